@@ -262,6 +262,7 @@ def generate_native_binding_cpp_and_hpp_files(functions_per_namespaces):
 
     print_hpp("#pragma once")
     # print_hpp('#include "lua/sol.hpp"')
+    print_hpp('#include "native_namespace.hpp"')
     print_hpp("")
     print_hpp("namespace lua::native")
     print_hpp("{")
@@ -300,17 +301,22 @@ def generate_native_binding_cpp_and_hpp_files(functions_per_namespaces):
         for native_func in native_funcs:
             file_buffer += "\tstatic " + str(native_func) + "\n\n"
 
-        file_buffer += "\t" + "void init_native_binding_" + namespace_name + "(sol::state& L)\n"
-        file_buffer += "\t{\n"
+        # looked up with a binary search, the last native of a name wins like it did with set_function
+        funcs_by_name = {native_func.lua_name: native_func for native_func in native_funcs}
 
-        file_buffer +=  "\t\tauto " + namespace_name + ' = L["' + namespace_name + '"].get_or_create<sol::table>();\n'
+        file_buffer += "\t" + "static constexpr native_entry " + namespace_name + "_natives[] = {\n"
 
-        for native_func in native_funcs:
+        for lua_name in sorted(funcs_by_name):
             i += 1
-            file_buffer += "\t\t"+ namespace_name+ '.set_function("'+ native_func.lua_name+ '", '+ "LUA_NATIVE_"+ native_func.namespace+ "_"+ native_func.lua_name+ ");\n"
+            file_buffer += '\t\t{"' + lua_name + '", native_function<LUA_NATIVE_' + namespace_name + "_" + lua_name + ">},\n"
 
-        file_buffer+= "\t}\n" 
-        file_buffer+= "}\n"
+        file_buffer += "\t};\n\n"
+
+        file_buffer += "\t" + "void init_native_binding_" + namespace_name + "(sol::state& L)\n"
+        file_buffer += "\t{\n"
+        file_buffer += "\t\t" + 'bind_namespace(L, "' + namespace_name + '", ' + namespace_name + "_natives);\n"
+        file_buffer += "\t}\n"
+        file_buffer += "}\n"
 
         f.write(file_buffer)
         f.close()
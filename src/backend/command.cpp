@@ -1,5 +1,6 @@
 #include "command.hpp"
 
+#include "command_index.hpp"
 #include "fiber_pool.hpp"
 
 namespace
@@ -37,6 +38,7 @@ namespace big
 	    m_fiber_pool(fiber_pool)
 	{
 		g_commands[rage::joaat(name)] = this;
+		g_command_index.mark_dirty();
 
 		constexpr bool generate_command_documentation = false;
 		if constexpr (generate_command_documentation)
@@ -72,9 +74,13 @@ namespace big
 		if (m_fiber_pool)
 			g_fiber_pool->queue_job([this, args, ctx] {
 				execute(args, ctx);
+				g.mark_dirty();
 			});
 		else
+		{
 			execute(args, ctx);
+			g.mark_dirty();
+		}
 	}
 
 	void command::call(const std::vector<std::string>& args, const std::shared_ptr<command_context> ctx)
@@ -116,63 +122,37 @@ namespace big
 
 	std::vector<command*> command::get_suggestions(std::string search, const int limit)
 	{
-		std::vector<command*> result_cmds{};
-		for (auto& [hash, command] : g_commands)
-		{
-			if (command && &command->get_name() && command->get_label().length() == 0)
-				continue;
-
-			std::string cmd_name  = command->get_name();
-			std::string cmd_label = command->get_label();
-
-			//transform all strings to lower case
-			std::transform(cmd_name.begin(), cmd_name.end(), cmd_name.begin(), tolower);
-			std::transform(cmd_label.begin(), cmd_label.end(), cmd_label.begin(), tolower);
-			std::transform(search.begin(), search.end(), search.begin(), tolower);
+		std::vector<command*> result_cmds(limit);
+		result_cmds.resize(get_suggestions(search, result_cmds));
 
-			for (auto& cmd : split(search, ';'))
-			{
-				std::string search_label = split(cmd, ' ')[0];
-
-				if (cmd_name.contains(search_label))
-					result_cmds.push_back(command);
-				else if (cmd_label.contains(search_label))
-					result_cmds.push_back(command);
-			}
-
-			// apply our maximum vector size..
-			if (result_cmds.size() >= limit)
-				break;
-		}
+		return result_cmds;
+	}
 
-		auto compare_by_substring_match = [](command*& a, command*& b, const std::string& sub) -> bool {
-			std::string cmd_name_a = a->get_name();
-			std::string cmd_name_b = b->get_name();
+	std::size_t command::get_suggestions(std::string_view search, std::span<command*> out)
+	{
+		std::size_t count = 0;
 
-			if (cmd_name_a == sub && cmd_name_b != sub)
-				return true;
-			if (cmd_name_b == sub && cmd_name_a != sub)
-				return false;
+		// only the command name of every ';' separated part is looked up, not its arguments
+		while (!search.empty() && count < out.size())
+		{
+			auto cmd = search.substr(0, search.find(';'));
+			search.remove_prefix(std::min(cmd.size() + 1, search.size()));
 
-			auto pos_a = cmd_name_a.find(sub);
-			auto pos_b = cmd_name_b.find(sub);
+			cmd.remove_prefix(std::min(cmd.find_first_not_of(' '), cmd.size()));
+			cmd = cmd.substr(0, cmd.find(' '));
+			if (cmd.empty())
+				continue;
 
-			if (pos_a != std::string::npos && pos_b != std::string::npos)
+			const auto begin = count;
+			const auto found = g_command_index.find(cmd, out.subspan(begin));
+			for (std::size_t i = begin; i < begin + found; i++)
 			{
-				if (pos_a != pos_b)
-					return pos_a < pos_b;
-
-				return cmd_name_a.length() < cmd_name_b.length();
+				if (std::find(out.begin(), out.begin() + count, out[i]) == out.begin() + count)
+					out[count++] = out[i];
 			}
+		}
 
-			return pos_a < pos_b;
-		};
-
-		std::sort(result_cmds.begin(), result_cmds.end(), [&search, &compare_by_substring_match](command*& a, command*& b) {
-			return compare_by_substring_match(a, b, search);
-		});
-
-		return result_cmds;
+		return count;
 	}
 
 	bool command::process(const std::string& text, const std::shared_ptr<command_context> ctx, bool use_best_suggestion)
@@ -8,6 +8,8 @@
 #include "util/math.hpp"
 #include "util/string_operations.hpp"
 
+#include <span>
+
 namespace big
 {
 	class command
@@ -37,21 +39,14 @@ namespace big
 		{
 			return m_name;
 		}
-		inline const std::string get_label()
+		// null terminated, either points into the loaded language pack or at m_label
+		inline std::string_view get_label()
 		{
-			std::string key;
-			if (key = g_translation_service.get_translation(m_label_hash); key.empty())
-				key = m_label;
-
-			return key;
+			return g_translation_service.get_translation(m_label_hash, m_label);
 		}
-		inline const std::string get_description()
+		inline std::string_view get_description()
 		{
-			std::string key;
-			if (key = g_translation_service.get_translation(m_description_hash); key.empty())
-				key = m_description;
-
-			return key;
+			return g_translation_service.get_translation(m_description_hash, m_description);
 		}
 		inline const std::optional<uint8_t>& get_num_args()
 		{
@@ -107,6 +102,8 @@ namespace big
 		void call(command_arguments& args, const std::shared_ptr<command_context> ctx = std::make_shared<default_command_context>());
 		void call(const std::vector<std::string>& args, const std::shared_ptr<command_context> ctx = std::make_shared<default_command_context>());
 		static std::vector<command*> get_suggestions(std::string, int limit = 7);
+		// same as above without allocating, returns the amount of suggestions written to out
+		static std::size_t get_suggestions(std::string_view search, std::span<command*> out);
 
 		static command* get(rage::joaat_t command);
 
@@ -0,0 +1,218 @@
+#include "command_index.hpp"
+
+#include "command.hpp"
+
+namespace big
+{
+	// match tiers, commands matching the search exactly come first, fuzzy matches last
+	constexpr std::uint64_t exact_name_match = 0ull << 62;
+	constexpr std::uint64_t name_match       = 1ull << 62;
+	constexpr std::uint64_t label_match      = 2ull << 62;
+	constexpr std::uint64_t fuzzy_match      = 3ull << 62;
+
+	static char to_lower(char c)
+	{
+		return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+	}
+
+	static std::uint32_t trigram_at(std::string_view text, std::size_t i)
+	{
+		return (std::uint8_t)text[i] | ((std::uint8_t)text[i + 1] << 8) | ((std::uint8_t)text[i + 2] << 16);
+	}
+
+	void command_index::mark_dirty()
+	{
+		std::unique_lock lock(m_mutex);
+		m_dirty = true;
+	}
+
+	std::string_view command_index::name(const entry& entry) const
+	{
+		return {m_strings.data() + entry.m_name, entry.m_name_length};
+	}
+
+	std::string_view command_index::label(const entry& entry) const
+	{
+		return {m_strings.data() + entry.m_label, entry.m_label_length};
+	}
+
+	std::span<const std::uint32_t> command_index::postings(std::uint32_t trigram) const
+	{
+		const auto it = std::lower_bound(m_trigrams.begin(), m_trigrams.end(), trigram);
+		if (it == m_trigrams.end() || *it != trigram)
+			return {};
+
+		const auto i = it - m_trigrams.begin();
+		return {m_postings.data() + m_trigram_begin[i], m_postings.data() + m_trigram_begin[i + 1]};
+	}
+
+	void command_index::rebuild()
+	{
+		m_entries.clear();
+		m_strings.clear();
+
+		auto intern = [this](std::string_view text) {
+			const auto offset = (std::uint32_t)m_strings.size();
+			for (const auto c : text.substr(0, UINT16_MAX))
+				m_strings.push_back(to_lower(c));
+			return offset;
+		};
+
+		for (auto& [hash, command] : g_commands)
+		{
+			// commands without a label aren't meant to be called by hand
+			if (!command || command->get_label().empty())
+				continue;
+
+			entry cmd_entry{command};
+			cmd_entry.m_name         = intern(command->get_name());
+			cmd_entry.m_name_length  = (std::uint16_t)(m_strings.size() - cmd_entry.m_name);
+			cmd_entry.m_label        = intern(command->get_label());
+			cmd_entry.m_label_length = (std::uint16_t)(m_strings.size() - cmd_entry.m_label);
+			m_entries.push_back(cmd_entry);
+		}
+
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> trigram_entries;
+		for (std::uint32_t i = 0; i < m_entries.size(); i++)
+		{
+			for (const auto text : {name(m_entries[i]), label(m_entries[i])})
+			{
+				for (std::size_t j = 0; j + 3 <= text.size(); j++)
+					trigram_entries.emplace_back(trigram_at(text, j), i);
+			}
+		}
+
+		std::sort(trigram_entries.begin(), trigram_entries.end());
+		trigram_entries.erase(std::unique(trigram_entries.begin(), trigram_entries.end()), trigram_entries.end());
+
+		m_trigrams.clear();
+		m_trigram_begin.clear();
+		m_postings.clear();
+		for (const auto& [trigram, index] : trigram_entries)
+		{
+			if (m_trigrams.empty() || m_trigrams.back() != trigram)
+			{
+				m_trigrams.push_back(trigram);
+				m_trigram_begin.push_back((std::uint32_t)m_postings.size());
+			}
+
+			m_postings.push_back(index);
+		}
+		m_trigram_begin.push_back((std::uint32_t)m_postings.size());
+
+		m_dirty       = false;
+		m_translation = g_translation_service.generation();
+	}
+
+	std::optional<command_index::score> command_index::substring_score(const entry& entry, std::string_view search) const
+	{
+		const auto cmd_name = name(entry);
+
+		if (cmd_name == search)
+			return exact_name_match;
+
+		// earlier matches first, then shorter names
+		if (const auto pos = cmd_name.find(search); pos != std::string_view::npos)
+			return name_match | (score)pos << 32 | cmd_name.size();
+
+		if (const auto pos = label(entry).find(search); pos != std::string_view::npos)
+			return label_match | (score)pos << 32 | cmd_name.size();
+
+		return std::nullopt;
+	}
+
+	std::size_t command_index::find(std::string_view search, std::span<command*> out)
+	{
+		if (out.empty() || search.empty())
+			return 0;
+
+		std::shared_lock lock(m_mutex);
+		if (m_dirty || m_translation != g_translation_service.generation())
+		{
+			lock.unlock();
+			{
+				std::unique_lock rebuild_lock(m_mutex);
+				if (m_dirty || m_translation != g_translation_service.generation())
+					rebuild();
+			}
+			lock.lock();
+		}
+
+		char search_buffer[max_search_length];
+		const auto search_length = std::min(search.size(), max_search_length);
+		for (std::size_t i = 0; i < search_length; i++)
+			search_buffer[i] = to_lower(search[i]);
+		const std::string_view query(search_buffer, search_length);
+
+		// reused between queries so that looking up suggestions doesn't allocate
+		thread_local std::vector<std::pair<score, std::uint32_t>> matches;
+		thread_local std::vector<std::uint16_t> shared_trigrams;
+		thread_local std::vector<std::uint32_t> touched;
+		matches.clear();
+		touched.clear();
+
+		if (query.size() < 3)
+		{
+			for (std::uint32_t i = 0; i < m_entries.size(); i++)
+			{
+				if (const auto match_score = substring_score(m_entries[i], query))
+					matches.emplace_back(*match_score, i);
+			}
+		}
+		else
+		{
+			// every command containing the search contains its rarest trigram as well
+			auto candidates = postings(trigram_at(query, 0));
+			for (std::size_t i = 1; i + 3 <= query.size() && !candidates.empty(); i++)
+			{
+				const auto list = postings(trigram_at(query, i));
+				if (list.size() < candidates.size())
+					candidates = list;
+			}
+
+			for (const auto i : candidates)
+			{
+				if (const auto match_score = substring_score(m_entries[i], query))
+					matches.emplace_back(*match_score, i);
+			}
+
+			if (matches.size() < out.size())
+			{
+				shared_trigrams.resize(m_entries.size());
+
+				const auto trigram_count = query.size() - 2;
+				for (std::size_t i = 0; i < trigram_count; i++)
+				{
+					for (const auto index : postings(trigram_at(query, i)))
+					{
+						if (shared_trigrams[index]++ == 0)
+							touched.push_back(index);
+					}
+				}
+
+				const auto direct_matches = matches.size();
+				for (const auto index : touched)
+				{
+					const auto shared      = shared_trigrams[index];
+					shared_trigrams[index] = 0;
+
+					// at least a third of the search has to be there, and substring matches are already in
+					if (shared * 3 < trigram_count || std::any_of(matches.begin(), matches.begin() + direct_matches, [index](const auto& match) {
+						    return match.second == index;
+					    }))
+						continue;
+
+					matches.emplace_back(fuzzy_match | (score)(trigram_count - shared) << 32 | name(m_entries[index]).size(), index);
+				}
+			}
+		}
+
+		const auto count = std::min(matches.size(), out.size());
+		std::partial_sort(matches.begin(), matches.begin() + count, matches.end());
+
+		for (std::size_t i = 0; i < count; i++)
+			out[i] = m_entries[matches[i].second].m_command;
+
+		return count;
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <shared_mutex>
+#include <span>
+
+namespace big
+{
+	class command;
+
+	/**
+	 * @brief Lowercased names and translated labels of every command, laid out for the suggestion engine.
+	 *
+	 * Rebuilt lazily after commands register or another language gets loaded.
+	 * Commands whose name or label contain the search are found through a trigram index, or a scan of the
+	 * interned strings for searches shorter than a trigram. When those don't fill the requested amount,
+	 * commands sharing a third of the trigrams of the search are suggested after them.
+	 */
+	class command_index
+	{
+	public:
+		void mark_dirty();
+
+		/**
+		 * @brief Finds the commands that best match search, allocates nothing once the index is built.
+		 *
+		 * @param out Receives the matches, best first.
+		 * @return The amount of matches written to out.
+		 */
+		std::size_t find(std::string_view search, std::span<command*> out);
+
+	private:
+		struct entry
+		{
+			command* m_command;
+			std::uint32_t m_name;
+			std::uint32_t m_label;
+			std::uint16_t m_name_length;
+			std::uint16_t m_label_length;
+		};
+
+		// lower is better, the highest bits hold the match tier
+		using score = std::uint64_t;
+
+		static constexpr std::size_t max_search_length = 64;
+
+		void rebuild();
+		std::string_view name(const entry& entry) const;
+		std::string_view label(const entry& entry) const;
+		std::span<const std::uint32_t> postings(std::uint32_t trigram) const;
+		std::optional<score> substring_score(const entry& entry, std::string_view search) const;
+
+		std::shared_mutex m_mutex;
+		bool m_dirty                = true;
+		std::uint32_t m_translation = 0;
+
+		std::vector<entry> m_entries;
+		// every name and label, lowercased and stored back to back
+		std::string m_strings;
+
+		// entries containing each trigram, m_trigram_begin[i] .. m_trigram_begin[i + 1] indexes into m_postings
+		std::vector<std::uint32_t> m_trigrams;
+		std::vector<std::uint32_t> m_trigram_begin;
+		std::vector<std::uint32_t> m_postings;
+	};
+
+	inline command_index g_command_index;
+}
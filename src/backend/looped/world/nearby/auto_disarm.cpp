@@ -1,7 +1,7 @@
 #include "backend/looped_command.hpp"
 #include "natives.hpp"
+#include "services/entity_snapshot/entity_snapshot_service.hpp"
 #include "util/entity.hpp"
-#include "util/pools.hpp"
 
 namespace big
 {
@@ -16,13 +16,8 @@ namespace big
 
 		virtual void on_tick() override
 		{
-			for (auto ped : pools::get_all_peds())
+			for (auto handle : g_entity_snapshot_service->get_handles(snapshot_entity_type::PED))
 			{
-				if (!ped)
-					continue;
-
-				auto handle = g_pointers->m_gta.m_ptr_to_handle(ped);
-
 				if (!PED::IS_PED_A_PLAYER(handle) && ENTITY::DOES_ENTITY_EXIST(PED::GET_PED_TARGET_FROM_COMBAT_PED(handle, false)))
 				{
 					if (entity::take_control_of(handle, 0))
@@ -24,7 +24,7 @@ namespace big
 			{
 				entry->block_join = true;
 				entry->block_join_reason = block_join_reason;
-				g_player_database_service->save();
+				g_player_database_service->save(entry);
 			}
 		}
 
@@ -32,7 +32,7 @@ namespace big
 		{
 			g_fiber_pool->queue_job([player] {
 				player_command::get("smartkick"_J)->call(player, {});
-			});
+			}, fiber_pool_priority::HIGH);
 		}
 
 		if (timeout)
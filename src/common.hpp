@@ -35,6 +35,8 @@
 #include <functional>
 #include <utility>
 
+#include <array>
+#include <deque>
 #include <set>
 #include <unordered_set>
 #include <stack>
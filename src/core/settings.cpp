@@ -10,12 +10,63 @@ namespace big
 		load();
 	}
 
+	// coalesces bursts of changes such as dragging a slider into a single write
+	constexpr auto save_delay = 1s;
+	// catches changes that went through neither the gui nor a command, e.g. lua scripts writing to settings
+	constexpr auto full_check_interval = 30s;
+
+	void menu_settings::mark_dirty()
+	{
+		m_last_change = std::chrono::steady_clock::now().time_since_epoch().count();
+		m_dirty       = true;
+	}
+
 	void menu_settings::attempt_save()
 	{
+		const auto now = std::chrono::steady_clock::now();
+
+		if (!m_dirty)
+		{
+			if (now - m_last_full_check < full_check_interval)
+				return;
+		}
+		else if (now.time_since_epoch().count() - m_last_change < std::chrono::steady_clock::duration(save_delay).count())
+		{
+			return;
+		}
+
+		// the write in progress would race with ours, try again on the next attempt
+		if (m_write_pending)
+			return;
+
+		m_dirty           = false;
+		m_last_full_check = now;
+
 		const nlohmann::json j = *this;
 
+		// only top level sections that differ from the last save get replaced
+		if (!deep_compare(m_options, j, true))
+			return;
+
+		m_write_pending = true;
+		g_thread_pool->push(
+		    [this, content = j.dump(4)] {
+			    write_file(content);
+			    m_write_pending = false;
+		    },
+		    thread_pool_priority::LOW);
+	}
+
+	void menu_settings::flush()
+	{
+		while (m_write_pending)
+			std::this_thread::sleep_for(10ms);
+
+		m_dirty = false;
+
+		const nlohmann::json j = *this;
 		if (deep_compare(m_options, j, true))
-			save();
+			write_file(m_options.dump(4));
 	}
 
 	bool menu_settings::load()
@@ -75,11 +126,7 @@ namespace big
 
 	bool menu_settings::write_default_config()
 	{
-		std::ofstream file(m_save_file.get_path(), std::ios::out | std::ios::trunc);
-		file << m_default_options.dump(4);
-		file.close();
-
-		return true;
+		return write_file(m_default_options.dump(4));
 	}
 
 	bool menu_settings::deep_compare(nlohmann::json& current_settings, const nlohmann::json& default_settings, bool compare_value)
@@ -120,11 +167,35 @@ namespace big
 
 	bool menu_settings::save()
 	{
-		std::ofstream file(m_save_file.get_path(), std::ios::out | std::ios::trunc);
-		nlohmann::json j = *this;
-		file << j.dump(4);
+		m_options = *this;
+
+		return write_file(m_options.dump(4));
+	}
+
+	bool menu_settings::write_file(const std::string& content)
+	{
+		// write next to the settings and swap them in, an unload or crash mid write can't leave a truncated file behind
+		auto temp_path = m_save_file.get_path();
+		temp_path += ".tmp";
+
+		std::ofstream file(temp_path, std::ios::out | std::ios::trunc);
+		file << content;
 		file.close();
 
+		if (!file)
+		{
+			LOG(WARNING) << "Failed to write settings to " << temp_path;
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temp_path, m_save_file.get_path(), ec);
+		if (ec)
+		{
+			LOG(WARNING) << "Failed to replace settings: " << ec.message();
+			return false;
+		}
+
 		return true;
 	}
 }
\ No newline at end of file
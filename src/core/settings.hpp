@@ -52,12 +52,17 @@ namespace big
 		void init(const file& save_file);
 
 		void attempt_save();
+		// writes pending changes right away, waits for a save that's already in progress
+		void flush();
+		// the settings may have changed, attempt_save only serializes them after this or every full_check_interval
+		void mark_dirty();
 		bool load();
 		bool write_default_config();
 
 	private:
 		bool deep_compare(nlohmann::json& current_settings, const nlohmann::json& default_settings, bool compare_value = false);
 		bool save();
+		bool write_file(const std::string& content);
 
 	private:
 		file m_save_file;
@@ -65,6 +70,11 @@ namespace big
 		nlohmann::json m_default_options;
 		nlohmann::json m_options;
 
+		std::atomic<bool> m_dirty;
+		std::atomic<bool> m_write_pending;
+		std::atomic<std::chrono::steady_clock::rep> m_last_change;
+		std::chrono::steady_clock::time_point m_last_full_check;
+
 	public:
 		int friend_count = 0;
 		int player_count = 0;
@@ -151,8 +161,10 @@ namespace big
 			bool window_hook      = false;
 			bool block_all_metrics = false;
 			bool battleye_server   = false;
+			// time the fiber pool may spend on starting new jobs each frame, 0 disables the limit
+			int fiber_pool_frame_budget_us = 4000;
 
-			NLOHMANN_DEFINE_TYPE_INTRUSIVE(debug, logs, external_console, window_hook, block_all_metrics, battleye_server)
+			NLOHMANN_DEFINE_TYPE_INTRUSIVE(debug, logs, external_console, window_hook, block_all_metrics, battleye_server, fiber_pool_frame_budget_us)
 		} debug{};
 
 		struct tunables
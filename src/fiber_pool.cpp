@@ -1,5 +1,6 @@
 #include "fiber_pool.hpp"
 
+#include "natives.hpp"
 #include "script.hpp"
 #include "script_mgr.hpp"
 #include <script/tlsContext.hpp>
@@ -7,6 +8,8 @@
 namespace big
 {
 	fiber_pool::fiber_pool(std::size_t num_fibers) :
+	    m_queued_jobs(0),
+	    m_busy_fibers(0),
 	    m_num_fibers(num_fibers)
 	{
 		for (std::size_t i = 0; i < num_fibers; ++i)
@@ -22,37 +25,68 @@ namespace big
 		g_fiber_pool = nullptr;
 	}
 
-	void fiber_pool::queue_job(std::function<void()> func)
+	void fiber_pool::queue_job(std::move_only_function<void()> func, fiber_pool_priority priority)
 	{
 		if (func)
 		{
 			std::lock_guard lock(m_mutex);
-			m_jobs.push(std::move(func));
+			m_jobs[static_cast<size_t>(priority)].push_back(std::move(func));
+			++m_queued_jobs;
 		}
 	}
 
-	
-	void fiber_pool::execute_on_game_thread(std::function<void()> func)
+	void fiber_pool::execute_on_game_thread(std::move_only_function<void()> func)
 	{
 		if (func)
 		{
 			if (rage::tlsContext::get()->m_script_thread && rage::tlsContext::get()->m_is_script_thread_active)
 				func();
 			else
-				queue_job(func);
+				queue_job(std::move(func));
 		}
 	}
 
+	bool fiber_pool::has_frame_budget(fiber_pool_priority priority)
+	{
+		// the fibers are ticked one after another, so the first fiber to tick in a frame starts the clock
+		if (const auto frame = MISC::GET_FRAME_COUNT(); frame != m_frame)
+		{
+			m_frame       = frame;
+			m_frame_start = std::chrono::steady_clock::now();
+			return true;
+		}
+
+		if (priority == fiber_pool_priority::HIGH || g.debug.fiber_pool_frame_budget_us <= 0)
+			return true;
+
+		return std::chrono::steady_clock::now() - m_frame_start < std::chrono::microseconds(g.debug.fiber_pool_frame_budget_us);
+	}
+
 	void fiber_pool::fiber_tick()
 	{
+		if (!m_queued_jobs)
+			return;
+
 		std::unique_lock lock(m_mutex);
-		if (!m_jobs.empty())
+		for (size_t i = 0; i < m_jobs.size(); i++)
 		{
-			auto job = std::move(m_jobs.top());
-			m_jobs.pop();
+			auto& jobs = m_jobs[i];
+			if (jobs.empty())
+				continue;
+
+			if (!has_frame_budget(static_cast<fiber_pool_priority>(i)))
+				return;
+
+			auto job = std::move(jobs.front());
+			jobs.pop_front();
+			--m_queued_jobs;
 			lock.unlock();
 
-			std::invoke(std::move(job));
+			++m_busy_fibers;
+			std::invoke(job);
+			--m_busy_fibers;
+
+			return;
 		}
 	}
 
@@ -72,14 +106,20 @@ namespace big
 
 	int fiber_pool::get_used_fibers()
 	{
-		return m_jobs.size();
+		return m_busy_fibers;
+	}
+
+	int fiber_pool::get_queued_jobs()
+	{
+		return m_queued_jobs;
 	}
 
 	void fiber_pool::reset()
 	{
 		std::lock_guard lock(m_mutex);
 
-		while (!m_jobs.empty())
-			m_jobs.pop();
+		for (auto& jobs : m_jobs)
+			jobs.clear();
+		m_queued_jobs = 0;
 	}
-}
\ No newline at end of file
+}
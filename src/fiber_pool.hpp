@@ -2,27 +2,52 @@
 
 namespace big
 {
+	// jobs are picked highest priority first and in the order they were queued within a priority
+	enum class fiber_pool_priority
+	{
+		// reactions to other players, e.g. protections, never held back by the frame budget
+		HIGH,
+		// user commands and gui callbacks
+		NORMAL,
+		// work nobody is actively waiting on
+		LOW
+	};
+
+	constexpr auto FIBER_POOL_PRIORITY_COUNT = 3u;
+
 	class fiber_pool
 	{
 	public:
 		explicit fiber_pool(std::size_t num_fibers);
 		~fiber_pool();
 
-		void queue_job(std::function<void()> func);
-		void execute_on_game_thread(std::function<void()> func);
+		void queue_job(std::move_only_function<void()> func, fiber_pool_priority priority = fiber_pool_priority::NORMAL);
+		void execute_on_game_thread(std::move_only_function<void()> func);
 
 		void fiber_tick();
 		static void fiber_func();
 
 		int get_total_fibers();
+		// the amount of fibers currently running a job
 		int get_used_fibers();
+		int get_queued_jobs();
 
 		void reset();
 
 	private:
-		std::recursive_mutex m_mutex;
-		std::stack<std::function<void()>> m_jobs;
+		// true if a new job may still be started this frame
+		bool has_frame_budget(fiber_pool_priority priority);
+
+	private:
+		std::mutex m_mutex;
+		std::array<std::deque<std::move_only_function<void()>>, FIBER_POOL_PRIORITY_COUNT> m_jobs;
+		// lets the fibers skip the lock while there's nothing to do
+		std::atomic<int> m_queued_jobs;
+		std::atomic<int> m_busy_fibers;
 		int m_num_fibers;
+
+		int m_frame = -1;
+		std::chrono::steady_clock::time_point m_frame_start;
 	};
 
 	inline fiber_pool* g_fiber_pool{};
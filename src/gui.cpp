@@ -174,6 +174,10 @@ namespace big
 			push_theme_colors();
 			view::root(); // frame bg
 			pop_theme_colors();
+
+			// most settings are bound straight to widgets, so any interaction may have changed them
+			if (ImGui::IsAnyItemActive() || ImGui::IsMouseReleased(ImGuiMouseButton_Left))
+				g.mark_dirty();
 		}
 	}
 
@@ -51,7 +51,7 @@ namespace big
 				command->call(_args);
 			}
 			if (ImGui::IsItemHovered() && !command->get_description().empty())
-				ImGui::SetTooltip(command->get_description().c_str());
+				ImGui::SetTooltip(command->get_description().data());
 		}
 
 		template<template_str cmd_str, ImVec2 size = ImVec2(0, 0), ImVec4 color = ImVec4(0.24f, 0.23f, 0.29f, 1.00f)>
@@ -64,7 +64,7 @@ namespace big
 			if (ImGui::Button(label_override.value_or(command->get_label()).data()))
 				command->call(player, args);
 			if (ImGui::IsItemHovered() && !command->get_description().empty())
-				ImGui::SetTooltip(command->get_description().c_str());
+				ImGui::SetTooltip(command->get_description().data());
 		}
 
 		template<template_str cmd_str>
@@ -81,7 +81,7 @@ namespace big
 			if (updated = ImGui::Checkbox(label_override.value_or(command->get_label()).data(), &command->is_enabled()))
 				command->refresh();
 			if (ImGui::IsItemHovered() && !command->get_description().empty())
-				ImGui::SetTooltip(command->get_description().c_str());
+				ImGui::SetTooltip(command->get_description().data());
 
 			return updated;
 		}
@@ -99,7 +99,7 @@ namespace big
 			    command->get_upper_bound());
 
 			if (ImGui::IsItemHovered() && !command->get_description().empty())
-				ImGui::SetTooltip(command->get_description().c_str());
+				ImGui::SetTooltip(command->get_description().data());
 		}
 
 		template<template_str cmd_str>
@@ -115,7 +115,7 @@ namespace big
 			    command->get_upper_bound());
 
 			if (ImGui::IsItemHovered() && !command->get_description().empty())
-				ImGui::SetTooltip(command->get_description().c_str());
+				ImGui::SetTooltip(command->get_description().data());
 		}
 
 		template<template_str cmd_str>
@@ -131,7 +131,7 @@ namespace big
 			    command->get_upper_bound());
 
 			if (ImGui::IsItemHovered() && !command->get_description().empty())
-				ImGui::SetTooltip(command->get_description().c_str());
+				ImGui::SetTooltip(command->get_description().data());
 		}
 
 		template<ImVec2 size = ImVec2(0, 0), ImVec4 color = ImVec4(0.24f, 0.23f, 0.29f, 1.00f)>
@@ -0,0 +1,130 @@
+#pragma once
+#include <imgui.h>
+
+namespace big
+{
+	/**
+	 * @brief The rows of a large picker that match its search, for lists too long to filter every frame.
+	 *
+	 * Items and their lowercased search keys are captured whenever the generation of the source changes,
+	 * the matching rows are only recomputed after the search or the filter changed.
+	 * Only the rows scrolled into view are drawn, so every row has to have the same height.
+	 */
+	template<typename T>
+	class filtered_list
+	{
+	public:
+		/**
+		 * @brief Calls populate(*this) to add the items again if generation differs from the one of the items held.
+		 */
+		template<typename F>
+		void set_source(std::uint32_t generation, F&& populate)
+		{
+			if (m_has_source && m_generation == generation)
+				return;
+
+			m_items.clear();
+			m_keys.clear();
+			m_key_begin.clear();
+			populate(*this);
+			m_key_begin.push_back((std::uint32_t)m_keys.size());
+
+			m_has_source = true;
+			m_generation = generation;
+			m_dirty      = true;
+		}
+
+		/**
+		 * @brief Adds an item matching searches found in any of its keys, only call this from set_source.
+		 */
+		void add(T item, std::initializer_list<std::string_view> keys)
+		{
+			m_items.push_back(std::move(item));
+			m_key_begin.push_back((std::uint32_t)m_keys.size());
+
+			for (const auto key : keys)
+			{
+				for (const auto c : key)
+					m_keys.push_back((char)std::tolower((unsigned char)c));
+
+				// keeps searches from matching across two keys, the search is a C string and can't contain it
+				m_keys.push_back('\0');
+			}
+		}
+
+		/**
+		 * @brief Recomputes the matching rows if the search or filter_state changed since the last call.
+		 *
+		 * @param filter_state Anything the predicate depends on, the rows are kept as long as it stays the same.
+		 * @param predicate Returns whether an item matching the search is shown.
+		 */
+		template<typename P>
+		void filter(std::string_view search, std::uint64_t filter_state, P&& predicate)
+		{
+			if (!m_dirty && m_filter_state == filter_state && search == m_search)
+				return;
+
+			std::string lower_search(search);
+			std::transform(lower_search.begin(), lower_search.end(), lower_search.begin(), [](char c) {
+				return (char)std::tolower((unsigned char)c);
+			});
+
+			m_visible.clear();
+			for (std::uint32_t i = 0; i < m_items.size(); i++)
+			{
+				const std::string_view keys(m_keys.data() + m_key_begin[i], m_key_begin[i + 1] - m_key_begin[i]);
+				if (keys.find(lower_search) != std::string_view::npos && predicate(m_items[i]))
+					m_visible.push_back(i);
+			}
+
+			m_search.assign(search);
+			m_filter_state = filter_state;
+			m_dirty        = false;
+		}
+
+		void filter(std::string_view search)
+		{
+			filter(search, 0, [](const T&) {
+				return true;
+			});
+		}
+
+		std::size_t size() const
+		{
+			return m_visible.size();
+		}
+
+		bool empty() const
+		{
+			return m_visible.empty();
+		}
+
+		/**
+		 * @brief Calls draw_row(item) for the matching rows within the current window's scroll region.
+		 */
+		template<typename F>
+		void draw(F&& draw_row) const
+		{
+			ImGuiListClipper clipper;
+			clipper.Begin((int)m_visible.size());
+			while (clipper.Step())
+			{
+				for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+					draw_row(m_items[m_visible[i]]);
+			}
+		}
+
+	private:
+		std::vector<T> m_items;
+		// the keys of every item back to back, m_key_begin[i] .. m_key_begin[i + 1] belongs to m_items[i]
+		std::string m_keys;
+		std::vector<std::uint32_t> m_key_begin;
+		std::vector<std::uint32_t> m_visible;
+
+		bool m_has_source            = false;
+		bool m_dirty                 = true;
+		std::uint32_t m_generation   = 0;
+		std::uint64_t m_filter_state = 0;
+		std::string m_search;
+	};
+}
@@ -108,7 +108,7 @@ namespace big
 								g_notification_service.push("PLAYERS"_T.data(),
 									std::format("{} {}: {}", entry->name, "PLAYER_CHANGED_NAME"_T, plyr->get_name()));
 								entry->name = plyr->get_name();
-								g_player_database_service->save();
+								g_player_database_service->save(entry);
 							}
 						}
 					}
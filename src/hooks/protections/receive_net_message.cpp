@@ -756,7 +756,7 @@ namespace big
 				player->bad_host = true;
 				g_fiber_pool->queue_job([player] {
 					entity::force_remove_network_entity(g_local_player, player, false);
-				});
+				}, fiber_pool_priority::HIGH);
 			}
 
 			break;
@@ -1,9 +1,17 @@
 #pragma once
+#include "script.hpp"
+#include "services/entity_snapshot/entity_snapshot_service.hpp"
 #include "util/entity.hpp"
 #include "util/pools.hpp"
 
 namespace lua::entities
 {
+	// the snapshot is captured by script fibers, gui and event callbacks run on other threads and walk the pools themselves
+	static bool can_use_snapshot()
+	{
+		return IsThreadAFiber() && big::script::get_current();
+	}
+
 	// Lua API: Table
 	// Name: entities
 	// Table for manipulating GTA entities.
@@ -14,7 +22,11 @@ namespace lua::entities
 	// Returns: table<int, int>: Returns all vehicles as script handles
 	static std::vector<Entity> get_all_vehicles_as_handles()
 	{
-		return big::pools::get_all_vehicles_array();
+		if (!can_use_snapshot())
+			return big::pools::get_all_vehicles_array();
+
+		const auto handles = big::g_entity_snapshot_service->get_handles(big::snapshot_entity_type::VEHICLE);
+		return {handles.begin(), handles.end()};
 	}
 
 	// Lua API: Function
@@ -23,7 +35,11 @@ namespace lua::entities
 	// Returns: table<int, int>: Returns all peds as script handles
 	static std::vector<Entity> get_all_peds_as_handles()
 	{
-		return big::pools::get_all_peds_array();
+		if (!can_use_snapshot())
+			return big::pools::get_all_peds_array();
+
+		const auto handles = big::g_entity_snapshot_service->get_handles(big::snapshot_entity_type::PED);
+		return {handles.begin(), handles.end()};
 	}
 
 	// Lua API: Function
@@ -32,7 +48,11 @@ namespace lua::entities
 	// Returns: table<int, int>: Returns all objects as script handles
 	static std::vector<Entity> get_all_objects_as_handles()
 	{
-		return big::pools::get_all_props_array();
+		if (!can_use_snapshot())
+			return big::pools::get_all_props_array();
+
+		const auto handles = big::g_entity_snapshot_service->get_handles(big::snapshot_entity_type::PROP);
+		return {handles.begin(), handles.end()};
 	}
 
 	static bool take_control_of(Entity entity)
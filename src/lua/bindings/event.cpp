@@ -1,5 +1,5 @@
 #pragma once
-#include "lua/lua_module.hpp"
+#include "lua/lua_manager.hpp"
 
 namespace lua::event
 {
@@ -124,7 +124,7 @@ namespace lua::event
 	{
 		big::lua_module* module = sol::state_view(state)["!this"];
 
-		module->m_event_callbacks[menu_event].push_back(func);
+		big::g_lua_manager->add_event_callback(*module, menu_event, std::move(func));
 	}
 
 	void bind(sol::state& state)
@@ -1,9 +1,11 @@
 #include "memory.hpp"
 
 #include "lua/lua_manager.hpp"
+#include "lua/lua_pattern_cache.hpp"
 #include "memory/module.hpp"
 #include "memory/pattern.hpp"
 #include "pointers.hpp"
+#include "thread_pool.hpp"
 
 namespace lua::memory
 {
@@ -77,9 +79,106 @@ namespace lua::memory
 	// Param: pattern: string: byte pattern (IDA format)
 	// Returns: pointer: A pointer to the found address.
 	// Scans the specified memory pattern within the "GTA5.exe" module and returns a pointer to the found address.
+	// Results are cached across scripts and game restarts until the game is updated.
 	static pointer scan_pattern(const std::string& pattern)
 	{
-		return pointer(::memory::module("GTA5.exe").scan(::memory::pattern(pattern)).value().as<uint64_t>());
+		return pointer(big::g_lua_pattern_cache.resolve({&pattern, 1})[0].value());
+	}
+
+	// Lua API: Function
+	// Table: memory
+	// Name: scan_patterns
+	// Param: patterns: table<string>: byte patterns (IDA format)
+	// Param: callback: function: The function that will be called with a table of pointers, in the order of the patterns. Entries that aren't strings and patterns that weren't found are nil in that table.
+	// Scans for all the patterns within the "GTA5.exe" module in a single pass, off the game thread. The callback is called from a script fiber once the scan is done.
+	// **Example Usage:**
+	// ```lua
+	// memory.scan_patterns({"48 89 5C 24 08 57 48 83 EC 20", "E8 ? ? ? ? 84 C0 74 ? 48 8B CB"}, function (pointers)
+	//     if pointers[1] then
+	//         log.info(pointers[1]:get_address())
+	//     end
+	// end)
+	// ```
+	static void scan_patterns(sol::table patterns_table, sol::main_protected_function callback, sol::this_state state)
+	{
+		big::lua_module* module = sol::state_view(state)["!this"];
+		if (!module || !callback.valid())
+		{
+			return;
+		}
+
+		// the position of each pattern in the table, so that the results line up with it
+		const auto count = patterns_table.size();
+		std::vector<std::string> patterns;
+		std::vector<size_t> slots;
+		for (size_t i = 1; i <= count; i++)
+		{
+			const sol::object pattern = patterns_table[i];
+			if (pattern.get_type() == sol::type::string)
+			{
+				patterns.push_back(pattern.as<std::string>());
+				slots.push_back(i);
+			}
+		}
+
+		// doesn't keep the module alive, it must only ever be destroyed by the lua manager
+		struct scan_job
+		{
+			std::weak_ptr<big::lua_module> m_module;
+			// bound to the main thread, the coroutine calling us may be gone once the scan is done
+			sol::main_protected_function m_callback;
+			std::vector<std::string> m_patterns;
+			std::vector<size_t> m_slots;
+			size_t m_count;
+
+			scan_job(std::weak_ptr<big::lua_module> module, sol::main_protected_function callback, std::vector<std::string> patterns, std::vector<size_t> slots, size_t count) :
+			    m_module(std::move(module)),
+			    m_callback(std::move(callback)),
+			    m_patterns(std::move(patterns)),
+			    m_slots(std::move(slots)),
+			    m_count(count)
+			{
+			}
+
+			scan_job(scan_job&&) = default;
+
+			~scan_job()
+			{
+				// not handed to the module, its lua state may already be closed so the reference is dropped without touching it
+				if (m_callback.valid())
+					m_callback.abandon();
+			}
+		};
+
+		big::g_thread_pool->push([job = scan_job{module->weak_from_this(), std::move(callback), std::move(patterns), std::move(slots), count}]() mutable {
+			auto results = big::g_lua_pattern_cache.resolve(job.m_patterns);
+			big::g_lua_pattern_cache.save();
+
+			// the module lock keeps it from being destroyed while the callback is handed over, skipped if it was unloaded
+			big::g_lua_manager->for_each_module([&job, &results](const std::shared_ptr<big::lua_module>& module) {
+				if (job.m_module.owner_before(module) || module.owner_before(job.m_module))
+					return;
+
+				module->executor().post([results = std::move(results), slots = std::move(job.m_slots), count = job.m_count, callback = std::move(job.m_callback)] {
+					sol::state_view lua_state(callback.lua_state());
+
+					auto pointers = lua_state.create_table(static_cast<int>(count));
+					for (size_t i = 0; i < results.size(); i++)
+					{
+						if (results[i])
+						{
+							pointers[slots[i]] = pointer(*results[i]);
+						}
+					}
+
+					auto result = callback(pointers);
+					if (!result.valid())
+					{
+						big::g_lua_manager->handle_error(result, result.lua_state());
+					}
+				});
+			});
+		});
 	}
 
 	// Lua API: Function
@@ -196,15 +295,12 @@ namespace lua::memory
 
 	static bool pre_callback(const runtime_func_t::parameters_t* params, const uint8_t param_count, runtime_func_t::return_value_t* return_value, const uintptr_t target_func_ptr)
 	{
-		const auto& dyn_hook = big::g_lua_manager->m_target_func_ptr_to_dynamic_hook[target_func_ptr];
-		return big::g_lua_manager
-		    ->dynamic_hook_pre_callbacks(target_func_ptr, dyn_hook->m_return_type, return_value, dyn_hook->m_param_types, params, param_count);
+		return big::g_lua_manager->dynamic_hook_pre_callbacks(target_func_ptr, return_value, params, param_count);
 	}
 
 	static void post_callback(const runtime_func_t::parameters_t* params, const uint8_t param_count, runtime_func_t::return_value_t* return_value, const uintptr_t target_func_ptr)
 	{
-		const auto& dyn_hook = big::g_lua_manager->m_target_func_ptr_to_dynamic_hook[target_func_ptr];
-		big::g_lua_manager->dynamic_hook_post_callbacks(target_func_ptr, dyn_hook->m_return_type, return_value, dyn_hook->m_param_types, params, param_count);
+		big::g_lua_manager->dynamic_hook_post_callbacks(target_func_ptr, return_value, params, param_count);
 	}
 
 	// Lua API: Function
@@ -251,20 +347,11 @@ namespace lua::memory
 
 		const auto target_func_ptr = target_func_ptr_obj.get_address();
 
-		bool need_hook = false;
-		if (pre_lua_callback.valid())
-		{
-			module->m_dynamic_hook_pre_callbacks[target_func_ptr].push_back(pre_lua_callback);
-			need_hook = true;
-		}
-		if (post_lua_callback.valid())
-		{
-			module->m_dynamic_hook_post_callbacks[target_func_ptr].push_back(post_lua_callback);
-			need_hook = true;
-		}
-
+		const bool need_hook = pre_lua_callback.valid() || post_lua_callback.valid();
 		if (need_hook)
 		{
+			big::g_lua_manager->add_dynamic_hook_callbacks(*module, target_func_ptr, hook_name, std::move(pre_lua_callback), std::move(post_lua_callback));
+
 			std::shared_ptr<runtime_func_t> runtime_func;
 
 			if (!big::g_lua_manager->m_target_func_ptr_to_dynamic_hook.contains(target_func_ptr))
@@ -695,6 +782,7 @@ namespace lua::memory
 		patch_ut["restore"] = &big::lua_patch::restore;
 
 		ns["scan_pattern"]  = scan_pattern;
+		ns["scan_patterns"] = scan_patterns;
 		ns["handle_to_ptr"] = handle_to_ptr;
 		ns["ptr_to_handle"] = ptr_to_handle;
 		ns["allocate"]      = allocate;
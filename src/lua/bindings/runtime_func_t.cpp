@@ -25,6 +25,8 @@ namespace lua::memory
 
 	runtime_func_t::~runtime_func_t()
 	{
+		// no new call can look the hook up once the detour is removed
+		m_detour.reset();
 		big::g_lua_manager->m_target_func_ptr_to_dynamic_hook.erase(m_target_func_ptr);
 	}
 
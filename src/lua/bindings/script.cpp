@@ -8,8 +8,6 @@
 
 namespace lua::script
 {
-	static script_util dummy_script_util;
-
 	int script_util::yield()
 	{
 		return 0;
@@ -30,6 +28,7 @@ namespace lua::script
 	// Param: name: string: name of your new looped script
 	// Param: func: function: function that will be executed in a forever loop.
 	// Registers a function that will be looped as a gta script.
+	// The looped scripts and run_in_fiber functions of a module are coroutines sharing a few fibers, a call that blocks for several frames such as entities.take_control_of only pauses the function that made it.
 	// **Example Usage:**
 	// ```lua
 	// script.register_looped("nameOfMyLoopedScript", function (script)
@@ -57,34 +56,7 @@ namespace lua::script
 	{
 		big::lua_module* module = sol::state_view(state)["!this"];
 
-		std::unique_ptr<big::script> lua_script = std::make_unique<big::script>(
-		    [func_, state]() mutable {
-			    sol::thread t       = sol::thread::create(state);
-			    sol::coroutine func = sol::coroutine(t.state(), func_);
-
-			    while (big::g_running)
-			    {
-				    auto res = func(dummy_script_util);
-
-				    if (!res.valid())
-				    {
-					    big::g_lua_manager->handle_error(res, res.lua_state());
-					    break;
-				    }
-
-				    if (func.runnable())
-				    {
-					    big::script::get_current()->yield(std::chrono::milliseconds(res.return_count() ? res[0] : 0));
-				    }
-				    else
-				    {
-					    big::script::get_current()->yield();
-				    }
-			    }
-		    },
-		    name);
-
-		module->m_registered_scripts.push_back(std::move(lua_script));
+		module->executor().add(name, std::move(func_), true);
 	}
 
 	// Lua API: Function
@@ -92,6 +64,7 @@ namespace lua::script
 	// Name: run_in_fiber
 	// Param: func: function: function that will be executed once in the fiber pool.
 	// Executes a function once inside the fiber pool, you can call natives inside it and yield or sleep.
+	// Like looped scripts, it runs as a coroutine of the module, a call that blocks for several frames such as entities.take_control_of only pauses this function.
 	// **Example Usage:**
 	// ```lua
 	// script.run_in_fiber(function (script)
@@ -119,38 +92,7 @@ namespace lua::script
 	{
 		big::lua_module* module = sol::state_view(state)["!this"];
 
-		static size_t name_i = 0;
-		std::string job_name = module->module_name() + std::to_string(name_i++);
-
-		// We make a new script for lua state destruction timing purposes, see lua_module dctor for more info.
-		std::unique_ptr<big::script> lua_script = std::make_unique<big::script>(
-		    [func_, state]() mutable {
-			    sol::thread t       = sol::thread::create(state);
-			    sol::coroutine func = sol::coroutine(t.state(), func_);
-
-			    while (big::g_running)
-			    {
-				    auto res = func(dummy_script_util);
-
-				    if (!res.valid())
-				    {
-					    big::g_lua_manager->handle_error(res, res.lua_state());
-					    break;
-				    }
-
-				    if (func.runnable())
-				    {
-					    big::script::get_current()->yield(std::chrono::milliseconds(res.return_count() ? res[0] : 0));
-				    }
-				    else
-				    {
-					    break;
-				    }
-			    }
-		    },
-		    job_name);
-
-		module->m_registered_scripts.push_back(std::move(lua_script));
+		module->executor().add({}, std::move(func_), false);
 	}
 
 	// Lua API: function
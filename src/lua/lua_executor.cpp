@@ -0,0 +1,213 @@
+#include "lua_executor.hpp"
+
+#include "bindings/script.hpp"
+#include "lua_manager.hpp"
+
+namespace big
+{
+	static lua::script::script_util dummy_script_util;
+
+	lua_executor::lua_executor(sol::state_view state) :
+	    m_state(state)
+	{
+	}
+
+	void lua_executor::add(std::string name, sol::protected_function func, bool looped)
+	{
+		std::lock_guard lock(m_pending_mutex);
+		m_pending.emplace_back(std::move(name), std::move(func), looped);
+	}
+
+	void lua_executor::post(std::move_only_function<void()> func)
+	{
+		std::lock_guard lock(m_pending_mutex);
+		m_posted.push_back(std::move(func));
+	}
+
+	void lua_executor::run()
+	{
+		while (g_running)
+		{
+			tick(script::clock::now());
+
+			// woken every frame, coroutines started in between would have to wait for the next sleeper otherwise
+			script::get_current()->yield();
+		}
+	}
+
+	std::size_t lua_executor::size() const
+	{
+		std::lock_guard lock(m_coroutines_mutex);
+		return m_coroutines.size() - m_free_coroutines.size();
+	}
+
+	std::vector<std::string> lua_executor::names() const
+	{
+		std::lock_guard lock(m_coroutines_mutex);
+
+		std::vector<std::string> names;
+		for (const auto& entry : m_coroutines)
+		{
+			if (!entry.m_name.empty())
+				names.push_back(entry.m_name);
+		}
+		return names;
+	}
+
+	void lua_executor::run_worker(worker& worker)
+	{
+		while (true)
+		{
+			if (worker.m_coroutine)
+			{
+				resume(*worker.m_coroutine);
+				worker.m_coroutine.reset();
+			}
+
+			script::get_current()->yield();
+		}
+	}
+
+	lua_executor::worker& lua_executor::idle_worker()
+	{
+		for (auto& worker : m_workers)
+		{
+			if (!worker->m_coroutine)
+				return *worker;
+		}
+
+		auto& worker    = *m_workers.emplace_back(std::make_unique<lua_executor::worker>());
+		worker.m_script = std::make_unique<script>([this, &worker] {
+			run_worker(worker);
+		});
+		return worker;
+	}
+
+	void lua_executor::tick(script::time_point now)
+	{
+		m_now = now;
+
+		{
+			std::lock_guard lock(m_pending_mutex);
+			std::swap(m_pending, m_starting);
+			std::swap(m_posted, m_running_posted);
+		}
+
+		for (auto& func : m_running_posted)
+			func();
+		m_running_posted.clear();
+
+		for (auto& [name, func, looped] : m_starting)
+		{
+			sol::thread thread;
+			if (!m_idle_threads.empty())
+			{
+				thread = std::move(m_idle_threads.back());
+				m_idle_threads.pop_back();
+			}
+			else
+			{
+				thread = sol::thread::create(m_state);
+			}
+
+			coroutine entry{std::move(name), std::move(thread), sol::coroutine(), looped};
+			entry.m_coroutine = sol::coroutine(entry.m_thread.state(), func);
+
+			std::lock_guard lock(m_coroutines_mutex);
+			std::uint32_t index;
+			if (!m_free_coroutines.empty())
+			{
+				index = m_free_coroutines.back();
+				m_free_coroutines.pop_back();
+				m_coroutines[index] = std::move(entry);
+			}
+			else
+			{
+				index = static_cast<std::uint32_t>(m_coroutines.size());
+				m_coroutines.push_back(std::move(entry));
+			}
+
+			m_ready.push_back(index);
+		}
+		m_starting.clear();
+
+		while (!m_sleeping.empty() && m_sleeping.top().first <= now)
+		{
+			m_ready.push_back(m_sleeping.top().second);
+			m_sleeping.pop();
+		}
+
+		// coroutines yielding for the next frame go back into m_ready while we resume
+		std::swap(m_ready, m_resuming);
+
+		// coroutines blocked in a binding carry on where they were, their fiber decides whether it's time to
+		for (auto& worker : m_workers)
+		{
+			if (worker->m_coroutine)
+				worker->m_script->tick(now);
+		}
+
+		for (const auto index : m_resuming)
+		{
+			// a worker still holding its coroutine after this is blocked, the next coroutine gets another one
+			auto& worker       = idle_worker();
+			worker.m_coroutine = index;
+			worker.m_script->tick(now);
+		}
+		m_resuming.clear();
+	}
+
+	void lua_executor::resume(std::uint32_t index)
+	{
+		auto& entry = m_coroutines[index];
+
+		auto res = entry.m_coroutine(dummy_script_util);
+
+		// the call may have blocked for several frames
+		const auto now = m_now;
+		if (!res.valid())
+		{
+			g_lua_manager->handle_error(res, res.lua_state(), entry.m_name.empty() ? "run_in_fiber" : entry.m_name);
+
+			// the thread is left in an error state and can't run anything else
+			release(index, false);
+			return;
+		}
+
+		if (entry.m_coroutine.runnable())
+		{
+			const int sleep_ms = res.return_count() ? res[0] : 0;
+			if (sleep_ms > 0)
+				m_sleeping.emplace(now + std::chrono::milliseconds(sleep_ms), index);
+			else
+				m_ready.push_back(index);
+		}
+		else if (entry.m_looped)
+		{
+			// calling the finished coroutine again starts the function over
+			m_ready.push_back(index);
+		}
+		else
+		{
+			release(index, true);
+		}
+	}
+
+	void lua_executor::release(std::uint32_t index, bool reuse_thread)
+	{
+		std::lock_guard lock(m_coroutines_mutex);
+
+		auto& entry       = m_coroutines[index];
+		entry.m_coroutine = sol::coroutine();
+		entry.m_name.clear();
+
+		if (reuse_thread && m_idle_threads.size() < max_idle_threads)
+		{
+			lua_settop(entry.m_thread.thread_state(), 0);
+			m_idle_threads.push_back(std::move(entry.m_thread));
+		}
+		entry.m_thread = sol::thread();
+
+		m_free_coroutines.push_back(index);
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include "../script.hpp"
+
+#include <deque>
+#include <queue>
+#include <tuple>
+
+namespace big
+{
+	/**
+	 * @brief Runs the functions a module passes to script.run_in_fiber and script.register_looped as coroutines
+	 * multiplexed on a single script fiber, instead of giving each call a fiber and a lua thread of its own.
+	 *
+	 * Lua threads of finished coroutines are kept for the next ones, so the cost of the executor follows
+	 * the amount of coroutines alive rather than the amount of calls made.
+	 *
+	 * Coroutines are resumed on worker fibers. A binding that yields the fiber, such as entities.take_control_of,
+	 * only blocks the coroutine that called it: the others move on to another worker in the meantime.
+	 */
+	class lua_executor
+	{
+	public:
+		explicit lua_executor(sol::state_view state);
+
+		lua_executor(const lua_executor&)            = delete;
+		lua_executor& operator=(const lua_executor&) = delete;
+
+		// safe to call from any thread running lua code of the module, the coroutine starts on the next frame
+		// name shows up in errors and in the debug view, it may be empty for one-off functions
+		void add(std::string name, sol::protected_function func, bool looped);
+
+		// runs func on the fiber of the executor on the next frame, for work finishing on other threads to reach lua
+		void post(std::move_only_function<void()> func);
+
+		// body of the script fiber of the executor
+		void run();
+
+		// safe to call from the render thread
+		std::size_t size() const;
+		std::vector<std::string> names() const;
+
+	private:
+		struct coroutine
+		{
+			std::string m_name;
+			sol::thread m_thread;
+			sol::coroutine m_coroutine;
+			bool m_looped;
+		};
+
+		struct worker
+		{
+			std::unique_ptr<script> m_script;
+			// the coroutine being resumed, still set after the fiber yielded if a binding is blocking it
+			std::optional<std::uint32_t> m_coroutine;
+		};
+
+		// lua threads kept around for reuse, more than this are left to the garbage collector
+		static constexpr std::size_t max_idle_threads = 16;
+
+		void tick(script::time_point now);
+		void run_worker(worker& worker);
+		worker& idle_worker();
+		void resume(std::uint32_t index);
+		void release(std::uint32_t index, bool reuse_thread);
+
+		sol::state_view m_state;
+
+		std::mutex m_pending_mutex;
+		std::vector<std::tuple<std::string, sol::protected_function, bool>> m_pending;
+		// m_pending is swapped into this, so that lua code running while coroutines start can add more
+		std::vector<std::tuple<std::string, sol::protected_function, bool>> m_starting;
+		std::vector<std::move_only_function<void()>> m_posted;
+		std::vector<std::move_only_function<void()>> m_running_posted;
+
+		// slots are reused through m_free_coroutines, indices stay valid while the coroutine is alive
+		// and a deque keeps the coroutines of blocked workers in place while others are added
+		// only the executor fiber writes them, under m_coroutines_mutex so that the debug view can read along
+		mutable std::mutex m_coroutines_mutex;
+		std::deque<coroutine> m_coroutines;
+		std::vector<std::uint32_t> m_free_coroutines;
+		std::vector<sol::thread> m_idle_threads;
+
+		// as many as the coroutines blocked at once plus one, kept for the whole life of the module
+		std::vector<std::unique_ptr<worker>> m_workers;
+		script::time_point m_now;
+
+		// coroutines to resume on the next tick, and the ones sleeping ordered by wake time
+		std::vector<std::uint32_t> m_ready;
+		std::vector<std::uint32_t> m_resuming;
+		std::priority_queue<std::pair<script::time_point, std::uint32_t>, std::vector<std::pair<script::time_point, std::uint32_t>>, std::greater<>> m_sleeping;
+	};
+}
@@ -1,9 +1,39 @@
 #include "lua_manager.hpp"
 
 #include "file_manager.hpp"
+#include "lua_pattern_cache.hpp"
+#include "lua_require_index.hpp"
 
 namespace big
 {
+	// argument buffers of the hook callbacks running on this thread, one per nesting level as a callback can end up calling another hooked function
+	thread_local std::vector<std::unique_ptr<std::vector<sol::object>>> hook_arg_buffers;
+	thread_local std::size_t hook_depth = 0;
+
+	class hook_args_scope
+	{
+		std::vector<sol::object>* m_args;
+
+	public:
+		hook_args_scope()
+		{
+			if (hook_arg_buffers.size() == hook_depth)
+				hook_arg_buffers.push_back(std::make_unique<std::vector<sol::object>>());
+
+			m_args = hook_arg_buffers[hook_depth++].get();
+		}
+
+		~hook_args_scope()
+		{
+			hook_depth--;
+		}
+
+		std::vector<sol::object>& args()
+		{
+			return *m_args;
+		}
+	};
+
 	std::optional<std::filesystem::path> move_file_relative_to_folder(const std::filesystem::path& original, const std::filesystem::path& target, const std::filesystem::path& file)
 	{
 		// keeps folder hierarchy intact
@@ -20,9 +50,23 @@ namespace big
 
 			return std::nullopt;
 		}
+
+		g_lua_require_index.mark_dirty();
 		return {new_module_path};
 	}
 
+	// moves the modules with that id out of modules
+	static std::vector<std::shared_ptr<lua_module>> take_modules(std::vector<std::shared_ptr<lua_module>>& modules, rage::joaat_t module_id)
+	{
+		const auto it = std::stable_partition(modules.begin(), modules.end(), [module_id](const auto& module) {
+			return module->module_id() != module_id;
+		});
+
+		std::vector<std::shared_ptr<lua_module>> taken(std::make_move_iterator(it), std::make_move_iterator(modules.end()));
+		modules.erase(it, modules.end());
+		return taken;
+	}
+
 	lua_manager::lua_manager(folder scripts_folder, folder scripts_config_folder) :
 	    m_scripts_folder(scripts_folder),
 	    m_scripts_config_folder(scripts_config_folder),
@@ -32,6 +76,8 @@ namespace big
 
 		g_lua_manager = this;
 
+		publish_callbacks();
+
 		load_all_modules();
 	}
 
@@ -39,23 +85,27 @@ namespace big
 	{
 		unload_all_modules();
 
+		g_lua_pattern_cache.save();
+
 		g_lua_manager = nullptr;
 	}
 
 	void lua_manager::disable_all_modules()
 	{
 		std::vector<std::filesystem::path> script_paths;
+		std::vector<std::shared_ptr<lua_module>> unloaded;
 
 		{
 			std::lock_guard guard(m_module_lock);
+			remove_callbacks(std::nullopt);
 			for (auto& module : m_modules)
 			{
 				script_paths.push_back(module->module_path());
-
-				module.reset();
 			}
+			unloaded = std::move(m_modules);
 			m_modules.clear();
 		}
+		release_modules(std::move(unloaded));
 
 		for (const auto& script_path : script_paths)
 		{
@@ -96,6 +146,8 @@ namespace big
 
 	void lua_manager::load_all_modules()
 	{
+		g_lua_require_index.mark_dirty();
+
 		for (const auto& entry : std::filesystem::recursive_directory_iterator(m_scripts_folder.get_path(), std::filesystem::directory_options::skip_permission_denied))
 			if (entry.is_regular_file() && entry.path().extension() == ".lua")
 				load_module(entry.path());
@@ -103,13 +155,16 @@ namespace big
 
 	void lua_manager::unload_all_modules()
 	{
+		std::vector<std::shared_ptr<lua_module>> unloaded;
 		{
 			std::lock_guard guard(m_module_lock);
+			remove_callbacks(std::nullopt);
 
-			for (auto& module : m_modules)
-				module.reset();
+			unloaded = std::move(m_modules);
 			m_modules.clear();
 		}
+		release_modules(std::move(unloaded));
+
 		{
 			std::lock_guard guard(m_disabled_module_lock);
 
@@ -143,6 +198,7 @@ namespace big
 
 		for (const auto& module : m_modules)
 		{
+			std::lock_guard state_guard(module->state_mutex());
 			for (const auto& element : module->m_independent_gui)
 			{
 				element->draw();
@@ -156,6 +212,7 @@ namespace big
 
 		for (const auto& module : m_modules)
 		{
+			std::lock_guard state_guard(module->state_mutex());
 			for (const auto& element : module->m_always_draw_gui)
 			{
 				element->draw();
@@ -179,6 +236,7 @@ namespace big
 					add_separator = false;
 				}
 
+				std::lock_guard state_guard(module->state_mutex());
 				for (const auto& element : it->second)
 				{
 					element->draw();
@@ -188,64 +246,178 @@ namespace big
 		}
 	}
 
-	bool lua_manager::dynamic_hook_pre_callbacks(const uintptr_t target_func_ptr, lua::memory::type_info_t return_type, lua::memory::runtime_func_t::return_value_t* return_value, std::vector<lua::memory::type_info_t> param_types, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count)
+	void lua_manager::publish_callbacks()
 	{
-		std::scoped_lock guard(m_module_lock);
+		for (std::size_t i = 0; i < event_count; i++)
+			m_event_snapshots[i].store(std::make_shared<const callback_list>(m_event_callbacks[i]));
 
-		bool call_orig_if_true = true;
+		m_hook_snapshot.store(std::make_shared<const hook_callback_map>(m_hook_callbacks));
+	}
 
-		for (const auto& module : m_modules)
-		{
-			const auto it = module->m_dynamic_hook_pre_callbacks.find(target_func_ptr);
-			if (it != module->m_dynamic_hook_pre_callbacks.end())
-			{
-				sol::object return_value_obj = module->to_lua(return_value, return_type);
-				std::vector<sol::object> args;
-				for (uint8_t i = 0; i < param_count; i++)
-				{
-					args.push_back(module->to_lua(params, i, param_types));
-				}
+	void lua_manager::remove_callbacks(std::optional<rage::joaat_t> module_id)
+	{
+		const auto is_removed = [module_id](const callback_entry& entry) {
+			return !module_id || entry.m_module->module_id() == *module_id;
+		};
 
-				for (const auto& cb : it->second)
-				{
-					const auto new_call_orig_if_true = cb(return_value_obj, sol::as_args(args));
+		std::lock_guard guard(m_callbacks_mutex);
 
-					if (call_orig_if_true && new_call_orig_if_true.valid() && new_call_orig_if_true.get_type() == sol::type::boolean
-					    && new_call_orig_if_true.get<bool>() == false)
-					{
-						call_orig_if_true = false;
-					}
-				}
+		for (auto& callbacks : m_event_callbacks)
+			std::erase_if(callbacks, is_removed);
+
+		std::erase_if(m_hook_callbacks, [&is_removed](auto& hook) {
+			std::erase_if(hook.second.m_pre, is_removed);
+			std::erase_if(hook.second.m_post, is_removed);
+			return hook.second.m_pre.empty() && hook.second.m_post.empty();
+		});
+
+		publish_callbacks();
+	}
+
+	void lua_manager::release_modules(std::vector<std::shared_ptr<lua_module>> modules)
+	{
+		if (modules.empty())
+			return;
+
+		// the snapshots published by remove_callbacks don't reference the modules anymore,
+		// but a dispatch that loaded an older one on another thread may still be calling into them
+		while (m_dispatches.load() != 0)
+			std::this_thread::yield();
+
+		// like when modules were erased in place, their dynamic hooks unregister themselves under the lock
+		std::lock_guard guard(m_module_lock);
+		modules.clear();
+	}
+
+	static void add_callback(lua_manager::callback_list& callbacks, lua_manager::callback_entry entry)
+	{
+		const auto last_of_module = std::find_if(callbacks.rbegin(), callbacks.rend(), [&entry](const auto& other) {
+			return other.m_module == entry.m_module;
+		});
+
+		callbacks.insert(last_of_module.base(), std::move(entry));
+	}
+
+	void lua_manager::add_event_callback(lua_module& module, menu_event menu_event, sol::protected_function func)
+	{
+		auto callback = std::make_shared<lua_callback>(std::move(func), std::format("menu_event {}", static_cast<int>(menu_event)));
+
+		std::lock_guard guard(m_callbacks_mutex);
+
+		auto& callbacks = m_event_callbacks[static_cast<std::size_t>(menu_event)];
+		add_callback(callbacks, {&module, std::move(callback)});
+
+		m_event_snapshots[static_cast<std::size_t>(menu_event)].store(std::make_shared<const callback_list>(callbacks));
+	}
+
+	void lua_manager::add_dynamic_hook_callbacks(lua_module& module, uintptr_t target_func_ptr, const std::string& hook_name, sol::protected_function pre, sol::protected_function post)
+	{
+		std::lock_guard guard(m_callbacks_mutex);
+
+		auto& hook = m_hook_callbacks[target_func_ptr];
+		if (pre.valid())
+			add_callback(hook.m_pre, {&module, std::make_shared<lua_callback>(std::move(pre), hook_name + " pre callback")});
+		if (post.valid())
+			add_callback(hook.m_post, {&module, std::make_shared<lua_callback>(std::move(post), hook_name + " post callback")});
+
+		m_hook_snapshot.store(std::make_shared<const hook_callback_map>(m_hook_callbacks));
+	}
+
+	void lua_manager::record_call_time(const lua_module& module, lua_callback& callback, std::chrono::steady_clock::duration time)
+	{
+		const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+
+		callback.m_calls++;
+		callback.m_total_time += nanoseconds;
+
+		auto max_time = callback.m_max_time.load();
+		while (nanoseconds > max_time)
+		{
+			if (!callback.m_max_time.compare_exchange_weak(max_time, nanoseconds))
+				continue;
+
+			if (time >= slow_callback_threshold)
+			{
+				const auto calls   = callback.m_calls.load();
+				const auto average = callback.m_total_time.load() / static_cast<std::chrono::nanoseconds::rep>(calls);
+				LOG(WARNING) << module.module_name() << ": " << callback.m_name << " took " << nanoseconds / 1'000'000.f
+				             << "ms, averaging " << average / 1'000'000.f << "ms over " << calls << " calls";
 			}
+			break;
 		}
-
-		return call_orig_if_true;
 	}
 
-	void lua_manager::dynamic_hook_post_callbacks(const uintptr_t target_func_ptr, lua::memory::type_info_t return_type, lua::memory::runtime_func_t::return_value_t* return_value, std::vector<lua::memory::type_info_t> param_types, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count)
+	template<typename F>
+	void lua_manager::call_hook_callbacks(const callback_list& callbacks, lua::memory::type_info_t return_type, lua::memory::runtime_func_t::return_value_t* return_value, const std::vector<lua::memory::type_info_t>& param_types, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count, F&& on_result)
 	{
-		std::scoped_lock guard(m_module_lock);
+		hook_args_scope scope;
+		auto& args = scope.args();
 
-		for (const auto& module : m_modules)
+		for (auto it = callbacks.begin(); it != callbacks.end();)
 		{
-			const auto it = module->m_dynamic_hook_post_callbacks.find(target_func_ptr);
-			if (it != module->m_dynamic_hook_post_callbacks.end())
+			const auto module = it->m_module;
+			std::lock_guard state_guard(module->state_mutex());
+
+			// the arguments are converted once for all the callbacks of a module
+			const auto return_value_obj = module->to_lua(return_value, return_type);
+			for (uint8_t i = 0; i < param_count; i++)
 			{
-				sol::object return_value_obj = module->to_lua(return_value, return_type);
-				std::vector<sol::object> args;
-				for (uint8_t i = 0; i < param_count; i++)
-				{
-					args.push_back(module->to_lua(params, i, param_types));
-				}
+				args.push_back(module->to_lua(params, i, param_types));
+			}
 
-				for (const auto& cb : it->second)
-				{
-					cb(return_value_obj, sol::as_args(args));
-				}
+			for (; it != callbacks.end() && it->m_module == module; ++it)
+			{
+				on_result(call(*module, *it->m_callback, return_value_obj, sol::as_args(args)));
 			}
+
+			// references into the lua state have to be released while we still own it
+			args.clear();
 		}
 	}
 
+	bool lua_manager::dynamic_hook_pre_callbacks(const uintptr_t target_func_ptr, lua::memory::runtime_func_t::return_value_t* return_value, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count)
+	{
+		dispatch_scope scope(*this);
+
+		const auto dyn_hook = m_target_func_ptr_to_dynamic_hook.find(target_func_ptr);
+		if (dyn_hook == m_target_func_ptr_to_dynamic_hook.end())
+			return true;
+
+		const auto hooks = m_hook_snapshot.load();
+		const auto it    = hooks->find(target_func_ptr);
+		if (it == hooks->end())
+			return true;
+
+		bool call_orig_if_true = true;
+
+		call_hook_callbacks(it->second.m_pre, dyn_hook->second->m_return_type, return_value, dyn_hook->second->m_param_types, params, param_count, [&call_orig_if_true](const sol::protected_function_result& new_call_orig_if_true) {
+			if (call_orig_if_true && new_call_orig_if_true.valid() && new_call_orig_if_true.get_type() == sol::type::boolean
+			    && new_call_orig_if_true.get<bool>() == false)
+			{
+				call_orig_if_true = false;
+			}
+		});
+
+		return call_orig_if_true;
+	}
+
+	void lua_manager::dynamic_hook_post_callbacks(const uintptr_t target_func_ptr, lua::memory::runtime_func_t::return_value_t* return_value, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count)
+	{
+		dispatch_scope scope(*this);
+
+		const auto dyn_hook = m_target_func_ptr_to_dynamic_hook.find(target_func_ptr);
+		if (dyn_hook == m_target_func_ptr_to_dynamic_hook.end())
+			return;
+
+		const auto hooks = m_hook_snapshot.load();
+		const auto it    = hooks->find(target_func_ptr);
+		if (it == hooks->end())
+			return;
+
+		call_hook_callbacks(it->second.m_post, dyn_hook->second->m_return_type, return_value, dyn_hook->second->m_param_types, params, param_count, [](const sol::protected_function_result&) {
+		});
+	}
+
 	std::weak_ptr<lua_module> lua_manager::enable_module(rage::joaat_t module_id)
 	{
 		if (auto module = get_disabled_module(module_id).lock())
@@ -273,17 +445,18 @@ namespace big
 
 	std::weak_ptr<lua_module> lua_manager::disable_module(rage::joaat_t module_id)
 	{
-		if (auto module = get_module(module_id).lock())
+		if (const auto module = get_module(module_id); !module.expired())
 		{
-			const auto module_path = module->module_path();
+			const auto module_path = module.lock()->module_path();
 
 			// unload module
+			std::vector<std::shared_ptr<lua_module>> unloaded;
 			{
-				std::lock_guard guard(m_disabled_module_lock);
-				std::erase_if(m_modules, [module_id](auto& module) {
-					return module_id == module->module_id();
-				});
+				std::lock_guard guard(m_module_lock);
+				remove_callbacks(module_id);
+				unloaded = take_modules(m_modules, module_id);
 			}
+			release_modules(std::move(unloaded));
 
 			const auto new_module_path =
 			    move_file_relative_to_folder(m_scripts_folder.get_path(), m_disabled_scripts_folder.get_path(), module_path);
@@ -297,15 +470,18 @@ namespace big
 
 	void lua_manager::unload_module(rage::joaat_t module_id)
 	{
-		std::lock_guard guard(m_module_lock);
-		std::erase_if(m_modules, [module_id](auto& module) {
-			return module_id == module->module_id();
-		});
+		std::vector<std::shared_ptr<lua_module>> unloaded;
+		{
+			std::lock_guard guard(m_module_lock);
+			remove_callbacks(module_id);
+			unloaded = take_modules(m_modules, module_id);
 
-		std::lock_guard guard2(m_disabled_module_lock);
-		std::erase_if(m_disabled_modules, [module_id](auto& module) {
-			return module_id == module->module_id();
-		});
+			std::lock_guard guard2(m_disabled_module_lock);
+			std::erase_if(m_disabled_modules, [module_id](auto& module) {
+				return module_id == module->module_id();
+			});
+		}
+		release_modules(std::move(unloaded));
 	}
 
 	std::weak_ptr<lua_module> lua_manager::load_module(const std::filesystem::path& module_path)
@@ -375,6 +551,9 @@ namespace big
 					{
 						if (module->module_path() == module_path && module->last_write_time() < last_write_time)
 						{
+							// libraries may have been added alongside the change
+							g_lua_require_index.mark_dirty();
+
 							unload_module(module->module_id());
 							load_module(module_path);
 							break;
@@ -415,6 +594,12 @@ namespace big
 		Logger::FlushQueue();
 	}
 
+	void lua_manager::handle_error(const sol::error& error, const sol::state_view& state, std::string_view script_name)
+	{
+		LOG(FATAL) << state["!module_name"].get<std::string_view>() << " (" << script_name << "): " << error.what();
+		Logger::FlushQueue();
+	}
+
 	std::shared_ptr<lua::memory::runtime_func_t> lua_manager::get_existing_dynamic_hook(const uintptr_t target_func_ptr)
 	{
 		for (const auto& mod : m_modules)
@@ -4,9 +4,51 @@
 
 namespace big
 {
+	/**
+	 * @brief A lua function the menu calls back, with the time spent in it so that slow scripts can be found.
+	 */
+	struct lua_callback
+	{
+		lua_callback(sol::protected_function function, std::string name) :
+		    m_function(std::move(function)),
+		    m_name(std::move(name))
+		{
+		}
+
+		sol::protected_function m_function;
+		std::string m_name;
+
+		std::atomic<std::uint64_t> m_calls = 0;
+		std::atomic<std::chrono::nanoseconds::rep> m_total_time = 0;
+		std::atomic<std::chrono::nanoseconds::rep> m_max_time   = 0;
+	};
+
 	class lua_manager final
 	{
+	public:
+		struct callback_entry
+		{
+			// not owning, modules are only destroyed once the dispatches that could still see them are done
+			lua_module* m_module;
+			std::shared_ptr<lua_callback> m_callback;
+		};
+		// callbacks of the same module are kept next to each other, in the order they were registered
+		using callback_list = std::vector<callback_entry>;
+
+		struct hook_callbacks
+		{
+			callback_list m_pre;
+			callback_list m_post;
+		};
+		using hook_callback_map = std::unordered_map<uintptr_t, hook_callbacks>;
+
 	private:
+		// menu_event::Wndproc is the last event
+		static constexpr std::size_t event_count = static_cast<std::size_t>(menu_event::Wndproc) + 1;
+
+		// callbacks taking longer than this get logged whenever they reach a new maximum
+		static constexpr std::chrono::milliseconds slow_callback_threshold = 5ms;
+
 		std::mutex m_module_lock;
 		std::vector<std::shared_ptr<lua_module>> m_modules;
 		std::mutex m_disabled_module_lock;
@@ -19,6 +61,55 @@ namespace big
 		folder m_scripts_folder;
 		folder m_scripts_config_folder;
 
+		// writers copy the lists under m_callbacks_mutex and publish them as immutable snapshots,
+		// so that events and hooks are dispatched without taking any lock
+		// unloading waits for m_dispatches to drain before destroying the modules, see release_modules
+		std::mutex m_callbacks_mutex;
+		std::array<callback_list, event_count> m_event_callbacks;
+		hook_callback_map m_hook_callbacks;
+		std::array<std::atomic<std::shared_ptr<const callback_list>>, event_count> m_event_snapshots;
+		std::atomic<std::shared_ptr<const hook_callback_map>> m_hook_snapshot;
+		std::atomic<std::size_t> m_dispatches = 0;
+
+		// counts a dispatch from before it loads a snapshot until it's done with the modules in it
+		class dispatch_scope
+		{
+			lua_manager& m_manager;
+
+		public:
+			dispatch_scope(lua_manager& manager) :
+			    m_manager(manager)
+			{
+				m_manager.m_dispatches++;
+			}
+
+			~dispatch_scope()
+			{
+				m_manager.m_dispatches--;
+			}
+		};
+
+		void publish_callbacks();
+		// removes the callbacks of every module if module_id is empty
+		void remove_callbacks(std::optional<rage::joaat_t> module_id);
+		// destroys unloaded modules once no dispatch can be calling into them anymore, never call it from a lua callback
+		void release_modules(std::vector<std::shared_ptr<lua_module>> modules);
+
+		template<typename F>
+		void call_hook_callbacks(const callback_list& callbacks, lua::memory::type_info_t return_type, lua::memory::runtime_func_t::return_value_t* return_value, const std::vector<lua::memory::type_info_t>& param_types, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count, F&& on_result);
+
+		template<typename... Args>
+		sol::protected_function_result call(const lua_module& module, lua_callback& callback, Args&&... args)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			auto result      = callback.m_function(std::forward<Args>(args)...);
+			record_call_time(module, callback, std::chrono::steady_clock::now() - start);
+
+			return result;
+		}
+
+		void record_call_time(const lua_module& module, lua_callback& callback, std::chrono::steady_clock::duration time);
+
 	public:
 		lua_manager(folder scripts_folder, folder scripts_config_folder);
 		~lua_manager();
@@ -55,8 +146,12 @@ namespace big
 		void draw_always_draw_gui();
 		void draw_gui(rage::joaat_t tab_hash);
 
-		bool dynamic_hook_pre_callbacks(const uintptr_t target_func_ptr, lua::memory::type_info_t return_type, lua::memory::runtime_func_t::return_value_t* return_value, std::vector<lua::memory::type_info_t> param_types, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count);
-		void dynamic_hook_post_callbacks(const uintptr_t target_func_ptr, lua::memory::type_info_t return_type, lua::memory::runtime_func_t::return_value_t* return_value, std::vector<lua::memory::type_info_t> param_types, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count);
+		void add_event_callback(lua_module& module, menu_event menu_event, sol::protected_function func);
+		// either callback can be invalid
+		void add_dynamic_hook_callbacks(lua_module& module, uintptr_t target_func_ptr, const std::string& hook_name, sol::protected_function pre, sol::protected_function post);
+
+		bool dynamic_hook_pre_callbacks(const uintptr_t target_func_ptr, lua::memory::runtime_func_t::return_value_t* return_value, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count);
+		void dynamic_hook_post_callbacks(const uintptr_t target_func_ptr, lua::memory::runtime_func_t::return_value_t* return_value, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count);
 
 		std::weak_ptr<lua_module> enable_module(rage::joaat_t module_id);
 		std::weak_ptr<lua_module> disable_module(rage::joaat_t module_id);
@@ -67,37 +162,35 @@ namespace big
 		void reload_changed_scripts();
 
 		void handle_error(const sol::error& error, const sol::state_view& state);
+		void handle_error(const sol::error& error, const sol::state_view& state, std::string_view script_name);
 
 		template<menu_event menu_event_, typename Return = void, typename... Args>
 		inline std::conditional_t<std::is_void_v<Return>, void, std::optional<Return>> trigger_event(Args&&... args)
 		{
-			std::lock_guard guard(m_module_lock);
+			dispatch_scope scope(*this);
+			const auto callbacks = m_event_snapshots[static_cast<std::size_t>(menu_event_)].load();
 
-			for (auto& module : m_modules)
+			for (const auto& [module, callback] : *callbacks)
 			{
-				if (auto vec = module->m_event_callbacks.find(menu_event_); vec != module->m_event_callbacks.end())
+				std::lock_guard state_guard(module->state_mutex());
+
+				auto result = call(*module, *callback, args...);
+
+				if (!result.valid())
 				{
-					for (auto& cb : vec->second)
-					{
-						auto result = cb(args...);
-
-						if (!result.valid())
-						{
-							handle_error(result, result.lua_state());
-							continue;
-						}
-
-						if constexpr (!std::is_void_v<Return>)
-						{
-							if (result.return_count() == 0)
-								continue;
-
-							if (!result[0].is<Return>())
-								continue;
-
-							return result[0].get<Return>();
-						}
-					}
+					handle_error(result, result.lua_state());
+					continue;
+				}
+
+				if constexpr (!std::is_void_v<Return>)
+				{
+					if (result.return_count() == 0)
+						continue;
+
+					if (!result[0].is<Return>())
+						continue;
+
+					return result[0].get<Return>();
 				}
 			}
 
@@ -22,6 +22,7 @@
 #include "bindings/vehicles.hpp"
 #include "bindings/weapons.hpp"
 #include "file_manager.hpp"
+#include "lua_require_index.hpp"
 #include "script_mgr.hpp"
 
 namespace big
@@ -117,6 +118,13 @@ namespace big
 			lua_CFunction traceback_function = sol::c_call<decltype(&traceback_error_handler), &traceback_error_handler>;
 			sol::protected_function::set_default_handler(sol::object(m_state.lua_state(), sol::in_place, traceback_function));
 
+			m_executor = std::make_unique<lua_executor>(m_state);
+			m_registered_scripts.push_back(std::make_unique<script>(
+			    [this] {
+				    m_executor->run();
+			    },
+			    m_module_name));
+
 			m_last_write_time = std::filesystem::last_write_time(m_module_path);
 		}
 	}
@@ -163,21 +171,25 @@ namespace big
 		return m_disabled;
 	}
 
-	void lua_module::set_folder_for_lua_require(folder& scripts_folder)
+	lua_executor& lua_module::executor()
 	{
-		std::string scripts_search_path = scripts_folder.get_path().string() + "/?.lua;";
+		return *m_executor;
+	}
 
-		for (const auto& entry : std::filesystem::recursive_directory_iterator(scripts_folder.get_path(), std::filesystem::directory_options::skip_permission_denied))
-		{
-			if (!entry.is_directory())
-				continue;
+	std::recursive_mutex& lua_module::state_mutex()
+	{
+		return m_state_mutex;
+	}
 
-			scripts_search_path += entry.path().string() + "/?.lua;";
-		}
-		// Remove final ';'
-		scripts_search_path.pop_back();
+	void lua_module::set_folder_for_lua_require(folder& scripts_folder)
+	{
+		// shared by every module, the folder is only scanned again after the lua manager marks the index dirty
+		g_lua_require_index.set_folder(scripts_folder.get_path());
 
-		m_state["package"]["path"] = scripts_search_path;
+		// 1                   2
+		// {searcher_preload, searcher_Lua, ...}
+		m_state["package"]["searchers"][2] = &lua_require_index::searcher;
+		m_state["package"]["path"]         = scripts_folder.get_path().string() + "/?.lua";
 	}
 
 	void lua_module::sandbox_lua_os_library()
@@ -323,6 +335,8 @@ namespace big
 
 	void lua_module::load_and_call_script()
 	{
+		std::lock_guard state_guard(m_state_mutex);
+
 		auto result = m_state.safe_script_file(m_module_path.string(), &sol::script_pass_on_error, sol::load_mode::text);
 
 		if (!result.valid())
@@ -333,11 +347,17 @@ namespace big
 		else
 		{
 			LOG(INFO) << "Loaded " << m_module_name;
+
+			const auto load_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_load_start);
+			LOG(VERBOSE) << m_module_name << " took " << load_time.count() / 1000.f << "ms to load and uses " << m_state.memory_used() / 1024 << " KiB of Lua heap";
 		}
 	}
 
-	void lua_module::tick_scripts()
+	void lua_module::tick_scripts(script::time_point now)
 	{
+		// events and hooks firing on other threads would otherwise run lua in this state at the same time as the fibers,
+		// recursive as natives called from the fibers can hit dynamic hooks of this module on this thread
+		std::lock_guard state_guard(m_state_mutex);
 		std::lock_guard guard(m_registered_scripts_mutex);
 
 		const auto script_count = m_registered_scripts.size();
@@ -347,7 +367,7 @@ namespace big
 
 			if (script->is_enabled())
 			{
-				script->tick();
+				script->tick(now);
 			}
 		}
 	}
@@ -5,13 +5,16 @@
 #include "lua/bindings/runtime_func_t.hpp"
 #include "lua/bindings/scr_patch.hpp"
 #include "lua/bindings/type_info_t.hpp"
+#include "lua_executor.hpp"
 #include "lua_patch.hpp"
 #include "services/gui/gui_service.hpp"
 
 namespace big
 {
-	class lua_module
+	class lua_module : public std::enable_shared_from_this<lua_module>
 	{
+		// declared before m_state so that the load time logged includes setting up the state
+		std::chrono::steady_clock::time_point m_load_start = std::chrono::steady_clock::now();
 		sol::state m_state;
 
 		sol::protected_function m_io_open;
@@ -26,6 +29,12 @@ namespace big
 		bool m_disabled;
 		std::mutex m_registered_scripts_mutex;
 
+		// held whenever the menu runs lua code of this module: loading, script fibers, event handlers, hooks and gui
+		std::recursive_mutex m_state_mutex;
+
+		// runs the coroutines of script.run_in_fiber and script.register_looped
+		std::unique_ptr<lua_executor> m_executor;
+
 	public:
 		std::vector<std::unique_ptr<script>> m_registered_scripts;
 		std::vector<std::unique_ptr<lua_patch>> m_registered_patches;
@@ -38,13 +47,10 @@ namespace big
 		std::vector<std::unique_ptr<lua::gui::gui_element>> m_independent_gui;
 		std::vector<std::unique_ptr<lua::gui::gui_element>> m_always_draw_gui;
 		std::unordered_map<rage::joaat_t, std::vector<std::unique_ptr<lua::gui::gui_element>>> m_gui;
-		std::unordered_map<menu_event, std::vector<sol::protected_function>> m_event_callbacks;
 		std::vector<void*> m_allocated_memory;
 
 		// lua modules own and share the runtime_func_t object, such as when no module reference it anymore the hook detour get cleaned up.
 		std::vector<std::shared_ptr<lua::memory::runtime_func_t>> m_dynamic_hooks;
-		std::unordered_map<uintptr_t, std::vector<sol::protected_function>> m_dynamic_hook_pre_callbacks;
-		std::unordered_map<uintptr_t, std::vector<sol::protected_function>> m_dynamic_hook_post_callbacks;
 
 		std::unordered_map<uintptr_t, std::unique_ptr<uint8_t[]>> m_dynamic_call_jit_functions;
 
@@ -57,6 +63,8 @@ namespace big
 		const std::string& module_name() const;
 		const std::chrono::time_point<std::chrono::file_clock> last_write_time() const;
 		const bool is_disabled() const;
+		lua_executor& executor();
+		std::recursive_mutex& state_mutex();
 
 		// used for sandboxing and limiting to only our custom search path for the lua require function
 		void set_folder_for_lua_require(folder& scripts_folder);
@@ -79,7 +87,7 @@ namespace big
 			}
 		}
 
-		void tick_scripts();
+		void tick_scripts(script::time_point now);
 		void cleanup_done_scripts();
 
 		sol::object to_lua(const lua::memory::runtime_func_t::parameters_t* params, const uint8_t i, const std::vector<lua::memory::type_info_t>& param_types);
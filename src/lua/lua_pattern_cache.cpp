@@ -0,0 +1,118 @@
+#include "lua_pattern_cache.hpp"
+
+#include "file_manager.hpp"
+#include "memory/batch.hpp"
+
+namespace big
+{
+	static uint64_t hash_pattern(std::string_view ida_pattern)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (const auto c : ida_pattern)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	const memory::module& lua_pattern_cache::gta_module()
+	{
+		static const memory::module module("GTA5.exe");
+		return module;
+	}
+
+	cache_file lua_pattern_cache::get_cache_file()
+	{
+		return cache_file(g_file_manager.get_project_file("./cache/lua_patterns.bin"), cache_version);
+	}
+
+	void lua_pattern_cache::load()
+	{
+		m_loaded = true;
+
+		auto file = get_cache_file();
+		if (!file.load() || !file.up_to_date(gta_module().timestamp()))
+			return;
+
+		for (const auto& cached : file.view<entry>())
+			m_offsets.emplace(cached.m_hash, cached.m_offset);
+
+		LOG(VERBOSE) << "Loaded " << m_offsets.size() << " lua patterns from the cache";
+	}
+
+	std::vector<std::optional<uint64_t>> lua_pattern_cache::resolve(std::span<const std::string> ida_patterns)
+	{
+		const auto& module = gta_module();
+		const auto base    = module.begin().as<uint64_t>();
+
+		std::vector<std::optional<uint64_t>> results(ida_patterns.size());
+		std::vector<uint64_t> hashes(ida_patterns.size());
+		std::vector<size_t> missing;
+		{
+			std::lock_guard lock(m_mutex);
+			if (!m_loaded)
+				load();
+
+			for (size_t i = 0; i < ida_patterns.size(); i++)
+			{
+				hashes[i] = hash_pattern(ida_patterns[i]);
+
+				if (const auto it = m_offsets.find(hashes[i]); it == m_offsets.end())
+					missing.push_back(i);
+				else if (it->second != not_found)
+					results[i] = base + it->second;
+			}
+		}
+
+		if (missing.empty())
+			return results;
+
+		// only parsed when they have to be scanned for, the views point into patterns
+		std::vector<memory::pattern> patterns;
+		patterns.reserve(missing.size());
+		for (const auto i : missing)
+			patterns.emplace_back(ida_patterns[i]);
+
+		std::vector<memory::pattern_view> views;
+		views.reserve(patterns.size());
+		for (const auto& pattern : patterns)
+			views.push_back(pattern.view());
+
+		const auto matches = memory::pattern_batch(std::move(views)).scan(module, memory::batch_runner::s_worker_count);
+
+		std::lock_guard lock(m_mutex);
+		for (size_t i = 0; i < missing.size(); i++)
+		{
+			const auto index = missing[i];
+			if (matches[i])
+				results[index] = matches[i]->as<uint64_t>();
+
+			m_offsets[hashes[index]] = matches[i] ? matches[i]->as<uint64_t>() - base : not_found;
+		}
+		m_dirty = true;
+
+		return results;
+	}
+
+	void lua_pattern_cache::save()
+	{
+		std::lock_guard lock(m_mutex);
+		if (!m_dirty)
+			return;
+
+		const auto data_size = m_offsets.size() * sizeof(entry);
+		auto data            = std::make_unique<uint8_t[]>(data_size);
+
+		auto entries = reinterpret_cast<entry*>(data.get());
+		for (const auto& [hash, offset] : m_offsets)
+			*entries++ = {hash, offset};
+
+		auto file = get_cache_file();
+		file.set_data(std::move(data), data_size);
+		file.set_header_version(gta_module().timestamp());
+		if (file.write())
+			m_dirty = false;
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "memory/module.hpp"
+#include "services/gta_data/cache_file.hpp"
+
+namespace big
+{
+	/**
+	 * @brief Offsets of the patterns lua scripts scanned GTA5.exe for, shared by every lua state.
+	 *
+	 * Patterns are identified by a hash of their ida string. The cache is saved next to the pointers cache
+	 * and thrown away once the timestamp of the game executable changes.
+	 */
+	class lua_pattern_cache
+	{
+	public:
+		/**
+		 * @brief Finds the patterns that aren't cached yet in a single pass over the module, safe to call from any thread.
+		 *
+		 * @return The address of each pattern in the order they were given, empty for the ones not found.
+		 */
+		std::vector<std::optional<uint64_t>> resolve(std::span<const std::string> ida_patterns);
+
+		// writes the cache to disk if patterns were scanned for since it was loaded
+		void save();
+
+	private:
+		struct entry
+		{
+			uint64_t m_hash;
+			// from the base of the module, not_found if the pattern isn't in this build of the game
+			uint64_t m_offset;
+		};
+
+		// bump this when changing the layout of entry
+		static constexpr uint32_t cache_version = 1;
+		static constexpr uint64_t not_found     = UINT64_MAX;
+
+		static const memory::module& gta_module();
+		static cache_file get_cache_file();
+
+		void load();
+
+		std::mutex m_mutex;
+		bool m_loaded = false;
+		bool m_dirty  = false;
+		std::unordered_map<uint64_t, uint64_t> m_offsets;
+	};
+
+	inline lua_pattern_cache g_lua_pattern_cache;
+}
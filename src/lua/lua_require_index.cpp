@@ -0,0 +1,169 @@
+#include "lua_require_index.hpp"
+
+namespace big
+{
+	static std::string to_module_key(std::string_view name)
+	{
+		std::string key(name);
+		for (auto& c : key)
+		{
+			// require replaces the dots of module names with directory separators
+			if (c == '.' || c == '\\')
+				c = '/';
+			else
+				c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+		}
+
+		return key;
+	}
+
+	void lua_require_index::set_folder(const std::filesystem::path& scripts_folder)
+	{
+		std::unique_lock lock(m_mutex);
+		if (m_folder != scripts_folder)
+		{
+			m_folder = scripts_folder;
+			m_dirty  = true;
+		}
+	}
+
+	void lua_require_index::mark_dirty()
+	{
+		std::unique_lock lock(m_mutex);
+		m_dirty = true;
+	}
+
+	void lua_require_index::rebuild()
+	{
+		m_modules.clear();
+		m_dirty = false;
+
+		std::error_code ec;
+		for (std::filesystem::recursive_directory_iterator it(m_folder, std::filesystem::directory_options::skip_permission_denied, ec), end; !ec && it != end; it.increment(ec))
+		{
+			if (!it->is_regular_file(ec) || it->path().extension() != ".lua")
+				continue;
+
+			const auto relative_path = it->path().lexically_relative(m_folder).replace_extension();
+			const auto key           = to_module_key(reinterpret_cast<const char*>(relative_path.generic_u8string().c_str()));
+
+			// every subfolder used to be a package.path entry, so b.lua in a/ is reachable as both "a.b" and "b"
+			for (size_t begin = 0; begin != std::string::npos;)
+			{
+				if (begin == 0)
+					m_modules.insert_or_assign(key, it->path());
+				else
+					m_modules.try_emplace(key.substr(begin), it->path());
+
+				const auto separator = key.find('/', begin);
+				begin                = separator == std::string::npos ? std::string::npos : separator + 1;
+			}
+		}
+
+		LOG(VERBOSE) << "Indexed " << m_modules.size() << " lua module names in " << m_folder;
+	}
+
+	std::optional<std::filesystem::path> lua_require_index::find(std::string_view module_name)
+	{
+		const auto key = to_module_key(module_name);
+
+		std::shared_lock lock(m_mutex);
+		if (m_dirty)
+		{
+			lock.unlock();
+			{
+				std::unique_lock rebuild_lock(m_mutex);
+				if (m_dirty)
+					rebuild();
+			}
+			lock.lock();
+		}
+
+		if (const auto it = m_modules.find(key); it != m_modules.end())
+			return it->second;
+
+		return std::nullopt;
+	}
+
+	static int write_bytecode(lua_State*, const void* data, size_t size, void* user_data)
+	{
+		static_cast<std::string*>(user_data)->append(static_cast<const char*>(data), size);
+		return 0;
+	}
+
+	bool lua_require_index::push_chunk(lua_State* L, const std::filesystem::path& path)
+	{
+		const auto chunk_name = "@" + std::string(reinterpret_cast<const char*>(path.u8string().c_str()));
+
+		std::error_code ec;
+		const auto last_write_time = std::filesystem::last_write_time(path, ec);
+		if (ec)
+		{
+			lua_pushfstring(L, "cannot read '%s': %s", chunk_name.c_str() + 1, ec.message().c_str());
+			return false;
+		}
+
+		{
+			std::lock_guard lock(m_chunks_mutex);
+			if (const auto it = m_chunks.find(path.native()); it != m_chunks.end() && it->second.m_last_write_time == last_write_time)
+			{
+				const auto& bytecode = it->second.m_bytecode;
+				return luaL_loadbufferx(L, bytecode.data(), bytecode.size(), chunk_name.c_str(), "b") == LUA_OK;
+			}
+		}
+
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+		{
+			lua_pushfstring(L, "cannot open '%s'", chunk_name.c_str() + 1);
+			return false;
+		}
+		const std::string source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		if (luaL_loadbufferx(L, source.data(), source.size(), chunk_name.c_str(), "t") != LUA_OK)
+			return false;
+
+		// debug info is kept so that errors still point at the right lines
+		chunk compiled{last_write_time};
+		lua_dump(L, write_bytecode, &compiled.m_bytecode, 0);
+
+		std::lock_guard lock(m_chunks_mutex);
+		m_chunks.insert_or_assign(path.native(), std::move(compiled));
+
+		return true;
+	}
+
+	// returns the amount of values pushed for the searcher, or -1 with the error message pushed
+	static int search_module(lua_State* L, const char* module_name)
+	{
+		const auto path = g_lua_require_index.find(module_name);
+		if (!path)
+		{
+			lua_pushfstring(L, "no file for module '%s' in the scripts folder", module_name);
+			return 1;
+		}
+
+		const auto file_name = std::string(reinterpret_cast<const char*>(path->u8string().c_str()));
+		if (!g_lua_require_index.push_chunk(L, *path))
+		{
+			lua_pushfstring(L, "error loading module '%s' from file '%s':\n\t%s", module_name, file_name.c_str(), lua_tostring(L, -1));
+			return -1;
+		}
+
+		// like the lua searcher, the loader gets the file name as its second argument
+		lua_pushstring(L, file_name.c_str());
+		return 2;
+	}
+
+	int lua_require_index::searcher(lua_State* L)
+	{
+		const auto module_name = luaL_checkstring(L, 1);
+
+		// raised out here, lua errors skip the destructors of the frames they unwind
+		const auto results = search_module(L, module_name);
+		if (results < 0)
+			return lua_error(L);
+
+		return results;
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <shared_mutex>
+
+namespace big
+{
+	/**
+	 * @brief Resolves require() of every lua state against a single index of the scripts folder.
+	 *
+	 * The folder is scanned lazily after mark_dirty() instead of probing one package.path template per directory.
+	 * A module "a.b" matches a/b.lua at the root of the folder first, then in any of its subfolders.
+	 * Compiled chunks are kept by path and write time, so a library required by several modules is only read and parsed once.
+	 */
+	class lua_require_index
+	{
+	public:
+		// the next lookup scans the folder again if it differs from the one indexed
+		void set_folder(const std::filesystem::path& scripts_folder);
+		void mark_dirty();
+
+		std::optional<std::filesystem::path> find(std::string_view module_name);
+
+		/**
+		 * @brief Pushes the compiled chunk of the file on the stack of L, or the error message on failure.
+		 *
+		 * @return true if the chunk was pushed.
+		 */
+		bool push_chunk(lua_State* L, const std::filesystem::path& path);
+
+		// package.searchers entry using the index
+		static int searcher(lua_State* L);
+
+	private:
+		struct chunk
+		{
+			std::filesystem::file_time_type m_last_write_time;
+			std::string m_bytecode;
+		};
+
+		void rebuild();
+
+		std::shared_mutex m_mutex;
+		bool m_dirty = true;
+		std::filesystem::path m_folder;
+		// lowercased module name with '/' separators, to the file it resolves to
+		std::unordered_map<std::string, std::filesystem::path> m_modules;
+
+		std::mutex m_chunks_mutex;
+		std::unordered_map<std::filesystem::path::string_type, chunk> m_chunks;
+	};
+
+	inline lua_require_index g_lua_require_index;
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "native_namespace.hpp"
 
 namespace lua::native
 {
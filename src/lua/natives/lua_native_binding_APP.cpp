@@ -96,25 +96,28 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry APP_natives[] = {
+		{"APP_CLEAR_BLOCK", native_function<LUA_NATIVE_APP_APP_CLEAR_BLOCK>},
+		{"APP_CLOSE_APP", native_function<LUA_NATIVE_APP_APP_CLOSE_APP>},
+		{"APP_CLOSE_BLOCK", native_function<LUA_NATIVE_APP_APP_CLOSE_BLOCK>},
+		{"APP_DATA_VALID", native_function<LUA_NATIVE_APP_APP_DATA_VALID>},
+		{"APP_DELETE_APP_DATA", native_function<LUA_NATIVE_APP_APP_DELETE_APP_DATA>},
+		{"APP_GET_DELETED_FILE_STATUS", native_function<LUA_NATIVE_APP_APP_GET_DELETED_FILE_STATUS>},
+		{"APP_GET_FLOAT", native_function<LUA_NATIVE_APP_APP_GET_FLOAT>},
+		{"APP_GET_INT", native_function<LUA_NATIVE_APP_APP_GET_INT>},
+		{"APP_GET_STRING", native_function<LUA_NATIVE_APP_APP_GET_STRING>},
+		{"APP_HAS_LINKED_SOCIAL_CLUB_ACCOUNT", native_function<LUA_NATIVE_APP_APP_HAS_LINKED_SOCIAL_CLUB_ACCOUNT>},
+		{"APP_HAS_SYNCED_DATA", native_function<LUA_NATIVE_APP_APP_HAS_SYNCED_DATA>},
+		{"APP_SAVE_DATA", native_function<LUA_NATIVE_APP_APP_SAVE_DATA>},
+		{"APP_SET_APP", native_function<LUA_NATIVE_APP_APP_SET_APP>},
+		{"APP_SET_BLOCK", native_function<LUA_NATIVE_APP_APP_SET_BLOCK>},
+		{"APP_SET_FLOAT", native_function<LUA_NATIVE_APP_APP_SET_FLOAT>},
+		{"APP_SET_INT", native_function<LUA_NATIVE_APP_APP_SET_INT>},
+		{"APP_SET_STRING", native_function<LUA_NATIVE_APP_APP_SET_STRING>},
+	};
+
 	void init_native_binding_APP(sol::state& L)
 	{
-		auto APP = L["APP"].get_or_create<sol::table>();
-		APP.set_function("APP_DATA_VALID", LUA_NATIVE_APP_APP_DATA_VALID);
-		APP.set_function("APP_GET_INT", LUA_NATIVE_APP_APP_GET_INT);
-		APP.set_function("APP_GET_FLOAT", LUA_NATIVE_APP_APP_GET_FLOAT);
-		APP.set_function("APP_GET_STRING", LUA_NATIVE_APP_APP_GET_STRING);
-		APP.set_function("APP_SET_INT", LUA_NATIVE_APP_APP_SET_INT);
-		APP.set_function("APP_SET_FLOAT", LUA_NATIVE_APP_APP_SET_FLOAT);
-		APP.set_function("APP_SET_STRING", LUA_NATIVE_APP_APP_SET_STRING);
-		APP.set_function("APP_SET_APP", LUA_NATIVE_APP_APP_SET_APP);
-		APP.set_function("APP_SET_BLOCK", LUA_NATIVE_APP_APP_SET_BLOCK);
-		APP.set_function("APP_CLEAR_BLOCK", LUA_NATIVE_APP_APP_CLEAR_BLOCK);
-		APP.set_function("APP_CLOSE_APP", LUA_NATIVE_APP_APP_CLOSE_APP);
-		APP.set_function("APP_CLOSE_BLOCK", LUA_NATIVE_APP_APP_CLOSE_BLOCK);
-		APP.set_function("APP_HAS_LINKED_SOCIAL_CLUB_ACCOUNT", LUA_NATIVE_APP_APP_HAS_LINKED_SOCIAL_CLUB_ACCOUNT);
-		APP.set_function("APP_HAS_SYNCED_DATA", LUA_NATIVE_APP_APP_HAS_SYNCED_DATA);
-		APP.set_function("APP_SAVE_DATA", LUA_NATIVE_APP_APP_SAVE_DATA);
-		APP.set_function("APP_GET_DELETED_FILE_STATUS", LUA_NATIVE_APP_APP_GET_DELETED_FILE_STATUS);
-		APP.set_function("APP_DELETE_APP_DATA", LUA_NATIVE_APP_APP_DELETE_APP_DATA);
+		bind_namespace(L, "APP", APP_natives);
 	}
 }
@@ -1473,285 +1473,288 @@ namespace lua::native
 		AUDIO::SET_VEHICLE_HORN_SOUND_INDEX(vehicle, value);
 	}
 
+	static constexpr native_entry AUDIO_natives[] = {
+		{"ACTIVATE_AUDIO_SLOWMO_MODE", native_function<LUA_NATIVE_AUDIO_ACTIVATE_AUDIO_SLOWMO_MODE>},
+		{"ADD_ENTITY_TO_AUDIO_MIX_GROUP", native_function<LUA_NATIVE_AUDIO_ADD_ENTITY_TO_AUDIO_MIX_GROUP>},
+		{"ADD_LINE_TO_CONVERSATION", native_function<LUA_NATIVE_AUDIO_ADD_LINE_TO_CONVERSATION>},
+		{"ADD_PED_TO_CONVERSATION", native_function<LUA_NATIVE_AUDIO_ADD_PED_TO_CONVERSATION>},
+		{"AUDIO_IS_MUSIC_PLAYING", native_function<LUA_NATIVE_AUDIO_AUDIO_IS_MUSIC_PLAYING>},
+		{"AUDIO_IS_SCRIPTED_MUSIC_PLAYING", native_function<LUA_NATIVE_AUDIO_AUDIO_IS_SCRIPTED_MUSIC_PLAYING>},
+		{"BLIP_SIREN", native_function<LUA_NATIVE_AUDIO_BLIP_SIREN>},
+		{"BLOCK_ALL_SPEECH_FROM_PED", native_function<LUA_NATIVE_AUDIO_BLOCK_ALL_SPEECH_FROM_PED>},
+		{"BLOCK_DEATH_JINGLE", native_function<LUA_NATIVE_AUDIO_BLOCK_DEATH_JINGLE>},
+		{"BLOCK_SPEECH_CONTEXT_GROUP", native_function<LUA_NATIVE_AUDIO_BLOCK_SPEECH_CONTEXT_GROUP>},
+		{"CANCEL_ALL_POLICE_REPORTS", native_function<LUA_NATIVE_AUDIO_CANCEL_ALL_POLICE_REPORTS>},
+		{"CANCEL_MUSIC_EVENT", native_function<LUA_NATIVE_AUDIO_CANCEL_MUSIC_EVENT>},
+		{"CAN_VEHICLE_RECEIVE_CB_RADIO", native_function<LUA_NATIVE_AUDIO_CAN_VEHICLE_RECEIVE_CB_RADIO>},
+		{"CLEAR_ALL_BROKEN_GLASS", native_function<LUA_NATIVE_AUDIO_CLEAR_ALL_BROKEN_GLASS>},
+		{"CLEAR_AMBIENT_ZONE_LIST_STATE", native_function<LUA_NATIVE_AUDIO_CLEAR_AMBIENT_ZONE_LIST_STATE>},
+		{"CLEAR_AMBIENT_ZONE_STATE", native_function<LUA_NATIVE_AUDIO_CLEAR_AMBIENT_ZONE_STATE>},
+		{"CLEAR_CUSTOM_RADIO_TRACK_LIST", native_function<LUA_NATIVE_AUDIO_CLEAR_CUSTOM_RADIO_TRACK_LIST>},
+		{"CREATE_NEW_SCRIPTED_CONVERSATION", native_function<LUA_NATIVE_AUDIO_CREATE_NEW_SCRIPTED_CONVERSATION>},
+		{"DEACTIVATE_AUDIO_SLOWMO_MODE", native_function<LUA_NATIVE_AUDIO_DEACTIVATE_AUDIO_SLOWMO_MODE>},
+		{"DISABLE_PED_PAIN_AUDIO", native_function<LUA_NATIVE_AUDIO_DISABLE_PED_PAIN_AUDIO>},
+		{"DISTANT_COP_CAR_SIRENS", native_function<LUA_NATIVE_AUDIO_DISTANT_COP_CAR_SIRENS>},
+		{"DOES_CONTEXT_EXIST_FOR_THIS_PED", native_function<LUA_NATIVE_AUDIO_DOES_CONTEXT_EXIST_FOR_THIS_PED>},
+		{"DOES_PLAYER_VEH_HAVE_RADIO", native_function<LUA_NATIVE_AUDIO_DOES_PLAYER_VEH_HAVE_RADIO>},
+		{"ENABLE_DRAG_RACE_STATIONARY_WARNING_SOUNDS_", native_function<LUA_NATIVE_AUDIO_ENABLE_DRAG_RACE_STATIONARY_WARNING_SOUNDS_>},
+		{"ENABLE_STALL_WARNING_SOUNDS", native_function<LUA_NATIVE_AUDIO_ENABLE_STALL_WARNING_SOUNDS>},
+		{"ENABLE_STUNT_JUMP_AUDIO", native_function<LUA_NATIVE_AUDIO_ENABLE_STUNT_JUMP_AUDIO>},
+		{"ENABLE_VEHICLE_EXHAUST_POPS", native_function<LUA_NATIVE_AUDIO_ENABLE_VEHICLE_EXHAUST_POPS>},
+		{"ENABLE_VEHICLE_FANBELT_DAMAGE", native_function<LUA_NATIVE_AUDIO_ENABLE_VEHICLE_FANBELT_DAMAGE>},
+		{"FIND_RADIO_STATION_INDEX", native_function<LUA_NATIVE_AUDIO_FIND_RADIO_STATION_INDEX>},
+		{"FORCE_MUSIC_TRACK_LIST", native_function<LUA_NATIVE_AUDIO_FORCE_MUSIC_TRACK_LIST>},
+		{"FORCE_PED_PANIC_WALLA", native_function<LUA_NATIVE_AUDIO_FORCE_PED_PANIC_WALLA>},
+		{"FORCE_USE_AUDIO_GAME_OBJECT", native_function<LUA_NATIVE_AUDIO_FORCE_USE_AUDIO_GAME_OBJECT>},
+		{"FREEZE_MICROPHONE", native_function<LUA_NATIVE_AUDIO_FREEZE_MICROPHONE>},
+		{"FREEZE_RADIO_STATION", native_function<LUA_NATIVE_AUDIO_FREEZE_RADIO_STATION>},
+		{"GET_AMBIENT_VOICE_NAME_HASH", native_function<LUA_NATIVE_AUDIO_GET_AMBIENT_VOICE_NAME_HASH>},
+		{"GET_AUDIBLE_MUSIC_TRACK_TEXT_ID", native_function<LUA_NATIVE_AUDIO_GET_AUDIBLE_MUSIC_TRACK_TEXT_ID>},
+		{"GET_CURRENT_SCRIPTED_CONVERSATION_LINE", native_function<LUA_NATIVE_AUDIO_GET_CURRENT_SCRIPTED_CONVERSATION_LINE>},
+		{"GET_CURRENT_TRACK_PLAY_TIME", native_function<LUA_NATIVE_AUDIO_GET_CURRENT_TRACK_PLAY_TIME>},
+		{"GET_CURRENT_TRACK_SOUND_NAME", native_function<LUA_NATIVE_AUDIO_GET_CURRENT_TRACK_SOUND_NAME>},
+		{"GET_CURRENT_TV_SHOW_PLAY_TIME", native_function<LUA_NATIVE_AUDIO_GET_CURRENT_TV_SHOW_PLAY_TIME>},
+		{"GET_IS_PRELOADED_CONVERSATION_READY", native_function<LUA_NATIVE_AUDIO_GET_IS_PRELOADED_CONVERSATION_READY>},
+		{"GET_MUSIC_PLAYTIME", native_function<LUA_NATIVE_AUDIO_GET_MUSIC_PLAYTIME>},
+		{"GET_MUSIC_VOL_SLIDER", native_function<LUA_NATIVE_AUDIO_GET_MUSIC_VOL_SLIDER>},
+		{"GET_NETWORK_ID_FROM_SOUND_ID", native_function<LUA_NATIVE_AUDIO_GET_NETWORK_ID_FROM_SOUND_ID>},
+		{"GET_NEXT_AUDIBLE_BEAT", native_function<LUA_NATIVE_AUDIO_GET_NEXT_AUDIBLE_BEAT>},
+		{"GET_NUM_UNLOCKED_RADIO_STATIONS", native_function<LUA_NATIVE_AUDIO_GET_NUM_UNLOCKED_RADIO_STATIONS>},
+		{"GET_PLAYER_RADIO_STATION_GENRE", native_function<LUA_NATIVE_AUDIO_GET_PLAYER_RADIO_STATION_GENRE>},
+		{"GET_PLAYER_RADIO_STATION_INDEX", native_function<LUA_NATIVE_AUDIO_GET_PLAYER_RADIO_STATION_INDEX>},
+		{"GET_PLAYER_RADIO_STATION_NAME", native_function<LUA_NATIVE_AUDIO_GET_PLAYER_RADIO_STATION_NAME>},
+		{"GET_RADIO_STATION_NAME", native_function<LUA_NATIVE_AUDIO_GET_RADIO_STATION_NAME>},
+		{"GET_SOUND_ID", native_function<LUA_NATIVE_AUDIO_GET_SOUND_ID>},
+		{"GET_SOUND_ID_FROM_NETWORK_ID", native_function<LUA_NATIVE_AUDIO_GET_SOUND_ID_FROM_NETWORK_ID>},
+		{"GET_STREAM_PLAY_TIME", native_function<LUA_NATIVE_AUDIO_GET_STREAM_PLAY_TIME>},
+		{"GET_VARIATION_CHOSEN_FOR_SCRIPTED_LINE", native_function<LUA_NATIVE_AUDIO_GET_VARIATION_CHOSEN_FOR_SCRIPTED_LINE>},
+		{"GET_VEHICLE_DEFAULT_HORN", native_function<LUA_NATIVE_AUDIO_GET_VEHICLE_DEFAULT_HORN>},
+		{"GET_VEHICLE_DEFAULT_HORN_IGNORE_MODS", native_function<LUA_NATIVE_AUDIO_GET_VEHICLE_DEFAULT_HORN_IGNORE_MODS>},
+		{"GET_VEHICLE_HORN_SOUND_INDEX", native_function<LUA_NATIVE_AUDIO_GET_VEHICLE_HORN_SOUND_INDEX>},
+		{"HAS_LOADED_MP_DATA_SET", native_function<LUA_NATIVE_AUDIO_HAS_LOADED_MP_DATA_SET>},
+		{"HAS_LOADED_SP_DATA_SET", native_function<LUA_NATIVE_AUDIO_HAS_LOADED_SP_DATA_SET>},
+		{"HAS_SOUND_FINISHED", native_function<LUA_NATIVE_AUDIO_HAS_SOUND_FINISHED>},
+		{"HINT_AMBIENT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_HINT_AMBIENT_AUDIO_BANK>},
+		{"HINT_MISSION_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_HINT_MISSION_AUDIO_BANK>},
+		{"HINT_SCRIPT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_HINT_SCRIPT_AUDIO_BANK>},
+		{"INIT_SYNCH_SCENE_AUDIO_WITH_ENTITY", native_function<LUA_NATIVE_AUDIO_INIT_SYNCH_SCENE_AUDIO_WITH_ENTITY>},
+		{"INIT_SYNCH_SCENE_AUDIO_WITH_POSITION", native_function<LUA_NATIVE_AUDIO_INIT_SYNCH_SCENE_AUDIO_WITH_POSITION>},
+		{"INTERRUPT_CONVERSATION", native_function<LUA_NATIVE_AUDIO_INTERRUPT_CONVERSATION>},
+		{"INTERRUPT_CONVERSATION_AND_PAUSE", native_function<LUA_NATIVE_AUDIO_INTERRUPT_CONVERSATION_AND_PAUSE>},
+		{"IS_ALARM_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_ALARM_PLAYING>},
+		{"IS_AMBIENT_SPEECH_DISABLED", native_function<LUA_NATIVE_AUDIO_IS_AMBIENT_SPEECH_DISABLED>},
+		{"IS_AMBIENT_SPEECH_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_AMBIENT_SPEECH_PLAYING>},
+		{"IS_AMBIENT_ZONE_ENABLED", native_function<LUA_NATIVE_AUDIO_IS_AMBIENT_ZONE_ENABLED>},
+		{"IS_ANIMAL_VOCALIZATION_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_ANIMAL_VOCALIZATION_PLAYING>},
+		{"IS_ANY_POSITIONAL_SPEECH_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_ANY_POSITIONAL_SPEECH_PLAYING>},
+		{"IS_ANY_SPEECH_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_ANY_SPEECH_PLAYING>},
+		{"IS_AUDIO_SCENE_ACTIVE", native_function<LUA_NATIVE_AUDIO_IS_AUDIO_SCENE_ACTIVE>},
+		{"IS_GAME_IN_CONTROL_OF_MUSIC", native_function<LUA_NATIVE_AUDIO_IS_GAME_IN_CONTROL_OF_MUSIC>},
+		{"IS_HORN_ACTIVE", native_function<LUA_NATIVE_AUDIO_IS_HORN_ACTIVE>},
+		{"IS_MISSION_COMPLETE_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_MISSION_COMPLETE_PLAYING>},
+		{"IS_MISSION_COMPLETE_READY_FOR_UI", native_function<LUA_NATIVE_AUDIO_IS_MISSION_COMPLETE_READY_FOR_UI>},
+		{"IS_MISSION_NEWS_STORY_UNLOCKED", native_function<LUA_NATIVE_AUDIO_IS_MISSION_NEWS_STORY_UNLOCKED>},
+		{"IS_MOBILE_INTERFERENCE_ACTIVE", native_function<LUA_NATIVE_AUDIO_IS_MOBILE_INTERFERENCE_ACTIVE>},
+		{"IS_MOBILE_PHONE_CALL_ONGOING", native_function<LUA_NATIVE_AUDIO_IS_MOBILE_PHONE_CALL_ONGOING>},
+		{"IS_MOBILE_PHONE_RADIO_ACTIVE", native_function<LUA_NATIVE_AUDIO_IS_MOBILE_PHONE_RADIO_ACTIVE>},
+		{"IS_MUSIC_ONESHOT_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_MUSIC_ONESHOT_PLAYING>},
+		{"IS_PED_IN_CURRENT_CONVERSATION", native_function<LUA_NATIVE_AUDIO_IS_PED_IN_CURRENT_CONVERSATION>},
+		{"IS_PED_RINGTONE_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_PED_RINGTONE_PLAYING>},
+		{"IS_PLAYER_VEH_RADIO_ENABLE", native_function<LUA_NATIVE_AUDIO_IS_PLAYER_VEH_RADIO_ENABLE>},
+		{"IS_RADIO_FADED_OUT", native_function<LUA_NATIVE_AUDIO_IS_RADIO_FADED_OUT>},
+		{"IS_RADIO_RETUNING", native_function<LUA_NATIVE_AUDIO_IS_RADIO_RETUNING>},
+		{"IS_RADIO_STATION_FAVOURITED", native_function<LUA_NATIVE_AUDIO_IS_RADIO_STATION_FAVOURITED>},
+		{"IS_SCRIPTED_CONVERSATION_LOADED", native_function<LUA_NATIVE_AUDIO_IS_SCRIPTED_CONVERSATION_LOADED>},
+		{"IS_SCRIPTED_CONVERSATION_ONGOING", native_function<LUA_NATIVE_AUDIO_IS_SCRIPTED_CONVERSATION_ONGOING>},
+		{"IS_SCRIPTED_SPEECH_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_SCRIPTED_SPEECH_PLAYING>},
+		{"IS_STREAM_PLAYING", native_function<LUA_NATIVE_AUDIO_IS_STREAM_PLAYING>},
+		{"IS_VEHICLE_AUDIBLY_DAMAGED", native_function<LUA_NATIVE_AUDIO_IS_VEHICLE_AUDIBLY_DAMAGED>},
+		{"IS_VEHICLE_RADIO_ON", native_function<LUA_NATIVE_AUDIO_IS_VEHICLE_RADIO_ON>},
+		{"LINK_STATIC_EMITTER_TO_ENTITY", native_function<LUA_NATIVE_AUDIO_LINK_STATIC_EMITTER_TO_ENTITY>},
+		{"LOAD_STREAM", native_function<LUA_NATIVE_AUDIO_LOAD_STREAM>},
+		{"LOAD_STREAM_WITH_START_OFFSET", native_function<LUA_NATIVE_AUDIO_LOAD_STREAM_WITH_START_OFFSET>},
+		{"LOCK_RADIO_STATION", native_function<LUA_NATIVE_AUDIO_LOCK_RADIO_STATION>},
+		{"LOCK_RADIO_STATION_TRACK_LIST", native_function<LUA_NATIVE_AUDIO_LOCK_RADIO_STATION_TRACK_LIST>},
+		{"OVERRIDE_MICROPHONE_SETTINGS", native_function<LUA_NATIVE_AUDIO_OVERRIDE_MICROPHONE_SETTINGS>},
+		{"OVERRIDE_PLAYER_GROUND_MATERIAL", native_function<LUA_NATIVE_AUDIO_OVERRIDE_PLAYER_GROUND_MATERIAL>},
+		{"OVERRIDE_TREVOR_RAGE", native_function<LUA_NATIVE_AUDIO_OVERRIDE_TREVOR_RAGE>},
+		{"OVERRIDE_UNDERWATER_STREAM", native_function<LUA_NATIVE_AUDIO_OVERRIDE_UNDERWATER_STREAM>},
+		{"OVERRIDE_VEH_HORN", native_function<LUA_NATIVE_AUDIO_OVERRIDE_VEH_HORN>},
+		{"PAUSE_SCRIPTED_CONVERSATION", native_function<LUA_NATIVE_AUDIO_PAUSE_SCRIPTED_CONVERSATION>},
+		{"PLAY_AMBIENT_SPEECH_FROM_POSITION_NATIVE", native_function<LUA_NATIVE_AUDIO_PLAY_AMBIENT_SPEECH_FROM_POSITION_NATIVE>},
+		{"PLAY_ANIMAL_VOCALIZATION", native_function<LUA_NATIVE_AUDIO_PLAY_ANIMAL_VOCALIZATION>},
+		{"PLAY_DEFERRED_SOUND_FRONTEND", native_function<LUA_NATIVE_AUDIO_PLAY_DEFERRED_SOUND_FRONTEND>},
+		{"PLAY_END_CREDITS_MUSIC", native_function<LUA_NATIVE_AUDIO_PLAY_END_CREDITS_MUSIC>},
+		{"PLAY_MISSION_COMPLETE_AUDIO", native_function<LUA_NATIVE_AUDIO_PLAY_MISSION_COMPLETE_AUDIO>},
+		{"PLAY_PAIN", native_function<LUA_NATIVE_AUDIO_PLAY_PAIN>},
+		{"PLAY_PED_AMBIENT_SPEECH_AND_CLONE_NATIVE", native_function<LUA_NATIVE_AUDIO_PLAY_PED_AMBIENT_SPEECH_AND_CLONE_NATIVE>},
+		{"PLAY_PED_AMBIENT_SPEECH_NATIVE", native_function<LUA_NATIVE_AUDIO_PLAY_PED_AMBIENT_SPEECH_NATIVE>},
+		{"PLAY_PED_AMBIENT_SPEECH_WITH_VOICE_NATIVE", native_function<LUA_NATIVE_AUDIO_PLAY_PED_AMBIENT_SPEECH_WITH_VOICE_NATIVE>},
+		{"PLAY_PED_RINGTONE", native_function<LUA_NATIVE_AUDIO_PLAY_PED_RINGTONE>},
+		{"PLAY_POLICE_REPORT", native_function<LUA_NATIVE_AUDIO_PLAY_POLICE_REPORT>},
+		{"PLAY_SOUND", native_function<LUA_NATIVE_AUDIO_PLAY_SOUND>},
+		{"PLAY_SOUND_FROM_COORD", native_function<LUA_NATIVE_AUDIO_PLAY_SOUND_FROM_COORD>},
+		{"PLAY_SOUND_FROM_ENTITY", native_function<LUA_NATIVE_AUDIO_PLAY_SOUND_FROM_ENTITY>},
+		{"PLAY_SOUND_FROM_ENTITY_HASH", native_function<LUA_NATIVE_AUDIO_PLAY_SOUND_FROM_ENTITY_HASH>},
+		{"PLAY_SOUND_FRONTEND", native_function<LUA_NATIVE_AUDIO_PLAY_SOUND_FRONTEND>},
+		{"PLAY_STREAM_FROM_OBJECT", native_function<LUA_NATIVE_AUDIO_PLAY_STREAM_FROM_OBJECT>},
+		{"PLAY_STREAM_FROM_PED", native_function<LUA_NATIVE_AUDIO_PLAY_STREAM_FROM_PED>},
+		{"PLAY_STREAM_FROM_POSITION", native_function<LUA_NATIVE_AUDIO_PLAY_STREAM_FROM_POSITION>},
+		{"PLAY_STREAM_FROM_VEHICLE", native_function<LUA_NATIVE_AUDIO_PLAY_STREAM_FROM_VEHICLE>},
+		{"PLAY_STREAM_FRONTEND", native_function<LUA_NATIVE_AUDIO_PLAY_STREAM_FRONTEND>},
+		{"PLAY_SYNCHRONIZED_AUDIO_EVENT", native_function<LUA_NATIVE_AUDIO_PLAY_SYNCHRONIZED_AUDIO_EVENT>},
+		{"PLAY_VEHICLE_DOOR_CLOSE_SOUND", native_function<LUA_NATIVE_AUDIO_PLAY_VEHICLE_DOOR_CLOSE_SOUND>},
+		{"PLAY_VEHICLE_DOOR_OPEN_SOUND", native_function<LUA_NATIVE_AUDIO_PLAY_VEHICLE_DOOR_OPEN_SOUND>},
+		{"PRELOAD_SCRIPT_CONVERSATION", native_function<LUA_NATIVE_AUDIO_PRELOAD_SCRIPT_CONVERSATION>},
+		{"PRELOAD_SCRIPT_PHONE_CONVERSATION", native_function<LUA_NATIVE_AUDIO_PRELOAD_SCRIPT_PHONE_CONVERSATION>},
+		{"PRELOAD_VEHICLE_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_PRELOAD_VEHICLE_AUDIO_BANK>},
+		{"PREPARE_ALARM", native_function<LUA_NATIVE_AUDIO_PREPARE_ALARM>},
+		{"PREPARE_MUSIC_EVENT", native_function<LUA_NATIVE_AUDIO_PREPARE_MUSIC_EVENT>},
+		{"PREPARE_SYNCHRONIZED_AUDIO_EVENT", native_function<LUA_NATIVE_AUDIO_PREPARE_SYNCHRONIZED_AUDIO_EVENT>},
+		{"PREPARE_SYNCHRONIZED_AUDIO_EVENT_FOR_SCENE", native_function<LUA_NATIVE_AUDIO_PREPARE_SYNCHRONIZED_AUDIO_EVENT_FOR_SCENE>},
+		{"RECORD_BROKEN_GLASS", native_function<LUA_NATIVE_AUDIO_RECORD_BROKEN_GLASS>},
+		{"REFRESH_CLOSEST_OCEAN_SHORELINE", native_function<LUA_NATIVE_AUDIO_REFRESH_CLOSEST_OCEAN_SHORELINE>},
+		{"REGISTER_SCRIPT_WITH_AUDIO", native_function<LUA_NATIVE_AUDIO_REGISTER_SCRIPT_WITH_AUDIO>},
+		{"RELEASE_AMBIENT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_RELEASE_AMBIENT_AUDIO_BANK>},
+		{"RELEASE_MISSION_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_RELEASE_MISSION_AUDIO_BANK>},
+		{"RELEASE_NAMED_SCRIPT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_RELEASE_NAMED_SCRIPT_AUDIO_BANK>},
+		{"RELEASE_SCRIPT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_RELEASE_SCRIPT_AUDIO_BANK>},
+		{"RELEASE_SOUND_ID", native_function<LUA_NATIVE_AUDIO_RELEASE_SOUND_ID>},
+		{"RELEASE_WEAPON_AUDIO", native_function<LUA_NATIVE_AUDIO_RELEASE_WEAPON_AUDIO>},
+		{"REMOVE_ENTITY_FROM_AUDIO_MIX_GROUP", native_function<LUA_NATIVE_AUDIO_REMOVE_ENTITY_FROM_AUDIO_MIX_GROUP>},
+		{"REMOVE_PORTAL_SETTINGS_OVERRIDE", native_function<LUA_NATIVE_AUDIO_REMOVE_PORTAL_SETTINGS_OVERRIDE>},
+		{"REQUEST_AMBIENT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_REQUEST_AMBIENT_AUDIO_BANK>},
+		{"REQUEST_MISSION_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_REQUEST_MISSION_AUDIO_BANK>},
+		{"REQUEST_SCRIPT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_REQUEST_SCRIPT_AUDIO_BANK>},
+		{"REQUEST_TENNIS_BANKS", native_function<LUA_NATIVE_AUDIO_REQUEST_TENNIS_BANKS>},
+		{"RESET_PED_AUDIO_FLAGS", native_function<LUA_NATIVE_AUDIO_RESET_PED_AUDIO_FLAGS>},
+		{"RESET_TREVOR_RAGE", native_function<LUA_NATIVE_AUDIO_RESET_TREVOR_RAGE>},
+		{"RESET_VEHICLE_STARTUP_REV_SOUND", native_function<LUA_NATIVE_AUDIO_RESET_VEHICLE_STARTUP_REV_SOUND>},
+		{"RESTART_SCRIPTED_CONVERSATION", native_function<LUA_NATIVE_AUDIO_RESTART_SCRIPTED_CONVERSATION>},
+		{"SCRIPT_OVERRIDES_WIND_ELEVATION", native_function<LUA_NATIVE_AUDIO_SCRIPT_OVERRIDES_WIND_ELEVATION>},
+		{"SET_AGGRESSIVE_HORNS", native_function<LUA_NATIVE_AUDIO_SET_AGGRESSIVE_HORNS>},
+		{"SET_AMBIENT_VOICE_NAME", native_function<LUA_NATIVE_AUDIO_SET_AMBIENT_VOICE_NAME>},
+		{"SET_AMBIENT_VOICE_NAME_HASH", native_function<LUA_NATIVE_AUDIO_SET_AMBIENT_VOICE_NAME_HASH>},
+		{"SET_AMBIENT_ZONE_LIST_STATE", native_function<LUA_NATIVE_AUDIO_SET_AMBIENT_ZONE_LIST_STATE>},
+		{"SET_AMBIENT_ZONE_LIST_STATE_PERSISTENT", native_function<LUA_NATIVE_AUDIO_SET_AMBIENT_ZONE_LIST_STATE_PERSISTENT>},
+		{"SET_AMBIENT_ZONE_STATE", native_function<LUA_NATIVE_AUDIO_SET_AMBIENT_ZONE_STATE>},
+		{"SET_AMBIENT_ZONE_STATE_PERSISTENT", native_function<LUA_NATIVE_AUDIO_SET_AMBIENT_ZONE_STATE_PERSISTENT>},
+		{"SET_ANIMAL_MOOD", native_function<LUA_NATIVE_AUDIO_SET_ANIMAL_MOOD>},
+		{"SET_AUDIO_FLAG", native_function<LUA_NATIVE_AUDIO_SET_AUDIO_FLAG>},
+		{"SET_AUDIO_SCENE_VARIABLE", native_function<LUA_NATIVE_AUDIO_SET_AUDIO_SCENE_VARIABLE>},
+		{"SET_AUDIO_SCRIPT_CLEANUP_TIME", native_function<LUA_NATIVE_AUDIO_SET_AUDIO_SCRIPT_CLEANUP_TIME>},
+		{"SET_AUDIO_SPECIAL_EFFECT_MODE", native_function<LUA_NATIVE_AUDIO_SET_AUDIO_SPECIAL_EFFECT_MODE>},
+		{"SET_AUDIO_VEHICLE_PRIORITY", native_function<LUA_NATIVE_AUDIO_SET_AUDIO_VEHICLE_PRIORITY>},
+		{"SET_CONVERSATION_AUDIO_CONTROLLED_BY_ANIM", native_function<LUA_NATIVE_AUDIO_SET_CONVERSATION_AUDIO_CONTROLLED_BY_ANIM>},
+		{"SET_CONVERSATION_AUDIO_PLACEHOLDER", native_function<LUA_NATIVE_AUDIO_SET_CONVERSATION_AUDIO_PLACEHOLDER>},
+		{"SET_CUSTOM_RADIO_TRACK_LIST", native_function<LUA_NATIVE_AUDIO_SET_CUSTOM_RADIO_TRACK_LIST>},
+		{"SET_CUTSCENE_AUDIO_OVERRIDE", native_function<LUA_NATIVE_AUDIO_SET_CUTSCENE_AUDIO_OVERRIDE>},
+		{"SET_EMITTER_RADIO_STATION", native_function<LUA_NATIVE_AUDIO_SET_EMITTER_RADIO_STATION>},
+		{"SET_ENTITY_FOR_NULL_CONV_PED", native_function<LUA_NATIVE_AUDIO_SET_ENTITY_FOR_NULL_CONV_PED>},
+		{"SET_FRONTEND_RADIO_ACTIVE", native_function<LUA_NATIVE_AUDIO_SET_FRONTEND_RADIO_ACTIVE>},
+		{"SET_GLOBAL_RADIO_SIGNAL_LEVEL", native_function<LUA_NATIVE_AUDIO_SET_GLOBAL_RADIO_SIGNAL_LEVEL>},
+		{"SET_GPS_ACTIVE", native_function<LUA_NATIVE_AUDIO_SET_GPS_ACTIVE>},
+		{"SET_HORN_ENABLED", native_function<LUA_NATIVE_AUDIO_SET_HORN_ENABLED>},
+		{"SET_HORN_PERMANENTLY_ON", native_function<LUA_NATIVE_AUDIO_SET_HORN_PERMANENTLY_ON>},
+		{"SET_HORN_PERMANENTLY_ON_TIME", native_function<LUA_NATIVE_AUDIO_SET_HORN_PERMANENTLY_ON_TIME>},
+		{"SET_INITIAL_PLAYER_STATION", native_function<LUA_NATIVE_AUDIO_SET_INITIAL_PLAYER_STATION>},
+		{"SET_MICROPHONE_POSITION", native_function<LUA_NATIVE_AUDIO_SET_MICROPHONE_POSITION>},
+		{"SET_MOBILE_PHONE_RADIO_STATE", native_function<LUA_NATIVE_AUDIO_SET_MOBILE_PHONE_RADIO_STATE>},
+		{"SET_MOBILE_RADIO_ENABLED_DURING_GAMEPLAY", native_function<LUA_NATIVE_AUDIO_SET_MOBILE_RADIO_ENABLED_DURING_GAMEPLAY>},
+		{"SET_NEXT_RADIO_TRACK", native_function<LUA_NATIVE_AUDIO_SET_NEXT_RADIO_TRACK>},
+		{"SET_NO_DUCKING_FOR_CONVERSATION", native_function<LUA_NATIVE_AUDIO_SET_NO_DUCKING_FOR_CONVERSATION>},
+		{"SET_PED_CLOTH_EVENTS_ENABLED", native_function<LUA_NATIVE_AUDIO_SET_PED_CLOTH_EVENTS_ENABLED>},
+		{"SET_PED_FOOTSTEPS_EVENTS_ENABLED", native_function<LUA_NATIVE_AUDIO_SET_PED_FOOTSTEPS_EVENTS_ENABLED>},
+		{"SET_PED_GENDER", native_function<LUA_NATIVE_AUDIO_SET_PED_GENDER>},
+		{"SET_PED_INTERIOR_WALLA_DENSITY", native_function<LUA_NATIVE_AUDIO_SET_PED_INTERIOR_WALLA_DENSITY>},
+		{"SET_PED_IS_DRUNK", native_function<LUA_NATIVE_AUDIO_SET_PED_IS_DRUNK>},
+		{"SET_PED_RACE_AND_VOICE_GROUP", native_function<LUA_NATIVE_AUDIO_SET_PED_RACE_AND_VOICE_GROUP>},
+		{"SET_PED_VOICE_FULL", native_function<LUA_NATIVE_AUDIO_SET_PED_VOICE_FULL>},
+		{"SET_PED_VOICE_GROUP", native_function<LUA_NATIVE_AUDIO_SET_PED_VOICE_GROUP>},
+		{"SET_PED_VOICE_GROUP_FROM_RACE_TO_PVG", native_function<LUA_NATIVE_AUDIO_SET_PED_VOICE_GROUP_FROM_RACE_TO_PVG>},
+		{"SET_PED_WALLA_DENSITY", native_function<LUA_NATIVE_AUDIO_SET_PED_WALLA_DENSITY>},
+		{"SET_PLAYER_ANGRY", native_function<LUA_NATIVE_AUDIO_SET_PLAYER_ANGRY>},
+		{"SET_PLAYER_VEHICLE_ALARM_AUDIO_ACTIVE", native_function<LUA_NATIVE_AUDIO_SET_PLAYER_VEHICLE_ALARM_AUDIO_ACTIVE>},
+		{"SET_PORTAL_SETTINGS_OVERRIDE", native_function<LUA_NATIVE_AUDIO_SET_PORTAL_SETTINGS_OVERRIDE>},
+		{"SET_POSITIONED_PLAYER_VEHICLE_RADIO_EMITTER_ENABLED", native_function<LUA_NATIVE_AUDIO_SET_POSITIONED_PLAYER_VEHICLE_RADIO_EMITTER_ENABLED>},
+		{"SET_POSITION_FOR_NULL_CONV_PED", native_function<LUA_NATIVE_AUDIO_SET_POSITION_FOR_NULL_CONV_PED>},
+		{"SET_RADIO_AUTO_UNFREEZE", native_function<LUA_NATIVE_AUDIO_SET_RADIO_AUTO_UNFREEZE>},
+		{"SET_RADIO_FRONTEND_FADE_TIME", native_function<LUA_NATIVE_AUDIO_SET_RADIO_FRONTEND_FADE_TIME>},
+		{"SET_RADIO_POSITION_AUDIO_MUTE", native_function<LUA_NATIVE_AUDIO_SET_RADIO_POSITION_AUDIO_MUTE>},
+		{"SET_RADIO_RETUNE_DOWN", native_function<LUA_NATIVE_AUDIO_SET_RADIO_RETUNE_DOWN>},
+		{"SET_RADIO_RETUNE_UP", native_function<LUA_NATIVE_AUDIO_SET_RADIO_RETUNE_UP>},
+		{"SET_RADIO_STATION_AS_FAVOURITE", native_function<LUA_NATIVE_AUDIO_SET_RADIO_STATION_AS_FAVOURITE>},
+		{"SET_RADIO_STATION_MUSIC_ONLY", native_function<LUA_NATIVE_AUDIO_SET_RADIO_STATION_MUSIC_ONLY>},
+		{"SET_RADIO_TO_STATION_INDEX", native_function<LUA_NATIVE_AUDIO_SET_RADIO_TO_STATION_INDEX>},
+		{"SET_RADIO_TO_STATION_NAME", native_function<LUA_NATIVE_AUDIO_SET_RADIO_TO_STATION_NAME>},
+		{"SET_RADIO_TRACK", native_function<LUA_NATIVE_AUDIO_SET_RADIO_TRACK>},
+		{"SET_RADIO_TRACK_WITH_START_OFFSET", native_function<LUA_NATIVE_AUDIO_SET_RADIO_TRACK_WITH_START_OFFSET>},
+		{"SET_SCRIPT_UPDATE_DOOR_AUDIO", native_function<LUA_NATIVE_AUDIO_SET_SCRIPT_UPDATE_DOOR_AUDIO>},
+		{"SET_SIREN_BYPASS_MP_DRIVER_CHECK", native_function<LUA_NATIVE_AUDIO_SET_SIREN_BYPASS_MP_DRIVER_CHECK>},
+		{"SET_SIREN_CAN_BE_CONTROLLED_BY_AUDIO", native_function<LUA_NATIVE_AUDIO_SET_SIREN_CAN_BE_CONTROLLED_BY_AUDIO>},
+		{"SET_SIREN_WITH_NO_DRIVER", native_function<LUA_NATIVE_AUDIO_SET_SIREN_WITH_NO_DRIVER>},
+		{"SET_SKIP_MINIGUN_SPIN_UP_AUDIO", native_function<LUA_NATIVE_AUDIO_SET_SKIP_MINIGUN_SPIN_UP_AUDIO>},
+		{"SET_STATIC_EMITTER_ENABLED", native_function<LUA_NATIVE_AUDIO_SET_STATIC_EMITTER_ENABLED>},
+		{"SET_USER_RADIO_CONTROL_ENABLED", native_function<LUA_NATIVE_AUDIO_SET_USER_RADIO_CONTROL_ENABLED>},
+		{"SET_VARIABLE_ON_SOUND", native_function<LUA_NATIVE_AUDIO_SET_VARIABLE_ON_SOUND>},
+		{"SET_VARIABLE_ON_STREAM", native_function<LUA_NATIVE_AUDIO_SET_VARIABLE_ON_STREAM>},
+		{"SET_VARIABLE_ON_SYNCH_SCENE_AUDIO", native_function<LUA_NATIVE_AUDIO_SET_VARIABLE_ON_SYNCH_SCENE_AUDIO>},
+		{"SET_VARIABLE_ON_UNDER_WATER_STREAM", native_function<LUA_NATIVE_AUDIO_SET_VARIABLE_ON_UNDER_WATER_STREAM>},
+		{"SET_VEHICLE_AUDIO_BODY_DAMAGE_FACTOR", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_AUDIO_BODY_DAMAGE_FACTOR>},
+		{"SET_VEHICLE_AUDIO_ENGINE_DAMAGE_FACTOR", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_AUDIO_ENGINE_DAMAGE_FACTOR>},
+		{"SET_VEHICLE_BOOST_ACTIVE", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_BOOST_ACTIVE>},
+		{"SET_VEHICLE_CONVERSATIONS_PERSIST", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_CONVERSATIONS_PERSIST>},
+		{"SET_VEHICLE_CONVERSATIONS_PERSIST_NEW", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_CONVERSATIONS_PERSIST_NEW>},
+		{"SET_VEHICLE_FORCE_REVERSE_WARNING", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_FORCE_REVERSE_WARNING>},
+		{"SET_VEHICLE_HORN_SOUND_INDEX", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_HORN_SOUND_INDEX>},
+		{"SET_VEHICLE_MISSILE_WARNING_ENABLED", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_MISSILE_WARNING_ENABLED>},
+		{"SET_VEHICLE_RADIO_ENABLED", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_RADIO_ENABLED>},
+		{"SET_VEHICLE_RADIO_LOUD", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_RADIO_LOUD>},
+		{"SET_VEHICLE_STARTUP_REV_SOUND", native_function<LUA_NATIVE_AUDIO_SET_VEHICLE_STARTUP_REV_SOUND>},
+		{"SET_VEH_FORCED_RADIO_THIS_FRAME", native_function<LUA_NATIVE_AUDIO_SET_VEH_FORCED_RADIO_THIS_FRAME>},
+		{"SET_VEH_HAS_NORMAL_RADIO", native_function<LUA_NATIVE_AUDIO_SET_VEH_HAS_NORMAL_RADIO>},
+		{"SET_VEH_RADIO_STATION", native_function<LUA_NATIVE_AUDIO_SET_VEH_RADIO_STATION>},
+		{"SKIP_RADIO_FORWARD", native_function<LUA_NATIVE_AUDIO_SKIP_RADIO_FORWARD>},
+		{"SKIP_TO_NEXT_SCRIPTED_CONVERSATION_LINE", native_function<LUA_NATIVE_AUDIO_SKIP_TO_NEXT_SCRIPTED_CONVERSATION_LINE>},
+		{"START_ALARM", native_function<LUA_NATIVE_AUDIO_START_ALARM>},
+		{"START_AUDIO_SCENE", native_function<LUA_NATIVE_AUDIO_START_AUDIO_SCENE>},
+		{"START_PRELOADED_CONVERSATION", native_function<LUA_NATIVE_AUDIO_START_PRELOADED_CONVERSATION>},
+		{"START_SCRIPT_CONVERSATION", native_function<LUA_NATIVE_AUDIO_START_SCRIPT_CONVERSATION>},
+		{"START_SCRIPT_PHONE_CONVERSATION", native_function<LUA_NATIVE_AUDIO_START_SCRIPT_PHONE_CONVERSATION>},
+		{"STOP_ALARM", native_function<LUA_NATIVE_AUDIO_STOP_ALARM>},
+		{"STOP_ALL_ALARMS", native_function<LUA_NATIVE_AUDIO_STOP_ALL_ALARMS>},
+		{"STOP_AUDIO_SCENE", native_function<LUA_NATIVE_AUDIO_STOP_AUDIO_SCENE>},
+		{"STOP_AUDIO_SCENES", native_function<LUA_NATIVE_AUDIO_STOP_AUDIO_SCENES>},
+		{"STOP_CURRENT_PLAYING_AMBIENT_SPEECH", native_function<LUA_NATIVE_AUDIO_STOP_CURRENT_PLAYING_AMBIENT_SPEECH>},
+		{"STOP_CURRENT_PLAYING_SPEECH", native_function<LUA_NATIVE_AUDIO_STOP_CURRENT_PLAYING_SPEECH>},
+		{"STOP_CUTSCENE_AUDIO", native_function<LUA_NATIVE_AUDIO_STOP_CUTSCENE_AUDIO>},
+		{"STOP_PED_RINGTONE", native_function<LUA_NATIVE_AUDIO_STOP_PED_RINGTONE>},
+		{"STOP_PED_SPEAKING", native_function<LUA_NATIVE_AUDIO_STOP_PED_SPEAKING>},
+		{"STOP_PED_SPEAKING_SYNCED", native_function<LUA_NATIVE_AUDIO_STOP_PED_SPEAKING_SYNCED>},
+		{"STOP_SCRIPTED_CONVERSATION", native_function<LUA_NATIVE_AUDIO_STOP_SCRIPTED_CONVERSATION>},
+		{"STOP_SMOKE_GRENADE_EXPLOSION_SOUNDS", native_function<LUA_NATIVE_AUDIO_STOP_SMOKE_GRENADE_EXPLOSION_SOUNDS>},
+		{"STOP_SOUND", native_function<LUA_NATIVE_AUDIO_STOP_SOUND>},
+		{"STOP_STREAM", native_function<LUA_NATIVE_AUDIO_STOP_STREAM>},
+		{"STOP_SYNCHRONIZED_AUDIO_EVENT", native_function<LUA_NATIVE_AUDIO_STOP_SYNCHRONIZED_AUDIO_EVENT>},
+		{"TRIGGER_MUSIC_EVENT", native_function<LUA_NATIVE_AUDIO_TRIGGER_MUSIC_EVENT>},
+		{"TRIGGER_SIREN_AUDIO", native_function<LUA_NATIVE_AUDIO_TRIGGER_SIREN_AUDIO>},
+		{"UNBLOCK_SPEECH_CONTEXT_GROUP", native_function<LUA_NATIVE_AUDIO_UNBLOCK_SPEECH_CONTEXT_GROUP>},
+		{"UNFREEZE_RADIO_STATION", native_function<LUA_NATIVE_AUDIO_UNFREEZE_RADIO_STATION>},
+		{"UNHINT_AMBIENT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_UNHINT_AMBIENT_AUDIO_BANK>},
+		{"UNHINT_NAMED_SCRIPT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_UNHINT_NAMED_SCRIPT_AUDIO_BANK>},
+		{"UNHINT_SCRIPT_AUDIO_BANK", native_function<LUA_NATIVE_AUDIO_UNHINT_SCRIPT_AUDIO_BANK>},
+		{"UNLOCK_MISSION_NEWS_STORY", native_function<LUA_NATIVE_AUDIO_UNLOCK_MISSION_NEWS_STORY>},
+		{"UNLOCK_RADIO_STATION_TRACK_LIST", native_function<LUA_NATIVE_AUDIO_UNLOCK_RADIO_STATION_TRACK_LIST>},
+		{"UNREGISTER_SCRIPT_WITH_AUDIO", native_function<LUA_NATIVE_AUDIO_UNREGISTER_SCRIPT_WITH_AUDIO>},
+		{"UNREQUEST_TENNIS_BANKS", native_function<LUA_NATIVE_AUDIO_UNREQUEST_TENNIS_BANKS>},
+		{"UPDATE_SOUND_COORD", native_function<LUA_NATIVE_AUDIO_UPDATE_SOUND_COORD>},
+		{"UPDATE_UNLOCKABLE_DJ_RADIO_TRACKS", native_function<LUA_NATIVE_AUDIO_UPDATE_UNLOCKABLE_DJ_RADIO_TRACKS>},
+		{"USE_FOOTSTEP_SCRIPT_SWEETENERS", native_function<LUA_NATIVE_AUDIO_USE_FOOTSTEP_SCRIPT_SWEETENERS>},
+		{"USE_SIREN_AS_HORN", native_function<LUA_NATIVE_AUDIO_USE_SIREN_AS_HORN>},
+	};
+
 	void init_native_binding_AUDIO(sol::state& L)
 	{
-		auto AUDIO = L["AUDIO"].get_or_create<sol::table>();
-		AUDIO.set_function("PLAY_PED_RINGTONE", LUA_NATIVE_AUDIO_PLAY_PED_RINGTONE);
-		AUDIO.set_function("IS_PED_RINGTONE_PLAYING", LUA_NATIVE_AUDIO_IS_PED_RINGTONE_PLAYING);
-		AUDIO.set_function("STOP_PED_RINGTONE", LUA_NATIVE_AUDIO_STOP_PED_RINGTONE);
-		AUDIO.set_function("IS_MOBILE_PHONE_CALL_ONGOING", LUA_NATIVE_AUDIO_IS_MOBILE_PHONE_CALL_ONGOING);
-		AUDIO.set_function("IS_MOBILE_INTERFERENCE_ACTIVE", LUA_NATIVE_AUDIO_IS_MOBILE_INTERFERENCE_ACTIVE);
-		AUDIO.set_function("GET_CURRENT_TV_SHOW_PLAY_TIME", LUA_NATIVE_AUDIO_GET_CURRENT_TV_SHOW_PLAY_TIME);
-		AUDIO.set_function("CREATE_NEW_SCRIPTED_CONVERSATION", LUA_NATIVE_AUDIO_CREATE_NEW_SCRIPTED_CONVERSATION);
-		AUDIO.set_function("ADD_LINE_TO_CONVERSATION", LUA_NATIVE_AUDIO_ADD_LINE_TO_CONVERSATION);
-		AUDIO.set_function("ADD_PED_TO_CONVERSATION", LUA_NATIVE_AUDIO_ADD_PED_TO_CONVERSATION);
-		AUDIO.set_function("SET_POSITION_FOR_NULL_CONV_PED", LUA_NATIVE_AUDIO_SET_POSITION_FOR_NULL_CONV_PED);
-		AUDIO.set_function("SET_ENTITY_FOR_NULL_CONV_PED", LUA_NATIVE_AUDIO_SET_ENTITY_FOR_NULL_CONV_PED);
-		AUDIO.set_function("SET_MICROPHONE_POSITION", LUA_NATIVE_AUDIO_SET_MICROPHONE_POSITION);
-		AUDIO.set_function("SET_CONVERSATION_AUDIO_CONTROLLED_BY_ANIM", LUA_NATIVE_AUDIO_SET_CONVERSATION_AUDIO_CONTROLLED_BY_ANIM);
-		AUDIO.set_function("SET_CONVERSATION_AUDIO_PLACEHOLDER", LUA_NATIVE_AUDIO_SET_CONVERSATION_AUDIO_PLACEHOLDER);
-		AUDIO.set_function("START_SCRIPT_PHONE_CONVERSATION", LUA_NATIVE_AUDIO_START_SCRIPT_PHONE_CONVERSATION);
-		AUDIO.set_function("PRELOAD_SCRIPT_PHONE_CONVERSATION", LUA_NATIVE_AUDIO_PRELOAD_SCRIPT_PHONE_CONVERSATION);
-		AUDIO.set_function("START_SCRIPT_CONVERSATION", LUA_NATIVE_AUDIO_START_SCRIPT_CONVERSATION);
-		AUDIO.set_function("PRELOAD_SCRIPT_CONVERSATION", LUA_NATIVE_AUDIO_PRELOAD_SCRIPT_CONVERSATION);
-		AUDIO.set_function("START_PRELOADED_CONVERSATION", LUA_NATIVE_AUDIO_START_PRELOADED_CONVERSATION);
-		AUDIO.set_function("GET_IS_PRELOADED_CONVERSATION_READY", LUA_NATIVE_AUDIO_GET_IS_PRELOADED_CONVERSATION_READY);
-		AUDIO.set_function("IS_SCRIPTED_CONVERSATION_ONGOING", LUA_NATIVE_AUDIO_IS_SCRIPTED_CONVERSATION_ONGOING);
-		AUDIO.set_function("IS_SCRIPTED_CONVERSATION_LOADED", LUA_NATIVE_AUDIO_IS_SCRIPTED_CONVERSATION_LOADED);
-		AUDIO.set_function("GET_CURRENT_SCRIPTED_CONVERSATION_LINE", LUA_NATIVE_AUDIO_GET_CURRENT_SCRIPTED_CONVERSATION_LINE);
-		AUDIO.set_function("PAUSE_SCRIPTED_CONVERSATION", LUA_NATIVE_AUDIO_PAUSE_SCRIPTED_CONVERSATION);
-		AUDIO.set_function("RESTART_SCRIPTED_CONVERSATION", LUA_NATIVE_AUDIO_RESTART_SCRIPTED_CONVERSATION);
-		AUDIO.set_function("STOP_SCRIPTED_CONVERSATION", LUA_NATIVE_AUDIO_STOP_SCRIPTED_CONVERSATION);
-		AUDIO.set_function("SKIP_TO_NEXT_SCRIPTED_CONVERSATION_LINE", LUA_NATIVE_AUDIO_SKIP_TO_NEXT_SCRIPTED_CONVERSATION_LINE);
-		AUDIO.set_function("INTERRUPT_CONVERSATION", LUA_NATIVE_AUDIO_INTERRUPT_CONVERSATION);
-		AUDIO.set_function("INTERRUPT_CONVERSATION_AND_PAUSE", LUA_NATIVE_AUDIO_INTERRUPT_CONVERSATION_AND_PAUSE);
-		AUDIO.set_function("GET_VARIATION_CHOSEN_FOR_SCRIPTED_LINE", LUA_NATIVE_AUDIO_GET_VARIATION_CHOSEN_FOR_SCRIPTED_LINE);
-		AUDIO.set_function("SET_NO_DUCKING_FOR_CONVERSATION", LUA_NATIVE_AUDIO_SET_NO_DUCKING_FOR_CONVERSATION);
-		AUDIO.set_function("REGISTER_SCRIPT_WITH_AUDIO", LUA_NATIVE_AUDIO_REGISTER_SCRIPT_WITH_AUDIO);
-		AUDIO.set_function("UNREGISTER_SCRIPT_WITH_AUDIO", LUA_NATIVE_AUDIO_UNREGISTER_SCRIPT_WITH_AUDIO);
-		AUDIO.set_function("REQUEST_MISSION_AUDIO_BANK", LUA_NATIVE_AUDIO_REQUEST_MISSION_AUDIO_BANK);
-		AUDIO.set_function("REQUEST_AMBIENT_AUDIO_BANK", LUA_NATIVE_AUDIO_REQUEST_AMBIENT_AUDIO_BANK);
-		AUDIO.set_function("REQUEST_SCRIPT_AUDIO_BANK", LUA_NATIVE_AUDIO_REQUEST_SCRIPT_AUDIO_BANK);
-		AUDIO.set_function("HINT_MISSION_AUDIO_BANK", LUA_NATIVE_AUDIO_HINT_MISSION_AUDIO_BANK);
-		AUDIO.set_function("HINT_AMBIENT_AUDIO_BANK", LUA_NATIVE_AUDIO_HINT_AMBIENT_AUDIO_BANK);
-		AUDIO.set_function("HINT_SCRIPT_AUDIO_BANK", LUA_NATIVE_AUDIO_HINT_SCRIPT_AUDIO_BANK);
-		AUDIO.set_function("RELEASE_MISSION_AUDIO_BANK", LUA_NATIVE_AUDIO_RELEASE_MISSION_AUDIO_BANK);
-		AUDIO.set_function("RELEASE_AMBIENT_AUDIO_BANK", LUA_NATIVE_AUDIO_RELEASE_AMBIENT_AUDIO_BANK);
-		AUDIO.set_function("RELEASE_NAMED_SCRIPT_AUDIO_BANK", LUA_NATIVE_AUDIO_RELEASE_NAMED_SCRIPT_AUDIO_BANK);
-		AUDIO.set_function("RELEASE_SCRIPT_AUDIO_BANK", LUA_NATIVE_AUDIO_RELEASE_SCRIPT_AUDIO_BANK);
-		AUDIO.set_function("UNHINT_AMBIENT_AUDIO_BANK", LUA_NATIVE_AUDIO_UNHINT_AMBIENT_AUDIO_BANK);
-		AUDIO.set_function("UNHINT_SCRIPT_AUDIO_BANK", LUA_NATIVE_AUDIO_UNHINT_SCRIPT_AUDIO_BANK);
-		AUDIO.set_function("UNHINT_NAMED_SCRIPT_AUDIO_BANK", LUA_NATIVE_AUDIO_UNHINT_NAMED_SCRIPT_AUDIO_BANK);
-		AUDIO.set_function("GET_SOUND_ID", LUA_NATIVE_AUDIO_GET_SOUND_ID);
-		AUDIO.set_function("RELEASE_SOUND_ID", LUA_NATIVE_AUDIO_RELEASE_SOUND_ID);
-		AUDIO.set_function("PLAY_SOUND", LUA_NATIVE_AUDIO_PLAY_SOUND);
-		AUDIO.set_function("PLAY_SOUND_FRONTEND", LUA_NATIVE_AUDIO_PLAY_SOUND_FRONTEND);
-		AUDIO.set_function("PLAY_DEFERRED_SOUND_FRONTEND", LUA_NATIVE_AUDIO_PLAY_DEFERRED_SOUND_FRONTEND);
-		AUDIO.set_function("PLAY_SOUND_FROM_ENTITY", LUA_NATIVE_AUDIO_PLAY_SOUND_FROM_ENTITY);
-		AUDIO.set_function("PLAY_SOUND_FROM_ENTITY_HASH", LUA_NATIVE_AUDIO_PLAY_SOUND_FROM_ENTITY_HASH);
-		AUDIO.set_function("PLAY_SOUND_FROM_COORD", LUA_NATIVE_AUDIO_PLAY_SOUND_FROM_COORD);
-		AUDIO.set_function("UPDATE_SOUND_COORD", LUA_NATIVE_AUDIO_UPDATE_SOUND_COORD);
-		AUDIO.set_function("STOP_SOUND", LUA_NATIVE_AUDIO_STOP_SOUND);
-		AUDIO.set_function("GET_NETWORK_ID_FROM_SOUND_ID", LUA_NATIVE_AUDIO_GET_NETWORK_ID_FROM_SOUND_ID);
-		AUDIO.set_function("GET_SOUND_ID_FROM_NETWORK_ID", LUA_NATIVE_AUDIO_GET_SOUND_ID_FROM_NETWORK_ID);
-		AUDIO.set_function("SET_VARIABLE_ON_SOUND", LUA_NATIVE_AUDIO_SET_VARIABLE_ON_SOUND);
-		AUDIO.set_function("SET_VARIABLE_ON_STREAM", LUA_NATIVE_AUDIO_SET_VARIABLE_ON_STREAM);
-		AUDIO.set_function("OVERRIDE_UNDERWATER_STREAM", LUA_NATIVE_AUDIO_OVERRIDE_UNDERWATER_STREAM);
-		AUDIO.set_function("SET_VARIABLE_ON_UNDER_WATER_STREAM", LUA_NATIVE_AUDIO_SET_VARIABLE_ON_UNDER_WATER_STREAM);
-		AUDIO.set_function("HAS_SOUND_FINISHED", LUA_NATIVE_AUDIO_HAS_SOUND_FINISHED);
-		AUDIO.set_function("PLAY_PED_AMBIENT_SPEECH_NATIVE", LUA_NATIVE_AUDIO_PLAY_PED_AMBIENT_SPEECH_NATIVE);
-		AUDIO.set_function("PLAY_PED_AMBIENT_SPEECH_AND_CLONE_NATIVE", LUA_NATIVE_AUDIO_PLAY_PED_AMBIENT_SPEECH_AND_CLONE_NATIVE);
-		AUDIO.set_function("PLAY_PED_AMBIENT_SPEECH_WITH_VOICE_NATIVE", LUA_NATIVE_AUDIO_PLAY_PED_AMBIENT_SPEECH_WITH_VOICE_NATIVE);
-		AUDIO.set_function("PLAY_AMBIENT_SPEECH_FROM_POSITION_NATIVE", LUA_NATIVE_AUDIO_PLAY_AMBIENT_SPEECH_FROM_POSITION_NATIVE);
-		AUDIO.set_function("OVERRIDE_TREVOR_RAGE", LUA_NATIVE_AUDIO_OVERRIDE_TREVOR_RAGE);
-		AUDIO.set_function("RESET_TREVOR_RAGE", LUA_NATIVE_AUDIO_RESET_TREVOR_RAGE);
-		AUDIO.set_function("SET_PLAYER_ANGRY", LUA_NATIVE_AUDIO_SET_PLAYER_ANGRY);
-		AUDIO.set_function("PLAY_PAIN", LUA_NATIVE_AUDIO_PLAY_PAIN);
-		AUDIO.set_function("RELEASE_WEAPON_AUDIO", LUA_NATIVE_AUDIO_RELEASE_WEAPON_AUDIO);
-		AUDIO.set_function("ACTIVATE_AUDIO_SLOWMO_MODE", LUA_NATIVE_AUDIO_ACTIVATE_AUDIO_SLOWMO_MODE);
-		AUDIO.set_function("DEACTIVATE_AUDIO_SLOWMO_MODE", LUA_NATIVE_AUDIO_DEACTIVATE_AUDIO_SLOWMO_MODE);
-		AUDIO.set_function("SET_AMBIENT_VOICE_NAME", LUA_NATIVE_AUDIO_SET_AMBIENT_VOICE_NAME);
-		AUDIO.set_function("SET_AMBIENT_VOICE_NAME_HASH", LUA_NATIVE_AUDIO_SET_AMBIENT_VOICE_NAME_HASH);
-		AUDIO.set_function("GET_AMBIENT_VOICE_NAME_HASH", LUA_NATIVE_AUDIO_GET_AMBIENT_VOICE_NAME_HASH);
-		AUDIO.set_function("SET_PED_VOICE_FULL", LUA_NATIVE_AUDIO_SET_PED_VOICE_FULL);
-		AUDIO.set_function("SET_PED_RACE_AND_VOICE_GROUP", LUA_NATIVE_AUDIO_SET_PED_RACE_AND_VOICE_GROUP);
-		AUDIO.set_function("SET_PED_VOICE_GROUP", LUA_NATIVE_AUDIO_SET_PED_VOICE_GROUP);
-		AUDIO.set_function("SET_PED_VOICE_GROUP_FROM_RACE_TO_PVG", LUA_NATIVE_AUDIO_SET_PED_VOICE_GROUP_FROM_RACE_TO_PVG);
-		AUDIO.set_function("SET_PED_GENDER", LUA_NATIVE_AUDIO_SET_PED_GENDER);
-		AUDIO.set_function("STOP_CURRENT_PLAYING_SPEECH", LUA_NATIVE_AUDIO_STOP_CURRENT_PLAYING_SPEECH);
-		AUDIO.set_function("STOP_CURRENT_PLAYING_AMBIENT_SPEECH", LUA_NATIVE_AUDIO_STOP_CURRENT_PLAYING_AMBIENT_SPEECH);
-		AUDIO.set_function("IS_AMBIENT_SPEECH_PLAYING", LUA_NATIVE_AUDIO_IS_AMBIENT_SPEECH_PLAYING);
-		AUDIO.set_function("IS_SCRIPTED_SPEECH_PLAYING", LUA_NATIVE_AUDIO_IS_SCRIPTED_SPEECH_PLAYING);
-		AUDIO.set_function("IS_ANY_SPEECH_PLAYING", LUA_NATIVE_AUDIO_IS_ANY_SPEECH_PLAYING);
-		AUDIO.set_function("IS_ANY_POSITIONAL_SPEECH_PLAYING", LUA_NATIVE_AUDIO_IS_ANY_POSITIONAL_SPEECH_PLAYING);
-		AUDIO.set_function("DOES_CONTEXT_EXIST_FOR_THIS_PED", LUA_NATIVE_AUDIO_DOES_CONTEXT_EXIST_FOR_THIS_PED);
-		AUDIO.set_function("IS_PED_IN_CURRENT_CONVERSATION", LUA_NATIVE_AUDIO_IS_PED_IN_CURRENT_CONVERSATION);
-		AUDIO.set_function("SET_PED_IS_DRUNK", LUA_NATIVE_AUDIO_SET_PED_IS_DRUNK);
-		AUDIO.set_function("PLAY_ANIMAL_VOCALIZATION", LUA_NATIVE_AUDIO_PLAY_ANIMAL_VOCALIZATION);
-		AUDIO.set_function("IS_ANIMAL_VOCALIZATION_PLAYING", LUA_NATIVE_AUDIO_IS_ANIMAL_VOCALIZATION_PLAYING);
-		AUDIO.set_function("SET_ANIMAL_MOOD", LUA_NATIVE_AUDIO_SET_ANIMAL_MOOD);
-		AUDIO.set_function("IS_MOBILE_PHONE_RADIO_ACTIVE", LUA_NATIVE_AUDIO_IS_MOBILE_PHONE_RADIO_ACTIVE);
-		AUDIO.set_function("SET_MOBILE_PHONE_RADIO_STATE", LUA_NATIVE_AUDIO_SET_MOBILE_PHONE_RADIO_STATE);
-		AUDIO.set_function("GET_PLAYER_RADIO_STATION_INDEX", LUA_NATIVE_AUDIO_GET_PLAYER_RADIO_STATION_INDEX);
-		AUDIO.set_function("GET_PLAYER_RADIO_STATION_NAME", LUA_NATIVE_AUDIO_GET_PLAYER_RADIO_STATION_NAME);
-		AUDIO.set_function("GET_RADIO_STATION_NAME", LUA_NATIVE_AUDIO_GET_RADIO_STATION_NAME);
-		AUDIO.set_function("GET_PLAYER_RADIO_STATION_GENRE", LUA_NATIVE_AUDIO_GET_PLAYER_RADIO_STATION_GENRE);
-		AUDIO.set_function("IS_RADIO_RETUNING", LUA_NATIVE_AUDIO_IS_RADIO_RETUNING);
-		AUDIO.set_function("IS_RADIO_FADED_OUT", LUA_NATIVE_AUDIO_IS_RADIO_FADED_OUT);
-		AUDIO.set_function("SET_RADIO_RETUNE_UP", LUA_NATIVE_AUDIO_SET_RADIO_RETUNE_UP);
-		AUDIO.set_function("SET_RADIO_RETUNE_DOWN", LUA_NATIVE_AUDIO_SET_RADIO_RETUNE_DOWN);
-		AUDIO.set_function("SET_RADIO_TO_STATION_NAME", LUA_NATIVE_AUDIO_SET_RADIO_TO_STATION_NAME);
-		AUDIO.set_function("SET_VEH_RADIO_STATION", LUA_NATIVE_AUDIO_SET_VEH_RADIO_STATION);
-		AUDIO.set_function("SET_VEH_HAS_NORMAL_RADIO", LUA_NATIVE_AUDIO_SET_VEH_HAS_NORMAL_RADIO);
-		AUDIO.set_function("IS_VEHICLE_RADIO_ON", LUA_NATIVE_AUDIO_IS_VEHICLE_RADIO_ON);
-		AUDIO.set_function("SET_VEH_FORCED_RADIO_THIS_FRAME", LUA_NATIVE_AUDIO_SET_VEH_FORCED_RADIO_THIS_FRAME);
-		AUDIO.set_function("SET_EMITTER_RADIO_STATION", LUA_NATIVE_AUDIO_SET_EMITTER_RADIO_STATION);
-		AUDIO.set_function("SET_STATIC_EMITTER_ENABLED", LUA_NATIVE_AUDIO_SET_STATIC_EMITTER_ENABLED);
-		AUDIO.set_function("LINK_STATIC_EMITTER_TO_ENTITY", LUA_NATIVE_AUDIO_LINK_STATIC_EMITTER_TO_ENTITY);
-		AUDIO.set_function("SET_RADIO_TO_STATION_INDEX", LUA_NATIVE_AUDIO_SET_RADIO_TO_STATION_INDEX);
-		AUDIO.set_function("SET_FRONTEND_RADIO_ACTIVE", LUA_NATIVE_AUDIO_SET_FRONTEND_RADIO_ACTIVE);
-		AUDIO.set_function("UNLOCK_MISSION_NEWS_STORY", LUA_NATIVE_AUDIO_UNLOCK_MISSION_NEWS_STORY);
-		AUDIO.set_function("IS_MISSION_NEWS_STORY_UNLOCKED", LUA_NATIVE_AUDIO_IS_MISSION_NEWS_STORY_UNLOCKED);
-		AUDIO.set_function("GET_AUDIBLE_MUSIC_TRACK_TEXT_ID", LUA_NATIVE_AUDIO_GET_AUDIBLE_MUSIC_TRACK_TEXT_ID);
-		AUDIO.set_function("PLAY_END_CREDITS_MUSIC", LUA_NATIVE_AUDIO_PLAY_END_CREDITS_MUSIC);
-		AUDIO.set_function("SKIP_RADIO_FORWARD", LUA_NATIVE_AUDIO_SKIP_RADIO_FORWARD);
-		AUDIO.set_function("FREEZE_RADIO_STATION", LUA_NATIVE_AUDIO_FREEZE_RADIO_STATION);
-		AUDIO.set_function("UNFREEZE_RADIO_STATION", LUA_NATIVE_AUDIO_UNFREEZE_RADIO_STATION);
-		AUDIO.set_function("SET_RADIO_AUTO_UNFREEZE", LUA_NATIVE_AUDIO_SET_RADIO_AUTO_UNFREEZE);
-		AUDIO.set_function("SET_INITIAL_PLAYER_STATION", LUA_NATIVE_AUDIO_SET_INITIAL_PLAYER_STATION);
-		AUDIO.set_function("SET_USER_RADIO_CONTROL_ENABLED", LUA_NATIVE_AUDIO_SET_USER_RADIO_CONTROL_ENABLED);
-		AUDIO.set_function("SET_RADIO_TRACK", LUA_NATIVE_AUDIO_SET_RADIO_TRACK);
-		AUDIO.set_function("SET_RADIO_TRACK_WITH_START_OFFSET", LUA_NATIVE_AUDIO_SET_RADIO_TRACK_WITH_START_OFFSET);
-		AUDIO.set_function("SET_NEXT_RADIO_TRACK", LUA_NATIVE_AUDIO_SET_NEXT_RADIO_TRACK);
-		AUDIO.set_function("SET_VEHICLE_RADIO_LOUD", LUA_NATIVE_AUDIO_SET_VEHICLE_RADIO_LOUD);
-		AUDIO.set_function("CAN_VEHICLE_RECEIVE_CB_RADIO", LUA_NATIVE_AUDIO_CAN_VEHICLE_RECEIVE_CB_RADIO);
-		AUDIO.set_function("SET_MOBILE_RADIO_ENABLED_DURING_GAMEPLAY", LUA_NATIVE_AUDIO_SET_MOBILE_RADIO_ENABLED_DURING_GAMEPLAY);
-		AUDIO.set_function("DOES_PLAYER_VEH_HAVE_RADIO", LUA_NATIVE_AUDIO_DOES_PLAYER_VEH_HAVE_RADIO);
-		AUDIO.set_function("IS_PLAYER_VEH_RADIO_ENABLE", LUA_NATIVE_AUDIO_IS_PLAYER_VEH_RADIO_ENABLE);
-		AUDIO.set_function("SET_VEHICLE_RADIO_ENABLED", LUA_NATIVE_AUDIO_SET_VEHICLE_RADIO_ENABLED);
-		AUDIO.set_function("SET_POSITIONED_PLAYER_VEHICLE_RADIO_EMITTER_ENABLED", LUA_NATIVE_AUDIO_SET_POSITIONED_PLAYER_VEHICLE_RADIO_EMITTER_ENABLED);
-		AUDIO.set_function("SET_CUSTOM_RADIO_TRACK_LIST", LUA_NATIVE_AUDIO_SET_CUSTOM_RADIO_TRACK_LIST);
-		AUDIO.set_function("CLEAR_CUSTOM_RADIO_TRACK_LIST", LUA_NATIVE_AUDIO_CLEAR_CUSTOM_RADIO_TRACK_LIST);
-		AUDIO.set_function("GET_NUM_UNLOCKED_RADIO_STATIONS", LUA_NATIVE_AUDIO_GET_NUM_UNLOCKED_RADIO_STATIONS);
-		AUDIO.set_function("FIND_RADIO_STATION_INDEX", LUA_NATIVE_AUDIO_FIND_RADIO_STATION_INDEX);
-		AUDIO.set_function("SET_RADIO_STATION_MUSIC_ONLY", LUA_NATIVE_AUDIO_SET_RADIO_STATION_MUSIC_ONLY);
-		AUDIO.set_function("SET_RADIO_FRONTEND_FADE_TIME", LUA_NATIVE_AUDIO_SET_RADIO_FRONTEND_FADE_TIME);
-		AUDIO.set_function("UNLOCK_RADIO_STATION_TRACK_LIST", LUA_NATIVE_AUDIO_UNLOCK_RADIO_STATION_TRACK_LIST);
-		AUDIO.set_function("LOCK_RADIO_STATION_TRACK_LIST", LUA_NATIVE_AUDIO_LOCK_RADIO_STATION_TRACK_LIST);
-		AUDIO.set_function("UPDATE_UNLOCKABLE_DJ_RADIO_TRACKS", LUA_NATIVE_AUDIO_UPDATE_UNLOCKABLE_DJ_RADIO_TRACKS);
-		AUDIO.set_function("LOCK_RADIO_STATION", LUA_NATIVE_AUDIO_LOCK_RADIO_STATION);
-		AUDIO.set_function("SET_RADIO_STATION_AS_FAVOURITE", LUA_NATIVE_AUDIO_SET_RADIO_STATION_AS_FAVOURITE);
-		AUDIO.set_function("IS_RADIO_STATION_FAVOURITED", LUA_NATIVE_AUDIO_IS_RADIO_STATION_FAVOURITED);
-		AUDIO.set_function("GET_NEXT_AUDIBLE_BEAT", LUA_NATIVE_AUDIO_GET_NEXT_AUDIBLE_BEAT);
-		AUDIO.set_function("FORCE_MUSIC_TRACK_LIST", LUA_NATIVE_AUDIO_FORCE_MUSIC_TRACK_LIST);
-		AUDIO.set_function("GET_CURRENT_TRACK_PLAY_TIME", LUA_NATIVE_AUDIO_GET_CURRENT_TRACK_PLAY_TIME);
-		AUDIO.set_function("GET_CURRENT_TRACK_SOUND_NAME", LUA_NATIVE_AUDIO_GET_CURRENT_TRACK_SOUND_NAME);
-		AUDIO.set_function("SET_VEHICLE_MISSILE_WARNING_ENABLED", LUA_NATIVE_AUDIO_SET_VEHICLE_MISSILE_WARNING_ENABLED);
-		AUDIO.set_function("SET_AMBIENT_ZONE_STATE", LUA_NATIVE_AUDIO_SET_AMBIENT_ZONE_STATE);
-		AUDIO.set_function("CLEAR_AMBIENT_ZONE_STATE", LUA_NATIVE_AUDIO_CLEAR_AMBIENT_ZONE_STATE);
-		AUDIO.set_function("SET_AMBIENT_ZONE_LIST_STATE", LUA_NATIVE_AUDIO_SET_AMBIENT_ZONE_LIST_STATE);
-		AUDIO.set_function("CLEAR_AMBIENT_ZONE_LIST_STATE", LUA_NATIVE_AUDIO_CLEAR_AMBIENT_ZONE_LIST_STATE);
-		AUDIO.set_function("SET_AMBIENT_ZONE_STATE_PERSISTENT", LUA_NATIVE_AUDIO_SET_AMBIENT_ZONE_STATE_PERSISTENT);
-		AUDIO.set_function("SET_AMBIENT_ZONE_LIST_STATE_PERSISTENT", LUA_NATIVE_AUDIO_SET_AMBIENT_ZONE_LIST_STATE_PERSISTENT);
-		AUDIO.set_function("IS_AMBIENT_ZONE_ENABLED", LUA_NATIVE_AUDIO_IS_AMBIENT_ZONE_ENABLED);
-		AUDIO.set_function("REFRESH_CLOSEST_OCEAN_SHORELINE", LUA_NATIVE_AUDIO_REFRESH_CLOSEST_OCEAN_SHORELINE);
-		AUDIO.set_function("SET_CUTSCENE_AUDIO_OVERRIDE", LUA_NATIVE_AUDIO_SET_CUTSCENE_AUDIO_OVERRIDE);
-		AUDIO.set_function("SET_VARIABLE_ON_SYNCH_SCENE_AUDIO", LUA_NATIVE_AUDIO_SET_VARIABLE_ON_SYNCH_SCENE_AUDIO);
-		AUDIO.set_function("PLAY_POLICE_REPORT", LUA_NATIVE_AUDIO_PLAY_POLICE_REPORT);
-		AUDIO.set_function("CANCEL_ALL_POLICE_REPORTS", LUA_NATIVE_AUDIO_CANCEL_ALL_POLICE_REPORTS);
-		AUDIO.set_function("BLIP_SIREN", LUA_NATIVE_AUDIO_BLIP_SIREN);
-		AUDIO.set_function("OVERRIDE_VEH_HORN", LUA_NATIVE_AUDIO_OVERRIDE_VEH_HORN);
-		AUDIO.set_function("IS_HORN_ACTIVE", LUA_NATIVE_AUDIO_IS_HORN_ACTIVE);
-		AUDIO.set_function("SET_AGGRESSIVE_HORNS", LUA_NATIVE_AUDIO_SET_AGGRESSIVE_HORNS);
-		AUDIO.set_function("SET_RADIO_POSITION_AUDIO_MUTE", LUA_NATIVE_AUDIO_SET_RADIO_POSITION_AUDIO_MUTE);
-		AUDIO.set_function("SET_VEHICLE_CONVERSATIONS_PERSIST", LUA_NATIVE_AUDIO_SET_VEHICLE_CONVERSATIONS_PERSIST);
-		AUDIO.set_function("SET_VEHICLE_CONVERSATIONS_PERSIST_NEW", LUA_NATIVE_AUDIO_SET_VEHICLE_CONVERSATIONS_PERSIST_NEW);
-		AUDIO.set_function("IS_STREAM_PLAYING", LUA_NATIVE_AUDIO_IS_STREAM_PLAYING);
-		AUDIO.set_function("GET_STREAM_PLAY_TIME", LUA_NATIVE_AUDIO_GET_STREAM_PLAY_TIME);
-		AUDIO.set_function("LOAD_STREAM", LUA_NATIVE_AUDIO_LOAD_STREAM);
-		AUDIO.set_function("LOAD_STREAM_WITH_START_OFFSET", LUA_NATIVE_AUDIO_LOAD_STREAM_WITH_START_OFFSET);
-		AUDIO.set_function("PLAY_STREAM_FROM_PED", LUA_NATIVE_AUDIO_PLAY_STREAM_FROM_PED);
-		AUDIO.set_function("PLAY_STREAM_FROM_VEHICLE", LUA_NATIVE_AUDIO_PLAY_STREAM_FROM_VEHICLE);
-		AUDIO.set_function("PLAY_STREAM_FROM_OBJECT", LUA_NATIVE_AUDIO_PLAY_STREAM_FROM_OBJECT);
-		AUDIO.set_function("PLAY_STREAM_FRONTEND", LUA_NATIVE_AUDIO_PLAY_STREAM_FRONTEND);
-		AUDIO.set_function("PLAY_STREAM_FROM_POSITION", LUA_NATIVE_AUDIO_PLAY_STREAM_FROM_POSITION);
-		AUDIO.set_function("STOP_STREAM", LUA_NATIVE_AUDIO_STOP_STREAM);
-		AUDIO.set_function("STOP_PED_SPEAKING", LUA_NATIVE_AUDIO_STOP_PED_SPEAKING);
-		AUDIO.set_function("BLOCK_ALL_SPEECH_FROM_PED", LUA_NATIVE_AUDIO_BLOCK_ALL_SPEECH_FROM_PED);
-		AUDIO.set_function("STOP_PED_SPEAKING_SYNCED", LUA_NATIVE_AUDIO_STOP_PED_SPEAKING_SYNCED);
-		AUDIO.set_function("DISABLE_PED_PAIN_AUDIO", LUA_NATIVE_AUDIO_DISABLE_PED_PAIN_AUDIO);
-		AUDIO.set_function("IS_AMBIENT_SPEECH_DISABLED", LUA_NATIVE_AUDIO_IS_AMBIENT_SPEECH_DISABLED);
-		AUDIO.set_function("BLOCK_SPEECH_CONTEXT_GROUP", LUA_NATIVE_AUDIO_BLOCK_SPEECH_CONTEXT_GROUP);
-		AUDIO.set_function("UNBLOCK_SPEECH_CONTEXT_GROUP", LUA_NATIVE_AUDIO_UNBLOCK_SPEECH_CONTEXT_GROUP);
-		AUDIO.set_function("SET_SIREN_WITH_NO_DRIVER", LUA_NATIVE_AUDIO_SET_SIREN_WITH_NO_DRIVER);
-		AUDIO.set_function("SET_SIREN_BYPASS_MP_DRIVER_CHECK", LUA_NATIVE_AUDIO_SET_SIREN_BYPASS_MP_DRIVER_CHECK);
-		AUDIO.set_function("TRIGGER_SIREN_AUDIO", LUA_NATIVE_AUDIO_TRIGGER_SIREN_AUDIO);
-		AUDIO.set_function("SET_HORN_PERMANENTLY_ON", LUA_NATIVE_AUDIO_SET_HORN_PERMANENTLY_ON);
-		AUDIO.set_function("SET_HORN_ENABLED", LUA_NATIVE_AUDIO_SET_HORN_ENABLED);
-		AUDIO.set_function("SET_AUDIO_VEHICLE_PRIORITY", LUA_NATIVE_AUDIO_SET_AUDIO_VEHICLE_PRIORITY);
-		AUDIO.set_function("SET_HORN_PERMANENTLY_ON_TIME", LUA_NATIVE_AUDIO_SET_HORN_PERMANENTLY_ON_TIME);
-		AUDIO.set_function("USE_SIREN_AS_HORN", LUA_NATIVE_AUDIO_USE_SIREN_AS_HORN);
-		AUDIO.set_function("FORCE_USE_AUDIO_GAME_OBJECT", LUA_NATIVE_AUDIO_FORCE_USE_AUDIO_GAME_OBJECT);
-		AUDIO.set_function("PRELOAD_VEHICLE_AUDIO_BANK", LUA_NATIVE_AUDIO_PRELOAD_VEHICLE_AUDIO_BANK);
-		AUDIO.set_function("SET_VEHICLE_STARTUP_REV_SOUND", LUA_NATIVE_AUDIO_SET_VEHICLE_STARTUP_REV_SOUND);
-		AUDIO.set_function("RESET_VEHICLE_STARTUP_REV_SOUND", LUA_NATIVE_AUDIO_RESET_VEHICLE_STARTUP_REV_SOUND);
-		AUDIO.set_function("SET_VEHICLE_FORCE_REVERSE_WARNING", LUA_NATIVE_AUDIO_SET_VEHICLE_FORCE_REVERSE_WARNING);
-		AUDIO.set_function("IS_VEHICLE_AUDIBLY_DAMAGED", LUA_NATIVE_AUDIO_IS_VEHICLE_AUDIBLY_DAMAGED);
-		AUDIO.set_function("SET_VEHICLE_AUDIO_ENGINE_DAMAGE_FACTOR", LUA_NATIVE_AUDIO_SET_VEHICLE_AUDIO_ENGINE_DAMAGE_FACTOR);
-		AUDIO.set_function("SET_VEHICLE_AUDIO_BODY_DAMAGE_FACTOR", LUA_NATIVE_AUDIO_SET_VEHICLE_AUDIO_BODY_DAMAGE_FACTOR);
-		AUDIO.set_function("ENABLE_VEHICLE_FANBELT_DAMAGE", LUA_NATIVE_AUDIO_ENABLE_VEHICLE_FANBELT_DAMAGE);
-		AUDIO.set_function("ENABLE_VEHICLE_EXHAUST_POPS", LUA_NATIVE_AUDIO_ENABLE_VEHICLE_EXHAUST_POPS);
-		AUDIO.set_function("SET_VEHICLE_BOOST_ACTIVE", LUA_NATIVE_AUDIO_SET_VEHICLE_BOOST_ACTIVE);
-		AUDIO.set_function("SET_PLAYER_VEHICLE_ALARM_AUDIO_ACTIVE", LUA_NATIVE_AUDIO_SET_PLAYER_VEHICLE_ALARM_AUDIO_ACTIVE);
-		AUDIO.set_function("SET_SCRIPT_UPDATE_DOOR_AUDIO", LUA_NATIVE_AUDIO_SET_SCRIPT_UPDATE_DOOR_AUDIO);
-		AUDIO.set_function("PLAY_VEHICLE_DOOR_OPEN_SOUND", LUA_NATIVE_AUDIO_PLAY_VEHICLE_DOOR_OPEN_SOUND);
-		AUDIO.set_function("PLAY_VEHICLE_DOOR_CLOSE_SOUND", LUA_NATIVE_AUDIO_PLAY_VEHICLE_DOOR_CLOSE_SOUND);
-		AUDIO.set_function("ENABLE_STALL_WARNING_SOUNDS", LUA_NATIVE_AUDIO_ENABLE_STALL_WARNING_SOUNDS);
-		AUDIO.set_function("ENABLE_DRAG_RACE_STATIONARY_WARNING_SOUNDS_", LUA_NATIVE_AUDIO_ENABLE_DRAG_RACE_STATIONARY_WARNING_SOUNDS_);
-		AUDIO.set_function("IS_GAME_IN_CONTROL_OF_MUSIC", LUA_NATIVE_AUDIO_IS_GAME_IN_CONTROL_OF_MUSIC);
-		AUDIO.set_function("SET_GPS_ACTIVE", LUA_NATIVE_AUDIO_SET_GPS_ACTIVE);
-		AUDIO.set_function("PLAY_MISSION_COMPLETE_AUDIO", LUA_NATIVE_AUDIO_PLAY_MISSION_COMPLETE_AUDIO);
-		AUDIO.set_function("IS_MISSION_COMPLETE_PLAYING", LUA_NATIVE_AUDIO_IS_MISSION_COMPLETE_PLAYING);
-		AUDIO.set_function("IS_MISSION_COMPLETE_READY_FOR_UI", LUA_NATIVE_AUDIO_IS_MISSION_COMPLETE_READY_FOR_UI);
-		AUDIO.set_function("BLOCK_DEATH_JINGLE", LUA_NATIVE_AUDIO_BLOCK_DEATH_JINGLE);
-		AUDIO.set_function("START_AUDIO_SCENE", LUA_NATIVE_AUDIO_START_AUDIO_SCENE);
-		AUDIO.set_function("STOP_AUDIO_SCENE", LUA_NATIVE_AUDIO_STOP_AUDIO_SCENE);
-		AUDIO.set_function("STOP_AUDIO_SCENES", LUA_NATIVE_AUDIO_STOP_AUDIO_SCENES);
-		AUDIO.set_function("IS_AUDIO_SCENE_ACTIVE", LUA_NATIVE_AUDIO_IS_AUDIO_SCENE_ACTIVE);
-		AUDIO.set_function("SET_AUDIO_SCENE_VARIABLE", LUA_NATIVE_AUDIO_SET_AUDIO_SCENE_VARIABLE);
-		AUDIO.set_function("SET_AUDIO_SCRIPT_CLEANUP_TIME", LUA_NATIVE_AUDIO_SET_AUDIO_SCRIPT_CLEANUP_TIME);
-		AUDIO.set_function("ADD_ENTITY_TO_AUDIO_MIX_GROUP", LUA_NATIVE_AUDIO_ADD_ENTITY_TO_AUDIO_MIX_GROUP);
-		AUDIO.set_function("REMOVE_ENTITY_FROM_AUDIO_MIX_GROUP", LUA_NATIVE_AUDIO_REMOVE_ENTITY_FROM_AUDIO_MIX_GROUP);
-		AUDIO.set_function("AUDIO_IS_MUSIC_PLAYING", LUA_NATIVE_AUDIO_AUDIO_IS_MUSIC_PLAYING);
-		AUDIO.set_function("AUDIO_IS_SCRIPTED_MUSIC_PLAYING", LUA_NATIVE_AUDIO_AUDIO_IS_SCRIPTED_MUSIC_PLAYING);
-		AUDIO.set_function("PREPARE_MUSIC_EVENT", LUA_NATIVE_AUDIO_PREPARE_MUSIC_EVENT);
-		AUDIO.set_function("CANCEL_MUSIC_EVENT", LUA_NATIVE_AUDIO_CANCEL_MUSIC_EVENT);
-		AUDIO.set_function("TRIGGER_MUSIC_EVENT", LUA_NATIVE_AUDIO_TRIGGER_MUSIC_EVENT);
-		AUDIO.set_function("IS_MUSIC_ONESHOT_PLAYING", LUA_NATIVE_AUDIO_IS_MUSIC_ONESHOT_PLAYING);
-		AUDIO.set_function("GET_MUSIC_PLAYTIME", LUA_NATIVE_AUDIO_GET_MUSIC_PLAYTIME);
-		AUDIO.set_function("SET_GLOBAL_RADIO_SIGNAL_LEVEL", LUA_NATIVE_AUDIO_SET_GLOBAL_RADIO_SIGNAL_LEVEL);
-		AUDIO.set_function("RECORD_BROKEN_GLASS", LUA_NATIVE_AUDIO_RECORD_BROKEN_GLASS);
-		AUDIO.set_function("CLEAR_ALL_BROKEN_GLASS", LUA_NATIVE_AUDIO_CLEAR_ALL_BROKEN_GLASS);
-		AUDIO.set_function("SCRIPT_OVERRIDES_WIND_ELEVATION", LUA_NATIVE_AUDIO_SCRIPT_OVERRIDES_WIND_ELEVATION);
-		AUDIO.set_function("SET_PED_WALLA_DENSITY", LUA_NATIVE_AUDIO_SET_PED_WALLA_DENSITY);
-		AUDIO.set_function("SET_PED_INTERIOR_WALLA_DENSITY", LUA_NATIVE_AUDIO_SET_PED_INTERIOR_WALLA_DENSITY);
-		AUDIO.set_function("FORCE_PED_PANIC_WALLA", LUA_NATIVE_AUDIO_FORCE_PED_PANIC_WALLA);
-		AUDIO.set_function("PREPARE_ALARM", LUA_NATIVE_AUDIO_PREPARE_ALARM);
-		AUDIO.set_function("START_ALARM", LUA_NATIVE_AUDIO_START_ALARM);
-		AUDIO.set_function("STOP_ALARM", LUA_NATIVE_AUDIO_STOP_ALARM);
-		AUDIO.set_function("STOP_ALL_ALARMS", LUA_NATIVE_AUDIO_STOP_ALL_ALARMS);
-		AUDIO.set_function("IS_ALARM_PLAYING", LUA_NATIVE_AUDIO_IS_ALARM_PLAYING);
-		AUDIO.set_function("GET_VEHICLE_DEFAULT_HORN", LUA_NATIVE_AUDIO_GET_VEHICLE_DEFAULT_HORN);
-		AUDIO.set_function("GET_VEHICLE_DEFAULT_HORN_IGNORE_MODS", LUA_NATIVE_AUDIO_GET_VEHICLE_DEFAULT_HORN_IGNORE_MODS);
-		AUDIO.set_function("RESET_PED_AUDIO_FLAGS", LUA_NATIVE_AUDIO_RESET_PED_AUDIO_FLAGS);
-		AUDIO.set_function("SET_PED_FOOTSTEPS_EVENTS_ENABLED", LUA_NATIVE_AUDIO_SET_PED_FOOTSTEPS_EVENTS_ENABLED);
-		AUDIO.set_function("SET_PED_CLOTH_EVENTS_ENABLED", LUA_NATIVE_AUDIO_SET_PED_CLOTH_EVENTS_ENABLED);
-		AUDIO.set_function("OVERRIDE_PLAYER_GROUND_MATERIAL", LUA_NATIVE_AUDIO_OVERRIDE_PLAYER_GROUND_MATERIAL);
-		AUDIO.set_function("USE_FOOTSTEP_SCRIPT_SWEETENERS", LUA_NATIVE_AUDIO_USE_FOOTSTEP_SCRIPT_SWEETENERS);
-		AUDIO.set_function("OVERRIDE_MICROPHONE_SETTINGS", LUA_NATIVE_AUDIO_OVERRIDE_MICROPHONE_SETTINGS);
-		AUDIO.set_function("FREEZE_MICROPHONE", LUA_NATIVE_AUDIO_FREEZE_MICROPHONE);
-		AUDIO.set_function("DISTANT_COP_CAR_SIRENS", LUA_NATIVE_AUDIO_DISTANT_COP_CAR_SIRENS);
-		AUDIO.set_function("SET_SIREN_CAN_BE_CONTROLLED_BY_AUDIO", LUA_NATIVE_AUDIO_SET_SIREN_CAN_BE_CONTROLLED_BY_AUDIO);
-		AUDIO.set_function("ENABLE_STUNT_JUMP_AUDIO", LUA_NATIVE_AUDIO_ENABLE_STUNT_JUMP_AUDIO);
-		AUDIO.set_function("SET_AUDIO_FLAG", LUA_NATIVE_AUDIO_SET_AUDIO_FLAG);
-		AUDIO.set_function("PREPARE_SYNCHRONIZED_AUDIO_EVENT", LUA_NATIVE_AUDIO_PREPARE_SYNCHRONIZED_AUDIO_EVENT);
-		AUDIO.set_function("PREPARE_SYNCHRONIZED_AUDIO_EVENT_FOR_SCENE", LUA_NATIVE_AUDIO_PREPARE_SYNCHRONIZED_AUDIO_EVENT_FOR_SCENE);
-		AUDIO.set_function("PLAY_SYNCHRONIZED_AUDIO_EVENT", LUA_NATIVE_AUDIO_PLAY_SYNCHRONIZED_AUDIO_EVENT);
-		AUDIO.set_function("STOP_SYNCHRONIZED_AUDIO_EVENT", LUA_NATIVE_AUDIO_STOP_SYNCHRONIZED_AUDIO_EVENT);
-		AUDIO.set_function("INIT_SYNCH_SCENE_AUDIO_WITH_POSITION", LUA_NATIVE_AUDIO_INIT_SYNCH_SCENE_AUDIO_WITH_POSITION);
-		AUDIO.set_function("INIT_SYNCH_SCENE_AUDIO_WITH_ENTITY", LUA_NATIVE_AUDIO_INIT_SYNCH_SCENE_AUDIO_WITH_ENTITY);
-		AUDIO.set_function("SET_AUDIO_SPECIAL_EFFECT_MODE", LUA_NATIVE_AUDIO_SET_AUDIO_SPECIAL_EFFECT_MODE);
-		AUDIO.set_function("SET_PORTAL_SETTINGS_OVERRIDE", LUA_NATIVE_AUDIO_SET_PORTAL_SETTINGS_OVERRIDE);
-		AUDIO.set_function("REMOVE_PORTAL_SETTINGS_OVERRIDE", LUA_NATIVE_AUDIO_REMOVE_PORTAL_SETTINGS_OVERRIDE);
-		AUDIO.set_function("STOP_SMOKE_GRENADE_EXPLOSION_SOUNDS", LUA_NATIVE_AUDIO_STOP_SMOKE_GRENADE_EXPLOSION_SOUNDS);
-		AUDIO.set_function("GET_MUSIC_VOL_SLIDER", LUA_NATIVE_AUDIO_GET_MUSIC_VOL_SLIDER);
-		AUDIO.set_function("REQUEST_TENNIS_BANKS", LUA_NATIVE_AUDIO_REQUEST_TENNIS_BANKS);
-		AUDIO.set_function("UNREQUEST_TENNIS_BANKS", LUA_NATIVE_AUDIO_UNREQUEST_TENNIS_BANKS);
-		AUDIO.set_function("SET_SKIP_MINIGUN_SPIN_UP_AUDIO", LUA_NATIVE_AUDIO_SET_SKIP_MINIGUN_SPIN_UP_AUDIO);
-		AUDIO.set_function("STOP_CUTSCENE_AUDIO", LUA_NATIVE_AUDIO_STOP_CUTSCENE_AUDIO);
-		AUDIO.set_function("HAS_LOADED_MP_DATA_SET", LUA_NATIVE_AUDIO_HAS_LOADED_MP_DATA_SET);
-		AUDIO.set_function("HAS_LOADED_SP_DATA_SET", LUA_NATIVE_AUDIO_HAS_LOADED_SP_DATA_SET);
-		AUDIO.set_function("GET_VEHICLE_HORN_SOUND_INDEX", LUA_NATIVE_AUDIO_GET_VEHICLE_HORN_SOUND_INDEX);
-		AUDIO.set_function("SET_VEHICLE_HORN_SOUND_INDEX", LUA_NATIVE_AUDIO_SET_VEHICLE_HORN_SOUND_INDEX);
+		bind_namespace(L, "AUDIO", AUDIO_natives);
 	}
 }
@@ -60,19 +60,22 @@ namespace lua::native
 		BRAIN::REACTIVATE_NAMED_OBJECT_BRAINS_WAITING_TILL_OUT_OF_RANGE(scriptName.is<const char*>() ? scriptName.as<const char*>() : nullptr);
 	}
 
+	static constexpr native_entry BRAIN_natives[] = {
+		{"ADD_SCRIPT_TO_RANDOM_PED", native_function<LUA_NATIVE_BRAIN_ADD_SCRIPT_TO_RANDOM_PED>},
+		{"DISABLE_SCRIPT_BRAIN_SET", native_function<LUA_NATIVE_BRAIN_DISABLE_SCRIPT_BRAIN_SET>},
+		{"ENABLE_SCRIPT_BRAIN_SET", native_function<LUA_NATIVE_BRAIN_ENABLE_SCRIPT_BRAIN_SET>},
+		{"IS_OBJECT_WITHIN_BRAIN_ACTIVATION_RANGE", native_function<LUA_NATIVE_BRAIN_IS_OBJECT_WITHIN_BRAIN_ACTIVATION_RANGE>},
+		{"IS_WORLD_POINT_WITHIN_BRAIN_ACTIVATION_RANGE", native_function<LUA_NATIVE_BRAIN_IS_WORLD_POINT_WITHIN_BRAIN_ACTIVATION_RANGE>},
+		{"REACTIVATE_ALL_OBJECT_BRAINS_THAT_ARE_WAITING_TILL_OUT_OF_RANGE", native_function<LUA_NATIVE_BRAIN_REACTIVATE_ALL_OBJECT_BRAINS_THAT_ARE_WAITING_TILL_OUT_OF_RANGE>},
+		{"REACTIVATE_ALL_WORLD_BRAINS_THAT_ARE_WAITING_TILL_OUT_OF_RANGE", native_function<LUA_NATIVE_BRAIN_REACTIVATE_ALL_WORLD_BRAINS_THAT_ARE_WAITING_TILL_OUT_OF_RANGE>},
+		{"REACTIVATE_NAMED_OBJECT_BRAINS_WAITING_TILL_OUT_OF_RANGE", native_function<LUA_NATIVE_BRAIN_REACTIVATE_NAMED_OBJECT_BRAINS_WAITING_TILL_OUT_OF_RANGE>},
+		{"REACTIVATE_NAMED_WORLD_BRAINS_WAITING_TILL_OUT_OF_RANGE", native_function<LUA_NATIVE_BRAIN_REACTIVATE_NAMED_WORLD_BRAINS_WAITING_TILL_OUT_OF_RANGE>},
+		{"REGISTER_OBJECT_SCRIPT_BRAIN", native_function<LUA_NATIVE_BRAIN_REGISTER_OBJECT_SCRIPT_BRAIN>},
+		{"REGISTER_WORLD_POINT_SCRIPT_BRAIN", native_function<LUA_NATIVE_BRAIN_REGISTER_WORLD_POINT_SCRIPT_BRAIN>},
+	};
+
 	void init_native_binding_BRAIN(sol::state& L)
 	{
-		auto BRAIN = L["BRAIN"].get_or_create<sol::table>();
-		BRAIN.set_function("ADD_SCRIPT_TO_RANDOM_PED", LUA_NATIVE_BRAIN_ADD_SCRIPT_TO_RANDOM_PED);
-		BRAIN.set_function("REGISTER_OBJECT_SCRIPT_BRAIN", LUA_NATIVE_BRAIN_REGISTER_OBJECT_SCRIPT_BRAIN);
-		BRAIN.set_function("IS_OBJECT_WITHIN_BRAIN_ACTIVATION_RANGE", LUA_NATIVE_BRAIN_IS_OBJECT_WITHIN_BRAIN_ACTIVATION_RANGE);
-		BRAIN.set_function("REGISTER_WORLD_POINT_SCRIPT_BRAIN", LUA_NATIVE_BRAIN_REGISTER_WORLD_POINT_SCRIPT_BRAIN);
-		BRAIN.set_function("IS_WORLD_POINT_WITHIN_BRAIN_ACTIVATION_RANGE", LUA_NATIVE_BRAIN_IS_WORLD_POINT_WITHIN_BRAIN_ACTIVATION_RANGE);
-		BRAIN.set_function("ENABLE_SCRIPT_BRAIN_SET", LUA_NATIVE_BRAIN_ENABLE_SCRIPT_BRAIN_SET);
-		BRAIN.set_function("DISABLE_SCRIPT_BRAIN_SET", LUA_NATIVE_BRAIN_DISABLE_SCRIPT_BRAIN_SET);
-		BRAIN.set_function("REACTIVATE_ALL_WORLD_BRAINS_THAT_ARE_WAITING_TILL_OUT_OF_RANGE", LUA_NATIVE_BRAIN_REACTIVATE_ALL_WORLD_BRAINS_THAT_ARE_WAITING_TILL_OUT_OF_RANGE);
-		BRAIN.set_function("REACTIVATE_ALL_OBJECT_BRAINS_THAT_ARE_WAITING_TILL_OUT_OF_RANGE", LUA_NATIVE_BRAIN_REACTIVATE_ALL_OBJECT_BRAINS_THAT_ARE_WAITING_TILL_OUT_OF_RANGE);
-		BRAIN.set_function("REACTIVATE_NAMED_WORLD_BRAINS_WAITING_TILL_OUT_OF_RANGE", LUA_NATIVE_BRAIN_REACTIVATE_NAMED_WORLD_BRAINS_WAITING_TILL_OUT_OF_RANGE);
-		BRAIN.set_function("REACTIVATE_NAMED_OBJECT_BRAINS_WAITING_TILL_OUT_OF_RANGE", LUA_NATIVE_BRAIN_REACTIVATE_NAMED_OBJECT_BRAINS_WAITING_TILL_OUT_OF_RANGE);
+		bind_namespace(L, "BRAIN", BRAIN_natives);
 	}
 }
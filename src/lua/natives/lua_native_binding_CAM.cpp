@@ -1318,254 +1318,257 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry CAM_natives[] = {
+		{"ADD_CAM_SPLINE_NODE", native_function<LUA_NATIVE_CAM_ADD_CAM_SPLINE_NODE>},
+		{"ADD_CAM_SPLINE_NODE_USING_CAMERA", native_function<LUA_NATIVE_CAM_ADD_CAM_SPLINE_NODE_USING_CAMERA>},
+		{"ADD_CAM_SPLINE_NODE_USING_CAMERA_FRAME", native_function<LUA_NATIVE_CAM_ADD_CAM_SPLINE_NODE_USING_CAMERA_FRAME>},
+		{"ADD_CAM_SPLINE_NODE_USING_GAMEPLAY_FRAME", native_function<LUA_NATIVE_CAM_ADD_CAM_SPLINE_NODE_USING_GAMEPLAY_FRAME>},
+		{"ALLOW_MOTION_BLUR_DECAY", native_function<LUA_NATIVE_CAM_ALLOW_MOTION_BLUR_DECAY>},
+		{"ANIMATED_SHAKE_CAM", native_function<LUA_NATIVE_CAM_ANIMATED_SHAKE_CAM>},
+		{"ANIMATED_SHAKE_SCRIPT_GLOBAL", native_function<LUA_NATIVE_CAM_ANIMATED_SHAKE_SCRIPT_GLOBAL>},
+		{"ARE_WIDESCREEN_BORDERS_ACTIVE", native_function<LUA_NATIVE_CAM_ARE_WIDESCREEN_BORDERS_ACTIVE>},
+		{"ATTACH_CAM_TO_ENTITY", native_function<LUA_NATIVE_CAM_ATTACH_CAM_TO_ENTITY>},
+		{"ATTACH_CAM_TO_PED_BONE", native_function<LUA_NATIVE_CAM_ATTACH_CAM_TO_PED_BONE>},
+		{"ATTACH_CAM_TO_VEHICLE_BONE", native_function<LUA_NATIVE_CAM_ATTACH_CAM_TO_VEHICLE_BONE>},
+		{"BLOCK_FIRST_PERSON_ORIENTATION_RESET_THIS_UPDATE", native_function<LUA_NATIVE_CAM_BLOCK_FIRST_PERSON_ORIENTATION_RESET_THIS_UPDATE>},
+		{"BYPASS_CAMERA_COLLISION_BUOYANCY_TEST_THIS_UPDATE", native_function<LUA_NATIVE_CAM_BYPASS_CAMERA_COLLISION_BUOYANCY_TEST_THIS_UPDATE>},
+		{"BYPASS_CUTSCENE_CAM_RENDERING_THIS_UPDATE", native_function<LUA_NATIVE_CAM_BYPASS_CUTSCENE_CAM_RENDERING_THIS_UPDATE>},
+		{"CAMERA_PREVENT_COLLISION_SETTINGS_FOR_TRIPLEHEAD_IN_INTERIORS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_CAMERA_PREVENT_COLLISION_SETTINGS_FOR_TRIPLEHEAD_IN_INTERIORS_THIS_UPDATE>},
+		{"CREATE_CAM", native_function<LUA_NATIVE_CAM_CREATE_CAM>},
+		{"CREATE_CAMERA", native_function<LUA_NATIVE_CAM_CREATE_CAMERA>},
+		{"CREATE_CAMERA_WITH_PARAMS", native_function<LUA_NATIVE_CAM_CREATE_CAMERA_WITH_PARAMS>},
+		{"CREATE_CAM_WITH_PARAMS", native_function<LUA_NATIVE_CAM_CREATE_CAM_WITH_PARAMS>},
+		{"CREATE_CINEMATIC_SHOT", native_function<LUA_NATIVE_CAM_CREATE_CINEMATIC_SHOT>},
+		{"DESTROY_ALL_CAMS", native_function<LUA_NATIVE_CAM_DESTROY_ALL_CAMS>},
+		{"DESTROY_CAM", native_function<LUA_NATIVE_CAM_DESTROY_CAM>},
+		{"DETACH_CAM", native_function<LUA_NATIVE_CAM_DETACH_CAM>},
+		{"DISABLE_AIM_CAM_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_AIM_CAM_THIS_UPDATE>},
+		{"DISABLE_CAM_COLLISION_FOR_OBJECT", native_function<LUA_NATIVE_CAM_DISABLE_CAM_COLLISION_FOR_OBJECT>},
+		{"DISABLE_CINEMATIC_BONNET_CAMERA_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_CINEMATIC_BONNET_CAMERA_THIS_UPDATE>},
+		{"DISABLE_CINEMATIC_SLOW_MO_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_CINEMATIC_SLOW_MO_THIS_UPDATE>},
+		{"DISABLE_CINEMATIC_VEHICLE_IDLE_MODE_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_CINEMATIC_VEHICLE_IDLE_MODE_THIS_UPDATE>},
+		{"DISABLE_FIRST_PERSON_CAMERA_WATER_CLIPPING_TEST_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_FIRST_PERSON_CAMERA_WATER_CLIPPING_TEST_THIS_UPDATE>},
+		{"DISABLE_FIRST_PERSON_FLASH_EFFECT_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_FIRST_PERSON_FLASH_EFFECT_THIS_UPDATE>},
+		{"DISABLE_GAMEPLAY_CAM_ALTITUDE_FOV_SCALING_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_GAMEPLAY_CAM_ALTITUDE_FOV_SCALING_THIS_UPDATE>},
+		{"DISABLE_NEAR_CLIP_SCAN_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_NEAR_CLIP_SCAN_THIS_UPDATE>},
+		{"DISABLE_ON_FOOT_FIRST_PERSON_VIEW_THIS_UPDATE", native_function<LUA_NATIVE_CAM_DISABLE_ON_FOOT_FIRST_PERSON_VIEW_THIS_UPDATE>},
+		{"DOES_CAM_EXIST", native_function<LUA_NATIVE_CAM_DOES_CAM_EXIST>},
+		{"DO_SCREEN_FADE_IN", native_function<LUA_NATIVE_CAM_DO_SCREEN_FADE_IN>},
+		{"DO_SCREEN_FADE_OUT", native_function<LUA_NATIVE_CAM_DO_SCREEN_FADE_OUT>},
+		{"FORCE_BONNET_CAMERA_RELATIVE_HEADING_AND_PITCH", native_function<LUA_NATIVE_CAM_FORCE_BONNET_CAMERA_RELATIVE_HEADING_AND_PITCH>},
+		{"FORCE_CAMERA_RELATIVE_HEADING_AND_PITCH", native_function<LUA_NATIVE_CAM_FORCE_CAMERA_RELATIVE_HEADING_AND_PITCH>},
+		{"FORCE_CAM_FAR_CLIP", native_function<LUA_NATIVE_CAM_FORCE_CAM_FAR_CLIP>},
+		{"FORCE_CINEMATIC_RENDERING_THIS_UPDATE", native_function<LUA_NATIVE_CAM_FORCE_CINEMATIC_RENDERING_THIS_UPDATE>},
+		{"FORCE_TIGHTSPACE_CUSTOM_FRAMING_THIS_UPDATE", native_function<LUA_NATIVE_CAM_FORCE_TIGHTSPACE_CUSTOM_FRAMING_THIS_UPDATE>},
+		{"FORCE_VEHICLE_CAM_STUNT_SETTINGS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_FORCE_VEHICLE_CAM_STUNT_SETTINGS_THIS_UPDATE>},
+		{"GET_CAM_ACTIVE_VIEW_MODE_CONTEXT", native_function<LUA_NATIVE_CAM_GET_CAM_ACTIVE_VIEW_MODE_CONTEXT>},
+		{"GET_CAM_ANIM_CURRENT_PHASE", native_function<LUA_NATIVE_CAM_GET_CAM_ANIM_CURRENT_PHASE>},
+		{"GET_CAM_COORD", native_function<LUA_NATIVE_CAM_GET_CAM_COORD>},
+		{"GET_CAM_DOF_STRENGTH", native_function<LUA_NATIVE_CAM_GET_CAM_DOF_STRENGTH>},
+		{"GET_CAM_FAR_CLIP", native_function<LUA_NATIVE_CAM_GET_CAM_FAR_CLIP>},
+		{"GET_CAM_FAR_DOF", native_function<LUA_NATIVE_CAM_GET_CAM_FAR_DOF>},
+		{"GET_CAM_FOV", native_function<LUA_NATIVE_CAM_GET_CAM_FOV>},
+		{"GET_CAM_NEAR_CLIP", native_function<LUA_NATIVE_CAM_GET_CAM_NEAR_CLIP>},
+		{"GET_CAM_NEAR_DOF", native_function<LUA_NATIVE_CAM_GET_CAM_NEAR_DOF>},
+		{"GET_CAM_ROT", native_function<LUA_NATIVE_CAM_GET_CAM_ROT>},
+		{"GET_CAM_SPLINE_NODE_INDEX", native_function<LUA_NATIVE_CAM_GET_CAM_SPLINE_NODE_INDEX>},
+		{"GET_CAM_SPLINE_NODE_PHASE", native_function<LUA_NATIVE_CAM_GET_CAM_SPLINE_NODE_PHASE>},
+		{"GET_CAM_SPLINE_PHASE", native_function<LUA_NATIVE_CAM_GET_CAM_SPLINE_PHASE>},
+		{"GET_CAM_VIEW_MODE_FOR_CONTEXT", native_function<LUA_NATIVE_CAM_GET_CAM_VIEW_MODE_FOR_CONTEXT>},
+		{"GET_DEBUG_CAM", native_function<LUA_NATIVE_CAM_GET_DEBUG_CAM>},
+		{"GET_FINAL_RENDERED_CAM_COORD", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_COORD>},
+		{"GET_FINAL_RENDERED_CAM_FAR_CLIP", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_FAR_CLIP>},
+		{"GET_FINAL_RENDERED_CAM_FAR_DOF", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_FAR_DOF>},
+		{"GET_FINAL_RENDERED_CAM_FOV", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_FOV>},
+		{"GET_FINAL_RENDERED_CAM_MOTION_BLUR_STRENGTH", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_MOTION_BLUR_STRENGTH>},
+		{"GET_FINAL_RENDERED_CAM_NEAR_CLIP", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_NEAR_CLIP>},
+		{"GET_FINAL_RENDERED_CAM_NEAR_DOF", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_NEAR_DOF>},
+		{"GET_FINAL_RENDERED_CAM_ROT", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_ROT>},
+		{"GET_FINAL_RENDERED_REMOTE_PLAYER_CAM_FOV", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_REMOTE_PLAYER_CAM_FOV>},
+		{"GET_FINAL_RENDERED_REMOTE_PLAYER_CAM_ROT", native_function<LUA_NATIVE_CAM_GET_FINAL_RENDERED_REMOTE_PLAYER_CAM_ROT>},
+		{"GET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR", native_function<LUA_NATIVE_CAM_GET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR>},
+		{"GET_FOCUS_PED_ON_SCREEN", native_function<LUA_NATIVE_CAM_GET_FOCUS_PED_ON_SCREEN>},
+		{"GET_FOLLOW_PED_CAM_VIEW_MODE", native_function<LUA_NATIVE_CAM_GET_FOLLOW_PED_CAM_VIEW_MODE>},
+		{"GET_FOLLOW_PED_CAM_ZOOM_LEVEL", native_function<LUA_NATIVE_CAM_GET_FOLLOW_PED_CAM_ZOOM_LEVEL>},
+		{"GET_FOLLOW_VEHICLE_CAM_VIEW_MODE", native_function<LUA_NATIVE_CAM_GET_FOLLOW_VEHICLE_CAM_VIEW_MODE>},
+		{"GET_FOLLOW_VEHICLE_CAM_ZOOM_LEVEL", native_function<LUA_NATIVE_CAM_GET_FOLLOW_VEHICLE_CAM_ZOOM_LEVEL>},
+		{"GET_GAMEPLAY_CAM_COORD", native_function<LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_COORD>},
+		{"GET_GAMEPLAY_CAM_FOV", native_function<LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_FOV>},
+		{"GET_GAMEPLAY_CAM_RELATIVE_HEADING", native_function<LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_RELATIVE_HEADING>},
+		{"GET_GAMEPLAY_CAM_RELATIVE_PITCH", native_function<LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_RELATIVE_PITCH>},
+		{"GET_GAMEPLAY_CAM_ROT", native_function<LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_ROT>},
+		{"GET_RENDERING_CAM", native_function<LUA_NATIVE_CAM_GET_RENDERING_CAM>},
+		{"GET_THIRD_PERSON_CAM_MAX_ORBIT_DISTANCE_SPRING_", native_function<LUA_NATIVE_CAM_GET_THIRD_PERSON_CAM_MAX_ORBIT_DISTANCE_SPRING_>},
+		{"GET_THIRD_PERSON_CAM_MIN_ORBIT_DISTANCE_SPRING_", native_function<LUA_NATIVE_CAM_GET_THIRD_PERSON_CAM_MIN_ORBIT_DISTANCE_SPRING_>},
+		{"HARD_ATTACH_CAM_TO_ENTITY", native_function<LUA_NATIVE_CAM_HARD_ATTACH_CAM_TO_ENTITY>},
+		{"HARD_ATTACH_CAM_TO_PED_BONE", native_function<LUA_NATIVE_CAM_HARD_ATTACH_CAM_TO_PED_BONE>},
+		{"IGNORE_MENU_PREFERENCE_FOR_BONNET_CAMERA_THIS_UPDATE", native_function<LUA_NATIVE_CAM_IGNORE_MENU_PREFERENCE_FOR_BONNET_CAMERA_THIS_UPDATE>},
+		{"INVALIDATE_CINEMATIC_VEHICLE_IDLE_MODE", native_function<LUA_NATIVE_CAM_INVALIDATE_CINEMATIC_VEHICLE_IDLE_MODE>},
+		{"INVALIDATE_IDLE_CAM", native_function<LUA_NATIVE_CAM_INVALIDATE_IDLE_CAM>},
+		{"IS_AIM_CAM_ACTIVE", native_function<LUA_NATIVE_CAM_IS_AIM_CAM_ACTIVE>},
+		{"IS_AIM_CAM_ACTIVE_IN_ACCURATE_MODE", native_function<LUA_NATIVE_CAM_IS_AIM_CAM_ACTIVE_IN_ACCURATE_MODE>},
+		{"IS_ALLOWED_INDEPENDENT_CAMERA_MODES", native_function<LUA_NATIVE_CAM_IS_ALLOWED_INDEPENDENT_CAMERA_MODES>},
+		{"IS_BONNET_CINEMATIC_CAM_RENDERING", native_function<LUA_NATIVE_CAM_IS_BONNET_CINEMATIC_CAM_RENDERING>},
+		{"IS_CAM_ACTIVE", native_function<LUA_NATIVE_CAM_IS_CAM_ACTIVE>},
+		{"IS_CAM_INTERPOLATING", native_function<LUA_NATIVE_CAM_IS_CAM_INTERPOLATING>},
+		{"IS_CAM_PLAYING_ANIM", native_function<LUA_NATIVE_CAM_IS_CAM_PLAYING_ANIM>},
+		{"IS_CAM_RENDERING", native_function<LUA_NATIVE_CAM_IS_CAM_RENDERING>},
+		{"IS_CAM_SHAKING", native_function<LUA_NATIVE_CAM_IS_CAM_SHAKING>},
+		{"IS_CAM_SPLINE_PAUSED", native_function<LUA_NATIVE_CAM_IS_CAM_SPLINE_PAUSED>},
+		{"IS_CINEMATIC_CAM_INPUT_ACTIVE", native_function<LUA_NATIVE_CAM_IS_CINEMATIC_CAM_INPUT_ACTIVE>},
+		{"IS_CINEMATIC_CAM_RENDERING", native_function<LUA_NATIVE_CAM_IS_CINEMATIC_CAM_RENDERING>},
+		{"IS_CINEMATIC_CAM_SHAKING", native_function<LUA_NATIVE_CAM_IS_CINEMATIC_CAM_SHAKING>},
+		{"IS_CINEMATIC_FIRST_PERSON_VEHICLE_INTERIOR_CAM_RENDERING", native_function<LUA_NATIVE_CAM_IS_CINEMATIC_FIRST_PERSON_VEHICLE_INTERIOR_CAM_RENDERING>},
+		{"IS_CINEMATIC_IDLE_CAM_RENDERING", native_function<LUA_NATIVE_CAM_IS_CINEMATIC_IDLE_CAM_RENDERING>},
+		{"IS_CINEMATIC_SHOT_ACTIVE", native_function<LUA_NATIVE_CAM_IS_CINEMATIC_SHOT_ACTIVE>},
+		{"IS_CODE_GAMEPLAY_HINT_ACTIVE", native_function<LUA_NATIVE_CAM_IS_CODE_GAMEPLAY_HINT_ACTIVE>},
+		{"IS_FIRST_PERSON_AIM_CAM_ACTIVE", native_function<LUA_NATIVE_CAM_IS_FIRST_PERSON_AIM_CAM_ACTIVE>},
+		{"IS_FOLLOW_PED_CAM_ACTIVE", native_function<LUA_NATIVE_CAM_IS_FOLLOW_PED_CAM_ACTIVE>},
+		{"IS_FOLLOW_VEHICLE_CAM_ACTIVE", native_function<LUA_NATIVE_CAM_IS_FOLLOW_VEHICLE_CAM_ACTIVE>},
+		{"IS_GAMEPLAY_CAM_LOOKING_BEHIND", native_function<LUA_NATIVE_CAM_IS_GAMEPLAY_CAM_LOOKING_BEHIND>},
+		{"IS_GAMEPLAY_CAM_RENDERING", native_function<LUA_NATIVE_CAM_IS_GAMEPLAY_CAM_RENDERING>},
+		{"IS_GAMEPLAY_CAM_SHAKING", native_function<LUA_NATIVE_CAM_IS_GAMEPLAY_CAM_SHAKING>},
+		{"IS_GAMEPLAY_HINT_ACTIVE", native_function<LUA_NATIVE_CAM_IS_GAMEPLAY_HINT_ACTIVE>},
+		{"IS_INTERPOLATING_FROM_SCRIPT_CAMS", native_function<LUA_NATIVE_CAM_IS_INTERPOLATING_FROM_SCRIPT_CAMS>},
+		{"IS_INTERPOLATING_TO_SCRIPT_CAMS", native_function<LUA_NATIVE_CAM_IS_INTERPOLATING_TO_SCRIPT_CAMS>},
+		{"IS_IN_VEHICLE_MOBILE_PHONE_CAMERA_RENDERING", native_function<LUA_NATIVE_CAM_IS_IN_VEHICLE_MOBILE_PHONE_CAMERA_RENDERING>},
+		{"IS_SCREEN_FADED_IN", native_function<LUA_NATIVE_CAM_IS_SCREEN_FADED_IN>},
+		{"IS_SCREEN_FADED_OUT", native_function<LUA_NATIVE_CAM_IS_SCREEN_FADED_OUT>},
+		{"IS_SCREEN_FADING_IN", native_function<LUA_NATIVE_CAM_IS_SCREEN_FADING_IN>},
+		{"IS_SCREEN_FADING_OUT", native_function<LUA_NATIVE_CAM_IS_SCREEN_FADING_OUT>},
+		{"IS_SCRIPT_GLOBAL_SHAKING", native_function<LUA_NATIVE_CAM_IS_SCRIPT_GLOBAL_SHAKING>},
+		{"IS_SPHERE_VISIBLE", native_function<LUA_NATIVE_CAM_IS_SPHERE_VISIBLE>},
+		{"OVERRIDE_CAM_SPLINE_MOTION_BLUR", native_function<LUA_NATIVE_CAM_OVERRIDE_CAM_SPLINE_MOTION_BLUR>},
+		{"OVERRIDE_CAM_SPLINE_VELOCITY", native_function<LUA_NATIVE_CAM_OVERRIDE_CAM_SPLINE_VELOCITY>},
+		{"PLAY_CAM_ANIM", native_function<LUA_NATIVE_CAM_PLAY_CAM_ANIM>},
+		{"PLAY_SYNCHRONIZED_CAM_ANIM", native_function<LUA_NATIVE_CAM_PLAY_SYNCHRONIZED_CAM_ANIM>},
+		{"POINT_CAM_AT_COORD", native_function<LUA_NATIVE_CAM_POINT_CAM_AT_COORD>},
+		{"POINT_CAM_AT_ENTITY", native_function<LUA_NATIVE_CAM_POINT_CAM_AT_ENTITY>},
+		{"POINT_CAM_AT_PED_BONE", native_function<LUA_NATIVE_CAM_POINT_CAM_AT_PED_BONE>},
+		{"RENDER_SCRIPT_CAMS", native_function<LUA_NATIVE_CAM_RENDER_SCRIPT_CAMS>},
+		{"REPLAY_GET_MAX_DISTANCE_ALLOWED_FROM_PLAYER", native_function<LUA_NATIVE_CAM_REPLAY_GET_MAX_DISTANCE_ALLOWED_FROM_PLAYER>},
+		{"RESET_GAMEPLAY_CAM_FULL_ATTACH_PARENT_TRANSFORM_TIMER", native_function<LUA_NATIVE_CAM_RESET_GAMEPLAY_CAM_FULL_ATTACH_PARENT_TRANSFORM_TIMER>},
+		{"SET_ALLOW_CUSTOM_VEHICLE_DRIVE_BY_CAM_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_ALLOW_CUSTOM_VEHICLE_DRIVE_BY_CAM_THIS_UPDATE>},
+		{"SET_CAM_ACTIVE", native_function<LUA_NATIVE_CAM_SET_CAM_ACTIVE>},
+		{"SET_CAM_ACTIVE_WITH_INTERP", native_function<LUA_NATIVE_CAM_SET_CAM_ACTIVE_WITH_INTERP>},
+		{"SET_CAM_AFFECTS_AIMING", native_function<LUA_NATIVE_CAM_SET_CAM_AFFECTS_AIMING>},
+		{"SET_CAM_ANIM_CURRENT_PHASE", native_function<LUA_NATIVE_CAM_SET_CAM_ANIM_CURRENT_PHASE>},
+		{"SET_CAM_CONTROLS_MINI_MAP_HEADING", native_function<LUA_NATIVE_CAM_SET_CAM_CONTROLS_MINI_MAP_HEADING>},
+		{"SET_CAM_COORD", native_function<LUA_NATIVE_CAM_SET_CAM_COORD>},
+		{"SET_CAM_DEATH_FAIL_EFFECT_STATE", native_function<LUA_NATIVE_CAM_SET_CAM_DEATH_FAIL_EFFECT_STATE>},
+		{"SET_CAM_DEBUG_NAME", native_function<LUA_NATIVE_CAM_SET_CAM_DEBUG_NAME>},
+		{"SET_CAM_DOF_FNUMBER_OF_LENS", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_FNUMBER_OF_LENS>},
+		{"SET_CAM_DOF_FOCAL_LENGTH_MULTIPLIER", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_FOCAL_LENGTH_MULTIPLIER>},
+		{"SET_CAM_DOF_FOCUS_DISTANCE_BIAS", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_FOCUS_DISTANCE_BIAS>},
+		{"SET_CAM_DOF_MAX_NEAR_IN_FOCUS_DISTANCE", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_MAX_NEAR_IN_FOCUS_DISTANCE>},
+		{"SET_CAM_DOF_MAX_NEAR_IN_FOCUS_DISTANCE_BLEND_LEVEL", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_MAX_NEAR_IN_FOCUS_DISTANCE_BLEND_LEVEL>},
+		{"SET_CAM_DOF_OVERRIDDEN_FOCUS_DISTANCE", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_OVERRIDDEN_FOCUS_DISTANCE>},
+		{"SET_CAM_DOF_OVERRIDDEN_FOCUS_DISTANCE_BLEND_LEVEL", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_OVERRIDDEN_FOCUS_DISTANCE_BLEND_LEVEL>},
+		{"SET_CAM_DOF_PLANES", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_PLANES>},
+		{"SET_CAM_DOF_SHOULD_KEEP_LOOK_AT_TARGET_IN_FOCUS", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_SHOULD_KEEP_LOOK_AT_TARGET_IN_FOCUS>},
+		{"SET_CAM_DOF_STRENGTH", native_function<LUA_NATIVE_CAM_SET_CAM_DOF_STRENGTH>},
+		{"SET_CAM_FAR_CLIP", native_function<LUA_NATIVE_CAM_SET_CAM_FAR_CLIP>},
+		{"SET_CAM_FAR_DOF", native_function<LUA_NATIVE_CAM_SET_CAM_FAR_DOF>},
+		{"SET_CAM_FOV", native_function<LUA_NATIVE_CAM_SET_CAM_FOV>},
+		{"SET_CAM_INHERIT_ROLL_VEHICLE", native_function<LUA_NATIVE_CAM_SET_CAM_INHERIT_ROLL_VEHICLE>},
+		{"SET_CAM_IS_INSIDE_VEHICLE", native_function<LUA_NATIVE_CAM_SET_CAM_IS_INSIDE_VEHICLE>},
+		{"SET_CAM_MOTION_BLUR_STRENGTH", native_function<LUA_NATIVE_CAM_SET_CAM_MOTION_BLUR_STRENGTH>},
+		{"SET_CAM_NEAR_CLIP", native_function<LUA_NATIVE_CAM_SET_CAM_NEAR_CLIP>},
+		{"SET_CAM_NEAR_DOF", native_function<LUA_NATIVE_CAM_SET_CAM_NEAR_DOF>},
+		{"SET_CAM_PARAMS", native_function<LUA_NATIVE_CAM_SET_CAM_PARAMS>},
+		{"SET_CAM_ROT", native_function<LUA_NATIVE_CAM_SET_CAM_ROT>},
+		{"SET_CAM_SHAKE_AMPLITUDE", native_function<LUA_NATIVE_CAM_SET_CAM_SHAKE_AMPLITUDE>},
+		{"SET_CAM_SPLINE_DURATION", native_function<LUA_NATIVE_CAM_SET_CAM_SPLINE_DURATION>},
+		{"SET_CAM_SPLINE_NODE_EASE", native_function<LUA_NATIVE_CAM_SET_CAM_SPLINE_NODE_EASE>},
+		{"SET_CAM_SPLINE_NODE_EXTRA_FLAGS", native_function<LUA_NATIVE_CAM_SET_CAM_SPLINE_NODE_EXTRA_FLAGS>},
+		{"SET_CAM_SPLINE_NODE_VELOCITY_SCALE", native_function<LUA_NATIVE_CAM_SET_CAM_SPLINE_NODE_VELOCITY_SCALE>},
+		{"SET_CAM_SPLINE_PHASE", native_function<LUA_NATIVE_CAM_SET_CAM_SPLINE_PHASE>},
+		{"SET_CAM_SPLINE_SMOOTHING_STYLE", native_function<LUA_NATIVE_CAM_SET_CAM_SPLINE_SMOOTHING_STYLE>},
+		{"SET_CAM_USE_SHALLOW_DOF_MODE", native_function<LUA_NATIVE_CAM_SET_CAM_USE_SHALLOW_DOF_MODE>},
+		{"SET_CAM_VIEW_MODE_FOR_CONTEXT", native_function<LUA_NATIVE_CAM_SET_CAM_VIEW_MODE_FOR_CONTEXT>},
+		{"SET_CINEMATIC_BUTTON_ACTIVE", native_function<LUA_NATIVE_CAM_SET_CINEMATIC_BUTTON_ACTIVE>},
+		{"SET_CINEMATIC_CAM_SHAKE_AMPLITUDE", native_function<LUA_NATIVE_CAM_SET_CINEMATIC_CAM_SHAKE_AMPLITUDE>},
+		{"SET_CINEMATIC_MODE_ACTIVE", native_function<LUA_NATIVE_CAM_SET_CINEMATIC_MODE_ACTIVE>},
+		{"SET_CINEMATIC_NEWS_CHANNEL_ACTIVE_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_CINEMATIC_NEWS_CHANNEL_ACTIVE_THIS_UPDATE>},
+		{"SET_CUTSCENE_CAM_FAR_CLIP_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_CUTSCENE_CAM_FAR_CLIP_THIS_UPDATE>},
+		{"SET_FIRST_PERSON_AIM_CAM_NEAR_CLIP_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_NEAR_CLIP_THIS_UPDATE>},
+		{"SET_FIRST_PERSON_AIM_CAM_RELATIVE_HEADING_LIMITS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_RELATIVE_HEADING_LIMITS_THIS_UPDATE>},
+		{"SET_FIRST_PERSON_AIM_CAM_RELATIVE_PITCH_LIMITS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_RELATIVE_PITCH_LIMITS_THIS_UPDATE>},
+		{"SET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR>},
+		{"SET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR_LIMITS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR_LIMITS_THIS_UPDATE>},
+		{"SET_FIRST_PERSON_FLASH_EFFECT_TYPE", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_FLASH_EFFECT_TYPE>},
+		{"SET_FIRST_PERSON_FLASH_EFFECT_VEHICLE_MODEL_HASH", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_FLASH_EFFECT_VEHICLE_MODEL_HASH>},
+		{"SET_FIRST_PERSON_FLASH_EFFECT_VEHICLE_MODEL_NAME", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_FLASH_EFFECT_VEHICLE_MODEL_NAME>},
+		{"SET_FIRST_PERSON_SHOOTER_CAMERA_HEADING", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_SHOOTER_CAMERA_HEADING>},
+		{"SET_FIRST_PERSON_SHOOTER_CAMERA_PITCH", native_function<LUA_NATIVE_CAM_SET_FIRST_PERSON_SHOOTER_CAMERA_PITCH>},
+		{"SET_FLY_CAM_COORD_AND_CONSTRAIN", native_function<LUA_NATIVE_CAM_SET_FLY_CAM_COORD_AND_CONSTRAIN>},
+		{"SET_FLY_CAM_HORIZONTAL_RESPONSE", native_function<LUA_NATIVE_CAM_SET_FLY_CAM_HORIZONTAL_RESPONSE>},
+		{"SET_FLY_CAM_MAX_HEIGHT", native_function<LUA_NATIVE_CAM_SET_FLY_CAM_MAX_HEIGHT>},
+		{"SET_FLY_CAM_VERTICAL_CONTROLS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FLY_CAM_VERTICAL_CONTROLS_THIS_UPDATE>},
+		{"SET_FLY_CAM_VERTICAL_RESPONSE", native_function<LUA_NATIVE_CAM_SET_FLY_CAM_VERTICAL_RESPONSE>},
+		{"SET_FOLLOW_CAM_IGNORE_ATTACH_PARENT_MOVEMENT_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FOLLOW_CAM_IGNORE_ATTACH_PARENT_MOVEMENT_THIS_UPDATE>},
+		{"SET_FOLLOW_PED_CAM_LADDER_ALIGN_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FOLLOW_PED_CAM_LADDER_ALIGN_THIS_UPDATE>},
+		{"SET_FOLLOW_PED_CAM_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FOLLOW_PED_CAM_THIS_UPDATE>},
+		{"SET_FOLLOW_PED_CAM_VIEW_MODE", native_function<LUA_NATIVE_CAM_SET_FOLLOW_PED_CAM_VIEW_MODE>},
+		{"SET_FOLLOW_VEHICLE_CAM_HIGH_ANGLE_MODE_EVERY_UPDATE", native_function<LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_HIGH_ANGLE_MODE_EVERY_UPDATE>},
+		{"SET_FOLLOW_VEHICLE_CAM_HIGH_ANGLE_MODE_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_HIGH_ANGLE_MODE_THIS_UPDATE>},
+		{"SET_FOLLOW_VEHICLE_CAM_SEAT_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_SEAT_THIS_UPDATE>},
+		{"SET_FOLLOW_VEHICLE_CAM_VIEW_MODE", native_function<LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_VIEW_MODE>},
+		{"SET_FOLLOW_VEHICLE_CAM_ZOOM_LEVEL", native_function<LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_ZOOM_LEVEL>},
+		{"SET_GAMEPLAY_CAM_ALTITUDE_FOV_SCALING_STATE", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_ALTITUDE_FOV_SCALING_STATE>},
+		{"SET_GAMEPLAY_CAM_ENTITY_TO_LIMIT_FOCUS_OVER_BOUNDING_SPHERE_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_ENTITY_TO_LIMIT_FOCUS_OVER_BOUNDING_SPHERE_THIS_UPDATE>},
+		{"SET_GAMEPLAY_CAM_FOLLOW_PED_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_FOLLOW_PED_THIS_UPDATE>},
+		{"SET_GAMEPLAY_CAM_IGNORE_ENTITY_COLLISION_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_IGNORE_ENTITY_COLLISION_THIS_UPDATE>},
+		{"SET_GAMEPLAY_CAM_MAX_MOTION_BLUR_STRENGTH_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_MAX_MOTION_BLUR_STRENGTH_THIS_UPDATE>},
+		{"SET_GAMEPLAY_CAM_MOTION_BLUR_SCALING_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_MOTION_BLUR_SCALING_THIS_UPDATE>},
+		{"SET_GAMEPLAY_CAM_RELATIVE_HEADING", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_RELATIVE_HEADING>},
+		{"SET_GAMEPLAY_CAM_RELATIVE_PITCH", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_RELATIVE_PITCH>},
+		{"SET_GAMEPLAY_CAM_SHAKE_AMPLITUDE", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_SHAKE_AMPLITUDE>},
+		{"SET_GAMEPLAY_COORD_HINT", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_COORD_HINT>},
+		{"SET_GAMEPLAY_ENTITY_HINT", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_ENTITY_HINT>},
+		{"SET_GAMEPLAY_HINT_BASE_ORBIT_PITCH_OFFSET", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_BASE_ORBIT_PITCH_OFFSET>},
+		{"SET_GAMEPLAY_HINT_CAMERA_BLEND_TO_FOLLOW_PED_MEDIUM_VIEW_MODE", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_CAMERA_BLEND_TO_FOLLOW_PED_MEDIUM_VIEW_MODE>},
+		{"SET_GAMEPLAY_HINT_CAMERA_RELATIVE_SIDE_OFFSET", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_CAMERA_RELATIVE_SIDE_OFFSET>},
+		{"SET_GAMEPLAY_HINT_CAMERA_RELATIVE_VERTICAL_OFFSET", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_CAMERA_RELATIVE_VERTICAL_OFFSET>},
+		{"SET_GAMEPLAY_HINT_FOLLOW_DISTANCE_SCALAR", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_FOLLOW_DISTANCE_SCALAR>},
+		{"SET_GAMEPLAY_HINT_FOV", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_FOV>},
+		{"SET_GAMEPLAY_OBJECT_HINT", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_OBJECT_HINT>},
+		{"SET_GAMEPLAY_PED_HINT", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_PED_HINT>},
+		{"SET_GAMEPLAY_VEHICLE_HINT", native_function<LUA_NATIVE_CAM_SET_GAMEPLAY_VEHICLE_HINT>},
+		{"SET_IN_VEHICLE_CAM_STATE_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_IN_VEHICLE_CAM_STATE_THIS_UPDATE>},
+		{"SET_SCRIPTED_CAMERA_IS_FIRST_PERSON_THIS_FRAME", native_function<LUA_NATIVE_CAM_SET_SCRIPTED_CAMERA_IS_FIRST_PERSON_THIS_FRAME>},
+		{"SET_TABLE_GAMES_CAMERA_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_TABLE_GAMES_CAMERA_THIS_UPDATE>},
+		{"SET_THIRD_PERSON_AIM_CAM_NEAR_CLIP_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_THIRD_PERSON_AIM_CAM_NEAR_CLIP_THIS_UPDATE>},
+		{"SET_THIRD_PERSON_CAM_ORBIT_DISTANCE_LIMITS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_THIRD_PERSON_CAM_ORBIT_DISTANCE_LIMITS_THIS_UPDATE>},
+		{"SET_THIRD_PERSON_CAM_RELATIVE_HEADING_LIMITS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_THIRD_PERSON_CAM_RELATIVE_HEADING_LIMITS_THIS_UPDATE>},
+		{"SET_THIRD_PERSON_CAM_RELATIVE_PITCH_LIMITS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_THIRD_PERSON_CAM_RELATIVE_PITCH_LIMITS_THIS_UPDATE>},
+		{"SET_USE_HI_DOF", native_function<LUA_NATIVE_CAM_SET_USE_HI_DOF>},
+		{"SET_USE_HI_DOF_ON_SYNCED_SCENE_THIS_UPDATE", native_function<LUA_NATIVE_CAM_SET_USE_HI_DOF_ON_SYNCED_SCENE_THIS_UPDATE>},
+		{"SET_WIDESCREEN_BORDERS", native_function<LUA_NATIVE_CAM_SET_WIDESCREEN_BORDERS>},
+		{"SHAKE_CAM", native_function<LUA_NATIVE_CAM_SHAKE_CAM>},
+		{"SHAKE_CINEMATIC_CAM", native_function<LUA_NATIVE_CAM_SHAKE_CINEMATIC_CAM>},
+		{"SHAKE_GAMEPLAY_CAM", native_function<LUA_NATIVE_CAM_SHAKE_GAMEPLAY_CAM>},
+		{"SHAKE_SCRIPT_GLOBAL", native_function<LUA_NATIVE_CAM_SHAKE_SCRIPT_GLOBAL>},
+		{"STOP_CAM_POINTING", native_function<LUA_NATIVE_CAM_STOP_CAM_POINTING>},
+		{"STOP_CAM_SHAKING", native_function<LUA_NATIVE_CAM_STOP_CAM_SHAKING>},
+		{"STOP_CINEMATIC_CAM_SHAKING", native_function<LUA_NATIVE_CAM_STOP_CINEMATIC_CAM_SHAKING>},
+		{"STOP_CINEMATIC_SHOT", native_function<LUA_NATIVE_CAM_STOP_CINEMATIC_SHOT>},
+		{"STOP_CODE_GAMEPLAY_HINT", native_function<LUA_NATIVE_CAM_STOP_CODE_GAMEPLAY_HINT>},
+		{"STOP_CUTSCENE_CAM_SHAKING", native_function<LUA_NATIVE_CAM_STOP_CUTSCENE_CAM_SHAKING>},
+		{"STOP_GAMEPLAY_CAM_SHAKING", native_function<LUA_NATIVE_CAM_STOP_GAMEPLAY_CAM_SHAKING>},
+		{"STOP_GAMEPLAY_HINT", native_function<LUA_NATIVE_CAM_STOP_GAMEPLAY_HINT>},
+		{"STOP_GAMEPLAY_HINT_BEING_CANCELLED_THIS_UPDATE", native_function<LUA_NATIVE_CAM_STOP_GAMEPLAY_HINT_BEING_CANCELLED_THIS_UPDATE>},
+		{"STOP_RENDERING_SCRIPT_CAMS_USING_CATCH_UP", native_function<LUA_NATIVE_CAM_STOP_RENDERING_SCRIPT_CAMS_USING_CATCH_UP>},
+		{"STOP_SCRIPT_GLOBAL_SHAKING", native_function<LUA_NATIVE_CAM_STOP_SCRIPT_GLOBAL_SHAKING>},
+		{"TRIGGER_VEHICLE_PART_BROKEN_CAMERA_SHAKE", native_function<LUA_NATIVE_CAM_TRIGGER_VEHICLE_PART_BROKEN_CAMERA_SHAKE>},
+		{"USE_DEDICATED_STUNT_CAMERA_THIS_UPDATE", native_function<LUA_NATIVE_CAM_USE_DEDICATED_STUNT_CAMERA_THIS_UPDATE>},
+		{"USE_SCRIPT_CAM_FOR_AMBIENT_POPULATION_ORIGIN_THIS_FRAME", native_function<LUA_NATIVE_CAM_USE_SCRIPT_CAM_FOR_AMBIENT_POPULATION_ORIGIN_THIS_FRAME>},
+		{"USE_VEHICLE_CAM_STUNT_SETTINGS_THIS_UPDATE", native_function<LUA_NATIVE_CAM_USE_VEHICLE_CAM_STUNT_SETTINGS_THIS_UPDATE>},
+		{"WAS_FLY_CAM_CONSTRAINED_ON_PREVIOUS_UDPATE", native_function<LUA_NATIVE_CAM_WAS_FLY_CAM_CONSTRAINED_ON_PREVIOUS_UDPATE>},
+	};
+
 	void init_native_binding_CAM(sol::state& L)
 	{
-		auto CAM = L["CAM"].get_or_create<sol::table>();
-		CAM.set_function("RENDER_SCRIPT_CAMS", LUA_NATIVE_CAM_RENDER_SCRIPT_CAMS);
-		CAM.set_function("STOP_RENDERING_SCRIPT_CAMS_USING_CATCH_UP", LUA_NATIVE_CAM_STOP_RENDERING_SCRIPT_CAMS_USING_CATCH_UP);
-		CAM.set_function("CREATE_CAM", LUA_NATIVE_CAM_CREATE_CAM);
-		CAM.set_function("CREATE_CAM_WITH_PARAMS", LUA_NATIVE_CAM_CREATE_CAM_WITH_PARAMS);
-		CAM.set_function("CREATE_CAMERA", LUA_NATIVE_CAM_CREATE_CAMERA);
-		CAM.set_function("CREATE_CAMERA_WITH_PARAMS", LUA_NATIVE_CAM_CREATE_CAMERA_WITH_PARAMS);
-		CAM.set_function("DESTROY_CAM", LUA_NATIVE_CAM_DESTROY_CAM);
-		CAM.set_function("DESTROY_ALL_CAMS", LUA_NATIVE_CAM_DESTROY_ALL_CAMS);
-		CAM.set_function("DOES_CAM_EXIST", LUA_NATIVE_CAM_DOES_CAM_EXIST);
-		CAM.set_function("SET_CAM_ACTIVE", LUA_NATIVE_CAM_SET_CAM_ACTIVE);
-		CAM.set_function("IS_CAM_ACTIVE", LUA_NATIVE_CAM_IS_CAM_ACTIVE);
-		CAM.set_function("IS_CAM_RENDERING", LUA_NATIVE_CAM_IS_CAM_RENDERING);
-		CAM.set_function("GET_RENDERING_CAM", LUA_NATIVE_CAM_GET_RENDERING_CAM);
-		CAM.set_function("GET_CAM_COORD", LUA_NATIVE_CAM_GET_CAM_COORD);
-		CAM.set_function("GET_CAM_ROT", LUA_NATIVE_CAM_GET_CAM_ROT);
-		CAM.set_function("GET_CAM_FOV", LUA_NATIVE_CAM_GET_CAM_FOV);
-		CAM.set_function("GET_CAM_NEAR_CLIP", LUA_NATIVE_CAM_GET_CAM_NEAR_CLIP);
-		CAM.set_function("GET_CAM_FAR_CLIP", LUA_NATIVE_CAM_GET_CAM_FAR_CLIP);
-		CAM.set_function("GET_CAM_NEAR_DOF", LUA_NATIVE_CAM_GET_CAM_NEAR_DOF);
-		CAM.set_function("GET_CAM_FAR_DOF", LUA_NATIVE_CAM_GET_CAM_FAR_DOF);
-		CAM.set_function("GET_CAM_DOF_STRENGTH", LUA_NATIVE_CAM_GET_CAM_DOF_STRENGTH);
-		CAM.set_function("SET_CAM_PARAMS", LUA_NATIVE_CAM_SET_CAM_PARAMS);
-		CAM.set_function("SET_CAM_COORD", LUA_NATIVE_CAM_SET_CAM_COORD);
-		CAM.set_function("SET_CAM_ROT", LUA_NATIVE_CAM_SET_CAM_ROT);
-		CAM.set_function("SET_CAM_FOV", LUA_NATIVE_CAM_SET_CAM_FOV);
-		CAM.set_function("SET_CAM_NEAR_CLIP", LUA_NATIVE_CAM_SET_CAM_NEAR_CLIP);
-		CAM.set_function("SET_CAM_FAR_CLIP", LUA_NATIVE_CAM_SET_CAM_FAR_CLIP);
-		CAM.set_function("FORCE_CAM_FAR_CLIP", LUA_NATIVE_CAM_FORCE_CAM_FAR_CLIP);
-		CAM.set_function("SET_CAM_MOTION_BLUR_STRENGTH", LUA_NATIVE_CAM_SET_CAM_MOTION_BLUR_STRENGTH);
-		CAM.set_function("SET_CAM_NEAR_DOF", LUA_NATIVE_CAM_SET_CAM_NEAR_DOF);
-		CAM.set_function("SET_CAM_FAR_DOF", LUA_NATIVE_CAM_SET_CAM_FAR_DOF);
-		CAM.set_function("SET_CAM_DOF_STRENGTH", LUA_NATIVE_CAM_SET_CAM_DOF_STRENGTH);
-		CAM.set_function("SET_CAM_DOF_PLANES", LUA_NATIVE_CAM_SET_CAM_DOF_PLANES);
-		CAM.set_function("SET_CAM_USE_SHALLOW_DOF_MODE", LUA_NATIVE_CAM_SET_CAM_USE_SHALLOW_DOF_MODE);
-		CAM.set_function("SET_USE_HI_DOF", LUA_NATIVE_CAM_SET_USE_HI_DOF);
-		CAM.set_function("SET_USE_HI_DOF_ON_SYNCED_SCENE_THIS_UPDATE", LUA_NATIVE_CAM_SET_USE_HI_DOF_ON_SYNCED_SCENE_THIS_UPDATE);
-		CAM.set_function("SET_CAM_DOF_OVERRIDDEN_FOCUS_DISTANCE", LUA_NATIVE_CAM_SET_CAM_DOF_OVERRIDDEN_FOCUS_DISTANCE);
-		CAM.set_function("SET_CAM_DOF_OVERRIDDEN_FOCUS_DISTANCE_BLEND_LEVEL", LUA_NATIVE_CAM_SET_CAM_DOF_OVERRIDDEN_FOCUS_DISTANCE_BLEND_LEVEL);
-		CAM.set_function("SET_CAM_DOF_FNUMBER_OF_LENS", LUA_NATIVE_CAM_SET_CAM_DOF_FNUMBER_OF_LENS);
-		CAM.set_function("SET_CAM_DOF_FOCAL_LENGTH_MULTIPLIER", LUA_NATIVE_CAM_SET_CAM_DOF_FOCAL_LENGTH_MULTIPLIER);
-		CAM.set_function("SET_CAM_DOF_FOCUS_DISTANCE_BIAS", LUA_NATIVE_CAM_SET_CAM_DOF_FOCUS_DISTANCE_BIAS);
-		CAM.set_function("SET_CAM_DOF_MAX_NEAR_IN_FOCUS_DISTANCE", LUA_NATIVE_CAM_SET_CAM_DOF_MAX_NEAR_IN_FOCUS_DISTANCE);
-		CAM.set_function("SET_CAM_DOF_MAX_NEAR_IN_FOCUS_DISTANCE_BLEND_LEVEL", LUA_NATIVE_CAM_SET_CAM_DOF_MAX_NEAR_IN_FOCUS_DISTANCE_BLEND_LEVEL);
-		CAM.set_function("SET_CAM_DOF_SHOULD_KEEP_LOOK_AT_TARGET_IN_FOCUS", LUA_NATIVE_CAM_SET_CAM_DOF_SHOULD_KEEP_LOOK_AT_TARGET_IN_FOCUS);
-		CAM.set_function("ATTACH_CAM_TO_ENTITY", LUA_NATIVE_CAM_ATTACH_CAM_TO_ENTITY);
-		CAM.set_function("ATTACH_CAM_TO_PED_BONE", LUA_NATIVE_CAM_ATTACH_CAM_TO_PED_BONE);
-		CAM.set_function("HARD_ATTACH_CAM_TO_PED_BONE", LUA_NATIVE_CAM_HARD_ATTACH_CAM_TO_PED_BONE);
-		CAM.set_function("HARD_ATTACH_CAM_TO_ENTITY", LUA_NATIVE_CAM_HARD_ATTACH_CAM_TO_ENTITY);
-		CAM.set_function("ATTACH_CAM_TO_VEHICLE_BONE", LUA_NATIVE_CAM_ATTACH_CAM_TO_VEHICLE_BONE);
-		CAM.set_function("DETACH_CAM", LUA_NATIVE_CAM_DETACH_CAM);
-		CAM.set_function("SET_CAM_INHERIT_ROLL_VEHICLE", LUA_NATIVE_CAM_SET_CAM_INHERIT_ROLL_VEHICLE);
-		CAM.set_function("POINT_CAM_AT_COORD", LUA_NATIVE_CAM_POINT_CAM_AT_COORD);
-		CAM.set_function("POINT_CAM_AT_ENTITY", LUA_NATIVE_CAM_POINT_CAM_AT_ENTITY);
-		CAM.set_function("POINT_CAM_AT_PED_BONE", LUA_NATIVE_CAM_POINT_CAM_AT_PED_BONE);
-		CAM.set_function("STOP_CAM_POINTING", LUA_NATIVE_CAM_STOP_CAM_POINTING);
-		CAM.set_function("SET_CAM_AFFECTS_AIMING", LUA_NATIVE_CAM_SET_CAM_AFFECTS_AIMING);
-		CAM.set_function("SET_CAM_CONTROLS_MINI_MAP_HEADING", LUA_NATIVE_CAM_SET_CAM_CONTROLS_MINI_MAP_HEADING);
-		CAM.set_function("SET_CAM_IS_INSIDE_VEHICLE", LUA_NATIVE_CAM_SET_CAM_IS_INSIDE_VEHICLE);
-		CAM.set_function("ALLOW_MOTION_BLUR_DECAY", LUA_NATIVE_CAM_ALLOW_MOTION_BLUR_DECAY);
-		CAM.set_function("SET_CAM_DEBUG_NAME", LUA_NATIVE_CAM_SET_CAM_DEBUG_NAME);
-		CAM.set_function("GET_DEBUG_CAM", LUA_NATIVE_CAM_GET_DEBUG_CAM);
-		CAM.set_function("ADD_CAM_SPLINE_NODE", LUA_NATIVE_CAM_ADD_CAM_SPLINE_NODE);
-		CAM.set_function("ADD_CAM_SPLINE_NODE_USING_CAMERA_FRAME", LUA_NATIVE_CAM_ADD_CAM_SPLINE_NODE_USING_CAMERA_FRAME);
-		CAM.set_function("ADD_CAM_SPLINE_NODE_USING_CAMERA", LUA_NATIVE_CAM_ADD_CAM_SPLINE_NODE_USING_CAMERA);
-		CAM.set_function("ADD_CAM_SPLINE_NODE_USING_GAMEPLAY_FRAME", LUA_NATIVE_CAM_ADD_CAM_SPLINE_NODE_USING_GAMEPLAY_FRAME);
-		CAM.set_function("SET_CAM_SPLINE_PHASE", LUA_NATIVE_CAM_SET_CAM_SPLINE_PHASE);
-		CAM.set_function("GET_CAM_SPLINE_PHASE", LUA_NATIVE_CAM_GET_CAM_SPLINE_PHASE);
-		CAM.set_function("GET_CAM_SPLINE_NODE_PHASE", LUA_NATIVE_CAM_GET_CAM_SPLINE_NODE_PHASE);
-		CAM.set_function("SET_CAM_SPLINE_DURATION", LUA_NATIVE_CAM_SET_CAM_SPLINE_DURATION);
-		CAM.set_function("SET_CAM_SPLINE_SMOOTHING_STYLE", LUA_NATIVE_CAM_SET_CAM_SPLINE_SMOOTHING_STYLE);
-		CAM.set_function("GET_CAM_SPLINE_NODE_INDEX", LUA_NATIVE_CAM_GET_CAM_SPLINE_NODE_INDEX);
-		CAM.set_function("SET_CAM_SPLINE_NODE_EASE", LUA_NATIVE_CAM_SET_CAM_SPLINE_NODE_EASE);
-		CAM.set_function("SET_CAM_SPLINE_NODE_VELOCITY_SCALE", LUA_NATIVE_CAM_SET_CAM_SPLINE_NODE_VELOCITY_SCALE);
-		CAM.set_function("OVERRIDE_CAM_SPLINE_VELOCITY", LUA_NATIVE_CAM_OVERRIDE_CAM_SPLINE_VELOCITY);
-		CAM.set_function("OVERRIDE_CAM_SPLINE_MOTION_BLUR", LUA_NATIVE_CAM_OVERRIDE_CAM_SPLINE_MOTION_BLUR);
-		CAM.set_function("SET_CAM_SPLINE_NODE_EXTRA_FLAGS", LUA_NATIVE_CAM_SET_CAM_SPLINE_NODE_EXTRA_FLAGS);
-		CAM.set_function("IS_CAM_SPLINE_PAUSED", LUA_NATIVE_CAM_IS_CAM_SPLINE_PAUSED);
-		CAM.set_function("SET_CAM_ACTIVE_WITH_INTERP", LUA_NATIVE_CAM_SET_CAM_ACTIVE_WITH_INTERP);
-		CAM.set_function("IS_CAM_INTERPOLATING", LUA_NATIVE_CAM_IS_CAM_INTERPOLATING);
-		CAM.set_function("SHAKE_CAM", LUA_NATIVE_CAM_SHAKE_CAM);
-		CAM.set_function("ANIMATED_SHAKE_CAM", LUA_NATIVE_CAM_ANIMATED_SHAKE_CAM);
-		CAM.set_function("IS_CAM_SHAKING", LUA_NATIVE_CAM_IS_CAM_SHAKING);
-		CAM.set_function("SET_CAM_SHAKE_AMPLITUDE", LUA_NATIVE_CAM_SET_CAM_SHAKE_AMPLITUDE);
-		CAM.set_function("STOP_CAM_SHAKING", LUA_NATIVE_CAM_STOP_CAM_SHAKING);
-		CAM.set_function("SHAKE_SCRIPT_GLOBAL", LUA_NATIVE_CAM_SHAKE_SCRIPT_GLOBAL);
-		CAM.set_function("ANIMATED_SHAKE_SCRIPT_GLOBAL", LUA_NATIVE_CAM_ANIMATED_SHAKE_SCRIPT_GLOBAL);
-		CAM.set_function("IS_SCRIPT_GLOBAL_SHAKING", LUA_NATIVE_CAM_IS_SCRIPT_GLOBAL_SHAKING);
-		CAM.set_function("STOP_SCRIPT_GLOBAL_SHAKING", LUA_NATIVE_CAM_STOP_SCRIPT_GLOBAL_SHAKING);
-		CAM.set_function("TRIGGER_VEHICLE_PART_BROKEN_CAMERA_SHAKE", LUA_NATIVE_CAM_TRIGGER_VEHICLE_PART_BROKEN_CAMERA_SHAKE);
-		CAM.set_function("PLAY_CAM_ANIM", LUA_NATIVE_CAM_PLAY_CAM_ANIM);
-		CAM.set_function("IS_CAM_PLAYING_ANIM", LUA_NATIVE_CAM_IS_CAM_PLAYING_ANIM);
-		CAM.set_function("SET_CAM_ANIM_CURRENT_PHASE", LUA_NATIVE_CAM_SET_CAM_ANIM_CURRENT_PHASE);
-		CAM.set_function("GET_CAM_ANIM_CURRENT_PHASE", LUA_NATIVE_CAM_GET_CAM_ANIM_CURRENT_PHASE);
-		CAM.set_function("PLAY_SYNCHRONIZED_CAM_ANIM", LUA_NATIVE_CAM_PLAY_SYNCHRONIZED_CAM_ANIM);
-		CAM.set_function("SET_FLY_CAM_HORIZONTAL_RESPONSE", LUA_NATIVE_CAM_SET_FLY_CAM_HORIZONTAL_RESPONSE);
-		CAM.set_function("SET_FLY_CAM_VERTICAL_RESPONSE", LUA_NATIVE_CAM_SET_FLY_CAM_VERTICAL_RESPONSE);
-		CAM.set_function("SET_FLY_CAM_MAX_HEIGHT", LUA_NATIVE_CAM_SET_FLY_CAM_MAX_HEIGHT);
-		CAM.set_function("SET_FLY_CAM_COORD_AND_CONSTRAIN", LUA_NATIVE_CAM_SET_FLY_CAM_COORD_AND_CONSTRAIN);
-		CAM.set_function("SET_FLY_CAM_VERTICAL_CONTROLS_THIS_UPDATE", LUA_NATIVE_CAM_SET_FLY_CAM_VERTICAL_CONTROLS_THIS_UPDATE);
-		CAM.set_function("WAS_FLY_CAM_CONSTRAINED_ON_PREVIOUS_UDPATE", LUA_NATIVE_CAM_WAS_FLY_CAM_CONSTRAINED_ON_PREVIOUS_UDPATE);
-		CAM.set_function("IS_SCREEN_FADED_OUT", LUA_NATIVE_CAM_IS_SCREEN_FADED_OUT);
-		CAM.set_function("IS_SCREEN_FADED_IN", LUA_NATIVE_CAM_IS_SCREEN_FADED_IN);
-		CAM.set_function("IS_SCREEN_FADING_OUT", LUA_NATIVE_CAM_IS_SCREEN_FADING_OUT);
-		CAM.set_function("IS_SCREEN_FADING_IN", LUA_NATIVE_CAM_IS_SCREEN_FADING_IN);
-		CAM.set_function("DO_SCREEN_FADE_IN", LUA_NATIVE_CAM_DO_SCREEN_FADE_IN);
-		CAM.set_function("DO_SCREEN_FADE_OUT", LUA_NATIVE_CAM_DO_SCREEN_FADE_OUT);
-		CAM.set_function("SET_WIDESCREEN_BORDERS", LUA_NATIVE_CAM_SET_WIDESCREEN_BORDERS);
-		CAM.set_function("ARE_WIDESCREEN_BORDERS_ACTIVE", LUA_NATIVE_CAM_ARE_WIDESCREEN_BORDERS_ACTIVE);
-		CAM.set_function("GET_GAMEPLAY_CAM_COORD", LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_COORD);
-		CAM.set_function("GET_GAMEPLAY_CAM_ROT", LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_ROT);
-		CAM.set_function("GET_GAMEPLAY_CAM_FOV", LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_FOV);
-		CAM.set_function("SET_GAMEPLAY_CAM_MOTION_BLUR_SCALING_THIS_UPDATE", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_MOTION_BLUR_SCALING_THIS_UPDATE);
-		CAM.set_function("SET_GAMEPLAY_CAM_MAX_MOTION_BLUR_STRENGTH_THIS_UPDATE", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_MAX_MOTION_BLUR_STRENGTH_THIS_UPDATE);
-		CAM.set_function("GET_GAMEPLAY_CAM_RELATIVE_HEADING", LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_RELATIVE_HEADING);
-		CAM.set_function("SET_GAMEPLAY_CAM_RELATIVE_HEADING", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_RELATIVE_HEADING);
-		CAM.set_function("GET_GAMEPLAY_CAM_RELATIVE_PITCH", LUA_NATIVE_CAM_GET_GAMEPLAY_CAM_RELATIVE_PITCH);
-		CAM.set_function("SET_GAMEPLAY_CAM_RELATIVE_PITCH", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_RELATIVE_PITCH);
-		CAM.set_function("RESET_GAMEPLAY_CAM_FULL_ATTACH_PARENT_TRANSFORM_TIMER", LUA_NATIVE_CAM_RESET_GAMEPLAY_CAM_FULL_ATTACH_PARENT_TRANSFORM_TIMER);
-		CAM.set_function("FORCE_CAMERA_RELATIVE_HEADING_AND_PITCH", LUA_NATIVE_CAM_FORCE_CAMERA_RELATIVE_HEADING_AND_PITCH);
-		CAM.set_function("FORCE_BONNET_CAMERA_RELATIVE_HEADING_AND_PITCH", LUA_NATIVE_CAM_FORCE_BONNET_CAMERA_RELATIVE_HEADING_AND_PITCH);
-		CAM.set_function("SET_FIRST_PERSON_SHOOTER_CAMERA_HEADING", LUA_NATIVE_CAM_SET_FIRST_PERSON_SHOOTER_CAMERA_HEADING);
-		CAM.set_function("SET_FIRST_PERSON_SHOOTER_CAMERA_PITCH", LUA_NATIVE_CAM_SET_FIRST_PERSON_SHOOTER_CAMERA_PITCH);
-		CAM.set_function("SET_SCRIPTED_CAMERA_IS_FIRST_PERSON_THIS_FRAME", LUA_NATIVE_CAM_SET_SCRIPTED_CAMERA_IS_FIRST_PERSON_THIS_FRAME);
-		CAM.set_function("SHAKE_GAMEPLAY_CAM", LUA_NATIVE_CAM_SHAKE_GAMEPLAY_CAM);
-		CAM.set_function("IS_GAMEPLAY_CAM_SHAKING", LUA_NATIVE_CAM_IS_GAMEPLAY_CAM_SHAKING);
-		CAM.set_function("SET_GAMEPLAY_CAM_SHAKE_AMPLITUDE", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_SHAKE_AMPLITUDE);
-		CAM.set_function("STOP_GAMEPLAY_CAM_SHAKING", LUA_NATIVE_CAM_STOP_GAMEPLAY_CAM_SHAKING);
-		CAM.set_function("SET_GAMEPLAY_CAM_FOLLOW_PED_THIS_UPDATE", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_FOLLOW_PED_THIS_UPDATE);
-		CAM.set_function("IS_GAMEPLAY_CAM_RENDERING", LUA_NATIVE_CAM_IS_GAMEPLAY_CAM_RENDERING);
-		CAM.set_function("IS_INTERPOLATING_FROM_SCRIPT_CAMS", LUA_NATIVE_CAM_IS_INTERPOLATING_FROM_SCRIPT_CAMS);
-		CAM.set_function("IS_INTERPOLATING_TO_SCRIPT_CAMS", LUA_NATIVE_CAM_IS_INTERPOLATING_TO_SCRIPT_CAMS);
-		CAM.set_function("SET_GAMEPLAY_CAM_ALTITUDE_FOV_SCALING_STATE", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_ALTITUDE_FOV_SCALING_STATE);
-		CAM.set_function("DISABLE_GAMEPLAY_CAM_ALTITUDE_FOV_SCALING_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_GAMEPLAY_CAM_ALTITUDE_FOV_SCALING_THIS_UPDATE);
-		CAM.set_function("IS_GAMEPLAY_CAM_LOOKING_BEHIND", LUA_NATIVE_CAM_IS_GAMEPLAY_CAM_LOOKING_BEHIND);
-		CAM.set_function("SET_GAMEPLAY_CAM_IGNORE_ENTITY_COLLISION_THIS_UPDATE", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_IGNORE_ENTITY_COLLISION_THIS_UPDATE);
-		CAM.set_function("DISABLE_CAM_COLLISION_FOR_OBJECT", LUA_NATIVE_CAM_DISABLE_CAM_COLLISION_FOR_OBJECT);
-		CAM.set_function("BYPASS_CAMERA_COLLISION_BUOYANCY_TEST_THIS_UPDATE", LUA_NATIVE_CAM_BYPASS_CAMERA_COLLISION_BUOYANCY_TEST_THIS_UPDATE);
-		CAM.set_function("SET_GAMEPLAY_CAM_ENTITY_TO_LIMIT_FOCUS_OVER_BOUNDING_SPHERE_THIS_UPDATE", LUA_NATIVE_CAM_SET_GAMEPLAY_CAM_ENTITY_TO_LIMIT_FOCUS_OVER_BOUNDING_SPHERE_THIS_UPDATE);
-		CAM.set_function("DISABLE_FIRST_PERSON_CAMERA_WATER_CLIPPING_TEST_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_FIRST_PERSON_CAMERA_WATER_CLIPPING_TEST_THIS_UPDATE);
-		CAM.set_function("SET_FOLLOW_CAM_IGNORE_ATTACH_PARENT_MOVEMENT_THIS_UPDATE", LUA_NATIVE_CAM_SET_FOLLOW_CAM_IGNORE_ATTACH_PARENT_MOVEMENT_THIS_UPDATE);
-		CAM.set_function("IS_SPHERE_VISIBLE", LUA_NATIVE_CAM_IS_SPHERE_VISIBLE);
-		CAM.set_function("IS_FOLLOW_PED_CAM_ACTIVE", LUA_NATIVE_CAM_IS_FOLLOW_PED_CAM_ACTIVE);
-		CAM.set_function("SET_FOLLOW_PED_CAM_THIS_UPDATE", LUA_NATIVE_CAM_SET_FOLLOW_PED_CAM_THIS_UPDATE);
-		CAM.set_function("USE_SCRIPT_CAM_FOR_AMBIENT_POPULATION_ORIGIN_THIS_FRAME", LUA_NATIVE_CAM_USE_SCRIPT_CAM_FOR_AMBIENT_POPULATION_ORIGIN_THIS_FRAME);
-		CAM.set_function("SET_FOLLOW_PED_CAM_LADDER_ALIGN_THIS_UPDATE", LUA_NATIVE_CAM_SET_FOLLOW_PED_CAM_LADDER_ALIGN_THIS_UPDATE);
-		CAM.set_function("SET_THIRD_PERSON_CAM_RELATIVE_HEADING_LIMITS_THIS_UPDATE", LUA_NATIVE_CAM_SET_THIRD_PERSON_CAM_RELATIVE_HEADING_LIMITS_THIS_UPDATE);
-		CAM.set_function("SET_THIRD_PERSON_CAM_RELATIVE_PITCH_LIMITS_THIS_UPDATE", LUA_NATIVE_CAM_SET_THIRD_PERSON_CAM_RELATIVE_PITCH_LIMITS_THIS_UPDATE);
-		CAM.set_function("SET_THIRD_PERSON_CAM_ORBIT_DISTANCE_LIMITS_THIS_UPDATE", LUA_NATIVE_CAM_SET_THIRD_PERSON_CAM_ORBIT_DISTANCE_LIMITS_THIS_UPDATE);
-		CAM.set_function("GET_THIRD_PERSON_CAM_MIN_ORBIT_DISTANCE_SPRING_", LUA_NATIVE_CAM_GET_THIRD_PERSON_CAM_MIN_ORBIT_DISTANCE_SPRING_);
-		CAM.set_function("GET_THIRD_PERSON_CAM_MAX_ORBIT_DISTANCE_SPRING_", LUA_NATIVE_CAM_GET_THIRD_PERSON_CAM_MAX_ORBIT_DISTANCE_SPRING_);
-		CAM.set_function("SET_IN_VEHICLE_CAM_STATE_THIS_UPDATE", LUA_NATIVE_CAM_SET_IN_VEHICLE_CAM_STATE_THIS_UPDATE);
-		CAM.set_function("DISABLE_ON_FOOT_FIRST_PERSON_VIEW_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_ON_FOOT_FIRST_PERSON_VIEW_THIS_UPDATE);
-		CAM.set_function("DISABLE_FIRST_PERSON_FLASH_EFFECT_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_FIRST_PERSON_FLASH_EFFECT_THIS_UPDATE);
-		CAM.set_function("BLOCK_FIRST_PERSON_ORIENTATION_RESET_THIS_UPDATE", LUA_NATIVE_CAM_BLOCK_FIRST_PERSON_ORIENTATION_RESET_THIS_UPDATE);
-		CAM.set_function("GET_FOLLOW_PED_CAM_ZOOM_LEVEL", LUA_NATIVE_CAM_GET_FOLLOW_PED_CAM_ZOOM_LEVEL);
-		CAM.set_function("GET_FOLLOW_PED_CAM_VIEW_MODE", LUA_NATIVE_CAM_GET_FOLLOW_PED_CAM_VIEW_MODE);
-		CAM.set_function("SET_FOLLOW_PED_CAM_VIEW_MODE", LUA_NATIVE_CAM_SET_FOLLOW_PED_CAM_VIEW_MODE);
-		CAM.set_function("IS_FOLLOW_VEHICLE_CAM_ACTIVE", LUA_NATIVE_CAM_IS_FOLLOW_VEHICLE_CAM_ACTIVE);
-		CAM.set_function("SET_FOLLOW_VEHICLE_CAM_HIGH_ANGLE_MODE_THIS_UPDATE", LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_HIGH_ANGLE_MODE_THIS_UPDATE);
-		CAM.set_function("SET_FOLLOW_VEHICLE_CAM_HIGH_ANGLE_MODE_EVERY_UPDATE", LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_HIGH_ANGLE_MODE_EVERY_UPDATE);
-		CAM.set_function("SET_TABLE_GAMES_CAMERA_THIS_UPDATE", LUA_NATIVE_CAM_SET_TABLE_GAMES_CAMERA_THIS_UPDATE);
-		CAM.set_function("GET_FOLLOW_VEHICLE_CAM_ZOOM_LEVEL", LUA_NATIVE_CAM_GET_FOLLOW_VEHICLE_CAM_ZOOM_LEVEL);
-		CAM.set_function("SET_FOLLOW_VEHICLE_CAM_ZOOM_LEVEL", LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_ZOOM_LEVEL);
-		CAM.set_function("GET_FOLLOW_VEHICLE_CAM_VIEW_MODE", LUA_NATIVE_CAM_GET_FOLLOW_VEHICLE_CAM_VIEW_MODE);
-		CAM.set_function("SET_FOLLOW_VEHICLE_CAM_VIEW_MODE", LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_VIEW_MODE);
-		CAM.set_function("GET_CAM_VIEW_MODE_FOR_CONTEXT", LUA_NATIVE_CAM_GET_CAM_VIEW_MODE_FOR_CONTEXT);
-		CAM.set_function("SET_CAM_VIEW_MODE_FOR_CONTEXT", LUA_NATIVE_CAM_SET_CAM_VIEW_MODE_FOR_CONTEXT);
-		CAM.set_function("GET_CAM_ACTIVE_VIEW_MODE_CONTEXT", LUA_NATIVE_CAM_GET_CAM_ACTIVE_VIEW_MODE_CONTEXT);
-		CAM.set_function("USE_VEHICLE_CAM_STUNT_SETTINGS_THIS_UPDATE", LUA_NATIVE_CAM_USE_VEHICLE_CAM_STUNT_SETTINGS_THIS_UPDATE);
-		CAM.set_function("USE_DEDICATED_STUNT_CAMERA_THIS_UPDATE", LUA_NATIVE_CAM_USE_DEDICATED_STUNT_CAMERA_THIS_UPDATE);
-		CAM.set_function("FORCE_VEHICLE_CAM_STUNT_SETTINGS_THIS_UPDATE", LUA_NATIVE_CAM_FORCE_VEHICLE_CAM_STUNT_SETTINGS_THIS_UPDATE);
-		CAM.set_function("SET_FOLLOW_VEHICLE_CAM_SEAT_THIS_UPDATE", LUA_NATIVE_CAM_SET_FOLLOW_VEHICLE_CAM_SEAT_THIS_UPDATE);
-		CAM.set_function("IS_AIM_CAM_ACTIVE", LUA_NATIVE_CAM_IS_AIM_CAM_ACTIVE);
-		CAM.set_function("IS_AIM_CAM_ACTIVE_IN_ACCURATE_MODE", LUA_NATIVE_CAM_IS_AIM_CAM_ACTIVE_IN_ACCURATE_MODE);
-		CAM.set_function("IS_FIRST_PERSON_AIM_CAM_ACTIVE", LUA_NATIVE_CAM_IS_FIRST_PERSON_AIM_CAM_ACTIVE);
-		CAM.set_function("DISABLE_AIM_CAM_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_AIM_CAM_THIS_UPDATE);
-		CAM.set_function("GET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR", LUA_NATIVE_CAM_GET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR);
-		CAM.set_function("SET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR", LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR);
-		CAM.set_function("SET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR_LIMITS_THIS_UPDATE", LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_ZOOM_FACTOR_LIMITS_THIS_UPDATE);
-		CAM.set_function("SET_FIRST_PERSON_AIM_CAM_RELATIVE_HEADING_LIMITS_THIS_UPDATE", LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_RELATIVE_HEADING_LIMITS_THIS_UPDATE);
-		CAM.set_function("SET_FIRST_PERSON_AIM_CAM_RELATIVE_PITCH_LIMITS_THIS_UPDATE", LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_RELATIVE_PITCH_LIMITS_THIS_UPDATE);
-		CAM.set_function("SET_FIRST_PERSON_AIM_CAM_NEAR_CLIP_THIS_UPDATE", LUA_NATIVE_CAM_SET_FIRST_PERSON_AIM_CAM_NEAR_CLIP_THIS_UPDATE);
-		CAM.set_function("SET_THIRD_PERSON_AIM_CAM_NEAR_CLIP_THIS_UPDATE", LUA_NATIVE_CAM_SET_THIRD_PERSON_AIM_CAM_NEAR_CLIP_THIS_UPDATE);
-		CAM.set_function("SET_ALLOW_CUSTOM_VEHICLE_DRIVE_BY_CAM_THIS_UPDATE", LUA_NATIVE_CAM_SET_ALLOW_CUSTOM_VEHICLE_DRIVE_BY_CAM_THIS_UPDATE);
-		CAM.set_function("FORCE_TIGHTSPACE_CUSTOM_FRAMING_THIS_UPDATE", LUA_NATIVE_CAM_FORCE_TIGHTSPACE_CUSTOM_FRAMING_THIS_UPDATE);
-		CAM.set_function("GET_FINAL_RENDERED_CAM_COORD", LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_COORD);
-		CAM.set_function("GET_FINAL_RENDERED_CAM_ROT", LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_ROT);
-		CAM.set_function("GET_FINAL_RENDERED_REMOTE_PLAYER_CAM_ROT", LUA_NATIVE_CAM_GET_FINAL_RENDERED_REMOTE_PLAYER_CAM_ROT);
-		CAM.set_function("GET_FINAL_RENDERED_CAM_FOV", LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_FOV);
-		CAM.set_function("GET_FINAL_RENDERED_REMOTE_PLAYER_CAM_FOV", LUA_NATIVE_CAM_GET_FINAL_RENDERED_REMOTE_PLAYER_CAM_FOV);
-		CAM.set_function("GET_FINAL_RENDERED_CAM_NEAR_CLIP", LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_NEAR_CLIP);
-		CAM.set_function("GET_FINAL_RENDERED_CAM_FAR_CLIP", LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_FAR_CLIP);
-		CAM.set_function("GET_FINAL_RENDERED_CAM_NEAR_DOF", LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_NEAR_DOF);
-		CAM.set_function("GET_FINAL_RENDERED_CAM_FAR_DOF", LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_FAR_DOF);
-		CAM.set_function("GET_FINAL_RENDERED_CAM_MOTION_BLUR_STRENGTH", LUA_NATIVE_CAM_GET_FINAL_RENDERED_CAM_MOTION_BLUR_STRENGTH);
-		CAM.set_function("SET_GAMEPLAY_COORD_HINT", LUA_NATIVE_CAM_SET_GAMEPLAY_COORD_HINT);
-		CAM.set_function("SET_GAMEPLAY_PED_HINT", LUA_NATIVE_CAM_SET_GAMEPLAY_PED_HINT);
-		CAM.set_function("SET_GAMEPLAY_VEHICLE_HINT", LUA_NATIVE_CAM_SET_GAMEPLAY_VEHICLE_HINT);
-		CAM.set_function("SET_GAMEPLAY_OBJECT_HINT", LUA_NATIVE_CAM_SET_GAMEPLAY_OBJECT_HINT);
-		CAM.set_function("SET_GAMEPLAY_ENTITY_HINT", LUA_NATIVE_CAM_SET_GAMEPLAY_ENTITY_HINT);
-		CAM.set_function("IS_GAMEPLAY_HINT_ACTIVE", LUA_NATIVE_CAM_IS_GAMEPLAY_HINT_ACTIVE);
-		CAM.set_function("STOP_GAMEPLAY_HINT", LUA_NATIVE_CAM_STOP_GAMEPLAY_HINT);
-		CAM.set_function("STOP_GAMEPLAY_HINT_BEING_CANCELLED_THIS_UPDATE", LUA_NATIVE_CAM_STOP_GAMEPLAY_HINT_BEING_CANCELLED_THIS_UPDATE);
-		CAM.set_function("STOP_CODE_GAMEPLAY_HINT", LUA_NATIVE_CAM_STOP_CODE_GAMEPLAY_HINT);
-		CAM.set_function("IS_CODE_GAMEPLAY_HINT_ACTIVE", LUA_NATIVE_CAM_IS_CODE_GAMEPLAY_HINT_ACTIVE);
-		CAM.set_function("SET_GAMEPLAY_HINT_FOV", LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_FOV);
-		CAM.set_function("SET_GAMEPLAY_HINT_FOLLOW_DISTANCE_SCALAR", LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_FOLLOW_DISTANCE_SCALAR);
-		CAM.set_function("SET_GAMEPLAY_HINT_BASE_ORBIT_PITCH_OFFSET", LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_BASE_ORBIT_PITCH_OFFSET);
-		CAM.set_function("SET_GAMEPLAY_HINT_CAMERA_RELATIVE_SIDE_OFFSET", LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_CAMERA_RELATIVE_SIDE_OFFSET);
-		CAM.set_function("SET_GAMEPLAY_HINT_CAMERA_RELATIVE_VERTICAL_OFFSET", LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_CAMERA_RELATIVE_VERTICAL_OFFSET);
-		CAM.set_function("SET_GAMEPLAY_HINT_CAMERA_BLEND_TO_FOLLOW_PED_MEDIUM_VIEW_MODE", LUA_NATIVE_CAM_SET_GAMEPLAY_HINT_CAMERA_BLEND_TO_FOLLOW_PED_MEDIUM_VIEW_MODE);
-		CAM.set_function("SET_CINEMATIC_BUTTON_ACTIVE", LUA_NATIVE_CAM_SET_CINEMATIC_BUTTON_ACTIVE);
-		CAM.set_function("IS_CINEMATIC_CAM_RENDERING", LUA_NATIVE_CAM_IS_CINEMATIC_CAM_RENDERING);
-		CAM.set_function("SHAKE_CINEMATIC_CAM", LUA_NATIVE_CAM_SHAKE_CINEMATIC_CAM);
-		CAM.set_function("IS_CINEMATIC_CAM_SHAKING", LUA_NATIVE_CAM_IS_CINEMATIC_CAM_SHAKING);
-		CAM.set_function("SET_CINEMATIC_CAM_SHAKE_AMPLITUDE", LUA_NATIVE_CAM_SET_CINEMATIC_CAM_SHAKE_AMPLITUDE);
-		CAM.set_function("STOP_CINEMATIC_CAM_SHAKING", LUA_NATIVE_CAM_STOP_CINEMATIC_CAM_SHAKING);
-		CAM.set_function("DISABLE_CINEMATIC_BONNET_CAMERA_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_CINEMATIC_BONNET_CAMERA_THIS_UPDATE);
-		CAM.set_function("DISABLE_CINEMATIC_VEHICLE_IDLE_MODE_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_CINEMATIC_VEHICLE_IDLE_MODE_THIS_UPDATE);
-		CAM.set_function("INVALIDATE_CINEMATIC_VEHICLE_IDLE_MODE", LUA_NATIVE_CAM_INVALIDATE_CINEMATIC_VEHICLE_IDLE_MODE);
-		CAM.set_function("INVALIDATE_IDLE_CAM", LUA_NATIVE_CAM_INVALIDATE_IDLE_CAM);
-		CAM.set_function("IS_CINEMATIC_IDLE_CAM_RENDERING", LUA_NATIVE_CAM_IS_CINEMATIC_IDLE_CAM_RENDERING);
-		CAM.set_function("IS_CINEMATIC_FIRST_PERSON_VEHICLE_INTERIOR_CAM_RENDERING", LUA_NATIVE_CAM_IS_CINEMATIC_FIRST_PERSON_VEHICLE_INTERIOR_CAM_RENDERING);
-		CAM.set_function("CREATE_CINEMATIC_SHOT", LUA_NATIVE_CAM_CREATE_CINEMATIC_SHOT);
-		CAM.set_function("IS_CINEMATIC_SHOT_ACTIVE", LUA_NATIVE_CAM_IS_CINEMATIC_SHOT_ACTIVE);
-		CAM.set_function("STOP_CINEMATIC_SHOT", LUA_NATIVE_CAM_STOP_CINEMATIC_SHOT);
-		CAM.set_function("FORCE_CINEMATIC_RENDERING_THIS_UPDATE", LUA_NATIVE_CAM_FORCE_CINEMATIC_RENDERING_THIS_UPDATE);
-		CAM.set_function("SET_CINEMATIC_NEWS_CHANNEL_ACTIVE_THIS_UPDATE", LUA_NATIVE_CAM_SET_CINEMATIC_NEWS_CHANNEL_ACTIVE_THIS_UPDATE);
-		CAM.set_function("SET_CINEMATIC_MODE_ACTIVE", LUA_NATIVE_CAM_SET_CINEMATIC_MODE_ACTIVE);
-		CAM.set_function("IS_IN_VEHICLE_MOBILE_PHONE_CAMERA_RENDERING", LUA_NATIVE_CAM_IS_IN_VEHICLE_MOBILE_PHONE_CAMERA_RENDERING);
-		CAM.set_function("DISABLE_CINEMATIC_SLOW_MO_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_CINEMATIC_SLOW_MO_THIS_UPDATE);
-		CAM.set_function("IS_BONNET_CINEMATIC_CAM_RENDERING", LUA_NATIVE_CAM_IS_BONNET_CINEMATIC_CAM_RENDERING);
-		CAM.set_function("IS_CINEMATIC_CAM_INPUT_ACTIVE", LUA_NATIVE_CAM_IS_CINEMATIC_CAM_INPUT_ACTIVE);
-		CAM.set_function("IGNORE_MENU_PREFERENCE_FOR_BONNET_CAMERA_THIS_UPDATE", LUA_NATIVE_CAM_IGNORE_MENU_PREFERENCE_FOR_BONNET_CAMERA_THIS_UPDATE);
-		CAM.set_function("BYPASS_CUTSCENE_CAM_RENDERING_THIS_UPDATE", LUA_NATIVE_CAM_BYPASS_CUTSCENE_CAM_RENDERING_THIS_UPDATE);
-		CAM.set_function("STOP_CUTSCENE_CAM_SHAKING", LUA_NATIVE_CAM_STOP_CUTSCENE_CAM_SHAKING);
-		CAM.set_function("SET_CUTSCENE_CAM_FAR_CLIP_THIS_UPDATE", LUA_NATIVE_CAM_SET_CUTSCENE_CAM_FAR_CLIP_THIS_UPDATE);
-		CAM.set_function("GET_FOCUS_PED_ON_SCREEN", LUA_NATIVE_CAM_GET_FOCUS_PED_ON_SCREEN);
-		CAM.set_function("DISABLE_NEAR_CLIP_SCAN_THIS_UPDATE", LUA_NATIVE_CAM_DISABLE_NEAR_CLIP_SCAN_THIS_UPDATE);
-		CAM.set_function("SET_CAM_DEATH_FAIL_EFFECT_STATE", LUA_NATIVE_CAM_SET_CAM_DEATH_FAIL_EFFECT_STATE);
-		CAM.set_function("SET_FIRST_PERSON_FLASH_EFFECT_TYPE", LUA_NATIVE_CAM_SET_FIRST_PERSON_FLASH_EFFECT_TYPE);
-		CAM.set_function("SET_FIRST_PERSON_FLASH_EFFECT_VEHICLE_MODEL_NAME", LUA_NATIVE_CAM_SET_FIRST_PERSON_FLASH_EFFECT_VEHICLE_MODEL_NAME);
-		CAM.set_function("SET_FIRST_PERSON_FLASH_EFFECT_VEHICLE_MODEL_HASH", LUA_NATIVE_CAM_SET_FIRST_PERSON_FLASH_EFFECT_VEHICLE_MODEL_HASH);
-		CAM.set_function("IS_ALLOWED_INDEPENDENT_CAMERA_MODES", LUA_NATIVE_CAM_IS_ALLOWED_INDEPENDENT_CAMERA_MODES);
-		CAM.set_function("CAMERA_PREVENT_COLLISION_SETTINGS_FOR_TRIPLEHEAD_IN_INTERIORS_THIS_UPDATE", LUA_NATIVE_CAM_CAMERA_PREVENT_COLLISION_SETTINGS_FOR_TRIPLEHEAD_IN_INTERIORS_THIS_UPDATE);
-		CAM.set_function("REPLAY_GET_MAX_DISTANCE_ALLOWED_FROM_PLAYER", LUA_NATIVE_CAM_REPLAY_GET_MAX_DISTANCE_ALLOWED_FROM_PLAYER);
+		bind_namespace(L, "CAM", CAM_natives);
 	}
 }
@@ -118,24 +118,27 @@ namespace lua::native
 		return return_values;
 	}
 
+	static constexpr native_entry CLOCK_natives[] = {
+		{"ADD_TO_CLOCK_TIME", native_function<LUA_NATIVE_CLOCK_ADD_TO_CLOCK_TIME>},
+		{"ADVANCE_CLOCK_TIME_TO", native_function<LUA_NATIVE_CLOCK_ADVANCE_CLOCK_TIME_TO>},
+		{"GET_CLOCK_DAY_OF_MONTH", native_function<LUA_NATIVE_CLOCK_GET_CLOCK_DAY_OF_MONTH>},
+		{"GET_CLOCK_DAY_OF_WEEK", native_function<LUA_NATIVE_CLOCK_GET_CLOCK_DAY_OF_WEEK>},
+		{"GET_CLOCK_HOURS", native_function<LUA_NATIVE_CLOCK_GET_CLOCK_HOURS>},
+		{"GET_CLOCK_MINUTES", native_function<LUA_NATIVE_CLOCK_GET_CLOCK_MINUTES>},
+		{"GET_CLOCK_MONTH", native_function<LUA_NATIVE_CLOCK_GET_CLOCK_MONTH>},
+		{"GET_CLOCK_SECONDS", native_function<LUA_NATIVE_CLOCK_GET_CLOCK_SECONDS>},
+		{"GET_CLOCK_YEAR", native_function<LUA_NATIVE_CLOCK_GET_CLOCK_YEAR>},
+		{"GET_LOCAL_TIME", native_function<LUA_NATIVE_CLOCK_GET_LOCAL_TIME>},
+		{"GET_MILLISECONDS_PER_GAME_MINUTE", native_function<LUA_NATIVE_CLOCK_GET_MILLISECONDS_PER_GAME_MINUTE>},
+		{"GET_POSIX_TIME", native_function<LUA_NATIVE_CLOCK_GET_POSIX_TIME>},
+		{"GET_UTC_TIME", native_function<LUA_NATIVE_CLOCK_GET_UTC_TIME>},
+		{"PAUSE_CLOCK", native_function<LUA_NATIVE_CLOCK_PAUSE_CLOCK>},
+		{"SET_CLOCK_DATE", native_function<LUA_NATIVE_CLOCK_SET_CLOCK_DATE>},
+		{"SET_CLOCK_TIME", native_function<LUA_NATIVE_CLOCK_SET_CLOCK_TIME>},
+	};
+
 	void init_native_binding_CLOCK(sol::state& L)
 	{
-		auto CLOCK = L["CLOCK"].get_or_create<sol::table>();
-		CLOCK.set_function("SET_CLOCK_TIME", LUA_NATIVE_CLOCK_SET_CLOCK_TIME);
-		CLOCK.set_function("PAUSE_CLOCK", LUA_NATIVE_CLOCK_PAUSE_CLOCK);
-		CLOCK.set_function("ADVANCE_CLOCK_TIME_TO", LUA_NATIVE_CLOCK_ADVANCE_CLOCK_TIME_TO);
-		CLOCK.set_function("ADD_TO_CLOCK_TIME", LUA_NATIVE_CLOCK_ADD_TO_CLOCK_TIME);
-		CLOCK.set_function("GET_CLOCK_HOURS", LUA_NATIVE_CLOCK_GET_CLOCK_HOURS);
-		CLOCK.set_function("GET_CLOCK_MINUTES", LUA_NATIVE_CLOCK_GET_CLOCK_MINUTES);
-		CLOCK.set_function("GET_CLOCK_SECONDS", LUA_NATIVE_CLOCK_GET_CLOCK_SECONDS);
-		CLOCK.set_function("SET_CLOCK_DATE", LUA_NATIVE_CLOCK_SET_CLOCK_DATE);
-		CLOCK.set_function("GET_CLOCK_DAY_OF_WEEK", LUA_NATIVE_CLOCK_GET_CLOCK_DAY_OF_WEEK);
-		CLOCK.set_function("GET_CLOCK_DAY_OF_MONTH", LUA_NATIVE_CLOCK_GET_CLOCK_DAY_OF_MONTH);
-		CLOCK.set_function("GET_CLOCK_MONTH", LUA_NATIVE_CLOCK_GET_CLOCK_MONTH);
-		CLOCK.set_function("GET_CLOCK_YEAR", LUA_NATIVE_CLOCK_GET_CLOCK_YEAR);
-		CLOCK.set_function("GET_MILLISECONDS_PER_GAME_MINUTE", LUA_NATIVE_CLOCK_GET_MILLISECONDS_PER_GAME_MINUTE);
-		CLOCK.set_function("GET_POSIX_TIME", LUA_NATIVE_CLOCK_GET_POSIX_TIME);
-		CLOCK.set_function("GET_UTC_TIME", LUA_NATIVE_CLOCK_GET_UTC_TIME);
-		CLOCK.set_function("GET_LOCAL_TIME", LUA_NATIVE_CLOCK_GET_LOCAL_TIME);
+		bind_namespace(L, "CLOCK", CLOCK_natives);
 	}
 }
@@ -300,62 +300,65 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry CUTSCENE_natives[] = {
+		{"CAN_REQUEST_ASSETS_FOR_CUTSCENE_ENTITY", native_function<LUA_NATIVE_CUTSCENE_CAN_REQUEST_ASSETS_FOR_CUTSCENE_ENTITY>},
+		{"CAN_SET_ENTER_STATE_FOR_REGISTERED_ENTITY", native_function<LUA_NATIVE_CUTSCENE_CAN_SET_ENTER_STATE_FOR_REGISTERED_ENTITY>},
+		{"CAN_SET_EXIT_STATE_FOR_CAMERA", native_function<LUA_NATIVE_CUTSCENE_CAN_SET_EXIT_STATE_FOR_CAMERA>},
+		{"CAN_SET_EXIT_STATE_FOR_REGISTERED_ENTITY", native_function<LUA_NATIVE_CUTSCENE_CAN_SET_EXIT_STATE_FOR_REGISTERED_ENTITY>},
+		{"CAN_USE_MOBILE_PHONE_DURING_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_CAN_USE_MOBILE_PHONE_DURING_CUTSCENE>},
+		{"DOES_CUTSCENE_ENTITY_EXIST", native_function<LUA_NATIVE_CUTSCENE_DOES_CUTSCENE_ENTITY_EXIST>},
+		{"DOES_CUTSCENE_HANDLE_EXIST", native_function<LUA_NATIVE_CUTSCENE_DOES_CUTSCENE_HANDLE_EXIST>},
+		{"GET_CUTSCENE_CONCAT_SECTION_PLAYING", native_function<LUA_NATIVE_CUTSCENE_GET_CUTSCENE_CONCAT_SECTION_PLAYING>},
+		{"GET_CUTSCENE_END_TIME", native_function<LUA_NATIVE_CUTSCENE_GET_CUTSCENE_END_TIME>},
+		{"GET_CUTSCENE_PLAY_DURATION", native_function<LUA_NATIVE_CUTSCENE_GET_CUTSCENE_PLAY_DURATION>},
+		{"GET_CUTSCENE_SECTION_PLAYING", native_function<LUA_NATIVE_CUTSCENE_GET_CUTSCENE_SECTION_PLAYING>},
+		{"GET_CUTSCENE_TIME", native_function<LUA_NATIVE_CUTSCENE_GET_CUTSCENE_TIME>},
+		{"GET_CUTSCENE_TOTAL_DURATION", native_function<LUA_NATIVE_CUTSCENE_GET_CUTSCENE_TOTAL_DURATION>},
+		{"GET_CUT_FILE_CONCAT_COUNT", native_function<LUA_NATIVE_CUTSCENE_GET_CUT_FILE_CONCAT_COUNT>},
+		{"GET_ENTITY_INDEX_OF_CUTSCENE_ENTITY", native_function<LUA_NATIVE_CUTSCENE_GET_ENTITY_INDEX_OF_CUTSCENE_ENTITY>},
+		{"GET_ENTITY_INDEX_OF_REGISTERED_ENTITY", native_function<LUA_NATIVE_CUTSCENE_GET_ENTITY_INDEX_OF_REGISTERED_ENTITY>},
+		{"HAS_CUTSCENE_CUT_THIS_FRAME", native_function<LUA_NATIVE_CUTSCENE_HAS_CUTSCENE_CUT_THIS_FRAME>},
+		{"HAS_CUTSCENE_FINISHED", native_function<LUA_NATIVE_CUTSCENE_HAS_CUTSCENE_FINISHED>},
+		{"HAS_CUTSCENE_LOADED", native_function<LUA_NATIVE_CUTSCENE_HAS_CUTSCENE_LOADED>},
+		{"HAS_CUT_FILE_LOADED", native_function<LUA_NATIVE_CUTSCENE_HAS_CUT_FILE_LOADED>},
+		{"HAS_THIS_CUTSCENE_LOADED", native_function<LUA_NATIVE_CUTSCENE_HAS_THIS_CUTSCENE_LOADED>},
+		{"IS_CUTSCENE_ACTIVE", native_function<LUA_NATIVE_CUTSCENE_IS_CUTSCENE_ACTIVE>},
+		{"IS_CUTSCENE_AUTHORIZED", native_function<LUA_NATIVE_CUTSCENE_IS_CUTSCENE_AUTHORIZED>},
+		{"IS_CUTSCENE_PLAYBACK_FLAG_SET", native_function<LUA_NATIVE_CUTSCENE_IS_CUTSCENE_PLAYBACK_FLAG_SET>},
+		{"IS_CUTSCENE_PLAYING", native_function<LUA_NATIVE_CUTSCENE_IS_CUTSCENE_PLAYING>},
+		{"IS_MULTIHEAD_FADE_UP", native_function<LUA_NATIVE_CUTSCENE_IS_MULTIHEAD_FADE_UP>},
+		{"NETWORK_SET_MOCAP_CUTSCENE_CAN_BE_SKIPPED", native_function<LUA_NATIVE_CUTSCENE_NETWORK_SET_MOCAP_CUTSCENE_CAN_BE_SKIPPED>},
+		{"REGISTER_ENTITY_FOR_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_REGISTER_ENTITY_FOR_CUTSCENE>},
+		{"REMOVE_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_REMOVE_CUTSCENE>},
+		{"REMOVE_CUT_FILE", native_function<LUA_NATIVE_CUTSCENE_REMOVE_CUT_FILE>},
+		{"REQUEST_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_REQUEST_CUTSCENE>},
+		{"REQUEST_CUTSCENE_WITH_PLAYBACK_LIST", native_function<LUA_NATIVE_CUTSCENE_REQUEST_CUTSCENE_WITH_PLAYBACK_LIST>},
+		{"REQUEST_CUT_FILE", native_function<LUA_NATIVE_CUTSCENE_REQUEST_CUT_FILE>},
+		{"SET_CAN_DISPLAY_MINIMAP_DURING_CUTSCENE_THIS_UPDATE", native_function<LUA_NATIVE_CUTSCENE_SET_CAN_DISPLAY_MINIMAP_DURING_CUTSCENE_THIS_UPDATE>},
+		{"SET_CAR_GENERATORS_CAN_UPDATE_DURING_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_SET_CAR_GENERATORS_CAN_UPDATE_DURING_CUTSCENE>},
+		{"SET_CUTSCENE_CAN_BE_SKIPPED", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_CAN_BE_SKIPPED>},
+		{"SET_CUTSCENE_ENTITY_STREAMING_FLAGS", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_ENTITY_STREAMING_FLAGS>},
+		{"SET_CUTSCENE_FADE_VALUES", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_FADE_VALUES>},
+		{"SET_CUTSCENE_MULTIHEAD_FADE", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_MULTIHEAD_FADE>},
+		{"SET_CUTSCENE_MULTIHEAD_FADE_MANUAL", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_MULTIHEAD_FADE_MANUAL>},
+		{"SET_CUTSCENE_ORIGIN", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_ORIGIN>},
+		{"SET_CUTSCENE_ORIGIN_AND_ORIENTATION", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_ORIGIN_AND_ORIENTATION>},
+		{"SET_CUTSCENE_PED_COMPONENT_VARIATION", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_PED_COMPONENT_VARIATION>},
+		{"SET_CUTSCENE_PED_COMPONENT_VARIATION_FROM_PED", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_PED_COMPONENT_VARIATION_FROM_PED>},
+		{"SET_CUTSCENE_PED_PROP_VARIATION", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_PED_PROP_VARIATION>},
+		{"SET_CUTSCENE_TRIGGER_AREA", native_function<LUA_NATIVE_CUTSCENE_SET_CUTSCENE_TRIGGER_AREA>},
+		{"SET_PAD_CAN_SHAKE_DURING_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_SET_PAD_CAN_SHAKE_DURING_CUTSCENE>},
+		{"SET_SCRIPT_CAN_START_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_SET_SCRIPT_CAN_START_CUTSCENE>},
+		{"SET_VEHICLE_MODEL_PLAYER_WILL_EXIT_SCENE", native_function<LUA_NATIVE_CUTSCENE_SET_VEHICLE_MODEL_PLAYER_WILL_EXIT_SCENE>},
+		{"START_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_START_CUTSCENE>},
+		{"START_CUTSCENE_AT_COORDS", native_function<LUA_NATIVE_CUTSCENE_START_CUTSCENE_AT_COORDS>},
+		{"STOP_CUTSCENE", native_function<LUA_NATIVE_CUTSCENE_STOP_CUTSCENE>},
+		{"STOP_CUTSCENE_IMMEDIATELY", native_function<LUA_NATIVE_CUTSCENE_STOP_CUTSCENE_IMMEDIATELY>},
+		{"WAS_CUTSCENE_SKIPPED", native_function<LUA_NATIVE_CUTSCENE_WAS_CUTSCENE_SKIPPED>},
+	};
+
 	void init_native_binding_CUTSCENE(sol::state& L)
 	{
-		auto CUTSCENE = L["CUTSCENE"].get_or_create<sol::table>();
-		CUTSCENE.set_function("REQUEST_CUTSCENE", LUA_NATIVE_CUTSCENE_REQUEST_CUTSCENE);
-		CUTSCENE.set_function("REQUEST_CUTSCENE_WITH_PLAYBACK_LIST", LUA_NATIVE_CUTSCENE_REQUEST_CUTSCENE_WITH_PLAYBACK_LIST);
-		CUTSCENE.set_function("REMOVE_CUTSCENE", LUA_NATIVE_CUTSCENE_REMOVE_CUTSCENE);
-		CUTSCENE.set_function("HAS_CUTSCENE_LOADED", LUA_NATIVE_CUTSCENE_HAS_CUTSCENE_LOADED);
-		CUTSCENE.set_function("HAS_THIS_CUTSCENE_LOADED", LUA_NATIVE_CUTSCENE_HAS_THIS_CUTSCENE_LOADED);
-		CUTSCENE.set_function("SET_SCRIPT_CAN_START_CUTSCENE", LUA_NATIVE_CUTSCENE_SET_SCRIPT_CAN_START_CUTSCENE);
-		CUTSCENE.set_function("CAN_REQUEST_ASSETS_FOR_CUTSCENE_ENTITY", LUA_NATIVE_CUTSCENE_CAN_REQUEST_ASSETS_FOR_CUTSCENE_ENTITY);
-		CUTSCENE.set_function("IS_CUTSCENE_PLAYBACK_FLAG_SET", LUA_NATIVE_CUTSCENE_IS_CUTSCENE_PLAYBACK_FLAG_SET);
-		CUTSCENE.set_function("SET_CUTSCENE_ENTITY_STREAMING_FLAGS", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_ENTITY_STREAMING_FLAGS);
-		CUTSCENE.set_function("REQUEST_CUT_FILE", LUA_NATIVE_CUTSCENE_REQUEST_CUT_FILE);
-		CUTSCENE.set_function("HAS_CUT_FILE_LOADED", LUA_NATIVE_CUTSCENE_HAS_CUT_FILE_LOADED);
-		CUTSCENE.set_function("REMOVE_CUT_FILE", LUA_NATIVE_CUTSCENE_REMOVE_CUT_FILE);
-		CUTSCENE.set_function("GET_CUT_FILE_CONCAT_COUNT", LUA_NATIVE_CUTSCENE_GET_CUT_FILE_CONCAT_COUNT);
-		CUTSCENE.set_function("START_CUTSCENE", LUA_NATIVE_CUTSCENE_START_CUTSCENE);
-		CUTSCENE.set_function("START_CUTSCENE_AT_COORDS", LUA_NATIVE_CUTSCENE_START_CUTSCENE_AT_COORDS);
-		CUTSCENE.set_function("STOP_CUTSCENE", LUA_NATIVE_CUTSCENE_STOP_CUTSCENE);
-		CUTSCENE.set_function("STOP_CUTSCENE_IMMEDIATELY", LUA_NATIVE_CUTSCENE_STOP_CUTSCENE_IMMEDIATELY);
-		CUTSCENE.set_function("SET_CUTSCENE_ORIGIN", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_ORIGIN);
-		CUTSCENE.set_function("SET_CUTSCENE_ORIGIN_AND_ORIENTATION", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_ORIGIN_AND_ORIENTATION);
-		CUTSCENE.set_function("GET_CUTSCENE_TIME", LUA_NATIVE_CUTSCENE_GET_CUTSCENE_TIME);
-		CUTSCENE.set_function("GET_CUTSCENE_TOTAL_DURATION", LUA_NATIVE_CUTSCENE_GET_CUTSCENE_TOTAL_DURATION);
-		CUTSCENE.set_function("GET_CUTSCENE_END_TIME", LUA_NATIVE_CUTSCENE_GET_CUTSCENE_END_TIME);
-		CUTSCENE.set_function("GET_CUTSCENE_PLAY_DURATION", LUA_NATIVE_CUTSCENE_GET_CUTSCENE_PLAY_DURATION);
-		CUTSCENE.set_function("WAS_CUTSCENE_SKIPPED", LUA_NATIVE_CUTSCENE_WAS_CUTSCENE_SKIPPED);
-		CUTSCENE.set_function("HAS_CUTSCENE_FINISHED", LUA_NATIVE_CUTSCENE_HAS_CUTSCENE_FINISHED);
-		CUTSCENE.set_function("IS_CUTSCENE_ACTIVE", LUA_NATIVE_CUTSCENE_IS_CUTSCENE_ACTIVE);
-		CUTSCENE.set_function("IS_CUTSCENE_PLAYING", LUA_NATIVE_CUTSCENE_IS_CUTSCENE_PLAYING);
-		CUTSCENE.set_function("GET_CUTSCENE_SECTION_PLAYING", LUA_NATIVE_CUTSCENE_GET_CUTSCENE_SECTION_PLAYING);
-		CUTSCENE.set_function("GET_ENTITY_INDEX_OF_CUTSCENE_ENTITY", LUA_NATIVE_CUTSCENE_GET_ENTITY_INDEX_OF_CUTSCENE_ENTITY);
-		CUTSCENE.set_function("GET_CUTSCENE_CONCAT_SECTION_PLAYING", LUA_NATIVE_CUTSCENE_GET_CUTSCENE_CONCAT_SECTION_PLAYING);
-		CUTSCENE.set_function("IS_CUTSCENE_AUTHORIZED", LUA_NATIVE_CUTSCENE_IS_CUTSCENE_AUTHORIZED);
-		CUTSCENE.set_function("DOES_CUTSCENE_HANDLE_EXIST", LUA_NATIVE_CUTSCENE_DOES_CUTSCENE_HANDLE_EXIST);
-		CUTSCENE.set_function("REGISTER_ENTITY_FOR_CUTSCENE", LUA_NATIVE_CUTSCENE_REGISTER_ENTITY_FOR_CUTSCENE);
-		CUTSCENE.set_function("GET_ENTITY_INDEX_OF_REGISTERED_ENTITY", LUA_NATIVE_CUTSCENE_GET_ENTITY_INDEX_OF_REGISTERED_ENTITY);
-		CUTSCENE.set_function("SET_VEHICLE_MODEL_PLAYER_WILL_EXIT_SCENE", LUA_NATIVE_CUTSCENE_SET_VEHICLE_MODEL_PLAYER_WILL_EXIT_SCENE);
-		CUTSCENE.set_function("SET_CUTSCENE_TRIGGER_AREA", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_TRIGGER_AREA);
-		CUTSCENE.set_function("CAN_SET_ENTER_STATE_FOR_REGISTERED_ENTITY", LUA_NATIVE_CUTSCENE_CAN_SET_ENTER_STATE_FOR_REGISTERED_ENTITY);
-		CUTSCENE.set_function("CAN_SET_EXIT_STATE_FOR_REGISTERED_ENTITY", LUA_NATIVE_CUTSCENE_CAN_SET_EXIT_STATE_FOR_REGISTERED_ENTITY);
-		CUTSCENE.set_function("CAN_SET_EXIT_STATE_FOR_CAMERA", LUA_NATIVE_CUTSCENE_CAN_SET_EXIT_STATE_FOR_CAMERA);
-		CUTSCENE.set_function("SET_PAD_CAN_SHAKE_DURING_CUTSCENE", LUA_NATIVE_CUTSCENE_SET_PAD_CAN_SHAKE_DURING_CUTSCENE);
-		CUTSCENE.set_function("SET_CUTSCENE_FADE_VALUES", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_FADE_VALUES);
-		CUTSCENE.set_function("SET_CUTSCENE_MULTIHEAD_FADE", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_MULTIHEAD_FADE);
-		CUTSCENE.set_function("SET_CUTSCENE_MULTIHEAD_FADE_MANUAL", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_MULTIHEAD_FADE_MANUAL);
-		CUTSCENE.set_function("IS_MULTIHEAD_FADE_UP", LUA_NATIVE_CUTSCENE_IS_MULTIHEAD_FADE_UP);
-		CUTSCENE.set_function("NETWORK_SET_MOCAP_CUTSCENE_CAN_BE_SKIPPED", LUA_NATIVE_CUTSCENE_NETWORK_SET_MOCAP_CUTSCENE_CAN_BE_SKIPPED);
-		CUTSCENE.set_function("SET_CAR_GENERATORS_CAN_UPDATE_DURING_CUTSCENE", LUA_NATIVE_CUTSCENE_SET_CAR_GENERATORS_CAN_UPDATE_DURING_CUTSCENE);
-		CUTSCENE.set_function("CAN_USE_MOBILE_PHONE_DURING_CUTSCENE", LUA_NATIVE_CUTSCENE_CAN_USE_MOBILE_PHONE_DURING_CUTSCENE);
-		CUTSCENE.set_function("SET_CUTSCENE_CAN_BE_SKIPPED", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_CAN_BE_SKIPPED);
-		CUTSCENE.set_function("SET_CAN_DISPLAY_MINIMAP_DURING_CUTSCENE_THIS_UPDATE", LUA_NATIVE_CUTSCENE_SET_CAN_DISPLAY_MINIMAP_DURING_CUTSCENE_THIS_UPDATE);
-		CUTSCENE.set_function("SET_CUTSCENE_PED_COMPONENT_VARIATION", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_PED_COMPONENT_VARIATION);
-		CUTSCENE.set_function("SET_CUTSCENE_PED_COMPONENT_VARIATION_FROM_PED", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_PED_COMPONENT_VARIATION_FROM_PED);
-		CUTSCENE.set_function("DOES_CUTSCENE_ENTITY_EXIST", LUA_NATIVE_CUTSCENE_DOES_CUTSCENE_ENTITY_EXIST);
-		CUTSCENE.set_function("SET_CUTSCENE_PED_PROP_VARIATION", LUA_NATIVE_CUTSCENE_SET_CUTSCENE_PED_PROP_VARIATION);
-		CUTSCENE.set_function("HAS_CUTSCENE_CUT_THIS_FRAME", LUA_NATIVE_CUTSCENE_HAS_CUTSCENE_CUT_THIS_FRAME);
+		bind_namespace(L, "CUTSCENE", CUTSCENE_natives);
 	}
 }
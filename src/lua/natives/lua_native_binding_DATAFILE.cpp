@@ -331,65 +331,68 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry DATAFILE_natives[] = {
+		{"DATAARRAY_ADD_BOOL", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_ADD_BOOL>},
+		{"DATAARRAY_ADD_DICT", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_ADD_DICT>},
+		{"DATAARRAY_ADD_FLOAT", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_ADD_FLOAT>},
+		{"DATAARRAY_ADD_INT", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_ADD_INT>},
+		{"DATAARRAY_ADD_STRING", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_ADD_STRING>},
+		{"DATAARRAY_ADD_VECTOR", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_ADD_VECTOR>},
+		{"DATAARRAY_GET_BOOL", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_GET_BOOL>},
+		{"DATAARRAY_GET_COUNT", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_GET_COUNT>},
+		{"DATAARRAY_GET_DICT", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_GET_DICT>},
+		{"DATAARRAY_GET_FLOAT", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_GET_FLOAT>},
+		{"DATAARRAY_GET_INT", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_GET_INT>},
+		{"DATAARRAY_GET_STRING", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_GET_STRING>},
+		{"DATAARRAY_GET_TYPE", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_GET_TYPE>},
+		{"DATAARRAY_GET_VECTOR", native_function<LUA_NATIVE_DATAFILE_DATAARRAY_GET_VECTOR>},
+		{"DATADICT_CREATE_ARRAY", native_function<LUA_NATIVE_DATAFILE_DATADICT_CREATE_ARRAY>},
+		{"DATADICT_CREATE_DICT", native_function<LUA_NATIVE_DATAFILE_DATADICT_CREATE_DICT>},
+		{"DATADICT_GET_ARRAY", native_function<LUA_NATIVE_DATAFILE_DATADICT_GET_ARRAY>},
+		{"DATADICT_GET_BOOL", native_function<LUA_NATIVE_DATAFILE_DATADICT_GET_BOOL>},
+		{"DATADICT_GET_DICT", native_function<LUA_NATIVE_DATAFILE_DATADICT_GET_DICT>},
+		{"DATADICT_GET_FLOAT", native_function<LUA_NATIVE_DATAFILE_DATADICT_GET_FLOAT>},
+		{"DATADICT_GET_INT", native_function<LUA_NATIVE_DATAFILE_DATADICT_GET_INT>},
+		{"DATADICT_GET_STRING", native_function<LUA_NATIVE_DATAFILE_DATADICT_GET_STRING>},
+		{"DATADICT_GET_TYPE", native_function<LUA_NATIVE_DATAFILE_DATADICT_GET_TYPE>},
+		{"DATADICT_GET_VECTOR", native_function<LUA_NATIVE_DATAFILE_DATADICT_GET_VECTOR>},
+		{"DATADICT_SET_BOOL", native_function<LUA_NATIVE_DATAFILE_DATADICT_SET_BOOL>},
+		{"DATADICT_SET_FLOAT", native_function<LUA_NATIVE_DATAFILE_DATADICT_SET_FLOAT>},
+		{"DATADICT_SET_INT", native_function<LUA_NATIVE_DATAFILE_DATADICT_SET_INT>},
+		{"DATADICT_SET_STRING", native_function<LUA_NATIVE_DATAFILE_DATADICT_SET_STRING>},
+		{"DATADICT_SET_VECTOR", native_function<LUA_NATIVE_DATAFILE_DATADICT_SET_VECTOR>},
+		{"DATAFILE_CLEAR_WATCH_LIST", native_function<LUA_NATIVE_DATAFILE_DATAFILE_CLEAR_WATCH_LIST>},
+		{"DATAFILE_CREATE", native_function<LUA_NATIVE_DATAFILE_DATAFILE_CREATE>},
+		{"DATAFILE_DELETE", native_function<LUA_NATIVE_DATAFILE_DATAFILE_DELETE>},
+		{"DATAFILE_DELETE_FOR_ADDITIONAL_DATA_FILE", native_function<LUA_NATIVE_DATAFILE_DATAFILE_DELETE_FOR_ADDITIONAL_DATA_FILE>},
+		{"DATAFILE_DELETE_REQUESTED_FILE", native_function<LUA_NATIVE_DATAFILE_DATAFILE_DELETE_REQUESTED_FILE>},
+		{"DATAFILE_FLUSH_MISSION_HEADER", native_function<LUA_NATIVE_DATAFILE_DATAFILE_FLUSH_MISSION_HEADER>},
+		{"DATAFILE_GET_FILE_DICT", native_function<LUA_NATIVE_DATAFILE_DATAFILE_GET_FILE_DICT>},
+		{"DATAFILE_GET_FILE_DICT_FOR_ADDITIONAL_DATA_FILE", native_function<LUA_NATIVE_DATAFILE_DATAFILE_GET_FILE_DICT_FOR_ADDITIONAL_DATA_FILE>},
+		{"DATAFILE_HAS_LOADED_FILE_DATA", native_function<LUA_NATIVE_DATAFILE_DATAFILE_HAS_LOADED_FILE_DATA>},
+		{"DATAFILE_HAS_VALID_FILE_DATA", native_function<LUA_NATIVE_DATAFILE_DATAFILE_HAS_VALID_FILE_DATA>},
+		{"DATAFILE_IS_SAVE_PENDING", native_function<LUA_NATIVE_DATAFILE_DATAFILE_IS_SAVE_PENDING>},
+		{"DATAFILE_IS_VALID_REQUEST_ID", native_function<LUA_NATIVE_DATAFILE_DATAFILE_IS_VALID_REQUEST_ID>},
+		{"DATAFILE_LOAD_OFFLINE_UGC", native_function<LUA_NATIVE_DATAFILE_DATAFILE_LOAD_OFFLINE_UGC>},
+		{"DATAFILE_LOAD_OFFLINE_UGC_FOR_ADDITIONAL_DATA_FILE", native_function<LUA_NATIVE_DATAFILE_DATAFILE_LOAD_OFFLINE_UGC_FOR_ADDITIONAL_DATA_FILE>},
+		{"DATAFILE_SELECT_ACTIVE_FILE", native_function<LUA_NATIVE_DATAFILE_DATAFILE_SELECT_ACTIVE_FILE>},
+		{"DATAFILE_SELECT_CREATOR_STATS", native_function<LUA_NATIVE_DATAFILE_DATAFILE_SELECT_CREATOR_STATS>},
+		{"DATAFILE_SELECT_UGC_DATA", native_function<LUA_NATIVE_DATAFILE_DATAFILE_SELECT_UGC_DATA>},
+		{"DATAFILE_SELECT_UGC_PLAYER_DATA", native_function<LUA_NATIVE_DATAFILE_DATAFILE_SELECT_UGC_PLAYER_DATA>},
+		{"DATAFILE_SELECT_UGC_STATS", native_function<LUA_NATIVE_DATAFILE_DATAFILE_SELECT_UGC_STATS>},
+		{"DATAFILE_START_SAVE_TO_CLOUD", native_function<LUA_NATIVE_DATAFILE_DATAFILE_START_SAVE_TO_CLOUD>},
+		{"DATAFILE_STORE_MISSION_HEADER", native_function<LUA_NATIVE_DATAFILE_DATAFILE_STORE_MISSION_HEADER>},
+		{"DATAFILE_UPDATE_SAVE_TO_CLOUD", native_function<LUA_NATIVE_DATAFILE_DATAFILE_UPDATE_SAVE_TO_CLOUD>},
+		{"DATAFILE_WATCH_REQUEST_ID", native_function<LUA_NATIVE_DATAFILE_DATAFILE_WATCH_REQUEST_ID>},
+		{"UGC_CREATE_CONTENT", native_function<LUA_NATIVE_DATAFILE_UGC_CREATE_CONTENT>},
+		{"UGC_CREATE_MISSION", native_function<LUA_NATIVE_DATAFILE_UGC_CREATE_MISSION>},
+		{"UGC_SET_PLAYER_DATA", native_function<LUA_NATIVE_DATAFILE_UGC_SET_PLAYER_DATA>},
+		{"UGC_UPDATE_CONTENT", native_function<LUA_NATIVE_DATAFILE_UGC_UPDATE_CONTENT>},
+		{"UGC_UPDATE_MISSION", native_function<LUA_NATIVE_DATAFILE_UGC_UPDATE_MISSION>},
+	};
+
 	void init_native_binding_DATAFILE(sol::state& L)
 	{
-		auto DATAFILE = L["DATAFILE"].get_or_create<sol::table>();
-		DATAFILE.set_function("DATAFILE_WATCH_REQUEST_ID", LUA_NATIVE_DATAFILE_DATAFILE_WATCH_REQUEST_ID);
-		DATAFILE.set_function("DATAFILE_CLEAR_WATCH_LIST", LUA_NATIVE_DATAFILE_DATAFILE_CLEAR_WATCH_LIST);
-		DATAFILE.set_function("DATAFILE_IS_VALID_REQUEST_ID", LUA_NATIVE_DATAFILE_DATAFILE_IS_VALID_REQUEST_ID);
-		DATAFILE.set_function("DATAFILE_HAS_LOADED_FILE_DATA", LUA_NATIVE_DATAFILE_DATAFILE_HAS_LOADED_FILE_DATA);
-		DATAFILE.set_function("DATAFILE_HAS_VALID_FILE_DATA", LUA_NATIVE_DATAFILE_DATAFILE_HAS_VALID_FILE_DATA);
-		DATAFILE.set_function("DATAFILE_SELECT_ACTIVE_FILE", LUA_NATIVE_DATAFILE_DATAFILE_SELECT_ACTIVE_FILE);
-		DATAFILE.set_function("DATAFILE_DELETE_REQUESTED_FILE", LUA_NATIVE_DATAFILE_DATAFILE_DELETE_REQUESTED_FILE);
-		DATAFILE.set_function("UGC_CREATE_CONTENT", LUA_NATIVE_DATAFILE_UGC_CREATE_CONTENT);
-		DATAFILE.set_function("UGC_CREATE_MISSION", LUA_NATIVE_DATAFILE_UGC_CREATE_MISSION);
-		DATAFILE.set_function("UGC_UPDATE_CONTENT", LUA_NATIVE_DATAFILE_UGC_UPDATE_CONTENT);
-		DATAFILE.set_function("UGC_UPDATE_MISSION", LUA_NATIVE_DATAFILE_UGC_UPDATE_MISSION);
-		DATAFILE.set_function("UGC_SET_PLAYER_DATA", LUA_NATIVE_DATAFILE_UGC_SET_PLAYER_DATA);
-		DATAFILE.set_function("DATAFILE_SELECT_UGC_DATA", LUA_NATIVE_DATAFILE_DATAFILE_SELECT_UGC_DATA);
-		DATAFILE.set_function("DATAFILE_SELECT_UGC_STATS", LUA_NATIVE_DATAFILE_DATAFILE_SELECT_UGC_STATS);
-		DATAFILE.set_function("DATAFILE_SELECT_UGC_PLAYER_DATA", LUA_NATIVE_DATAFILE_DATAFILE_SELECT_UGC_PLAYER_DATA);
-		DATAFILE.set_function("DATAFILE_SELECT_CREATOR_STATS", LUA_NATIVE_DATAFILE_DATAFILE_SELECT_CREATOR_STATS);
-		DATAFILE.set_function("DATAFILE_LOAD_OFFLINE_UGC", LUA_NATIVE_DATAFILE_DATAFILE_LOAD_OFFLINE_UGC);
-		DATAFILE.set_function("DATAFILE_CREATE", LUA_NATIVE_DATAFILE_DATAFILE_CREATE);
-		DATAFILE.set_function("DATAFILE_DELETE", LUA_NATIVE_DATAFILE_DATAFILE_DELETE);
-		DATAFILE.set_function("DATAFILE_STORE_MISSION_HEADER", LUA_NATIVE_DATAFILE_DATAFILE_STORE_MISSION_HEADER);
-		DATAFILE.set_function("DATAFILE_FLUSH_MISSION_HEADER", LUA_NATIVE_DATAFILE_DATAFILE_FLUSH_MISSION_HEADER);
-		DATAFILE.set_function("DATAFILE_GET_FILE_DICT", LUA_NATIVE_DATAFILE_DATAFILE_GET_FILE_DICT);
-		DATAFILE.set_function("DATAFILE_START_SAVE_TO_CLOUD", LUA_NATIVE_DATAFILE_DATAFILE_START_SAVE_TO_CLOUD);
-		DATAFILE.set_function("DATAFILE_UPDATE_SAVE_TO_CLOUD", LUA_NATIVE_DATAFILE_DATAFILE_UPDATE_SAVE_TO_CLOUD);
-		DATAFILE.set_function("DATAFILE_IS_SAVE_PENDING", LUA_NATIVE_DATAFILE_DATAFILE_IS_SAVE_PENDING);
-		DATAFILE.set_function("DATAFILE_LOAD_OFFLINE_UGC_FOR_ADDITIONAL_DATA_FILE", LUA_NATIVE_DATAFILE_DATAFILE_LOAD_OFFLINE_UGC_FOR_ADDITIONAL_DATA_FILE);
-		DATAFILE.set_function("DATAFILE_DELETE_FOR_ADDITIONAL_DATA_FILE", LUA_NATIVE_DATAFILE_DATAFILE_DELETE_FOR_ADDITIONAL_DATA_FILE);
-		DATAFILE.set_function("DATAFILE_GET_FILE_DICT_FOR_ADDITIONAL_DATA_FILE", LUA_NATIVE_DATAFILE_DATAFILE_GET_FILE_DICT_FOR_ADDITIONAL_DATA_FILE);
-		DATAFILE.set_function("DATADICT_SET_BOOL", LUA_NATIVE_DATAFILE_DATADICT_SET_BOOL);
-		DATAFILE.set_function("DATADICT_SET_INT", LUA_NATIVE_DATAFILE_DATADICT_SET_INT);
-		DATAFILE.set_function("DATADICT_SET_FLOAT", LUA_NATIVE_DATAFILE_DATADICT_SET_FLOAT);
-		DATAFILE.set_function("DATADICT_SET_STRING", LUA_NATIVE_DATAFILE_DATADICT_SET_STRING);
-		DATAFILE.set_function("DATADICT_SET_VECTOR", LUA_NATIVE_DATAFILE_DATADICT_SET_VECTOR);
-		DATAFILE.set_function("DATADICT_CREATE_DICT", LUA_NATIVE_DATAFILE_DATADICT_CREATE_DICT);
-		DATAFILE.set_function("DATADICT_CREATE_ARRAY", LUA_NATIVE_DATAFILE_DATADICT_CREATE_ARRAY);
-		DATAFILE.set_function("DATADICT_GET_BOOL", LUA_NATIVE_DATAFILE_DATADICT_GET_BOOL);
-		DATAFILE.set_function("DATADICT_GET_INT", LUA_NATIVE_DATAFILE_DATADICT_GET_INT);
-		DATAFILE.set_function("DATADICT_GET_FLOAT", LUA_NATIVE_DATAFILE_DATADICT_GET_FLOAT);
-		DATAFILE.set_function("DATADICT_GET_STRING", LUA_NATIVE_DATAFILE_DATADICT_GET_STRING);
-		DATAFILE.set_function("DATADICT_GET_VECTOR", LUA_NATIVE_DATAFILE_DATADICT_GET_VECTOR);
-		DATAFILE.set_function("DATADICT_GET_DICT", LUA_NATIVE_DATAFILE_DATADICT_GET_DICT);
-		DATAFILE.set_function("DATADICT_GET_ARRAY", LUA_NATIVE_DATAFILE_DATADICT_GET_ARRAY);
-		DATAFILE.set_function("DATADICT_GET_TYPE", LUA_NATIVE_DATAFILE_DATADICT_GET_TYPE);
-		DATAFILE.set_function("DATAARRAY_ADD_BOOL", LUA_NATIVE_DATAFILE_DATAARRAY_ADD_BOOL);
-		DATAFILE.set_function("DATAARRAY_ADD_INT", LUA_NATIVE_DATAFILE_DATAARRAY_ADD_INT);
-		DATAFILE.set_function("DATAARRAY_ADD_FLOAT", LUA_NATIVE_DATAFILE_DATAARRAY_ADD_FLOAT);
-		DATAFILE.set_function("DATAARRAY_ADD_STRING", LUA_NATIVE_DATAFILE_DATAARRAY_ADD_STRING);
-		DATAFILE.set_function("DATAARRAY_ADD_VECTOR", LUA_NATIVE_DATAFILE_DATAARRAY_ADD_VECTOR);
-		DATAFILE.set_function("DATAARRAY_ADD_DICT", LUA_NATIVE_DATAFILE_DATAARRAY_ADD_DICT);
-		DATAFILE.set_function("DATAARRAY_GET_BOOL", LUA_NATIVE_DATAFILE_DATAARRAY_GET_BOOL);
-		DATAFILE.set_function("DATAARRAY_GET_INT", LUA_NATIVE_DATAFILE_DATAARRAY_GET_INT);
-		DATAFILE.set_function("DATAARRAY_GET_FLOAT", LUA_NATIVE_DATAFILE_DATAARRAY_GET_FLOAT);
-		DATAFILE.set_function("DATAARRAY_GET_STRING", LUA_NATIVE_DATAFILE_DATAARRAY_GET_STRING);
-		DATAFILE.set_function("DATAARRAY_GET_VECTOR", LUA_NATIVE_DATAFILE_DATAARRAY_GET_VECTOR);
-		DATAFILE.set_function("DATAARRAY_GET_DICT", LUA_NATIVE_DATAFILE_DATAARRAY_GET_DICT);
-		DATAFILE.set_function("DATAARRAY_GET_COUNT", LUA_NATIVE_DATAFILE_DATAARRAY_GET_COUNT);
-		DATAFILE.set_function("DATAARRAY_GET_TYPE", LUA_NATIVE_DATAFILE_DATAARRAY_GET_TYPE);
+		bind_namespace(L, "DATAFILE", DATAFILE_natives);
 	}
 }
@@ -73,20 +73,23 @@ namespace lua::native
 		DECORATOR::DECOR_REGISTER_LOCK();
 	}
 
+	static constexpr native_entry DECORATOR_natives[] = {
+		{"DECOR_EXIST_ON", native_function<LUA_NATIVE_DECORATOR_DECOR_EXIST_ON>},
+		{"DECOR_GET_BOOL", native_function<LUA_NATIVE_DECORATOR_DECOR_GET_BOOL>},
+		{"DECOR_GET_FLOAT", native_function<LUA_NATIVE_DECORATOR_DECOR_GET_FLOAT>},
+		{"DECOR_GET_INT", native_function<LUA_NATIVE_DECORATOR_DECOR_GET_INT>},
+		{"DECOR_IS_REGISTERED_AS_TYPE", native_function<LUA_NATIVE_DECORATOR_DECOR_IS_REGISTERED_AS_TYPE>},
+		{"DECOR_REGISTER", native_function<LUA_NATIVE_DECORATOR_DECOR_REGISTER>},
+		{"DECOR_REGISTER_LOCK", native_function<LUA_NATIVE_DECORATOR_DECOR_REGISTER_LOCK>},
+		{"DECOR_REMOVE", native_function<LUA_NATIVE_DECORATOR_DECOR_REMOVE>},
+		{"DECOR_SET_BOOL", native_function<LUA_NATIVE_DECORATOR_DECOR_SET_BOOL>},
+		{"DECOR_SET_FLOAT", native_function<LUA_NATIVE_DECORATOR_DECOR_SET_FLOAT>},
+		{"DECOR_SET_INT", native_function<LUA_NATIVE_DECORATOR_DECOR_SET_INT>},
+		{"DECOR_SET_TIME", native_function<LUA_NATIVE_DECORATOR_DECOR_SET_TIME>},
+	};
+
 	void init_native_binding_DECORATOR(sol::state& L)
 	{
-		auto DECORATOR = L["DECORATOR"].get_or_create<sol::table>();
-		DECORATOR.set_function("DECOR_SET_TIME", LUA_NATIVE_DECORATOR_DECOR_SET_TIME);
-		DECORATOR.set_function("DECOR_SET_BOOL", LUA_NATIVE_DECORATOR_DECOR_SET_BOOL);
-		DECORATOR.set_function("DECOR_SET_FLOAT", LUA_NATIVE_DECORATOR_DECOR_SET_FLOAT);
-		DECORATOR.set_function("DECOR_SET_INT", LUA_NATIVE_DECORATOR_DECOR_SET_INT);
-		DECORATOR.set_function("DECOR_GET_BOOL", LUA_NATIVE_DECORATOR_DECOR_GET_BOOL);
-		DECORATOR.set_function("DECOR_GET_FLOAT", LUA_NATIVE_DECORATOR_DECOR_GET_FLOAT);
-		DECORATOR.set_function("DECOR_GET_INT", LUA_NATIVE_DECORATOR_DECOR_GET_INT);
-		DECORATOR.set_function("DECOR_EXIST_ON", LUA_NATIVE_DECORATOR_DECOR_EXIST_ON);
-		DECORATOR.set_function("DECOR_REMOVE", LUA_NATIVE_DECORATOR_DECOR_REMOVE);
-		DECORATOR.set_function("DECOR_REGISTER", LUA_NATIVE_DECORATOR_DECOR_REGISTER);
-		DECORATOR.set_function("DECOR_IS_REGISTERED_AS_TYPE", LUA_NATIVE_DECORATOR_DECOR_IS_REGISTERED_AS_TYPE);
-		DECORATOR.set_function("DECOR_REGISTER_LOCK", LUA_NATIVE_DECORATOR_DECOR_REGISTER_LOCK);
+		bind_namespace(L, "DECORATOR", DECORATOR_natives);
 	}
 }
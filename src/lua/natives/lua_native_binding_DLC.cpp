@@ -70,19 +70,22 @@ namespace lua::native
 		DLC::ON_ENTER_MP();
 	}
 
+	static constexpr native_entry DLC_natives[] = {
+		{"ARE_ANY_CCS_PENDING", native_function<LUA_NATIVE_DLC_ARE_ANY_CCS_PENDING>},
+		{"DLC_CHECK_CLOUD_DATA_CORRECT", native_function<LUA_NATIVE_DLC_DLC_CHECK_CLOUD_DATA_CORRECT>},
+		{"DLC_CHECK_COMPAT_PACK_CONFIGURATION", native_function<LUA_NATIVE_DLC_DLC_CHECK_COMPAT_PACK_CONFIGURATION>},
+		{"GET_EVER_HAD_BAD_PACK_ORDER", native_function<LUA_NATIVE_DLC_GET_EVER_HAD_BAD_PACK_ORDER>},
+		{"GET_EXTRACONTENT_CLOUD_RESULT", native_function<LUA_NATIVE_DLC_GET_EXTRACONTENT_CLOUD_RESULT>},
+		{"GET_IS_INITIAL_LOADING_SCREEN_ACTIVE", native_function<LUA_NATIVE_DLC_GET_IS_INITIAL_LOADING_SCREEN_ACTIVE>},
+		{"GET_IS_LOADING_SCREEN_ACTIVE", native_function<LUA_NATIVE_DLC_GET_IS_LOADING_SCREEN_ACTIVE>},
+		{"HAS_CLOUD_REQUESTS_FINISHED", native_function<LUA_NATIVE_DLC_HAS_CLOUD_REQUESTS_FINISHED>},
+		{"IS_DLC_PRESENT", native_function<LUA_NATIVE_DLC_IS_DLC_PRESENT>},
+		{"ON_ENTER_MP", native_function<LUA_NATIVE_DLC_ON_ENTER_MP>},
+		{"ON_ENTER_SP", native_function<LUA_NATIVE_DLC_ON_ENTER_SP>},
+	};
+
 	void init_native_binding_DLC(sol::state& L)
 	{
-		auto DLC = L["DLC"].get_or_create<sol::table>();
-		DLC.set_function("ARE_ANY_CCS_PENDING", LUA_NATIVE_DLC_ARE_ANY_CCS_PENDING);
-		DLC.set_function("IS_DLC_PRESENT", LUA_NATIVE_DLC_IS_DLC_PRESENT);
-		DLC.set_function("DLC_CHECK_CLOUD_DATA_CORRECT", LUA_NATIVE_DLC_DLC_CHECK_CLOUD_DATA_CORRECT);
-		DLC.set_function("GET_EXTRACONTENT_CLOUD_RESULT", LUA_NATIVE_DLC_GET_EXTRACONTENT_CLOUD_RESULT);
-		DLC.set_function("DLC_CHECK_COMPAT_PACK_CONFIGURATION", LUA_NATIVE_DLC_DLC_CHECK_COMPAT_PACK_CONFIGURATION);
-		DLC.set_function("GET_EVER_HAD_BAD_PACK_ORDER", LUA_NATIVE_DLC_GET_EVER_HAD_BAD_PACK_ORDER);
-		DLC.set_function("GET_IS_LOADING_SCREEN_ACTIVE", LUA_NATIVE_DLC_GET_IS_LOADING_SCREEN_ACTIVE);
-		DLC.set_function("GET_IS_INITIAL_LOADING_SCREEN_ACTIVE", LUA_NATIVE_DLC_GET_IS_INITIAL_LOADING_SCREEN_ACTIVE);
-		DLC.set_function("HAS_CLOUD_REQUESTS_FINISHED", LUA_NATIVE_DLC_HAS_CLOUD_REQUESTS_FINISHED);
-		DLC.set_function("ON_ENTER_SP", LUA_NATIVE_DLC_ON_ENTER_SP);
-		DLC.set_function("ON_ENTER_MP", LUA_NATIVE_DLC_ON_ENTER_MP);
+		bind_namespace(L, "DLC", DLC_natives);
 	}
 }
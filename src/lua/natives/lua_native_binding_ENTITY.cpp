@@ -1080,196 +1080,199 @@ namespace lua::native
 		ENTITY::SET_PICK_UP_BY_CARGOBOB_DISABLED(entity, toggle);
 	}
 
+	static constexpr native_entry ENTITY_natives[] = {
+		{"APPLY_FORCE_TO_ENTITY", native_function<LUA_NATIVE_ENTITY_APPLY_FORCE_TO_ENTITY>},
+		{"APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS", native_function<LUA_NATIVE_ENTITY_APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS>},
+		{"ATTACH_ENTITY_BONE_TO_ENTITY_BONE", native_function<LUA_NATIVE_ENTITY_ATTACH_ENTITY_BONE_TO_ENTITY_BONE>},
+		{"ATTACH_ENTITY_BONE_TO_ENTITY_BONE_Y_FORWARD", native_function<LUA_NATIVE_ENTITY_ATTACH_ENTITY_BONE_TO_ENTITY_BONE_Y_FORWARD>},
+		{"ATTACH_ENTITY_TO_ENTITY", native_function<LUA_NATIVE_ENTITY_ATTACH_ENTITY_TO_ENTITY>},
+		{"ATTACH_ENTITY_TO_ENTITY_PHYSICALLY", native_function<LUA_NATIVE_ENTITY_ATTACH_ENTITY_TO_ENTITY_PHYSICALLY>},
+		{"ATTACH_ENTITY_TO_ENTITY_PHYSICALLY_OVERRIDE_INVERSE_MASS", native_function<LUA_NATIVE_ENTITY_ATTACH_ENTITY_TO_ENTITY_PHYSICALLY_OVERRIDE_INVERSE_MASS>},
+		{"CLEAR_ENTITY_LAST_DAMAGE_ENTITY", native_function<LUA_NATIVE_ENTITY_CLEAR_ENTITY_LAST_DAMAGE_ENTITY>},
+		{"CREATE_FORCED_OBJECT", native_function<LUA_NATIVE_ENTITY_CREATE_FORCED_OBJECT>},
+		{"CREATE_MODEL_HIDE", native_function<LUA_NATIVE_ENTITY_CREATE_MODEL_HIDE>},
+		{"CREATE_MODEL_HIDE_EXCLUDING_SCRIPT_OBJECTS", native_function<LUA_NATIVE_ENTITY_CREATE_MODEL_HIDE_EXCLUDING_SCRIPT_OBJECTS>},
+		{"CREATE_MODEL_SWAP", native_function<LUA_NATIVE_ENTITY_CREATE_MODEL_SWAP>},
+		{"DELETE_ENTITY", native_function<LUA_NATIVE_ENTITY_DELETE_ENTITY>},
+		{"DETACH_ENTITY", native_function<LUA_NATIVE_ENTITY_DETACH_ENTITY>},
+		{"DOES_ENTITY_BELONG_TO_THIS_SCRIPT", native_function<LUA_NATIVE_ENTITY_DOES_ENTITY_BELONG_TO_THIS_SCRIPT>},
+		{"DOES_ENTITY_EXIST", native_function<LUA_NATIVE_ENTITY_DOES_ENTITY_EXIST>},
+		{"DOES_ENTITY_HAVE_ANIM_DIRECTOR", native_function<LUA_NATIVE_ENTITY_DOES_ENTITY_HAVE_ANIM_DIRECTOR>},
+		{"DOES_ENTITY_HAVE_DRAWABLE", native_function<LUA_NATIVE_ENTITY_DOES_ENTITY_HAVE_DRAWABLE>},
+		{"DOES_ENTITY_HAVE_PHYSICS", native_function<LUA_NATIVE_ENTITY_DOES_ENTITY_HAVE_PHYSICS>},
+		{"DOES_ENTITY_HAVE_SKELETON", native_function<LUA_NATIVE_ENTITY_DOES_ENTITY_HAVE_SKELETON>},
+		{"ENABLE_ENTITY_BULLET_COLLISION", native_function<LUA_NATIVE_ENTITY_ENABLE_ENTITY_BULLET_COLLISION>},
+		{"FIND_ANIM_EVENT_PHASE", native_function<LUA_NATIVE_ENTITY_FIND_ANIM_EVENT_PHASE>},
+		{"FORCE_ENTITY_AI_AND_ANIMATION_UPDATE", native_function<LUA_NATIVE_ENTITY_FORCE_ENTITY_AI_AND_ANIMATION_UPDATE>},
+		{"FREEZE_ENTITY_POSITION", native_function<LUA_NATIVE_ENTITY_FREEZE_ENTITY_POSITION>},
+		{"GET_ANIM_DURATION", native_function<LUA_NATIVE_ENTITY_GET_ANIM_DURATION>},
+		{"GET_COLLISION_NORMAL_OF_LAST_HIT_FOR_ENTITY", native_function<LUA_NATIVE_ENTITY_GET_COLLISION_NORMAL_OF_LAST_HIT_FOR_ENTITY>},
+		{"GET_ENTITY_ALPHA", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_ALPHA>},
+		{"GET_ENTITY_ANIM_CURRENT_TIME", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_ANIM_CURRENT_TIME>},
+		{"GET_ENTITY_ANIM_TOTAL_TIME", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_ANIM_TOTAL_TIME>},
+		{"GET_ENTITY_ATTACHED_TO", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_ATTACHED_TO>},
+		{"GET_ENTITY_BONE_COUNT", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_BONE_COUNT>},
+		{"GET_ENTITY_BONE_INDEX_BY_NAME", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_BONE_INDEX_BY_NAME>},
+		{"GET_ENTITY_BONE_OBJECT_POSTION", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_BONE_OBJECT_POSTION>},
+		{"GET_ENTITY_BONE_OBJECT_ROTATION", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_BONE_OBJECT_ROTATION>},
+		{"GET_ENTITY_BONE_POSTION", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_BONE_POSTION>},
+		{"GET_ENTITY_BONE_ROTATION", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_BONE_ROTATION>},
+		{"GET_ENTITY_CAN_BE_DAMAGED", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_CAN_BE_DAMAGED>},
+		{"GET_ENTITY_COLLISION_DISABLED", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_COLLISION_DISABLED>},
+		{"GET_ENTITY_COORDS", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_COORDS>},
+		{"GET_ENTITY_FORWARD_VECTOR", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_FORWARD_VECTOR>},
+		{"GET_ENTITY_FORWARD_X", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_FORWARD_X>},
+		{"GET_ENTITY_FORWARD_Y", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_FORWARD_Y>},
+		{"GET_ENTITY_HEADING", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_HEADING>},
+		{"GET_ENTITY_HEADING_FROM_EULERS", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_HEADING_FROM_EULERS>},
+		{"GET_ENTITY_HEALTH", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_HEALTH>},
+		{"GET_ENTITY_HEIGHT", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_HEIGHT>},
+		{"GET_ENTITY_HEIGHT_ABOVE_GROUND", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_HEIGHT_ABOVE_GROUND>},
+		{"GET_ENTITY_LOD_DIST", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_LOD_DIST>},
+		{"GET_ENTITY_MATRIX", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_MATRIX>},
+		{"GET_ENTITY_MAX_HEALTH", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_MAX_HEALTH>},
+		{"GET_ENTITY_MODEL", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_MODEL>},
+		{"GET_ENTITY_OF_TYPE_ATTACHED_TO_ENTITY", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_OF_TYPE_ATTACHED_TO_ENTITY>},
+		{"GET_ENTITY_PITCH", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_PITCH>},
+		{"GET_ENTITY_POPULATION_TYPE", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_POPULATION_TYPE>},
+		{"GET_ENTITY_PROOFS", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_PROOFS>},
+		{"GET_ENTITY_QUATERNION", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_QUATERNION>},
+		{"GET_ENTITY_ROLL", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_ROLL>},
+		{"GET_ENTITY_ROTATION", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_ROTATION>},
+		{"GET_ENTITY_ROTATION_VELOCITY", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_ROTATION_VELOCITY>},
+		{"GET_ENTITY_SCRIPT", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_SCRIPT>},
+		{"GET_ENTITY_SPEED", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_SPEED>},
+		{"GET_ENTITY_SPEED_VECTOR", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_SPEED_VECTOR>},
+		{"GET_ENTITY_SUBMERGED_LEVEL", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_SUBMERGED_LEVEL>},
+		{"GET_ENTITY_TYPE", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_TYPE>},
+		{"GET_ENTITY_UPRIGHT_VALUE", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_UPRIGHT_VALUE>},
+		{"GET_ENTITY_VELOCITY", native_function<LUA_NATIVE_ENTITY_GET_ENTITY_VELOCITY>},
+		{"GET_LAST_ENTITY_HIT_BY_ENTITY_", native_function<LUA_NATIVE_ENTITY_GET_LAST_ENTITY_HIT_BY_ENTITY_>},
+		{"GET_LAST_MATERIAL_HIT_BY_ENTITY", native_function<LUA_NATIVE_ENTITY_GET_LAST_MATERIAL_HIT_BY_ENTITY>},
+		{"GET_NEAREST_PARTICIPANT_TO_ENTITY", native_function<LUA_NATIVE_ENTITY_GET_NEAREST_PARTICIPANT_TO_ENTITY>},
+		{"GET_NEAREST_PLAYER_TO_ENTITY", native_function<LUA_NATIVE_ENTITY_GET_NEAREST_PLAYER_TO_ENTITY>},
+		{"GET_NEAREST_PLAYER_TO_ENTITY_ON_TEAM", native_function<LUA_NATIVE_ENTITY_GET_NEAREST_PLAYER_TO_ENTITY_ON_TEAM>},
+		{"GET_OBJECT_INDEX_FROM_ENTITY_INDEX", native_function<LUA_NATIVE_ENTITY_GET_OBJECT_INDEX_FROM_ENTITY_INDEX>},
+		{"GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS", native_function<LUA_NATIVE_ENTITY_GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS>},
+		{"GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS", native_function<LUA_NATIVE_ENTITY_GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS>},
+		{"GET_PED_INDEX_FROM_ENTITY_INDEX", native_function<LUA_NATIVE_ENTITY_GET_PED_INDEX_FROM_ENTITY_INDEX>},
+		{"GET_VEHICLE_INDEX_FROM_ENTITY_INDEX", native_function<LUA_NATIVE_ENTITY_GET_VEHICLE_INDEX_FROM_ENTITY_INDEX>},
+		{"GET_WORLD_POSITION_OF_ENTITY_BONE", native_function<LUA_NATIVE_ENTITY_GET_WORLD_POSITION_OF_ENTITY_BONE>},
+		{"HAS_ANIM_EVENT_FIRED", native_function<LUA_NATIVE_ENTITY_HAS_ANIM_EVENT_FIRED>},
+		{"HAS_COLLISION_LOADED_AROUND_ENTITY", native_function<LUA_NATIVE_ENTITY_HAS_COLLISION_LOADED_AROUND_ENTITY>},
+		{"HAS_ENTITY_ANIM_FINISHED", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_ANIM_FINISHED>},
+		{"HAS_ENTITY_BEEN_DAMAGED_BY_ANY_OBJECT", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_BEEN_DAMAGED_BY_ANY_OBJECT>},
+		{"HAS_ENTITY_BEEN_DAMAGED_BY_ANY_PED", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_BEEN_DAMAGED_BY_ANY_PED>},
+		{"HAS_ENTITY_BEEN_DAMAGED_BY_ANY_VEHICLE", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_BEEN_DAMAGED_BY_ANY_VEHICLE>},
+		{"HAS_ENTITY_BEEN_DAMAGED_BY_ENTITY", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_BEEN_DAMAGED_BY_ENTITY>},
+		{"HAS_ENTITY_CLEAR_LOS_TO_ENTITY", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_CLEAR_LOS_TO_ENTITY>},
+		{"HAS_ENTITY_CLEAR_LOS_TO_ENTITY_ADJUST_FOR_COVER", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_CLEAR_LOS_TO_ENTITY_ADJUST_FOR_COVER>},
+		{"HAS_ENTITY_CLEAR_LOS_TO_ENTITY_IN_FRONT", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_CLEAR_LOS_TO_ENTITY_IN_FRONT>},
+		{"HAS_ENTITY_COLLIDED_WITH_ANYTHING", native_function<LUA_NATIVE_ENTITY_HAS_ENTITY_COLLIDED_WITH_ANYTHING>},
+		{"IS_AN_ENTITY", native_function<LUA_NATIVE_ENTITY_IS_AN_ENTITY>},
+		{"IS_ENTITY_AN_OBJECT", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_AN_OBJECT>},
+		{"IS_ENTITY_ATTACHED", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED>},
+		{"IS_ENTITY_ATTACHED_TO_ANY_OBJECT", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED_TO_ANY_OBJECT>},
+		{"IS_ENTITY_ATTACHED_TO_ANY_PED", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED_TO_ANY_PED>},
+		{"IS_ENTITY_ATTACHED_TO_ANY_VEHICLE", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED_TO_ANY_VEHICLE>},
+		{"IS_ENTITY_ATTACHED_TO_ENTITY", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED_TO_ENTITY>},
+		{"IS_ENTITY_AT_COORD", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_AT_COORD>},
+		{"IS_ENTITY_AT_ENTITY", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_AT_ENTITY>},
+		{"IS_ENTITY_A_MISSION_ENTITY", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_A_MISSION_ENTITY>},
+		{"IS_ENTITY_A_PED", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_A_PED>},
+		{"IS_ENTITY_A_VEHICLE", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_A_VEHICLE>},
+		{"IS_ENTITY_DEAD", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_DEAD>},
+		{"IS_ENTITY_IN_AIR", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_IN_AIR>},
+		{"IS_ENTITY_IN_ANGLED_AREA", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_IN_ANGLED_AREA>},
+		{"IS_ENTITY_IN_AREA", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_IN_AREA>},
+		{"IS_ENTITY_IN_WATER", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_IN_WATER>},
+		{"IS_ENTITY_IN_ZONE", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_IN_ZONE>},
+		{"IS_ENTITY_OCCLUDED", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_OCCLUDED>},
+		{"IS_ENTITY_ON_SCREEN", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_ON_SCREEN>},
+		{"IS_ENTITY_PLAYING_ANIM", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_PLAYING_ANIM>},
+		{"IS_ENTITY_STATIC", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_STATIC>},
+		{"IS_ENTITY_TOUCHING_ENTITY", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_TOUCHING_ENTITY>},
+		{"IS_ENTITY_TOUCHING_MODEL", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_TOUCHING_MODEL>},
+		{"IS_ENTITY_UPRIGHT", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_UPRIGHT>},
+		{"IS_ENTITY_UPSIDEDOWN", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_UPSIDEDOWN>},
+		{"IS_ENTITY_VISIBLE", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_VISIBLE>},
+		{"IS_ENTITY_VISIBLE_TO_SCRIPT", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_VISIBLE_TO_SCRIPT>},
+		{"IS_ENTITY_WAITING_FOR_WORLD_COLLISION", native_function<LUA_NATIVE_ENTITY_IS_ENTITY_WAITING_FOR_WORLD_COLLISION>},
+		{"PLAY_ENTITY_ANIM", native_function<LUA_NATIVE_ENTITY_PLAY_ENTITY_ANIM>},
+		{"PLAY_SYNCHRONIZED_ENTITY_ANIM", native_function<LUA_NATIVE_ENTITY_PLAY_SYNCHRONIZED_ENTITY_ANIM>},
+		{"PLAY_SYNCHRONIZED_MAP_ENTITY_ANIM", native_function<LUA_NATIVE_ENTITY_PLAY_SYNCHRONIZED_MAP_ENTITY_ANIM>},
+		{"PROCESS_ENTITY_ATTACHMENTS", native_function<LUA_NATIVE_ENTITY_PROCESS_ENTITY_ATTACHMENTS>},
+		{"REMOVE_FORCED_OBJECT", native_function<LUA_NATIVE_ENTITY_REMOVE_FORCED_OBJECT>},
+		{"REMOVE_MODEL_HIDE", native_function<LUA_NATIVE_ENTITY_REMOVE_MODEL_HIDE>},
+		{"REMOVE_MODEL_SWAP", native_function<LUA_NATIVE_ENTITY_REMOVE_MODEL_SWAP>},
+		{"RESET_ENTITY_ALPHA", native_function<LUA_NATIVE_ENTITY_RESET_ENTITY_ALPHA>},
+		{"RESET_PICKUP_ENTITY_GLOW", native_function<LUA_NATIVE_ENTITY_RESET_PICKUP_ENTITY_GLOW>},
+		{"SET_ALLOW_MIGRATE_TO_SPECTATOR", native_function<LUA_NATIVE_ENTITY_SET_ALLOW_MIGRATE_TO_SPECTATOR>},
+		{"SET_CAN_AUTO_VAULT_ON_ENTITY", native_function<LUA_NATIVE_ENTITY_SET_CAN_AUTO_VAULT_ON_ENTITY>},
+		{"SET_CAN_CLIMB_ON_ENTITY", native_function<LUA_NATIVE_ENTITY_SET_CAN_CLIMB_ON_ENTITY>},
+		{"SET_ENTITY_ALPHA", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_ALPHA>},
+		{"SET_ENTITY_ALWAYS_PRERENDER", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_ALWAYS_PRERENDER>},
+		{"SET_ENTITY_ANGULAR_VELOCITY", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_ANGULAR_VELOCITY>},
+		{"SET_ENTITY_ANIM_CURRENT_TIME", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_ANIM_CURRENT_TIME>},
+		{"SET_ENTITY_ANIM_SPEED", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_ANIM_SPEED>},
+		{"SET_ENTITY_AS_MISSION_ENTITY", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_AS_MISSION_ENTITY>},
+		{"SET_ENTITY_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_AS_NO_LONGER_NEEDED>},
+		{"SET_ENTITY_CANT_CAUSE_COLLISION_DAMAGED_ENTITY", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_CANT_CAUSE_COLLISION_DAMAGED_ENTITY>},
+		{"SET_ENTITY_CAN_BE_DAMAGED", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_CAN_BE_DAMAGED>},
+		{"SET_ENTITY_CAN_BE_DAMAGED_BY_RELATIONSHIP_GROUP", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_CAN_BE_DAMAGED_BY_RELATIONSHIP_GROUP>},
+		{"SET_ENTITY_CAN_BE_TARGETED_WITHOUT_LOS", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_CAN_BE_TARGETED_WITHOUT_LOS>},
+		{"SET_ENTITY_CAN_ONLY_BE_DAMAGED_BY_ENTITY", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_CAN_ONLY_BE_DAMAGED_BY_ENTITY>},
+		{"SET_ENTITY_CAN_ONLY_BE_DAMAGED_BY_SCRIPT_PARTICIPANTS", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_CAN_ONLY_BE_DAMAGED_BY_SCRIPT_PARTICIPANTS>},
+		{"SET_ENTITY_COLLISION", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_COLLISION>},
+		{"SET_ENTITY_COMPLETELY_DISABLE_COLLISION", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_COMPLETELY_DISABLE_COLLISION>},
+		{"SET_ENTITY_COORDS", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_COORDS>},
+		{"SET_ENTITY_COORDS_NO_OFFSET", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_COORDS_NO_OFFSET>},
+		{"SET_ENTITY_COORDS_WITHOUT_PLANTS_RESET", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_COORDS_WITHOUT_PLANTS_RESET>},
+		{"SET_ENTITY_DYNAMIC", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_DYNAMIC>},
+		{"SET_ENTITY_HAS_GRAVITY", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_HAS_GRAVITY>},
+		{"SET_ENTITY_HEADING", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_HEADING>},
+		{"SET_ENTITY_HEALTH", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_HEALTH>},
+		{"SET_ENTITY_INVINCIBLE", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_INVINCIBLE>},
+		{"SET_ENTITY_IS_IN_VEHICLE", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_IS_IN_VEHICLE>},
+		{"SET_ENTITY_IS_TARGET_PRIORITY", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_IS_TARGET_PRIORITY>},
+		{"SET_ENTITY_LIGHTS", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_LIGHTS>},
+		{"SET_ENTITY_LOAD_COLLISION_FLAG", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_LOAD_COLLISION_FLAG>},
+		{"SET_ENTITY_LOD_DIST", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_LOD_DIST>},
+		{"SET_ENTITY_MAX_HEALTH", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_MAX_HEALTH>},
+		{"SET_ENTITY_MAX_SPEED", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_MAX_SPEED>},
+		{"SET_ENTITY_MIRROR_REFLECTION_FLAG", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_MIRROR_REFLECTION_FLAG>},
+		{"SET_ENTITY_MOTION_BLUR", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_MOTION_BLUR>},
+		{"SET_ENTITY_NOWEAPONDECALS", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_NOWEAPONDECALS>},
+		{"SET_ENTITY_NO_COLLISION_ENTITY", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_NO_COLLISION_ENTITY>},
+		{"SET_ENTITY_ONLY_DAMAGED_BY_PLAYER", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_ONLY_DAMAGED_BY_PLAYER>},
+		{"SET_ENTITY_ONLY_DAMAGED_BY_RELATIONSHIP_GROUP", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_ONLY_DAMAGED_BY_RELATIONSHIP_GROUP>},
+		{"SET_ENTITY_PROOFS", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_PROOFS>},
+		{"SET_ENTITY_QUATERNION", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_QUATERNION>},
+		{"SET_ENTITY_RECORDS_COLLISIONS", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_RECORDS_COLLISIONS>},
+		{"SET_ENTITY_RENDER_SCORCHED", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_RENDER_SCORCHED>},
+		{"SET_ENTITY_REQUIRES_MORE_EXPENSIVE_RIVER_CHECK", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_REQUIRES_MORE_EXPENSIVE_RIVER_CHECK>},
+		{"SET_ENTITY_ROTATION", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_ROTATION>},
+		{"SET_ENTITY_SHOULD_FREEZE_WAITING_ON_COLLISION", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_SHOULD_FREEZE_WAITING_ON_COLLISION>},
+		{"SET_ENTITY_SORT_BIAS", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_SORT_BIAS>},
+		{"SET_ENTITY_TRAFFICLIGHT_OVERRIDE", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_TRAFFICLIGHT_OVERRIDE>},
+		{"SET_ENTITY_USE_MAX_DISTANCE_FOR_WATER_REFLECTION", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_USE_MAX_DISTANCE_FOR_WATER_REFLECTION>},
+		{"SET_ENTITY_VELOCITY", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_VELOCITY>},
+		{"SET_ENTITY_VISIBLE", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_VISIBLE>},
+		{"SET_ENTITY_WATER_REFLECTION_FLAG", native_function<LUA_NATIVE_ENTITY_SET_ENTITY_WATER_REFLECTION_FLAG>},
+		{"SET_OBJECT_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_ENTITY_SET_OBJECT_AS_NO_LONGER_NEEDED>},
+		{"SET_PED_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_ENTITY_SET_PED_AS_NO_LONGER_NEEDED>},
+		{"SET_PICKUP_COLLIDES_WITH_PROJECTILES", native_function<LUA_NATIVE_ENTITY_SET_PICKUP_COLLIDES_WITH_PROJECTILES>},
+		{"SET_PICK_UP_BY_CARGOBOB_DISABLED", native_function<LUA_NATIVE_ENTITY_SET_PICK_UP_BY_CARGOBOB_DISABLED>},
+		{"SET_VEHICLE_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_ENTITY_SET_VEHICLE_AS_NO_LONGER_NEEDED>},
+		{"SET_WAIT_FOR_COLLISIONS_BEFORE_PROBE", native_function<LUA_NATIVE_ENTITY_SET_WAIT_FOR_COLLISIONS_BEFORE_PROBE>},
+		{"STOP_ENTITY_ANIM", native_function<LUA_NATIVE_ENTITY_STOP_ENTITY_ANIM>},
+		{"STOP_SYNCHRONIZED_ENTITY_ANIM", native_function<LUA_NATIVE_ENTITY_STOP_SYNCHRONIZED_ENTITY_ANIM>},
+		{"STOP_SYNCHRONIZED_MAP_ENTITY_ANIM", native_function<LUA_NATIVE_ENTITY_STOP_SYNCHRONIZED_MAP_ENTITY_ANIM>},
+		{"WOULD_ENTITY_BE_OCCLUDED", native_function<LUA_NATIVE_ENTITY_WOULD_ENTITY_BE_OCCLUDED>},
+	};
+
 	void init_native_binding_ENTITY(sol::state& L)
 	{
-		auto ENTITY = L["ENTITY"].get_or_create<sol::table>();
-		ENTITY.set_function("DOES_ENTITY_EXIST", LUA_NATIVE_ENTITY_DOES_ENTITY_EXIST);
-		ENTITY.set_function("DOES_ENTITY_BELONG_TO_THIS_SCRIPT", LUA_NATIVE_ENTITY_DOES_ENTITY_BELONG_TO_THIS_SCRIPT);
-		ENTITY.set_function("DOES_ENTITY_HAVE_DRAWABLE", LUA_NATIVE_ENTITY_DOES_ENTITY_HAVE_DRAWABLE);
-		ENTITY.set_function("DOES_ENTITY_HAVE_PHYSICS", LUA_NATIVE_ENTITY_DOES_ENTITY_HAVE_PHYSICS);
-		ENTITY.set_function("DOES_ENTITY_HAVE_SKELETON", LUA_NATIVE_ENTITY_DOES_ENTITY_HAVE_SKELETON);
-		ENTITY.set_function("DOES_ENTITY_HAVE_ANIM_DIRECTOR", LUA_NATIVE_ENTITY_DOES_ENTITY_HAVE_ANIM_DIRECTOR);
-		ENTITY.set_function("HAS_ENTITY_ANIM_FINISHED", LUA_NATIVE_ENTITY_HAS_ENTITY_ANIM_FINISHED);
-		ENTITY.set_function("HAS_ENTITY_BEEN_DAMAGED_BY_ANY_OBJECT", LUA_NATIVE_ENTITY_HAS_ENTITY_BEEN_DAMAGED_BY_ANY_OBJECT);
-		ENTITY.set_function("HAS_ENTITY_BEEN_DAMAGED_BY_ANY_PED", LUA_NATIVE_ENTITY_HAS_ENTITY_BEEN_DAMAGED_BY_ANY_PED);
-		ENTITY.set_function("HAS_ENTITY_BEEN_DAMAGED_BY_ANY_VEHICLE", LUA_NATIVE_ENTITY_HAS_ENTITY_BEEN_DAMAGED_BY_ANY_VEHICLE);
-		ENTITY.set_function("HAS_ENTITY_BEEN_DAMAGED_BY_ENTITY", LUA_NATIVE_ENTITY_HAS_ENTITY_BEEN_DAMAGED_BY_ENTITY);
-		ENTITY.set_function("HAS_ENTITY_CLEAR_LOS_TO_ENTITY", LUA_NATIVE_ENTITY_HAS_ENTITY_CLEAR_LOS_TO_ENTITY);
-		ENTITY.set_function("HAS_ENTITY_CLEAR_LOS_TO_ENTITY_ADJUST_FOR_COVER", LUA_NATIVE_ENTITY_HAS_ENTITY_CLEAR_LOS_TO_ENTITY_ADJUST_FOR_COVER);
-		ENTITY.set_function("HAS_ENTITY_CLEAR_LOS_TO_ENTITY_IN_FRONT", LUA_NATIVE_ENTITY_HAS_ENTITY_CLEAR_LOS_TO_ENTITY_IN_FRONT);
-		ENTITY.set_function("HAS_ENTITY_COLLIDED_WITH_ANYTHING", LUA_NATIVE_ENTITY_HAS_ENTITY_COLLIDED_WITH_ANYTHING);
-		ENTITY.set_function("GET_LAST_ENTITY_HIT_BY_ENTITY_", LUA_NATIVE_ENTITY_GET_LAST_ENTITY_HIT_BY_ENTITY_);
-		ENTITY.set_function("GET_LAST_MATERIAL_HIT_BY_ENTITY", LUA_NATIVE_ENTITY_GET_LAST_MATERIAL_HIT_BY_ENTITY);
-		ENTITY.set_function("GET_COLLISION_NORMAL_OF_LAST_HIT_FOR_ENTITY", LUA_NATIVE_ENTITY_GET_COLLISION_NORMAL_OF_LAST_HIT_FOR_ENTITY);
-		ENTITY.set_function("FORCE_ENTITY_AI_AND_ANIMATION_UPDATE", LUA_NATIVE_ENTITY_FORCE_ENTITY_AI_AND_ANIMATION_UPDATE);
-		ENTITY.set_function("GET_ENTITY_ANIM_CURRENT_TIME", LUA_NATIVE_ENTITY_GET_ENTITY_ANIM_CURRENT_TIME);
-		ENTITY.set_function("GET_ENTITY_ANIM_TOTAL_TIME", LUA_NATIVE_ENTITY_GET_ENTITY_ANIM_TOTAL_TIME);
-		ENTITY.set_function("GET_ANIM_DURATION", LUA_NATIVE_ENTITY_GET_ANIM_DURATION);
-		ENTITY.set_function("GET_ENTITY_ATTACHED_TO", LUA_NATIVE_ENTITY_GET_ENTITY_ATTACHED_TO);
-		ENTITY.set_function("GET_ENTITY_COORDS", LUA_NATIVE_ENTITY_GET_ENTITY_COORDS);
-		ENTITY.set_function("GET_ENTITY_FORWARD_VECTOR", LUA_NATIVE_ENTITY_GET_ENTITY_FORWARD_VECTOR);
-		ENTITY.set_function("GET_ENTITY_FORWARD_X", LUA_NATIVE_ENTITY_GET_ENTITY_FORWARD_X);
-		ENTITY.set_function("GET_ENTITY_FORWARD_Y", LUA_NATIVE_ENTITY_GET_ENTITY_FORWARD_Y);
-		ENTITY.set_function("GET_ENTITY_HEADING", LUA_NATIVE_ENTITY_GET_ENTITY_HEADING);
-		ENTITY.set_function("GET_ENTITY_HEADING_FROM_EULERS", LUA_NATIVE_ENTITY_GET_ENTITY_HEADING_FROM_EULERS);
-		ENTITY.set_function("GET_ENTITY_HEALTH", LUA_NATIVE_ENTITY_GET_ENTITY_HEALTH);
-		ENTITY.set_function("GET_ENTITY_MAX_HEALTH", LUA_NATIVE_ENTITY_GET_ENTITY_MAX_HEALTH);
-		ENTITY.set_function("SET_ENTITY_MAX_HEALTH", LUA_NATIVE_ENTITY_SET_ENTITY_MAX_HEALTH);
-		ENTITY.set_function("GET_ENTITY_HEIGHT", LUA_NATIVE_ENTITY_GET_ENTITY_HEIGHT);
-		ENTITY.set_function("GET_ENTITY_HEIGHT_ABOVE_GROUND", LUA_NATIVE_ENTITY_GET_ENTITY_HEIGHT_ABOVE_GROUND);
-		ENTITY.set_function("GET_ENTITY_MATRIX", LUA_NATIVE_ENTITY_GET_ENTITY_MATRIX);
-		ENTITY.set_function("GET_ENTITY_MODEL", LUA_NATIVE_ENTITY_GET_ENTITY_MODEL);
-		ENTITY.set_function("GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS", LUA_NATIVE_ENTITY_GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS);
-		ENTITY.set_function("GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS", LUA_NATIVE_ENTITY_GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS);
-		ENTITY.set_function("GET_ENTITY_PITCH", LUA_NATIVE_ENTITY_GET_ENTITY_PITCH);
-		ENTITY.set_function("GET_ENTITY_QUATERNION", LUA_NATIVE_ENTITY_GET_ENTITY_QUATERNION);
-		ENTITY.set_function("GET_ENTITY_ROLL", LUA_NATIVE_ENTITY_GET_ENTITY_ROLL);
-		ENTITY.set_function("GET_ENTITY_ROTATION", LUA_NATIVE_ENTITY_GET_ENTITY_ROTATION);
-		ENTITY.set_function("GET_ENTITY_ROTATION_VELOCITY", LUA_NATIVE_ENTITY_GET_ENTITY_ROTATION_VELOCITY);
-		ENTITY.set_function("GET_ENTITY_SCRIPT", LUA_NATIVE_ENTITY_GET_ENTITY_SCRIPT);
-		ENTITY.set_function("GET_ENTITY_SPEED", LUA_NATIVE_ENTITY_GET_ENTITY_SPEED);
-		ENTITY.set_function("GET_ENTITY_SPEED_VECTOR", LUA_NATIVE_ENTITY_GET_ENTITY_SPEED_VECTOR);
-		ENTITY.set_function("GET_ENTITY_UPRIGHT_VALUE", LUA_NATIVE_ENTITY_GET_ENTITY_UPRIGHT_VALUE);
-		ENTITY.set_function("GET_ENTITY_VELOCITY", LUA_NATIVE_ENTITY_GET_ENTITY_VELOCITY);
-		ENTITY.set_function("GET_OBJECT_INDEX_FROM_ENTITY_INDEX", LUA_NATIVE_ENTITY_GET_OBJECT_INDEX_FROM_ENTITY_INDEX);
-		ENTITY.set_function("GET_PED_INDEX_FROM_ENTITY_INDEX", LUA_NATIVE_ENTITY_GET_PED_INDEX_FROM_ENTITY_INDEX);
-		ENTITY.set_function("GET_VEHICLE_INDEX_FROM_ENTITY_INDEX", LUA_NATIVE_ENTITY_GET_VEHICLE_INDEX_FROM_ENTITY_INDEX);
-		ENTITY.set_function("GET_WORLD_POSITION_OF_ENTITY_BONE", LUA_NATIVE_ENTITY_GET_WORLD_POSITION_OF_ENTITY_BONE);
-		ENTITY.set_function("GET_NEAREST_PLAYER_TO_ENTITY", LUA_NATIVE_ENTITY_GET_NEAREST_PLAYER_TO_ENTITY);
-		ENTITY.set_function("GET_NEAREST_PLAYER_TO_ENTITY_ON_TEAM", LUA_NATIVE_ENTITY_GET_NEAREST_PLAYER_TO_ENTITY_ON_TEAM);
-		ENTITY.set_function("GET_NEAREST_PARTICIPANT_TO_ENTITY", LUA_NATIVE_ENTITY_GET_NEAREST_PARTICIPANT_TO_ENTITY);
-		ENTITY.set_function("GET_ENTITY_TYPE", LUA_NATIVE_ENTITY_GET_ENTITY_TYPE);
-		ENTITY.set_function("GET_ENTITY_POPULATION_TYPE", LUA_NATIVE_ENTITY_GET_ENTITY_POPULATION_TYPE);
-		ENTITY.set_function("IS_AN_ENTITY", LUA_NATIVE_ENTITY_IS_AN_ENTITY);
-		ENTITY.set_function("IS_ENTITY_A_PED", LUA_NATIVE_ENTITY_IS_ENTITY_A_PED);
-		ENTITY.set_function("IS_ENTITY_A_MISSION_ENTITY", LUA_NATIVE_ENTITY_IS_ENTITY_A_MISSION_ENTITY);
-		ENTITY.set_function("IS_ENTITY_A_VEHICLE", LUA_NATIVE_ENTITY_IS_ENTITY_A_VEHICLE);
-		ENTITY.set_function("IS_ENTITY_AN_OBJECT", LUA_NATIVE_ENTITY_IS_ENTITY_AN_OBJECT);
-		ENTITY.set_function("IS_ENTITY_AT_COORD", LUA_NATIVE_ENTITY_IS_ENTITY_AT_COORD);
-		ENTITY.set_function("IS_ENTITY_AT_ENTITY", LUA_NATIVE_ENTITY_IS_ENTITY_AT_ENTITY);
-		ENTITY.set_function("IS_ENTITY_ATTACHED", LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED);
-		ENTITY.set_function("IS_ENTITY_ATTACHED_TO_ANY_OBJECT", LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED_TO_ANY_OBJECT);
-		ENTITY.set_function("IS_ENTITY_ATTACHED_TO_ANY_PED", LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED_TO_ANY_PED);
-		ENTITY.set_function("IS_ENTITY_ATTACHED_TO_ANY_VEHICLE", LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED_TO_ANY_VEHICLE);
-		ENTITY.set_function("IS_ENTITY_ATTACHED_TO_ENTITY", LUA_NATIVE_ENTITY_IS_ENTITY_ATTACHED_TO_ENTITY);
-		ENTITY.set_function("IS_ENTITY_DEAD", LUA_NATIVE_ENTITY_IS_ENTITY_DEAD);
-		ENTITY.set_function("IS_ENTITY_IN_AIR", LUA_NATIVE_ENTITY_IS_ENTITY_IN_AIR);
-		ENTITY.set_function("IS_ENTITY_IN_ANGLED_AREA", LUA_NATIVE_ENTITY_IS_ENTITY_IN_ANGLED_AREA);
-		ENTITY.set_function("IS_ENTITY_IN_AREA", LUA_NATIVE_ENTITY_IS_ENTITY_IN_AREA);
-		ENTITY.set_function("IS_ENTITY_IN_ZONE", LUA_NATIVE_ENTITY_IS_ENTITY_IN_ZONE);
-		ENTITY.set_function("IS_ENTITY_IN_WATER", LUA_NATIVE_ENTITY_IS_ENTITY_IN_WATER);
-		ENTITY.set_function("GET_ENTITY_SUBMERGED_LEVEL", LUA_NATIVE_ENTITY_GET_ENTITY_SUBMERGED_LEVEL);
-		ENTITY.set_function("SET_ENTITY_REQUIRES_MORE_EXPENSIVE_RIVER_CHECK", LUA_NATIVE_ENTITY_SET_ENTITY_REQUIRES_MORE_EXPENSIVE_RIVER_CHECK);
-		ENTITY.set_function("IS_ENTITY_ON_SCREEN", LUA_NATIVE_ENTITY_IS_ENTITY_ON_SCREEN);
-		ENTITY.set_function("IS_ENTITY_PLAYING_ANIM", LUA_NATIVE_ENTITY_IS_ENTITY_PLAYING_ANIM);
-		ENTITY.set_function("IS_ENTITY_STATIC", LUA_NATIVE_ENTITY_IS_ENTITY_STATIC);
-		ENTITY.set_function("IS_ENTITY_TOUCHING_ENTITY", LUA_NATIVE_ENTITY_IS_ENTITY_TOUCHING_ENTITY);
-		ENTITY.set_function("IS_ENTITY_TOUCHING_MODEL", LUA_NATIVE_ENTITY_IS_ENTITY_TOUCHING_MODEL);
-		ENTITY.set_function("IS_ENTITY_UPRIGHT", LUA_NATIVE_ENTITY_IS_ENTITY_UPRIGHT);
-		ENTITY.set_function("IS_ENTITY_UPSIDEDOWN", LUA_NATIVE_ENTITY_IS_ENTITY_UPSIDEDOWN);
-		ENTITY.set_function("IS_ENTITY_VISIBLE", LUA_NATIVE_ENTITY_IS_ENTITY_VISIBLE);
-		ENTITY.set_function("IS_ENTITY_VISIBLE_TO_SCRIPT", LUA_NATIVE_ENTITY_IS_ENTITY_VISIBLE_TO_SCRIPT);
-		ENTITY.set_function("IS_ENTITY_OCCLUDED", LUA_NATIVE_ENTITY_IS_ENTITY_OCCLUDED);
-		ENTITY.set_function("WOULD_ENTITY_BE_OCCLUDED", LUA_NATIVE_ENTITY_WOULD_ENTITY_BE_OCCLUDED);
-		ENTITY.set_function("IS_ENTITY_WAITING_FOR_WORLD_COLLISION", LUA_NATIVE_ENTITY_IS_ENTITY_WAITING_FOR_WORLD_COLLISION);
-		ENTITY.set_function("APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS", LUA_NATIVE_ENTITY_APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS);
-		ENTITY.set_function("APPLY_FORCE_TO_ENTITY", LUA_NATIVE_ENTITY_APPLY_FORCE_TO_ENTITY);
-		ENTITY.set_function("ATTACH_ENTITY_TO_ENTITY", LUA_NATIVE_ENTITY_ATTACH_ENTITY_TO_ENTITY);
-		ENTITY.set_function("ATTACH_ENTITY_BONE_TO_ENTITY_BONE", LUA_NATIVE_ENTITY_ATTACH_ENTITY_BONE_TO_ENTITY_BONE);
-		ENTITY.set_function("ATTACH_ENTITY_BONE_TO_ENTITY_BONE_Y_FORWARD", LUA_NATIVE_ENTITY_ATTACH_ENTITY_BONE_TO_ENTITY_BONE_Y_FORWARD);
-		ENTITY.set_function("ATTACH_ENTITY_TO_ENTITY_PHYSICALLY", LUA_NATIVE_ENTITY_ATTACH_ENTITY_TO_ENTITY_PHYSICALLY);
-		ENTITY.set_function("ATTACH_ENTITY_TO_ENTITY_PHYSICALLY_OVERRIDE_INVERSE_MASS", LUA_NATIVE_ENTITY_ATTACH_ENTITY_TO_ENTITY_PHYSICALLY_OVERRIDE_INVERSE_MASS);
-		ENTITY.set_function("PROCESS_ENTITY_ATTACHMENTS", LUA_NATIVE_ENTITY_PROCESS_ENTITY_ATTACHMENTS);
-		ENTITY.set_function("GET_ENTITY_BONE_INDEX_BY_NAME", LUA_NATIVE_ENTITY_GET_ENTITY_BONE_INDEX_BY_NAME);
-		ENTITY.set_function("CLEAR_ENTITY_LAST_DAMAGE_ENTITY", LUA_NATIVE_ENTITY_CLEAR_ENTITY_LAST_DAMAGE_ENTITY);
-		ENTITY.set_function("DELETE_ENTITY", LUA_NATIVE_ENTITY_DELETE_ENTITY);
-		ENTITY.set_function("DETACH_ENTITY", LUA_NATIVE_ENTITY_DETACH_ENTITY);
-		ENTITY.set_function("FREEZE_ENTITY_POSITION", LUA_NATIVE_ENTITY_FREEZE_ENTITY_POSITION);
-		ENTITY.set_function("SET_ENTITY_SHOULD_FREEZE_WAITING_ON_COLLISION", LUA_NATIVE_ENTITY_SET_ENTITY_SHOULD_FREEZE_WAITING_ON_COLLISION);
-		ENTITY.set_function("PLAY_ENTITY_ANIM", LUA_NATIVE_ENTITY_PLAY_ENTITY_ANIM);
-		ENTITY.set_function("PLAY_SYNCHRONIZED_ENTITY_ANIM", LUA_NATIVE_ENTITY_PLAY_SYNCHRONIZED_ENTITY_ANIM);
-		ENTITY.set_function("PLAY_SYNCHRONIZED_MAP_ENTITY_ANIM", LUA_NATIVE_ENTITY_PLAY_SYNCHRONIZED_MAP_ENTITY_ANIM);
-		ENTITY.set_function("STOP_SYNCHRONIZED_MAP_ENTITY_ANIM", LUA_NATIVE_ENTITY_STOP_SYNCHRONIZED_MAP_ENTITY_ANIM);
-		ENTITY.set_function("STOP_ENTITY_ANIM", LUA_NATIVE_ENTITY_STOP_ENTITY_ANIM);
-		ENTITY.set_function("STOP_SYNCHRONIZED_ENTITY_ANIM", LUA_NATIVE_ENTITY_STOP_SYNCHRONIZED_ENTITY_ANIM);
-		ENTITY.set_function("HAS_ANIM_EVENT_FIRED", LUA_NATIVE_ENTITY_HAS_ANIM_EVENT_FIRED);
-		ENTITY.set_function("FIND_ANIM_EVENT_PHASE", LUA_NATIVE_ENTITY_FIND_ANIM_EVENT_PHASE);
-		ENTITY.set_function("SET_ENTITY_ANIM_CURRENT_TIME", LUA_NATIVE_ENTITY_SET_ENTITY_ANIM_CURRENT_TIME);
-		ENTITY.set_function("SET_ENTITY_ANIM_SPEED", LUA_NATIVE_ENTITY_SET_ENTITY_ANIM_SPEED);
-		ENTITY.set_function("SET_ENTITY_AS_MISSION_ENTITY", LUA_NATIVE_ENTITY_SET_ENTITY_AS_MISSION_ENTITY);
-		ENTITY.set_function("SET_ENTITY_AS_NO_LONGER_NEEDED", LUA_NATIVE_ENTITY_SET_ENTITY_AS_NO_LONGER_NEEDED);
-		ENTITY.set_function("SET_PED_AS_NO_LONGER_NEEDED", LUA_NATIVE_ENTITY_SET_PED_AS_NO_LONGER_NEEDED);
-		ENTITY.set_function("SET_VEHICLE_AS_NO_LONGER_NEEDED", LUA_NATIVE_ENTITY_SET_VEHICLE_AS_NO_LONGER_NEEDED);
-		ENTITY.set_function("SET_OBJECT_AS_NO_LONGER_NEEDED", LUA_NATIVE_ENTITY_SET_OBJECT_AS_NO_LONGER_NEEDED);
-		ENTITY.set_function("SET_ENTITY_CAN_BE_DAMAGED", LUA_NATIVE_ENTITY_SET_ENTITY_CAN_BE_DAMAGED);
-		ENTITY.set_function("GET_ENTITY_CAN_BE_DAMAGED", LUA_NATIVE_ENTITY_GET_ENTITY_CAN_BE_DAMAGED);
-		ENTITY.set_function("SET_ENTITY_CAN_BE_DAMAGED_BY_RELATIONSHIP_GROUP", LUA_NATIVE_ENTITY_SET_ENTITY_CAN_BE_DAMAGED_BY_RELATIONSHIP_GROUP);
-		ENTITY.set_function("SET_ENTITY_CAN_ONLY_BE_DAMAGED_BY_SCRIPT_PARTICIPANTS", LUA_NATIVE_ENTITY_SET_ENTITY_CAN_ONLY_BE_DAMAGED_BY_SCRIPT_PARTICIPANTS);
-		ENTITY.set_function("SET_ENTITY_CAN_BE_TARGETED_WITHOUT_LOS", LUA_NATIVE_ENTITY_SET_ENTITY_CAN_BE_TARGETED_WITHOUT_LOS);
-		ENTITY.set_function("SET_ENTITY_COLLISION", LUA_NATIVE_ENTITY_SET_ENTITY_COLLISION);
-		ENTITY.set_function("GET_ENTITY_COLLISION_DISABLED", LUA_NATIVE_ENTITY_GET_ENTITY_COLLISION_DISABLED);
-		ENTITY.set_function("SET_ENTITY_COMPLETELY_DISABLE_COLLISION", LUA_NATIVE_ENTITY_SET_ENTITY_COMPLETELY_DISABLE_COLLISION);
-		ENTITY.set_function("SET_ENTITY_COORDS", LUA_NATIVE_ENTITY_SET_ENTITY_COORDS);
-		ENTITY.set_function("SET_ENTITY_COORDS_WITHOUT_PLANTS_RESET", LUA_NATIVE_ENTITY_SET_ENTITY_COORDS_WITHOUT_PLANTS_RESET);
-		ENTITY.set_function("SET_ENTITY_COORDS_NO_OFFSET", LUA_NATIVE_ENTITY_SET_ENTITY_COORDS_NO_OFFSET);
-		ENTITY.set_function("SET_ENTITY_DYNAMIC", LUA_NATIVE_ENTITY_SET_ENTITY_DYNAMIC);
-		ENTITY.set_function("SET_ENTITY_HEADING", LUA_NATIVE_ENTITY_SET_ENTITY_HEADING);
-		ENTITY.set_function("SET_ENTITY_HEALTH", LUA_NATIVE_ENTITY_SET_ENTITY_HEALTH);
-		ENTITY.set_function("SET_ENTITY_INVINCIBLE", LUA_NATIVE_ENTITY_SET_ENTITY_INVINCIBLE);
-		ENTITY.set_function("SET_ENTITY_IS_TARGET_PRIORITY", LUA_NATIVE_ENTITY_SET_ENTITY_IS_TARGET_PRIORITY);
-		ENTITY.set_function("SET_ENTITY_LIGHTS", LUA_NATIVE_ENTITY_SET_ENTITY_LIGHTS);
-		ENTITY.set_function("SET_ENTITY_LOAD_COLLISION_FLAG", LUA_NATIVE_ENTITY_SET_ENTITY_LOAD_COLLISION_FLAG);
-		ENTITY.set_function("HAS_COLLISION_LOADED_AROUND_ENTITY", LUA_NATIVE_ENTITY_HAS_COLLISION_LOADED_AROUND_ENTITY);
-		ENTITY.set_function("SET_ENTITY_MAX_SPEED", LUA_NATIVE_ENTITY_SET_ENTITY_MAX_SPEED);
-		ENTITY.set_function("SET_ENTITY_ONLY_DAMAGED_BY_PLAYER", LUA_NATIVE_ENTITY_SET_ENTITY_ONLY_DAMAGED_BY_PLAYER);
-		ENTITY.set_function("SET_ENTITY_ONLY_DAMAGED_BY_RELATIONSHIP_GROUP", LUA_NATIVE_ENTITY_SET_ENTITY_ONLY_DAMAGED_BY_RELATIONSHIP_GROUP);
-		ENTITY.set_function("SET_ENTITY_PROOFS", LUA_NATIVE_ENTITY_SET_ENTITY_PROOFS);
-		ENTITY.set_function("GET_ENTITY_PROOFS", LUA_NATIVE_ENTITY_GET_ENTITY_PROOFS);
-		ENTITY.set_function("SET_ENTITY_QUATERNION", LUA_NATIVE_ENTITY_SET_ENTITY_QUATERNION);
-		ENTITY.set_function("SET_ENTITY_RECORDS_COLLISIONS", LUA_NATIVE_ENTITY_SET_ENTITY_RECORDS_COLLISIONS);
-		ENTITY.set_function("SET_ENTITY_ROTATION", LUA_NATIVE_ENTITY_SET_ENTITY_ROTATION);
-		ENTITY.set_function("SET_ENTITY_VISIBLE", LUA_NATIVE_ENTITY_SET_ENTITY_VISIBLE);
-		ENTITY.set_function("SET_ENTITY_WATER_REFLECTION_FLAG", LUA_NATIVE_ENTITY_SET_ENTITY_WATER_REFLECTION_FLAG);
-		ENTITY.set_function("SET_ENTITY_MIRROR_REFLECTION_FLAG", LUA_NATIVE_ENTITY_SET_ENTITY_MIRROR_REFLECTION_FLAG);
-		ENTITY.set_function("SET_ENTITY_VELOCITY", LUA_NATIVE_ENTITY_SET_ENTITY_VELOCITY);
-		ENTITY.set_function("SET_ENTITY_ANGULAR_VELOCITY", LUA_NATIVE_ENTITY_SET_ENTITY_ANGULAR_VELOCITY);
-		ENTITY.set_function("SET_ENTITY_HAS_GRAVITY", LUA_NATIVE_ENTITY_SET_ENTITY_HAS_GRAVITY);
-		ENTITY.set_function("SET_ENTITY_LOD_DIST", LUA_NATIVE_ENTITY_SET_ENTITY_LOD_DIST);
-		ENTITY.set_function("GET_ENTITY_LOD_DIST", LUA_NATIVE_ENTITY_GET_ENTITY_LOD_DIST);
-		ENTITY.set_function("SET_ENTITY_ALPHA", LUA_NATIVE_ENTITY_SET_ENTITY_ALPHA);
-		ENTITY.set_function("GET_ENTITY_ALPHA", LUA_NATIVE_ENTITY_GET_ENTITY_ALPHA);
-		ENTITY.set_function("RESET_ENTITY_ALPHA", LUA_NATIVE_ENTITY_RESET_ENTITY_ALPHA);
-		ENTITY.set_function("RESET_PICKUP_ENTITY_GLOW", LUA_NATIVE_ENTITY_RESET_PICKUP_ENTITY_GLOW);
-		ENTITY.set_function("SET_PICKUP_COLLIDES_WITH_PROJECTILES", LUA_NATIVE_ENTITY_SET_PICKUP_COLLIDES_WITH_PROJECTILES);
-		ENTITY.set_function("SET_ENTITY_SORT_BIAS", LUA_NATIVE_ENTITY_SET_ENTITY_SORT_BIAS);
-		ENTITY.set_function("SET_ENTITY_ALWAYS_PRERENDER", LUA_NATIVE_ENTITY_SET_ENTITY_ALWAYS_PRERENDER);
-		ENTITY.set_function("SET_ENTITY_RENDER_SCORCHED", LUA_NATIVE_ENTITY_SET_ENTITY_RENDER_SCORCHED);
-		ENTITY.set_function("SET_ENTITY_TRAFFICLIGHT_OVERRIDE", LUA_NATIVE_ENTITY_SET_ENTITY_TRAFFICLIGHT_OVERRIDE);
-		ENTITY.set_function("SET_ENTITY_IS_IN_VEHICLE", LUA_NATIVE_ENTITY_SET_ENTITY_IS_IN_VEHICLE);
-		ENTITY.set_function("CREATE_MODEL_SWAP", LUA_NATIVE_ENTITY_CREATE_MODEL_SWAP);
-		ENTITY.set_function("REMOVE_MODEL_SWAP", LUA_NATIVE_ENTITY_REMOVE_MODEL_SWAP);
-		ENTITY.set_function("CREATE_MODEL_HIDE", LUA_NATIVE_ENTITY_CREATE_MODEL_HIDE);
-		ENTITY.set_function("CREATE_MODEL_HIDE_EXCLUDING_SCRIPT_OBJECTS", LUA_NATIVE_ENTITY_CREATE_MODEL_HIDE_EXCLUDING_SCRIPT_OBJECTS);
-		ENTITY.set_function("REMOVE_MODEL_HIDE", LUA_NATIVE_ENTITY_REMOVE_MODEL_HIDE);
-		ENTITY.set_function("CREATE_FORCED_OBJECT", LUA_NATIVE_ENTITY_CREATE_FORCED_OBJECT);
-		ENTITY.set_function("REMOVE_FORCED_OBJECT", LUA_NATIVE_ENTITY_REMOVE_FORCED_OBJECT);
-		ENTITY.set_function("SET_ENTITY_NO_COLLISION_ENTITY", LUA_NATIVE_ENTITY_SET_ENTITY_NO_COLLISION_ENTITY);
-		ENTITY.set_function("SET_ENTITY_MOTION_BLUR", LUA_NATIVE_ENTITY_SET_ENTITY_MOTION_BLUR);
-		ENTITY.set_function("SET_CAN_AUTO_VAULT_ON_ENTITY", LUA_NATIVE_ENTITY_SET_CAN_AUTO_VAULT_ON_ENTITY);
-		ENTITY.set_function("SET_CAN_CLIMB_ON_ENTITY", LUA_NATIVE_ENTITY_SET_CAN_CLIMB_ON_ENTITY);
-		ENTITY.set_function("SET_WAIT_FOR_COLLISIONS_BEFORE_PROBE", LUA_NATIVE_ENTITY_SET_WAIT_FOR_COLLISIONS_BEFORE_PROBE);
-		ENTITY.set_function("SET_ENTITY_NOWEAPONDECALS", LUA_NATIVE_ENTITY_SET_ENTITY_NOWEAPONDECALS);
-		ENTITY.set_function("SET_ENTITY_USE_MAX_DISTANCE_FOR_WATER_REFLECTION", LUA_NATIVE_ENTITY_SET_ENTITY_USE_MAX_DISTANCE_FOR_WATER_REFLECTION);
-		ENTITY.set_function("GET_ENTITY_BONE_ROTATION", LUA_NATIVE_ENTITY_GET_ENTITY_BONE_ROTATION);
-		ENTITY.set_function("GET_ENTITY_BONE_POSTION", LUA_NATIVE_ENTITY_GET_ENTITY_BONE_POSTION);
-		ENTITY.set_function("GET_ENTITY_BONE_OBJECT_ROTATION", LUA_NATIVE_ENTITY_GET_ENTITY_BONE_OBJECT_ROTATION);
-		ENTITY.set_function("GET_ENTITY_BONE_OBJECT_POSTION", LUA_NATIVE_ENTITY_GET_ENTITY_BONE_OBJECT_POSTION);
-		ENTITY.set_function("GET_ENTITY_BONE_COUNT", LUA_NATIVE_ENTITY_GET_ENTITY_BONE_COUNT);
-		ENTITY.set_function("ENABLE_ENTITY_BULLET_COLLISION", LUA_NATIVE_ENTITY_ENABLE_ENTITY_BULLET_COLLISION);
-		ENTITY.set_function("SET_ENTITY_CAN_ONLY_BE_DAMAGED_BY_ENTITY", LUA_NATIVE_ENTITY_SET_ENTITY_CAN_ONLY_BE_DAMAGED_BY_ENTITY);
-		ENTITY.set_function("SET_ENTITY_CANT_CAUSE_COLLISION_DAMAGED_ENTITY", LUA_NATIVE_ENTITY_SET_ENTITY_CANT_CAUSE_COLLISION_DAMAGED_ENTITY);
-		ENTITY.set_function("SET_ALLOW_MIGRATE_TO_SPECTATOR", LUA_NATIVE_ENTITY_SET_ALLOW_MIGRATE_TO_SPECTATOR);
-		ENTITY.set_function("GET_ENTITY_OF_TYPE_ATTACHED_TO_ENTITY", LUA_NATIVE_ENTITY_GET_ENTITY_OF_TYPE_ATTACHED_TO_ENTITY);
-		ENTITY.set_function("SET_PICK_UP_BY_CARGOBOB_DISABLED", LUA_NATIVE_ENTITY_SET_PICK_UP_BY_CARGOBOB_DISABLED);
+		bind_namespace(L, "ENTITY", ENTITY_natives);
 	}
 }
@@ -72,21 +72,24 @@ namespace lua::native
 		EVENT::SUPPRESS_AGITATION_EVENTS_NEXT_FRAME();
 	}
 
+	static constexpr native_entry EVENT_natives[] = {
+		{"ADD_SHOCKING_EVENT_AT_POSITION", native_function<LUA_NATIVE_EVENT_ADD_SHOCKING_EVENT_AT_POSITION>},
+		{"ADD_SHOCKING_EVENT_FOR_ENTITY", native_function<LUA_NATIVE_EVENT_ADD_SHOCKING_EVENT_FOR_ENTITY>},
+		{"BLOCK_DECISION_MAKER_EVENT", native_function<LUA_NATIVE_EVENT_BLOCK_DECISION_MAKER_EVENT>},
+		{"CLEAR_DECISION_MAKER_EVENT_RESPONSE", native_function<LUA_NATIVE_EVENT_CLEAR_DECISION_MAKER_EVENT_RESPONSE>},
+		{"IS_SHOCKING_EVENT_IN_SPHERE", native_function<LUA_NATIVE_EVENT_IS_SHOCKING_EVENT_IN_SPHERE>},
+		{"REMOVE_ALL_SHOCKING_EVENTS", native_function<LUA_NATIVE_EVENT_REMOVE_ALL_SHOCKING_EVENTS>},
+		{"REMOVE_SHOCKING_EVENT", native_function<LUA_NATIVE_EVENT_REMOVE_SHOCKING_EVENT>},
+		{"REMOVE_SHOCKING_EVENT_SPAWN_BLOCKING_AREAS", native_function<LUA_NATIVE_EVENT_REMOVE_SHOCKING_EVENT_SPAWN_BLOCKING_AREAS>},
+		{"SET_DECISION_MAKER", native_function<LUA_NATIVE_EVENT_SET_DECISION_MAKER>},
+		{"SUPPRESS_AGITATION_EVENTS_NEXT_FRAME", native_function<LUA_NATIVE_EVENT_SUPPRESS_AGITATION_EVENTS_NEXT_FRAME>},
+		{"SUPPRESS_SHOCKING_EVENTS_NEXT_FRAME", native_function<LUA_NATIVE_EVENT_SUPPRESS_SHOCKING_EVENTS_NEXT_FRAME>},
+		{"SUPPRESS_SHOCKING_EVENT_TYPE_NEXT_FRAME", native_function<LUA_NATIVE_EVENT_SUPPRESS_SHOCKING_EVENT_TYPE_NEXT_FRAME>},
+		{"UNBLOCK_DECISION_MAKER_EVENT", native_function<LUA_NATIVE_EVENT_UNBLOCK_DECISION_MAKER_EVENT>},
+	};
+
 	void init_native_binding_EVENT(sol::state& L)
 	{
-		auto EVENT = L["EVENT"].get_or_create<sol::table>();
-		EVENT.set_function("SET_DECISION_MAKER", LUA_NATIVE_EVENT_SET_DECISION_MAKER);
-		EVENT.set_function("CLEAR_DECISION_MAKER_EVENT_RESPONSE", LUA_NATIVE_EVENT_CLEAR_DECISION_MAKER_EVENT_RESPONSE);
-		EVENT.set_function("BLOCK_DECISION_MAKER_EVENT", LUA_NATIVE_EVENT_BLOCK_DECISION_MAKER_EVENT);
-		EVENT.set_function("UNBLOCK_DECISION_MAKER_EVENT", LUA_NATIVE_EVENT_UNBLOCK_DECISION_MAKER_EVENT);
-		EVENT.set_function("ADD_SHOCKING_EVENT_AT_POSITION", LUA_NATIVE_EVENT_ADD_SHOCKING_EVENT_AT_POSITION);
-		EVENT.set_function("ADD_SHOCKING_EVENT_FOR_ENTITY", LUA_NATIVE_EVENT_ADD_SHOCKING_EVENT_FOR_ENTITY);
-		EVENT.set_function("IS_SHOCKING_EVENT_IN_SPHERE", LUA_NATIVE_EVENT_IS_SHOCKING_EVENT_IN_SPHERE);
-		EVENT.set_function("REMOVE_SHOCKING_EVENT", LUA_NATIVE_EVENT_REMOVE_SHOCKING_EVENT);
-		EVENT.set_function("REMOVE_ALL_SHOCKING_EVENTS", LUA_NATIVE_EVENT_REMOVE_ALL_SHOCKING_EVENTS);
-		EVENT.set_function("REMOVE_SHOCKING_EVENT_SPAWN_BLOCKING_AREAS", LUA_NATIVE_EVENT_REMOVE_SHOCKING_EVENT_SPAWN_BLOCKING_AREAS);
-		EVENT.set_function("SUPPRESS_SHOCKING_EVENTS_NEXT_FRAME", LUA_NATIVE_EVENT_SUPPRESS_SHOCKING_EVENTS_NEXT_FRAME);
-		EVENT.set_function("SUPPRESS_SHOCKING_EVENT_TYPE_NEXT_FRAME", LUA_NATIVE_EVENT_SUPPRESS_SHOCKING_EVENT_TYPE_NEXT_FRAME);
-		EVENT.set_function("SUPPRESS_AGITATION_EVENTS_NEXT_FRAME", LUA_NATIVE_EVENT_SUPPRESS_AGITATION_EVENTS_NEXT_FRAME);
+		bind_namespace(L, "EVENT", EVENT_natives);
 	}
 }
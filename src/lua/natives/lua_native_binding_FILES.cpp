@@ -307,57 +307,60 @@ namespace lua::native
 		FILES::REVERT_CONTENT_CHANGESET_GROUP_FOR_ALL(hash);
 	}
 
+	static constexpr native_entry FILES_natives[] = {
+		{"DOES_CURRENT_PED_COMPONENT_HAVE_RESTRICTION_TAG", native_function<LUA_NATIVE_FILES_DOES_CURRENT_PED_COMPONENT_HAVE_RESTRICTION_TAG>},
+		{"DOES_CURRENT_PED_PROP_HAVE_RESTRICTION_TAG", native_function<LUA_NATIVE_FILES_DOES_CURRENT_PED_PROP_HAVE_RESTRICTION_TAG>},
+		{"DOES_SHOP_PED_APPAREL_HAVE_RESTRICTION_TAG", native_function<LUA_NATIVE_FILES_DOES_SHOP_PED_APPAREL_HAVE_RESTRICTION_TAG>},
+		{"EXECUTE_CONTENT_CHANGESET_GROUP_FOR_ALL", native_function<LUA_NATIVE_FILES_EXECUTE_CONTENT_CHANGESET_GROUP_FOR_ALL>},
+		{"GET_DLC_VEHICLE_DATA", native_function<LUA_NATIVE_FILES_GET_DLC_VEHICLE_DATA>},
+		{"GET_DLC_VEHICLE_FLAGS", native_function<LUA_NATIVE_FILES_GET_DLC_VEHICLE_FLAGS>},
+		{"GET_DLC_VEHICLE_MODEL", native_function<LUA_NATIVE_FILES_GET_DLC_VEHICLE_MODEL>},
+		{"GET_DLC_VEHICLE_MOD_LOCK_HASH", native_function<LUA_NATIVE_FILES_GET_DLC_VEHICLE_MOD_LOCK_HASH>},
+		{"GET_DLC_WEAPON_COMPONENT_DATA", native_function<LUA_NATIVE_FILES_GET_DLC_WEAPON_COMPONENT_DATA>},
+		{"GET_DLC_WEAPON_COMPONENT_DATA_SP", native_function<LUA_NATIVE_FILES_GET_DLC_WEAPON_COMPONENT_DATA_SP>},
+		{"GET_DLC_WEAPON_DATA", native_function<LUA_NATIVE_FILES_GET_DLC_WEAPON_DATA>},
+		{"GET_DLC_WEAPON_DATA_SP", native_function<LUA_NATIVE_FILES_GET_DLC_WEAPON_DATA_SP>},
+		{"GET_FORCED_COMPONENT", native_function<LUA_NATIVE_FILES_GET_FORCED_COMPONENT>},
+		{"GET_FORCED_PROP", native_function<LUA_NATIVE_FILES_GET_FORCED_PROP>},
+		{"GET_HASH_NAME_FOR_COMPONENT", native_function<LUA_NATIVE_FILES_GET_HASH_NAME_FOR_COMPONENT>},
+		{"GET_HASH_NAME_FOR_PROP", native_function<LUA_NATIVE_FILES_GET_HASH_NAME_FOR_PROP>},
+		{"GET_NUM_DLC_VEHICLES", native_function<LUA_NATIVE_FILES_GET_NUM_DLC_VEHICLES>},
+		{"GET_NUM_DLC_WEAPONS", native_function<LUA_NATIVE_FILES_GET_NUM_DLC_WEAPONS>},
+		{"GET_NUM_DLC_WEAPONS_SP", native_function<LUA_NATIVE_FILES_GET_NUM_DLC_WEAPONS_SP>},
+		{"GET_NUM_DLC_WEAPON_COMPONENTS", native_function<LUA_NATIVE_FILES_GET_NUM_DLC_WEAPON_COMPONENTS>},
+		{"GET_NUM_DLC_WEAPON_COMPONENTS_SP", native_function<LUA_NATIVE_FILES_GET_NUM_DLC_WEAPON_COMPONENTS_SP>},
+		{"GET_NUM_TATTOO_SHOP_DLC_ITEMS", native_function<LUA_NATIVE_FILES_GET_NUM_TATTOO_SHOP_DLC_ITEMS>},
+		{"GET_SHOP_PED_APPAREL_FORCED_COMPONENT_COUNT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_APPAREL_FORCED_COMPONENT_COUNT>},
+		{"GET_SHOP_PED_APPAREL_FORCED_PROP_COUNT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_APPAREL_FORCED_PROP_COUNT>},
+		{"GET_SHOP_PED_APPAREL_VARIANT_COMPONENT_COUNT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_APPAREL_VARIANT_COMPONENT_COUNT>},
+		{"GET_SHOP_PED_APPAREL_VARIANT_PROP_COUNT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_APPAREL_VARIANT_PROP_COUNT>},
+		{"GET_SHOP_PED_COMPONENT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_COMPONENT>},
+		{"GET_SHOP_PED_OUTFIT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_OUTFIT>},
+		{"GET_SHOP_PED_OUTFIT_COMPONENT_VARIANT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_OUTFIT_COMPONENT_VARIANT>},
+		{"GET_SHOP_PED_OUTFIT_LOCATE", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_OUTFIT_LOCATE>},
+		{"GET_SHOP_PED_OUTFIT_PROP_VARIANT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_OUTFIT_PROP_VARIANT>},
+		{"GET_SHOP_PED_PROP", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_PROP>},
+		{"GET_SHOP_PED_QUERY_COMPONENT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_COMPONENT>},
+		{"GET_SHOP_PED_QUERY_COMPONENT_INDEX", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_COMPONENT_INDEX>},
+		{"GET_SHOP_PED_QUERY_OUTFIT", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_OUTFIT>},
+		{"GET_SHOP_PED_QUERY_PROP", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_PROP>},
+		{"GET_SHOP_PED_QUERY_PROP_INDEX", native_function<LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_PROP_INDEX>},
+		{"GET_TATTOO_SHOP_DLC_ITEM_DATA", native_function<LUA_NATIVE_FILES_GET_TATTOO_SHOP_DLC_ITEM_DATA>},
+		{"GET_TATTOO_SHOP_DLC_ITEM_INDEX", native_function<LUA_NATIVE_FILES_GET_TATTOO_SHOP_DLC_ITEM_INDEX>},
+		{"GET_VARIANT_COMPONENT", native_function<LUA_NATIVE_FILES_GET_VARIANT_COMPONENT>},
+		{"GET_VARIANT_PROP", native_function<LUA_NATIVE_FILES_GET_VARIANT_PROP>},
+		{"INIT_SHOP_PED_COMPONENT", native_function<LUA_NATIVE_FILES_INIT_SHOP_PED_COMPONENT>},
+		{"INIT_SHOP_PED_PROP", native_function<LUA_NATIVE_FILES_INIT_SHOP_PED_PROP>},
+		{"IS_CONTENT_ITEM_LOCKED", native_function<LUA_NATIVE_FILES_IS_CONTENT_ITEM_LOCKED>},
+		{"IS_DLC_VEHICLE_MOD", native_function<LUA_NATIVE_FILES_IS_DLC_VEHICLE_MOD>},
+		{"REVERT_CONTENT_CHANGESET_GROUP_FOR_ALL", native_function<LUA_NATIVE_FILES_REVERT_CONTENT_CHANGESET_GROUP_FOR_ALL>},
+		{"SETUP_SHOP_PED_APPAREL_QUERY", native_function<LUA_NATIVE_FILES_SETUP_SHOP_PED_APPAREL_QUERY>},
+		{"SETUP_SHOP_PED_APPAREL_QUERY_TU", native_function<LUA_NATIVE_FILES_SETUP_SHOP_PED_APPAREL_QUERY_TU>},
+		{"SETUP_SHOP_PED_OUTFIT_QUERY", native_function<LUA_NATIVE_FILES_SETUP_SHOP_PED_OUTFIT_QUERY>},
+	};
+
 	void init_native_binding_FILES(sol::state& L)
 	{
-		auto FILES = L["FILES"].get_or_create<sol::table>();
-		FILES.set_function("GET_NUM_TATTOO_SHOP_DLC_ITEMS", LUA_NATIVE_FILES_GET_NUM_TATTOO_SHOP_DLC_ITEMS);
-		FILES.set_function("GET_TATTOO_SHOP_DLC_ITEM_DATA", LUA_NATIVE_FILES_GET_TATTOO_SHOP_DLC_ITEM_DATA);
-		FILES.set_function("GET_TATTOO_SHOP_DLC_ITEM_INDEX", LUA_NATIVE_FILES_GET_TATTOO_SHOP_DLC_ITEM_INDEX);
-		FILES.set_function("INIT_SHOP_PED_COMPONENT", LUA_NATIVE_FILES_INIT_SHOP_PED_COMPONENT);
-		FILES.set_function("INIT_SHOP_PED_PROP", LUA_NATIVE_FILES_INIT_SHOP_PED_PROP);
-		FILES.set_function("SETUP_SHOP_PED_APPAREL_QUERY", LUA_NATIVE_FILES_SETUP_SHOP_PED_APPAREL_QUERY);
-		FILES.set_function("SETUP_SHOP_PED_APPAREL_QUERY_TU", LUA_NATIVE_FILES_SETUP_SHOP_PED_APPAREL_QUERY_TU);
-		FILES.set_function("GET_SHOP_PED_QUERY_COMPONENT", LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_COMPONENT);
-		FILES.set_function("GET_SHOP_PED_QUERY_COMPONENT_INDEX", LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_COMPONENT_INDEX);
-		FILES.set_function("GET_SHOP_PED_COMPONENT", LUA_NATIVE_FILES_GET_SHOP_PED_COMPONENT);
-		FILES.set_function("GET_SHOP_PED_QUERY_PROP", LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_PROP);
-		FILES.set_function("GET_SHOP_PED_QUERY_PROP_INDEX", LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_PROP_INDEX);
-		FILES.set_function("GET_SHOP_PED_PROP", LUA_NATIVE_FILES_GET_SHOP_PED_PROP);
-		FILES.set_function("GET_HASH_NAME_FOR_COMPONENT", LUA_NATIVE_FILES_GET_HASH_NAME_FOR_COMPONENT);
-		FILES.set_function("GET_HASH_NAME_FOR_PROP", LUA_NATIVE_FILES_GET_HASH_NAME_FOR_PROP);
-		FILES.set_function("GET_SHOP_PED_APPAREL_VARIANT_COMPONENT_COUNT", LUA_NATIVE_FILES_GET_SHOP_PED_APPAREL_VARIANT_COMPONENT_COUNT);
-		FILES.set_function("GET_SHOP_PED_APPAREL_VARIANT_PROP_COUNT", LUA_NATIVE_FILES_GET_SHOP_PED_APPAREL_VARIANT_PROP_COUNT);
-		FILES.set_function("GET_VARIANT_COMPONENT", LUA_NATIVE_FILES_GET_VARIANT_COMPONENT);
-		FILES.set_function("GET_VARIANT_PROP", LUA_NATIVE_FILES_GET_VARIANT_PROP);
-		FILES.set_function("GET_SHOP_PED_APPAREL_FORCED_COMPONENT_COUNT", LUA_NATIVE_FILES_GET_SHOP_PED_APPAREL_FORCED_COMPONENT_COUNT);
-		FILES.set_function("GET_SHOP_PED_APPAREL_FORCED_PROP_COUNT", LUA_NATIVE_FILES_GET_SHOP_PED_APPAREL_FORCED_PROP_COUNT);
-		FILES.set_function("GET_FORCED_COMPONENT", LUA_NATIVE_FILES_GET_FORCED_COMPONENT);
-		FILES.set_function("GET_FORCED_PROP", LUA_NATIVE_FILES_GET_FORCED_PROP);
-		FILES.set_function("DOES_SHOP_PED_APPAREL_HAVE_RESTRICTION_TAG", LUA_NATIVE_FILES_DOES_SHOP_PED_APPAREL_HAVE_RESTRICTION_TAG);
-		FILES.set_function("DOES_CURRENT_PED_COMPONENT_HAVE_RESTRICTION_TAG", LUA_NATIVE_FILES_DOES_CURRENT_PED_COMPONENT_HAVE_RESTRICTION_TAG);
-		FILES.set_function("DOES_CURRENT_PED_PROP_HAVE_RESTRICTION_TAG", LUA_NATIVE_FILES_DOES_CURRENT_PED_PROP_HAVE_RESTRICTION_TAG);
-		FILES.set_function("SETUP_SHOP_PED_OUTFIT_QUERY", LUA_NATIVE_FILES_SETUP_SHOP_PED_OUTFIT_QUERY);
-		FILES.set_function("GET_SHOP_PED_QUERY_OUTFIT", LUA_NATIVE_FILES_GET_SHOP_PED_QUERY_OUTFIT);
-		FILES.set_function("GET_SHOP_PED_OUTFIT", LUA_NATIVE_FILES_GET_SHOP_PED_OUTFIT);
-		FILES.set_function("GET_SHOP_PED_OUTFIT_LOCATE", LUA_NATIVE_FILES_GET_SHOP_PED_OUTFIT_LOCATE);
-		FILES.set_function("GET_SHOP_PED_OUTFIT_PROP_VARIANT", LUA_NATIVE_FILES_GET_SHOP_PED_OUTFIT_PROP_VARIANT);
-		FILES.set_function("GET_SHOP_PED_OUTFIT_COMPONENT_VARIANT", LUA_NATIVE_FILES_GET_SHOP_PED_OUTFIT_COMPONENT_VARIANT);
-		FILES.set_function("GET_NUM_DLC_VEHICLES", LUA_NATIVE_FILES_GET_NUM_DLC_VEHICLES);
-		FILES.set_function("GET_DLC_VEHICLE_MODEL", LUA_NATIVE_FILES_GET_DLC_VEHICLE_MODEL);
-		FILES.set_function("GET_DLC_VEHICLE_DATA", LUA_NATIVE_FILES_GET_DLC_VEHICLE_DATA);
-		FILES.set_function("GET_DLC_VEHICLE_FLAGS", LUA_NATIVE_FILES_GET_DLC_VEHICLE_FLAGS);
-		FILES.set_function("GET_NUM_DLC_WEAPONS", LUA_NATIVE_FILES_GET_NUM_DLC_WEAPONS);
-		FILES.set_function("GET_NUM_DLC_WEAPONS_SP", LUA_NATIVE_FILES_GET_NUM_DLC_WEAPONS_SP);
-		FILES.set_function("GET_DLC_WEAPON_DATA", LUA_NATIVE_FILES_GET_DLC_WEAPON_DATA);
-		FILES.set_function("GET_DLC_WEAPON_DATA_SP", LUA_NATIVE_FILES_GET_DLC_WEAPON_DATA_SP);
-		FILES.set_function("GET_NUM_DLC_WEAPON_COMPONENTS", LUA_NATIVE_FILES_GET_NUM_DLC_WEAPON_COMPONENTS);
-		FILES.set_function("GET_NUM_DLC_WEAPON_COMPONENTS_SP", LUA_NATIVE_FILES_GET_NUM_DLC_WEAPON_COMPONENTS_SP);
-		FILES.set_function("GET_DLC_WEAPON_COMPONENT_DATA", LUA_NATIVE_FILES_GET_DLC_WEAPON_COMPONENT_DATA);
-		FILES.set_function("GET_DLC_WEAPON_COMPONENT_DATA_SP", LUA_NATIVE_FILES_GET_DLC_WEAPON_COMPONENT_DATA_SP);
-		FILES.set_function("IS_CONTENT_ITEM_LOCKED", LUA_NATIVE_FILES_IS_CONTENT_ITEM_LOCKED);
-		FILES.set_function("IS_DLC_VEHICLE_MOD", LUA_NATIVE_FILES_IS_DLC_VEHICLE_MOD);
-		FILES.set_function("GET_DLC_VEHICLE_MOD_LOCK_HASH", LUA_NATIVE_FILES_GET_DLC_VEHICLE_MOD_LOCK_HASH);
-		FILES.set_function("EXECUTE_CONTENT_CHANGESET_GROUP_FOR_ALL", LUA_NATIVE_FILES_EXECUTE_CONTENT_CHANGESET_GROUP_FOR_ALL);
-		FILES.set_function("REVERT_CONTENT_CHANGESET_GROUP_FOR_ALL", LUA_NATIVE_FILES_REVERT_CONTENT_CHANGESET_GROUP_FOR_ALL);
+		bind_namespace(L, "FILES", FILES_natives);
 	}
 }
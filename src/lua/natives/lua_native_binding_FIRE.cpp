@@ -112,26 +112,29 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry FIRE_natives[] = {
+		{"ADD_EXPLOSION", native_function<LUA_NATIVE_FIRE_ADD_EXPLOSION>},
+		{"ADD_EXPLOSION_WITH_USER_VFX", native_function<LUA_NATIVE_FIRE_ADD_EXPLOSION_WITH_USER_VFX>},
+		{"ADD_OWNED_EXPLOSION", native_function<LUA_NATIVE_FIRE_ADD_OWNED_EXPLOSION>},
+		{"GET_CLOSEST_FIRE_POS", native_function<LUA_NATIVE_FIRE_GET_CLOSEST_FIRE_POS>},
+		{"GET_NUMBER_OF_FIRES_IN_RANGE", native_function<LUA_NATIVE_FIRE_GET_NUMBER_OF_FIRES_IN_RANGE>},
+		{"GET_OWNER_OF_EXPLOSION_IN_ANGLED_AREA", native_function<LUA_NATIVE_FIRE_GET_OWNER_OF_EXPLOSION_IN_ANGLED_AREA>},
+		{"GET_OWNER_OF_EXPLOSION_IN_SPHERE", native_function<LUA_NATIVE_FIRE_GET_OWNER_OF_EXPLOSION_IN_SPHERE>},
+		{"IS_ENTITY_ON_FIRE", native_function<LUA_NATIVE_FIRE_IS_ENTITY_ON_FIRE>},
+		{"IS_EXPLOSION_ACTIVE_IN_AREA", native_function<LUA_NATIVE_FIRE_IS_EXPLOSION_ACTIVE_IN_AREA>},
+		{"IS_EXPLOSION_IN_ANGLED_AREA", native_function<LUA_NATIVE_FIRE_IS_EXPLOSION_IN_ANGLED_AREA>},
+		{"IS_EXPLOSION_IN_AREA", native_function<LUA_NATIVE_FIRE_IS_EXPLOSION_IN_AREA>},
+		{"IS_EXPLOSION_IN_SPHERE", native_function<LUA_NATIVE_FIRE_IS_EXPLOSION_IN_SPHERE>},
+		{"REMOVE_SCRIPT_FIRE", native_function<LUA_NATIVE_FIRE_REMOVE_SCRIPT_FIRE>},
+		{"SET_FLAMMABILITY_MULTIPLIER", native_function<LUA_NATIVE_FIRE_SET_FLAMMABILITY_MULTIPLIER>},
+		{"START_ENTITY_FIRE", native_function<LUA_NATIVE_FIRE_START_ENTITY_FIRE>},
+		{"START_SCRIPT_FIRE", native_function<LUA_NATIVE_FIRE_START_SCRIPT_FIRE>},
+		{"STOP_ENTITY_FIRE", native_function<LUA_NATIVE_FIRE_STOP_ENTITY_FIRE>},
+		{"STOP_FIRE_IN_RANGE", native_function<LUA_NATIVE_FIRE_STOP_FIRE_IN_RANGE>},
+	};
+
 	void init_native_binding_FIRE(sol::state& L)
 	{
-		auto FIRE = L["FIRE"].get_or_create<sol::table>();
-		FIRE.set_function("START_SCRIPT_FIRE", LUA_NATIVE_FIRE_START_SCRIPT_FIRE);
-		FIRE.set_function("REMOVE_SCRIPT_FIRE", LUA_NATIVE_FIRE_REMOVE_SCRIPT_FIRE);
-		FIRE.set_function("START_ENTITY_FIRE", LUA_NATIVE_FIRE_START_ENTITY_FIRE);
-		FIRE.set_function("STOP_ENTITY_FIRE", LUA_NATIVE_FIRE_STOP_ENTITY_FIRE);
-		FIRE.set_function("IS_ENTITY_ON_FIRE", LUA_NATIVE_FIRE_IS_ENTITY_ON_FIRE);
-		FIRE.set_function("GET_NUMBER_OF_FIRES_IN_RANGE", LUA_NATIVE_FIRE_GET_NUMBER_OF_FIRES_IN_RANGE);
-		FIRE.set_function("SET_FLAMMABILITY_MULTIPLIER", LUA_NATIVE_FIRE_SET_FLAMMABILITY_MULTIPLIER);
-		FIRE.set_function("STOP_FIRE_IN_RANGE", LUA_NATIVE_FIRE_STOP_FIRE_IN_RANGE);
-		FIRE.set_function("GET_CLOSEST_FIRE_POS", LUA_NATIVE_FIRE_GET_CLOSEST_FIRE_POS);
-		FIRE.set_function("ADD_EXPLOSION", LUA_NATIVE_FIRE_ADD_EXPLOSION);
-		FIRE.set_function("ADD_OWNED_EXPLOSION", LUA_NATIVE_FIRE_ADD_OWNED_EXPLOSION);
-		FIRE.set_function("ADD_EXPLOSION_WITH_USER_VFX", LUA_NATIVE_FIRE_ADD_EXPLOSION_WITH_USER_VFX);
-		FIRE.set_function("IS_EXPLOSION_IN_AREA", LUA_NATIVE_FIRE_IS_EXPLOSION_IN_AREA);
-		FIRE.set_function("IS_EXPLOSION_ACTIVE_IN_AREA", LUA_NATIVE_FIRE_IS_EXPLOSION_ACTIVE_IN_AREA);
-		FIRE.set_function("IS_EXPLOSION_IN_SPHERE", LUA_NATIVE_FIRE_IS_EXPLOSION_IN_SPHERE);
-		FIRE.set_function("GET_OWNER_OF_EXPLOSION_IN_SPHERE", LUA_NATIVE_FIRE_GET_OWNER_OF_EXPLOSION_IN_SPHERE);
-		FIRE.set_function("IS_EXPLOSION_IN_ANGLED_AREA", LUA_NATIVE_FIRE_IS_EXPLOSION_IN_ANGLED_AREA);
-		FIRE.set_function("GET_OWNER_OF_EXPLOSION_IN_ANGLED_AREA", LUA_NATIVE_FIRE_GET_OWNER_OF_EXPLOSION_IN_ANGLED_AREA);
+		bind_namespace(L, "FIRE", FIRE_natives);
 	}
 }
@@ -2131,406 +2131,409 @@ namespace lua::native
 		GRAPHICS::ANIMPOSTFX_STOP_AND_FLUSH_REQUESTS(effectName.is<const char*>() ? effectName.as<const char*>() : nullptr);
 	}
 
+	static constexpr native_entry GRAPHICS_natives[] = {
+		{"ABORT_VEHICLE_CREW_EMBLEM_REQUEST", native_function<LUA_NATIVE_GRAPHICS_ABORT_VEHICLE_CREW_EMBLEM_REQUEST>},
+		{"ADD_DECAL", native_function<LUA_NATIVE_GRAPHICS_ADD_DECAL>},
+		{"ADD_ENTITY_ICON", native_function<LUA_NATIVE_GRAPHICS_ADD_ENTITY_ICON>},
+		{"ADD_OIL_DECAL", native_function<LUA_NATIVE_GRAPHICS_ADD_OIL_DECAL>},
+		{"ADD_PETROL_DECAL", native_function<LUA_NATIVE_GRAPHICS_ADD_PETROL_DECAL>},
+		{"ADD_PETROL_TRAIL_DECAL_INFO", native_function<LUA_NATIVE_GRAPHICS_ADD_PETROL_TRAIL_DECAL_INFO>},
+		{"ADD_TCMODIFIER_OVERRIDE", native_function<LUA_NATIVE_GRAPHICS_ADD_TCMODIFIER_OVERRIDE>},
+		{"ADD_VEHICLE_CREW_EMBLEM", native_function<LUA_NATIVE_GRAPHICS_ADD_VEHICLE_CREW_EMBLEM>},
+		{"ADJUST_NEXT_POS_SIZE_AS_NORMALIZED_16_9", native_function<LUA_NATIVE_GRAPHICS_ADJUST_NEXT_POS_SIZE_AS_NORMALIZED_16_9>},
+		{"ANIMPOSTFX_GET_CURRENT_TIME", native_function<LUA_NATIVE_GRAPHICS_ANIMPOSTFX_GET_CURRENT_TIME>},
+		{"ANIMPOSTFX_IS_RUNNING", native_function<LUA_NATIVE_GRAPHICS_ANIMPOSTFX_IS_RUNNING>},
+		{"ANIMPOSTFX_PLAY", native_function<LUA_NATIVE_GRAPHICS_ANIMPOSTFX_PLAY>},
+		{"ANIMPOSTFX_STOP", native_function<LUA_NATIVE_GRAPHICS_ANIMPOSTFX_STOP>},
+		{"ANIMPOSTFX_STOP_ALL", native_function<LUA_NATIVE_GRAPHICS_ANIMPOSTFX_STOP_ALL>},
+		{"ANIMPOSTFX_STOP_AND_FLUSH_REQUESTS", native_function<LUA_NATIVE_GRAPHICS_ANIMPOSTFX_STOP_AND_FLUSH_REQUESTS>},
+		{"ATTACH_TV_AUDIO_TO_ENTITY", native_function<LUA_NATIVE_GRAPHICS_ATTACH_TV_AUDIO_TO_ENTITY>},
+		{"BEGIN_CREATE_LOW_QUALITY_COPY_OF_PHOTO", native_function<LUA_NATIVE_GRAPHICS_BEGIN_CREATE_LOW_QUALITY_COPY_OF_PHOTO>},
+		{"BEGIN_CREATE_MISSION_CREATOR_PHOTO_PREVIEW", native_function<LUA_NATIVE_GRAPHICS_BEGIN_CREATE_MISSION_CREATOR_PHOTO_PREVIEW>},
+		{"BEGIN_SCALEFORM_MOVIE_METHOD", native_function<LUA_NATIVE_GRAPHICS_BEGIN_SCALEFORM_MOVIE_METHOD>},
+		{"BEGIN_SCALEFORM_MOVIE_METHOD_ON_FRONTEND", native_function<LUA_NATIVE_GRAPHICS_BEGIN_SCALEFORM_MOVIE_METHOD_ON_FRONTEND>},
+		{"BEGIN_SCALEFORM_MOVIE_METHOD_ON_FRONTEND_HEADER", native_function<LUA_NATIVE_GRAPHICS_BEGIN_SCALEFORM_MOVIE_METHOD_ON_FRONTEND_HEADER>},
+		{"BEGIN_SCALEFORM_SCRIPT_HUD_MOVIE_METHOD", native_function<LUA_NATIVE_GRAPHICS_BEGIN_SCALEFORM_SCRIPT_HUD_MOVIE_METHOD>},
+		{"BEGIN_TAKE_HIGH_QUALITY_PHOTO", native_function<LUA_NATIVE_GRAPHICS_BEGIN_TAKE_HIGH_QUALITY_PHOTO>},
+		{"BEGIN_TAKE_MISSION_CREATOR_PHOTO", native_function<LUA_NATIVE_GRAPHICS_BEGIN_TAKE_MISSION_CREATOR_PHOTO>},
+		{"BEGIN_TEXT_COMMAND_SCALEFORM_STRING", native_function<LUA_NATIVE_GRAPHICS_BEGIN_TEXT_COMMAND_SCALEFORM_STRING>},
+		{"CALL_SCALEFORM_MOVIE_METHOD", native_function<LUA_NATIVE_GRAPHICS_CALL_SCALEFORM_MOVIE_METHOD>},
+		{"CALL_SCALEFORM_MOVIE_METHOD_WITH_NUMBER", native_function<LUA_NATIVE_GRAPHICS_CALL_SCALEFORM_MOVIE_METHOD_WITH_NUMBER>},
+		{"CALL_SCALEFORM_MOVIE_METHOD_WITH_NUMBER_AND_STRING", native_function<LUA_NATIVE_GRAPHICS_CALL_SCALEFORM_MOVIE_METHOD_WITH_NUMBER_AND_STRING>},
+		{"CALL_SCALEFORM_MOVIE_METHOD_WITH_STRING", native_function<LUA_NATIVE_GRAPHICS_CALL_SCALEFORM_MOVIE_METHOD_WITH_STRING>},
+		{"CASCADE_SHADOWS_CLEAR_SHADOW_SAMPLE_TYPE", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_CLEAR_SHADOW_SAMPLE_TYPE>},
+		{"CASCADE_SHADOWS_ENABLE_ENTITY_TRACKER", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_ENABLE_ENTITY_TRACKER>},
+		{"CASCADE_SHADOWS_ENABLE_FREEZER", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_ENABLE_FREEZER>},
+		{"CASCADE_SHADOWS_INIT_SESSION", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_INIT_SESSION>},
+		{"CASCADE_SHADOWS_SET_AIRCRAFT_MODE", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_AIRCRAFT_MODE>},
+		{"CASCADE_SHADOWS_SET_BOUND_POSITION", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_BOUND_POSITION>},
+		{"CASCADE_SHADOWS_SET_CASCADE_BOUNDS", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_CASCADE_BOUNDS>},
+		{"CASCADE_SHADOWS_SET_CASCADE_BOUNDS_SCALE", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_CASCADE_BOUNDS_SCALE>},
+		{"CASCADE_SHADOWS_SET_DYNAMIC_DEPTH_MODE", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_DYNAMIC_DEPTH_MODE>},
+		{"CASCADE_SHADOWS_SET_DYNAMIC_DEPTH_VALUE", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_DYNAMIC_DEPTH_VALUE>},
+		{"CASCADE_SHADOWS_SET_ENTITY_TRACKER_SCALE", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_ENTITY_TRACKER_SCALE>},
+		{"CASCADE_SHADOWS_SET_SCREEN_SIZE_CHECK_ENABLED", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_SCREEN_SIZE_CHECK_ENABLED>},
+		{"CASCADE_SHADOWS_SET_SHADOW_SAMPLE_TYPE", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_SHADOW_SAMPLE_TYPE>},
+		{"CASCADE_SHADOWS_SET_SPLIT_Z_EXP_WEIGHT", native_function<LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_SPLIT_Z_EXP_WEIGHT>},
+		{"CLEAR_ALL_TCMODIFIER_OVERRIDES", native_function<LUA_NATIVE_GRAPHICS_CLEAR_ALL_TCMODIFIER_OVERRIDES>},
+		{"CLEAR_DRAW_ORIGIN", native_function<LUA_NATIVE_GRAPHICS_CLEAR_DRAW_ORIGIN>},
+		{"CLEAR_EXTRA_TCMODIFIER", native_function<LUA_NATIVE_GRAPHICS_CLEAR_EXTRA_TCMODIFIER>},
+		{"CLEAR_PARTICLE_FX_SHOOTOUT_BOAT", native_function<LUA_NATIVE_GRAPHICS_CLEAR_PARTICLE_FX_SHOOTOUT_BOAT>},
+		{"CLEAR_STATUS_OF_SORTED_LIST_OPERATION", native_function<LUA_NATIVE_GRAPHICS_CLEAR_STATUS_OF_SORTED_LIST_OPERATION>},
+		{"CLEAR_TIMECYCLE_MODIFIER", native_function<LUA_NATIVE_GRAPHICS_CLEAR_TIMECYCLE_MODIFIER>},
+		{"CLEAR_TV_CHANNEL_PLAYLIST", native_function<LUA_NATIVE_GRAPHICS_CLEAR_TV_CHANNEL_PLAYLIST>},
+		{"CREATE_CHECKPOINT", native_function<LUA_NATIVE_GRAPHICS_CREATE_CHECKPOINT>},
+		{"CREATE_TRACKED_POINT", native_function<LUA_NATIVE_GRAPHICS_CREATE_TRACKED_POINT>},
+		{"DELETE_CHECKPOINT", native_function<LUA_NATIVE_GRAPHICS_DELETE_CHECKPOINT>},
+		{"DESTROY_TRACKED_POINT", native_function<LUA_NATIVE_GRAPHICS_DESTROY_TRACKED_POINT>},
+		{"DISABLE_COMPOSITE_SHOTGUN_DECALS", native_function<LUA_NATIVE_GRAPHICS_DISABLE_COMPOSITE_SHOTGUN_DECALS>},
+		{"DISABLE_DOWNWASH_PTFX", native_function<LUA_NATIVE_GRAPHICS_DISABLE_DOWNWASH_PTFX>},
+		{"DISABLE_HDTEX_THIS_FRAME", native_function<LUA_NATIVE_GRAPHICS_DISABLE_HDTEX_THIS_FRAME>},
+		{"DISABLE_IN_WATER_PTFX", native_function<LUA_NATIVE_GRAPHICS_DISABLE_IN_WATER_PTFX>},
+		{"DISABLE_MOON_CYCLE_OVERRIDE", native_function<LUA_NATIVE_GRAPHICS_DISABLE_MOON_CYCLE_OVERRIDE>},
+		{"DISABLE_OCCLUSION_THIS_FRAME", native_function<LUA_NATIVE_GRAPHICS_DISABLE_OCCLUSION_THIS_FRAME>},
+		{"DISABLE_PROCOBJ_CREATION", native_function<LUA_NATIVE_GRAPHICS_DISABLE_PROCOBJ_CREATION>},
+		{"DISABLE_REGION_VFX", native_function<LUA_NATIVE_GRAPHICS_DISABLE_REGION_VFX>},
+		{"DISABLE_SCREENBLUR_FADE", native_function<LUA_NATIVE_GRAPHICS_DISABLE_SCREENBLUR_FADE>},
+		{"DISABLE_SCUFF_DECALS", native_function<LUA_NATIVE_GRAPHICS_DISABLE_SCUFF_DECALS>},
+		{"DISABLE_VEHICLE_DISTANTLIGHTS", native_function<LUA_NATIVE_GRAPHICS_DISABLE_VEHICLE_DISTANTLIGHTS>},
+		{"DOES_LATEST_BRIEF_STRING_EXIST", native_function<LUA_NATIVE_GRAPHICS_DOES_LATEST_BRIEF_STRING_EXIST>},
+		{"DOES_PARTICLE_FX_LOOPED_EXIST", native_function<LUA_NATIVE_GRAPHICS_DOES_PARTICLE_FX_LOOPED_EXIST>},
+		{"DOES_THIS_PHOTO_SLOT_CONTAIN_A_VALID_PHOTO", native_function<LUA_NATIVE_GRAPHICS_DOES_THIS_PHOTO_SLOT_CONTAIN_A_VALID_PHOTO>},
+		{"DOES_VEHICLE_HAVE_CREW_EMBLEM", native_function<LUA_NATIVE_GRAPHICS_DOES_VEHICLE_HAVE_CREW_EMBLEM>},
+		{"DONT_RENDER_IN_GAME_UI", native_function<LUA_NATIVE_GRAPHICS_DONT_RENDER_IN_GAME_UI>},
+		{"DRAW_BINK_MOVIE", native_function<LUA_NATIVE_GRAPHICS_DRAW_BINK_MOVIE>},
+		{"DRAW_BOX", native_function<LUA_NATIVE_GRAPHICS_DRAW_BOX>},
+		{"DRAW_DEBUG_BOX", native_function<LUA_NATIVE_GRAPHICS_DRAW_DEBUG_BOX>},
+		{"DRAW_DEBUG_CROSS", native_function<LUA_NATIVE_GRAPHICS_DRAW_DEBUG_CROSS>},
+		{"DRAW_DEBUG_LINE", native_function<LUA_NATIVE_GRAPHICS_DRAW_DEBUG_LINE>},
+		{"DRAW_DEBUG_LINE_WITH_TWO_COLOURS", native_function<LUA_NATIVE_GRAPHICS_DRAW_DEBUG_LINE_WITH_TWO_COLOURS>},
+		{"DRAW_DEBUG_SPHERE", native_function<LUA_NATIVE_GRAPHICS_DRAW_DEBUG_SPHERE>},
+		{"DRAW_DEBUG_TEXT", native_function<LUA_NATIVE_GRAPHICS_DRAW_DEBUG_TEXT>},
+		{"DRAW_DEBUG_TEXT_2D", native_function<LUA_NATIVE_GRAPHICS_DRAW_DEBUG_TEXT_2D>},
+		{"DRAW_LIGHT_WITH_RANGE", native_function<LUA_NATIVE_GRAPHICS_DRAW_LIGHT_WITH_RANGE>},
+		{"DRAW_LIGHT_WITH_RANGEEX", native_function<LUA_NATIVE_GRAPHICS_DRAW_LIGHT_WITH_RANGEEX>},
+		{"DRAW_LINE", native_function<LUA_NATIVE_GRAPHICS_DRAW_LINE>},
+		{"DRAW_LOW_QUALITY_PHOTO_TO_PHONE", native_function<LUA_NATIVE_GRAPHICS_DRAW_LOW_QUALITY_PHOTO_TO_PHONE>},
+		{"DRAW_MARKER", native_function<LUA_NATIVE_GRAPHICS_DRAW_MARKER>},
+		{"DRAW_MARKER_EX", native_function<LUA_NATIVE_GRAPHICS_DRAW_MARKER_EX>},
+		{"DRAW_MARKER_SPHERE", native_function<LUA_NATIVE_GRAPHICS_DRAW_MARKER_SPHERE>},
+		{"DRAW_POLY", native_function<LUA_NATIVE_GRAPHICS_DRAW_POLY>},
+		{"DRAW_RECT", native_function<LUA_NATIVE_GRAPHICS_DRAW_RECT>},
+		{"DRAW_SCALEFORM_MOVIE", native_function<LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE>},
+		{"DRAW_SCALEFORM_MOVIE_3D", native_function<LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE_3D>},
+		{"DRAW_SCALEFORM_MOVIE_3D_SOLID", native_function<LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE_3D_SOLID>},
+		{"DRAW_SCALEFORM_MOVIE_FULLSCREEN", native_function<LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE_FULLSCREEN>},
+		{"DRAW_SCALEFORM_MOVIE_FULLSCREEN_MASKED", native_function<LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE_FULLSCREEN_MASKED>},
+		{"DRAW_SHADOWED_SPOT_LIGHT", native_function<LUA_NATIVE_GRAPHICS_DRAW_SHADOWED_SPOT_LIGHT>},
+		{"DRAW_SPOT_LIGHT", native_function<LUA_NATIVE_GRAPHICS_DRAW_SPOT_LIGHT>},
+		{"DRAW_SPRITE", native_function<LUA_NATIVE_GRAPHICS_DRAW_SPRITE>},
+		{"DRAW_SPRITE_ARX", native_function<LUA_NATIVE_GRAPHICS_DRAW_SPRITE_ARX>},
+		{"DRAW_SPRITE_ARX_WITH_UV", native_function<LUA_NATIVE_GRAPHICS_DRAW_SPRITE_ARX_WITH_UV>},
+		{"DRAW_SPRITE_NAMED_RENDERTARGET", native_function<LUA_NATIVE_GRAPHICS_DRAW_SPRITE_NAMED_RENDERTARGET>},
+		{"DRAW_TEXTURED_POLY", native_function<LUA_NATIVE_GRAPHICS_DRAW_TEXTURED_POLY>},
+		{"DRAW_TV_CHANNEL", native_function<LUA_NATIVE_GRAPHICS_DRAW_TV_CHANNEL>},
+		{"ENABLE_ALIEN_BLOOD_VFX", native_function<LUA_NATIVE_GRAPHICS_ENABLE_ALIEN_BLOOD_VFX>},
+		{"ENABLE_CLOWN_BLOOD_VFX", native_function<LUA_NATIVE_GRAPHICS_ENABLE_CLOWN_BLOOD_VFX>},
+		{"ENABLE_MOON_CYCLE_OVERRIDE", native_function<LUA_NATIVE_GRAPHICS_ENABLE_MOON_CYCLE_OVERRIDE>},
+		{"ENABLE_MOVIE_KEYFRAME_WAIT", native_function<LUA_NATIVE_GRAPHICS_ENABLE_MOVIE_KEYFRAME_WAIT>},
+		{"ENABLE_MOVIE_SUBTITLES", native_function<LUA_NATIVE_GRAPHICS_ENABLE_MOVIE_SUBTITLES>},
+		{"ENABLE_PROCOBJ_CREATION", native_function<LUA_NATIVE_GRAPHICS_ENABLE_PROCOBJ_CREATION>},
+		{"END_PETROL_TRAIL_DECALS", native_function<LUA_NATIVE_GRAPHICS_END_PETROL_TRAIL_DECALS>},
+		{"END_SCALEFORM_MOVIE_METHOD", native_function<LUA_NATIVE_GRAPHICS_END_SCALEFORM_MOVIE_METHOD>},
+		{"END_SCALEFORM_MOVIE_METHOD_RETURN_VALUE", native_function<LUA_NATIVE_GRAPHICS_END_SCALEFORM_MOVIE_METHOD_RETURN_VALUE>},
+		{"END_TEXT_COMMAND_SCALEFORM_STRING", native_function<LUA_NATIVE_GRAPHICS_END_TEXT_COMMAND_SCALEFORM_STRING>},
+		{"END_TEXT_COMMAND_UNPARSED_SCALEFORM_STRING", native_function<LUA_NATIVE_GRAPHICS_END_TEXT_COMMAND_UNPARSED_SCALEFORM_STRING>},
+		{"FADE_DECALS_IN_RANGE", native_function<LUA_NATIVE_GRAPHICS_FADE_DECALS_IN_RANGE>},
+		{"FADE_UP_PED_LIGHT", native_function<LUA_NATIVE_GRAPHICS_FADE_UP_PED_LIGHT>},
+		{"FORCE_ALLOW_SNOW_FOOT_VFX_ON_ICE_", native_function<LUA_NATIVE_GRAPHICS_FORCE_ALLOW_SNOW_FOOT_VFX_ON_ICE_>},
+		{"FORCE_EXPOSURE_READBACK", native_function<LUA_NATIVE_GRAPHICS_FORCE_EXPOSURE_READBACK>},
+		{"FORCE_GROUND_SNOW_PASS_", native_function<LUA_NATIVE_GRAPHICS_FORCE_GROUND_SNOW_PASS_>},
+		{"FORCE_PARTICLE_FX_IN_VEHICLE_INTERIOR", native_function<LUA_NATIVE_GRAPHICS_FORCE_PARTICLE_FX_IN_VEHICLE_INTERIOR>},
+		{"FORCE_POSTFX_BULLET_IMPACTS_AFTER_HUD", native_function<LUA_NATIVE_GRAPHICS_FORCE_POSTFX_BULLET_IMPACTS_AFTER_HUD>},
+		{"FORCE_RENDER_IN_GAME_UI", native_function<LUA_NATIVE_GRAPHICS_FORCE_RENDER_IN_GAME_UI>},
+		{"FREE_MEMORY_FOR_HIGH_QUALITY_PHOTO", native_function<LUA_NATIVE_GRAPHICS_FREE_MEMORY_FOR_HIGH_QUALITY_PHOTO>},
+		{"FREE_MEMORY_FOR_LOW_QUALITY_PHOTO", native_function<LUA_NATIVE_GRAPHICS_FREE_MEMORY_FOR_LOW_QUALITY_PHOTO>},
+		{"FREE_MEMORY_FOR_MISSION_CREATOR_PHOTO", native_function<LUA_NATIVE_GRAPHICS_FREE_MEMORY_FOR_MISSION_CREATOR_PHOTO>},
+		{"FREE_MEMORY_FOR_MISSION_CREATOR_PHOTO_PREVIEW", native_function<LUA_NATIVE_GRAPHICS_FREE_MEMORY_FOR_MISSION_CREATOR_PHOTO_PREVIEW>},
+		{"GET_ACTUAL_SCREEN_RESOLUTION", native_function<LUA_NATIVE_GRAPHICS_GET_ACTUAL_SCREEN_RESOLUTION>},
+		{"GET_ASPECT_RATIO", native_function<LUA_NATIVE_GRAPHICS_GET_ASPECT_RATIO>},
+		{"GET_BINK_MOVIE_TIME", native_function<LUA_NATIVE_GRAPHICS_GET_BINK_MOVIE_TIME>},
+		{"GET_CURRENT_NUMBER_OF_CLOUD_PHOTOS", native_function<LUA_NATIVE_GRAPHICS_GET_CURRENT_NUMBER_OF_CLOUD_PHOTOS>},
+		{"GET_CURRENT_TV_CLIP_NAMEHASH", native_function<LUA_NATIVE_GRAPHICS_GET_CURRENT_TV_CLIP_NAMEHASH>},
+		{"GET_DECAL_WASH_LEVEL", native_function<LUA_NATIVE_GRAPHICS_GET_DECAL_WASH_LEVEL>},
+		{"GET_EXTRA_TCMODIFIER", native_function<LUA_NATIVE_GRAPHICS_GET_EXTRA_TCMODIFIER>},
+		{"GET_IS_HIDEF", native_function<LUA_NATIVE_GRAPHICS_GET_IS_HIDEF>},
+		{"GET_IS_PETROL_DECAL_IN_RANGE", native_function<LUA_NATIVE_GRAPHICS_GET_IS_PETROL_DECAL_IN_RANGE>},
+		{"GET_IS_TIMECYCLE_TRANSITIONING_OUT", native_function<LUA_NATIVE_GRAPHICS_GET_IS_TIMECYCLE_TRANSITIONING_OUT>},
+		{"GET_IS_WIDESCREEN", native_function<LUA_NATIVE_GRAPHICS_GET_IS_WIDESCREEN>},
+		{"GET_LIGHT_OVERRIDE_MAX_INTENSITY_SCALE", native_function<LUA_NATIVE_GRAPHICS_GET_LIGHT_OVERRIDE_MAX_INTENSITY_SCALE>},
+		{"GET_LOAD_HIGH_QUALITY_PHOTO_STATUS", native_function<LUA_NATIVE_GRAPHICS_GET_LOAD_HIGH_QUALITY_PHOTO_STATUS>},
+		{"GET_MAXIMUM_NUMBER_OF_CLOUD_PHOTOS", native_function<LUA_NATIVE_GRAPHICS_GET_MAXIMUM_NUMBER_OF_CLOUD_PHOTOS>},
+		{"GET_MAXIMUM_NUMBER_OF_PHOTOS", native_function<LUA_NATIVE_GRAPHICS_GET_MAXIMUM_NUMBER_OF_PHOTOS>},
+		{"GET_MOTIONBLUR_MAX_VEL_SCALER", native_function<LUA_NATIVE_GRAPHICS_GET_MOTIONBLUR_MAX_VEL_SCALER>},
+		{"GET_REQUESTINGNIGHTVISION", native_function<LUA_NATIVE_GRAPHICS_GET_REQUESTINGNIGHTVISION>},
+		{"GET_SAFE_ZONE_SIZE", native_function<LUA_NATIVE_GRAPHICS_GET_SAFE_ZONE_SIZE>},
+		{"GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_BOOL", native_function<LUA_NATIVE_GRAPHICS_GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_BOOL>},
+		{"GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_INT", native_function<LUA_NATIVE_GRAPHICS_GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_INT>},
+		{"GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_STRING", native_function<LUA_NATIVE_GRAPHICS_GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_STRING>},
+		{"GET_SCREENBLUR_FADE_CURRENT_TIME", native_function<LUA_NATIVE_GRAPHICS_GET_SCREENBLUR_FADE_CURRENT_TIME>},
+		{"GET_SCREEN_ASPECT_RATIO", native_function<LUA_NATIVE_GRAPHICS_GET_SCREEN_ASPECT_RATIO>},
+		{"GET_SCREEN_COORD_FROM_WORLD_COORD", native_function<LUA_NATIVE_GRAPHICS_GET_SCREEN_COORD_FROM_WORLD_COORD>},
+		{"GET_SCREEN_RESOLUTION", native_function<LUA_NATIVE_GRAPHICS_GET_SCREEN_RESOLUTION>},
+		{"GET_SCRIPT_GFX_ALIGN_POSITION", native_function<LUA_NATIVE_GRAPHICS_GET_SCRIPT_GFX_ALIGN_POSITION>},
+		{"GET_STATUS_OF_CREATE_LOW_QUALITY_COPY_OF_PHOTO", native_function<LUA_NATIVE_GRAPHICS_GET_STATUS_OF_CREATE_LOW_QUALITY_COPY_OF_PHOTO>},
+		{"GET_STATUS_OF_CREATE_MISSION_CREATOR_PHOTO_PREVIEW", native_function<LUA_NATIVE_GRAPHICS_GET_STATUS_OF_CREATE_MISSION_CREATOR_PHOTO_PREVIEW>},
+		{"GET_STATUS_OF_LOAD_MISSION_CREATOR_PHOTO", native_function<LUA_NATIVE_GRAPHICS_GET_STATUS_OF_LOAD_MISSION_CREATOR_PHOTO>},
+		{"GET_STATUS_OF_SAVE_HIGH_QUALITY_PHOTO", native_function<LUA_NATIVE_GRAPHICS_GET_STATUS_OF_SAVE_HIGH_QUALITY_PHOTO>},
+		{"GET_STATUS_OF_SORTED_LIST_OPERATION", native_function<LUA_NATIVE_GRAPHICS_GET_STATUS_OF_SORTED_LIST_OPERATION>},
+		{"GET_STATUS_OF_TAKE_HIGH_QUALITY_PHOTO", native_function<LUA_NATIVE_GRAPHICS_GET_STATUS_OF_TAKE_HIGH_QUALITY_PHOTO>},
+		{"GET_STATUS_OF_TAKE_MISSION_CREATOR_PHOTO", native_function<LUA_NATIVE_GRAPHICS_GET_STATUS_OF_TAKE_MISSION_CREATOR_PHOTO>},
+		{"GET_TEXTURE_RESOLUTION", native_function<LUA_NATIVE_GRAPHICS_GET_TEXTURE_RESOLUTION>},
+		{"GET_TIMECYCLE_MODIFIER_INDEX", native_function<LUA_NATIVE_GRAPHICS_GET_TIMECYCLE_MODIFIER_INDEX>},
+		{"GET_TIMECYCLE_TRANSITION_MODIFIER_INDEX", native_function<LUA_NATIVE_GRAPHICS_GET_TIMECYCLE_TRANSITION_MODIFIER_INDEX>},
+		{"GET_TOGGLE_PAUSED_RENDERPHASES_STATUS", native_function<LUA_NATIVE_GRAPHICS_GET_TOGGLE_PAUSED_RENDERPHASES_STATUS>},
+		{"GET_TV_CHANNEL", native_function<LUA_NATIVE_GRAPHICS_GET_TV_CHANNEL>},
+		{"GET_TV_VOLUME", native_function<LUA_NATIVE_GRAPHICS_GET_TV_VOLUME>},
+		{"GET_USINGNIGHTVISION", native_function<LUA_NATIVE_GRAPHICS_GET_USINGNIGHTVISION>},
+		{"GET_USINGSEETHROUGH", native_function<LUA_NATIVE_GRAPHICS_GET_USINGSEETHROUGH>},
+		{"GET_VEHICLE_CREW_EMBLEM_REQUEST_STATE", native_function<LUA_NATIVE_GRAPHICS_GET_VEHICLE_CREW_EMBLEM_REQUEST_STATE>},
+		{"GOLF_TRAIL_GET_MAX_HEIGHT", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_GET_MAX_HEIGHT>},
+		{"GOLF_TRAIL_GET_VISUAL_CONTROL_POINT", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_GET_VISUAL_CONTROL_POINT>},
+		{"GOLF_TRAIL_SET_COLOUR", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_COLOUR>},
+		{"GOLF_TRAIL_SET_ENABLED", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_ENABLED>},
+		{"GOLF_TRAIL_SET_FACING", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_FACING>},
+		{"GOLF_TRAIL_SET_FIXED_CONTROL_POINT", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_FIXED_CONTROL_POINT>},
+		{"GOLF_TRAIL_SET_FIXED_CONTROL_POINT_ENABLE", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_FIXED_CONTROL_POINT_ENABLE>},
+		{"GOLF_TRAIL_SET_PATH", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_PATH>},
+		{"GOLF_TRAIL_SET_RADIUS", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_RADIUS>},
+		{"GOLF_TRAIL_SET_SHADER_PARAMS", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_SHADER_PARAMS>},
+		{"GOLF_TRAIL_SET_TESSELLATION", native_function<LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_TESSELLATION>},
+		{"GRAB_PAUSEMENU_OWNERSHIP", native_function<LUA_NATIVE_GRAPHICS_GRAB_PAUSEMENU_OWNERSHIP>},
+		{"GRASSBATCH_DISABLE_FLATTENING", native_function<LUA_NATIVE_GRAPHICS_GRASSBATCH_DISABLE_FLATTENING>},
+		{"GRASSBATCH_ENABLE_FLATTENING_EXT_IN_SPHERE", native_function<LUA_NATIVE_GRAPHICS_GRASSBATCH_ENABLE_FLATTENING_EXT_IN_SPHERE>},
+		{"GRASSBATCH_ENABLE_FLATTENING_IN_SPHERE", native_function<LUA_NATIVE_GRAPHICS_GRASSBATCH_ENABLE_FLATTENING_IN_SPHERE>},
+		{"HAS_SCALEFORM_CONTAINER_MOVIE_LOADED_INTO_PARENT", native_function<LUA_NATIVE_GRAPHICS_HAS_SCALEFORM_CONTAINER_MOVIE_LOADED_INTO_PARENT>},
+		{"HAS_SCALEFORM_MOVIE_FILENAME_LOADED", native_function<LUA_NATIVE_GRAPHICS_HAS_SCALEFORM_MOVIE_FILENAME_LOADED>},
+		{"HAS_SCALEFORM_MOVIE_LOADED", native_function<LUA_NATIVE_GRAPHICS_HAS_SCALEFORM_MOVIE_LOADED>},
+		{"HAS_SCALEFORM_SCRIPT_HUD_MOVIE_LOADED", native_function<LUA_NATIVE_GRAPHICS_HAS_SCALEFORM_SCRIPT_HUD_MOVIE_LOADED>},
+		{"HAS_STREAMED_TEXTURE_DICT_LOADED", native_function<LUA_NATIVE_GRAPHICS_HAS_STREAMED_TEXTURE_DICT_LOADED>},
+		{"IS_ACTIVE_SCALEFORM_MOVIE_DELETING", native_function<LUA_NATIVE_GRAPHICS_IS_ACTIVE_SCALEFORM_MOVIE_DELETING>},
+		{"IS_DECAL_ALIVE", native_function<LUA_NATIVE_GRAPHICS_IS_DECAL_ALIVE>},
+		{"IS_PLAYLIST_ON_CHANNEL", native_function<LUA_NATIVE_GRAPHICS_IS_PLAYLIST_ON_CHANNEL>},
+		{"IS_SCALEFORM_MOVIE_DELETING", native_function<LUA_NATIVE_GRAPHICS_IS_SCALEFORM_MOVIE_DELETING>},
+		{"IS_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_READY", native_function<LUA_NATIVE_GRAPHICS_IS_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_READY>},
+		{"IS_SCREENBLUR_FADE_RUNNING", native_function<LUA_NATIVE_GRAPHICS_IS_SCREENBLUR_FADE_RUNNING>},
+		{"IS_TRACKED_POINT_VISIBLE", native_function<LUA_NATIVE_GRAPHICS_IS_TRACKED_POINT_VISIBLE>},
+		{"IS_TVSHOW_CURRENTLY_PLAYING", native_function<LUA_NATIVE_GRAPHICS_IS_TVSHOW_CURRENTLY_PLAYING>},
+		{"LOAD_HIGH_QUALITY_PHOTO", native_function<LUA_NATIVE_GRAPHICS_LOAD_HIGH_QUALITY_PHOTO>},
+		{"LOAD_MISSION_CREATOR_PHOTO", native_function<LUA_NATIVE_GRAPHICS_LOAD_MISSION_CREATOR_PHOTO>},
+		{"LOAD_MOVIE_MESH_SET", native_function<LUA_NATIVE_GRAPHICS_LOAD_MOVIE_MESH_SET>},
+		{"MOVE_VEHICLE_DECALS", native_function<LUA_NATIVE_GRAPHICS_MOVE_VEHICLE_DECALS>},
+		{"OVERRIDE_INTERIOR_SMOKE_END", native_function<LUA_NATIVE_GRAPHICS_OVERRIDE_INTERIOR_SMOKE_END>},
+		{"OVERRIDE_INTERIOR_SMOKE_LEVEL", native_function<LUA_NATIVE_GRAPHICS_OVERRIDE_INTERIOR_SMOKE_LEVEL>},
+		{"OVERRIDE_INTERIOR_SMOKE_NAME", native_function<LUA_NATIVE_GRAPHICS_OVERRIDE_INTERIOR_SMOKE_NAME>},
+		{"OVERRIDE_NIGHTVISION_LIGHT_RANGE", native_function<LUA_NATIVE_GRAPHICS_OVERRIDE_NIGHTVISION_LIGHT_RANGE>},
+		{"OVERRIDE_PED_CREW_LOGO_TEXTURE", native_function<LUA_NATIVE_GRAPHICS_OVERRIDE_PED_CREW_LOGO_TEXTURE>},
+		{"PASS_KEYBOARD_INPUT_TO_SCALEFORM", native_function<LUA_NATIVE_GRAPHICS_PASS_KEYBOARD_INPUT_TO_SCALEFORM>},
+		{"PATCH_DECAL_DIFFUSE_MAP", native_function<LUA_NATIVE_GRAPHICS_PATCH_DECAL_DIFFUSE_MAP>},
+		{"PHONEPHOTOEDITOR_IS_ACTIVE", native_function<LUA_NATIVE_GRAPHICS_PHONEPHOTOEDITOR_IS_ACTIVE>},
+		{"PHONEPHOTOEDITOR_SET_FRAME_TXD", native_function<LUA_NATIVE_GRAPHICS_PHONEPHOTOEDITOR_SET_FRAME_TXD>},
+		{"PHONEPHOTOEDITOR_TOGGLE", native_function<LUA_NATIVE_GRAPHICS_PHONEPHOTOEDITOR_TOGGLE>},
+		{"PLAY_BINK_MOVIE", native_function<LUA_NATIVE_GRAPHICS_PLAY_BINK_MOVIE>},
+		{"POP_TIMECYCLE_MODIFIER", native_function<LUA_NATIVE_GRAPHICS_POP_TIMECYCLE_MODIFIER>},
+		{"PRESET_INTERIOR_AMBIENT_CACHE", native_function<LUA_NATIVE_GRAPHICS_PRESET_INTERIOR_AMBIENT_CACHE>},
+		{"PROCGRASS_DISABLE_AMBSCALESCAN", native_function<LUA_NATIVE_GRAPHICS_PROCGRASS_DISABLE_AMBSCALESCAN>},
+		{"PROCGRASS_DISABLE_CULLSPHERE", native_function<LUA_NATIVE_GRAPHICS_PROCGRASS_DISABLE_CULLSPHERE>},
+		{"PROCGRASS_ENABLE_AMBSCALESCAN", native_function<LUA_NATIVE_GRAPHICS_PROCGRASS_ENABLE_AMBSCALESCAN>},
+		{"PROCGRASS_ENABLE_CULLSPHERE", native_function<LUA_NATIVE_GRAPHICS_PROCGRASS_ENABLE_CULLSPHERE>},
+		{"PROCGRASS_IS_CULLSPHERE_ENABLED", native_function<LUA_NATIVE_GRAPHICS_PROCGRASS_IS_CULLSPHERE_ENABLED>},
+		{"PUSH_TIMECYCLE_MODIFIER", native_function<LUA_NATIVE_GRAPHICS_PUSH_TIMECYCLE_MODIFIER>},
+		{"QUERY_MOVIE_MESH_SET_STATE", native_function<LUA_NATIVE_GRAPHICS_QUERY_MOVIE_MESH_SET_STATE>},
+		{"QUEUE_OPERATION_TO_CREATE_SORTED_LIST_OF_PHOTOS", native_function<LUA_NATIVE_GRAPHICS_QUEUE_OPERATION_TO_CREATE_SORTED_LIST_OF_PHOTOS>},
+		{"REGISTER_NOIR_LENS_EFFECT", native_function<LUA_NATIVE_GRAPHICS_REGISTER_NOIR_LENS_EFFECT>},
+		{"REGISTER_POSTFX_BULLET_IMPACT", native_function<LUA_NATIVE_GRAPHICS_REGISTER_POSTFX_BULLET_IMPACT>},
+		{"RELEASE_BINK_MOVIE", native_function<LUA_NATIVE_GRAPHICS_RELEASE_BINK_MOVIE>},
+		{"RELEASE_MOVIE_MESH_SET", native_function<LUA_NATIVE_GRAPHICS_RELEASE_MOVIE_MESH_SET>},
+		{"REMOVE_DECAL", native_function<LUA_NATIVE_GRAPHICS_REMOVE_DECAL>},
+		{"REMOVE_DECALS_FROM_OBJECT", native_function<LUA_NATIVE_GRAPHICS_REMOVE_DECALS_FROM_OBJECT>},
+		{"REMOVE_DECALS_FROM_OBJECT_FACING", native_function<LUA_NATIVE_GRAPHICS_REMOVE_DECALS_FROM_OBJECT_FACING>},
+		{"REMOVE_DECALS_FROM_VEHICLE", native_function<LUA_NATIVE_GRAPHICS_REMOVE_DECALS_FROM_VEHICLE>},
+		{"REMOVE_DECALS_IN_RANGE", native_function<LUA_NATIVE_GRAPHICS_REMOVE_DECALS_IN_RANGE>},
+		{"REMOVE_GRASS_CULL_SPHERE", native_function<LUA_NATIVE_GRAPHICS_REMOVE_GRASS_CULL_SPHERE>},
+		{"REMOVE_PARTICLE_FX", native_function<LUA_NATIVE_GRAPHICS_REMOVE_PARTICLE_FX>},
+		{"REMOVE_PARTICLE_FX_FROM_ENTITY", native_function<LUA_NATIVE_GRAPHICS_REMOVE_PARTICLE_FX_FROM_ENTITY>},
+		{"REMOVE_PARTICLE_FX_IN_RANGE", native_function<LUA_NATIVE_GRAPHICS_REMOVE_PARTICLE_FX_IN_RANGE>},
+		{"REMOVE_SCALEFORM_SCRIPT_HUD_MOVIE", native_function<LUA_NATIVE_GRAPHICS_REMOVE_SCALEFORM_SCRIPT_HUD_MOVIE>},
+		{"REMOVE_VEHICLE_CREW_EMBLEM", native_function<LUA_NATIVE_GRAPHICS_REMOVE_VEHICLE_CREW_EMBLEM>},
+		{"RENDER_SHADOWED_LIGHTS_WITH_NO_SHADOWS", native_function<LUA_NATIVE_GRAPHICS_RENDER_SHADOWED_LIGHTS_WITH_NO_SHADOWS>},
+		{"REQUEST_EARLY_LIGHT_CHECK", native_function<LUA_NATIVE_GRAPHICS_REQUEST_EARLY_LIGHT_CHECK>},
+		{"REQUEST_SCALEFORM_MOVIE", native_function<LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_MOVIE>},
+		{"REQUEST_SCALEFORM_MOVIE_INSTANCE", native_function<LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_MOVIE_INSTANCE>},
+		{"REQUEST_SCALEFORM_MOVIE_SKIP_RENDER_WHILE_PAUSED", native_function<LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_MOVIE_SKIP_RENDER_WHILE_PAUSED>},
+		{"REQUEST_SCALEFORM_MOVIE_WITH_IGNORE_SUPER_WIDESCREEN", native_function<LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_MOVIE_WITH_IGNORE_SUPER_WIDESCREEN>},
+		{"REQUEST_SCALEFORM_SCRIPT_HUD_MOVIE", native_function<LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_SCRIPT_HUD_MOVIE>},
+		{"REQUEST_STREAMED_TEXTURE_DICT", native_function<LUA_NATIVE_GRAPHICS_REQUEST_STREAMED_TEXTURE_DICT>},
+		{"RESET_ADAPTATION", native_function<LUA_NATIVE_GRAPHICS_RESET_ADAPTATION>},
+		{"RESET_PARTICLE_FX_OVERRIDE", native_function<LUA_NATIVE_GRAPHICS_RESET_PARTICLE_FX_OVERRIDE>},
+		{"RESET_PAUSED_RENDERPHASES", native_function<LUA_NATIVE_GRAPHICS_RESET_PAUSED_RENDERPHASES>},
+		{"RESET_SCRIPT_GFX_ALIGN", native_function<LUA_NATIVE_GRAPHICS_RESET_SCRIPT_GFX_ALIGN>},
+		{"SAVE_HIGH_QUALITY_PHOTO", native_function<LUA_NATIVE_GRAPHICS_SAVE_HIGH_QUALITY_PHOTO>},
+		{"SCALEFORM_MOVIE_METHOD_ADD_PARAM_BOOL", native_function<LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_BOOL>},
+		{"SCALEFORM_MOVIE_METHOD_ADD_PARAM_FLOAT", native_function<LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_FLOAT>},
+		{"SCALEFORM_MOVIE_METHOD_ADD_PARAM_INT", native_function<LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_INT>},
+		{"SCALEFORM_MOVIE_METHOD_ADD_PARAM_LATEST_BRIEF_STRING", native_function<LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_LATEST_BRIEF_STRING>},
+		{"SCALEFORM_MOVIE_METHOD_ADD_PARAM_LITERAL_STRING", native_function<LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_LITERAL_STRING>},
+		{"SCALEFORM_MOVIE_METHOD_ADD_PARAM_PLAYER_NAME_STRING", native_function<LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_PLAYER_NAME_STRING>},
+		{"SCALEFORM_MOVIE_METHOD_ADD_PARAM_TEXTURE_NAME_STRING", native_function<LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_TEXTURE_NAME_STRING>},
+		{"SEETHROUGH_GET_MAX_THICKNESS", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_GET_MAX_THICKNESS>},
+		{"SEETHROUGH_RESET", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_RESET>},
+		{"SEETHROUGH_SET_COLOR_NEAR", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_COLOR_NEAR>},
+		{"SEETHROUGH_SET_FADE_ENDDISTANCE", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_FADE_ENDDISTANCE>},
+		{"SEETHROUGH_SET_FADE_STARTDISTANCE", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_FADE_STARTDISTANCE>},
+		{"SEETHROUGH_SET_HEATSCALE", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_HEATSCALE>},
+		{"SEETHROUGH_SET_HIGHLIGHT_NOISE", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_HIGHLIGHT_NOISE>},
+		{"SEETHROUGH_SET_HILIGHT_INTENSITY", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_HILIGHT_INTENSITY>},
+		{"SEETHROUGH_SET_MAX_THICKNESS", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_MAX_THICKNESS>},
+		{"SEETHROUGH_SET_NOISE_MAX", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_NOISE_MAX>},
+		{"SEETHROUGH_SET_NOISE_MIN", native_function<LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_NOISE_MIN>},
+		{"SET_ARENA_THEME_AND_VARIATION_FOR_TAKEN_PHOTO", native_function<LUA_NATIVE_GRAPHICS_SET_ARENA_THEME_AND_VARIATION_FOR_TAKEN_PHOTO>},
+		{"SET_ARTIFICIAL_LIGHTS_STATE", native_function<LUA_NATIVE_GRAPHICS_SET_ARTIFICIAL_LIGHTS_STATE>},
+		{"SET_ARTIFICIAL_VEHICLE_LIGHTS_STATE", native_function<LUA_NATIVE_GRAPHICS_SET_ARTIFICIAL_VEHICLE_LIGHTS_STATE>},
+		{"SET_BACKFACECULLING", native_function<LUA_NATIVE_GRAPHICS_SET_BACKFACECULLING>},
+		{"SET_BINK_MOVIE", native_function<LUA_NATIVE_GRAPHICS_SET_BINK_MOVIE>},
+		{"SET_BINK_MOVIE_AUDIO_FRONTEND", native_function<LUA_NATIVE_GRAPHICS_SET_BINK_MOVIE_AUDIO_FRONTEND>},
+		{"SET_BINK_MOVIE_TIME", native_function<LUA_NATIVE_GRAPHICS_SET_BINK_MOVIE_TIME>},
+		{"SET_BINK_MOVIE_VOLUME", native_function<LUA_NATIVE_GRAPHICS_SET_BINK_MOVIE_VOLUME>},
+		{"SET_BINK_SHOULD_SKIP", native_function<LUA_NATIVE_GRAPHICS_SET_BINK_SHOULD_SKIP>},
+		{"SET_CHECKPOINT_CLIPPLANE_WITH_POS_NORM", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_CLIPPLANE_WITH_POS_NORM>},
+		{"SET_CHECKPOINT_CYLINDER_HEIGHT", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_CYLINDER_HEIGHT>},
+		{"SET_CHECKPOINT_DECAL_ROT_ALIGNED_TO_CAMERA_ROT", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_DECAL_ROT_ALIGNED_TO_CAMERA_ROT>},
+		{"SET_CHECKPOINT_DIRECTION", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_DIRECTION>},
+		{"SET_CHECKPOINT_FORCE_DIRECTION", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_FORCE_DIRECTION>},
+		{"SET_CHECKPOINT_FORCE_OLD_ARROW_POINTING", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_FORCE_OLD_ARROW_POINTING>},
+		{"SET_CHECKPOINT_INSIDE_CYLINDER_HEIGHT_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_INSIDE_CYLINDER_HEIGHT_SCALE>},
+		{"SET_CHECKPOINT_INSIDE_CYLINDER_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_INSIDE_CYLINDER_SCALE>},
+		{"SET_CHECKPOINT_RGBA", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_RGBA>},
+		{"SET_CHECKPOINT_RGBA2", native_function<LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_RGBA2>},
+		{"SET_CURRENT_PLAYER_TCMODIFIER", native_function<LUA_NATIVE_GRAPHICS_SET_CURRENT_PLAYER_TCMODIFIER>},
+		{"SET_DEBUG_LINES_AND_SPHERES_DRAWING_ACTIVE", native_function<LUA_NATIVE_GRAPHICS_SET_DEBUG_LINES_AND_SPHERES_DRAWING_ACTIVE>},
+		{"SET_DECAL_BULLET_IMPACT_RANGE_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_DECAL_BULLET_IMPACT_RANGE_SCALE>},
+		{"SET_DEPTHWRITING", native_function<LUA_NATIVE_GRAPHICS_SET_DEPTHWRITING>},
+		{"SET_DISABLE_DECAL_RENDERING_THIS_FRAME", native_function<LUA_NATIVE_GRAPHICS_SET_DISABLE_DECAL_RENDERING_THIS_FRAME>},
+		{"SET_DISABLE_PETROL_DECALS_IGNITING_THIS_FRAME", native_function<LUA_NATIVE_GRAPHICS_SET_DISABLE_PETROL_DECALS_IGNITING_THIS_FRAME>},
+		{"SET_DISABLE_PETROL_DECALS_RECYCLING_THIS_FRAME", native_function<LUA_NATIVE_GRAPHICS_SET_DISABLE_PETROL_DECALS_RECYCLING_THIS_FRAME>},
+		{"SET_DISTANCE_BLUR_STRENGTH_OVERRIDE", native_function<LUA_NATIVE_GRAPHICS_SET_DISTANCE_BLUR_STRENGTH_OVERRIDE>},
+		{"SET_DRAW_ORIGIN", native_function<LUA_NATIVE_GRAPHICS_SET_DRAW_ORIGIN>},
+		{"SET_ENTITY_ICON_COLOR", native_function<LUA_NATIVE_GRAPHICS_SET_ENTITY_ICON_COLOR>},
+		{"SET_ENTITY_ICON_VISIBILITY", native_function<LUA_NATIVE_GRAPHICS_SET_ENTITY_ICON_VISIBILITY>},
+		{"SET_EXPOSURETWEAK", native_function<LUA_NATIVE_GRAPHICS_SET_EXPOSURETWEAK>},
+		{"SET_EXTRA_TCMODIFIER", native_function<LUA_NATIVE_GRAPHICS_SET_EXTRA_TCMODIFIER>},
+		{"SET_FLASH", native_function<LUA_NATIVE_GRAPHICS_SET_FLASH>},
+		{"SET_FORCE_MOTIONBLUR", native_function<LUA_NATIVE_GRAPHICS_SET_FORCE_MOTIONBLUR>},
+		{"SET_GRASS_CULL_SPHERE", native_function<LUA_NATIVE_GRAPHICS_SET_GRASS_CULL_SPHERE>},
+		{"SET_HIDOF_OVERRIDE", native_function<LUA_NATIVE_GRAPHICS_SET_HIDOF_OVERRIDE>},
+		{"SET_LIGHT_OVERRIDE_MAX_INTENSITY_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_LIGHT_OVERRIDE_MAX_INTENSITY_SCALE>},
+		{"SET_LOCK_ADAPTIVE_DOF_DISTANCE", native_function<LUA_NATIVE_GRAPHICS_SET_LOCK_ADAPTIVE_DOF_DISTANCE>},
+		{"SET_MOTIONBLUR_MAX_VEL_SCALER", native_function<LUA_NATIVE_GRAPHICS_SET_MOTIONBLUR_MAX_VEL_SCALER>},
+		{"SET_NEXT_PLAYER_TCMODIFIER", native_function<LUA_NATIVE_GRAPHICS_SET_NEXT_PLAYER_TCMODIFIER>},
+		{"SET_NIGHTVISION", native_function<LUA_NATIVE_GRAPHICS_SET_NIGHTVISION>},
+		{"SET_NOISEOVERIDE", native_function<LUA_NATIVE_GRAPHICS_SET_NOISEOVERIDE>},
+		{"SET_NOISINESSOVERIDE", native_function<LUA_NATIVE_GRAPHICS_SET_NOISINESSOVERIDE>},
+		{"SET_ON_ISLAND_X_FOR_TAKEN_PHOTO", native_function<LUA_NATIVE_GRAPHICS_SET_ON_ISLAND_X_FOR_TAKEN_PHOTO>},
+		{"SET_PARTICLE_FX_BANG_SCRAPE_LODRANGE_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BANG_SCRAPE_LODRANGE_SCALE>},
+		{"SET_PARTICLE_FX_BLOOD_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BLOOD_SCALE>},
+		{"SET_PARTICLE_FX_BULLET_IMPACT_LODRANGE_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BULLET_IMPACT_LODRANGE_SCALE>},
+		{"SET_PARTICLE_FX_BULLET_IMPACT_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BULLET_IMPACT_SCALE>},
+		{"SET_PARTICLE_FX_BULLET_TRACE_NO_ANGLE_REJECT", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BULLET_TRACE_NO_ANGLE_REJECT>},
+		{"SET_PARTICLE_FX_CAM_INSIDE_NONPLAYER_VEHICLE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_CAM_INSIDE_NONPLAYER_VEHICLE>},
+		{"SET_PARTICLE_FX_CAM_INSIDE_VEHICLE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_CAM_INSIDE_VEHICLE>},
+		{"SET_PARTICLE_FX_FOOT_LODRANGE_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_FOOT_LODRANGE_SCALE>},
+		{"SET_PARTICLE_FX_FOOT_OVERRIDE_NAME", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_FOOT_OVERRIDE_NAME>},
+		{"SET_PARTICLE_FX_FORCE_VEHICLE_INTERIOR", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_FORCE_VEHICLE_INTERIOR>},
+		{"SET_PARTICLE_FX_LOOPED_ALPHA", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_ALPHA>},
+		{"SET_PARTICLE_FX_LOOPED_CAMERA_BIAS_", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_CAMERA_BIAS_>},
+		{"SET_PARTICLE_FX_LOOPED_COLOUR", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_COLOUR>},
+		{"SET_PARTICLE_FX_LOOPED_EVOLUTION", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_EVOLUTION>},
+		{"SET_PARTICLE_FX_LOOPED_FAR_CLIP_DIST", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_FAR_CLIP_DIST>},
+		{"SET_PARTICLE_FX_LOOPED_OFFSETS", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_OFFSETS>},
+		{"SET_PARTICLE_FX_LOOPED_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_SCALE>},
+		{"SET_PARTICLE_FX_NON_LOOPED_ALPHA", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_NON_LOOPED_ALPHA>},
+		{"SET_PARTICLE_FX_NON_LOOPED_COLOUR", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_NON_LOOPED_COLOUR>},
+		{"SET_PARTICLE_FX_NON_LOOPED_EMITTER_SIZE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_NON_LOOPED_EMITTER_SIZE>},
+		{"SET_PARTICLE_FX_NON_LOOPED_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_NON_LOOPED_SCALE>},
+		{"SET_PARTICLE_FX_OVERRIDE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_OVERRIDE>},
+		{"SET_PARTICLE_FX_SHOOTOUT_BOAT", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_SHOOTOUT_BOAT>},
+		{"SET_PARTICLE_FX_SLIPSTREAM_LODRANGE_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_SLIPSTREAM_LODRANGE_SCALE>},
+		{"SET_PLAYER_TCMODIFIER_TRANSITION", native_function<LUA_NATIVE_GRAPHICS_SET_PLAYER_TCMODIFIER_TRANSITION>},
+		{"SET_PTFX_FORCE_VEHICLE_INTERIOR_FLAG", native_function<LUA_NATIVE_GRAPHICS_SET_PTFX_FORCE_VEHICLE_INTERIOR_FLAG>},
+		{"SET_SCALEFORM_MOVIE_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_GRAPHICS_SET_SCALEFORM_MOVIE_AS_NO_LONGER_NEEDED>},
+		{"SET_SCALEFORM_MOVIE_TO_USE_LARGE_RT", native_function<LUA_NATIVE_GRAPHICS_SET_SCALEFORM_MOVIE_TO_USE_LARGE_RT>},
+		{"SET_SCALEFORM_MOVIE_TO_USE_SUPER_LARGE_RT", native_function<LUA_NATIVE_GRAPHICS_SET_SCALEFORM_MOVIE_TO_USE_SUPER_LARGE_RT>},
+		{"SET_SCALEFORM_MOVIE_TO_USE_SYSTEM_TIME", native_function<LUA_NATIVE_GRAPHICS_SET_SCALEFORM_MOVIE_TO_USE_SYSTEM_TIME>},
+		{"SET_SCRIPT_GFX_ALIGN", native_function<LUA_NATIVE_GRAPHICS_SET_SCRIPT_GFX_ALIGN>},
+		{"SET_SCRIPT_GFX_ALIGN_PARAMS", native_function<LUA_NATIVE_GRAPHICS_SET_SCRIPT_GFX_ALIGN_PARAMS>},
+		{"SET_SCRIPT_GFX_DRAW_BEHIND_PAUSEMENU", native_function<LUA_NATIVE_GRAPHICS_SET_SCRIPT_GFX_DRAW_BEHIND_PAUSEMENU>},
+		{"SET_SCRIPT_GFX_DRAW_ORDER", native_function<LUA_NATIVE_GRAPHICS_SET_SCRIPT_GFX_DRAW_ORDER>},
+		{"SET_SEETHROUGH", native_function<LUA_NATIVE_GRAPHICS_SET_SEETHROUGH>},
+		{"SET_SKIDMARK_RANGE_SCALE", native_function<LUA_NATIVE_GRAPHICS_SET_SKIDMARK_RANGE_SCALE>},
+		{"SET_STREAMED_TEXTURE_DICT_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_GRAPHICS_SET_STREAMED_TEXTURE_DICT_AS_NO_LONGER_NEEDED>},
+		{"SET_TAKEN_PHOTO_IS_MUGSHOT", native_function<LUA_NATIVE_GRAPHICS_SET_TAKEN_PHOTO_IS_MUGSHOT>},
+		{"SET_TIMECYCLE_MODIFIER", native_function<LUA_NATIVE_GRAPHICS_SET_TIMECYCLE_MODIFIER>},
+		{"SET_TIMECYCLE_MODIFIER_STRENGTH", native_function<LUA_NATIVE_GRAPHICS_SET_TIMECYCLE_MODIFIER_STRENGTH>},
+		{"SET_TRACKED_POINT_INFO", native_function<LUA_NATIVE_GRAPHICS_SET_TRACKED_POINT_INFO>},
+		{"SET_TRANSITION_OUT_OF_TIMECYCLE_MODIFIER", native_function<LUA_NATIVE_GRAPHICS_SET_TRANSITION_OUT_OF_TIMECYCLE_MODIFIER>},
+		{"SET_TRANSITION_TIMECYCLE_MODIFIER", native_function<LUA_NATIVE_GRAPHICS_SET_TRANSITION_TIMECYCLE_MODIFIER>},
+		{"SET_TV_AUDIO_FRONTEND", native_function<LUA_NATIVE_GRAPHICS_SET_TV_AUDIO_FRONTEND>},
+		{"SET_TV_CHANNEL", native_function<LUA_NATIVE_GRAPHICS_SET_TV_CHANNEL>},
+		{"SET_TV_CHANNEL_PLAYLIST", native_function<LUA_NATIVE_GRAPHICS_SET_TV_CHANNEL_PLAYLIST>},
+		{"SET_TV_CHANNEL_PLAYLIST_AT_HOUR", native_function<LUA_NATIVE_GRAPHICS_SET_TV_CHANNEL_PLAYLIST_AT_HOUR>},
+		{"SET_TV_CHANNEL_PLAYLIST_DIRTY_", native_function<LUA_NATIVE_GRAPHICS_SET_TV_CHANNEL_PLAYLIST_DIRTY_>},
+		{"SET_TV_PLAYER_WATCHING_THIS_FRAME", native_function<LUA_NATIVE_GRAPHICS_SET_TV_PLAYER_WATCHING_THIS_FRAME>},
+		{"SET_TV_VOLUME", native_function<LUA_NATIVE_GRAPHICS_SET_TV_VOLUME>},
+		{"SET_WEATHER_PTFX_OVERRIDE_CURR_LEVEL", native_function<LUA_NATIVE_GRAPHICS_SET_WEATHER_PTFX_OVERRIDE_CURR_LEVEL>},
+		{"SET_WEATHER_PTFX_USE_OVERRIDE_SETTINGS", native_function<LUA_NATIVE_GRAPHICS_SET_WEATHER_PTFX_USE_OVERRIDE_SETTINGS>},
+		{"START_NETWORKED_PARTICLE_FX_LOOPED_ON_ENTITY", native_function<LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_LOOPED_ON_ENTITY>},
+		{"START_NETWORKED_PARTICLE_FX_LOOPED_ON_ENTITY_BONE", native_function<LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_LOOPED_ON_ENTITY_BONE>},
+		{"START_NETWORKED_PARTICLE_FX_NON_LOOPED_AT_COORD", native_function<LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_NON_LOOPED_AT_COORD>},
+		{"START_NETWORKED_PARTICLE_FX_NON_LOOPED_ON_ENTITY", native_function<LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_NON_LOOPED_ON_ENTITY>},
+		{"START_NETWORKED_PARTICLE_FX_NON_LOOPED_ON_PED_BONE", native_function<LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_NON_LOOPED_ON_PED_BONE>},
+		{"START_PARTICLE_FX_LOOPED_AT_COORD", native_function<LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_LOOPED_AT_COORD>},
+		{"START_PARTICLE_FX_LOOPED_ON_ENTITY", native_function<LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_LOOPED_ON_ENTITY>},
+		{"START_PARTICLE_FX_LOOPED_ON_ENTITY_BONE", native_function<LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_LOOPED_ON_ENTITY_BONE>},
+		{"START_PARTICLE_FX_LOOPED_ON_PED_BONE", native_function<LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_LOOPED_ON_PED_BONE>},
+		{"START_PARTICLE_FX_NON_LOOPED_AT_COORD", native_function<LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_NON_LOOPED_AT_COORD>},
+		{"START_PARTICLE_FX_NON_LOOPED_ON_ENTITY", native_function<LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_NON_LOOPED_ON_ENTITY>},
+		{"START_PARTICLE_FX_NON_LOOPED_ON_ENTITY_BONE", native_function<LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_NON_LOOPED_ON_ENTITY_BONE>},
+		{"START_PARTICLE_FX_NON_LOOPED_ON_PED_BONE", native_function<LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_NON_LOOPED_ON_PED_BONE>},
+		{"START_PETROL_TRAIL_DECALS", native_function<LUA_NATIVE_GRAPHICS_START_PETROL_TRAIL_DECALS>},
+		{"START_VEHICLE_PARTICLE_FX_LOOPED_", native_function<LUA_NATIVE_GRAPHICS_START_VEHICLE_PARTICLE_FX_LOOPED_>},
+		{"STOP_BINK_MOVIE", native_function<LUA_NATIVE_GRAPHICS_STOP_BINK_MOVIE>},
+		{"STOP_PARTICLE_FX_LOOPED", native_function<LUA_NATIVE_GRAPHICS_STOP_PARTICLE_FX_LOOPED>},
+		{"TERRAINGRID_ACTIVATE", native_function<LUA_NATIVE_GRAPHICS_TERRAINGRID_ACTIVATE>},
+		{"TERRAINGRID_SET_COLOURS", native_function<LUA_NATIVE_GRAPHICS_TERRAINGRID_SET_COLOURS>},
+		{"TERRAINGRID_SET_PARAMS", native_function<LUA_NATIVE_GRAPHICS_TERRAINGRID_SET_PARAMS>},
+		{"TOGGLE_PAUSED_RENDERPHASES", native_function<LUA_NATIVE_GRAPHICS_TOGGLE_PAUSED_RENDERPHASES>},
+		{"TOGGLE_PLAYER_DAMAGE_OVERLAY", native_function<LUA_NATIVE_GRAPHICS_TOGGLE_PLAYER_DAMAGE_OVERLAY>},
+		{"TRIGGER_SCREENBLUR_FADE_IN", native_function<LUA_NATIVE_GRAPHICS_TRIGGER_SCREENBLUR_FADE_IN>},
+		{"TRIGGER_SCREENBLUR_FADE_OUT", native_function<LUA_NATIVE_GRAPHICS_TRIGGER_SCREENBLUR_FADE_OUT>},
+		{"UI3DSCENE_ASSIGN_PED_TO_SLOT", native_function<LUA_NATIVE_GRAPHICS_UI3DSCENE_ASSIGN_PED_TO_SLOT>},
+		{"UI3DSCENE_CLEAR_PATCHED_DATA", native_function<LUA_NATIVE_GRAPHICS_UI3DSCENE_CLEAR_PATCHED_DATA>},
+		{"UI3DSCENE_IS_AVAILABLE", native_function<LUA_NATIVE_GRAPHICS_UI3DSCENE_IS_AVAILABLE>},
+		{"UI3DSCENE_MAKE_PUSHED_PRESET_PERSISTENT", native_function<LUA_NATIVE_GRAPHICS_UI3DSCENE_MAKE_PUSHED_PRESET_PERSISTENT>},
+		{"UI3DSCENE_PUSH_PRESET", native_function<LUA_NATIVE_GRAPHICS_UI3DSCENE_PUSH_PRESET>},
+		{"UNPATCH_DECAL_DIFFUSE_MAP", native_function<LUA_NATIVE_GRAPHICS_UNPATCH_DECAL_DIFFUSE_MAP>},
+		{"UPDATE_LIGHTS_ON_ENTITY", native_function<LUA_NATIVE_GRAPHICS_UPDATE_LIGHTS_ON_ENTITY>},
+		{"USE_PARTICLE_FX_ASSET", native_function<LUA_NATIVE_GRAPHICS_USE_PARTICLE_FX_ASSET>},
+		{"USE_SNOW_FOOT_VFX_WHEN_UNSHELTERED", native_function<LUA_NATIVE_GRAPHICS_USE_SNOW_FOOT_VFX_WHEN_UNSHELTERED>},
+		{"USE_SNOW_WHEEL_VFX_WHEN_UNSHELTERED", native_function<LUA_NATIVE_GRAPHICS_USE_SNOW_WHEEL_VFX_WHEN_UNSHELTERED>},
+		{"WASH_DECALS_FROM_VEHICLE", native_function<LUA_NATIVE_GRAPHICS_WASH_DECALS_FROM_VEHICLE>},
+		{"WASH_DECALS_IN_RANGE", native_function<LUA_NATIVE_GRAPHICS_WASH_DECALS_IN_RANGE>},
+		{"WATER_REFLECTION_SET_SCRIPT_OBJECT_VISIBILITY", native_function<LUA_NATIVE_GRAPHICS_WATER_REFLECTION_SET_SCRIPT_OBJECT_VISIBILITY>},
+	};
+
 	void init_native_binding_GRAPHICS(sol::state& L)
 	{
-		auto GRAPHICS = L["GRAPHICS"].get_or_create<sol::table>();
-		GRAPHICS.set_function("SET_DEBUG_LINES_AND_SPHERES_DRAWING_ACTIVE", LUA_NATIVE_GRAPHICS_SET_DEBUG_LINES_AND_SPHERES_DRAWING_ACTIVE);
-		GRAPHICS.set_function("DRAW_DEBUG_LINE", LUA_NATIVE_GRAPHICS_DRAW_DEBUG_LINE);
-		GRAPHICS.set_function("DRAW_DEBUG_LINE_WITH_TWO_COLOURS", LUA_NATIVE_GRAPHICS_DRAW_DEBUG_LINE_WITH_TWO_COLOURS);
-		GRAPHICS.set_function("DRAW_DEBUG_SPHERE", LUA_NATIVE_GRAPHICS_DRAW_DEBUG_SPHERE);
-		GRAPHICS.set_function("DRAW_DEBUG_BOX", LUA_NATIVE_GRAPHICS_DRAW_DEBUG_BOX);
-		GRAPHICS.set_function("DRAW_DEBUG_CROSS", LUA_NATIVE_GRAPHICS_DRAW_DEBUG_CROSS);
-		GRAPHICS.set_function("DRAW_DEBUG_TEXT", LUA_NATIVE_GRAPHICS_DRAW_DEBUG_TEXT);
-		GRAPHICS.set_function("DRAW_DEBUG_TEXT_2D", LUA_NATIVE_GRAPHICS_DRAW_DEBUG_TEXT_2D);
-		GRAPHICS.set_function("DRAW_LINE", LUA_NATIVE_GRAPHICS_DRAW_LINE);
-		GRAPHICS.set_function("DRAW_POLY", LUA_NATIVE_GRAPHICS_DRAW_POLY);
-		GRAPHICS.set_function("DRAW_TEXTURED_POLY", LUA_NATIVE_GRAPHICS_DRAW_TEXTURED_POLY);
-		GRAPHICS.set_function("DRAW_BOX", LUA_NATIVE_GRAPHICS_DRAW_BOX);
-		GRAPHICS.set_function("SET_BACKFACECULLING", LUA_NATIVE_GRAPHICS_SET_BACKFACECULLING);
-		GRAPHICS.set_function("SET_DEPTHWRITING", LUA_NATIVE_GRAPHICS_SET_DEPTHWRITING);
-		GRAPHICS.set_function("BEGIN_TAKE_MISSION_CREATOR_PHOTO", LUA_NATIVE_GRAPHICS_BEGIN_TAKE_MISSION_CREATOR_PHOTO);
-		GRAPHICS.set_function("GET_STATUS_OF_TAKE_MISSION_CREATOR_PHOTO", LUA_NATIVE_GRAPHICS_GET_STATUS_OF_TAKE_MISSION_CREATOR_PHOTO);
-		GRAPHICS.set_function("FREE_MEMORY_FOR_MISSION_CREATOR_PHOTO", LUA_NATIVE_GRAPHICS_FREE_MEMORY_FOR_MISSION_CREATOR_PHOTO);
-		GRAPHICS.set_function("LOAD_MISSION_CREATOR_PHOTO", LUA_NATIVE_GRAPHICS_LOAD_MISSION_CREATOR_PHOTO);
-		GRAPHICS.set_function("GET_STATUS_OF_LOAD_MISSION_CREATOR_PHOTO", LUA_NATIVE_GRAPHICS_GET_STATUS_OF_LOAD_MISSION_CREATOR_PHOTO);
-		GRAPHICS.set_function("BEGIN_CREATE_MISSION_CREATOR_PHOTO_PREVIEW", LUA_NATIVE_GRAPHICS_BEGIN_CREATE_MISSION_CREATOR_PHOTO_PREVIEW);
-		GRAPHICS.set_function("GET_STATUS_OF_CREATE_MISSION_CREATOR_PHOTO_PREVIEW", LUA_NATIVE_GRAPHICS_GET_STATUS_OF_CREATE_MISSION_CREATOR_PHOTO_PREVIEW);
-		GRAPHICS.set_function("FREE_MEMORY_FOR_MISSION_CREATOR_PHOTO_PREVIEW", LUA_NATIVE_GRAPHICS_FREE_MEMORY_FOR_MISSION_CREATOR_PHOTO_PREVIEW);
-		GRAPHICS.set_function("BEGIN_TAKE_HIGH_QUALITY_PHOTO", LUA_NATIVE_GRAPHICS_BEGIN_TAKE_HIGH_QUALITY_PHOTO);
-		GRAPHICS.set_function("GET_STATUS_OF_TAKE_HIGH_QUALITY_PHOTO", LUA_NATIVE_GRAPHICS_GET_STATUS_OF_TAKE_HIGH_QUALITY_PHOTO);
-		GRAPHICS.set_function("FREE_MEMORY_FOR_HIGH_QUALITY_PHOTO", LUA_NATIVE_GRAPHICS_FREE_MEMORY_FOR_HIGH_QUALITY_PHOTO);
-		GRAPHICS.set_function("SET_TAKEN_PHOTO_IS_MUGSHOT", LUA_NATIVE_GRAPHICS_SET_TAKEN_PHOTO_IS_MUGSHOT);
-		GRAPHICS.set_function("SET_ARENA_THEME_AND_VARIATION_FOR_TAKEN_PHOTO", LUA_NATIVE_GRAPHICS_SET_ARENA_THEME_AND_VARIATION_FOR_TAKEN_PHOTO);
-		GRAPHICS.set_function("SET_ON_ISLAND_X_FOR_TAKEN_PHOTO", LUA_NATIVE_GRAPHICS_SET_ON_ISLAND_X_FOR_TAKEN_PHOTO);
-		GRAPHICS.set_function("SAVE_HIGH_QUALITY_PHOTO", LUA_NATIVE_GRAPHICS_SAVE_HIGH_QUALITY_PHOTO);
-		GRAPHICS.set_function("GET_STATUS_OF_SAVE_HIGH_QUALITY_PHOTO", LUA_NATIVE_GRAPHICS_GET_STATUS_OF_SAVE_HIGH_QUALITY_PHOTO);
-		GRAPHICS.set_function("BEGIN_CREATE_LOW_QUALITY_COPY_OF_PHOTO", LUA_NATIVE_GRAPHICS_BEGIN_CREATE_LOW_QUALITY_COPY_OF_PHOTO);
-		GRAPHICS.set_function("GET_STATUS_OF_CREATE_LOW_QUALITY_COPY_OF_PHOTO", LUA_NATIVE_GRAPHICS_GET_STATUS_OF_CREATE_LOW_QUALITY_COPY_OF_PHOTO);
-		GRAPHICS.set_function("FREE_MEMORY_FOR_LOW_QUALITY_PHOTO", LUA_NATIVE_GRAPHICS_FREE_MEMORY_FOR_LOW_QUALITY_PHOTO);
-		GRAPHICS.set_function("DRAW_LOW_QUALITY_PHOTO_TO_PHONE", LUA_NATIVE_GRAPHICS_DRAW_LOW_QUALITY_PHOTO_TO_PHONE);
-		GRAPHICS.set_function("GET_MAXIMUM_NUMBER_OF_PHOTOS", LUA_NATIVE_GRAPHICS_GET_MAXIMUM_NUMBER_OF_PHOTOS);
-		GRAPHICS.set_function("GET_MAXIMUM_NUMBER_OF_CLOUD_PHOTOS", LUA_NATIVE_GRAPHICS_GET_MAXIMUM_NUMBER_OF_CLOUD_PHOTOS);
-		GRAPHICS.set_function("GET_CURRENT_NUMBER_OF_CLOUD_PHOTOS", LUA_NATIVE_GRAPHICS_GET_CURRENT_NUMBER_OF_CLOUD_PHOTOS);
-		GRAPHICS.set_function("QUEUE_OPERATION_TO_CREATE_SORTED_LIST_OF_PHOTOS", LUA_NATIVE_GRAPHICS_QUEUE_OPERATION_TO_CREATE_SORTED_LIST_OF_PHOTOS);
-		GRAPHICS.set_function("GET_STATUS_OF_SORTED_LIST_OPERATION", LUA_NATIVE_GRAPHICS_GET_STATUS_OF_SORTED_LIST_OPERATION);
-		GRAPHICS.set_function("CLEAR_STATUS_OF_SORTED_LIST_OPERATION", LUA_NATIVE_GRAPHICS_CLEAR_STATUS_OF_SORTED_LIST_OPERATION);
-		GRAPHICS.set_function("DOES_THIS_PHOTO_SLOT_CONTAIN_A_VALID_PHOTO", LUA_NATIVE_GRAPHICS_DOES_THIS_PHOTO_SLOT_CONTAIN_A_VALID_PHOTO);
-		GRAPHICS.set_function("LOAD_HIGH_QUALITY_PHOTO", LUA_NATIVE_GRAPHICS_LOAD_HIGH_QUALITY_PHOTO);
-		GRAPHICS.set_function("GET_LOAD_HIGH_QUALITY_PHOTO_STATUS", LUA_NATIVE_GRAPHICS_GET_LOAD_HIGH_QUALITY_PHOTO_STATUS);
-		GRAPHICS.set_function("DRAW_LIGHT_WITH_RANGEEX", LUA_NATIVE_GRAPHICS_DRAW_LIGHT_WITH_RANGEEX);
-		GRAPHICS.set_function("DRAW_LIGHT_WITH_RANGE", LUA_NATIVE_GRAPHICS_DRAW_LIGHT_WITH_RANGE);
-		GRAPHICS.set_function("DRAW_SPOT_LIGHT", LUA_NATIVE_GRAPHICS_DRAW_SPOT_LIGHT);
-		GRAPHICS.set_function("DRAW_SHADOWED_SPOT_LIGHT", LUA_NATIVE_GRAPHICS_DRAW_SHADOWED_SPOT_LIGHT);
-		GRAPHICS.set_function("FADE_UP_PED_LIGHT", LUA_NATIVE_GRAPHICS_FADE_UP_PED_LIGHT);
-		GRAPHICS.set_function("UPDATE_LIGHTS_ON_ENTITY", LUA_NATIVE_GRAPHICS_UPDATE_LIGHTS_ON_ENTITY);
-		GRAPHICS.set_function("SET_LIGHT_OVERRIDE_MAX_INTENSITY_SCALE", LUA_NATIVE_GRAPHICS_SET_LIGHT_OVERRIDE_MAX_INTENSITY_SCALE);
-		GRAPHICS.set_function("GET_LIGHT_OVERRIDE_MAX_INTENSITY_SCALE", LUA_NATIVE_GRAPHICS_GET_LIGHT_OVERRIDE_MAX_INTENSITY_SCALE);
-		GRAPHICS.set_function("DRAW_MARKER", LUA_NATIVE_GRAPHICS_DRAW_MARKER);
-		GRAPHICS.set_function("DRAW_MARKER_EX", LUA_NATIVE_GRAPHICS_DRAW_MARKER_EX);
-		GRAPHICS.set_function("DRAW_MARKER_SPHERE", LUA_NATIVE_GRAPHICS_DRAW_MARKER_SPHERE);
-		GRAPHICS.set_function("CREATE_CHECKPOINT", LUA_NATIVE_GRAPHICS_CREATE_CHECKPOINT);
-		GRAPHICS.set_function("SET_CHECKPOINT_INSIDE_CYLINDER_HEIGHT_SCALE", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_INSIDE_CYLINDER_HEIGHT_SCALE);
-		GRAPHICS.set_function("SET_CHECKPOINT_INSIDE_CYLINDER_SCALE", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_INSIDE_CYLINDER_SCALE);
-		GRAPHICS.set_function("SET_CHECKPOINT_CYLINDER_HEIGHT", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_CYLINDER_HEIGHT);
-		GRAPHICS.set_function("SET_CHECKPOINT_RGBA", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_RGBA);
-		GRAPHICS.set_function("SET_CHECKPOINT_RGBA2", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_RGBA2);
-		GRAPHICS.set_function("SET_CHECKPOINT_CLIPPLANE_WITH_POS_NORM", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_CLIPPLANE_WITH_POS_NORM);
-		GRAPHICS.set_function("SET_CHECKPOINT_FORCE_OLD_ARROW_POINTING", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_FORCE_OLD_ARROW_POINTING);
-		GRAPHICS.set_function("SET_CHECKPOINT_DECAL_ROT_ALIGNED_TO_CAMERA_ROT", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_DECAL_ROT_ALIGNED_TO_CAMERA_ROT);
-		GRAPHICS.set_function("SET_CHECKPOINT_FORCE_DIRECTION", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_FORCE_DIRECTION);
-		GRAPHICS.set_function("SET_CHECKPOINT_DIRECTION", LUA_NATIVE_GRAPHICS_SET_CHECKPOINT_DIRECTION);
-		GRAPHICS.set_function("DELETE_CHECKPOINT", LUA_NATIVE_GRAPHICS_DELETE_CHECKPOINT);
-		GRAPHICS.set_function("DONT_RENDER_IN_GAME_UI", LUA_NATIVE_GRAPHICS_DONT_RENDER_IN_GAME_UI);
-		GRAPHICS.set_function("FORCE_RENDER_IN_GAME_UI", LUA_NATIVE_GRAPHICS_FORCE_RENDER_IN_GAME_UI);
-		GRAPHICS.set_function("REQUEST_STREAMED_TEXTURE_DICT", LUA_NATIVE_GRAPHICS_REQUEST_STREAMED_TEXTURE_DICT);
-		GRAPHICS.set_function("HAS_STREAMED_TEXTURE_DICT_LOADED", LUA_NATIVE_GRAPHICS_HAS_STREAMED_TEXTURE_DICT_LOADED);
-		GRAPHICS.set_function("SET_STREAMED_TEXTURE_DICT_AS_NO_LONGER_NEEDED", LUA_NATIVE_GRAPHICS_SET_STREAMED_TEXTURE_DICT_AS_NO_LONGER_NEEDED);
-		GRAPHICS.set_function("DRAW_RECT", LUA_NATIVE_GRAPHICS_DRAW_RECT);
-		GRAPHICS.set_function("SET_SCRIPT_GFX_DRAW_BEHIND_PAUSEMENU", LUA_NATIVE_GRAPHICS_SET_SCRIPT_GFX_DRAW_BEHIND_PAUSEMENU);
-		GRAPHICS.set_function("SET_SCRIPT_GFX_DRAW_ORDER", LUA_NATIVE_GRAPHICS_SET_SCRIPT_GFX_DRAW_ORDER);
-		GRAPHICS.set_function("SET_SCRIPT_GFX_ALIGN", LUA_NATIVE_GRAPHICS_SET_SCRIPT_GFX_ALIGN);
-		GRAPHICS.set_function("RESET_SCRIPT_GFX_ALIGN", LUA_NATIVE_GRAPHICS_RESET_SCRIPT_GFX_ALIGN);
-		GRAPHICS.set_function("SET_SCRIPT_GFX_ALIGN_PARAMS", LUA_NATIVE_GRAPHICS_SET_SCRIPT_GFX_ALIGN_PARAMS);
-		GRAPHICS.set_function("GET_SCRIPT_GFX_ALIGN_POSITION", LUA_NATIVE_GRAPHICS_GET_SCRIPT_GFX_ALIGN_POSITION);
-		GRAPHICS.set_function("GET_SAFE_ZONE_SIZE", LUA_NATIVE_GRAPHICS_GET_SAFE_ZONE_SIZE);
-		GRAPHICS.set_function("DRAW_SPRITE", LUA_NATIVE_GRAPHICS_DRAW_SPRITE);
-		GRAPHICS.set_function("DRAW_SPRITE_ARX", LUA_NATIVE_GRAPHICS_DRAW_SPRITE_ARX);
-		GRAPHICS.set_function("DRAW_SPRITE_NAMED_RENDERTARGET", LUA_NATIVE_GRAPHICS_DRAW_SPRITE_NAMED_RENDERTARGET);
-		GRAPHICS.set_function("DRAW_SPRITE_ARX_WITH_UV", LUA_NATIVE_GRAPHICS_DRAW_SPRITE_ARX_WITH_UV);
-		GRAPHICS.set_function("ADD_ENTITY_ICON", LUA_NATIVE_GRAPHICS_ADD_ENTITY_ICON);
-		GRAPHICS.set_function("SET_ENTITY_ICON_VISIBILITY", LUA_NATIVE_GRAPHICS_SET_ENTITY_ICON_VISIBILITY);
-		GRAPHICS.set_function("SET_ENTITY_ICON_COLOR", LUA_NATIVE_GRAPHICS_SET_ENTITY_ICON_COLOR);
-		GRAPHICS.set_function("SET_DRAW_ORIGIN", LUA_NATIVE_GRAPHICS_SET_DRAW_ORIGIN);
-		GRAPHICS.set_function("CLEAR_DRAW_ORIGIN", LUA_NATIVE_GRAPHICS_CLEAR_DRAW_ORIGIN);
-		GRAPHICS.set_function("SET_BINK_MOVIE", LUA_NATIVE_GRAPHICS_SET_BINK_MOVIE);
-		GRAPHICS.set_function("PLAY_BINK_MOVIE", LUA_NATIVE_GRAPHICS_PLAY_BINK_MOVIE);
-		GRAPHICS.set_function("STOP_BINK_MOVIE", LUA_NATIVE_GRAPHICS_STOP_BINK_MOVIE);
-		GRAPHICS.set_function("RELEASE_BINK_MOVIE", LUA_NATIVE_GRAPHICS_RELEASE_BINK_MOVIE);
-		GRAPHICS.set_function("DRAW_BINK_MOVIE", LUA_NATIVE_GRAPHICS_DRAW_BINK_MOVIE);
-		GRAPHICS.set_function("SET_BINK_MOVIE_TIME", LUA_NATIVE_GRAPHICS_SET_BINK_MOVIE_TIME);
-		GRAPHICS.set_function("GET_BINK_MOVIE_TIME", LUA_NATIVE_GRAPHICS_GET_BINK_MOVIE_TIME);
-		GRAPHICS.set_function("SET_BINK_MOVIE_VOLUME", LUA_NATIVE_GRAPHICS_SET_BINK_MOVIE_VOLUME);
-		GRAPHICS.set_function("ATTACH_TV_AUDIO_TO_ENTITY", LUA_NATIVE_GRAPHICS_ATTACH_TV_AUDIO_TO_ENTITY);
-		GRAPHICS.set_function("SET_BINK_MOVIE_AUDIO_FRONTEND", LUA_NATIVE_GRAPHICS_SET_BINK_MOVIE_AUDIO_FRONTEND);
-		GRAPHICS.set_function("SET_TV_AUDIO_FRONTEND", LUA_NATIVE_GRAPHICS_SET_TV_AUDIO_FRONTEND);
-		GRAPHICS.set_function("SET_BINK_SHOULD_SKIP", LUA_NATIVE_GRAPHICS_SET_BINK_SHOULD_SKIP);
-		GRAPHICS.set_function("LOAD_MOVIE_MESH_SET", LUA_NATIVE_GRAPHICS_LOAD_MOVIE_MESH_SET);
-		GRAPHICS.set_function("RELEASE_MOVIE_MESH_SET", LUA_NATIVE_GRAPHICS_RELEASE_MOVIE_MESH_SET);
-		GRAPHICS.set_function("QUERY_MOVIE_MESH_SET_STATE", LUA_NATIVE_GRAPHICS_QUERY_MOVIE_MESH_SET_STATE);
-		GRAPHICS.set_function("GET_SCREEN_RESOLUTION", LUA_NATIVE_GRAPHICS_GET_SCREEN_RESOLUTION);
-		GRAPHICS.set_function("GET_ACTUAL_SCREEN_RESOLUTION", LUA_NATIVE_GRAPHICS_GET_ACTUAL_SCREEN_RESOLUTION);
-		GRAPHICS.set_function("GET_ASPECT_RATIO", LUA_NATIVE_GRAPHICS_GET_ASPECT_RATIO);
-		GRAPHICS.set_function("GET_SCREEN_ASPECT_RATIO", LUA_NATIVE_GRAPHICS_GET_SCREEN_ASPECT_RATIO);
-		GRAPHICS.set_function("GET_IS_WIDESCREEN", LUA_NATIVE_GRAPHICS_GET_IS_WIDESCREEN);
-		GRAPHICS.set_function("GET_IS_HIDEF", LUA_NATIVE_GRAPHICS_GET_IS_HIDEF);
-		GRAPHICS.set_function("ADJUST_NEXT_POS_SIZE_AS_NORMALIZED_16_9", LUA_NATIVE_GRAPHICS_ADJUST_NEXT_POS_SIZE_AS_NORMALIZED_16_9);
-		GRAPHICS.set_function("SET_NIGHTVISION", LUA_NATIVE_GRAPHICS_SET_NIGHTVISION);
-		GRAPHICS.set_function("GET_REQUESTINGNIGHTVISION", LUA_NATIVE_GRAPHICS_GET_REQUESTINGNIGHTVISION);
-		GRAPHICS.set_function("GET_USINGNIGHTVISION", LUA_NATIVE_GRAPHICS_GET_USINGNIGHTVISION);
-		GRAPHICS.set_function("SET_EXPOSURETWEAK", LUA_NATIVE_GRAPHICS_SET_EXPOSURETWEAK);
-		GRAPHICS.set_function("FORCE_EXPOSURE_READBACK", LUA_NATIVE_GRAPHICS_FORCE_EXPOSURE_READBACK);
-		GRAPHICS.set_function("OVERRIDE_NIGHTVISION_LIGHT_RANGE", LUA_NATIVE_GRAPHICS_OVERRIDE_NIGHTVISION_LIGHT_RANGE);
-		GRAPHICS.set_function("SET_NOISEOVERIDE", LUA_NATIVE_GRAPHICS_SET_NOISEOVERIDE);
-		GRAPHICS.set_function("SET_NOISINESSOVERIDE", LUA_NATIVE_GRAPHICS_SET_NOISINESSOVERIDE);
-		GRAPHICS.set_function("GET_SCREEN_COORD_FROM_WORLD_COORD", LUA_NATIVE_GRAPHICS_GET_SCREEN_COORD_FROM_WORLD_COORD);
-		GRAPHICS.set_function("GET_TEXTURE_RESOLUTION", LUA_NATIVE_GRAPHICS_GET_TEXTURE_RESOLUTION);
-		GRAPHICS.set_function("OVERRIDE_PED_CREW_LOGO_TEXTURE", LUA_NATIVE_GRAPHICS_OVERRIDE_PED_CREW_LOGO_TEXTURE);
-		GRAPHICS.set_function("SET_DISTANCE_BLUR_STRENGTH_OVERRIDE", LUA_NATIVE_GRAPHICS_SET_DISTANCE_BLUR_STRENGTH_OVERRIDE);
-		GRAPHICS.set_function("SET_FLASH", LUA_NATIVE_GRAPHICS_SET_FLASH);
-		GRAPHICS.set_function("DISABLE_OCCLUSION_THIS_FRAME", LUA_NATIVE_GRAPHICS_DISABLE_OCCLUSION_THIS_FRAME);
-		GRAPHICS.set_function("SET_ARTIFICIAL_LIGHTS_STATE", LUA_NATIVE_GRAPHICS_SET_ARTIFICIAL_LIGHTS_STATE);
-		GRAPHICS.set_function("SET_ARTIFICIAL_VEHICLE_LIGHTS_STATE", LUA_NATIVE_GRAPHICS_SET_ARTIFICIAL_VEHICLE_LIGHTS_STATE);
-		GRAPHICS.set_function("DISABLE_HDTEX_THIS_FRAME", LUA_NATIVE_GRAPHICS_DISABLE_HDTEX_THIS_FRAME);
-		GRAPHICS.set_function("CREATE_TRACKED_POINT", LUA_NATIVE_GRAPHICS_CREATE_TRACKED_POINT);
-		GRAPHICS.set_function("SET_TRACKED_POINT_INFO", LUA_NATIVE_GRAPHICS_SET_TRACKED_POINT_INFO);
-		GRAPHICS.set_function("IS_TRACKED_POINT_VISIBLE", LUA_NATIVE_GRAPHICS_IS_TRACKED_POINT_VISIBLE);
-		GRAPHICS.set_function("DESTROY_TRACKED_POINT", LUA_NATIVE_GRAPHICS_DESTROY_TRACKED_POINT);
-		GRAPHICS.set_function("SET_GRASS_CULL_SPHERE", LUA_NATIVE_GRAPHICS_SET_GRASS_CULL_SPHERE);
-		GRAPHICS.set_function("REMOVE_GRASS_CULL_SPHERE", LUA_NATIVE_GRAPHICS_REMOVE_GRASS_CULL_SPHERE);
-		GRAPHICS.set_function("PROCGRASS_ENABLE_CULLSPHERE", LUA_NATIVE_GRAPHICS_PROCGRASS_ENABLE_CULLSPHERE);
-		GRAPHICS.set_function("PROCGRASS_DISABLE_CULLSPHERE", LUA_NATIVE_GRAPHICS_PROCGRASS_DISABLE_CULLSPHERE);
-		GRAPHICS.set_function("PROCGRASS_IS_CULLSPHERE_ENABLED", LUA_NATIVE_GRAPHICS_PROCGRASS_IS_CULLSPHERE_ENABLED);
-		GRAPHICS.set_function("PROCGRASS_ENABLE_AMBSCALESCAN", LUA_NATIVE_GRAPHICS_PROCGRASS_ENABLE_AMBSCALESCAN);
-		GRAPHICS.set_function("PROCGRASS_DISABLE_AMBSCALESCAN", LUA_NATIVE_GRAPHICS_PROCGRASS_DISABLE_AMBSCALESCAN);
-		GRAPHICS.set_function("DISABLE_PROCOBJ_CREATION", LUA_NATIVE_GRAPHICS_DISABLE_PROCOBJ_CREATION);
-		GRAPHICS.set_function("ENABLE_PROCOBJ_CREATION", LUA_NATIVE_GRAPHICS_ENABLE_PROCOBJ_CREATION);
-		GRAPHICS.set_function("GRASSBATCH_ENABLE_FLATTENING_EXT_IN_SPHERE", LUA_NATIVE_GRAPHICS_GRASSBATCH_ENABLE_FLATTENING_EXT_IN_SPHERE);
-		GRAPHICS.set_function("GRASSBATCH_ENABLE_FLATTENING_IN_SPHERE", LUA_NATIVE_GRAPHICS_GRASSBATCH_ENABLE_FLATTENING_IN_SPHERE);
-		GRAPHICS.set_function("GRASSBATCH_DISABLE_FLATTENING", LUA_NATIVE_GRAPHICS_GRASSBATCH_DISABLE_FLATTENING);
-		GRAPHICS.set_function("CASCADE_SHADOWS_INIT_SESSION", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_INIT_SESSION);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_CASCADE_BOUNDS", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_CASCADE_BOUNDS);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_CASCADE_BOUNDS_SCALE", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_CASCADE_BOUNDS_SCALE);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_ENTITY_TRACKER_SCALE", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_ENTITY_TRACKER_SCALE);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_SPLIT_Z_EXP_WEIGHT", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_SPLIT_Z_EXP_WEIGHT);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_BOUND_POSITION", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_BOUND_POSITION);
-		GRAPHICS.set_function("CASCADE_SHADOWS_ENABLE_ENTITY_TRACKER", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_ENABLE_ENTITY_TRACKER);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_SCREEN_SIZE_CHECK_ENABLED", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_SCREEN_SIZE_CHECK_ENABLED);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_SHADOW_SAMPLE_TYPE", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_SHADOW_SAMPLE_TYPE);
-		GRAPHICS.set_function("CASCADE_SHADOWS_CLEAR_SHADOW_SAMPLE_TYPE", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_CLEAR_SHADOW_SAMPLE_TYPE);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_AIRCRAFT_MODE", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_AIRCRAFT_MODE);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_DYNAMIC_DEPTH_MODE", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_DYNAMIC_DEPTH_MODE);
-		GRAPHICS.set_function("CASCADE_SHADOWS_SET_DYNAMIC_DEPTH_VALUE", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_SET_DYNAMIC_DEPTH_VALUE);
-		GRAPHICS.set_function("CASCADE_SHADOWS_ENABLE_FREEZER", LUA_NATIVE_GRAPHICS_CASCADE_SHADOWS_ENABLE_FREEZER);
-		GRAPHICS.set_function("WATER_REFLECTION_SET_SCRIPT_OBJECT_VISIBILITY", LUA_NATIVE_GRAPHICS_WATER_REFLECTION_SET_SCRIPT_OBJECT_VISIBILITY);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_ENABLED", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_ENABLED);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_PATH", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_PATH);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_RADIUS", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_RADIUS);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_COLOUR", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_COLOUR);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_TESSELLATION", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_TESSELLATION);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_FIXED_CONTROL_POINT_ENABLE", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_FIXED_CONTROL_POINT_ENABLE);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_FIXED_CONTROL_POINT", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_FIXED_CONTROL_POINT);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_SHADER_PARAMS", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_SHADER_PARAMS);
-		GRAPHICS.set_function("GOLF_TRAIL_SET_FACING", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_SET_FACING);
-		GRAPHICS.set_function("GOLF_TRAIL_GET_MAX_HEIGHT", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_GET_MAX_HEIGHT);
-		GRAPHICS.set_function("GOLF_TRAIL_GET_VISUAL_CONTROL_POINT", LUA_NATIVE_GRAPHICS_GOLF_TRAIL_GET_VISUAL_CONTROL_POINT);
-		GRAPHICS.set_function("SET_SEETHROUGH", LUA_NATIVE_GRAPHICS_SET_SEETHROUGH);
-		GRAPHICS.set_function("GET_USINGSEETHROUGH", LUA_NATIVE_GRAPHICS_GET_USINGSEETHROUGH);
-		GRAPHICS.set_function("SEETHROUGH_RESET", LUA_NATIVE_GRAPHICS_SEETHROUGH_RESET);
-		GRAPHICS.set_function("SEETHROUGH_SET_FADE_STARTDISTANCE", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_FADE_STARTDISTANCE);
-		GRAPHICS.set_function("SEETHROUGH_SET_FADE_ENDDISTANCE", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_FADE_ENDDISTANCE);
-		GRAPHICS.set_function("SEETHROUGH_GET_MAX_THICKNESS", LUA_NATIVE_GRAPHICS_SEETHROUGH_GET_MAX_THICKNESS);
-		GRAPHICS.set_function("SEETHROUGH_SET_MAX_THICKNESS", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_MAX_THICKNESS);
-		GRAPHICS.set_function("SEETHROUGH_SET_NOISE_MIN", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_NOISE_MIN);
-		GRAPHICS.set_function("SEETHROUGH_SET_NOISE_MAX", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_NOISE_MAX);
-		GRAPHICS.set_function("SEETHROUGH_SET_HILIGHT_INTENSITY", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_HILIGHT_INTENSITY);
-		GRAPHICS.set_function("SEETHROUGH_SET_HIGHLIGHT_NOISE", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_HIGHLIGHT_NOISE);
-		GRAPHICS.set_function("SEETHROUGH_SET_HEATSCALE", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_HEATSCALE);
-		GRAPHICS.set_function("SEETHROUGH_SET_COLOR_NEAR", LUA_NATIVE_GRAPHICS_SEETHROUGH_SET_COLOR_NEAR);
-		GRAPHICS.set_function("SET_MOTIONBLUR_MAX_VEL_SCALER", LUA_NATIVE_GRAPHICS_SET_MOTIONBLUR_MAX_VEL_SCALER);
-		GRAPHICS.set_function("GET_MOTIONBLUR_MAX_VEL_SCALER", LUA_NATIVE_GRAPHICS_GET_MOTIONBLUR_MAX_VEL_SCALER);
-		GRAPHICS.set_function("SET_FORCE_MOTIONBLUR", LUA_NATIVE_GRAPHICS_SET_FORCE_MOTIONBLUR);
-		GRAPHICS.set_function("TOGGLE_PLAYER_DAMAGE_OVERLAY", LUA_NATIVE_GRAPHICS_TOGGLE_PLAYER_DAMAGE_OVERLAY);
-		GRAPHICS.set_function("RESET_ADAPTATION", LUA_NATIVE_GRAPHICS_RESET_ADAPTATION);
-		GRAPHICS.set_function("TRIGGER_SCREENBLUR_FADE_IN", LUA_NATIVE_GRAPHICS_TRIGGER_SCREENBLUR_FADE_IN);
-		GRAPHICS.set_function("TRIGGER_SCREENBLUR_FADE_OUT", LUA_NATIVE_GRAPHICS_TRIGGER_SCREENBLUR_FADE_OUT);
-		GRAPHICS.set_function("DISABLE_SCREENBLUR_FADE", LUA_NATIVE_GRAPHICS_DISABLE_SCREENBLUR_FADE);
-		GRAPHICS.set_function("GET_SCREENBLUR_FADE_CURRENT_TIME", LUA_NATIVE_GRAPHICS_GET_SCREENBLUR_FADE_CURRENT_TIME);
-		GRAPHICS.set_function("IS_SCREENBLUR_FADE_RUNNING", LUA_NATIVE_GRAPHICS_IS_SCREENBLUR_FADE_RUNNING);
-		GRAPHICS.set_function("TOGGLE_PAUSED_RENDERPHASES", LUA_NATIVE_GRAPHICS_TOGGLE_PAUSED_RENDERPHASES);
-		GRAPHICS.set_function("GET_TOGGLE_PAUSED_RENDERPHASES_STATUS", LUA_NATIVE_GRAPHICS_GET_TOGGLE_PAUSED_RENDERPHASES_STATUS);
-		GRAPHICS.set_function("RESET_PAUSED_RENDERPHASES", LUA_NATIVE_GRAPHICS_RESET_PAUSED_RENDERPHASES);
-		GRAPHICS.set_function("GRAB_PAUSEMENU_OWNERSHIP", LUA_NATIVE_GRAPHICS_GRAB_PAUSEMENU_OWNERSHIP);
-		GRAPHICS.set_function("SET_HIDOF_OVERRIDE", LUA_NATIVE_GRAPHICS_SET_HIDOF_OVERRIDE);
-		GRAPHICS.set_function("SET_LOCK_ADAPTIVE_DOF_DISTANCE", LUA_NATIVE_GRAPHICS_SET_LOCK_ADAPTIVE_DOF_DISTANCE);
-		GRAPHICS.set_function("PHONEPHOTOEDITOR_TOGGLE", LUA_NATIVE_GRAPHICS_PHONEPHOTOEDITOR_TOGGLE);
-		GRAPHICS.set_function("PHONEPHOTOEDITOR_IS_ACTIVE", LUA_NATIVE_GRAPHICS_PHONEPHOTOEDITOR_IS_ACTIVE);
-		GRAPHICS.set_function("PHONEPHOTOEDITOR_SET_FRAME_TXD", LUA_NATIVE_GRAPHICS_PHONEPHOTOEDITOR_SET_FRAME_TXD);
-		GRAPHICS.set_function("START_PARTICLE_FX_NON_LOOPED_AT_COORD", LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_NON_LOOPED_AT_COORD);
-		GRAPHICS.set_function("START_NETWORKED_PARTICLE_FX_NON_LOOPED_AT_COORD", LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_NON_LOOPED_AT_COORD);
-		GRAPHICS.set_function("START_PARTICLE_FX_NON_LOOPED_ON_PED_BONE", LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_NON_LOOPED_ON_PED_BONE);
-		GRAPHICS.set_function("START_NETWORKED_PARTICLE_FX_NON_LOOPED_ON_PED_BONE", LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_NON_LOOPED_ON_PED_BONE);
-		GRAPHICS.set_function("START_PARTICLE_FX_NON_LOOPED_ON_ENTITY", LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_NON_LOOPED_ON_ENTITY);
-		GRAPHICS.set_function("START_NETWORKED_PARTICLE_FX_NON_LOOPED_ON_ENTITY", LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_NON_LOOPED_ON_ENTITY);
-		GRAPHICS.set_function("START_PARTICLE_FX_NON_LOOPED_ON_ENTITY_BONE", LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_NON_LOOPED_ON_ENTITY_BONE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_NON_LOOPED_COLOUR", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_NON_LOOPED_COLOUR);
-		GRAPHICS.set_function("SET_PARTICLE_FX_NON_LOOPED_ALPHA", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_NON_LOOPED_ALPHA);
-		GRAPHICS.set_function("SET_PARTICLE_FX_NON_LOOPED_SCALE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_NON_LOOPED_SCALE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_NON_LOOPED_EMITTER_SIZE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_NON_LOOPED_EMITTER_SIZE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_FORCE_VEHICLE_INTERIOR", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_FORCE_VEHICLE_INTERIOR);
-		GRAPHICS.set_function("START_PARTICLE_FX_LOOPED_AT_COORD", LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_LOOPED_AT_COORD);
-		GRAPHICS.set_function("START_PARTICLE_FX_LOOPED_ON_PED_BONE", LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_LOOPED_ON_PED_BONE);
-		GRAPHICS.set_function("START_PARTICLE_FX_LOOPED_ON_ENTITY", LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_LOOPED_ON_ENTITY);
-		GRAPHICS.set_function("START_PARTICLE_FX_LOOPED_ON_ENTITY_BONE", LUA_NATIVE_GRAPHICS_START_PARTICLE_FX_LOOPED_ON_ENTITY_BONE);
-		GRAPHICS.set_function("START_NETWORKED_PARTICLE_FX_LOOPED_ON_ENTITY", LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_LOOPED_ON_ENTITY);
-		GRAPHICS.set_function("START_NETWORKED_PARTICLE_FX_LOOPED_ON_ENTITY_BONE", LUA_NATIVE_GRAPHICS_START_NETWORKED_PARTICLE_FX_LOOPED_ON_ENTITY_BONE);
-		GRAPHICS.set_function("STOP_PARTICLE_FX_LOOPED", LUA_NATIVE_GRAPHICS_STOP_PARTICLE_FX_LOOPED);
-		GRAPHICS.set_function("REMOVE_PARTICLE_FX", LUA_NATIVE_GRAPHICS_REMOVE_PARTICLE_FX);
-		GRAPHICS.set_function("REMOVE_PARTICLE_FX_FROM_ENTITY", LUA_NATIVE_GRAPHICS_REMOVE_PARTICLE_FX_FROM_ENTITY);
-		GRAPHICS.set_function("REMOVE_PARTICLE_FX_IN_RANGE", LUA_NATIVE_GRAPHICS_REMOVE_PARTICLE_FX_IN_RANGE);
-		GRAPHICS.set_function("FORCE_PARTICLE_FX_IN_VEHICLE_INTERIOR", LUA_NATIVE_GRAPHICS_FORCE_PARTICLE_FX_IN_VEHICLE_INTERIOR);
-		GRAPHICS.set_function("DOES_PARTICLE_FX_LOOPED_EXIST", LUA_NATIVE_GRAPHICS_DOES_PARTICLE_FX_LOOPED_EXIST);
-		GRAPHICS.set_function("SET_PARTICLE_FX_LOOPED_OFFSETS", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_OFFSETS);
-		GRAPHICS.set_function("SET_PARTICLE_FX_LOOPED_EVOLUTION", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_EVOLUTION);
-		GRAPHICS.set_function("SET_PARTICLE_FX_LOOPED_COLOUR", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_COLOUR);
-		GRAPHICS.set_function("SET_PARTICLE_FX_LOOPED_ALPHA", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_ALPHA);
-		GRAPHICS.set_function("SET_PARTICLE_FX_LOOPED_SCALE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_SCALE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_LOOPED_FAR_CLIP_DIST", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_FAR_CLIP_DIST);
-		GRAPHICS.set_function("SET_PARTICLE_FX_LOOPED_CAMERA_BIAS_", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_LOOPED_CAMERA_BIAS_);
-		GRAPHICS.set_function("SET_PARTICLE_FX_CAM_INSIDE_VEHICLE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_CAM_INSIDE_VEHICLE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_CAM_INSIDE_NONPLAYER_VEHICLE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_CAM_INSIDE_NONPLAYER_VEHICLE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_SHOOTOUT_BOAT", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_SHOOTOUT_BOAT);
-		GRAPHICS.set_function("CLEAR_PARTICLE_FX_SHOOTOUT_BOAT", LUA_NATIVE_GRAPHICS_CLEAR_PARTICLE_FX_SHOOTOUT_BOAT);
-		GRAPHICS.set_function("SET_PARTICLE_FX_BLOOD_SCALE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BLOOD_SCALE);
-		GRAPHICS.set_function("DISABLE_IN_WATER_PTFX", LUA_NATIVE_GRAPHICS_DISABLE_IN_WATER_PTFX);
-		GRAPHICS.set_function("DISABLE_DOWNWASH_PTFX", LUA_NATIVE_GRAPHICS_DISABLE_DOWNWASH_PTFX);
-		GRAPHICS.set_function("SET_PARTICLE_FX_SLIPSTREAM_LODRANGE_SCALE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_SLIPSTREAM_LODRANGE_SCALE);
-		GRAPHICS.set_function("ENABLE_CLOWN_BLOOD_VFX", LUA_NATIVE_GRAPHICS_ENABLE_CLOWN_BLOOD_VFX);
-		GRAPHICS.set_function("ENABLE_ALIEN_BLOOD_VFX", LUA_NATIVE_GRAPHICS_ENABLE_ALIEN_BLOOD_VFX);
-		GRAPHICS.set_function("SET_PARTICLE_FX_BULLET_IMPACT_SCALE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BULLET_IMPACT_SCALE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_BULLET_IMPACT_LODRANGE_SCALE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BULLET_IMPACT_LODRANGE_SCALE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_BULLET_TRACE_NO_ANGLE_REJECT", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BULLET_TRACE_NO_ANGLE_REJECT);
-		GRAPHICS.set_function("SET_PARTICLE_FX_BANG_SCRAPE_LODRANGE_SCALE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_BANG_SCRAPE_LODRANGE_SCALE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_FOOT_LODRANGE_SCALE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_FOOT_LODRANGE_SCALE);
-		GRAPHICS.set_function("SET_PARTICLE_FX_FOOT_OVERRIDE_NAME", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_FOOT_OVERRIDE_NAME);
-		GRAPHICS.set_function("SET_SKIDMARK_RANGE_SCALE", LUA_NATIVE_GRAPHICS_SET_SKIDMARK_RANGE_SCALE);
-		GRAPHICS.set_function("SET_PTFX_FORCE_VEHICLE_INTERIOR_FLAG", LUA_NATIVE_GRAPHICS_SET_PTFX_FORCE_VEHICLE_INTERIOR_FLAG);
-		GRAPHICS.set_function("REGISTER_POSTFX_BULLET_IMPACT", LUA_NATIVE_GRAPHICS_REGISTER_POSTFX_BULLET_IMPACT);
-		GRAPHICS.set_function("FORCE_POSTFX_BULLET_IMPACTS_AFTER_HUD", LUA_NATIVE_GRAPHICS_FORCE_POSTFX_BULLET_IMPACTS_AFTER_HUD);
-		GRAPHICS.set_function("USE_PARTICLE_FX_ASSET", LUA_NATIVE_GRAPHICS_USE_PARTICLE_FX_ASSET);
-		GRAPHICS.set_function("SET_PARTICLE_FX_OVERRIDE", LUA_NATIVE_GRAPHICS_SET_PARTICLE_FX_OVERRIDE);
-		GRAPHICS.set_function("RESET_PARTICLE_FX_OVERRIDE", LUA_NATIVE_GRAPHICS_RESET_PARTICLE_FX_OVERRIDE);
-		GRAPHICS.set_function("START_VEHICLE_PARTICLE_FX_LOOPED_", LUA_NATIVE_GRAPHICS_START_VEHICLE_PARTICLE_FX_LOOPED_);
-		GRAPHICS.set_function("SET_WEATHER_PTFX_USE_OVERRIDE_SETTINGS", LUA_NATIVE_GRAPHICS_SET_WEATHER_PTFX_USE_OVERRIDE_SETTINGS);
-		GRAPHICS.set_function("SET_WEATHER_PTFX_OVERRIDE_CURR_LEVEL", LUA_NATIVE_GRAPHICS_SET_WEATHER_PTFX_OVERRIDE_CURR_LEVEL);
-		GRAPHICS.set_function("WASH_DECALS_IN_RANGE", LUA_NATIVE_GRAPHICS_WASH_DECALS_IN_RANGE);
-		GRAPHICS.set_function("WASH_DECALS_FROM_VEHICLE", LUA_NATIVE_GRAPHICS_WASH_DECALS_FROM_VEHICLE);
-		GRAPHICS.set_function("FADE_DECALS_IN_RANGE", LUA_NATIVE_GRAPHICS_FADE_DECALS_IN_RANGE);
-		GRAPHICS.set_function("REMOVE_DECALS_IN_RANGE", LUA_NATIVE_GRAPHICS_REMOVE_DECALS_IN_RANGE);
-		GRAPHICS.set_function("REMOVE_DECALS_FROM_OBJECT", LUA_NATIVE_GRAPHICS_REMOVE_DECALS_FROM_OBJECT);
-		GRAPHICS.set_function("REMOVE_DECALS_FROM_OBJECT_FACING", LUA_NATIVE_GRAPHICS_REMOVE_DECALS_FROM_OBJECT_FACING);
-		GRAPHICS.set_function("REMOVE_DECALS_FROM_VEHICLE", LUA_NATIVE_GRAPHICS_REMOVE_DECALS_FROM_VEHICLE);
-		GRAPHICS.set_function("ADD_DECAL", LUA_NATIVE_GRAPHICS_ADD_DECAL);
-		GRAPHICS.set_function("ADD_PETROL_DECAL", LUA_NATIVE_GRAPHICS_ADD_PETROL_DECAL);
-		GRAPHICS.set_function("ADD_OIL_DECAL", LUA_NATIVE_GRAPHICS_ADD_OIL_DECAL);
-		GRAPHICS.set_function("START_PETROL_TRAIL_DECALS", LUA_NATIVE_GRAPHICS_START_PETROL_TRAIL_DECALS);
-		GRAPHICS.set_function("ADD_PETROL_TRAIL_DECAL_INFO", LUA_NATIVE_GRAPHICS_ADD_PETROL_TRAIL_DECAL_INFO);
-		GRAPHICS.set_function("END_PETROL_TRAIL_DECALS", LUA_NATIVE_GRAPHICS_END_PETROL_TRAIL_DECALS);
-		GRAPHICS.set_function("REMOVE_DECAL", LUA_NATIVE_GRAPHICS_REMOVE_DECAL);
-		GRAPHICS.set_function("IS_DECAL_ALIVE", LUA_NATIVE_GRAPHICS_IS_DECAL_ALIVE);
-		GRAPHICS.set_function("GET_DECAL_WASH_LEVEL", LUA_NATIVE_GRAPHICS_GET_DECAL_WASH_LEVEL);
-		GRAPHICS.set_function("SET_DISABLE_PETROL_DECALS_IGNITING_THIS_FRAME", LUA_NATIVE_GRAPHICS_SET_DISABLE_PETROL_DECALS_IGNITING_THIS_FRAME);
-		GRAPHICS.set_function("SET_DISABLE_PETROL_DECALS_RECYCLING_THIS_FRAME", LUA_NATIVE_GRAPHICS_SET_DISABLE_PETROL_DECALS_RECYCLING_THIS_FRAME);
-		GRAPHICS.set_function("SET_DISABLE_DECAL_RENDERING_THIS_FRAME", LUA_NATIVE_GRAPHICS_SET_DISABLE_DECAL_RENDERING_THIS_FRAME);
-		GRAPHICS.set_function("GET_IS_PETROL_DECAL_IN_RANGE", LUA_NATIVE_GRAPHICS_GET_IS_PETROL_DECAL_IN_RANGE);
-		GRAPHICS.set_function("PATCH_DECAL_DIFFUSE_MAP", LUA_NATIVE_GRAPHICS_PATCH_DECAL_DIFFUSE_MAP);
-		GRAPHICS.set_function("UNPATCH_DECAL_DIFFUSE_MAP", LUA_NATIVE_GRAPHICS_UNPATCH_DECAL_DIFFUSE_MAP);
-		GRAPHICS.set_function("MOVE_VEHICLE_DECALS", LUA_NATIVE_GRAPHICS_MOVE_VEHICLE_DECALS);
-		GRAPHICS.set_function("ADD_VEHICLE_CREW_EMBLEM", LUA_NATIVE_GRAPHICS_ADD_VEHICLE_CREW_EMBLEM);
-		GRAPHICS.set_function("ABORT_VEHICLE_CREW_EMBLEM_REQUEST", LUA_NATIVE_GRAPHICS_ABORT_VEHICLE_CREW_EMBLEM_REQUEST);
-		GRAPHICS.set_function("REMOVE_VEHICLE_CREW_EMBLEM", LUA_NATIVE_GRAPHICS_REMOVE_VEHICLE_CREW_EMBLEM);
-		GRAPHICS.set_function("GET_VEHICLE_CREW_EMBLEM_REQUEST_STATE", LUA_NATIVE_GRAPHICS_GET_VEHICLE_CREW_EMBLEM_REQUEST_STATE);
-		GRAPHICS.set_function("DOES_VEHICLE_HAVE_CREW_EMBLEM", LUA_NATIVE_GRAPHICS_DOES_VEHICLE_HAVE_CREW_EMBLEM);
-		GRAPHICS.set_function("DISABLE_COMPOSITE_SHOTGUN_DECALS", LUA_NATIVE_GRAPHICS_DISABLE_COMPOSITE_SHOTGUN_DECALS);
-		GRAPHICS.set_function("DISABLE_SCUFF_DECALS", LUA_NATIVE_GRAPHICS_DISABLE_SCUFF_DECALS);
-		GRAPHICS.set_function("SET_DECAL_BULLET_IMPACT_RANGE_SCALE", LUA_NATIVE_GRAPHICS_SET_DECAL_BULLET_IMPACT_RANGE_SCALE);
-		GRAPHICS.set_function("OVERRIDE_INTERIOR_SMOKE_NAME", LUA_NATIVE_GRAPHICS_OVERRIDE_INTERIOR_SMOKE_NAME);
-		GRAPHICS.set_function("OVERRIDE_INTERIOR_SMOKE_LEVEL", LUA_NATIVE_GRAPHICS_OVERRIDE_INTERIOR_SMOKE_LEVEL);
-		GRAPHICS.set_function("OVERRIDE_INTERIOR_SMOKE_END", LUA_NATIVE_GRAPHICS_OVERRIDE_INTERIOR_SMOKE_END);
-		GRAPHICS.set_function("REGISTER_NOIR_LENS_EFFECT", LUA_NATIVE_GRAPHICS_REGISTER_NOIR_LENS_EFFECT);
-		GRAPHICS.set_function("DISABLE_VEHICLE_DISTANTLIGHTS", LUA_NATIVE_GRAPHICS_DISABLE_VEHICLE_DISTANTLIGHTS);
-		GRAPHICS.set_function("RENDER_SHADOWED_LIGHTS_WITH_NO_SHADOWS", LUA_NATIVE_GRAPHICS_RENDER_SHADOWED_LIGHTS_WITH_NO_SHADOWS);
-		GRAPHICS.set_function("REQUEST_EARLY_LIGHT_CHECK", LUA_NATIVE_GRAPHICS_REQUEST_EARLY_LIGHT_CHECK);
-		GRAPHICS.set_function("USE_SNOW_FOOT_VFX_WHEN_UNSHELTERED", LUA_NATIVE_GRAPHICS_USE_SNOW_FOOT_VFX_WHEN_UNSHELTERED);
-		GRAPHICS.set_function("FORCE_ALLOW_SNOW_FOOT_VFX_ON_ICE_", LUA_NATIVE_GRAPHICS_FORCE_ALLOW_SNOW_FOOT_VFX_ON_ICE_);
-		GRAPHICS.set_function("USE_SNOW_WHEEL_VFX_WHEN_UNSHELTERED", LUA_NATIVE_GRAPHICS_USE_SNOW_WHEEL_VFX_WHEN_UNSHELTERED);
-		GRAPHICS.set_function("DISABLE_REGION_VFX", LUA_NATIVE_GRAPHICS_DISABLE_REGION_VFX);
-		GRAPHICS.set_function("FORCE_GROUND_SNOW_PASS_", LUA_NATIVE_GRAPHICS_FORCE_GROUND_SNOW_PASS_);
-		GRAPHICS.set_function("PRESET_INTERIOR_AMBIENT_CACHE", LUA_NATIVE_GRAPHICS_PRESET_INTERIOR_AMBIENT_CACHE);
-		GRAPHICS.set_function("SET_TIMECYCLE_MODIFIER", LUA_NATIVE_GRAPHICS_SET_TIMECYCLE_MODIFIER);
-		GRAPHICS.set_function("SET_TIMECYCLE_MODIFIER_STRENGTH", LUA_NATIVE_GRAPHICS_SET_TIMECYCLE_MODIFIER_STRENGTH);
-		GRAPHICS.set_function("SET_TRANSITION_TIMECYCLE_MODIFIER", LUA_NATIVE_GRAPHICS_SET_TRANSITION_TIMECYCLE_MODIFIER);
-		GRAPHICS.set_function("SET_TRANSITION_OUT_OF_TIMECYCLE_MODIFIER", LUA_NATIVE_GRAPHICS_SET_TRANSITION_OUT_OF_TIMECYCLE_MODIFIER);
-		GRAPHICS.set_function("CLEAR_TIMECYCLE_MODIFIER", LUA_NATIVE_GRAPHICS_CLEAR_TIMECYCLE_MODIFIER);
-		GRAPHICS.set_function("GET_TIMECYCLE_MODIFIER_INDEX", LUA_NATIVE_GRAPHICS_GET_TIMECYCLE_MODIFIER_INDEX);
-		GRAPHICS.set_function("GET_TIMECYCLE_TRANSITION_MODIFIER_INDEX", LUA_NATIVE_GRAPHICS_GET_TIMECYCLE_TRANSITION_MODIFIER_INDEX);
-		GRAPHICS.set_function("GET_IS_TIMECYCLE_TRANSITIONING_OUT", LUA_NATIVE_GRAPHICS_GET_IS_TIMECYCLE_TRANSITIONING_OUT);
-		GRAPHICS.set_function("PUSH_TIMECYCLE_MODIFIER", LUA_NATIVE_GRAPHICS_PUSH_TIMECYCLE_MODIFIER);
-		GRAPHICS.set_function("POP_TIMECYCLE_MODIFIER", LUA_NATIVE_GRAPHICS_POP_TIMECYCLE_MODIFIER);
-		GRAPHICS.set_function("SET_CURRENT_PLAYER_TCMODIFIER", LUA_NATIVE_GRAPHICS_SET_CURRENT_PLAYER_TCMODIFIER);
-		GRAPHICS.set_function("SET_PLAYER_TCMODIFIER_TRANSITION", LUA_NATIVE_GRAPHICS_SET_PLAYER_TCMODIFIER_TRANSITION);
-		GRAPHICS.set_function("SET_NEXT_PLAYER_TCMODIFIER", LUA_NATIVE_GRAPHICS_SET_NEXT_PLAYER_TCMODIFIER);
-		GRAPHICS.set_function("ADD_TCMODIFIER_OVERRIDE", LUA_NATIVE_GRAPHICS_ADD_TCMODIFIER_OVERRIDE);
-		GRAPHICS.set_function("CLEAR_ALL_TCMODIFIER_OVERRIDES", LUA_NATIVE_GRAPHICS_CLEAR_ALL_TCMODIFIER_OVERRIDES);
-		GRAPHICS.set_function("SET_EXTRA_TCMODIFIER", LUA_NATIVE_GRAPHICS_SET_EXTRA_TCMODIFIER);
-		GRAPHICS.set_function("CLEAR_EXTRA_TCMODIFIER", LUA_NATIVE_GRAPHICS_CLEAR_EXTRA_TCMODIFIER);
-		GRAPHICS.set_function("GET_EXTRA_TCMODIFIER", LUA_NATIVE_GRAPHICS_GET_EXTRA_TCMODIFIER);
-		GRAPHICS.set_function("ENABLE_MOON_CYCLE_OVERRIDE", LUA_NATIVE_GRAPHICS_ENABLE_MOON_CYCLE_OVERRIDE);
-		GRAPHICS.set_function("DISABLE_MOON_CYCLE_OVERRIDE", LUA_NATIVE_GRAPHICS_DISABLE_MOON_CYCLE_OVERRIDE);
-		GRAPHICS.set_function("REQUEST_SCALEFORM_MOVIE", LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_MOVIE);
-		GRAPHICS.set_function("REQUEST_SCALEFORM_MOVIE_WITH_IGNORE_SUPER_WIDESCREEN", LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_MOVIE_WITH_IGNORE_SUPER_WIDESCREEN);
-		GRAPHICS.set_function("REQUEST_SCALEFORM_MOVIE_INSTANCE", LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_MOVIE_INSTANCE);
-		GRAPHICS.set_function("REQUEST_SCALEFORM_MOVIE_SKIP_RENDER_WHILE_PAUSED", LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_MOVIE_SKIP_RENDER_WHILE_PAUSED);
-		GRAPHICS.set_function("HAS_SCALEFORM_MOVIE_LOADED", LUA_NATIVE_GRAPHICS_HAS_SCALEFORM_MOVIE_LOADED);
-		GRAPHICS.set_function("IS_ACTIVE_SCALEFORM_MOVIE_DELETING", LUA_NATIVE_GRAPHICS_IS_ACTIVE_SCALEFORM_MOVIE_DELETING);
-		GRAPHICS.set_function("IS_SCALEFORM_MOVIE_DELETING", LUA_NATIVE_GRAPHICS_IS_SCALEFORM_MOVIE_DELETING);
-		GRAPHICS.set_function("HAS_SCALEFORM_MOVIE_FILENAME_LOADED", LUA_NATIVE_GRAPHICS_HAS_SCALEFORM_MOVIE_FILENAME_LOADED);
-		GRAPHICS.set_function("HAS_SCALEFORM_CONTAINER_MOVIE_LOADED_INTO_PARENT", LUA_NATIVE_GRAPHICS_HAS_SCALEFORM_CONTAINER_MOVIE_LOADED_INTO_PARENT);
-		GRAPHICS.set_function("SET_SCALEFORM_MOVIE_AS_NO_LONGER_NEEDED", LUA_NATIVE_GRAPHICS_SET_SCALEFORM_MOVIE_AS_NO_LONGER_NEEDED);
-		GRAPHICS.set_function("SET_SCALEFORM_MOVIE_TO_USE_SYSTEM_TIME", LUA_NATIVE_GRAPHICS_SET_SCALEFORM_MOVIE_TO_USE_SYSTEM_TIME);
-		GRAPHICS.set_function("SET_SCALEFORM_MOVIE_TO_USE_LARGE_RT", LUA_NATIVE_GRAPHICS_SET_SCALEFORM_MOVIE_TO_USE_LARGE_RT);
-		GRAPHICS.set_function("SET_SCALEFORM_MOVIE_TO_USE_SUPER_LARGE_RT", LUA_NATIVE_GRAPHICS_SET_SCALEFORM_MOVIE_TO_USE_SUPER_LARGE_RT);
-		GRAPHICS.set_function("DRAW_SCALEFORM_MOVIE", LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE);
-		GRAPHICS.set_function("DRAW_SCALEFORM_MOVIE_FULLSCREEN", LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE_FULLSCREEN);
-		GRAPHICS.set_function("DRAW_SCALEFORM_MOVIE_FULLSCREEN_MASKED", LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE_FULLSCREEN_MASKED);
-		GRAPHICS.set_function("DRAW_SCALEFORM_MOVIE_3D", LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE_3D);
-		GRAPHICS.set_function("DRAW_SCALEFORM_MOVIE_3D_SOLID", LUA_NATIVE_GRAPHICS_DRAW_SCALEFORM_MOVIE_3D_SOLID);
-		GRAPHICS.set_function("CALL_SCALEFORM_MOVIE_METHOD", LUA_NATIVE_GRAPHICS_CALL_SCALEFORM_MOVIE_METHOD);
-		GRAPHICS.set_function("CALL_SCALEFORM_MOVIE_METHOD_WITH_NUMBER", LUA_NATIVE_GRAPHICS_CALL_SCALEFORM_MOVIE_METHOD_WITH_NUMBER);
-		GRAPHICS.set_function("CALL_SCALEFORM_MOVIE_METHOD_WITH_STRING", LUA_NATIVE_GRAPHICS_CALL_SCALEFORM_MOVIE_METHOD_WITH_STRING);
-		GRAPHICS.set_function("CALL_SCALEFORM_MOVIE_METHOD_WITH_NUMBER_AND_STRING", LUA_NATIVE_GRAPHICS_CALL_SCALEFORM_MOVIE_METHOD_WITH_NUMBER_AND_STRING);
-		GRAPHICS.set_function("BEGIN_SCALEFORM_SCRIPT_HUD_MOVIE_METHOD", LUA_NATIVE_GRAPHICS_BEGIN_SCALEFORM_SCRIPT_HUD_MOVIE_METHOD);
-		GRAPHICS.set_function("BEGIN_SCALEFORM_MOVIE_METHOD", LUA_NATIVE_GRAPHICS_BEGIN_SCALEFORM_MOVIE_METHOD);
-		GRAPHICS.set_function("BEGIN_SCALEFORM_MOVIE_METHOD_ON_FRONTEND", LUA_NATIVE_GRAPHICS_BEGIN_SCALEFORM_MOVIE_METHOD_ON_FRONTEND);
-		GRAPHICS.set_function("BEGIN_SCALEFORM_MOVIE_METHOD_ON_FRONTEND_HEADER", LUA_NATIVE_GRAPHICS_BEGIN_SCALEFORM_MOVIE_METHOD_ON_FRONTEND_HEADER);
-		GRAPHICS.set_function("END_SCALEFORM_MOVIE_METHOD", LUA_NATIVE_GRAPHICS_END_SCALEFORM_MOVIE_METHOD);
-		GRAPHICS.set_function("END_SCALEFORM_MOVIE_METHOD_RETURN_VALUE", LUA_NATIVE_GRAPHICS_END_SCALEFORM_MOVIE_METHOD_RETURN_VALUE);
-		GRAPHICS.set_function("IS_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_READY", LUA_NATIVE_GRAPHICS_IS_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_READY);
-		GRAPHICS.set_function("GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_INT", LUA_NATIVE_GRAPHICS_GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_INT);
-		GRAPHICS.set_function("GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_BOOL", LUA_NATIVE_GRAPHICS_GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_BOOL);
-		GRAPHICS.set_function("GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_STRING", LUA_NATIVE_GRAPHICS_GET_SCALEFORM_MOVIE_METHOD_RETURN_VALUE_STRING);
-		GRAPHICS.set_function("SCALEFORM_MOVIE_METHOD_ADD_PARAM_INT", LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_INT);
-		GRAPHICS.set_function("SCALEFORM_MOVIE_METHOD_ADD_PARAM_FLOAT", LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_FLOAT);
-		GRAPHICS.set_function("SCALEFORM_MOVIE_METHOD_ADD_PARAM_BOOL", LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_BOOL);
-		GRAPHICS.set_function("BEGIN_TEXT_COMMAND_SCALEFORM_STRING", LUA_NATIVE_GRAPHICS_BEGIN_TEXT_COMMAND_SCALEFORM_STRING);
-		GRAPHICS.set_function("END_TEXT_COMMAND_SCALEFORM_STRING", LUA_NATIVE_GRAPHICS_END_TEXT_COMMAND_SCALEFORM_STRING);
-		GRAPHICS.set_function("END_TEXT_COMMAND_UNPARSED_SCALEFORM_STRING", LUA_NATIVE_GRAPHICS_END_TEXT_COMMAND_UNPARSED_SCALEFORM_STRING);
-		GRAPHICS.set_function("SCALEFORM_MOVIE_METHOD_ADD_PARAM_LITERAL_STRING", LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_LITERAL_STRING);
-		GRAPHICS.set_function("SCALEFORM_MOVIE_METHOD_ADD_PARAM_TEXTURE_NAME_STRING", LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_TEXTURE_NAME_STRING);
-		GRAPHICS.set_function("SCALEFORM_MOVIE_METHOD_ADD_PARAM_PLAYER_NAME_STRING", LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_PLAYER_NAME_STRING);
-		GRAPHICS.set_function("DOES_LATEST_BRIEF_STRING_EXIST", LUA_NATIVE_GRAPHICS_DOES_LATEST_BRIEF_STRING_EXIST);
-		GRAPHICS.set_function("SCALEFORM_MOVIE_METHOD_ADD_PARAM_LATEST_BRIEF_STRING", LUA_NATIVE_GRAPHICS_SCALEFORM_MOVIE_METHOD_ADD_PARAM_LATEST_BRIEF_STRING);
-		GRAPHICS.set_function("REQUEST_SCALEFORM_SCRIPT_HUD_MOVIE", LUA_NATIVE_GRAPHICS_REQUEST_SCALEFORM_SCRIPT_HUD_MOVIE);
-		GRAPHICS.set_function("HAS_SCALEFORM_SCRIPT_HUD_MOVIE_LOADED", LUA_NATIVE_GRAPHICS_HAS_SCALEFORM_SCRIPT_HUD_MOVIE_LOADED);
-		GRAPHICS.set_function("REMOVE_SCALEFORM_SCRIPT_HUD_MOVIE", LUA_NATIVE_GRAPHICS_REMOVE_SCALEFORM_SCRIPT_HUD_MOVIE);
-		GRAPHICS.set_function("PASS_KEYBOARD_INPUT_TO_SCALEFORM", LUA_NATIVE_GRAPHICS_PASS_KEYBOARD_INPUT_TO_SCALEFORM);
-		GRAPHICS.set_function("SET_TV_CHANNEL", LUA_NATIVE_GRAPHICS_SET_TV_CHANNEL);
-		GRAPHICS.set_function("GET_TV_CHANNEL", LUA_NATIVE_GRAPHICS_GET_TV_CHANNEL);
-		GRAPHICS.set_function("SET_TV_VOLUME", LUA_NATIVE_GRAPHICS_SET_TV_VOLUME);
-		GRAPHICS.set_function("GET_TV_VOLUME", LUA_NATIVE_GRAPHICS_GET_TV_VOLUME);
-		GRAPHICS.set_function("DRAW_TV_CHANNEL", LUA_NATIVE_GRAPHICS_DRAW_TV_CHANNEL);
-		GRAPHICS.set_function("SET_TV_CHANNEL_PLAYLIST", LUA_NATIVE_GRAPHICS_SET_TV_CHANNEL_PLAYLIST);
-		GRAPHICS.set_function("SET_TV_CHANNEL_PLAYLIST_AT_HOUR", LUA_NATIVE_GRAPHICS_SET_TV_CHANNEL_PLAYLIST_AT_HOUR);
-		GRAPHICS.set_function("SET_TV_CHANNEL_PLAYLIST_DIRTY_", LUA_NATIVE_GRAPHICS_SET_TV_CHANNEL_PLAYLIST_DIRTY_);
-		GRAPHICS.set_function("CLEAR_TV_CHANNEL_PLAYLIST", LUA_NATIVE_GRAPHICS_CLEAR_TV_CHANNEL_PLAYLIST);
-		GRAPHICS.set_function("IS_PLAYLIST_ON_CHANNEL", LUA_NATIVE_GRAPHICS_IS_PLAYLIST_ON_CHANNEL);
-		GRAPHICS.set_function("IS_TVSHOW_CURRENTLY_PLAYING", LUA_NATIVE_GRAPHICS_IS_TVSHOW_CURRENTLY_PLAYING);
-		GRAPHICS.set_function("ENABLE_MOVIE_KEYFRAME_WAIT", LUA_NATIVE_GRAPHICS_ENABLE_MOVIE_KEYFRAME_WAIT);
-		GRAPHICS.set_function("SET_TV_PLAYER_WATCHING_THIS_FRAME", LUA_NATIVE_GRAPHICS_SET_TV_PLAYER_WATCHING_THIS_FRAME);
-		GRAPHICS.set_function("GET_CURRENT_TV_CLIP_NAMEHASH", LUA_NATIVE_GRAPHICS_GET_CURRENT_TV_CLIP_NAMEHASH);
-		GRAPHICS.set_function("ENABLE_MOVIE_SUBTITLES", LUA_NATIVE_GRAPHICS_ENABLE_MOVIE_SUBTITLES);
-		GRAPHICS.set_function("UI3DSCENE_IS_AVAILABLE", LUA_NATIVE_GRAPHICS_UI3DSCENE_IS_AVAILABLE);
-		GRAPHICS.set_function("UI3DSCENE_PUSH_PRESET", LUA_NATIVE_GRAPHICS_UI3DSCENE_PUSH_PRESET);
-		GRAPHICS.set_function("UI3DSCENE_ASSIGN_PED_TO_SLOT", LUA_NATIVE_GRAPHICS_UI3DSCENE_ASSIGN_PED_TO_SLOT);
-		GRAPHICS.set_function("UI3DSCENE_CLEAR_PATCHED_DATA", LUA_NATIVE_GRAPHICS_UI3DSCENE_CLEAR_PATCHED_DATA);
-		GRAPHICS.set_function("UI3DSCENE_MAKE_PUSHED_PRESET_PERSISTENT", LUA_NATIVE_GRAPHICS_UI3DSCENE_MAKE_PUSHED_PRESET_PERSISTENT);
-		GRAPHICS.set_function("TERRAINGRID_ACTIVATE", LUA_NATIVE_GRAPHICS_TERRAINGRID_ACTIVATE);
-		GRAPHICS.set_function("TERRAINGRID_SET_PARAMS", LUA_NATIVE_GRAPHICS_TERRAINGRID_SET_PARAMS);
-		GRAPHICS.set_function("TERRAINGRID_SET_COLOURS", LUA_NATIVE_GRAPHICS_TERRAINGRID_SET_COLOURS);
-		GRAPHICS.set_function("ANIMPOSTFX_PLAY", LUA_NATIVE_GRAPHICS_ANIMPOSTFX_PLAY);
-		GRAPHICS.set_function("ANIMPOSTFX_STOP", LUA_NATIVE_GRAPHICS_ANIMPOSTFX_STOP);
-		GRAPHICS.set_function("ANIMPOSTFX_GET_CURRENT_TIME", LUA_NATIVE_GRAPHICS_ANIMPOSTFX_GET_CURRENT_TIME);
-		GRAPHICS.set_function("ANIMPOSTFX_IS_RUNNING", LUA_NATIVE_GRAPHICS_ANIMPOSTFX_IS_RUNNING);
-		GRAPHICS.set_function("ANIMPOSTFX_STOP_ALL", LUA_NATIVE_GRAPHICS_ANIMPOSTFX_STOP_ALL);
-		GRAPHICS.set_function("ANIMPOSTFX_STOP_AND_FLUSH_REQUESTS", LUA_NATIVE_GRAPHICS_ANIMPOSTFX_STOP_AND_FLUSH_REQUESTS);
+		bind_namespace(L, "GRAPHICS", GRAPHICS_natives);
 	}
 }
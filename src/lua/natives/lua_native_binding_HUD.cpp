@@ -2780,522 +2780,525 @@ namespace lua::native
 		HUD::HIDE_HUDMARKERS_THIS_FRAME();
 	}
 
+	static constexpr native_entry HUD_natives[] = {
+		{"ACTIVATE_FRONTEND_MENU", native_function<LUA_NATIVE_HUD_ACTIVATE_FRONTEND_MENU>},
+		{"ADD_BLIP_FOR_AREA", native_function<LUA_NATIVE_HUD_ADD_BLIP_FOR_AREA>},
+		{"ADD_BLIP_FOR_COORD", native_function<LUA_NATIVE_HUD_ADD_BLIP_FOR_COORD>},
+		{"ADD_BLIP_FOR_ENTITY", native_function<LUA_NATIVE_HUD_ADD_BLIP_FOR_ENTITY>},
+		{"ADD_BLIP_FOR_PICKUP", native_function<LUA_NATIVE_HUD_ADD_BLIP_FOR_PICKUP>},
+		{"ADD_BLIP_FOR_RADIUS", native_function<LUA_NATIVE_HUD_ADD_BLIP_FOR_RADIUS>},
+		{"ADD_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS", native_function<LUA_NATIVE_HUD_ADD_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS>},
+		{"ADD_POINT_TO_GPS_CUSTOM_ROUTE", native_function<LUA_NATIVE_HUD_ADD_POINT_TO_GPS_CUSTOM_ROUTE>},
+		{"ADD_POINT_TO_GPS_MULTI_ROUTE", native_function<LUA_NATIVE_HUD_ADD_POINT_TO_GPS_MULTI_ROUTE>},
+		{"ADD_TEXT_COMPONENT_FLOAT", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_FLOAT>},
+		{"ADD_TEXT_COMPONENT_FORMATTED_INTEGER", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_FORMATTED_INTEGER>},
+		{"ADD_TEXT_COMPONENT_INTEGER", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_INTEGER>},
+		{"ADD_TEXT_COMPONENT_SUBSTRING_BLIP_NAME", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_BLIP_NAME>},
+		{"ADD_TEXT_COMPONENT_SUBSTRING_KEYBOARD_DISPLAY", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_KEYBOARD_DISPLAY>},
+		{"ADD_TEXT_COMPONENT_SUBSTRING_PHONE_NUMBER", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_PHONE_NUMBER>},
+		{"ADD_TEXT_COMPONENT_SUBSTRING_PLAYER_NAME", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_PLAYER_NAME>},
+		{"ADD_TEXT_COMPONENT_SUBSTRING_TEXT_LABEL", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_TEXT_LABEL>},
+		{"ADD_TEXT_COMPONENT_SUBSTRING_TEXT_LABEL_HASH_KEY", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_TEXT_LABEL_HASH_KEY>},
+		{"ADD_TEXT_COMPONENT_SUBSTRING_TIME", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_TIME>},
+		{"ADD_TEXT_COMPONENT_SUBSTRING_WEBSITE", native_function<LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_WEBSITE>},
+		{"ADD_VALID_VEHICLE_HIT_HASH", native_function<LUA_NATIVE_HUD_ADD_VALID_VEHICLE_HIT_HASH>},
+		{"ALLOW_DISPLAY_OF_MULTIPLAYER_CASH_TEXT", native_function<LUA_NATIVE_HUD_ALLOW_DISPLAY_OF_MULTIPLAYER_CASH_TEXT>},
+		{"ALLOW_PAUSE_WHEN_NOT_IN_STATE_OF_PLAY_THIS_FRAME", native_function<LUA_NATIVE_HUD_ALLOW_PAUSE_WHEN_NOT_IN_STATE_OF_PLAY_THIS_FRAME>},
+		{"ALLOW_SONAR_BLIPS", native_function<LUA_NATIVE_HUD_ALLOW_SONAR_BLIPS>},
+		{"ARE_ONLINE_POLICIES_UP_TO_DATE", native_function<LUA_NATIVE_HUD_ARE_ONLINE_POLICIES_UP_TO_DATE>},
+		{"BEGIN_TEXT_COMMAND_ADD_DIRECTLY_TO_PREVIOUS_BRIEFS", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_ADD_DIRECTLY_TO_PREVIOUS_BRIEFS>},
+		{"BEGIN_TEXT_COMMAND_BUSYSPINNER_ON", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_BUSYSPINNER_ON>},
+		{"BEGIN_TEXT_COMMAND_CLEAR_PRINT", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_CLEAR_PRINT>},
+		{"BEGIN_TEXT_COMMAND_DISPLAY_HELP", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_DISPLAY_HELP>},
+		{"BEGIN_TEXT_COMMAND_DISPLAY_TEXT", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_DISPLAY_TEXT>},
+		{"BEGIN_TEXT_COMMAND_GET_NUMBER_OF_LINES_FOR_STRING", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_GET_NUMBER_OF_LINES_FOR_STRING>},
+		{"BEGIN_TEXT_COMMAND_GET_SCREEN_WIDTH_OF_DISPLAY_TEXT", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_GET_SCREEN_WIDTH_OF_DISPLAY_TEXT>},
+		{"BEGIN_TEXT_COMMAND_IS_MESSAGE_DISPLAYED", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_IS_MESSAGE_DISPLAYED>},
+		{"BEGIN_TEXT_COMMAND_IS_THIS_HELP_MESSAGE_BEING_DISPLAYED", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_IS_THIS_HELP_MESSAGE_BEING_DISPLAYED>},
+		{"BEGIN_TEXT_COMMAND_OVERRIDE_BUTTON_TEXT", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_OVERRIDE_BUTTON_TEXT>},
+		{"BEGIN_TEXT_COMMAND_PRINT", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_PRINT>},
+		{"BEGIN_TEXT_COMMAND_SET_BLIP_NAME", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_SET_BLIP_NAME>},
+		{"BEGIN_TEXT_COMMAND_THEFEED_POST", native_function<LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_THEFEED_POST>},
+		{"BUSYSPINNER_IS_DISPLAYING", native_function<LUA_NATIVE_HUD_BUSYSPINNER_IS_DISPLAYING>},
+		{"BUSYSPINNER_IS_ON", native_function<LUA_NATIVE_HUD_BUSYSPINNER_IS_ON>},
+		{"BUSYSPINNER_OFF", native_function<LUA_NATIVE_HUD_BUSYSPINNER_OFF>},
+		{"CHANGE_FAKE_MP_CASH", native_function<LUA_NATIVE_HUD_CHANGE_FAKE_MP_CASH>},
+		{"CLEAR_ADDITIONAL_TEXT", native_function<LUA_NATIVE_HUD_CLEAR_ADDITIONAL_TEXT>},
+		{"CLEAR_ALL_BLIP_ROUTES", native_function<LUA_NATIVE_HUD_CLEAR_ALL_BLIP_ROUTES>},
+		{"CLEAR_ALL_HELP_MESSAGES", native_function<LUA_NATIVE_HUD_CLEAR_ALL_HELP_MESSAGES>},
+		{"CLEAR_BRIEF", native_function<LUA_NATIVE_HUD_CLEAR_BRIEF>},
+		{"CLEAR_DYNAMIC_PAUSE_MENU_ERROR_MESSAGE", native_function<LUA_NATIVE_HUD_CLEAR_DYNAMIC_PAUSE_MENU_ERROR_MESSAGE>},
+		{"CLEAR_FAKE_CONE_ARRAY", native_function<LUA_NATIVE_HUD_CLEAR_FAKE_CONE_ARRAY>},
+		{"CLEAR_FLOATING_HELP", native_function<LUA_NATIVE_HUD_CLEAR_FLOATING_HELP>},
+		{"CLEAR_GPS_CUSTOM_ROUTE", native_function<LUA_NATIVE_HUD_CLEAR_GPS_CUSTOM_ROUTE>},
+		{"CLEAR_GPS_FLAGS", native_function<LUA_NATIVE_HUD_CLEAR_GPS_FLAGS>},
+		{"CLEAR_GPS_MULTI_ROUTE", native_function<LUA_NATIVE_HUD_CLEAR_GPS_MULTI_ROUTE>},
+		{"CLEAR_GPS_PLAYER_WAYPOINT", native_function<LUA_NATIVE_HUD_CLEAR_GPS_PLAYER_WAYPOINT>},
+		{"CLEAR_GPS_RACE_TRACK", native_function<LUA_NATIVE_HUD_CLEAR_GPS_RACE_TRACK>},
+		{"CLEAR_HELP", native_function<LUA_NATIVE_HUD_CLEAR_HELP>},
+		{"CLEAR_PED_IN_PAUSE_MENU", native_function<LUA_NATIVE_HUD_CLEAR_PED_IN_PAUSE_MENU>},
+		{"CLEAR_PRINTS", native_function<LUA_NATIVE_HUD_CLEAR_PRINTS>},
+		{"CLEAR_REMINDER_MESSAGE", native_function<LUA_NATIVE_HUD_CLEAR_REMINDER_MESSAGE>},
+		{"CLEAR_SMALL_PRINTS", native_function<LUA_NATIVE_HUD_CLEAR_SMALL_PRINTS>},
+		{"CLEAR_THIS_PRINT", native_function<LUA_NATIVE_HUD_CLEAR_THIS_PRINT>},
+		{"CLEAR_VALID_VEHICLE_HIT_HASHES", native_function<LUA_NATIVE_HUD_CLEAR_VALID_VEHICLE_HIT_HASHES>},
+		{"CLOSE_MP_TEXT_CHAT", native_function<LUA_NATIVE_HUD_CLOSE_MP_TEXT_CHAT>},
+		{"CLOSE_SOCIAL_CLUB_MENU", native_function<LUA_NATIVE_HUD_CLOSE_SOCIAL_CLUB_MENU>},
+		{"CODE_WANTS_SCRIPT_TO_TAKE_CONTROL", native_function<LUA_NATIVE_HUD_CODE_WANTS_SCRIPT_TO_TAKE_CONTROL>},
+		{"CREATE_FAKE_MP_GAMER_TAG", native_function<LUA_NATIVE_HUD_CREATE_FAKE_MP_GAMER_TAG>},
+		{"CREATE_MP_GAMER_TAG_WITH_CREW_COLOR", native_function<LUA_NATIVE_HUD_CREATE_MP_GAMER_TAG_WITH_CREW_COLOR>},
+		{"CUSTOM_MINIMAP_CLEAR_BLIPS", native_function<LUA_NATIVE_HUD_CUSTOM_MINIMAP_CLEAR_BLIPS>},
+		{"CUSTOM_MINIMAP_CREATE_BLIP", native_function<LUA_NATIVE_HUD_CUSTOM_MINIMAP_CREATE_BLIP>},
+		{"CUSTOM_MINIMAP_SET_ACTIVE", native_function<LUA_NATIVE_HUD_CUSTOM_MINIMAP_SET_ACTIVE>},
+		{"CUSTOM_MINIMAP_SET_BLIP_OBJECT", native_function<LUA_NATIVE_HUD_CUSTOM_MINIMAP_SET_BLIP_OBJECT>},
+		{"DELETE_WAYPOINTS_FROM_THIS_PLAYER", native_function<LUA_NATIVE_HUD_DELETE_WAYPOINTS_FROM_THIS_PLAYER>},
+		{"DISABLE_FRONTEND_THIS_FRAME", native_function<LUA_NATIVE_HUD_DISABLE_FRONTEND_THIS_FRAME>},
+		{"DISABLE_PAUSEMENU_SPINNER", native_function<LUA_NATIVE_HUD_DISABLE_PAUSEMENU_SPINNER>},
+		{"DISPLAY_AMMO_THIS_FRAME", native_function<LUA_NATIVE_HUD_DISPLAY_AMMO_THIS_FRAME>},
+		{"DISPLAY_AREA_NAME", native_function<LUA_NATIVE_HUD_DISPLAY_AREA_NAME>},
+		{"DISPLAY_CASH", native_function<LUA_NATIVE_HUD_DISPLAY_CASH>},
+		{"DISPLAY_HELP_TEXT_THIS_FRAME", native_function<LUA_NATIVE_HUD_DISPLAY_HELP_TEXT_THIS_FRAME>},
+		{"DISPLAY_HUD", native_function<LUA_NATIVE_HUD_DISPLAY_HUD>},
+		{"DISPLAY_HUD_WHEN_NOT_IN_STATE_OF_PLAY_THIS_FRAME", native_function<LUA_NATIVE_HUD_DISPLAY_HUD_WHEN_NOT_IN_STATE_OF_PLAY_THIS_FRAME>},
+		{"DISPLAY_HUD_WHEN_PAUSED_THIS_FRAME", native_function<LUA_NATIVE_HUD_DISPLAY_HUD_WHEN_PAUSED_THIS_FRAME>},
+		{"DISPLAY_PLAYER_NAME_TAGS_ON_BLIPS", native_function<LUA_NATIVE_HUD_DISPLAY_PLAYER_NAME_TAGS_ON_BLIPS>},
+		{"DISPLAY_RADAR", native_function<LUA_NATIVE_HUD_DISPLAY_RADAR>},
+		{"DISPLAY_SNIPER_SCOPE_THIS_FRAME", native_function<LUA_NATIVE_HUD_DISPLAY_SNIPER_SCOPE_THIS_FRAME>},
+		{"DOES_BLIP_EXIST", native_function<LUA_NATIVE_HUD_DOES_BLIP_EXIST>},
+		{"DOES_BLIP_HAVE_GPS_ROUTE", native_function<LUA_NATIVE_HUD_DOES_BLIP_HAVE_GPS_ROUTE>},
+		{"DOES_PED_HAVE_AI_BLIP", native_function<LUA_NATIVE_HUD_DOES_PED_HAVE_AI_BLIP>},
+		{"DOES_TEXT_BLOCK_EXIST", native_function<LUA_NATIVE_HUD_DOES_TEXT_BLOCK_EXIST>},
+		{"DOES_TEXT_LABEL_EXIST", native_function<LUA_NATIVE_HUD_DOES_TEXT_LABEL_EXIST>},
+		{"DONT_TILT_MINIMAP_THIS_FRAME", native_function<LUA_NATIVE_HUD_DONT_TILT_MINIMAP_THIS_FRAME>},
+		{"DONT_ZOOM_MINIMAP_WHEN_RUNNING_THIS_FRAME", native_function<LUA_NATIVE_HUD_DONT_ZOOM_MINIMAP_WHEN_RUNNING_THIS_FRAME>},
+		{"DONT_ZOOM_MINIMAP_WHEN_SNIPING_THIS_FRAME", native_function<LUA_NATIVE_HUD_DONT_ZOOM_MINIMAP_WHEN_SNIPING_THIS_FRAME>},
+		{"DRAW_FRONTEND_BACKGROUND_THIS_FRAME", native_function<LUA_NATIVE_HUD_DRAW_FRONTEND_BACKGROUND_THIS_FRAME>},
+		{"DRAW_HUD_OVER_FADE_THIS_FRAME", native_function<LUA_NATIVE_HUD_DRAW_HUD_OVER_FADE_THIS_FRAME>},
+		{"END_TEXT_COMMAND_ADD_DIRECTLY_TO_PREVIOUS_BRIEFS", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_ADD_DIRECTLY_TO_PREVIOUS_BRIEFS>},
+		{"END_TEXT_COMMAND_BUSYSPINNER_ON", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_BUSYSPINNER_ON>},
+		{"END_TEXT_COMMAND_CLEAR_PRINT", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_CLEAR_PRINT>},
+		{"END_TEXT_COMMAND_DISPLAY_HELP", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_DISPLAY_HELP>},
+		{"END_TEXT_COMMAND_DISPLAY_TEXT", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_DISPLAY_TEXT>},
+		{"END_TEXT_COMMAND_GET_NUMBER_OF_LINES_FOR_STRING", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_GET_NUMBER_OF_LINES_FOR_STRING>},
+		{"END_TEXT_COMMAND_GET_SCREEN_WIDTH_OF_DISPLAY_TEXT", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_GET_SCREEN_WIDTH_OF_DISPLAY_TEXT>},
+		{"END_TEXT_COMMAND_IS_MESSAGE_DISPLAYED", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_IS_MESSAGE_DISPLAYED>},
+		{"END_TEXT_COMMAND_IS_THIS_HELP_MESSAGE_BEING_DISPLAYED", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_IS_THIS_HELP_MESSAGE_BEING_DISPLAYED>},
+		{"END_TEXT_COMMAND_OVERRIDE_BUTTON_TEXT", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_OVERRIDE_BUTTON_TEXT>},
+		{"END_TEXT_COMMAND_PRINT", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_PRINT>},
+		{"END_TEXT_COMMAND_SET_BLIP_NAME", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_SET_BLIP_NAME>},
+		{"END_TEXT_COMMAND_THEFEED_POST_AWARD", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_AWARD>},
+		{"END_TEXT_COMMAND_THEFEED_POST_CREWTAG", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_CREWTAG>},
+		{"END_TEXT_COMMAND_THEFEED_POST_CREWTAG_WITH_GAME_NAME", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_CREWTAG_WITH_GAME_NAME>},
+		{"END_TEXT_COMMAND_THEFEED_POST_CREW_RANKUP_WITH_LITERAL_FLAG", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_CREW_RANKUP_WITH_LITERAL_FLAG>},
+		{"END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT>},
+		{"END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_SUBTITLE_LABEL", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_SUBTITLE_LABEL>},
+		{"END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_TU", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_TU>},
+		{"END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_WITH_CREW_TAG", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_WITH_CREW_TAG>},
+		{"END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_WITH_CREW_TAG_AND_ADDITIONAL_ICON", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_WITH_CREW_TAG_AND_ADDITIONAL_ICON>},
+		{"END_TEXT_COMMAND_THEFEED_POST_MPTICKER", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MPTICKER>},
+		{"END_TEXT_COMMAND_THEFEED_POST_REPLAY", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_REPLAY>},
+		{"END_TEXT_COMMAND_THEFEED_POST_REPLAY_INPUT", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_REPLAY_INPUT>},
+		{"END_TEXT_COMMAND_THEFEED_POST_STATS", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_STATS>},
+		{"END_TEXT_COMMAND_THEFEED_POST_TICKER", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_TICKER>},
+		{"END_TEXT_COMMAND_THEFEED_POST_TICKER_FORCED", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_TICKER_FORCED>},
+		{"END_TEXT_COMMAND_THEFEED_POST_TICKER_WITH_TOKENS", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_TICKER_WITH_TOKENS>},
+		{"END_TEXT_COMMAND_THEFEED_POST_UNLOCK", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_UNLOCK>},
+		{"END_TEXT_COMMAND_THEFEED_POST_UNLOCK_TU", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_UNLOCK_TU>},
+		{"END_TEXT_COMMAND_THEFEED_POST_UNLOCK_TU_WITH_COLOR", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_UNLOCK_TU_WITH_COLOR>},
+		{"END_TEXT_COMMAND_THEFEED_POST_VERSUS_TU", native_function<LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_VERSUS_TU>},
+		{"FLAG_PLAYER_CONTEXT_IN_TOURNAMENT", native_function<LUA_NATIVE_HUD_FLAG_PLAYER_CONTEXT_IN_TOURNAMENT>},
+		{"FLASH_ABILITY_BAR", native_function<LUA_NATIVE_HUD_FLASH_ABILITY_BAR>},
+		{"FLASH_MINIMAP_DISPLAY", native_function<LUA_NATIVE_HUD_FLASH_MINIMAP_DISPLAY>},
+		{"FLASH_MINIMAP_DISPLAY_WITH_COLOR", native_function<LUA_NATIVE_HUD_FLASH_MINIMAP_DISPLAY_WITH_COLOR>},
+		{"FLASH_WANTED_DISPLAY", native_function<LUA_NATIVE_HUD_FLASH_WANTED_DISPLAY>},
+		{"FORCE_CLOSE_REPORTUGC_MENU", native_function<LUA_NATIVE_HUD_FORCE_CLOSE_REPORTUGC_MENU>},
+		{"FORCE_CLOSE_TEXT_INPUT_BOX", native_function<LUA_NATIVE_HUD_FORCE_CLOSE_TEXT_INPUT_BOX>},
+		{"FORCE_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS_LIST", native_function<LUA_NATIVE_HUD_FORCE_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS_LIST>},
+		{"FORCE_OFF_WANTED_STAR_FLASH", native_function<LUA_NATIVE_HUD_FORCE_OFF_WANTED_STAR_FLASH>},
+		{"FORCE_SCRIPTED_GFX_WHEN_FRONTEND_ACTIVE", native_function<LUA_NATIVE_HUD_FORCE_SCRIPTED_GFX_WHEN_FRONTEND_ACTIVE>},
+		{"FORCE_SONAR_BLIPS_THIS_FRAME", native_function<LUA_NATIVE_HUD_FORCE_SONAR_BLIPS_THIS_FRAME>},
+		{"GET_AI_PED_PED_BLIP_INDEX", native_function<LUA_NATIVE_HUD_GET_AI_PED_PED_BLIP_INDEX>},
+		{"GET_AI_PED_VEHICLE_BLIP_INDEX", native_function<LUA_NATIVE_HUD_GET_AI_PED_VEHICLE_BLIP_INDEX>},
+		{"GET_BLIP_ALPHA", native_function<LUA_NATIVE_HUD_GET_BLIP_ALPHA>},
+		{"GET_BLIP_COLOUR", native_function<LUA_NATIVE_HUD_GET_BLIP_COLOUR>},
+		{"GET_BLIP_COORDS", native_function<LUA_NATIVE_HUD_GET_BLIP_COORDS>},
+		{"GET_BLIP_FADE_DIRECTION", native_function<LUA_NATIVE_HUD_GET_BLIP_FADE_DIRECTION>},
+		{"GET_BLIP_FROM_ENTITY", native_function<LUA_NATIVE_HUD_GET_BLIP_FROM_ENTITY>},
+		{"GET_BLIP_HUD_COLOUR", native_function<LUA_NATIVE_HUD_GET_BLIP_HUD_COLOUR>},
+		{"GET_BLIP_INFO_ID_COORD", native_function<LUA_NATIVE_HUD_GET_BLIP_INFO_ID_COORD>},
+		{"GET_BLIP_INFO_ID_DISPLAY", native_function<LUA_NATIVE_HUD_GET_BLIP_INFO_ID_DISPLAY>},
+		{"GET_BLIP_INFO_ID_ENTITY_INDEX", native_function<LUA_NATIVE_HUD_GET_BLIP_INFO_ID_ENTITY_INDEX>},
+		{"GET_BLIP_INFO_ID_PICKUP_INDEX", native_function<LUA_NATIVE_HUD_GET_BLIP_INFO_ID_PICKUP_INDEX>},
+		{"GET_BLIP_INFO_ID_TYPE", native_function<LUA_NATIVE_HUD_GET_BLIP_INFO_ID_TYPE>},
+		{"GET_BLIP_ROTATION", native_function<LUA_NATIVE_HUD_GET_BLIP_ROTATION>},
+		{"GET_BLIP_SPRITE", native_function<LUA_NATIVE_HUD_GET_BLIP_SPRITE>},
+		{"GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME", native_function<LUA_NATIVE_HUD_GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME>},
+		{"GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME_BYTES", native_function<LUA_NATIVE_HUD_GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME_BYTES>},
+		{"GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME_WITH_BYTE_LIMIT", native_function<LUA_NATIVE_HUD_GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME_WITH_BYTE_LIMIT>},
+		{"GET_CHARACTER_MENU_PED_FLOAT_STAT", native_function<LUA_NATIVE_HUD_GET_CHARACTER_MENU_PED_FLOAT_STAT>},
+		{"GET_CHARACTER_MENU_PED_INT_STAT", native_function<LUA_NATIVE_HUD_GET_CHARACTER_MENU_PED_INT_STAT>},
+		{"GET_CHARACTER_MENU_PED_MASKED_INT_STAT", native_function<LUA_NATIVE_HUD_GET_CHARACTER_MENU_PED_MASKED_INT_STAT>},
+		{"GET_CLOSEST_BLIP_INFO_ID", native_function<LUA_NATIVE_HUD_GET_CLOSEST_BLIP_INFO_ID>},
+		{"GET_CURRENT_FRONTEND_MENU_VERSION", native_function<LUA_NATIVE_HUD_GET_CURRENT_FRONTEND_MENU_VERSION>},
+		{"GET_CURRENT_WEBPAGE_ID", native_function<LUA_NATIVE_HUD_GET_CURRENT_WEBPAGE_ID>},
+		{"GET_CURRENT_WEBSITE_ID", native_function<LUA_NATIVE_HUD_GET_CURRENT_WEBSITE_ID>},
+		{"GET_DEFAULT_SCRIPT_RENDERTARGET_RENDER_ID", native_function<LUA_NATIVE_HUD_GET_DEFAULT_SCRIPT_RENDERTARGET_RENDER_ID>},
+		{"GET_FAKE_SPECTATOR_MODE", native_function<LUA_NATIVE_HUD_GET_FAKE_SPECTATOR_MODE>},
+		{"GET_FILENAME_FOR_AUDIO_CONVERSATION", native_function<LUA_NATIVE_HUD_GET_FILENAME_FOR_AUDIO_CONVERSATION>},
+		{"GET_FIRST_BLIP_INFO_ID", native_function<LUA_NATIVE_HUD_GET_FIRST_BLIP_INFO_ID>},
+		{"GET_FIRST_N_CHARACTERS_OF_LITERAL_STRING", native_function<LUA_NATIVE_HUD_GET_FIRST_N_CHARACTERS_OF_LITERAL_STRING>},
+		{"GET_GLOBAL_ACTIONSCRIPT_FLAG", native_function<LUA_NATIVE_HUD_GET_GLOBAL_ACTIONSCRIPT_FLAG>},
+		{"GET_HUD_COLOUR", native_function<LUA_NATIVE_HUD_GET_HUD_COLOUR>},
+		{"GET_HUD_COMPONENT_POSITION", native_function<LUA_NATIVE_HUD_GET_HUD_COMPONENT_POSITION>},
+		{"GET_HUD_SCREEN_POSITION_FROM_WORLD_POSITION", native_function<LUA_NATIVE_HUD_GET_HUD_SCREEN_POSITION_FROM_WORLD_POSITION>},
+		{"GET_LENGTH_OF_LITERAL_STRING", native_function<LUA_NATIVE_HUD_GET_LENGTH_OF_LITERAL_STRING>},
+		{"GET_LENGTH_OF_LITERAL_STRING_IN_BYTES", native_function<LUA_NATIVE_HUD_GET_LENGTH_OF_LITERAL_STRING_IN_BYTES>},
+		{"GET_LENGTH_OF_STRING_WITH_THIS_TEXT_LABEL", native_function<LUA_NATIVE_HUD_GET_LENGTH_OF_STRING_WITH_THIS_TEXT_LABEL>},
+		{"GET_MAIN_PLAYER_BLIP_ID", native_function<LUA_NATIVE_HUD_GET_MAIN_PLAYER_BLIP_ID>},
+		{"GET_MENU_LAYOUT_CHANGED_EVENT_DETAILS", native_function<LUA_NATIVE_HUD_GET_MENU_LAYOUT_CHANGED_EVENT_DETAILS>},
+		{"GET_MENU_PED_BOOL_STAT", native_function<LUA_NATIVE_HUD_GET_MENU_PED_BOOL_STAT>},
+		{"GET_MENU_PED_FLOAT_STAT", native_function<LUA_NATIVE_HUD_GET_MENU_PED_FLOAT_STAT>},
+		{"GET_MENU_PED_INT_STAT", native_function<LUA_NATIVE_HUD_GET_MENU_PED_INT_STAT>},
+		{"GET_MENU_PED_MASKED_INT_STAT", native_function<LUA_NATIVE_HUD_GET_MENU_PED_MASKED_INT_STAT>},
+		{"GET_MENU_TRIGGER_EVENT_DETAILS", native_function<LUA_NATIVE_HUD_GET_MENU_TRIGGER_EVENT_DETAILS>},
+		{"GET_MINIMAP_FOW_COORDINATE_IS_REVEALED", native_function<LUA_NATIVE_HUD_GET_MINIMAP_FOW_COORDINATE_IS_REVEALED>},
+		{"GET_MINIMAP_FOW_DISCOVERY_RATIO", native_function<LUA_NATIVE_HUD_GET_MINIMAP_FOW_DISCOVERY_RATIO>},
+		{"GET_MOUSE_EVENT", native_function<LUA_NATIVE_HUD_GET_MOUSE_EVENT>},
+		{"GET_NAMED_RENDERTARGET_RENDER_ID", native_function<LUA_NATIVE_HUD_GET_NAMED_RENDERTARGET_RENDER_ID>},
+		{"GET_NEW_SELECTED_MISSION_CREATOR_BLIP", native_function<LUA_NATIVE_HUD_GET_NEW_SELECTED_MISSION_CREATOR_BLIP>},
+		{"GET_NEXT_BLIP_INFO_ID", native_function<LUA_NATIVE_HUD_GET_NEXT_BLIP_INFO_ID>},
+		{"GET_NORTH_BLID_INDEX", native_function<LUA_NATIVE_HUD_GET_NORTH_BLID_INDEX>},
+		{"GET_NUMBER_OF_ACTIVE_BLIPS", native_function<LUA_NATIVE_HUD_GET_NUMBER_OF_ACTIVE_BLIPS>},
+		{"GET_PAUSE_MENU_POSITION", native_function<LUA_NATIVE_HUD_GET_PAUSE_MENU_POSITION>},
+		{"GET_PAUSE_MENU_STATE", native_function<LUA_NATIVE_HUD_GET_PAUSE_MENU_STATE>},
+		{"GET_PM_PLAYER_CREW_COLOR", native_function<LUA_NATIVE_HUD_GET_PM_PLAYER_CREW_COLOR>},
+		{"GET_RENDERED_CHARACTER_HEIGHT", native_function<LUA_NATIVE_HUD_GET_RENDERED_CHARACTER_HEIGHT>},
+		{"GET_SCREEN_CODE_WANTS_SCRIPT_TO_CONTROL", native_function<LUA_NATIVE_HUD_GET_SCREEN_CODE_WANTS_SCRIPT_TO_CONTROL>},
+		{"GET_STANDARD_BLIP_ENUM_ID", native_function<LUA_NATIVE_HUD_GET_STANDARD_BLIP_ENUM_ID>},
+		{"GET_STREET_NAME_FROM_HASH_KEY", native_function<LUA_NATIVE_HUD_GET_STREET_NAME_FROM_HASH_KEY>},
+		{"GET_WARNING_SCREEN_MESSAGE_HASH", native_function<LUA_NATIVE_HUD_GET_WARNING_SCREEN_MESSAGE_HASH>},
+		{"GET_WAYPOINT_BLIP_ENUM_ID", native_function<LUA_NATIVE_HUD_GET_WAYPOINT_BLIP_ENUM_ID>},
+		{"GIVE_PED_TO_PAUSE_MENU", native_function<LUA_NATIVE_HUD_GIVE_PED_TO_PAUSE_MENU>},
+		{"HAS_ADDITIONAL_TEXT_LOADED", native_function<LUA_NATIVE_HUD_HAS_ADDITIONAL_TEXT_LOADED>},
+		{"HAS_DIRECTOR_MODE_BEEN_LAUNCHED_BY_CODE", native_function<LUA_NATIVE_HUD_HAS_DIRECTOR_MODE_BEEN_LAUNCHED_BY_CODE>},
+		{"HAS_MENU_LAYOUT_CHANGED_EVENT_OCCURRED", native_function<LUA_NATIVE_HUD_HAS_MENU_LAYOUT_CHANGED_EVENT_OCCURRED>},
+		{"HAS_MENU_TRIGGER_EVENT_OCCURRED", native_function<LUA_NATIVE_HUD_HAS_MENU_TRIGGER_EVENT_OCCURRED>},
+		{"HAS_SCRIPT_HIDDEN_HELP_THIS_FRAME", native_function<LUA_NATIVE_HUD_HAS_SCRIPT_HIDDEN_HELP_THIS_FRAME>},
+		{"HAS_THIS_ADDITIONAL_TEXT_LOADED", native_function<LUA_NATIVE_HUD_HAS_THIS_ADDITIONAL_TEXT_LOADED>},
+		{"HIDE_HELP_TEXT_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_HELP_TEXT_THIS_FRAME>},
+		{"HIDE_HUDMARKERS_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_HUDMARKERS_THIS_FRAME>},
+		{"HIDE_HUD_AND_RADAR_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_HUD_AND_RADAR_THIS_FRAME>},
+		{"HIDE_HUD_COMPONENT_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_HUD_COMPONENT_THIS_FRAME>},
+		{"HIDE_LOADING_ON_FADE_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_LOADING_ON_FADE_THIS_FRAME>},
+		{"HIDE_MINIMAP_EXTERIOR_MAP_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_MINIMAP_EXTERIOR_MAP_THIS_FRAME>},
+		{"HIDE_MINIMAP_INTERIOR_MAP_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_MINIMAP_INTERIOR_MAP_THIS_FRAME>},
+		{"HIDE_NUMBER_ON_BLIP", native_function<LUA_NATIVE_HUD_HIDE_NUMBER_ON_BLIP>},
+		{"HIDE_SCRIPTED_HUD_COMPONENT_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_SCRIPTED_HUD_COMPONENT_THIS_FRAME>},
+		{"HIDE_STREET_AND_CAR_NAMES_THIS_FRAME", native_function<LUA_NATIVE_HUD_HIDE_STREET_AND_CAR_NAMES_THIS_FRAME>},
+		{"HUD_FORCE_SPECIAL_VEHICLE_WEAPON_WHEEL", native_function<LUA_NATIVE_HUD_HUD_FORCE_SPECIAL_VEHICLE_WEAPON_WHEEL>},
+		{"HUD_FORCE_WEAPON_WHEEL", native_function<LUA_NATIVE_HUD_HUD_FORCE_WEAPON_WHEEL>},
+		{"HUD_GET_WEAPON_WHEEL_CURRENTLY_HIGHLIGHTED", native_function<LUA_NATIVE_HUD_HUD_GET_WEAPON_WHEEL_CURRENTLY_HIGHLIGHTED>},
+		{"HUD_GET_WEAPON_WHEEL_TOP_SLOT", native_function<LUA_NATIVE_HUD_HUD_GET_WEAPON_WHEEL_TOP_SLOT>},
+		{"HUD_SET_WEAPON_WHEEL_TOP_SLOT", native_function<LUA_NATIVE_HUD_HUD_SET_WEAPON_WHEEL_TOP_SLOT>},
+		{"HUD_SHOWING_CHARACTER_SWITCH_SELECTION", native_function<LUA_NATIVE_HUD_HUD_SHOWING_CHARACTER_SWITCH_SELECTION>},
+		{"HUD_SUPPRESS_WEAPON_WHEEL_RESULTS_THIS_FRAME", native_function<LUA_NATIVE_HUD_HUD_SUPPRESS_WEAPON_WHEEL_RESULTS_THIS_FRAME>},
+		{"IS_BLIP_FLASHING", native_function<LUA_NATIVE_HUD_IS_BLIP_FLASHING>},
+		{"IS_BLIP_ON_MINIMAP", native_function<LUA_NATIVE_HUD_IS_BLIP_ON_MINIMAP>},
+		{"IS_BLIP_SHORT_RANGE", native_function<LUA_NATIVE_HUD_IS_BLIP_SHORT_RANGE>},
+		{"IS_FLOATING_HELP_TEXT_ON_SCREEN", native_function<LUA_NATIVE_HUD_IS_FLOATING_HELP_TEXT_ON_SCREEN>},
+		{"IS_FRONTEND_READY_FOR_CONTROL", native_function<LUA_NATIVE_HUD_IS_FRONTEND_READY_FOR_CONTROL>},
+		{"IS_HELP_MESSAGE_BEING_DISPLAYED", native_function<LUA_NATIVE_HUD_IS_HELP_MESSAGE_BEING_DISPLAYED>},
+		{"IS_HELP_MESSAGE_FADING_OUT", native_function<LUA_NATIVE_HUD_IS_HELP_MESSAGE_FADING_OUT>},
+		{"IS_HELP_MESSAGE_ON_SCREEN", native_function<LUA_NATIVE_HUD_IS_HELP_MESSAGE_ON_SCREEN>},
+		{"IS_HOVERING_OVER_MISSION_CREATOR_BLIP", native_function<LUA_NATIVE_HUD_IS_HOVERING_OVER_MISSION_CREATOR_BLIP>},
+		{"IS_HUD_COMPONENT_ACTIVE", native_function<LUA_NATIVE_HUD_IS_HUD_COMPONENT_ACTIVE>},
+		{"IS_HUD_HIDDEN", native_function<LUA_NATIVE_HUD_IS_HUD_HIDDEN>},
+		{"IS_HUD_PREFERENCE_SWITCHED_ON", native_function<LUA_NATIVE_HUD_IS_HUD_PREFERENCE_SWITCHED_ON>},
+		{"IS_IME_IN_PROGRESS", native_function<LUA_NATIVE_HUD_IS_IME_IN_PROGRESS>},
+		{"IS_MESSAGE_BEING_DISPLAYED", native_function<LUA_NATIVE_HUD_IS_MESSAGE_BEING_DISPLAYED>},
+		{"IS_MINIMAP_RENDERING", native_function<LUA_NATIVE_HUD_IS_MINIMAP_RENDERING>},
+		{"IS_MISSION_CREATOR_BLIP", native_function<LUA_NATIVE_HUD_IS_MISSION_CREATOR_BLIP>},
+		{"IS_MOUSE_ROLLED_OVER_INSTRUCTIONAL_BUTTONS", native_function<LUA_NATIVE_HUD_IS_MOUSE_ROLLED_OVER_INSTRUCTIONAL_BUTTONS>},
+		{"IS_MP_GAMER_TAG_ACTIVE", native_function<LUA_NATIVE_HUD_IS_MP_GAMER_TAG_ACTIVE>},
+		{"IS_MP_GAMER_TAG_FREE", native_function<LUA_NATIVE_HUD_IS_MP_GAMER_TAG_FREE>},
+		{"IS_MP_GAMER_TAG_MOVIE_ACTIVE", native_function<LUA_NATIVE_HUD_IS_MP_GAMER_TAG_MOVIE_ACTIVE>},
+		{"IS_MP_TEXT_CHAT_TYPING", native_function<LUA_NATIVE_HUD_IS_MP_TEXT_CHAT_TYPING>},
+		{"IS_NAMED_RENDERTARGET_LINKED", native_function<LUA_NATIVE_HUD_IS_NAMED_RENDERTARGET_LINKED>},
+		{"IS_NAMED_RENDERTARGET_REGISTERED", native_function<LUA_NATIVE_HUD_IS_NAMED_RENDERTARGET_REGISTERED>},
+		{"IS_NAVIGATING_MENU_CONTENT", native_function<LUA_NATIVE_HUD_IS_NAVIGATING_MENU_CONTENT>},
+		{"IS_ONLINE_POLICIES_MENU_ACTIVE", native_function<LUA_NATIVE_HUD_IS_ONLINE_POLICIES_MENU_ACTIVE>},
+		{"IS_PAUSEMAP_IN_INTERIOR_MODE", native_function<LUA_NATIVE_HUD_IS_PAUSEMAP_IN_INTERIOR_MODE>},
+		{"IS_PAUSE_MENU_ACTIVE", native_function<LUA_NATIVE_HUD_IS_PAUSE_MENU_ACTIVE>},
+		{"IS_PAUSE_MENU_RESTARTING", native_function<LUA_NATIVE_HUD_IS_PAUSE_MENU_RESTARTING>},
+		{"IS_RADAR_HIDDEN", native_function<LUA_NATIVE_HUD_IS_RADAR_HIDDEN>},
+		{"IS_RADAR_PREFERENCE_SWITCHED_ON", native_function<LUA_NATIVE_HUD_IS_RADAR_PREFERENCE_SWITCHED_ON>},
+		{"IS_REPORTUGC_MENU_OPEN", native_function<LUA_NATIVE_HUD_IS_REPORTUGC_MENU_OPEN>},
+		{"IS_SCRIPTED_HUD_COMPONENT_ACTIVE", native_function<LUA_NATIVE_HUD_IS_SCRIPTED_HUD_COMPONENT_ACTIVE>},
+		{"IS_SCRIPTED_HUD_COMPONENT_HIDDEN_THIS_FRAME", native_function<LUA_NATIVE_HUD_IS_SCRIPTED_HUD_COMPONENT_HIDDEN_THIS_FRAME>},
+		{"IS_SOCIAL_CLUB_ACTIVE", native_function<LUA_NATIVE_HUD_IS_SOCIAL_CLUB_ACTIVE>},
+		{"IS_STORE_PENDING_NETWORK_SHUTDOWN_TO_OPEN", native_function<LUA_NATIVE_HUD_IS_STORE_PENDING_NETWORK_SHUTDOWN_TO_OPEN>},
+		{"IS_STREAMING_ADDITIONAL_TEXT", native_function<LUA_NATIVE_HUD_IS_STREAMING_ADDITIONAL_TEXT>},
+		{"IS_SUBTITLE_PREFERENCE_SWITCHED_ON", native_function<LUA_NATIVE_HUD_IS_SUBTITLE_PREFERENCE_SWITCHED_ON>},
+		{"IS_UPDATING_MP_GAMER_TAG_NAME_AND_CREW_DETAILS", native_function<LUA_NATIVE_HUD_IS_UPDATING_MP_GAMER_TAG_NAME_AND_CREW_DETAILS>},
+		{"IS_WARNING_MESSAGE_ACTIVE", native_function<LUA_NATIVE_HUD_IS_WARNING_MESSAGE_ACTIVE>},
+		{"IS_WARNING_MESSAGE_READY_FOR_CONTROL", native_function<LUA_NATIVE_HUD_IS_WARNING_MESSAGE_READY_FOR_CONTROL>},
+		{"IS_WAYPOINT_ACTIVE", native_function<LUA_NATIVE_HUD_IS_WAYPOINT_ACTIVE>},
+		{"LINK_NAMED_RENDERTARGET", native_function<LUA_NATIVE_HUD_LINK_NAMED_RENDERTARGET>},
+		{"LOCK_MINIMAP_ANGLE", native_function<LUA_NATIVE_HUD_LOCK_MINIMAP_ANGLE>},
+		{"LOCK_MINIMAP_POSITION", native_function<LUA_NATIVE_HUD_LOCK_MINIMAP_POSITION>},
+		{"MP_TEXT_CHAT_DISABLE", native_function<LUA_NATIVE_HUD_MP_TEXT_CHAT_DISABLE>},
+		{"MP_TEXT_CHAT_IS_TEAM_JOB", native_function<LUA_NATIVE_HUD_MP_TEXT_CHAT_IS_TEAM_JOB>},
+		{"OPEN_ONLINE_POLICIES_MENU", native_function<LUA_NATIVE_HUD_OPEN_ONLINE_POLICIES_MENU>},
+		{"OPEN_REPORTUGC_MENU", native_function<LUA_NATIVE_HUD_OPEN_REPORTUGC_MENU>},
+		{"OPEN_SOCIAL_CLUB_MENU", native_function<LUA_NATIVE_HUD_OPEN_SOCIAL_CLUB_MENU>},
+		{"OVERRIDE_MP_TEXT_CHAT_COLOR", native_function<LUA_NATIVE_HUD_OVERRIDE_MP_TEXT_CHAT_COLOR>},
+		{"OVERRIDE_MP_TEXT_CHAT_TEAM_STRING", native_function<LUA_NATIVE_HUD_OVERRIDE_MP_TEXT_CHAT_TEAM_STRING>},
+		{"PAUSE_MENUCEPTION_GO_DEEPER", native_function<LUA_NATIVE_HUD_PAUSE_MENUCEPTION_GO_DEEPER>},
+		{"PAUSE_MENUCEPTION_THE_KICK", native_function<LUA_NATIVE_HUD_PAUSE_MENUCEPTION_THE_KICK>},
+		{"PAUSE_MENU_ACTIVATE_CONTEXT", native_function<LUA_NATIVE_HUD_PAUSE_MENU_ACTIVATE_CONTEXT>},
+		{"PAUSE_MENU_DEACTIVATE_CONTEXT", native_function<LUA_NATIVE_HUD_PAUSE_MENU_DEACTIVATE_CONTEXT>},
+		{"PAUSE_MENU_GET_HAIR_COLOUR_INDEX", native_function<LUA_NATIVE_HUD_PAUSE_MENU_GET_HAIR_COLOUR_INDEX>},
+		{"PAUSE_MENU_GET_MOUSE_CLICK_EVENT", native_function<LUA_NATIVE_HUD_PAUSE_MENU_GET_MOUSE_CLICK_EVENT>},
+		{"PAUSE_MENU_GET_MOUSE_HOVER_INDEX", native_function<LUA_NATIVE_HUD_PAUSE_MENU_GET_MOUSE_HOVER_INDEX>},
+		{"PAUSE_MENU_GET_MOUSE_HOVER_UNIQUE_ID", native_function<LUA_NATIVE_HUD_PAUSE_MENU_GET_MOUSE_HOVER_UNIQUE_ID>},
+		{"PAUSE_MENU_IS_CONTEXT_ACTIVE", native_function<LUA_NATIVE_HUD_PAUSE_MENU_IS_CONTEXT_ACTIVE>},
+		{"PAUSE_MENU_IS_CONTEXT_MENU_ACTIVE", native_function<LUA_NATIVE_HUD_PAUSE_MENU_IS_CONTEXT_MENU_ACTIVE>},
+		{"PAUSE_MENU_REDRAW_INSTRUCTIONAL_BUTTONS", native_function<LUA_NATIVE_HUD_PAUSE_MENU_REDRAW_INSTRUCTIONAL_BUTTONS>},
+		{"PAUSE_MENU_SET_BUSY_SPINNER", native_function<LUA_NATIVE_HUD_PAUSE_MENU_SET_BUSY_SPINNER>},
+		{"PAUSE_MENU_SET_WARN_ON_TAB_CHANGE", native_function<LUA_NATIVE_HUD_PAUSE_MENU_SET_WARN_ON_TAB_CHANGE>},
+		{"PAUSE_TOGGLE_FULLSCREEN_MAP", native_function<LUA_NATIVE_HUD_PAUSE_TOGGLE_FULLSCREEN_MAP>},
+		{"PRELOAD_BUSYSPINNER", native_function<LUA_NATIVE_HUD_PRELOAD_BUSYSPINNER>},
+		{"PULSE_BLIP", native_function<LUA_NATIVE_HUD_PULSE_BLIP>},
+		{"REFRESH_WAYPOINT", native_function<LUA_NATIVE_HUD_REFRESH_WAYPOINT>},
+		{"REGISTER_NAMED_RENDERTARGET", native_function<LUA_NATIVE_HUD_REGISTER_NAMED_RENDERTARGET>},
+		{"RELEASE_CONTROL_OF_FRONTEND", native_function<LUA_NATIVE_HUD_RELEASE_CONTROL_OF_FRONTEND>},
+		{"RELEASE_NAMED_RENDERTARGET", native_function<LUA_NATIVE_HUD_RELEASE_NAMED_RENDERTARGET>},
+		{"RELOAD_MAP_MENU", native_function<LUA_NATIVE_HUD_RELOAD_MAP_MENU>},
+		{"REMOVE_BLIP", native_function<LUA_NATIVE_HUD_REMOVE_BLIP>},
+		{"REMOVE_COP_BLIP_FROM_PED", native_function<LUA_NATIVE_HUD_REMOVE_COP_BLIP_FROM_PED>},
+		{"REMOVE_FAKE_CONE_DATA", native_function<LUA_NATIVE_HUD_REMOVE_FAKE_CONE_DATA>},
+		{"REMOVE_MP_GAMER_TAG", native_function<LUA_NATIVE_HUD_REMOVE_MP_GAMER_TAG>},
+		{"REMOVE_MULTIPLAYER_BANK_CASH", native_function<LUA_NATIVE_HUD_REMOVE_MULTIPLAYER_BANK_CASH>},
+		{"REMOVE_MULTIPLAYER_HUD_CASH", native_function<LUA_NATIVE_HUD_REMOVE_MULTIPLAYER_HUD_CASH>},
+		{"REMOVE_MULTIPLAYER_WALLET_CASH", native_function<LUA_NATIVE_HUD_REMOVE_MULTIPLAYER_WALLET_CASH>},
+		{"REMOVE_WARNING_MESSAGE_OPTION_ITEMS", native_function<LUA_NATIVE_HUD_REMOVE_WARNING_MESSAGE_OPTION_ITEMS>},
+		{"REPLACE_HUD_COLOUR", native_function<LUA_NATIVE_HUD_REPLACE_HUD_COLOUR>},
+		{"REPLACE_HUD_COLOUR_WITH_RGBA", native_function<LUA_NATIVE_HUD_REPLACE_HUD_COLOUR_WITH_RGBA>},
+		{"REQUEST_ADDITIONAL_TEXT", native_function<LUA_NATIVE_HUD_REQUEST_ADDITIONAL_TEXT>},
+		{"REQUEST_ADDITIONAL_TEXT_FOR_DLC", native_function<LUA_NATIVE_HUD_REQUEST_ADDITIONAL_TEXT_FOR_DLC>},
+		{"RESET_GLOBAL_ACTIONSCRIPT_FLAG", native_function<LUA_NATIVE_HUD_RESET_GLOBAL_ACTIONSCRIPT_FLAG>},
+		{"RESET_HUD_COMPONENT_VALUES", native_function<LUA_NATIVE_HUD_RESET_HUD_COMPONENT_VALUES>},
+		{"RESET_RETICULE_VALUES", native_function<LUA_NATIVE_HUD_RESET_RETICULE_VALUES>},
+		{"RESTART_FRONTEND_MENU", native_function<LUA_NATIVE_HUD_RESTART_FRONTEND_MENU>},
+		{"SETUP_FAKE_CONE_DATA", native_function<LUA_NATIVE_HUD_SETUP_FAKE_CONE_DATA>},
+		{"SET_ABILITY_BAR_VALUE", native_function<LUA_NATIVE_HUD_SET_ABILITY_BAR_VALUE>},
+		{"SET_ABILITY_BAR_VISIBILITY", native_function<LUA_NATIVE_HUD_SET_ABILITY_BAR_VISIBILITY>},
+		{"SET_ALLOW_ABILITY_BAR", native_function<LUA_NATIVE_HUD_SET_ALLOW_ABILITY_BAR>},
+		{"SET_ALLOW_COMMA_ON_TEXT_INPUT", native_function<LUA_NATIVE_HUD_SET_ALLOW_COMMA_ON_TEXT_INPUT>},
+		{"SET_ALL_MP_GAMER_TAGS_VISIBILITY", native_function<LUA_NATIVE_HUD_SET_ALL_MP_GAMER_TAGS_VISIBILITY>},
+		{"SET_BIGMAP_ACTIVE", native_function<LUA_NATIVE_HUD_SET_BIGMAP_ACTIVE>},
+		{"SET_BLIP_ALPHA", native_function<LUA_NATIVE_HUD_SET_BLIP_ALPHA>},
+		{"SET_BLIP_AS_FRIENDLY", native_function<LUA_NATIVE_HUD_SET_BLIP_AS_FRIENDLY>},
+		{"SET_BLIP_AS_MINIMAL_ON_EDGE", native_function<LUA_NATIVE_HUD_SET_BLIP_AS_MINIMAL_ON_EDGE>},
+		{"SET_BLIP_AS_MISSION_CREATOR_BLIP", native_function<LUA_NATIVE_HUD_SET_BLIP_AS_MISSION_CREATOR_BLIP>},
+		{"SET_BLIP_AS_SHORT_RANGE", native_function<LUA_NATIVE_HUD_SET_BLIP_AS_SHORT_RANGE>},
+		{"SET_BLIP_BRIGHT", native_function<LUA_NATIVE_HUD_SET_BLIP_BRIGHT>},
+		{"SET_BLIP_CATEGORY", native_function<LUA_NATIVE_HUD_SET_BLIP_CATEGORY>},
+		{"SET_BLIP_COLOUR", native_function<LUA_NATIVE_HUD_SET_BLIP_COLOUR>},
+		{"SET_BLIP_COORDS", native_function<LUA_NATIVE_HUD_SET_BLIP_COORDS>},
+		{"SET_BLIP_DISPLAY", native_function<LUA_NATIVE_HUD_SET_BLIP_DISPLAY>},
+		{"SET_BLIP_EXTENDED_HEIGHT_THRESHOLD", native_function<LUA_NATIVE_HUD_SET_BLIP_EXTENDED_HEIGHT_THRESHOLD>},
+		{"SET_BLIP_FADE", native_function<LUA_NATIVE_HUD_SET_BLIP_FADE>},
+		{"SET_BLIP_FLASHES", native_function<LUA_NATIVE_HUD_SET_BLIP_FLASHES>},
+		{"SET_BLIP_FLASHES_ALTERNATE", native_function<LUA_NATIVE_HUD_SET_BLIP_FLASHES_ALTERNATE>},
+		{"SET_BLIP_FLASH_INTERVAL", native_function<LUA_NATIVE_HUD_SET_BLIP_FLASH_INTERVAL>},
+		{"SET_BLIP_FLASH_TIMER", native_function<LUA_NATIVE_HUD_SET_BLIP_FLASH_TIMER>},
+		{"SET_BLIP_GPS_ROUTE_DISPLAY_DISTANCE_", native_function<LUA_NATIVE_HUD_SET_BLIP_GPS_ROUTE_DISPLAY_DISTANCE_>},
+		{"SET_BLIP_HIDDEN_ON_LEGEND", native_function<LUA_NATIVE_HUD_SET_BLIP_HIDDEN_ON_LEGEND>},
+		{"SET_BLIP_HIGH_DETAIL", native_function<LUA_NATIVE_HUD_SET_BLIP_HIGH_DETAIL>},
+		{"SET_BLIP_MARKER_LONG_DISTANCE", native_function<LUA_NATIVE_HUD_SET_BLIP_MARKER_LONG_DISTANCE>},
+		{"SET_BLIP_NAME_FROM_TEXT_FILE", native_function<LUA_NATIVE_HUD_SET_BLIP_NAME_FROM_TEXT_FILE>},
+		{"SET_BLIP_NAME_TO_PLAYER_NAME", native_function<LUA_NATIVE_HUD_SET_BLIP_NAME_TO_PLAYER_NAME>},
+		{"SET_BLIP_PRIORITY", native_function<LUA_NATIVE_HUD_SET_BLIP_PRIORITY>},
+		{"SET_BLIP_ROTATION", native_function<LUA_NATIVE_HUD_SET_BLIP_ROTATION>},
+		{"SET_BLIP_ROTATION_WITH_FLOAT", native_function<LUA_NATIVE_HUD_SET_BLIP_ROTATION_WITH_FLOAT>},
+		{"SET_BLIP_ROUTE", native_function<LUA_NATIVE_HUD_SET_BLIP_ROUTE>},
+		{"SET_BLIP_ROUTE_COLOUR", native_function<LUA_NATIVE_HUD_SET_BLIP_ROUTE_COLOUR>},
+		{"SET_BLIP_SCALE", native_function<LUA_NATIVE_HUD_SET_BLIP_SCALE>},
+		{"SET_BLIP_SCALE_2D", native_function<LUA_NATIVE_HUD_SET_BLIP_SCALE_2D>},
+		{"SET_BLIP_SECONDARY_COLOUR", native_function<LUA_NATIVE_HUD_SET_BLIP_SECONDARY_COLOUR>},
+		{"SET_BLIP_SHORT_HEIGHT_THRESHOLD", native_function<LUA_NATIVE_HUD_SET_BLIP_SHORT_HEIGHT_THRESHOLD>},
+		{"SET_BLIP_SHOW_CONE", native_function<LUA_NATIVE_HUD_SET_BLIP_SHOW_CONE>},
+		{"SET_BLIP_SPRITE", native_function<LUA_NATIVE_HUD_SET_BLIP_SPRITE>},
+		{"SET_BLIP_USE_HEIGHT_INDICATOR_ON_EDGE", native_function<LUA_NATIVE_HUD_SET_BLIP_USE_HEIGHT_INDICATOR_ON_EDGE>},
+		{"SET_BLOCK_WANTED_FLASH", native_function<LUA_NATIVE_HUD_SET_BLOCK_WANTED_FLASH>},
+		{"SET_COLOUR_OF_NEXT_TEXT_COMPONENT", native_function<LUA_NATIVE_HUD_SET_COLOUR_OF_NEXT_TEXT_COMPONENT>},
+		{"SET_COP_BLIP_SPRITE", native_function<LUA_NATIVE_HUD_SET_COP_BLIP_SPRITE>},
+		{"SET_COP_BLIP_SPRITE_AS_STANDARD", native_function<LUA_NATIVE_HUD_SET_COP_BLIP_SPRITE_AS_STANDARD>},
+		{"SET_CUSTOM_MP_HUD_COLOR", native_function<LUA_NATIVE_HUD_SET_CUSTOM_MP_HUD_COLOR>},
+		{"SET_DESCRIPTION_FOR_UGC_MISSION_EIGHT_STRINGS", native_function<LUA_NATIVE_HUD_SET_DESCRIPTION_FOR_UGC_MISSION_EIGHT_STRINGS>},
+		{"SET_DIRECTOR_MODE_AVAILABLE", native_function<LUA_NATIVE_HUD_SET_DIRECTOR_MODE_AVAILABLE>},
+		{"SET_DIRECTOR_MODE_LAUNCHED_BY_SCRIPT", native_function<LUA_NATIVE_HUD_SET_DIRECTOR_MODE_LAUNCHED_BY_SCRIPT>},
+		{"SET_FAKE_GPS_PLAYER_POSITION_THIS_FRAME", native_function<LUA_NATIVE_HUD_SET_FAKE_GPS_PLAYER_POSITION_THIS_FRAME>},
+		{"SET_FAKE_MINIMAP_MAX_ALTIMETER_HEIGHT", native_function<LUA_NATIVE_HUD_SET_FAKE_MINIMAP_MAX_ALTIMETER_HEIGHT>},
+		{"SET_FAKE_PAUSEMAP_PLAYER_POSITION_THIS_FRAME", native_function<LUA_NATIVE_HUD_SET_FAKE_PAUSEMAP_PLAYER_POSITION_THIS_FRAME>},
+		{"SET_FAKE_SPECTATOR_MODE", native_function<LUA_NATIVE_HUD_SET_FAKE_SPECTATOR_MODE>},
+		{"SET_FLOATING_HELP_TEXT_SCREEN_POSITION", native_function<LUA_NATIVE_HUD_SET_FLOATING_HELP_TEXT_SCREEN_POSITION>},
+		{"SET_FLOATING_HELP_TEXT_STYLE", native_function<LUA_NATIVE_HUD_SET_FLOATING_HELP_TEXT_STYLE>},
+		{"SET_FLOATING_HELP_TEXT_TO_ENTITY", native_function<LUA_NATIVE_HUD_SET_FLOATING_HELP_TEXT_TO_ENTITY>},
+		{"SET_FLOATING_HELP_TEXT_WORLD_POSITION", native_function<LUA_NATIVE_HUD_SET_FLOATING_HELP_TEXT_WORLD_POSITION>},
+		{"SET_FORCE_SHOW_GPS", native_function<LUA_NATIVE_HUD_SET_FORCE_SHOW_GPS>},
+		{"SET_FRONTEND_ACTIVE", native_function<LUA_NATIVE_HUD_SET_FRONTEND_ACTIVE>},
+		{"SET_GPS_CUSTOM_ROUTE_RENDER", native_function<LUA_NATIVE_HUD_SET_GPS_CUSTOM_ROUTE_RENDER>},
+		{"SET_GPS_FLAGS", native_function<LUA_NATIVE_HUD_SET_GPS_FLAGS>},
+		{"SET_GPS_FLASHES", native_function<LUA_NATIVE_HUD_SET_GPS_FLASHES>},
+		{"SET_GPS_MULTI_ROUTE_RENDER", native_function<LUA_NATIVE_HUD_SET_GPS_MULTI_ROUTE_RENDER>},
+		{"SET_HEALTH_HUD_DISPLAY_VALUES", native_function<LUA_NATIVE_HUD_SET_HEALTH_HUD_DISPLAY_VALUES>},
+		{"SET_HELP_MESSAGE_STYLE", native_function<LUA_NATIVE_HUD_SET_HELP_MESSAGE_STYLE>},
+		{"SET_HUD_COMPONENT_POSITION", native_function<LUA_NATIVE_HUD_SET_HUD_COMPONENT_POSITION>},
+		{"SET_INSIDE_VERY_LARGE_INTERIOR", native_function<LUA_NATIVE_HUD_SET_INSIDE_VERY_LARGE_INTERIOR>},
+		{"SET_INSIDE_VERY_SMALL_INTERIOR", native_function<LUA_NATIVE_HUD_SET_INSIDE_VERY_SMALL_INTERIOR>},
+		{"SET_MAX_ARMOUR_HUD_DISPLAY", native_function<LUA_NATIVE_HUD_SET_MAX_ARMOUR_HUD_DISPLAY>},
+		{"SET_MAX_HEALTH_HUD_DISPLAY", native_function<LUA_NATIVE_HUD_SET_MAX_HEALTH_HUD_DISPLAY>},
+		{"SET_MINIMAP_BLOCK_WAYPOINT", native_function<LUA_NATIVE_HUD_SET_MINIMAP_BLOCK_WAYPOINT>},
+		{"SET_MINIMAP_COMPONENT", native_function<LUA_NATIVE_HUD_SET_MINIMAP_COMPONENT>},
+		{"SET_MINIMAP_FOW_DO_NOT_UPDATE", native_function<LUA_NATIVE_HUD_SET_MINIMAP_FOW_DO_NOT_UPDATE>},
+		{"SET_MINIMAP_FOW_REVEAL_COORDINATE", native_function<LUA_NATIVE_HUD_SET_MINIMAP_FOW_REVEAL_COORDINATE>},
+		{"SET_MINIMAP_GOLF_COURSE", native_function<LUA_NATIVE_HUD_SET_MINIMAP_GOLF_COURSE>},
+		{"SET_MINIMAP_GOLF_COURSE_OFF", native_function<LUA_NATIVE_HUD_SET_MINIMAP_GOLF_COURSE_OFF>},
+		{"SET_MINIMAP_HIDE_FOW", native_function<LUA_NATIVE_HUD_SET_MINIMAP_HIDE_FOW>},
+		{"SET_MINIMAP_IN_PROLOGUE", native_function<LUA_NATIVE_HUD_SET_MINIMAP_IN_PROLOGUE>},
+		{"SET_MINIMAP_IN_SPECTATOR_MODE", native_function<LUA_NATIVE_HUD_SET_MINIMAP_IN_SPECTATOR_MODE>},
+		{"SET_MINIMAP_SONAR_SWEEP", native_function<LUA_NATIVE_HUD_SET_MINIMAP_SONAR_SWEEP>},
+		{"SET_MISSION_NAME", native_function<LUA_NATIVE_HUD_SET_MISSION_NAME>},
+		{"SET_MISSION_NAME_FOR_UGC_MISSION", native_function<LUA_NATIVE_HUD_SET_MISSION_NAME_FOR_UGC_MISSION>},
+		{"SET_MOUSE_CURSOR_STYLE", native_function<LUA_NATIVE_HUD_SET_MOUSE_CURSOR_STYLE>},
+		{"SET_MOUSE_CURSOR_THIS_FRAME", native_function<LUA_NATIVE_HUD_SET_MOUSE_CURSOR_THIS_FRAME>},
+		{"SET_MOUSE_CURSOR_VISIBLE", native_function<LUA_NATIVE_HUD_SET_MOUSE_CURSOR_VISIBLE>},
+		{"SET_MP_GAMER_TAGS_POINT_HEALTH", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAGS_POINT_HEALTH>},
+		{"SET_MP_GAMER_TAGS_SHOULD_USE_POINTS_HEALTH", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAGS_SHOULD_USE_POINTS_HEALTH>},
+		{"SET_MP_GAMER_TAGS_SHOULD_USE_VEHICLE_HEALTH", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAGS_SHOULD_USE_VEHICLE_HEALTH>},
+		{"SET_MP_GAMER_TAG_ALPHA", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAG_ALPHA>},
+		{"SET_MP_GAMER_TAG_BIG_TEXT", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAG_BIG_TEXT>},
+		{"SET_MP_GAMER_TAG_COLOUR", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAG_COLOUR>},
+		{"SET_MP_GAMER_TAG_HEALTH_BAR_COLOUR", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAG_HEALTH_BAR_COLOUR>},
+		{"SET_MP_GAMER_TAG_NAME", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAG_NAME>},
+		{"SET_MP_GAMER_TAG_NUM_PACKAGES", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAG_NUM_PACKAGES>},
+		{"SET_MP_GAMER_TAG_VISIBILITY", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAG_VISIBILITY>},
+		{"SET_MP_GAMER_TAG_WANTED_LEVEL", native_function<LUA_NATIVE_HUD_SET_MP_GAMER_TAG_WANTED_LEVEL>},
+		{"SET_MULTIPLAYER_BANK_CASH", native_function<LUA_NATIVE_HUD_SET_MULTIPLAYER_BANK_CASH>},
+		{"SET_MULTIPLAYER_HUD_CASH", native_function<LUA_NATIVE_HUD_SET_MULTIPLAYER_HUD_CASH>},
+		{"SET_MULTIPLAYER_WALLET_CASH", native_function<LUA_NATIVE_HUD_SET_MULTIPLAYER_WALLET_CASH>},
+		{"SET_NEW_WAYPOINT", native_function<LUA_NATIVE_HUD_SET_NEW_WAYPOINT>},
+		{"SET_PAUSE_EXTERIOR_RENDERING_WHILE_IN_INTERIOR_", native_function<LUA_NATIVE_HUD_SET_PAUSE_EXTERIOR_RENDERING_WHILE_IN_INTERIOR_>},
+		{"SET_PAUSE_MENU_ACTIVE", native_function<LUA_NATIVE_HUD_SET_PAUSE_MENU_ACTIVE>},
+		{"SET_PAUSE_MENU_PED_LIGHTING", native_function<LUA_NATIVE_HUD_SET_PAUSE_MENU_PED_LIGHTING>},
+		{"SET_PAUSE_MENU_PED_SLEEP_STATE", native_function<LUA_NATIVE_HUD_SET_PAUSE_MENU_PED_SLEEP_STATE>},
+		{"SET_PED_AI_BLIP_FORCED_ON", native_function<LUA_NATIVE_HUD_SET_PED_AI_BLIP_FORCED_ON>},
+		{"SET_PED_AI_BLIP_GANG_ID", native_function<LUA_NATIVE_HUD_SET_PED_AI_BLIP_GANG_ID>},
+		{"SET_PED_AI_BLIP_HAS_CONE", native_function<LUA_NATIVE_HUD_SET_PED_AI_BLIP_HAS_CONE>},
+		{"SET_PED_AI_BLIP_NOTICE_RANGE", native_function<LUA_NATIVE_HUD_SET_PED_AI_BLIP_NOTICE_RANGE>},
+		{"SET_PED_AI_BLIP_SPRITE", native_function<LUA_NATIVE_HUD_SET_PED_AI_BLIP_SPRITE>},
+		{"SET_PED_HAS_AI_BLIP", native_function<LUA_NATIVE_HUD_SET_PED_HAS_AI_BLIP>},
+		{"SET_PED_HAS_AI_BLIP_WITH_COLOUR", native_function<LUA_NATIVE_HUD_SET_PED_HAS_AI_BLIP_WITH_COLOUR>},
+		{"SET_PLAYER_ICON_COLOUR", native_function<LUA_NATIVE_HUD_SET_PLAYER_ICON_COLOUR>},
+		{"SET_PLAYER_IS_IN_DIRECTOR_MODE", native_function<LUA_NATIVE_HUD_SET_PLAYER_IS_IN_DIRECTOR_MODE>},
+		{"SET_PM_WARNINGSCREEN_ACTIVE", native_function<LUA_NATIVE_HUD_SET_PM_WARNINGSCREEN_ACTIVE>},
+		{"SET_RACE_TRACK_RENDER", native_function<LUA_NATIVE_HUD_SET_RACE_TRACK_RENDER>},
+		{"SET_RADAR_AS_EXTERIOR_THIS_FRAME", native_function<LUA_NATIVE_HUD_SET_RADAR_AS_EXTERIOR_THIS_FRAME>},
+		{"SET_RADAR_AS_INTERIOR_THIS_FRAME", native_function<LUA_NATIVE_HUD_SET_RADAR_AS_INTERIOR_THIS_FRAME>},
+		{"SET_RADAR_ZOOM", native_function<LUA_NATIVE_HUD_SET_RADAR_ZOOM>},
+		{"SET_RADAR_ZOOM_PRECISE", native_function<LUA_NATIVE_HUD_SET_RADAR_ZOOM_PRECISE>},
+		{"SET_RADAR_ZOOM_TO_BLIP", native_function<LUA_NATIVE_HUD_SET_RADAR_ZOOM_TO_BLIP>},
+		{"SET_RADAR_ZOOM_TO_DISTANCE", native_function<LUA_NATIVE_HUD_SET_RADAR_ZOOM_TO_DISTANCE>},
+		{"SET_RADIUS_BLIP_EDGE", native_function<LUA_NATIVE_HUD_SET_RADIUS_BLIP_EDGE>},
+		{"SET_SAVEGAME_LIST_UNIQUE_ID", native_function<LUA_NATIVE_HUD_SET_SAVEGAME_LIST_UNIQUE_ID>},
+		{"SET_SCRIPT_VARIABLE_HUD_COLOUR", native_function<LUA_NATIVE_HUD_SET_SCRIPT_VARIABLE_HUD_COLOUR>},
+		{"SET_SECOND_SCRIPT_VARIABLE_HUD_COLOUR", native_function<LUA_NATIVE_HUD_SET_SECOND_SCRIPT_VARIABLE_HUD_COLOUR>},
+		{"SET_SOCIAL_CLUB_TOUR", native_function<LUA_NATIVE_HUD_SET_SOCIAL_CLUB_TOUR>},
+		{"SET_TEXT_CENTRE", native_function<LUA_NATIVE_HUD_SET_TEXT_CENTRE>},
+		{"SET_TEXT_COLOUR", native_function<LUA_NATIVE_HUD_SET_TEXT_COLOUR>},
+		{"SET_TEXT_DROPSHADOW", native_function<LUA_NATIVE_HUD_SET_TEXT_DROPSHADOW>},
+		{"SET_TEXT_DROP_SHADOW", native_function<LUA_NATIVE_HUD_SET_TEXT_DROP_SHADOW>},
+		{"SET_TEXT_EDGE", native_function<LUA_NATIVE_HUD_SET_TEXT_EDGE>},
+		{"SET_TEXT_FONT", native_function<LUA_NATIVE_HUD_SET_TEXT_FONT>},
+		{"SET_TEXT_INPUT_BOX_ENABLED", native_function<LUA_NATIVE_HUD_SET_TEXT_INPUT_BOX_ENABLED>},
+		{"SET_TEXT_JUSTIFICATION", native_function<LUA_NATIVE_HUD_SET_TEXT_JUSTIFICATION>},
+		{"SET_TEXT_LEADING", native_function<LUA_NATIVE_HUD_SET_TEXT_LEADING>},
+		{"SET_TEXT_LINE_HEIGHT_MULT", native_function<LUA_NATIVE_HUD_SET_TEXT_LINE_HEIGHT_MULT>},
+		{"SET_TEXT_OUTLINE", native_function<LUA_NATIVE_HUD_SET_TEXT_OUTLINE>},
+		{"SET_TEXT_PROPORTIONAL", native_function<LUA_NATIVE_HUD_SET_TEXT_PROPORTIONAL>},
+		{"SET_TEXT_RENDER_ID", native_function<LUA_NATIVE_HUD_SET_TEXT_RENDER_ID>},
+		{"SET_TEXT_RIGHT_JUSTIFY", native_function<LUA_NATIVE_HUD_SET_TEXT_RIGHT_JUSTIFY>},
+		{"SET_TEXT_SCALE", native_function<LUA_NATIVE_HUD_SET_TEXT_SCALE>},
+		{"SET_TEXT_WRAP", native_function<LUA_NATIVE_HUD_SET_TEXT_WRAP>},
+		{"SET_USE_ISLAND_MAP", native_function<LUA_NATIVE_HUD_SET_USE_ISLAND_MAP>},
+		{"SET_USE_SET_DESTINATION_IN_PAUSE_MAP", native_function<LUA_NATIVE_HUD_SET_USE_SET_DESTINATION_IN_PAUSE_MAP>},
+		{"SET_WARNING_MESSAGE", native_function<LUA_NATIVE_HUD_SET_WARNING_MESSAGE>},
+		{"SET_WARNING_MESSAGE_OPTION_HIGHLIGHT", native_function<LUA_NATIVE_HUD_SET_WARNING_MESSAGE_OPTION_HIGHLIGHT>},
+		{"SET_WARNING_MESSAGE_OPTION_ITEMS", native_function<LUA_NATIVE_HUD_SET_WARNING_MESSAGE_OPTION_ITEMS>},
+		{"SET_WARNING_MESSAGE_WITH_HEADER", native_function<LUA_NATIVE_HUD_SET_WARNING_MESSAGE_WITH_HEADER>},
+		{"SET_WARNING_MESSAGE_WITH_HEADER_AND_SUBSTRING_FLAGS", native_function<LUA_NATIVE_HUD_SET_WARNING_MESSAGE_WITH_HEADER_AND_SUBSTRING_FLAGS>},
+		{"SET_WARNING_MESSAGE_WITH_HEADER_AND_SUBSTRING_FLAGS_EXTENDED", native_function<LUA_NATIVE_HUD_SET_WARNING_MESSAGE_WITH_HEADER_AND_SUBSTRING_FLAGS_EXTENDED>},
+		{"SET_WARNING_MESSAGE_WITH_HEADER_EXTENDED", native_function<LUA_NATIVE_HUD_SET_WARNING_MESSAGE_WITH_HEADER_EXTENDED>},
+		{"SET_WAYPOINT_OFF", native_function<LUA_NATIVE_HUD_SET_WAYPOINT_OFF>},
+		{"SET_WIDESCREEN_FORMAT", native_function<LUA_NATIVE_HUD_SET_WIDESCREEN_FORMAT>},
+		{"SHOW_ACCOUNT_PICKER", native_function<LUA_NATIVE_HUD_SHOW_ACCOUNT_PICKER>},
+		{"SHOW_CONTACT_INSTRUCTIONAL_BUTTON", native_function<LUA_NATIVE_HUD_SHOW_CONTACT_INSTRUCTIONAL_BUTTON>},
+		{"SHOW_CREW_INDICATOR_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_CREW_INDICATOR_ON_BLIP>},
+		{"SHOW_FOR_SALE_ICON_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_FOR_SALE_ICON_ON_BLIP>},
+		{"SHOW_FRIEND_INDICATOR_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_FRIEND_INDICATOR_ON_BLIP>},
+		{"SHOW_GOLD_TICK_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_GOLD_TICK_ON_BLIP>},
+		{"SHOW_HEADING_INDICATOR_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_HEADING_INDICATOR_ON_BLIP>},
+		{"SHOW_HEIGHT_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_HEIGHT_ON_BLIP>},
+		{"SHOW_HUD_COMPONENT_THIS_FRAME", native_function<LUA_NATIVE_HUD_SHOW_HUD_COMPONENT_THIS_FRAME>},
+		{"SHOW_NUMBER_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_NUMBER_ON_BLIP>},
+		{"SHOW_OUTLINE_INDICATOR_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_OUTLINE_INDICATOR_ON_BLIP>},
+		{"SHOW_SCRIPTED_HUD_COMPONENT_THIS_FRAME", native_function<LUA_NATIVE_HUD_SHOW_SCRIPTED_HUD_COMPONENT_THIS_FRAME>},
+		{"SHOW_START_MISSION_INSTRUCTIONAL_BUTTON", native_function<LUA_NATIVE_HUD_SHOW_START_MISSION_INSTRUCTIONAL_BUTTON>},
+		{"SHOW_TICK_ON_BLIP", native_function<LUA_NATIVE_HUD_SHOW_TICK_ON_BLIP>},
+		{"START_GPS_CUSTOM_ROUTE", native_function<LUA_NATIVE_HUD_START_GPS_CUSTOM_ROUTE>},
+		{"START_GPS_MULTI_ROUTE", native_function<LUA_NATIVE_HUD_START_GPS_MULTI_ROUTE>},
+		{"SUPPRESS_FRONTEND_RENDERING_THIS_FRAME", native_function<LUA_NATIVE_HUD_SUPPRESS_FRONTEND_RENDERING_THIS_FRAME>},
+		{"TAKE_CONTROL_OF_FRONTEND", native_function<LUA_NATIVE_HUD_TAKE_CONTROL_OF_FRONTEND>},
+		{"THEFEED_AUTO_POST_GAMETIPS_OFF", native_function<LUA_NATIVE_HUD_THEFEED_AUTO_POST_GAMETIPS_OFF>},
+		{"THEFEED_AUTO_POST_GAMETIPS_ON", native_function<LUA_NATIVE_HUD_THEFEED_AUTO_POST_GAMETIPS_ON>},
+		{"THEFEED_CLEAR_FROZEN_POST", native_function<LUA_NATIVE_HUD_THEFEED_CLEAR_FROZEN_POST>},
+		{"THEFEED_FLUSH_QUEUE", native_function<LUA_NATIVE_HUD_THEFEED_FLUSH_QUEUE>},
+		{"THEFEED_FORCE_RENDER_OFF", native_function<LUA_NATIVE_HUD_THEFEED_FORCE_RENDER_OFF>},
+		{"THEFEED_FORCE_RENDER_ON", native_function<LUA_NATIVE_HUD_THEFEED_FORCE_RENDER_ON>},
+		{"THEFEED_FREEZE_NEXT_POST", native_function<LUA_NATIVE_HUD_THEFEED_FREEZE_NEXT_POST>},
+		{"THEFEED_GET_LAST_SHOWN_PHONE_ACTIVATABLE_FEED_ID", native_function<LUA_NATIVE_HUD_THEFEED_GET_LAST_SHOWN_PHONE_ACTIVATABLE_FEED_ID>},
+		{"THEFEED_HIDE", native_function<LUA_NATIVE_HUD_THEFEED_HIDE>},
+		{"THEFEED_HIDE_THIS_FRAME", native_function<LUA_NATIVE_HUD_THEFEED_HIDE_THIS_FRAME>},
+		{"THEFEED_IS_PAUSED", native_function<LUA_NATIVE_HUD_THEFEED_IS_PAUSED>},
+		{"THEFEED_ONLY_SHOW_TOOLTIPS", native_function<LUA_NATIVE_HUD_THEFEED_ONLY_SHOW_TOOLTIPS>},
+		{"THEFEED_PAUSE", native_function<LUA_NATIVE_HUD_THEFEED_PAUSE>},
+		{"THEFEED_REMOVE_ITEM", native_function<LUA_NATIVE_HUD_THEFEED_REMOVE_ITEM>},
+		{"THEFEED_REPORT_LOGO_OFF", native_function<LUA_NATIVE_HUD_THEFEED_REPORT_LOGO_OFF>},
+		{"THEFEED_REPORT_LOGO_ON", native_function<LUA_NATIVE_HUD_THEFEED_REPORT_LOGO_ON>},
+		{"THEFEED_RESET_ALL_PARAMETERS", native_function<LUA_NATIVE_HUD_THEFEED_RESET_ALL_PARAMETERS>},
+		{"THEFEED_RESUME", native_function<LUA_NATIVE_HUD_THEFEED_RESUME>},
+		{"THEFEED_SET_BACKGROUND_COLOR_FOR_NEXT_POST", native_function<LUA_NATIVE_HUD_THEFEED_SET_BACKGROUND_COLOR_FOR_NEXT_POST>},
+		{"THEFEED_SET_FLASH_DURATION_PARAMETER_FOR_NEXT_MESSAGE", native_function<LUA_NATIVE_HUD_THEFEED_SET_FLASH_DURATION_PARAMETER_FOR_NEXT_MESSAGE>},
+		{"THEFEED_SET_RGBA_PARAMETER_FOR_NEXT_MESSAGE", native_function<LUA_NATIVE_HUD_THEFEED_SET_RGBA_PARAMETER_FOR_NEXT_MESSAGE>},
+		{"THEFEED_SET_SCRIPTED_MENU_HEIGHT", native_function<LUA_NATIVE_HUD_THEFEED_SET_SCRIPTED_MENU_HEIGHT>},
+		{"THEFEED_SET_SNAP_FEED_ITEM_POSITIONS", native_function<LUA_NATIVE_HUD_THEFEED_SET_SNAP_FEED_ITEM_POSITIONS>},
+		{"THEFEED_SET_VIBRATE_PARAMETER_FOR_NEXT_MESSAGE", native_function<LUA_NATIVE_HUD_THEFEED_SET_VIBRATE_PARAMETER_FOR_NEXT_MESSAGE>},
+		{"THEFEED_SHOW", native_function<LUA_NATIVE_HUD_THEFEED_SHOW>},
+		{"THEFEED_UPDATE_ITEM_TEXTURE", native_function<LUA_NATIVE_HUD_THEFEED_UPDATE_ITEM_TEXTURE>},
+		{"TOGGLE_STEALTH_RADAR", native_function<LUA_NATIVE_HUD_TOGGLE_STEALTH_RADAR>},
+		{"TRIGGER_SONAR_BLIP", native_function<LUA_NATIVE_HUD_TRIGGER_SONAR_BLIP>},
+		{"UNLOCK_MINIMAP_ANGLE", native_function<LUA_NATIVE_HUD_UNLOCK_MINIMAP_ANGLE>},
+		{"UNLOCK_MINIMAP_POSITION", native_function<LUA_NATIVE_HUD_UNLOCK_MINIMAP_POSITION>},
+		{"UPDATE_RADAR_ZOOM_TO_BLIP", native_function<LUA_NATIVE_HUD_UPDATE_RADAR_ZOOM_TO_BLIP>},
+		{"USE_FAKE_MP_CASH", native_function<LUA_NATIVE_HUD_USE_FAKE_MP_CASH>},
+		{"USE_VEHICLE_TARGETING_RETICULE", native_function<LUA_NATIVE_HUD_USE_VEHICLE_TARGETING_RETICULE>},
+		{"USE_VEHICLE_TARGETING_RETICULE_ON_VEHICLES_", native_function<LUA_NATIVE_HUD_USE_VEHICLE_TARGETING_RETICULE_ON_VEHICLES_>},
+	};
+
 	void init_native_binding_HUD(sol::state& L)
 	{
-		auto HUD = L["HUD"].get_or_create<sol::table>();
-		HUD.set_function("BEGIN_TEXT_COMMAND_BUSYSPINNER_ON", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_BUSYSPINNER_ON);
-		HUD.set_function("END_TEXT_COMMAND_BUSYSPINNER_ON", LUA_NATIVE_HUD_END_TEXT_COMMAND_BUSYSPINNER_ON);
-		HUD.set_function("BUSYSPINNER_OFF", LUA_NATIVE_HUD_BUSYSPINNER_OFF);
-		HUD.set_function("PRELOAD_BUSYSPINNER", LUA_NATIVE_HUD_PRELOAD_BUSYSPINNER);
-		HUD.set_function("BUSYSPINNER_IS_ON", LUA_NATIVE_HUD_BUSYSPINNER_IS_ON);
-		HUD.set_function("BUSYSPINNER_IS_DISPLAYING", LUA_NATIVE_HUD_BUSYSPINNER_IS_DISPLAYING);
-		HUD.set_function("DISABLE_PAUSEMENU_SPINNER", LUA_NATIVE_HUD_DISABLE_PAUSEMENU_SPINNER);
-		HUD.set_function("SET_MOUSE_CURSOR_THIS_FRAME", LUA_NATIVE_HUD_SET_MOUSE_CURSOR_THIS_FRAME);
-		HUD.set_function("SET_MOUSE_CURSOR_STYLE", LUA_NATIVE_HUD_SET_MOUSE_CURSOR_STYLE);
-		HUD.set_function("SET_MOUSE_CURSOR_VISIBLE", LUA_NATIVE_HUD_SET_MOUSE_CURSOR_VISIBLE);
-		HUD.set_function("IS_MOUSE_ROLLED_OVER_INSTRUCTIONAL_BUTTONS", LUA_NATIVE_HUD_IS_MOUSE_ROLLED_OVER_INSTRUCTIONAL_BUTTONS);
-		HUD.set_function("GET_MOUSE_EVENT", LUA_NATIVE_HUD_GET_MOUSE_EVENT);
-		HUD.set_function("THEFEED_ONLY_SHOW_TOOLTIPS", LUA_NATIVE_HUD_THEFEED_ONLY_SHOW_TOOLTIPS);
-		HUD.set_function("THEFEED_SET_SCRIPTED_MENU_HEIGHT", LUA_NATIVE_HUD_THEFEED_SET_SCRIPTED_MENU_HEIGHT);
-		HUD.set_function("THEFEED_HIDE", LUA_NATIVE_HUD_THEFEED_HIDE);
-		HUD.set_function("THEFEED_HIDE_THIS_FRAME", LUA_NATIVE_HUD_THEFEED_HIDE_THIS_FRAME);
-		HUD.set_function("THEFEED_SHOW", LUA_NATIVE_HUD_THEFEED_SHOW);
-		HUD.set_function("THEFEED_FLUSH_QUEUE", LUA_NATIVE_HUD_THEFEED_FLUSH_QUEUE);
-		HUD.set_function("THEFEED_REMOVE_ITEM", LUA_NATIVE_HUD_THEFEED_REMOVE_ITEM);
-		HUD.set_function("THEFEED_FORCE_RENDER_ON", LUA_NATIVE_HUD_THEFEED_FORCE_RENDER_ON);
-		HUD.set_function("THEFEED_FORCE_RENDER_OFF", LUA_NATIVE_HUD_THEFEED_FORCE_RENDER_OFF);
-		HUD.set_function("THEFEED_PAUSE", LUA_NATIVE_HUD_THEFEED_PAUSE);
-		HUD.set_function("THEFEED_RESUME", LUA_NATIVE_HUD_THEFEED_RESUME);
-		HUD.set_function("THEFEED_IS_PAUSED", LUA_NATIVE_HUD_THEFEED_IS_PAUSED);
-		HUD.set_function("THEFEED_REPORT_LOGO_ON", LUA_NATIVE_HUD_THEFEED_REPORT_LOGO_ON);
-		HUD.set_function("THEFEED_REPORT_LOGO_OFF", LUA_NATIVE_HUD_THEFEED_REPORT_LOGO_OFF);
-		HUD.set_function("THEFEED_GET_LAST_SHOWN_PHONE_ACTIVATABLE_FEED_ID", LUA_NATIVE_HUD_THEFEED_GET_LAST_SHOWN_PHONE_ACTIVATABLE_FEED_ID);
-		HUD.set_function("THEFEED_AUTO_POST_GAMETIPS_ON", LUA_NATIVE_HUD_THEFEED_AUTO_POST_GAMETIPS_ON);
-		HUD.set_function("THEFEED_AUTO_POST_GAMETIPS_OFF", LUA_NATIVE_HUD_THEFEED_AUTO_POST_GAMETIPS_OFF);
-		HUD.set_function("THEFEED_SET_BACKGROUND_COLOR_FOR_NEXT_POST", LUA_NATIVE_HUD_THEFEED_SET_BACKGROUND_COLOR_FOR_NEXT_POST);
-		HUD.set_function("THEFEED_SET_RGBA_PARAMETER_FOR_NEXT_MESSAGE", LUA_NATIVE_HUD_THEFEED_SET_RGBA_PARAMETER_FOR_NEXT_MESSAGE);
-		HUD.set_function("THEFEED_SET_FLASH_DURATION_PARAMETER_FOR_NEXT_MESSAGE", LUA_NATIVE_HUD_THEFEED_SET_FLASH_DURATION_PARAMETER_FOR_NEXT_MESSAGE);
-		HUD.set_function("THEFEED_SET_VIBRATE_PARAMETER_FOR_NEXT_MESSAGE", LUA_NATIVE_HUD_THEFEED_SET_VIBRATE_PARAMETER_FOR_NEXT_MESSAGE);
-		HUD.set_function("THEFEED_RESET_ALL_PARAMETERS", LUA_NATIVE_HUD_THEFEED_RESET_ALL_PARAMETERS);
-		HUD.set_function("THEFEED_FREEZE_NEXT_POST", LUA_NATIVE_HUD_THEFEED_FREEZE_NEXT_POST);
-		HUD.set_function("THEFEED_CLEAR_FROZEN_POST", LUA_NATIVE_HUD_THEFEED_CLEAR_FROZEN_POST);
-		HUD.set_function("THEFEED_SET_SNAP_FEED_ITEM_POSITIONS", LUA_NATIVE_HUD_THEFEED_SET_SNAP_FEED_ITEM_POSITIONS);
-		HUD.set_function("THEFEED_UPDATE_ITEM_TEXTURE", LUA_NATIVE_HUD_THEFEED_UPDATE_ITEM_TEXTURE);
-		HUD.set_function("BEGIN_TEXT_COMMAND_THEFEED_POST", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_THEFEED_POST);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_STATS", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_STATS);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_SUBTITLE_LABEL", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_SUBTITLE_LABEL);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_TU", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_TU);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_WITH_CREW_TAG", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_WITH_CREW_TAG);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_WITH_CREW_TAG_AND_ADDITIONAL_ICON", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MESSAGETEXT_WITH_CREW_TAG_AND_ADDITIONAL_ICON);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_TICKER", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_TICKER);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_TICKER_FORCED", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_TICKER_FORCED);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_TICKER_WITH_TOKENS", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_TICKER_WITH_TOKENS);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_AWARD", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_AWARD);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_CREWTAG", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_CREWTAG);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_CREWTAG_WITH_GAME_NAME", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_CREWTAG_WITH_GAME_NAME);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_UNLOCK", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_UNLOCK);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_UNLOCK_TU", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_UNLOCK_TU);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_UNLOCK_TU_WITH_COLOR", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_UNLOCK_TU_WITH_COLOR);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_MPTICKER", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_MPTICKER);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_CREW_RANKUP_WITH_LITERAL_FLAG", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_CREW_RANKUP_WITH_LITERAL_FLAG);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_VERSUS_TU", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_VERSUS_TU);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_REPLAY", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_REPLAY);
-		HUD.set_function("END_TEXT_COMMAND_THEFEED_POST_REPLAY_INPUT", LUA_NATIVE_HUD_END_TEXT_COMMAND_THEFEED_POST_REPLAY_INPUT);
-		HUD.set_function("BEGIN_TEXT_COMMAND_PRINT", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_PRINT);
-		HUD.set_function("END_TEXT_COMMAND_PRINT", LUA_NATIVE_HUD_END_TEXT_COMMAND_PRINT);
-		HUD.set_function("BEGIN_TEXT_COMMAND_IS_MESSAGE_DISPLAYED", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_IS_MESSAGE_DISPLAYED);
-		HUD.set_function("END_TEXT_COMMAND_IS_MESSAGE_DISPLAYED", LUA_NATIVE_HUD_END_TEXT_COMMAND_IS_MESSAGE_DISPLAYED);
-		HUD.set_function("BEGIN_TEXT_COMMAND_DISPLAY_TEXT", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_DISPLAY_TEXT);
-		HUD.set_function("END_TEXT_COMMAND_DISPLAY_TEXT", LUA_NATIVE_HUD_END_TEXT_COMMAND_DISPLAY_TEXT);
-		HUD.set_function("BEGIN_TEXT_COMMAND_GET_SCREEN_WIDTH_OF_DISPLAY_TEXT", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_GET_SCREEN_WIDTH_OF_DISPLAY_TEXT);
-		HUD.set_function("END_TEXT_COMMAND_GET_SCREEN_WIDTH_OF_DISPLAY_TEXT", LUA_NATIVE_HUD_END_TEXT_COMMAND_GET_SCREEN_WIDTH_OF_DISPLAY_TEXT);
-		HUD.set_function("BEGIN_TEXT_COMMAND_GET_NUMBER_OF_LINES_FOR_STRING", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_GET_NUMBER_OF_LINES_FOR_STRING);
-		HUD.set_function("END_TEXT_COMMAND_GET_NUMBER_OF_LINES_FOR_STRING", LUA_NATIVE_HUD_END_TEXT_COMMAND_GET_NUMBER_OF_LINES_FOR_STRING);
-		HUD.set_function("BEGIN_TEXT_COMMAND_DISPLAY_HELP", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_DISPLAY_HELP);
-		HUD.set_function("END_TEXT_COMMAND_DISPLAY_HELP", LUA_NATIVE_HUD_END_TEXT_COMMAND_DISPLAY_HELP);
-		HUD.set_function("BEGIN_TEXT_COMMAND_IS_THIS_HELP_MESSAGE_BEING_DISPLAYED", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_IS_THIS_HELP_MESSAGE_BEING_DISPLAYED);
-		HUD.set_function("END_TEXT_COMMAND_IS_THIS_HELP_MESSAGE_BEING_DISPLAYED", LUA_NATIVE_HUD_END_TEXT_COMMAND_IS_THIS_HELP_MESSAGE_BEING_DISPLAYED);
-		HUD.set_function("BEGIN_TEXT_COMMAND_SET_BLIP_NAME", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_SET_BLIP_NAME);
-		HUD.set_function("END_TEXT_COMMAND_SET_BLIP_NAME", LUA_NATIVE_HUD_END_TEXT_COMMAND_SET_BLIP_NAME);
-		HUD.set_function("BEGIN_TEXT_COMMAND_ADD_DIRECTLY_TO_PREVIOUS_BRIEFS", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_ADD_DIRECTLY_TO_PREVIOUS_BRIEFS);
-		HUD.set_function("END_TEXT_COMMAND_ADD_DIRECTLY_TO_PREVIOUS_BRIEFS", LUA_NATIVE_HUD_END_TEXT_COMMAND_ADD_DIRECTLY_TO_PREVIOUS_BRIEFS);
-		HUD.set_function("BEGIN_TEXT_COMMAND_CLEAR_PRINT", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_CLEAR_PRINT);
-		HUD.set_function("END_TEXT_COMMAND_CLEAR_PRINT", LUA_NATIVE_HUD_END_TEXT_COMMAND_CLEAR_PRINT);
-		HUD.set_function("BEGIN_TEXT_COMMAND_OVERRIDE_BUTTON_TEXT", LUA_NATIVE_HUD_BEGIN_TEXT_COMMAND_OVERRIDE_BUTTON_TEXT);
-		HUD.set_function("END_TEXT_COMMAND_OVERRIDE_BUTTON_TEXT", LUA_NATIVE_HUD_END_TEXT_COMMAND_OVERRIDE_BUTTON_TEXT);
-		HUD.set_function("ADD_TEXT_COMPONENT_INTEGER", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_INTEGER);
-		HUD.set_function("ADD_TEXT_COMPONENT_FLOAT", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_FLOAT);
-		HUD.set_function("ADD_TEXT_COMPONENT_SUBSTRING_TEXT_LABEL", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_TEXT_LABEL);
-		HUD.set_function("ADD_TEXT_COMPONENT_SUBSTRING_TEXT_LABEL_HASH_KEY", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_TEXT_LABEL_HASH_KEY);
-		HUD.set_function("ADD_TEXT_COMPONENT_SUBSTRING_BLIP_NAME", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_BLIP_NAME);
-		HUD.set_function("ADD_TEXT_COMPONENT_SUBSTRING_PLAYER_NAME", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_PLAYER_NAME);
-		HUD.set_function("ADD_TEXT_COMPONENT_SUBSTRING_TIME", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_TIME);
-		HUD.set_function("ADD_TEXT_COMPONENT_FORMATTED_INTEGER", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_FORMATTED_INTEGER);
-		HUD.set_function("ADD_TEXT_COMPONENT_SUBSTRING_PHONE_NUMBER", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_PHONE_NUMBER);
-		HUD.set_function("ADD_TEXT_COMPONENT_SUBSTRING_WEBSITE", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_WEBSITE);
-		HUD.set_function("ADD_TEXT_COMPONENT_SUBSTRING_KEYBOARD_DISPLAY", LUA_NATIVE_HUD_ADD_TEXT_COMPONENT_SUBSTRING_KEYBOARD_DISPLAY);
-		HUD.set_function("SET_COLOUR_OF_NEXT_TEXT_COMPONENT", LUA_NATIVE_HUD_SET_COLOUR_OF_NEXT_TEXT_COMPONENT);
-		HUD.set_function("GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME", LUA_NATIVE_HUD_GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME);
-		HUD.set_function("GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME_WITH_BYTE_LIMIT", LUA_NATIVE_HUD_GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME_WITH_BYTE_LIMIT);
-		HUD.set_function("GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME_BYTES", LUA_NATIVE_HUD_GET_CHARACTER_FROM_AUDIO_CONVERSATION_FILENAME_BYTES);
-		HUD.set_function("GET_FILENAME_FOR_AUDIO_CONVERSATION", LUA_NATIVE_HUD_GET_FILENAME_FOR_AUDIO_CONVERSATION);
-		HUD.set_function("CLEAR_PRINTS", LUA_NATIVE_HUD_CLEAR_PRINTS);
-		HUD.set_function("CLEAR_BRIEF", LUA_NATIVE_HUD_CLEAR_BRIEF);
-		HUD.set_function("CLEAR_ALL_HELP_MESSAGES", LUA_NATIVE_HUD_CLEAR_ALL_HELP_MESSAGES);
-		HUD.set_function("CLEAR_THIS_PRINT", LUA_NATIVE_HUD_CLEAR_THIS_PRINT);
-		HUD.set_function("CLEAR_SMALL_PRINTS", LUA_NATIVE_HUD_CLEAR_SMALL_PRINTS);
-		HUD.set_function("DOES_TEXT_BLOCK_EXIST", LUA_NATIVE_HUD_DOES_TEXT_BLOCK_EXIST);
-		HUD.set_function("REQUEST_ADDITIONAL_TEXT", LUA_NATIVE_HUD_REQUEST_ADDITIONAL_TEXT);
-		HUD.set_function("REQUEST_ADDITIONAL_TEXT_FOR_DLC", LUA_NATIVE_HUD_REQUEST_ADDITIONAL_TEXT_FOR_DLC);
-		HUD.set_function("HAS_ADDITIONAL_TEXT_LOADED", LUA_NATIVE_HUD_HAS_ADDITIONAL_TEXT_LOADED);
-		HUD.set_function("CLEAR_ADDITIONAL_TEXT", LUA_NATIVE_HUD_CLEAR_ADDITIONAL_TEXT);
-		HUD.set_function("IS_STREAMING_ADDITIONAL_TEXT", LUA_NATIVE_HUD_IS_STREAMING_ADDITIONAL_TEXT);
-		HUD.set_function("HAS_THIS_ADDITIONAL_TEXT_LOADED", LUA_NATIVE_HUD_HAS_THIS_ADDITIONAL_TEXT_LOADED);
-		HUD.set_function("IS_MESSAGE_BEING_DISPLAYED", LUA_NATIVE_HUD_IS_MESSAGE_BEING_DISPLAYED);
-		HUD.set_function("DOES_TEXT_LABEL_EXIST", LUA_NATIVE_HUD_DOES_TEXT_LABEL_EXIST);
-		HUD.set_function("GET_FIRST_N_CHARACTERS_OF_LITERAL_STRING", LUA_NATIVE_HUD_GET_FIRST_N_CHARACTERS_OF_LITERAL_STRING);
-		HUD.set_function("GET_LENGTH_OF_STRING_WITH_THIS_TEXT_LABEL", LUA_NATIVE_HUD_GET_LENGTH_OF_STRING_WITH_THIS_TEXT_LABEL);
-		HUD.set_function("GET_LENGTH_OF_LITERAL_STRING", LUA_NATIVE_HUD_GET_LENGTH_OF_LITERAL_STRING);
-		HUD.set_function("GET_LENGTH_OF_LITERAL_STRING_IN_BYTES", LUA_NATIVE_HUD_GET_LENGTH_OF_LITERAL_STRING_IN_BYTES);
-		HUD.set_function("GET_STREET_NAME_FROM_HASH_KEY", LUA_NATIVE_HUD_GET_STREET_NAME_FROM_HASH_KEY);
-		HUD.set_function("IS_HUD_PREFERENCE_SWITCHED_ON", LUA_NATIVE_HUD_IS_HUD_PREFERENCE_SWITCHED_ON);
-		HUD.set_function("IS_RADAR_PREFERENCE_SWITCHED_ON", LUA_NATIVE_HUD_IS_RADAR_PREFERENCE_SWITCHED_ON);
-		HUD.set_function("IS_SUBTITLE_PREFERENCE_SWITCHED_ON", LUA_NATIVE_HUD_IS_SUBTITLE_PREFERENCE_SWITCHED_ON);
-		HUD.set_function("DISPLAY_HUD", LUA_NATIVE_HUD_DISPLAY_HUD);
-		HUD.set_function("DISPLAY_HUD_WHEN_NOT_IN_STATE_OF_PLAY_THIS_FRAME", LUA_NATIVE_HUD_DISPLAY_HUD_WHEN_NOT_IN_STATE_OF_PLAY_THIS_FRAME);
-		HUD.set_function("DISPLAY_HUD_WHEN_PAUSED_THIS_FRAME", LUA_NATIVE_HUD_DISPLAY_HUD_WHEN_PAUSED_THIS_FRAME);
-		HUD.set_function("DISPLAY_RADAR", LUA_NATIVE_HUD_DISPLAY_RADAR);
-		HUD.set_function("SET_FAKE_SPECTATOR_MODE", LUA_NATIVE_HUD_SET_FAKE_SPECTATOR_MODE);
-		HUD.set_function("GET_FAKE_SPECTATOR_MODE", LUA_NATIVE_HUD_GET_FAKE_SPECTATOR_MODE);
-		HUD.set_function("IS_HUD_HIDDEN", LUA_NATIVE_HUD_IS_HUD_HIDDEN);
-		HUD.set_function("IS_RADAR_HIDDEN", LUA_NATIVE_HUD_IS_RADAR_HIDDEN);
-		HUD.set_function("IS_MINIMAP_RENDERING", LUA_NATIVE_HUD_IS_MINIMAP_RENDERING);
-		HUD.set_function("USE_VEHICLE_TARGETING_RETICULE", LUA_NATIVE_HUD_USE_VEHICLE_TARGETING_RETICULE);
-		HUD.set_function("USE_VEHICLE_TARGETING_RETICULE_ON_VEHICLES_", LUA_NATIVE_HUD_USE_VEHICLE_TARGETING_RETICULE_ON_VEHICLES_);
-		HUD.set_function("ADD_VALID_VEHICLE_HIT_HASH", LUA_NATIVE_HUD_ADD_VALID_VEHICLE_HIT_HASH);
-		HUD.set_function("CLEAR_VALID_VEHICLE_HIT_HASHES", LUA_NATIVE_HUD_CLEAR_VALID_VEHICLE_HIT_HASHES);
-		HUD.set_function("SET_BLIP_ROUTE", LUA_NATIVE_HUD_SET_BLIP_ROUTE);
-		HUD.set_function("CLEAR_ALL_BLIP_ROUTES", LUA_NATIVE_HUD_CLEAR_ALL_BLIP_ROUTES);
-		HUD.set_function("SET_BLIP_ROUTE_COLOUR", LUA_NATIVE_HUD_SET_BLIP_ROUTE_COLOUR);
-		HUD.set_function("SET_FORCE_SHOW_GPS", LUA_NATIVE_HUD_SET_FORCE_SHOW_GPS);
-		HUD.set_function("SET_USE_SET_DESTINATION_IN_PAUSE_MAP", LUA_NATIVE_HUD_SET_USE_SET_DESTINATION_IN_PAUSE_MAP);
-		HUD.set_function("SET_BLOCK_WANTED_FLASH", LUA_NATIVE_HUD_SET_BLOCK_WANTED_FLASH);
-		HUD.set_function("ADD_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS", LUA_NATIVE_HUD_ADD_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS);
-		HUD.set_function("FORCE_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS_LIST", LUA_NATIVE_HUD_FORCE_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS_LIST);
-		HUD.set_function("SET_RADAR_ZOOM_PRECISE", LUA_NATIVE_HUD_SET_RADAR_ZOOM_PRECISE);
-		HUD.set_function("SET_RADAR_ZOOM", LUA_NATIVE_HUD_SET_RADAR_ZOOM);
-		HUD.set_function("SET_RADAR_ZOOM_TO_BLIP", LUA_NATIVE_HUD_SET_RADAR_ZOOM_TO_BLIP);
-		HUD.set_function("SET_RADAR_ZOOM_TO_DISTANCE", LUA_NATIVE_HUD_SET_RADAR_ZOOM_TO_DISTANCE);
-		HUD.set_function("UPDATE_RADAR_ZOOM_TO_BLIP", LUA_NATIVE_HUD_UPDATE_RADAR_ZOOM_TO_BLIP);
-		HUD.set_function("GET_HUD_COLOUR", LUA_NATIVE_HUD_GET_HUD_COLOUR);
-		HUD.set_function("SET_SCRIPT_VARIABLE_HUD_COLOUR", LUA_NATIVE_HUD_SET_SCRIPT_VARIABLE_HUD_COLOUR);
-		HUD.set_function("SET_SECOND_SCRIPT_VARIABLE_HUD_COLOUR", LUA_NATIVE_HUD_SET_SECOND_SCRIPT_VARIABLE_HUD_COLOUR);
-		HUD.set_function("REPLACE_HUD_COLOUR", LUA_NATIVE_HUD_REPLACE_HUD_COLOUR);
-		HUD.set_function("REPLACE_HUD_COLOUR_WITH_RGBA", LUA_NATIVE_HUD_REPLACE_HUD_COLOUR_WITH_RGBA);
-		HUD.set_function("SET_ABILITY_BAR_VISIBILITY", LUA_NATIVE_HUD_SET_ABILITY_BAR_VISIBILITY);
-		HUD.set_function("SET_ALLOW_ABILITY_BAR", LUA_NATIVE_HUD_SET_ALLOW_ABILITY_BAR);
-		HUD.set_function("FLASH_ABILITY_BAR", LUA_NATIVE_HUD_FLASH_ABILITY_BAR);
-		HUD.set_function("SET_ABILITY_BAR_VALUE", LUA_NATIVE_HUD_SET_ABILITY_BAR_VALUE);
-		HUD.set_function("FLASH_WANTED_DISPLAY", LUA_NATIVE_HUD_FLASH_WANTED_DISPLAY);
-		HUD.set_function("FORCE_OFF_WANTED_STAR_FLASH", LUA_NATIVE_HUD_FORCE_OFF_WANTED_STAR_FLASH);
-		HUD.set_function("SET_CUSTOM_MP_HUD_COLOR", LUA_NATIVE_HUD_SET_CUSTOM_MP_HUD_COLOR);
-		HUD.set_function("GET_RENDERED_CHARACTER_HEIGHT", LUA_NATIVE_HUD_GET_RENDERED_CHARACTER_HEIGHT);
-		HUD.set_function("SET_TEXT_SCALE", LUA_NATIVE_HUD_SET_TEXT_SCALE);
-		HUD.set_function("SET_TEXT_COLOUR", LUA_NATIVE_HUD_SET_TEXT_COLOUR);
-		HUD.set_function("SET_TEXT_CENTRE", LUA_NATIVE_HUD_SET_TEXT_CENTRE);
-		HUD.set_function("SET_TEXT_RIGHT_JUSTIFY", LUA_NATIVE_HUD_SET_TEXT_RIGHT_JUSTIFY);
-		HUD.set_function("SET_TEXT_JUSTIFICATION", LUA_NATIVE_HUD_SET_TEXT_JUSTIFICATION);
-		HUD.set_function("SET_TEXT_LINE_HEIGHT_MULT", LUA_NATIVE_HUD_SET_TEXT_LINE_HEIGHT_MULT);
-		HUD.set_function("SET_TEXT_WRAP", LUA_NATIVE_HUD_SET_TEXT_WRAP);
-		HUD.set_function("SET_TEXT_LEADING", LUA_NATIVE_HUD_SET_TEXT_LEADING);
-		HUD.set_function("SET_TEXT_PROPORTIONAL", LUA_NATIVE_HUD_SET_TEXT_PROPORTIONAL);
-		HUD.set_function("SET_TEXT_FONT", LUA_NATIVE_HUD_SET_TEXT_FONT);
-		HUD.set_function("SET_TEXT_DROP_SHADOW", LUA_NATIVE_HUD_SET_TEXT_DROP_SHADOW);
-		HUD.set_function("SET_TEXT_DROPSHADOW", LUA_NATIVE_HUD_SET_TEXT_DROPSHADOW);
-		HUD.set_function("SET_TEXT_OUTLINE", LUA_NATIVE_HUD_SET_TEXT_OUTLINE);
-		HUD.set_function("SET_TEXT_EDGE", LUA_NATIVE_HUD_SET_TEXT_EDGE);
-		HUD.set_function("SET_TEXT_RENDER_ID", LUA_NATIVE_HUD_SET_TEXT_RENDER_ID);
-		HUD.set_function("GET_DEFAULT_SCRIPT_RENDERTARGET_RENDER_ID", LUA_NATIVE_HUD_GET_DEFAULT_SCRIPT_RENDERTARGET_RENDER_ID);
-		HUD.set_function("REGISTER_NAMED_RENDERTARGET", LUA_NATIVE_HUD_REGISTER_NAMED_RENDERTARGET);
-		HUD.set_function("IS_NAMED_RENDERTARGET_REGISTERED", LUA_NATIVE_HUD_IS_NAMED_RENDERTARGET_REGISTERED);
-		HUD.set_function("RELEASE_NAMED_RENDERTARGET", LUA_NATIVE_HUD_RELEASE_NAMED_RENDERTARGET);
-		HUD.set_function("LINK_NAMED_RENDERTARGET", LUA_NATIVE_HUD_LINK_NAMED_RENDERTARGET);
-		HUD.set_function("GET_NAMED_RENDERTARGET_RENDER_ID", LUA_NATIVE_HUD_GET_NAMED_RENDERTARGET_RENDER_ID);
-		HUD.set_function("IS_NAMED_RENDERTARGET_LINKED", LUA_NATIVE_HUD_IS_NAMED_RENDERTARGET_LINKED);
-		HUD.set_function("CLEAR_HELP", LUA_NATIVE_HUD_CLEAR_HELP);
-		HUD.set_function("IS_HELP_MESSAGE_ON_SCREEN", LUA_NATIVE_HUD_IS_HELP_MESSAGE_ON_SCREEN);
-		HUD.set_function("HAS_SCRIPT_HIDDEN_HELP_THIS_FRAME", LUA_NATIVE_HUD_HAS_SCRIPT_HIDDEN_HELP_THIS_FRAME);
-		HUD.set_function("IS_HELP_MESSAGE_BEING_DISPLAYED", LUA_NATIVE_HUD_IS_HELP_MESSAGE_BEING_DISPLAYED);
-		HUD.set_function("IS_HELP_MESSAGE_FADING_OUT", LUA_NATIVE_HUD_IS_HELP_MESSAGE_FADING_OUT);
-		HUD.set_function("SET_HELP_MESSAGE_STYLE", LUA_NATIVE_HUD_SET_HELP_MESSAGE_STYLE);
-		HUD.set_function("GET_STANDARD_BLIP_ENUM_ID", LUA_NATIVE_HUD_GET_STANDARD_BLIP_ENUM_ID);
-		HUD.set_function("GET_WAYPOINT_BLIP_ENUM_ID", LUA_NATIVE_HUD_GET_WAYPOINT_BLIP_ENUM_ID);
-		HUD.set_function("GET_NUMBER_OF_ACTIVE_BLIPS", LUA_NATIVE_HUD_GET_NUMBER_OF_ACTIVE_BLIPS);
-		HUD.set_function("GET_NEXT_BLIP_INFO_ID", LUA_NATIVE_HUD_GET_NEXT_BLIP_INFO_ID);
-		HUD.set_function("GET_FIRST_BLIP_INFO_ID", LUA_NATIVE_HUD_GET_FIRST_BLIP_INFO_ID);
-		HUD.set_function("GET_CLOSEST_BLIP_INFO_ID", LUA_NATIVE_HUD_GET_CLOSEST_BLIP_INFO_ID);
-		HUD.set_function("GET_BLIP_INFO_ID_COORD", LUA_NATIVE_HUD_GET_BLIP_INFO_ID_COORD);
-		HUD.set_function("GET_BLIP_INFO_ID_DISPLAY", LUA_NATIVE_HUD_GET_BLIP_INFO_ID_DISPLAY);
-		HUD.set_function("GET_BLIP_INFO_ID_TYPE", LUA_NATIVE_HUD_GET_BLIP_INFO_ID_TYPE);
-		HUD.set_function("GET_BLIP_INFO_ID_ENTITY_INDEX", LUA_NATIVE_HUD_GET_BLIP_INFO_ID_ENTITY_INDEX);
-		HUD.set_function("GET_BLIP_INFO_ID_PICKUP_INDEX", LUA_NATIVE_HUD_GET_BLIP_INFO_ID_PICKUP_INDEX);
-		HUD.set_function("GET_BLIP_FROM_ENTITY", LUA_NATIVE_HUD_GET_BLIP_FROM_ENTITY);
-		HUD.set_function("ADD_BLIP_FOR_RADIUS", LUA_NATIVE_HUD_ADD_BLIP_FOR_RADIUS);
-		HUD.set_function("ADD_BLIP_FOR_AREA", LUA_NATIVE_HUD_ADD_BLIP_FOR_AREA);
-		HUD.set_function("ADD_BLIP_FOR_ENTITY", LUA_NATIVE_HUD_ADD_BLIP_FOR_ENTITY);
-		HUD.set_function("ADD_BLIP_FOR_PICKUP", LUA_NATIVE_HUD_ADD_BLIP_FOR_PICKUP);
-		HUD.set_function("ADD_BLIP_FOR_COORD", LUA_NATIVE_HUD_ADD_BLIP_FOR_COORD);
-		HUD.set_function("TRIGGER_SONAR_BLIP", LUA_NATIVE_HUD_TRIGGER_SONAR_BLIP);
-		HUD.set_function("ALLOW_SONAR_BLIPS", LUA_NATIVE_HUD_ALLOW_SONAR_BLIPS);
-		HUD.set_function("SET_BLIP_COORDS", LUA_NATIVE_HUD_SET_BLIP_COORDS);
-		HUD.set_function("GET_BLIP_COORDS", LUA_NATIVE_HUD_GET_BLIP_COORDS);
-		HUD.set_function("SET_BLIP_SPRITE", LUA_NATIVE_HUD_SET_BLIP_SPRITE);
-		HUD.set_function("GET_BLIP_SPRITE", LUA_NATIVE_HUD_GET_BLIP_SPRITE);
-		HUD.set_function("SET_COP_BLIP_SPRITE", LUA_NATIVE_HUD_SET_COP_BLIP_SPRITE);
-		HUD.set_function("SET_COP_BLIP_SPRITE_AS_STANDARD", LUA_NATIVE_HUD_SET_COP_BLIP_SPRITE_AS_STANDARD);
-		HUD.set_function("SET_BLIP_NAME_FROM_TEXT_FILE", LUA_NATIVE_HUD_SET_BLIP_NAME_FROM_TEXT_FILE);
-		HUD.set_function("SET_BLIP_NAME_TO_PLAYER_NAME", LUA_NATIVE_HUD_SET_BLIP_NAME_TO_PLAYER_NAME);
-		HUD.set_function("SET_BLIP_ALPHA", LUA_NATIVE_HUD_SET_BLIP_ALPHA);
-		HUD.set_function("GET_BLIP_ALPHA", LUA_NATIVE_HUD_GET_BLIP_ALPHA);
-		HUD.set_function("SET_BLIP_FADE", LUA_NATIVE_HUD_SET_BLIP_FADE);
-		HUD.set_function("GET_BLIP_FADE_DIRECTION", LUA_NATIVE_HUD_GET_BLIP_FADE_DIRECTION);
-		HUD.set_function("SET_BLIP_ROTATION", LUA_NATIVE_HUD_SET_BLIP_ROTATION);
-		HUD.set_function("SET_BLIP_ROTATION_WITH_FLOAT", LUA_NATIVE_HUD_SET_BLIP_ROTATION_WITH_FLOAT);
-		HUD.set_function("GET_BLIP_ROTATION", LUA_NATIVE_HUD_GET_BLIP_ROTATION);
-		HUD.set_function("SET_BLIP_FLASH_TIMER", LUA_NATIVE_HUD_SET_BLIP_FLASH_TIMER);
-		HUD.set_function("SET_BLIP_FLASH_INTERVAL", LUA_NATIVE_HUD_SET_BLIP_FLASH_INTERVAL);
-		HUD.set_function("SET_BLIP_COLOUR", LUA_NATIVE_HUD_SET_BLIP_COLOUR);
-		HUD.set_function("SET_BLIP_SECONDARY_COLOUR", LUA_NATIVE_HUD_SET_BLIP_SECONDARY_COLOUR);
-		HUD.set_function("GET_BLIP_COLOUR", LUA_NATIVE_HUD_GET_BLIP_COLOUR);
-		HUD.set_function("GET_BLIP_HUD_COLOUR", LUA_NATIVE_HUD_GET_BLIP_HUD_COLOUR);
-		HUD.set_function("IS_BLIP_SHORT_RANGE", LUA_NATIVE_HUD_IS_BLIP_SHORT_RANGE);
-		HUD.set_function("IS_BLIP_ON_MINIMAP", LUA_NATIVE_HUD_IS_BLIP_ON_MINIMAP);
-		HUD.set_function("DOES_BLIP_HAVE_GPS_ROUTE", LUA_NATIVE_HUD_DOES_BLIP_HAVE_GPS_ROUTE);
-		HUD.set_function("SET_BLIP_HIDDEN_ON_LEGEND", LUA_NATIVE_HUD_SET_BLIP_HIDDEN_ON_LEGEND);
-		HUD.set_function("SET_BLIP_HIGH_DETAIL", LUA_NATIVE_HUD_SET_BLIP_HIGH_DETAIL);
-		HUD.set_function("SET_BLIP_AS_MISSION_CREATOR_BLIP", LUA_NATIVE_HUD_SET_BLIP_AS_MISSION_CREATOR_BLIP);
-		HUD.set_function("IS_MISSION_CREATOR_BLIP", LUA_NATIVE_HUD_IS_MISSION_CREATOR_BLIP);
-		HUD.set_function("GET_NEW_SELECTED_MISSION_CREATOR_BLIP", LUA_NATIVE_HUD_GET_NEW_SELECTED_MISSION_CREATOR_BLIP);
-		HUD.set_function("IS_HOVERING_OVER_MISSION_CREATOR_BLIP", LUA_NATIVE_HUD_IS_HOVERING_OVER_MISSION_CREATOR_BLIP);
-		HUD.set_function("SHOW_START_MISSION_INSTRUCTIONAL_BUTTON", LUA_NATIVE_HUD_SHOW_START_MISSION_INSTRUCTIONAL_BUTTON);
-		HUD.set_function("SHOW_CONTACT_INSTRUCTIONAL_BUTTON", LUA_NATIVE_HUD_SHOW_CONTACT_INSTRUCTIONAL_BUTTON);
-		HUD.set_function("RELOAD_MAP_MENU", LUA_NATIVE_HUD_RELOAD_MAP_MENU);
-		HUD.set_function("SET_BLIP_MARKER_LONG_DISTANCE", LUA_NATIVE_HUD_SET_BLIP_MARKER_LONG_DISTANCE);
-		HUD.set_function("SET_BLIP_FLASHES", LUA_NATIVE_HUD_SET_BLIP_FLASHES);
-		HUD.set_function("SET_BLIP_FLASHES_ALTERNATE", LUA_NATIVE_HUD_SET_BLIP_FLASHES_ALTERNATE);
-		HUD.set_function("IS_BLIP_FLASHING", LUA_NATIVE_HUD_IS_BLIP_FLASHING);
-		HUD.set_function("SET_BLIP_AS_SHORT_RANGE", LUA_NATIVE_HUD_SET_BLIP_AS_SHORT_RANGE);
-		HUD.set_function("SET_BLIP_SCALE", LUA_NATIVE_HUD_SET_BLIP_SCALE);
-		HUD.set_function("SET_BLIP_SCALE_2D", LUA_NATIVE_HUD_SET_BLIP_SCALE_2D);
-		HUD.set_function("SET_BLIP_PRIORITY", LUA_NATIVE_HUD_SET_BLIP_PRIORITY);
-		HUD.set_function("SET_BLIP_DISPLAY", LUA_NATIVE_HUD_SET_BLIP_DISPLAY);
-		HUD.set_function("SET_BLIP_CATEGORY", LUA_NATIVE_HUD_SET_BLIP_CATEGORY);
-		HUD.set_function("REMOVE_BLIP", LUA_NATIVE_HUD_REMOVE_BLIP);
-		HUD.set_function("SET_BLIP_AS_FRIENDLY", LUA_NATIVE_HUD_SET_BLIP_AS_FRIENDLY);
-		HUD.set_function("PULSE_BLIP", LUA_NATIVE_HUD_PULSE_BLIP);
-		HUD.set_function("SHOW_NUMBER_ON_BLIP", LUA_NATIVE_HUD_SHOW_NUMBER_ON_BLIP);
-		HUD.set_function("HIDE_NUMBER_ON_BLIP", LUA_NATIVE_HUD_HIDE_NUMBER_ON_BLIP);
-		HUD.set_function("SHOW_HEIGHT_ON_BLIP", LUA_NATIVE_HUD_SHOW_HEIGHT_ON_BLIP);
-		HUD.set_function("SHOW_TICK_ON_BLIP", LUA_NATIVE_HUD_SHOW_TICK_ON_BLIP);
-		HUD.set_function("SHOW_GOLD_TICK_ON_BLIP", LUA_NATIVE_HUD_SHOW_GOLD_TICK_ON_BLIP);
-		HUD.set_function("SHOW_FOR_SALE_ICON_ON_BLIP", LUA_NATIVE_HUD_SHOW_FOR_SALE_ICON_ON_BLIP);
-		HUD.set_function("SHOW_HEADING_INDICATOR_ON_BLIP", LUA_NATIVE_HUD_SHOW_HEADING_INDICATOR_ON_BLIP);
-		HUD.set_function("SHOW_OUTLINE_INDICATOR_ON_BLIP", LUA_NATIVE_HUD_SHOW_OUTLINE_INDICATOR_ON_BLIP);
-		HUD.set_function("SHOW_FRIEND_INDICATOR_ON_BLIP", LUA_NATIVE_HUD_SHOW_FRIEND_INDICATOR_ON_BLIP);
-		HUD.set_function("SHOW_CREW_INDICATOR_ON_BLIP", LUA_NATIVE_HUD_SHOW_CREW_INDICATOR_ON_BLIP);
-		HUD.set_function("SET_BLIP_EXTENDED_HEIGHT_THRESHOLD", LUA_NATIVE_HUD_SET_BLIP_EXTENDED_HEIGHT_THRESHOLD);
-		HUD.set_function("SET_BLIP_SHORT_HEIGHT_THRESHOLD", LUA_NATIVE_HUD_SET_BLIP_SHORT_HEIGHT_THRESHOLD);
-		HUD.set_function("SET_BLIP_USE_HEIGHT_INDICATOR_ON_EDGE", LUA_NATIVE_HUD_SET_BLIP_USE_HEIGHT_INDICATOR_ON_EDGE);
-		HUD.set_function("SET_BLIP_AS_MINIMAL_ON_EDGE", LUA_NATIVE_HUD_SET_BLIP_AS_MINIMAL_ON_EDGE);
-		HUD.set_function("SET_RADIUS_BLIP_EDGE", LUA_NATIVE_HUD_SET_RADIUS_BLIP_EDGE);
-		HUD.set_function("DOES_BLIP_EXIST", LUA_NATIVE_HUD_DOES_BLIP_EXIST);
-		HUD.set_function("SET_WAYPOINT_OFF", LUA_NATIVE_HUD_SET_WAYPOINT_OFF);
-		HUD.set_function("DELETE_WAYPOINTS_FROM_THIS_PLAYER", LUA_NATIVE_HUD_DELETE_WAYPOINTS_FROM_THIS_PLAYER);
-		HUD.set_function("REFRESH_WAYPOINT", LUA_NATIVE_HUD_REFRESH_WAYPOINT);
-		HUD.set_function("IS_WAYPOINT_ACTIVE", LUA_NATIVE_HUD_IS_WAYPOINT_ACTIVE);
-		HUD.set_function("SET_NEW_WAYPOINT", LUA_NATIVE_HUD_SET_NEW_WAYPOINT);
-		HUD.set_function("SET_BLIP_BRIGHT", LUA_NATIVE_HUD_SET_BLIP_BRIGHT);
-		HUD.set_function("SET_BLIP_SHOW_CONE", LUA_NATIVE_HUD_SET_BLIP_SHOW_CONE);
-		HUD.set_function("REMOVE_COP_BLIP_FROM_PED", LUA_NATIVE_HUD_REMOVE_COP_BLIP_FROM_PED);
-		HUD.set_function("SETUP_FAKE_CONE_DATA", LUA_NATIVE_HUD_SETUP_FAKE_CONE_DATA);
-		HUD.set_function("REMOVE_FAKE_CONE_DATA", LUA_NATIVE_HUD_REMOVE_FAKE_CONE_DATA);
-		HUD.set_function("CLEAR_FAKE_CONE_ARRAY", LUA_NATIVE_HUD_CLEAR_FAKE_CONE_ARRAY);
-		HUD.set_function("SET_BLIP_GPS_ROUTE_DISPLAY_DISTANCE_", LUA_NATIVE_HUD_SET_BLIP_GPS_ROUTE_DISPLAY_DISTANCE_);
-		HUD.set_function("SET_MINIMAP_COMPONENT", LUA_NATIVE_HUD_SET_MINIMAP_COMPONENT);
-		HUD.set_function("SET_MINIMAP_SONAR_SWEEP", LUA_NATIVE_HUD_SET_MINIMAP_SONAR_SWEEP);
-		HUD.set_function("SHOW_ACCOUNT_PICKER", LUA_NATIVE_HUD_SHOW_ACCOUNT_PICKER);
-		HUD.set_function("GET_MAIN_PLAYER_BLIP_ID", LUA_NATIVE_HUD_GET_MAIN_PLAYER_BLIP_ID);
-		HUD.set_function("SET_PM_WARNINGSCREEN_ACTIVE", LUA_NATIVE_HUD_SET_PM_WARNINGSCREEN_ACTIVE);
-		HUD.set_function("HIDE_LOADING_ON_FADE_THIS_FRAME", LUA_NATIVE_HUD_HIDE_LOADING_ON_FADE_THIS_FRAME);
-		HUD.set_function("SET_RADAR_AS_INTERIOR_THIS_FRAME", LUA_NATIVE_HUD_SET_RADAR_AS_INTERIOR_THIS_FRAME);
-		HUD.set_function("SET_INSIDE_VERY_SMALL_INTERIOR", LUA_NATIVE_HUD_SET_INSIDE_VERY_SMALL_INTERIOR);
-		HUD.set_function("SET_INSIDE_VERY_LARGE_INTERIOR", LUA_NATIVE_HUD_SET_INSIDE_VERY_LARGE_INTERIOR);
-		HUD.set_function("SET_RADAR_AS_EXTERIOR_THIS_FRAME", LUA_NATIVE_HUD_SET_RADAR_AS_EXTERIOR_THIS_FRAME);
-		HUD.set_function("SET_FAKE_PAUSEMAP_PLAYER_POSITION_THIS_FRAME", LUA_NATIVE_HUD_SET_FAKE_PAUSEMAP_PLAYER_POSITION_THIS_FRAME);
-		HUD.set_function("SET_FAKE_GPS_PLAYER_POSITION_THIS_FRAME", LUA_NATIVE_HUD_SET_FAKE_GPS_PLAYER_POSITION_THIS_FRAME);
-		HUD.set_function("IS_PAUSEMAP_IN_INTERIOR_MODE", LUA_NATIVE_HUD_IS_PAUSEMAP_IN_INTERIOR_MODE);
-		HUD.set_function("HIDE_MINIMAP_EXTERIOR_MAP_THIS_FRAME", LUA_NATIVE_HUD_HIDE_MINIMAP_EXTERIOR_MAP_THIS_FRAME);
-		HUD.set_function("HIDE_MINIMAP_INTERIOR_MAP_THIS_FRAME", LUA_NATIVE_HUD_HIDE_MINIMAP_INTERIOR_MAP_THIS_FRAME);
-		HUD.set_function("SET_USE_ISLAND_MAP", LUA_NATIVE_HUD_SET_USE_ISLAND_MAP);
-		HUD.set_function("SET_PAUSE_EXTERIOR_RENDERING_WHILE_IN_INTERIOR_", LUA_NATIVE_HUD_SET_PAUSE_EXTERIOR_RENDERING_WHILE_IN_INTERIOR_);
-		HUD.set_function("DONT_TILT_MINIMAP_THIS_FRAME", LUA_NATIVE_HUD_DONT_TILT_MINIMAP_THIS_FRAME);
-		HUD.set_function("DONT_ZOOM_MINIMAP_WHEN_RUNNING_THIS_FRAME", LUA_NATIVE_HUD_DONT_ZOOM_MINIMAP_WHEN_RUNNING_THIS_FRAME);
-		HUD.set_function("DONT_ZOOM_MINIMAP_WHEN_SNIPING_THIS_FRAME", LUA_NATIVE_HUD_DONT_ZOOM_MINIMAP_WHEN_SNIPING_THIS_FRAME);
-		HUD.set_function("SET_WIDESCREEN_FORMAT", LUA_NATIVE_HUD_SET_WIDESCREEN_FORMAT);
-		HUD.set_function("DISPLAY_AREA_NAME", LUA_NATIVE_HUD_DISPLAY_AREA_NAME);
-		HUD.set_function("DISPLAY_CASH", LUA_NATIVE_HUD_DISPLAY_CASH);
-		HUD.set_function("USE_FAKE_MP_CASH", LUA_NATIVE_HUD_USE_FAKE_MP_CASH);
-		HUD.set_function("CHANGE_FAKE_MP_CASH", LUA_NATIVE_HUD_CHANGE_FAKE_MP_CASH);
-		HUD.set_function("DISPLAY_AMMO_THIS_FRAME", LUA_NATIVE_HUD_DISPLAY_AMMO_THIS_FRAME);
-		HUD.set_function("DISPLAY_SNIPER_SCOPE_THIS_FRAME", LUA_NATIVE_HUD_DISPLAY_SNIPER_SCOPE_THIS_FRAME);
-		HUD.set_function("HIDE_HUD_AND_RADAR_THIS_FRAME", LUA_NATIVE_HUD_HIDE_HUD_AND_RADAR_THIS_FRAME);
-		HUD.set_function("ALLOW_DISPLAY_OF_MULTIPLAYER_CASH_TEXT", LUA_NATIVE_HUD_ALLOW_DISPLAY_OF_MULTIPLAYER_CASH_TEXT);
-		HUD.set_function("SET_MULTIPLAYER_WALLET_CASH", LUA_NATIVE_HUD_SET_MULTIPLAYER_WALLET_CASH);
-		HUD.set_function("REMOVE_MULTIPLAYER_WALLET_CASH", LUA_NATIVE_HUD_REMOVE_MULTIPLAYER_WALLET_CASH);
-		HUD.set_function("SET_MULTIPLAYER_BANK_CASH", LUA_NATIVE_HUD_SET_MULTIPLAYER_BANK_CASH);
-		HUD.set_function("REMOVE_MULTIPLAYER_BANK_CASH", LUA_NATIVE_HUD_REMOVE_MULTIPLAYER_BANK_CASH);
-		HUD.set_function("SET_MULTIPLAYER_HUD_CASH", LUA_NATIVE_HUD_SET_MULTIPLAYER_HUD_CASH);
-		HUD.set_function("REMOVE_MULTIPLAYER_HUD_CASH", LUA_NATIVE_HUD_REMOVE_MULTIPLAYER_HUD_CASH);
-		HUD.set_function("HIDE_HELP_TEXT_THIS_FRAME", LUA_NATIVE_HUD_HIDE_HELP_TEXT_THIS_FRAME);
-		HUD.set_function("IS_IME_IN_PROGRESS", LUA_NATIVE_HUD_IS_IME_IN_PROGRESS);
-		HUD.set_function("DISPLAY_HELP_TEXT_THIS_FRAME", LUA_NATIVE_HUD_DISPLAY_HELP_TEXT_THIS_FRAME);
-		HUD.set_function("HUD_FORCE_WEAPON_WHEEL", LUA_NATIVE_HUD_HUD_FORCE_WEAPON_WHEEL);
-		HUD.set_function("HUD_FORCE_SPECIAL_VEHICLE_WEAPON_WHEEL", LUA_NATIVE_HUD_HUD_FORCE_SPECIAL_VEHICLE_WEAPON_WHEEL);
-		HUD.set_function("HUD_SUPPRESS_WEAPON_WHEEL_RESULTS_THIS_FRAME", LUA_NATIVE_HUD_HUD_SUPPRESS_WEAPON_WHEEL_RESULTS_THIS_FRAME);
-		HUD.set_function("HUD_GET_WEAPON_WHEEL_CURRENTLY_HIGHLIGHTED", LUA_NATIVE_HUD_HUD_GET_WEAPON_WHEEL_CURRENTLY_HIGHLIGHTED);
-		HUD.set_function("HUD_SET_WEAPON_WHEEL_TOP_SLOT", LUA_NATIVE_HUD_HUD_SET_WEAPON_WHEEL_TOP_SLOT);
-		HUD.set_function("HUD_GET_WEAPON_WHEEL_TOP_SLOT", LUA_NATIVE_HUD_HUD_GET_WEAPON_WHEEL_TOP_SLOT);
-		HUD.set_function("HUD_SHOWING_CHARACTER_SWITCH_SELECTION", LUA_NATIVE_HUD_HUD_SHOWING_CHARACTER_SWITCH_SELECTION);
-		HUD.set_function("SET_GPS_FLAGS", LUA_NATIVE_HUD_SET_GPS_FLAGS);
-		HUD.set_function("CLEAR_GPS_FLAGS", LUA_NATIVE_HUD_CLEAR_GPS_FLAGS);
-		HUD.set_function("SET_RACE_TRACK_RENDER", LUA_NATIVE_HUD_SET_RACE_TRACK_RENDER);
-		HUD.set_function("CLEAR_GPS_RACE_TRACK", LUA_NATIVE_HUD_CLEAR_GPS_RACE_TRACK);
-		HUD.set_function("START_GPS_CUSTOM_ROUTE", LUA_NATIVE_HUD_START_GPS_CUSTOM_ROUTE);
-		HUD.set_function("ADD_POINT_TO_GPS_CUSTOM_ROUTE", LUA_NATIVE_HUD_ADD_POINT_TO_GPS_CUSTOM_ROUTE);
-		HUD.set_function("SET_GPS_CUSTOM_ROUTE_RENDER", LUA_NATIVE_HUD_SET_GPS_CUSTOM_ROUTE_RENDER);
-		HUD.set_function("CLEAR_GPS_CUSTOM_ROUTE", LUA_NATIVE_HUD_CLEAR_GPS_CUSTOM_ROUTE);
-		HUD.set_function("START_GPS_MULTI_ROUTE", LUA_NATIVE_HUD_START_GPS_MULTI_ROUTE);
-		HUD.set_function("ADD_POINT_TO_GPS_MULTI_ROUTE", LUA_NATIVE_HUD_ADD_POINT_TO_GPS_MULTI_ROUTE);
-		HUD.set_function("SET_GPS_MULTI_ROUTE_RENDER", LUA_NATIVE_HUD_SET_GPS_MULTI_ROUTE_RENDER);
-		HUD.set_function("CLEAR_GPS_MULTI_ROUTE", LUA_NATIVE_HUD_CLEAR_GPS_MULTI_ROUTE);
-		HUD.set_function("CLEAR_GPS_PLAYER_WAYPOINT", LUA_NATIVE_HUD_CLEAR_GPS_PLAYER_WAYPOINT);
-		HUD.set_function("SET_GPS_FLASHES", LUA_NATIVE_HUD_SET_GPS_FLASHES);
-		HUD.set_function("SET_PLAYER_ICON_COLOUR", LUA_NATIVE_HUD_SET_PLAYER_ICON_COLOUR);
-		HUD.set_function("FLASH_MINIMAP_DISPLAY", LUA_NATIVE_HUD_FLASH_MINIMAP_DISPLAY);
-		HUD.set_function("FLASH_MINIMAP_DISPLAY_WITH_COLOR", LUA_NATIVE_HUD_FLASH_MINIMAP_DISPLAY_WITH_COLOR);
-		HUD.set_function("TOGGLE_STEALTH_RADAR", LUA_NATIVE_HUD_TOGGLE_STEALTH_RADAR);
-		HUD.set_function("SET_MINIMAP_IN_SPECTATOR_MODE", LUA_NATIVE_HUD_SET_MINIMAP_IN_SPECTATOR_MODE);
-		HUD.set_function("SET_MISSION_NAME", LUA_NATIVE_HUD_SET_MISSION_NAME);
-		HUD.set_function("SET_MISSION_NAME_FOR_UGC_MISSION", LUA_NATIVE_HUD_SET_MISSION_NAME_FOR_UGC_MISSION);
-		HUD.set_function("SET_DESCRIPTION_FOR_UGC_MISSION_EIGHT_STRINGS", LUA_NATIVE_HUD_SET_DESCRIPTION_FOR_UGC_MISSION_EIGHT_STRINGS);
-		HUD.set_function("SET_MINIMAP_BLOCK_WAYPOINT", LUA_NATIVE_HUD_SET_MINIMAP_BLOCK_WAYPOINT);
-		HUD.set_function("SET_MINIMAP_IN_PROLOGUE", LUA_NATIVE_HUD_SET_MINIMAP_IN_PROLOGUE);
-		HUD.set_function("SET_MINIMAP_HIDE_FOW", LUA_NATIVE_HUD_SET_MINIMAP_HIDE_FOW);
-		HUD.set_function("GET_MINIMAP_FOW_DISCOVERY_RATIO", LUA_NATIVE_HUD_GET_MINIMAP_FOW_DISCOVERY_RATIO);
-		HUD.set_function("GET_MINIMAP_FOW_COORDINATE_IS_REVEALED", LUA_NATIVE_HUD_GET_MINIMAP_FOW_COORDINATE_IS_REVEALED);
-		HUD.set_function("SET_MINIMAP_FOW_DO_NOT_UPDATE", LUA_NATIVE_HUD_SET_MINIMAP_FOW_DO_NOT_UPDATE);
-		HUD.set_function("SET_MINIMAP_FOW_REVEAL_COORDINATE", LUA_NATIVE_HUD_SET_MINIMAP_FOW_REVEAL_COORDINATE);
-		HUD.set_function("SET_MINIMAP_GOLF_COURSE", LUA_NATIVE_HUD_SET_MINIMAP_GOLF_COURSE);
-		HUD.set_function("SET_MINIMAP_GOLF_COURSE_OFF", LUA_NATIVE_HUD_SET_MINIMAP_GOLF_COURSE_OFF);
-		HUD.set_function("LOCK_MINIMAP_ANGLE", LUA_NATIVE_HUD_LOCK_MINIMAP_ANGLE);
-		HUD.set_function("UNLOCK_MINIMAP_ANGLE", LUA_NATIVE_HUD_UNLOCK_MINIMAP_ANGLE);
-		HUD.set_function("LOCK_MINIMAP_POSITION", LUA_NATIVE_HUD_LOCK_MINIMAP_POSITION);
-		HUD.set_function("UNLOCK_MINIMAP_POSITION", LUA_NATIVE_HUD_UNLOCK_MINIMAP_POSITION);
-		HUD.set_function("SET_FAKE_MINIMAP_MAX_ALTIMETER_HEIGHT", LUA_NATIVE_HUD_SET_FAKE_MINIMAP_MAX_ALTIMETER_HEIGHT);
-		HUD.set_function("SET_HEALTH_HUD_DISPLAY_VALUES", LUA_NATIVE_HUD_SET_HEALTH_HUD_DISPLAY_VALUES);
-		HUD.set_function("SET_MAX_HEALTH_HUD_DISPLAY", LUA_NATIVE_HUD_SET_MAX_HEALTH_HUD_DISPLAY);
-		HUD.set_function("SET_MAX_ARMOUR_HUD_DISPLAY", LUA_NATIVE_HUD_SET_MAX_ARMOUR_HUD_DISPLAY);
-		HUD.set_function("SET_BIGMAP_ACTIVE", LUA_NATIVE_HUD_SET_BIGMAP_ACTIVE);
-		HUD.set_function("IS_HUD_COMPONENT_ACTIVE", LUA_NATIVE_HUD_IS_HUD_COMPONENT_ACTIVE);
-		HUD.set_function("IS_SCRIPTED_HUD_COMPONENT_ACTIVE", LUA_NATIVE_HUD_IS_SCRIPTED_HUD_COMPONENT_ACTIVE);
-		HUD.set_function("HIDE_SCRIPTED_HUD_COMPONENT_THIS_FRAME", LUA_NATIVE_HUD_HIDE_SCRIPTED_HUD_COMPONENT_THIS_FRAME);
-		HUD.set_function("SHOW_SCRIPTED_HUD_COMPONENT_THIS_FRAME", LUA_NATIVE_HUD_SHOW_SCRIPTED_HUD_COMPONENT_THIS_FRAME);
-		HUD.set_function("IS_SCRIPTED_HUD_COMPONENT_HIDDEN_THIS_FRAME", LUA_NATIVE_HUD_IS_SCRIPTED_HUD_COMPONENT_HIDDEN_THIS_FRAME);
-		HUD.set_function("HIDE_HUD_COMPONENT_THIS_FRAME", LUA_NATIVE_HUD_HIDE_HUD_COMPONENT_THIS_FRAME);
-		HUD.set_function("SHOW_HUD_COMPONENT_THIS_FRAME", LUA_NATIVE_HUD_SHOW_HUD_COMPONENT_THIS_FRAME);
-		HUD.set_function("HIDE_STREET_AND_CAR_NAMES_THIS_FRAME", LUA_NATIVE_HUD_HIDE_STREET_AND_CAR_NAMES_THIS_FRAME);
-		HUD.set_function("RESET_RETICULE_VALUES", LUA_NATIVE_HUD_RESET_RETICULE_VALUES);
-		HUD.set_function("RESET_HUD_COMPONENT_VALUES", LUA_NATIVE_HUD_RESET_HUD_COMPONENT_VALUES);
-		HUD.set_function("SET_HUD_COMPONENT_POSITION", LUA_NATIVE_HUD_SET_HUD_COMPONENT_POSITION);
-		HUD.set_function("GET_HUD_COMPONENT_POSITION", LUA_NATIVE_HUD_GET_HUD_COMPONENT_POSITION);
-		HUD.set_function("CLEAR_REMINDER_MESSAGE", LUA_NATIVE_HUD_CLEAR_REMINDER_MESSAGE);
-		HUD.set_function("GET_HUD_SCREEN_POSITION_FROM_WORLD_POSITION", LUA_NATIVE_HUD_GET_HUD_SCREEN_POSITION_FROM_WORLD_POSITION);
-		HUD.set_function("OPEN_REPORTUGC_MENU", LUA_NATIVE_HUD_OPEN_REPORTUGC_MENU);
-		HUD.set_function("FORCE_CLOSE_REPORTUGC_MENU", LUA_NATIVE_HUD_FORCE_CLOSE_REPORTUGC_MENU);
-		HUD.set_function("IS_REPORTUGC_MENU_OPEN", LUA_NATIVE_HUD_IS_REPORTUGC_MENU_OPEN);
-		HUD.set_function("IS_FLOATING_HELP_TEXT_ON_SCREEN", LUA_NATIVE_HUD_IS_FLOATING_HELP_TEXT_ON_SCREEN);
-		HUD.set_function("SET_FLOATING_HELP_TEXT_SCREEN_POSITION", LUA_NATIVE_HUD_SET_FLOATING_HELP_TEXT_SCREEN_POSITION);
-		HUD.set_function("SET_FLOATING_HELP_TEXT_WORLD_POSITION", LUA_NATIVE_HUD_SET_FLOATING_HELP_TEXT_WORLD_POSITION);
-		HUD.set_function("SET_FLOATING_HELP_TEXT_TO_ENTITY", LUA_NATIVE_HUD_SET_FLOATING_HELP_TEXT_TO_ENTITY);
-		HUD.set_function("SET_FLOATING_HELP_TEXT_STYLE", LUA_NATIVE_HUD_SET_FLOATING_HELP_TEXT_STYLE);
-		HUD.set_function("CLEAR_FLOATING_HELP", LUA_NATIVE_HUD_CLEAR_FLOATING_HELP);
-		HUD.set_function("CREATE_MP_GAMER_TAG_WITH_CREW_COLOR", LUA_NATIVE_HUD_CREATE_MP_GAMER_TAG_WITH_CREW_COLOR);
-		HUD.set_function("IS_MP_GAMER_TAG_MOVIE_ACTIVE", LUA_NATIVE_HUD_IS_MP_GAMER_TAG_MOVIE_ACTIVE);
-		HUD.set_function("CREATE_FAKE_MP_GAMER_TAG", LUA_NATIVE_HUD_CREATE_FAKE_MP_GAMER_TAG);
-		HUD.set_function("REMOVE_MP_GAMER_TAG", LUA_NATIVE_HUD_REMOVE_MP_GAMER_TAG);
-		HUD.set_function("IS_MP_GAMER_TAG_ACTIVE", LUA_NATIVE_HUD_IS_MP_GAMER_TAG_ACTIVE);
-		HUD.set_function("IS_MP_GAMER_TAG_FREE", LUA_NATIVE_HUD_IS_MP_GAMER_TAG_FREE);
-		HUD.set_function("SET_MP_GAMER_TAG_VISIBILITY", LUA_NATIVE_HUD_SET_MP_GAMER_TAG_VISIBILITY);
-		HUD.set_function("SET_ALL_MP_GAMER_TAGS_VISIBILITY", LUA_NATIVE_HUD_SET_ALL_MP_GAMER_TAGS_VISIBILITY);
-		HUD.set_function("SET_MP_GAMER_TAGS_SHOULD_USE_VEHICLE_HEALTH", LUA_NATIVE_HUD_SET_MP_GAMER_TAGS_SHOULD_USE_VEHICLE_HEALTH);
-		HUD.set_function("SET_MP_GAMER_TAGS_SHOULD_USE_POINTS_HEALTH", LUA_NATIVE_HUD_SET_MP_GAMER_TAGS_SHOULD_USE_POINTS_HEALTH);
-		HUD.set_function("SET_MP_GAMER_TAGS_POINT_HEALTH", LUA_NATIVE_HUD_SET_MP_GAMER_TAGS_POINT_HEALTH);
-		HUD.set_function("SET_MP_GAMER_TAG_COLOUR", LUA_NATIVE_HUD_SET_MP_GAMER_TAG_COLOUR);
-		HUD.set_function("SET_MP_GAMER_TAG_HEALTH_BAR_COLOUR", LUA_NATIVE_HUD_SET_MP_GAMER_TAG_HEALTH_BAR_COLOUR);
-		HUD.set_function("SET_MP_GAMER_TAG_ALPHA", LUA_NATIVE_HUD_SET_MP_GAMER_TAG_ALPHA);
-		HUD.set_function("SET_MP_GAMER_TAG_WANTED_LEVEL", LUA_NATIVE_HUD_SET_MP_GAMER_TAG_WANTED_LEVEL);
-		HUD.set_function("SET_MP_GAMER_TAG_NUM_PACKAGES", LUA_NATIVE_HUD_SET_MP_GAMER_TAG_NUM_PACKAGES);
-		HUD.set_function("SET_MP_GAMER_TAG_NAME", LUA_NATIVE_HUD_SET_MP_GAMER_TAG_NAME);
-		HUD.set_function("IS_UPDATING_MP_GAMER_TAG_NAME_AND_CREW_DETAILS", LUA_NATIVE_HUD_IS_UPDATING_MP_GAMER_TAG_NAME_AND_CREW_DETAILS);
-		HUD.set_function("SET_MP_GAMER_TAG_BIG_TEXT", LUA_NATIVE_HUD_SET_MP_GAMER_TAG_BIG_TEXT);
-		HUD.set_function("GET_CURRENT_WEBPAGE_ID", LUA_NATIVE_HUD_GET_CURRENT_WEBPAGE_ID);
-		HUD.set_function("GET_CURRENT_WEBSITE_ID", LUA_NATIVE_HUD_GET_CURRENT_WEBSITE_ID);
-		HUD.set_function("GET_GLOBAL_ACTIONSCRIPT_FLAG", LUA_NATIVE_HUD_GET_GLOBAL_ACTIONSCRIPT_FLAG);
-		HUD.set_function("RESET_GLOBAL_ACTIONSCRIPT_FLAG", LUA_NATIVE_HUD_RESET_GLOBAL_ACTIONSCRIPT_FLAG);
-		HUD.set_function("IS_WARNING_MESSAGE_READY_FOR_CONTROL", LUA_NATIVE_HUD_IS_WARNING_MESSAGE_READY_FOR_CONTROL);
-		HUD.set_function("SET_WARNING_MESSAGE", LUA_NATIVE_HUD_SET_WARNING_MESSAGE);
-		HUD.set_function("SET_WARNING_MESSAGE_WITH_HEADER", LUA_NATIVE_HUD_SET_WARNING_MESSAGE_WITH_HEADER);
-		HUD.set_function("SET_WARNING_MESSAGE_WITH_HEADER_AND_SUBSTRING_FLAGS", LUA_NATIVE_HUD_SET_WARNING_MESSAGE_WITH_HEADER_AND_SUBSTRING_FLAGS);
-		HUD.set_function("SET_WARNING_MESSAGE_WITH_HEADER_EXTENDED", LUA_NATIVE_HUD_SET_WARNING_MESSAGE_WITH_HEADER_EXTENDED);
-		HUD.set_function("SET_WARNING_MESSAGE_WITH_HEADER_AND_SUBSTRING_FLAGS_EXTENDED", LUA_NATIVE_HUD_SET_WARNING_MESSAGE_WITH_HEADER_AND_SUBSTRING_FLAGS_EXTENDED);
-		HUD.set_function("GET_WARNING_SCREEN_MESSAGE_HASH", LUA_NATIVE_HUD_GET_WARNING_SCREEN_MESSAGE_HASH);
-		HUD.set_function("SET_WARNING_MESSAGE_OPTION_ITEMS", LUA_NATIVE_HUD_SET_WARNING_MESSAGE_OPTION_ITEMS);
-		HUD.set_function("SET_WARNING_MESSAGE_OPTION_HIGHLIGHT", LUA_NATIVE_HUD_SET_WARNING_MESSAGE_OPTION_HIGHLIGHT);
-		HUD.set_function("REMOVE_WARNING_MESSAGE_OPTION_ITEMS", LUA_NATIVE_HUD_REMOVE_WARNING_MESSAGE_OPTION_ITEMS);
-		HUD.set_function("IS_WARNING_MESSAGE_ACTIVE", LUA_NATIVE_HUD_IS_WARNING_MESSAGE_ACTIVE);
-		HUD.set_function("CLEAR_DYNAMIC_PAUSE_MENU_ERROR_MESSAGE", LUA_NATIVE_HUD_CLEAR_DYNAMIC_PAUSE_MENU_ERROR_MESSAGE);
-		HUD.set_function("CUSTOM_MINIMAP_SET_ACTIVE", LUA_NATIVE_HUD_CUSTOM_MINIMAP_SET_ACTIVE);
-		HUD.set_function("CUSTOM_MINIMAP_SET_BLIP_OBJECT", LUA_NATIVE_HUD_CUSTOM_MINIMAP_SET_BLIP_OBJECT);
-		HUD.set_function("CUSTOM_MINIMAP_CREATE_BLIP", LUA_NATIVE_HUD_CUSTOM_MINIMAP_CREATE_BLIP);
-		HUD.set_function("CUSTOM_MINIMAP_CLEAR_BLIPS", LUA_NATIVE_HUD_CUSTOM_MINIMAP_CLEAR_BLIPS);
-		HUD.set_function("FORCE_SONAR_BLIPS_THIS_FRAME", LUA_NATIVE_HUD_FORCE_SONAR_BLIPS_THIS_FRAME);
-		HUD.set_function("GET_NORTH_BLID_INDEX", LUA_NATIVE_HUD_GET_NORTH_BLID_INDEX);
-		HUD.set_function("DISPLAY_PLAYER_NAME_TAGS_ON_BLIPS", LUA_NATIVE_HUD_DISPLAY_PLAYER_NAME_TAGS_ON_BLIPS);
-		HUD.set_function("DRAW_FRONTEND_BACKGROUND_THIS_FRAME", LUA_NATIVE_HUD_DRAW_FRONTEND_BACKGROUND_THIS_FRAME);
-		HUD.set_function("DRAW_HUD_OVER_FADE_THIS_FRAME", LUA_NATIVE_HUD_DRAW_HUD_OVER_FADE_THIS_FRAME);
-		HUD.set_function("ACTIVATE_FRONTEND_MENU", LUA_NATIVE_HUD_ACTIVATE_FRONTEND_MENU);
-		HUD.set_function("RESTART_FRONTEND_MENU", LUA_NATIVE_HUD_RESTART_FRONTEND_MENU);
-		HUD.set_function("GET_CURRENT_FRONTEND_MENU_VERSION", LUA_NATIVE_HUD_GET_CURRENT_FRONTEND_MENU_VERSION);
-		HUD.set_function("SET_PAUSE_MENU_ACTIVE", LUA_NATIVE_HUD_SET_PAUSE_MENU_ACTIVE);
-		HUD.set_function("DISABLE_FRONTEND_THIS_FRAME", LUA_NATIVE_HUD_DISABLE_FRONTEND_THIS_FRAME);
-		HUD.set_function("SUPPRESS_FRONTEND_RENDERING_THIS_FRAME", LUA_NATIVE_HUD_SUPPRESS_FRONTEND_RENDERING_THIS_FRAME);
-		HUD.set_function("ALLOW_PAUSE_WHEN_NOT_IN_STATE_OF_PLAY_THIS_FRAME", LUA_NATIVE_HUD_ALLOW_PAUSE_WHEN_NOT_IN_STATE_OF_PLAY_THIS_FRAME);
-		HUD.set_function("SET_FRONTEND_ACTIVE", LUA_NATIVE_HUD_SET_FRONTEND_ACTIVE);
-		HUD.set_function("IS_PAUSE_MENU_ACTIVE", LUA_NATIVE_HUD_IS_PAUSE_MENU_ACTIVE);
-		HUD.set_function("IS_STORE_PENDING_NETWORK_SHUTDOWN_TO_OPEN", LUA_NATIVE_HUD_IS_STORE_PENDING_NETWORK_SHUTDOWN_TO_OPEN);
-		HUD.set_function("GET_PAUSE_MENU_STATE", LUA_NATIVE_HUD_GET_PAUSE_MENU_STATE);
-		HUD.set_function("GET_PAUSE_MENU_POSITION", LUA_NATIVE_HUD_GET_PAUSE_MENU_POSITION);
-		HUD.set_function("IS_PAUSE_MENU_RESTARTING", LUA_NATIVE_HUD_IS_PAUSE_MENU_RESTARTING);
-		HUD.set_function("FORCE_SCRIPTED_GFX_WHEN_FRONTEND_ACTIVE", LUA_NATIVE_HUD_FORCE_SCRIPTED_GFX_WHEN_FRONTEND_ACTIVE);
-		HUD.set_function("PAUSE_MENUCEPTION_GO_DEEPER", LUA_NATIVE_HUD_PAUSE_MENUCEPTION_GO_DEEPER);
-		HUD.set_function("PAUSE_MENUCEPTION_THE_KICK", LUA_NATIVE_HUD_PAUSE_MENUCEPTION_THE_KICK);
-		HUD.set_function("PAUSE_TOGGLE_FULLSCREEN_MAP", LUA_NATIVE_HUD_PAUSE_TOGGLE_FULLSCREEN_MAP);
-		HUD.set_function("PAUSE_MENU_ACTIVATE_CONTEXT", LUA_NATIVE_HUD_PAUSE_MENU_ACTIVATE_CONTEXT);
-		HUD.set_function("PAUSE_MENU_DEACTIVATE_CONTEXT", LUA_NATIVE_HUD_PAUSE_MENU_DEACTIVATE_CONTEXT);
-		HUD.set_function("PAUSE_MENU_IS_CONTEXT_ACTIVE", LUA_NATIVE_HUD_PAUSE_MENU_IS_CONTEXT_ACTIVE);
-		HUD.set_function("PAUSE_MENU_IS_CONTEXT_MENU_ACTIVE", LUA_NATIVE_HUD_PAUSE_MENU_IS_CONTEXT_MENU_ACTIVE);
-		HUD.set_function("PAUSE_MENU_GET_HAIR_COLOUR_INDEX", LUA_NATIVE_HUD_PAUSE_MENU_GET_HAIR_COLOUR_INDEX);
-		HUD.set_function("PAUSE_MENU_GET_MOUSE_HOVER_INDEX", LUA_NATIVE_HUD_PAUSE_MENU_GET_MOUSE_HOVER_INDEX);
-		HUD.set_function("PAUSE_MENU_GET_MOUSE_HOVER_UNIQUE_ID", LUA_NATIVE_HUD_PAUSE_MENU_GET_MOUSE_HOVER_UNIQUE_ID);
-		HUD.set_function("PAUSE_MENU_GET_MOUSE_CLICK_EVENT", LUA_NATIVE_HUD_PAUSE_MENU_GET_MOUSE_CLICK_EVENT);
-		HUD.set_function("PAUSE_MENU_REDRAW_INSTRUCTIONAL_BUTTONS", LUA_NATIVE_HUD_PAUSE_MENU_REDRAW_INSTRUCTIONAL_BUTTONS);
-		HUD.set_function("PAUSE_MENU_SET_BUSY_SPINNER", LUA_NATIVE_HUD_PAUSE_MENU_SET_BUSY_SPINNER);
-		HUD.set_function("PAUSE_MENU_SET_WARN_ON_TAB_CHANGE", LUA_NATIVE_HUD_PAUSE_MENU_SET_WARN_ON_TAB_CHANGE);
-		HUD.set_function("IS_FRONTEND_READY_FOR_CONTROL", LUA_NATIVE_HUD_IS_FRONTEND_READY_FOR_CONTROL);
-		HUD.set_function("TAKE_CONTROL_OF_FRONTEND", LUA_NATIVE_HUD_TAKE_CONTROL_OF_FRONTEND);
-		HUD.set_function("RELEASE_CONTROL_OF_FRONTEND", LUA_NATIVE_HUD_RELEASE_CONTROL_OF_FRONTEND);
-		HUD.set_function("CODE_WANTS_SCRIPT_TO_TAKE_CONTROL", LUA_NATIVE_HUD_CODE_WANTS_SCRIPT_TO_TAKE_CONTROL);
-		HUD.set_function("GET_SCREEN_CODE_WANTS_SCRIPT_TO_CONTROL", LUA_NATIVE_HUD_GET_SCREEN_CODE_WANTS_SCRIPT_TO_CONTROL);
-		HUD.set_function("IS_NAVIGATING_MENU_CONTENT", LUA_NATIVE_HUD_IS_NAVIGATING_MENU_CONTENT);
-		HUD.set_function("HAS_MENU_TRIGGER_EVENT_OCCURRED", LUA_NATIVE_HUD_HAS_MENU_TRIGGER_EVENT_OCCURRED);
-		HUD.set_function("HAS_MENU_LAYOUT_CHANGED_EVENT_OCCURRED", LUA_NATIVE_HUD_HAS_MENU_LAYOUT_CHANGED_EVENT_OCCURRED);
-		HUD.set_function("SET_SAVEGAME_LIST_UNIQUE_ID", LUA_NATIVE_HUD_SET_SAVEGAME_LIST_UNIQUE_ID);
-		HUD.set_function("GET_MENU_TRIGGER_EVENT_DETAILS", LUA_NATIVE_HUD_GET_MENU_TRIGGER_EVENT_DETAILS);
-		HUD.set_function("GET_MENU_LAYOUT_CHANGED_EVENT_DETAILS", LUA_NATIVE_HUD_GET_MENU_LAYOUT_CHANGED_EVENT_DETAILS);
-		HUD.set_function("GET_PM_PLAYER_CREW_COLOR", LUA_NATIVE_HUD_GET_PM_PLAYER_CREW_COLOR);
-		HUD.set_function("GET_MENU_PED_INT_STAT", LUA_NATIVE_HUD_GET_MENU_PED_INT_STAT);
-		HUD.set_function("GET_CHARACTER_MENU_PED_INT_STAT", LUA_NATIVE_HUD_GET_CHARACTER_MENU_PED_INT_STAT);
-		HUD.set_function("GET_MENU_PED_MASKED_INT_STAT", LUA_NATIVE_HUD_GET_MENU_PED_MASKED_INT_STAT);
-		HUD.set_function("GET_CHARACTER_MENU_PED_MASKED_INT_STAT", LUA_NATIVE_HUD_GET_CHARACTER_MENU_PED_MASKED_INT_STAT);
-		HUD.set_function("GET_MENU_PED_FLOAT_STAT", LUA_NATIVE_HUD_GET_MENU_PED_FLOAT_STAT);
-		HUD.set_function("GET_CHARACTER_MENU_PED_FLOAT_STAT", LUA_NATIVE_HUD_GET_CHARACTER_MENU_PED_FLOAT_STAT);
-		HUD.set_function("GET_MENU_PED_BOOL_STAT", LUA_NATIVE_HUD_GET_MENU_PED_BOOL_STAT);
-		HUD.set_function("CLEAR_PED_IN_PAUSE_MENU", LUA_NATIVE_HUD_CLEAR_PED_IN_PAUSE_MENU);
-		HUD.set_function("GIVE_PED_TO_PAUSE_MENU", LUA_NATIVE_HUD_GIVE_PED_TO_PAUSE_MENU);
-		HUD.set_function("SET_PAUSE_MENU_PED_LIGHTING", LUA_NATIVE_HUD_SET_PAUSE_MENU_PED_LIGHTING);
-		HUD.set_function("SET_PAUSE_MENU_PED_SLEEP_STATE", LUA_NATIVE_HUD_SET_PAUSE_MENU_PED_SLEEP_STATE);
-		HUD.set_function("OPEN_ONLINE_POLICIES_MENU", LUA_NATIVE_HUD_OPEN_ONLINE_POLICIES_MENU);
-		HUD.set_function("ARE_ONLINE_POLICIES_UP_TO_DATE", LUA_NATIVE_HUD_ARE_ONLINE_POLICIES_UP_TO_DATE);
-		HUD.set_function("IS_ONLINE_POLICIES_MENU_ACTIVE", LUA_NATIVE_HUD_IS_ONLINE_POLICIES_MENU_ACTIVE);
-		HUD.set_function("OPEN_SOCIAL_CLUB_MENU", LUA_NATIVE_HUD_OPEN_SOCIAL_CLUB_MENU);
-		HUD.set_function("CLOSE_SOCIAL_CLUB_MENU", LUA_NATIVE_HUD_CLOSE_SOCIAL_CLUB_MENU);
-		HUD.set_function("SET_SOCIAL_CLUB_TOUR", LUA_NATIVE_HUD_SET_SOCIAL_CLUB_TOUR);
-		HUD.set_function("IS_SOCIAL_CLUB_ACTIVE", LUA_NATIVE_HUD_IS_SOCIAL_CLUB_ACTIVE);
-		HUD.set_function("SET_TEXT_INPUT_BOX_ENABLED", LUA_NATIVE_HUD_SET_TEXT_INPUT_BOX_ENABLED);
-		HUD.set_function("FORCE_CLOSE_TEXT_INPUT_BOX", LUA_NATIVE_HUD_FORCE_CLOSE_TEXT_INPUT_BOX);
-		HUD.set_function("SET_ALLOW_COMMA_ON_TEXT_INPUT", LUA_NATIVE_HUD_SET_ALLOW_COMMA_ON_TEXT_INPUT);
-		HUD.set_function("OVERRIDE_MP_TEXT_CHAT_TEAM_STRING", LUA_NATIVE_HUD_OVERRIDE_MP_TEXT_CHAT_TEAM_STRING);
-		HUD.set_function("IS_MP_TEXT_CHAT_TYPING", LUA_NATIVE_HUD_IS_MP_TEXT_CHAT_TYPING);
-		HUD.set_function("CLOSE_MP_TEXT_CHAT", LUA_NATIVE_HUD_CLOSE_MP_TEXT_CHAT);
-		HUD.set_function("MP_TEXT_CHAT_IS_TEAM_JOB", LUA_NATIVE_HUD_MP_TEXT_CHAT_IS_TEAM_JOB);
-		HUD.set_function("OVERRIDE_MP_TEXT_CHAT_COLOR", LUA_NATIVE_HUD_OVERRIDE_MP_TEXT_CHAT_COLOR);
-		HUD.set_function("MP_TEXT_CHAT_DISABLE", LUA_NATIVE_HUD_MP_TEXT_CHAT_DISABLE);
-		HUD.set_function("FLAG_PLAYER_CONTEXT_IN_TOURNAMENT", LUA_NATIVE_HUD_FLAG_PLAYER_CONTEXT_IN_TOURNAMENT);
-		HUD.set_function("SET_PED_HAS_AI_BLIP", LUA_NATIVE_HUD_SET_PED_HAS_AI_BLIP);
-		HUD.set_function("SET_PED_HAS_AI_BLIP_WITH_COLOUR", LUA_NATIVE_HUD_SET_PED_HAS_AI_BLIP_WITH_COLOUR);
-		HUD.set_function("DOES_PED_HAVE_AI_BLIP", LUA_NATIVE_HUD_DOES_PED_HAVE_AI_BLIP);
-		HUD.set_function("SET_PED_AI_BLIP_GANG_ID", LUA_NATIVE_HUD_SET_PED_AI_BLIP_GANG_ID);
-		HUD.set_function("SET_PED_AI_BLIP_HAS_CONE", LUA_NATIVE_HUD_SET_PED_AI_BLIP_HAS_CONE);
-		HUD.set_function("SET_PED_AI_BLIP_FORCED_ON", LUA_NATIVE_HUD_SET_PED_AI_BLIP_FORCED_ON);
-		HUD.set_function("SET_PED_AI_BLIP_NOTICE_RANGE", LUA_NATIVE_HUD_SET_PED_AI_BLIP_NOTICE_RANGE);
-		HUD.set_function("SET_PED_AI_BLIP_SPRITE", LUA_NATIVE_HUD_SET_PED_AI_BLIP_SPRITE);
-		HUD.set_function("GET_AI_PED_PED_BLIP_INDEX", LUA_NATIVE_HUD_GET_AI_PED_PED_BLIP_INDEX);
-		HUD.set_function("GET_AI_PED_VEHICLE_BLIP_INDEX", LUA_NATIVE_HUD_GET_AI_PED_VEHICLE_BLIP_INDEX);
-		HUD.set_function("HAS_DIRECTOR_MODE_BEEN_LAUNCHED_BY_CODE", LUA_NATIVE_HUD_HAS_DIRECTOR_MODE_BEEN_LAUNCHED_BY_CODE);
-		HUD.set_function("SET_DIRECTOR_MODE_LAUNCHED_BY_SCRIPT", LUA_NATIVE_HUD_SET_DIRECTOR_MODE_LAUNCHED_BY_SCRIPT);
-		HUD.set_function("SET_PLAYER_IS_IN_DIRECTOR_MODE", LUA_NATIVE_HUD_SET_PLAYER_IS_IN_DIRECTOR_MODE);
-		HUD.set_function("SET_DIRECTOR_MODE_AVAILABLE", LUA_NATIVE_HUD_SET_DIRECTOR_MODE_AVAILABLE);
-		HUD.set_function("HIDE_HUDMARKERS_THIS_FRAME", LUA_NATIVE_HUD_HIDE_HUDMARKERS_THIS_FRAME);
+		bind_namespace(L, "HUD", HUD_natives);
 	}
 }
@@ -253,53 +253,56 @@ namespace lua::native
 		INTERIOR::SET_IS_EXTERIOR_ONLY(entity, toggle);
 	}
 
+	static constexpr native_entry INTERIOR_natives[] = {
+		{"ACTIVATE_INTERIOR_ENTITY_SET", native_function<LUA_NATIVE_INTERIOR_ACTIVATE_INTERIOR_ENTITY_SET>},
+		{"ACTIVATE_INTERIOR_GROUPS_USING_CAMERA", native_function<LUA_NATIVE_INTERIOR_ACTIVATE_INTERIOR_GROUPS_USING_CAMERA>},
+		{"ADD_PICKUP_TO_INTERIOR_ROOM_BY_NAME", native_function<LUA_NATIVE_INTERIOR_ADD_PICKUP_TO_INTERIOR_ROOM_BY_NAME>},
+		{"CAP_INTERIOR", native_function<LUA_NATIVE_INTERIOR_CAP_INTERIOR>},
+		{"CLEAR_INTERIOR_STATE_OF_ENTITY", native_function<LUA_NATIVE_INTERIOR_CLEAR_INTERIOR_STATE_OF_ENTITY>},
+		{"CLEAR_ROOM_FOR_ENTITY", native_function<LUA_NATIVE_INTERIOR_CLEAR_ROOM_FOR_ENTITY>},
+		{"CLEAR_ROOM_FOR_GAME_VIEWPORT", native_function<LUA_NATIVE_INTERIOR_CLEAR_ROOM_FOR_GAME_VIEWPORT>},
+		{"DEACTIVATE_INTERIOR_ENTITY_SET", native_function<LUA_NATIVE_INTERIOR_DEACTIVATE_INTERIOR_ENTITY_SET>},
+		{"DISABLE_INTERIOR", native_function<LUA_NATIVE_INTERIOR_DISABLE_INTERIOR>},
+		{"DISABLE_METRO_SYSTEM", native_function<LUA_NATIVE_INTERIOR_DISABLE_METRO_SYSTEM>},
+		{"ENABLE_EXTERIOR_CULL_MODEL_THIS_FRAME", native_function<LUA_NATIVE_INTERIOR_ENABLE_EXTERIOR_CULL_MODEL_THIS_FRAME>},
+		{"ENABLE_SHADOW_CULL_MODEL_THIS_FRAME", native_function<LUA_NATIVE_INTERIOR_ENABLE_SHADOW_CULL_MODEL_THIS_FRAME>},
+		{"ENABLE_STADIUM_PROBES_THIS_FRAME", native_function<LUA_NATIVE_INTERIOR_ENABLE_STADIUM_PROBES_THIS_FRAME>},
+		{"FORCE_ACTIVATING_TRACKING_ON_ENTITY", native_function<LUA_NATIVE_INTERIOR_FORCE_ACTIVATING_TRACKING_ON_ENTITY>},
+		{"FORCE_ROOM_FOR_ENTITY", native_function<LUA_NATIVE_INTERIOR_FORCE_ROOM_FOR_ENTITY>},
+		{"FORCE_ROOM_FOR_GAME_VIEWPORT", native_function<LUA_NATIVE_INTERIOR_FORCE_ROOM_FOR_GAME_VIEWPORT>},
+		{"GET_INTERIOR_AT_COORDS", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_AT_COORDS>},
+		{"GET_INTERIOR_AT_COORDS_WITH_TYPE", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_AT_COORDS_WITH_TYPE>},
+		{"GET_INTERIOR_AT_COORDS_WITH_TYPEHASH", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_AT_COORDS_WITH_TYPEHASH>},
+		{"GET_INTERIOR_FROM_COLLISION", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_FROM_COLLISION>},
+		{"GET_INTERIOR_FROM_ENTITY", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_FROM_ENTITY>},
+		{"GET_INTERIOR_FROM_PRIMARY_VIEW", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_FROM_PRIMARY_VIEW>},
+		{"GET_INTERIOR_GROUP_ID", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_GROUP_ID>},
+		{"GET_INTERIOR_HEADING", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_HEADING>},
+		{"GET_INTERIOR_LOCATION_AND_NAMEHASH", native_function<LUA_NATIVE_INTERIOR_GET_INTERIOR_LOCATION_AND_NAMEHASH>},
+		{"GET_KEY_FOR_ENTITY_IN_ROOM", native_function<LUA_NATIVE_INTERIOR_GET_KEY_FOR_ENTITY_IN_ROOM>},
+		{"GET_OFFSET_FROM_INTERIOR_IN_WORLD_COORDS", native_function<LUA_NATIVE_INTERIOR_GET_OFFSET_FROM_INTERIOR_IN_WORLD_COORDS>},
+		{"GET_ROOM_KEY_FOR_GAME_VIEWPORT", native_function<LUA_NATIVE_INTERIOR_GET_ROOM_KEY_FOR_GAME_VIEWPORT>},
+		{"GET_ROOM_KEY_FROM_ENTITY", native_function<LUA_NATIVE_INTERIOR_GET_ROOM_KEY_FROM_ENTITY>},
+		{"IS_COLLISION_MARKED_OUTSIDE", native_function<LUA_NATIVE_INTERIOR_IS_COLLISION_MARKED_OUTSIDE>},
+		{"IS_INTERIOR_CAPPED", native_function<LUA_NATIVE_INTERIOR_IS_INTERIOR_CAPPED>},
+		{"IS_INTERIOR_DISABLED", native_function<LUA_NATIVE_INTERIOR_IS_INTERIOR_DISABLED>},
+		{"IS_INTERIOR_ENTITY_SET_ACTIVE", native_function<LUA_NATIVE_INTERIOR_IS_INTERIOR_ENTITY_SET_ACTIVE>},
+		{"IS_INTERIOR_READY", native_function<LUA_NATIVE_INTERIOR_IS_INTERIOR_READY>},
+		{"IS_INTERIOR_SCENE", native_function<LUA_NATIVE_INTERIOR_IS_INTERIOR_SCENE>},
+		{"IS_VALID_INTERIOR", native_function<LUA_NATIVE_INTERIOR_IS_VALID_INTERIOR>},
+		{"PIN_INTERIOR_IN_MEMORY", native_function<LUA_NATIVE_INTERIOR_PIN_INTERIOR_IN_MEMORY>},
+		{"REFRESH_INTERIOR", native_function<LUA_NATIVE_INTERIOR_REFRESH_INTERIOR>},
+		{"RETAIN_ENTITY_IN_INTERIOR", native_function<LUA_NATIVE_INTERIOR_RETAIN_ENTITY_IN_INTERIOR>},
+		{"SET_INTERIOR_ENTITY_SET_TINT_INDEX", native_function<LUA_NATIVE_INTERIOR_SET_INTERIOR_ENTITY_SET_TINT_INDEX>},
+		{"SET_INTERIOR_IN_USE", native_function<LUA_NATIVE_INTERIOR_SET_INTERIOR_IN_USE>},
+		{"SET_IS_EXTERIOR_ONLY", native_function<LUA_NATIVE_INTERIOR_SET_IS_EXTERIOR_ONLY>},
+		{"SET_ROOM_FOR_GAME_VIEWPORT_BY_KEY", native_function<LUA_NATIVE_INTERIOR_SET_ROOM_FOR_GAME_VIEWPORT_BY_KEY>},
+		{"SET_ROOM_FOR_GAME_VIEWPORT_BY_NAME", native_function<LUA_NATIVE_INTERIOR_SET_ROOM_FOR_GAME_VIEWPORT_BY_NAME>},
+		{"UNPIN_INTERIOR", native_function<LUA_NATIVE_INTERIOR_UNPIN_INTERIOR>},
+	};
+
 	void init_native_binding_INTERIOR(sol::state& L)
 	{
-		auto INTERIOR = L["INTERIOR"].get_or_create<sol::table>();
-		INTERIOR.set_function("GET_INTERIOR_HEADING", LUA_NATIVE_INTERIOR_GET_INTERIOR_HEADING);
-		INTERIOR.set_function("GET_INTERIOR_LOCATION_AND_NAMEHASH", LUA_NATIVE_INTERIOR_GET_INTERIOR_LOCATION_AND_NAMEHASH);
-		INTERIOR.set_function("GET_INTERIOR_GROUP_ID", LUA_NATIVE_INTERIOR_GET_INTERIOR_GROUP_ID);
-		INTERIOR.set_function("GET_OFFSET_FROM_INTERIOR_IN_WORLD_COORDS", LUA_NATIVE_INTERIOR_GET_OFFSET_FROM_INTERIOR_IN_WORLD_COORDS);
-		INTERIOR.set_function("IS_INTERIOR_SCENE", LUA_NATIVE_INTERIOR_IS_INTERIOR_SCENE);
-		INTERIOR.set_function("IS_VALID_INTERIOR", LUA_NATIVE_INTERIOR_IS_VALID_INTERIOR);
-		INTERIOR.set_function("CLEAR_ROOM_FOR_ENTITY", LUA_NATIVE_INTERIOR_CLEAR_ROOM_FOR_ENTITY);
-		INTERIOR.set_function("FORCE_ROOM_FOR_ENTITY", LUA_NATIVE_INTERIOR_FORCE_ROOM_FOR_ENTITY);
-		INTERIOR.set_function("GET_ROOM_KEY_FROM_ENTITY", LUA_NATIVE_INTERIOR_GET_ROOM_KEY_FROM_ENTITY);
-		INTERIOR.set_function("GET_KEY_FOR_ENTITY_IN_ROOM", LUA_NATIVE_INTERIOR_GET_KEY_FOR_ENTITY_IN_ROOM);
-		INTERIOR.set_function("GET_INTERIOR_FROM_ENTITY", LUA_NATIVE_INTERIOR_GET_INTERIOR_FROM_ENTITY);
-		INTERIOR.set_function("RETAIN_ENTITY_IN_INTERIOR", LUA_NATIVE_INTERIOR_RETAIN_ENTITY_IN_INTERIOR);
-		INTERIOR.set_function("CLEAR_INTERIOR_STATE_OF_ENTITY", LUA_NATIVE_INTERIOR_CLEAR_INTERIOR_STATE_OF_ENTITY);
-		INTERIOR.set_function("FORCE_ACTIVATING_TRACKING_ON_ENTITY", LUA_NATIVE_INTERIOR_FORCE_ACTIVATING_TRACKING_ON_ENTITY);
-		INTERIOR.set_function("FORCE_ROOM_FOR_GAME_VIEWPORT", LUA_NATIVE_INTERIOR_FORCE_ROOM_FOR_GAME_VIEWPORT);
-		INTERIOR.set_function("SET_ROOM_FOR_GAME_VIEWPORT_BY_NAME", LUA_NATIVE_INTERIOR_SET_ROOM_FOR_GAME_VIEWPORT_BY_NAME);
-		INTERIOR.set_function("SET_ROOM_FOR_GAME_VIEWPORT_BY_KEY", LUA_NATIVE_INTERIOR_SET_ROOM_FOR_GAME_VIEWPORT_BY_KEY);
-		INTERIOR.set_function("GET_ROOM_KEY_FOR_GAME_VIEWPORT", LUA_NATIVE_INTERIOR_GET_ROOM_KEY_FOR_GAME_VIEWPORT);
-		INTERIOR.set_function("CLEAR_ROOM_FOR_GAME_VIEWPORT", LUA_NATIVE_INTERIOR_CLEAR_ROOM_FOR_GAME_VIEWPORT);
-		INTERIOR.set_function("GET_INTERIOR_FROM_PRIMARY_VIEW", LUA_NATIVE_INTERIOR_GET_INTERIOR_FROM_PRIMARY_VIEW);
-		INTERIOR.set_function("GET_INTERIOR_AT_COORDS", LUA_NATIVE_INTERIOR_GET_INTERIOR_AT_COORDS);
-		INTERIOR.set_function("ADD_PICKUP_TO_INTERIOR_ROOM_BY_NAME", LUA_NATIVE_INTERIOR_ADD_PICKUP_TO_INTERIOR_ROOM_BY_NAME);
-		INTERIOR.set_function("PIN_INTERIOR_IN_MEMORY", LUA_NATIVE_INTERIOR_PIN_INTERIOR_IN_MEMORY);
-		INTERIOR.set_function("UNPIN_INTERIOR", LUA_NATIVE_INTERIOR_UNPIN_INTERIOR);
-		INTERIOR.set_function("IS_INTERIOR_READY", LUA_NATIVE_INTERIOR_IS_INTERIOR_READY);
-		INTERIOR.set_function("SET_INTERIOR_IN_USE", LUA_NATIVE_INTERIOR_SET_INTERIOR_IN_USE);
-		INTERIOR.set_function("GET_INTERIOR_AT_COORDS_WITH_TYPE", LUA_NATIVE_INTERIOR_GET_INTERIOR_AT_COORDS_WITH_TYPE);
-		INTERIOR.set_function("GET_INTERIOR_AT_COORDS_WITH_TYPEHASH", LUA_NATIVE_INTERIOR_GET_INTERIOR_AT_COORDS_WITH_TYPEHASH);
-		INTERIOR.set_function("ACTIVATE_INTERIOR_GROUPS_USING_CAMERA", LUA_NATIVE_INTERIOR_ACTIVATE_INTERIOR_GROUPS_USING_CAMERA);
-		INTERIOR.set_function("IS_COLLISION_MARKED_OUTSIDE", LUA_NATIVE_INTERIOR_IS_COLLISION_MARKED_OUTSIDE);
-		INTERIOR.set_function("GET_INTERIOR_FROM_COLLISION", LUA_NATIVE_INTERIOR_GET_INTERIOR_FROM_COLLISION);
-		INTERIOR.set_function("ENABLE_STADIUM_PROBES_THIS_FRAME", LUA_NATIVE_INTERIOR_ENABLE_STADIUM_PROBES_THIS_FRAME);
-		INTERIOR.set_function("ACTIVATE_INTERIOR_ENTITY_SET", LUA_NATIVE_INTERIOR_ACTIVATE_INTERIOR_ENTITY_SET);
-		INTERIOR.set_function("DEACTIVATE_INTERIOR_ENTITY_SET", LUA_NATIVE_INTERIOR_DEACTIVATE_INTERIOR_ENTITY_SET);
-		INTERIOR.set_function("IS_INTERIOR_ENTITY_SET_ACTIVE", LUA_NATIVE_INTERIOR_IS_INTERIOR_ENTITY_SET_ACTIVE);
-		INTERIOR.set_function("SET_INTERIOR_ENTITY_SET_TINT_INDEX", LUA_NATIVE_INTERIOR_SET_INTERIOR_ENTITY_SET_TINT_INDEX);
-		INTERIOR.set_function("REFRESH_INTERIOR", LUA_NATIVE_INTERIOR_REFRESH_INTERIOR);
-		INTERIOR.set_function("ENABLE_EXTERIOR_CULL_MODEL_THIS_FRAME", LUA_NATIVE_INTERIOR_ENABLE_EXTERIOR_CULL_MODEL_THIS_FRAME);
-		INTERIOR.set_function("ENABLE_SHADOW_CULL_MODEL_THIS_FRAME", LUA_NATIVE_INTERIOR_ENABLE_SHADOW_CULL_MODEL_THIS_FRAME);
-		INTERIOR.set_function("DISABLE_INTERIOR", LUA_NATIVE_INTERIOR_DISABLE_INTERIOR);
-		INTERIOR.set_function("IS_INTERIOR_DISABLED", LUA_NATIVE_INTERIOR_IS_INTERIOR_DISABLED);
-		INTERIOR.set_function("CAP_INTERIOR", LUA_NATIVE_INTERIOR_CAP_INTERIOR);
-		INTERIOR.set_function("IS_INTERIOR_CAPPED", LUA_NATIVE_INTERIOR_IS_INTERIOR_CAPPED);
-		INTERIOR.set_function("DISABLE_METRO_SYSTEM", LUA_NATIVE_INTERIOR_DISABLE_METRO_SYSTEM);
-		INTERIOR.set_function("SET_IS_EXTERIOR_ONLY", LUA_NATIVE_INTERIOR_SET_IS_EXTERIOR_ONLY);
+		bind_namespace(L, "INTERIOR", INTERIOR_natives);
 	}
 }
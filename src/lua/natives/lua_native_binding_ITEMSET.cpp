@@ -54,17 +54,20 @@ namespace lua::native
 		ITEMSET::CLEAN_ITEMSET(itemset);
 	}
 
+	static constexpr native_entry ITEMSET_natives[] = {
+		{"ADD_TO_ITEMSET", native_function<LUA_NATIVE_ITEMSET_ADD_TO_ITEMSET>},
+		{"CLEAN_ITEMSET", native_function<LUA_NATIVE_ITEMSET_CLEAN_ITEMSET>},
+		{"CREATE_ITEMSET", native_function<LUA_NATIVE_ITEMSET_CREATE_ITEMSET>},
+		{"DESTROY_ITEMSET", native_function<LUA_NATIVE_ITEMSET_DESTROY_ITEMSET>},
+		{"GET_INDEXED_ITEM_IN_ITEMSET", native_function<LUA_NATIVE_ITEMSET_GET_INDEXED_ITEM_IN_ITEMSET>},
+		{"GET_ITEMSET_SIZE", native_function<LUA_NATIVE_ITEMSET_GET_ITEMSET_SIZE>},
+		{"IS_IN_ITEMSET", native_function<LUA_NATIVE_ITEMSET_IS_IN_ITEMSET>},
+		{"IS_ITEMSET_VALID", native_function<LUA_NATIVE_ITEMSET_IS_ITEMSET_VALID>},
+		{"REMOVE_FROM_ITEMSET", native_function<LUA_NATIVE_ITEMSET_REMOVE_FROM_ITEMSET>},
+	};
+
 	void init_native_binding_ITEMSET(sol::state& L)
 	{
-		auto ITEMSET = L["ITEMSET"].get_or_create<sol::table>();
-		ITEMSET.set_function("CREATE_ITEMSET", LUA_NATIVE_ITEMSET_CREATE_ITEMSET);
-		ITEMSET.set_function("DESTROY_ITEMSET", LUA_NATIVE_ITEMSET_DESTROY_ITEMSET);
-		ITEMSET.set_function("IS_ITEMSET_VALID", LUA_NATIVE_ITEMSET_IS_ITEMSET_VALID);
-		ITEMSET.set_function("ADD_TO_ITEMSET", LUA_NATIVE_ITEMSET_ADD_TO_ITEMSET);
-		ITEMSET.set_function("REMOVE_FROM_ITEMSET", LUA_NATIVE_ITEMSET_REMOVE_FROM_ITEMSET);
-		ITEMSET.set_function("GET_ITEMSET_SIZE", LUA_NATIVE_ITEMSET_GET_ITEMSET_SIZE);
-		ITEMSET.set_function("GET_INDEXED_ITEM_IN_ITEMSET", LUA_NATIVE_ITEMSET_GET_INDEXED_ITEM_IN_ITEMSET);
-		ITEMSET.set_function("IS_IN_ITEMSET", LUA_NATIVE_ITEMSET_IS_IN_ITEMSET);
-		ITEMSET.set_function("CLEAN_ITEMSET", LUA_NATIVE_ITEMSET_CLEAN_ITEMSET);
+		bind_namespace(L, "ITEMSET", ITEMSET_natives);
 	}
 }
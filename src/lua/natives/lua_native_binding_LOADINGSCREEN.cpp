@@ -47,16 +47,19 @@ namespace lua::native
 		LOADINGSCREEN::SHUTDOWN_SESSION_CLEARS_AUTO_MULTIPLAYER(toggle);
 	}
 
+	static constexpr native_entry LOADINGSCREEN_natives[] = {
+		{"LOBBY_AUTO_MULTIPLAYER_EVENT", native_function<LUA_NATIVE_LOADINGSCREEN_LOBBY_AUTO_MULTIPLAYER_EVENT>},
+		{"LOBBY_AUTO_MULTIPLAYER_FREEMODE", native_function<LUA_NATIVE_LOADINGSCREEN_LOBBY_AUTO_MULTIPLAYER_FREEMODE>},
+		{"LOBBY_AUTO_MULTIPLAYER_MENU", native_function<LUA_NATIVE_LOADINGSCREEN_LOBBY_AUTO_MULTIPLAYER_MENU>},
+		{"LOBBY_AUTO_MULTIPLAYER_RANDOM_JOB", native_function<LUA_NATIVE_LOADINGSCREEN_LOBBY_AUTO_MULTIPLAYER_RANDOM_JOB>},
+		{"LOBBY_SET_AUTO_MP_RANDOM_JOB", native_function<LUA_NATIVE_LOADINGSCREEN_LOBBY_SET_AUTO_MP_RANDOM_JOB>},
+		{"LOBBY_SET_AUTO_MULTIPLAYER", native_function<LUA_NATIVE_LOADINGSCREEN_LOBBY_SET_AUTO_MULTIPLAYER>},
+		{"LOBBY_SET_AUTO_MULTIPLAYER_EVENT", native_function<LUA_NATIVE_LOADINGSCREEN_LOBBY_SET_AUTO_MULTIPLAYER_EVENT>},
+		{"SHUTDOWN_SESSION_CLEARS_AUTO_MULTIPLAYER", native_function<LUA_NATIVE_LOADINGSCREEN_SHUTDOWN_SESSION_CLEARS_AUTO_MULTIPLAYER>},
+	};
+
 	void init_native_binding_LOADINGSCREEN(sol::state& L)
 	{
-		auto LOADINGSCREEN = L["LOADINGSCREEN"].get_or_create<sol::table>();
-		LOADINGSCREEN.set_function("LOBBY_AUTO_MULTIPLAYER_MENU", LUA_NATIVE_LOADINGSCREEN_LOBBY_AUTO_MULTIPLAYER_MENU);
-		LOADINGSCREEN.set_function("LOBBY_AUTO_MULTIPLAYER_FREEMODE", LUA_NATIVE_LOADINGSCREEN_LOBBY_AUTO_MULTIPLAYER_FREEMODE);
-		LOADINGSCREEN.set_function("LOBBY_SET_AUTO_MULTIPLAYER", LUA_NATIVE_LOADINGSCREEN_LOBBY_SET_AUTO_MULTIPLAYER);
-		LOADINGSCREEN.set_function("LOBBY_AUTO_MULTIPLAYER_EVENT", LUA_NATIVE_LOADINGSCREEN_LOBBY_AUTO_MULTIPLAYER_EVENT);
-		LOADINGSCREEN.set_function("LOBBY_SET_AUTO_MULTIPLAYER_EVENT", LUA_NATIVE_LOADINGSCREEN_LOBBY_SET_AUTO_MULTIPLAYER_EVENT);
-		LOADINGSCREEN.set_function("LOBBY_AUTO_MULTIPLAYER_RANDOM_JOB", LUA_NATIVE_LOADINGSCREEN_LOBBY_AUTO_MULTIPLAYER_RANDOM_JOB);
-		LOADINGSCREEN.set_function("LOBBY_SET_AUTO_MP_RANDOM_JOB", LUA_NATIVE_LOADINGSCREEN_LOBBY_SET_AUTO_MP_RANDOM_JOB);
-		LOADINGSCREEN.set_function("SHUTDOWN_SESSION_CLEARS_AUTO_MULTIPLAYER", LUA_NATIVE_LOADINGSCREEN_SHUTDOWN_SESSION_CLEARS_AUTO_MULTIPLAYER);
+		bind_namespace(L, "LOADINGSCREEN", LOADINGSCREEN_natives);
 	}
 }
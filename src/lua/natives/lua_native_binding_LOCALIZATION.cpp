@@ -21,11 +21,14 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry LOCALIZATION_natives[] = {
+		{"GET_CURRENT_LANGUAGE", native_function<LUA_NATIVE_LOCALIZATION_GET_CURRENT_LANGUAGE>},
+		{"LOCALIZATION_GET_SYSTEM_DATE_TYPE", native_function<LUA_NATIVE_LOCALIZATION_LOCALIZATION_GET_SYSTEM_DATE_TYPE>},
+		{"LOCALIZATION_GET_SYSTEM_LANGUAGE", native_function<LUA_NATIVE_LOCALIZATION_LOCALIZATION_GET_SYSTEM_LANGUAGE>},
+	};
+
 	void init_native_binding_LOCALIZATION(sol::state& L)
 	{
-		auto LOCALIZATION = L["LOCALIZATION"].get_or_create<sol::table>();
-		LOCALIZATION.set_function("LOCALIZATION_GET_SYSTEM_LANGUAGE", LUA_NATIVE_LOCALIZATION_LOCALIZATION_GET_SYSTEM_LANGUAGE);
-		LOCALIZATION.set_function("GET_CURRENT_LANGUAGE", LUA_NATIVE_LOCALIZATION_GET_CURRENT_LANGUAGE);
-		LOCALIZATION.set_function("LOCALIZATION_GET_SYSTEM_DATE_TYPE", LUA_NATIVE_LOCALIZATION_LOCALIZATION_GET_SYSTEM_DATE_TYPE);
+		bind_namespace(L, "LOCALIZATION", LOCALIZATION_natives);
 	}
 }
@@ -1886,341 +1886,344 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry MISC_natives[] = {
+		{"ABSF", native_function<LUA_NATIVE_MISC_ABSF>},
+		{"ABSI", native_function<LUA_NATIVE_MISC_ABSI>},
+		{"ACOS", native_function<LUA_NATIVE_MISC_ACOS>},
+		{"ACTION_MANAGER_ENABLE_ACTION", native_function<LUA_NATIVE_MISC_ACTION_MANAGER_ENABLE_ACTION>},
+		{"ACTIVITY_FEED_ACTION_START_WITH_COMMAND_LINE", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_ACTION_START_WITH_COMMAND_LINE>},
+		{"ACTIVITY_FEED_ACTION_START_WITH_COMMAND_LINE_ADD", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_ACTION_START_WITH_COMMAND_LINE_ADD>},
+		{"ACTIVITY_FEED_ADD_INT_TO_CAPTION", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_ADD_INT_TO_CAPTION>},
+		{"ACTIVITY_FEED_ADD_LITERAL_SUBSTRING_TO_CAPTION", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_ADD_LITERAL_SUBSTRING_TO_CAPTION>},
+		{"ACTIVITY_FEED_ADD_SUBSTRING_TO_CAPTION", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_ADD_SUBSTRING_TO_CAPTION>},
+		{"ACTIVITY_FEED_CREATE", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_CREATE>},
+		{"ACTIVITY_FEED_LARGE_IMAGE_URL", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_LARGE_IMAGE_URL>},
+		{"ACTIVITY_FEED_ONLINE_PLAYED_WITH_POST", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_ONLINE_PLAYED_WITH_POST>},
+		{"ACTIVITY_FEED_POST", native_function<LUA_NATIVE_MISC_ACTIVITY_FEED_POST>},
+		{"ADD_DISPATCH_SPAWN_ANGLED_BLOCKING_AREA", native_function<LUA_NATIVE_MISC_ADD_DISPATCH_SPAWN_ANGLED_BLOCKING_AREA>},
+		{"ADD_DISPATCH_SPAWN_SPHERE_BLOCKING_AREA", native_function<LUA_NATIVE_MISC_ADD_DISPATCH_SPAWN_SPHERE_BLOCKING_AREA>},
+		{"ADD_HOSPITAL_RESTART", native_function<LUA_NATIVE_MISC_ADD_HOSPITAL_RESTART>},
+		{"ADD_POLICE_RESTART", native_function<LUA_NATIVE_MISC_ADD_POLICE_RESTART>},
+		{"ADD_POP_MULTIPLIER_AREA", native_function<LUA_NATIVE_MISC_ADD_POP_MULTIPLIER_AREA>},
+		{"ADD_POP_MULTIPLIER_SPHERE", native_function<LUA_NATIVE_MISC_ADD_POP_MULTIPLIER_SPHERE>},
+		{"ADD_REPLAY_STAT_VALUE", native_function<LUA_NATIVE_MISC_ADD_REPLAY_STAT_VALUE>},
+		{"ADD_STUNT_JUMP", native_function<LUA_NATIVE_MISC_ADD_STUNT_JUMP>},
+		{"ADD_STUNT_JUMP_ANGLED", native_function<LUA_NATIVE_MISC_ADD_STUNT_JUMP_ANGLED>},
+		{"ADD_TACTICAL_NAV_MESH_POINT", native_function<LUA_NATIVE_MISC_ADD_TACTICAL_NAV_MESH_POINT>},
+		{"ALLOW_MISSION_CREATOR_WARP", native_function<LUA_NATIVE_MISC_ALLOW_MISSION_CREATOR_WARP>},
+		{"ARE_CREDITS_RUNNING", native_function<LUA_NATIVE_MISC_ARE_CREDITS_RUNNING>},
+		{"ARE_PROFILE_SETTINGS_VALID", native_function<LUA_NATIVE_MISC_ARE_PROFILE_SETTINGS_VALID>},
+		{"ARE_STRINGS_EQUAL", native_function<LUA_NATIVE_MISC_ARE_STRINGS_EQUAL>},
+		{"ASIN", native_function<LUA_NATIVE_MISC_ASIN>},
+		{"ATAN", native_function<LUA_NATIVE_MISC_ATAN>},
+		{"ATAN2", native_function<LUA_NATIVE_MISC_ATAN2>},
+		{"BEGIN_REPLAY_STATS", native_function<LUA_NATIVE_MISC_BEGIN_REPLAY_STATS>},
+		{"BLOCK_DISPATCH_SERVICE_RESOURCE_CREATION", native_function<LUA_NATIVE_MISC_BLOCK_DISPATCH_SERVICE_RESOURCE_CREATION>},
+		{"CANCEL_ONSCREEN_KEYBOARD", native_function<LUA_NATIVE_MISC_CANCEL_ONSCREEN_KEYBOARD>},
+		{"CANCEL_STUNT_JUMP", native_function<LUA_NATIVE_MISC_CANCEL_STUNT_JUMP>},
+		{"CLEANUP_ASYNC_INSTALL", native_function<LUA_NATIVE_MISC_CLEANUP_ASYNC_INSTALL>},
+		{"CLEAR_ANGLED_AREA_OF_VEHICLES", native_function<LUA_NATIVE_MISC_CLEAR_ANGLED_AREA_OF_VEHICLES>},
+		{"CLEAR_AREA", native_function<LUA_NATIVE_MISC_CLEAR_AREA>},
+		{"CLEAR_AREA_LEAVE_VEHICLE_HEALTH", native_function<LUA_NATIVE_MISC_CLEAR_AREA_LEAVE_VEHICLE_HEALTH>},
+		{"CLEAR_AREA_OF_COPS", native_function<LUA_NATIVE_MISC_CLEAR_AREA_OF_COPS>},
+		{"CLEAR_AREA_OF_OBJECTS", native_function<LUA_NATIVE_MISC_CLEAR_AREA_OF_OBJECTS>},
+		{"CLEAR_AREA_OF_PEDS", native_function<LUA_NATIVE_MISC_CLEAR_AREA_OF_PEDS>},
+		{"CLEAR_AREA_OF_PROJECTILES", native_function<LUA_NATIVE_MISC_CLEAR_AREA_OF_PROJECTILES>},
+		{"CLEAR_AREA_OF_VEHICLES", native_function<LUA_NATIVE_MISC_CLEAR_AREA_OF_VEHICLES>},
+		{"CLEAR_BIT", native_function<LUA_NATIVE_MISC_CLEAR_BIT>},
+		{"CLEAR_CODE_REQUESTED_AUTOSAVE", native_function<LUA_NATIVE_MISC_CLEAR_CODE_REQUESTED_AUTOSAVE>},
+		{"CLEAR_OVERRIDE_WEATHER", native_function<LUA_NATIVE_MISC_CLEAR_OVERRIDE_WEATHER>},
+		{"CLEAR_REPLAY_STATS", native_function<LUA_NATIVE_MISC_CLEAR_REPLAY_STATS>},
+		{"CLEAR_RESTART_COORD_OVERRIDE", native_function<LUA_NATIVE_MISC_CLEAR_RESTART_COORD_OVERRIDE>},
+		{"CLEAR_SCENARIO_SPAWN_HISTORY", native_function<LUA_NATIVE_MISC_CLEAR_SCENARIO_SPAWN_HISTORY>},
+		{"CLEAR_TACTICAL_NAV_MESH_POINTS", native_function<LUA_NATIVE_MISC_CLEAR_TACTICAL_NAV_MESH_POINTS>},
+		{"CLEAR_WEATHER_TYPE_NOW_PERSIST_NETWORK", native_function<LUA_NATIVE_MISC_CLEAR_WEATHER_TYPE_NOW_PERSIST_NETWORK>},
+		{"CLEAR_WEATHER_TYPE_PERSIST", native_function<LUA_NATIVE_MISC_CLEAR_WEATHER_TYPE_PERSIST>},
+		{"COMPARE_STRINGS", native_function<LUA_NATIVE_MISC_COMPARE_STRINGS>},
+		{"COPY_SCRIPT_STRUCT", native_function<LUA_NATIVE_MISC_COPY_SCRIPT_STRUCT>},
+		{"CREATE_INCIDENT", native_function<LUA_NATIVE_MISC_CREATE_INCIDENT>},
+		{"CREATE_INCIDENT_WITH_ENTITY", native_function<LUA_NATIVE_MISC_CREATE_INCIDENT_WITH_ENTITY>},
+		{"DELETE_INCIDENT", native_function<LUA_NATIVE_MISC_DELETE_INCIDENT>},
+		{"DELETE_STUNT_JUMP", native_function<LUA_NATIVE_MISC_DELETE_STUNT_JUMP>},
+		{"DISABLE_HOSPITAL_RESTART", native_function<LUA_NATIVE_MISC_DISABLE_HOSPITAL_RESTART>},
+		{"DISABLE_POLICE_RESTART", native_function<LUA_NATIVE_MISC_DISABLE_POLICE_RESTART>},
+		{"DISABLE_SCREEN_DIMMING_THIS_FRAME", native_function<LUA_NATIVE_MISC_DISABLE_SCREEN_DIMMING_THIS_FRAME>},
+		{"DISABLE_STUNT_JUMP_SET", native_function<LUA_NATIVE_MISC_DISABLE_STUNT_JUMP_SET>},
+		{"DISPLAY_ONSCREEN_KEYBOARD", native_function<LUA_NATIVE_MISC_DISPLAY_ONSCREEN_KEYBOARD>},
+		{"DISPLAY_ONSCREEN_KEYBOARD_WITH_LONGER_INITIAL_STRING", native_function<LUA_NATIVE_MISC_DISPLAY_ONSCREEN_KEYBOARD_WITH_LONGER_INITIAL_STRING>},
+		{"DOES_POP_MULTIPLIER_AREA_EXIST", native_function<LUA_NATIVE_MISC_DOES_POP_MULTIPLIER_AREA_EXIST>},
+		{"DOES_POP_MULTIPLIER_SPHERE_EXIST", native_function<LUA_NATIVE_MISC_DOES_POP_MULTIPLIER_SPHERE_EXIST>},
+		{"DO_AUTO_SAVE", native_function<LUA_NATIVE_MISC_DO_AUTO_SAVE>},
+		{"ENABLE_DISPATCH_SERVICE", native_function<LUA_NATIVE_MISC_ENABLE_DISPATCH_SERVICE>},
+		{"ENABLE_STUNT_JUMP_SET", native_function<LUA_NATIVE_MISC_ENABLE_STUNT_JUMP_SET>},
+		{"ENABLE_TENNIS_MODE", native_function<LUA_NATIVE_MISC_ENABLE_TENNIS_MODE>},
+		{"END_REPLAY_STATS", native_function<LUA_NATIVE_MISC_END_REPLAY_STATS>},
+		{"FIND_SPAWN_POINT_IN_DIRECTION", native_function<LUA_NATIVE_MISC_FIND_SPAWN_POINT_IN_DIRECTION>},
+		{"FORCE_GAME_STATE_PLAYING", native_function<LUA_NATIVE_MISC_FORCE_GAME_STATE_PLAYING>},
+		{"FORCE_LIGHTNING_FLASH", native_function<LUA_NATIVE_MISC_FORCE_LIGHTNING_FLASH>},
+		{"GET_ALLOCATED_STACK_SIZE", native_function<LUA_NATIVE_MISC_GET_ALLOCATED_STACK_SIZE>},
+		{"GET_ANGLE_BETWEEN_2D_VECTORS", native_function<LUA_NATIVE_MISC_GET_ANGLE_BETWEEN_2D_VECTORS>},
+		{"GET_BASE_ELEMENT_LOCATION_FROM_METADATA_BLOCK", native_function<LUA_NATIVE_MISC_GET_BASE_ELEMENT_LOCATION_FROM_METADATA_BLOCK>},
+		{"GET_BENCHMARK_ITERATIONS", native_function<LUA_NATIVE_MISC_GET_BENCHMARK_ITERATIONS>},
+		{"GET_BENCHMARK_PASS", native_function<LUA_NATIVE_MISC_GET_BENCHMARK_PASS>},
+		{"GET_BITS_IN_RANGE", native_function<LUA_NATIVE_MISC_GET_BITS_IN_RANGE>},
+		{"GET_CITY_DENSITY", native_function<LUA_NATIVE_MISC_GET_CITY_DENSITY>},
+		{"GET_CLOSEST_POINT_ON_LINE", native_function<LUA_NATIVE_MISC_GET_CLOSEST_POINT_ON_LINE>},
+		{"GET_CLOUDS_ALPHA", native_function<LUA_NATIVE_MISC_GET_CLOUDS_ALPHA>},
+		{"GET_CONTENT_ID_INDEX", native_function<LUA_NATIVE_MISC_GET_CONTENT_ID_INDEX>},
+		{"GET_CONTENT_PROP_TYPE_", native_function<LUA_NATIVE_MISC_GET_CONTENT_PROP_TYPE_>},
+		{"GET_CONTENT_TO_LOAD", native_function<LUA_NATIVE_MISC_GET_CONTENT_TO_LOAD>},
+		{"GET_COORDS_OF_PROJECTILE_TYPE_IN_ANGLED_AREA", native_function<LUA_NATIVE_MISC_GET_COORDS_OF_PROJECTILE_TYPE_IN_ANGLED_AREA>},
+		{"GET_COORDS_OF_PROJECTILE_TYPE_IN_AREA", native_function<LUA_NATIVE_MISC_GET_COORDS_OF_PROJECTILE_TYPE_IN_AREA>},
+		{"GET_COORDS_OF_PROJECTILE_TYPE_WITHIN_DISTANCE", native_function<LUA_NATIVE_MISC_GET_COORDS_OF_PROJECTILE_TYPE_WITHIN_DISTANCE>},
+		{"GET_CURR_WEATHER_STATE", native_function<LUA_NATIVE_MISC_GET_CURR_WEATHER_STATE>},
+		{"GET_DISTANCE_BETWEEN_COORDS", native_function<LUA_NATIVE_MISC_GET_DISTANCE_BETWEEN_COORDS>},
+		{"GET_FAKE_WANTED_LEVEL", native_function<LUA_NATIVE_MISC_GET_FAKE_WANTED_LEVEL>},
+		{"GET_FRAME_COUNT", native_function<LUA_NATIVE_MISC_GET_FRAME_COUNT>},
+		{"GET_FRAME_TIME", native_function<LUA_NATIVE_MISC_GET_FRAME_TIME>},
+		{"GET_GAME_TIMER", native_function<LUA_NATIVE_MISC_GET_GAME_TIMER>},
+		{"GET_GROUND_Z_AND_NORMAL_FOR_3D_COORD", native_function<LUA_NATIVE_MISC_GET_GROUND_Z_AND_NORMAL_FOR_3D_COORD>},
+		{"GET_GROUND_Z_EXCLUDING_OBJECTS_FOR_3D_COORD", native_function<LUA_NATIVE_MISC_GET_GROUND_Z_EXCLUDING_OBJECTS_FOR_3D_COORD>},
+		{"GET_GROUND_Z_FOR_3D_COORD", native_function<LUA_NATIVE_MISC_GET_GROUND_Z_FOR_3D_COORD>},
+		{"GET_HASH_KEY", native_function<LUA_NATIVE_MISC_GET_HASH_KEY>},
+		{"GET_HEADING_FROM_VECTOR_2D", native_function<LUA_NATIVE_MISC_GET_HEADING_FROM_VECTOR_2D>},
+		{"GET_INDEX_OF_CURRENT_LEVEL", native_function<LUA_NATIVE_MISC_GET_INDEX_OF_CURRENT_LEVEL>},
+		{"GET_IS_AUTO_SAVE_OFF", native_function<LUA_NATIVE_MISC_GET_IS_AUTO_SAVE_OFF>},
+		{"GET_IS_PLAYER_IN_ANIMAL_FORM", native_function<LUA_NATIVE_MISC_GET_IS_PLAYER_IN_ANIMAL_FORM>},
+		{"GET_LINE_PLANE_INTERSECTION", native_function<LUA_NATIVE_MISC_GET_LINE_PLANE_INTERSECTION>},
+		{"GET_MISSION_FLAG", native_function<LUA_NATIVE_MISC_GET_MISSION_FLAG>},
+		{"GET_MODEL_DIMENSIONS", native_function<LUA_NATIVE_MISC_GET_MODEL_DIMENSIONS>},
+		{"GET_NEXT_WEATHER_TYPE_HASH_NAME", native_function<LUA_NATIVE_MISC_GET_NEXT_WEATHER_TYPE_HASH_NAME>},
+		{"GET_NUMBER_OF_FREE_STACKS_OF_THIS_SIZE", native_function<LUA_NATIVE_MISC_GET_NUMBER_OF_FREE_STACKS_OF_THIS_SIZE>},
+		{"GET_NUMBER_RESOURCES_ALLOCATED_TO_WANTED_LEVEL", native_function<LUA_NATIVE_MISC_GET_NUMBER_RESOURCES_ALLOCATED_TO_WANTED_LEVEL>},
+		{"GET_NUM_SUCCESSFUL_STUNT_JUMPS", native_function<LUA_NATIVE_MISC_GET_NUM_SUCCESSFUL_STUNT_JUMPS>},
+		{"GET_ONSCREEN_KEYBOARD_RESULT", native_function<LUA_NATIVE_MISC_GET_ONSCREEN_KEYBOARD_RESULT>},
+		{"GET_POINT_AREA_OVERLAP", native_function<LUA_NATIVE_MISC_GET_POINT_AREA_OVERLAP>},
+		{"GET_PREV_WEATHER_TYPE_HASH_NAME", native_function<LUA_NATIVE_MISC_GET_PREV_WEATHER_TYPE_HASH_NAME>},
+		{"GET_PROFILE_SETTING", native_function<LUA_NATIVE_MISC_GET_PROFILE_SETTING>},
+		{"GET_PROJECTILE_OF_PROJECTILE_TYPE_WITHIN_DISTANCE", native_function<LUA_NATIVE_MISC_GET_PROJECTILE_OF_PROJECTILE_TYPE_WITHIN_DISTANCE>},
+		{"GET_RAIN_LEVEL", native_function<LUA_NATIVE_MISC_GET_RAIN_LEVEL>},
+		{"GET_RANDOM_EVENT_FLAG", native_function<LUA_NATIVE_MISC_GET_RANDOM_EVENT_FLAG>},
+		{"GET_RANDOM_FLOAT_IN_RANGE", native_function<LUA_NATIVE_MISC_GET_RANDOM_FLOAT_IN_RANGE>},
+		{"GET_RANDOM_INT_IN_RANGE", native_function<LUA_NATIVE_MISC_GET_RANDOM_INT_IN_RANGE>},
+		{"GET_RANDOM_MWC_INT_IN_RANGE", native_function<LUA_NATIVE_MISC_GET_RANDOM_MWC_INT_IN_RANGE>},
+		{"GET_RATIO_OF_CLOSEST_POINT_ON_LINE", native_function<LUA_NATIVE_MISC_GET_RATIO_OF_CLOSEST_POINT_ON_LINE>},
+		{"GET_REAL_WORLD_TIME", native_function<LUA_NATIVE_MISC_GET_REAL_WORLD_TIME>},
+		{"GET_REPLAY_STAT_AT_INDEX", native_function<LUA_NATIVE_MISC_GET_REPLAY_STAT_AT_INDEX>},
+		{"GET_REPLAY_STAT_COUNT", native_function<LUA_NATIVE_MISC_GET_REPLAY_STAT_COUNT>},
+		{"GET_REPLAY_STAT_MISSION_ID", native_function<LUA_NATIVE_MISC_GET_REPLAY_STAT_MISSION_ID>},
+		{"GET_REPLAY_STAT_MISSION_TYPE", native_function<LUA_NATIVE_MISC_GET_REPLAY_STAT_MISSION_TYPE>},
+		{"GET_SAVE_HOUSE_DETAILS_AFTER_SUCCESSFUL_LOAD", native_function<LUA_NATIVE_MISC_GET_SAVE_HOUSE_DETAILS_AFTER_SUCCESSFUL_LOAD>},
+		{"GET_SIZE_OF_SAVE_DATA", native_function<LUA_NATIVE_MISC_GET_SIZE_OF_SAVE_DATA>},
+		{"GET_SNOW_LEVEL", native_function<LUA_NATIVE_MISC_GET_SNOW_LEVEL>},
+		{"GET_STATUS_OF_MANUAL_SAVE", native_function<LUA_NATIVE_MISC_GET_STATUS_OF_MANUAL_SAVE>},
+		{"GET_STATUS_OF_MISSION_REPEAT_SAVE", native_function<LUA_NATIVE_MISC_GET_STATUS_OF_MISSION_REPEAT_SAVE>},
+		{"GET_SYSTEM_TIME_STEP", native_function<LUA_NATIVE_MISC_GET_SYSTEM_TIME_STEP>},
+		{"GET_TENNIS_SWING_ANIM_CAN_BE_INTERRUPTED", native_function<LUA_NATIVE_MISC_GET_TENNIS_SWING_ANIM_CAN_BE_INTERRUPTED>},
+		{"GET_TENNIS_SWING_ANIM_COMPLETE", native_function<LUA_NATIVE_MISC_GET_TENNIS_SWING_ANIM_COMPLETE>},
+		{"GET_TENNIS_SWING_ANIM_SWUNG", native_function<LUA_NATIVE_MISC_GET_TENNIS_SWING_ANIM_SWUNG>},
+		{"GET_TOTAL_SUCCESSFUL_STUNT_JUMPS", native_function<LUA_NATIVE_MISC_GET_TOTAL_SUCCESSFUL_STUNT_JUMPS>},
+		{"GET_WIND_DIRECTION", native_function<LUA_NATIVE_MISC_GET_WIND_DIRECTION>},
+		{"GET_WIND_SPEED", native_function<LUA_NATIVE_MISC_GET_WIND_SPEED>},
+		{"HAS_ASYNC_INSTALL_FINISHED", native_function<LUA_NATIVE_MISC_HAS_ASYNC_INSTALL_FINISHED>},
+		{"HAS_BULLET_IMPACTED_IN_AREA", native_function<LUA_NATIVE_MISC_HAS_BULLET_IMPACTED_IN_AREA>},
+		{"HAS_BULLET_IMPACTED_IN_BOX", native_function<LUA_NATIVE_MISC_HAS_BULLET_IMPACTED_IN_BOX>},
+		{"HAS_CHEAT_WITH_HASH_BEEN_ACTIVATED", native_function<LUA_NATIVE_MISC_HAS_CHEAT_WITH_HASH_BEEN_ACTIVATED>},
+		{"HAS_CODE_REQUESTED_AUTOSAVE", native_function<LUA_NATIVE_MISC_HAS_CODE_REQUESTED_AUTOSAVE>},
+		{"HAS_GAME_INSTALLED_THIS_SESSION", native_function<LUA_NATIVE_MISC_HAS_GAME_INSTALLED_THIS_SESSION>},
+		{"HAS_PC_CHEAT_WITH_HASH_BEEN_ACTIVATED", native_function<LUA_NATIVE_MISC_HAS_PC_CHEAT_WITH_HASH_BEEN_ACTIVATED>},
+		{"HAS_RESUMED_FROM_SUSPEND", native_function<LUA_NATIVE_MISC_HAS_RESUMED_FROM_SUSPEND>},
+		{"HAVE_CREDITS_REACHED_END", native_function<LUA_NATIVE_MISC_HAVE_CREDITS_REACHED_END>},
+		{"HAVE_REPLAY_STATS_BEEN_STORED", native_function<LUA_NATIVE_MISC_HAVE_REPLAY_STATS_BEEN_STORED>},
+		{"IGNORE_NEXT_RESTART", native_function<LUA_NATIVE_MISC_IGNORE_NEXT_RESTART>},
+		{"INFORM_CODE_OF_CONTENT_ID_OF_CURRENT_UGC_MISSION", native_function<LUA_NATIVE_MISC_INFORM_CODE_OF_CONTENT_ID_OF_CURRENT_UGC_MISSION>},
+		{"IS_AREA_OCCUPIED", native_function<LUA_NATIVE_MISC_IS_AREA_OCCUPIED>},
+		{"IS_AREA_OCCUPIED_SLOW", native_function<LUA_NATIVE_MISC_IS_AREA_OCCUPIED_SLOW>},
+		{"IS_AUSSIE_VERSION", native_function<LUA_NATIVE_MISC_IS_AUSSIE_VERSION>},
+		{"IS_AUTO_SAVE_IN_PROGRESS", native_function<LUA_NATIVE_MISC_IS_AUTO_SAVE_IN_PROGRESS>},
+		{"IS_BULLET_IN_ANGLED_AREA", native_function<LUA_NATIVE_MISC_IS_BULLET_IN_ANGLED_AREA>},
+		{"IS_BULLET_IN_AREA", native_function<LUA_NATIVE_MISC_IS_BULLET_IN_AREA>},
+		{"IS_BULLET_IN_BOX", native_function<LUA_NATIVE_MISC_IS_BULLET_IN_BOX>},
+		{"IS_COMMANDLINE_END_USER_BENCHMARK", native_function<LUA_NATIVE_MISC_IS_COMMANDLINE_END_USER_BENCHMARK>},
+		{"IS_DURANGO_VERSION", native_function<LUA_NATIVE_MISC_IS_DURANGO_VERSION>},
+		{"IS_FRONTEND_FADING", native_function<LUA_NATIVE_MISC_IS_FRONTEND_FADING>},
+		{"IS_INCIDENT_VALID", native_function<LUA_NATIVE_MISC_IS_INCIDENT_VALID>},
+		{"IS_JAPANESE_VERSION", native_function<LUA_NATIVE_MISC_IS_JAPANESE_VERSION>},
+		{"IS_MEMORY_CARD_IN_USE", native_function<LUA_NATIVE_MISC_IS_MEMORY_CARD_IN_USE>},
+		{"IS_MINIGAME_IN_PROGRESS", native_function<LUA_NATIVE_MISC_IS_MINIGAME_IN_PROGRESS>},
+		{"IS_NEXT_WEATHER_TYPE", native_function<LUA_NATIVE_MISC_IS_NEXT_WEATHER_TYPE>},
+		{"IS_ORBIS_VERSION", native_function<LUA_NATIVE_MISC_IS_ORBIS_VERSION>},
+		{"IS_PC_VERSION", native_function<LUA_NATIVE_MISC_IS_PC_VERSION>},
+		{"IS_POINT_OBSCURED_BY_A_MISSION_ENTITY", native_function<LUA_NATIVE_MISC_IS_POINT_OBSCURED_BY_A_MISSION_ENTITY>},
+		{"IS_POP_MULTIPLIER_AREA_NETWORKED", native_function<LUA_NATIVE_MISC_IS_POP_MULTIPLIER_AREA_NETWORKED>},
+		{"IS_POSITION_OCCUPIED", native_function<LUA_NATIVE_MISC_IS_POSITION_OCCUPIED>},
+		{"IS_PREV_WEATHER_TYPE", native_function<LUA_NATIVE_MISC_IS_PREV_WEATHER_TYPE>},
+		{"IS_PROJECTILE_IN_AREA", native_function<LUA_NATIVE_MISC_IS_PROJECTILE_IN_AREA>},
+		{"IS_PROJECTILE_TYPE_IN_ANGLED_AREA", native_function<LUA_NATIVE_MISC_IS_PROJECTILE_TYPE_IN_ANGLED_AREA>},
+		{"IS_PROJECTILE_TYPE_IN_AREA", native_function<LUA_NATIVE_MISC_IS_PROJECTILE_TYPE_IN_AREA>},
+		{"IS_PROJECTILE_TYPE_WITHIN_DISTANCE", native_function<LUA_NATIVE_MISC_IS_PROJECTILE_TYPE_WITHIN_DISTANCE>},
+		{"IS_PROSPERO_VERSION", native_function<LUA_NATIVE_MISC_IS_PROSPERO_VERSION>},
+		{"IS_PS3_VERSION", native_function<LUA_NATIVE_MISC_IS_PS3_VERSION>},
+		{"IS_SCARLETT_VERSION", native_function<LUA_NATIVE_MISC_IS_SCARLETT_VERSION>},
+		{"IS_SCE_PLATFORM", native_function<LUA_NATIVE_MISC_IS_SCE_PLATFORM>},
+		{"IS_SNIPER_BULLET_IN_AREA", native_function<LUA_NATIVE_MISC_IS_SNIPER_BULLET_IN_AREA>},
+		{"IS_SNIPER_INVERTED", native_function<LUA_NATIVE_MISC_IS_SNIPER_INVERTED>},
+		{"IS_STEAM_VERSION", native_function<LUA_NATIVE_MISC_IS_STEAM_VERSION>},
+		{"IS_STRING_NULL", native_function<LUA_NATIVE_MISC_IS_STRING_NULL>},
+		{"IS_STRING_NULL_OR_EMPTY", native_function<LUA_NATIVE_MISC_IS_STRING_NULL_OR_EMPTY>},
+		{"IS_STUNT_JUMP_IN_PROGRESS", native_function<LUA_NATIVE_MISC_IS_STUNT_JUMP_IN_PROGRESS>},
+		{"IS_STUNT_JUMP_MESSAGE_SHOWING", native_function<LUA_NATIVE_MISC_IS_STUNT_JUMP_MESSAGE_SHOWING>},
+		{"IS_TENNIS_MODE", native_function<LUA_NATIVE_MISC_IS_TENNIS_MODE>},
+		{"IS_THIS_A_MINIGAME_SCRIPT", native_function<LUA_NATIVE_MISC_IS_THIS_A_MINIGAME_SCRIPT>},
+		{"IS_XBOX360_VERSION", native_function<LUA_NATIVE_MISC_IS_XBOX360_VERSION>},
+		{"IS_XBOX_PLATFORM", native_function<LUA_NATIVE_MISC_IS_XBOX_PLATFORM>},
+		{"LANDING_SCREEN_STARTED_END_USER_BENCHMARK", native_function<LUA_NATIVE_MISC_LANDING_SCREEN_STARTED_END_USER_BENCHMARK>},
+		{"LOAD_CLOUD_HAT", native_function<LUA_NATIVE_MISC_LOAD_CLOUD_HAT>},
+		{"NETWORK_SET_SCRIPT_IS_SAFE_FOR_NETWORK_GAME", native_function<LUA_NATIVE_MISC_NETWORK_SET_SCRIPT_IS_SAFE_FOR_NETWORK_GAME>},
+		{"NEXT_ONSCREEN_KEYBOARD_RESULT_WILL_DISPLAY_USING_THESE_FONTS", native_function<LUA_NATIVE_MISC_NEXT_ONSCREEN_KEYBOARD_RESULT_WILL_DISPLAY_USING_THESE_FONTS>},
+		{"OVERRIDE_FREEZE_FLAGS", native_function<LUA_NATIVE_MISC_OVERRIDE_FREEZE_FLAGS>},
+		{"OVERRIDE_SAVE_HOUSE", native_function<LUA_NATIVE_MISC_OVERRIDE_SAVE_HOUSE>},
+		{"PAUSE_DEATH_ARREST_RESTART", native_function<LUA_NATIVE_MISC_PAUSE_DEATH_ARREST_RESTART>},
+		{"PLAY_TENNIS_DIVE_ANIM", native_function<LUA_NATIVE_MISC_PLAY_TENNIS_DIVE_ANIM>},
+		{"PLAY_TENNIS_SWING_ANIM", native_function<LUA_NATIVE_MISC_PLAY_TENNIS_SWING_ANIM>},
+		{"PLM_GET_CONSTRAINED_DURATION_MS", native_function<LUA_NATIVE_MISC_PLM_GET_CONSTRAINED_DURATION_MS>},
+		{"PLM_IS_IN_CONSTRAINED_MODE", native_function<LUA_NATIVE_MISC_PLM_IS_IN_CONSTRAINED_MODE>},
+		{"POPULATE_NOW", native_function<LUA_NATIVE_MISC_POPULATE_NOW>},
+		{"PRELOAD_CLOUD_HAT", native_function<LUA_NATIVE_MISC_PRELOAD_CLOUD_HAT>},
+		{"PREVENT_ARREST_STATE_THIS_FRAME", native_function<LUA_NATIVE_MISC_PREVENT_ARREST_STATE_THIS_FRAME>},
+		{"QUEUE_MISSION_REPEAT_LOAD", native_function<LUA_NATIVE_MISC_QUEUE_MISSION_REPEAT_LOAD>},
+		{"QUEUE_MISSION_REPEAT_SAVE", native_function<LUA_NATIVE_MISC_QUEUE_MISSION_REPEAT_SAVE>},
+		{"QUEUE_MISSION_REPEAT_SAVE_FOR_BENCHMARK_TEST", native_function<LUA_NATIVE_MISC_QUEUE_MISSION_REPEAT_SAVE_FOR_BENCHMARK_TEST>},
+		{"QUIT_GAME", native_function<LUA_NATIVE_MISC_QUIT_GAME>},
+		{"REGISTER_BOOL_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_BOOL_TO_SAVE>},
+		{"REGISTER_ENUM_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_ENUM_TO_SAVE>},
+		{"REGISTER_FLOAT_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_FLOAT_TO_SAVE>},
+		{"REGISTER_INT64_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_INT64_TO_SAVE>},
+		{"REGISTER_INT_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_INT_TO_SAVE>},
+		{"REGISTER_SAVE_HOUSE", native_function<LUA_NATIVE_MISC_REGISTER_SAVE_HOUSE>},
+		{"REGISTER_TEXT_LABEL_15_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_15_TO_SAVE>},
+		{"REGISTER_TEXT_LABEL_23_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_23_TO_SAVE>},
+		{"REGISTER_TEXT_LABEL_31_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_31_TO_SAVE>},
+		{"REGISTER_TEXT_LABEL_63_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_63_TO_SAVE>},
+		{"REGISTER_TEXT_LABEL_TO_SAVE", native_function<LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_TO_SAVE>},
+		{"REMOVE_DISPATCH_SPAWN_BLOCKING_AREA", native_function<LUA_NATIVE_MISC_REMOVE_DISPATCH_SPAWN_BLOCKING_AREA>},
+		{"REMOVE_POP_MULTIPLIER_AREA", native_function<LUA_NATIVE_MISC_REMOVE_POP_MULTIPLIER_AREA>},
+		{"REMOVE_POP_MULTIPLIER_SPHERE", native_function<LUA_NATIVE_MISC_REMOVE_POP_MULTIPLIER_SPHERE>},
+		{"RESET_DISPATCH_IDEAL_SPAWN_DISTANCE", native_function<LUA_NATIVE_MISC_RESET_DISPATCH_IDEAL_SPAWN_DISTANCE>},
+		{"RESET_DISPATCH_SPAWN_BLOCKING_AREAS", native_function<LUA_NATIVE_MISC_RESET_DISPATCH_SPAWN_BLOCKING_AREAS>},
+		{"RESET_DISPATCH_SPAWN_LOCATION", native_function<LUA_NATIVE_MISC_RESET_DISPATCH_SPAWN_LOCATION>},
+		{"RESET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS", native_function<LUA_NATIVE_MISC_RESET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS>},
+		{"RESET_END_USER_BENCHMARK", native_function<LUA_NATIVE_MISC_RESET_END_USER_BENCHMARK>},
+		{"RESET_WANTED_RESPONSE_NUM_PEDS_TO_SPAWN", native_function<LUA_NATIVE_MISC_RESET_WANTED_RESPONSE_NUM_PEDS_TO_SPAWN>},
+		{"RESTART_GAME", native_function<LUA_NATIVE_MISC_RESTART_GAME>},
+		{"SAVE_END_USER_BENCHMARK", native_function<LUA_NATIVE_MISC_SAVE_END_USER_BENCHMARK>},
+		{"SCRIPT_RACE_GET_PLAYER_SPLIT_TIME", native_function<LUA_NATIVE_MISC_SCRIPT_RACE_GET_PLAYER_SPLIT_TIME>},
+		{"SCRIPT_RACE_INIT", native_function<LUA_NATIVE_MISC_SCRIPT_RACE_INIT>},
+		{"SCRIPT_RACE_PLAYER_HIT_CHECKPOINT", native_function<LUA_NATIVE_MISC_SCRIPT_RACE_PLAYER_HIT_CHECKPOINT>},
+		{"SCRIPT_RACE_SHUTDOWN", native_function<LUA_NATIVE_MISC_SCRIPT_RACE_SHUTDOWN>},
+		{"SET_BEAST_JUMP_THIS_FRAME", native_function<LUA_NATIVE_MISC_SET_BEAST_JUMP_THIS_FRAME>},
+		{"SET_BIT", native_function<LUA_NATIVE_MISC_SET_BIT>},
+		{"SET_BITS_IN_RANGE", native_function<LUA_NATIVE_MISC_SET_BITS_IN_RANGE>},
+		{"SET_CLOUDS_ALPHA", native_function<LUA_NATIVE_MISC_SET_CLOUDS_ALPHA>},
+		{"SET_CLOUD_SETTINGS_OVERRIDE", native_function<LUA_NATIVE_MISC_SET_CLOUD_SETTINGS_OVERRIDE>},
+		{"SET_CONTENT_ID_INDEX", native_function<LUA_NATIVE_MISC_SET_CONTENT_ID_INDEX>},
+		{"SET_CONTENT_PROP_TYPE_", native_function<LUA_NATIVE_MISC_SET_CONTENT_PROP_TYPE_>},
+		{"SET_CREDITS_ACTIVE", native_function<LUA_NATIVE_MISC_SET_CREDITS_ACTIVE>},
+		{"SET_CREDITS_FADE_OUT_WITH_SCREEN", native_function<LUA_NATIVE_MISC_SET_CREDITS_FADE_OUT_WITH_SCREEN>},
+		{"SET_CURR_WEATHER_STATE", native_function<LUA_NATIVE_MISC_SET_CURR_WEATHER_STATE>},
+		{"SET_DISPATCH_IDEAL_SPAWN_DISTANCE", native_function<LUA_NATIVE_MISC_SET_DISPATCH_IDEAL_SPAWN_DISTANCE>},
+		{"SET_DISPATCH_SPAWN_LOCATION", native_function<LUA_NATIVE_MISC_SET_DISPATCH_SPAWN_LOCATION>},
+		{"SET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS", native_function<LUA_NATIVE_MISC_SET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS>},
+		{"SET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS_MULTIPLIER", native_function<LUA_NATIVE_MISC_SET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS_MULTIPLIER>},
+		{"SET_EXPLOSIVE_AMMO_THIS_FRAME", native_function<LUA_NATIVE_MISC_SET_EXPLOSIVE_AMMO_THIS_FRAME>},
+		{"SET_EXPLOSIVE_MELEE_THIS_FRAME", native_function<LUA_NATIVE_MISC_SET_EXPLOSIVE_MELEE_THIS_FRAME>},
+		{"SET_FADE_IN_AFTER_DEATH_ARREST", native_function<LUA_NATIVE_MISC_SET_FADE_IN_AFTER_DEATH_ARREST>},
+		{"SET_FADE_IN_AFTER_LOAD", native_function<LUA_NATIVE_MISC_SET_FADE_IN_AFTER_LOAD>},
+		{"SET_FADE_OUT_AFTER_ARREST", native_function<LUA_NATIVE_MISC_SET_FADE_OUT_AFTER_ARREST>},
+		{"SET_FADE_OUT_AFTER_DEATH", native_function<LUA_NATIVE_MISC_SET_FADE_OUT_AFTER_DEATH>},
+		{"SET_FAKE_WANTED_LEVEL", native_function<LUA_NATIVE_MISC_SET_FAKE_WANTED_LEVEL>},
+		{"SET_FIRE_AMMO_THIS_FRAME", native_function<LUA_NATIVE_MISC_SET_FIRE_AMMO_THIS_FRAME>},
+		{"SET_FORCED_JUMP_THIS_FRAME", native_function<LUA_NATIVE_MISC_SET_FORCED_JUMP_THIS_FRAME>},
+		{"SET_GAME_PAUSED", native_function<LUA_NATIVE_MISC_SET_GAME_PAUSED>},
+		{"SET_GRAVITY_LEVEL", native_function<LUA_NATIVE_MISC_SET_GRAVITY_LEVEL>},
+		{"SET_IDEAL_SPAWN_DISTANCE_FOR_INCIDENT", native_function<LUA_NATIVE_MISC_SET_IDEAL_SPAWN_DISTANCE_FOR_INCIDENT>},
+		{"SET_INCIDENT_REQUESTED_UNITS", native_function<LUA_NATIVE_MISC_SET_INCIDENT_REQUESTED_UNITS>},
+		{"SET_INSTANCE_PRIORITY_HINT", native_function<LUA_NATIVE_MISC_SET_INSTANCE_PRIORITY_HINT>},
+		{"SET_INSTANCE_PRIORITY_MODE", native_function<LUA_NATIVE_MISC_SET_INSTANCE_PRIORITY_MODE>},
+		{"SET_MINIGAME_IN_PROGRESS", native_function<LUA_NATIVE_MISC_SET_MINIGAME_IN_PROGRESS>},
+		{"SET_MISSION_FLAG", native_function<LUA_NATIVE_MISC_SET_MISSION_FLAG>},
+		{"SET_OVERRIDE_WEATHER", native_function<LUA_NATIVE_MISC_SET_OVERRIDE_WEATHER>},
+		{"SET_OVERRIDE_WEATHEREX", native_function<LUA_NATIVE_MISC_SET_OVERRIDE_WEATHEREX>},
+		{"SET_PLAYER_IS_IN_ANIMAL_FORM", native_function<LUA_NATIVE_MISC_SET_PLAYER_IS_IN_ANIMAL_FORM>},
+		{"SET_PLAYER_IS_REPEATING_A_MISSION", native_function<LUA_NATIVE_MISC_SET_PLAYER_IS_REPEATING_A_MISSION>},
+		{"SET_RAIN", native_function<LUA_NATIVE_MISC_SET_RAIN>},
+		{"SET_RANDOM_EVENT_FLAG", native_function<LUA_NATIVE_MISC_SET_RANDOM_EVENT_FLAG>},
+		{"SET_RANDOM_SEED", native_function<LUA_NATIVE_MISC_SET_RANDOM_SEED>},
+		{"SET_RANDOM_WEATHER_TYPE", native_function<LUA_NATIVE_MISC_SET_RANDOM_WEATHER_TYPE>},
+		{"SET_RESTART_COORD_OVERRIDE", native_function<LUA_NATIVE_MISC_SET_RESTART_COORD_OVERRIDE>},
+		{"SET_RIOT_MODE_ENABLED", native_function<LUA_NATIVE_MISC_SET_RIOT_MODE_ENABLED>},
+		{"SET_SAVE_HOUSE", native_function<LUA_NATIVE_MISC_SET_SAVE_HOUSE>},
+		{"SET_SAVE_MENU_ACTIVE", native_function<LUA_NATIVE_MISC_SET_SAVE_MENU_ACTIVE>},
+		{"SET_SCRIPT_HIGH_PRIO", native_function<LUA_NATIVE_MISC_SET_SCRIPT_HIGH_PRIO>},
+		{"SET_SNOW", native_function<LUA_NATIVE_MISC_SET_SNOW>},
+		{"SET_STUNT_JUMPS_CAN_TRIGGER", native_function<LUA_NATIVE_MISC_SET_STUNT_JUMPS_CAN_TRIGGER>},
+		{"SET_SUPER_JUMP_THIS_FRAME", native_function<LUA_NATIVE_MISC_SET_SUPER_JUMP_THIS_FRAME>},
+		{"SET_TENNIS_MOVE_NETWORK_SIGNAL_FLOAT", native_function<LUA_NATIVE_MISC_SET_TENNIS_MOVE_NETWORK_SIGNAL_FLOAT>},
+		{"SET_THIS_IS_A_TRIGGER_SCRIPT", native_function<LUA_NATIVE_MISC_SET_THIS_IS_A_TRIGGER_SCRIPT>},
+		{"SET_THIS_SCRIPT_CAN_BE_PAUSED", native_function<LUA_NATIVE_MISC_SET_THIS_SCRIPT_CAN_BE_PAUSED>},
+		{"SET_THIS_SCRIPT_CAN_REMOVE_BLIPS_CREATED_BY_ANY_SCRIPT", native_function<LUA_NATIVE_MISC_SET_THIS_SCRIPT_CAN_REMOVE_BLIPS_CREATED_BY_ANY_SCRIPT>},
+		{"SET_TICKER_JOHNMARSTON_IS_DONE", native_function<LUA_NATIVE_MISC_SET_TICKER_JOHNMARSTON_IS_DONE>},
+		{"SET_TIME_SCALE", native_function<LUA_NATIVE_MISC_SET_TIME_SCALE>},
+		{"SET_WANTED_RESPONSE_NUM_PEDS_TO_SPAWN", native_function<LUA_NATIVE_MISC_SET_WANTED_RESPONSE_NUM_PEDS_TO_SPAWN>},
+		{"SET_WEATHER_TYPE_NOW", native_function<LUA_NATIVE_MISC_SET_WEATHER_TYPE_NOW>},
+		{"SET_WEATHER_TYPE_NOW_PERSIST", native_function<LUA_NATIVE_MISC_SET_WEATHER_TYPE_NOW_PERSIST>},
+		{"SET_WEATHER_TYPE_OVERTIME_PERSIST", native_function<LUA_NATIVE_MISC_SET_WEATHER_TYPE_OVERTIME_PERSIST>},
+		{"SET_WEATHER_TYPE_PERSIST", native_function<LUA_NATIVE_MISC_SET_WEATHER_TYPE_PERSIST>},
+		{"SET_WIND", native_function<LUA_NATIVE_MISC_SET_WIND>},
+		{"SET_WIND_DIRECTION", native_function<LUA_NATIVE_MISC_SET_WIND_DIRECTION>},
+		{"SET_WIND_SPEED", native_function<LUA_NATIVE_MISC_SET_WIND_SPEED>},
+		{"SHOOT_SINGLE_BULLET_BETWEEN_COORDS", native_function<LUA_NATIVE_MISC_SHOOT_SINGLE_BULLET_BETWEEN_COORDS>},
+		{"SHOOT_SINGLE_BULLET_BETWEEN_COORDS_IGNORE_ENTITY", native_function<LUA_NATIVE_MISC_SHOOT_SINGLE_BULLET_BETWEEN_COORDS_IGNORE_ENTITY>},
+		{"SHOOT_SINGLE_BULLET_BETWEEN_COORDS_IGNORE_ENTITY_NEW", native_function<LUA_NATIVE_MISC_SHOOT_SINGLE_BULLET_BETWEEN_COORDS_IGNORE_ENTITY_NEW>},
+		{"SHOULD_USE_METRIC_MEASUREMENTS", native_function<LUA_NATIVE_MISC_SHOULD_USE_METRIC_MEASUREMENTS>},
+		{"SLERP_NEAR_QUATERNION", native_function<LUA_NATIVE_MISC_SLERP_NEAR_QUATERNION>},
+		{"START_END_USER_BENCHMARK", native_function<LUA_NATIVE_MISC_START_END_USER_BENCHMARK>},
+		{"START_SAVE_ARRAY_WITH_SIZE", native_function<LUA_NATIVE_MISC_START_SAVE_ARRAY_WITH_SIZE>},
+		{"START_SAVE_DATA", native_function<LUA_NATIVE_MISC_START_SAVE_DATA>},
+		{"START_SAVE_STRUCT_WITH_SIZE", native_function<LUA_NATIVE_MISC_START_SAVE_STRUCT_WITH_SIZE>},
+		{"STOP_END_USER_BENCHMARK", native_function<LUA_NATIVE_MISC_STOP_END_USER_BENCHMARK>},
+		{"STOP_SAVE_ARRAY", native_function<LUA_NATIVE_MISC_STOP_SAVE_ARRAY>},
+		{"STOP_SAVE_DATA", native_function<LUA_NATIVE_MISC_STOP_SAVE_DATA>},
+		{"STOP_SAVE_STRUCT", native_function<LUA_NATIVE_MISC_STOP_SAVE_STRUCT>},
+		{"STRING_TO_INT", native_function<LUA_NATIVE_MISC_STRING_TO_INT>},
+		{"SUPRESS_RANDOM_EVENT_THIS_FRAME", native_function<LUA_NATIVE_MISC_SUPRESS_RANDOM_EVENT_THIS_FRAME>},
+		{"TAN", native_function<LUA_NATIVE_MISC_TAN>},
+		{"TERMINATE_ALL_SCRIPTS_WITH_THIS_NAME", native_function<LUA_NATIVE_MISC_TERMINATE_ALL_SCRIPTS_WITH_THIS_NAME>},
+		{"TOGGLE_SHOW_OPTIONAL_STUNT_JUMP_CAMERA", native_function<LUA_NATIVE_MISC_TOGGLE_SHOW_OPTIONAL_STUNT_JUMP_CAMERA>},
+		{"UI_STARTED_END_USER_BENCHMARK", native_function<LUA_NATIVE_MISC_UI_STARTED_END_USER_BENCHMARK>},
+		{"UNLOAD_ALL_CLOUD_HATS", native_function<LUA_NATIVE_MISC_UNLOAD_ALL_CLOUD_HATS>},
+		{"UNLOAD_CLOUD_HAT", native_function<LUA_NATIVE_MISC_UNLOAD_CLOUD_HAT>},
+		{"UPDATE_ONSCREEN_KEYBOARD", native_function<LUA_NATIVE_MISC_UPDATE_ONSCREEN_KEYBOARD>},
+		{"USE_ACTIVE_CAMERA_FOR_TIMESLICING_CENTRE", native_function<LUA_NATIVE_MISC_USE_ACTIVE_CAMERA_FOR_TIMESLICING_CENTRE>},
+		{"USING_MISSION_CREATOR", native_function<LUA_NATIVE_MISC_USING_MISSION_CREATOR>},
+		{"WATER_OVERRIDE_FADE_IN", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_FADE_IN>},
+		{"WATER_OVERRIDE_FADE_OUT", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_FADE_OUT>},
+		{"WATER_OVERRIDE_SET_OCEANNOISEMINAMPLITUDE", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_OCEANNOISEMINAMPLITUDE>},
+		{"WATER_OVERRIDE_SET_OCEANWAVEAMPLITUDE", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_OCEANWAVEAMPLITUDE>},
+		{"WATER_OVERRIDE_SET_OCEANWAVEMAXAMPLITUDE", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_OCEANWAVEMAXAMPLITUDE>},
+		{"WATER_OVERRIDE_SET_OCEANWAVEMINAMPLITUDE", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_OCEANWAVEMINAMPLITUDE>},
+		{"WATER_OVERRIDE_SET_RIPPLEBUMPINESS", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_RIPPLEBUMPINESS>},
+		{"WATER_OVERRIDE_SET_RIPPLEDISTURB", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_RIPPLEDISTURB>},
+		{"WATER_OVERRIDE_SET_RIPPLEMAXBUMPINESS", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_RIPPLEMAXBUMPINESS>},
+		{"WATER_OVERRIDE_SET_RIPPLEMINBUMPINESS", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_RIPPLEMINBUMPINESS>},
+		{"WATER_OVERRIDE_SET_SHOREWAVEAMPLITUDE", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_SHOREWAVEAMPLITUDE>},
+		{"WATER_OVERRIDE_SET_SHOREWAVEMAXAMPLITUDE", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_SHOREWAVEMAXAMPLITUDE>},
+		{"WATER_OVERRIDE_SET_SHOREWAVEMINAMPLITUDE", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_SHOREWAVEMINAMPLITUDE>},
+		{"WATER_OVERRIDE_SET_STRENGTH", native_function<LUA_NATIVE_MISC_WATER_OVERRIDE_SET_STRENGTH>},
+	};
+
 	void init_native_binding_MISC(sol::state& L)
 	{
-		auto MISC = L["MISC"].get_or_create<sol::table>();
-		MISC.set_function("GET_ALLOCATED_STACK_SIZE", LUA_NATIVE_MISC_GET_ALLOCATED_STACK_SIZE);
-		MISC.set_function("GET_NUMBER_OF_FREE_STACKS_OF_THIS_SIZE", LUA_NATIVE_MISC_GET_NUMBER_OF_FREE_STACKS_OF_THIS_SIZE);
-		MISC.set_function("SET_RANDOM_SEED", LUA_NATIVE_MISC_SET_RANDOM_SEED);
-		MISC.set_function("SET_TIME_SCALE", LUA_NATIVE_MISC_SET_TIME_SCALE);
-		MISC.set_function("SET_MISSION_FLAG", LUA_NATIVE_MISC_SET_MISSION_FLAG);
-		MISC.set_function("GET_MISSION_FLAG", LUA_NATIVE_MISC_GET_MISSION_FLAG);
-		MISC.set_function("SET_RANDOM_EVENT_FLAG", LUA_NATIVE_MISC_SET_RANDOM_EVENT_FLAG);
-		MISC.set_function("GET_RANDOM_EVENT_FLAG", LUA_NATIVE_MISC_GET_RANDOM_EVENT_FLAG);
-		MISC.set_function("GET_CONTENT_TO_LOAD", LUA_NATIVE_MISC_GET_CONTENT_TO_LOAD);
-		MISC.set_function("ACTIVITY_FEED_CREATE", LUA_NATIVE_MISC_ACTIVITY_FEED_CREATE);
-		MISC.set_function("ACTIVITY_FEED_ADD_SUBSTRING_TO_CAPTION", LUA_NATIVE_MISC_ACTIVITY_FEED_ADD_SUBSTRING_TO_CAPTION);
-		MISC.set_function("ACTIVITY_FEED_ADD_LITERAL_SUBSTRING_TO_CAPTION", LUA_NATIVE_MISC_ACTIVITY_FEED_ADD_LITERAL_SUBSTRING_TO_CAPTION);
-		MISC.set_function("ACTIVITY_FEED_ADD_INT_TO_CAPTION", LUA_NATIVE_MISC_ACTIVITY_FEED_ADD_INT_TO_CAPTION);
-		MISC.set_function("ACTIVITY_FEED_LARGE_IMAGE_URL", LUA_NATIVE_MISC_ACTIVITY_FEED_LARGE_IMAGE_URL);
-		MISC.set_function("ACTIVITY_FEED_ACTION_START_WITH_COMMAND_LINE", LUA_NATIVE_MISC_ACTIVITY_FEED_ACTION_START_WITH_COMMAND_LINE);
-		MISC.set_function("ACTIVITY_FEED_ACTION_START_WITH_COMMAND_LINE_ADD", LUA_NATIVE_MISC_ACTIVITY_FEED_ACTION_START_WITH_COMMAND_LINE_ADD);
-		MISC.set_function("ACTIVITY_FEED_POST", LUA_NATIVE_MISC_ACTIVITY_FEED_POST);
-		MISC.set_function("ACTIVITY_FEED_ONLINE_PLAYED_WITH_POST", LUA_NATIVE_MISC_ACTIVITY_FEED_ONLINE_PLAYED_WITH_POST);
-		MISC.set_function("HAS_RESUMED_FROM_SUSPEND", LUA_NATIVE_MISC_HAS_RESUMED_FROM_SUSPEND);
-		MISC.set_function("SET_SCRIPT_HIGH_PRIO", LUA_NATIVE_MISC_SET_SCRIPT_HIGH_PRIO);
-		MISC.set_function("SET_THIS_IS_A_TRIGGER_SCRIPT", LUA_NATIVE_MISC_SET_THIS_IS_A_TRIGGER_SCRIPT);
-		MISC.set_function("INFORM_CODE_OF_CONTENT_ID_OF_CURRENT_UGC_MISSION", LUA_NATIVE_MISC_INFORM_CODE_OF_CONTENT_ID_OF_CURRENT_UGC_MISSION);
-		MISC.set_function("GET_BASE_ELEMENT_LOCATION_FROM_METADATA_BLOCK", LUA_NATIVE_MISC_GET_BASE_ELEMENT_LOCATION_FROM_METADATA_BLOCK);
-		MISC.set_function("GET_PREV_WEATHER_TYPE_HASH_NAME", LUA_NATIVE_MISC_GET_PREV_WEATHER_TYPE_HASH_NAME);
-		MISC.set_function("GET_NEXT_WEATHER_TYPE_HASH_NAME", LUA_NATIVE_MISC_GET_NEXT_WEATHER_TYPE_HASH_NAME);
-		MISC.set_function("IS_PREV_WEATHER_TYPE", LUA_NATIVE_MISC_IS_PREV_WEATHER_TYPE);
-		MISC.set_function("IS_NEXT_WEATHER_TYPE", LUA_NATIVE_MISC_IS_NEXT_WEATHER_TYPE);
-		MISC.set_function("SET_WEATHER_TYPE_PERSIST", LUA_NATIVE_MISC_SET_WEATHER_TYPE_PERSIST);
-		MISC.set_function("SET_WEATHER_TYPE_NOW_PERSIST", LUA_NATIVE_MISC_SET_WEATHER_TYPE_NOW_PERSIST);
-		MISC.set_function("SET_WEATHER_TYPE_NOW", LUA_NATIVE_MISC_SET_WEATHER_TYPE_NOW);
-		MISC.set_function("SET_WEATHER_TYPE_OVERTIME_PERSIST", LUA_NATIVE_MISC_SET_WEATHER_TYPE_OVERTIME_PERSIST);
-		MISC.set_function("SET_RANDOM_WEATHER_TYPE", LUA_NATIVE_MISC_SET_RANDOM_WEATHER_TYPE);
-		MISC.set_function("CLEAR_WEATHER_TYPE_PERSIST", LUA_NATIVE_MISC_CLEAR_WEATHER_TYPE_PERSIST);
-		MISC.set_function("CLEAR_WEATHER_TYPE_NOW_PERSIST_NETWORK", LUA_NATIVE_MISC_CLEAR_WEATHER_TYPE_NOW_PERSIST_NETWORK);
-		MISC.set_function("GET_CURR_WEATHER_STATE", LUA_NATIVE_MISC_GET_CURR_WEATHER_STATE);
-		MISC.set_function("SET_CURR_WEATHER_STATE", LUA_NATIVE_MISC_SET_CURR_WEATHER_STATE);
-		MISC.set_function("SET_OVERRIDE_WEATHER", LUA_NATIVE_MISC_SET_OVERRIDE_WEATHER);
-		MISC.set_function("SET_OVERRIDE_WEATHEREX", LUA_NATIVE_MISC_SET_OVERRIDE_WEATHEREX);
-		MISC.set_function("CLEAR_OVERRIDE_WEATHER", LUA_NATIVE_MISC_CLEAR_OVERRIDE_WEATHER);
-		MISC.set_function("WATER_OVERRIDE_SET_SHOREWAVEAMPLITUDE", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_SHOREWAVEAMPLITUDE);
-		MISC.set_function("WATER_OVERRIDE_SET_SHOREWAVEMINAMPLITUDE", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_SHOREWAVEMINAMPLITUDE);
-		MISC.set_function("WATER_OVERRIDE_SET_SHOREWAVEMAXAMPLITUDE", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_SHOREWAVEMAXAMPLITUDE);
-		MISC.set_function("WATER_OVERRIDE_SET_OCEANNOISEMINAMPLITUDE", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_OCEANNOISEMINAMPLITUDE);
-		MISC.set_function("WATER_OVERRIDE_SET_OCEANWAVEAMPLITUDE", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_OCEANWAVEAMPLITUDE);
-		MISC.set_function("WATER_OVERRIDE_SET_OCEANWAVEMINAMPLITUDE", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_OCEANWAVEMINAMPLITUDE);
-		MISC.set_function("WATER_OVERRIDE_SET_OCEANWAVEMAXAMPLITUDE", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_OCEANWAVEMAXAMPLITUDE);
-		MISC.set_function("WATER_OVERRIDE_SET_RIPPLEBUMPINESS", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_RIPPLEBUMPINESS);
-		MISC.set_function("WATER_OVERRIDE_SET_RIPPLEMINBUMPINESS", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_RIPPLEMINBUMPINESS);
-		MISC.set_function("WATER_OVERRIDE_SET_RIPPLEMAXBUMPINESS", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_RIPPLEMAXBUMPINESS);
-		MISC.set_function("WATER_OVERRIDE_SET_RIPPLEDISTURB", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_RIPPLEDISTURB);
-		MISC.set_function("WATER_OVERRIDE_SET_STRENGTH", LUA_NATIVE_MISC_WATER_OVERRIDE_SET_STRENGTH);
-		MISC.set_function("WATER_OVERRIDE_FADE_IN", LUA_NATIVE_MISC_WATER_OVERRIDE_FADE_IN);
-		MISC.set_function("WATER_OVERRIDE_FADE_OUT", LUA_NATIVE_MISC_WATER_OVERRIDE_FADE_OUT);
-		MISC.set_function("SET_WIND", LUA_NATIVE_MISC_SET_WIND);
-		MISC.set_function("SET_WIND_SPEED", LUA_NATIVE_MISC_SET_WIND_SPEED);
-		MISC.set_function("GET_WIND_SPEED", LUA_NATIVE_MISC_GET_WIND_SPEED);
-		MISC.set_function("SET_WIND_DIRECTION", LUA_NATIVE_MISC_SET_WIND_DIRECTION);
-		MISC.set_function("GET_WIND_DIRECTION", LUA_NATIVE_MISC_GET_WIND_DIRECTION);
-		MISC.set_function("SET_RAIN", LUA_NATIVE_MISC_SET_RAIN);
-		MISC.set_function("GET_RAIN_LEVEL", LUA_NATIVE_MISC_GET_RAIN_LEVEL);
-		MISC.set_function("SET_SNOW", LUA_NATIVE_MISC_SET_SNOW);
-		MISC.set_function("GET_SNOW_LEVEL", LUA_NATIVE_MISC_GET_SNOW_LEVEL);
-		MISC.set_function("FORCE_LIGHTNING_FLASH", LUA_NATIVE_MISC_FORCE_LIGHTNING_FLASH);
-		MISC.set_function("SET_CLOUD_SETTINGS_OVERRIDE", LUA_NATIVE_MISC_SET_CLOUD_SETTINGS_OVERRIDE);
-		MISC.set_function("PRELOAD_CLOUD_HAT", LUA_NATIVE_MISC_PRELOAD_CLOUD_HAT);
-		MISC.set_function("LOAD_CLOUD_HAT", LUA_NATIVE_MISC_LOAD_CLOUD_HAT);
-		MISC.set_function("UNLOAD_CLOUD_HAT", LUA_NATIVE_MISC_UNLOAD_CLOUD_HAT);
-		MISC.set_function("UNLOAD_ALL_CLOUD_HATS", LUA_NATIVE_MISC_UNLOAD_ALL_CLOUD_HATS);
-		MISC.set_function("SET_CLOUDS_ALPHA", LUA_NATIVE_MISC_SET_CLOUDS_ALPHA);
-		MISC.set_function("GET_CLOUDS_ALPHA", LUA_NATIVE_MISC_GET_CLOUDS_ALPHA);
-		MISC.set_function("GET_GAME_TIMER", LUA_NATIVE_MISC_GET_GAME_TIMER);
-		MISC.set_function("GET_FRAME_TIME", LUA_NATIVE_MISC_GET_FRAME_TIME);
-		MISC.set_function("GET_SYSTEM_TIME_STEP", LUA_NATIVE_MISC_GET_SYSTEM_TIME_STEP);
-		MISC.set_function("GET_FRAME_COUNT", LUA_NATIVE_MISC_GET_FRAME_COUNT);
-		MISC.set_function("GET_RANDOM_FLOAT_IN_RANGE", LUA_NATIVE_MISC_GET_RANDOM_FLOAT_IN_RANGE);
-		MISC.set_function("GET_RANDOM_INT_IN_RANGE", LUA_NATIVE_MISC_GET_RANDOM_INT_IN_RANGE);
-		MISC.set_function("GET_RANDOM_MWC_INT_IN_RANGE", LUA_NATIVE_MISC_GET_RANDOM_MWC_INT_IN_RANGE);
-		MISC.set_function("GET_GROUND_Z_FOR_3D_COORD", LUA_NATIVE_MISC_GET_GROUND_Z_FOR_3D_COORD);
-		MISC.set_function("GET_GROUND_Z_AND_NORMAL_FOR_3D_COORD", LUA_NATIVE_MISC_GET_GROUND_Z_AND_NORMAL_FOR_3D_COORD);
-		MISC.set_function("GET_GROUND_Z_EXCLUDING_OBJECTS_FOR_3D_COORD", LUA_NATIVE_MISC_GET_GROUND_Z_EXCLUDING_OBJECTS_FOR_3D_COORD);
-		MISC.set_function("ASIN", LUA_NATIVE_MISC_ASIN);
-		MISC.set_function("ACOS", LUA_NATIVE_MISC_ACOS);
-		MISC.set_function("TAN", LUA_NATIVE_MISC_TAN);
-		MISC.set_function("ATAN", LUA_NATIVE_MISC_ATAN);
-		MISC.set_function("ATAN2", LUA_NATIVE_MISC_ATAN2);
-		MISC.set_function("GET_DISTANCE_BETWEEN_COORDS", LUA_NATIVE_MISC_GET_DISTANCE_BETWEEN_COORDS);
-		MISC.set_function("GET_ANGLE_BETWEEN_2D_VECTORS", LUA_NATIVE_MISC_GET_ANGLE_BETWEEN_2D_VECTORS);
-		MISC.set_function("GET_HEADING_FROM_VECTOR_2D", LUA_NATIVE_MISC_GET_HEADING_FROM_VECTOR_2D);
-		MISC.set_function("GET_RATIO_OF_CLOSEST_POINT_ON_LINE", LUA_NATIVE_MISC_GET_RATIO_OF_CLOSEST_POINT_ON_LINE);
-		MISC.set_function("GET_CLOSEST_POINT_ON_LINE", LUA_NATIVE_MISC_GET_CLOSEST_POINT_ON_LINE);
-		MISC.set_function("GET_LINE_PLANE_INTERSECTION", LUA_NATIVE_MISC_GET_LINE_PLANE_INTERSECTION);
-		MISC.set_function("GET_POINT_AREA_OVERLAP", LUA_NATIVE_MISC_GET_POINT_AREA_OVERLAP);
-		MISC.set_function("SET_BIT", LUA_NATIVE_MISC_SET_BIT);
-		MISC.set_function("CLEAR_BIT", LUA_NATIVE_MISC_CLEAR_BIT);
-		MISC.set_function("GET_HASH_KEY", LUA_NATIVE_MISC_GET_HASH_KEY);
-		MISC.set_function("SLERP_NEAR_QUATERNION", LUA_NATIVE_MISC_SLERP_NEAR_QUATERNION);
-		MISC.set_function("IS_AREA_OCCUPIED", LUA_NATIVE_MISC_IS_AREA_OCCUPIED);
-		MISC.set_function("IS_AREA_OCCUPIED_SLOW", LUA_NATIVE_MISC_IS_AREA_OCCUPIED_SLOW);
-		MISC.set_function("IS_POSITION_OCCUPIED", LUA_NATIVE_MISC_IS_POSITION_OCCUPIED);
-		MISC.set_function("IS_POINT_OBSCURED_BY_A_MISSION_ENTITY", LUA_NATIVE_MISC_IS_POINT_OBSCURED_BY_A_MISSION_ENTITY);
-		MISC.set_function("CLEAR_AREA", LUA_NATIVE_MISC_CLEAR_AREA);
-		MISC.set_function("CLEAR_AREA_LEAVE_VEHICLE_HEALTH", LUA_NATIVE_MISC_CLEAR_AREA_LEAVE_VEHICLE_HEALTH);
-		MISC.set_function("CLEAR_AREA_OF_VEHICLES", LUA_NATIVE_MISC_CLEAR_AREA_OF_VEHICLES);
-		MISC.set_function("CLEAR_ANGLED_AREA_OF_VEHICLES", LUA_NATIVE_MISC_CLEAR_ANGLED_AREA_OF_VEHICLES);
-		MISC.set_function("CLEAR_AREA_OF_OBJECTS", LUA_NATIVE_MISC_CLEAR_AREA_OF_OBJECTS);
-		MISC.set_function("CLEAR_AREA_OF_PEDS", LUA_NATIVE_MISC_CLEAR_AREA_OF_PEDS);
-		MISC.set_function("CLEAR_AREA_OF_COPS", LUA_NATIVE_MISC_CLEAR_AREA_OF_COPS);
-		MISC.set_function("CLEAR_AREA_OF_PROJECTILES", LUA_NATIVE_MISC_CLEAR_AREA_OF_PROJECTILES);
-		MISC.set_function("CLEAR_SCENARIO_SPAWN_HISTORY", LUA_NATIVE_MISC_CLEAR_SCENARIO_SPAWN_HISTORY);
-		MISC.set_function("SET_SAVE_MENU_ACTIVE", LUA_NATIVE_MISC_SET_SAVE_MENU_ACTIVE);
-		MISC.set_function("GET_STATUS_OF_MANUAL_SAVE", LUA_NATIVE_MISC_GET_STATUS_OF_MANUAL_SAVE);
-		MISC.set_function("SET_CREDITS_ACTIVE", LUA_NATIVE_MISC_SET_CREDITS_ACTIVE);
-		MISC.set_function("SET_CREDITS_FADE_OUT_WITH_SCREEN", LUA_NATIVE_MISC_SET_CREDITS_FADE_OUT_WITH_SCREEN);
-		MISC.set_function("HAVE_CREDITS_REACHED_END", LUA_NATIVE_MISC_HAVE_CREDITS_REACHED_END);
-		MISC.set_function("ARE_CREDITS_RUNNING", LUA_NATIVE_MISC_ARE_CREDITS_RUNNING);
-		MISC.set_function("TERMINATE_ALL_SCRIPTS_WITH_THIS_NAME", LUA_NATIVE_MISC_TERMINATE_ALL_SCRIPTS_WITH_THIS_NAME);
-		MISC.set_function("NETWORK_SET_SCRIPT_IS_SAFE_FOR_NETWORK_GAME", LUA_NATIVE_MISC_NETWORK_SET_SCRIPT_IS_SAFE_FOR_NETWORK_GAME);
-		MISC.set_function("ADD_HOSPITAL_RESTART", LUA_NATIVE_MISC_ADD_HOSPITAL_RESTART);
-		MISC.set_function("DISABLE_HOSPITAL_RESTART", LUA_NATIVE_MISC_DISABLE_HOSPITAL_RESTART);
-		MISC.set_function("ADD_POLICE_RESTART", LUA_NATIVE_MISC_ADD_POLICE_RESTART);
-		MISC.set_function("DISABLE_POLICE_RESTART", LUA_NATIVE_MISC_DISABLE_POLICE_RESTART);
-		MISC.set_function("SET_RESTART_COORD_OVERRIDE", LUA_NATIVE_MISC_SET_RESTART_COORD_OVERRIDE);
-		MISC.set_function("CLEAR_RESTART_COORD_OVERRIDE", LUA_NATIVE_MISC_CLEAR_RESTART_COORD_OVERRIDE);
-		MISC.set_function("PAUSE_DEATH_ARREST_RESTART", LUA_NATIVE_MISC_PAUSE_DEATH_ARREST_RESTART);
-		MISC.set_function("IGNORE_NEXT_RESTART", LUA_NATIVE_MISC_IGNORE_NEXT_RESTART);
-		MISC.set_function("SET_FADE_OUT_AFTER_DEATH", LUA_NATIVE_MISC_SET_FADE_OUT_AFTER_DEATH);
-		MISC.set_function("SET_FADE_OUT_AFTER_ARREST", LUA_NATIVE_MISC_SET_FADE_OUT_AFTER_ARREST);
-		MISC.set_function("SET_FADE_IN_AFTER_DEATH_ARREST", LUA_NATIVE_MISC_SET_FADE_IN_AFTER_DEATH_ARREST);
-		MISC.set_function("SET_FADE_IN_AFTER_LOAD", LUA_NATIVE_MISC_SET_FADE_IN_AFTER_LOAD);
-		MISC.set_function("REGISTER_SAVE_HOUSE", LUA_NATIVE_MISC_REGISTER_SAVE_HOUSE);
-		MISC.set_function("SET_SAVE_HOUSE", LUA_NATIVE_MISC_SET_SAVE_HOUSE);
-		MISC.set_function("OVERRIDE_SAVE_HOUSE", LUA_NATIVE_MISC_OVERRIDE_SAVE_HOUSE);
-		MISC.set_function("GET_SAVE_HOUSE_DETAILS_AFTER_SUCCESSFUL_LOAD", LUA_NATIVE_MISC_GET_SAVE_HOUSE_DETAILS_AFTER_SUCCESSFUL_LOAD);
-		MISC.set_function("DO_AUTO_SAVE", LUA_NATIVE_MISC_DO_AUTO_SAVE);
-		MISC.set_function("GET_IS_AUTO_SAVE_OFF", LUA_NATIVE_MISC_GET_IS_AUTO_SAVE_OFF);
-		MISC.set_function("IS_AUTO_SAVE_IN_PROGRESS", LUA_NATIVE_MISC_IS_AUTO_SAVE_IN_PROGRESS);
-		MISC.set_function("HAS_CODE_REQUESTED_AUTOSAVE", LUA_NATIVE_MISC_HAS_CODE_REQUESTED_AUTOSAVE);
-		MISC.set_function("CLEAR_CODE_REQUESTED_AUTOSAVE", LUA_NATIVE_MISC_CLEAR_CODE_REQUESTED_AUTOSAVE);
-		MISC.set_function("BEGIN_REPLAY_STATS", LUA_NATIVE_MISC_BEGIN_REPLAY_STATS);
-		MISC.set_function("ADD_REPLAY_STAT_VALUE", LUA_NATIVE_MISC_ADD_REPLAY_STAT_VALUE);
-		MISC.set_function("END_REPLAY_STATS", LUA_NATIVE_MISC_END_REPLAY_STATS);
-		MISC.set_function("HAVE_REPLAY_STATS_BEEN_STORED", LUA_NATIVE_MISC_HAVE_REPLAY_STATS_BEEN_STORED);
-		MISC.set_function("GET_REPLAY_STAT_MISSION_ID", LUA_NATIVE_MISC_GET_REPLAY_STAT_MISSION_ID);
-		MISC.set_function("GET_REPLAY_STAT_MISSION_TYPE", LUA_NATIVE_MISC_GET_REPLAY_STAT_MISSION_TYPE);
-		MISC.set_function("GET_REPLAY_STAT_COUNT", LUA_NATIVE_MISC_GET_REPLAY_STAT_COUNT);
-		MISC.set_function("GET_REPLAY_STAT_AT_INDEX", LUA_NATIVE_MISC_GET_REPLAY_STAT_AT_INDEX);
-		MISC.set_function("CLEAR_REPLAY_STATS", LUA_NATIVE_MISC_CLEAR_REPLAY_STATS);
-		MISC.set_function("QUEUE_MISSION_REPEAT_LOAD", LUA_NATIVE_MISC_QUEUE_MISSION_REPEAT_LOAD);
-		MISC.set_function("QUEUE_MISSION_REPEAT_SAVE", LUA_NATIVE_MISC_QUEUE_MISSION_REPEAT_SAVE);
-		MISC.set_function("QUEUE_MISSION_REPEAT_SAVE_FOR_BENCHMARK_TEST", LUA_NATIVE_MISC_QUEUE_MISSION_REPEAT_SAVE_FOR_BENCHMARK_TEST);
-		MISC.set_function("GET_STATUS_OF_MISSION_REPEAT_SAVE", LUA_NATIVE_MISC_GET_STATUS_OF_MISSION_REPEAT_SAVE);
-		MISC.set_function("IS_MEMORY_CARD_IN_USE", LUA_NATIVE_MISC_IS_MEMORY_CARD_IN_USE);
-		MISC.set_function("SHOOT_SINGLE_BULLET_BETWEEN_COORDS", LUA_NATIVE_MISC_SHOOT_SINGLE_BULLET_BETWEEN_COORDS);
-		MISC.set_function("SHOOT_SINGLE_BULLET_BETWEEN_COORDS_IGNORE_ENTITY", LUA_NATIVE_MISC_SHOOT_SINGLE_BULLET_BETWEEN_COORDS_IGNORE_ENTITY);
-		MISC.set_function("SHOOT_SINGLE_BULLET_BETWEEN_COORDS_IGNORE_ENTITY_NEW", LUA_NATIVE_MISC_SHOOT_SINGLE_BULLET_BETWEEN_COORDS_IGNORE_ENTITY_NEW);
-		MISC.set_function("GET_MODEL_DIMENSIONS", LUA_NATIVE_MISC_GET_MODEL_DIMENSIONS);
-		MISC.set_function("SET_FAKE_WANTED_LEVEL", LUA_NATIVE_MISC_SET_FAKE_WANTED_LEVEL);
-		MISC.set_function("GET_FAKE_WANTED_LEVEL", LUA_NATIVE_MISC_GET_FAKE_WANTED_LEVEL);
-		MISC.set_function("USING_MISSION_CREATOR", LUA_NATIVE_MISC_USING_MISSION_CREATOR);
-		MISC.set_function("ALLOW_MISSION_CREATOR_WARP", LUA_NATIVE_MISC_ALLOW_MISSION_CREATOR_WARP);
-		MISC.set_function("SET_MINIGAME_IN_PROGRESS", LUA_NATIVE_MISC_SET_MINIGAME_IN_PROGRESS);
-		MISC.set_function("IS_MINIGAME_IN_PROGRESS", LUA_NATIVE_MISC_IS_MINIGAME_IN_PROGRESS);
-		MISC.set_function("IS_THIS_A_MINIGAME_SCRIPT", LUA_NATIVE_MISC_IS_THIS_A_MINIGAME_SCRIPT);
-		MISC.set_function("IS_SNIPER_INVERTED", LUA_NATIVE_MISC_IS_SNIPER_INVERTED);
-		MISC.set_function("SHOULD_USE_METRIC_MEASUREMENTS", LUA_NATIVE_MISC_SHOULD_USE_METRIC_MEASUREMENTS);
-		MISC.set_function("GET_PROFILE_SETTING", LUA_NATIVE_MISC_GET_PROFILE_SETTING);
-		MISC.set_function("ARE_STRINGS_EQUAL", LUA_NATIVE_MISC_ARE_STRINGS_EQUAL);
-		MISC.set_function("COMPARE_STRINGS", LUA_NATIVE_MISC_COMPARE_STRINGS);
-		MISC.set_function("ABSI", LUA_NATIVE_MISC_ABSI);
-		MISC.set_function("ABSF", LUA_NATIVE_MISC_ABSF);
-		MISC.set_function("IS_SNIPER_BULLET_IN_AREA", LUA_NATIVE_MISC_IS_SNIPER_BULLET_IN_AREA);
-		MISC.set_function("IS_PROJECTILE_IN_AREA", LUA_NATIVE_MISC_IS_PROJECTILE_IN_AREA);
-		MISC.set_function("IS_PROJECTILE_TYPE_IN_AREA", LUA_NATIVE_MISC_IS_PROJECTILE_TYPE_IN_AREA);
-		MISC.set_function("IS_PROJECTILE_TYPE_IN_ANGLED_AREA", LUA_NATIVE_MISC_IS_PROJECTILE_TYPE_IN_ANGLED_AREA);
-		MISC.set_function("IS_PROJECTILE_TYPE_WITHIN_DISTANCE", LUA_NATIVE_MISC_IS_PROJECTILE_TYPE_WITHIN_DISTANCE);
-		MISC.set_function("GET_COORDS_OF_PROJECTILE_TYPE_IN_AREA", LUA_NATIVE_MISC_GET_COORDS_OF_PROJECTILE_TYPE_IN_AREA);
-		MISC.set_function("GET_COORDS_OF_PROJECTILE_TYPE_IN_ANGLED_AREA", LUA_NATIVE_MISC_GET_COORDS_OF_PROJECTILE_TYPE_IN_ANGLED_AREA);
-		MISC.set_function("GET_COORDS_OF_PROJECTILE_TYPE_WITHIN_DISTANCE", LUA_NATIVE_MISC_GET_COORDS_OF_PROJECTILE_TYPE_WITHIN_DISTANCE);
-		MISC.set_function("GET_PROJECTILE_OF_PROJECTILE_TYPE_WITHIN_DISTANCE", LUA_NATIVE_MISC_GET_PROJECTILE_OF_PROJECTILE_TYPE_WITHIN_DISTANCE);
-		MISC.set_function("IS_BULLET_IN_ANGLED_AREA", LUA_NATIVE_MISC_IS_BULLET_IN_ANGLED_AREA);
-		MISC.set_function("IS_BULLET_IN_AREA", LUA_NATIVE_MISC_IS_BULLET_IN_AREA);
-		MISC.set_function("IS_BULLET_IN_BOX", LUA_NATIVE_MISC_IS_BULLET_IN_BOX);
-		MISC.set_function("HAS_BULLET_IMPACTED_IN_AREA", LUA_NATIVE_MISC_HAS_BULLET_IMPACTED_IN_AREA);
-		MISC.set_function("HAS_BULLET_IMPACTED_IN_BOX", LUA_NATIVE_MISC_HAS_BULLET_IMPACTED_IN_BOX);
-		MISC.set_function("IS_ORBIS_VERSION", LUA_NATIVE_MISC_IS_ORBIS_VERSION);
-		MISC.set_function("IS_DURANGO_VERSION", LUA_NATIVE_MISC_IS_DURANGO_VERSION);
-		MISC.set_function("IS_XBOX360_VERSION", LUA_NATIVE_MISC_IS_XBOX360_VERSION);
-		MISC.set_function("IS_PS3_VERSION", LUA_NATIVE_MISC_IS_PS3_VERSION);
-		MISC.set_function("IS_PC_VERSION", LUA_NATIVE_MISC_IS_PC_VERSION);
-		MISC.set_function("IS_STEAM_VERSION", LUA_NATIVE_MISC_IS_STEAM_VERSION);
-		MISC.set_function("IS_AUSSIE_VERSION", LUA_NATIVE_MISC_IS_AUSSIE_VERSION);
-		MISC.set_function("IS_JAPANESE_VERSION", LUA_NATIVE_MISC_IS_JAPANESE_VERSION);
-		MISC.set_function("IS_XBOX_PLATFORM", LUA_NATIVE_MISC_IS_XBOX_PLATFORM);
-		MISC.set_function("IS_SCARLETT_VERSION", LUA_NATIVE_MISC_IS_SCARLETT_VERSION);
-		MISC.set_function("IS_SCE_PLATFORM", LUA_NATIVE_MISC_IS_SCE_PLATFORM);
-		MISC.set_function("IS_PROSPERO_VERSION", LUA_NATIVE_MISC_IS_PROSPERO_VERSION);
-		MISC.set_function("IS_STRING_NULL", LUA_NATIVE_MISC_IS_STRING_NULL);
-		MISC.set_function("IS_STRING_NULL_OR_EMPTY", LUA_NATIVE_MISC_IS_STRING_NULL_OR_EMPTY);
-		MISC.set_function("STRING_TO_INT", LUA_NATIVE_MISC_STRING_TO_INT);
-		MISC.set_function("SET_BITS_IN_RANGE", LUA_NATIVE_MISC_SET_BITS_IN_RANGE);
-		MISC.set_function("GET_BITS_IN_RANGE", LUA_NATIVE_MISC_GET_BITS_IN_RANGE);
-		MISC.set_function("ADD_STUNT_JUMP", LUA_NATIVE_MISC_ADD_STUNT_JUMP);
-		MISC.set_function("ADD_STUNT_JUMP_ANGLED", LUA_NATIVE_MISC_ADD_STUNT_JUMP_ANGLED);
-		MISC.set_function("TOGGLE_SHOW_OPTIONAL_STUNT_JUMP_CAMERA", LUA_NATIVE_MISC_TOGGLE_SHOW_OPTIONAL_STUNT_JUMP_CAMERA);
-		MISC.set_function("DELETE_STUNT_JUMP", LUA_NATIVE_MISC_DELETE_STUNT_JUMP);
-		MISC.set_function("ENABLE_STUNT_JUMP_SET", LUA_NATIVE_MISC_ENABLE_STUNT_JUMP_SET);
-		MISC.set_function("DISABLE_STUNT_JUMP_SET", LUA_NATIVE_MISC_DISABLE_STUNT_JUMP_SET);
-		MISC.set_function("SET_STUNT_JUMPS_CAN_TRIGGER", LUA_NATIVE_MISC_SET_STUNT_JUMPS_CAN_TRIGGER);
-		MISC.set_function("IS_STUNT_JUMP_IN_PROGRESS", LUA_NATIVE_MISC_IS_STUNT_JUMP_IN_PROGRESS);
-		MISC.set_function("IS_STUNT_JUMP_MESSAGE_SHOWING", LUA_NATIVE_MISC_IS_STUNT_JUMP_MESSAGE_SHOWING);
-		MISC.set_function("GET_NUM_SUCCESSFUL_STUNT_JUMPS", LUA_NATIVE_MISC_GET_NUM_SUCCESSFUL_STUNT_JUMPS);
-		MISC.set_function("GET_TOTAL_SUCCESSFUL_STUNT_JUMPS", LUA_NATIVE_MISC_GET_TOTAL_SUCCESSFUL_STUNT_JUMPS);
-		MISC.set_function("CANCEL_STUNT_JUMP", LUA_NATIVE_MISC_CANCEL_STUNT_JUMP);
-		MISC.set_function("SET_GAME_PAUSED", LUA_NATIVE_MISC_SET_GAME_PAUSED);
-		MISC.set_function("SET_THIS_SCRIPT_CAN_BE_PAUSED", LUA_NATIVE_MISC_SET_THIS_SCRIPT_CAN_BE_PAUSED);
-		MISC.set_function("SET_THIS_SCRIPT_CAN_REMOVE_BLIPS_CREATED_BY_ANY_SCRIPT", LUA_NATIVE_MISC_SET_THIS_SCRIPT_CAN_REMOVE_BLIPS_CREATED_BY_ANY_SCRIPT);
-		MISC.set_function("HAS_CHEAT_WITH_HASH_BEEN_ACTIVATED", LUA_NATIVE_MISC_HAS_CHEAT_WITH_HASH_BEEN_ACTIVATED);
-		MISC.set_function("HAS_PC_CHEAT_WITH_HASH_BEEN_ACTIVATED", LUA_NATIVE_MISC_HAS_PC_CHEAT_WITH_HASH_BEEN_ACTIVATED);
-		MISC.set_function("OVERRIDE_FREEZE_FLAGS", LUA_NATIVE_MISC_OVERRIDE_FREEZE_FLAGS);
-		MISC.set_function("SET_INSTANCE_PRIORITY_MODE", LUA_NATIVE_MISC_SET_INSTANCE_PRIORITY_MODE);
-		MISC.set_function("SET_INSTANCE_PRIORITY_HINT", LUA_NATIVE_MISC_SET_INSTANCE_PRIORITY_HINT);
-		MISC.set_function("IS_FRONTEND_FADING", LUA_NATIVE_MISC_IS_FRONTEND_FADING);
-		MISC.set_function("POPULATE_NOW", LUA_NATIVE_MISC_POPULATE_NOW);
-		MISC.set_function("GET_INDEX_OF_CURRENT_LEVEL", LUA_NATIVE_MISC_GET_INDEX_OF_CURRENT_LEVEL);
-		MISC.set_function("SET_GRAVITY_LEVEL", LUA_NATIVE_MISC_SET_GRAVITY_LEVEL);
-		MISC.set_function("START_SAVE_DATA", LUA_NATIVE_MISC_START_SAVE_DATA);
-		MISC.set_function("STOP_SAVE_DATA", LUA_NATIVE_MISC_STOP_SAVE_DATA);
-		MISC.set_function("GET_SIZE_OF_SAVE_DATA", LUA_NATIVE_MISC_GET_SIZE_OF_SAVE_DATA);
-		MISC.set_function("REGISTER_INT_TO_SAVE", LUA_NATIVE_MISC_REGISTER_INT_TO_SAVE);
-		MISC.set_function("REGISTER_INT64_TO_SAVE", LUA_NATIVE_MISC_REGISTER_INT64_TO_SAVE);
-		MISC.set_function("REGISTER_ENUM_TO_SAVE", LUA_NATIVE_MISC_REGISTER_ENUM_TO_SAVE);
-		MISC.set_function("REGISTER_FLOAT_TO_SAVE", LUA_NATIVE_MISC_REGISTER_FLOAT_TO_SAVE);
-		MISC.set_function("REGISTER_BOOL_TO_SAVE", LUA_NATIVE_MISC_REGISTER_BOOL_TO_SAVE);
-		MISC.set_function("REGISTER_TEXT_LABEL_TO_SAVE", LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_TO_SAVE);
-		MISC.set_function("REGISTER_TEXT_LABEL_15_TO_SAVE", LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_15_TO_SAVE);
-		MISC.set_function("REGISTER_TEXT_LABEL_23_TO_SAVE", LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_23_TO_SAVE);
-		MISC.set_function("REGISTER_TEXT_LABEL_31_TO_SAVE", LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_31_TO_SAVE);
-		MISC.set_function("REGISTER_TEXT_LABEL_63_TO_SAVE", LUA_NATIVE_MISC_REGISTER_TEXT_LABEL_63_TO_SAVE);
-		MISC.set_function("START_SAVE_STRUCT_WITH_SIZE", LUA_NATIVE_MISC_START_SAVE_STRUCT_WITH_SIZE);
-		MISC.set_function("STOP_SAVE_STRUCT", LUA_NATIVE_MISC_STOP_SAVE_STRUCT);
-		MISC.set_function("START_SAVE_ARRAY_WITH_SIZE", LUA_NATIVE_MISC_START_SAVE_ARRAY_WITH_SIZE);
-		MISC.set_function("STOP_SAVE_ARRAY", LUA_NATIVE_MISC_STOP_SAVE_ARRAY);
-		MISC.set_function("COPY_SCRIPT_STRUCT", LUA_NATIVE_MISC_COPY_SCRIPT_STRUCT);
-		MISC.set_function("ENABLE_DISPATCH_SERVICE", LUA_NATIVE_MISC_ENABLE_DISPATCH_SERVICE);
-		MISC.set_function("BLOCK_DISPATCH_SERVICE_RESOURCE_CREATION", LUA_NATIVE_MISC_BLOCK_DISPATCH_SERVICE_RESOURCE_CREATION);
-		MISC.set_function("GET_NUMBER_RESOURCES_ALLOCATED_TO_WANTED_LEVEL", LUA_NATIVE_MISC_GET_NUMBER_RESOURCES_ALLOCATED_TO_WANTED_LEVEL);
-		MISC.set_function("CREATE_INCIDENT", LUA_NATIVE_MISC_CREATE_INCIDENT);
-		MISC.set_function("CREATE_INCIDENT_WITH_ENTITY", LUA_NATIVE_MISC_CREATE_INCIDENT_WITH_ENTITY);
-		MISC.set_function("DELETE_INCIDENT", LUA_NATIVE_MISC_DELETE_INCIDENT);
-		MISC.set_function("IS_INCIDENT_VALID", LUA_NATIVE_MISC_IS_INCIDENT_VALID);
-		MISC.set_function("SET_INCIDENT_REQUESTED_UNITS", LUA_NATIVE_MISC_SET_INCIDENT_REQUESTED_UNITS);
-		MISC.set_function("SET_IDEAL_SPAWN_DISTANCE_FOR_INCIDENT", LUA_NATIVE_MISC_SET_IDEAL_SPAWN_DISTANCE_FOR_INCIDENT);
-		MISC.set_function("FIND_SPAWN_POINT_IN_DIRECTION", LUA_NATIVE_MISC_FIND_SPAWN_POINT_IN_DIRECTION);
-		MISC.set_function("ADD_POP_MULTIPLIER_AREA", LUA_NATIVE_MISC_ADD_POP_MULTIPLIER_AREA);
-		MISC.set_function("DOES_POP_MULTIPLIER_AREA_EXIST", LUA_NATIVE_MISC_DOES_POP_MULTIPLIER_AREA_EXIST);
-		MISC.set_function("REMOVE_POP_MULTIPLIER_AREA", LUA_NATIVE_MISC_REMOVE_POP_MULTIPLIER_AREA);
-		MISC.set_function("IS_POP_MULTIPLIER_AREA_NETWORKED", LUA_NATIVE_MISC_IS_POP_MULTIPLIER_AREA_NETWORKED);
-		MISC.set_function("ADD_POP_MULTIPLIER_SPHERE", LUA_NATIVE_MISC_ADD_POP_MULTIPLIER_SPHERE);
-		MISC.set_function("DOES_POP_MULTIPLIER_SPHERE_EXIST", LUA_NATIVE_MISC_DOES_POP_MULTIPLIER_SPHERE_EXIST);
-		MISC.set_function("REMOVE_POP_MULTIPLIER_SPHERE", LUA_NATIVE_MISC_REMOVE_POP_MULTIPLIER_SPHERE);
-		MISC.set_function("ENABLE_TENNIS_MODE", LUA_NATIVE_MISC_ENABLE_TENNIS_MODE);
-		MISC.set_function("IS_TENNIS_MODE", LUA_NATIVE_MISC_IS_TENNIS_MODE);
-		MISC.set_function("PLAY_TENNIS_SWING_ANIM", LUA_NATIVE_MISC_PLAY_TENNIS_SWING_ANIM);
-		MISC.set_function("GET_TENNIS_SWING_ANIM_COMPLETE", LUA_NATIVE_MISC_GET_TENNIS_SWING_ANIM_COMPLETE);
-		MISC.set_function("GET_TENNIS_SWING_ANIM_CAN_BE_INTERRUPTED", LUA_NATIVE_MISC_GET_TENNIS_SWING_ANIM_CAN_BE_INTERRUPTED);
-		MISC.set_function("GET_TENNIS_SWING_ANIM_SWUNG", LUA_NATIVE_MISC_GET_TENNIS_SWING_ANIM_SWUNG);
-		MISC.set_function("PLAY_TENNIS_DIVE_ANIM", LUA_NATIVE_MISC_PLAY_TENNIS_DIVE_ANIM);
-		MISC.set_function("SET_TENNIS_MOVE_NETWORK_SIGNAL_FLOAT", LUA_NATIVE_MISC_SET_TENNIS_MOVE_NETWORK_SIGNAL_FLOAT);
-		MISC.set_function("RESET_DISPATCH_SPAWN_LOCATION", LUA_NATIVE_MISC_RESET_DISPATCH_SPAWN_LOCATION);
-		MISC.set_function("SET_DISPATCH_SPAWN_LOCATION", LUA_NATIVE_MISC_SET_DISPATCH_SPAWN_LOCATION);
-		MISC.set_function("RESET_DISPATCH_IDEAL_SPAWN_DISTANCE", LUA_NATIVE_MISC_RESET_DISPATCH_IDEAL_SPAWN_DISTANCE);
-		MISC.set_function("SET_DISPATCH_IDEAL_SPAWN_DISTANCE", LUA_NATIVE_MISC_SET_DISPATCH_IDEAL_SPAWN_DISTANCE);
-		MISC.set_function("RESET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS", LUA_NATIVE_MISC_RESET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS);
-		MISC.set_function("SET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS", LUA_NATIVE_MISC_SET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS);
-		MISC.set_function("SET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS_MULTIPLIER", LUA_NATIVE_MISC_SET_DISPATCH_TIME_BETWEEN_SPAWN_ATTEMPTS_MULTIPLIER);
-		MISC.set_function("ADD_DISPATCH_SPAWN_ANGLED_BLOCKING_AREA", LUA_NATIVE_MISC_ADD_DISPATCH_SPAWN_ANGLED_BLOCKING_AREA);
-		MISC.set_function("ADD_DISPATCH_SPAWN_SPHERE_BLOCKING_AREA", LUA_NATIVE_MISC_ADD_DISPATCH_SPAWN_SPHERE_BLOCKING_AREA);
-		MISC.set_function("REMOVE_DISPATCH_SPAWN_BLOCKING_AREA", LUA_NATIVE_MISC_REMOVE_DISPATCH_SPAWN_BLOCKING_AREA);
-		MISC.set_function("RESET_DISPATCH_SPAWN_BLOCKING_AREAS", LUA_NATIVE_MISC_RESET_DISPATCH_SPAWN_BLOCKING_AREAS);
-		MISC.set_function("RESET_WANTED_RESPONSE_NUM_PEDS_TO_SPAWN", LUA_NATIVE_MISC_RESET_WANTED_RESPONSE_NUM_PEDS_TO_SPAWN);
-		MISC.set_function("SET_WANTED_RESPONSE_NUM_PEDS_TO_SPAWN", LUA_NATIVE_MISC_SET_WANTED_RESPONSE_NUM_PEDS_TO_SPAWN);
-		MISC.set_function("ADD_TACTICAL_NAV_MESH_POINT", LUA_NATIVE_MISC_ADD_TACTICAL_NAV_MESH_POINT);
-		MISC.set_function("CLEAR_TACTICAL_NAV_MESH_POINTS", LUA_NATIVE_MISC_CLEAR_TACTICAL_NAV_MESH_POINTS);
-		MISC.set_function("SET_RIOT_MODE_ENABLED", LUA_NATIVE_MISC_SET_RIOT_MODE_ENABLED);
-		MISC.set_function("DISPLAY_ONSCREEN_KEYBOARD_WITH_LONGER_INITIAL_STRING", LUA_NATIVE_MISC_DISPLAY_ONSCREEN_KEYBOARD_WITH_LONGER_INITIAL_STRING);
-		MISC.set_function("DISPLAY_ONSCREEN_KEYBOARD", LUA_NATIVE_MISC_DISPLAY_ONSCREEN_KEYBOARD);
-		MISC.set_function("UPDATE_ONSCREEN_KEYBOARD", LUA_NATIVE_MISC_UPDATE_ONSCREEN_KEYBOARD);
-		MISC.set_function("GET_ONSCREEN_KEYBOARD_RESULT", LUA_NATIVE_MISC_GET_ONSCREEN_KEYBOARD_RESULT);
-		MISC.set_function("CANCEL_ONSCREEN_KEYBOARD", LUA_NATIVE_MISC_CANCEL_ONSCREEN_KEYBOARD);
-		MISC.set_function("NEXT_ONSCREEN_KEYBOARD_RESULT_WILL_DISPLAY_USING_THESE_FONTS", LUA_NATIVE_MISC_NEXT_ONSCREEN_KEYBOARD_RESULT_WILL_DISPLAY_USING_THESE_FONTS);
-		MISC.set_function("ACTION_MANAGER_ENABLE_ACTION", LUA_NATIVE_MISC_ACTION_MANAGER_ENABLE_ACTION);
-		MISC.set_function("GET_REAL_WORLD_TIME", LUA_NATIVE_MISC_GET_REAL_WORLD_TIME);
-		MISC.set_function("SUPRESS_RANDOM_EVENT_THIS_FRAME", LUA_NATIVE_MISC_SUPRESS_RANDOM_EVENT_THIS_FRAME);
-		MISC.set_function("SET_EXPLOSIVE_AMMO_THIS_FRAME", LUA_NATIVE_MISC_SET_EXPLOSIVE_AMMO_THIS_FRAME);
-		MISC.set_function("SET_FIRE_AMMO_THIS_FRAME", LUA_NATIVE_MISC_SET_FIRE_AMMO_THIS_FRAME);
-		MISC.set_function("SET_EXPLOSIVE_MELEE_THIS_FRAME", LUA_NATIVE_MISC_SET_EXPLOSIVE_MELEE_THIS_FRAME);
-		MISC.set_function("SET_SUPER_JUMP_THIS_FRAME", LUA_NATIVE_MISC_SET_SUPER_JUMP_THIS_FRAME);
-		MISC.set_function("SET_BEAST_JUMP_THIS_FRAME", LUA_NATIVE_MISC_SET_BEAST_JUMP_THIS_FRAME);
-		MISC.set_function("SET_FORCED_JUMP_THIS_FRAME", LUA_NATIVE_MISC_SET_FORCED_JUMP_THIS_FRAME);
-		MISC.set_function("HAS_GAME_INSTALLED_THIS_SESSION", LUA_NATIVE_MISC_HAS_GAME_INSTALLED_THIS_SESSION);
-		MISC.set_function("SET_TICKER_JOHNMARSTON_IS_DONE", LUA_NATIVE_MISC_SET_TICKER_JOHNMARSTON_IS_DONE);
-		MISC.set_function("ARE_PROFILE_SETTINGS_VALID", LUA_NATIVE_MISC_ARE_PROFILE_SETTINGS_VALID);
-		MISC.set_function("PREVENT_ARREST_STATE_THIS_FRAME", LUA_NATIVE_MISC_PREVENT_ARREST_STATE_THIS_FRAME);
-		MISC.set_function("FORCE_GAME_STATE_PLAYING", LUA_NATIVE_MISC_FORCE_GAME_STATE_PLAYING);
-		MISC.set_function("SCRIPT_RACE_INIT", LUA_NATIVE_MISC_SCRIPT_RACE_INIT);
-		MISC.set_function("SCRIPT_RACE_SHUTDOWN", LUA_NATIVE_MISC_SCRIPT_RACE_SHUTDOWN);
-		MISC.set_function("SCRIPT_RACE_PLAYER_HIT_CHECKPOINT", LUA_NATIVE_MISC_SCRIPT_RACE_PLAYER_HIT_CHECKPOINT);
-		MISC.set_function("SCRIPT_RACE_GET_PLAYER_SPLIT_TIME", LUA_NATIVE_MISC_SCRIPT_RACE_GET_PLAYER_SPLIT_TIME);
-		MISC.set_function("START_END_USER_BENCHMARK", LUA_NATIVE_MISC_START_END_USER_BENCHMARK);
-		MISC.set_function("STOP_END_USER_BENCHMARK", LUA_NATIVE_MISC_STOP_END_USER_BENCHMARK);
-		MISC.set_function("RESET_END_USER_BENCHMARK", LUA_NATIVE_MISC_RESET_END_USER_BENCHMARK);
-		MISC.set_function("SAVE_END_USER_BENCHMARK", LUA_NATIVE_MISC_SAVE_END_USER_BENCHMARK);
-		MISC.set_function("UI_STARTED_END_USER_BENCHMARK", LUA_NATIVE_MISC_UI_STARTED_END_USER_BENCHMARK);
-		MISC.set_function("LANDING_SCREEN_STARTED_END_USER_BENCHMARK", LUA_NATIVE_MISC_LANDING_SCREEN_STARTED_END_USER_BENCHMARK);
-		MISC.set_function("IS_COMMANDLINE_END_USER_BENCHMARK", LUA_NATIVE_MISC_IS_COMMANDLINE_END_USER_BENCHMARK);
-		MISC.set_function("GET_BENCHMARK_ITERATIONS", LUA_NATIVE_MISC_GET_BENCHMARK_ITERATIONS);
-		MISC.set_function("GET_BENCHMARK_PASS", LUA_NATIVE_MISC_GET_BENCHMARK_PASS);
-		MISC.set_function("RESTART_GAME", LUA_NATIVE_MISC_RESTART_GAME);
-		MISC.set_function("QUIT_GAME", LUA_NATIVE_MISC_QUIT_GAME);
-		MISC.set_function("HAS_ASYNC_INSTALL_FINISHED", LUA_NATIVE_MISC_HAS_ASYNC_INSTALL_FINISHED);
-		MISC.set_function("CLEANUP_ASYNC_INSTALL", LUA_NATIVE_MISC_CLEANUP_ASYNC_INSTALL);
-		MISC.set_function("PLM_IS_IN_CONSTRAINED_MODE", LUA_NATIVE_MISC_PLM_IS_IN_CONSTRAINED_MODE);
-		MISC.set_function("PLM_GET_CONSTRAINED_DURATION_MS", LUA_NATIVE_MISC_PLM_GET_CONSTRAINED_DURATION_MS);
-		MISC.set_function("SET_PLAYER_IS_IN_ANIMAL_FORM", LUA_NATIVE_MISC_SET_PLAYER_IS_IN_ANIMAL_FORM);
-		MISC.set_function("GET_IS_PLAYER_IN_ANIMAL_FORM", LUA_NATIVE_MISC_GET_IS_PLAYER_IN_ANIMAL_FORM);
-		MISC.set_function("SET_PLAYER_IS_REPEATING_A_MISSION", LUA_NATIVE_MISC_SET_PLAYER_IS_REPEATING_A_MISSION);
-		MISC.set_function("DISABLE_SCREEN_DIMMING_THIS_FRAME", LUA_NATIVE_MISC_DISABLE_SCREEN_DIMMING_THIS_FRAME);
-		MISC.set_function("GET_CITY_DENSITY", LUA_NATIVE_MISC_GET_CITY_DENSITY);
-		MISC.set_function("USE_ACTIVE_CAMERA_FOR_TIMESLICING_CENTRE", LUA_NATIVE_MISC_USE_ACTIVE_CAMERA_FOR_TIMESLICING_CENTRE);
-		MISC.set_function("SET_CONTENT_ID_INDEX", LUA_NATIVE_MISC_SET_CONTENT_ID_INDEX);
-		MISC.set_function("GET_CONTENT_ID_INDEX", LUA_NATIVE_MISC_GET_CONTENT_ID_INDEX);
-		MISC.set_function("SET_CONTENT_PROP_TYPE_", LUA_NATIVE_MISC_SET_CONTENT_PROP_TYPE_);
-		MISC.set_function("GET_CONTENT_PROP_TYPE_", LUA_NATIVE_MISC_GET_CONTENT_PROP_TYPE_);
+		bind_namespace(L, "MISC", MISC_natives);
 	}
 }
@@ -133,33 +133,36 @@ namespace lua::native
 		return renderId;
 	}
 
+	static constexpr native_entry MOBILE_natives[] = {
+		{"CAN_PHONE_BE_SEEN_ON_SCREEN", native_function<LUA_NATIVE_MOBILE_CAN_PHONE_BE_SEEN_ON_SCREEN>},
+		{"CELL_CAM_ACTIVATE", native_function<LUA_NATIVE_MOBILE_CELL_CAM_ACTIVATE>},
+		{"CELL_CAM_ACTIVATE_SELFIE_MODE", native_function<LUA_NATIVE_MOBILE_CELL_CAM_ACTIVATE_SELFIE_MODE>},
+		{"CELL_CAM_ACTIVATE_SHALLOW_DOF_MODE", native_function<LUA_NATIVE_MOBILE_CELL_CAM_ACTIVATE_SHALLOW_DOF_MODE>},
+		{"CELL_CAM_IS_CHAR_VISIBLE_NO_FACE_CHECK", native_function<LUA_NATIVE_MOBILE_CELL_CAM_IS_CHAR_VISIBLE_NO_FACE_CHECK>},
+		{"CELL_CAM_SET_SELFIE_MODE_DISTANCE_SCALING", native_function<LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_DISTANCE_SCALING>},
+		{"CELL_CAM_SET_SELFIE_MODE_HEAD_PITCH_OFFSET", native_function<LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_HEAD_PITCH_OFFSET>},
+		{"CELL_CAM_SET_SELFIE_MODE_HEAD_ROLL_OFFSET", native_function<LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_HEAD_ROLL_OFFSET>},
+		{"CELL_CAM_SET_SELFIE_MODE_HEAD_YAW_OFFSET", native_function<LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_HEAD_YAW_OFFSET>},
+		{"CELL_CAM_SET_SELFIE_MODE_HORZ_PAN_OFFSET", native_function<LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_HORZ_PAN_OFFSET>},
+		{"CELL_CAM_SET_SELFIE_MODE_ROLL_OFFSET", native_function<LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_ROLL_OFFSET>},
+		{"CELL_CAM_SET_SELFIE_MODE_SIDE_OFFSET_SCALING", native_function<LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_SIDE_OFFSET_SCALING>},
+		{"CELL_CAM_SET_SELFIE_MODE_VERT_PAN_OFFSET", native_function<LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_VERT_PAN_OFFSET>},
+		{"CELL_HORIZONTAL_MODE_TOGGLE", native_function<LUA_NATIVE_MOBILE_CELL_HORIZONTAL_MODE_TOGGLE>},
+		{"CELL_SET_INPUT", native_function<LUA_NATIVE_MOBILE_CELL_SET_INPUT>},
+		{"CREATE_MOBILE_PHONE", native_function<LUA_NATIVE_MOBILE_CREATE_MOBILE_PHONE>},
+		{"DESTROY_MOBILE_PHONE", native_function<LUA_NATIVE_MOBILE_DESTROY_MOBILE_PHONE>},
+		{"GET_MOBILE_PHONE_POSITION", native_function<LUA_NATIVE_MOBILE_GET_MOBILE_PHONE_POSITION>},
+		{"GET_MOBILE_PHONE_RENDER_ID", native_function<LUA_NATIVE_MOBILE_GET_MOBILE_PHONE_RENDER_ID>},
+		{"GET_MOBILE_PHONE_ROTATION", native_function<LUA_NATIVE_MOBILE_GET_MOBILE_PHONE_ROTATION>},
+		{"SCRIPT_IS_MOVING_MOBILE_PHONE_OFFSCREEN", native_function<LUA_NATIVE_MOBILE_SCRIPT_IS_MOVING_MOBILE_PHONE_OFFSCREEN>},
+		{"SET_MOBILE_PHONE_DOF_STATE", native_function<LUA_NATIVE_MOBILE_SET_MOBILE_PHONE_DOF_STATE>},
+		{"SET_MOBILE_PHONE_POSITION", native_function<LUA_NATIVE_MOBILE_SET_MOBILE_PHONE_POSITION>},
+		{"SET_MOBILE_PHONE_ROTATION", native_function<LUA_NATIVE_MOBILE_SET_MOBILE_PHONE_ROTATION>},
+		{"SET_MOBILE_PHONE_SCALE", native_function<LUA_NATIVE_MOBILE_SET_MOBILE_PHONE_SCALE>},
+	};
+
 	void init_native_binding_MOBILE(sol::state& L)
 	{
-		auto MOBILE = L["MOBILE"].get_or_create<sol::table>();
-		MOBILE.set_function("CREATE_MOBILE_PHONE", LUA_NATIVE_MOBILE_CREATE_MOBILE_PHONE);
-		MOBILE.set_function("DESTROY_MOBILE_PHONE", LUA_NATIVE_MOBILE_DESTROY_MOBILE_PHONE);
-		MOBILE.set_function("SET_MOBILE_PHONE_SCALE", LUA_NATIVE_MOBILE_SET_MOBILE_PHONE_SCALE);
-		MOBILE.set_function("SET_MOBILE_PHONE_ROTATION", LUA_NATIVE_MOBILE_SET_MOBILE_PHONE_ROTATION);
-		MOBILE.set_function("GET_MOBILE_PHONE_ROTATION", LUA_NATIVE_MOBILE_GET_MOBILE_PHONE_ROTATION);
-		MOBILE.set_function("SET_MOBILE_PHONE_POSITION", LUA_NATIVE_MOBILE_SET_MOBILE_PHONE_POSITION);
-		MOBILE.set_function("GET_MOBILE_PHONE_POSITION", LUA_NATIVE_MOBILE_GET_MOBILE_PHONE_POSITION);
-		MOBILE.set_function("SCRIPT_IS_MOVING_MOBILE_PHONE_OFFSCREEN", LUA_NATIVE_MOBILE_SCRIPT_IS_MOVING_MOBILE_PHONE_OFFSCREEN);
-		MOBILE.set_function("CAN_PHONE_BE_SEEN_ON_SCREEN", LUA_NATIVE_MOBILE_CAN_PHONE_BE_SEEN_ON_SCREEN);
-		MOBILE.set_function("SET_MOBILE_PHONE_DOF_STATE", LUA_NATIVE_MOBILE_SET_MOBILE_PHONE_DOF_STATE);
-		MOBILE.set_function("CELL_SET_INPUT", LUA_NATIVE_MOBILE_CELL_SET_INPUT);
-		MOBILE.set_function("CELL_HORIZONTAL_MODE_TOGGLE", LUA_NATIVE_MOBILE_CELL_HORIZONTAL_MODE_TOGGLE);
-		MOBILE.set_function("CELL_CAM_ACTIVATE", LUA_NATIVE_MOBILE_CELL_CAM_ACTIVATE);
-		MOBILE.set_function("CELL_CAM_ACTIVATE_SELFIE_MODE", LUA_NATIVE_MOBILE_CELL_CAM_ACTIVATE_SELFIE_MODE);
-		MOBILE.set_function("CELL_CAM_ACTIVATE_SHALLOW_DOF_MODE", LUA_NATIVE_MOBILE_CELL_CAM_ACTIVATE_SHALLOW_DOF_MODE);
-		MOBILE.set_function("CELL_CAM_SET_SELFIE_MODE_SIDE_OFFSET_SCALING", LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_SIDE_OFFSET_SCALING);
-		MOBILE.set_function("CELL_CAM_SET_SELFIE_MODE_HORZ_PAN_OFFSET", LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_HORZ_PAN_OFFSET);
-		MOBILE.set_function("CELL_CAM_SET_SELFIE_MODE_VERT_PAN_OFFSET", LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_VERT_PAN_OFFSET);
-		MOBILE.set_function("CELL_CAM_SET_SELFIE_MODE_ROLL_OFFSET", LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_ROLL_OFFSET);
-		MOBILE.set_function("CELL_CAM_SET_SELFIE_MODE_DISTANCE_SCALING", LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_DISTANCE_SCALING);
-		MOBILE.set_function("CELL_CAM_SET_SELFIE_MODE_HEAD_YAW_OFFSET", LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_HEAD_YAW_OFFSET);
-		MOBILE.set_function("CELL_CAM_SET_SELFIE_MODE_HEAD_ROLL_OFFSET", LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_HEAD_ROLL_OFFSET);
-		MOBILE.set_function("CELL_CAM_SET_SELFIE_MODE_HEAD_PITCH_OFFSET", LUA_NATIVE_MOBILE_CELL_CAM_SET_SELFIE_MODE_HEAD_PITCH_OFFSET);
-		MOBILE.set_function("CELL_CAM_IS_CHAR_VISIBLE_NO_FACE_CHECK", LUA_NATIVE_MOBILE_CELL_CAM_IS_CHAR_VISIBLE_NO_FACE_CHECK);
-		MOBILE.set_function("GET_MOBILE_PHONE_RENDER_ID", LUA_NATIVE_MOBILE_GET_MOBILE_PHONE_RENDER_ID);
+		bind_namespace(L, "MOBILE", MOBILE_natives);
 	}
 }
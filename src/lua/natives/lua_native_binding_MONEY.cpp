@@ -1826,364 +1826,367 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry MONEY_natives[] = {
+		{"CAN_PAY_AMOUNT_TO_BOSS", native_function<LUA_NATIVE_MONEY_CAN_PAY_AMOUNT_TO_BOSS>},
+		{"DEPOSIT_VC", native_function<LUA_NATIVE_MONEY_DEPOSIT_VC>},
+		{"HAS_VC_WITHDRAWAL_COMPLETED", native_function<LUA_NATIVE_MONEY_HAS_VC_WITHDRAWAL_COMPLETED>},
+		{"NETWORK_BUY_AIRSTRIKE", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_AIRSTRIKE>},
+		{"NETWORK_BUY_BACKUP_GANG", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_BACKUP_GANG>},
+		{"NETWORK_BUY_BOUNTY", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_BOUNTY>},
+		{"NETWORK_BUY_CONTRABAND_MISSION", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_CONTRABAND_MISSION>},
+		{"NETWORK_BUY_FAIRGROUND_RIDE", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_FAIRGROUND_RIDE>},
+		{"NETWORK_BUY_HEALTHCARE", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_HEALTHCARE>},
+		{"NETWORK_BUY_HELI_STRIKE", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_HELI_STRIKE>},
+		{"NETWORK_BUY_ITEM", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_ITEM>},
+		{"NETWORK_BUY_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_PROPERTY>},
+		{"NETWORK_BUY_SMOKES", native_function<LUA_NATIVE_MONEY_NETWORK_BUY_SMOKES>},
+		{"NETWORK_CAN_BET", native_function<LUA_NATIVE_MONEY_NETWORK_CAN_BET>},
+		{"NETWORK_CAN_RECEIVE_PLAYER_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_CAN_RECEIVE_PLAYER_CASH>},
+		{"NETWORK_CAN_SHARE_JOB_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_CAN_SHARE_JOB_CASH>},
+		{"NETWORK_CAN_SPEND_MONEY", native_function<LUA_NATIVE_MONEY_NETWORK_CAN_SPEND_MONEY>},
+		{"NETWORK_CAN_SPEND_MONEY2", native_function<LUA_NATIVE_MONEY_NETWORK_CAN_SPEND_MONEY2>},
+		{"NETWORK_CASINO_BUY_CHIPS", native_function<LUA_NATIVE_MONEY_NETWORK_CASINO_BUY_CHIPS>},
+		{"NETWORK_CASINO_CAN_BET", native_function<LUA_NATIVE_MONEY_NETWORK_CASINO_CAN_BET>},
+		{"NETWORK_CASINO_CAN_BET_AMOUNT", native_function<LUA_NATIVE_MONEY_NETWORK_CASINO_CAN_BET_AMOUNT>},
+		{"NETWORK_CASINO_CAN_BET_PVC", native_function<LUA_NATIVE_MONEY_NETWORK_CASINO_CAN_BET_PVC>},
+		{"NETWORK_CASINO_CAN_BUY_CHIPS_PVC", native_function<LUA_NATIVE_MONEY_NETWORK_CASINO_CAN_BUY_CHIPS_PVC>},
+		{"NETWORK_CASINO_SELL_CHIPS", native_function<LUA_NATIVE_MONEY_NETWORK_CASINO_SELL_CHIPS>},
+		{"NETWORK_CLEAR_CHARACTER_WALLET", native_function<LUA_NATIVE_MONEY_NETWORK_CLEAR_CHARACTER_WALLET>},
+		{"NETWORK_CLEAR_TRANSACTION_TELEMETRY_NONCE_", native_function<LUA_NATIVE_MONEY_NETWORK_CLEAR_TRANSACTION_TELEMETRY_NONCE_>},
+		{"NETWORK_DEDUCT_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_DEDUCT_CASH>},
+		{"NETWORK_DEFER_CASH_TRANSACTIONS_UNTIL_SHOP_SAVE", native_function<LUA_NATIVE_MONEY_NETWORK_DEFER_CASH_TRANSACTIONS_UNTIL_SHOP_SAVE>},
+		{"NETWORK_DELETE_CHARACTER", native_function<LUA_NATIVE_MONEY_NETWORK_DELETE_CHARACTER>},
+		{"NETWORK_EARN_AGENCY", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AGENCY>},
+		{"NETWORK_EARN_AGENCY_CONTRACT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AGENCY_CONTRACT>},
+		{"NETWORK_EARN_AGENCY_PHONE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AGENCY_PHONE>},
+		{"NETWORK_EARN_AGENCY_SAFE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AGENCY_SAFE>},
+		{"NETWORK_EARN_ARCADE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_ARCADE>},
+		{"NETWORK_EARN_ARENA_CAREER_PROGRESSION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_CAREER_PROGRESSION>},
+		{"NETWORK_EARN_ARENA_SKILL_LEVEL_PROGRESSION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_SKILL_LEVEL_PROGRESSION>},
+		{"NETWORK_EARN_ARENA_WAR", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_WAR>},
+		{"NETWORK_EARN_ARENA_WAR_ASSASSINATE_TARGET", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_WAR_ASSASSINATE_TARGET>},
+		{"NETWORK_EARN_ARENA_WAR_EVENT_CARGO", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_WAR_EVENT_CARGO>},
+		{"NETWORK_EARN_ASSASSINATE_TARGET_KILLED", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_ASSASSINATE_TARGET_KILLED>},
+		{"NETWORK_EARN_AUTOSHOP_BUSINESS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AUTOSHOP_BUSINESS>},
+		{"NETWORK_EARN_AUTOSHOP_INCOME", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AUTOSHOP_INCOME>},
+		{"NETWORK_EARN_AVENGER_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AVENGER_>},
+		{"NETWORK_EARN_AWARD_ACID_LAB_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_ACID_LAB_>},
+		{"NETWORK_EARN_AWARD_CONTRACT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_CONTRACT>},
+		{"NETWORK_EARN_AWARD_DAILY_STASH_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_DAILY_STASH_>},
+		{"NETWORK_EARN_AWARD_DEAD_DROP_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_DEAD_DROP_>},
+		{"NETWORK_EARN_AWARD_FIXER_MISSION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_FIXER_MISSION>},
+		{"NETWORK_EARN_AWARD_JUGGALO_MISSION_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_JUGGALO_MISSION_>},
+		{"NETWORK_EARN_AWARD_PHONE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_PHONE>},
+		{"NETWORK_EARN_AWARD_RANDOM_EVENT_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_RANDOM_EVENT_>},
+		{"NETWORK_EARN_AWARD_SHORT_TRIP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_SHORT_TRIP>},
+		{"NETWORK_EARN_AWARD_TAXI_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_TAXI_>},
+		{"NETWORK_EARN_BB_EVENT_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_BB_EVENT_BONUS>},
+		{"NETWORK_EARN_BEACH_PARTY_LOST_FOUND", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_BEACH_PARTY_LOST_FOUND>},
+		{"NETWORK_EARN_BIKER", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_BIKER>},
+		{"NETWORK_EARN_BIKER_SHOP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_BIKER_SHOP>},
+		{"NETWORK_EARN_BONUS_OBJECTIVE_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_BONUS_OBJECTIVE_>},
+		{"NETWORK_EARN_BOSS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_BOSS>},
+		{"NETWORK_EARN_BOUNTY_HUNTER_REWARD", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_BOUNTY_HUNTER_REWARD>},
+		{"NETWORK_EARN_CARCLUB_MEMBERSHIP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CARCLUB_MEMBERSHIP>},
+		{"NETWORK_EARN_CASINO_AWARD", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_AWARD>},
+		{"NETWORK_EARN_CASINO_COLLECTABLE_COMPLETED_COLLECTION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_COLLECTABLE_COMPLETED_COLLECTION>},
+		{"NETWORK_EARN_CASINO_HEIST", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_HEIST>},
+		{"NETWORK_EARN_CASINO_HEIST_AWARDS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_HEIST_AWARDS>},
+		{"NETWORK_EARN_CASINO_MISSION_PARTICIPATION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_MISSION_PARTICIPATION>},
+		{"NETWORK_EARN_CASINO_MISSION_REWARD", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_MISSION_REWARD>},
+		{"NETWORK_EARN_CASINO_STORY_MISSION_REWARD", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_STORY_MISSION_REWARD>},
+		{"NETWORK_EARN_CASINO_TIME_TRIAL_WIN", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_TIME_TRIAL_WIN>},
+		{"NETWORK_EARN_CHALLENGE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_CHALLENGE>},
+		{"NETWORK_EARN_COLLECTABLES", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_COLLECTABLES>},
+		{"NETWORK_EARN_COLLECTABLES_ACTION_FIGURES", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_COLLECTABLES_ACTION_FIGURES>},
+		{"NETWORK_EARN_COLLECTABLE_COMPLETED_COLLECTION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_COLLECTABLE_COMPLETED_COLLECTION>},
+		{"NETWORK_EARN_COLLECTABLE_ITEM", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_COLLECTABLE_ITEM>},
+		{"NETWORK_EARN_DAILY_OBJECTIVE_EVENT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_OBJECTIVE_EVENT>},
+		{"NETWORK_EARN_DAILY_STASH_HOUSE_COMPLETED_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_STASH_HOUSE_COMPLETED_>},
+		{"NETWORK_EARN_DAILY_STASH_HOUSE_PARTICIPATION_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_STASH_HOUSE_PARTICIPATION_>},
+		{"NETWORK_EARN_DAILY_VEHICLE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_VEHICLE>},
+		{"NETWORK_EARN_DAILY_VEHICLE_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_VEHICLE_BONUS>},
+		{"NETWORK_EARN_DAR_CHALLENGE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_DAR_CHALLENGE>},
+		{"NETWORK_EARN_DISPATCH_CALL", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_DISPATCH_CALL>},
+		{"NETWORK_EARN_DOOMSDAY_FINALE_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_DOOMSDAY_FINALE_BONUS>},
+		{"NETWORK_EARN_FIRST_TIME_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FIRST_TIME_BONUS>},
+		{"NETWORK_EARN_FIXER_AGENCY_SHORT_TRIP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FIXER_AGENCY_SHORT_TRIP>},
+		{"NETWORK_EARN_FIXER_FINALE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FIXER_FINALE>},
+		{"NETWORK_EARN_FIXER_PREP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FIXER_PREP>},
+		{"NETWORK_EARN_FIXER_RIVAL_DELIVERY", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FIXER_RIVAL_DELIVERY>},
+		{"NETWORK_EARN_FMBB_WAGE_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FMBB_WAGE_BONUS>},
+		{"NETWORK_EARN_FOOLIGAN_JOB_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FOOLIGAN_JOB_>},
+		{"NETWORK_EARN_FOOLIGAN_JOB_PARTICIPATION_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FOOLIGAN_JOB_PARTICIPATION_>},
+		{"NETWORK_EARN_FROM_AI_TARGET_KILL", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_AI_TARGET_KILL>},
+		{"NETWORK_EARN_FROM_AMBIENT_JOB", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_AMBIENT_JOB>},
+		{"NETWORK_EARN_FROM_BEND_JOB", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BEND_JOB>},
+		{"NETWORK_EARN_FROM_BETTING", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BETTING>},
+		{"NETWORK_EARN_FROM_BOUNTY", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BOUNTY>},
+		{"NETWORK_EARN_FROM_BUSINESS_BATTLE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BUSINESS_BATTLE>},
+		{"NETWORK_EARN_FROM_BUSINESS_HUB_SELL", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BUSINESS_HUB_SELL>},
+		{"NETWORK_EARN_FROM_BUSINESS_PRODUCT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BUSINESS_PRODUCT>},
+		{"NETWORK_EARN_FROM_CASHING_OUT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CASHING_OUT>},
+		{"NETWORK_EARN_FROM_CHALLENGE_WIN", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CHALLENGE_WIN>},
+		{"NETWORK_EARN_FROM_CLUB_MANAGEMENT_PARTICIPATION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CLUB_MANAGEMENT_PARTICIPATION>},
+		{"NETWORK_EARN_FROM_CONTRABAND", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CONTRABAND>},
+		{"NETWORK_EARN_FROM_CRATE_DROP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CRATE_DROP>},
+		{"NETWORK_EARN_FROM_CRIMINAL_MASTERMIND", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CRIMINAL_MASTERMIND>},
+		{"NETWORK_EARN_FROM_DAILY_OBJECTIVES", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_DAILY_OBJECTIVES>},
+		{"NETWORK_EARN_FROM_DESTROYING_CONTRABAND", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_DESTROYING_CONTRABAND>},
+		{"NETWORK_EARN_FROM_FMBB_BOSS_WORK", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_FMBB_BOSS_WORK>},
+		{"NETWORK_EARN_FROM_FMBB_PHONECALL_MISSION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_FMBB_PHONECALL_MISSION>},
+		{"NETWORK_EARN_FROM_GANGATTACK_PICKUP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_GANGATTACK_PICKUP>},
+		{"NETWORK_EARN_FROM_HANGAR_TRADE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_HANGAR_TRADE>},
+		{"NETWORK_EARN_FROM_HOLDUPS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_HOLDUPS>},
+		{"NETWORK_EARN_FROM_IMPORT_EXPORT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_IMPORT_EXPORT>},
+		{"NETWORK_EARN_FROM_ISLAND_HEIST_DJ_MISSION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_ISLAND_HEIST_DJ_MISSION>},
+		{"NETWORK_EARN_FROM_JOB", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_JOB>},
+		{"NETWORK_EARN_FROM_JOBX2", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_JOBX2>},
+		{"NETWORK_EARN_FROM_JOB_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_JOB_BONUS>},
+		{"NETWORK_EARN_FROM_NOT_BADSPORT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_NOT_BADSPORT>},
+		{"NETWORK_EARN_FROM_PERSONAL_VEHICLE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_PERSONAL_VEHICLE>},
+		{"NETWORK_EARN_FROM_PICKUP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_PICKUP>},
+		{"NETWORK_EARN_FROM_PREMIUM_JOB", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_PREMIUM_JOB>},
+		{"NETWORK_EARN_FROM_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_PROPERTY>},
+		{"NETWORK_EARN_FROM_ROB_ARMORED_CARS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_ROB_ARMORED_CARS>},
+		{"NETWORK_EARN_FROM_SELL_BUNKER", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_SELL_BUNKER>},
+		{"NETWORK_EARN_FROM_SMUGGLER_WORK", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_SMUGGLER_WORK>},
+		{"NETWORK_EARN_FROM_VEHICLE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_VEHICLE>},
+		{"NETWORK_EARN_FROM_VEHICLE_EXPORT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_VEHICLE_EXPORT>},
+		{"NETWORK_EARN_FROM_WAREHOUSE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_FROM_WAREHOUSE>},
+		{"NETWORK_EARN_GANGOPS_AWARD", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_AWARD>},
+		{"NETWORK_EARN_GANGOPS_ELITE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_ELITE>},
+		{"NETWORK_EARN_GANGOPS_FINALE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_FINALE>},
+		{"NETWORK_EARN_GANGOPS_PREP_PARTICIPATION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_PREP_PARTICIPATION>},
+		{"NETWORK_EARN_GANGOPS_SETUP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_SETUP>},
+		{"NETWORK_EARN_GANGOPS_WAGES", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_WAGES>},
+		{"NETWORK_EARN_GANGOPS_WAGES_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_WAGES_BONUS>},
+		{"NETWORK_EARN_GENERIC_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GENERIC_>},
+		{"NETWORK_EARN_GOON", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_GOON>},
+		{"NETWORK_EARN_HACKER_TRUCK", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_HACKER_TRUCK>},
+		{"NETWORK_EARN_HEIST_AWARD", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_HEIST_AWARD>},
+		{"NETWORK_EARN_ISLAND_HEIST", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_ISLAND_HEIST>},
+		{"NETWORK_EARN_JUGGALO_STORY_MISSION_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_JUGGALO_STORY_MISSION_>},
+		{"NETWORK_EARN_JUGGALO_STORY_MISSION_PARTICIPATION_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_JUGGALO_STORY_MISSION_PARTICIPATION_>},
+		{"NETWORK_EARN_NIGHTCLUB", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_NIGHTCLUB>},
+		{"NETWORK_EARN_NIGHTCLUB_AND_WAREHOUSE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_NIGHTCLUB_AND_WAREHOUSE>},
+		{"NETWORK_EARN_NIGHTCLUB_DANCING", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_NIGHTCLUB_DANCING>},
+		{"NETWORK_EARN_PROGRESS_HUB_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_PROGRESS_HUB_>},
+		{"NETWORK_EARN_PURCHASE_CLUB_HOUSE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_PURCHASE_CLUB_HOUSE>},
+		{"NETWORK_EARN_RC_TIME_TRIAL", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_RC_TIME_TRIAL>},
+		{"NETWORK_EARN_RDR_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_RDR_BONUS>},
+		{"NETWORK_EARN_SELL_ACID_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SELL_ACID_>},
+		{"NETWORK_EARN_SELL_BASE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SELL_BASE>},
+		{"NETWORK_EARN_SELL_PARTICIPATION_ACID_LAB_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SELL_PARTICIPATION_ACID_LAB_>},
+		{"NETWORK_EARN_SELL_PRIZE_VEHICLE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SELL_PRIZE_VEHICLE>},
+		{"NETWORK_EARN_SETUP_PARTICIPATION_ACID_LAB_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SETUP_PARTICIPATION_ACID_LAB_>},
+		{"NETWORK_EARN_SIGHTSEEING_REWARD", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SIGHTSEEING_REWARD>},
+		{"NETWORK_EARN_SMUGGLER_AGENCY", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SMUGGLER_AGENCY>},
+		{"NETWORK_EARN_SMUGGLER_OPS_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SMUGGLER_OPS_>},
+		{"NETWORK_EARN_SOURCE_PARTICIPATION_ACID_LAB_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SOURCE_PARTICIPATION_ACID_LAB_>},
+		{"NETWORK_EARN_SPIN_THE_WHEEL_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_SPIN_THE_WHEEL_CASH>},
+		{"NETWORK_EARN_STREET_DEALER_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_STREET_DEALER_>},
+		{"NETWORK_EARN_TARGET_REFUND", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_TARGET_REFUND>},
+		{"NETWORK_EARN_TAXI_JOB_", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_TAXI_JOB_>},
+		{"NETWORK_EARN_TUNER_AWARD", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_TUNER_AWARD>},
+		{"NETWORK_EARN_TUNER_ROBBERY", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_TUNER_ROBBERY>},
+		{"NETWORK_EARN_UPGRADE_AGENCY", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_UPGRADE_AGENCY>},
+		{"NETWORK_EARN_UPGRADE_ARCADE", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_UPGRADE_ARCADE>},
+		{"NETWORK_EARN_UPGRADE_AUTOSHOP", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_UPGRADE_AUTOSHOP>},
+		{"NETWORK_EARN_WAGE_PAYMENT", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_WAGE_PAYMENT>},
+		{"NETWORK_EARN_WAGE_PAYMENT_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_WAGE_PAYMENT_BONUS>},
+		{"NETWORK_EARN_YATCH_MISSION", native_function<LUA_NATIVE_MONEY_NETWORK_EARN_YATCH_MISSION>},
+		{"NETWORK_ECONOMY_HAS_FIXED_CRAZY_NUMBERS", native_function<LUA_NATIVE_MONEY_NETWORK_ECONOMY_HAS_FIXED_CRAZY_NUMBERS>},
+		{"NETWORK_GET_CAN_SPEND_FROM_BANK", native_function<LUA_NATIVE_MONEY_NETWORK_GET_CAN_SPEND_FROM_BANK>},
+		{"NETWORK_GET_CAN_SPEND_FROM_BANK_AND_WALLET", native_function<LUA_NATIVE_MONEY_NETWORK_GET_CAN_SPEND_FROM_BANK_AND_WALLET>},
+		{"NETWORK_GET_CAN_SPEND_FROM_WALLET", native_function<LUA_NATIVE_MONEY_NETWORK_GET_CAN_SPEND_FROM_WALLET>},
+		{"NETWORK_GET_CAN_TRANSFER_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_GET_CAN_TRANSFER_CASH>},
+		{"NETWORK_GET_EVC_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_EVC_BALANCE>},
+		{"NETWORK_GET_PLAYER_IS_HIGH_EARNER", native_function<LUA_NATIVE_MONEY_NETWORK_GET_PLAYER_IS_HIGH_EARNER>},
+		{"NETWORK_GET_PVC_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_PVC_BALANCE>},
+		{"NETWORK_GET_PVC_TRANSFER_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_PVC_TRANSFER_BALANCE>},
+		{"NETWORK_GET_REMAINING_TRANSFER_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_REMAINING_TRANSFER_BALANCE>},
+		{"NETWORK_GET_STRING_BANK_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_STRING_BANK_BALANCE>},
+		{"NETWORK_GET_STRING_BANK_WALLET_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_STRING_BANK_WALLET_BALANCE>},
+		{"NETWORK_GET_STRING_WALLET_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_STRING_WALLET_BALANCE>},
+		{"NETWORK_GET_VC_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_VC_BALANCE>},
+		{"NETWORK_GET_VC_BANK_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_VC_BANK_BALANCE>},
+		{"NETWORK_GET_VC_WALLET_BALANCE", native_function<LUA_NATIVE_MONEY_NETWORK_GET_VC_WALLET_BALANCE>},
+		{"NETWORK_GIVE_PLAYER_JOBSHARE_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_GIVE_PLAYER_JOBSHARE_CASH>},
+		{"NETWORK_INITIALIZE_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_INITIALIZE_CASH>},
+		{"NETWORK_MANUAL_DELETE_CHARACTER", native_function<LUA_NATIVE_MONEY_NETWORK_MANUAL_DELETE_CHARACTER>},
+		{"NETWORK_MONEY_CAN_BET", native_function<LUA_NATIVE_MONEY_NETWORK_MONEY_CAN_BET>},
+		{"NETWORK_PAY_EMPLOYEE_WAGE", native_function<LUA_NATIVE_MONEY_NETWORK_PAY_EMPLOYEE_WAGE>},
+		{"NETWORK_PAY_MATCH_ENTRY_FEE", native_function<LUA_NATIVE_MONEY_NETWORK_PAY_MATCH_ENTRY_FEE>},
+		{"NETWORK_RECEIVE_PLAYER_JOBSHARE_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_RECEIVE_PLAYER_JOBSHARE_CASH>},
+		{"NETWORK_REFUND_CASH", native_function<LUA_NATIVE_MONEY_NETWORK_REFUND_CASH>},
+		{"NETWORK_SERVICE_EARN_GANGOPS_RIVAL_DELIVERY", native_function<LUA_NATIVE_MONEY_NETWORK_SERVICE_EARN_GANGOPS_RIVAL_DELIVERY>},
+		{"NETWORK_SPEND_AGENCY", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_AGENCY>},
+		{"NETWORK_SPEND_APARTMENT_UTILITIES", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_APARTMENT_UTILITIES>},
+		{"NETWORK_SPEND_ARCADE", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_ARCADE>},
+		{"NETWORK_SPEND_ARCADE_MGMT", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_ARCADE_MGMT>},
+		{"NETWORK_SPEND_ARENA_PREMIUM", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_ARENA_PREMIUM>},
+		{"NETWORK_SPEND_ARENA_SPECTATOR_BOX", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_ARENA_SPECTATOR_BOX>},
+		{"NETWORK_SPEND_AUTOSHOP_MODIFY", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_AUTOSHOP_MODIFY>},
+		{"NETWORK_SPEND_BEACH_PARTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BEACH_PARTY>},
+		{"NETWORK_SPEND_BIKE_SHOP", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BIKE_SHOP>},
+		{"NETWORK_SPEND_BOSS", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BOSS>},
+		{"NETWORK_SPEND_BOUNTY_HUNTER_MISSION", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BOUNTY_HUNTER_MISSION>},
+		{"NETWORK_SPEND_BUSINESS_PROPERTY_FEES", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUSINESS_PROPERTY_FEES>},
+		{"NETWORK_SPEND_BUY_ACID_LAB_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_ACID_LAB_>},
+		{"NETWORK_SPEND_BUY_AGENCY", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_AGENCY>},
+		{"NETWORK_SPEND_BUY_ARCADE", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_ARCADE>},
+		{"NETWORK_SPEND_BUY_ARENA", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_ARENA>},
+		{"NETWORK_SPEND_BUY_AUTOSHOP", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_AUTOSHOP>},
+		{"NETWORK_SPEND_BUY_CASINO", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_CASINO>},
+		{"NETWORK_SPEND_BUY_MFGARAGE_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_MFGARAGE_>},
+		{"NETWORK_SPEND_BUY_SUB", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_SUB>},
+		{"NETWORK_SPEND_BUY_SUPPLIES_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_SUPPLIES_>},
+		{"NETWORK_SPEND_CAR_CLUB_BAR", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_CAR_CLUB_BAR>},
+		{"NETWORK_SPEND_CAR_CLUB_MEMBERSHIP", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_CAR_CLUB_MEMBERSHIP>},
+		{"NETWORK_SPEND_CAR_CLUB_TAKEOVER", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_CAR_CLUB_TAKEOVER>},
+		{"NETWORK_SPEND_CASINO_CLUB", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_CLUB>},
+		{"NETWORK_SPEND_CASINO_GENERIC", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_GENERIC>},
+		{"NETWORK_SPEND_CASINO_HEIST", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_HEIST>},
+		{"NETWORK_SPEND_CASINO_HEIST_SKIP_MISSION", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_HEIST_SKIP_MISSION>},
+		{"NETWORK_SPEND_CASINO_MEMBERSHIP", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_MEMBERSHIP>},
+		{"NETWORK_SPEND_COMP_SUV", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_COMP_SUV>},
+		{"NETWORK_SPEND_EARNED_FROM_BANK_AND_WALLETS", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_EARNED_FROM_BANK_AND_WALLETS>},
+		{"NETWORK_SPEND_GANGOPS_CANNON", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_CANNON>},
+		{"NETWORK_SPEND_GANGOPS_REPAIR_COST", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_REPAIR_COST>},
+		{"NETWORK_SPEND_GANGOPS_SKIP_MISSION", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_SKIP_MISSION>},
+		{"NETWORK_SPEND_GANGOPS_START_STRAND", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_START_STRAND>},
+		{"NETWORK_SPEND_GANGOPS_TRIP_SKIP", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_TRIP_SKIP>},
+		{"NETWORK_SPEND_GOON", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_GOON>},
+		{"NETWORK_SPEND_GUNRUNNING", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_GUNRUNNING>},
+		{"NETWORK_SPEND_HIDDEN", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_HIDDEN>},
+		{"NETWORK_SPEND_INTERACTION_MENU_ABILITY", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_INTERACTION_MENU_ABILITY>},
+		{"NETWORK_SPEND_ISLAND_HEIST", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_ISLAND_HEIST>},
+		{"NETWORK_SPEND_MAKE_IT_RAIN", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_MAKE_IT_RAIN>},
+		{"NETWORK_SPEND_NIGHTCLUB_AND_WAREHOUSE", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_NIGHTCLUB_AND_WAREHOUSE>},
+		{"NETWORK_SPEND_NIGHTCLUB_BAR_DRINK", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_NIGHTCLUB_BAR_DRINK>},
+		{"NETWORK_SPEND_PLAY_ARCADE", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_PLAY_ARCADE>},
+		{"NETWORK_SPEND_RENAME_ACID_LAB_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_RENAME_ACID_LAB_>},
+		{"NETWORK_SPEND_RENAME_ACID_PRODUCT_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_RENAME_ACID_PRODUCT_>},
+		{"NETWORK_SPEND_SET_COMMON_FIELDS", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_SET_COMMON_FIELDS>},
+		{"NETWORK_SPEND_SET_DISCOUNT", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_SET_DISCOUNT>},
+		{"NETWORK_SPEND_SOURCE_BIKE", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_SOURCE_BIKE>},
+		{"NETWORK_SPEND_SPIN_THE_WHEEL_PAYMENT", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_SPIN_THE_WHEEL_PAYMENT>},
+		{"NETWORK_SPEND_SUBMARINE", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_SUBMARINE>},
+		{"NETWORK_SPEND_SUPPLY", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_SUPPLY>},
+		{"NETWORK_SPEND_SUV_FST_TRVL", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_SUV_FST_TRVL>},
+		{"NETWORK_SPEND_UPGRADE_ACID_LAB_ARMOR_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ACID_LAB_ARMOR_>},
+		{"NETWORK_SPEND_UPGRADE_ACID_LAB_EQUIPMENT_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ACID_LAB_EQUIPMENT_>},
+		{"NETWORK_SPEND_UPGRADE_ACID_LAB_MINES_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ACID_LAB_MINES_>},
+		{"NETWORK_SPEND_UPGRADE_ACID_LAB_SCOOP_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ACID_LAB_SCOOP_>},
+		{"NETWORK_SPEND_UPGRADE_AGENCY", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_AGENCY>},
+		{"NETWORK_SPEND_UPGRADE_ARCADE", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ARCADE>},
+		{"NETWORK_SPEND_UPGRADE_ARENA", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ARENA>},
+		{"NETWORK_SPEND_UPGRADE_AUTOSHOP", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_AUTOSHOP>},
+		{"NETWORK_SPEND_UPGRADE_CASINO", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_CASINO>},
+		{"NETWORK_SPEND_UPGRADE_MFGARAGE_", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_MFGARAGE_>},
+		{"NETWORK_SPEND_UPGRADE_SUB", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_SUB>},
+		{"NETWORK_SPEND_VEHICLE_REQUESTED", native_function<LUA_NATIVE_MONEY_NETWORK_SPEND_VEHICLE_REQUESTED>},
+		{"NETWORK_SPENT_AIR_FREIGHT_", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_AIR_FREIGHT_>},
+		{"NETWORK_SPENT_AMMO_DROP", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_AMMO_DROP>},
+		{"NETWORK_SPENT_ARENA_JOIN_SPECTATOR", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_ARENA_JOIN_SPECTATOR>},
+		{"NETWORK_SPENT_ARREST_BAIL", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_ARREST_BAIL>},
+		{"NETWORK_SPENT_BALLISTIC_EQUIPMENT", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BALLISTIC_EQUIPMENT>},
+		{"NETWORK_SPENT_BANK_INTEREST", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BANK_INTEREST>},
+		{"NETWORK_SPENT_BETTING", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BETTING>},
+		{"NETWORK_SPENT_BOAT_PICKUP", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BOAT_PICKUP>},
+		{"NETWORK_SPENT_BOSS_GOON", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BOSS_GOON>},
+		{"NETWORK_SPENT_BOUNTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BOUNTY>},
+		{"NETWORK_SPENT_BULL_SHARK", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BULL_SHARK>},
+		{"NETWORK_SPENT_BUY_BASE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_BASE>},
+		{"NETWORK_SPENT_BUY_BUNKER", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_BUNKER>},
+		{"NETWORK_SPENT_BUY_OFFTHERADAR", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_OFFTHERADAR>},
+		{"NETWORK_SPENT_BUY_PASSIVE_MODE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_PASSIVE_MODE>},
+		{"NETWORK_SPENT_BUY_REVEAL_PLAYERS", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_REVEAL_PLAYERS>},
+		{"NETWORK_SPENT_BUY_TILTROTOR", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_TILTROTOR>},
+		{"NETWORK_SPENT_BUY_TRUCK", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_TRUCK>},
+		{"NETWORK_SPENT_BUY_WANTEDLEVEL", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_WANTEDLEVEL>},
+		{"NETWORK_SPENT_CALL_PLAYER", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_CALL_PLAYER>},
+		{"NETWORK_SPENT_CARGO_SOURCING", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_CARGO_SOURCING>},
+		{"NETWORK_SPENT_CARWASH", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_CARWASH>},
+		{"NETWORK_SPENT_CASH_DROP", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_CASH_DROP>},
+		{"NETWORK_SPENT_CHANGE_APPEARANCE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_CHANGE_APPEARANCE>},
+		{"NETWORK_SPENT_CINEMA", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_CINEMA>},
+		{"NETWORK_SPENT_EMPLOY_ASSASSINS", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_EMPLOY_ASSASSINS>},
+		{"NETWORK_SPENT_FROM_ROCKSTAR", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_FROM_ROCKSTAR>},
+		{"NETWORK_SPENT_GENERIC_", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_GENERIC_>},
+		{"NETWORK_SPENT_HANGAR_STAFF_CHARGES", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_HANGAR_STAFF_CHARGES>},
+		{"NETWORK_SPENT_HANGAR_UTILITY_CHARGES", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_HANGAR_UTILITY_CHARGES>},
+		{"NETWORK_SPENT_HELI_PICKUP", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_HELI_PICKUP>},
+		{"NETWORK_SPENT_HIRE_MERCENARY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_HIRE_MERCENARY>},
+		{"NETWORK_SPENT_HIRE_MUGGER", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_HIRE_MUGGER>},
+		{"NETWORK_SPENT_HOLDUPS", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_HOLDUPS>},
+		{"NETWORK_SPENT_IMPORT_EXPORT_REPAIR", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_IMPORT_EXPORT_REPAIR>},
+		{"NETWORK_SPENT_IN_STRIPCLUB", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_IN_STRIPCLUB>},
+		{"NETWORK_SPENT_JOB_SKIP", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_JOB_SKIP>},
+		{"NETWORK_SPENT_JUKEBOX", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_JUKEBOX>},
+		{"NETWORK_SPENT_MC_ABILITY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_MC_ABILITY>},
+		{"NETWORK_SPENT_MISSILE_JAMMER_", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_MISSILE_JAMMER_>},
+		{"NETWORK_SPENT_MOVE_SUBMARINE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_MOVE_SUBMARINE>},
+		{"NETWORK_SPENT_MOVE_YACHT", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_MOVE_YACHT>},
+		{"NETWORK_SPENT_NIGHTCLUB_ENTRY_FEE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_NIGHTCLUB_ENTRY_FEE>},
+		{"NETWORK_SPENT_NO_COPS", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_NO_COPS>},
+		{"NETWORK_SPENT_ORDER_BODYGUARD_VEHICLE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_ORDER_BODYGUARD_VEHICLE>},
+		{"NETWORK_SPENT_ORDER_WAREHOUSE_VEHICLE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_ORDER_WAREHOUSE_VEHICLE>},
+		{"NETWORK_SPENT_PAY_BUSINESS_SUPPLIES", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PAY_BUSINESS_SUPPLIES>},
+		{"NETWORK_SPENT_PAY_VEHICLE_INSURANCE_PREMIUM", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PAY_VEHICLE_INSURANCE_PREMIUM>},
+		{"NETWORK_SPENT_PA_HELI_PICKUP", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PA_HELI_PICKUP>},
+		{"NETWORK_SPENT_PA_SERVICE_DANCER", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_DANCER>},
+		{"NETWORK_SPENT_PA_SERVICE_HELI", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_HELI>},
+		{"NETWORK_SPENT_PA_SERVICE_IMPOUND", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_IMPOUND>},
+		{"NETWORK_SPENT_PA_SERVICE_SNACK", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_SNACK>},
+		{"NETWORK_SPENT_PA_SERVICE_VEHICLE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_VEHICLE>},
+		{"NETWORK_SPENT_PLAYER_HEALTHCARE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PLAYER_HEALTHCARE>},
+		{"NETWORK_SPENT_PROSTITUTES", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PROSTITUTES>},
+		{"NETWORK_SPENT_PURCHASE_BUSINESS_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_BUSINESS_PROPERTY>},
+		{"NETWORK_SPENT_PURCHASE_CLUB_HOUSE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_CLUB_HOUSE>},
+		{"NETWORK_SPENT_PURCHASE_HACKER_TRUCK", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_HACKER_TRUCK>},
+		{"NETWORK_SPENT_PURCHASE_HANGAR", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_HANGAR>},
+		{"NETWORK_SPENT_PURCHASE_IMPEXP_WAREHOUSE_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_IMPEXP_WAREHOUSE_PROPERTY>},
+		{"NETWORK_SPENT_PURCHASE_NIGHTCLUB_AND_WAREHOUSE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_NIGHTCLUB_AND_WAREHOUSE>},
+		{"NETWORK_SPENT_PURCHASE_OFFICE_GARAGE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_OFFICE_GARAGE>},
+		{"NETWORK_SPENT_PURCHASE_OFFICE_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_OFFICE_PROPERTY>},
+		{"NETWORK_SPENT_PURCHASE_WAREHOUSE_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_WAREHOUSE_PROPERTY>},
+		{"NETWORK_SPENT_RDR_HATCHET_BONUS", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_RDR_HATCHET_BONUS>},
+		{"NETWORK_SPENT_REHIRE_DJ", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_REHIRE_DJ>},
+		{"NETWORK_SPENT_RENAME_ORGANIZATION", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_RENAME_ORGANIZATION>},
+		{"NETWORK_SPENT_REQUEST_HEIST", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_REQUEST_HEIST>},
+		{"NETWORK_SPENT_REQUEST_JOB", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_REQUEST_JOB>},
+		{"NETWORK_SPENT_ROBBED_BY_MUGGER", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_ROBBED_BY_MUGGER>},
+		{"NETWORK_SPENT_SKIP_CARGO_SOURCE_SETUP_", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_SKIP_CARGO_SOURCE_SETUP_>},
+		{"NETWORK_SPENT_STEALTH_MODULE_", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_STEALTH_MODULE_>},
+		{"NETWORK_SPENT_TAXI", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_TAXI>},
+		{"NETWORK_SPENT_TELESCOPE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_TELESCOPE>},
+		{"NETWORK_SPENT_TRADE_BUSINESS_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_TRADE_BUSINESS_PROPERTY>},
+		{"NETWORK_SPENT_TRADE_IMPEXP_WAREHOUSE_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_TRADE_IMPEXP_WAREHOUSE_PROPERTY>},
+		{"NETWORK_SPENT_UPGRADE_BASE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_BASE>},
+		{"NETWORK_SPENT_UPGRADE_BUSINESS_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_BUSINESS_PROPERTY>},
+		{"NETWORK_SPENT_UPGRADE_CLUB_HOUSE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_CLUB_HOUSE>},
+		{"NETWORK_SPENT_UPGRADE_HACKER_TRUCK", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_HACKER_TRUCK>},
+		{"NETWORK_SPENT_UPGRADE_HANGAR", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_HANGAR>},
+		{"NETWORK_SPENT_UPGRADE_IMPEXP_WAREHOUSE_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_IMPEXP_WAREHOUSE_PROPERTY>},
+		{"NETWORK_SPENT_UPGRADE_NIGHTCLUB_AND_WAREHOUSE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_NIGHTCLUB_AND_WAREHOUSE>},
+		{"NETWORK_SPENT_UPGRADE_OFFICE_GARAGE", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_OFFICE_GARAGE>},
+		{"NETWORK_SPENT_UPGRADE_OFFICE_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_OFFICE_PROPERTY>},
+		{"NETWORK_SPENT_UPGRADE_TILTROTOR", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_TILTROTOR>},
+		{"NETWORK_SPENT_UPGRADE_TRUCK", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_TRUCK>},
+		{"NETWORK_SPENT_UPGRADE_WAREHOUSE_PROPERTY", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_WAREHOUSE_PROPERTY>},
+		{"NETWORK_SPENT_UPRADE_BUNKER", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_UPRADE_BUNKER>},
+		{"NETWORK_SPENT_VEHICLE_EXPORT_MODS", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_VEHICLE_EXPORT_MODS>},
+		{"NETWORK_SPENT_WAGER", native_function<LUA_NATIVE_MONEY_NETWORK_SPENT_WAGER>},
+		{"NETWORK_YOHAN_SOURCE_GOODS", native_function<LUA_NATIVE_MONEY_NETWORK_YOHAN_SOURCE_GOODS>},
+		{"PROCESS_CASH_GIFT", native_function<LUA_NATIVE_MONEY_PROCESS_CASH_GIFT>},
+		{"WAS_VC_WITHDRAWAL_SUCCESSFUL", native_function<LUA_NATIVE_MONEY_WAS_VC_WITHDRAWAL_SUCCESSFUL>},
+		{"WITHDRAW_VC", native_function<LUA_NATIVE_MONEY_WITHDRAW_VC>},
+	};
+
 	void init_native_binding_MONEY(sol::state& L)
 	{
-		auto MONEY = L["MONEY"].get_or_create<sol::table>();
-		MONEY.set_function("NETWORK_INITIALIZE_CASH", LUA_NATIVE_MONEY_NETWORK_INITIALIZE_CASH);
-		MONEY.set_function("NETWORK_DELETE_CHARACTER", LUA_NATIVE_MONEY_NETWORK_DELETE_CHARACTER);
-		MONEY.set_function("NETWORK_MANUAL_DELETE_CHARACTER", LUA_NATIVE_MONEY_NETWORK_MANUAL_DELETE_CHARACTER);
-		MONEY.set_function("NETWORK_GET_PLAYER_IS_HIGH_EARNER", LUA_NATIVE_MONEY_NETWORK_GET_PLAYER_IS_HIGH_EARNER);
-		MONEY.set_function("NETWORK_CLEAR_CHARACTER_WALLET", LUA_NATIVE_MONEY_NETWORK_CLEAR_CHARACTER_WALLET);
-		MONEY.set_function("NETWORK_GIVE_PLAYER_JOBSHARE_CASH", LUA_NATIVE_MONEY_NETWORK_GIVE_PLAYER_JOBSHARE_CASH);
-		MONEY.set_function("NETWORK_RECEIVE_PLAYER_JOBSHARE_CASH", LUA_NATIVE_MONEY_NETWORK_RECEIVE_PLAYER_JOBSHARE_CASH);
-		MONEY.set_function("NETWORK_CAN_SHARE_JOB_CASH", LUA_NATIVE_MONEY_NETWORK_CAN_SHARE_JOB_CASH);
-		MONEY.set_function("NETWORK_REFUND_CASH", LUA_NATIVE_MONEY_NETWORK_REFUND_CASH);
-		MONEY.set_function("NETWORK_DEDUCT_CASH", LUA_NATIVE_MONEY_NETWORK_DEDUCT_CASH);
-		MONEY.set_function("NETWORK_MONEY_CAN_BET", LUA_NATIVE_MONEY_NETWORK_MONEY_CAN_BET);
-		MONEY.set_function("NETWORK_CAN_BET", LUA_NATIVE_MONEY_NETWORK_CAN_BET);
-		MONEY.set_function("NETWORK_CASINO_CAN_BET", LUA_NATIVE_MONEY_NETWORK_CASINO_CAN_BET);
-		MONEY.set_function("NETWORK_CASINO_CAN_BET_PVC", LUA_NATIVE_MONEY_NETWORK_CASINO_CAN_BET_PVC);
-		MONEY.set_function("NETWORK_CASINO_CAN_BET_AMOUNT", LUA_NATIVE_MONEY_NETWORK_CASINO_CAN_BET_AMOUNT);
-		MONEY.set_function("NETWORK_CASINO_CAN_BUY_CHIPS_PVC", LUA_NATIVE_MONEY_NETWORK_CASINO_CAN_BUY_CHIPS_PVC);
-		MONEY.set_function("NETWORK_CASINO_BUY_CHIPS", LUA_NATIVE_MONEY_NETWORK_CASINO_BUY_CHIPS);
-		MONEY.set_function("NETWORK_CASINO_SELL_CHIPS", LUA_NATIVE_MONEY_NETWORK_CASINO_SELL_CHIPS);
-		MONEY.set_function("NETWORK_DEFER_CASH_TRANSACTIONS_UNTIL_SHOP_SAVE", LUA_NATIVE_MONEY_NETWORK_DEFER_CASH_TRANSACTIONS_UNTIL_SHOP_SAVE);
-		MONEY.set_function("CAN_PAY_AMOUNT_TO_BOSS", LUA_NATIVE_MONEY_CAN_PAY_AMOUNT_TO_BOSS);
-		MONEY.set_function("NETWORK_EARN_FROM_PICKUP", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_PICKUP);
-		MONEY.set_function("NETWORK_EARN_FROM_CASHING_OUT", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CASHING_OUT);
-		MONEY.set_function("NETWORK_EARN_FROM_GANGATTACK_PICKUP", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_GANGATTACK_PICKUP);
-		MONEY.set_function("NETWORK_EARN_ASSASSINATE_TARGET_KILLED", LUA_NATIVE_MONEY_NETWORK_EARN_ASSASSINATE_TARGET_KILLED);
-		MONEY.set_function("NETWORK_EARN_FROM_ROB_ARMORED_CARS", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_ROB_ARMORED_CARS);
-		MONEY.set_function("NETWORK_EARN_FROM_CRATE_DROP", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CRATE_DROP);
-		MONEY.set_function("NETWORK_EARN_FROM_BETTING", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BETTING);
-		MONEY.set_function("NETWORK_EARN_FROM_JOB", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_JOB);
-		MONEY.set_function("NETWORK_EARN_FROM_JOBX2", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_JOBX2);
-		MONEY.set_function("NETWORK_EARN_FROM_PREMIUM_JOB", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_PREMIUM_JOB);
-		MONEY.set_function("NETWORK_EARN_FROM_BEND_JOB", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BEND_JOB);
-		MONEY.set_function("NETWORK_EARN_FROM_CHALLENGE_WIN", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CHALLENGE_WIN);
-		MONEY.set_function("NETWORK_EARN_FROM_BOUNTY", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BOUNTY);
-		MONEY.set_function("NETWORK_EARN_FROM_IMPORT_EXPORT", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_IMPORT_EXPORT);
-		MONEY.set_function("NETWORK_EARN_FROM_HOLDUPS", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_HOLDUPS);
-		MONEY.set_function("NETWORK_EARN_FROM_PROPERTY", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_PROPERTY);
-		MONEY.set_function("NETWORK_EARN_FROM_AI_TARGET_KILL", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_AI_TARGET_KILL);
-		MONEY.set_function("NETWORK_EARN_FROM_NOT_BADSPORT", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_NOT_BADSPORT);
-		MONEY.set_function("NETWORK_EARN_FROM_VEHICLE", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_VEHICLE);
-		MONEY.set_function("NETWORK_EARN_FROM_PERSONAL_VEHICLE", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_PERSONAL_VEHICLE);
-		MONEY.set_function("NETWORK_EARN_FROM_DAILY_OBJECTIVES", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_DAILY_OBJECTIVES);
-		MONEY.set_function("NETWORK_EARN_FROM_AMBIENT_JOB", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_AMBIENT_JOB);
-		MONEY.set_function("NETWORK_EARN_FROM_JOB_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_JOB_BONUS);
-		MONEY.set_function("NETWORK_EARN_FROM_CRIMINAL_MASTERMIND", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CRIMINAL_MASTERMIND);
-		MONEY.set_function("NETWORK_EARN_HEIST_AWARD", LUA_NATIVE_MONEY_NETWORK_EARN_HEIST_AWARD);
-		MONEY.set_function("NETWORK_EARN_FIRST_TIME_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_FIRST_TIME_BONUS);
-		MONEY.set_function("NETWORK_EARN_GOON", LUA_NATIVE_MONEY_NETWORK_EARN_GOON);
-		MONEY.set_function("NETWORK_EARN_BOSS", LUA_NATIVE_MONEY_NETWORK_EARN_BOSS);
-		MONEY.set_function("NETWORK_EARN_AGENCY", LUA_NATIVE_MONEY_NETWORK_EARN_AGENCY);
-		MONEY.set_function("NETWORK_EARN_FROM_WAREHOUSE", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_WAREHOUSE);
-		MONEY.set_function("NETWORK_EARN_FROM_CONTRABAND", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CONTRABAND);
-		MONEY.set_function("NETWORK_EARN_FROM_DESTROYING_CONTRABAND", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_DESTROYING_CONTRABAND);
-		MONEY.set_function("NETWORK_EARN_FROM_SMUGGLER_WORK", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_SMUGGLER_WORK);
-		MONEY.set_function("NETWORK_EARN_FROM_HANGAR_TRADE", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_HANGAR_TRADE);
-		MONEY.set_function("NETWORK_EARN_PURCHASE_CLUB_HOUSE", LUA_NATIVE_MONEY_NETWORK_EARN_PURCHASE_CLUB_HOUSE);
-		MONEY.set_function("NETWORK_EARN_FROM_BUSINESS_PRODUCT", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BUSINESS_PRODUCT);
-		MONEY.set_function("NETWORK_EARN_FROM_VEHICLE_EXPORT", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_VEHICLE_EXPORT);
-		MONEY.set_function("NETWORK_EARN_SMUGGLER_AGENCY", LUA_NATIVE_MONEY_NETWORK_EARN_SMUGGLER_AGENCY);
-		MONEY.set_function("NETWORK_EARN_BOUNTY_HUNTER_REWARD", LUA_NATIVE_MONEY_NETWORK_EARN_BOUNTY_HUNTER_REWARD);
-		MONEY.set_function("NETWORK_EARN_FROM_BUSINESS_BATTLE", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BUSINESS_BATTLE);
-		MONEY.set_function("NETWORK_EARN_FROM_CLUB_MANAGEMENT_PARTICIPATION", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_CLUB_MANAGEMENT_PARTICIPATION);
-		MONEY.set_function("NETWORK_EARN_FROM_FMBB_PHONECALL_MISSION", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_FMBB_PHONECALL_MISSION);
-		MONEY.set_function("NETWORK_EARN_FROM_BUSINESS_HUB_SELL", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_BUSINESS_HUB_SELL);
-		MONEY.set_function("NETWORK_EARN_FROM_FMBB_BOSS_WORK", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_FMBB_BOSS_WORK);
-		MONEY.set_function("NETWORK_EARN_FMBB_WAGE_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_FMBB_WAGE_BONUS);
-		MONEY.set_function("NETWORK_CAN_SPEND_MONEY", LUA_NATIVE_MONEY_NETWORK_CAN_SPEND_MONEY);
-		MONEY.set_function("NETWORK_CAN_SPEND_MONEY2", LUA_NATIVE_MONEY_NETWORK_CAN_SPEND_MONEY2);
-		MONEY.set_function("NETWORK_BUY_ITEM", LUA_NATIVE_MONEY_NETWORK_BUY_ITEM);
-		MONEY.set_function("NETWORK_SPENT_TAXI", LUA_NATIVE_MONEY_NETWORK_SPENT_TAXI);
-		MONEY.set_function("NETWORK_PAY_EMPLOYEE_WAGE", LUA_NATIVE_MONEY_NETWORK_PAY_EMPLOYEE_WAGE);
-		MONEY.set_function("NETWORK_PAY_MATCH_ENTRY_FEE", LUA_NATIVE_MONEY_NETWORK_PAY_MATCH_ENTRY_FEE);
-		MONEY.set_function("NETWORK_SPENT_BETTING", LUA_NATIVE_MONEY_NETWORK_SPENT_BETTING);
-		MONEY.set_function("NETWORK_SPENT_WAGER", LUA_NATIVE_MONEY_NETWORK_SPENT_WAGER);
-		MONEY.set_function("NETWORK_SPENT_IN_STRIPCLUB", LUA_NATIVE_MONEY_NETWORK_SPENT_IN_STRIPCLUB);
-		MONEY.set_function("NETWORK_BUY_HEALTHCARE", LUA_NATIVE_MONEY_NETWORK_BUY_HEALTHCARE);
-		MONEY.set_function("NETWORK_BUY_AIRSTRIKE", LUA_NATIVE_MONEY_NETWORK_BUY_AIRSTRIKE);
-		MONEY.set_function("NETWORK_BUY_BACKUP_GANG", LUA_NATIVE_MONEY_NETWORK_BUY_BACKUP_GANG);
-		MONEY.set_function("NETWORK_BUY_HELI_STRIKE", LUA_NATIVE_MONEY_NETWORK_BUY_HELI_STRIKE);
-		MONEY.set_function("NETWORK_SPENT_AMMO_DROP", LUA_NATIVE_MONEY_NETWORK_SPENT_AMMO_DROP);
-		MONEY.set_function("NETWORK_BUY_BOUNTY", LUA_NATIVE_MONEY_NETWORK_BUY_BOUNTY);
-		MONEY.set_function("NETWORK_BUY_PROPERTY", LUA_NATIVE_MONEY_NETWORK_BUY_PROPERTY);
-		MONEY.set_function("NETWORK_BUY_SMOKES", LUA_NATIVE_MONEY_NETWORK_BUY_SMOKES);
-		MONEY.set_function("NETWORK_SPENT_HELI_PICKUP", LUA_NATIVE_MONEY_NETWORK_SPENT_HELI_PICKUP);
-		MONEY.set_function("NETWORK_SPENT_BOAT_PICKUP", LUA_NATIVE_MONEY_NETWORK_SPENT_BOAT_PICKUP);
-		MONEY.set_function("NETWORK_SPENT_BULL_SHARK", LUA_NATIVE_MONEY_NETWORK_SPENT_BULL_SHARK);
-		MONEY.set_function("NETWORK_SPENT_CASH_DROP", LUA_NATIVE_MONEY_NETWORK_SPENT_CASH_DROP);
-		MONEY.set_function("NETWORK_SPENT_HIRE_MUGGER", LUA_NATIVE_MONEY_NETWORK_SPENT_HIRE_MUGGER);
-		MONEY.set_function("NETWORK_SPENT_ROBBED_BY_MUGGER", LUA_NATIVE_MONEY_NETWORK_SPENT_ROBBED_BY_MUGGER);
-		MONEY.set_function("NETWORK_SPENT_HIRE_MERCENARY", LUA_NATIVE_MONEY_NETWORK_SPENT_HIRE_MERCENARY);
-		MONEY.set_function("NETWORK_SPENT_BUY_WANTEDLEVEL", LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_WANTEDLEVEL);
-		MONEY.set_function("NETWORK_SPENT_BUY_OFFTHERADAR", LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_OFFTHERADAR);
-		MONEY.set_function("NETWORK_SPENT_BUY_REVEAL_PLAYERS", LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_REVEAL_PLAYERS);
-		MONEY.set_function("NETWORK_SPENT_CARWASH", LUA_NATIVE_MONEY_NETWORK_SPENT_CARWASH);
-		MONEY.set_function("NETWORK_SPENT_CINEMA", LUA_NATIVE_MONEY_NETWORK_SPENT_CINEMA);
-		MONEY.set_function("NETWORK_SPENT_TELESCOPE", LUA_NATIVE_MONEY_NETWORK_SPENT_TELESCOPE);
-		MONEY.set_function("NETWORK_SPENT_HOLDUPS", LUA_NATIVE_MONEY_NETWORK_SPENT_HOLDUPS);
-		MONEY.set_function("NETWORK_SPENT_BUY_PASSIVE_MODE", LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_PASSIVE_MODE);
-		MONEY.set_function("NETWORK_SPENT_BANK_INTEREST", LUA_NATIVE_MONEY_NETWORK_SPENT_BANK_INTEREST);
-		MONEY.set_function("NETWORK_SPENT_PROSTITUTES", LUA_NATIVE_MONEY_NETWORK_SPENT_PROSTITUTES);
-		MONEY.set_function("NETWORK_SPENT_ARREST_BAIL", LUA_NATIVE_MONEY_NETWORK_SPENT_ARREST_BAIL);
-		MONEY.set_function("NETWORK_SPENT_PAY_VEHICLE_INSURANCE_PREMIUM", LUA_NATIVE_MONEY_NETWORK_SPENT_PAY_VEHICLE_INSURANCE_PREMIUM);
-		MONEY.set_function("NETWORK_SPENT_CALL_PLAYER", LUA_NATIVE_MONEY_NETWORK_SPENT_CALL_PLAYER);
-		MONEY.set_function("NETWORK_SPENT_BOUNTY", LUA_NATIVE_MONEY_NETWORK_SPENT_BOUNTY);
-		MONEY.set_function("NETWORK_SPENT_FROM_ROCKSTAR", LUA_NATIVE_MONEY_NETWORK_SPENT_FROM_ROCKSTAR);
-		MONEY.set_function("NETWORK_SPEND_EARNED_FROM_BANK_AND_WALLETS", LUA_NATIVE_MONEY_NETWORK_SPEND_EARNED_FROM_BANK_AND_WALLETS);
-		MONEY.set_function("PROCESS_CASH_GIFT", LUA_NATIVE_MONEY_PROCESS_CASH_GIFT);
-		MONEY.set_function("NETWORK_SPENT_MOVE_SUBMARINE", LUA_NATIVE_MONEY_NETWORK_SPENT_MOVE_SUBMARINE);
-		MONEY.set_function("NETWORK_SPENT_PLAYER_HEALTHCARE", LUA_NATIVE_MONEY_NETWORK_SPENT_PLAYER_HEALTHCARE);
-		MONEY.set_function("NETWORK_SPENT_NO_COPS", LUA_NATIVE_MONEY_NETWORK_SPENT_NO_COPS);
-		MONEY.set_function("NETWORK_SPENT_CARGO_SOURCING", LUA_NATIVE_MONEY_NETWORK_SPENT_CARGO_SOURCING);
-		MONEY.set_function("NETWORK_SPENT_REQUEST_JOB", LUA_NATIVE_MONEY_NETWORK_SPENT_REQUEST_JOB);
-		MONEY.set_function("NETWORK_SPENT_REQUEST_HEIST", LUA_NATIVE_MONEY_NETWORK_SPENT_REQUEST_HEIST);
-		MONEY.set_function("NETWORK_BUY_FAIRGROUND_RIDE", LUA_NATIVE_MONEY_NETWORK_BUY_FAIRGROUND_RIDE);
-		MONEY.set_function("NETWORK_ECONOMY_HAS_FIXED_CRAZY_NUMBERS", LUA_NATIVE_MONEY_NETWORK_ECONOMY_HAS_FIXED_CRAZY_NUMBERS);
-		MONEY.set_function("NETWORK_SPENT_JOB_SKIP", LUA_NATIVE_MONEY_NETWORK_SPENT_JOB_SKIP);
-		MONEY.set_function("NETWORK_SPENT_BOSS_GOON", LUA_NATIVE_MONEY_NETWORK_SPENT_BOSS_GOON);
-		MONEY.set_function("NETWORK_SPEND_GOON", LUA_NATIVE_MONEY_NETWORK_SPEND_GOON);
-		MONEY.set_function("NETWORK_SPEND_BOSS", LUA_NATIVE_MONEY_NETWORK_SPEND_BOSS);
-		MONEY.set_function("NETWORK_SPENT_MOVE_YACHT", LUA_NATIVE_MONEY_NETWORK_SPENT_MOVE_YACHT);
-		MONEY.set_function("NETWORK_SPENT_RENAME_ORGANIZATION", LUA_NATIVE_MONEY_NETWORK_SPENT_RENAME_ORGANIZATION);
-		MONEY.set_function("NETWORK_BUY_CONTRABAND_MISSION", LUA_NATIVE_MONEY_NETWORK_BUY_CONTRABAND_MISSION);
-		MONEY.set_function("NETWORK_SPENT_PA_SERVICE_HELI", LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_HELI);
-		MONEY.set_function("NETWORK_SPENT_PA_SERVICE_VEHICLE", LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_VEHICLE);
-		MONEY.set_function("NETWORK_SPENT_PA_SERVICE_SNACK", LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_SNACK);
-		MONEY.set_function("NETWORK_SPENT_PA_SERVICE_DANCER", LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_DANCER);
-		MONEY.set_function("NETWORK_SPENT_PA_SERVICE_IMPOUND", LUA_NATIVE_MONEY_NETWORK_SPENT_PA_SERVICE_IMPOUND);
-		MONEY.set_function("NETWORK_SPENT_PA_HELI_PICKUP", LUA_NATIVE_MONEY_NETWORK_SPENT_PA_HELI_PICKUP);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_OFFICE_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_OFFICE_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_OFFICE_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_OFFICE_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_WAREHOUSE_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_WAREHOUSE_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_WAREHOUSE_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_WAREHOUSE_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_IMPEXP_WAREHOUSE_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_IMPEXP_WAREHOUSE_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_IMPEXP_WAREHOUSE_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_IMPEXP_WAREHOUSE_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_TRADE_IMPEXP_WAREHOUSE_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_TRADE_IMPEXP_WAREHOUSE_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_ORDER_WAREHOUSE_VEHICLE", LUA_NATIVE_MONEY_NETWORK_SPENT_ORDER_WAREHOUSE_VEHICLE);
-		MONEY.set_function("NETWORK_SPENT_ORDER_BODYGUARD_VEHICLE", LUA_NATIVE_MONEY_NETWORK_SPENT_ORDER_BODYGUARD_VEHICLE);
-		MONEY.set_function("NETWORK_SPENT_JUKEBOX", LUA_NATIVE_MONEY_NETWORK_SPENT_JUKEBOX);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_CLUB_HOUSE", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_CLUB_HOUSE);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_CLUB_HOUSE", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_CLUB_HOUSE);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_BUSINESS_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_BUSINESS_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_BUSINESS_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_BUSINESS_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_TRADE_BUSINESS_PROPERTY", LUA_NATIVE_MONEY_NETWORK_SPENT_TRADE_BUSINESS_PROPERTY);
-		MONEY.set_function("NETWORK_SPENT_MC_ABILITY", LUA_NATIVE_MONEY_NETWORK_SPENT_MC_ABILITY);
-		MONEY.set_function("NETWORK_SPENT_PAY_BUSINESS_SUPPLIES", LUA_NATIVE_MONEY_NETWORK_SPENT_PAY_BUSINESS_SUPPLIES);
-		MONEY.set_function("NETWORK_SPENT_CHANGE_APPEARANCE", LUA_NATIVE_MONEY_NETWORK_SPENT_CHANGE_APPEARANCE);
-		MONEY.set_function("NETWORK_SPENT_VEHICLE_EXPORT_MODS", LUA_NATIVE_MONEY_NETWORK_SPENT_VEHICLE_EXPORT_MODS);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_OFFICE_GARAGE", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_OFFICE_GARAGE);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_OFFICE_GARAGE", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_OFFICE_GARAGE);
-		MONEY.set_function("NETWORK_SPENT_IMPORT_EXPORT_REPAIR", LUA_NATIVE_MONEY_NETWORK_SPENT_IMPORT_EXPORT_REPAIR);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_HANGAR", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_HANGAR);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_HANGAR", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_HANGAR);
-		MONEY.set_function("NETWORK_SPENT_HANGAR_UTILITY_CHARGES", LUA_NATIVE_MONEY_NETWORK_SPENT_HANGAR_UTILITY_CHARGES);
-		MONEY.set_function("NETWORK_SPENT_HANGAR_STAFF_CHARGES", LUA_NATIVE_MONEY_NETWORK_SPENT_HANGAR_STAFF_CHARGES);
-		MONEY.set_function("NETWORK_SPENT_BUY_TRUCK", LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_TRUCK);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_TRUCK", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_TRUCK);
-		MONEY.set_function("NETWORK_SPENT_BUY_BUNKER", LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_BUNKER);
-		MONEY.set_function("NETWORK_SPENT_UPRADE_BUNKER", LUA_NATIVE_MONEY_NETWORK_SPENT_UPRADE_BUNKER);
-		MONEY.set_function("NETWORK_EARN_FROM_SELL_BUNKER", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_SELL_BUNKER);
-		MONEY.set_function("NETWORK_SPENT_BALLISTIC_EQUIPMENT", LUA_NATIVE_MONEY_NETWORK_SPENT_BALLISTIC_EQUIPMENT);
-		MONEY.set_function("NETWORK_EARN_RDR_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_RDR_BONUS);
-		MONEY.set_function("NETWORK_EARN_WAGE_PAYMENT", LUA_NATIVE_MONEY_NETWORK_EARN_WAGE_PAYMENT);
-		MONEY.set_function("NETWORK_EARN_WAGE_PAYMENT_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_WAGE_PAYMENT_BONUS);
-		MONEY.set_function("NETWORK_SPENT_BUY_BASE", LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_BASE);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_BASE", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_BASE);
-		MONEY.set_function("NETWORK_SPENT_BUY_TILTROTOR", LUA_NATIVE_MONEY_NETWORK_SPENT_BUY_TILTROTOR);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_TILTROTOR", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_TILTROTOR);
-		MONEY.set_function("NETWORK_SPENT_EMPLOY_ASSASSINS", LUA_NATIVE_MONEY_NETWORK_SPENT_EMPLOY_ASSASSINS);
-		MONEY.set_function("NETWORK_SPEND_GANGOPS_CANNON", LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_CANNON);
-		MONEY.set_function("NETWORK_SPEND_GANGOPS_SKIP_MISSION", LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_SKIP_MISSION);
-		MONEY.set_function("NETWORK_SPEND_CASINO_HEIST_SKIP_MISSION", LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_HEIST_SKIP_MISSION);
-		MONEY.set_function("NETWORK_EARN_SELL_BASE", LUA_NATIVE_MONEY_NETWORK_EARN_SELL_BASE);
-		MONEY.set_function("NETWORK_EARN_TARGET_REFUND", LUA_NATIVE_MONEY_NETWORK_EARN_TARGET_REFUND);
-		MONEY.set_function("NETWORK_EARN_GANGOPS_WAGES", LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_WAGES);
-		MONEY.set_function("NETWORK_EARN_GANGOPS_WAGES_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_WAGES_BONUS);
-		MONEY.set_function("NETWORK_EARN_DAR_CHALLENGE", LUA_NATIVE_MONEY_NETWORK_EARN_DAR_CHALLENGE);
-		MONEY.set_function("NETWORK_EARN_DOOMSDAY_FINALE_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_DOOMSDAY_FINALE_BONUS);
-		MONEY.set_function("NETWORK_EARN_GANGOPS_AWARD", LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_AWARD);
-		MONEY.set_function("NETWORK_EARN_GANGOPS_ELITE", LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_ELITE);
-		MONEY.set_function("NETWORK_SERVICE_EARN_GANGOPS_RIVAL_DELIVERY", LUA_NATIVE_MONEY_NETWORK_SERVICE_EARN_GANGOPS_RIVAL_DELIVERY);
-		MONEY.set_function("NETWORK_SPEND_GANGOPS_START_STRAND", LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_START_STRAND);
-		MONEY.set_function("NETWORK_SPEND_GANGOPS_TRIP_SKIP", LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_TRIP_SKIP);
-		MONEY.set_function("NETWORK_EARN_GANGOPS_PREP_PARTICIPATION", LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_PREP_PARTICIPATION);
-		MONEY.set_function("NETWORK_EARN_GANGOPS_SETUP", LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_SETUP);
-		MONEY.set_function("NETWORK_EARN_GANGOPS_FINALE", LUA_NATIVE_MONEY_NETWORK_EARN_GANGOPS_FINALE);
-		MONEY.set_function("NETWORK_SPEND_GANGOPS_REPAIR_COST", LUA_NATIVE_MONEY_NETWORK_SPEND_GANGOPS_REPAIR_COST);
-		MONEY.set_function("NETWORK_EARN_NIGHTCLUB", LUA_NATIVE_MONEY_NETWORK_EARN_NIGHTCLUB);
-		MONEY.set_function("NETWORK_EARN_NIGHTCLUB_DANCING", LUA_NATIVE_MONEY_NETWORK_EARN_NIGHTCLUB_DANCING);
-		MONEY.set_function("NETWORK_EARN_BB_EVENT_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_BB_EVENT_BONUS);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_HACKER_TRUCK", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_HACKER_TRUCK);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_HACKER_TRUCK", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_HACKER_TRUCK);
-		MONEY.set_function("NETWORK_EARN_HACKER_TRUCK", LUA_NATIVE_MONEY_NETWORK_EARN_HACKER_TRUCK);
-		MONEY.set_function("NETWORK_SPENT_PURCHASE_NIGHTCLUB_AND_WAREHOUSE", LUA_NATIVE_MONEY_NETWORK_SPENT_PURCHASE_NIGHTCLUB_AND_WAREHOUSE);
-		MONEY.set_function("NETWORK_SPENT_UPGRADE_NIGHTCLUB_AND_WAREHOUSE", LUA_NATIVE_MONEY_NETWORK_SPENT_UPGRADE_NIGHTCLUB_AND_WAREHOUSE);
-		MONEY.set_function("NETWORK_EARN_NIGHTCLUB_AND_WAREHOUSE", LUA_NATIVE_MONEY_NETWORK_EARN_NIGHTCLUB_AND_WAREHOUSE);
-		MONEY.set_function("NETWORK_SPEND_NIGHTCLUB_AND_WAREHOUSE", LUA_NATIVE_MONEY_NETWORK_SPEND_NIGHTCLUB_AND_WAREHOUSE);
-		MONEY.set_function("NETWORK_SPENT_RDR_HATCHET_BONUS", LUA_NATIVE_MONEY_NETWORK_SPENT_RDR_HATCHET_BONUS);
-		MONEY.set_function("NETWORK_SPENT_NIGHTCLUB_ENTRY_FEE", LUA_NATIVE_MONEY_NETWORK_SPENT_NIGHTCLUB_ENTRY_FEE);
-		MONEY.set_function("NETWORK_SPEND_NIGHTCLUB_BAR_DRINK", LUA_NATIVE_MONEY_NETWORK_SPEND_NIGHTCLUB_BAR_DRINK);
-		MONEY.set_function("NETWORK_SPEND_BOUNTY_HUNTER_MISSION", LUA_NATIVE_MONEY_NETWORK_SPEND_BOUNTY_HUNTER_MISSION);
-		MONEY.set_function("NETWORK_SPENT_REHIRE_DJ", LUA_NATIVE_MONEY_NETWORK_SPENT_REHIRE_DJ);
-		MONEY.set_function("NETWORK_SPENT_ARENA_JOIN_SPECTATOR", LUA_NATIVE_MONEY_NETWORK_SPENT_ARENA_JOIN_SPECTATOR);
-		MONEY.set_function("NETWORK_EARN_ARENA_SKILL_LEVEL_PROGRESSION", LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_SKILL_LEVEL_PROGRESSION);
-		MONEY.set_function("NETWORK_EARN_ARENA_CAREER_PROGRESSION", LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_CAREER_PROGRESSION);
-		MONEY.set_function("NETWORK_SPEND_MAKE_IT_RAIN", LUA_NATIVE_MONEY_NETWORK_SPEND_MAKE_IT_RAIN);
-		MONEY.set_function("NETWORK_SPEND_BUY_ARENA", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_ARENA);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_ARENA", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ARENA);
-		MONEY.set_function("NETWORK_SPEND_ARENA_SPECTATOR_BOX", LUA_NATIVE_MONEY_NETWORK_SPEND_ARENA_SPECTATOR_BOX);
-		MONEY.set_function("NETWORK_SPEND_SPIN_THE_WHEEL_PAYMENT", LUA_NATIVE_MONEY_NETWORK_SPEND_SPIN_THE_WHEEL_PAYMENT);
-		MONEY.set_function("NETWORK_EARN_SPIN_THE_WHEEL_CASH", LUA_NATIVE_MONEY_NETWORK_EARN_SPIN_THE_WHEEL_CASH);
-		MONEY.set_function("NETWORK_SPEND_ARENA_PREMIUM", LUA_NATIVE_MONEY_NETWORK_SPEND_ARENA_PREMIUM);
-		MONEY.set_function("NETWORK_EARN_ARENA_WAR", LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_WAR);
-		MONEY.set_function("NETWORK_EARN_ARENA_WAR_ASSASSINATE_TARGET", LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_WAR_ASSASSINATE_TARGET);
-		MONEY.set_function("NETWORK_EARN_ARENA_WAR_EVENT_CARGO", LUA_NATIVE_MONEY_NETWORK_EARN_ARENA_WAR_EVENT_CARGO);
-		MONEY.set_function("NETWORK_EARN_RC_TIME_TRIAL", LUA_NATIVE_MONEY_NETWORK_EARN_RC_TIME_TRIAL);
-		MONEY.set_function("NETWORK_EARN_DAILY_OBJECTIVE_EVENT", LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_OBJECTIVE_EVENT);
-		MONEY.set_function("NETWORK_SPEND_CASINO_MEMBERSHIP", LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_MEMBERSHIP);
-		MONEY.set_function("NETWORK_SPEND_BUY_CASINO", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_CASINO);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_CASINO", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_CASINO);
-		MONEY.set_function("NETWORK_SPEND_CASINO_GENERIC", LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_GENERIC);
-		MONEY.set_function("NETWORK_EARN_CASINO_TIME_TRIAL_WIN", LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_TIME_TRIAL_WIN);
-		MONEY.set_function("NETWORK_EARN_COLLECTABLES_ACTION_FIGURES", LUA_NATIVE_MONEY_NETWORK_EARN_COLLECTABLES_ACTION_FIGURES);
-		MONEY.set_function("NETWORK_EARN_CASINO_COLLECTABLE_COMPLETED_COLLECTION", LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_COLLECTABLE_COMPLETED_COLLECTION);
-		MONEY.set_function("NETWORK_EARN_SELL_PRIZE_VEHICLE", LUA_NATIVE_MONEY_NETWORK_EARN_SELL_PRIZE_VEHICLE);
-		MONEY.set_function("NETWORK_EARN_CASINO_MISSION_REWARD", LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_MISSION_REWARD);
-		MONEY.set_function("NETWORK_EARN_CASINO_STORY_MISSION_REWARD", LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_STORY_MISSION_REWARD);
-		MONEY.set_function("NETWORK_EARN_CASINO_MISSION_PARTICIPATION", LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_MISSION_PARTICIPATION);
-		MONEY.set_function("NETWORK_EARN_CASINO_AWARD", LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_AWARD);
-		MONEY.set_function("NETWORK_SPEND_BUY_ARCADE", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_ARCADE);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_ARCADE", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ARCADE);
-		MONEY.set_function("NETWORK_SPEND_CASINO_HEIST", LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_HEIST);
-		MONEY.set_function("NETWORK_SPEND_ARCADE_MGMT", LUA_NATIVE_MONEY_NETWORK_SPEND_ARCADE_MGMT);
-		MONEY.set_function("NETWORK_SPEND_PLAY_ARCADE", LUA_NATIVE_MONEY_NETWORK_SPEND_PLAY_ARCADE);
-		MONEY.set_function("NETWORK_SPEND_ARCADE", LUA_NATIVE_MONEY_NETWORK_SPEND_ARCADE);
-		MONEY.set_function("NETWORK_EARN_CASINO_HEIST", LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_HEIST);
-		MONEY.set_function("NETWORK_EARN_UPGRADE_ARCADE", LUA_NATIVE_MONEY_NETWORK_EARN_UPGRADE_ARCADE);
-		MONEY.set_function("NETWORK_EARN_ARCADE", LUA_NATIVE_MONEY_NETWORK_EARN_ARCADE);
-		MONEY.set_function("NETWORK_EARN_COLLECTABLES", LUA_NATIVE_MONEY_NETWORK_EARN_COLLECTABLES);
-		MONEY.set_function("NETWORK_EARN_CHALLENGE", LUA_NATIVE_MONEY_NETWORK_EARN_CHALLENGE);
-		MONEY.set_function("NETWORK_EARN_CASINO_HEIST_AWARDS", LUA_NATIVE_MONEY_NETWORK_EARN_CASINO_HEIST_AWARDS);
-		MONEY.set_function("NETWORK_EARN_COLLECTABLE_ITEM", LUA_NATIVE_MONEY_NETWORK_EARN_COLLECTABLE_ITEM);
-		MONEY.set_function("NETWORK_EARN_COLLECTABLE_COMPLETED_COLLECTION", LUA_NATIVE_MONEY_NETWORK_EARN_COLLECTABLE_COMPLETED_COLLECTION);
-		MONEY.set_function("NETWORK_EARN_YATCH_MISSION", LUA_NATIVE_MONEY_NETWORK_EARN_YATCH_MISSION);
-		MONEY.set_function("NETWORK_EARN_DISPATCH_CALL", LUA_NATIVE_MONEY_NETWORK_EARN_DISPATCH_CALL);
-		MONEY.set_function("NETWORK_SPEND_BEACH_PARTY", LUA_NATIVE_MONEY_NETWORK_SPEND_BEACH_PARTY);
-		MONEY.set_function("NETWORK_SPEND_SUBMARINE", LUA_NATIVE_MONEY_NETWORK_SPEND_SUBMARINE);
-		MONEY.set_function("NETWORK_SPEND_CASINO_CLUB", LUA_NATIVE_MONEY_NETWORK_SPEND_CASINO_CLUB);
-		MONEY.set_function("NETWORK_SPEND_BUY_SUB", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_SUB);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_SUB", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_SUB);
-		MONEY.set_function("NETWORK_SPEND_ISLAND_HEIST", LUA_NATIVE_MONEY_NETWORK_SPEND_ISLAND_HEIST);
-		MONEY.set_function("NETWORK_EARN_ISLAND_HEIST", LUA_NATIVE_MONEY_NETWORK_EARN_ISLAND_HEIST);
-		MONEY.set_function("NETWORK_EARN_BEACH_PARTY_LOST_FOUND", LUA_NATIVE_MONEY_NETWORK_EARN_BEACH_PARTY_LOST_FOUND);
-		MONEY.set_function("NETWORK_EARN_FROM_ISLAND_HEIST_DJ_MISSION", LUA_NATIVE_MONEY_NETWORK_EARN_FROM_ISLAND_HEIST_DJ_MISSION);
-		MONEY.set_function("NETWORK_SPEND_CAR_CLUB_MEMBERSHIP", LUA_NATIVE_MONEY_NETWORK_SPEND_CAR_CLUB_MEMBERSHIP);
-		MONEY.set_function("NETWORK_SPEND_CAR_CLUB_BAR", LUA_NATIVE_MONEY_NETWORK_SPEND_CAR_CLUB_BAR);
-		MONEY.set_function("NETWORK_SPEND_AUTOSHOP_MODIFY", LUA_NATIVE_MONEY_NETWORK_SPEND_AUTOSHOP_MODIFY);
-		MONEY.set_function("NETWORK_SPEND_CAR_CLUB_TAKEOVER", LUA_NATIVE_MONEY_NETWORK_SPEND_CAR_CLUB_TAKEOVER);
-		MONEY.set_function("NETWORK_SPEND_BUY_AUTOSHOP", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_AUTOSHOP);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_AUTOSHOP", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_AUTOSHOP);
-		MONEY.set_function("NETWORK_EARN_AUTOSHOP_BUSINESS", LUA_NATIVE_MONEY_NETWORK_EARN_AUTOSHOP_BUSINESS);
-		MONEY.set_function("NETWORK_EARN_AUTOSHOP_INCOME", LUA_NATIVE_MONEY_NETWORK_EARN_AUTOSHOP_INCOME);
-		MONEY.set_function("NETWORK_EARN_CARCLUB_MEMBERSHIP", LUA_NATIVE_MONEY_NETWORK_EARN_CARCLUB_MEMBERSHIP);
-		MONEY.set_function("NETWORK_EARN_DAILY_VEHICLE", LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_VEHICLE);
-		MONEY.set_function("NETWORK_EARN_DAILY_VEHICLE_BONUS", LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_VEHICLE_BONUS);
-		MONEY.set_function("NETWORK_EARN_TUNER_AWARD", LUA_NATIVE_MONEY_NETWORK_EARN_TUNER_AWARD);
-		MONEY.set_function("NETWORK_EARN_TUNER_ROBBERY", LUA_NATIVE_MONEY_NETWORK_EARN_TUNER_ROBBERY);
-		MONEY.set_function("NETWORK_EARN_UPGRADE_AUTOSHOP", LUA_NATIVE_MONEY_NETWORK_EARN_UPGRADE_AUTOSHOP);
-		MONEY.set_function("NETWORK_SPEND_INTERACTION_MENU_ABILITY", LUA_NATIVE_MONEY_NETWORK_SPEND_INTERACTION_MENU_ABILITY);
-		MONEY.set_function("NETWORK_SPEND_SET_COMMON_FIELDS", LUA_NATIVE_MONEY_NETWORK_SPEND_SET_COMMON_FIELDS);
-		MONEY.set_function("NETWORK_SPEND_SET_DISCOUNT", LUA_NATIVE_MONEY_NETWORK_SPEND_SET_DISCOUNT);
-		MONEY.set_function("NETWORK_SPEND_BUY_AGENCY", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_AGENCY);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_AGENCY", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_AGENCY);
-		MONEY.set_function("NETWORK_SPEND_AGENCY", LUA_NATIVE_MONEY_NETWORK_SPEND_AGENCY);
-		MONEY.set_function("NETWORK_SPEND_HIDDEN", LUA_NATIVE_MONEY_NETWORK_SPEND_HIDDEN);
-		MONEY.set_function("NETWORK_SPEND_SOURCE_BIKE", LUA_NATIVE_MONEY_NETWORK_SPEND_SOURCE_BIKE);
-		MONEY.set_function("NETWORK_SPEND_COMP_SUV", LUA_NATIVE_MONEY_NETWORK_SPEND_COMP_SUV);
-		MONEY.set_function("NETWORK_SPEND_SUV_FST_TRVL", LUA_NATIVE_MONEY_NETWORK_SPEND_SUV_FST_TRVL);
-		MONEY.set_function("NETWORK_SPEND_SUPPLY", LUA_NATIVE_MONEY_NETWORK_SPEND_SUPPLY);
-		MONEY.set_function("NETWORK_SPEND_BIKE_SHOP", LUA_NATIVE_MONEY_NETWORK_SPEND_BIKE_SHOP);
-		MONEY.set_function("NETWORK_SPEND_VEHICLE_REQUESTED", LUA_NATIVE_MONEY_NETWORK_SPEND_VEHICLE_REQUESTED);
-		MONEY.set_function("NETWORK_SPEND_GUNRUNNING", LUA_NATIVE_MONEY_NETWORK_SPEND_GUNRUNNING);
-		MONEY.set_function("NETWORK_EARN_AGENCY_SAFE", LUA_NATIVE_MONEY_NETWORK_EARN_AGENCY_SAFE);
-		MONEY.set_function("NETWORK_EARN_AWARD_CONTRACT", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_CONTRACT);
-		MONEY.set_function("NETWORK_EARN_AGENCY_CONTRACT", LUA_NATIVE_MONEY_NETWORK_EARN_AGENCY_CONTRACT);
-		MONEY.set_function("NETWORK_EARN_AWARD_PHONE", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_PHONE);
-		MONEY.set_function("NETWORK_EARN_AGENCY_PHONE", LUA_NATIVE_MONEY_NETWORK_EARN_AGENCY_PHONE);
-		MONEY.set_function("NETWORK_EARN_AWARD_FIXER_MISSION", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_FIXER_MISSION);
-		MONEY.set_function("NETWORK_EARN_FIXER_PREP", LUA_NATIVE_MONEY_NETWORK_EARN_FIXER_PREP);
-		MONEY.set_function("NETWORK_EARN_FIXER_FINALE", LUA_NATIVE_MONEY_NETWORK_EARN_FIXER_FINALE);
-		MONEY.set_function("NETWORK_EARN_FIXER_AGENCY_SHORT_TRIP", LUA_NATIVE_MONEY_NETWORK_EARN_FIXER_AGENCY_SHORT_TRIP);
-		MONEY.set_function("NETWORK_EARN_AWARD_SHORT_TRIP", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_SHORT_TRIP);
-		MONEY.set_function("NETWORK_EARN_FIXER_RIVAL_DELIVERY", LUA_NATIVE_MONEY_NETWORK_EARN_FIXER_RIVAL_DELIVERY);
-		MONEY.set_function("NETWORK_EARN_UPGRADE_AGENCY", LUA_NATIVE_MONEY_NETWORK_EARN_UPGRADE_AGENCY);
-		MONEY.set_function("NETWORK_SPEND_APARTMENT_UTILITIES", LUA_NATIVE_MONEY_NETWORK_SPEND_APARTMENT_UTILITIES);
-		MONEY.set_function("NETWORK_SPEND_BUSINESS_PROPERTY_FEES", LUA_NATIVE_MONEY_NETWORK_SPEND_BUSINESS_PROPERTY_FEES);
-		MONEY.set_function("NETWORK_EARN_SIGHTSEEING_REWARD", LUA_NATIVE_MONEY_NETWORK_EARN_SIGHTSEEING_REWARD);
-		MONEY.set_function("NETWORK_EARN_BIKER_SHOP", LUA_NATIVE_MONEY_NETWORK_EARN_BIKER_SHOP);
-		MONEY.set_function("NETWORK_EARN_BIKER", LUA_NATIVE_MONEY_NETWORK_EARN_BIKER);
-		MONEY.set_function("NETWORK_YOHAN_SOURCE_GOODS", LUA_NATIVE_MONEY_NETWORK_YOHAN_SOURCE_GOODS);
-		MONEY.set_function("NETWORK_SPEND_BUY_MFGARAGE_", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_MFGARAGE_);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_MFGARAGE_", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_MFGARAGE_);
-		MONEY.set_function("NETWORK_SPEND_BUY_SUPPLIES_", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_SUPPLIES_);
-		MONEY.set_function("NETWORK_SPEND_BUY_ACID_LAB_", LUA_NATIVE_MONEY_NETWORK_SPEND_BUY_ACID_LAB_);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_ACID_LAB_EQUIPMENT_", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ACID_LAB_EQUIPMENT_);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_ACID_LAB_ARMOR_", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ACID_LAB_ARMOR_);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_ACID_LAB_SCOOP_", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ACID_LAB_SCOOP_);
-		MONEY.set_function("NETWORK_SPEND_UPGRADE_ACID_LAB_MINES_", LUA_NATIVE_MONEY_NETWORK_SPEND_UPGRADE_ACID_LAB_MINES_);
-		MONEY.set_function("NETWORK_SPEND_RENAME_ACID_LAB_", LUA_NATIVE_MONEY_NETWORK_SPEND_RENAME_ACID_LAB_);
-		MONEY.set_function("NETWORK_SPEND_RENAME_ACID_PRODUCT_", LUA_NATIVE_MONEY_NETWORK_SPEND_RENAME_ACID_PRODUCT_);
-		MONEY.set_function("NETWORK_EARN_AWARD_JUGGALO_MISSION_", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_JUGGALO_MISSION_);
-		MONEY.set_function("NETWORK_EARN_AWARD_ACID_LAB_", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_ACID_LAB_);
-		MONEY.set_function("NETWORK_EARN_AWARD_DAILY_STASH_", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_DAILY_STASH_);
-		MONEY.set_function("NETWORK_EARN_AWARD_DEAD_DROP_", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_DEAD_DROP_);
-		MONEY.set_function("NETWORK_EARN_AWARD_RANDOM_EVENT_", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_RANDOM_EVENT_);
-		MONEY.set_function("NETWORK_EARN_AWARD_TAXI_", LUA_NATIVE_MONEY_NETWORK_EARN_AWARD_TAXI_);
-		MONEY.set_function("NETWORK_EARN_STREET_DEALER_", LUA_NATIVE_MONEY_NETWORK_EARN_STREET_DEALER_);
-		MONEY.set_function("NETWORK_EARN_SELL_ACID_", LUA_NATIVE_MONEY_NETWORK_EARN_SELL_ACID_);
-		MONEY.set_function("NETWORK_EARN_SETUP_PARTICIPATION_ACID_LAB_", LUA_NATIVE_MONEY_NETWORK_EARN_SETUP_PARTICIPATION_ACID_LAB_);
-		MONEY.set_function("NETWORK_EARN_SOURCE_PARTICIPATION_ACID_LAB_", LUA_NATIVE_MONEY_NETWORK_EARN_SOURCE_PARTICIPATION_ACID_LAB_);
-		MONEY.set_function("NETWORK_EARN_SELL_PARTICIPATION_ACID_LAB_", LUA_NATIVE_MONEY_NETWORK_EARN_SELL_PARTICIPATION_ACID_LAB_);
-		MONEY.set_function("NETWORK_EARN_JUGGALO_STORY_MISSION_", LUA_NATIVE_MONEY_NETWORK_EARN_JUGGALO_STORY_MISSION_);
-		MONEY.set_function("NETWORK_EARN_JUGGALO_STORY_MISSION_PARTICIPATION_", LUA_NATIVE_MONEY_NETWORK_EARN_JUGGALO_STORY_MISSION_PARTICIPATION_);
-		MONEY.set_function("NETWORK_EARN_FOOLIGAN_JOB_", LUA_NATIVE_MONEY_NETWORK_EARN_FOOLIGAN_JOB_);
-		MONEY.set_function("NETWORK_EARN_FOOLIGAN_JOB_PARTICIPATION_", LUA_NATIVE_MONEY_NETWORK_EARN_FOOLIGAN_JOB_PARTICIPATION_);
-		MONEY.set_function("NETWORK_EARN_TAXI_JOB_", LUA_NATIVE_MONEY_NETWORK_EARN_TAXI_JOB_);
-		MONEY.set_function("NETWORK_EARN_DAILY_STASH_HOUSE_COMPLETED_", LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_STASH_HOUSE_COMPLETED_);
-		MONEY.set_function("NETWORK_EARN_DAILY_STASH_HOUSE_PARTICIPATION_", LUA_NATIVE_MONEY_NETWORK_EARN_DAILY_STASH_HOUSE_PARTICIPATION_);
-		MONEY.set_function("NETWORK_EARN_AVENGER_", LUA_NATIVE_MONEY_NETWORK_EARN_AVENGER_);
-		MONEY.set_function("NETWORK_EARN_SMUGGLER_OPS_", LUA_NATIVE_MONEY_NETWORK_EARN_SMUGGLER_OPS_);
-		MONEY.set_function("NETWORK_EARN_BONUS_OBJECTIVE_", LUA_NATIVE_MONEY_NETWORK_EARN_BONUS_OBJECTIVE_);
-		MONEY.set_function("NETWORK_EARN_PROGRESS_HUB_", LUA_NATIVE_MONEY_NETWORK_EARN_PROGRESS_HUB_);
-		MONEY.set_function("NETWORK_SPENT_AIR_FREIGHT_", LUA_NATIVE_MONEY_NETWORK_SPENT_AIR_FREIGHT_);
-		MONEY.set_function("NETWORK_SPENT_SKIP_CARGO_SOURCE_SETUP_", LUA_NATIVE_MONEY_NETWORK_SPENT_SKIP_CARGO_SOURCE_SETUP_);
-		MONEY.set_function("NETWORK_SPENT_STEALTH_MODULE_", LUA_NATIVE_MONEY_NETWORK_SPENT_STEALTH_MODULE_);
-		MONEY.set_function("NETWORK_SPENT_MISSILE_JAMMER_", LUA_NATIVE_MONEY_NETWORK_SPENT_MISSILE_JAMMER_);
-		MONEY.set_function("NETWORK_SPENT_GENERIC_", LUA_NATIVE_MONEY_NETWORK_SPENT_GENERIC_);
-		MONEY.set_function("NETWORK_EARN_GENERIC_", LUA_NATIVE_MONEY_NETWORK_EARN_GENERIC_);
-		MONEY.set_function("NETWORK_CLEAR_TRANSACTION_TELEMETRY_NONCE_", LUA_NATIVE_MONEY_NETWORK_CLEAR_TRANSACTION_TELEMETRY_NONCE_);
-		MONEY.set_function("NETWORK_GET_VC_BANK_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_VC_BANK_BALANCE);
-		MONEY.set_function("NETWORK_GET_VC_WALLET_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_VC_WALLET_BALANCE);
-		MONEY.set_function("NETWORK_GET_VC_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_VC_BALANCE);
-		MONEY.set_function("NETWORK_GET_EVC_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_EVC_BALANCE);
-		MONEY.set_function("NETWORK_GET_PVC_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_PVC_BALANCE);
-		MONEY.set_function("NETWORK_GET_STRING_WALLET_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_STRING_WALLET_BALANCE);
-		MONEY.set_function("NETWORK_GET_STRING_BANK_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_STRING_BANK_BALANCE);
-		MONEY.set_function("NETWORK_GET_STRING_BANK_WALLET_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_STRING_BANK_WALLET_BALANCE);
-		MONEY.set_function("NETWORK_GET_CAN_SPEND_FROM_WALLET", LUA_NATIVE_MONEY_NETWORK_GET_CAN_SPEND_FROM_WALLET);
-		MONEY.set_function("NETWORK_GET_CAN_SPEND_FROM_BANK", LUA_NATIVE_MONEY_NETWORK_GET_CAN_SPEND_FROM_BANK);
-		MONEY.set_function("NETWORK_GET_CAN_SPEND_FROM_BANK_AND_WALLET", LUA_NATIVE_MONEY_NETWORK_GET_CAN_SPEND_FROM_BANK_AND_WALLET);
-		MONEY.set_function("NETWORK_GET_PVC_TRANSFER_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_PVC_TRANSFER_BALANCE);
-		MONEY.set_function("NETWORK_GET_CAN_TRANSFER_CASH", LUA_NATIVE_MONEY_NETWORK_GET_CAN_TRANSFER_CASH);
-		MONEY.set_function("NETWORK_CAN_RECEIVE_PLAYER_CASH", LUA_NATIVE_MONEY_NETWORK_CAN_RECEIVE_PLAYER_CASH);
-		MONEY.set_function("NETWORK_GET_REMAINING_TRANSFER_BALANCE", LUA_NATIVE_MONEY_NETWORK_GET_REMAINING_TRANSFER_BALANCE);
-		MONEY.set_function("WITHDRAW_VC", LUA_NATIVE_MONEY_WITHDRAW_VC);
-		MONEY.set_function("DEPOSIT_VC", LUA_NATIVE_MONEY_DEPOSIT_VC);
-		MONEY.set_function("HAS_VC_WITHDRAWAL_COMPLETED", LUA_NATIVE_MONEY_HAS_VC_WITHDRAWAL_COMPLETED);
-		MONEY.set_function("WAS_VC_WITHDRAWAL_SUCCESSFUL", LUA_NATIVE_MONEY_WAS_VC_WITHDRAWAL_SUCCESSFUL);
+		bind_namespace(L, "MONEY", MONEY_natives);
 	}
 }
@@ -265,48 +265,51 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry NETSHOPPING_natives[] = {
+		{"NET_GAMESERVER_BASKET_ADD_ITEM", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_ADD_ITEM>},
+		{"NET_GAMESERVER_BASKET_APPLY_SERVER_DATA", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_APPLY_SERVER_DATA>},
+		{"NET_GAMESERVER_BASKET_END", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_END>},
+		{"NET_GAMESERVER_BASKET_IS_ACTIVE", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_IS_ACTIVE>},
+		{"NET_GAMESERVER_BASKET_IS_FULL", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_IS_FULL>},
+		{"NET_GAMESERVER_BASKET_START", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_START>},
+		{"NET_GAMESERVER_BEGIN_SERVICE", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BEGIN_SERVICE>},
+		{"NET_GAMESERVER_CATALOG_IS_VALID", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CATALOG_IS_VALID>},
+		{"NET_GAMESERVER_CATALOG_ITEM_IS_VALID", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CATALOG_ITEM_IS_VALID>},
+		{"NET_GAMESERVER_CATALOG_ITEM_KEY_IS_VALID", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CATALOG_ITEM_KEY_IS_VALID>},
+		{"NET_GAMESERVER_CHECKOUT_START", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CHECKOUT_START>},
+		{"NET_GAMESERVER_CLEAR_SESSION", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CLEAR_SESSION>},
+		{"NET_GAMESERVER_DELETE_CHARACTER", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_DELETE_CHARACTER>},
+		{"NET_GAMESERVER_DELETE_CHARACTER_GET_STATUS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_DELETE_CHARACTER_GET_STATUS>},
+		{"NET_GAMESERVER_DELETE_SET_TELEMETRY_NONCE_SEED", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_DELETE_SET_TELEMETRY_NONCE_SEED>},
+		{"NET_GAMESERVER_END_SERVICE", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_END_SERVICE>},
+		{"NET_GAMESERVER_GET_CATALOG_CLOUD_CRC", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_GET_CATALOG_CLOUD_CRC>},
+		{"NET_GAMESERVER_GET_PRICE", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_GET_PRICE>},
+		{"NET_GAMESERVER_GET_SESSION_STATE_AND_STATUS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_GET_SESSION_STATE_AND_STATUS>},
+		{"NET_GAMESERVER_INIT_SESSION", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_INIT_SESSION>},
+		{"NET_GAMESERVER_IS_CATALOG_CURRENT", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_IS_CATALOG_CURRENT>},
+		{"NET_GAMESERVER_IS_SESSION_REFRESH_PENDING", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_IS_SESSION_REFRESH_PENDING>},
+		{"NET_GAMESERVER_IS_SESSION_VALID", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_IS_SESSION_VALID>},
+		{"NET_GAMESERVER_REFRESH_SERVER_CATALOG", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_REFRESH_SERVER_CATALOG>},
+		{"NET_GAMESERVER_RETRIEVE_CATALOG_REFRESH_STATUS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_RETRIEVE_CATALOG_REFRESH_STATUS>},
+		{"NET_GAMESERVER_RETRIEVE_INIT_SESSION_STATUS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_RETRIEVE_INIT_SESSION_STATUS>},
+		{"NET_GAMESERVER_RETRIEVE_SESSION_ERROR_CODE", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_RETRIEVE_SESSION_ERROR_CODE>},
+		{"NET_GAMESERVER_RETRIEVE_START_SESSION_STATUS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_RETRIEVE_START_SESSION_STATUS>},
+		{"NET_GAMESERVER_SESSION_APPLY_RECEIVED_DATA", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_SESSION_APPLY_RECEIVED_DATA>},
+		{"NET_GAMESERVER_SET_TELEMETRY_NONCE_SEED", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_SET_TELEMETRY_NONCE_SEED>},
+		{"NET_GAMESERVER_START_SESSION", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_START_SESSION>},
+		{"NET_GAMESERVER_START_SESSION_PENDING", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_START_SESSION_PENDING>},
+		{"NET_GAMESERVER_START_SESSION_RESTART", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_START_SESSION_RESTART>},
+		{"NET_GAMESERVER_TRANSACTION_IN_PROGRESS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSACTION_IN_PROGRESS>},
+		{"NET_GAMESERVER_TRANSFER_BANK_TO_WALLET", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_BANK_TO_WALLET>},
+		{"NET_GAMESERVER_TRANSFER_BANK_TO_WALLET_GET_STATUS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_BANK_TO_WALLET_GET_STATUS>},
+		{"NET_GAMESERVER_TRANSFER_CASH_SET_TELEMETRY_NONCE_SEED", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_CASH_SET_TELEMETRY_NONCE_SEED>},
+		{"NET_GAMESERVER_TRANSFER_WALLET_TO_BANK", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_WALLET_TO_BANK>},
+		{"NET_GAMESERVER_TRANSFER_WALLET_TO_BANK_GET_STATUS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_WALLET_TO_BANK_GET_STATUS>},
+		{"NET_GAMESERVER_USE_SERVER_TRANSACTIONS", native_function<LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_USE_SERVER_TRANSACTIONS>},
+	};
+
 	void init_native_binding_NETSHOPPING(sol::state& L)
 	{
-		auto NETSHOPPING = L["NETSHOPPING"].get_or_create<sol::table>();
-		NETSHOPPING.set_function("NET_GAMESERVER_USE_SERVER_TRANSACTIONS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_USE_SERVER_TRANSACTIONS);
-		NETSHOPPING.set_function("NET_GAMESERVER_CATALOG_ITEM_IS_VALID", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CATALOG_ITEM_IS_VALID);
-		NETSHOPPING.set_function("NET_GAMESERVER_CATALOG_ITEM_KEY_IS_VALID", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CATALOG_ITEM_KEY_IS_VALID);
-		NETSHOPPING.set_function("NET_GAMESERVER_GET_PRICE", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_GET_PRICE);
-		NETSHOPPING.set_function("NET_GAMESERVER_CATALOG_IS_VALID", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CATALOG_IS_VALID);
-		NETSHOPPING.set_function("NET_GAMESERVER_IS_CATALOG_CURRENT", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_IS_CATALOG_CURRENT);
-		NETSHOPPING.set_function("NET_GAMESERVER_GET_CATALOG_CLOUD_CRC", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_GET_CATALOG_CLOUD_CRC);
-		NETSHOPPING.set_function("NET_GAMESERVER_REFRESH_SERVER_CATALOG", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_REFRESH_SERVER_CATALOG);
-		NETSHOPPING.set_function("NET_GAMESERVER_RETRIEVE_CATALOG_REFRESH_STATUS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_RETRIEVE_CATALOG_REFRESH_STATUS);
-		NETSHOPPING.set_function("NET_GAMESERVER_INIT_SESSION", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_INIT_SESSION);
-		NETSHOPPING.set_function("NET_GAMESERVER_RETRIEVE_INIT_SESSION_STATUS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_RETRIEVE_INIT_SESSION_STATUS);
-		NETSHOPPING.set_function("NET_GAMESERVER_START_SESSION", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_START_SESSION);
-		NETSHOPPING.set_function("NET_GAMESERVER_START_SESSION_PENDING", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_START_SESSION_PENDING);
-		NETSHOPPING.set_function("NET_GAMESERVER_RETRIEVE_START_SESSION_STATUS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_RETRIEVE_START_SESSION_STATUS);
-		NETSHOPPING.set_function("NET_GAMESERVER_RETRIEVE_SESSION_ERROR_CODE", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_RETRIEVE_SESSION_ERROR_CODE);
-		NETSHOPPING.set_function("NET_GAMESERVER_IS_SESSION_VALID", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_IS_SESSION_VALID);
-		NETSHOPPING.set_function("NET_GAMESERVER_CLEAR_SESSION", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CLEAR_SESSION);
-		NETSHOPPING.set_function("NET_GAMESERVER_SESSION_APPLY_RECEIVED_DATA", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_SESSION_APPLY_RECEIVED_DATA);
-		NETSHOPPING.set_function("NET_GAMESERVER_IS_SESSION_REFRESH_PENDING", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_IS_SESSION_REFRESH_PENDING);
-		NETSHOPPING.set_function("NET_GAMESERVER_START_SESSION_RESTART", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_START_SESSION_RESTART);
-		NETSHOPPING.set_function("NET_GAMESERVER_TRANSACTION_IN_PROGRESS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSACTION_IN_PROGRESS);
-		NETSHOPPING.set_function("NET_GAMESERVER_GET_SESSION_STATE_AND_STATUS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_GET_SESSION_STATE_AND_STATUS);
-		NETSHOPPING.set_function("NET_GAMESERVER_BASKET_START", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_START);
-		NETSHOPPING.set_function("NET_GAMESERVER_BASKET_END", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_END);
-		NETSHOPPING.set_function("NET_GAMESERVER_BASKET_IS_ACTIVE", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_IS_ACTIVE);
-		NETSHOPPING.set_function("NET_GAMESERVER_BASKET_ADD_ITEM", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_ADD_ITEM);
-		NETSHOPPING.set_function("NET_GAMESERVER_BASKET_IS_FULL", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_IS_FULL);
-		NETSHOPPING.set_function("NET_GAMESERVER_BASKET_APPLY_SERVER_DATA", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BASKET_APPLY_SERVER_DATA);
-		NETSHOPPING.set_function("NET_GAMESERVER_CHECKOUT_START", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_CHECKOUT_START);
-		NETSHOPPING.set_function("NET_GAMESERVER_BEGIN_SERVICE", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_BEGIN_SERVICE);
-		NETSHOPPING.set_function("NET_GAMESERVER_END_SERVICE", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_END_SERVICE);
-		NETSHOPPING.set_function("NET_GAMESERVER_DELETE_CHARACTER", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_DELETE_CHARACTER);
-		NETSHOPPING.set_function("NET_GAMESERVER_DELETE_CHARACTER_GET_STATUS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_DELETE_CHARACTER_GET_STATUS);
-		NETSHOPPING.set_function("NET_GAMESERVER_DELETE_SET_TELEMETRY_NONCE_SEED", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_DELETE_SET_TELEMETRY_NONCE_SEED);
-		NETSHOPPING.set_function("NET_GAMESERVER_TRANSFER_BANK_TO_WALLET", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_BANK_TO_WALLET);
-		NETSHOPPING.set_function("NET_GAMESERVER_TRANSFER_WALLET_TO_BANK", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_WALLET_TO_BANK);
-		NETSHOPPING.set_function("NET_GAMESERVER_TRANSFER_BANK_TO_WALLET_GET_STATUS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_BANK_TO_WALLET_GET_STATUS);
-		NETSHOPPING.set_function("NET_GAMESERVER_TRANSFER_WALLET_TO_BANK_GET_STATUS", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_WALLET_TO_BANK_GET_STATUS);
-		NETSHOPPING.set_function("NET_GAMESERVER_TRANSFER_CASH_SET_TELEMETRY_NONCE_SEED", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_TRANSFER_CASH_SET_TELEMETRY_NONCE_SEED);
-		NETSHOPPING.set_function("NET_GAMESERVER_SET_TELEMETRY_NONCE_SEED", LUA_NATIVE_NETSHOPPING_NET_GAMESERVER_SET_TELEMETRY_NONCE_SEED);
+		bind_namespace(L, "NETSHOPPING", NETSHOPPING_natives);
 	}
 }
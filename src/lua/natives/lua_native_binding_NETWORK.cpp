@@ -4867,851 +4867,854 @@ namespace lua::native
 		NETWORK::NETWORK_UGC_NAV(p0, p1);
 	}
 
+	static constexpr native_entry NETWORK_natives[] = {
+		{"ACTIVATE_DAMAGE_TRACKER_ON_NETWORK_ID", native_function<LUA_NATIVE_NETWORK_ACTIVATE_DAMAGE_TRACKER_ON_NETWORK_ID>},
+		{"ACTIVATE_DAMAGE_TRACKER_ON_PLAYER", native_function<LUA_NATIVE_NETWORK_ACTIVATE_DAMAGE_TRACKER_ON_PLAYER>},
+		{"ARE_CUTSCENE_ENTITIES_NETWORKED", native_function<LUA_NATIVE_NETWORK_ARE_CUTSCENE_ENTITIES_NETWORKED>},
+		{"BAD_SPORT_PLAYER_LEFT_DETECTED", native_function<LUA_NATIVE_NETWORK_BAD_SPORT_PLAYER_LEFT_DETECTED>},
+		{"CAN_REGISTER_MISSION_DOORS", native_function<LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_DOORS>},
+		{"CAN_REGISTER_MISSION_ENTITIES", native_function<LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_ENTITIES>},
+		{"CAN_REGISTER_MISSION_OBJECTS", native_function<LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_OBJECTS>},
+		{"CAN_REGISTER_MISSION_PEDS", native_function<LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_PEDS>},
+		{"CAN_REGISTER_MISSION_PICKUPS", native_function<LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_PICKUPS>},
+		{"CAN_REGISTER_MISSION_VEHICLES", native_function<LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_VEHICLES>},
+		{"CLEAR_SERVICE_EVENT_ARGUMENTS", native_function<LUA_NATIVE_NETWORK_CLEAR_SERVICE_EVENT_ARGUMENTS>},
+		{"CLOUD_CHECK_AVAILABILITY", native_function<LUA_NATIVE_NETWORK_CLOUD_CHECK_AVAILABILITY>},
+		{"CLOUD_DELETE_MEMBER_FILE", native_function<LUA_NATIVE_NETWORK_CLOUD_DELETE_MEMBER_FILE>},
+		{"CLOUD_DID_REQUEST_SUCCEED", native_function<LUA_NATIVE_NETWORK_CLOUD_DID_REQUEST_SUCCEED>},
+		{"CLOUD_GET_AVAILABILITY_CHECK_RESULT", native_function<LUA_NATIVE_NETWORK_CLOUD_GET_AVAILABILITY_CHECK_RESULT>},
+		{"CLOUD_HAS_REQUEST_COMPLETED", native_function<LUA_NATIVE_NETWORK_CLOUD_HAS_REQUEST_COMPLETED>},
+		{"CLOUD_IS_CHECKING_AVAILABILITY", native_function<LUA_NATIVE_NETWORK_CLOUD_IS_CHECKING_AVAILABILITY>},
+		{"CONVERT_POSIX_TIME", native_function<LUA_NATIVE_NETWORK_CONVERT_POSIX_TIME>},
+		{"DELAY_MP_STORE_OPEN", native_function<LUA_NATIVE_NETWORK_DELAY_MP_STORE_OPEN>},
+		{"FACEBOOK_CAN_POST_TO_FACEBOOK", native_function<LUA_NATIVE_NETWORK_FACEBOOK_CAN_POST_TO_FACEBOOK>},
+		{"FACEBOOK_DID_POST_SUCCEED", native_function<LUA_NATIVE_NETWORK_FACEBOOK_DID_POST_SUCCEED>},
+		{"FACEBOOK_HAS_POST_COMPLETED", native_function<LUA_NATIVE_NETWORK_FACEBOOK_HAS_POST_COMPLETED>},
+		{"FACEBOOK_POST_COMPLETED_HEIST", native_function<LUA_NATIVE_NETWORK_FACEBOOK_POST_COMPLETED_HEIST>},
+		{"FACEBOOK_POST_COMPLETED_MILESTONE", native_function<LUA_NATIVE_NETWORK_FACEBOOK_POST_COMPLETED_MILESTONE>},
+		{"FACEBOOK_POST_CREATE_CHARACTER", native_function<LUA_NATIVE_NETWORK_FACEBOOK_POST_CREATE_CHARACTER>},
+		{"FADE_OUT_LOCAL_PLAYER", native_function<LUA_NATIVE_NETWORK_FADE_OUT_LOCAL_PLAYER>},
+		{"FILLOUT_PM_PLAYER_LIST", native_function<LUA_NATIVE_NETWORK_FILLOUT_PM_PLAYER_LIST>},
+		{"FILLOUT_PM_PLAYER_LIST_WITH_NAMES", native_function<LUA_NATIVE_NETWORK_FILLOUT_PM_PLAYER_LIST_WITH_NAMES>},
+		{"GET_CLOUD_TIME_AS_INT", native_function<LUA_NATIVE_NETWORK_GET_CLOUD_TIME_AS_INT>},
+		{"GET_CLOUD_TIME_AS_STRING", native_function<LUA_NATIVE_NETWORK_GET_CLOUD_TIME_AS_STRING>},
+		{"GET_COMMERCE_ITEM_CAT", native_function<LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_CAT>},
+		{"GET_COMMERCE_ITEM_ID", native_function<LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_ID>},
+		{"GET_COMMERCE_ITEM_NAME", native_function<LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_NAME>},
+		{"GET_COMMERCE_ITEM_NUM_CATS", native_function<LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_NUM_CATS>},
+		{"GET_COMMERCE_ITEM_TEXTURENAME", native_function<LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_TEXTURENAME>},
+		{"GET_COMMERCE_PRODUCT_PRICE", native_function<LUA_NATIVE_NETWORK_GET_COMMERCE_PRODUCT_PRICE>},
+		{"GET_CONTENT_TO_LOAD_TYPE", native_function<LUA_NATIVE_NETWORK_GET_CONTENT_TO_LOAD_TYPE>},
+		{"GET_IS_LAUNCH_FROM_LIVE_AREA", native_function<LUA_NATIVE_NETWORK_GET_IS_LAUNCH_FROM_LIVE_AREA>},
+		{"GET_IS_LIVE_AREA_LAUNCH_WITH_CONTENT", native_function<LUA_NATIVE_NETWORK_GET_IS_LIVE_AREA_LAUNCH_WITH_CONTENT>},
+		{"GET_MAX_NUM_NETWORK_OBJECTS", native_function<LUA_NATIVE_NETWORK_GET_MAX_NUM_NETWORK_OBJECTS>},
+		{"GET_MAX_NUM_NETWORK_PEDS", native_function<LUA_NATIVE_NETWORK_GET_MAX_NUM_NETWORK_PEDS>},
+		{"GET_MAX_NUM_NETWORK_PICKUPS", native_function<LUA_NATIVE_NETWORK_GET_MAX_NUM_NETWORK_PICKUPS>},
+		{"GET_MAX_NUM_NETWORK_VEHICLES", native_function<LUA_NATIVE_NETWORK_GET_MAX_NUM_NETWORK_VEHICLES>},
+		{"GET_NETWORK_TIME", native_function<LUA_NATIVE_NETWORK_GET_NETWORK_TIME>},
+		{"GET_NETWORK_TIME_ACCURATE", native_function<LUA_NATIVE_NETWORK_GET_NETWORK_TIME_ACCURATE>},
+		{"GET_NUM_COMMERCE_ITEMS", native_function<LUA_NATIVE_NETWORK_GET_NUM_COMMERCE_ITEMS>},
+		{"GET_NUM_CREATED_MISSION_OBJECTS", native_function<LUA_NATIVE_NETWORK_GET_NUM_CREATED_MISSION_OBJECTS>},
+		{"GET_NUM_CREATED_MISSION_PEDS", native_function<LUA_NATIVE_NETWORK_GET_NUM_CREATED_MISSION_PEDS>},
+		{"GET_NUM_CREATED_MISSION_VEHICLES", native_function<LUA_NATIVE_NETWORK_GET_NUM_CREATED_MISSION_VEHICLES>},
+		{"GET_NUM_RESERVED_MISSION_OBJECTS", native_function<LUA_NATIVE_NETWORK_GET_NUM_RESERVED_MISSION_OBJECTS>},
+		{"GET_NUM_RESERVED_MISSION_PEDS", native_function<LUA_NATIVE_NETWORK_GET_NUM_RESERVED_MISSION_PEDS>},
+		{"GET_NUM_RESERVED_MISSION_VEHICLES", native_function<LUA_NATIVE_NETWORK_GET_NUM_RESERVED_MISSION_VEHICLES>},
+		{"GET_ONLINE_VERSION", native_function<LUA_NATIVE_NETWORK_GET_ONLINE_VERSION>},
+		{"GET_RESERVED_MISSION_ENTITIES_IN_AREA", native_function<LUA_NATIVE_NETWORK_GET_RESERVED_MISSION_ENTITIES_IN_AREA>},
+		{"GET_STATUS_OF_TEXTURE_DOWNLOAD", native_function<LUA_NATIVE_NETWORK_GET_STATUS_OF_TEXTURE_DOWNLOAD>},
+		{"GET_TIME_AS_STRING", native_function<LUA_NATIVE_NETWORK_GET_TIME_AS_STRING>},
+		{"GET_TIME_DIFFERENCE", native_function<LUA_NATIVE_NETWORK_GET_TIME_DIFFERENCE>},
+		{"GET_TIME_OFFSET", native_function<LUA_NATIVE_NETWORK_GET_TIME_OFFSET>},
+		{"GET_USER_PREMIUM_ACCESS", native_function<LUA_NATIVE_NETWORK_GET_USER_PREMIUM_ACCESS>},
+		{"GET_USER_STARTER_ACCESS", native_function<LUA_NATIVE_NETWORK_GET_USER_STARTER_ACCESS>},
+		{"HAS_NETWORK_TIME_STARTED", native_function<LUA_NATIVE_NETWORK_HAS_NETWORK_TIME_STARTED>},
+		{"IS_COMMERCE_DATA_FETCH_IN_PROGRESS", native_function<LUA_NATIVE_NETWORK_IS_COMMERCE_DATA_FETCH_IN_PROGRESS>},
+		{"IS_COMMERCE_DATA_VALID", native_function<LUA_NATIVE_NETWORK_IS_COMMERCE_DATA_VALID>},
+		{"IS_COMMERCE_STORE_OPEN", native_function<LUA_NATIVE_NETWORK_IS_COMMERCE_STORE_OPEN>},
+		{"IS_DAMAGE_TRACKER_ACTIVE_ON_NETWORK_ID", native_function<LUA_NATIVE_NETWORK_IS_DAMAGE_TRACKER_ACTIVE_ON_NETWORK_ID>},
+		{"IS_DAMAGE_TRACKER_ACTIVE_ON_PLAYER", native_function<LUA_NATIVE_NETWORK_IS_DAMAGE_TRACKER_ACTIVE_ON_PLAYER>},
+		{"IS_ENTITY_A_GHOST", native_function<LUA_NATIVE_NETWORK_IS_ENTITY_A_GHOST>},
+		{"IS_ENTITY_IN_GHOST_COLLISION", native_function<LUA_NATIVE_NETWORK_IS_ENTITY_IN_GHOST_COLLISION>},
+		{"IS_NETWORK_ID_OWNED_BY_PARTICIPANT", native_function<LUA_NATIVE_NETWORK_IS_NETWORK_ID_OWNED_BY_PARTICIPANT>},
+		{"IS_NETWORK_VEHICLE_RUNNING_RESPOT_TIMER", native_function<LUA_NATIVE_NETWORK_IS_NETWORK_VEHICLE_RUNNING_RESPOT_TIMER>},
+		{"IS_PLAYER_IN_CUTSCENE", native_function<LUA_NATIVE_NETWORK_IS_PLAYER_IN_CUTSCENE>},
+		{"IS_SPHERE_VISIBLE_TO_ANOTHER_MACHINE", native_function<LUA_NATIVE_NETWORK_IS_SPHERE_VISIBLE_TO_ANOTHER_MACHINE>},
+		{"IS_SPHERE_VISIBLE_TO_PLAYER", native_function<LUA_NATIVE_NETWORK_IS_SPHERE_VISIBLE_TO_PLAYER>},
+		{"IS_STORE_AVAILABLE_TO_USER", native_function<LUA_NATIVE_NETWORK_IS_STORE_AVAILABLE_TO_USER>},
+		{"IS_TIME_EQUAL_TO", native_function<LUA_NATIVE_NETWORK_IS_TIME_EQUAL_TO>},
+		{"IS_TIME_LESS_THAN", native_function<LUA_NATIVE_NETWORK_IS_TIME_LESS_THAN>},
+		{"IS_TIME_MORE_THAN", native_function<LUA_NATIVE_NETWORK_IS_TIME_MORE_THAN>},
+		{"IS_USER_OLD_ENOUGH_TO_ACCESS_STORE", native_function<LUA_NATIVE_NETWORK_IS_USER_OLD_ENOUGH_TO_ACCESS_STORE>},
+		{"NETWORK_ACCEPT_PRESENCE_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCEPT_PRESENCE_INVITE>},
+		{"NETWORK_ACCESS_TUNABLE_BOOL", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_BOOL>},
+		{"NETWORK_ACCESS_TUNABLE_BOOL_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_BOOL_HASH>},
+		{"NETWORK_ACCESS_TUNABLE_BOOL_MODIFICATION_DETECTION_REGISTRATION_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_BOOL_MODIFICATION_DETECTION_REGISTRATION_HASH>},
+		{"NETWORK_ACCESS_TUNABLE_FLOAT", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_FLOAT>},
+		{"NETWORK_ACCESS_TUNABLE_FLOAT_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_FLOAT_HASH>},
+		{"NETWORK_ACCESS_TUNABLE_FLOAT_MODIFICATION_DETECTION_REGISTRATION_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_FLOAT_MODIFICATION_DETECTION_REGISTRATION_HASH>},
+		{"NETWORK_ACCESS_TUNABLE_INT", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_INT>},
+		{"NETWORK_ACCESS_TUNABLE_INT_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_INT_HASH>},
+		{"NETWORK_ACCESS_TUNABLE_INT_MODIFICATION_DETECTION_REGISTRATION_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_INT_MODIFICATION_DETECTION_REGISTRATION_HASH>},
+		{"NETWORK_ACCESS_TUNABLE_MODIFICATION_DETECTION_CLEAR", native_function<LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_MODIFICATION_DETECTION_CLEAR>},
+		{"NETWORK_ACTION_FOLLOW_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_ACTION_FOLLOW_INVITE>},
+		{"NETWORK_ADD_CLIENT_ENTITY_ANGLED_AREA", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_CLIENT_ENTITY_ANGLED_AREA>},
+		{"NETWORK_ADD_CLIENT_ENTITY_AREA", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_CLIENT_ENTITY_AREA>},
+		{"NETWORK_ADD_ENTITY_ANGLED_AREA", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_ENTITY_ANGLED_AREA>},
+		{"NETWORK_ADD_ENTITY_AREA", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_ENTITY_AREA>},
+		{"NETWORK_ADD_ENTITY_TO_SYNCHRONISED_SCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_ENTITY_TO_SYNCHRONISED_SCENE>},
+		{"NETWORK_ADD_FOLLOWERS", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_FOLLOWERS>},
+		{"NETWORK_ADD_FRIEND", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_FRIEND>},
+		{"NETWORK_ADD_INVALID_OBJECT_MODEL", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_INVALID_OBJECT_MODEL>},
+		{"NETWORK_ADD_MAP_ENTITY_TO_SYNCHRONISED_SCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_MAP_ENTITY_TO_SYNCHRONISED_SCENE>},
+		{"NETWORK_ADD_PED_TO_SYNCHRONISED_SCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_PED_TO_SYNCHRONISED_SCENE>},
+		{"NETWORK_ADD_PED_TO_SYNCHRONISED_SCENE_WITH_IK", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_PED_TO_SYNCHRONISED_SCENE_WITH_IK>},
+		{"NETWORK_ADD_SYNCHRONISED_SCENE_CAMERA", native_function<LUA_NATIVE_NETWORK_NETWORK_ADD_SYNCHRONISED_SCENE_CAMERA>},
+		{"NETWORK_ALLOW_CLONING_WHILE_IN_TUTORIAL", native_function<LUA_NATIVE_NETWORK_NETWORK_ALLOW_CLONING_WHILE_IN_TUTORIAL>},
+		{"NETWORK_ALLOW_GANG_TO_JOIN_TUTORIAL_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_ALLOW_GANG_TO_JOIN_TUTORIAL_SESSION>},
+		{"NETWORK_ALLOW_INVITE_PROCESS_IN_PLAYER_SWITCH", native_function<LUA_NATIVE_NETWORK_NETWORK_ALLOW_INVITE_PROCESS_IN_PLAYER_SWITCH>},
+		{"NETWORK_ALLOW_REMOTE_ATTACHMENT_MODIFICATION", native_function<LUA_NATIVE_NETWORK_NETWORK_ALLOW_REMOTE_ATTACHMENT_MODIFICATION>},
+		{"NETWORK_ALLOW_REMOTE_SYNCED_SCENE_LOCAL_PLAYER_REQUESTS", native_function<LUA_NATIVE_NETWORK_NETWORK_ALLOW_REMOTE_SYNCED_SCENE_LOCAL_PLAYER_REQUESTS>},
+		{"NETWORK_AM_I_BLOCKED_BY_GAMER", native_function<LUA_NATIVE_NETWORK_NETWORK_AM_I_BLOCKED_BY_GAMER>},
+		{"NETWORK_AM_I_BLOCKED_BY_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_AM_I_BLOCKED_BY_PLAYER>},
+		{"NETWORK_AM_I_MUTED_BY_GAMER", native_function<LUA_NATIVE_NETWORK_NETWORK_AM_I_MUTED_BY_GAMER>},
+		{"NETWORK_AM_I_MUTED_BY_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_AM_I_MUTED_BY_PLAYER>},
+		{"NETWORK_APPLY_CACHED_PLAYER_HEAD_BLEND_DATA", native_function<LUA_NATIVE_NETWORK_NETWORK_APPLY_CACHED_PLAYER_HEAD_BLEND_DATA>},
+		{"NETWORK_APPLY_PED_SCAR_DATA", native_function<LUA_NATIVE_NETWORK_NETWORK_APPLY_PED_SCAR_DATA>},
+		{"NETWORK_APPLY_TRANSITION_PARAMETER", native_function<LUA_NATIVE_NETWORK_NETWORK_APPLY_TRANSITION_PARAMETER>},
+		{"NETWORK_APPLY_TRANSITION_PARAMETER_STRING", native_function<LUA_NATIVE_NETWORK_NETWORK_APPLY_TRANSITION_PARAMETER_STRING>},
+		{"NETWORK_APPLY_VOICE_PROXIMITY_OVERRIDE", native_function<LUA_NATIVE_NETWORK_NETWORK_APPLY_VOICE_PROXIMITY_OVERRIDE>},
+		{"NETWORK_ARE_HANDLES_THE_SAME", native_function<LUA_NATIVE_NETWORK_NETWORK_ARE_HANDLES_THE_SAME>},
+		{"NETWORK_ARE_PLAYERS_IN_SAME_TUTORIAL_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_ARE_PLAYERS_IN_SAME_TUTORIAL_SESSION>},
+		{"NETWORK_ARE_SOCIAL_CLUB_POLICIES_CURRENT", native_function<LUA_NATIVE_NETWORK_NETWORK_ARE_SOCIAL_CLUB_POLICIES_CURRENT>},
+		{"NETWORK_ARE_TRANSITION_DETAILS_VALID", native_function<LUA_NATIVE_NETWORK_NETWORK_ARE_TRANSITION_DETAILS_VALID>},
+		{"NETWORK_ATTACH_SYNCHRONISED_SCENE_TO_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_ATTACH_SYNCHRONISED_SCENE_TO_ENTITY>},
+		{"NETWORK_BAIL", native_function<LUA_NATIVE_NETWORK_NETWORK_BAIL>},
+		{"NETWORK_BAIL_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_BAIL_TRANSITION>},
+		{"NETWORK_BLOCK_INVITES", native_function<LUA_NATIVE_NETWORK_NETWORK_BLOCK_INVITES>},
+		{"NETWORK_BLOCK_JOIN_QUEUE_INVITES", native_function<LUA_NATIVE_NETWORK_NETWORK_BLOCK_JOIN_QUEUE_INVITES>},
+		{"NETWORK_BLOCK_PROXY_MIGRATION_BETWEEN_TUTORIAL_SESSIONS", native_function<LUA_NATIVE_NETWORK_NETWORK_BLOCK_PROXY_MIGRATION_BETWEEN_TUTORIAL_SESSIONS>},
+		{"NETWORK_CACHE_LOCAL_PLAYER_HEAD_BLEND_DATA", native_function<LUA_NATIVE_NETWORK_NETWORK_CACHE_LOCAL_PLAYER_HEAD_BLEND_DATA>},
+		{"NETWORK_CANCEL_RESPAWN_SEARCH", native_function<LUA_NATIVE_NETWORK_NETWORK_CANCEL_RESPAWN_SEARCH>},
+		{"NETWORK_CANCEL_TRANSITION_MATCHMAKING", native_function<LUA_NATIVE_NETWORK_NETWORK_CANCEL_TRANSITION_MATCHMAKING>},
+		{"NETWORK_CAN_ACCESS_MULTIPLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_ACCESS_MULTIPLAYER>},
+		{"NETWORK_CAN_BAIL", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_BAIL>},
+		{"NETWORK_CAN_COMMUNICATE_WITH_GAMER", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_COMMUNICATE_WITH_GAMER>},
+		{"NETWORK_CAN_ENTER_MULTIPLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_ENTER_MULTIPLAYER>},
+		{"NETWORK_CAN_GAMER_PLAY_MULTIPLAYER_WITH_ME", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_GAMER_PLAY_MULTIPLAYER_WITH_ME>},
+		{"NETWORK_CAN_PLAY_MULTIPLAYER_WITH_GAMER", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_PLAY_MULTIPLAYER_WITH_GAMER>},
+		{"NETWORK_CAN_QUEUE_FOR_PREVIOUS_SESSION_JOIN", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_QUEUE_FOR_PREVIOUS_SESSION_JOIN>},
+		{"NETWORK_CAN_RECEIVE_LOCAL_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_RECEIVE_LOCAL_INVITE>},
+		{"NETWORK_CAN_SEND_LOCAL_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_SEND_LOCAL_INVITE>},
+		{"NETWORK_CAN_SESSION_END", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_SESSION_END>},
+		{"NETWORK_CAN_SET_WAYPOINT", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_SET_WAYPOINT>},
+		{"NETWORK_CAN_TEXT_CHAT_WITH_GAMER", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_TEXT_CHAT_WITH_GAMER>},
+		{"NETWORK_CAN_VIEW_GAMER_USER_CONTENT", native_function<LUA_NATIVE_NETWORK_NETWORK_CAN_VIEW_GAMER_USER_CONTENT>},
+		{"NETWORK_CHANGE_TRANSITION_SLOTS", native_function<LUA_NATIVE_NETWORK_NETWORK_CHANGE_TRANSITION_SLOTS>},
+		{"NETWORK_CHECK_COMMUNICATION_PRIVILEGES", native_function<LUA_NATIVE_NETWORK_NETWORK_CHECK_COMMUNICATION_PRIVILEGES>},
+		{"NETWORK_CHECK_DATA_MANAGER_FOR_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_CHECK_DATA_MANAGER_FOR_HANDLE>},
+		{"NETWORK_CHECK_DATA_MANAGER_SUCCEEDED_FOR_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_CHECK_DATA_MANAGER_SUCCEEDED_FOR_HANDLE>},
+		{"NETWORK_CHECK_ONLINE_PRIVILEGES", native_function<LUA_NATIVE_NETWORK_NETWORK_CHECK_ONLINE_PRIVILEGES>},
+		{"NETWORK_CHECK_PRIVILEGES", native_function<LUA_NATIVE_NETWORK_NETWORK_CHECK_PRIVILEGES>},
+		{"NETWORK_CHECK_ROS_LINK_WENTDOWN_NOT_NET", native_function<LUA_NATIVE_NETWORK_NETWORK_CHECK_ROS_LINK_WENTDOWN_NOT_NET>},
+		{"NETWORK_CHECK_TEXT_COMMUNICATION_PRIVILEGES", native_function<LUA_NATIVE_NETWORK_NETWORK_CHECK_TEXT_COMMUNICATION_PRIVILEGES>},
+		{"NETWORK_CHECK_USER_CONTENT_PRIVILEGES", native_function<LUA_NATIVE_NETWORK_NETWORK_CHECK_USER_CONTENT_PRIVILEGES>},
+		{"NETWORK_CLAN_ANY_DOWNLOAD_MEMBERSHIP_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_ANY_DOWNLOAD_MEMBERSHIP_PENDING>},
+		{"NETWORK_CLAN_CREWINFO_GET_CREWRANKTITLE", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_CREWINFO_GET_CREWRANKTITLE>},
+		{"NETWORK_CLAN_CREWINFO_GET_STRING_VALUE", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_CREWINFO_GET_STRING_VALUE>},
+		{"NETWORK_CLAN_DOWNLOAD_MEMBERSHIP", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_DOWNLOAD_MEMBERSHIP>},
+		{"NETWORK_CLAN_DOWNLOAD_MEMBERSHIP_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_DOWNLOAD_MEMBERSHIP_PENDING>},
+		{"NETWORK_CLAN_GET_EMBLEM_TXD_NAME", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_EMBLEM_TXD_NAME>},
+		{"NETWORK_CLAN_GET_LOCAL_MEMBERSHIPS_COUNT", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_LOCAL_MEMBERSHIPS_COUNT>},
+		{"NETWORK_CLAN_GET_MEMBERSHIP", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_MEMBERSHIP>},
+		{"NETWORK_CLAN_GET_MEMBERSHIP_COUNT", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_MEMBERSHIP_COUNT>},
+		{"NETWORK_CLAN_GET_MEMBERSHIP_DESC", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_MEMBERSHIP_DESC>},
+		{"NETWORK_CLAN_GET_MEMBERSHIP_VALID", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_MEMBERSHIP_VALID>},
+		{"NETWORK_CLAN_GET_UI_FORMATTED_TAG", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_UI_FORMATTED_TAG>},
+		{"NETWORK_CLAN_HAS_CREWINFO_METADATA_BEEN_RECEIVED", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_HAS_CREWINFO_METADATA_BEEN_RECEIVED>},
+		{"NETWORK_CLAN_IS_EMBLEM_READY", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_IS_EMBLEM_READY>},
+		{"NETWORK_CLAN_IS_ROCKSTAR_CLAN", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_IS_ROCKSTAR_CLAN>},
+		{"NETWORK_CLAN_JOIN", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_JOIN>},
+		{"NETWORK_CLAN_PLAYER_GET_DESC", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_PLAYER_GET_DESC>},
+		{"NETWORK_CLAN_PLAYER_IS_ACTIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_PLAYER_IS_ACTIVE>},
+		{"NETWORK_CLAN_RELEASE_EMBLEM", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_RELEASE_EMBLEM>},
+		{"NETWORK_CLAN_REMOTE_MEMBERSHIPS_ARE_IN_CACHE", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_REMOTE_MEMBERSHIPS_ARE_IN_CACHE>},
+		{"NETWORK_CLAN_REQUEST_EMBLEM", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_REQUEST_EMBLEM>},
+		{"NETWORK_CLAN_SERVICE_IS_VALID", native_function<LUA_NATIVE_NETWORK_NETWORK_CLAN_SERVICE_IS_VALID>},
+		{"NETWORK_CLEAR_CLOCK_TIME_OVERRIDE", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_CLOCK_TIME_OVERRIDE>},
+		{"NETWORK_CLEAR_FOLLOWERS", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_FOLLOWERS>},
+		{"NETWORK_CLEAR_FOLLOW_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_FOLLOW_INVITE>},
+		{"NETWORK_CLEAR_FOUND_GAMERS", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_FOUND_GAMERS>},
+		{"NETWORK_CLEAR_GET_GAMER_STATUS", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_GET_GAMER_STATUS>},
+		{"NETWORK_CLEAR_GROUP_ACTIVITY", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_GROUP_ACTIVITY>},
+		{"NETWORK_CLEAR_INVALID_OBJECT_MODELS", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_INVALID_OBJECT_MODELS>},
+		{"NETWORK_CLEAR_OFFLINE_INVITE_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_OFFLINE_INVITE_PENDING>},
+		{"NETWORK_CLEAR_PROPERTY_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_PROPERTY_ID>},
+		{"NETWORK_CLEAR_QUEUED_JOIN_REQUEST", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_QUEUED_JOIN_REQUEST>},
+		{"NETWORK_CLEAR_TRANSITION_CREATOR_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_TRANSITION_CREATOR_HANDLE>},
+		{"NETWORK_CLEAR_VOICE_CHANNEL", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_VOICE_CHANNEL>},
+		{"NETWORK_CLEAR_VOICE_PROXIMITY_OVERRIDE", native_function<LUA_NATIVE_NETWORK_NETWORK_CLEAR_VOICE_PROXIMITY_OVERRIDE>},
+		{"NETWORK_CLOSE_TRANSITION_MATCHMAKING", native_function<LUA_NATIVE_NETWORK_NETWORK_CLOSE_TRANSITION_MATCHMAKING>},
+		{"NETWORK_CONCEAL_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_CONCEAL_ENTITY>},
+		{"NETWORK_CONCEAL_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_CONCEAL_PLAYER>},
+		{"NETWORK_CREATE_SYNCHRONISED_SCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_CREATE_SYNCHRONISED_SCENE>},
+		{"NETWORK_DID_FIND_GAMERS_SUCCEED", native_function<LUA_NATIVE_NETWORK_NETWORK_DID_FIND_GAMERS_SUCCEED>},
+		{"NETWORK_DID_GET_GAMER_STATUS_SUCCEED", native_function<LUA_NATIVE_NETWORK_NETWORK_DID_GET_GAMER_STATUS_SUCCEED>},
+		{"NETWORK_DISABLE_INVINCIBLE_FLASHING", native_function<LUA_NATIVE_NETWORK_NETWORK_DISABLE_INVINCIBLE_FLASHING>},
+		{"NETWORK_DISABLE_LEAVE_REMOTE_PED_BEHIND", native_function<LUA_NATIVE_NETWORK_NETWORK_DISABLE_LEAVE_REMOTE_PED_BEHIND>},
+		{"NETWORK_DISABLE_PROXIMITY_MIGRATION", native_function<LUA_NATIVE_NETWORK_NETWORK_DISABLE_PROXIMITY_MIGRATION>},
+		{"NETWORK_DISABLE_REALTIME_MULTIPLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_DISABLE_REALTIME_MULTIPLAYER>},
+		{"NETWORK_DISABLE_VOICE_BANDWIDTH_RESTRICTION", native_function<LUA_NATIVE_NETWORK_NETWORK_DISABLE_VOICE_BANDWIDTH_RESTRICTION>},
+		{"NETWORK_DISPLAYNAMES_FROM_HANDLES_START", native_function<LUA_NATIVE_NETWORK_NETWORK_DISPLAYNAMES_FROM_HANDLES_START>},
+		{"NETWORK_DOES_COMMUNICATION_GROUP_EXIST_", native_function<LUA_NATIVE_NETWORK_NETWORK_DOES_COMMUNICATION_GROUP_EXIST_>},
+		{"NETWORK_DOES_ENTITY_EXIST_WITH_NETWORK_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_DOES_ENTITY_EXIST_WITH_NETWORK_ID>},
+		{"NETWORK_DOES_NETWORK_ID_EXIST", native_function<LUA_NATIVE_NETWORK_NETWORK_DOES_NETWORK_ID_EXIST>},
+		{"NETWORK_DOES_TUNABLE_EXIST", native_function<LUA_NATIVE_NETWORK_NETWORK_DOES_TUNABLE_EXIST>},
+		{"NETWORK_DOES_TUNABLE_EXIST_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_DOES_TUNABLE_EXIST_HASH>},
+		{"NETWORK_DO_TRANSITION_QUICKMATCH", native_function<LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_QUICKMATCH>},
+		{"NETWORK_DO_TRANSITION_QUICKMATCH_ASYNC", native_function<LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_QUICKMATCH_ASYNC>},
+		{"NETWORK_DO_TRANSITION_QUICKMATCH_WITH_GROUP", native_function<LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_QUICKMATCH_WITH_GROUP>},
+		{"NETWORK_DO_TRANSITION_TO_FREEMODE", native_function<LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_TO_FREEMODE>},
+		{"NETWORK_DO_TRANSITION_TO_GAME", native_function<LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_TO_GAME>},
+		{"NETWORK_DO_TRANSITION_TO_NEW_FREEMODE", native_function<LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_TO_NEW_FREEMODE>},
+		{"NETWORK_DO_TRANSITION_TO_NEW_GAME", native_function<LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_TO_NEW_GAME>},
+		{"NETWORK_DUMP_NET_IF_CONFIG", native_function<LUA_NATIVE_NETWORK_NETWORK_DUMP_NET_IF_CONFIG>},
+		{"NETWORK_ENABLE_EXTRA_VEHICLE_ORIENTATION_BLEND_CHECKS", native_function<LUA_NATIVE_NETWORK_NETWORK_ENABLE_EXTRA_VEHICLE_ORIENTATION_BLEND_CHECKS>},
+		{"NETWORK_ENABLE_VOICE_BANDWIDTH_RESTRICTION", native_function<LUA_NATIVE_NETWORK_NETWORK_ENABLE_VOICE_BANDWIDTH_RESTRICTION>},
+		{"NETWORK_END_TUTORIAL_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_END_TUTORIAL_SESSION>},
+		{"NETWORK_ENTITY_AREA_DOES_EXIST", native_function<LUA_NATIVE_NETWORK_NETWORK_ENTITY_AREA_DOES_EXIST>},
+		{"NETWORK_ENTITY_AREA_HAVE_ALL_REPLIED", native_function<LUA_NATIVE_NETWORK_NETWORK_ENTITY_AREA_HAVE_ALL_REPLIED>},
+		{"NETWORK_ENTITY_AREA_IS_OCCUPIED", native_function<LUA_NATIVE_NETWORK_NETWORK_ENTITY_AREA_IS_OCCUPIED>},
+		{"NETWORK_ENTITY_GET_OBJECT_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_ENTITY_GET_OBJECT_ID>},
+		{"NETWORK_ENTITY_USE_HIGH_PRECISION_ROTATION", native_function<LUA_NATIVE_NETWORK_NETWORK_ENTITY_USE_HIGH_PRECISION_ROTATION>},
+		{"NETWORK_EXPLODE_HELI", native_function<LUA_NATIVE_NETWORK_NETWORK_EXPLODE_HELI>},
+		{"NETWORK_EXPLODE_VEHICLE", native_function<LUA_NATIVE_NETWORK_NETWORK_EXPLODE_VEHICLE>},
+		{"NETWORK_FADE_IN_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_FADE_IN_ENTITY>},
+		{"NETWORK_FADE_OUT_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_FADE_OUT_ENTITY>},
+		{"NETWORK_FIND_GAMERS_IN_CREW", native_function<LUA_NATIVE_NETWORK_NETWORK_FIND_GAMERS_IN_CREW>},
+		{"NETWORK_FIND_LARGEST_BUNCH_OF_PLAYERS", native_function<LUA_NATIVE_NETWORK_NETWORK_FIND_LARGEST_BUNCH_OF_PLAYERS>},
+		{"NETWORK_FIND_MATCHED_GAMERS", native_function<LUA_NATIVE_NETWORK_NETWORK_FIND_MATCHED_GAMERS>},
+		{"NETWORK_FINISH_BROADCASTING_DATA", native_function<LUA_NATIVE_NETWORK_NETWORK_FINISH_BROADCASTING_DATA>},
+		{"NETWORK_FORCE_LOCAL_PLAYER_SCAR_SYNC", native_function<LUA_NATIVE_NETWORK_NETWORK_FORCE_LOCAL_PLAYER_SCAR_SYNC>},
+		{"NETWORK_FORCE_LOCAL_USE_OF_SYNCED_SCENE_CAMERA", native_function<LUA_NATIVE_NETWORK_NETWORK_FORCE_LOCAL_USE_OF_SYNCED_SCENE_CAMERA>},
+		{"NETWORK_GAMERTAG_FROM_HANDLE_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_GAMERTAG_FROM_HANDLE_PENDING>},
+		{"NETWORK_GAMERTAG_FROM_HANDLE_START", native_function<LUA_NATIVE_NETWORK_NETWORK_GAMERTAG_FROM_HANDLE_START>},
+		{"NETWORK_GAMERTAG_FROM_HANDLE_SUCCEEDED", native_function<LUA_NATIVE_NETWORK_NETWORK_GAMERTAG_FROM_HANDLE_SUCCEEDED>},
+		{"NETWORK_GAMER_HAS_HEADSET", native_function<LUA_NATIVE_NETWORK_NETWORK_GAMER_HAS_HEADSET>},
+		{"NETWORK_GET_ACTIVITY_PLAYER_NUM", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_ACTIVITY_PLAYER_NUM>},
+		{"NETWORK_GET_AGE_GROUP", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_AGE_GROUP>},
+		{"NETWORK_GET_ASSISTED_DAMAGE_OF_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_ASSISTED_DAMAGE_OF_ENTITY>},
+		{"NETWORK_GET_ASSISTED_KILL_OF_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_ASSISTED_KILL_OF_ENTITY>},
+		{"NETWORK_GET_AVERAGE_LATENCY", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_AVERAGE_LATENCY>},
+		{"NETWORK_GET_AVERAGE_PACKET_LOSS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_AVERAGE_PACKET_LOSS>},
+		{"NETWORK_GET_AVERAGE_PING", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_AVERAGE_PING>},
+		{"NETWORK_GET_BONE_ID_OF_FATAL_HIT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_BONE_ID_OF_FATAL_HIT>},
+		{"NETWORK_GET_COMMUNICATION_GROUP_FLAGS_", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_COMMUNICATION_GROUP_FLAGS_>},
+		{"NETWORK_GET_CONTENT_MODIFIER_LIST_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_CONTENT_MODIFIER_LIST_ID>},
+		{"NETWORK_GET_CURRENTLY_SELECTED_GAMER_HANDLE_FROM_INVITE_MENU", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_CURRENTLY_SELECTED_GAMER_HANDLE_FROM_INVITE_MENU>},
+		{"NETWORK_GET_DESTROYER_OF_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_DESTROYER_OF_ENTITY>},
+		{"NETWORK_GET_DESTROYER_OF_NETWORK_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_DESTROYER_OF_NETWORK_ID>},
+		{"NETWORK_GET_DISPLAYNAMES_FROM_HANDLES", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_DISPLAYNAMES_FROM_HANDLES>},
+		{"NETWORK_GET_ENTITY_FROM_NETWORK_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_FROM_NETWORK_ID>},
+		{"NETWORK_GET_ENTITY_FROM_OBJECT_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_FROM_OBJECT_ID>},
+		{"NETWORK_GET_ENTITY_IS_LOCAL", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_IS_LOCAL>},
+		{"NETWORK_GET_ENTITY_IS_NETWORKED", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_IS_NETWORKED>},
+		{"NETWORK_GET_ENTITY_KILLER_OF_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_KILLER_OF_PLAYER>},
+		{"NETWORK_GET_FOUND_GAMER", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_FOUND_GAMER>},
+		{"NETWORK_GET_FRIEND_COUNT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_FRIEND_COUNT>},
+		{"NETWORK_GET_FRIEND_DISPLAY_NAME", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_FRIEND_DISPLAY_NAME>},
+		{"NETWORK_GET_FRIEND_NAME", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_FRIEND_NAME>},
+		{"NETWORK_GET_GAMERTAG_FROM_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_GAMERTAG_FROM_HANDLE>},
+		{"NETWORK_GET_GAMER_STATUS_FROM_QUEUE", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_GAMER_STATUS_FROM_QUEUE>},
+		{"NETWORK_GET_GAMER_STATUS_RESULT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_GAMER_STATUS_RESULT>},
+		{"NETWORK_GET_GAME_MODE", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_GAME_MODE>},
+		{"NETWORK_GET_GLOBAL_MULTIPLAYER_CLOCK", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_GLOBAL_MULTIPLAYER_CLOCK>},
+		{"NETWORK_GET_HIGHEST_RELIABLE_RESEND_COUNT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_HIGHEST_RELIABLE_RESEND_COUNT>},
+		{"NETWORK_GET_HOST_OF_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_HOST_OF_SCRIPT>},
+		{"NETWORK_GET_HOST_OF_THIS_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_HOST_OF_THIS_SCRIPT>},
+		{"NETWORK_GET_HOST_PLAYER_INDEX", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_HOST_PLAYER_INDEX>},
+		{"NETWORK_GET_INSTANCE_ID_OF_THIS_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_INSTANCE_ID_OF_THIS_SCRIPT>},
+		{"NETWORK_GET_INVITE_REPLY_STATUS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_INVITE_REPLY_STATUS>},
+		{"NETWORK_GET_KILLER_OF_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_KILLER_OF_PLAYER>},
+		{"NETWORK_GET_LAST_ENTITY_POS_RECEIVED_OVER_NETWORK", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_LAST_ENTITY_POS_RECEIVED_OVER_NETWORK>},
+		{"NETWORK_GET_LAST_PLAYER_POS_RECEIVED_OVER_NETWORK", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_LAST_PLAYER_POS_RECEIVED_OVER_NETWORK>},
+		{"NETWORK_GET_LAST_VEL_RECEIVED_OVER_NETWORK", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_LAST_VEL_RECEIVED_OVER_NETWORK>},
+		{"NETWORK_GET_LOCAL_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_LOCAL_HANDLE>},
+		{"NETWORK_GET_LOCAL_SCENE_FROM_NETWORK_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_LOCAL_SCENE_FROM_NETWORK_ID>},
+		{"NETWORK_GET_MAX_FRIENDS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_MAX_FRIENDS>},
+		{"NETWORK_GET_MAX_NUM_PARTICIPANTS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_MAX_NUM_PARTICIPANTS>},
+		{"NETWORK_GET_MUTE_COUNT_FOR_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_MUTE_COUNT_FOR_PLAYER>},
+		{"NETWORK_GET_NETWORK_ID_FROM_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NETWORK_ID_FROM_ENTITY>},
+		{"NETWORK_GET_NET_STATISTICS_INFO", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NET_STATISTICS_INFO>},
+		{"NETWORK_GET_NP_UNAVAILABLE_REASON", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NP_UNAVAILABLE_REASON>},
+		{"NETWORK_GET_NUMBER_BODY_TRACKER_HITS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NUMBER_BODY_TRACKER_HITS>},
+		{"NETWORK_GET_NUM_CONNECTED_PLAYERS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NUM_CONNECTED_PLAYERS>},
+		{"NETWORK_GET_NUM_FOUND_GAMERS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NUM_FOUND_GAMERS>},
+		{"NETWORK_GET_NUM_PARTICIPANTS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NUM_PARTICIPANTS>},
+		{"NETWORK_GET_NUM_PRESENCE_INVITES", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NUM_PRESENCE_INVITES>},
+		{"NETWORK_GET_NUM_SCRIPT_PARTICIPANTS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NUM_SCRIPT_PARTICIPANTS>},
+		{"NETWORK_GET_NUM_TRANSITION_NON_ASYNC_GAMERS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NUM_TRANSITION_NON_ASYNC_GAMERS>},
+		{"NETWORK_GET_NUM_UNACKED_RELIABLES", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_NUM_UNACKED_RELIABLES>},
+		{"NETWORK_GET_PARTICIPANT_INDEX", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PARTICIPANT_INDEX>},
+		{"NETWORK_GET_PLATFORM_PARTY_MEMBERS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLATFORM_PARTY_MEMBERS>},
+		{"NETWORK_GET_PLATFORM_PARTY_MEMBER_COUNT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLATFORM_PARTY_MEMBER_COUNT>},
+		{"NETWORK_GET_PLAYER_ACCOUNT_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_ACCOUNT_ID>},
+		{"NETWORK_GET_PLAYER_FROM_GAMER_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_FROM_GAMER_HANDLE>},
+		{"NETWORK_GET_PLAYER_INDEX", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_INDEX>},
+		{"NETWORK_GET_PLAYER_INDEX_FROM_PED", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_INDEX_FROM_PED>},
+		{"NETWORK_GET_PLAYER_LOUDNESS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_LOUDNESS>},
+		{"NETWORK_GET_PLAYER_OWNS_WAYPOINT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_OWNS_WAYPOINT>},
+		{"NETWORK_GET_PLAYER_TUTORIAL_SESSION_INSTANCE", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_TUTORIAL_SESSION_INSTANCE>},
+		{"NETWORK_GET_POSITION_HASH_OF_THIS_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_POSITION_HASH_OF_THIS_SCRIPT>},
+		{"NETWORK_GET_PREDICTED_VELOCITY", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PREDICTED_VELOCITY>},
+		{"NETWORK_GET_PRESENCE_INVITE_CONTENT_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_CONTENT_ID>},
+		{"NETWORK_GET_PRESENCE_INVITE_FROM_ADMIN", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_FROM_ADMIN>},
+		{"NETWORK_GET_PRESENCE_INVITE_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_HANDLE>},
+		{"NETWORK_GET_PRESENCE_INVITE_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_ID>},
+		{"NETWORK_GET_PRESENCE_INVITE_INDEX_BY_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_INDEX_BY_ID>},
+		{"NETWORK_GET_PRESENCE_INVITE_INVITER", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_INVITER>},
+		{"NETWORK_GET_PRESENCE_INVITE_IS_TOURNAMENT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_IS_TOURNAMENT>},
+		{"NETWORK_GET_PRESENCE_INVITE_PLAYLIST_CURRENT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_PLAYLIST_CURRENT>},
+		{"NETWORK_GET_PRESENCE_INVITE_PLAYLIST_LENGTH", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_PLAYLIST_LENGTH>},
+		{"NETWORK_GET_PRESENCE_INVITE_SESSION_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_SESSION_ID>},
+		{"NETWORK_GET_PRIMARY_CLAN_DATA_CANCEL", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_CANCEL>},
+		{"NETWORK_GET_PRIMARY_CLAN_DATA_CLEAR", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_CLEAR>},
+		{"NETWORK_GET_PRIMARY_CLAN_DATA_NEW", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_NEW>},
+		{"NETWORK_GET_PRIMARY_CLAN_DATA_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_PENDING>},
+		{"NETWORK_GET_PRIMARY_CLAN_DATA_START", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_START>},
+		{"NETWORK_GET_PRIMARY_CLAN_DATA_SUCCESS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_SUCCESS>},
+		{"NETWORK_GET_RANDOM_FLOAT_RANGED_", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_RANDOM_FLOAT_RANGED_>},
+		{"NETWORK_GET_RANDOM_INT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_RANDOM_INT>},
+		{"NETWORK_GET_RANDOM_INT_RANGED", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_RANDOM_INT_RANGED>},
+		{"NETWORK_GET_RESPAWN_RESULT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_RESPAWN_RESULT>},
+		{"NETWORK_GET_RESPAWN_RESULT_FLAGS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_RESPAWN_RESULT_FLAGS>},
+		{"NETWORK_GET_SCRIPT_STATUS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_SCRIPT_STATUS>},
+		{"NETWORK_GET_SIGNALLING_INFO", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_SIGNALLING_INFO>},
+		{"NETWORK_GET_TALKER_PROXIMITY", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_TALKER_PROXIMITY>},
+		{"NETWORK_GET_THIS_SCRIPT_IS_NETWORK_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_THIS_SCRIPT_IS_NETWORK_SCRIPT>},
+		{"NETWORK_GET_TIMEOUT_TIME", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_TIMEOUT_TIME>},
+		{"NETWORK_GET_TOTAL_NUM_PLAYERS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_TOTAL_NUM_PLAYERS>},
+		{"NETWORK_GET_TRANSITION_HOST", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_TRANSITION_HOST>},
+		{"NETWORK_GET_TRANSITION_MEMBERS", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_TRANSITION_MEMBERS>},
+		{"NETWORK_GET_TUNABLE_CLOUD_CRC", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_TUNABLE_CLOUD_CRC>},
+		{"NETWORK_GET_UNRELIABLE_RESEND_COUNT", native_function<LUA_NATIVE_NETWORK_NETWORK_GET_UNRELIABLE_RESEND_COUNT>},
+		{"NETWORK_HANDLE_FROM_FRIEND", native_function<LUA_NATIVE_NETWORK_NETWORK_HANDLE_FROM_FRIEND>},
+		{"NETWORK_HANDLE_FROM_MEMBER_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_HANDLE_FROM_MEMBER_ID>},
+		{"NETWORK_HANDLE_FROM_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_HANDLE_FROM_PLAYER>},
+		{"NETWORK_HANDLE_FROM_USER_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_HANDLE_FROM_USER_ID>},
+		{"NETWORK_HASH_FROM_GAMER_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_HASH_FROM_GAMER_HANDLE>},
+		{"NETWORK_HASH_FROM_PLAYER_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_HASH_FROM_PLAYER_HANDLE>},
+		{"NETWORK_HAS_AGE_RESTRICTIONS", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_AGE_RESTRICTIONS>},
+		{"NETWORK_HAS_AUTOMUTE_OVERRIDE", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_AUTOMUTE_OVERRIDE>},
+		{"NETWORK_HAS_BONE_BEEN_HIT_BY_KILLER", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_BONE_BEEN_HIT_BY_KILLER>},
+		{"NETWORK_HAS_CACHED_PLAYER_HEAD_BLEND_DATA", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_CACHED_PLAYER_HEAD_BLEND_DATA>},
+		{"NETWORK_HAS_CONFIRMED_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_CONFIRMED_INVITE>},
+		{"NETWORK_HAS_CONTROL_OF_DOOR", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_CONTROL_OF_DOOR>},
+		{"NETWORK_HAS_CONTROL_OF_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_CONTROL_OF_ENTITY>},
+		{"NETWORK_HAS_CONTROL_OF_NETWORK_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_CONTROL_OF_NETWORK_ID>},
+		{"NETWORK_HAS_CONTROL_OF_PICKUP", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_CONTROL_OF_PICKUP>},
+		{"NETWORK_HAS_ENTITY_BEEN_REGISTERED_WITH_THIS_THREAD", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_ENTITY_BEEN_REGISTERED_WITH_THIS_THREAD>},
+		{"NETWORK_HAS_FOLLOW_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_FOLLOW_INVITE>},
+		{"NETWORK_HAS_HEADSET", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_HEADSET>},
+		{"NETWORK_HAS_INVITED_GAMER", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_INVITED_GAMER>},
+		{"NETWORK_HAS_INVITED_GAMER_TO_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_INVITED_GAMER_TO_TRANSITION>},
+		{"NETWORK_HAS_MADE_INVITE_DECISION", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_MADE_INVITE_DECISION>},
+		{"NETWORK_HAS_PENDING_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_PENDING_INVITE>},
+		{"NETWORK_HAS_PLAYER_STARTED_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_PLAYER_STARTED_TRANSITION>},
+		{"NETWORK_HAS_RECEIVED_HOST_BROADCAST_DATA", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_RECEIVED_HOST_BROADCAST_DATA>},
+		{"NETWORK_HAS_ROS_PRIVILEGE", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE>},
+		{"NETWORK_HAS_ROS_PRIVILEGE_END_DATE", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_END_DATE>},
+		{"NETWORK_HAS_ROS_PRIVILEGE_MP_TEXT_COMMUNICATION_", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_MP_TEXT_COMMUNICATION_>},
+		{"NETWORK_HAS_ROS_PRIVILEGE_MP_VOICE_COMMUNICATION_", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_MP_VOICE_COMMUNICATION_>},
+		{"NETWORK_HAS_ROS_PRIVILEGE_PLAYED_LAST_GEN", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_PLAYED_LAST_GEN>},
+		{"NETWORK_HAS_ROS_PRIVILEGE_SPECIAL_EDITION_CONTENT", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_SPECIAL_EDITION_CONTENT>},
+		{"NETWORK_HAS_SOCIAL_CLUB_ACCOUNT", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_SOCIAL_CLUB_ACCOUNT>},
+		{"NETWORK_HAS_SOCIAL_NETWORKING_SHARING_PRIV", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_SOCIAL_NETWORKING_SHARING_PRIV>},
+		{"NETWORK_HAS_TRANSITION_INVITE_BEEN_ACKED", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_TRANSITION_INVITE_BEEN_ACKED>},
+		{"NETWORK_HAS_VALID_ROS_CREDENTIALS", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_VALID_ROS_CREDENTIALS>},
+		{"NETWORK_HAS_VIEW_GAMER_USER_CONTENT_RESULT", native_function<LUA_NATIVE_NETWORK_NETWORK_HAS_VIEW_GAMER_USER_CONTENT_RESULT>},
+		{"NETWORK_HAVE_COMMUNICATION_PRIVILEGES", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_COMMUNICATION_PRIVILEGES>},
+		{"NETWORK_HAVE_ONLINE_PRIVILEGES", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_ONLINE_PRIVILEGES>},
+		{"NETWORK_HAVE_PLATFORM_COMMUNICATION_PRIVILEGES_", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_PLATFORM_COMMUNICATION_PRIVILEGES_>},
+		{"NETWORK_HAVE_PLATFORM_SUBSCRIPTION", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_PLATFORM_SUBSCRIPTION>},
+		{"NETWORK_HAVE_ROS_BANNED_PRIV", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_BANNED_PRIV>},
+		{"NETWORK_HAVE_ROS_CREATE_TICKET_PRIV", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_CREATE_TICKET_PRIV>},
+		{"NETWORK_HAVE_ROS_LEADERBOARD_WRITE_PRIV", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_LEADERBOARD_WRITE_PRIV>},
+		{"NETWORK_HAVE_ROS_MULTIPLAYER_PRIV", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_MULTIPLAYER_PRIV>},
+		{"NETWORK_HAVE_ROS_SOCIAL_CLUB_PRIV", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_SOCIAL_CLUB_PRIV>},
+		{"NETWORK_HAVE_SCS_PRIVATE_MSG_PRIV", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_SCS_PRIVATE_MSG_PRIV>},
+		{"NETWORK_HAVE_USER_CONTENT_PRIVILEGES", native_function<LUA_NATIVE_NETWORK_NETWORK_HAVE_USER_CONTENT_PRIVILEGES>},
+		{"NETWORK_HIDE_PROJECTILE_IN_CUTSCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_HIDE_PROJECTILE_IN_CUTSCENE>},
+		{"NETWORK_HOST_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_HOST_TRANSITION>},
+		{"NETWORK_IGNORE_REMOTE_WAYPOINTS", native_function<LUA_NATIVE_NETWORK_NETWORK_IGNORE_REMOTE_WAYPOINTS>},
+		{"NETWORK_INVITE_GAMERS", native_function<LUA_NATIVE_NETWORK_NETWORK_INVITE_GAMERS>},
+		{"NETWORK_INVITE_GAMERS_TO_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_INVITE_GAMERS_TO_TRANSITION>},
+		{"NETWORK_IS_ACTIVITY_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_ACTIVITY_SESSION>},
+		{"NETWORK_IS_ACTIVITY_SPECTATOR", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_ACTIVITY_SPECTATOR>},
+		{"NETWORK_IS_ACTIVITY_SPECTATOR_FROM_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_ACTIVITY_SPECTATOR_FROM_HANDLE>},
+		{"NETWORK_IS_ADDING_FRIEND", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_ADDING_FRIEND>},
+		{"NETWORK_IS_AMERICAS_VERSION_", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_AMERICAS_VERSION_>},
+		{"NETWORK_IS_ANY_PLAYER_NEAR", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_ANY_PLAYER_NEAR>},
+		{"NETWORK_IS_CABLE_CONNECTED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_CABLE_CONNECTED>},
+		{"NETWORK_IS_CHATTING_IN_PLATFORM_PARTY", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_CHATTING_IN_PLATFORM_PARTY>},
+		{"NETWORK_IS_CLOCK_TIME_OVERRIDDEN", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_CLOCK_TIME_OVERRIDDEN>},
+		{"NETWORK_IS_CLOUD_AVAILABLE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_CLOUD_AVAILABLE>},
+		{"NETWORK_IS_CLOUD_BACKGROUND_SCRIPT_REQUEST_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_CLOUD_BACKGROUND_SCRIPT_REQUEST_PENDING>},
+		{"NETWORK_IS_CONNECTED_VIA_RELAY", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_CONNECTED_VIA_RELAY>},
+		{"NETWORK_IS_CONNETED_TO_NP_PRESENCE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_CONNETED_TO_NP_PRESENCE>},
+		{"NETWORK_IS_DOOR_NETWORKED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_DOOR_NETWORKED>},
+		{"NETWORK_IS_ENTITY_CONCEALED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_ENTITY_CONCEALED>},
+		{"NETWORK_IS_ENTITY_FADING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_ENTITY_FADING>},
+		{"NETWORK_IS_FINDING_GAMERS", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_FINDING_GAMERS>},
+		{"NETWORK_IS_FRIEND", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND>},
+		{"NETWORK_IS_FRIEND_HANDLE_ONLINE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_HANDLE_ONLINE>},
+		{"NETWORK_IS_FRIEND_INDEX_ONLINE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_INDEX_ONLINE>},
+		{"NETWORK_IS_FRIEND_IN_MULTIPLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_IN_MULTIPLAYER>},
+		{"NETWORK_IS_FRIEND_IN_SAME_TITLE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_IN_SAME_TITLE>},
+		{"NETWORK_IS_FRIEND_ONLINE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_ONLINE>},
+		{"NETWORK_IS_GAMER_BLOCKED_BY_ME", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_GAMER_BLOCKED_BY_ME>},
+		{"NETWORK_IS_GAMER_IN_MY_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_GAMER_IN_MY_SESSION>},
+		{"NETWORK_IS_GAMER_MUTED_BY_ME", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_GAMER_MUTED_BY_ME>},
+		{"NETWORK_IS_GAMER_TALKING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_GAMER_TALKING>},
+		{"NETWORK_IS_GAME_IN_PROGRESS", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_GAME_IN_PROGRESS>},
+		{"NETWORK_IS_GETTING_GAMER_STATUS", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_GETTING_GAMER_STATUS>},
+		{"NETWORK_IS_HANDLE_VALID", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_HANDLE_VALID>},
+		{"NETWORK_IS_HOST", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_HOST>},
+		{"NETWORK_IS_HOST_OF_THIS_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_HOST_OF_THIS_SCRIPT>},
+		{"NETWORK_IS_INACTIVE_PROFILE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_INACTIVE_PROFILE>},
+		{"NETWORK_IS_IN_MP_CUTSCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_IN_MP_CUTSCENE>},
+		{"NETWORK_IS_IN_PLATFORM_PARTY", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_IN_PLATFORM_PARTY>},
+		{"NETWORK_IS_IN_PLATFORM_PARTY_CHAT", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_IN_PLATFORM_PARTY_CHAT>},
+		{"NETWORK_IS_IN_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_IN_SESSION>},
+		{"NETWORK_IS_IN_SPECTATOR_MODE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_IN_SPECTATOR_MODE>},
+		{"NETWORK_IS_IN_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_IN_TRANSITION>},
+		{"NETWORK_IS_IN_TUTORIAL_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_IN_TUTORIAL_SESSION>},
+		{"NETWORK_IS_LOCAL_PLAYER_INVINCIBLE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_LOCAL_PLAYER_INVINCIBLE>},
+		{"NETWORK_IS_LOGGED_IN_TO_PSN", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_LOGGED_IN_TO_PSN>},
+		{"NETWORK_IS_MULTIPLAYER_DISABLED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_MULTIPLAYER_DISABLED>},
+		{"NETWORK_IS_NETWORK_ID_REMOTELY_CONTROLLED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_NETWORK_ID_REMOTELY_CONTROLLED>},
+		{"NETWORK_IS_NP_AVAILABLE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_NP_AVAILABLE>},
+		{"NETWORK_IS_NP_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_NP_PENDING>},
+		{"NETWORK_IS_OFFLINE_INVITE_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_OFFLINE_INVITE_PENDING>},
+		{"NETWORK_IS_PARTICIPANT_ACTIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PARTICIPANT_ACTIVE>},
+		{"NETWORK_IS_PENDING_FRIEND", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PENDING_FRIEND>},
+		{"NETWORK_IS_PLATFORM_SUBSCRIPTION_CHECK_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLATFORM_SUBSCRIPTION_CHECK_PENDING>},
+		{"NETWORK_IS_PLAYER_ACTIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_ACTIVE>},
+		{"NETWORK_IS_PLAYER_A_PARTICIPANT", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_A_PARTICIPANT>},
+		{"NETWORK_IS_PLAYER_A_PARTICIPANT_ON_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_A_PARTICIPANT_ON_SCRIPT>},
+		{"NETWORK_IS_PLAYER_BLOCKED_BY_ME", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_BLOCKED_BY_ME>},
+		{"NETWORK_IS_PLAYER_CONCEALED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_CONCEALED>},
+		{"NETWORK_IS_PLAYER_CONNECTED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_CONNECTED>},
+		{"NETWORK_IS_PLAYER_FADING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_FADING>},
+		{"NETWORK_IS_PLAYER_IN_MP_CUTSCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_IN_MP_CUTSCENE>},
+		{"NETWORK_IS_PLAYER_MUTED_BY_ME", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_MUTED_BY_ME>},
+		{"NETWORK_IS_PLAYER_ON_BLOCKLIST", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_ON_BLOCKLIST>},
+		{"NETWORK_IS_PLAYER_TALKING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_TALKING>},
+		{"NETWORK_IS_PRIVILEGE_CHECK_IN_PROGRESS", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PRIVILEGE_CHECK_IN_PROGRESS>},
+		{"NETWORK_IS_PUSH_TO_TALK_ACTIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_PUSH_TO_TALK_ACTIVE>},
+		{"NETWORK_IS_QUEUING_FOR_SESSION_JOIN", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_QUEUING_FOR_SESSION_JOIN>},
+		{"NETWORK_IS_REFRESHING_ROS_CREDENTIALS", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_REFRESHING_ROS_CREDENTIALS>},
+		{"NETWORK_IS_SCRIPT_ACTIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_SCRIPT_ACTIVE>},
+		{"NETWORK_IS_SCRIPT_ACTIVE_BY_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_SCRIPT_ACTIVE_BY_HASH>},
+		{"NETWORK_IS_SESSION_ACTIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_SESSION_ACTIVE>},
+		{"NETWORK_IS_SESSION_BUSY", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_SESSION_BUSY>},
+		{"NETWORK_IS_SESSION_STARTED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_SESSION_STARTED>},
+		{"NETWORK_IS_SHOWING_SYSTEM_UI_OR_RECENTLY_REQUESTED_UPSELL", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_SHOWING_SYSTEM_UI_OR_RECENTLY_REQUESTED_UPSELL>},
+		{"NETWORK_IS_SIGNED_IN", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_SIGNED_IN>},
+		{"NETWORK_IS_SIGNED_ONLINE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_SIGNED_ONLINE>},
+		{"NETWORK_IS_THREAD_A_NETWORK_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_THREAD_A_NETWORK_SCRIPT>},
+		{"NETWORK_IS_TITLE_UPDATE_REQUIRED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TITLE_UPDATE_REQUIRED>},
+		{"NETWORK_IS_TRANSITION_BUSY", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_BUSY>},
+		{"NETWORK_IS_TRANSITION_CLOSED_CREW", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_CLOSED_CREW>},
+		{"NETWORK_IS_TRANSITION_CLOSED_FRIENDS", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_CLOSED_FRIENDS>},
+		{"NETWORK_IS_TRANSITION_HOST", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_HOST>},
+		{"NETWORK_IS_TRANSITION_HOST_FROM_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_HOST_FROM_HANDLE>},
+		{"NETWORK_IS_TRANSITION_LEAVE_POSTPONED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_LEAVE_POSTPONED>},
+		{"NETWORK_IS_TRANSITION_MATCHMAKING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_MATCHMAKING>},
+		{"NETWORK_IS_TRANSITION_OPEN_TO_MATCHMAKING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_OPEN_TO_MATCHMAKING>},
+		{"NETWORK_IS_TRANSITION_PRIVATE", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_PRIVATE>},
+		{"NETWORK_IS_TRANSITION_SOLO", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_SOLO>},
+		{"NETWORK_IS_TRANSITION_STARTED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_STARTED>},
+		{"NETWORK_IS_TRANSITION_TO_GAME", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_TO_GAME>},
+		{"NETWORK_IS_TRANSITION_VISIBILITY_LOCKED", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_VISIBILITY_LOCKED>},
+		{"NETWORK_IS_TUNABLE_CLOUD_REQUEST_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TUNABLE_CLOUD_REQUEST_PENDING>},
+		{"NETWORK_IS_TUTORIAL_SESSION_CHANGE_PENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_TUTORIAL_SESSION_CHANGE_PENDING>},
+		{"NETWORK_IS_USING_ONLINE_PROMOTION", native_function<LUA_NATIVE_NETWORK_NETWORK_IS_USING_ONLINE_PROMOTION>},
+		{"NETWORK_JOIN_GROUP_ACTIVITY", native_function<LUA_NATIVE_NETWORK_NETWORK_JOIN_GROUP_ACTIVITY>},
+		{"NETWORK_JOIN_PREVIOUSLY_FAILED_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_JOIN_PREVIOUSLY_FAILED_SESSION>},
+		{"NETWORK_JOIN_PREVIOUSLY_FAILED_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_JOIN_PREVIOUSLY_FAILED_TRANSITION>},
+		{"NETWORK_JOIN_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_JOIN_TRANSITION>},
+		{"NETWORK_KEEP_ENTITY_COLLISION_DISABLED_AFTER_ANIM_SCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_KEEP_ENTITY_COLLISION_DISABLED_AFTER_ANIM_SCENE>},
+		{"NETWORK_LAUNCH_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_LAUNCH_TRANSITION>},
+		{"NETWORK_LEAVE_PED_BEHIND_BEFORE_CUTSCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_LEAVE_PED_BEHIND_BEFORE_CUTSCENE>},
+		{"NETWORK_LEAVE_PED_BEHIND_BEFORE_WARP", native_function<LUA_NATIVE_NETWORK_NETWORK_LEAVE_PED_BEHIND_BEFORE_WARP>},
+		{"NETWORK_LEAVE_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_LEAVE_TRANSITION>},
+		{"NETWORK_MARK_AS_PREFERRED_ACTIVITY", native_function<LUA_NATIVE_NETWORK_NETWORK_MARK_AS_PREFERRED_ACTIVITY>},
+		{"NETWORK_MARK_AS_WAITING_ASYNC", native_function<LUA_NATIVE_NETWORK_NETWORK_MARK_AS_WAITING_ASYNC>},
+		{"NETWORK_MARK_TRANSITION_GAMER_AS_FULLY_JOINED", native_function<LUA_NATIVE_NETWORK_NETWORK_MARK_TRANSITION_GAMER_AS_FULLY_JOINED>},
+		{"NETWORK_MEMBER_ID_FROM_GAMER_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_MEMBER_ID_FROM_GAMER_HANDLE>},
+		{"NETWORK_NEED_TO_START_NEW_GAME_BUT_BLOCKED", native_function<LUA_NATIVE_NETWORK_NETWORK_NEED_TO_START_NEW_GAME_BUT_BLOCKED>},
+		{"NETWORK_ON_RETURN_TO_SINGLE_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_ON_RETURN_TO_SINGLE_PLAYER>},
+		{"NETWORK_OPEN_TRANSITION_MATCHMAKING", native_function<LUA_NATIVE_NETWORK_NETWORK_OPEN_TRANSITION_MATCHMAKING>},
+		{"NETWORK_OVERRIDE_CHAT_RESTRICTIONS", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_CHAT_RESTRICTIONS>},
+		{"NETWORK_OVERRIDE_CLOCK_RATE", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_CLOCK_RATE>},
+		{"NETWORK_OVERRIDE_CLOCK_TIME", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_CLOCK_TIME>},
+		{"NETWORK_OVERRIDE_COORDS_AND_HEADING", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_COORDS_AND_HEADING>},
+		{"NETWORK_OVERRIDE_RECEIVE_RESTRICTIONS", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_RECEIVE_RESTRICTIONS>},
+		{"NETWORK_OVERRIDE_RECEIVE_RESTRICTIONS_ALL", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_RECEIVE_RESTRICTIONS_ALL>},
+		{"NETWORK_OVERRIDE_SEND_RESTRICTIONS", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_SEND_RESTRICTIONS>},
+		{"NETWORK_OVERRIDE_SEND_RESTRICTIONS_ALL", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_SEND_RESTRICTIONS_ALL>},
+		{"NETWORK_OVERRIDE_TEAM_RESTRICTIONS", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_TEAM_RESTRICTIONS>},
+		{"NETWORK_OVERRIDE_TRANSITION_CHAT", native_function<LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_TRANSITION_CHAT>},
+		{"NETWORK_PATCH_POST_CUTSCENE_HS4F_TUN_ENT", native_function<LUA_NATIVE_NETWORK_NETWORK_PATCH_POST_CUTSCENE_HS4F_TUN_ENT>},
+		{"NETWORK_PERMISSIONS_HAS_GAMER_RECORD", native_function<LUA_NATIVE_NETWORK_NETWORK_PERMISSIONS_HAS_GAMER_RECORD>},
+		{"NETWORK_PLAYER_GET_CHEATER_REASON", native_function<LUA_NATIVE_NETWORK_NETWORK_PLAYER_GET_CHEATER_REASON>},
+		{"NETWORK_PLAYER_GET_NAME", native_function<LUA_NATIVE_NETWORK_NETWORK_PLAYER_GET_NAME>},
+		{"NETWORK_PLAYER_GET_USERID", native_function<LUA_NATIVE_NETWORK_NETWORK_PLAYER_GET_USERID>},
+		{"NETWORK_PLAYER_HAS_HEADSET", native_function<LUA_NATIVE_NETWORK_NETWORK_PLAYER_HAS_HEADSET>},
+		{"NETWORK_PLAYER_INDEX_IS_CHEATER", native_function<LUA_NATIVE_NETWORK_NETWORK_PLAYER_INDEX_IS_CHEATER>},
+		{"NETWORK_PLAYER_IS_BADSPORT", native_function<LUA_NATIVE_NETWORK_NETWORK_PLAYER_IS_BADSPORT>},
+		{"NETWORK_PLAYER_IS_CHEATER", native_function<LUA_NATIVE_NETWORK_NETWORK_PLAYER_IS_CHEATER>},
+		{"NETWORK_PLAYER_IS_ROCKSTAR_DEV", native_function<LUA_NATIVE_NETWORK_NETWORK_PLAYER_IS_ROCKSTAR_DEV>},
+		{"NETWORK_PREVENT_SCRIPT_HOST_MIGRATION", native_function<LUA_NATIVE_NETWORK_NETWORK_PREVENT_SCRIPT_HOST_MIGRATION>},
+		{"NETWORK_QUERY_RESPAWN_RESULTS", native_function<LUA_NATIVE_NETWORK_NETWORK_QUERY_RESPAWN_RESULTS>},
+		{"NETWORK_QUEUE_GAMER_FOR_STATUS", native_function<LUA_NATIVE_NETWORK_NETWORK_QUEUE_GAMER_FOR_STATUS>},
+		{"NETWORK_QUIT_MP_TO_DESKTOP", native_function<LUA_NATIVE_NETWORK_NETWORK_QUIT_MP_TO_DESKTOP>},
+		{"NETWORK_REGISTER_ENTITY_AS_NETWORKED", native_function<LUA_NATIVE_NETWORK_NETWORK_REGISTER_ENTITY_AS_NETWORKED>},
+		{"NETWORK_REGISTER_HIGH_FREQUENCY_HOST_BROADCAST_VARIABLES", native_function<LUA_NATIVE_NETWORK_NETWORK_REGISTER_HIGH_FREQUENCY_HOST_BROADCAST_VARIABLES>},
+		{"NETWORK_REGISTER_HIGH_FREQUENCY_PLAYER_BROADCAST_VARIABLES", native_function<LUA_NATIVE_NETWORK_NETWORK_REGISTER_HIGH_FREQUENCY_PLAYER_BROADCAST_VARIABLES>},
+		{"NETWORK_REGISTER_HOST_BROADCAST_VARIABLES", native_function<LUA_NATIVE_NETWORK_NETWORK_REGISTER_HOST_BROADCAST_VARIABLES>},
+		{"NETWORK_REGISTER_PLAYER_BROADCAST_VARIABLES", native_function<LUA_NATIVE_NETWORK_NETWORK_REGISTER_PLAYER_BROADCAST_VARIABLES>},
+		{"NETWORK_REMAIN_IN_GAME_CHAT", native_function<LUA_NATIVE_NETWORK_NETWORK_REMAIN_IN_GAME_CHAT>},
+		{"NETWORK_REMOVE_ALL_QUEUED_JOIN_REQUESTS", native_function<LUA_NATIVE_NETWORK_NETWORK_REMOVE_ALL_QUEUED_JOIN_REQUESTS>},
+		{"NETWORK_REMOVE_ALL_TRANSITION_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_REMOVE_ALL_TRANSITION_INVITE>},
+		{"NETWORK_REMOVE_AND_CANCEL_ALL_INVITES", native_function<LUA_NATIVE_NETWORK_NETWORK_REMOVE_AND_CANCEL_ALL_INVITES>},
+		{"NETWORK_REMOVE_AND_CANCEL_ALL_TRANSITION_INVITES", native_function<LUA_NATIVE_NETWORK_NETWORK_REMOVE_AND_CANCEL_ALL_TRANSITION_INVITES>},
+		{"NETWORK_REMOVE_ENTITY_AREA", native_function<LUA_NATIVE_NETWORK_NETWORK_REMOVE_ENTITY_AREA>},
+		{"NETWORK_REMOVE_INVALID_OBJECT_MODEL", native_function<LUA_NATIVE_NETWORK_NETWORK_REMOVE_INVALID_OBJECT_MODEL>},
+		{"NETWORK_REMOVE_PRESENCE_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_REMOVE_PRESENCE_INVITE>},
+		{"NETWORK_REMOVE_TRANSITION_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_REMOVE_TRANSITION_INVITE>},
+		{"NETWORK_REPORT_CODE_TAMPER", native_function<LUA_NATIVE_NETWORK_NETWORK_REPORT_CODE_TAMPER>},
+		{"NETWORK_REQUEST_CLOUD_BACKGROUND_SCRIPTS", native_function<LUA_NATIVE_NETWORK_NETWORK_REQUEST_CLOUD_BACKGROUND_SCRIPTS>},
+		{"NETWORK_REQUEST_CLOUD_TUNABLES", native_function<LUA_NATIVE_NETWORK_NETWORK_REQUEST_CLOUD_TUNABLES>},
+		{"NETWORK_REQUEST_CONTROL_OF_DOOR", native_function<LUA_NATIVE_NETWORK_NETWORK_REQUEST_CONTROL_OF_DOOR>},
+		{"NETWORK_REQUEST_CONTROL_OF_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_REQUEST_CONTROL_OF_ENTITY>},
+		{"NETWORK_REQUEST_CONTROL_OF_NETWORK_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_REQUEST_CONTROL_OF_NETWORK_ID>},
+		{"NETWORK_REQUEST_INVITE_CONFIRMED_EVENT", native_function<LUA_NATIVE_NETWORK_NETWORK_REQUEST_INVITE_CONFIRMED_EVENT>},
+		{"NETWORK_REQUEST_TO_BE_HOST_OF_THIS_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_REQUEST_TO_BE_HOST_OF_THIS_SCRIPT>},
+		{"NETWORK_RESET_BODY_TRACKER", native_function<LUA_NATIVE_NETWORK_NETWORK_RESET_BODY_TRACKER>},
+		{"NETWORK_RESOLVE_PRIVILEGE_USER_CONTENT", native_function<LUA_NATIVE_NETWORK_NETWORK_RESOLVE_PRIVILEGE_USER_CONTENT>},
+		{"NETWORK_RESURRECT_LOCAL_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_RESURRECT_LOCAL_PLAYER>},
+		{"NETWORK_RETAIN_ACTIVITY_GROUP", native_function<LUA_NATIVE_NETWORK_NETWORK_RETAIN_ACTIVITY_GROUP>},
+		{"NETWORK_SEED_RANDOM_NUMBER_GENERATOR", native_function<LUA_NATIVE_NETWORK_NETWORK_SEED_RANDOM_NUMBER_GENERATOR>},
+		{"NETWORK_SEND_IMPORTANT_TRANSITION_INVITE_VIA_PRESENCE", native_function<LUA_NATIVE_NETWORK_NETWORK_SEND_IMPORTANT_TRANSITION_INVITE_VIA_PRESENCE>},
+		{"NETWORK_SEND_INVITE_VIA_PRESENCE", native_function<LUA_NATIVE_NETWORK_NETWORK_SEND_INVITE_VIA_PRESENCE>},
+		{"NETWORK_SEND_QUEUED_JOIN_REQUEST", native_function<LUA_NATIVE_NETWORK_NETWORK_SEND_QUEUED_JOIN_REQUEST>},
+		{"NETWORK_SEND_TEXT_MESSAGE", native_function<LUA_NATIVE_NETWORK_NETWORK_SEND_TEXT_MESSAGE>},
+		{"NETWORK_SEND_TRANSITION_GAMER_INSTRUCTION", native_function<LUA_NATIVE_NETWORK_NETWORK_SEND_TRANSITION_GAMER_INSTRUCTION>},
+		{"NETWORK_SEND_TRANSITION_INVITE_VIA_PRESENCE", native_function<LUA_NATIVE_NETWORK_NETWORK_SEND_TRANSITION_INVITE_VIA_PRESENCE>},
+		{"NETWORK_SESSION_ADD_ACTIVE_MATCHMAKING_GROUP", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_ADD_ACTIVE_MATCHMAKING_GROUP>},
+		{"NETWORK_SESSION_BLOCK_JOIN_REQUESTS", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_BLOCK_JOIN_REQUESTS>},
+		{"NETWORK_SESSION_CANCEL_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_CANCEL_INVITE>},
+		{"NETWORK_SESSION_CHANGE_SLOTS", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_CHANGE_SLOTS>},
+		{"NETWORK_SESSION_DO_ACTIVITY_QUICKMATCH", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_DO_ACTIVITY_QUICKMATCH>},
+		{"NETWORK_SESSION_DO_CREW_MATCHMAKING", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_DO_CREW_MATCHMAKING>},
+		{"NETWORK_SESSION_DO_FREEROAM_QUICKMATCH", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_DO_FREEROAM_QUICKMATCH>},
+		{"NETWORK_SESSION_DO_FRIEND_MATCHMAKING", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_DO_FRIEND_MATCHMAKING>},
+		{"NETWORK_SESSION_END", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_END>},
+		{"NETWORK_SESSION_FORCE_CANCEL_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_FORCE_CANCEL_INVITE>},
+		{"NETWORK_SESSION_GET_HOST_AIM_PREFERENCE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_HOST_AIM_PREFERENCE>},
+		{"NETWORK_SESSION_GET_INVITER", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_INVITER>},
+		{"NETWORK_SESSION_GET_KICK_VOTE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_KICK_VOTE>},
+		{"NETWORK_SESSION_GET_MATCHMAKING_GROUP_FREE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_MATCHMAKING_GROUP_FREE>},
+		{"NETWORK_SESSION_GET_PRIVATE_SLOTS", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_PRIVATE_SLOTS>},
+		{"NETWORK_SESSION_GET_UNIQUE_CREW_LIMIT", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_UNIQUE_CREW_LIMIT>},
+		{"NETWORK_SESSION_HOST", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_HOST>},
+		{"NETWORK_SESSION_HOST_CLOSED", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_HOST_CLOSED>},
+		{"NETWORK_SESSION_HOST_FRIENDS_ONLY", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_HOST_FRIENDS_ONLY>},
+		{"NETWORK_SESSION_HOST_SINGLE_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_HOST_SINGLE_PLAYER>},
+		{"NETWORK_SESSION_IS_AWAITING_INVITE_RESPONSE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_AWAITING_INVITE_RESPONSE>},
+		{"NETWORK_SESSION_IS_CLOSED_CREW", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_CLOSED_CREW>},
+		{"NETWORK_SESSION_IS_CLOSED_FRIENDS", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_CLOSED_FRIENDS>},
+		{"NETWORK_SESSION_IS_DISPLAYING_INVITE_CONFIRMATION", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_DISPLAYING_INVITE_CONFIRMATION>},
+		{"NETWORK_SESSION_IS_IN_VOICE_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_IN_VOICE_SESSION>},
+		{"NETWORK_SESSION_IS_PRIVATE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_PRIVATE>},
+		{"NETWORK_SESSION_IS_SOLO", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_SOLO>},
+		{"NETWORK_SESSION_IS_VISIBLE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_VISIBLE>},
+		{"NETWORK_SESSION_IS_VOICE_SESSION_ACTIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_VOICE_SESSION_ACTIVE>},
+		{"NETWORK_SESSION_IS_VOICE_SESSION_BUSY", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_VOICE_SESSION_BUSY>},
+		{"NETWORK_SESSION_JOIN_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_JOIN_INVITE>},
+		{"NETWORK_SESSION_KICK_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_KICK_PLAYER>},
+		{"NETWORK_SESSION_LEAVE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_LEAVE>},
+		{"NETWORK_SESSION_LEAVE_INCLUDING_REASON_", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_LEAVE_INCLUDING_REASON_>},
+		{"NETWORK_SESSION_LEAVE_SINGLE_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_LEAVE_SINGLE_PLAYER>},
+		{"NETWORK_SESSION_MARK_VISIBLE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_MARK_VISIBLE>},
+		{"NETWORK_SESSION_RESERVE_SLOTS_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_RESERVE_SLOTS_TRANSITION>},
+		{"NETWORK_SESSION_SET_CREW_LIMIT_MAX_MEMBERS_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_CREW_LIMIT_MAX_MEMBERS_TRANSITION>},
+		{"NETWORK_SESSION_SET_GAMEMODE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_GAMEMODE>},
+		{"NETWORK_SESSION_SET_MATCHMAKING_GROUP", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_MATCHMAKING_GROUP>},
+		{"NETWORK_SESSION_SET_MATCHMAKING_GROUP_MAX", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_MATCHMAKING_GROUP_MAX>},
+		{"NETWORK_SESSION_SET_MATCHMAKING_MENTAL_STATE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_MATCHMAKING_MENTAL_STATE>},
+		{"NETWORK_SESSION_SET_MATCHMAKING_PROPERTY_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_MATCHMAKING_PROPERTY_ID>},
+		{"NETWORK_SESSION_SET_NUM_BOSSES", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_NUM_BOSSES>},
+		{"NETWORK_SESSION_SET_SCRIPT_VALIDATE_JOIN", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_SCRIPT_VALIDATE_JOIN>},
+		{"NETWORK_SESSION_SET_UNIQUE_CREW_LIMIT", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_UNIQUE_CREW_LIMIT>},
+		{"NETWORK_SESSION_SET_UNIQUE_CREW_LIMIT_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_UNIQUE_CREW_LIMIT_TRANSITION>},
+		{"NETWORK_SESSION_SET_UNIQUE_CREW_ONLY_CREWS_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_UNIQUE_CREW_ONLY_CREWS_TRANSITION>},
+		{"NETWORK_SESSION_VALIDATE_JOIN", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_VALIDATE_JOIN>},
+		{"NETWORK_SESSION_VOICE_CONNECT_TO_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_CONNECT_TO_PLAYER>},
+		{"NETWORK_SESSION_VOICE_HOST", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_HOST>},
+		{"NETWORK_SESSION_VOICE_LEAVE", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_LEAVE>},
+		{"NETWORK_SESSION_VOICE_RESPOND_TO_REQUEST", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_RESPOND_TO_REQUEST>},
+		{"NETWORK_SESSION_VOICE_SET_TIMEOUT", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_SET_TIMEOUT>},
+		{"NETWORK_SESSION_WAS_INVITED", native_function<LUA_NATIVE_NETWORK_NETWORK_SESSION_WAS_INVITED>},
+		{"NETWORK_SET_ACTIVITY_PLAYER_MAX", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_ACTIVITY_PLAYER_MAX>},
+		{"NETWORK_SET_ACTIVITY_SPECTATOR", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_ACTIVITY_SPECTATOR>},
+		{"NETWORK_SET_ACTIVITY_SPECTATOR_MAX", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_ACTIVITY_SPECTATOR_MAX>},
+		{"NETWORK_SET_ANTAGONISTIC_TO_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_ANTAGONISTIC_TO_PLAYER>},
+		{"NETWORK_SET_ATTRIBUTE_DAMAGE_TO_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_ATTRIBUTE_DAMAGE_TO_PLAYER>},
+		{"NETWORK_SET_CAN_RECEIVE_RS_INVITES", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_CAN_RECEIVE_RS_INVITES>},
+		{"NETWORK_SET_COMMUNICATION_GROUP_FLAGS_", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_COMMUNICATION_GROUP_FLAGS_>},
+		{"NETWORK_SET_CURRENTLY_SELECTED_GAMER_HANDLE_FROM_INVITE_MENU", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_CURRENTLY_SELECTED_GAMER_HANDLE_FROM_INVITE_MENU>},
+		{"NETWORK_SET_CURRENT_CHAT_OPTION", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_CURRENT_CHAT_OPTION>},
+		{"NETWORK_SET_CURRENT_DATA_MANAGER_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_CURRENT_DATA_MANAGER_HANDLE>},
+		{"NETWORK_SET_CURRENT_PUBLIC_CONTENT_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_CURRENT_PUBLIC_CONTENT_ID>},
+		{"NETWORK_SET_CURRENT_SPAWN_LOCATION_OPTION", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_CURRENT_SPAWN_LOCATION_OPTION>},
+		{"NETWORK_SET_CUSTOM_ARENA_BALL_PARAMS", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_CUSTOM_ARENA_BALL_PARAMS>},
+		{"NETWORK_SET_DO_NOT_LAUNCH_FROM_JOIN_AS_MIGRATED_HOST", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_DO_NOT_LAUNCH_FROM_JOIN_AS_MIGRATED_HOST>},
+		{"NETWORK_SET_ENTITY_CAN_BLEND", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_ENTITY_CAN_BLEND>},
+		{"NETWORK_SET_ENTITY_ONLY_EXISTS_FOR_PARTICIPANTS", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_ENTITY_ONLY_EXISTS_FOR_PARTICIPANTS>},
+		{"NETWORK_SET_FRIENDLY_FIRE_OPTION", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_FRIENDLY_FIRE_OPTION>},
+		{"NETWORK_SET_GAMER_INVITED_TO_TRANSITION", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_GAMER_INVITED_TO_TRANSITION>},
+		{"NETWORK_SET_IGNORE_SPECTATOR_CHAT_LIMITS_SAME_TEAM", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_IGNORE_SPECTATOR_CHAT_LIMITS_SAME_TEAM>},
+		{"NETWORK_SET_INVITE_FAILED_MESSAGE_FOR_INVITE_MENU", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_INVITE_FAILED_MESSAGE_FOR_INVITE_MENU>},
+		{"NETWORK_SET_INVITE_ON_CALL_FOR_INVITE_MENU", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_INVITE_ON_CALL_FOR_INVITE_MENU>},
+		{"NETWORK_SET_IN_FREE_CAM_MODE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_IN_FREE_CAM_MODE>},
+		{"NETWORK_SET_IN_MP_CUTSCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_IN_MP_CUTSCENE>},
+		{"NETWORK_SET_IN_PROGRESS_FINISH_TIME", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_IN_PROGRESS_FINISH_TIME>},
+		{"NETWORK_SET_IN_SPECTATOR_MODE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_IN_SPECTATOR_MODE>},
+		{"NETWORK_SET_IN_SPECTATOR_MODE_EXTENDED", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_IN_SPECTATOR_MODE_EXTENDED>},
+		{"NETWORK_SET_LOCAL_PLAYER_INVINCIBLE_TIME", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_LOCAL_PLAYER_INVINCIBLE_TIME>},
+		{"NETWORK_SET_LOCAL_PLAYER_SYNC_LOOK_AT", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_LOCAL_PLAYER_SYNC_LOOK_AT>},
+		{"NETWORK_SET_LOOK_AT_TALKERS", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_LOOK_AT_TALKERS>},
+		{"NETWORK_SET_MINIMUM_RANK_FOR_MISSION", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_MINIMUM_RANK_FOR_MISSION>},
+		{"NETWORK_SET_MISSION_FINISHED", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_MISSION_FINISHED>},
+		{"NETWORK_SET_NO_LONGER_NEEDED", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_NO_LONGER_NEEDED>},
+		{"NETWORK_SET_NO_SPECTATOR_CHAT", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_NO_SPECTATOR_CHAT>},
+		{"NETWORK_SET_OBJECT_CAN_BLEND_WHEN_FIXED", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_OBJECT_CAN_BLEND_WHEN_FIXED>},
+		{"NETWORK_SET_OBJECT_SCOPE_DISTANCE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_OBJECT_SCOPE_DISTANCE>},
+		{"NETWORK_SET_OVERRIDE_SPECTATOR_MODE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_OVERRIDE_SPECTATOR_MODE>},
+		{"NETWORK_SET_OVERRIDE_TUTORIAL_SESSION_CHAT", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_OVERRIDE_TUTORIAL_SESSION_CHAT>},
+		{"NETWORK_SET_PLAYER_IS_PASSIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_PLAYER_IS_PASSIVE>},
+		{"NETWORK_SET_PLAYER_MENTAL_STATE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_PLAYER_MENTAL_STATE>},
+		{"NETWORK_SET_PRESENCE_SESSION_INVITES_BLOCKED", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_PRESENCE_SESSION_INVITES_BLOCKED>},
+		{"NETWORK_SET_PRIVILEGE_CHECK_RESULT_NOT_NEEDED", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_PRIVILEGE_CHECK_RESULT_NOT_NEEDED>},
+		{"NETWORK_SET_PROPERTY_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_PROPERTY_ID>},
+		{"NETWORK_SET_PROXIMITY_AFFECTS_TEAM", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_PROXIMITY_AFFECTS_TEAM>},
+		{"NETWORK_SET_RICH_PRESENCE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_RICH_PRESENCE>},
+		{"NETWORK_SET_RICH_PRESENCE_STRING", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_RICH_PRESENCE_STRING>},
+		{"NETWORK_SET_SAME_TEAM_AS_LOCAL_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_SAME_TEAM_AS_LOCAL_PLAYER>},
+		{"NETWORK_SET_SCRIPT_AUTOMUTED", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_SCRIPT_AUTOMUTED>},
+		{"NETWORK_SET_SCRIPT_CONTROLLING_TEAMS", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_SCRIPT_CONTROLLING_TEAMS>},
+		{"NETWORK_SET_SCRIPT_READY_FOR_EVENTS", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_SCRIPT_READY_FOR_EVENTS>},
+		{"NETWORK_SET_SPECTATOR_TO_NON_SPECTATOR_TEXT_CHAT", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_SPECTATOR_TO_NON_SPECTATOR_TEXT_CHAT>},
+		{"NETWORK_SET_TALKER_PROXIMITY", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_TALKER_PROXIMITY>},
+		{"NETWORK_SET_TASK_CUTSCENE_INSCOPE_MULTIPLER", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_TASK_CUTSCENE_INSCOPE_MULTIPLER>},
+		{"NETWORK_SET_TEAM_ONLY_CHAT", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_TEAM_ONLY_CHAT>},
+		{"NETWORK_SET_THIS_SCRIPT_IS_NETWORK_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_THIS_SCRIPT_IS_NETWORK_SCRIPT>},
+		{"NETWORK_SET_TRANSITION_ACTIVITY_ID", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_TRANSITION_ACTIVITY_ID>},
+		{"NETWORK_SET_TRANSITION_CREATOR_HANDLE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_TRANSITION_CREATOR_HANDLE>},
+		{"NETWORK_SET_TRANSITION_VISIBILITY_LOCK", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_TRANSITION_VISIBILITY_LOCK>},
+		{"NETWORK_SET_VEHICLE_DRIVEN_IN_TEST_DRIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_VEHICLE_DRIVEN_IN_TEST_DRIVE>},
+		{"NETWORK_SET_VEHICLE_DRIVEN_LOCATION", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_VEHICLE_DRIVEN_LOCATION>},
+		{"NETWORK_SET_VOICE_ACTIVE", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_VOICE_ACTIVE>},
+		{"NETWORK_SET_VOICE_CHANNEL", native_function<LUA_NATIVE_NETWORK_NETWORK_SET_VOICE_CHANNEL>},
+		{"NETWORK_SHOULD_SHOW_PROMOTION_ALERT_SCREEN", native_function<LUA_NATIVE_NETWORK_NETWORK_SHOULD_SHOW_PROMOTION_ALERT_SCREEN>},
+		{"NETWORK_SHOULD_SHOW_STRICT_NAT_WARNING", native_function<LUA_NATIVE_NETWORK_NETWORK_SHOULD_SHOW_STRICT_NAT_WARNING>},
+		{"NETWORK_SHOW_ACCOUNT_UPGRADE_UI", native_function<LUA_NATIVE_NETWORK_NETWORK_SHOW_ACCOUNT_UPGRADE_UI>},
+		{"NETWORK_SHOW_CHAT_RESTRICTION_MSC", native_function<LUA_NATIVE_NETWORK_NETWORK_SHOW_CHAT_RESTRICTION_MSC>},
+		{"NETWORK_SHOW_PROFILE_UI", native_function<LUA_NATIVE_NETWORK_NETWORK_SHOW_PROFILE_UI>},
+		{"NETWORK_SHOW_PSN_UGC_RESTRICTION", native_function<LUA_NATIVE_NETWORK_NETWORK_SHOW_PSN_UGC_RESTRICTION>},
+		{"NETWORK_SKIP_RADIO_RESET_NEXT_CLOSE", native_function<LUA_NATIVE_NETWORK_NETWORK_SKIP_RADIO_RESET_NEXT_CLOSE>},
+		{"NETWORK_SKIP_RADIO_RESET_NEXT_OPEN", native_function<LUA_NATIVE_NETWORK_NETWORK_SKIP_RADIO_RESET_NEXT_OPEN>},
+		{"NETWORK_SKIP_RADIO_WARNING", native_function<LUA_NATIVE_NETWORK_NETWORK_SKIP_RADIO_WARNING>},
+		{"NETWORK_START_COMMUNICATION_PERMISSIONS_CHECK", native_function<LUA_NATIVE_NETWORK_NETWORK_START_COMMUNICATION_PERMISSIONS_CHECK>},
+		{"NETWORK_START_RESPAWN_SEARCH_FOR_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_START_RESPAWN_SEARCH_FOR_PLAYER>},
+		{"NETWORK_START_RESPAWN_SEARCH_IN_ANGLED_AREA_FOR_PLAYER", native_function<LUA_NATIVE_NETWORK_NETWORK_START_RESPAWN_SEARCH_IN_ANGLED_AREA_FOR_PLAYER>},
+		{"NETWORK_START_SOLO_TUTORIAL_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_START_SOLO_TUTORIAL_SESSION>},
+		{"NETWORK_START_SYNCHRONISED_SCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_START_SYNCHRONISED_SCENE>},
+		{"NETWORK_START_USER_CONTENT_PERMISSIONS_CHECK", native_function<LUA_NATIVE_NETWORK_NETWORK_START_USER_CONTENT_PERMISSIONS_CHECK>},
+		{"NETWORK_STOP_SYNCHRONISED_SCENE", native_function<LUA_NATIVE_NETWORK_NETWORK_STOP_SYNCHRONISED_SCENE>},
+		{"NETWORK_STORE_INVITE_THROUGH_RESTART", native_function<LUA_NATIVE_NETWORK_NETWORK_STORE_INVITE_THROUGH_RESTART>},
+		{"NETWORK_SUPPRESS_INVITE", native_function<LUA_NATIVE_NETWORK_NETWORK_SUPPRESS_INVITE>},
+		{"NETWORK_TEXT_CHAT_IS_TYPING", native_function<LUA_NATIVE_NETWORK_NETWORK_TEXT_CHAT_IS_TYPING>},
+		{"NETWORK_TRANSITION_ADD_STAGE", native_function<LUA_NATIVE_NETWORK_NETWORK_TRANSITION_ADD_STAGE>},
+		{"NETWORK_TRANSITION_BLOCK_JOIN_REQUESTS", native_function<LUA_NATIVE_NETWORK_NETWORK_TRANSITION_BLOCK_JOIN_REQUESTS>},
+		{"NETWORK_TRANSITION_FINISH", native_function<LUA_NATIVE_NETWORK_NETWORK_TRANSITION_FINISH>},
+		{"NETWORK_TRANSITION_SET_ACTIVITY_ISLAND", native_function<LUA_NATIVE_NETWORK_NETWORK_TRANSITION_SET_ACTIVITY_ISLAND>},
+		{"NETWORK_TRANSITION_SET_CONTENT_CREATOR", native_function<LUA_NATIVE_NETWORK_NETWORK_TRANSITION_SET_CONTENT_CREATOR>},
+		{"NETWORK_TRANSITION_SET_IN_PROGRESS", native_function<LUA_NATIVE_NETWORK_NETWORK_TRANSITION_SET_IN_PROGRESS>},
+		{"NETWORK_TRANSITION_START", native_function<LUA_NATIVE_NETWORK_NETWORK_TRANSITION_START>},
+		{"NETWORK_TRIGGER_DAMAGE_EVENT_FOR_ZERO_DAMAGE", native_function<LUA_NATIVE_NETWORK_NETWORK_TRIGGER_DAMAGE_EVENT_FOR_ZERO_DAMAGE>},
+		{"NETWORK_TRIGGER_DAMAGE_EVENT_FOR_ZERO_WEAPON_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_TRIGGER_DAMAGE_EVENT_FOR_ZERO_WEAPON_HASH>},
+		{"NETWORK_TRY_ACCESS_TUNABLE_BOOL_HASH", native_function<LUA_NATIVE_NETWORK_NETWORK_TRY_ACCESS_TUNABLE_BOOL_HASH>},
+		{"NETWORK_TRY_TO_SET_THIS_SCRIPT_IS_NETWORK_SCRIPT", native_function<LUA_NATIVE_NETWORK_NETWORK_TRY_TO_SET_THIS_SCRIPT_IS_NETWORK_SCRIPT>},
+		{"NETWORK_UGC_NAV", native_function<LUA_NATIVE_NETWORK_NETWORK_UGC_NAV>},
+		{"NETWORK_UNREGISTER_NETWORKED_ENTITY", native_function<LUA_NATIVE_NETWORK_NETWORK_UNREGISTER_NETWORKED_ENTITY>},
+		{"NETWORK_USE_HIGH_PRECISION_BLENDING", native_function<LUA_NATIVE_NETWORK_NETWORK_USE_HIGH_PRECISION_BLENDING>},
+		{"NETWORK_USE_LOGARITHMIC_BLENDING_THIS_FRAME", native_function<LUA_NATIVE_NETWORK_NETWORK_USE_LOGARITHMIC_BLENDING_THIS_FRAME>},
+		{"NETWORK_WAITING_POP_CLEAR_TUTORIAL_SESSION", native_function<LUA_NATIVE_NETWORK_NETWORK_WAITING_POP_CLEAR_TUTORIAL_SESSION>},
+		{"NETWORK_WAS_GAME_SUSPENDED", native_function<LUA_NATIVE_NETWORK_NETWORK_WAS_GAME_SUSPENDED>},
+		{"NET_TO_ENT", native_function<LUA_NATIVE_NETWORK_NET_TO_ENT>},
+		{"NET_TO_OBJ", native_function<LUA_NATIVE_NETWORK_NET_TO_OBJ>},
+		{"NET_TO_PED", native_function<LUA_NATIVE_NETWORK_NET_TO_PED>},
+		{"NET_TO_VEH", native_function<LUA_NATIVE_NETWORK_NET_TO_VEH>},
+		{"OBJ_TO_NET", native_function<LUA_NATIVE_NETWORK_OBJ_TO_NET>},
+		{"OPEN_COMMERCE_STORE", native_function<LUA_NATIVE_NETWORK_OPEN_COMMERCE_STORE>},
+		{"PARTICIPANT_ID", native_function<LUA_NATIVE_NETWORK_PARTICIPANT_ID>},
+		{"PARTICIPANT_ID_TO_INT", native_function<LUA_NATIVE_NETWORK_PARTICIPANT_ID_TO_INT>},
+		{"PED_TO_NET", native_function<LUA_NATIVE_NETWORK_PED_TO_NET>},
+		{"REFRESH_PLAYER_LIST_STATS", native_function<LUA_NATIVE_NETWORK_REFRESH_PLAYER_LIST_STATS>},
+		{"RELEASE_ALL_COMMERCE_ITEM_IMAGES", native_function<LUA_NATIVE_NETWORK_RELEASE_ALL_COMMERCE_ITEM_IMAGES>},
+		{"REMOTE_CHEATER_PLAYER_DETECTED", native_function<LUA_NATIVE_NETWORK_REMOTE_CHEATER_PLAYER_DETECTED>},
+		{"REMOVE_ALL_STICKY_BOMBS_FROM_ENTITY", native_function<LUA_NATIVE_NETWORK_REMOVE_ALL_STICKY_BOMBS_FROM_ENTITY>},
+		{"REQUEST_COMMERCE_ITEM_IMAGE", native_function<LUA_NATIVE_NETWORK_REQUEST_COMMERCE_ITEM_IMAGE>},
+		{"RESERVE_LOCAL_NETWORK_MISSION_OBJECTS", native_function<LUA_NATIVE_NETWORK_RESERVE_LOCAL_NETWORK_MISSION_OBJECTS>},
+		{"RESERVE_LOCAL_NETWORK_MISSION_PEDS", native_function<LUA_NATIVE_NETWORK_RESERVE_LOCAL_NETWORK_MISSION_PEDS>},
+		{"RESERVE_LOCAL_NETWORK_MISSION_VEHICLES", native_function<LUA_NATIVE_NETWORK_RESERVE_LOCAL_NETWORK_MISSION_VEHICLES>},
+		{"RESERVE_NETWORK_MISSION_OBJECTS", native_function<LUA_NATIVE_NETWORK_RESERVE_NETWORK_MISSION_OBJECTS>},
+		{"RESERVE_NETWORK_MISSION_PEDS", native_function<LUA_NATIVE_NETWORK_RESERVE_NETWORK_MISSION_PEDS>},
+		{"RESERVE_NETWORK_MISSION_VEHICLES", native_function<LUA_NATIVE_NETWORK_RESERVE_NETWORK_MISSION_VEHICLES>},
+		{"RESET_GHOST_ALPHA", native_function<LUA_NATIVE_NETWORK_RESET_GHOST_ALPHA>},
+		{"RESET_STORE_NETWORK_GAME_TRACKING", native_function<LUA_NATIVE_NETWORK_RESET_STORE_NETWORK_GAME_TRACKING>},
+		{"SET_ENTITY_GHOSTED_FOR_GHOST_PLAYERS", native_function<LUA_NATIVE_NETWORK_SET_ENTITY_GHOSTED_FOR_GHOST_PLAYERS>},
+		{"SET_ENTITY_LOCALLY_INVISIBLE", native_function<LUA_NATIVE_NETWORK_SET_ENTITY_LOCALLY_INVISIBLE>},
+		{"SET_ENTITY_LOCALLY_VISIBLE", native_function<LUA_NATIVE_NETWORK_SET_ENTITY_LOCALLY_VISIBLE>},
+		{"SET_ENTITY_VISIBLE_IN_CUTSCENE", native_function<LUA_NATIVE_NETWORK_SET_ENTITY_VISIBLE_IN_CUTSCENE>},
+		{"SET_GHOST_ALPHA", native_function<LUA_NATIVE_NETWORK_SET_GHOST_ALPHA>},
+		{"SET_INVERT_GHOSTING", native_function<LUA_NATIVE_NETWORK_SET_INVERT_GHOSTING>},
+		{"SET_LAST_VIEWED_SHOP_ITEM", native_function<LUA_NATIVE_NETWORK_SET_LAST_VIEWED_SHOP_ITEM>},
+		{"SET_LOCAL_PLAYER_AS_GHOST", native_function<LUA_NATIVE_NETWORK_SET_LOCAL_PLAYER_AS_GHOST>},
+		{"SET_LOCAL_PLAYER_INVISIBLE_LOCALLY", native_function<LUA_NATIVE_NETWORK_SET_LOCAL_PLAYER_INVISIBLE_LOCALLY>},
+		{"SET_LOCAL_PLAYER_VISIBLE_IN_CUTSCENE", native_function<LUA_NATIVE_NETWORK_SET_LOCAL_PLAYER_VISIBLE_IN_CUTSCENE>},
+		{"SET_LOCAL_PLAYER_VISIBLE_LOCALLY", native_function<LUA_NATIVE_NETWORK_SET_LOCAL_PLAYER_VISIBLE_LOCALLY>},
+		{"SET_NETWORK_CUTSCENE_ENTITIES", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_CUTSCENE_ENTITIES>},
+		{"SET_NETWORK_ENABLE_HIGH_SPEED_EDGE_FALL_DETECTION", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ENABLE_HIGH_SPEED_EDGE_FALL_DETECTION>},
+		{"SET_NETWORK_ID_ALWAYS_EXISTS_FOR_PLAYER", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ID_ALWAYS_EXISTS_FOR_PLAYER>},
+		{"SET_NETWORK_ID_CAN_BE_REASSIGNED", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ID_CAN_BE_REASSIGNED>},
+		{"SET_NETWORK_ID_CAN_MIGRATE", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ID_CAN_MIGRATE>},
+		{"SET_NETWORK_ID_EXISTS_ON_ALL_MACHINES", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ID_EXISTS_ON_ALL_MACHINES>},
+		{"SET_NETWORK_ID_PASS_CONTROL_IN_TUTORIAL", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ID_PASS_CONTROL_IN_TUTORIAL>},
+		{"SET_NETWORK_ID_VISIBLE_IN_CUTSCENE", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ID_VISIBLE_IN_CUTSCENE>},
+		{"SET_NETWORK_ID_VISIBLE_IN_CUTSCENE_HACK", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ID_VISIBLE_IN_CUTSCENE_HACK>},
+		{"SET_NETWORK_ID_VISIBLE_IN_CUTSCENE_REMAIN_HACK", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_ID_VISIBLE_IN_CUTSCENE_REMAIN_HACK>},
+		{"SET_NETWORK_VEHICLE_AS_GHOST", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_VEHICLE_AS_GHOST>},
+		{"SET_NETWORK_VEHICLE_MAX_POSITION_DELTA_MULTIPLIER", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_VEHICLE_MAX_POSITION_DELTA_MULTIPLIER>},
+		{"SET_NETWORK_VEHICLE_RESPOT_TIMER", native_function<LUA_NATIVE_NETWORK_SET_NETWORK_VEHICLE_RESPOT_TIMER>},
+		{"SET_NON_PARTICIPANTS_OF_THIS_SCRIPT_AS_GHOSTS", native_function<LUA_NATIVE_NETWORK_SET_NON_PARTICIPANTS_OF_THIS_SCRIPT_AS_GHOSTS>},
+		{"SET_PLAYER_INVISIBLE_LOCALLY", native_function<LUA_NATIVE_NETWORK_SET_PLAYER_INVISIBLE_LOCALLY>},
+		{"SET_PLAYER_VISIBLE_LOCALLY", native_function<LUA_NATIVE_NETWORK_SET_PLAYER_VISIBLE_LOCALLY>},
+		{"SET_REMOTE_PLAYER_AS_GHOST", native_function<LUA_NATIVE_NETWORK_SET_REMOTE_PLAYER_AS_GHOST>},
+		{"SET_REMOTE_PLAYER_VISIBLE_IN_CUTSCENE", native_function<LUA_NATIVE_NETWORK_SET_REMOTE_PLAYER_VISIBLE_IN_CUTSCENE>},
+		{"SET_STORE_ENABLED", native_function<LUA_NATIVE_NETWORK_SET_STORE_ENABLED>},
+		{"SHUTDOWN_AND_LAUNCH_SINGLE_PLAYER_GAME", native_function<LUA_NATIVE_NETWORK_SHUTDOWN_AND_LAUNCH_SINGLE_PLAYER_GAME>},
+		{"SHUTDOWN_AND_LOAD_MOST_RECENT_SAVE", native_function<LUA_NATIVE_NETWORK_SHUTDOWN_AND_LOAD_MOST_RECENT_SAVE>},
+		{"TEXTURE_DOWNLOAD_GET_NAME", native_function<LUA_NATIVE_NETWORK_TEXTURE_DOWNLOAD_GET_NAME>},
+		{"TEXTURE_DOWNLOAD_HAS_FAILED", native_function<LUA_NATIVE_NETWORK_TEXTURE_DOWNLOAD_HAS_FAILED>},
+		{"TEXTURE_DOWNLOAD_RELEASE", native_function<LUA_NATIVE_NETWORK_TEXTURE_DOWNLOAD_RELEASE>},
+		{"TEXTURE_DOWNLOAD_REQUEST", native_function<LUA_NATIVE_NETWORK_TEXTURE_DOWNLOAD_REQUEST>},
+		{"TITLE_TEXTURE_DOWNLOAD_REQUEST", native_function<LUA_NATIVE_NETWORK_TITLE_TEXTURE_DOWNLOAD_REQUEST>},
+		{"TRIGGER_COMMERCE_DATA_FETCH", native_function<LUA_NATIVE_NETWORK_TRIGGER_COMMERCE_DATA_FETCH>},
+		{"UGC_CANCEL_QUERY", native_function<LUA_NATIVE_NETWORK_UGC_CANCEL_QUERY>},
+		{"UGC_CLEAR_CREATE_RESULT", native_function<LUA_NATIVE_NETWORK_UGC_CLEAR_CREATE_RESULT>},
+		{"UGC_CLEAR_MODIFY_RESULT", native_function<LUA_NATIVE_NETWORK_UGC_CLEAR_MODIFY_RESULT>},
+		{"UGC_CLEAR_OFFLINE_QUERY", native_function<LUA_NATIVE_NETWORK_UGC_CLEAR_OFFLINE_QUERY>},
+		{"UGC_CLEAR_QUERY_RESULTS", native_function<LUA_NATIVE_NETWORK_UGC_CLEAR_QUERY_RESULTS>},
+		{"UGC_COPY_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_COPY_CONTENT>},
+		{"UGC_DID_CREATE_SUCCEED", native_function<LUA_NATIVE_NETWORK_UGC_DID_CREATE_SUCCEED>},
+		{"UGC_DID_DESCRIPTION_REQUEST_SUCCEED", native_function<LUA_NATIVE_NETWORK_UGC_DID_DESCRIPTION_REQUEST_SUCCEED>},
+		{"UGC_DID_GET_SUCCEED", native_function<LUA_NATIVE_NETWORK_UGC_DID_GET_SUCCEED>},
+		{"UGC_DID_MODIFY_SUCCEED", native_function<LUA_NATIVE_NETWORK_UGC_DID_MODIFY_SUCCEED>},
+		{"UGC_DID_QUERY_CREATORS_SUCCEED", native_function<LUA_NATIVE_NETWORK_UGC_DID_QUERY_CREATORS_SUCCEED>},
+		{"UGC_GET_BOOKMARKED_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_GET_BOOKMARKED_CONTENT>},
+		{"UGC_GET_CACHED_DESCRIPTION", native_function<LUA_NATIVE_NETWORK_UGC_GET_CACHED_DESCRIPTION>},
+		{"UGC_GET_CONTENT_CATEGORY", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_CATEGORY>},
+		{"UGC_GET_CONTENT_CREATED_BY_LOCAL_PLAYER", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_CREATED_BY_LOCAL_PLAYER>},
+		{"UGC_GET_CONTENT_CREATOR_GAMER_HANDLE", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_CREATOR_GAMER_HANDLE>},
+		{"UGC_GET_CONTENT_DESCRIPTION_HASH", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_DESCRIPTION_HASH>},
+		{"UGC_GET_CONTENT_FILE_VERSION", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_FILE_VERSION>},
+		{"UGC_GET_CONTENT_HASH", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HASH>},
+		{"UGC_GET_CONTENT_HAS_HI_RES_PHOTO", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HAS_HI_RES_PHOTO>},
+		{"UGC_GET_CONTENT_HAS_LO_RES_PHOTO", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HAS_LO_RES_PHOTO>},
+		{"UGC_GET_CONTENT_HAS_PLAYER_BOOKMARKED", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HAS_PLAYER_BOOKMARKED>},
+		{"UGC_GET_CONTENT_HAS_PLAYER_RECORD", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HAS_PLAYER_RECORD>},
+		{"UGC_GET_CONTENT_ID", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_ID>},
+		{"UGC_GET_CONTENT_IS_PUBLISHED", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_IS_PUBLISHED>},
+		{"UGC_GET_CONTENT_IS_USING_SC_NICKNAME", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_IS_USING_SC_NICKNAME>},
+		{"UGC_GET_CONTENT_IS_VERIFIED", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_IS_VERIFIED>},
+		{"UGC_GET_CONTENT_LANGUAGE", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_LANGUAGE>},
+		{"UGC_GET_CONTENT_NAME", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_NAME>},
+		{"UGC_GET_CONTENT_NUM", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_NUM>},
+		{"UGC_GET_CONTENT_PATH", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_PATH>},
+		{"UGC_GET_CONTENT_RATING", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_RATING>},
+		{"UGC_GET_CONTENT_RATING_COUNT", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_RATING_COUNT>},
+		{"UGC_GET_CONTENT_RATING_NEGATIVE_COUNT", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_RATING_NEGATIVE_COUNT>},
+		{"UGC_GET_CONTENT_RATING_POSITIVE_COUNT", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_RATING_POSITIVE_COUNT>},
+		{"UGC_GET_CONTENT_TOTAL", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_TOTAL>},
+		{"UGC_GET_CONTENT_UPDATED_DATE", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_UPDATED_DATE>},
+		{"UGC_GET_CONTENT_USER_ID", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_USER_ID>},
+		{"UGC_GET_CONTENT_USER_NAME", native_function<LUA_NATIVE_NETWORK_UGC_GET_CONTENT_USER_NAME>},
+		{"UGC_GET_CREATE_CONTENT_ID", native_function<LUA_NATIVE_NETWORK_UGC_GET_CREATE_CONTENT_ID>},
+		{"UGC_GET_CREATE_RESULT", native_function<LUA_NATIVE_NETWORK_UGC_GET_CREATE_RESULT>},
+		{"UGC_GET_CREATORS_BY_USER_ID", native_function<LUA_NATIVE_NETWORK_UGC_GET_CREATORS_BY_USER_ID>},
+		{"UGC_GET_CREATOR_NUM", native_function<LUA_NATIVE_NETWORK_UGC_GET_CREATOR_NUM>},
+		{"UGC_GET_CREW_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_GET_CREW_CONTENT>},
+		{"UGC_GET_FRIEND_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_GET_FRIEND_CONTENT>},
+		{"UGC_GET_GET_BY_CATEGORY", native_function<LUA_NATIVE_NETWORK_UGC_GET_GET_BY_CATEGORY>},
+		{"UGC_GET_GET_BY_CONTENT_ID", native_function<LUA_NATIVE_NETWORK_UGC_GET_GET_BY_CONTENT_ID>},
+		{"UGC_GET_GET_BY_CONTENT_IDS", native_function<LUA_NATIVE_NETWORK_UGC_GET_GET_BY_CONTENT_IDS>},
+		{"UGC_GET_MODIFY_RESULT", native_function<LUA_NATIVE_NETWORK_UGC_GET_MODIFY_RESULT>},
+		{"UGC_GET_MOST_RECENTLY_CREATED_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_GET_MOST_RECENTLY_CREATED_CONTENT>},
+		{"UGC_GET_MOST_RECENTLY_PLAYED_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_GET_MOST_RECENTLY_PLAYED_CONTENT>},
+		{"UGC_GET_MY_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_GET_MY_CONTENT>},
+		{"UGC_GET_QUERY_RESULT", native_function<LUA_NATIVE_NETWORK_UGC_GET_QUERY_RESULT>},
+		{"UGC_GET_ROOT_CONTENT_ID", native_function<LUA_NATIVE_NETWORK_UGC_GET_ROOT_CONTENT_ID>},
+		{"UGC_GET_TOP_RATED_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_GET_TOP_RATED_CONTENT>},
+		{"UGC_HAS_CREATE_FINISHED", native_function<LUA_NATIVE_NETWORK_UGC_HAS_CREATE_FINISHED>},
+		{"UGC_HAS_DESCRIPTION_REQUEST_FINISHED", native_function<LUA_NATIVE_NETWORK_UGC_HAS_DESCRIPTION_REQUEST_FINISHED>},
+		{"UGC_HAS_GET_FINISHED", native_function<LUA_NATIVE_NETWORK_UGC_HAS_GET_FINISHED>},
+		{"UGC_HAS_MODIFY_FINISHED", native_function<LUA_NATIVE_NETWORK_UGC_HAS_MODIFY_FINISHED>},
+		{"UGC_HAS_PERMISSION_TO_WRITE", native_function<LUA_NATIVE_NETWORK_UGC_HAS_PERMISSION_TO_WRITE>},
+		{"UGC_HAS_QUERY_CREATORS_FINISHED", native_function<LUA_NATIVE_NETWORK_UGC_HAS_QUERY_CREATORS_FINISHED>},
+		{"UGC_IS_CREATING", native_function<LUA_NATIVE_NETWORK_UGC_IS_CREATING>},
+		{"UGC_IS_DESCRIPTION_REQUEST_IN_PROGRESS", native_function<LUA_NATIVE_NETWORK_UGC_IS_DESCRIPTION_REQUEST_IN_PROGRESS>},
+		{"UGC_IS_GETTING", native_function<LUA_NATIVE_NETWORK_UGC_IS_GETTING>},
+		{"UGC_IS_LANGUAGE_SUPPORTED", native_function<LUA_NATIVE_NETWORK_UGC_IS_LANGUAGE_SUPPORTED>},
+		{"UGC_IS_MODIFYING", native_function<LUA_NATIVE_NETWORK_UGC_IS_MODIFYING>},
+		{"UGC_LOAD_OFFLINE_QUERY", native_function<LUA_NATIVE_NETWORK_UGC_LOAD_OFFLINE_QUERY>},
+		{"UGC_PUBLISH", native_function<LUA_NATIVE_NETWORK_UGC_PUBLISH>},
+		{"UGC_QUERY_BY_CATEGORY", native_function<LUA_NATIVE_NETWORK_UGC_QUERY_BY_CATEGORY>},
+		{"UGC_QUERY_BY_CONTENT_ID", native_function<LUA_NATIVE_NETWORK_UGC_QUERY_BY_CONTENT_ID>},
+		{"UGC_QUERY_BY_CONTENT_IDS", native_function<LUA_NATIVE_NETWORK_UGC_QUERY_BY_CONTENT_IDS>},
+		{"UGC_QUERY_MOST_RECENTLY_CREATED_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_QUERY_MOST_RECENTLY_CREATED_CONTENT>},
+		{"UGC_QUERY_MY_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_QUERY_MY_CONTENT>},
+		{"UGC_RELEASE_ALL_CACHED_DESCRIPTIONS", native_function<LUA_NATIVE_NETWORK_UGC_RELEASE_ALL_CACHED_DESCRIPTIONS>},
+		{"UGC_RELEASE_CACHED_DESCRIPTION", native_function<LUA_NATIVE_NETWORK_UGC_RELEASE_CACHED_DESCRIPTION>},
+		{"UGC_REQUEST_CACHED_DESCRIPTION", native_function<LUA_NATIVE_NETWORK_UGC_REQUEST_CACHED_DESCRIPTION>},
+		{"UGC_REQUEST_CONTENT_DATA_FROM_INDEX", native_function<LUA_NATIVE_NETWORK_UGC_REQUEST_CONTENT_DATA_FROM_INDEX>},
+		{"UGC_REQUEST_CONTENT_DATA_FROM_PARAMS", native_function<LUA_NATIVE_NETWORK_UGC_REQUEST_CONTENT_DATA_FROM_PARAMS>},
+		{"UGC_SET_BOOKMARKED", native_function<LUA_NATIVE_NETWORK_UGC_SET_BOOKMARKED>},
+		{"UGC_SET_DELETED", native_function<LUA_NATIVE_NETWORK_UGC_SET_DELETED>},
+		{"UGC_SET_QUERY_DATA_FROM_OFFLINE", native_function<LUA_NATIVE_NETWORK_UGC_SET_QUERY_DATA_FROM_OFFLINE>},
+		{"UGC_SET_USING_OFFLINE_CONTENT", native_function<LUA_NATIVE_NETWORK_UGC_SET_USING_OFFLINE_CONTENT>},
+		{"UGC_TEXTURE_DOWNLOAD_REQUEST", native_function<LUA_NATIVE_NETWORK_UGC_TEXTURE_DOWNLOAD_REQUEST>},
+		{"UGC_WAS_QUERY_FORCE_CANCELLED", native_function<LUA_NATIVE_NETWORK_UGC_WAS_QUERY_FORCE_CANCELLED>},
+		{"USE_PLAYER_COLOUR_INSTEAD_OF_TEAM_COLOUR", native_function<LUA_NATIVE_NETWORK_USE_PLAYER_COLOUR_INSTEAD_OF_TEAM_COLOUR>},
+		{"VEH_TO_NET", native_function<LUA_NATIVE_NETWORK_VEH_TO_NET>},
+	};
+
 	void init_native_binding_NETWORK(sol::state& L)
 	{
-		auto NETWORK = L["NETWORK"].get_or_create<sol::table>();
-		NETWORK.set_function("GET_ONLINE_VERSION", LUA_NATIVE_NETWORK_GET_ONLINE_VERSION);
-		NETWORK.set_function("NETWORK_IS_SIGNED_IN", LUA_NATIVE_NETWORK_NETWORK_IS_SIGNED_IN);
-		NETWORK.set_function("NETWORK_IS_SIGNED_ONLINE", LUA_NATIVE_NETWORK_NETWORK_IS_SIGNED_ONLINE);
-		NETWORK.set_function("NETWORK_IS_NP_AVAILABLE", LUA_NATIVE_NETWORK_NETWORK_IS_NP_AVAILABLE);
-		NETWORK.set_function("NETWORK_IS_NP_PENDING", LUA_NATIVE_NETWORK_NETWORK_IS_NP_PENDING);
-		NETWORK.set_function("NETWORK_GET_NP_UNAVAILABLE_REASON", LUA_NATIVE_NETWORK_NETWORK_GET_NP_UNAVAILABLE_REASON);
-		NETWORK.set_function("NETWORK_IS_CONNETED_TO_NP_PRESENCE", LUA_NATIVE_NETWORK_NETWORK_IS_CONNETED_TO_NP_PRESENCE);
-		NETWORK.set_function("NETWORK_IS_LOGGED_IN_TO_PSN", LUA_NATIVE_NETWORK_NETWORK_IS_LOGGED_IN_TO_PSN);
-		NETWORK.set_function("NETWORK_HAS_VALID_ROS_CREDENTIALS", LUA_NATIVE_NETWORK_NETWORK_HAS_VALID_ROS_CREDENTIALS);
-		NETWORK.set_function("NETWORK_IS_REFRESHING_ROS_CREDENTIALS", LUA_NATIVE_NETWORK_NETWORK_IS_REFRESHING_ROS_CREDENTIALS);
-		NETWORK.set_function("NETWORK_IS_CLOUD_AVAILABLE", LUA_NATIVE_NETWORK_NETWORK_IS_CLOUD_AVAILABLE);
-		NETWORK.set_function("NETWORK_HAS_SOCIAL_CLUB_ACCOUNT", LUA_NATIVE_NETWORK_NETWORK_HAS_SOCIAL_CLUB_ACCOUNT);
-		NETWORK.set_function("NETWORK_ARE_SOCIAL_CLUB_POLICIES_CURRENT", LUA_NATIVE_NETWORK_NETWORK_ARE_SOCIAL_CLUB_POLICIES_CURRENT);
-		NETWORK.set_function("NETWORK_IS_HOST", LUA_NATIVE_NETWORK_NETWORK_IS_HOST);
-		NETWORK.set_function("NETWORK_GET_HOST_PLAYER_INDEX", LUA_NATIVE_NETWORK_NETWORK_GET_HOST_PLAYER_INDEX);
-		NETWORK.set_function("NETWORK_WAS_GAME_SUSPENDED", LUA_NATIVE_NETWORK_NETWORK_WAS_GAME_SUSPENDED);
-		NETWORK.set_function("NETWORK_HAVE_ONLINE_PRIVILEGES", LUA_NATIVE_NETWORK_NETWORK_HAVE_ONLINE_PRIVILEGES);
-		NETWORK.set_function("NETWORK_HAS_AGE_RESTRICTIONS", LUA_NATIVE_NETWORK_NETWORK_HAS_AGE_RESTRICTIONS);
-		NETWORK.set_function("NETWORK_HAVE_USER_CONTENT_PRIVILEGES", LUA_NATIVE_NETWORK_NETWORK_HAVE_USER_CONTENT_PRIVILEGES);
-		NETWORK.set_function("NETWORK_HAVE_COMMUNICATION_PRIVILEGES", LUA_NATIVE_NETWORK_NETWORK_HAVE_COMMUNICATION_PRIVILEGES);
-		NETWORK.set_function("NETWORK_HAVE_PLATFORM_COMMUNICATION_PRIVILEGES_", LUA_NATIVE_NETWORK_NETWORK_HAVE_PLATFORM_COMMUNICATION_PRIVILEGES_);
-		NETWORK.set_function("NETWORK_CHECK_ONLINE_PRIVILEGES", LUA_NATIVE_NETWORK_NETWORK_CHECK_ONLINE_PRIVILEGES);
-		NETWORK.set_function("NETWORK_CHECK_USER_CONTENT_PRIVILEGES", LUA_NATIVE_NETWORK_NETWORK_CHECK_USER_CONTENT_PRIVILEGES);
-		NETWORK.set_function("NETWORK_CHECK_COMMUNICATION_PRIVILEGES", LUA_NATIVE_NETWORK_NETWORK_CHECK_COMMUNICATION_PRIVILEGES);
-		NETWORK.set_function("NETWORK_CHECK_TEXT_COMMUNICATION_PRIVILEGES", LUA_NATIVE_NETWORK_NETWORK_CHECK_TEXT_COMMUNICATION_PRIVILEGES);
-		NETWORK.set_function("NETWORK_IS_USING_ONLINE_PROMOTION", LUA_NATIVE_NETWORK_NETWORK_IS_USING_ONLINE_PROMOTION);
-		NETWORK.set_function("NETWORK_SHOULD_SHOW_PROMOTION_ALERT_SCREEN", LUA_NATIVE_NETWORK_NETWORK_SHOULD_SHOW_PROMOTION_ALERT_SCREEN);
-		NETWORK.set_function("NETWORK_HAS_SOCIAL_NETWORKING_SHARING_PRIV", LUA_NATIVE_NETWORK_NETWORK_HAS_SOCIAL_NETWORKING_SHARING_PRIV);
-		NETWORK.set_function("NETWORK_GET_AGE_GROUP", LUA_NATIVE_NETWORK_NETWORK_GET_AGE_GROUP);
-		NETWORK.set_function("NETWORK_CHECK_PRIVILEGES", LUA_NATIVE_NETWORK_NETWORK_CHECK_PRIVILEGES);
-		NETWORK.set_function("NETWORK_IS_PRIVILEGE_CHECK_IN_PROGRESS", LUA_NATIVE_NETWORK_NETWORK_IS_PRIVILEGE_CHECK_IN_PROGRESS);
-		NETWORK.set_function("NETWORK_SET_PRIVILEGE_CHECK_RESULT_NOT_NEEDED", LUA_NATIVE_NETWORK_NETWORK_SET_PRIVILEGE_CHECK_RESULT_NOT_NEEDED);
-		NETWORK.set_function("NETWORK_RESOLVE_PRIVILEGE_USER_CONTENT", LUA_NATIVE_NETWORK_NETWORK_RESOLVE_PRIVILEGE_USER_CONTENT);
-		NETWORK.set_function("NETWORK_HAVE_PLATFORM_SUBSCRIPTION", LUA_NATIVE_NETWORK_NETWORK_HAVE_PLATFORM_SUBSCRIPTION);
-		NETWORK.set_function("NETWORK_IS_PLATFORM_SUBSCRIPTION_CHECK_PENDING", LUA_NATIVE_NETWORK_NETWORK_IS_PLATFORM_SUBSCRIPTION_CHECK_PENDING);
-		NETWORK.set_function("NETWORK_SHOW_ACCOUNT_UPGRADE_UI", LUA_NATIVE_NETWORK_NETWORK_SHOW_ACCOUNT_UPGRADE_UI);
-		NETWORK.set_function("NETWORK_IS_SHOWING_SYSTEM_UI_OR_RECENTLY_REQUESTED_UPSELL", LUA_NATIVE_NETWORK_NETWORK_IS_SHOWING_SYSTEM_UI_OR_RECENTLY_REQUESTED_UPSELL);
-		NETWORK.set_function("NETWORK_NEED_TO_START_NEW_GAME_BUT_BLOCKED", LUA_NATIVE_NETWORK_NETWORK_NEED_TO_START_NEW_GAME_BUT_BLOCKED);
-		NETWORK.set_function("NETWORK_CAN_BAIL", LUA_NATIVE_NETWORK_NETWORK_CAN_BAIL);
-		NETWORK.set_function("NETWORK_BAIL", LUA_NATIVE_NETWORK_NETWORK_BAIL);
-		NETWORK.set_function("NETWORK_ON_RETURN_TO_SINGLE_PLAYER", LUA_NATIVE_NETWORK_NETWORK_ON_RETURN_TO_SINGLE_PLAYER);
-		NETWORK.set_function("NETWORK_TRANSITION_START", LUA_NATIVE_NETWORK_NETWORK_TRANSITION_START);
-		NETWORK.set_function("NETWORK_TRANSITION_ADD_STAGE", LUA_NATIVE_NETWORK_NETWORK_TRANSITION_ADD_STAGE);
-		NETWORK.set_function("NETWORK_TRANSITION_FINISH", LUA_NATIVE_NETWORK_NETWORK_TRANSITION_FINISH);
-		NETWORK.set_function("NETWORK_CAN_ACCESS_MULTIPLAYER", LUA_NATIVE_NETWORK_NETWORK_CAN_ACCESS_MULTIPLAYER);
-		NETWORK.set_function("NETWORK_IS_MULTIPLAYER_DISABLED", LUA_NATIVE_NETWORK_NETWORK_IS_MULTIPLAYER_DISABLED);
-		NETWORK.set_function("NETWORK_CAN_ENTER_MULTIPLAYER", LUA_NATIVE_NETWORK_NETWORK_CAN_ENTER_MULTIPLAYER);
-		NETWORK.set_function("NETWORK_SESSION_DO_FREEROAM_QUICKMATCH", LUA_NATIVE_NETWORK_NETWORK_SESSION_DO_FREEROAM_QUICKMATCH);
-		NETWORK.set_function("NETWORK_SESSION_DO_FRIEND_MATCHMAKING", LUA_NATIVE_NETWORK_NETWORK_SESSION_DO_FRIEND_MATCHMAKING);
-		NETWORK.set_function("NETWORK_SESSION_DO_CREW_MATCHMAKING", LUA_NATIVE_NETWORK_NETWORK_SESSION_DO_CREW_MATCHMAKING);
-		NETWORK.set_function("NETWORK_SESSION_DO_ACTIVITY_QUICKMATCH", LUA_NATIVE_NETWORK_NETWORK_SESSION_DO_ACTIVITY_QUICKMATCH);
-		NETWORK.set_function("NETWORK_SESSION_HOST", LUA_NATIVE_NETWORK_NETWORK_SESSION_HOST);
-		NETWORK.set_function("NETWORK_SESSION_HOST_CLOSED", LUA_NATIVE_NETWORK_NETWORK_SESSION_HOST_CLOSED);
-		NETWORK.set_function("NETWORK_SESSION_HOST_FRIENDS_ONLY", LUA_NATIVE_NETWORK_NETWORK_SESSION_HOST_FRIENDS_ONLY);
-		NETWORK.set_function("NETWORK_SESSION_IS_CLOSED_FRIENDS", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_CLOSED_FRIENDS);
-		NETWORK.set_function("NETWORK_SESSION_IS_CLOSED_CREW", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_CLOSED_CREW);
-		NETWORK.set_function("NETWORK_SESSION_IS_SOLO", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_SOLO);
-		NETWORK.set_function("NETWORK_SESSION_IS_PRIVATE", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_PRIVATE);
-		NETWORK.set_function("NETWORK_SESSION_LEAVE_INCLUDING_REASON_", LUA_NATIVE_NETWORK_NETWORK_SESSION_LEAVE_INCLUDING_REASON_);
-		NETWORK.set_function("NETWORK_SESSION_END", LUA_NATIVE_NETWORK_NETWORK_SESSION_END);
-		NETWORK.set_function("NETWORK_SESSION_LEAVE", LUA_NATIVE_NETWORK_NETWORK_SESSION_LEAVE);
-		NETWORK.set_function("NETWORK_SESSION_KICK_PLAYER", LUA_NATIVE_NETWORK_NETWORK_SESSION_KICK_PLAYER);
-		NETWORK.set_function("NETWORK_SESSION_GET_KICK_VOTE", LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_KICK_VOTE);
-		NETWORK.set_function("NETWORK_SESSION_RESERVE_SLOTS_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_SESSION_RESERVE_SLOTS_TRANSITION);
-		NETWORK.set_function("NETWORK_JOIN_PREVIOUSLY_FAILED_SESSION", LUA_NATIVE_NETWORK_NETWORK_JOIN_PREVIOUSLY_FAILED_SESSION);
-		NETWORK.set_function("NETWORK_JOIN_PREVIOUSLY_FAILED_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_JOIN_PREVIOUSLY_FAILED_TRANSITION);
-		NETWORK.set_function("NETWORK_SESSION_SET_MATCHMAKING_GROUP", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_MATCHMAKING_GROUP);
-		NETWORK.set_function("NETWORK_SESSION_SET_MATCHMAKING_GROUP_MAX", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_MATCHMAKING_GROUP_MAX);
-		NETWORK.set_function("NETWORK_SESSION_GET_MATCHMAKING_GROUP_FREE", LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_MATCHMAKING_GROUP_FREE);
-		NETWORK.set_function("NETWORK_SESSION_ADD_ACTIVE_MATCHMAKING_GROUP", LUA_NATIVE_NETWORK_NETWORK_SESSION_ADD_ACTIVE_MATCHMAKING_GROUP);
-		NETWORK.set_function("NETWORK_SESSION_SET_UNIQUE_CREW_LIMIT", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_UNIQUE_CREW_LIMIT);
-		NETWORK.set_function("NETWORK_SESSION_GET_UNIQUE_CREW_LIMIT", LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_UNIQUE_CREW_LIMIT);
-		NETWORK.set_function("NETWORK_SESSION_SET_UNIQUE_CREW_LIMIT_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_UNIQUE_CREW_LIMIT_TRANSITION);
-		NETWORK.set_function("NETWORK_SESSION_SET_UNIQUE_CREW_ONLY_CREWS_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_UNIQUE_CREW_ONLY_CREWS_TRANSITION);
-		NETWORK.set_function("NETWORK_SESSION_SET_CREW_LIMIT_MAX_MEMBERS_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_CREW_LIMIT_MAX_MEMBERS_TRANSITION);
-		NETWORK.set_function("NETWORK_SESSION_SET_MATCHMAKING_PROPERTY_ID", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_MATCHMAKING_PROPERTY_ID);
-		NETWORK.set_function("NETWORK_SESSION_SET_MATCHMAKING_MENTAL_STATE", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_MATCHMAKING_MENTAL_STATE);
-		NETWORK.set_function("NETWORK_SESSION_SET_NUM_BOSSES", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_NUM_BOSSES);
-		NETWORK.set_function("NETWORK_SESSION_SET_SCRIPT_VALIDATE_JOIN", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_SCRIPT_VALIDATE_JOIN);
-		NETWORK.set_function("NETWORK_SESSION_VALIDATE_JOIN", LUA_NATIVE_NETWORK_NETWORK_SESSION_VALIDATE_JOIN);
-		NETWORK.set_function("NETWORK_ADD_FOLLOWERS", LUA_NATIVE_NETWORK_NETWORK_ADD_FOLLOWERS);
-		NETWORK.set_function("NETWORK_CLEAR_FOLLOWERS", LUA_NATIVE_NETWORK_NETWORK_CLEAR_FOLLOWERS);
-		NETWORK.set_function("NETWORK_GET_GLOBAL_MULTIPLAYER_CLOCK", LUA_NATIVE_NETWORK_NETWORK_GET_GLOBAL_MULTIPLAYER_CLOCK);
-		NETWORK.set_function("NETWORK_SESSION_SET_GAMEMODE", LUA_NATIVE_NETWORK_NETWORK_SESSION_SET_GAMEMODE);
-		NETWORK.set_function("NETWORK_SESSION_GET_HOST_AIM_PREFERENCE", LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_HOST_AIM_PREFERENCE);
-		NETWORK.set_function("NETWORK_FIND_GAMERS_IN_CREW", LUA_NATIVE_NETWORK_NETWORK_FIND_GAMERS_IN_CREW);
-		NETWORK.set_function("NETWORK_FIND_MATCHED_GAMERS", LUA_NATIVE_NETWORK_NETWORK_FIND_MATCHED_GAMERS);
-		NETWORK.set_function("NETWORK_IS_FINDING_GAMERS", LUA_NATIVE_NETWORK_NETWORK_IS_FINDING_GAMERS);
-		NETWORK.set_function("NETWORK_DID_FIND_GAMERS_SUCCEED", LUA_NATIVE_NETWORK_NETWORK_DID_FIND_GAMERS_SUCCEED);
-		NETWORK.set_function("NETWORK_GET_NUM_FOUND_GAMERS", LUA_NATIVE_NETWORK_NETWORK_GET_NUM_FOUND_GAMERS);
-		NETWORK.set_function("NETWORK_GET_FOUND_GAMER", LUA_NATIVE_NETWORK_NETWORK_GET_FOUND_GAMER);
-		NETWORK.set_function("NETWORK_CLEAR_FOUND_GAMERS", LUA_NATIVE_NETWORK_NETWORK_CLEAR_FOUND_GAMERS);
-		NETWORK.set_function("NETWORK_QUEUE_GAMER_FOR_STATUS", LUA_NATIVE_NETWORK_NETWORK_QUEUE_GAMER_FOR_STATUS);
-		NETWORK.set_function("NETWORK_GET_GAMER_STATUS_FROM_QUEUE", LUA_NATIVE_NETWORK_NETWORK_GET_GAMER_STATUS_FROM_QUEUE);
-		NETWORK.set_function("NETWORK_IS_GETTING_GAMER_STATUS", LUA_NATIVE_NETWORK_NETWORK_IS_GETTING_GAMER_STATUS);
-		NETWORK.set_function("NETWORK_DID_GET_GAMER_STATUS_SUCCEED", LUA_NATIVE_NETWORK_NETWORK_DID_GET_GAMER_STATUS_SUCCEED);
-		NETWORK.set_function("NETWORK_GET_GAMER_STATUS_RESULT", LUA_NATIVE_NETWORK_NETWORK_GET_GAMER_STATUS_RESULT);
-		NETWORK.set_function("NETWORK_CLEAR_GET_GAMER_STATUS", LUA_NATIVE_NETWORK_NETWORK_CLEAR_GET_GAMER_STATUS);
-		NETWORK.set_function("NETWORK_SESSION_JOIN_INVITE", LUA_NATIVE_NETWORK_NETWORK_SESSION_JOIN_INVITE);
-		NETWORK.set_function("NETWORK_SESSION_CANCEL_INVITE", LUA_NATIVE_NETWORK_NETWORK_SESSION_CANCEL_INVITE);
-		NETWORK.set_function("NETWORK_SESSION_FORCE_CANCEL_INVITE", LUA_NATIVE_NETWORK_NETWORK_SESSION_FORCE_CANCEL_INVITE);
-		NETWORK.set_function("NETWORK_HAS_PENDING_INVITE", LUA_NATIVE_NETWORK_NETWORK_HAS_PENDING_INVITE);
-		NETWORK.set_function("NETWORK_HAS_CONFIRMED_INVITE", LUA_NATIVE_NETWORK_NETWORK_HAS_CONFIRMED_INVITE);
-		NETWORK.set_function("NETWORK_REQUEST_INVITE_CONFIRMED_EVENT", LUA_NATIVE_NETWORK_NETWORK_REQUEST_INVITE_CONFIRMED_EVENT);
-		NETWORK.set_function("NETWORK_SESSION_WAS_INVITED", LUA_NATIVE_NETWORK_NETWORK_SESSION_WAS_INVITED);
-		NETWORK.set_function("NETWORK_SESSION_GET_INVITER", LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_INVITER);
-		NETWORK.set_function("NETWORK_SESSION_IS_AWAITING_INVITE_RESPONSE", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_AWAITING_INVITE_RESPONSE);
-		NETWORK.set_function("NETWORK_SESSION_IS_DISPLAYING_INVITE_CONFIRMATION", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_DISPLAYING_INVITE_CONFIRMATION);
-		NETWORK.set_function("NETWORK_SUPPRESS_INVITE", LUA_NATIVE_NETWORK_NETWORK_SUPPRESS_INVITE);
-		NETWORK.set_function("NETWORK_BLOCK_INVITES", LUA_NATIVE_NETWORK_NETWORK_BLOCK_INVITES);
-		NETWORK.set_function("NETWORK_BLOCK_JOIN_QUEUE_INVITES", LUA_NATIVE_NETWORK_NETWORK_BLOCK_JOIN_QUEUE_INVITES);
-		NETWORK.set_function("NETWORK_SET_CAN_RECEIVE_RS_INVITES", LUA_NATIVE_NETWORK_NETWORK_SET_CAN_RECEIVE_RS_INVITES);
-		NETWORK.set_function("NETWORK_STORE_INVITE_THROUGH_RESTART", LUA_NATIVE_NETWORK_NETWORK_STORE_INVITE_THROUGH_RESTART);
-		NETWORK.set_function("NETWORK_ALLOW_INVITE_PROCESS_IN_PLAYER_SWITCH", LUA_NATIVE_NETWORK_NETWORK_ALLOW_INVITE_PROCESS_IN_PLAYER_SWITCH);
-		NETWORK.set_function("NETWORK_SET_SCRIPT_READY_FOR_EVENTS", LUA_NATIVE_NETWORK_NETWORK_SET_SCRIPT_READY_FOR_EVENTS);
-		NETWORK.set_function("NETWORK_IS_OFFLINE_INVITE_PENDING", LUA_NATIVE_NETWORK_NETWORK_IS_OFFLINE_INVITE_PENDING);
-		NETWORK.set_function("NETWORK_CLEAR_OFFLINE_INVITE_PENDING", LUA_NATIVE_NETWORK_NETWORK_CLEAR_OFFLINE_INVITE_PENDING);
-		NETWORK.set_function("NETWORK_SESSION_HOST_SINGLE_PLAYER", LUA_NATIVE_NETWORK_NETWORK_SESSION_HOST_SINGLE_PLAYER);
-		NETWORK.set_function("NETWORK_SESSION_LEAVE_SINGLE_PLAYER", LUA_NATIVE_NETWORK_NETWORK_SESSION_LEAVE_SINGLE_PLAYER);
-		NETWORK.set_function("NETWORK_IS_GAME_IN_PROGRESS", LUA_NATIVE_NETWORK_NETWORK_IS_GAME_IN_PROGRESS);
-		NETWORK.set_function("NETWORK_IS_SESSION_ACTIVE", LUA_NATIVE_NETWORK_NETWORK_IS_SESSION_ACTIVE);
-		NETWORK.set_function("NETWORK_IS_IN_SESSION", LUA_NATIVE_NETWORK_NETWORK_IS_IN_SESSION);
-		NETWORK.set_function("NETWORK_IS_AMERICAS_VERSION_", LUA_NATIVE_NETWORK_NETWORK_IS_AMERICAS_VERSION_);
-		NETWORK.set_function("NETWORK_IS_SESSION_STARTED", LUA_NATIVE_NETWORK_NETWORK_IS_SESSION_STARTED);
-		NETWORK.set_function("NETWORK_IS_SESSION_BUSY", LUA_NATIVE_NETWORK_NETWORK_IS_SESSION_BUSY);
-		NETWORK.set_function("NETWORK_CAN_SESSION_END", LUA_NATIVE_NETWORK_NETWORK_CAN_SESSION_END);
-		NETWORK.set_function("NETWORK_GET_GAME_MODE", LUA_NATIVE_NETWORK_NETWORK_GET_GAME_MODE);
-		NETWORK.set_function("NETWORK_SESSION_MARK_VISIBLE", LUA_NATIVE_NETWORK_NETWORK_SESSION_MARK_VISIBLE);
-		NETWORK.set_function("NETWORK_SESSION_IS_VISIBLE", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_VISIBLE);
-		NETWORK.set_function("NETWORK_SESSION_BLOCK_JOIN_REQUESTS", LUA_NATIVE_NETWORK_NETWORK_SESSION_BLOCK_JOIN_REQUESTS);
-		NETWORK.set_function("NETWORK_SESSION_CHANGE_SLOTS", LUA_NATIVE_NETWORK_NETWORK_SESSION_CHANGE_SLOTS);
-		NETWORK.set_function("NETWORK_SESSION_GET_PRIVATE_SLOTS", LUA_NATIVE_NETWORK_NETWORK_SESSION_GET_PRIVATE_SLOTS);
-		NETWORK.set_function("NETWORK_SESSION_VOICE_HOST", LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_HOST);
-		NETWORK.set_function("NETWORK_SESSION_VOICE_LEAVE", LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_LEAVE);
-		NETWORK.set_function("NETWORK_SESSION_VOICE_CONNECT_TO_PLAYER", LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_CONNECT_TO_PLAYER);
-		NETWORK.set_function("NETWORK_SESSION_VOICE_RESPOND_TO_REQUEST", LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_RESPOND_TO_REQUEST);
-		NETWORK.set_function("NETWORK_SESSION_VOICE_SET_TIMEOUT", LUA_NATIVE_NETWORK_NETWORK_SESSION_VOICE_SET_TIMEOUT);
-		NETWORK.set_function("NETWORK_SESSION_IS_IN_VOICE_SESSION", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_IN_VOICE_SESSION);
-		NETWORK.set_function("NETWORK_SESSION_IS_VOICE_SESSION_ACTIVE", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_VOICE_SESSION_ACTIVE);
-		NETWORK.set_function("NETWORK_SESSION_IS_VOICE_SESSION_BUSY", LUA_NATIVE_NETWORK_NETWORK_SESSION_IS_VOICE_SESSION_BUSY);
-		NETWORK.set_function("NETWORK_SEND_TEXT_MESSAGE", LUA_NATIVE_NETWORK_NETWORK_SEND_TEXT_MESSAGE);
-		NETWORK.set_function("NETWORK_SET_ACTIVITY_SPECTATOR", LUA_NATIVE_NETWORK_NETWORK_SET_ACTIVITY_SPECTATOR);
-		NETWORK.set_function("NETWORK_IS_ACTIVITY_SPECTATOR", LUA_NATIVE_NETWORK_NETWORK_IS_ACTIVITY_SPECTATOR);
-		NETWORK.set_function("NETWORK_SET_ACTIVITY_PLAYER_MAX", LUA_NATIVE_NETWORK_NETWORK_SET_ACTIVITY_PLAYER_MAX);
-		NETWORK.set_function("NETWORK_SET_ACTIVITY_SPECTATOR_MAX", LUA_NATIVE_NETWORK_NETWORK_SET_ACTIVITY_SPECTATOR_MAX);
-		NETWORK.set_function("NETWORK_GET_ACTIVITY_PLAYER_NUM", LUA_NATIVE_NETWORK_NETWORK_GET_ACTIVITY_PLAYER_NUM);
-		NETWORK.set_function("NETWORK_IS_ACTIVITY_SPECTATOR_FROM_HANDLE", LUA_NATIVE_NETWORK_NETWORK_IS_ACTIVITY_SPECTATOR_FROM_HANDLE);
-		NETWORK.set_function("NETWORK_HOST_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_HOST_TRANSITION);
-		NETWORK.set_function("NETWORK_DO_TRANSITION_QUICKMATCH", LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_QUICKMATCH);
-		NETWORK.set_function("NETWORK_DO_TRANSITION_QUICKMATCH_ASYNC", LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_QUICKMATCH_ASYNC);
-		NETWORK.set_function("NETWORK_DO_TRANSITION_QUICKMATCH_WITH_GROUP", LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_QUICKMATCH_WITH_GROUP);
-		NETWORK.set_function("NETWORK_JOIN_GROUP_ACTIVITY", LUA_NATIVE_NETWORK_NETWORK_JOIN_GROUP_ACTIVITY);
-		NETWORK.set_function("NETWORK_CLEAR_GROUP_ACTIVITY", LUA_NATIVE_NETWORK_NETWORK_CLEAR_GROUP_ACTIVITY);
-		NETWORK.set_function("NETWORK_RETAIN_ACTIVITY_GROUP", LUA_NATIVE_NETWORK_NETWORK_RETAIN_ACTIVITY_GROUP);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_CLOSED_FRIENDS", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_CLOSED_FRIENDS);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_CLOSED_CREW", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_CLOSED_CREW);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_SOLO", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_SOLO);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_PRIVATE", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_PRIVATE);
-		NETWORK.set_function("NETWORK_GET_NUM_TRANSITION_NON_ASYNC_GAMERS", LUA_NATIVE_NETWORK_NETWORK_GET_NUM_TRANSITION_NON_ASYNC_GAMERS);
-		NETWORK.set_function("NETWORK_MARK_AS_PREFERRED_ACTIVITY", LUA_NATIVE_NETWORK_NETWORK_MARK_AS_PREFERRED_ACTIVITY);
-		NETWORK.set_function("NETWORK_MARK_AS_WAITING_ASYNC", LUA_NATIVE_NETWORK_NETWORK_MARK_AS_WAITING_ASYNC);
-		NETWORK.set_function("NETWORK_SET_IN_PROGRESS_FINISH_TIME", LUA_NATIVE_NETWORK_NETWORK_SET_IN_PROGRESS_FINISH_TIME);
-		NETWORK.set_function("NETWORK_SET_TRANSITION_CREATOR_HANDLE", LUA_NATIVE_NETWORK_NETWORK_SET_TRANSITION_CREATOR_HANDLE);
-		NETWORK.set_function("NETWORK_CLEAR_TRANSITION_CREATOR_HANDLE", LUA_NATIVE_NETWORK_NETWORK_CLEAR_TRANSITION_CREATOR_HANDLE);
-		NETWORK.set_function("NETWORK_INVITE_GAMERS_TO_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_INVITE_GAMERS_TO_TRANSITION);
-		NETWORK.set_function("NETWORK_SET_GAMER_INVITED_TO_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_SET_GAMER_INVITED_TO_TRANSITION);
-		NETWORK.set_function("NETWORK_LEAVE_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_LEAVE_TRANSITION);
-		NETWORK.set_function("NETWORK_LAUNCH_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_LAUNCH_TRANSITION);
-		NETWORK.set_function("NETWORK_SET_DO_NOT_LAUNCH_FROM_JOIN_AS_MIGRATED_HOST", LUA_NATIVE_NETWORK_NETWORK_SET_DO_NOT_LAUNCH_FROM_JOIN_AS_MIGRATED_HOST);
-		NETWORK.set_function("NETWORK_CANCEL_TRANSITION_MATCHMAKING", LUA_NATIVE_NETWORK_NETWORK_CANCEL_TRANSITION_MATCHMAKING);
-		NETWORK.set_function("NETWORK_BAIL_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_BAIL_TRANSITION);
-		NETWORK.set_function("NETWORK_DO_TRANSITION_TO_GAME", LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_TO_GAME);
-		NETWORK.set_function("NETWORK_DO_TRANSITION_TO_NEW_GAME", LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_TO_NEW_GAME);
-		NETWORK.set_function("NETWORK_DO_TRANSITION_TO_FREEMODE", LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_TO_FREEMODE);
-		NETWORK.set_function("NETWORK_DO_TRANSITION_TO_NEW_FREEMODE", LUA_NATIVE_NETWORK_NETWORK_DO_TRANSITION_TO_NEW_FREEMODE);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_TO_GAME", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_TO_GAME);
-		NETWORK.set_function("NETWORK_GET_TRANSITION_MEMBERS", LUA_NATIVE_NETWORK_NETWORK_GET_TRANSITION_MEMBERS);
-		NETWORK.set_function("NETWORK_APPLY_TRANSITION_PARAMETER", LUA_NATIVE_NETWORK_NETWORK_APPLY_TRANSITION_PARAMETER);
-		NETWORK.set_function("NETWORK_APPLY_TRANSITION_PARAMETER_STRING", LUA_NATIVE_NETWORK_NETWORK_APPLY_TRANSITION_PARAMETER_STRING);
-		NETWORK.set_function("NETWORK_SEND_TRANSITION_GAMER_INSTRUCTION", LUA_NATIVE_NETWORK_NETWORK_SEND_TRANSITION_GAMER_INSTRUCTION);
-		NETWORK.set_function("NETWORK_MARK_TRANSITION_GAMER_AS_FULLY_JOINED", LUA_NATIVE_NETWORK_NETWORK_MARK_TRANSITION_GAMER_AS_FULLY_JOINED);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_HOST", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_HOST);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_HOST_FROM_HANDLE", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_HOST_FROM_HANDLE);
-		NETWORK.set_function("NETWORK_GET_TRANSITION_HOST", LUA_NATIVE_NETWORK_NETWORK_GET_TRANSITION_HOST);
-		NETWORK.set_function("NETWORK_IS_IN_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_IS_IN_TRANSITION);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_STARTED", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_STARTED);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_BUSY", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_BUSY);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_MATCHMAKING", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_MATCHMAKING);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_LEAVE_POSTPONED", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_LEAVE_POSTPONED);
-		NETWORK.set_function("NETWORK_TRANSITION_SET_IN_PROGRESS", LUA_NATIVE_NETWORK_NETWORK_TRANSITION_SET_IN_PROGRESS);
-		NETWORK.set_function("NETWORK_TRANSITION_SET_CONTENT_CREATOR", LUA_NATIVE_NETWORK_NETWORK_TRANSITION_SET_CONTENT_CREATOR);
-		NETWORK.set_function("NETWORK_TRANSITION_SET_ACTIVITY_ISLAND", LUA_NATIVE_NETWORK_NETWORK_TRANSITION_SET_ACTIVITY_ISLAND);
-		NETWORK.set_function("NETWORK_OPEN_TRANSITION_MATCHMAKING", LUA_NATIVE_NETWORK_NETWORK_OPEN_TRANSITION_MATCHMAKING);
-		NETWORK.set_function("NETWORK_CLOSE_TRANSITION_MATCHMAKING", LUA_NATIVE_NETWORK_NETWORK_CLOSE_TRANSITION_MATCHMAKING);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_OPEN_TO_MATCHMAKING", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_OPEN_TO_MATCHMAKING);
-		NETWORK.set_function("NETWORK_SET_TRANSITION_VISIBILITY_LOCK", LUA_NATIVE_NETWORK_NETWORK_SET_TRANSITION_VISIBILITY_LOCK);
-		NETWORK.set_function("NETWORK_IS_TRANSITION_VISIBILITY_LOCKED", LUA_NATIVE_NETWORK_NETWORK_IS_TRANSITION_VISIBILITY_LOCKED);
-		NETWORK.set_function("NETWORK_SET_TRANSITION_ACTIVITY_ID", LUA_NATIVE_NETWORK_NETWORK_SET_TRANSITION_ACTIVITY_ID);
-		NETWORK.set_function("NETWORK_CHANGE_TRANSITION_SLOTS", LUA_NATIVE_NETWORK_NETWORK_CHANGE_TRANSITION_SLOTS);
-		NETWORK.set_function("NETWORK_TRANSITION_BLOCK_JOIN_REQUESTS", LUA_NATIVE_NETWORK_NETWORK_TRANSITION_BLOCK_JOIN_REQUESTS);
-		NETWORK.set_function("NETWORK_HAS_PLAYER_STARTED_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_HAS_PLAYER_STARTED_TRANSITION);
-		NETWORK.set_function("NETWORK_ARE_TRANSITION_DETAILS_VALID", LUA_NATIVE_NETWORK_NETWORK_ARE_TRANSITION_DETAILS_VALID);
-		NETWORK.set_function("NETWORK_JOIN_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_JOIN_TRANSITION);
-		NETWORK.set_function("NETWORK_HAS_INVITED_GAMER_TO_TRANSITION", LUA_NATIVE_NETWORK_NETWORK_HAS_INVITED_GAMER_TO_TRANSITION);
-		NETWORK.set_function("NETWORK_HAS_TRANSITION_INVITE_BEEN_ACKED", LUA_NATIVE_NETWORK_NETWORK_HAS_TRANSITION_INVITE_BEEN_ACKED);
-		NETWORK.set_function("NETWORK_IS_ACTIVITY_SESSION", LUA_NATIVE_NETWORK_NETWORK_IS_ACTIVITY_SESSION);
-		NETWORK.set_function("NETWORK_DISABLE_REALTIME_MULTIPLAYER", LUA_NATIVE_NETWORK_NETWORK_DISABLE_REALTIME_MULTIPLAYER);
-		NETWORK.set_function("NETWORK_SET_PRESENCE_SESSION_INVITES_BLOCKED", LUA_NATIVE_NETWORK_NETWORK_SET_PRESENCE_SESSION_INVITES_BLOCKED);
-		NETWORK.set_function("NETWORK_SEND_INVITE_VIA_PRESENCE", LUA_NATIVE_NETWORK_NETWORK_SEND_INVITE_VIA_PRESENCE);
-		NETWORK.set_function("NETWORK_SEND_TRANSITION_INVITE_VIA_PRESENCE", LUA_NATIVE_NETWORK_NETWORK_SEND_TRANSITION_INVITE_VIA_PRESENCE);
-		NETWORK.set_function("NETWORK_SEND_IMPORTANT_TRANSITION_INVITE_VIA_PRESENCE", LUA_NATIVE_NETWORK_NETWORK_SEND_IMPORTANT_TRANSITION_INVITE_VIA_PRESENCE);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_INDEX_BY_ID", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_INDEX_BY_ID);
-		NETWORK.set_function("NETWORK_GET_NUM_PRESENCE_INVITES", LUA_NATIVE_NETWORK_NETWORK_GET_NUM_PRESENCE_INVITES);
-		NETWORK.set_function("NETWORK_ACCEPT_PRESENCE_INVITE", LUA_NATIVE_NETWORK_NETWORK_ACCEPT_PRESENCE_INVITE);
-		NETWORK.set_function("NETWORK_REMOVE_PRESENCE_INVITE", LUA_NATIVE_NETWORK_NETWORK_REMOVE_PRESENCE_INVITE);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_ID", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_ID);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_INVITER", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_INVITER);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_HANDLE", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_HANDLE);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_SESSION_ID", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_SESSION_ID);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_CONTENT_ID", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_CONTENT_ID);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_PLAYLIST_LENGTH", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_PLAYLIST_LENGTH);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_PLAYLIST_CURRENT", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_PLAYLIST_CURRENT);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_FROM_ADMIN", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_FROM_ADMIN);
-		NETWORK.set_function("NETWORK_GET_PRESENCE_INVITE_IS_TOURNAMENT", LUA_NATIVE_NETWORK_NETWORK_GET_PRESENCE_INVITE_IS_TOURNAMENT);
-		NETWORK.set_function("NETWORK_HAS_FOLLOW_INVITE", LUA_NATIVE_NETWORK_NETWORK_HAS_FOLLOW_INVITE);
-		NETWORK.set_function("NETWORK_ACTION_FOLLOW_INVITE", LUA_NATIVE_NETWORK_NETWORK_ACTION_FOLLOW_INVITE);
-		NETWORK.set_function("NETWORK_CLEAR_FOLLOW_INVITE", LUA_NATIVE_NETWORK_NETWORK_CLEAR_FOLLOW_INVITE);
-		NETWORK.set_function("NETWORK_REMOVE_AND_CANCEL_ALL_INVITES", LUA_NATIVE_NETWORK_NETWORK_REMOVE_AND_CANCEL_ALL_INVITES);
-		NETWORK.set_function("NETWORK_REMOVE_TRANSITION_INVITE", LUA_NATIVE_NETWORK_NETWORK_REMOVE_TRANSITION_INVITE);
-		NETWORK.set_function("NETWORK_REMOVE_ALL_TRANSITION_INVITE", LUA_NATIVE_NETWORK_NETWORK_REMOVE_ALL_TRANSITION_INVITE);
-		NETWORK.set_function("NETWORK_REMOVE_AND_CANCEL_ALL_TRANSITION_INVITES", LUA_NATIVE_NETWORK_NETWORK_REMOVE_AND_CANCEL_ALL_TRANSITION_INVITES);
-		NETWORK.set_function("NETWORK_INVITE_GAMERS", LUA_NATIVE_NETWORK_NETWORK_INVITE_GAMERS);
-		NETWORK.set_function("NETWORK_HAS_INVITED_GAMER", LUA_NATIVE_NETWORK_NETWORK_HAS_INVITED_GAMER);
-		NETWORK.set_function("NETWORK_HAS_MADE_INVITE_DECISION", LUA_NATIVE_NETWORK_NETWORK_HAS_MADE_INVITE_DECISION);
-		NETWORK.set_function("NETWORK_GET_INVITE_REPLY_STATUS", LUA_NATIVE_NETWORK_NETWORK_GET_INVITE_REPLY_STATUS);
-		NETWORK.set_function("NETWORK_GET_CURRENTLY_SELECTED_GAMER_HANDLE_FROM_INVITE_MENU", LUA_NATIVE_NETWORK_NETWORK_GET_CURRENTLY_SELECTED_GAMER_HANDLE_FROM_INVITE_MENU);
-		NETWORK.set_function("NETWORK_SET_CURRENTLY_SELECTED_GAMER_HANDLE_FROM_INVITE_MENU", LUA_NATIVE_NETWORK_NETWORK_SET_CURRENTLY_SELECTED_GAMER_HANDLE_FROM_INVITE_MENU);
-		NETWORK.set_function("NETWORK_SET_INVITE_ON_CALL_FOR_INVITE_MENU", LUA_NATIVE_NETWORK_NETWORK_SET_INVITE_ON_CALL_FOR_INVITE_MENU);
-		NETWORK.set_function("NETWORK_CHECK_DATA_MANAGER_SUCCEEDED_FOR_HANDLE", LUA_NATIVE_NETWORK_NETWORK_CHECK_DATA_MANAGER_SUCCEEDED_FOR_HANDLE);
-		NETWORK.set_function("NETWORK_CHECK_DATA_MANAGER_FOR_HANDLE", LUA_NATIVE_NETWORK_NETWORK_CHECK_DATA_MANAGER_FOR_HANDLE);
-		NETWORK.set_function("NETWORK_SET_INVITE_FAILED_MESSAGE_FOR_INVITE_MENU", LUA_NATIVE_NETWORK_NETWORK_SET_INVITE_FAILED_MESSAGE_FOR_INVITE_MENU);
-		NETWORK.set_function("FILLOUT_PM_PLAYER_LIST", LUA_NATIVE_NETWORK_FILLOUT_PM_PLAYER_LIST);
-		NETWORK.set_function("FILLOUT_PM_PLAYER_LIST_WITH_NAMES", LUA_NATIVE_NETWORK_FILLOUT_PM_PLAYER_LIST_WITH_NAMES);
-		NETWORK.set_function("REFRESH_PLAYER_LIST_STATS", LUA_NATIVE_NETWORK_REFRESH_PLAYER_LIST_STATS);
-		NETWORK.set_function("NETWORK_SET_CURRENT_DATA_MANAGER_HANDLE", LUA_NATIVE_NETWORK_NETWORK_SET_CURRENT_DATA_MANAGER_HANDLE);
-		NETWORK.set_function("NETWORK_IS_IN_PLATFORM_PARTY", LUA_NATIVE_NETWORK_NETWORK_IS_IN_PLATFORM_PARTY);
-		NETWORK.set_function("NETWORK_GET_PLATFORM_PARTY_MEMBER_COUNT", LUA_NATIVE_NETWORK_NETWORK_GET_PLATFORM_PARTY_MEMBER_COUNT);
-		NETWORK.set_function("NETWORK_GET_PLATFORM_PARTY_MEMBERS", LUA_NATIVE_NETWORK_NETWORK_GET_PLATFORM_PARTY_MEMBERS);
-		NETWORK.set_function("NETWORK_IS_IN_PLATFORM_PARTY_CHAT", LUA_NATIVE_NETWORK_NETWORK_IS_IN_PLATFORM_PARTY_CHAT);
-		NETWORK.set_function("NETWORK_IS_CHATTING_IN_PLATFORM_PARTY", LUA_NATIVE_NETWORK_NETWORK_IS_CHATTING_IN_PLATFORM_PARTY);
-		NETWORK.set_function("NETWORK_CAN_QUEUE_FOR_PREVIOUS_SESSION_JOIN", LUA_NATIVE_NETWORK_NETWORK_CAN_QUEUE_FOR_PREVIOUS_SESSION_JOIN);
-		NETWORK.set_function("NETWORK_IS_QUEUING_FOR_SESSION_JOIN", LUA_NATIVE_NETWORK_NETWORK_IS_QUEUING_FOR_SESSION_JOIN);
-		NETWORK.set_function("NETWORK_CLEAR_QUEUED_JOIN_REQUEST", LUA_NATIVE_NETWORK_NETWORK_CLEAR_QUEUED_JOIN_REQUEST);
-		NETWORK.set_function("NETWORK_SEND_QUEUED_JOIN_REQUEST", LUA_NATIVE_NETWORK_NETWORK_SEND_QUEUED_JOIN_REQUEST);
-		NETWORK.set_function("NETWORK_REMOVE_ALL_QUEUED_JOIN_REQUESTS", LUA_NATIVE_NETWORK_NETWORK_REMOVE_ALL_QUEUED_JOIN_REQUESTS);
-		NETWORK.set_function("NETWORK_SEED_RANDOM_NUMBER_GENERATOR", LUA_NATIVE_NETWORK_NETWORK_SEED_RANDOM_NUMBER_GENERATOR);
-		NETWORK.set_function("NETWORK_GET_RANDOM_INT", LUA_NATIVE_NETWORK_NETWORK_GET_RANDOM_INT);
-		NETWORK.set_function("NETWORK_GET_RANDOM_INT_RANGED", LUA_NATIVE_NETWORK_NETWORK_GET_RANDOM_INT_RANGED);
-		NETWORK.set_function("NETWORK_GET_RANDOM_FLOAT_RANGED_", LUA_NATIVE_NETWORK_NETWORK_GET_RANDOM_FLOAT_RANGED_);
-		NETWORK.set_function("NETWORK_PLAYER_IS_CHEATER", LUA_NATIVE_NETWORK_NETWORK_PLAYER_IS_CHEATER);
-		NETWORK.set_function("NETWORK_PLAYER_GET_CHEATER_REASON", LUA_NATIVE_NETWORK_NETWORK_PLAYER_GET_CHEATER_REASON);
-		NETWORK.set_function("NETWORK_PLAYER_IS_BADSPORT", LUA_NATIVE_NETWORK_NETWORK_PLAYER_IS_BADSPORT);
-		NETWORK.set_function("REMOTE_CHEATER_PLAYER_DETECTED", LUA_NATIVE_NETWORK_REMOTE_CHEATER_PLAYER_DETECTED);
-		NETWORK.set_function("BAD_SPORT_PLAYER_LEFT_DETECTED", LUA_NATIVE_NETWORK_BAD_SPORT_PLAYER_LEFT_DETECTED);
-		NETWORK.set_function("NETWORK_ADD_INVALID_OBJECT_MODEL", LUA_NATIVE_NETWORK_NETWORK_ADD_INVALID_OBJECT_MODEL);
-		NETWORK.set_function("NETWORK_REMOVE_INVALID_OBJECT_MODEL", LUA_NATIVE_NETWORK_NETWORK_REMOVE_INVALID_OBJECT_MODEL);
-		NETWORK.set_function("NETWORK_CLEAR_INVALID_OBJECT_MODELS", LUA_NATIVE_NETWORK_NETWORK_CLEAR_INVALID_OBJECT_MODELS);
-		NETWORK.set_function("NETWORK_APPLY_PED_SCAR_DATA", LUA_NATIVE_NETWORK_NETWORK_APPLY_PED_SCAR_DATA);
-		NETWORK.set_function("NETWORK_SET_THIS_SCRIPT_IS_NETWORK_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_SET_THIS_SCRIPT_IS_NETWORK_SCRIPT);
-		NETWORK.set_function("NETWORK_TRY_TO_SET_THIS_SCRIPT_IS_NETWORK_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_TRY_TO_SET_THIS_SCRIPT_IS_NETWORK_SCRIPT);
-		NETWORK.set_function("NETWORK_GET_THIS_SCRIPT_IS_NETWORK_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_GET_THIS_SCRIPT_IS_NETWORK_SCRIPT);
-		NETWORK.set_function("NETWORK_GET_MAX_NUM_PARTICIPANTS", LUA_NATIVE_NETWORK_NETWORK_GET_MAX_NUM_PARTICIPANTS);
-		NETWORK.set_function("NETWORK_GET_NUM_PARTICIPANTS", LUA_NATIVE_NETWORK_NETWORK_GET_NUM_PARTICIPANTS);
-		NETWORK.set_function("NETWORK_GET_SCRIPT_STATUS", LUA_NATIVE_NETWORK_NETWORK_GET_SCRIPT_STATUS);
-		NETWORK.set_function("NETWORK_REGISTER_HOST_BROADCAST_VARIABLES", LUA_NATIVE_NETWORK_NETWORK_REGISTER_HOST_BROADCAST_VARIABLES);
-		NETWORK.set_function("NETWORK_REGISTER_PLAYER_BROADCAST_VARIABLES", LUA_NATIVE_NETWORK_NETWORK_REGISTER_PLAYER_BROADCAST_VARIABLES);
-		NETWORK.set_function("NETWORK_REGISTER_HIGH_FREQUENCY_HOST_BROADCAST_VARIABLES", LUA_NATIVE_NETWORK_NETWORK_REGISTER_HIGH_FREQUENCY_HOST_BROADCAST_VARIABLES);
-		NETWORK.set_function("NETWORK_REGISTER_HIGH_FREQUENCY_PLAYER_BROADCAST_VARIABLES", LUA_NATIVE_NETWORK_NETWORK_REGISTER_HIGH_FREQUENCY_PLAYER_BROADCAST_VARIABLES);
-		NETWORK.set_function("NETWORK_FINISH_BROADCASTING_DATA", LUA_NATIVE_NETWORK_NETWORK_FINISH_BROADCASTING_DATA);
-		NETWORK.set_function("NETWORK_HAS_RECEIVED_HOST_BROADCAST_DATA", LUA_NATIVE_NETWORK_NETWORK_HAS_RECEIVED_HOST_BROADCAST_DATA);
-		NETWORK.set_function("NETWORK_GET_PLAYER_INDEX", LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_INDEX);
-		NETWORK.set_function("NETWORK_GET_PARTICIPANT_INDEX", LUA_NATIVE_NETWORK_NETWORK_GET_PARTICIPANT_INDEX);
-		NETWORK.set_function("NETWORK_GET_PLAYER_INDEX_FROM_PED", LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_INDEX_FROM_PED);
-		NETWORK.set_function("NETWORK_GET_NUM_CONNECTED_PLAYERS", LUA_NATIVE_NETWORK_NETWORK_GET_NUM_CONNECTED_PLAYERS);
-		NETWORK.set_function("NETWORK_IS_PLAYER_CONNECTED", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_CONNECTED);
-		NETWORK.set_function("NETWORK_GET_TOTAL_NUM_PLAYERS", LUA_NATIVE_NETWORK_NETWORK_GET_TOTAL_NUM_PLAYERS);
-		NETWORK.set_function("NETWORK_IS_PARTICIPANT_ACTIVE", LUA_NATIVE_NETWORK_NETWORK_IS_PARTICIPANT_ACTIVE);
-		NETWORK.set_function("NETWORK_IS_PLAYER_ACTIVE", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_ACTIVE);
-		NETWORK.set_function("NETWORK_IS_PLAYER_A_PARTICIPANT", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_A_PARTICIPANT);
-		NETWORK.set_function("NETWORK_IS_HOST_OF_THIS_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_IS_HOST_OF_THIS_SCRIPT);
-		NETWORK.set_function("NETWORK_GET_HOST_OF_THIS_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_GET_HOST_OF_THIS_SCRIPT);
-		NETWORK.set_function("NETWORK_GET_HOST_OF_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_GET_HOST_OF_SCRIPT);
-		NETWORK.set_function("NETWORK_SET_MISSION_FINISHED", LUA_NATIVE_NETWORK_NETWORK_SET_MISSION_FINISHED);
-		NETWORK.set_function("NETWORK_IS_SCRIPT_ACTIVE", LUA_NATIVE_NETWORK_NETWORK_IS_SCRIPT_ACTIVE);
-		NETWORK.set_function("NETWORK_IS_SCRIPT_ACTIVE_BY_HASH", LUA_NATIVE_NETWORK_NETWORK_IS_SCRIPT_ACTIVE_BY_HASH);
-		NETWORK.set_function("NETWORK_IS_THREAD_A_NETWORK_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_IS_THREAD_A_NETWORK_SCRIPT);
-		NETWORK.set_function("NETWORK_GET_NUM_SCRIPT_PARTICIPANTS", LUA_NATIVE_NETWORK_NETWORK_GET_NUM_SCRIPT_PARTICIPANTS);
-		NETWORK.set_function("NETWORK_GET_INSTANCE_ID_OF_THIS_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_GET_INSTANCE_ID_OF_THIS_SCRIPT);
-		NETWORK.set_function("NETWORK_GET_POSITION_HASH_OF_THIS_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_GET_POSITION_HASH_OF_THIS_SCRIPT);
-		NETWORK.set_function("NETWORK_IS_PLAYER_A_PARTICIPANT_ON_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_A_PARTICIPANT_ON_SCRIPT);
-		NETWORK.set_function("NETWORK_PREVENT_SCRIPT_HOST_MIGRATION", LUA_NATIVE_NETWORK_NETWORK_PREVENT_SCRIPT_HOST_MIGRATION);
-		NETWORK.set_function("NETWORK_REQUEST_TO_BE_HOST_OF_THIS_SCRIPT", LUA_NATIVE_NETWORK_NETWORK_REQUEST_TO_BE_HOST_OF_THIS_SCRIPT);
-		NETWORK.set_function("PARTICIPANT_ID", LUA_NATIVE_NETWORK_PARTICIPANT_ID);
-		NETWORK.set_function("PARTICIPANT_ID_TO_INT", LUA_NATIVE_NETWORK_PARTICIPANT_ID_TO_INT);
-		NETWORK.set_function("NETWORK_GET_KILLER_OF_PLAYER", LUA_NATIVE_NETWORK_NETWORK_GET_KILLER_OF_PLAYER);
-		NETWORK.set_function("NETWORK_GET_DESTROYER_OF_NETWORK_ID", LUA_NATIVE_NETWORK_NETWORK_GET_DESTROYER_OF_NETWORK_ID);
-		NETWORK.set_function("NETWORK_GET_DESTROYER_OF_ENTITY", LUA_NATIVE_NETWORK_NETWORK_GET_DESTROYER_OF_ENTITY);
-		NETWORK.set_function("NETWORK_GET_ASSISTED_KILL_OF_ENTITY", LUA_NATIVE_NETWORK_NETWORK_GET_ASSISTED_KILL_OF_ENTITY);
-		NETWORK.set_function("NETWORK_GET_ASSISTED_DAMAGE_OF_ENTITY", LUA_NATIVE_NETWORK_NETWORK_GET_ASSISTED_DAMAGE_OF_ENTITY);
-		NETWORK.set_function("NETWORK_GET_ENTITY_KILLER_OF_PLAYER", LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_KILLER_OF_PLAYER);
-		NETWORK.set_function("NETWORK_SET_CURRENT_PUBLIC_CONTENT_ID", LUA_NATIVE_NETWORK_NETWORK_SET_CURRENT_PUBLIC_CONTENT_ID);
-		NETWORK.set_function("NETWORK_SET_CURRENT_CHAT_OPTION", LUA_NATIVE_NETWORK_NETWORK_SET_CURRENT_CHAT_OPTION);
-		NETWORK.set_function("NETWORK_SET_CURRENT_SPAWN_LOCATION_OPTION", LUA_NATIVE_NETWORK_NETWORK_SET_CURRENT_SPAWN_LOCATION_OPTION);
-		NETWORK.set_function("NETWORK_SET_VEHICLE_DRIVEN_IN_TEST_DRIVE", LUA_NATIVE_NETWORK_NETWORK_SET_VEHICLE_DRIVEN_IN_TEST_DRIVE);
-		NETWORK.set_function("NETWORK_SET_VEHICLE_DRIVEN_LOCATION", LUA_NATIVE_NETWORK_NETWORK_SET_VEHICLE_DRIVEN_LOCATION);
-		NETWORK.set_function("NETWORK_RESURRECT_LOCAL_PLAYER", LUA_NATIVE_NETWORK_NETWORK_RESURRECT_LOCAL_PLAYER);
-		NETWORK.set_function("NETWORK_SET_LOCAL_PLAYER_INVINCIBLE_TIME", LUA_NATIVE_NETWORK_NETWORK_SET_LOCAL_PLAYER_INVINCIBLE_TIME);
-		NETWORK.set_function("NETWORK_IS_LOCAL_PLAYER_INVINCIBLE", LUA_NATIVE_NETWORK_NETWORK_IS_LOCAL_PLAYER_INVINCIBLE);
-		NETWORK.set_function("NETWORK_DISABLE_INVINCIBLE_FLASHING", LUA_NATIVE_NETWORK_NETWORK_DISABLE_INVINCIBLE_FLASHING);
-		NETWORK.set_function("NETWORK_PATCH_POST_CUTSCENE_HS4F_TUN_ENT", LUA_NATIVE_NETWORK_NETWORK_PATCH_POST_CUTSCENE_HS4F_TUN_ENT);
-		NETWORK.set_function("NETWORK_SET_LOCAL_PLAYER_SYNC_LOOK_AT", LUA_NATIVE_NETWORK_NETWORK_SET_LOCAL_PLAYER_SYNC_LOOK_AT);
-		NETWORK.set_function("NETWORK_HAS_ENTITY_BEEN_REGISTERED_WITH_THIS_THREAD", LUA_NATIVE_NETWORK_NETWORK_HAS_ENTITY_BEEN_REGISTERED_WITH_THIS_THREAD);
-		NETWORK.set_function("NETWORK_GET_NETWORK_ID_FROM_ENTITY", LUA_NATIVE_NETWORK_NETWORK_GET_NETWORK_ID_FROM_ENTITY);
-		NETWORK.set_function("NETWORK_GET_ENTITY_FROM_NETWORK_ID", LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_FROM_NETWORK_ID);
-		NETWORK.set_function("NETWORK_GET_ENTITY_IS_NETWORKED", LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_IS_NETWORKED);
-		NETWORK.set_function("NETWORK_GET_ENTITY_IS_LOCAL", LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_IS_LOCAL);
-		NETWORK.set_function("NETWORK_REGISTER_ENTITY_AS_NETWORKED", LUA_NATIVE_NETWORK_NETWORK_REGISTER_ENTITY_AS_NETWORKED);
-		NETWORK.set_function("NETWORK_UNREGISTER_NETWORKED_ENTITY", LUA_NATIVE_NETWORK_NETWORK_UNREGISTER_NETWORKED_ENTITY);
-		NETWORK.set_function("NETWORK_DOES_NETWORK_ID_EXIST", LUA_NATIVE_NETWORK_NETWORK_DOES_NETWORK_ID_EXIST);
-		NETWORK.set_function("NETWORK_DOES_ENTITY_EXIST_WITH_NETWORK_ID", LUA_NATIVE_NETWORK_NETWORK_DOES_ENTITY_EXIST_WITH_NETWORK_ID);
-		NETWORK.set_function("NETWORK_REQUEST_CONTROL_OF_NETWORK_ID", LUA_NATIVE_NETWORK_NETWORK_REQUEST_CONTROL_OF_NETWORK_ID);
-		NETWORK.set_function("NETWORK_HAS_CONTROL_OF_NETWORK_ID", LUA_NATIVE_NETWORK_NETWORK_HAS_CONTROL_OF_NETWORK_ID);
-		NETWORK.set_function("NETWORK_IS_NETWORK_ID_REMOTELY_CONTROLLED", LUA_NATIVE_NETWORK_NETWORK_IS_NETWORK_ID_REMOTELY_CONTROLLED);
-		NETWORK.set_function("NETWORK_REQUEST_CONTROL_OF_ENTITY", LUA_NATIVE_NETWORK_NETWORK_REQUEST_CONTROL_OF_ENTITY);
-		NETWORK.set_function("NETWORK_REQUEST_CONTROL_OF_DOOR", LUA_NATIVE_NETWORK_NETWORK_REQUEST_CONTROL_OF_DOOR);
-		NETWORK.set_function("NETWORK_HAS_CONTROL_OF_ENTITY", LUA_NATIVE_NETWORK_NETWORK_HAS_CONTROL_OF_ENTITY);
-		NETWORK.set_function("NETWORK_HAS_CONTROL_OF_PICKUP", LUA_NATIVE_NETWORK_NETWORK_HAS_CONTROL_OF_PICKUP);
-		NETWORK.set_function("NETWORK_HAS_CONTROL_OF_DOOR", LUA_NATIVE_NETWORK_NETWORK_HAS_CONTROL_OF_DOOR);
-		NETWORK.set_function("NETWORK_IS_DOOR_NETWORKED", LUA_NATIVE_NETWORK_NETWORK_IS_DOOR_NETWORKED);
-		NETWORK.set_function("VEH_TO_NET", LUA_NATIVE_NETWORK_VEH_TO_NET);
-		NETWORK.set_function("PED_TO_NET", LUA_NATIVE_NETWORK_PED_TO_NET);
-		NETWORK.set_function("OBJ_TO_NET", LUA_NATIVE_NETWORK_OBJ_TO_NET);
-		NETWORK.set_function("NET_TO_VEH", LUA_NATIVE_NETWORK_NET_TO_VEH);
-		NETWORK.set_function("NET_TO_PED", LUA_NATIVE_NETWORK_NET_TO_PED);
-		NETWORK.set_function("NET_TO_OBJ", LUA_NATIVE_NETWORK_NET_TO_OBJ);
-		NETWORK.set_function("NET_TO_ENT", LUA_NATIVE_NETWORK_NET_TO_ENT);
-		NETWORK.set_function("NETWORK_GET_LOCAL_HANDLE", LUA_NATIVE_NETWORK_NETWORK_GET_LOCAL_HANDLE);
-		NETWORK.set_function("NETWORK_HANDLE_FROM_USER_ID", LUA_NATIVE_NETWORK_NETWORK_HANDLE_FROM_USER_ID);
-		NETWORK.set_function("NETWORK_HANDLE_FROM_MEMBER_ID", LUA_NATIVE_NETWORK_NETWORK_HANDLE_FROM_MEMBER_ID);
-		NETWORK.set_function("NETWORK_HANDLE_FROM_PLAYER", LUA_NATIVE_NETWORK_NETWORK_HANDLE_FROM_PLAYER);
-		NETWORK.set_function("NETWORK_HASH_FROM_PLAYER_HANDLE", LUA_NATIVE_NETWORK_NETWORK_HASH_FROM_PLAYER_HANDLE);
-		NETWORK.set_function("NETWORK_HASH_FROM_GAMER_HANDLE", LUA_NATIVE_NETWORK_NETWORK_HASH_FROM_GAMER_HANDLE);
-		NETWORK.set_function("NETWORK_HANDLE_FROM_FRIEND", LUA_NATIVE_NETWORK_NETWORK_HANDLE_FROM_FRIEND);
-		NETWORK.set_function("NETWORK_GAMERTAG_FROM_HANDLE_START", LUA_NATIVE_NETWORK_NETWORK_GAMERTAG_FROM_HANDLE_START);
-		NETWORK.set_function("NETWORK_GAMERTAG_FROM_HANDLE_PENDING", LUA_NATIVE_NETWORK_NETWORK_GAMERTAG_FROM_HANDLE_PENDING);
-		NETWORK.set_function("NETWORK_GAMERTAG_FROM_HANDLE_SUCCEEDED", LUA_NATIVE_NETWORK_NETWORK_GAMERTAG_FROM_HANDLE_SUCCEEDED);
-		NETWORK.set_function("NETWORK_GET_GAMERTAG_FROM_HANDLE", LUA_NATIVE_NETWORK_NETWORK_GET_GAMERTAG_FROM_HANDLE);
-		NETWORK.set_function("NETWORK_DISPLAYNAMES_FROM_HANDLES_START", LUA_NATIVE_NETWORK_NETWORK_DISPLAYNAMES_FROM_HANDLES_START);
-		NETWORK.set_function("NETWORK_GET_DISPLAYNAMES_FROM_HANDLES", LUA_NATIVE_NETWORK_NETWORK_GET_DISPLAYNAMES_FROM_HANDLES);
-		NETWORK.set_function("NETWORK_ARE_HANDLES_THE_SAME", LUA_NATIVE_NETWORK_NETWORK_ARE_HANDLES_THE_SAME);
-		NETWORK.set_function("NETWORK_IS_HANDLE_VALID", LUA_NATIVE_NETWORK_NETWORK_IS_HANDLE_VALID);
-		NETWORK.set_function("NETWORK_GET_PLAYER_FROM_GAMER_HANDLE", LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_FROM_GAMER_HANDLE);
-		NETWORK.set_function("NETWORK_MEMBER_ID_FROM_GAMER_HANDLE", LUA_NATIVE_NETWORK_NETWORK_MEMBER_ID_FROM_GAMER_HANDLE);
-		NETWORK.set_function("NETWORK_IS_GAMER_IN_MY_SESSION", LUA_NATIVE_NETWORK_NETWORK_IS_GAMER_IN_MY_SESSION);
-		NETWORK.set_function("NETWORK_SHOW_PROFILE_UI", LUA_NATIVE_NETWORK_NETWORK_SHOW_PROFILE_UI);
-		NETWORK.set_function("NETWORK_PLAYER_GET_NAME", LUA_NATIVE_NETWORK_NETWORK_PLAYER_GET_NAME);
-		NETWORK.set_function("NETWORK_PLAYER_GET_USERID", LUA_NATIVE_NETWORK_NETWORK_PLAYER_GET_USERID);
-		NETWORK.set_function("NETWORK_PLAYER_IS_ROCKSTAR_DEV", LUA_NATIVE_NETWORK_NETWORK_PLAYER_IS_ROCKSTAR_DEV);
-		NETWORK.set_function("NETWORK_PLAYER_INDEX_IS_CHEATER", LUA_NATIVE_NETWORK_NETWORK_PLAYER_INDEX_IS_CHEATER);
-		NETWORK.set_function("NETWORK_ENTITY_GET_OBJECT_ID", LUA_NATIVE_NETWORK_NETWORK_ENTITY_GET_OBJECT_ID);
-		NETWORK.set_function("NETWORK_GET_ENTITY_FROM_OBJECT_ID", LUA_NATIVE_NETWORK_NETWORK_GET_ENTITY_FROM_OBJECT_ID);
-		NETWORK.set_function("NETWORK_IS_INACTIVE_PROFILE", LUA_NATIVE_NETWORK_NETWORK_IS_INACTIVE_PROFILE);
-		NETWORK.set_function("NETWORK_GET_MAX_FRIENDS", LUA_NATIVE_NETWORK_NETWORK_GET_MAX_FRIENDS);
-		NETWORK.set_function("NETWORK_GET_FRIEND_COUNT", LUA_NATIVE_NETWORK_NETWORK_GET_FRIEND_COUNT);
-		NETWORK.set_function("NETWORK_GET_FRIEND_NAME", LUA_NATIVE_NETWORK_NETWORK_GET_FRIEND_NAME);
-		NETWORK.set_function("NETWORK_GET_FRIEND_DISPLAY_NAME", LUA_NATIVE_NETWORK_NETWORK_GET_FRIEND_DISPLAY_NAME);
-		NETWORK.set_function("NETWORK_IS_FRIEND_ONLINE", LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_ONLINE);
-		NETWORK.set_function("NETWORK_IS_FRIEND_HANDLE_ONLINE", LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_HANDLE_ONLINE);
-		NETWORK.set_function("NETWORK_IS_FRIEND_IN_SAME_TITLE", LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_IN_SAME_TITLE);
-		NETWORK.set_function("NETWORK_IS_FRIEND_IN_MULTIPLAYER", LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_IN_MULTIPLAYER);
-		NETWORK.set_function("NETWORK_IS_FRIEND", LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND);
-		NETWORK.set_function("NETWORK_IS_PENDING_FRIEND", LUA_NATIVE_NETWORK_NETWORK_IS_PENDING_FRIEND);
-		NETWORK.set_function("NETWORK_IS_ADDING_FRIEND", LUA_NATIVE_NETWORK_NETWORK_IS_ADDING_FRIEND);
-		NETWORK.set_function("NETWORK_ADD_FRIEND", LUA_NATIVE_NETWORK_NETWORK_ADD_FRIEND);
-		NETWORK.set_function("NETWORK_IS_FRIEND_INDEX_ONLINE", LUA_NATIVE_NETWORK_NETWORK_IS_FRIEND_INDEX_ONLINE);
-		NETWORK.set_function("NETWORK_SET_PLAYER_IS_PASSIVE", LUA_NATIVE_NETWORK_NETWORK_SET_PLAYER_IS_PASSIVE);
-		NETWORK.set_function("NETWORK_GET_PLAYER_OWNS_WAYPOINT", LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_OWNS_WAYPOINT);
-		NETWORK.set_function("NETWORK_CAN_SET_WAYPOINT", LUA_NATIVE_NETWORK_NETWORK_CAN_SET_WAYPOINT);
-		NETWORK.set_function("NETWORK_IGNORE_REMOTE_WAYPOINTS", LUA_NATIVE_NETWORK_NETWORK_IGNORE_REMOTE_WAYPOINTS);
-		NETWORK.set_function("NETWORK_DOES_COMMUNICATION_GROUP_EXIST_", LUA_NATIVE_NETWORK_NETWORK_DOES_COMMUNICATION_GROUP_EXIST_);
-		NETWORK.set_function("NETWORK_GET_COMMUNICATION_GROUP_FLAGS_", LUA_NATIVE_NETWORK_NETWORK_GET_COMMUNICATION_GROUP_FLAGS_);
-		NETWORK.set_function("NETWORK_SET_COMMUNICATION_GROUP_FLAGS_", LUA_NATIVE_NETWORK_NETWORK_SET_COMMUNICATION_GROUP_FLAGS_);
-		NETWORK.set_function("NETWORK_IS_PLAYER_ON_BLOCKLIST", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_ON_BLOCKLIST);
-		NETWORK.set_function("NETWORK_SET_SCRIPT_AUTOMUTED", LUA_NATIVE_NETWORK_NETWORK_SET_SCRIPT_AUTOMUTED);
-		NETWORK.set_function("NETWORK_HAS_AUTOMUTE_OVERRIDE", LUA_NATIVE_NETWORK_NETWORK_HAS_AUTOMUTE_OVERRIDE);
-		NETWORK.set_function("NETWORK_HAS_HEADSET", LUA_NATIVE_NETWORK_NETWORK_HAS_HEADSET);
-		NETWORK.set_function("NETWORK_SET_LOOK_AT_TALKERS", LUA_NATIVE_NETWORK_NETWORK_SET_LOOK_AT_TALKERS);
-		NETWORK.set_function("NETWORK_IS_PUSH_TO_TALK_ACTIVE", LUA_NATIVE_NETWORK_NETWORK_IS_PUSH_TO_TALK_ACTIVE);
-		NETWORK.set_function("NETWORK_GAMER_HAS_HEADSET", LUA_NATIVE_NETWORK_NETWORK_GAMER_HAS_HEADSET);
-		NETWORK.set_function("NETWORK_IS_GAMER_TALKING", LUA_NATIVE_NETWORK_NETWORK_IS_GAMER_TALKING);
-		NETWORK.set_function("NETWORK_PERMISSIONS_HAS_GAMER_RECORD", LUA_NATIVE_NETWORK_NETWORK_PERMISSIONS_HAS_GAMER_RECORD);
-		NETWORK.set_function("NETWORK_CAN_COMMUNICATE_WITH_GAMER", LUA_NATIVE_NETWORK_NETWORK_CAN_COMMUNICATE_WITH_GAMER);
-		NETWORK.set_function("NETWORK_CAN_TEXT_CHAT_WITH_GAMER", LUA_NATIVE_NETWORK_NETWORK_CAN_TEXT_CHAT_WITH_GAMER);
-		NETWORK.set_function("NETWORK_IS_GAMER_MUTED_BY_ME", LUA_NATIVE_NETWORK_NETWORK_IS_GAMER_MUTED_BY_ME);
-		NETWORK.set_function("NETWORK_AM_I_MUTED_BY_GAMER", LUA_NATIVE_NETWORK_NETWORK_AM_I_MUTED_BY_GAMER);
-		NETWORK.set_function("NETWORK_IS_GAMER_BLOCKED_BY_ME", LUA_NATIVE_NETWORK_NETWORK_IS_GAMER_BLOCKED_BY_ME);
-		NETWORK.set_function("NETWORK_AM_I_BLOCKED_BY_GAMER", LUA_NATIVE_NETWORK_NETWORK_AM_I_BLOCKED_BY_GAMER);
-		NETWORK.set_function("NETWORK_CAN_VIEW_GAMER_USER_CONTENT", LUA_NATIVE_NETWORK_NETWORK_CAN_VIEW_GAMER_USER_CONTENT);
-		NETWORK.set_function("NETWORK_HAS_VIEW_GAMER_USER_CONTENT_RESULT", LUA_NATIVE_NETWORK_NETWORK_HAS_VIEW_GAMER_USER_CONTENT_RESULT);
-		NETWORK.set_function("NETWORK_CAN_PLAY_MULTIPLAYER_WITH_GAMER", LUA_NATIVE_NETWORK_NETWORK_CAN_PLAY_MULTIPLAYER_WITH_GAMER);
-		NETWORK.set_function("NETWORK_CAN_GAMER_PLAY_MULTIPLAYER_WITH_ME", LUA_NATIVE_NETWORK_NETWORK_CAN_GAMER_PLAY_MULTIPLAYER_WITH_ME);
-		NETWORK.set_function("NETWORK_CAN_SEND_LOCAL_INVITE", LUA_NATIVE_NETWORK_NETWORK_CAN_SEND_LOCAL_INVITE);
-		NETWORK.set_function("NETWORK_CAN_RECEIVE_LOCAL_INVITE", LUA_NATIVE_NETWORK_NETWORK_CAN_RECEIVE_LOCAL_INVITE);
-		NETWORK.set_function("NETWORK_IS_PLAYER_TALKING", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_TALKING);
-		NETWORK.set_function("NETWORK_PLAYER_HAS_HEADSET", LUA_NATIVE_NETWORK_NETWORK_PLAYER_HAS_HEADSET);
-		NETWORK.set_function("NETWORK_IS_PLAYER_MUTED_BY_ME", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_MUTED_BY_ME);
-		NETWORK.set_function("NETWORK_AM_I_MUTED_BY_PLAYER", LUA_NATIVE_NETWORK_NETWORK_AM_I_MUTED_BY_PLAYER);
-		NETWORK.set_function("NETWORK_IS_PLAYER_BLOCKED_BY_ME", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_BLOCKED_BY_ME);
-		NETWORK.set_function("NETWORK_AM_I_BLOCKED_BY_PLAYER", LUA_NATIVE_NETWORK_NETWORK_AM_I_BLOCKED_BY_PLAYER);
-		NETWORK.set_function("NETWORK_GET_PLAYER_LOUDNESS", LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_LOUDNESS);
-		NETWORK.set_function("NETWORK_SET_TALKER_PROXIMITY", LUA_NATIVE_NETWORK_NETWORK_SET_TALKER_PROXIMITY);
-		NETWORK.set_function("NETWORK_GET_TALKER_PROXIMITY", LUA_NATIVE_NETWORK_NETWORK_GET_TALKER_PROXIMITY);
-		NETWORK.set_function("NETWORK_SET_VOICE_ACTIVE", LUA_NATIVE_NETWORK_NETWORK_SET_VOICE_ACTIVE);
-		NETWORK.set_function("NETWORK_REMAIN_IN_GAME_CHAT", LUA_NATIVE_NETWORK_NETWORK_REMAIN_IN_GAME_CHAT);
-		NETWORK.set_function("NETWORK_OVERRIDE_TRANSITION_CHAT", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_TRANSITION_CHAT);
-		NETWORK.set_function("NETWORK_SET_TEAM_ONLY_CHAT", LUA_NATIVE_NETWORK_NETWORK_SET_TEAM_ONLY_CHAT);
-		NETWORK.set_function("NETWORK_SET_SCRIPT_CONTROLLING_TEAMS", LUA_NATIVE_NETWORK_NETWORK_SET_SCRIPT_CONTROLLING_TEAMS);
-		NETWORK.set_function("NETWORK_SET_SAME_TEAM_AS_LOCAL_PLAYER", LUA_NATIVE_NETWORK_NETWORK_SET_SAME_TEAM_AS_LOCAL_PLAYER);
-		NETWORK.set_function("NETWORK_OVERRIDE_TEAM_RESTRICTIONS", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_TEAM_RESTRICTIONS);
-		NETWORK.set_function("NETWORK_SET_OVERRIDE_SPECTATOR_MODE", LUA_NATIVE_NETWORK_NETWORK_SET_OVERRIDE_SPECTATOR_MODE);
-		NETWORK.set_function("NETWORK_SET_OVERRIDE_TUTORIAL_SESSION_CHAT", LUA_NATIVE_NETWORK_NETWORK_SET_OVERRIDE_TUTORIAL_SESSION_CHAT);
-		NETWORK.set_function("NETWORK_SET_PROXIMITY_AFFECTS_TEAM", LUA_NATIVE_NETWORK_NETWORK_SET_PROXIMITY_AFFECTS_TEAM);
-		NETWORK.set_function("NETWORK_SET_NO_SPECTATOR_CHAT", LUA_NATIVE_NETWORK_NETWORK_SET_NO_SPECTATOR_CHAT);
-		NETWORK.set_function("NETWORK_SET_IGNORE_SPECTATOR_CHAT_LIMITS_SAME_TEAM", LUA_NATIVE_NETWORK_NETWORK_SET_IGNORE_SPECTATOR_CHAT_LIMITS_SAME_TEAM);
-		NETWORK.set_function("NETWORK_OVERRIDE_CHAT_RESTRICTIONS", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_CHAT_RESTRICTIONS);
-		NETWORK.set_function("NETWORK_OVERRIDE_SEND_RESTRICTIONS", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_SEND_RESTRICTIONS);
-		NETWORK.set_function("NETWORK_OVERRIDE_SEND_RESTRICTIONS_ALL", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_SEND_RESTRICTIONS_ALL);
-		NETWORK.set_function("NETWORK_OVERRIDE_RECEIVE_RESTRICTIONS", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_RECEIVE_RESTRICTIONS);
-		NETWORK.set_function("NETWORK_OVERRIDE_RECEIVE_RESTRICTIONS_ALL", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_RECEIVE_RESTRICTIONS_ALL);
-		NETWORK.set_function("NETWORK_SET_VOICE_CHANNEL", LUA_NATIVE_NETWORK_NETWORK_SET_VOICE_CHANNEL);
-		NETWORK.set_function("NETWORK_CLEAR_VOICE_CHANNEL", LUA_NATIVE_NETWORK_NETWORK_CLEAR_VOICE_CHANNEL);
-		NETWORK.set_function("NETWORK_APPLY_VOICE_PROXIMITY_OVERRIDE", LUA_NATIVE_NETWORK_NETWORK_APPLY_VOICE_PROXIMITY_OVERRIDE);
-		NETWORK.set_function("NETWORK_CLEAR_VOICE_PROXIMITY_OVERRIDE", LUA_NATIVE_NETWORK_NETWORK_CLEAR_VOICE_PROXIMITY_OVERRIDE);
-		NETWORK.set_function("NETWORK_ENABLE_VOICE_BANDWIDTH_RESTRICTION", LUA_NATIVE_NETWORK_NETWORK_ENABLE_VOICE_BANDWIDTH_RESTRICTION);
-		NETWORK.set_function("NETWORK_DISABLE_VOICE_BANDWIDTH_RESTRICTION", LUA_NATIVE_NETWORK_NETWORK_DISABLE_VOICE_BANDWIDTH_RESTRICTION);
-		NETWORK.set_function("NETWORK_GET_MUTE_COUNT_FOR_PLAYER", LUA_NATIVE_NETWORK_NETWORK_GET_MUTE_COUNT_FOR_PLAYER);
-		NETWORK.set_function("NETWORK_SET_SPECTATOR_TO_NON_SPECTATOR_TEXT_CHAT", LUA_NATIVE_NETWORK_NETWORK_SET_SPECTATOR_TO_NON_SPECTATOR_TEXT_CHAT);
-		NETWORK.set_function("NETWORK_TEXT_CHAT_IS_TYPING", LUA_NATIVE_NETWORK_NETWORK_TEXT_CHAT_IS_TYPING);
-		NETWORK.set_function("SHUTDOWN_AND_LAUNCH_SINGLE_PLAYER_GAME", LUA_NATIVE_NETWORK_SHUTDOWN_AND_LAUNCH_SINGLE_PLAYER_GAME);
-		NETWORK.set_function("SHUTDOWN_AND_LOAD_MOST_RECENT_SAVE", LUA_NATIVE_NETWORK_SHUTDOWN_AND_LOAD_MOST_RECENT_SAVE);
-		NETWORK.set_function("NETWORK_SET_FRIENDLY_FIRE_OPTION", LUA_NATIVE_NETWORK_NETWORK_SET_FRIENDLY_FIRE_OPTION);
-		NETWORK.set_function("NETWORK_SET_RICH_PRESENCE", LUA_NATIVE_NETWORK_NETWORK_SET_RICH_PRESENCE);
-		NETWORK.set_function("NETWORK_SET_RICH_PRESENCE_STRING", LUA_NATIVE_NETWORK_NETWORK_SET_RICH_PRESENCE_STRING);
-		NETWORK.set_function("NETWORK_GET_TIMEOUT_TIME", LUA_NATIVE_NETWORK_NETWORK_GET_TIMEOUT_TIME);
-		NETWORK.set_function("NETWORK_LEAVE_PED_BEHIND_BEFORE_WARP", LUA_NATIVE_NETWORK_NETWORK_LEAVE_PED_BEHIND_BEFORE_WARP);
-		NETWORK.set_function("NETWORK_LEAVE_PED_BEHIND_BEFORE_CUTSCENE", LUA_NATIVE_NETWORK_NETWORK_LEAVE_PED_BEHIND_BEFORE_CUTSCENE);
-		NETWORK.set_function("REMOVE_ALL_STICKY_BOMBS_FROM_ENTITY", LUA_NATIVE_NETWORK_REMOVE_ALL_STICKY_BOMBS_FROM_ENTITY);
-		NETWORK.set_function("NETWORK_KEEP_ENTITY_COLLISION_DISABLED_AFTER_ANIM_SCENE", LUA_NATIVE_NETWORK_NETWORK_KEEP_ENTITY_COLLISION_DISABLED_AFTER_ANIM_SCENE);
-		NETWORK.set_function("NETWORK_IS_ANY_PLAYER_NEAR", LUA_NATIVE_NETWORK_NETWORK_IS_ANY_PLAYER_NEAR);
-		NETWORK.set_function("NETWORK_CLAN_SERVICE_IS_VALID", LUA_NATIVE_NETWORK_NETWORK_CLAN_SERVICE_IS_VALID);
-		NETWORK.set_function("NETWORK_CLAN_PLAYER_IS_ACTIVE", LUA_NATIVE_NETWORK_NETWORK_CLAN_PLAYER_IS_ACTIVE);
-		NETWORK.set_function("NETWORK_CLAN_PLAYER_GET_DESC", LUA_NATIVE_NETWORK_NETWORK_CLAN_PLAYER_GET_DESC);
-		NETWORK.set_function("NETWORK_CLAN_IS_ROCKSTAR_CLAN", LUA_NATIVE_NETWORK_NETWORK_CLAN_IS_ROCKSTAR_CLAN);
-		NETWORK.set_function("NETWORK_CLAN_GET_UI_FORMATTED_TAG", LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_UI_FORMATTED_TAG);
-		NETWORK.set_function("NETWORK_CLAN_GET_LOCAL_MEMBERSHIPS_COUNT", LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_LOCAL_MEMBERSHIPS_COUNT);
-		NETWORK.set_function("NETWORK_CLAN_GET_MEMBERSHIP_DESC", LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_MEMBERSHIP_DESC);
-		NETWORK.set_function("NETWORK_CLAN_DOWNLOAD_MEMBERSHIP", LUA_NATIVE_NETWORK_NETWORK_CLAN_DOWNLOAD_MEMBERSHIP);
-		NETWORK.set_function("NETWORK_CLAN_DOWNLOAD_MEMBERSHIP_PENDING", LUA_NATIVE_NETWORK_NETWORK_CLAN_DOWNLOAD_MEMBERSHIP_PENDING);
-		NETWORK.set_function("NETWORK_CLAN_ANY_DOWNLOAD_MEMBERSHIP_PENDING", LUA_NATIVE_NETWORK_NETWORK_CLAN_ANY_DOWNLOAD_MEMBERSHIP_PENDING);
-		NETWORK.set_function("NETWORK_CLAN_REMOTE_MEMBERSHIPS_ARE_IN_CACHE", LUA_NATIVE_NETWORK_NETWORK_CLAN_REMOTE_MEMBERSHIPS_ARE_IN_CACHE);
-		NETWORK.set_function("NETWORK_CLAN_GET_MEMBERSHIP_COUNT", LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_MEMBERSHIP_COUNT);
-		NETWORK.set_function("NETWORK_CLAN_GET_MEMBERSHIP_VALID", LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_MEMBERSHIP_VALID);
-		NETWORK.set_function("NETWORK_CLAN_GET_MEMBERSHIP", LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_MEMBERSHIP);
-		NETWORK.set_function("NETWORK_CLAN_JOIN", LUA_NATIVE_NETWORK_NETWORK_CLAN_JOIN);
-		NETWORK.set_function("NETWORK_CLAN_CREWINFO_GET_STRING_VALUE", LUA_NATIVE_NETWORK_NETWORK_CLAN_CREWINFO_GET_STRING_VALUE);
-		NETWORK.set_function("NETWORK_CLAN_CREWINFO_GET_CREWRANKTITLE", LUA_NATIVE_NETWORK_NETWORK_CLAN_CREWINFO_GET_CREWRANKTITLE);
-		NETWORK.set_function("NETWORK_CLAN_HAS_CREWINFO_METADATA_BEEN_RECEIVED", LUA_NATIVE_NETWORK_NETWORK_CLAN_HAS_CREWINFO_METADATA_BEEN_RECEIVED);
-		NETWORK.set_function("NETWORK_CLAN_GET_EMBLEM_TXD_NAME", LUA_NATIVE_NETWORK_NETWORK_CLAN_GET_EMBLEM_TXD_NAME);
-		NETWORK.set_function("NETWORK_CLAN_REQUEST_EMBLEM", LUA_NATIVE_NETWORK_NETWORK_CLAN_REQUEST_EMBLEM);
-		NETWORK.set_function("NETWORK_CLAN_IS_EMBLEM_READY", LUA_NATIVE_NETWORK_NETWORK_CLAN_IS_EMBLEM_READY);
-		NETWORK.set_function("NETWORK_CLAN_RELEASE_EMBLEM", LUA_NATIVE_NETWORK_NETWORK_CLAN_RELEASE_EMBLEM);
-		NETWORK.set_function("NETWORK_GET_PRIMARY_CLAN_DATA_CLEAR", LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_CLEAR);
-		NETWORK.set_function("NETWORK_GET_PRIMARY_CLAN_DATA_CANCEL", LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_CANCEL);
-		NETWORK.set_function("NETWORK_GET_PRIMARY_CLAN_DATA_START", LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_START);
-		NETWORK.set_function("NETWORK_GET_PRIMARY_CLAN_DATA_PENDING", LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_PENDING);
-		NETWORK.set_function("NETWORK_GET_PRIMARY_CLAN_DATA_SUCCESS", LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_SUCCESS);
-		NETWORK.set_function("NETWORK_GET_PRIMARY_CLAN_DATA_NEW", LUA_NATIVE_NETWORK_NETWORK_GET_PRIMARY_CLAN_DATA_NEW);
-		NETWORK.set_function("SET_NETWORK_ID_CAN_MIGRATE", LUA_NATIVE_NETWORK_SET_NETWORK_ID_CAN_MIGRATE);
-		NETWORK.set_function("SET_NETWORK_ID_EXISTS_ON_ALL_MACHINES", LUA_NATIVE_NETWORK_SET_NETWORK_ID_EXISTS_ON_ALL_MACHINES);
-		NETWORK.set_function("SET_NETWORK_ID_ALWAYS_EXISTS_FOR_PLAYER", LUA_NATIVE_NETWORK_SET_NETWORK_ID_ALWAYS_EXISTS_FOR_PLAYER);
-		NETWORK.set_function("SET_NETWORK_ID_CAN_BE_REASSIGNED", LUA_NATIVE_NETWORK_SET_NETWORK_ID_CAN_BE_REASSIGNED);
-		NETWORK.set_function("NETWORK_SET_ENTITY_CAN_BLEND", LUA_NATIVE_NETWORK_NETWORK_SET_ENTITY_CAN_BLEND);
-		NETWORK.set_function("NETWORK_SET_OBJECT_CAN_BLEND_WHEN_FIXED", LUA_NATIVE_NETWORK_NETWORK_SET_OBJECT_CAN_BLEND_WHEN_FIXED);
-		NETWORK.set_function("NETWORK_SET_ENTITY_ONLY_EXISTS_FOR_PARTICIPANTS", LUA_NATIVE_NETWORK_NETWORK_SET_ENTITY_ONLY_EXISTS_FOR_PARTICIPANTS);
-		NETWORK.set_function("SET_NETWORK_ID_VISIBLE_IN_CUTSCENE", LUA_NATIVE_NETWORK_SET_NETWORK_ID_VISIBLE_IN_CUTSCENE);
-		NETWORK.set_function("SET_NETWORK_ID_VISIBLE_IN_CUTSCENE_HACK", LUA_NATIVE_NETWORK_SET_NETWORK_ID_VISIBLE_IN_CUTSCENE_HACK);
-		NETWORK.set_function("SET_NETWORK_ID_VISIBLE_IN_CUTSCENE_REMAIN_HACK", LUA_NATIVE_NETWORK_SET_NETWORK_ID_VISIBLE_IN_CUTSCENE_REMAIN_HACK);
-		NETWORK.set_function("SET_NETWORK_CUTSCENE_ENTITIES", LUA_NATIVE_NETWORK_SET_NETWORK_CUTSCENE_ENTITIES);
-		NETWORK.set_function("ARE_CUTSCENE_ENTITIES_NETWORKED", LUA_NATIVE_NETWORK_ARE_CUTSCENE_ENTITIES_NETWORKED);
-		NETWORK.set_function("SET_NETWORK_ID_PASS_CONTROL_IN_TUTORIAL", LUA_NATIVE_NETWORK_SET_NETWORK_ID_PASS_CONTROL_IN_TUTORIAL);
-		NETWORK.set_function("IS_NETWORK_ID_OWNED_BY_PARTICIPANT", LUA_NATIVE_NETWORK_IS_NETWORK_ID_OWNED_BY_PARTICIPANT);
-		NETWORK.set_function("SET_REMOTE_PLAYER_VISIBLE_IN_CUTSCENE", LUA_NATIVE_NETWORK_SET_REMOTE_PLAYER_VISIBLE_IN_CUTSCENE);
-		NETWORK.set_function("SET_LOCAL_PLAYER_VISIBLE_IN_CUTSCENE", LUA_NATIVE_NETWORK_SET_LOCAL_PLAYER_VISIBLE_IN_CUTSCENE);
-		NETWORK.set_function("SET_LOCAL_PLAYER_INVISIBLE_LOCALLY", LUA_NATIVE_NETWORK_SET_LOCAL_PLAYER_INVISIBLE_LOCALLY);
-		NETWORK.set_function("SET_LOCAL_PLAYER_VISIBLE_LOCALLY", LUA_NATIVE_NETWORK_SET_LOCAL_PLAYER_VISIBLE_LOCALLY);
-		NETWORK.set_function("SET_PLAYER_INVISIBLE_LOCALLY", LUA_NATIVE_NETWORK_SET_PLAYER_INVISIBLE_LOCALLY);
-		NETWORK.set_function("SET_PLAYER_VISIBLE_LOCALLY", LUA_NATIVE_NETWORK_SET_PLAYER_VISIBLE_LOCALLY);
-		NETWORK.set_function("FADE_OUT_LOCAL_PLAYER", LUA_NATIVE_NETWORK_FADE_OUT_LOCAL_PLAYER);
-		NETWORK.set_function("NETWORK_FADE_OUT_ENTITY", LUA_NATIVE_NETWORK_NETWORK_FADE_OUT_ENTITY);
-		NETWORK.set_function("NETWORK_FADE_IN_ENTITY", LUA_NATIVE_NETWORK_NETWORK_FADE_IN_ENTITY);
-		NETWORK.set_function("NETWORK_IS_PLAYER_FADING", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_FADING);
-		NETWORK.set_function("NETWORK_IS_ENTITY_FADING", LUA_NATIVE_NETWORK_NETWORK_IS_ENTITY_FADING);
-		NETWORK.set_function("IS_PLAYER_IN_CUTSCENE", LUA_NATIVE_NETWORK_IS_PLAYER_IN_CUTSCENE);
-		NETWORK.set_function("SET_ENTITY_VISIBLE_IN_CUTSCENE", LUA_NATIVE_NETWORK_SET_ENTITY_VISIBLE_IN_CUTSCENE);
-		NETWORK.set_function("SET_ENTITY_LOCALLY_INVISIBLE", LUA_NATIVE_NETWORK_SET_ENTITY_LOCALLY_INVISIBLE);
-		NETWORK.set_function("SET_ENTITY_LOCALLY_VISIBLE", LUA_NATIVE_NETWORK_SET_ENTITY_LOCALLY_VISIBLE);
-		NETWORK.set_function("IS_DAMAGE_TRACKER_ACTIVE_ON_NETWORK_ID", LUA_NATIVE_NETWORK_IS_DAMAGE_TRACKER_ACTIVE_ON_NETWORK_ID);
-		NETWORK.set_function("ACTIVATE_DAMAGE_TRACKER_ON_NETWORK_ID", LUA_NATIVE_NETWORK_ACTIVATE_DAMAGE_TRACKER_ON_NETWORK_ID);
-		NETWORK.set_function("IS_DAMAGE_TRACKER_ACTIVE_ON_PLAYER", LUA_NATIVE_NETWORK_IS_DAMAGE_TRACKER_ACTIVE_ON_PLAYER);
-		NETWORK.set_function("ACTIVATE_DAMAGE_TRACKER_ON_PLAYER", LUA_NATIVE_NETWORK_ACTIVATE_DAMAGE_TRACKER_ON_PLAYER);
-		NETWORK.set_function("IS_SPHERE_VISIBLE_TO_ANOTHER_MACHINE", LUA_NATIVE_NETWORK_IS_SPHERE_VISIBLE_TO_ANOTHER_MACHINE);
-		NETWORK.set_function("IS_SPHERE_VISIBLE_TO_PLAYER", LUA_NATIVE_NETWORK_IS_SPHERE_VISIBLE_TO_PLAYER);
-		NETWORK.set_function("RESERVE_NETWORK_MISSION_OBJECTS", LUA_NATIVE_NETWORK_RESERVE_NETWORK_MISSION_OBJECTS);
-		NETWORK.set_function("RESERVE_NETWORK_MISSION_PEDS", LUA_NATIVE_NETWORK_RESERVE_NETWORK_MISSION_PEDS);
-		NETWORK.set_function("RESERVE_NETWORK_MISSION_VEHICLES", LUA_NATIVE_NETWORK_RESERVE_NETWORK_MISSION_VEHICLES);
-		NETWORK.set_function("RESERVE_LOCAL_NETWORK_MISSION_OBJECTS", LUA_NATIVE_NETWORK_RESERVE_LOCAL_NETWORK_MISSION_OBJECTS);
-		NETWORK.set_function("RESERVE_LOCAL_NETWORK_MISSION_PEDS", LUA_NATIVE_NETWORK_RESERVE_LOCAL_NETWORK_MISSION_PEDS);
-		NETWORK.set_function("RESERVE_LOCAL_NETWORK_MISSION_VEHICLES", LUA_NATIVE_NETWORK_RESERVE_LOCAL_NETWORK_MISSION_VEHICLES);
-		NETWORK.set_function("CAN_REGISTER_MISSION_OBJECTS", LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_OBJECTS);
-		NETWORK.set_function("CAN_REGISTER_MISSION_PEDS", LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_PEDS);
-		NETWORK.set_function("CAN_REGISTER_MISSION_VEHICLES", LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_VEHICLES);
-		NETWORK.set_function("CAN_REGISTER_MISSION_PICKUPS", LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_PICKUPS);
-		NETWORK.set_function("CAN_REGISTER_MISSION_DOORS", LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_DOORS);
-		NETWORK.set_function("CAN_REGISTER_MISSION_ENTITIES", LUA_NATIVE_NETWORK_CAN_REGISTER_MISSION_ENTITIES);
-		NETWORK.set_function("GET_NUM_RESERVED_MISSION_OBJECTS", LUA_NATIVE_NETWORK_GET_NUM_RESERVED_MISSION_OBJECTS);
-		NETWORK.set_function("GET_NUM_RESERVED_MISSION_PEDS", LUA_NATIVE_NETWORK_GET_NUM_RESERVED_MISSION_PEDS);
-		NETWORK.set_function("GET_NUM_RESERVED_MISSION_VEHICLES", LUA_NATIVE_NETWORK_GET_NUM_RESERVED_MISSION_VEHICLES);
-		NETWORK.set_function("GET_NUM_CREATED_MISSION_OBJECTS", LUA_NATIVE_NETWORK_GET_NUM_CREATED_MISSION_OBJECTS);
-		NETWORK.set_function("GET_NUM_CREATED_MISSION_PEDS", LUA_NATIVE_NETWORK_GET_NUM_CREATED_MISSION_PEDS);
-		NETWORK.set_function("GET_NUM_CREATED_MISSION_VEHICLES", LUA_NATIVE_NETWORK_GET_NUM_CREATED_MISSION_VEHICLES);
-		NETWORK.set_function("GET_RESERVED_MISSION_ENTITIES_IN_AREA", LUA_NATIVE_NETWORK_GET_RESERVED_MISSION_ENTITIES_IN_AREA);
-		NETWORK.set_function("GET_MAX_NUM_NETWORK_OBJECTS", LUA_NATIVE_NETWORK_GET_MAX_NUM_NETWORK_OBJECTS);
-		NETWORK.set_function("GET_MAX_NUM_NETWORK_PEDS", LUA_NATIVE_NETWORK_GET_MAX_NUM_NETWORK_PEDS);
-		NETWORK.set_function("GET_MAX_NUM_NETWORK_VEHICLES", LUA_NATIVE_NETWORK_GET_MAX_NUM_NETWORK_VEHICLES);
-		NETWORK.set_function("GET_MAX_NUM_NETWORK_PICKUPS", LUA_NATIVE_NETWORK_GET_MAX_NUM_NETWORK_PICKUPS);
-		NETWORK.set_function("NETWORK_SET_OBJECT_SCOPE_DISTANCE", LUA_NATIVE_NETWORK_NETWORK_SET_OBJECT_SCOPE_DISTANCE);
-		NETWORK.set_function("NETWORK_ALLOW_CLONING_WHILE_IN_TUTORIAL", LUA_NATIVE_NETWORK_NETWORK_ALLOW_CLONING_WHILE_IN_TUTORIAL);
-		NETWORK.set_function("NETWORK_SET_TASK_CUTSCENE_INSCOPE_MULTIPLER", LUA_NATIVE_NETWORK_NETWORK_SET_TASK_CUTSCENE_INSCOPE_MULTIPLER);
-		NETWORK.set_function("GET_NETWORK_TIME", LUA_NATIVE_NETWORK_GET_NETWORK_TIME);
-		NETWORK.set_function("GET_NETWORK_TIME_ACCURATE", LUA_NATIVE_NETWORK_GET_NETWORK_TIME_ACCURATE);
-		NETWORK.set_function("HAS_NETWORK_TIME_STARTED", LUA_NATIVE_NETWORK_HAS_NETWORK_TIME_STARTED);
-		NETWORK.set_function("GET_TIME_OFFSET", LUA_NATIVE_NETWORK_GET_TIME_OFFSET);
-		NETWORK.set_function("IS_TIME_LESS_THAN", LUA_NATIVE_NETWORK_IS_TIME_LESS_THAN);
-		NETWORK.set_function("IS_TIME_MORE_THAN", LUA_NATIVE_NETWORK_IS_TIME_MORE_THAN);
-		NETWORK.set_function("IS_TIME_EQUAL_TO", LUA_NATIVE_NETWORK_IS_TIME_EQUAL_TO);
-		NETWORK.set_function("GET_TIME_DIFFERENCE", LUA_NATIVE_NETWORK_GET_TIME_DIFFERENCE);
-		NETWORK.set_function("GET_TIME_AS_STRING", LUA_NATIVE_NETWORK_GET_TIME_AS_STRING);
-		NETWORK.set_function("GET_CLOUD_TIME_AS_STRING", LUA_NATIVE_NETWORK_GET_CLOUD_TIME_AS_STRING);
-		NETWORK.set_function("GET_CLOUD_TIME_AS_INT", LUA_NATIVE_NETWORK_GET_CLOUD_TIME_AS_INT);
-		NETWORK.set_function("CONVERT_POSIX_TIME", LUA_NATIVE_NETWORK_CONVERT_POSIX_TIME);
-		NETWORK.set_function("NETWORK_SET_IN_SPECTATOR_MODE", LUA_NATIVE_NETWORK_NETWORK_SET_IN_SPECTATOR_MODE);
-		NETWORK.set_function("NETWORK_SET_IN_SPECTATOR_MODE_EXTENDED", LUA_NATIVE_NETWORK_NETWORK_SET_IN_SPECTATOR_MODE_EXTENDED);
-		NETWORK.set_function("NETWORK_SET_IN_FREE_CAM_MODE", LUA_NATIVE_NETWORK_NETWORK_SET_IN_FREE_CAM_MODE);
-		NETWORK.set_function("NETWORK_SET_ANTAGONISTIC_TO_PLAYER", LUA_NATIVE_NETWORK_NETWORK_SET_ANTAGONISTIC_TO_PLAYER);
-		NETWORK.set_function("NETWORK_IS_IN_SPECTATOR_MODE", LUA_NATIVE_NETWORK_NETWORK_IS_IN_SPECTATOR_MODE);
-		NETWORK.set_function("NETWORK_SET_IN_MP_CUTSCENE", LUA_NATIVE_NETWORK_NETWORK_SET_IN_MP_CUTSCENE);
-		NETWORK.set_function("NETWORK_IS_IN_MP_CUTSCENE", LUA_NATIVE_NETWORK_NETWORK_IS_IN_MP_CUTSCENE);
-		NETWORK.set_function("NETWORK_IS_PLAYER_IN_MP_CUTSCENE", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_IN_MP_CUTSCENE);
-		NETWORK.set_function("NETWORK_HIDE_PROJECTILE_IN_CUTSCENE", LUA_NATIVE_NETWORK_NETWORK_HIDE_PROJECTILE_IN_CUTSCENE);
-		NETWORK.set_function("SET_NETWORK_VEHICLE_RESPOT_TIMER", LUA_NATIVE_NETWORK_SET_NETWORK_VEHICLE_RESPOT_TIMER);
-		NETWORK.set_function("IS_NETWORK_VEHICLE_RUNNING_RESPOT_TIMER", LUA_NATIVE_NETWORK_IS_NETWORK_VEHICLE_RUNNING_RESPOT_TIMER);
-		NETWORK.set_function("SET_NETWORK_VEHICLE_AS_GHOST", LUA_NATIVE_NETWORK_SET_NETWORK_VEHICLE_AS_GHOST);
-		NETWORK.set_function("SET_NETWORK_VEHICLE_MAX_POSITION_DELTA_MULTIPLIER", LUA_NATIVE_NETWORK_SET_NETWORK_VEHICLE_MAX_POSITION_DELTA_MULTIPLIER);
-		NETWORK.set_function("SET_NETWORK_ENABLE_HIGH_SPEED_EDGE_FALL_DETECTION", LUA_NATIVE_NETWORK_SET_NETWORK_ENABLE_HIGH_SPEED_EDGE_FALL_DETECTION);
-		NETWORK.set_function("SET_LOCAL_PLAYER_AS_GHOST", LUA_NATIVE_NETWORK_SET_LOCAL_PLAYER_AS_GHOST);
-		NETWORK.set_function("IS_ENTITY_A_GHOST", LUA_NATIVE_NETWORK_IS_ENTITY_A_GHOST);
-		NETWORK.set_function("SET_NON_PARTICIPANTS_OF_THIS_SCRIPT_AS_GHOSTS", LUA_NATIVE_NETWORK_SET_NON_PARTICIPANTS_OF_THIS_SCRIPT_AS_GHOSTS);
-		NETWORK.set_function("SET_REMOTE_PLAYER_AS_GHOST", LUA_NATIVE_NETWORK_SET_REMOTE_PLAYER_AS_GHOST);
-		NETWORK.set_function("SET_GHOST_ALPHA", LUA_NATIVE_NETWORK_SET_GHOST_ALPHA);
-		NETWORK.set_function("RESET_GHOST_ALPHA", LUA_NATIVE_NETWORK_RESET_GHOST_ALPHA);
-		NETWORK.set_function("SET_ENTITY_GHOSTED_FOR_GHOST_PLAYERS", LUA_NATIVE_NETWORK_SET_ENTITY_GHOSTED_FOR_GHOST_PLAYERS);
-		NETWORK.set_function("SET_INVERT_GHOSTING", LUA_NATIVE_NETWORK_SET_INVERT_GHOSTING);
-		NETWORK.set_function("IS_ENTITY_IN_GHOST_COLLISION", LUA_NATIVE_NETWORK_IS_ENTITY_IN_GHOST_COLLISION);
-		NETWORK.set_function("USE_PLAYER_COLOUR_INSTEAD_OF_TEAM_COLOUR", LUA_NATIVE_NETWORK_USE_PLAYER_COLOUR_INSTEAD_OF_TEAM_COLOUR);
-		NETWORK.set_function("NETWORK_CREATE_SYNCHRONISED_SCENE", LUA_NATIVE_NETWORK_NETWORK_CREATE_SYNCHRONISED_SCENE);
-		NETWORK.set_function("NETWORK_ADD_PED_TO_SYNCHRONISED_SCENE", LUA_NATIVE_NETWORK_NETWORK_ADD_PED_TO_SYNCHRONISED_SCENE);
-		NETWORK.set_function("NETWORK_ADD_PED_TO_SYNCHRONISED_SCENE_WITH_IK", LUA_NATIVE_NETWORK_NETWORK_ADD_PED_TO_SYNCHRONISED_SCENE_WITH_IK);
-		NETWORK.set_function("NETWORK_ADD_ENTITY_TO_SYNCHRONISED_SCENE", LUA_NATIVE_NETWORK_NETWORK_ADD_ENTITY_TO_SYNCHRONISED_SCENE);
-		NETWORK.set_function("NETWORK_ADD_MAP_ENTITY_TO_SYNCHRONISED_SCENE", LUA_NATIVE_NETWORK_NETWORK_ADD_MAP_ENTITY_TO_SYNCHRONISED_SCENE);
-		NETWORK.set_function("NETWORK_ADD_SYNCHRONISED_SCENE_CAMERA", LUA_NATIVE_NETWORK_NETWORK_ADD_SYNCHRONISED_SCENE_CAMERA);
-		NETWORK.set_function("NETWORK_ATTACH_SYNCHRONISED_SCENE_TO_ENTITY", LUA_NATIVE_NETWORK_NETWORK_ATTACH_SYNCHRONISED_SCENE_TO_ENTITY);
-		NETWORK.set_function("NETWORK_START_SYNCHRONISED_SCENE", LUA_NATIVE_NETWORK_NETWORK_START_SYNCHRONISED_SCENE);
-		NETWORK.set_function("NETWORK_STOP_SYNCHRONISED_SCENE", LUA_NATIVE_NETWORK_NETWORK_STOP_SYNCHRONISED_SCENE);
-		NETWORK.set_function("NETWORK_GET_LOCAL_SCENE_FROM_NETWORK_ID", LUA_NATIVE_NETWORK_NETWORK_GET_LOCAL_SCENE_FROM_NETWORK_ID);
-		NETWORK.set_function("NETWORK_FORCE_LOCAL_USE_OF_SYNCED_SCENE_CAMERA", LUA_NATIVE_NETWORK_NETWORK_FORCE_LOCAL_USE_OF_SYNCED_SCENE_CAMERA);
-		NETWORK.set_function("NETWORK_ALLOW_REMOTE_SYNCED_SCENE_LOCAL_PLAYER_REQUESTS", LUA_NATIVE_NETWORK_NETWORK_ALLOW_REMOTE_SYNCED_SCENE_LOCAL_PLAYER_REQUESTS);
-		NETWORK.set_function("NETWORK_FIND_LARGEST_BUNCH_OF_PLAYERS", LUA_NATIVE_NETWORK_NETWORK_FIND_LARGEST_BUNCH_OF_PLAYERS);
-		NETWORK.set_function("NETWORK_START_RESPAWN_SEARCH_FOR_PLAYER", LUA_NATIVE_NETWORK_NETWORK_START_RESPAWN_SEARCH_FOR_PLAYER);
-		NETWORK.set_function("NETWORK_START_RESPAWN_SEARCH_IN_ANGLED_AREA_FOR_PLAYER", LUA_NATIVE_NETWORK_NETWORK_START_RESPAWN_SEARCH_IN_ANGLED_AREA_FOR_PLAYER);
-		NETWORK.set_function("NETWORK_QUERY_RESPAWN_RESULTS", LUA_NATIVE_NETWORK_NETWORK_QUERY_RESPAWN_RESULTS);
-		NETWORK.set_function("NETWORK_CANCEL_RESPAWN_SEARCH", LUA_NATIVE_NETWORK_NETWORK_CANCEL_RESPAWN_SEARCH);
-		NETWORK.set_function("NETWORK_GET_RESPAWN_RESULT", LUA_NATIVE_NETWORK_NETWORK_GET_RESPAWN_RESULT);
-		NETWORK.set_function("NETWORK_GET_RESPAWN_RESULT_FLAGS", LUA_NATIVE_NETWORK_NETWORK_GET_RESPAWN_RESULT_FLAGS);
-		NETWORK.set_function("NETWORK_START_SOLO_TUTORIAL_SESSION", LUA_NATIVE_NETWORK_NETWORK_START_SOLO_TUTORIAL_SESSION);
-		NETWORK.set_function("NETWORK_ALLOW_GANG_TO_JOIN_TUTORIAL_SESSION", LUA_NATIVE_NETWORK_NETWORK_ALLOW_GANG_TO_JOIN_TUTORIAL_SESSION);
-		NETWORK.set_function("NETWORK_END_TUTORIAL_SESSION", LUA_NATIVE_NETWORK_NETWORK_END_TUTORIAL_SESSION);
-		NETWORK.set_function("NETWORK_IS_IN_TUTORIAL_SESSION", LUA_NATIVE_NETWORK_NETWORK_IS_IN_TUTORIAL_SESSION);
-		NETWORK.set_function("NETWORK_WAITING_POP_CLEAR_TUTORIAL_SESSION", LUA_NATIVE_NETWORK_NETWORK_WAITING_POP_CLEAR_TUTORIAL_SESSION);
-		NETWORK.set_function("NETWORK_IS_TUTORIAL_SESSION_CHANGE_PENDING", LUA_NATIVE_NETWORK_NETWORK_IS_TUTORIAL_SESSION_CHANGE_PENDING);
-		NETWORK.set_function("NETWORK_GET_PLAYER_TUTORIAL_SESSION_INSTANCE", LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_TUTORIAL_SESSION_INSTANCE);
-		NETWORK.set_function("NETWORK_ARE_PLAYERS_IN_SAME_TUTORIAL_SESSION", LUA_NATIVE_NETWORK_NETWORK_ARE_PLAYERS_IN_SAME_TUTORIAL_SESSION);
-		NETWORK.set_function("NETWORK_BLOCK_PROXY_MIGRATION_BETWEEN_TUTORIAL_SESSIONS", LUA_NATIVE_NETWORK_NETWORK_BLOCK_PROXY_MIGRATION_BETWEEN_TUTORIAL_SESSIONS);
-		NETWORK.set_function("NETWORK_CONCEAL_PLAYER", LUA_NATIVE_NETWORK_NETWORK_CONCEAL_PLAYER);
-		NETWORK.set_function("NETWORK_IS_PLAYER_CONCEALED", LUA_NATIVE_NETWORK_NETWORK_IS_PLAYER_CONCEALED);
-		NETWORK.set_function("NETWORK_CONCEAL_ENTITY", LUA_NATIVE_NETWORK_NETWORK_CONCEAL_ENTITY);
-		NETWORK.set_function("NETWORK_IS_ENTITY_CONCEALED", LUA_NATIVE_NETWORK_NETWORK_IS_ENTITY_CONCEALED);
-		NETWORK.set_function("NETWORK_OVERRIDE_CLOCK_TIME", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_CLOCK_TIME);
-		NETWORK.set_function("NETWORK_OVERRIDE_CLOCK_RATE", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_CLOCK_RATE);
-		NETWORK.set_function("NETWORK_CLEAR_CLOCK_TIME_OVERRIDE", LUA_NATIVE_NETWORK_NETWORK_CLEAR_CLOCK_TIME_OVERRIDE);
-		NETWORK.set_function("NETWORK_IS_CLOCK_TIME_OVERRIDDEN", LUA_NATIVE_NETWORK_NETWORK_IS_CLOCK_TIME_OVERRIDDEN);
-		NETWORK.set_function("NETWORK_ADD_ENTITY_AREA", LUA_NATIVE_NETWORK_NETWORK_ADD_ENTITY_AREA);
-		NETWORK.set_function("NETWORK_ADD_ENTITY_ANGLED_AREA", LUA_NATIVE_NETWORK_NETWORK_ADD_ENTITY_ANGLED_AREA);
-		NETWORK.set_function("NETWORK_ADD_CLIENT_ENTITY_AREA", LUA_NATIVE_NETWORK_NETWORK_ADD_CLIENT_ENTITY_AREA);
-		NETWORK.set_function("NETWORK_ADD_CLIENT_ENTITY_ANGLED_AREA", LUA_NATIVE_NETWORK_NETWORK_ADD_CLIENT_ENTITY_ANGLED_AREA);
-		NETWORK.set_function("NETWORK_REMOVE_ENTITY_AREA", LUA_NATIVE_NETWORK_NETWORK_REMOVE_ENTITY_AREA);
-		NETWORK.set_function("NETWORK_ENTITY_AREA_DOES_EXIST", LUA_NATIVE_NETWORK_NETWORK_ENTITY_AREA_DOES_EXIST);
-		NETWORK.set_function("NETWORK_ENTITY_AREA_HAVE_ALL_REPLIED", LUA_NATIVE_NETWORK_NETWORK_ENTITY_AREA_HAVE_ALL_REPLIED);
-		NETWORK.set_function("NETWORK_ENTITY_AREA_IS_OCCUPIED", LUA_NATIVE_NETWORK_NETWORK_ENTITY_AREA_IS_OCCUPIED);
-		NETWORK.set_function("NETWORK_USE_HIGH_PRECISION_BLENDING", LUA_NATIVE_NETWORK_NETWORK_USE_HIGH_PRECISION_BLENDING);
-		NETWORK.set_function("NETWORK_SET_CUSTOM_ARENA_BALL_PARAMS", LUA_NATIVE_NETWORK_NETWORK_SET_CUSTOM_ARENA_BALL_PARAMS);
-		NETWORK.set_function("NETWORK_ENTITY_USE_HIGH_PRECISION_ROTATION", LUA_NATIVE_NETWORK_NETWORK_ENTITY_USE_HIGH_PRECISION_ROTATION);
-		NETWORK.set_function("NETWORK_REQUEST_CLOUD_BACKGROUND_SCRIPTS", LUA_NATIVE_NETWORK_NETWORK_REQUEST_CLOUD_BACKGROUND_SCRIPTS);
-		NETWORK.set_function("NETWORK_IS_CLOUD_BACKGROUND_SCRIPT_REQUEST_PENDING", LUA_NATIVE_NETWORK_NETWORK_IS_CLOUD_BACKGROUND_SCRIPT_REQUEST_PENDING);
-		NETWORK.set_function("NETWORK_REQUEST_CLOUD_TUNABLES", LUA_NATIVE_NETWORK_NETWORK_REQUEST_CLOUD_TUNABLES);
-		NETWORK.set_function("NETWORK_IS_TUNABLE_CLOUD_REQUEST_PENDING", LUA_NATIVE_NETWORK_NETWORK_IS_TUNABLE_CLOUD_REQUEST_PENDING);
-		NETWORK.set_function("NETWORK_GET_TUNABLE_CLOUD_CRC", LUA_NATIVE_NETWORK_NETWORK_GET_TUNABLE_CLOUD_CRC);
-		NETWORK.set_function("NETWORK_DOES_TUNABLE_EXIST", LUA_NATIVE_NETWORK_NETWORK_DOES_TUNABLE_EXIST);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_INT", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_INT);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_FLOAT", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_FLOAT);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_BOOL", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_BOOL);
-		NETWORK.set_function("NETWORK_DOES_TUNABLE_EXIST_HASH", LUA_NATIVE_NETWORK_NETWORK_DOES_TUNABLE_EXIST_HASH);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_MODIFICATION_DETECTION_CLEAR", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_MODIFICATION_DETECTION_CLEAR);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_INT_HASH", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_INT_HASH);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_INT_MODIFICATION_DETECTION_REGISTRATION_HASH", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_INT_MODIFICATION_DETECTION_REGISTRATION_HASH);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_FLOAT_HASH", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_FLOAT_HASH);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_FLOAT_MODIFICATION_DETECTION_REGISTRATION_HASH", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_FLOAT_MODIFICATION_DETECTION_REGISTRATION_HASH);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_BOOL_HASH", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_BOOL_HASH);
-		NETWORK.set_function("NETWORK_ACCESS_TUNABLE_BOOL_MODIFICATION_DETECTION_REGISTRATION_HASH", LUA_NATIVE_NETWORK_NETWORK_ACCESS_TUNABLE_BOOL_MODIFICATION_DETECTION_REGISTRATION_HASH);
-		NETWORK.set_function("NETWORK_TRY_ACCESS_TUNABLE_BOOL_HASH", LUA_NATIVE_NETWORK_NETWORK_TRY_ACCESS_TUNABLE_BOOL_HASH);
-		NETWORK.set_function("NETWORK_GET_CONTENT_MODIFIER_LIST_ID", LUA_NATIVE_NETWORK_NETWORK_GET_CONTENT_MODIFIER_LIST_ID);
-		NETWORK.set_function("NETWORK_GET_BONE_ID_OF_FATAL_HIT", LUA_NATIVE_NETWORK_NETWORK_GET_BONE_ID_OF_FATAL_HIT);
-		NETWORK.set_function("NETWORK_RESET_BODY_TRACKER", LUA_NATIVE_NETWORK_NETWORK_RESET_BODY_TRACKER);
-		NETWORK.set_function("NETWORK_GET_NUMBER_BODY_TRACKER_HITS", LUA_NATIVE_NETWORK_NETWORK_GET_NUMBER_BODY_TRACKER_HITS);
-		NETWORK.set_function("NETWORK_HAS_BONE_BEEN_HIT_BY_KILLER", LUA_NATIVE_NETWORK_NETWORK_HAS_BONE_BEEN_HIT_BY_KILLER);
-		NETWORK.set_function("NETWORK_SET_ATTRIBUTE_DAMAGE_TO_PLAYER", LUA_NATIVE_NETWORK_NETWORK_SET_ATTRIBUTE_DAMAGE_TO_PLAYER);
-		NETWORK.set_function("NETWORK_TRIGGER_DAMAGE_EVENT_FOR_ZERO_DAMAGE", LUA_NATIVE_NETWORK_NETWORK_TRIGGER_DAMAGE_EVENT_FOR_ZERO_DAMAGE);
-		NETWORK.set_function("NETWORK_TRIGGER_DAMAGE_EVENT_FOR_ZERO_WEAPON_HASH", LUA_NATIVE_NETWORK_NETWORK_TRIGGER_DAMAGE_EVENT_FOR_ZERO_WEAPON_HASH);
-		NETWORK.set_function("NETWORK_SET_NO_LONGER_NEEDED", LUA_NATIVE_NETWORK_NETWORK_SET_NO_LONGER_NEEDED);
-		NETWORK.set_function("NETWORK_EXPLODE_VEHICLE", LUA_NATIVE_NETWORK_NETWORK_EXPLODE_VEHICLE);
-		NETWORK.set_function("NETWORK_EXPLODE_HELI", LUA_NATIVE_NETWORK_NETWORK_EXPLODE_HELI);
-		NETWORK.set_function("NETWORK_USE_LOGARITHMIC_BLENDING_THIS_FRAME", LUA_NATIVE_NETWORK_NETWORK_USE_LOGARITHMIC_BLENDING_THIS_FRAME);
-		NETWORK.set_function("NETWORK_OVERRIDE_COORDS_AND_HEADING", LUA_NATIVE_NETWORK_NETWORK_OVERRIDE_COORDS_AND_HEADING);
-		NETWORK.set_function("NETWORK_ENABLE_EXTRA_VEHICLE_ORIENTATION_BLEND_CHECKS", LUA_NATIVE_NETWORK_NETWORK_ENABLE_EXTRA_VEHICLE_ORIENTATION_BLEND_CHECKS);
-		NETWORK.set_function("NETWORK_DISABLE_PROXIMITY_MIGRATION", LUA_NATIVE_NETWORK_NETWORK_DISABLE_PROXIMITY_MIGRATION);
-		NETWORK.set_function("NETWORK_SET_PROPERTY_ID", LUA_NATIVE_NETWORK_NETWORK_SET_PROPERTY_ID);
-		NETWORK.set_function("NETWORK_CLEAR_PROPERTY_ID", LUA_NATIVE_NETWORK_NETWORK_CLEAR_PROPERTY_ID);
-		NETWORK.set_function("NETWORK_SET_PLAYER_MENTAL_STATE", LUA_NATIVE_NETWORK_NETWORK_SET_PLAYER_MENTAL_STATE);
-		NETWORK.set_function("NETWORK_SET_MINIMUM_RANK_FOR_MISSION", LUA_NATIVE_NETWORK_NETWORK_SET_MINIMUM_RANK_FOR_MISSION);
-		NETWORK.set_function("NETWORK_CACHE_LOCAL_PLAYER_HEAD_BLEND_DATA", LUA_NATIVE_NETWORK_NETWORK_CACHE_LOCAL_PLAYER_HEAD_BLEND_DATA);
-		NETWORK.set_function("NETWORK_HAS_CACHED_PLAYER_HEAD_BLEND_DATA", LUA_NATIVE_NETWORK_NETWORK_HAS_CACHED_PLAYER_HEAD_BLEND_DATA);
-		NETWORK.set_function("NETWORK_APPLY_CACHED_PLAYER_HEAD_BLEND_DATA", LUA_NATIVE_NETWORK_NETWORK_APPLY_CACHED_PLAYER_HEAD_BLEND_DATA);
-		NETWORK.set_function("GET_NUM_COMMERCE_ITEMS", LUA_NATIVE_NETWORK_GET_NUM_COMMERCE_ITEMS);
-		NETWORK.set_function("IS_COMMERCE_DATA_VALID", LUA_NATIVE_NETWORK_IS_COMMERCE_DATA_VALID);
-		NETWORK.set_function("TRIGGER_COMMERCE_DATA_FETCH", LUA_NATIVE_NETWORK_TRIGGER_COMMERCE_DATA_FETCH);
-		NETWORK.set_function("IS_COMMERCE_DATA_FETCH_IN_PROGRESS", LUA_NATIVE_NETWORK_IS_COMMERCE_DATA_FETCH_IN_PROGRESS);
-		NETWORK.set_function("GET_COMMERCE_ITEM_ID", LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_ID);
-		NETWORK.set_function("GET_COMMERCE_ITEM_NAME", LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_NAME);
-		NETWORK.set_function("GET_COMMERCE_PRODUCT_PRICE", LUA_NATIVE_NETWORK_GET_COMMERCE_PRODUCT_PRICE);
-		NETWORK.set_function("GET_COMMERCE_ITEM_NUM_CATS", LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_NUM_CATS);
-		NETWORK.set_function("GET_COMMERCE_ITEM_CAT", LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_CAT);
-		NETWORK.set_function("OPEN_COMMERCE_STORE", LUA_NATIVE_NETWORK_OPEN_COMMERCE_STORE);
-		NETWORK.set_function("IS_COMMERCE_STORE_OPEN", LUA_NATIVE_NETWORK_IS_COMMERCE_STORE_OPEN);
-		NETWORK.set_function("SET_STORE_ENABLED", LUA_NATIVE_NETWORK_SET_STORE_ENABLED);
-		NETWORK.set_function("REQUEST_COMMERCE_ITEM_IMAGE", LUA_NATIVE_NETWORK_REQUEST_COMMERCE_ITEM_IMAGE);
-		NETWORK.set_function("RELEASE_ALL_COMMERCE_ITEM_IMAGES", LUA_NATIVE_NETWORK_RELEASE_ALL_COMMERCE_ITEM_IMAGES);
-		NETWORK.set_function("GET_COMMERCE_ITEM_TEXTURENAME", LUA_NATIVE_NETWORK_GET_COMMERCE_ITEM_TEXTURENAME);
-		NETWORK.set_function("IS_STORE_AVAILABLE_TO_USER", LUA_NATIVE_NETWORK_IS_STORE_AVAILABLE_TO_USER);
-		NETWORK.set_function("DELAY_MP_STORE_OPEN", LUA_NATIVE_NETWORK_DELAY_MP_STORE_OPEN);
-		NETWORK.set_function("RESET_STORE_NETWORK_GAME_TRACKING", LUA_NATIVE_NETWORK_RESET_STORE_NETWORK_GAME_TRACKING);
-		NETWORK.set_function("IS_USER_OLD_ENOUGH_TO_ACCESS_STORE", LUA_NATIVE_NETWORK_IS_USER_OLD_ENOUGH_TO_ACCESS_STORE);
-		NETWORK.set_function("SET_LAST_VIEWED_SHOP_ITEM", LUA_NATIVE_NETWORK_SET_LAST_VIEWED_SHOP_ITEM);
-		NETWORK.set_function("GET_USER_PREMIUM_ACCESS", LUA_NATIVE_NETWORK_GET_USER_PREMIUM_ACCESS);
-		NETWORK.set_function("GET_USER_STARTER_ACCESS", LUA_NATIVE_NETWORK_GET_USER_STARTER_ACCESS);
-		NETWORK.set_function("CLOUD_DELETE_MEMBER_FILE", LUA_NATIVE_NETWORK_CLOUD_DELETE_MEMBER_FILE);
-		NETWORK.set_function("CLOUD_HAS_REQUEST_COMPLETED", LUA_NATIVE_NETWORK_CLOUD_HAS_REQUEST_COMPLETED);
-		NETWORK.set_function("CLOUD_DID_REQUEST_SUCCEED", LUA_NATIVE_NETWORK_CLOUD_DID_REQUEST_SUCCEED);
-		NETWORK.set_function("CLOUD_CHECK_AVAILABILITY", LUA_NATIVE_NETWORK_CLOUD_CHECK_AVAILABILITY);
-		NETWORK.set_function("CLOUD_IS_CHECKING_AVAILABILITY", LUA_NATIVE_NETWORK_CLOUD_IS_CHECKING_AVAILABILITY);
-		NETWORK.set_function("CLOUD_GET_AVAILABILITY_CHECK_RESULT", LUA_NATIVE_NETWORK_CLOUD_GET_AVAILABILITY_CHECK_RESULT);
-		NETWORK.set_function("GET_CONTENT_TO_LOAD_TYPE", LUA_NATIVE_NETWORK_GET_CONTENT_TO_LOAD_TYPE);
-		NETWORK.set_function("GET_IS_LAUNCH_FROM_LIVE_AREA", LUA_NATIVE_NETWORK_GET_IS_LAUNCH_FROM_LIVE_AREA);
-		NETWORK.set_function("GET_IS_LIVE_AREA_LAUNCH_WITH_CONTENT", LUA_NATIVE_NETWORK_GET_IS_LIVE_AREA_LAUNCH_WITH_CONTENT);
-		NETWORK.set_function("CLEAR_SERVICE_EVENT_ARGUMENTS", LUA_NATIVE_NETWORK_CLEAR_SERVICE_EVENT_ARGUMENTS);
-		NETWORK.set_function("UGC_COPY_CONTENT", LUA_NATIVE_NETWORK_UGC_COPY_CONTENT);
-		NETWORK.set_function("UGC_IS_CREATING", LUA_NATIVE_NETWORK_UGC_IS_CREATING);
-		NETWORK.set_function("UGC_HAS_CREATE_FINISHED", LUA_NATIVE_NETWORK_UGC_HAS_CREATE_FINISHED);
-		NETWORK.set_function("UGC_DID_CREATE_SUCCEED", LUA_NATIVE_NETWORK_UGC_DID_CREATE_SUCCEED);
-		NETWORK.set_function("UGC_GET_CREATE_RESULT", LUA_NATIVE_NETWORK_UGC_GET_CREATE_RESULT);
-		NETWORK.set_function("UGC_GET_CREATE_CONTENT_ID", LUA_NATIVE_NETWORK_UGC_GET_CREATE_CONTENT_ID);
-		NETWORK.set_function("UGC_CLEAR_CREATE_RESULT", LUA_NATIVE_NETWORK_UGC_CLEAR_CREATE_RESULT);
-		NETWORK.set_function("UGC_QUERY_MY_CONTENT", LUA_NATIVE_NETWORK_UGC_QUERY_MY_CONTENT);
-		NETWORK.set_function("UGC_QUERY_BY_CATEGORY", LUA_NATIVE_NETWORK_UGC_QUERY_BY_CATEGORY);
-		NETWORK.set_function("UGC_QUERY_BY_CONTENT_ID", LUA_NATIVE_NETWORK_UGC_QUERY_BY_CONTENT_ID);
-		NETWORK.set_function("UGC_QUERY_BY_CONTENT_IDS", LUA_NATIVE_NETWORK_UGC_QUERY_BY_CONTENT_IDS);
-		NETWORK.set_function("UGC_QUERY_MOST_RECENTLY_CREATED_CONTENT", LUA_NATIVE_NETWORK_UGC_QUERY_MOST_RECENTLY_CREATED_CONTENT);
-		NETWORK.set_function("UGC_GET_BOOKMARKED_CONTENT", LUA_NATIVE_NETWORK_UGC_GET_BOOKMARKED_CONTENT);
-		NETWORK.set_function("UGC_GET_MY_CONTENT", LUA_NATIVE_NETWORK_UGC_GET_MY_CONTENT);
-		NETWORK.set_function("UGC_GET_FRIEND_CONTENT", LUA_NATIVE_NETWORK_UGC_GET_FRIEND_CONTENT);
-		NETWORK.set_function("UGC_GET_CREW_CONTENT", LUA_NATIVE_NETWORK_UGC_GET_CREW_CONTENT);
-		NETWORK.set_function("UGC_GET_GET_BY_CATEGORY", LUA_NATIVE_NETWORK_UGC_GET_GET_BY_CATEGORY);
-		NETWORK.set_function("UGC_GET_GET_BY_CONTENT_ID", LUA_NATIVE_NETWORK_UGC_GET_GET_BY_CONTENT_ID);
-		NETWORK.set_function("UGC_GET_GET_BY_CONTENT_IDS", LUA_NATIVE_NETWORK_UGC_GET_GET_BY_CONTENT_IDS);
-		NETWORK.set_function("UGC_GET_MOST_RECENTLY_CREATED_CONTENT", LUA_NATIVE_NETWORK_UGC_GET_MOST_RECENTLY_CREATED_CONTENT);
-		NETWORK.set_function("UGC_GET_MOST_RECENTLY_PLAYED_CONTENT", LUA_NATIVE_NETWORK_UGC_GET_MOST_RECENTLY_PLAYED_CONTENT);
-		NETWORK.set_function("UGC_GET_TOP_RATED_CONTENT", LUA_NATIVE_NETWORK_UGC_GET_TOP_RATED_CONTENT);
-		NETWORK.set_function("UGC_CANCEL_QUERY", LUA_NATIVE_NETWORK_UGC_CANCEL_QUERY);
-		NETWORK.set_function("UGC_IS_GETTING", LUA_NATIVE_NETWORK_UGC_IS_GETTING);
-		NETWORK.set_function("UGC_HAS_GET_FINISHED", LUA_NATIVE_NETWORK_UGC_HAS_GET_FINISHED);
-		NETWORK.set_function("UGC_DID_GET_SUCCEED", LUA_NATIVE_NETWORK_UGC_DID_GET_SUCCEED);
-		NETWORK.set_function("UGC_WAS_QUERY_FORCE_CANCELLED", LUA_NATIVE_NETWORK_UGC_WAS_QUERY_FORCE_CANCELLED);
-		NETWORK.set_function("UGC_GET_QUERY_RESULT", LUA_NATIVE_NETWORK_UGC_GET_QUERY_RESULT);
-		NETWORK.set_function("UGC_GET_CONTENT_NUM", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_NUM);
-		NETWORK.set_function("UGC_GET_CONTENT_TOTAL", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_TOTAL);
-		NETWORK.set_function("UGC_GET_CONTENT_HASH", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HASH);
-		NETWORK.set_function("UGC_CLEAR_QUERY_RESULTS", LUA_NATIVE_NETWORK_UGC_CLEAR_QUERY_RESULTS);
-		NETWORK.set_function("UGC_GET_CONTENT_USER_ID", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_USER_ID);
-		NETWORK.set_function("UGC_GET_CONTENT_CREATOR_GAMER_HANDLE", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_CREATOR_GAMER_HANDLE);
-		NETWORK.set_function("UGC_GET_CONTENT_CREATED_BY_LOCAL_PLAYER", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_CREATED_BY_LOCAL_PLAYER);
-		NETWORK.set_function("UGC_GET_CONTENT_USER_NAME", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_USER_NAME);
-		NETWORK.set_function("UGC_GET_CONTENT_IS_USING_SC_NICKNAME", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_IS_USING_SC_NICKNAME);
-		NETWORK.set_function("UGC_GET_CONTENT_CATEGORY", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_CATEGORY);
-		NETWORK.set_function("UGC_GET_CONTENT_ID", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_ID);
-		NETWORK.set_function("UGC_GET_ROOT_CONTENT_ID", LUA_NATIVE_NETWORK_UGC_GET_ROOT_CONTENT_ID);
-		NETWORK.set_function("UGC_GET_CONTENT_NAME", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_NAME);
-		NETWORK.set_function("UGC_GET_CONTENT_DESCRIPTION_HASH", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_DESCRIPTION_HASH);
-		NETWORK.set_function("UGC_GET_CONTENT_PATH", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_PATH);
-		NETWORK.set_function("UGC_GET_CONTENT_UPDATED_DATE", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_UPDATED_DATE);
-		NETWORK.set_function("UGC_GET_CONTENT_FILE_VERSION", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_FILE_VERSION);
-		NETWORK.set_function("UGC_GET_CONTENT_HAS_LO_RES_PHOTO", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HAS_LO_RES_PHOTO);
-		NETWORK.set_function("UGC_GET_CONTENT_HAS_HI_RES_PHOTO", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HAS_HI_RES_PHOTO);
-		NETWORK.set_function("UGC_GET_CONTENT_LANGUAGE", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_LANGUAGE);
-		NETWORK.set_function("UGC_GET_CONTENT_IS_PUBLISHED", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_IS_PUBLISHED);
-		NETWORK.set_function("UGC_GET_CONTENT_IS_VERIFIED", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_IS_VERIFIED);
-		NETWORK.set_function("UGC_GET_CONTENT_RATING", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_RATING);
-		NETWORK.set_function("UGC_GET_CONTENT_RATING_COUNT", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_RATING_COUNT);
-		NETWORK.set_function("UGC_GET_CONTENT_RATING_POSITIVE_COUNT", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_RATING_POSITIVE_COUNT);
-		NETWORK.set_function("UGC_GET_CONTENT_RATING_NEGATIVE_COUNT", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_RATING_NEGATIVE_COUNT);
-		NETWORK.set_function("UGC_GET_CONTENT_HAS_PLAYER_RECORD", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HAS_PLAYER_RECORD);
-		NETWORK.set_function("UGC_GET_CONTENT_HAS_PLAYER_BOOKMARKED", LUA_NATIVE_NETWORK_UGC_GET_CONTENT_HAS_PLAYER_BOOKMARKED);
-		NETWORK.set_function("UGC_REQUEST_CONTENT_DATA_FROM_INDEX", LUA_NATIVE_NETWORK_UGC_REQUEST_CONTENT_DATA_FROM_INDEX);
-		NETWORK.set_function("UGC_REQUEST_CONTENT_DATA_FROM_PARAMS", LUA_NATIVE_NETWORK_UGC_REQUEST_CONTENT_DATA_FROM_PARAMS);
-		NETWORK.set_function("UGC_REQUEST_CACHED_DESCRIPTION", LUA_NATIVE_NETWORK_UGC_REQUEST_CACHED_DESCRIPTION);
-		NETWORK.set_function("UGC_IS_DESCRIPTION_REQUEST_IN_PROGRESS", LUA_NATIVE_NETWORK_UGC_IS_DESCRIPTION_REQUEST_IN_PROGRESS);
-		NETWORK.set_function("UGC_HAS_DESCRIPTION_REQUEST_FINISHED", LUA_NATIVE_NETWORK_UGC_HAS_DESCRIPTION_REQUEST_FINISHED);
-		NETWORK.set_function("UGC_DID_DESCRIPTION_REQUEST_SUCCEED", LUA_NATIVE_NETWORK_UGC_DID_DESCRIPTION_REQUEST_SUCCEED);
-		NETWORK.set_function("UGC_GET_CACHED_DESCRIPTION", LUA_NATIVE_NETWORK_UGC_GET_CACHED_DESCRIPTION);
-		NETWORK.set_function("UGC_RELEASE_CACHED_DESCRIPTION", LUA_NATIVE_NETWORK_UGC_RELEASE_CACHED_DESCRIPTION);
-		NETWORK.set_function("UGC_RELEASE_ALL_CACHED_DESCRIPTIONS", LUA_NATIVE_NETWORK_UGC_RELEASE_ALL_CACHED_DESCRIPTIONS);
-		NETWORK.set_function("UGC_HAS_PERMISSION_TO_WRITE", LUA_NATIVE_NETWORK_UGC_HAS_PERMISSION_TO_WRITE);
-		NETWORK.set_function("UGC_PUBLISH", LUA_NATIVE_NETWORK_UGC_PUBLISH);
-		NETWORK.set_function("UGC_SET_BOOKMARKED", LUA_NATIVE_NETWORK_UGC_SET_BOOKMARKED);
-		NETWORK.set_function("UGC_SET_DELETED", LUA_NATIVE_NETWORK_UGC_SET_DELETED);
-		NETWORK.set_function("UGC_IS_MODIFYING", LUA_NATIVE_NETWORK_UGC_IS_MODIFYING);
-		NETWORK.set_function("UGC_HAS_MODIFY_FINISHED", LUA_NATIVE_NETWORK_UGC_HAS_MODIFY_FINISHED);
-		NETWORK.set_function("UGC_DID_MODIFY_SUCCEED", LUA_NATIVE_NETWORK_UGC_DID_MODIFY_SUCCEED);
-		NETWORK.set_function("UGC_GET_MODIFY_RESULT", LUA_NATIVE_NETWORK_UGC_GET_MODIFY_RESULT);
-		NETWORK.set_function("UGC_CLEAR_MODIFY_RESULT", LUA_NATIVE_NETWORK_UGC_CLEAR_MODIFY_RESULT);
-		NETWORK.set_function("UGC_GET_CREATORS_BY_USER_ID", LUA_NATIVE_NETWORK_UGC_GET_CREATORS_BY_USER_ID);
-		NETWORK.set_function("UGC_HAS_QUERY_CREATORS_FINISHED", LUA_NATIVE_NETWORK_UGC_HAS_QUERY_CREATORS_FINISHED);
-		NETWORK.set_function("UGC_DID_QUERY_CREATORS_SUCCEED", LUA_NATIVE_NETWORK_UGC_DID_QUERY_CREATORS_SUCCEED);
-		NETWORK.set_function("UGC_GET_CREATOR_NUM", LUA_NATIVE_NETWORK_UGC_GET_CREATOR_NUM);
-		NETWORK.set_function("UGC_LOAD_OFFLINE_QUERY", LUA_NATIVE_NETWORK_UGC_LOAD_OFFLINE_QUERY);
-		NETWORK.set_function("UGC_CLEAR_OFFLINE_QUERY", LUA_NATIVE_NETWORK_UGC_CLEAR_OFFLINE_QUERY);
-		NETWORK.set_function("UGC_SET_QUERY_DATA_FROM_OFFLINE", LUA_NATIVE_NETWORK_UGC_SET_QUERY_DATA_FROM_OFFLINE);
-		NETWORK.set_function("UGC_SET_USING_OFFLINE_CONTENT", LUA_NATIVE_NETWORK_UGC_SET_USING_OFFLINE_CONTENT);
-		NETWORK.set_function("UGC_IS_LANGUAGE_SUPPORTED", LUA_NATIVE_NETWORK_UGC_IS_LANGUAGE_SUPPORTED);
-		NETWORK.set_function("FACEBOOK_POST_COMPLETED_HEIST", LUA_NATIVE_NETWORK_FACEBOOK_POST_COMPLETED_HEIST);
-		NETWORK.set_function("FACEBOOK_POST_CREATE_CHARACTER", LUA_NATIVE_NETWORK_FACEBOOK_POST_CREATE_CHARACTER);
-		NETWORK.set_function("FACEBOOK_POST_COMPLETED_MILESTONE", LUA_NATIVE_NETWORK_FACEBOOK_POST_COMPLETED_MILESTONE);
-		NETWORK.set_function("FACEBOOK_HAS_POST_COMPLETED", LUA_NATIVE_NETWORK_FACEBOOK_HAS_POST_COMPLETED);
-		NETWORK.set_function("FACEBOOK_DID_POST_SUCCEED", LUA_NATIVE_NETWORK_FACEBOOK_DID_POST_SUCCEED);
-		NETWORK.set_function("FACEBOOK_CAN_POST_TO_FACEBOOK", LUA_NATIVE_NETWORK_FACEBOOK_CAN_POST_TO_FACEBOOK);
-		NETWORK.set_function("TEXTURE_DOWNLOAD_REQUEST", LUA_NATIVE_NETWORK_TEXTURE_DOWNLOAD_REQUEST);
-		NETWORK.set_function("TITLE_TEXTURE_DOWNLOAD_REQUEST", LUA_NATIVE_NETWORK_TITLE_TEXTURE_DOWNLOAD_REQUEST);
-		NETWORK.set_function("UGC_TEXTURE_DOWNLOAD_REQUEST", LUA_NATIVE_NETWORK_UGC_TEXTURE_DOWNLOAD_REQUEST);
-		NETWORK.set_function("TEXTURE_DOWNLOAD_RELEASE", LUA_NATIVE_NETWORK_TEXTURE_DOWNLOAD_RELEASE);
-		NETWORK.set_function("TEXTURE_DOWNLOAD_HAS_FAILED", LUA_NATIVE_NETWORK_TEXTURE_DOWNLOAD_HAS_FAILED);
-		NETWORK.set_function("TEXTURE_DOWNLOAD_GET_NAME", LUA_NATIVE_NETWORK_TEXTURE_DOWNLOAD_GET_NAME);
-		NETWORK.set_function("GET_STATUS_OF_TEXTURE_DOWNLOAD", LUA_NATIVE_NETWORK_GET_STATUS_OF_TEXTURE_DOWNLOAD);
-		NETWORK.set_function("NETWORK_CHECK_ROS_LINK_WENTDOWN_NOT_NET", LUA_NATIVE_NETWORK_NETWORK_CHECK_ROS_LINK_WENTDOWN_NOT_NET);
-		NETWORK.set_function("NETWORK_SHOULD_SHOW_STRICT_NAT_WARNING", LUA_NATIVE_NETWORK_NETWORK_SHOULD_SHOW_STRICT_NAT_WARNING);
-		NETWORK.set_function("NETWORK_IS_CABLE_CONNECTED", LUA_NATIVE_NETWORK_NETWORK_IS_CABLE_CONNECTED);
-		NETWORK.set_function("NETWORK_HAVE_SCS_PRIVATE_MSG_PRIV", LUA_NATIVE_NETWORK_NETWORK_HAVE_SCS_PRIVATE_MSG_PRIV);
-		NETWORK.set_function("NETWORK_HAVE_ROS_SOCIAL_CLUB_PRIV", LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_SOCIAL_CLUB_PRIV);
-		NETWORK.set_function("NETWORK_HAVE_ROS_BANNED_PRIV", LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_BANNED_PRIV);
-		NETWORK.set_function("NETWORK_HAVE_ROS_CREATE_TICKET_PRIV", LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_CREATE_TICKET_PRIV);
-		NETWORK.set_function("NETWORK_HAVE_ROS_MULTIPLAYER_PRIV", LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_MULTIPLAYER_PRIV);
-		NETWORK.set_function("NETWORK_HAVE_ROS_LEADERBOARD_WRITE_PRIV", LUA_NATIVE_NETWORK_NETWORK_HAVE_ROS_LEADERBOARD_WRITE_PRIV);
-		NETWORK.set_function("NETWORK_HAS_ROS_PRIVILEGE", LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE);
-		NETWORK.set_function("NETWORK_HAS_ROS_PRIVILEGE_END_DATE", LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_END_DATE);
-		NETWORK.set_function("NETWORK_HAS_ROS_PRIVILEGE_PLAYED_LAST_GEN", LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_PLAYED_LAST_GEN);
-		NETWORK.set_function("NETWORK_HAS_ROS_PRIVILEGE_SPECIAL_EDITION_CONTENT", LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_SPECIAL_EDITION_CONTENT);
-		NETWORK.set_function("NETWORK_HAS_ROS_PRIVILEGE_MP_TEXT_COMMUNICATION_", LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_MP_TEXT_COMMUNICATION_);
-		NETWORK.set_function("NETWORK_HAS_ROS_PRIVILEGE_MP_VOICE_COMMUNICATION_", LUA_NATIVE_NETWORK_NETWORK_HAS_ROS_PRIVILEGE_MP_VOICE_COMMUNICATION_);
-		NETWORK.set_function("NETWORK_START_COMMUNICATION_PERMISSIONS_CHECK", LUA_NATIVE_NETWORK_NETWORK_START_COMMUNICATION_PERMISSIONS_CHECK);
-		NETWORK.set_function("NETWORK_START_USER_CONTENT_PERMISSIONS_CHECK", LUA_NATIVE_NETWORK_NETWORK_START_USER_CONTENT_PERMISSIONS_CHECK);
-		NETWORK.set_function("NETWORK_SKIP_RADIO_RESET_NEXT_CLOSE", LUA_NATIVE_NETWORK_NETWORK_SKIP_RADIO_RESET_NEXT_CLOSE);
-		NETWORK.set_function("NETWORK_SKIP_RADIO_RESET_NEXT_OPEN", LUA_NATIVE_NETWORK_NETWORK_SKIP_RADIO_RESET_NEXT_OPEN);
-		NETWORK.set_function("NETWORK_SKIP_RADIO_WARNING", LUA_NATIVE_NETWORK_NETWORK_SKIP_RADIO_WARNING);
-		NETWORK.set_function("NETWORK_FORCE_LOCAL_PLAYER_SCAR_SYNC", LUA_NATIVE_NETWORK_NETWORK_FORCE_LOCAL_PLAYER_SCAR_SYNC);
-		NETWORK.set_function("NETWORK_DISABLE_LEAVE_REMOTE_PED_BEHIND", LUA_NATIVE_NETWORK_NETWORK_DISABLE_LEAVE_REMOTE_PED_BEHIND);
-		NETWORK.set_function("NETWORK_ALLOW_REMOTE_ATTACHMENT_MODIFICATION", LUA_NATIVE_NETWORK_NETWORK_ALLOW_REMOTE_ATTACHMENT_MODIFICATION);
-		NETWORK.set_function("NETWORK_SHOW_CHAT_RESTRICTION_MSC", LUA_NATIVE_NETWORK_NETWORK_SHOW_CHAT_RESTRICTION_MSC);
-		NETWORK.set_function("NETWORK_SHOW_PSN_UGC_RESTRICTION", LUA_NATIVE_NETWORK_NETWORK_SHOW_PSN_UGC_RESTRICTION);
-		NETWORK.set_function("NETWORK_IS_TITLE_UPDATE_REQUIRED", LUA_NATIVE_NETWORK_NETWORK_IS_TITLE_UPDATE_REQUIRED);
-		NETWORK.set_function("NETWORK_QUIT_MP_TO_DESKTOP", LUA_NATIVE_NETWORK_NETWORK_QUIT_MP_TO_DESKTOP);
-		NETWORK.set_function("NETWORK_IS_CONNECTED_VIA_RELAY", LUA_NATIVE_NETWORK_NETWORK_IS_CONNECTED_VIA_RELAY);
-		NETWORK.set_function("NETWORK_GET_AVERAGE_LATENCY", LUA_NATIVE_NETWORK_NETWORK_GET_AVERAGE_LATENCY);
-		NETWORK.set_function("NETWORK_GET_AVERAGE_PING", LUA_NATIVE_NETWORK_NETWORK_GET_AVERAGE_PING);
-		NETWORK.set_function("NETWORK_GET_AVERAGE_PACKET_LOSS", LUA_NATIVE_NETWORK_NETWORK_GET_AVERAGE_PACKET_LOSS);
-		NETWORK.set_function("NETWORK_GET_NUM_UNACKED_RELIABLES", LUA_NATIVE_NETWORK_NETWORK_GET_NUM_UNACKED_RELIABLES);
-		NETWORK.set_function("NETWORK_GET_UNRELIABLE_RESEND_COUNT", LUA_NATIVE_NETWORK_NETWORK_GET_UNRELIABLE_RESEND_COUNT);
-		NETWORK.set_function("NETWORK_GET_HIGHEST_RELIABLE_RESEND_COUNT", LUA_NATIVE_NETWORK_NETWORK_GET_HIGHEST_RELIABLE_RESEND_COUNT);
-		NETWORK.set_function("NETWORK_REPORT_CODE_TAMPER", LUA_NATIVE_NETWORK_NETWORK_REPORT_CODE_TAMPER);
-		NETWORK.set_function("NETWORK_GET_LAST_ENTITY_POS_RECEIVED_OVER_NETWORK", LUA_NATIVE_NETWORK_NETWORK_GET_LAST_ENTITY_POS_RECEIVED_OVER_NETWORK);
-		NETWORK.set_function("NETWORK_GET_LAST_PLAYER_POS_RECEIVED_OVER_NETWORK", LUA_NATIVE_NETWORK_NETWORK_GET_LAST_PLAYER_POS_RECEIVED_OVER_NETWORK);
-		NETWORK.set_function("NETWORK_GET_LAST_VEL_RECEIVED_OVER_NETWORK", LUA_NATIVE_NETWORK_NETWORK_GET_LAST_VEL_RECEIVED_OVER_NETWORK);
-		NETWORK.set_function("NETWORK_GET_PREDICTED_VELOCITY", LUA_NATIVE_NETWORK_NETWORK_GET_PREDICTED_VELOCITY);
-		NETWORK.set_function("NETWORK_DUMP_NET_IF_CONFIG", LUA_NATIVE_NETWORK_NETWORK_DUMP_NET_IF_CONFIG);
-		NETWORK.set_function("NETWORK_GET_SIGNALLING_INFO", LUA_NATIVE_NETWORK_NETWORK_GET_SIGNALLING_INFO);
-		NETWORK.set_function("NETWORK_GET_NET_STATISTICS_INFO", LUA_NATIVE_NETWORK_NETWORK_GET_NET_STATISTICS_INFO);
-		NETWORK.set_function("NETWORK_GET_PLAYER_ACCOUNT_ID", LUA_NATIVE_NETWORK_NETWORK_GET_PLAYER_ACCOUNT_ID);
-		NETWORK.set_function("NETWORK_UGC_NAV", LUA_NATIVE_NETWORK_NETWORK_UGC_NAV);
+		bind_namespace(L, "NETWORK", NETWORK_natives);
 	}
 }
@@ -896,171 +896,174 @@ namespace lua::native
 		OBJECT::SET_IS_OBJECT_BALL(object, toggle);
 	}
 
+	static constexpr native_entry OBJECT_natives[] = {
+		{"ADD_DOOR_TO_SYSTEM", native_function<LUA_NATIVE_OBJECT_ADD_DOOR_TO_SYSTEM>},
+		{"ADD_EXTENDED_PICKUP_PROBE_AREA", native_function<LUA_NATIVE_OBJECT_ADD_EXTENDED_PICKUP_PROBE_AREA>},
+		{"ALLOW_ALL_PLAYERS_TO_COLLECT_PICKUPS_OF_TYPE", native_function<LUA_NATIVE_OBJECT_ALLOW_ALL_PLAYERS_TO_COLLECT_PICKUPS_OF_TYPE>},
+		{"ALLOW_DAMAGE_EVENTS_FOR_NON_NETWORKED_OBJECTS", native_function<LUA_NATIVE_OBJECT_ALLOW_DAMAGE_EVENTS_FOR_NON_NETWORKED_OBJECTS>},
+		{"ALLOW_PICKUP_ARROW_MARKER_WHEN_UNCOLLECTABLE", native_function<LUA_NATIVE_OBJECT_ALLOW_PICKUP_ARROW_MARKER_WHEN_UNCOLLECTABLE>},
+		{"ALLOW_PICKUP_BY_NONE_PARTICIPANT", native_function<LUA_NATIVE_OBJECT_ALLOW_PICKUP_BY_NONE_PARTICIPANT>},
+		{"ALLOW_PORTABLE_PICKUP_TO_MIGRATE_TO_NON_PARTICIPANTS", native_function<LUA_NATIVE_OBJECT_ALLOW_PORTABLE_PICKUP_TO_MIGRATE_TO_NON_PARTICIPANTS>},
+		{"ARE_ENTITIES_ENTIRELY_INSIDE_GARAGE", native_function<LUA_NATIVE_OBJECT_ARE_ENTITIES_ENTIRELY_INSIDE_GARAGE>},
+		{"ATTACH_PORTABLE_PICKUP_TO_PED", native_function<LUA_NATIVE_OBJECT_ATTACH_PORTABLE_PICKUP_TO_PED>},
+		{"BLOCK_PLAYERS_FOR_AMBIENT_PICKUP", native_function<LUA_NATIVE_OBJECT_BLOCK_PLAYERS_FOR_AMBIENT_PICKUP>},
+		{"BREAK_OBJECT_FRAGMENT_CHILD", native_function<LUA_NATIVE_OBJECT_BREAK_OBJECT_FRAGMENT_CHILD>},
+		{"CLEAR_ALL_PICKUP_REWARD_TYPE_SUPPRESSION", native_function<LUA_NATIVE_OBJECT_CLEAR_ALL_PICKUP_REWARD_TYPE_SUPPRESSION>},
+		{"CLEAR_EXTENDED_PICKUP_PROBE_AREAS", native_function<LUA_NATIVE_OBJECT_CLEAR_EXTENDED_PICKUP_PROBE_AREAS>},
+		{"CLEAR_GARAGE", native_function<LUA_NATIVE_OBJECT_CLEAR_GARAGE>},
+		{"CLEAR_OBJECTS_INSIDE_GARAGE", native_function<LUA_NATIVE_OBJECT_CLEAR_OBJECTS_INSIDE_GARAGE>},
+		{"CLEAR_PICKUP_REWARD_TYPE_SUPPRESSION", native_function<LUA_NATIVE_OBJECT_CLEAR_PICKUP_REWARD_TYPE_SUPPRESSION>},
+		{"CLOSE_ALL_BARRIERS_FOR_RACE", native_function<LUA_NATIVE_OBJECT_CLOSE_ALL_BARRIERS_FOR_RACE>},
+		{"CLOSE_SAFEHOUSE_GARAGES", native_function<LUA_NATIVE_OBJECT_CLOSE_SAFEHOUSE_GARAGES>},
+		{"CONVERT_OLD_PICKUP_TYPE_TO_NEW", native_function<LUA_NATIVE_OBJECT_CONVERT_OLD_PICKUP_TYPE_TO_NEW>},
+		{"CREATE_AMBIENT_PICKUP", native_function<LUA_NATIVE_OBJECT_CREATE_AMBIENT_PICKUP>},
+		{"CREATE_MONEY_PICKUPS", native_function<LUA_NATIVE_OBJECT_CREATE_MONEY_PICKUPS>},
+		{"CREATE_NON_NETWORKED_AMBIENT_PICKUP", native_function<LUA_NATIVE_OBJECT_CREATE_NON_NETWORKED_AMBIENT_PICKUP>},
+		{"CREATE_NON_NETWORKED_PORTABLE_PICKUP", native_function<LUA_NATIVE_OBJECT_CREATE_NON_NETWORKED_PORTABLE_PICKUP>},
+		{"CREATE_OBJECT", native_function<LUA_NATIVE_OBJECT_CREATE_OBJECT>},
+		{"CREATE_OBJECT_NO_OFFSET", native_function<LUA_NATIVE_OBJECT_CREATE_OBJECT_NO_OFFSET>},
+		{"CREATE_PICKUP", native_function<LUA_NATIVE_OBJECT_CREATE_PICKUP>},
+		{"CREATE_PICKUP_ROTATE", native_function<LUA_NATIVE_OBJECT_CREATE_PICKUP_ROTATE>},
+		{"CREATE_PORTABLE_PICKUP", native_function<LUA_NATIVE_OBJECT_CREATE_PORTABLE_PICKUP>},
+		{"DAMAGE_OBJECT_FRAGMENT_CHILD", native_function<LUA_NATIVE_OBJECT_DAMAGE_OBJECT_FRAGMENT_CHILD>},
+		{"DELETE_OBJECT", native_function<LUA_NATIVE_OBJECT_DELETE_OBJECT>},
+		{"DETACH_PORTABLE_PICKUP_FROM_PED", native_function<LUA_NATIVE_OBJECT_DETACH_PORTABLE_PICKUP_FROM_PED>},
+		{"DISABLE_TIDYING_UP_IN_GARAGE", native_function<LUA_NATIVE_OBJECT_DISABLE_TIDYING_UP_IN_GARAGE>},
+		{"DOES_OBJECT_OF_TYPE_EXIST_AT_COORDS", native_function<LUA_NATIVE_OBJECT_DOES_OBJECT_OF_TYPE_EXIST_AT_COORDS>},
+		{"DOES_PICKUP_EXIST", native_function<LUA_NATIVE_OBJECT_DOES_PICKUP_EXIST>},
+		{"DOES_PICKUP_OBJECT_EXIST", native_function<LUA_NATIVE_OBJECT_DOES_PICKUP_OBJECT_EXIST>},
+		{"DOES_PICKUP_OF_TYPE_EXIST_IN_AREA", native_function<LUA_NATIVE_OBJECT_DOES_PICKUP_OF_TYPE_EXIST_IN_AREA>},
+		{"DOES_RAYFIRE_MAP_OBJECT_EXIST", native_function<LUA_NATIVE_OBJECT_DOES_RAYFIRE_MAP_OBJECT_EXIST>},
+		{"DOOR_SYSTEM_FIND_EXISTING_DOOR", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_FIND_EXISTING_DOOR>},
+		{"DOOR_SYSTEM_GET_AUTOMATIC_DISTANCE", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_AUTOMATIC_DISTANCE>},
+		{"DOOR_SYSTEM_GET_DOOR_PENDING_STATE", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_DOOR_PENDING_STATE>},
+		{"DOOR_SYSTEM_GET_DOOR_STATE", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_DOOR_STATE>},
+		{"DOOR_SYSTEM_GET_IS_PHYSICS_LOADED", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_IS_PHYSICS_LOADED>},
+		{"DOOR_SYSTEM_GET_OPEN_RATIO", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_OPEN_RATIO>},
+		{"DOOR_SYSTEM_SET_AUTOMATIC_DISTANCE", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_AUTOMATIC_DISTANCE>},
+		{"DOOR_SYSTEM_SET_AUTOMATIC_RATE", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_AUTOMATIC_RATE>},
+		{"DOOR_SYSTEM_SET_DOOR_OPEN_FOR_RACES", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_DOOR_OPEN_FOR_RACES>},
+		{"DOOR_SYSTEM_SET_DOOR_STATE", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_DOOR_STATE>},
+		{"DOOR_SYSTEM_SET_HOLD_OPEN", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_HOLD_OPEN>},
+		{"DOOR_SYSTEM_SET_OPEN_RATIO", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_OPEN_RATIO>},
+		{"DOOR_SYSTEM_SET_SPRING_REMOVED", native_function<LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_SPRING_REMOVED>},
+		{"ENABLE_SAVING_IN_GARAGE", native_function<LUA_NATIVE_OBJECT_ENABLE_SAVING_IN_GARAGE>},
+		{"FIX_OBJECT_FRAGMENT", native_function<LUA_NATIVE_OBJECT_FIX_OBJECT_FRAGMENT>},
+		{"FORCE_ACTIVATE_PHYSICS_ON_UNFIXED_PICKUP", native_function<LUA_NATIVE_OBJECT_FORCE_ACTIVATE_PHYSICS_ON_UNFIXED_PICKUP>},
+		{"FORCE_PICKUP_REGENERATE", native_function<LUA_NATIVE_OBJECT_FORCE_PICKUP_REGENERATE>},
+		{"FORCE_PICKUP_ROTATE_FACE_UP", native_function<LUA_NATIVE_OBJECT_FORCE_PICKUP_ROTATE_FACE_UP>},
+		{"FORCE_PORTABLE_PICKUP_LAST_ACCESSIBLE_POSITION_SETTING", native_function<LUA_NATIVE_OBJECT_FORCE_PORTABLE_PICKUP_LAST_ACCESSIBLE_POSITION_SETTING>},
+		{"GET_CLOSEST_OBJECT_OF_TYPE", native_function<LUA_NATIVE_OBJECT_GET_CLOSEST_OBJECT_OF_TYPE>},
+		{"GET_COORDS_AND_ROTATION_OF_CLOSEST_OBJECT_OF_TYPE", native_function<LUA_NATIVE_OBJECT_GET_COORDS_AND_ROTATION_OF_CLOSEST_OBJECT_OF_TYPE>},
+		{"GET_DEFAULT_AMMO_FOR_WEAPON_PICKUP", native_function<LUA_NATIVE_OBJECT_GET_DEFAULT_AMMO_FOR_WEAPON_PICKUP>},
+		{"GET_HAS_OBJECT_BEEN_COMPLETELY_DESTROYED", native_function<LUA_NATIVE_OBJECT_GET_HAS_OBJECT_BEEN_COMPLETELY_DESTROYED>},
+		{"GET_IS_ARTICULATED_JOINT_AT_MAX_ANGLE", native_function<LUA_NATIVE_OBJECT_GET_IS_ARTICULATED_JOINT_AT_MAX_ANGLE>},
+		{"GET_IS_ARTICULATED_JOINT_AT_MIN_ANGLE", native_function<LUA_NATIVE_OBJECT_GET_IS_ARTICULATED_JOINT_AT_MIN_ANGLE>},
+		{"GET_OBJECT_FRAGMENT_DAMAGE_HEALTH", native_function<LUA_NATIVE_OBJECT_GET_OBJECT_FRAGMENT_DAMAGE_HEALTH>},
+		{"GET_OBJECT_TINT_INDEX", native_function<LUA_NATIVE_OBJECT_GET_OBJECT_TINT_INDEX>},
+		{"GET_OFFSET_FROM_COORD_AND_HEADING_IN_WORLD_COORDS", native_function<LUA_NATIVE_OBJECT_GET_OFFSET_FROM_COORD_AND_HEADING_IN_WORLD_COORDS>},
+		{"GET_PICKUP_COORDS", native_function<LUA_NATIVE_OBJECT_GET_PICKUP_COORDS>},
+		{"GET_PICKUP_GENERATION_RANGE_MULTIPLIER", native_function<LUA_NATIVE_OBJECT_GET_PICKUP_GENERATION_RANGE_MULTIPLIER>},
+		{"GET_PICKUP_OBJECT", native_function<LUA_NATIVE_OBJECT_GET_PICKUP_OBJECT>},
+		{"GET_PICKUP_TYPE_FROM_WEAPON_HASH", native_function<LUA_NATIVE_OBJECT_GET_PICKUP_TYPE_FROM_WEAPON_HASH>},
+		{"GET_RAYFIRE_MAP_OBJECT", native_function<LUA_NATIVE_OBJECT_GET_RAYFIRE_MAP_OBJECT>},
+		{"GET_RAYFIRE_MAP_OBJECT_ANIM_PHASE", native_function<LUA_NATIVE_OBJECT_GET_RAYFIRE_MAP_OBJECT_ANIM_PHASE>},
+		{"GET_SAFE_PICKUP_COORDS", native_function<LUA_NATIVE_OBJECT_GET_SAFE_PICKUP_COORDS>},
+		{"GET_STATE_OF_CLOSEST_DOOR_OF_TYPE", native_function<LUA_NATIVE_OBJECT_GET_STATE_OF_CLOSEST_DOOR_OF_TYPE>},
+		{"GET_STATE_OF_RAYFIRE_MAP_OBJECT", native_function<LUA_NATIVE_OBJECT_GET_STATE_OF_RAYFIRE_MAP_OBJECT>},
+		{"GET_WEAPON_TYPE_FROM_PICKUP_TYPE", native_function<LUA_NATIVE_OBJECT_GET_WEAPON_TYPE_FROM_PICKUP_TYPE>},
+		{"HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_BROKEN", native_function<LUA_NATIVE_OBJECT_HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_BROKEN>},
+		{"HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_COMPLETELY_DESTROYED", native_function<LUA_NATIVE_OBJECT_HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_COMPLETELY_DESTROYED>},
+		{"HAS_OBJECT_BEEN_BROKEN", native_function<LUA_NATIVE_OBJECT_HAS_OBJECT_BEEN_BROKEN>},
+		{"HAS_PICKUP_BEEN_COLLECTED", native_function<LUA_NATIVE_OBJECT_HAS_PICKUP_BEEN_COLLECTED>},
+		{"HIDE_PORTABLE_PICKUP_WHEN_DETACHED", native_function<LUA_NATIVE_OBJECT_HIDE_PORTABLE_PICKUP_WHEN_DETACHED>},
+		{"IS_ANY_ENTITY_ENTIRELY_INSIDE_GARAGE", native_function<LUA_NATIVE_OBJECT_IS_ANY_ENTITY_ENTIRELY_INSIDE_GARAGE>},
+		{"IS_ANY_OBJECT_NEAR_POINT", native_function<LUA_NATIVE_OBJECT_IS_ANY_OBJECT_NEAR_POINT>},
+		{"IS_DOOR_CLOSED", native_function<LUA_NATIVE_OBJECT_IS_DOOR_CLOSED>},
+		{"IS_DOOR_REGISTERED_WITH_SYSTEM", native_function<LUA_NATIVE_OBJECT_IS_DOOR_REGISTERED_WITH_SYSTEM>},
+		{"IS_GARAGE_EMPTY", native_function<LUA_NATIVE_OBJECT_IS_GARAGE_EMPTY>},
+		{"IS_OBJECT_A_PICKUP", native_function<LUA_NATIVE_OBJECT_IS_OBJECT_A_PICKUP>},
+		{"IS_OBJECT_A_PORTABLE_PICKUP", native_function<LUA_NATIVE_OBJECT_IS_OBJECT_A_PORTABLE_PICKUP>},
+		{"IS_OBJECT_ENTIRELY_INSIDE_GARAGE", native_function<LUA_NATIVE_OBJECT_IS_OBJECT_ENTIRELY_INSIDE_GARAGE>},
+		{"IS_OBJECT_NEAR_POINT", native_function<LUA_NATIVE_OBJECT_IS_OBJECT_NEAR_POINT>},
+		{"IS_OBJECT_PARTIALLY_INSIDE_GARAGE", native_function<LUA_NATIVE_OBJECT_IS_OBJECT_PARTIALLY_INSIDE_GARAGE>},
+		{"IS_OBJECT_VISIBLE", native_function<LUA_NATIVE_OBJECT_IS_OBJECT_VISIBLE>},
+		{"IS_PICKUP_WEAPON_OBJECT_VALID", native_function<LUA_NATIVE_OBJECT_IS_PICKUP_WEAPON_OBJECT_VALID>},
+		{"IS_PLAYER_ENTIRELY_INSIDE_GARAGE", native_function<LUA_NATIVE_OBJECT_IS_PLAYER_ENTIRELY_INSIDE_GARAGE>},
+		{"IS_PLAYER_PARTIALLY_INSIDE_GARAGE", native_function<LUA_NATIVE_OBJECT_IS_PLAYER_PARTIALLY_INSIDE_GARAGE>},
+		{"IS_POINT_IN_ANGLED_AREA", native_function<LUA_NATIVE_OBJECT_IS_POINT_IN_ANGLED_AREA>},
+		{"IS_PROP_LIGHT_OVERRIDEN", native_function<LUA_NATIVE_OBJECT_IS_PROP_LIGHT_OVERRIDEN>},
+		{"ONLY_CLEAN_UP_OBJECT_WHEN_OUT_OF_RANGE", native_function<LUA_NATIVE_OBJECT_ONLY_CLEAN_UP_OBJECT_WHEN_OUT_OF_RANGE>},
+		{"OPEN_ALL_BARRIERS_FOR_RACE", native_function<LUA_NATIVE_OBJECT_OPEN_ALL_BARRIERS_FOR_RACE>},
+		{"PLACE_OBJECT_ON_GROUND_OR_OBJECT_PROPERLY", native_function<LUA_NATIVE_OBJECT_PLACE_OBJECT_ON_GROUND_OR_OBJECT_PROPERLY>},
+		{"PLACE_OBJECT_ON_GROUND_PROPERLY", native_function<LUA_NATIVE_OBJECT_PLACE_OBJECT_ON_GROUND_PROPERLY>},
+		{"PLAY_OBJECT_AUTO_START_ANIM", native_function<LUA_NATIVE_OBJECT_PLAY_OBJECT_AUTO_START_ANIM>},
+		{"PREVENT_COLLECTION_OF_PORTABLE_PICKUP", native_function<LUA_NATIVE_OBJECT_PREVENT_COLLECTION_OF_PORTABLE_PICKUP>},
+		{"REMOVE_ALL_PICKUPS_OF_TYPE", native_function<LUA_NATIVE_OBJECT_REMOVE_ALL_PICKUPS_OF_TYPE>},
+		{"REMOVE_DOOR_FROM_SYSTEM", native_function<LUA_NATIVE_OBJECT_REMOVE_DOOR_FROM_SYSTEM>},
+		{"REMOVE_OBJECT_HIGH_DETAIL_MODEL", native_function<LUA_NATIVE_OBJECT_REMOVE_OBJECT_HIGH_DETAIL_MODEL>},
+		{"REMOVE_PICKUP", native_function<LUA_NATIVE_OBJECT_REMOVE_PICKUP>},
+		{"RENDER_FAKE_PICKUP_GLOW", native_function<LUA_NATIVE_OBJECT_RENDER_FAKE_PICKUP_GLOW>},
+		{"ROTATE_OBJECT", native_function<LUA_NATIVE_OBJECT_ROTATE_OBJECT>},
+		{"SET_ACTIVATE_OBJECT_PHYSICS_AS_SOON_AS_IT_IS_UNFROZEN", native_function<LUA_NATIVE_OBJECT_SET_ACTIVATE_OBJECT_PHYSICS_AS_SOON_AS_IT_IS_UNFROZEN>},
+		{"SET_CUSTOM_PICKUP_WEAPON_HASH", native_function<LUA_NATIVE_OBJECT_SET_CUSTOM_PICKUP_WEAPON_HASH>},
+		{"SET_CUTSCENES_WEAPON_FLASHLIGHT_ON_THIS_FRAME", native_function<LUA_NATIVE_OBJECT_SET_CUTSCENES_WEAPON_FLASHLIGHT_ON_THIS_FRAME>},
+		{"SET_DISABLE_COLLISIONS_BETWEEN_CARS_AND_CAR_PARACHUTE", native_function<LUA_NATIVE_OBJECT_SET_DISABLE_COLLISIONS_BETWEEN_CARS_AND_CAR_PARACHUTE>},
+		{"SET_DRIVE_ARTICULATED_JOINT", native_function<LUA_NATIVE_OBJECT_SET_DRIVE_ARTICULATED_JOINT>},
+		{"SET_DRIVE_ARTICULATED_JOINT_WITH_INFLICTOR", native_function<LUA_NATIVE_OBJECT_SET_DRIVE_ARTICULATED_JOINT_WITH_INFLICTOR>},
+		{"SET_ENTITY_FLAG_RENDER_SMALL_SHADOW", native_function<LUA_NATIVE_OBJECT_SET_ENTITY_FLAG_RENDER_SMALL_SHADOW>},
+		{"SET_ENTITY_FLAG_SUPPRESS_SHADOW", native_function<LUA_NATIVE_OBJECT_SET_ENTITY_FLAG_SUPPRESS_SHADOW>},
+		{"SET_FORCE_OBJECT_THIS_FRAME", native_function<LUA_NATIVE_OBJECT_SET_FORCE_OBJECT_THIS_FRAME>},
+		{"SET_IS_OBJECT_ARTICULATED", native_function<LUA_NATIVE_OBJECT_SET_IS_OBJECT_ARTICULATED>},
+		{"SET_IS_OBJECT_BALL", native_function<LUA_NATIVE_OBJECT_SET_IS_OBJECT_BALL>},
+		{"SET_LOCAL_PLAYER_CAN_COLLECT_PORTABLE_PICKUPS", native_function<LUA_NATIVE_OBJECT_SET_LOCAL_PLAYER_CAN_COLLECT_PORTABLE_PICKUPS>},
+		{"SET_LOCAL_PLAYER_PERMITTED_TO_COLLECT_PICKUPS_WITH_MODEL", native_function<LUA_NATIVE_OBJECT_SET_LOCAL_PLAYER_PERMITTED_TO_COLLECT_PICKUPS_WITH_MODEL>},
+		{"SET_LOCKED_UNSTREAMED_IN_DOOR_OF_TYPE", native_function<LUA_NATIVE_OBJECT_SET_LOCKED_UNSTREAMED_IN_DOOR_OF_TYPE>},
+		{"SET_MAX_NUM_PORTABLE_PICKUPS_CARRIED_BY_PLAYER", native_function<LUA_NATIVE_OBJECT_SET_MAX_NUM_PORTABLE_PICKUPS_CARRIED_BY_PLAYER>},
+		{"SET_OBJECT_ALLOW_LOW_LOD_BUOYANCY", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_ALLOW_LOW_LOD_BUOYANCY>},
+		{"SET_OBJECT_FORCE_VEHICLES_TO_AVOID", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_FORCE_VEHICLES_TO_AVOID>},
+		{"SET_OBJECT_GLOW_IN_SAME_TEAM", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_GLOW_IN_SAME_TEAM>},
+		{"SET_OBJECT_IS_A_PRESSURE_PLATE", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_IS_A_PRESSURE_PLATE>},
+		{"SET_OBJECT_IS_SPECIAL_GOLFBALL", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_IS_SPECIAL_GOLFBALL>},
+		{"SET_OBJECT_IS_VISIBLE_IN_MIRRORS", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_IS_VISIBLE_IN_MIRRORS>},
+		{"SET_OBJECT_PHYSICS_PARAMS", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_PHYSICS_PARAMS>},
+		{"SET_OBJECT_SPEED_BOOST_AMOUNT", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_SPEED_BOOST_AMOUNT>},
+		{"SET_OBJECT_SPEED_BOOST_DURATION", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_SPEED_BOOST_DURATION>},
+		{"SET_OBJECT_TAKES_DAMAGE_FROM_COLLIDING_WITH_BUILDINGS", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_TAKES_DAMAGE_FROM_COLLIDING_WITH_BUILDINGS>},
+		{"SET_OBJECT_TARGETTABLE", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_TARGETTABLE>},
+		{"SET_OBJECT_TINT_INDEX", native_function<LUA_NATIVE_OBJECT_SET_OBJECT_TINT_INDEX>},
+		{"SET_ONLY_ALLOW_AMMO_COLLECTION_WHEN_LOW", native_function<LUA_NATIVE_OBJECT_SET_ONLY_ALLOW_AMMO_COLLECTION_WHEN_LOW>},
+		{"SET_PICKUP_GENERATION_RANGE_MULTIPLIER", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_GENERATION_RANGE_MULTIPLIER>},
+		{"SET_PICKUP_GLOW_OFFSET", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_GLOW_OFFSET>},
+		{"SET_PICKUP_HIDDEN_WHEN_UNCOLLECTABLE", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_HIDDEN_WHEN_UNCOLLECTABLE>},
+		{"SET_PICKUP_OBJECT_ALPHA_WHEN_TRANSPARENT", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_ALPHA_WHEN_TRANSPARENT>},
+		{"SET_PICKUP_OBJECT_ARROW_MARKER", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_ARROW_MARKER>},
+		{"SET_PICKUP_OBJECT_COLLECTABLE_IN_VEHICLE", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_COLLECTABLE_IN_VEHICLE>},
+		{"SET_PICKUP_OBJECT_GLOW_OFFSET", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_GLOW_OFFSET>},
+		{"SET_PICKUP_OBJECT_GLOW_WHEN_UNCOLLECTABLE", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_GLOW_WHEN_UNCOLLECTABLE>},
+		{"SET_PICKUP_OBJECT_TRANSPARENT_WHEN_UNCOLLECTABLE", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_TRANSPARENT_WHEN_UNCOLLECTABLE>},
+		{"SET_PICKUP_REGENERATION_TIME", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_REGENERATION_TIME>},
+		{"SET_PICKUP_TRACK_DAMAGE_EVENTS", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_TRACK_DAMAGE_EVENTS>},
+		{"SET_PICKUP_TRANSPARENT_WHEN_UNCOLLECTABLE", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_TRANSPARENT_WHEN_UNCOLLECTABLE>},
+		{"SET_PICKUP_UNCOLLECTABLE", native_function<LUA_NATIVE_OBJECT_SET_PICKUP_UNCOLLECTABLE>},
+		{"SET_PLAYER_PERMITTED_TO_COLLECT_PICKUPS_OF_TYPE", native_function<LUA_NATIVE_OBJECT_SET_PLAYER_PERMITTED_TO_COLLECT_PICKUPS_OF_TYPE>},
+		{"SET_PORTABLE_PICKUP_PERSIST", native_function<LUA_NATIVE_OBJECT_SET_PORTABLE_PICKUP_PERSIST>},
+		{"SET_PROJECTILES_SHOULD_EXPLODE_ON_CONTACT", native_function<LUA_NATIVE_OBJECT_SET_PROJECTILES_SHOULD_EXPLODE_ON_CONTACT>},
+		{"SET_PROP_LIGHT_COLOR", native_function<LUA_NATIVE_OBJECT_SET_PROP_LIGHT_COLOR>},
+		{"SET_PROP_TINT_INDEX", native_function<LUA_NATIVE_OBJECT_SET_PROP_TINT_INDEX>},
+		{"SET_STATE_OF_CLOSEST_DOOR_OF_TYPE", native_function<LUA_NATIVE_OBJECT_SET_STATE_OF_CLOSEST_DOOR_OF_TYPE>},
+		{"SET_STATE_OF_RAYFIRE_MAP_OBJECT", native_function<LUA_NATIVE_OBJECT_SET_STATE_OF_RAYFIRE_MAP_OBJECT>},
+		{"SET_TEAM_PICKUP_OBJECT", native_function<LUA_NATIVE_OBJECT_SET_TEAM_PICKUP_OBJECT>},
+		{"SET_TINT_INDEX_CLOSEST_BUILDING_OF_TYPE", native_function<LUA_NATIVE_OBJECT_SET_TINT_INDEX_CLOSEST_BUILDING_OF_TYPE>},
+		{"SET_WEAPON_IMPACTS_APPLY_GREATER_FORCE", native_function<LUA_NATIVE_OBJECT_SET_WEAPON_IMPACTS_APPLY_GREATER_FORCE>},
+		{"SLIDE_OBJECT", native_function<LUA_NATIVE_OBJECT_SLIDE_OBJECT>},
+		{"SUPPRESS_PICKUP_REWARD_TYPE", native_function<LUA_NATIVE_OBJECT_SUPPRESS_PICKUP_REWARD_TYPE>},
+		{"SUPPRESS_PICKUP_SOUND_FOR_PICKUP", native_function<LUA_NATIVE_OBJECT_SUPPRESS_PICKUP_SOUND_FOR_PICKUP>},
+		{"TRACK_OBJECT_VISIBILITY", native_function<LUA_NATIVE_OBJECT_TRACK_OBJECT_VISIBILITY>},
+	};
+
 	void init_native_binding_OBJECT(sol::state& L)
 	{
-		auto OBJECT = L["OBJECT"].get_or_create<sol::table>();
-		OBJECT.set_function("CREATE_OBJECT", LUA_NATIVE_OBJECT_CREATE_OBJECT);
-		OBJECT.set_function("CREATE_OBJECT_NO_OFFSET", LUA_NATIVE_OBJECT_CREATE_OBJECT_NO_OFFSET);
-		OBJECT.set_function("DELETE_OBJECT", LUA_NATIVE_OBJECT_DELETE_OBJECT);
-		OBJECT.set_function("PLACE_OBJECT_ON_GROUND_PROPERLY", LUA_NATIVE_OBJECT_PLACE_OBJECT_ON_GROUND_PROPERLY);
-		OBJECT.set_function("PLACE_OBJECT_ON_GROUND_OR_OBJECT_PROPERLY", LUA_NATIVE_OBJECT_PLACE_OBJECT_ON_GROUND_OR_OBJECT_PROPERLY);
-		OBJECT.set_function("ROTATE_OBJECT", LUA_NATIVE_OBJECT_ROTATE_OBJECT);
-		OBJECT.set_function("SLIDE_OBJECT", LUA_NATIVE_OBJECT_SLIDE_OBJECT);
-		OBJECT.set_function("SET_OBJECT_TARGETTABLE", LUA_NATIVE_OBJECT_SET_OBJECT_TARGETTABLE);
-		OBJECT.set_function("SET_OBJECT_FORCE_VEHICLES_TO_AVOID", LUA_NATIVE_OBJECT_SET_OBJECT_FORCE_VEHICLES_TO_AVOID);
-		OBJECT.set_function("GET_CLOSEST_OBJECT_OF_TYPE", LUA_NATIVE_OBJECT_GET_CLOSEST_OBJECT_OF_TYPE);
-		OBJECT.set_function("HAS_OBJECT_BEEN_BROKEN", LUA_NATIVE_OBJECT_HAS_OBJECT_BEEN_BROKEN);
-		OBJECT.set_function("HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_BROKEN", LUA_NATIVE_OBJECT_HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_BROKEN);
-		OBJECT.set_function("HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_COMPLETELY_DESTROYED", LUA_NATIVE_OBJECT_HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_COMPLETELY_DESTROYED);
-		OBJECT.set_function("GET_HAS_OBJECT_BEEN_COMPLETELY_DESTROYED", LUA_NATIVE_OBJECT_GET_HAS_OBJECT_BEEN_COMPLETELY_DESTROYED);
-		OBJECT.set_function("GET_OFFSET_FROM_COORD_AND_HEADING_IN_WORLD_COORDS", LUA_NATIVE_OBJECT_GET_OFFSET_FROM_COORD_AND_HEADING_IN_WORLD_COORDS);
-		OBJECT.set_function("GET_COORDS_AND_ROTATION_OF_CLOSEST_OBJECT_OF_TYPE", LUA_NATIVE_OBJECT_GET_COORDS_AND_ROTATION_OF_CLOSEST_OBJECT_OF_TYPE);
-		OBJECT.set_function("SET_STATE_OF_CLOSEST_DOOR_OF_TYPE", LUA_NATIVE_OBJECT_SET_STATE_OF_CLOSEST_DOOR_OF_TYPE);
-		OBJECT.set_function("GET_STATE_OF_CLOSEST_DOOR_OF_TYPE", LUA_NATIVE_OBJECT_GET_STATE_OF_CLOSEST_DOOR_OF_TYPE);
-		OBJECT.set_function("SET_LOCKED_UNSTREAMED_IN_DOOR_OF_TYPE", LUA_NATIVE_OBJECT_SET_LOCKED_UNSTREAMED_IN_DOOR_OF_TYPE);
-		OBJECT.set_function("PLAY_OBJECT_AUTO_START_ANIM", LUA_NATIVE_OBJECT_PLAY_OBJECT_AUTO_START_ANIM);
-		OBJECT.set_function("ADD_DOOR_TO_SYSTEM", LUA_NATIVE_OBJECT_ADD_DOOR_TO_SYSTEM);
-		OBJECT.set_function("REMOVE_DOOR_FROM_SYSTEM", LUA_NATIVE_OBJECT_REMOVE_DOOR_FROM_SYSTEM);
-		OBJECT.set_function("DOOR_SYSTEM_SET_DOOR_STATE", LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_DOOR_STATE);
-		OBJECT.set_function("DOOR_SYSTEM_GET_DOOR_STATE", LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_DOOR_STATE);
-		OBJECT.set_function("DOOR_SYSTEM_GET_DOOR_PENDING_STATE", LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_DOOR_PENDING_STATE);
-		OBJECT.set_function("DOOR_SYSTEM_SET_AUTOMATIC_RATE", LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_AUTOMATIC_RATE);
-		OBJECT.set_function("DOOR_SYSTEM_SET_AUTOMATIC_DISTANCE", LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_AUTOMATIC_DISTANCE);
-		OBJECT.set_function("DOOR_SYSTEM_SET_OPEN_RATIO", LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_OPEN_RATIO);
-		OBJECT.set_function("DOOR_SYSTEM_GET_AUTOMATIC_DISTANCE", LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_AUTOMATIC_DISTANCE);
-		OBJECT.set_function("DOOR_SYSTEM_GET_OPEN_RATIO", LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_OPEN_RATIO);
-		OBJECT.set_function("DOOR_SYSTEM_SET_SPRING_REMOVED", LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_SPRING_REMOVED);
-		OBJECT.set_function("DOOR_SYSTEM_SET_HOLD_OPEN", LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_HOLD_OPEN);
-		OBJECT.set_function("DOOR_SYSTEM_SET_DOOR_OPEN_FOR_RACES", LUA_NATIVE_OBJECT_DOOR_SYSTEM_SET_DOOR_OPEN_FOR_RACES);
-		OBJECT.set_function("IS_DOOR_REGISTERED_WITH_SYSTEM", LUA_NATIVE_OBJECT_IS_DOOR_REGISTERED_WITH_SYSTEM);
-		OBJECT.set_function("IS_DOOR_CLOSED", LUA_NATIVE_OBJECT_IS_DOOR_CLOSED);
-		OBJECT.set_function("OPEN_ALL_BARRIERS_FOR_RACE", LUA_NATIVE_OBJECT_OPEN_ALL_BARRIERS_FOR_RACE);
-		OBJECT.set_function("CLOSE_ALL_BARRIERS_FOR_RACE", LUA_NATIVE_OBJECT_CLOSE_ALL_BARRIERS_FOR_RACE);
-		OBJECT.set_function("DOOR_SYSTEM_GET_IS_PHYSICS_LOADED", LUA_NATIVE_OBJECT_DOOR_SYSTEM_GET_IS_PHYSICS_LOADED);
-		OBJECT.set_function("DOOR_SYSTEM_FIND_EXISTING_DOOR", LUA_NATIVE_OBJECT_DOOR_SYSTEM_FIND_EXISTING_DOOR);
-		OBJECT.set_function("IS_GARAGE_EMPTY", LUA_NATIVE_OBJECT_IS_GARAGE_EMPTY);
-		OBJECT.set_function("IS_PLAYER_ENTIRELY_INSIDE_GARAGE", LUA_NATIVE_OBJECT_IS_PLAYER_ENTIRELY_INSIDE_GARAGE);
-		OBJECT.set_function("IS_PLAYER_PARTIALLY_INSIDE_GARAGE", LUA_NATIVE_OBJECT_IS_PLAYER_PARTIALLY_INSIDE_GARAGE);
-		OBJECT.set_function("ARE_ENTITIES_ENTIRELY_INSIDE_GARAGE", LUA_NATIVE_OBJECT_ARE_ENTITIES_ENTIRELY_INSIDE_GARAGE);
-		OBJECT.set_function("IS_ANY_ENTITY_ENTIRELY_INSIDE_GARAGE", LUA_NATIVE_OBJECT_IS_ANY_ENTITY_ENTIRELY_INSIDE_GARAGE);
-		OBJECT.set_function("IS_OBJECT_ENTIRELY_INSIDE_GARAGE", LUA_NATIVE_OBJECT_IS_OBJECT_ENTIRELY_INSIDE_GARAGE);
-		OBJECT.set_function("IS_OBJECT_PARTIALLY_INSIDE_GARAGE", LUA_NATIVE_OBJECT_IS_OBJECT_PARTIALLY_INSIDE_GARAGE);
-		OBJECT.set_function("CLEAR_GARAGE", LUA_NATIVE_OBJECT_CLEAR_GARAGE);
-		OBJECT.set_function("CLEAR_OBJECTS_INSIDE_GARAGE", LUA_NATIVE_OBJECT_CLEAR_OBJECTS_INSIDE_GARAGE);
-		OBJECT.set_function("DISABLE_TIDYING_UP_IN_GARAGE", LUA_NATIVE_OBJECT_DISABLE_TIDYING_UP_IN_GARAGE);
-		OBJECT.set_function("ENABLE_SAVING_IN_GARAGE", LUA_NATIVE_OBJECT_ENABLE_SAVING_IN_GARAGE);
-		OBJECT.set_function("CLOSE_SAFEHOUSE_GARAGES", LUA_NATIVE_OBJECT_CLOSE_SAFEHOUSE_GARAGES);
-		OBJECT.set_function("DOES_OBJECT_OF_TYPE_EXIST_AT_COORDS", LUA_NATIVE_OBJECT_DOES_OBJECT_OF_TYPE_EXIST_AT_COORDS);
-		OBJECT.set_function("IS_POINT_IN_ANGLED_AREA", LUA_NATIVE_OBJECT_IS_POINT_IN_ANGLED_AREA);
-		OBJECT.set_function("SET_OBJECT_ALLOW_LOW_LOD_BUOYANCY", LUA_NATIVE_OBJECT_SET_OBJECT_ALLOW_LOW_LOD_BUOYANCY);
-		OBJECT.set_function("SET_OBJECT_PHYSICS_PARAMS", LUA_NATIVE_OBJECT_SET_OBJECT_PHYSICS_PARAMS);
-		OBJECT.set_function("GET_OBJECT_FRAGMENT_DAMAGE_HEALTH", LUA_NATIVE_OBJECT_GET_OBJECT_FRAGMENT_DAMAGE_HEALTH);
-		OBJECT.set_function("SET_ACTIVATE_OBJECT_PHYSICS_AS_SOON_AS_IT_IS_UNFROZEN", LUA_NATIVE_OBJECT_SET_ACTIVATE_OBJECT_PHYSICS_AS_SOON_AS_IT_IS_UNFROZEN);
-		OBJECT.set_function("IS_ANY_OBJECT_NEAR_POINT", LUA_NATIVE_OBJECT_IS_ANY_OBJECT_NEAR_POINT);
-		OBJECT.set_function("IS_OBJECT_NEAR_POINT", LUA_NATIVE_OBJECT_IS_OBJECT_NEAR_POINT);
-		OBJECT.set_function("REMOVE_OBJECT_HIGH_DETAIL_MODEL", LUA_NATIVE_OBJECT_REMOVE_OBJECT_HIGH_DETAIL_MODEL);
-		OBJECT.set_function("BREAK_OBJECT_FRAGMENT_CHILD", LUA_NATIVE_OBJECT_BREAK_OBJECT_FRAGMENT_CHILD);
-		OBJECT.set_function("DAMAGE_OBJECT_FRAGMENT_CHILD", LUA_NATIVE_OBJECT_DAMAGE_OBJECT_FRAGMENT_CHILD);
-		OBJECT.set_function("FIX_OBJECT_FRAGMENT", LUA_NATIVE_OBJECT_FIX_OBJECT_FRAGMENT);
-		OBJECT.set_function("TRACK_OBJECT_VISIBILITY", LUA_NATIVE_OBJECT_TRACK_OBJECT_VISIBILITY);
-		OBJECT.set_function("IS_OBJECT_VISIBLE", LUA_NATIVE_OBJECT_IS_OBJECT_VISIBLE);
-		OBJECT.set_function("SET_OBJECT_IS_SPECIAL_GOLFBALL", LUA_NATIVE_OBJECT_SET_OBJECT_IS_SPECIAL_GOLFBALL);
-		OBJECT.set_function("SET_OBJECT_TAKES_DAMAGE_FROM_COLLIDING_WITH_BUILDINGS", LUA_NATIVE_OBJECT_SET_OBJECT_TAKES_DAMAGE_FROM_COLLIDING_WITH_BUILDINGS);
-		OBJECT.set_function("ALLOW_DAMAGE_EVENTS_FOR_NON_NETWORKED_OBJECTS", LUA_NATIVE_OBJECT_ALLOW_DAMAGE_EVENTS_FOR_NON_NETWORKED_OBJECTS);
-		OBJECT.set_function("SET_CUTSCENES_WEAPON_FLASHLIGHT_ON_THIS_FRAME", LUA_NATIVE_OBJECT_SET_CUTSCENES_WEAPON_FLASHLIGHT_ON_THIS_FRAME);
-		OBJECT.set_function("GET_RAYFIRE_MAP_OBJECT", LUA_NATIVE_OBJECT_GET_RAYFIRE_MAP_OBJECT);
-		OBJECT.set_function("SET_STATE_OF_RAYFIRE_MAP_OBJECT", LUA_NATIVE_OBJECT_SET_STATE_OF_RAYFIRE_MAP_OBJECT);
-		OBJECT.set_function("GET_STATE_OF_RAYFIRE_MAP_OBJECT", LUA_NATIVE_OBJECT_GET_STATE_OF_RAYFIRE_MAP_OBJECT);
-		OBJECT.set_function("DOES_RAYFIRE_MAP_OBJECT_EXIST", LUA_NATIVE_OBJECT_DOES_RAYFIRE_MAP_OBJECT_EXIST);
-		OBJECT.set_function("GET_RAYFIRE_MAP_OBJECT_ANIM_PHASE", LUA_NATIVE_OBJECT_GET_RAYFIRE_MAP_OBJECT_ANIM_PHASE);
-		OBJECT.set_function("CREATE_PICKUP", LUA_NATIVE_OBJECT_CREATE_PICKUP);
-		OBJECT.set_function("CREATE_PICKUP_ROTATE", LUA_NATIVE_OBJECT_CREATE_PICKUP_ROTATE);
-		OBJECT.set_function("FORCE_PICKUP_ROTATE_FACE_UP", LUA_NATIVE_OBJECT_FORCE_PICKUP_ROTATE_FACE_UP);
-		OBJECT.set_function("SET_CUSTOM_PICKUP_WEAPON_HASH", LUA_NATIVE_OBJECT_SET_CUSTOM_PICKUP_WEAPON_HASH);
-		OBJECT.set_function("CREATE_AMBIENT_PICKUP", LUA_NATIVE_OBJECT_CREATE_AMBIENT_PICKUP);
-		OBJECT.set_function("CREATE_NON_NETWORKED_AMBIENT_PICKUP", LUA_NATIVE_OBJECT_CREATE_NON_NETWORKED_AMBIENT_PICKUP);
-		OBJECT.set_function("BLOCK_PLAYERS_FOR_AMBIENT_PICKUP", LUA_NATIVE_OBJECT_BLOCK_PLAYERS_FOR_AMBIENT_PICKUP);
-		OBJECT.set_function("CREATE_PORTABLE_PICKUP", LUA_NATIVE_OBJECT_CREATE_PORTABLE_PICKUP);
-		OBJECT.set_function("CREATE_NON_NETWORKED_PORTABLE_PICKUP", LUA_NATIVE_OBJECT_CREATE_NON_NETWORKED_PORTABLE_PICKUP);
-		OBJECT.set_function("ATTACH_PORTABLE_PICKUP_TO_PED", LUA_NATIVE_OBJECT_ATTACH_PORTABLE_PICKUP_TO_PED);
-		OBJECT.set_function("DETACH_PORTABLE_PICKUP_FROM_PED", LUA_NATIVE_OBJECT_DETACH_PORTABLE_PICKUP_FROM_PED);
-		OBJECT.set_function("FORCE_PORTABLE_PICKUP_LAST_ACCESSIBLE_POSITION_SETTING", LUA_NATIVE_OBJECT_FORCE_PORTABLE_PICKUP_LAST_ACCESSIBLE_POSITION_SETTING);
-		OBJECT.set_function("HIDE_PORTABLE_PICKUP_WHEN_DETACHED", LUA_NATIVE_OBJECT_HIDE_PORTABLE_PICKUP_WHEN_DETACHED);
-		OBJECT.set_function("SET_MAX_NUM_PORTABLE_PICKUPS_CARRIED_BY_PLAYER", LUA_NATIVE_OBJECT_SET_MAX_NUM_PORTABLE_PICKUPS_CARRIED_BY_PLAYER);
-		OBJECT.set_function("SET_LOCAL_PLAYER_CAN_COLLECT_PORTABLE_PICKUPS", LUA_NATIVE_OBJECT_SET_LOCAL_PLAYER_CAN_COLLECT_PORTABLE_PICKUPS);
-		OBJECT.set_function("GET_SAFE_PICKUP_COORDS", LUA_NATIVE_OBJECT_GET_SAFE_PICKUP_COORDS);
-		OBJECT.set_function("ADD_EXTENDED_PICKUP_PROBE_AREA", LUA_NATIVE_OBJECT_ADD_EXTENDED_PICKUP_PROBE_AREA);
-		OBJECT.set_function("CLEAR_EXTENDED_PICKUP_PROBE_AREAS", LUA_NATIVE_OBJECT_CLEAR_EXTENDED_PICKUP_PROBE_AREAS);
-		OBJECT.set_function("GET_PICKUP_COORDS", LUA_NATIVE_OBJECT_GET_PICKUP_COORDS);
-		OBJECT.set_function("SUPPRESS_PICKUP_SOUND_FOR_PICKUP", LUA_NATIVE_OBJECT_SUPPRESS_PICKUP_SOUND_FOR_PICKUP);
-		OBJECT.set_function("REMOVE_ALL_PICKUPS_OF_TYPE", LUA_NATIVE_OBJECT_REMOVE_ALL_PICKUPS_OF_TYPE);
-		OBJECT.set_function("HAS_PICKUP_BEEN_COLLECTED", LUA_NATIVE_OBJECT_HAS_PICKUP_BEEN_COLLECTED);
-		OBJECT.set_function("REMOVE_PICKUP", LUA_NATIVE_OBJECT_REMOVE_PICKUP);
-		OBJECT.set_function("CREATE_MONEY_PICKUPS", LUA_NATIVE_OBJECT_CREATE_MONEY_PICKUPS);
-		OBJECT.set_function("DOES_PICKUP_EXIST", LUA_NATIVE_OBJECT_DOES_PICKUP_EXIST);
-		OBJECT.set_function("DOES_PICKUP_OBJECT_EXIST", LUA_NATIVE_OBJECT_DOES_PICKUP_OBJECT_EXIST);
-		OBJECT.set_function("GET_PICKUP_OBJECT", LUA_NATIVE_OBJECT_GET_PICKUP_OBJECT);
-		OBJECT.set_function("IS_OBJECT_A_PICKUP", LUA_NATIVE_OBJECT_IS_OBJECT_A_PICKUP);
-		OBJECT.set_function("IS_OBJECT_A_PORTABLE_PICKUP", LUA_NATIVE_OBJECT_IS_OBJECT_A_PORTABLE_PICKUP);
-		OBJECT.set_function("DOES_PICKUP_OF_TYPE_EXIST_IN_AREA", LUA_NATIVE_OBJECT_DOES_PICKUP_OF_TYPE_EXIST_IN_AREA);
-		OBJECT.set_function("SET_PICKUP_REGENERATION_TIME", LUA_NATIVE_OBJECT_SET_PICKUP_REGENERATION_TIME);
-		OBJECT.set_function("FORCE_PICKUP_REGENERATE", LUA_NATIVE_OBJECT_FORCE_PICKUP_REGENERATE);
-		OBJECT.set_function("SET_PLAYER_PERMITTED_TO_COLLECT_PICKUPS_OF_TYPE", LUA_NATIVE_OBJECT_SET_PLAYER_PERMITTED_TO_COLLECT_PICKUPS_OF_TYPE);
-		OBJECT.set_function("SET_LOCAL_PLAYER_PERMITTED_TO_COLLECT_PICKUPS_WITH_MODEL", LUA_NATIVE_OBJECT_SET_LOCAL_PLAYER_PERMITTED_TO_COLLECT_PICKUPS_WITH_MODEL);
-		OBJECT.set_function("ALLOW_ALL_PLAYERS_TO_COLLECT_PICKUPS_OF_TYPE", LUA_NATIVE_OBJECT_ALLOW_ALL_PLAYERS_TO_COLLECT_PICKUPS_OF_TYPE);
-		OBJECT.set_function("SET_TEAM_PICKUP_OBJECT", LUA_NATIVE_OBJECT_SET_TEAM_PICKUP_OBJECT);
-		OBJECT.set_function("PREVENT_COLLECTION_OF_PORTABLE_PICKUP", LUA_NATIVE_OBJECT_PREVENT_COLLECTION_OF_PORTABLE_PICKUP);
-		OBJECT.set_function("SET_PICKUP_OBJECT_GLOW_WHEN_UNCOLLECTABLE", LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_GLOW_WHEN_UNCOLLECTABLE);
-		OBJECT.set_function("SET_PICKUP_GLOW_OFFSET", LUA_NATIVE_OBJECT_SET_PICKUP_GLOW_OFFSET);
-		OBJECT.set_function("SET_PICKUP_OBJECT_GLOW_OFFSET", LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_GLOW_OFFSET);
-		OBJECT.set_function("SET_OBJECT_GLOW_IN_SAME_TEAM", LUA_NATIVE_OBJECT_SET_OBJECT_GLOW_IN_SAME_TEAM);
-		OBJECT.set_function("SET_PICKUP_OBJECT_ARROW_MARKER", LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_ARROW_MARKER);
-		OBJECT.set_function("ALLOW_PICKUP_ARROW_MARKER_WHEN_UNCOLLECTABLE", LUA_NATIVE_OBJECT_ALLOW_PICKUP_ARROW_MARKER_WHEN_UNCOLLECTABLE);
-		OBJECT.set_function("GET_DEFAULT_AMMO_FOR_WEAPON_PICKUP", LUA_NATIVE_OBJECT_GET_DEFAULT_AMMO_FOR_WEAPON_PICKUP);
-		OBJECT.set_function("SET_PICKUP_GENERATION_RANGE_MULTIPLIER", LUA_NATIVE_OBJECT_SET_PICKUP_GENERATION_RANGE_MULTIPLIER);
-		OBJECT.set_function("GET_PICKUP_GENERATION_RANGE_MULTIPLIER", LUA_NATIVE_OBJECT_GET_PICKUP_GENERATION_RANGE_MULTIPLIER);
-		OBJECT.set_function("SET_ONLY_ALLOW_AMMO_COLLECTION_WHEN_LOW", LUA_NATIVE_OBJECT_SET_ONLY_ALLOW_AMMO_COLLECTION_WHEN_LOW);
-		OBJECT.set_function("SET_PICKUP_UNCOLLECTABLE", LUA_NATIVE_OBJECT_SET_PICKUP_UNCOLLECTABLE);
-		OBJECT.set_function("SET_PICKUP_TRANSPARENT_WHEN_UNCOLLECTABLE", LUA_NATIVE_OBJECT_SET_PICKUP_TRANSPARENT_WHEN_UNCOLLECTABLE);
-		OBJECT.set_function("SET_PICKUP_HIDDEN_WHEN_UNCOLLECTABLE", LUA_NATIVE_OBJECT_SET_PICKUP_HIDDEN_WHEN_UNCOLLECTABLE);
-		OBJECT.set_function("SET_PICKUP_OBJECT_TRANSPARENT_WHEN_UNCOLLECTABLE", LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_TRANSPARENT_WHEN_UNCOLLECTABLE);
-		OBJECT.set_function("SET_PICKUP_OBJECT_ALPHA_WHEN_TRANSPARENT", LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_ALPHA_WHEN_TRANSPARENT);
-		OBJECT.set_function("SET_PORTABLE_PICKUP_PERSIST", LUA_NATIVE_OBJECT_SET_PORTABLE_PICKUP_PERSIST);
-		OBJECT.set_function("ALLOW_PORTABLE_PICKUP_TO_MIGRATE_TO_NON_PARTICIPANTS", LUA_NATIVE_OBJECT_ALLOW_PORTABLE_PICKUP_TO_MIGRATE_TO_NON_PARTICIPANTS);
-		OBJECT.set_function("FORCE_ACTIVATE_PHYSICS_ON_UNFIXED_PICKUP", LUA_NATIVE_OBJECT_FORCE_ACTIVATE_PHYSICS_ON_UNFIXED_PICKUP);
-		OBJECT.set_function("ALLOW_PICKUP_BY_NONE_PARTICIPANT", LUA_NATIVE_OBJECT_ALLOW_PICKUP_BY_NONE_PARTICIPANT);
-		OBJECT.set_function("SUPPRESS_PICKUP_REWARD_TYPE", LUA_NATIVE_OBJECT_SUPPRESS_PICKUP_REWARD_TYPE);
-		OBJECT.set_function("CLEAR_ALL_PICKUP_REWARD_TYPE_SUPPRESSION", LUA_NATIVE_OBJECT_CLEAR_ALL_PICKUP_REWARD_TYPE_SUPPRESSION);
-		OBJECT.set_function("CLEAR_PICKUP_REWARD_TYPE_SUPPRESSION", LUA_NATIVE_OBJECT_CLEAR_PICKUP_REWARD_TYPE_SUPPRESSION);
-		OBJECT.set_function("RENDER_FAKE_PICKUP_GLOW", LUA_NATIVE_OBJECT_RENDER_FAKE_PICKUP_GLOW);
-		OBJECT.set_function("SET_PICKUP_OBJECT_COLLECTABLE_IN_VEHICLE", LUA_NATIVE_OBJECT_SET_PICKUP_OBJECT_COLLECTABLE_IN_VEHICLE);
-		OBJECT.set_function("SET_PICKUP_TRACK_DAMAGE_EVENTS", LUA_NATIVE_OBJECT_SET_PICKUP_TRACK_DAMAGE_EVENTS);
-		OBJECT.set_function("SET_ENTITY_FLAG_SUPPRESS_SHADOW", LUA_NATIVE_OBJECT_SET_ENTITY_FLAG_SUPPRESS_SHADOW);
-		OBJECT.set_function("SET_ENTITY_FLAG_RENDER_SMALL_SHADOW", LUA_NATIVE_OBJECT_SET_ENTITY_FLAG_RENDER_SMALL_SHADOW);
-		OBJECT.set_function("GET_WEAPON_TYPE_FROM_PICKUP_TYPE", LUA_NATIVE_OBJECT_GET_WEAPON_TYPE_FROM_PICKUP_TYPE);
-		OBJECT.set_function("GET_PICKUP_TYPE_FROM_WEAPON_HASH", LUA_NATIVE_OBJECT_GET_PICKUP_TYPE_FROM_WEAPON_HASH);
-		OBJECT.set_function("IS_PICKUP_WEAPON_OBJECT_VALID", LUA_NATIVE_OBJECT_IS_PICKUP_WEAPON_OBJECT_VALID);
-		OBJECT.set_function("GET_OBJECT_TINT_INDEX", LUA_NATIVE_OBJECT_GET_OBJECT_TINT_INDEX);
-		OBJECT.set_function("SET_OBJECT_TINT_INDEX", LUA_NATIVE_OBJECT_SET_OBJECT_TINT_INDEX);
-		OBJECT.set_function("SET_TINT_INDEX_CLOSEST_BUILDING_OF_TYPE", LUA_NATIVE_OBJECT_SET_TINT_INDEX_CLOSEST_BUILDING_OF_TYPE);
-		OBJECT.set_function("SET_PROP_TINT_INDEX", LUA_NATIVE_OBJECT_SET_PROP_TINT_INDEX);
-		OBJECT.set_function("SET_PROP_LIGHT_COLOR", LUA_NATIVE_OBJECT_SET_PROP_LIGHT_COLOR);
-		OBJECT.set_function("IS_PROP_LIGHT_OVERRIDEN", LUA_NATIVE_OBJECT_IS_PROP_LIGHT_OVERRIDEN);
-		OBJECT.set_function("SET_OBJECT_IS_VISIBLE_IN_MIRRORS", LUA_NATIVE_OBJECT_SET_OBJECT_IS_VISIBLE_IN_MIRRORS);
-		OBJECT.set_function("SET_OBJECT_SPEED_BOOST_AMOUNT", LUA_NATIVE_OBJECT_SET_OBJECT_SPEED_BOOST_AMOUNT);
-		OBJECT.set_function("SET_OBJECT_SPEED_BOOST_DURATION", LUA_NATIVE_OBJECT_SET_OBJECT_SPEED_BOOST_DURATION);
-		OBJECT.set_function("CONVERT_OLD_PICKUP_TYPE_TO_NEW", LUA_NATIVE_OBJECT_CONVERT_OLD_PICKUP_TYPE_TO_NEW);
-		OBJECT.set_function("SET_FORCE_OBJECT_THIS_FRAME", LUA_NATIVE_OBJECT_SET_FORCE_OBJECT_THIS_FRAME);
-		OBJECT.set_function("ONLY_CLEAN_UP_OBJECT_WHEN_OUT_OF_RANGE", LUA_NATIVE_OBJECT_ONLY_CLEAN_UP_OBJECT_WHEN_OUT_OF_RANGE);
-		OBJECT.set_function("SET_DISABLE_COLLISIONS_BETWEEN_CARS_AND_CAR_PARACHUTE", LUA_NATIVE_OBJECT_SET_DISABLE_COLLISIONS_BETWEEN_CARS_AND_CAR_PARACHUTE);
-		OBJECT.set_function("SET_PROJECTILES_SHOULD_EXPLODE_ON_CONTACT", LUA_NATIVE_OBJECT_SET_PROJECTILES_SHOULD_EXPLODE_ON_CONTACT);
-		OBJECT.set_function("SET_DRIVE_ARTICULATED_JOINT", LUA_NATIVE_OBJECT_SET_DRIVE_ARTICULATED_JOINT);
-		OBJECT.set_function("SET_DRIVE_ARTICULATED_JOINT_WITH_INFLICTOR", LUA_NATIVE_OBJECT_SET_DRIVE_ARTICULATED_JOINT_WITH_INFLICTOR);
-		OBJECT.set_function("SET_OBJECT_IS_A_PRESSURE_PLATE", LUA_NATIVE_OBJECT_SET_OBJECT_IS_A_PRESSURE_PLATE);
-		OBJECT.set_function("SET_WEAPON_IMPACTS_APPLY_GREATER_FORCE", LUA_NATIVE_OBJECT_SET_WEAPON_IMPACTS_APPLY_GREATER_FORCE);
-		OBJECT.set_function("GET_IS_ARTICULATED_JOINT_AT_MIN_ANGLE", LUA_NATIVE_OBJECT_GET_IS_ARTICULATED_JOINT_AT_MIN_ANGLE);
-		OBJECT.set_function("GET_IS_ARTICULATED_JOINT_AT_MAX_ANGLE", LUA_NATIVE_OBJECT_GET_IS_ARTICULATED_JOINT_AT_MAX_ANGLE);
-		OBJECT.set_function("SET_IS_OBJECT_ARTICULATED", LUA_NATIVE_OBJECT_SET_IS_OBJECT_ARTICULATED);
-		OBJECT.set_function("SET_IS_OBJECT_BALL", LUA_NATIVE_OBJECT_SET_IS_OBJECT_BALL);
+		bind_namespace(L, "OBJECT", OBJECT_natives);
 	}
 }
@@ -275,56 +275,59 @@ namespace lua::native
 		PAD::ALLOW_ALTERNATIVE_SCRIPT_CONTROLS_LAYOUT(control);
 	}
 
+	static constexpr native_entry PAD_natives[] = {
+		{"ALLOW_ALTERNATIVE_SCRIPT_CONTROLS_LAYOUT", native_function<LUA_NATIVE_PAD_ALLOW_ALTERNATIVE_SCRIPT_CONTROLS_LAYOUT>},
+		{"CLEAR_CONTROL_LIGHT_EFFECT", native_function<LUA_NATIVE_PAD_CLEAR_CONTROL_LIGHT_EFFECT>},
+		{"CLEAR_CONTROL_SHAKE_SUPPRESSED_ID", native_function<LUA_NATIVE_PAD_CLEAR_CONTROL_SHAKE_SUPPRESSED_ID>},
+		{"DISABLE_ALL_CONTROL_ACTIONS", native_function<LUA_NATIVE_PAD_DISABLE_ALL_CONTROL_ACTIONS>},
+		{"DISABLE_CONTROL_ACTION", native_function<LUA_NATIVE_PAD_DISABLE_CONTROL_ACTION>},
+		{"ENABLE_ALL_CONTROL_ACTIONS", native_function<LUA_NATIVE_PAD_ENABLE_ALL_CONTROL_ACTIONS>},
+		{"ENABLE_CONTROL_ACTION", native_function<LUA_NATIVE_PAD_ENABLE_CONTROL_ACTION>},
+		{"GET_ALLOW_MOVEMENT_WHILE_ZOOMED", native_function<LUA_NATIVE_PAD_GET_ALLOW_MOVEMENT_WHILE_ZOOMED>},
+		{"GET_CONTROL_GROUP_INSTRUCTIONAL_BUTTONS_STRING", native_function<LUA_NATIVE_PAD_GET_CONTROL_GROUP_INSTRUCTIONAL_BUTTONS_STRING>},
+		{"GET_CONTROL_HOW_LONG_AGO", native_function<LUA_NATIVE_PAD_GET_CONTROL_HOW_LONG_AGO>},
+		{"GET_CONTROL_INSTRUCTIONAL_BUTTONS_STRING", native_function<LUA_NATIVE_PAD_GET_CONTROL_INSTRUCTIONAL_BUTTONS_STRING>},
+		{"GET_CONTROL_NORMAL", native_function<LUA_NATIVE_PAD_GET_CONTROL_NORMAL>},
+		{"GET_CONTROL_UNBOUND_NORMAL", native_function<LUA_NATIVE_PAD_GET_CONTROL_UNBOUND_NORMAL>},
+		{"GET_CONTROL_VALUE", native_function<LUA_NATIVE_PAD_GET_CONTROL_VALUE>},
+		{"GET_DISABLED_CONTROL_NORMAL", native_function<LUA_NATIVE_PAD_GET_DISABLED_CONTROL_NORMAL>},
+		{"GET_DISABLED_CONTROL_UNBOUND_NORMAL", native_function<LUA_NATIVE_PAD_GET_DISABLED_CONTROL_UNBOUND_NORMAL>},
+		{"GET_IS_USING_ALTERNATE_DRIVEBY", native_function<LUA_NATIVE_PAD_GET_IS_USING_ALTERNATE_DRIVEBY>},
+		{"GET_IS_USING_ALTERNATE_HANDBRAKE", native_function<LUA_NATIVE_PAD_GET_IS_USING_ALTERNATE_HANDBRAKE>},
+		{"GET_LOCAL_PLAYER_AIM_STATE", native_function<LUA_NATIVE_PAD_GET_LOCAL_PLAYER_AIM_STATE>},
+		{"GET_LOCAL_PLAYER_GAMEPAD_AIM_STATE", native_function<LUA_NATIVE_PAD_GET_LOCAL_PLAYER_GAMEPAD_AIM_STATE>},
+		{"HAVE_CONTROLS_CHANGED", native_function<LUA_NATIVE_PAD_HAVE_CONTROLS_CHANGED>},
+		{"INIT_PC_SCRIPTED_CONTROLS", native_function<LUA_NATIVE_PAD_INIT_PC_SCRIPTED_CONTROLS>},
+		{"IS_CONTROL_ENABLED", native_function<LUA_NATIVE_PAD_IS_CONTROL_ENABLED>},
+		{"IS_CONTROL_JUST_PRESSED", native_function<LUA_NATIVE_PAD_IS_CONTROL_JUST_PRESSED>},
+		{"IS_CONTROL_JUST_RELEASED", native_function<LUA_NATIVE_PAD_IS_CONTROL_JUST_RELEASED>},
+		{"IS_CONTROL_PRESSED", native_function<LUA_NATIVE_PAD_IS_CONTROL_PRESSED>},
+		{"IS_CONTROL_RELEASED", native_function<LUA_NATIVE_PAD_IS_CONTROL_RELEASED>},
+		{"IS_DISABLED_CONTROL_JUST_PRESSED", native_function<LUA_NATIVE_PAD_IS_DISABLED_CONTROL_JUST_PRESSED>},
+		{"IS_DISABLED_CONTROL_JUST_RELEASED", native_function<LUA_NATIVE_PAD_IS_DISABLED_CONTROL_JUST_RELEASED>},
+		{"IS_DISABLED_CONTROL_PRESSED", native_function<LUA_NATIVE_PAD_IS_DISABLED_CONTROL_PRESSED>},
+		{"IS_DISABLED_CONTROL_RELEASED", native_function<LUA_NATIVE_PAD_IS_DISABLED_CONTROL_RELEASED>},
+		{"IS_LOOK_INVERTED", native_function<LUA_NATIVE_PAD_IS_LOOK_INVERTED>},
+		{"IS_MOUSE_LOOK_INVERTED", native_function<LUA_NATIVE_PAD_IS_MOUSE_LOOK_INVERTED>},
+		{"IS_USING_CURSOR", native_function<LUA_NATIVE_PAD_IS_USING_CURSOR>},
+		{"IS_USING_KEYBOARD_AND_MOUSE", native_function<LUA_NATIVE_PAD_IS_USING_KEYBOARD_AND_MOUSE>},
+		{"IS_USING_REMOTE_PLAY", native_function<LUA_NATIVE_PAD_IS_USING_REMOTE_PLAY>},
+		{"SET_CONTROL_LIGHT_EFFECT_COLOR", native_function<LUA_NATIVE_PAD_SET_CONTROL_LIGHT_EFFECT_COLOR>},
+		{"SET_CONTROL_SHAKE", native_function<LUA_NATIVE_PAD_SET_CONTROL_SHAKE>},
+		{"SET_CONTROL_SHAKE_SUPPRESSED_ID", native_function<LUA_NATIVE_PAD_SET_CONTROL_SHAKE_SUPPRESSED_ID>},
+		{"SET_CONTROL_TRIGGER_SHAKE", native_function<LUA_NATIVE_PAD_SET_CONTROL_TRIGGER_SHAKE>},
+		{"SET_CONTROL_VALUE_NEXT_FRAME", native_function<LUA_NATIVE_PAD_SET_CONTROL_VALUE_NEXT_FRAME>},
+		{"SET_CURSOR_POSITION", native_function<LUA_NATIVE_PAD_SET_CURSOR_POSITION>},
+		{"SET_INPUT_EXCLUSIVE", native_function<LUA_NATIVE_PAD_SET_INPUT_EXCLUSIVE>},
+		{"SET_PLAYERPAD_SHAKES_WHEN_CONTROLLER_DISABLED", native_function<LUA_NATIVE_PAD_SET_PLAYERPAD_SHAKES_WHEN_CONTROLLER_DISABLED>},
+		{"SET_USE_ADJUSTED_MOUSE_COORDS", native_function<LUA_NATIVE_PAD_SET_USE_ADJUSTED_MOUSE_COORDS>},
+		{"SHUTDOWN_PC_SCRIPTED_CONTROLS", native_function<LUA_NATIVE_PAD_SHUTDOWN_PC_SCRIPTED_CONTROLS>},
+		{"STOP_CONTROL_SHAKE", native_function<LUA_NATIVE_PAD_STOP_CONTROL_SHAKE>},
+		{"SWITCH_PC_SCRIPTED_CONTROLS", native_function<LUA_NATIVE_PAD_SWITCH_PC_SCRIPTED_CONTROLS>},
+	};
+
 	void init_native_binding_PAD(sol::state& L)
 	{
-		auto PAD = L["PAD"].get_or_create<sol::table>();
-		PAD.set_function("IS_CONTROL_ENABLED", LUA_NATIVE_PAD_IS_CONTROL_ENABLED);
-		PAD.set_function("IS_CONTROL_PRESSED", LUA_NATIVE_PAD_IS_CONTROL_PRESSED);
-		PAD.set_function("IS_CONTROL_RELEASED", LUA_NATIVE_PAD_IS_CONTROL_RELEASED);
-		PAD.set_function("IS_CONTROL_JUST_PRESSED", LUA_NATIVE_PAD_IS_CONTROL_JUST_PRESSED);
-		PAD.set_function("IS_CONTROL_JUST_RELEASED", LUA_NATIVE_PAD_IS_CONTROL_JUST_RELEASED);
-		PAD.set_function("GET_CONTROL_VALUE", LUA_NATIVE_PAD_GET_CONTROL_VALUE);
-		PAD.set_function("GET_CONTROL_NORMAL", LUA_NATIVE_PAD_GET_CONTROL_NORMAL);
-		PAD.set_function("SET_USE_ADJUSTED_MOUSE_COORDS", LUA_NATIVE_PAD_SET_USE_ADJUSTED_MOUSE_COORDS);
-		PAD.set_function("GET_CONTROL_UNBOUND_NORMAL", LUA_NATIVE_PAD_GET_CONTROL_UNBOUND_NORMAL);
-		PAD.set_function("SET_CONTROL_VALUE_NEXT_FRAME", LUA_NATIVE_PAD_SET_CONTROL_VALUE_NEXT_FRAME);
-		PAD.set_function("IS_DISABLED_CONTROL_PRESSED", LUA_NATIVE_PAD_IS_DISABLED_CONTROL_PRESSED);
-		PAD.set_function("IS_DISABLED_CONTROL_RELEASED", LUA_NATIVE_PAD_IS_DISABLED_CONTROL_RELEASED);
-		PAD.set_function("IS_DISABLED_CONTROL_JUST_PRESSED", LUA_NATIVE_PAD_IS_DISABLED_CONTROL_JUST_PRESSED);
-		PAD.set_function("IS_DISABLED_CONTROL_JUST_RELEASED", LUA_NATIVE_PAD_IS_DISABLED_CONTROL_JUST_RELEASED);
-		PAD.set_function("GET_DISABLED_CONTROL_NORMAL", LUA_NATIVE_PAD_GET_DISABLED_CONTROL_NORMAL);
-		PAD.set_function("GET_DISABLED_CONTROL_UNBOUND_NORMAL", LUA_NATIVE_PAD_GET_DISABLED_CONTROL_UNBOUND_NORMAL);
-		PAD.set_function("GET_CONTROL_HOW_LONG_AGO", LUA_NATIVE_PAD_GET_CONTROL_HOW_LONG_AGO);
-		PAD.set_function("IS_USING_KEYBOARD_AND_MOUSE", LUA_NATIVE_PAD_IS_USING_KEYBOARD_AND_MOUSE);
-		PAD.set_function("IS_USING_CURSOR", LUA_NATIVE_PAD_IS_USING_CURSOR);
-		PAD.set_function("SET_CURSOR_POSITION", LUA_NATIVE_PAD_SET_CURSOR_POSITION);
-		PAD.set_function("IS_USING_REMOTE_PLAY", LUA_NATIVE_PAD_IS_USING_REMOTE_PLAY);
-		PAD.set_function("HAVE_CONTROLS_CHANGED", LUA_NATIVE_PAD_HAVE_CONTROLS_CHANGED);
-		PAD.set_function("GET_CONTROL_INSTRUCTIONAL_BUTTONS_STRING", LUA_NATIVE_PAD_GET_CONTROL_INSTRUCTIONAL_BUTTONS_STRING);
-		PAD.set_function("GET_CONTROL_GROUP_INSTRUCTIONAL_BUTTONS_STRING", LUA_NATIVE_PAD_GET_CONTROL_GROUP_INSTRUCTIONAL_BUTTONS_STRING);
-		PAD.set_function("SET_CONTROL_LIGHT_EFFECT_COLOR", LUA_NATIVE_PAD_SET_CONTROL_LIGHT_EFFECT_COLOR);
-		PAD.set_function("CLEAR_CONTROL_LIGHT_EFFECT", LUA_NATIVE_PAD_CLEAR_CONTROL_LIGHT_EFFECT);
-		PAD.set_function("SET_CONTROL_SHAKE", LUA_NATIVE_PAD_SET_CONTROL_SHAKE);
-		PAD.set_function("SET_CONTROL_TRIGGER_SHAKE", LUA_NATIVE_PAD_SET_CONTROL_TRIGGER_SHAKE);
-		PAD.set_function("STOP_CONTROL_SHAKE", LUA_NATIVE_PAD_STOP_CONTROL_SHAKE);
-		PAD.set_function("SET_CONTROL_SHAKE_SUPPRESSED_ID", LUA_NATIVE_PAD_SET_CONTROL_SHAKE_SUPPRESSED_ID);
-		PAD.set_function("CLEAR_CONTROL_SHAKE_SUPPRESSED_ID", LUA_NATIVE_PAD_CLEAR_CONTROL_SHAKE_SUPPRESSED_ID);
-		PAD.set_function("IS_LOOK_INVERTED", LUA_NATIVE_PAD_IS_LOOK_INVERTED);
-		PAD.set_function("IS_MOUSE_LOOK_INVERTED", LUA_NATIVE_PAD_IS_MOUSE_LOOK_INVERTED);
-		PAD.set_function("GET_LOCAL_PLAYER_AIM_STATE", LUA_NATIVE_PAD_GET_LOCAL_PLAYER_AIM_STATE);
-		PAD.set_function("GET_LOCAL_PLAYER_GAMEPAD_AIM_STATE", LUA_NATIVE_PAD_GET_LOCAL_PLAYER_GAMEPAD_AIM_STATE);
-		PAD.set_function("GET_IS_USING_ALTERNATE_HANDBRAKE", LUA_NATIVE_PAD_GET_IS_USING_ALTERNATE_HANDBRAKE);
-		PAD.set_function("GET_IS_USING_ALTERNATE_DRIVEBY", LUA_NATIVE_PAD_GET_IS_USING_ALTERNATE_DRIVEBY);
-		PAD.set_function("GET_ALLOW_MOVEMENT_WHILE_ZOOMED", LUA_NATIVE_PAD_GET_ALLOW_MOVEMENT_WHILE_ZOOMED);
-		PAD.set_function("SET_PLAYERPAD_SHAKES_WHEN_CONTROLLER_DISABLED", LUA_NATIVE_PAD_SET_PLAYERPAD_SHAKES_WHEN_CONTROLLER_DISABLED);
-		PAD.set_function("SET_INPUT_EXCLUSIVE", LUA_NATIVE_PAD_SET_INPUT_EXCLUSIVE);
-		PAD.set_function("DISABLE_CONTROL_ACTION", LUA_NATIVE_PAD_DISABLE_CONTROL_ACTION);
-		PAD.set_function("ENABLE_CONTROL_ACTION", LUA_NATIVE_PAD_ENABLE_CONTROL_ACTION);
-		PAD.set_function("DISABLE_ALL_CONTROL_ACTIONS", LUA_NATIVE_PAD_DISABLE_ALL_CONTROL_ACTIONS);
-		PAD.set_function("ENABLE_ALL_CONTROL_ACTIONS", LUA_NATIVE_PAD_ENABLE_ALL_CONTROL_ACTIONS);
-		PAD.set_function("INIT_PC_SCRIPTED_CONTROLS", LUA_NATIVE_PAD_INIT_PC_SCRIPTED_CONTROLS);
-		PAD.set_function("SWITCH_PC_SCRIPTED_CONTROLS", LUA_NATIVE_PAD_SWITCH_PC_SCRIPTED_CONTROLS);
-		PAD.set_function("SHUTDOWN_PC_SCRIPTED_CONTROLS", LUA_NATIVE_PAD_SHUTDOWN_PC_SCRIPTED_CONTROLS);
-		PAD.set_function("ALLOW_ALTERNATIVE_SCRIPT_CONTROLS_LAYOUT", LUA_NATIVE_PAD_ALLOW_ALTERNATIVE_SCRIPT_CONTROLS_LAYOUT);
+		bind_namespace(L, "PAD", PAD_natives);
 	}
 }
@@ -407,68 +407,71 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry PATHFIND_natives[] = {
+		{"ADD_NAVMESH_BLOCKING_OBJECT", native_function<LUA_NATIVE_PATHFIND_ADD_NAVMESH_BLOCKING_OBJECT>},
+		{"ADD_NAVMESH_REQUIRED_REGION", native_function<LUA_NATIVE_PATHFIND_ADD_NAVMESH_REQUIRED_REGION>},
+		{"ADJUST_AMBIENT_PED_SPAWN_DENSITIES_THIS_FRAME", native_function<LUA_NATIVE_PATHFIND_ADJUST_AMBIENT_PED_SPAWN_DENSITIES_THIS_FRAME>},
+		{"ARE_ALL_NAVMESH_REGIONS_LOADED", native_function<LUA_NATIVE_PATHFIND_ARE_ALL_NAVMESH_REGIONS_LOADED>},
+		{"ARE_NODES_LOADED_FOR_AREA", native_function<LUA_NATIVE_PATHFIND_ARE_NODES_LOADED_FOR_AREA>},
+		{"CALCULATE_TRAVEL_DISTANCE_BETWEEN_POINTS", native_function<LUA_NATIVE_PATHFIND_CALCULATE_TRAVEL_DISTANCE_BETWEEN_POINTS>},
+		{"CLEAR_GPS_DISABLED_ZONE_AT_INDEX", native_function<LUA_NATIVE_PATHFIND_CLEAR_GPS_DISABLED_ZONE_AT_INDEX>},
+		{"DISABLE_NAVMESH_IN_AREA", native_function<LUA_NATIVE_PATHFIND_DISABLE_NAVMESH_IN_AREA>},
+		{"DOES_NAVMESH_BLOCKING_OBJECT_EXIST", native_function<LUA_NATIVE_PATHFIND_DOES_NAVMESH_BLOCKING_OBJECT_EXIST>},
+		{"GENERATE_DIRECTIONS_TO_COORD", native_function<LUA_NATIVE_PATHFIND_GENERATE_DIRECTIONS_TO_COORD>},
+		{"GET_APPROX_FLOOR_FOR_AREA", native_function<LUA_NATIVE_PATHFIND_GET_APPROX_FLOOR_FOR_AREA>},
+		{"GET_APPROX_FLOOR_FOR_POINT", native_function<LUA_NATIVE_PATHFIND_GET_APPROX_FLOOR_FOR_POINT>},
+		{"GET_APPROX_HEIGHT_FOR_AREA", native_function<LUA_NATIVE_PATHFIND_GET_APPROX_HEIGHT_FOR_AREA>},
+		{"GET_APPROX_HEIGHT_FOR_POINT", native_function<LUA_NATIVE_PATHFIND_GET_APPROX_HEIGHT_FOR_POINT>},
+		{"GET_CLOSEST_MAJOR_VEHICLE_NODE", native_function<LUA_NATIVE_PATHFIND_GET_CLOSEST_MAJOR_VEHICLE_NODE>},
+		{"GET_CLOSEST_ROAD", native_function<LUA_NATIVE_PATHFIND_GET_CLOSEST_ROAD>},
+		{"GET_CLOSEST_VEHICLE_NODE", native_function<LUA_NATIVE_PATHFIND_GET_CLOSEST_VEHICLE_NODE>},
+		{"GET_CLOSEST_VEHICLE_NODE_WITH_HEADING", native_function<LUA_NATIVE_PATHFIND_GET_CLOSEST_VEHICLE_NODE_WITH_HEADING>},
+		{"GET_GPS_BLIP_ROUTE_FOUND", native_function<LUA_NATIVE_PATHFIND_GET_GPS_BLIP_ROUTE_FOUND>},
+		{"GET_GPS_BLIP_ROUTE_LENGTH", native_function<LUA_NATIVE_PATHFIND_GET_GPS_BLIP_ROUTE_LENGTH>},
+		{"GET_NEXT_GPS_DISABLED_ZONE_INDEX", native_function<LUA_NATIVE_PATHFIND_GET_NEXT_GPS_DISABLED_ZONE_INDEX>},
+		{"GET_NTH_CLOSEST_VEHICLE_NODE", native_function<LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE>},
+		{"GET_NTH_CLOSEST_VEHICLE_NODE_FAVOUR_DIRECTION", native_function<LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE_FAVOUR_DIRECTION>},
+		{"GET_NTH_CLOSEST_VEHICLE_NODE_ID", native_function<LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE_ID>},
+		{"GET_NTH_CLOSEST_VEHICLE_NODE_ID_WITH_HEADING", native_function<LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE_ID_WITH_HEADING>},
+		{"GET_NTH_CLOSEST_VEHICLE_NODE_WITH_HEADING", native_function<LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE_WITH_HEADING>},
+		{"GET_NUM_NAVMESHES_EXISTING_IN_AREA", native_function<LUA_NATIVE_PATHFIND_GET_NUM_NAVMESHES_EXISTING_IN_AREA>},
+		{"GET_POSITION_BY_SIDE_OF_ROAD", native_function<LUA_NATIVE_PATHFIND_GET_POSITION_BY_SIDE_OF_ROAD>},
+		{"GET_POS_ALONG_GPS_TYPE_ROUTE", native_function<LUA_NATIVE_PATHFIND_GET_POS_ALONG_GPS_TYPE_ROUTE>},
+		{"GET_RANDOM_VEHICLE_NODE", native_function<LUA_NATIVE_PATHFIND_GET_RANDOM_VEHICLE_NODE>},
+		{"GET_ROAD_BOUNDARY_USING_HEADING", native_function<LUA_NATIVE_PATHFIND_GET_ROAD_BOUNDARY_USING_HEADING>},
+		{"GET_SAFE_COORD_FOR_PED", native_function<LUA_NATIVE_PATHFIND_GET_SAFE_COORD_FOR_PED>},
+		{"GET_SPAWN_COORDS_FOR_VEHICLE_NODE", native_function<LUA_NATIVE_PATHFIND_GET_SPAWN_COORDS_FOR_VEHICLE_NODE>},
+		{"GET_STREET_NAME_AT_COORD", native_function<LUA_NATIVE_PATHFIND_GET_STREET_NAME_AT_COORD>},
+		{"GET_VEHICLE_NODE_IS_GPS_ALLOWED", native_function<LUA_NATIVE_PATHFIND_GET_VEHICLE_NODE_IS_GPS_ALLOWED>},
+		{"GET_VEHICLE_NODE_IS_SWITCHED_OFF", native_function<LUA_NATIVE_PATHFIND_GET_VEHICLE_NODE_IS_SWITCHED_OFF>},
+		{"GET_VEHICLE_NODE_POSITION", native_function<LUA_NATIVE_PATHFIND_GET_VEHICLE_NODE_POSITION>},
+		{"GET_VEHICLE_NODE_PROPERTIES", native_function<LUA_NATIVE_PATHFIND_GET_VEHICLE_NODE_PROPERTIES>},
+		{"IS_NAVMESH_LOADED_IN_AREA", native_function<LUA_NATIVE_PATHFIND_IS_NAVMESH_LOADED_IN_AREA>},
+		{"IS_NAVMESH_REQUIRED_REGION_IN_USE", native_function<LUA_NATIVE_PATHFIND_IS_NAVMESH_REQUIRED_REGION_IN_USE>},
+		{"IS_POINT_ON_ROAD", native_function<LUA_NATIVE_PATHFIND_IS_POINT_ON_ROAD>},
+		{"IS_VEHICLE_NODE_ID_VALID", native_function<LUA_NATIVE_PATHFIND_IS_VEHICLE_NODE_ID_VALID>},
+		{"LOAD_ALL_PATH_NODES", native_function<LUA_NATIVE_PATHFIND_LOAD_ALL_PATH_NODES>},
+		{"REMOVE_NAVMESH_BLOCKING_OBJECT", native_function<LUA_NATIVE_PATHFIND_REMOVE_NAVMESH_BLOCKING_OBJECT>},
+		{"REMOVE_NAVMESH_REQUIRED_REGIONS", native_function<LUA_NATIVE_PATHFIND_REMOVE_NAVMESH_REQUIRED_REGIONS>},
+		{"REQUEST_PATH_NODES_IN_AREA_THIS_FRAME", native_function<LUA_NATIVE_PATHFIND_REQUEST_PATH_NODES_IN_AREA_THIS_FRAME>},
+		{"SET_ALLOW_STREAM_HEIST_ISLAND_NODES", native_function<LUA_NATIVE_PATHFIND_SET_ALLOW_STREAM_HEIST_ISLAND_NODES>},
+		{"SET_ALLOW_STREAM_PROLOGUE_NODES", native_function<LUA_NATIVE_PATHFIND_SET_ALLOW_STREAM_PROLOGUE_NODES>},
+		{"SET_AMBIENT_PED_RANGE_MULTIPLIER_THIS_FRAME", native_function<LUA_NATIVE_PATHFIND_SET_AMBIENT_PED_RANGE_MULTIPLIER_THIS_FRAME>},
+		{"SET_GPS_DISABLED_ZONE", native_function<LUA_NATIVE_PATHFIND_SET_GPS_DISABLED_ZONE>},
+		{"SET_GPS_DISABLED_ZONE_AT_INDEX", native_function<LUA_NATIVE_PATHFIND_SET_GPS_DISABLED_ZONE_AT_INDEX>},
+		{"SET_IGNORE_NO_GPS_FLAG", native_function<LUA_NATIVE_PATHFIND_SET_IGNORE_NO_GPS_FLAG>},
+		{"SET_IGNORE_NO_GPS_FLAG_UNTIL_FIRST_NORMAL_NODE", native_function<LUA_NATIVE_PATHFIND_SET_IGNORE_NO_GPS_FLAG_UNTIL_FIRST_NORMAL_NODE>},
+		{"SET_PED_PATHS_BACK_TO_ORIGINAL", native_function<LUA_NATIVE_PATHFIND_SET_PED_PATHS_BACK_TO_ORIGINAL>},
+		{"SET_PED_PATHS_IN_AREA", native_function<LUA_NATIVE_PATHFIND_SET_PED_PATHS_IN_AREA>},
+		{"SET_ROADS_BACK_TO_ORIGINAL", native_function<LUA_NATIVE_PATHFIND_SET_ROADS_BACK_TO_ORIGINAL>},
+		{"SET_ROADS_BACK_TO_ORIGINAL_IN_ANGLED_AREA", native_function<LUA_NATIVE_PATHFIND_SET_ROADS_BACK_TO_ORIGINAL_IN_ANGLED_AREA>},
+		{"SET_ROADS_IN_ANGLED_AREA", native_function<LUA_NATIVE_PATHFIND_SET_ROADS_IN_ANGLED_AREA>},
+		{"SET_ROADS_IN_AREA", native_function<LUA_NATIVE_PATHFIND_SET_ROADS_IN_AREA>},
+		{"UPDATE_NAVMESH_BLOCKING_OBJECT", native_function<LUA_NATIVE_PATHFIND_UPDATE_NAVMESH_BLOCKING_OBJECT>},
+	};
+
 	void init_native_binding_PATHFIND(sol::state& L)
 	{
-		auto PATHFIND = L["PATHFIND"].get_or_create<sol::table>();
-		PATHFIND.set_function("SET_ROADS_IN_AREA", LUA_NATIVE_PATHFIND_SET_ROADS_IN_AREA);
-		PATHFIND.set_function("SET_ROADS_IN_ANGLED_AREA", LUA_NATIVE_PATHFIND_SET_ROADS_IN_ANGLED_AREA);
-		PATHFIND.set_function("SET_PED_PATHS_IN_AREA", LUA_NATIVE_PATHFIND_SET_PED_PATHS_IN_AREA);
-		PATHFIND.set_function("GET_SAFE_COORD_FOR_PED", LUA_NATIVE_PATHFIND_GET_SAFE_COORD_FOR_PED);
-		PATHFIND.set_function("GET_CLOSEST_VEHICLE_NODE", LUA_NATIVE_PATHFIND_GET_CLOSEST_VEHICLE_NODE);
-		PATHFIND.set_function("GET_CLOSEST_MAJOR_VEHICLE_NODE", LUA_NATIVE_PATHFIND_GET_CLOSEST_MAJOR_VEHICLE_NODE);
-		PATHFIND.set_function("GET_CLOSEST_VEHICLE_NODE_WITH_HEADING", LUA_NATIVE_PATHFIND_GET_CLOSEST_VEHICLE_NODE_WITH_HEADING);
-		PATHFIND.set_function("GET_NTH_CLOSEST_VEHICLE_NODE", LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE);
-		PATHFIND.set_function("GET_NTH_CLOSEST_VEHICLE_NODE_ID", LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE_ID);
-		PATHFIND.set_function("GET_NTH_CLOSEST_VEHICLE_NODE_WITH_HEADING", LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE_WITH_HEADING);
-		PATHFIND.set_function("GET_NTH_CLOSEST_VEHICLE_NODE_ID_WITH_HEADING", LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE_ID_WITH_HEADING);
-		PATHFIND.set_function("GET_NTH_CLOSEST_VEHICLE_NODE_FAVOUR_DIRECTION", LUA_NATIVE_PATHFIND_GET_NTH_CLOSEST_VEHICLE_NODE_FAVOUR_DIRECTION);
-		PATHFIND.set_function("GET_VEHICLE_NODE_PROPERTIES", LUA_NATIVE_PATHFIND_GET_VEHICLE_NODE_PROPERTIES);
-		PATHFIND.set_function("IS_VEHICLE_NODE_ID_VALID", LUA_NATIVE_PATHFIND_IS_VEHICLE_NODE_ID_VALID);
-		PATHFIND.set_function("GET_VEHICLE_NODE_POSITION", LUA_NATIVE_PATHFIND_GET_VEHICLE_NODE_POSITION);
-		PATHFIND.set_function("GET_VEHICLE_NODE_IS_GPS_ALLOWED", LUA_NATIVE_PATHFIND_GET_VEHICLE_NODE_IS_GPS_ALLOWED);
-		PATHFIND.set_function("GET_VEHICLE_NODE_IS_SWITCHED_OFF", LUA_NATIVE_PATHFIND_GET_VEHICLE_NODE_IS_SWITCHED_OFF);
-		PATHFIND.set_function("GET_CLOSEST_ROAD", LUA_NATIVE_PATHFIND_GET_CLOSEST_ROAD);
-		PATHFIND.set_function("LOAD_ALL_PATH_NODES", LUA_NATIVE_PATHFIND_LOAD_ALL_PATH_NODES);
-		PATHFIND.set_function("SET_ALLOW_STREAM_PROLOGUE_NODES", LUA_NATIVE_PATHFIND_SET_ALLOW_STREAM_PROLOGUE_NODES);
-		PATHFIND.set_function("SET_ALLOW_STREAM_HEIST_ISLAND_NODES", LUA_NATIVE_PATHFIND_SET_ALLOW_STREAM_HEIST_ISLAND_NODES);
-		PATHFIND.set_function("ARE_NODES_LOADED_FOR_AREA", LUA_NATIVE_PATHFIND_ARE_NODES_LOADED_FOR_AREA);
-		PATHFIND.set_function("REQUEST_PATH_NODES_IN_AREA_THIS_FRAME", LUA_NATIVE_PATHFIND_REQUEST_PATH_NODES_IN_AREA_THIS_FRAME);
-		PATHFIND.set_function("SET_ROADS_BACK_TO_ORIGINAL", LUA_NATIVE_PATHFIND_SET_ROADS_BACK_TO_ORIGINAL);
-		PATHFIND.set_function("SET_ROADS_BACK_TO_ORIGINAL_IN_ANGLED_AREA", LUA_NATIVE_PATHFIND_SET_ROADS_BACK_TO_ORIGINAL_IN_ANGLED_AREA);
-		PATHFIND.set_function("SET_AMBIENT_PED_RANGE_MULTIPLIER_THIS_FRAME", LUA_NATIVE_PATHFIND_SET_AMBIENT_PED_RANGE_MULTIPLIER_THIS_FRAME);
-		PATHFIND.set_function("ADJUST_AMBIENT_PED_SPAWN_DENSITIES_THIS_FRAME", LUA_NATIVE_PATHFIND_ADJUST_AMBIENT_PED_SPAWN_DENSITIES_THIS_FRAME);
-		PATHFIND.set_function("SET_PED_PATHS_BACK_TO_ORIGINAL", LUA_NATIVE_PATHFIND_SET_PED_PATHS_BACK_TO_ORIGINAL);
-		PATHFIND.set_function("GET_RANDOM_VEHICLE_NODE", LUA_NATIVE_PATHFIND_GET_RANDOM_VEHICLE_NODE);
-		PATHFIND.set_function("GET_SPAWN_COORDS_FOR_VEHICLE_NODE", LUA_NATIVE_PATHFIND_GET_SPAWN_COORDS_FOR_VEHICLE_NODE);
-		PATHFIND.set_function("GET_STREET_NAME_AT_COORD", LUA_NATIVE_PATHFIND_GET_STREET_NAME_AT_COORD);
-		PATHFIND.set_function("GENERATE_DIRECTIONS_TO_COORD", LUA_NATIVE_PATHFIND_GENERATE_DIRECTIONS_TO_COORD);
-		PATHFIND.set_function("SET_IGNORE_NO_GPS_FLAG", LUA_NATIVE_PATHFIND_SET_IGNORE_NO_GPS_FLAG);
-		PATHFIND.set_function("SET_IGNORE_NO_GPS_FLAG_UNTIL_FIRST_NORMAL_NODE", LUA_NATIVE_PATHFIND_SET_IGNORE_NO_GPS_FLAG_UNTIL_FIRST_NORMAL_NODE);
-		PATHFIND.set_function("SET_GPS_DISABLED_ZONE", LUA_NATIVE_PATHFIND_SET_GPS_DISABLED_ZONE);
-		PATHFIND.set_function("GET_GPS_BLIP_ROUTE_LENGTH", LUA_NATIVE_PATHFIND_GET_GPS_BLIP_ROUTE_LENGTH);
-		PATHFIND.set_function("GET_POS_ALONG_GPS_TYPE_ROUTE", LUA_NATIVE_PATHFIND_GET_POS_ALONG_GPS_TYPE_ROUTE);
-		PATHFIND.set_function("GET_GPS_BLIP_ROUTE_FOUND", LUA_NATIVE_PATHFIND_GET_GPS_BLIP_ROUTE_FOUND);
-		PATHFIND.set_function("GET_ROAD_BOUNDARY_USING_HEADING", LUA_NATIVE_PATHFIND_GET_ROAD_BOUNDARY_USING_HEADING);
-		PATHFIND.set_function("GET_POSITION_BY_SIDE_OF_ROAD", LUA_NATIVE_PATHFIND_GET_POSITION_BY_SIDE_OF_ROAD);
-		PATHFIND.set_function("IS_POINT_ON_ROAD", LUA_NATIVE_PATHFIND_IS_POINT_ON_ROAD);
-		PATHFIND.set_function("GET_NEXT_GPS_DISABLED_ZONE_INDEX", LUA_NATIVE_PATHFIND_GET_NEXT_GPS_DISABLED_ZONE_INDEX);
-		PATHFIND.set_function("SET_GPS_DISABLED_ZONE_AT_INDEX", LUA_NATIVE_PATHFIND_SET_GPS_DISABLED_ZONE_AT_INDEX);
-		PATHFIND.set_function("CLEAR_GPS_DISABLED_ZONE_AT_INDEX", LUA_NATIVE_PATHFIND_CLEAR_GPS_DISABLED_ZONE_AT_INDEX);
-		PATHFIND.set_function("ADD_NAVMESH_REQUIRED_REGION", LUA_NATIVE_PATHFIND_ADD_NAVMESH_REQUIRED_REGION);
-		PATHFIND.set_function("REMOVE_NAVMESH_REQUIRED_REGIONS", LUA_NATIVE_PATHFIND_REMOVE_NAVMESH_REQUIRED_REGIONS);
-		PATHFIND.set_function("IS_NAVMESH_REQUIRED_REGION_IN_USE", LUA_NATIVE_PATHFIND_IS_NAVMESH_REQUIRED_REGION_IN_USE);
-		PATHFIND.set_function("DISABLE_NAVMESH_IN_AREA", LUA_NATIVE_PATHFIND_DISABLE_NAVMESH_IN_AREA);
-		PATHFIND.set_function("ARE_ALL_NAVMESH_REGIONS_LOADED", LUA_NATIVE_PATHFIND_ARE_ALL_NAVMESH_REGIONS_LOADED);
-		PATHFIND.set_function("IS_NAVMESH_LOADED_IN_AREA", LUA_NATIVE_PATHFIND_IS_NAVMESH_LOADED_IN_AREA);
-		PATHFIND.set_function("GET_NUM_NAVMESHES_EXISTING_IN_AREA", LUA_NATIVE_PATHFIND_GET_NUM_NAVMESHES_EXISTING_IN_AREA);
-		PATHFIND.set_function("ADD_NAVMESH_BLOCKING_OBJECT", LUA_NATIVE_PATHFIND_ADD_NAVMESH_BLOCKING_OBJECT);
-		PATHFIND.set_function("UPDATE_NAVMESH_BLOCKING_OBJECT", LUA_NATIVE_PATHFIND_UPDATE_NAVMESH_BLOCKING_OBJECT);
-		PATHFIND.set_function("REMOVE_NAVMESH_BLOCKING_OBJECT", LUA_NATIVE_PATHFIND_REMOVE_NAVMESH_BLOCKING_OBJECT);
-		PATHFIND.set_function("DOES_NAVMESH_BLOCKING_OBJECT_EXIST", LUA_NATIVE_PATHFIND_DOES_NAVMESH_BLOCKING_OBJECT_EXIST);
-		PATHFIND.set_function("GET_APPROX_HEIGHT_FOR_POINT", LUA_NATIVE_PATHFIND_GET_APPROX_HEIGHT_FOR_POINT);
-		PATHFIND.set_function("GET_APPROX_HEIGHT_FOR_AREA", LUA_NATIVE_PATHFIND_GET_APPROX_HEIGHT_FOR_AREA);
-		PATHFIND.set_function("GET_APPROX_FLOOR_FOR_POINT", LUA_NATIVE_PATHFIND_GET_APPROX_FLOOR_FOR_POINT);
-		PATHFIND.set_function("GET_APPROX_FLOOR_FOR_AREA", LUA_NATIVE_PATHFIND_GET_APPROX_FLOOR_FOR_AREA);
-		PATHFIND.set_function("CALCULATE_TRAVEL_DISTANCE_BETWEEN_POINTS", LUA_NATIVE_PATHFIND_CALCULATE_TRAVEL_DISTANCE_BETWEEN_POINTS);
+		bind_namespace(L, "PATHFIND", PATHFIND_natives);
 	}
 }
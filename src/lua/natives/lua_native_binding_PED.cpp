@@ -3369,620 +3369,623 @@ namespace lua::native
 		PED::SET_ALLOW_STUNT_JUMP_CAMERA(ped, toggle);
 	}
 
+	static constexpr native_entry PED_natives[] = {
+		{"ADD_ARMOUR_TO_PED", native_function<LUA_NATIVE_PED_ADD_ARMOUR_TO_PED>},
+		{"ADD_PED_DECORATION_FROM_HASHES", native_function<LUA_NATIVE_PED_ADD_PED_DECORATION_FROM_HASHES>},
+		{"ADD_PED_DECORATION_FROM_HASHES_IN_CORONA", native_function<LUA_NATIVE_PED_ADD_PED_DECORATION_FROM_HASHES_IN_CORONA>},
+		{"ADD_RELATIONSHIP_GROUP", native_function<LUA_NATIVE_PED_ADD_RELATIONSHIP_GROUP>},
+		{"ADD_SCENARIO_BLOCKING_AREA", native_function<LUA_NATIVE_PED_ADD_SCENARIO_BLOCKING_AREA>},
+		{"APPLY_DAMAGE_TO_PED", native_function<LUA_NATIVE_PED_APPLY_DAMAGE_TO_PED>},
+		{"APPLY_PED_BLOOD", native_function<LUA_NATIVE_PED_APPLY_PED_BLOOD>},
+		{"APPLY_PED_BLOOD_BY_ZONE", native_function<LUA_NATIVE_PED_APPLY_PED_BLOOD_BY_ZONE>},
+		{"APPLY_PED_BLOOD_DAMAGE_BY_ZONE", native_function<LUA_NATIVE_PED_APPLY_PED_BLOOD_DAMAGE_BY_ZONE>},
+		{"APPLY_PED_BLOOD_SPECIFIC", native_function<LUA_NATIVE_PED_APPLY_PED_BLOOD_SPECIFIC>},
+		{"APPLY_PED_DAMAGE_DECAL", native_function<LUA_NATIVE_PED_APPLY_PED_DAMAGE_DECAL>},
+		{"APPLY_PED_DAMAGE_PACK", native_function<LUA_NATIVE_PED_APPLY_PED_DAMAGE_PACK>},
+		{"ATTACH_SYNCHRONIZED_SCENE_TO_ENTITY", native_function<LUA_NATIVE_PED_ATTACH_SYNCHRONIZED_SCENE_TO_ENTITY>},
+		{"BLOCK_PED_FROM_GENERATING_DEAD_BODY_EVENTS_WHEN_DEAD", native_function<LUA_NATIVE_PED_BLOCK_PED_FROM_GENERATING_DEAD_BODY_EVENTS_WHEN_DEAD>},
+		{"CAN_CREATE_RANDOM_BIKE_RIDER", native_function<LUA_NATIVE_PED_CAN_CREATE_RANDOM_BIKE_RIDER>},
+		{"CAN_CREATE_RANDOM_COPS", native_function<LUA_NATIVE_PED_CAN_CREATE_RANDOM_COPS>},
+		{"CAN_CREATE_RANDOM_DRIVER", native_function<LUA_NATIVE_PED_CAN_CREATE_RANDOM_DRIVER>},
+		{"CAN_CREATE_RANDOM_PED", native_function<LUA_NATIVE_PED_CAN_CREATE_RANDOM_PED>},
+		{"CAN_KNOCK_PED_OFF_VEHICLE", native_function<LUA_NATIVE_PED_CAN_KNOCK_PED_OFF_VEHICLE>},
+		{"CAN_PED_IN_COMBAT_SEE_TARGET", native_function<LUA_NATIVE_PED_CAN_PED_IN_COMBAT_SEE_TARGET>},
+		{"CAN_PED_RAGDOLL", native_function<LUA_NATIVE_PED_CAN_PED_RAGDOLL>},
+		{"CAN_PED_SEE_HATED_PED", native_function<LUA_NATIVE_PED_CAN_PED_SEE_HATED_PED>},
+		{"CAN_PED_SHUFFLE_TO_OR_FROM_EXTRA_SEAT", native_function<LUA_NATIVE_PED_CAN_PED_SHUFFLE_TO_OR_FROM_EXTRA_SEAT>},
+		{"CAN_PED_SHUFFLE_TO_OR_FROM_TURRET_SEAT", native_function<LUA_NATIVE_PED_CAN_PED_SHUFFLE_TO_OR_FROM_TURRET_SEAT>},
+		{"CLEAR_ALL_PED_PROPS", native_function<LUA_NATIVE_PED_CLEAR_ALL_PED_PROPS>},
+		{"CLEAR_ALL_PED_VEHICLE_FORCED_SEAT_USAGE", native_function<LUA_NATIVE_PED_CLEAR_ALL_PED_VEHICLE_FORCED_SEAT_USAGE>},
+		{"CLEAR_COVER_POINT_FOR_PED", native_function<LUA_NATIVE_PED_CLEAR_COVER_POINT_FOR_PED>},
+		{"CLEAR_FACIAL_IDLE_ANIM_OVERRIDE", native_function<LUA_NATIVE_PED_CLEAR_FACIAL_IDLE_ANIM_OVERRIDE>},
+		{"CLEAR_PED_ALTERNATE_MOVEMENT_ANIM", native_function<LUA_NATIVE_PED_CLEAR_PED_ALTERNATE_MOVEMENT_ANIM>},
+		{"CLEAR_PED_ALTERNATE_WALK_ANIM", native_function<LUA_NATIVE_PED_CLEAR_PED_ALTERNATE_WALK_ANIM>},
+		{"CLEAR_PED_BLOOD_DAMAGE", native_function<LUA_NATIVE_PED_CLEAR_PED_BLOOD_DAMAGE>},
+		{"CLEAR_PED_BLOOD_DAMAGE_BY_ZONE", native_function<LUA_NATIVE_PED_CLEAR_PED_BLOOD_DAMAGE_BY_ZONE>},
+		{"CLEAR_PED_DAMAGE_DECAL_BY_ZONE", native_function<LUA_NATIVE_PED_CLEAR_PED_DAMAGE_DECAL_BY_ZONE>},
+		{"CLEAR_PED_DECORATIONS", native_function<LUA_NATIVE_PED_CLEAR_PED_DECORATIONS>},
+		{"CLEAR_PED_DECORATIONS_LEAVE_SCARS", native_function<LUA_NATIVE_PED_CLEAR_PED_DECORATIONS_LEAVE_SCARS>},
+		{"CLEAR_PED_DRIVE_BY_CLIPSET_OVERRIDE", native_function<LUA_NATIVE_PED_CLEAR_PED_DRIVE_BY_CLIPSET_OVERRIDE>},
+		{"CLEAR_PED_ENV_DIRT", native_function<LUA_NATIVE_PED_CLEAR_PED_ENV_DIRT>},
+		{"CLEAR_PED_FALL_UPPER_BODY_CLIPSET_OVERRIDE", native_function<LUA_NATIVE_PED_CLEAR_PED_FALL_UPPER_BODY_CLIPSET_OVERRIDE>},
+		{"CLEAR_PED_LAST_DAMAGE_BONE", native_function<LUA_NATIVE_PED_CLEAR_PED_LAST_DAMAGE_BONE>},
+		{"CLEAR_PED_MOTION_IN_COVER_CLIPSET_OVERRIDE", native_function<LUA_NATIVE_PED_CLEAR_PED_MOTION_IN_COVER_CLIPSET_OVERRIDE>},
+		{"CLEAR_PED_NON_CREATION_AREA", native_function<LUA_NATIVE_PED_CLEAR_PED_NON_CREATION_AREA>},
+		{"CLEAR_PED_PARACHUTE_PACK_VARIATION", native_function<LUA_NATIVE_PED_CLEAR_PED_PARACHUTE_PACK_VARIATION>},
+		{"CLEAR_PED_PROP", native_function<LUA_NATIVE_PED_CLEAR_PED_PROP>},
+		{"CLEAR_PED_SCUBA_GEAR_VARIATION", native_function<LUA_NATIVE_PED_CLEAR_PED_SCUBA_GEAR_VARIATION>},
+		{"CLEAR_PED_STORED_HAT_PROP", native_function<LUA_NATIVE_PED_CLEAR_PED_STORED_HAT_PROP>},
+		{"CLEAR_PED_WETNESS", native_function<LUA_NATIVE_PED_CLEAR_PED_WETNESS>},
+		{"CLEAR_RAGDOLL_BLOCKING_FLAGS", native_function<LUA_NATIVE_PED_CLEAR_RAGDOLL_BLOCKING_FLAGS>},
+		{"CLEAR_RELATIONSHIP_BETWEEN_GROUPS", native_function<LUA_NATIVE_PED_CLEAR_RELATIONSHIP_BETWEEN_GROUPS>},
+		{"CLONE_PED", native_function<LUA_NATIVE_PED_CLONE_PED>},
+		{"CLONE_PED_ALT", native_function<LUA_NATIVE_PED_CLONE_PED_ALT>},
+		{"CLONE_PED_TO_TARGET", native_function<LUA_NATIVE_PED_CLONE_PED_TO_TARGET>},
+		{"CLONE_PED_TO_TARGET_ALT", native_function<LUA_NATIVE_PED_CLONE_PED_TO_TARGET_ALT>},
+		{"COUNT_PEDS_IN_COMBAT_WITH_TARGET", native_function<LUA_NATIVE_PED_COUNT_PEDS_IN_COMBAT_WITH_TARGET>},
+		{"COUNT_PEDS_IN_COMBAT_WITH_TARGET_WITHIN_RADIUS", native_function<LUA_NATIVE_PED_COUNT_PEDS_IN_COMBAT_WITH_TARGET_WITHIN_RADIUS>},
+		{"CREATE_GROUP", native_function<LUA_NATIVE_PED_CREATE_GROUP>},
+		{"CREATE_NM_MESSAGE", native_function<LUA_NATIVE_PED_CREATE_NM_MESSAGE>},
+		{"CREATE_PARACHUTE_BAG_OBJECT", native_function<LUA_NATIVE_PED_CREATE_PARACHUTE_BAG_OBJECT>},
+		{"CREATE_PED", native_function<LUA_NATIVE_PED_CREATE_PED>},
+		{"CREATE_PED_INSIDE_VEHICLE", native_function<LUA_NATIVE_PED_CREATE_PED_INSIDE_VEHICLE>},
+		{"CREATE_RANDOM_PED", native_function<LUA_NATIVE_PED_CREATE_RANDOM_PED>},
+		{"CREATE_RANDOM_PED_AS_DRIVER", native_function<LUA_NATIVE_PED_CREATE_RANDOM_PED_AS_DRIVER>},
+		{"CREATE_SYNCHRONIZED_SCENE", native_function<LUA_NATIVE_PED_CREATE_SYNCHRONIZED_SCENE>},
+		{"CREATE_SYNCHRONIZED_SCENE_AT_MAP_OBJECT", native_function<LUA_NATIVE_PED_CREATE_SYNCHRONIZED_SCENE_AT_MAP_OBJECT>},
+		{"DELETE_PED", native_function<LUA_NATIVE_PED_DELETE_PED>},
+		{"DETACH_SYNCHRONIZED_SCENE", native_function<LUA_NATIVE_PED_DETACH_SYNCHRONIZED_SCENE>},
+		{"DISABLE_HEAD_BLEND_PALETTE_COLOR", native_function<LUA_NATIVE_PED_DISABLE_HEAD_BLEND_PALETTE_COLOR>},
+		{"DISABLE_PED_HEATSCALE_OVERRIDE", native_function<LUA_NATIVE_PED_DISABLE_PED_HEATSCALE_OVERRIDE>},
+		{"DISABLE_PED_INJURED_ON_GROUND_BEHAVIOUR", native_function<LUA_NATIVE_PED_DISABLE_PED_INJURED_ON_GROUND_BEHAVIOUR>},
+		{"DOES_GROUP_EXIST", native_function<LUA_NATIVE_PED_DOES_GROUP_EXIST>},
+		{"DOES_RELATIONSHIP_GROUP_EXIST", native_function<LUA_NATIVE_PED_DOES_RELATIONSHIP_GROUP_EXIST>},
+		{"DOES_SCENARIO_BLOCKING_AREA_EXISTS", native_function<LUA_NATIVE_PED_DOES_SCENARIO_BLOCKING_AREA_EXISTS>},
+		{"DROP_AMBIENT_PROP", native_function<LUA_NATIVE_PED_DROP_AMBIENT_PROP>},
+		{"ENABLE_MP_LIGHT", native_function<LUA_NATIVE_PED_ENABLE_MP_LIGHT>},
+		{"EXPLODE_PED_HEAD", native_function<LUA_NATIVE_PED_EXPLODE_PED_HEAD>},
+		{"FINALIZE_HEAD_BLEND", native_function<LUA_NATIVE_PED_FINALIZE_HEAD_BLEND>},
+		{"FORCE_ALL_HEADING_VALUES_TO_ALIGN", native_function<LUA_NATIVE_PED_FORCE_ALL_HEADING_VALUES_TO_ALIGN>},
+		{"FORCE_INSTANT_LEG_IK_SETUP", native_function<LUA_NATIVE_PED_FORCE_INSTANT_LEG_IK_SETUP>},
+		{"FORCE_PED_AI_AND_ANIMATION_UPDATE", native_function<LUA_NATIVE_PED_FORCE_PED_AI_AND_ANIMATION_UPDATE>},
+		{"FORCE_PED_MOTION_STATE", native_function<LUA_NATIVE_PED_FORCE_PED_MOTION_STATE>},
+		{"FORCE_PED_TO_OPEN_PARACHUTE", native_function<LUA_NATIVE_PED_FORCE_PED_TO_OPEN_PARACHUTE>},
+		{"FORCE_ZERO_MASS_IN_COLLISIONS", native_function<LUA_NATIVE_PED_FORCE_ZERO_MASS_IN_COLLISIONS>},
+		{"GET_ANIM_INITIAL_OFFSET_POSITION", native_function<LUA_NATIVE_PED_GET_ANIM_INITIAL_OFFSET_POSITION>},
+		{"GET_ANIM_INITIAL_OFFSET_ROTATION", native_function<LUA_NATIVE_PED_GET_ANIM_INITIAL_OFFSET_ROTATION>},
+		{"GET_CAN_PED_BE_GRABBED_BY_SCRIPT", native_function<LUA_NATIVE_PED_GET_CAN_PED_BE_GRABBED_BY_SCRIPT>},
+		{"GET_CLOSEST_PED", native_function<LUA_NATIVE_PED_GET_CLOSEST_PED>},
+		{"GET_COMBAT_FLOAT", native_function<LUA_NATIVE_PED_GET_COMBAT_FLOAT>},
+		{"GET_DEAD_PED_PICKUP_COORDS", native_function<LUA_NATIVE_PED_GET_DEAD_PED_PICKUP_COORDS>},
+		{"GET_DEFAULT_SECONDARY_TINT_FOR_BARBER", native_function<LUA_NATIVE_PED_GET_DEFAULT_SECONDARY_TINT_FOR_BARBER>},
+		{"GET_DEFAULT_SECONDARY_TINT_FOR_CREATOR", native_function<LUA_NATIVE_PED_GET_DEFAULT_SECONDARY_TINT_FOR_CREATOR>},
+		{"GET_FM_FEMALE_SHOP_PED_APPAREL_ITEM_INDEX", native_function<LUA_NATIVE_PED_GET_FM_FEMALE_SHOP_PED_APPAREL_ITEM_INDEX>},
+		{"GET_FM_MALE_SHOP_PED_APPAREL_ITEM_INDEX", native_function<LUA_NATIVE_PED_GET_FM_MALE_SHOP_PED_APPAREL_ITEM_INDEX>},
+		{"GET_GROUP_SIZE", native_function<LUA_NATIVE_PED_GET_GROUP_SIZE>},
+		{"GET_HEAD_BLEND_EYE_COLOR", native_function<LUA_NATIVE_PED_GET_HEAD_BLEND_EYE_COLOR>},
+		{"GET_JACK_TARGET", native_function<LUA_NATIVE_PED_GET_JACK_TARGET>},
+		{"GET_MELEE_TARGET_FOR_PED", native_function<LUA_NATIVE_PED_GET_MELEE_TARGET_FOR_PED>},
+		{"GET_MOUNT", native_function<LUA_NATIVE_PED_GET_MOUNT>},
+		{"GET_MP_LIGHT_ENABLED", native_function<LUA_NATIVE_PED_GET_MP_LIGHT_ENABLED>},
+		{"GET_MP_OUTFIT_DATA_FROM_METADATA", native_function<LUA_NATIVE_PED_GET_MP_OUTFIT_DATA_FROM_METADATA>},
+		{"GET_NUMBER_OF_PED_DRAWABLE_VARIATIONS", native_function<LUA_NATIVE_PED_GET_NUMBER_OF_PED_DRAWABLE_VARIATIONS>},
+		{"GET_NUMBER_OF_PED_PROP_DRAWABLE_VARIATIONS", native_function<LUA_NATIVE_PED_GET_NUMBER_OF_PED_PROP_DRAWABLE_VARIATIONS>},
+		{"GET_NUMBER_OF_PED_PROP_TEXTURE_VARIATIONS", native_function<LUA_NATIVE_PED_GET_NUMBER_OF_PED_PROP_TEXTURE_VARIATIONS>},
+		{"GET_NUMBER_OF_PED_TEXTURE_VARIATIONS", native_function<LUA_NATIVE_PED_GET_NUMBER_OF_PED_TEXTURE_VARIATIONS>},
+		{"GET_NUM_PED_HAIR_TINTS", native_function<LUA_NATIVE_PED_GET_NUM_PED_HAIR_TINTS>},
+		{"GET_NUM_PED_MAKEUP_TINTS", native_function<LUA_NATIVE_PED_GET_NUM_PED_MAKEUP_TINTS>},
+		{"GET_PEDHEADSHOT_TXD_STRING", native_function<LUA_NATIVE_PED_GET_PEDHEADSHOT_TXD_STRING>},
+		{"GET_PEDS_JACKER", native_function<LUA_NATIVE_PED_GET_PEDS_JACKER>},
+		{"GET_PED_ACCURACY", native_function<LUA_NATIVE_PED_GET_PED_ACCURACY>},
+		{"GET_PED_ALERTNESS", native_function<LUA_NATIVE_PED_GET_PED_ALERTNESS>},
+		{"GET_PED_ARMOUR", native_function<LUA_NATIVE_PED_GET_PED_ARMOUR>},
+		{"GET_PED_AS_GROUP_LEADER", native_function<LUA_NATIVE_PED_GET_PED_AS_GROUP_LEADER>},
+		{"GET_PED_AS_GROUP_MEMBER", native_function<LUA_NATIVE_PED_GET_PED_AS_GROUP_MEMBER>},
+		{"GET_PED_BONE_COORDS", native_function<LUA_NATIVE_PED_GET_PED_BONE_COORDS>},
+		{"GET_PED_BONE_INDEX", native_function<LUA_NATIVE_PED_GET_PED_BONE_INDEX>},
+		{"GET_PED_CAUSE_OF_DEATH", native_function<LUA_NATIVE_PED_GET_PED_CAUSE_OF_DEATH>},
+		{"GET_PED_COMBAT_MOVEMENT", native_function<LUA_NATIVE_PED_GET_PED_COMBAT_MOVEMENT>},
+		{"GET_PED_COMBAT_RANGE", native_function<LUA_NATIVE_PED_GET_PED_COMBAT_RANGE>},
+		{"GET_PED_CONFIG_FLAG", native_function<LUA_NATIVE_PED_GET_PED_CONFIG_FLAG>},
+		{"GET_PED_CURRENT_MOVE_BLEND_RATIO", native_function<LUA_NATIVE_PED_GET_PED_CURRENT_MOVE_BLEND_RATIO>},
+		{"GET_PED_DECORATIONS_STATE", native_function<LUA_NATIVE_PED_GET_PED_DECORATIONS_STATE>},
+		{"GET_PED_DECORATION_ZONE_FROM_HASHES", native_function<LUA_NATIVE_PED_GET_PED_DECORATION_ZONE_FROM_HASHES>},
+		{"GET_PED_DEFENSIVE_AREA_POSITION", native_function<LUA_NATIVE_PED_GET_PED_DEFENSIVE_AREA_POSITION>},
+		{"GET_PED_DIES_IN_WATER", native_function<LUA_NATIVE_PED_GET_PED_DIES_IN_WATER>},
+		{"GET_PED_DRAWABLE_VARIATION", native_function<LUA_NATIVE_PED_GET_PED_DRAWABLE_VARIATION>},
+		{"GET_PED_EMISSIVE_SCALE", native_function<LUA_NATIVE_PED_GET_PED_EMISSIVE_SCALE>},
+		{"GET_PED_ENVEFF_SCALE", native_function<LUA_NATIVE_PED_GET_PED_ENVEFF_SCALE>},
+		{"GET_PED_EXTRACTED_DISPLACEMENT", native_function<LUA_NATIVE_PED_GET_PED_EXTRACTED_DISPLACEMENT>},
+		{"GET_PED_GROUP_INDEX", native_function<LUA_NATIVE_PED_GET_PED_GROUP_INDEX>},
+		{"GET_PED_HAIR_TINT_COLOR", native_function<LUA_NATIVE_PED_GET_PED_HAIR_TINT_COLOR>},
+		{"GET_PED_HEAD_BLEND_DATA", native_function<LUA_NATIVE_PED_GET_PED_HEAD_BLEND_DATA>},
+		{"GET_PED_HEAD_BLEND_FIRST_INDEX", native_function<LUA_NATIVE_PED_GET_PED_HEAD_BLEND_FIRST_INDEX>},
+		{"GET_PED_HEAD_BLEND_NUM_HEADS", native_function<LUA_NATIVE_PED_GET_PED_HEAD_BLEND_NUM_HEADS>},
+		{"GET_PED_HEAD_OVERLAY", native_function<LUA_NATIVE_PED_GET_PED_HEAD_OVERLAY>},
+		{"GET_PED_HEAD_OVERLAY_NUM", native_function<LUA_NATIVE_PED_GET_PED_HEAD_OVERLAY_NUM>},
+		{"GET_PED_HELMET_STORED_HAT_PROP_INDEX", native_function<LUA_NATIVE_PED_GET_PED_HELMET_STORED_HAT_PROP_INDEX>},
+		{"GET_PED_HELMET_STORED_HAT_TEX_INDEX", native_function<LUA_NATIVE_PED_GET_PED_HELMET_STORED_HAT_TEX_INDEX>},
+		{"GET_PED_LAST_DAMAGE_BONE", native_function<LUA_NATIVE_PED_GET_PED_LAST_DAMAGE_BONE>},
+		{"GET_PED_MAKEUP_TINT_COLOR", native_function<LUA_NATIVE_PED_GET_PED_MAKEUP_TINT_COLOR>},
+		{"GET_PED_MAX_HEALTH", native_function<LUA_NATIVE_PED_GET_PED_MAX_HEALTH>},
+		{"GET_PED_MONEY", native_function<LUA_NATIVE_PED_GET_PED_MONEY>},
+		{"GET_PED_NEARBY_PEDS", native_function<LUA_NATIVE_PED_GET_PED_NEARBY_PEDS>},
+		{"GET_PED_NEARBY_VEHICLES", native_function<LUA_NATIVE_PED_GET_PED_NEARBY_VEHICLES>},
+		{"GET_PED_PALETTE_VARIATION", native_function<LUA_NATIVE_PED_GET_PED_PALETTE_VARIATION>},
+		{"GET_PED_PARACHUTE_LANDING_TYPE", native_function<LUA_NATIVE_PED_GET_PED_PARACHUTE_LANDING_TYPE>},
+		{"GET_PED_PARACHUTE_STATE", native_function<LUA_NATIVE_PED_GET_PED_PARACHUTE_STATE>},
+		{"GET_PED_PARACHUTE_TINT_INDEX", native_function<LUA_NATIVE_PED_GET_PED_PARACHUTE_TINT_INDEX>},
+		{"GET_PED_PROP_INDEX", native_function<LUA_NATIVE_PED_GET_PED_PROP_INDEX>},
+		{"GET_PED_PROP_TEXTURE_INDEX", native_function<LUA_NATIVE_PED_GET_PED_PROP_TEXTURE_INDEX>},
+		{"GET_PED_RAGDOLL_BONE_INDEX", native_function<LUA_NATIVE_PED_GET_PED_RAGDOLL_BONE_INDEX>},
+		{"GET_PED_RELATIONSHIP_GROUP_DEFAULT_HASH", native_function<LUA_NATIVE_PED_GET_PED_RELATIONSHIP_GROUP_DEFAULT_HASH>},
+		{"GET_PED_RELATIONSHIP_GROUP_HASH", native_function<LUA_NATIVE_PED_GET_PED_RELATIONSHIP_GROUP_HASH>},
+		{"GET_PED_RESET_FLAG", native_function<LUA_NATIVE_PED_GET_PED_RESET_FLAG>},
+		{"GET_PED_SOURCE_OF_DEATH", native_function<LUA_NATIVE_PED_GET_PED_SOURCE_OF_DEATH>},
+		{"GET_PED_STEALTH_MOVEMENT", native_function<LUA_NATIVE_PED_GET_PED_STEALTH_MOVEMENT>},
+		{"GET_PED_TARGET_FROM_COMBAT_PED", native_function<LUA_NATIVE_PED_GET_PED_TARGET_FROM_COMBAT_PED>},
+		{"GET_PED_TEXTURE_VARIATION", native_function<LUA_NATIVE_PED_GET_PED_TEXTURE_VARIATION>},
+		{"GET_PED_TIME_OF_DEATH", native_function<LUA_NATIVE_PED_GET_PED_TIME_OF_DEATH>},
+		{"GET_PED_TYPE", native_function<LUA_NATIVE_PED_GET_PED_TYPE>},
+		{"GET_PED_VISUAL_FIELD_CENTER_ANGLE", native_function<LUA_NATIVE_PED_GET_PED_VISUAL_FIELD_CENTER_ANGLE>},
+		{"GET_PLAYER_PED_IS_FOLLOWING", native_function<LUA_NATIVE_PED_GET_PLAYER_PED_IS_FOLLOWING>},
+		{"GET_POS_FROM_FIRED_EVENT", native_function<LUA_NATIVE_PED_GET_POS_FROM_FIRED_EVENT>},
+		{"GET_RANDOM_PED_AT_COORD", native_function<LUA_NATIVE_PED_GET_RANDOM_PED_AT_COORD>},
+		{"GET_RELATIONSHIP_BETWEEN_GROUPS", native_function<LUA_NATIVE_PED_GET_RELATIONSHIP_BETWEEN_GROUPS>},
+		{"GET_RELATIONSHIP_BETWEEN_PEDS", native_function<LUA_NATIVE_PED_GET_RELATIONSHIP_BETWEEN_PEDS>},
+		{"GET_SEAT_PED_IS_TRYING_TO_ENTER", native_function<LUA_NATIVE_PED_GET_SEAT_PED_IS_TRYING_TO_ENTER>},
+		{"GET_SYNCHRONIZED_SCENE_PHASE", native_function<LUA_NATIVE_PED_GET_SYNCHRONIZED_SCENE_PHASE>},
+		{"GET_SYNCHRONIZED_SCENE_RATE", native_function<LUA_NATIVE_PED_GET_SYNCHRONIZED_SCENE_RATE>},
+		{"GET_TIME_PED_DAMAGED_BY_WEAPON", native_function<LUA_NATIVE_PED_GET_TIME_PED_DAMAGED_BY_WEAPON>},
+		{"GET_TINT_INDEX_FOR_LAST_GEN_HAIR_TEXTURE", native_function<LUA_NATIVE_PED_GET_TINT_INDEX_FOR_LAST_GEN_HAIR_TEXTURE>},
+		{"GET_TRACKED_PED_PIXELCOUNT", native_function<LUA_NATIVE_PED_GET_TRACKED_PED_PIXELCOUNT>},
+		{"GET_VEHICLE_PED_IS_ENTERING", native_function<LUA_NATIVE_PED_GET_VEHICLE_PED_IS_ENTERING>},
+		{"GET_VEHICLE_PED_IS_IN", native_function<LUA_NATIVE_PED_GET_VEHICLE_PED_IS_IN>},
+		{"GET_VEHICLE_PED_IS_TRYING_TO_ENTER", native_function<LUA_NATIVE_PED_GET_VEHICLE_PED_IS_TRYING_TO_ENTER>},
+		{"GET_VEHICLE_PED_IS_USING", native_function<LUA_NATIVE_PED_GET_VEHICLE_PED_IS_USING>},
+		{"GIVE_PED_HELMET", native_function<LUA_NATIVE_PED_GIVE_PED_HELMET>},
+		{"GIVE_PED_NM_MESSAGE", native_function<LUA_NATIVE_PED_GIVE_PED_NM_MESSAGE>},
+		{"HAS_ACTION_MODE_ASSET_LOADED", native_function<LUA_NATIVE_PED_HAS_ACTION_MODE_ASSET_LOADED>},
+		{"HAS_PEDHEADSHOT_IMG_UPLOAD_FAILED", native_function<LUA_NATIVE_PED_HAS_PEDHEADSHOT_IMG_UPLOAD_FAILED>},
+		{"HAS_PEDHEADSHOT_IMG_UPLOAD_SUCCEEDED", native_function<LUA_NATIVE_PED_HAS_PEDHEADSHOT_IMG_UPLOAD_SUCCEEDED>},
+		{"HAS_PED_CLEAR_LOS_TO_ENTITY_", native_function<LUA_NATIVE_PED_HAS_PED_CLEAR_LOS_TO_ENTITY_>},
+		{"HAS_PED_HEAD_BLEND_FINISHED", native_function<LUA_NATIVE_PED_HAS_PED_HEAD_BLEND_FINISHED>},
+		{"HAS_PED_PRELOAD_PROP_DATA_FINISHED", native_function<LUA_NATIVE_PED_HAS_PED_PRELOAD_PROP_DATA_FINISHED>},
+		{"HAS_PED_PRELOAD_VARIATION_DATA_FINISHED", native_function<LUA_NATIVE_PED_HAS_PED_PRELOAD_VARIATION_DATA_FINISHED>},
+		{"HAS_PED_RECEIVED_EVENT", native_function<LUA_NATIVE_PED_HAS_PED_RECEIVED_EVENT>},
+		{"HAS_STEALTH_MODE_ASSET_LOADED", native_function<LUA_NATIVE_PED_HAS_STEALTH_MODE_ASSET_LOADED>},
+		{"HAVE_ALL_STREAMING_REQUESTS_COMPLETED", native_function<LUA_NATIVE_PED_HAVE_ALL_STREAMING_REQUESTS_COMPLETED>},
+		{"HIDE_PED_BLOOD_DAMAGE_BY_ZONE", native_function<LUA_NATIVE_PED_HIDE_PED_BLOOD_DAMAGE_BY_ZONE>},
+		{"INSTANTLY_FILL_PED_POPULATION", native_function<LUA_NATIVE_PED_INSTANTLY_FILL_PED_POPULATION>},
+		{"IS_ANY_HOSTILE_PED_NEAR_POINT", native_function<LUA_NATIVE_PED_IS_ANY_HOSTILE_PED_NEAR_POINT>},
+		{"IS_ANY_PED_NEAR_POINT", native_function<LUA_NATIVE_PED_IS_ANY_PED_NEAR_POINT>},
+		{"IS_ANY_PED_SHOOTING_IN_AREA", native_function<LUA_NATIVE_PED_IS_ANY_PED_SHOOTING_IN_AREA>},
+		{"IS_CONVERSATION_PED_DEAD", native_function<LUA_NATIVE_PED_IS_CONVERSATION_PED_DEAD>},
+		{"IS_COP_PED_IN_AREA_3D", native_function<LUA_NATIVE_PED_IS_COP_PED_IN_AREA_3D>},
+		{"IS_CURRENT_HEAD_PROP_A_HELMET", native_function<LUA_NATIVE_PED_IS_CURRENT_HEAD_PROP_A_HELMET>},
+		{"IS_MOBILE_PHONE_TO_PED_EAR", native_function<LUA_NATIVE_PED_IS_MOBILE_PHONE_TO_PED_EAR>},
+		{"IS_PEDHEADSHOT_IMG_UPLOAD_AVAILABLE", native_function<LUA_NATIVE_PED_IS_PEDHEADSHOT_IMG_UPLOAD_AVAILABLE>},
+		{"IS_PEDHEADSHOT_READY", native_function<LUA_NATIVE_PED_IS_PEDHEADSHOT_READY>},
+		{"IS_PEDHEADSHOT_VALID", native_function<LUA_NATIVE_PED_IS_PEDHEADSHOT_VALID>},
+		{"IS_PED_AIMING_FROM_COVER", native_function<LUA_NATIVE_PED_IS_PED_AIMING_FROM_COVER>},
+		{"IS_PED_A_PLAYER", native_function<LUA_NATIVE_PED_IS_PED_A_PLAYER>},
+		{"IS_PED_BEING_JACKED", native_function<LUA_NATIVE_PED_IS_PED_BEING_JACKED>},
+		{"IS_PED_BEING_STEALTH_KILLED", native_function<LUA_NATIVE_PED_IS_PED_BEING_STEALTH_KILLED>},
+		{"IS_PED_BEING_STUNNED", native_function<LUA_NATIVE_PED_IS_PED_BEING_STUNNED>},
+		{"IS_PED_BLUSH_FACEPAINT_TINT_FOR_BARBER", native_function<LUA_NATIVE_PED_IS_PED_BLUSH_FACEPAINT_TINT_FOR_BARBER>},
+		{"IS_PED_BLUSH_TINT_FOR_BARBER", native_function<LUA_NATIVE_PED_IS_PED_BLUSH_TINT_FOR_BARBER>},
+		{"IS_PED_BLUSH_TINT_FOR_CREATOR", native_function<LUA_NATIVE_PED_IS_PED_BLUSH_TINT_FOR_CREATOR>},
+		{"IS_PED_CLIMBING", native_function<LUA_NATIVE_PED_IS_PED_CLIMBING>},
+		{"IS_PED_COMPONENT_VARIATION_VALID", native_function<LUA_NATIVE_PED_IS_PED_COMPONENT_VARIATION_VALID>},
+		{"IS_PED_DEAD_OR_DYING", native_function<LUA_NATIVE_PED_IS_PED_DEAD_OR_DYING>},
+		{"IS_PED_DEFENSIVE_AREA_ACTIVE", native_function<LUA_NATIVE_PED_IS_PED_DEFENSIVE_AREA_ACTIVE>},
+		{"IS_PED_DIVING", native_function<LUA_NATIVE_PED_IS_PED_DIVING>},
+		{"IS_PED_DOING_A_BEAST_JUMP", native_function<LUA_NATIVE_PED_IS_PED_DOING_A_BEAST_JUMP>},
+		{"IS_PED_DOING_DRIVEBY", native_function<LUA_NATIVE_PED_IS_PED_DOING_DRIVEBY>},
+		{"IS_PED_DUCKING", native_function<LUA_NATIVE_PED_IS_PED_DUCKING>},
+		{"IS_PED_EVASIVE_DIVING", native_function<LUA_NATIVE_PED_IS_PED_EVASIVE_DIVING>},
+		{"IS_PED_FACING_PED", native_function<LUA_NATIVE_PED_IS_PED_FACING_PED>},
+		{"IS_PED_FALLING", native_function<LUA_NATIVE_PED_IS_PED_FALLING>},
+		{"IS_PED_FATALLY_INJURED", native_function<LUA_NATIVE_PED_IS_PED_FATALLY_INJURED>},
+		{"IS_PED_FLEEING", native_function<LUA_NATIVE_PED_IS_PED_FLEEING>},
+		{"IS_PED_GESTURING", native_function<LUA_NATIVE_PED_IS_PED_GESTURING>},
+		{"IS_PED_GETTING_INTO_A_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_GETTING_INTO_A_VEHICLE>},
+		{"IS_PED_GOING_INTO_COVER", native_function<LUA_NATIVE_PED_IS_PED_GOING_INTO_COVER>},
+		{"IS_PED_GROUP_MEMBER", native_function<LUA_NATIVE_PED_IS_PED_GROUP_MEMBER>},
+		{"IS_PED_HAIR_TINT_FOR_BARBER", native_function<LUA_NATIVE_PED_IS_PED_HAIR_TINT_FOR_BARBER>},
+		{"IS_PED_HAIR_TINT_FOR_CREATOR", native_function<LUA_NATIVE_PED_IS_PED_HAIR_TINT_FOR_CREATOR>},
+		{"IS_PED_HANGING_ON_TO_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_HANGING_ON_TO_VEHICLE>},
+		{"IS_PED_HEADING_TOWARDS_POSITION", native_function<LUA_NATIVE_PED_IS_PED_HEADING_TOWARDS_POSITION>},
+		{"IS_PED_HEADTRACKING_ENTITY", native_function<LUA_NATIVE_PED_IS_PED_HEADTRACKING_ENTITY>},
+		{"IS_PED_HEADTRACKING_PED", native_function<LUA_NATIVE_PED_IS_PED_HEADTRACKING_PED>},
+		{"IS_PED_HELMET_VISOR_UP", native_function<LUA_NATIVE_PED_IS_PED_HELMET_VISOR_UP>},
+		{"IS_PED_HUMAN", native_function<LUA_NATIVE_PED_IS_PED_HUMAN>},
+		{"IS_PED_HURT", native_function<LUA_NATIVE_PED_IS_PED_HURT>},
+		{"IS_PED_INJURED", native_function<LUA_NATIVE_PED_IS_PED_INJURED>},
+		{"IS_PED_IN_ANY_BOAT", native_function<LUA_NATIVE_PED_IS_PED_IN_ANY_BOAT>},
+		{"IS_PED_IN_ANY_HELI", native_function<LUA_NATIVE_PED_IS_PED_IN_ANY_HELI>},
+		{"IS_PED_IN_ANY_PLANE", native_function<LUA_NATIVE_PED_IS_PED_IN_ANY_PLANE>},
+		{"IS_PED_IN_ANY_POLICE_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_IN_ANY_POLICE_VEHICLE>},
+		{"IS_PED_IN_ANY_SUB", native_function<LUA_NATIVE_PED_IS_PED_IN_ANY_SUB>},
+		{"IS_PED_IN_ANY_TAXI", native_function<LUA_NATIVE_PED_IS_PED_IN_ANY_TAXI>},
+		{"IS_PED_IN_ANY_TRAIN", native_function<LUA_NATIVE_PED_IS_PED_IN_ANY_TRAIN>},
+		{"IS_PED_IN_ANY_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_IN_ANY_VEHICLE>},
+		{"IS_PED_IN_COMBAT", native_function<LUA_NATIVE_PED_IS_PED_IN_COMBAT>},
+		{"IS_PED_IN_COVER", native_function<LUA_NATIVE_PED_IS_PED_IN_COVER>},
+		{"IS_PED_IN_COVER_FACING_LEFT", native_function<LUA_NATIVE_PED_IS_PED_IN_COVER_FACING_LEFT>},
+		{"IS_PED_IN_FLYING_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_IN_FLYING_VEHICLE>},
+		{"IS_PED_IN_GROUP", native_function<LUA_NATIVE_PED_IS_PED_IN_GROUP>},
+		{"IS_PED_IN_HIGH_COVER", native_function<LUA_NATIVE_PED_IS_PED_IN_HIGH_COVER>},
+		{"IS_PED_IN_MELEE_COMBAT", native_function<LUA_NATIVE_PED_IS_PED_IN_MELEE_COMBAT>},
+		{"IS_PED_IN_MODEL", native_function<LUA_NATIVE_PED_IS_PED_IN_MODEL>},
+		{"IS_PED_IN_PARACHUTE_FREE_FALL", native_function<LUA_NATIVE_PED_IS_PED_IN_PARACHUTE_FREE_FALL>},
+		{"IS_PED_IN_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_IN_VEHICLE>},
+		{"IS_PED_JACKING", native_function<LUA_NATIVE_PED_IS_PED_JACKING>},
+		{"IS_PED_JUMPING", native_function<LUA_NATIVE_PED_IS_PED_JUMPING>},
+		{"IS_PED_JUMPING_OUT_OF_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_JUMPING_OUT_OF_VEHICLE>},
+		{"IS_PED_LANDING", native_function<LUA_NATIVE_PED_IS_PED_LANDING>},
+		{"IS_PED_LIPSTICK_TINT_FOR_BARBER", native_function<LUA_NATIVE_PED_IS_PED_LIPSTICK_TINT_FOR_BARBER>},
+		{"IS_PED_LIPSTICK_TINT_FOR_CREATOR", native_function<LUA_NATIVE_PED_IS_PED_LIPSTICK_TINT_FOR_CREATOR>},
+		{"IS_PED_MALE", native_function<LUA_NATIVE_PED_IS_PED_MALE>},
+		{"IS_PED_MODEL", native_function<LUA_NATIVE_PED_IS_PED_MODEL>},
+		{"IS_PED_ON_ANY_BIKE", native_function<LUA_NATIVE_PED_IS_PED_ON_ANY_BIKE>},
+		{"IS_PED_ON_FOOT", native_function<LUA_NATIVE_PED_IS_PED_ON_FOOT>},
+		{"IS_PED_ON_MOUNT", native_function<LUA_NATIVE_PED_IS_PED_ON_MOUNT>},
+		{"IS_PED_ON_SPECIFIC_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_ON_SPECIFIC_VEHICLE>},
+		{"IS_PED_ON_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_ON_VEHICLE>},
+		{"IS_PED_OPENING_DOOR", native_function<LUA_NATIVE_PED_IS_PED_OPENING_DOOR>},
+		{"IS_PED_PERFORMING_A_COUNTER_ATTACK", native_function<LUA_NATIVE_PED_IS_PED_PERFORMING_A_COUNTER_ATTACK>},
+		{"IS_PED_PERFORMING_MELEE_ACTION", native_function<LUA_NATIVE_PED_IS_PED_PERFORMING_MELEE_ACTION>},
+		{"IS_PED_PERFORMING_STEALTH_KILL", native_function<LUA_NATIVE_PED_IS_PED_PERFORMING_STEALTH_KILL>},
+		{"IS_PED_PLANTING_BOMB", native_function<LUA_NATIVE_PED_IS_PED_PLANTING_BOMB>},
+		{"IS_PED_PRONE", native_function<LUA_NATIVE_PED_IS_PED_PRONE>},
+		{"IS_PED_RAGDOLL", native_function<LUA_NATIVE_PED_IS_PED_RAGDOLL>},
+		{"IS_PED_RELOADING", native_function<LUA_NATIVE_PED_IS_PED_RELOADING>},
+		{"IS_PED_RESPONDING_TO_EVENT", native_function<LUA_NATIVE_PED_IS_PED_RESPONDING_TO_EVENT>},
+		{"IS_PED_RUNNING_MELEE_TASK", native_function<LUA_NATIVE_PED_IS_PED_RUNNING_MELEE_TASK>},
+		{"IS_PED_RUNNING_MOBILE_PHONE_TASK", native_function<LUA_NATIVE_PED_IS_PED_RUNNING_MOBILE_PHONE_TASK>},
+		{"IS_PED_RUNNING_RAGDOLL_TASK", native_function<LUA_NATIVE_PED_IS_PED_RUNNING_RAGDOLL_TASK>},
+		{"IS_PED_SHADER_READY", native_function<LUA_NATIVE_PED_IS_PED_SHADER_READY>},
+		{"IS_PED_SHELTERED", native_function<LUA_NATIVE_PED_IS_PED_SHELTERED>},
+		{"IS_PED_SHOOTING", native_function<LUA_NATIVE_PED_IS_PED_SHOOTING>},
+		{"IS_PED_SHOOTING_IN_AREA", native_function<LUA_NATIVE_PED_IS_PED_SHOOTING_IN_AREA>},
+		{"IS_PED_SITTING_IN_ANY_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_SITTING_IN_ANY_VEHICLE>},
+		{"IS_PED_SITTING_IN_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_SITTING_IN_VEHICLE>},
+		{"IS_PED_STOPPED", native_function<LUA_NATIVE_PED_IS_PED_STOPPED>},
+		{"IS_PED_SWIMMING", native_function<LUA_NATIVE_PED_IS_PED_SWIMMING>},
+		{"IS_PED_SWIMMING_UNDER_WATER", native_function<LUA_NATIVE_PED_IS_PED_SWIMMING_UNDER_WATER>},
+		{"IS_PED_SWITCHING_WEAPON", native_function<LUA_NATIVE_PED_IS_PED_SWITCHING_WEAPON>},
+		{"IS_PED_TAKING_OFF_HELMET", native_function<LUA_NATIVE_PED_IS_PED_TAKING_OFF_HELMET>},
+		{"IS_PED_TRACKED", native_function<LUA_NATIVE_PED_IS_PED_TRACKED>},
+		{"IS_PED_TRYING_TO_ENTER_A_LOCKED_VEHICLE", native_function<LUA_NATIVE_PED_IS_PED_TRYING_TO_ENTER_A_LOCKED_VEHICLE>},
+		{"IS_PED_USING_ACTION_MODE", native_function<LUA_NATIVE_PED_IS_PED_USING_ACTION_MODE>},
+		{"IS_PED_USING_ANY_SCENARIO", native_function<LUA_NATIVE_PED_IS_PED_USING_ANY_SCENARIO>},
+		{"IS_PED_USING_SCENARIO", native_function<LUA_NATIVE_PED_IS_PED_USING_SCENARIO>},
+		{"IS_PED_VAULTING", native_function<LUA_NATIVE_PED_IS_PED_VAULTING>},
+		{"IS_PED_WEARING_HELMET", native_function<LUA_NATIVE_PED_IS_PED_WEARING_HELMET>},
+		{"IS_SCRIPTED_SCENARIO_PED_USING_CONDITIONAL_ANIM", native_function<LUA_NATIVE_PED_IS_SCRIPTED_SCENARIO_PED_USING_CONDITIONAL_ANIM>},
+		{"IS_SYNCHRONIZED_SCENE_HOLD_LAST_FRAME", native_function<LUA_NATIVE_PED_IS_SYNCHRONIZED_SCENE_HOLD_LAST_FRAME>},
+		{"IS_SYNCHRONIZED_SCENE_LOOPED", native_function<LUA_NATIVE_PED_IS_SYNCHRONIZED_SCENE_LOOPED>},
+		{"IS_SYNCHRONIZED_SCENE_RUNNING", native_function<LUA_NATIVE_PED_IS_SYNCHRONIZED_SCENE_RUNNING>},
+		{"IS_TARGET_PED_IN_PERCEPTION_AREA", native_function<LUA_NATIVE_PED_IS_TARGET_PED_IN_PERCEPTION_AREA>},
+		{"IS_TRACKED_PED_VISIBLE", native_function<LUA_NATIVE_PED_IS_TRACKED_PED_VISIBLE>},
+		{"IS_USING_PED_SCUBA_GEAR_VARIATION", native_function<LUA_NATIVE_PED_IS_USING_PED_SCUBA_GEAR_VARIATION>},
+		{"KNOCK_OFF_PED_PROP", native_function<LUA_NATIVE_PED_KNOCK_OFF_PED_PROP>},
+		{"KNOCK_PED_OFF_VEHICLE", native_function<LUA_NATIVE_PED_KNOCK_PED_OFF_VEHICLE>},
+		{"MARK_PED_DECORATIONS_AS_CLONED_FROM_LOCAL_PLAYER", native_function<LUA_NATIVE_PED_MARK_PED_DECORATIONS_AS_CLONED_FROM_LOCAL_PLAYER>},
+		{"PED_HAS_SEXINESS_FLAG_SET", native_function<LUA_NATIVE_PED_PED_HAS_SEXINESS_FLAG_SET>},
+		{"PLAY_FACIAL_ANIM", native_function<LUA_NATIVE_PED_PLAY_FACIAL_ANIM>},
+		{"REGISTER_HATED_TARGETS_AROUND_PED", native_function<LUA_NATIVE_PED_REGISTER_HATED_TARGETS_AROUND_PED>},
+		{"REGISTER_PEDHEADSHOT", native_function<LUA_NATIVE_PED_REGISTER_PEDHEADSHOT>},
+		{"REGISTER_PEDHEADSHOT_HIRES", native_function<LUA_NATIVE_PED_REGISTER_PEDHEADSHOT_HIRES>},
+		{"REGISTER_PEDHEADSHOT_TRANSPARENT", native_function<LUA_NATIVE_PED_REGISTER_PEDHEADSHOT_TRANSPARENT>},
+		{"REGISTER_TARGET", native_function<LUA_NATIVE_PED_REGISTER_TARGET>},
+		{"RELEASE_PEDHEADSHOT_IMG_UPLOAD", native_function<LUA_NATIVE_PED_RELEASE_PEDHEADSHOT_IMG_UPLOAD>},
+		{"RELEASE_PED_PRELOAD_PROP_DATA", native_function<LUA_NATIVE_PED_RELEASE_PED_PRELOAD_PROP_DATA>},
+		{"RELEASE_PED_PRELOAD_VARIATION_DATA", native_function<LUA_NATIVE_PED_RELEASE_PED_PRELOAD_VARIATION_DATA>},
+		{"REMOVE_ACTION_MODE_ASSET", native_function<LUA_NATIVE_PED_REMOVE_ACTION_MODE_ASSET>},
+		{"REMOVE_GROUP", native_function<LUA_NATIVE_PED_REMOVE_GROUP>},
+		{"REMOVE_PED_DEFENSIVE_AREA", native_function<LUA_NATIVE_PED_REMOVE_PED_DEFENSIVE_AREA>},
+		{"REMOVE_PED_ELEGANTLY", native_function<LUA_NATIVE_PED_REMOVE_PED_ELEGANTLY>},
+		{"REMOVE_PED_FROM_GROUP", native_function<LUA_NATIVE_PED_REMOVE_PED_FROM_GROUP>},
+		{"REMOVE_PED_HELMET", native_function<LUA_NATIVE_PED_REMOVE_PED_HELMET>},
+		{"REMOVE_PED_PREFERRED_COVER_SET", native_function<LUA_NATIVE_PED_REMOVE_PED_PREFERRED_COVER_SET>},
+		{"REMOVE_RELATIONSHIP_GROUP", native_function<LUA_NATIVE_PED_REMOVE_RELATIONSHIP_GROUP>},
+		{"REMOVE_SCENARIO_BLOCKING_AREA", native_function<LUA_NATIVE_PED_REMOVE_SCENARIO_BLOCKING_AREA>},
+		{"REMOVE_SCENARIO_BLOCKING_AREAS", native_function<LUA_NATIVE_PED_REMOVE_SCENARIO_BLOCKING_AREAS>},
+		{"REMOVE_STEALTH_MODE_ASSET", native_function<LUA_NATIVE_PED_REMOVE_STEALTH_MODE_ASSET>},
+		{"REQUEST_ACTION_MODE_ASSET", native_function<LUA_NATIVE_PED_REQUEST_ACTION_MODE_ASSET>},
+		{"REQUEST_PEDHEADSHOT_IMG_UPLOAD", native_function<LUA_NATIVE_PED_REQUEST_PEDHEADSHOT_IMG_UPLOAD>},
+		{"REQUEST_PED_RESTRICTED_VEHICLE_VISIBILITY_TRACKING", native_function<LUA_NATIVE_PED_REQUEST_PED_RESTRICTED_VEHICLE_VISIBILITY_TRACKING>},
+		{"REQUEST_PED_USE_SMALL_BBOX_VISIBILITY_TRACKING", native_function<LUA_NATIVE_PED_REQUEST_PED_USE_SMALL_BBOX_VISIBILITY_TRACKING>},
+		{"REQUEST_PED_VEHICLE_VISIBILITY_TRACKING", native_function<LUA_NATIVE_PED_REQUEST_PED_VEHICLE_VISIBILITY_TRACKING>},
+		{"REQUEST_PED_VISIBILITY_TRACKING", native_function<LUA_NATIVE_PED_REQUEST_PED_VISIBILITY_TRACKING>},
+		{"REQUEST_RAGDOLL_BOUNDS_UPDATE", native_function<LUA_NATIVE_PED_REQUEST_RAGDOLL_BOUNDS_UPDATE>},
+		{"REQUEST_STEALTH_MODE_ASSET", native_function<LUA_NATIVE_PED_REQUEST_STEALTH_MODE_ASSET>},
+		{"RESET_AI_MELEE_WEAPON_DAMAGE_MODIFIER", native_function<LUA_NATIVE_PED_RESET_AI_MELEE_WEAPON_DAMAGE_MODIFIER>},
+		{"RESET_AI_WEAPON_DAMAGE_MODIFIER", native_function<LUA_NATIVE_PED_RESET_AI_WEAPON_DAMAGE_MODIFIER>},
+		{"RESET_FACIAL_IDLE_ANIM", native_function<LUA_NATIVE_PED_RESET_FACIAL_IDLE_ANIM>},
+		{"RESET_GROUP_FORMATION_DEFAULT_SPACING", native_function<LUA_NATIVE_PED_RESET_GROUP_FORMATION_DEFAULT_SPACING>},
+		{"RESET_PED_IN_VEHICLE_CONTEXT", native_function<LUA_NATIVE_PED_RESET_PED_IN_VEHICLE_CONTEXT>},
+		{"RESET_PED_LAST_VEHICLE", native_function<LUA_NATIVE_PED_RESET_PED_LAST_VEHICLE>},
+		{"RESET_PED_MOVEMENT_CLIPSET", native_function<LUA_NATIVE_PED_RESET_PED_MOVEMENT_CLIPSET>},
+		{"RESET_PED_RAGDOLL_TIMER", native_function<LUA_NATIVE_PED_RESET_PED_RAGDOLL_TIMER>},
+		{"RESET_PED_STRAFE_CLIPSET", native_function<LUA_NATIVE_PED_RESET_PED_STRAFE_CLIPSET>},
+		{"RESET_PED_VISIBLE_DAMAGE", native_function<LUA_NATIVE_PED_RESET_PED_VISIBLE_DAMAGE>},
+		{"RESET_PED_WEAPON_MOVEMENT_CLIPSET", native_function<LUA_NATIVE_PED_RESET_PED_WEAPON_MOVEMENT_CLIPSET>},
+		{"RESURRECT_PED", native_function<LUA_NATIVE_PED_RESURRECT_PED>},
+		{"REVIVE_INJURED_PED", native_function<LUA_NATIVE_PED_REVIVE_INJURED_PED>},
+		{"SET_AI_MELEE_WEAPON_DAMAGE_MODIFIER", native_function<LUA_NATIVE_PED_SET_AI_MELEE_WEAPON_DAMAGE_MODIFIER>},
+		{"SET_AI_WEAPON_DAMAGE_MODIFIER", native_function<LUA_NATIVE_PED_SET_AI_WEAPON_DAMAGE_MODIFIER>},
+		{"SET_ALLOW_LOCKON_TO_PED_IF_FRIENDLY", native_function<LUA_NATIVE_PED_SET_ALLOW_LOCKON_TO_PED_IF_FRIENDLY>},
+		{"SET_ALLOW_STUNT_JUMP_CAMERA", native_function<LUA_NATIVE_PED_SET_ALLOW_STUNT_JUMP_CAMERA>},
+		{"SET_AMBIENT_LAW_PED_ACCURACY_MODIFIER", native_function<LUA_NATIVE_PED_SET_AMBIENT_LAW_PED_ACCURACY_MODIFIER>},
+		{"SET_AMBIENT_PEDS_DROP_MONEY", native_function<LUA_NATIVE_PED_SET_AMBIENT_PEDS_DROP_MONEY>},
+		{"SET_BLOCKING_OF_NON_TEMPORARY_EVENTS", native_function<LUA_NATIVE_PED_SET_BLOCKING_OF_NON_TEMPORARY_EVENTS>},
+		{"SET_BLOCKING_OF_NON_TEMPORARY_EVENTS_FOR_AMBIENT_PEDS_THIS_FRAME", native_function<LUA_NATIVE_PED_SET_BLOCKING_OF_NON_TEMPORARY_EVENTS_FOR_AMBIENT_PEDS_THIS_FRAME>},
+		{"SET_CAN_ATTACK_FRIENDLY", native_function<LUA_NATIVE_PED_SET_CAN_ATTACK_FRIENDLY>},
+		{"SET_COMBAT_FLOAT", native_function<LUA_NATIVE_PED_SET_COMBAT_FLOAT>},
+		{"SET_COP_PERCEPTION_OVERRIDES", native_function<LUA_NATIVE_PED_SET_COP_PERCEPTION_OVERRIDES>},
+		{"SET_CORPSE_RAGDOLL_FRICTION", native_function<LUA_NATIVE_PED_SET_CORPSE_RAGDOLL_FRICTION>},
+		{"SET_CREATE_RANDOM_COPS", native_function<LUA_NATIVE_PED_SET_CREATE_RANDOM_COPS>},
+		{"SET_CREATE_RANDOM_COPS_NOT_ON_SCENARIOS", native_function<LUA_NATIVE_PED_SET_CREATE_RANDOM_COPS_NOT_ON_SCENARIOS>},
+		{"SET_CREATE_RANDOM_COPS_ON_SCENARIOS", native_function<LUA_NATIVE_PED_SET_CREATE_RANDOM_COPS_ON_SCENARIOS>},
+		{"SET_DISABLE_HIGH_FALL_DEATH", native_function<LUA_NATIVE_PED_SET_DISABLE_HIGH_FALL_DEATH>},
+		{"SET_DISABLE_PED_MAP_COLLISION", native_function<LUA_NATIVE_PED_SET_DISABLE_PED_MAP_COLLISION>},
+		{"SET_DRIVER_ABILITY", native_function<LUA_NATIVE_PED_SET_DRIVER_ABILITY>},
+		{"SET_DRIVER_AGGRESSIVENESS", native_function<LUA_NATIVE_PED_SET_DRIVER_AGGRESSIVENESS>},
+		{"SET_DRIVER_RACING_MODIFIER", native_function<LUA_NATIVE_PED_SET_DRIVER_RACING_MODIFIER>},
+		{"SET_ENABLE_BOUND_ANKLES", native_function<LUA_NATIVE_PED_SET_ENABLE_BOUND_ANKLES>},
+		{"SET_ENABLE_HANDCUFFS", native_function<LUA_NATIVE_PED_SET_ENABLE_HANDCUFFS>},
+		{"SET_ENABLE_PED_ENVEFF_SCALE", native_function<LUA_NATIVE_PED_SET_ENABLE_PED_ENVEFF_SCALE>},
+		{"SET_ENABLE_SCUBA", native_function<LUA_NATIVE_PED_SET_ENABLE_SCUBA>},
+		{"SET_FACIAL_CLIPSET", native_function<LUA_NATIVE_PED_SET_FACIAL_CLIPSET>},
+		{"SET_FACIAL_IDLE_ANIM_OVERRIDE", native_function<LUA_NATIVE_PED_SET_FACIAL_IDLE_ANIM_OVERRIDE>},
+		{"SET_FORCE_FOOTSTEP_UPDATE", native_function<LUA_NATIVE_PED_SET_FORCE_FOOTSTEP_UPDATE>},
+		{"SET_FORCE_STEP_TYPE", native_function<LUA_NATIVE_PED_SET_FORCE_STEP_TYPE>},
+		{"SET_GROUP_FORMATION", native_function<LUA_NATIVE_PED_SET_GROUP_FORMATION>},
+		{"SET_GROUP_FORMATION_SPACING", native_function<LUA_NATIVE_PED_SET_GROUP_FORMATION_SPACING>},
+		{"SET_GROUP_SEPARATION_RANGE", native_function<LUA_NATIVE_PED_SET_GROUP_SEPARATION_RANGE>},
+		{"SET_HEAD_BLEND_EYE_COLOR", native_function<LUA_NATIVE_PED_SET_HEAD_BLEND_EYE_COLOR>},
+		{"SET_HEAD_BLEND_PALETTE_COLOR", native_function<LUA_NATIVE_PED_SET_HEAD_BLEND_PALETTE_COLOR>},
+		{"SET_HEALTH_SNACKS_CARRIED_BY_ALL_NEW_PEDS", native_function<LUA_NATIVE_PED_SET_HEALTH_SNACKS_CARRIED_BY_ALL_NEW_PEDS>},
+		{"SET_IK_TARGET", native_function<LUA_NATIVE_PED_SET_IK_TARGET>},
+		{"SET_LADDER_CLIMB_INPUT_STATE", native_function<LUA_NATIVE_PED_SET_LADDER_CLIMB_INPUT_STATE>},
+		{"SET_MOVEMENT_MODE_OVERRIDE", native_function<LUA_NATIVE_PED_SET_MOVEMENT_MODE_OVERRIDE>},
+		{"SET_PED_ACCURACY", native_function<LUA_NATIVE_PED_SET_PED_ACCURACY>},
+		{"SET_PED_ALERTNESS", native_function<LUA_NATIVE_PED_SET_PED_ALERTNESS>},
+		{"SET_PED_ALLOWED_TO_DUCK", native_function<LUA_NATIVE_PED_SET_PED_ALLOWED_TO_DUCK>},
+		{"SET_PED_ALLOW_HURT_COMBAT_FOR_ALL_MISSION_PEDS", native_function<LUA_NATIVE_PED_SET_PED_ALLOW_HURT_COMBAT_FOR_ALL_MISSION_PEDS>},
+		{"SET_PED_ALLOW_MINOR_REACTIONS_AS_MISSION_PED", native_function<LUA_NATIVE_PED_SET_PED_ALLOW_MINOR_REACTIONS_AS_MISSION_PED>},
+		{"SET_PED_ALLOW_VEHICLES_OVERRIDE", native_function<LUA_NATIVE_PED_SET_PED_ALLOW_VEHICLES_OVERRIDE>},
+		{"SET_PED_ALTERNATE_MOVEMENT_ANIM", native_function<LUA_NATIVE_PED_SET_PED_ALTERNATE_MOVEMENT_ANIM>},
+		{"SET_PED_ALTERNATE_WALK_ANIM", native_function<LUA_NATIVE_PED_SET_PED_ALTERNATE_WALK_ANIM>},
+		{"SET_PED_ANGLED_DEFENSIVE_AREA", native_function<LUA_NATIVE_PED_SET_PED_ANGLED_DEFENSIVE_AREA>},
+		{"SET_PED_AO_BLOB_RENDERING", native_function<LUA_NATIVE_PED_SET_PED_AO_BLOB_RENDERING>},
+		{"SET_PED_ARMOUR", native_function<LUA_NATIVE_PED_SET_PED_ARMOUR>},
+		{"SET_PED_AS_COP", native_function<LUA_NATIVE_PED_SET_PED_AS_COP>},
+		{"SET_PED_AS_ENEMY", native_function<LUA_NATIVE_PED_SET_PED_AS_ENEMY>},
+		{"SET_PED_AS_GROUP_LEADER", native_function<LUA_NATIVE_PED_SET_PED_AS_GROUP_LEADER>},
+		{"SET_PED_AS_GROUP_MEMBER", native_function<LUA_NATIVE_PED_SET_PED_AS_GROUP_MEMBER>},
+		{"SET_PED_BLEND_FROM_PARENTS", native_function<LUA_NATIVE_PED_SET_PED_BLEND_FROM_PARENTS>},
+		{"SET_PED_BLOCKS_PATHING_WHEN_DEAD", native_function<LUA_NATIVE_PED_SET_PED_BLOCKS_PATHING_WHEN_DEAD>},
+		{"SET_PED_BOUNDS_ORIENTATION", native_function<LUA_NATIVE_PED_SET_PED_BOUNDS_ORIENTATION>},
+		{"SET_PED_CAN_ARM_IK", native_function<LUA_NATIVE_PED_SET_PED_CAN_ARM_IK>},
+		{"SET_PED_CAN_BE_DRAGGED_OUT", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_DRAGGED_OUT>},
+		{"SET_PED_CAN_BE_KNOCKED_OFF_BIKE", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_KNOCKED_OFF_BIKE>},
+		{"SET_PED_CAN_BE_KNOCKED_OFF_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_KNOCKED_OFF_VEHICLE>},
+		{"SET_PED_CAN_BE_SHOT_IN_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_SHOT_IN_VEHICLE>},
+		{"SET_PED_CAN_BE_TARGETED_WHEN_INJURED", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETED_WHEN_INJURED>},
+		{"SET_PED_CAN_BE_TARGETED_WITHOUT_LOS", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETED_WITHOUT_LOS>},
+		{"SET_PED_CAN_BE_TARGETTED", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETTED>},
+		{"SET_PED_CAN_BE_TARGETTED_BY_PLAYER", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETTED_BY_PLAYER>},
+		{"SET_PED_CAN_BE_TARGETTED_BY_TEAM", native_function<LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETTED_BY_TEAM>},
+		{"SET_PED_CAN_COWER_IN_COVER", native_function<LUA_NATIVE_PED_SET_PED_CAN_COWER_IN_COVER>},
+		{"SET_PED_CAN_EVASIVE_DIVE", native_function<LUA_NATIVE_PED_SET_PED_CAN_EVASIVE_DIVE>},
+		{"SET_PED_CAN_HEAD_IK", native_function<LUA_NATIVE_PED_SET_PED_CAN_HEAD_IK>},
+		{"SET_PED_CAN_LEG_IK", native_function<LUA_NATIVE_PED_SET_PED_CAN_LEG_IK>},
+		{"SET_PED_CAN_LOSE_PROPS_ON_DAMAGE", native_function<LUA_NATIVE_PED_SET_PED_CAN_LOSE_PROPS_ON_DAMAGE>},
+		{"SET_PED_CAN_PEEK_IN_COVER", native_function<LUA_NATIVE_PED_SET_PED_CAN_PEEK_IN_COVER>},
+		{"SET_PED_CAN_PLAY_AMBIENT_ANIMS", native_function<LUA_NATIVE_PED_SET_PED_CAN_PLAY_AMBIENT_ANIMS>},
+		{"SET_PED_CAN_PLAY_AMBIENT_BASE_ANIMS", native_function<LUA_NATIVE_PED_SET_PED_CAN_PLAY_AMBIENT_BASE_ANIMS>},
+		{"SET_PED_CAN_PLAY_GESTURE_ANIMS", native_function<LUA_NATIVE_PED_SET_PED_CAN_PLAY_GESTURE_ANIMS>},
+		{"SET_PED_CAN_PLAY_IN_CAR_IDLES", native_function<LUA_NATIVE_PED_SET_PED_CAN_PLAY_IN_CAR_IDLES>},
+		{"SET_PED_CAN_PLAY_VISEME_ANIMS", native_function<LUA_NATIVE_PED_SET_PED_CAN_PLAY_VISEME_ANIMS>},
+		{"SET_PED_CAN_RAGDOLL", native_function<LUA_NATIVE_PED_SET_PED_CAN_RAGDOLL>},
+		{"SET_PED_CAN_RAGDOLL_FROM_PLAYER_IMPACT", native_function<LUA_NATIVE_PED_SET_PED_CAN_RAGDOLL_FROM_PLAYER_IMPACT>},
+		{"SET_PED_CAN_SMASH_GLASS", native_function<LUA_NATIVE_PED_SET_PED_CAN_SMASH_GLASS>},
+		{"SET_PED_CAN_SWITCH_WEAPON", native_function<LUA_NATIVE_PED_SET_PED_CAN_SWITCH_WEAPON>},
+		{"SET_PED_CAN_TELEPORT_TO_GROUP_LEADER", native_function<LUA_NATIVE_PED_SET_PED_CAN_TELEPORT_TO_GROUP_LEADER>},
+		{"SET_PED_CAN_TORSO_IK", native_function<LUA_NATIVE_PED_SET_PED_CAN_TORSO_IK>},
+		{"SET_PED_CAN_TORSO_REACT_IK", native_function<LUA_NATIVE_PED_SET_PED_CAN_TORSO_REACT_IK>},
+		{"SET_PED_CAN_TORSO_VEHICLE_IK", native_function<LUA_NATIVE_PED_SET_PED_CAN_TORSO_VEHICLE_IK>},
+		{"SET_PED_CAN_USE_AUTO_CONVERSATION_LOOKAT", native_function<LUA_NATIVE_PED_SET_PED_CAN_USE_AUTO_CONVERSATION_LOOKAT>},
+		{"SET_PED_CAPSULE", native_function<LUA_NATIVE_PED_SET_PED_CAPSULE>},
+		{"SET_PED_CLOTH_PACKAGE_INDEX", native_function<LUA_NATIVE_PED_SET_PED_CLOTH_PACKAGE_INDEX>},
+		{"SET_PED_CLOTH_PIN_FRAMES", native_function<LUA_NATIVE_PED_SET_PED_CLOTH_PIN_FRAMES>},
+		{"SET_PED_CLOTH_PRONE", native_function<LUA_NATIVE_PED_SET_PED_CLOTH_PRONE>},
+		{"SET_PED_COMBAT_ABILITY", native_function<LUA_NATIVE_PED_SET_PED_COMBAT_ABILITY>},
+		{"SET_PED_COMBAT_ATTRIBUTES", native_function<LUA_NATIVE_PED_SET_PED_COMBAT_ATTRIBUTES>},
+		{"SET_PED_COMBAT_MOVEMENT", native_function<LUA_NATIVE_PED_SET_PED_COMBAT_MOVEMENT>},
+		{"SET_PED_COMBAT_RANGE", native_function<LUA_NATIVE_PED_SET_PED_COMBAT_RANGE>},
+		{"SET_PED_COMPONENT_VARIATION", native_function<LUA_NATIVE_PED_SET_PED_COMPONENT_VARIATION>},
+		{"SET_PED_CONFIG_FLAG", native_function<LUA_NATIVE_PED_SET_PED_CONFIG_FLAG>},
+		{"SET_PED_COORDS_KEEP_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_COORDS_KEEP_VEHICLE>},
+		{"SET_PED_COORDS_NO_GANG", native_function<LUA_NATIVE_PED_SET_PED_COORDS_NO_GANG>},
+		{"SET_PED_COWER_HASH", native_function<LUA_NATIVE_PED_SET_PED_COWER_HASH>},
+		{"SET_PED_DEFAULT_COMPONENT_VARIATION", native_function<LUA_NATIVE_PED_SET_PED_DEFAULT_COMPONENT_VARIATION>},
+		{"SET_PED_DEFENSIVE_AREA_ATTACHED_TO_PED", native_function<LUA_NATIVE_PED_SET_PED_DEFENSIVE_AREA_ATTACHED_TO_PED>},
+		{"SET_PED_DEFENSIVE_AREA_DIRECTION", native_function<LUA_NATIVE_PED_SET_PED_DEFENSIVE_AREA_DIRECTION>},
+		{"SET_PED_DEFENSIVE_SPHERE_ATTACHED_TO_PED", native_function<LUA_NATIVE_PED_SET_PED_DEFENSIVE_SPHERE_ATTACHED_TO_PED>},
+		{"SET_PED_DEFENSIVE_SPHERE_ATTACHED_TO_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_DEFENSIVE_SPHERE_ATTACHED_TO_VEHICLE>},
+		{"SET_PED_DENSITY_MULTIPLIER_THIS_FRAME", native_function<LUA_NATIVE_PED_SET_PED_DENSITY_MULTIPLIER_THIS_FRAME>},
+		{"SET_PED_DESIRED_HEADING", native_function<LUA_NATIVE_PED_SET_PED_DESIRED_HEADING>},
+		{"SET_PED_DIES_INSTANTLY_IN_WATER", native_function<LUA_NATIVE_PED_SET_PED_DIES_INSTANTLY_IN_WATER>},
+		{"SET_PED_DIES_IN_SINKING_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_DIES_IN_SINKING_VEHICLE>},
+		{"SET_PED_DIES_IN_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_DIES_IN_VEHICLE>},
+		{"SET_PED_DIES_IN_WATER", native_function<LUA_NATIVE_PED_SET_PED_DIES_IN_WATER>},
+		{"SET_PED_DIES_WHEN_INJURED", native_function<LUA_NATIVE_PED_SET_PED_DIES_WHEN_INJURED>},
+		{"SET_PED_DRIVE_BY_CLIPSET_OVERRIDE", native_function<LUA_NATIVE_PED_SET_PED_DRIVE_BY_CLIPSET_OVERRIDE>},
+		{"SET_PED_DUCKING", native_function<LUA_NATIVE_PED_SET_PED_DUCKING>},
+		{"SET_PED_EMISSIVE_SCALE", native_function<LUA_NATIVE_PED_SET_PED_EMISSIVE_SCALE>},
+		{"SET_PED_ENABLE_CREW_EMBLEM", native_function<LUA_NATIVE_PED_SET_PED_ENABLE_CREW_EMBLEM>},
+		{"SET_PED_ENABLE_WEAPON_BLOCKING", native_function<LUA_NATIVE_PED_SET_PED_ENABLE_WEAPON_BLOCKING>},
+		{"SET_PED_ENVEFF_COLOR_MODULATOR", native_function<LUA_NATIVE_PED_SET_PED_ENVEFF_COLOR_MODULATOR>},
+		{"SET_PED_ENVEFF_CPV_ADD", native_function<LUA_NATIVE_PED_SET_PED_ENVEFF_CPV_ADD>},
+		{"SET_PED_ENVEFF_SCALE", native_function<LUA_NATIVE_PED_SET_PED_ENVEFF_SCALE>},
+		{"SET_PED_FIRING_PATTERN", native_function<LUA_NATIVE_PED_SET_PED_FIRING_PATTERN>},
+		{"SET_PED_FLEE_ATTRIBUTES", native_function<LUA_NATIVE_PED_SET_PED_FLEE_ATTRIBUTES>},
+		{"SET_PED_GENERATES_DEAD_BODY_EVENTS", native_function<LUA_NATIVE_PED_SET_PED_GENERATES_DEAD_BODY_EVENTS>},
+		{"SET_PED_GESTURE_GROUP", native_function<LUA_NATIVE_PED_SET_PED_GESTURE_GROUP>},
+		{"SET_PED_GET_OUT_UPSIDE_DOWN_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_GET_OUT_UPSIDE_DOWN_VEHICLE>},
+		{"SET_PED_GRAVITY", native_function<LUA_NATIVE_PED_SET_PED_GRAVITY>},
+		{"SET_PED_GROUP_MEMBER_PASSENGER_INDEX", native_function<LUA_NATIVE_PED_SET_PED_GROUP_MEMBER_PASSENGER_INDEX>},
+		{"SET_PED_HAIR_TINT", native_function<LUA_NATIVE_PED_SET_PED_HAIR_TINT>},
+		{"SET_PED_HEAD_BLEND_DATA", native_function<LUA_NATIVE_PED_SET_PED_HEAD_BLEND_DATA>},
+		{"SET_PED_HEAD_OVERLAY", native_function<LUA_NATIVE_PED_SET_PED_HEAD_OVERLAY>},
+		{"SET_PED_HEAD_OVERLAY_TINT", native_function<LUA_NATIVE_PED_SET_PED_HEAD_OVERLAY_TINT>},
+		{"SET_PED_HEALTH_PENDING_LAST_DAMAGE_EVENT_OVERRIDE_FLAG", native_function<LUA_NATIVE_PED_SET_PED_HEALTH_PENDING_LAST_DAMAGE_EVENT_OVERRIDE_FLAG>},
+		{"SET_PED_HEARING_RANGE", native_function<LUA_NATIVE_PED_SET_PED_HEARING_RANGE>},
+		{"SET_PED_HEATSCALE_OVERRIDE", native_function<LUA_NATIVE_PED_SET_PED_HEATSCALE_OVERRIDE>},
+		{"SET_PED_HELMET", native_function<LUA_NATIVE_PED_SET_PED_HELMET>},
+		{"SET_PED_HELMET_FLAG", native_function<LUA_NATIVE_PED_SET_PED_HELMET_FLAG>},
+		{"SET_PED_HELMET_PROP_INDEX", native_function<LUA_NATIVE_PED_SET_PED_HELMET_PROP_INDEX>},
+		{"SET_PED_HELMET_TEXTURE_INDEX", native_function<LUA_NATIVE_PED_SET_PED_HELMET_TEXTURE_INDEX>},
+		{"SET_PED_HELMET_VISOR_PROP_INDICES", native_function<LUA_NATIVE_PED_SET_PED_HELMET_VISOR_PROP_INDICES>},
+		{"SET_PED_HIGHLY_PERCEPTIVE", native_function<LUA_NATIVE_PED_SET_PED_HIGHLY_PERCEPTIVE>},
+		{"SET_PED_ID_RANGE", native_function<LUA_NATIVE_PED_SET_PED_ID_RANGE>},
+		{"SET_PED_INCREASED_AVOIDANCE_RADIUS", native_function<LUA_NATIVE_PED_SET_PED_INCREASED_AVOIDANCE_RADIUS>},
+		{"SET_PED_INJURED_ON_GROUND_BEHAVIOUR", native_function<LUA_NATIVE_PED_SET_PED_INJURED_ON_GROUND_BEHAVIOUR>},
+		{"SET_PED_INTO_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_INTO_VEHICLE>},
+		{"SET_PED_IN_VEHICLE_CONTEXT", native_function<LUA_NATIVE_PED_SET_PED_IN_VEHICLE_CONTEXT>},
+		{"SET_PED_IS_AVOIDED_BY_OTHERS", native_function<LUA_NATIVE_PED_SET_PED_IS_AVOIDED_BY_OTHERS>},
+		{"SET_PED_IS_IGNORED_BY_AUTO_OPEN_DOORS", native_function<LUA_NATIVE_PED_SET_PED_IS_IGNORED_BY_AUTO_OPEN_DOORS>},
+		{"SET_PED_KEEP_TASK", native_function<LUA_NATIVE_PED_SET_PED_KEEP_TASK>},
+		{"SET_PED_LEG_IK_MODE", native_function<LUA_NATIVE_PED_SET_PED_LEG_IK_MODE>},
+		{"SET_PED_LOD_MULTIPLIER", native_function<LUA_NATIVE_PED_SET_PED_LOD_MULTIPLIER>},
+		{"SET_PED_MAX_HEALTH", native_function<LUA_NATIVE_PED_SET_PED_MAX_HEALTH>},
+		{"SET_PED_MAX_MOVE_BLEND_RATIO", native_function<LUA_NATIVE_PED_SET_PED_MAX_MOVE_BLEND_RATIO>},
+		{"SET_PED_MAX_TIME_IN_WATER", native_function<LUA_NATIVE_PED_SET_PED_MAX_TIME_IN_WATER>},
+		{"SET_PED_MAX_TIME_UNDERWATER", native_function<LUA_NATIVE_PED_SET_PED_MAX_TIME_UNDERWATER>},
+		{"SET_PED_MICRO_MORPH", native_function<LUA_NATIVE_PED_SET_PED_MICRO_MORPH>},
+		{"SET_PED_MIN_GROUND_TIME_FOR_STUNGUN", native_function<LUA_NATIVE_PED_SET_PED_MIN_GROUND_TIME_FOR_STUNGUN>},
+		{"SET_PED_MIN_MOVE_BLEND_RATIO", native_function<LUA_NATIVE_PED_SET_PED_MIN_MOVE_BLEND_RATIO>},
+		{"SET_PED_MODEL_IS_SUPPRESSED", native_function<LUA_NATIVE_PED_SET_PED_MODEL_IS_SUPPRESSED>},
+		{"SET_PED_MONEY", native_function<LUA_NATIVE_PED_SET_PED_MONEY>},
+		{"SET_PED_MOTION_BLUR", native_function<LUA_NATIVE_PED_SET_PED_MOTION_BLUR>},
+		{"SET_PED_MOTION_IN_COVER_CLIPSET_OVERRIDE", native_function<LUA_NATIVE_PED_SET_PED_MOTION_IN_COVER_CLIPSET_OVERRIDE>},
+		{"SET_PED_MOVEMENT_CLIPSET", native_function<LUA_NATIVE_PED_SET_PED_MOVEMENT_CLIPSET>},
+		{"SET_PED_MOVE_ANIMS_BLEND_OUT", native_function<LUA_NATIVE_PED_SET_PED_MOVE_ANIMS_BLEND_OUT>},
+		{"SET_PED_MOVE_RATE_IN_WATER_OVERRIDE", native_function<LUA_NATIVE_PED_SET_PED_MOVE_RATE_IN_WATER_OVERRIDE>},
+		{"SET_PED_MOVE_RATE_OVERRIDE", native_function<LUA_NATIVE_PED_SET_PED_MOVE_RATE_OVERRIDE>},
+		{"SET_PED_NAME_DEBUG", native_function<LUA_NATIVE_PED_SET_PED_NAME_DEBUG>},
+		{"SET_PED_NEVER_LEAVES_GROUP", native_function<LUA_NATIVE_PED_SET_PED_NEVER_LEAVES_GROUP>},
+		{"SET_PED_NON_CREATION_AREA", native_function<LUA_NATIVE_PED_SET_PED_NON_CREATION_AREA>},
+		{"SET_PED_NO_TIME_DELAY_BEFORE_SHOT", native_function<LUA_NATIVE_PED_SET_PED_NO_TIME_DELAY_BEFORE_SHOT>},
+		{"SET_PED_PANIC_EXIT_SCENARIO", native_function<LUA_NATIVE_PED_SET_PED_PANIC_EXIT_SCENARIO>},
+		{"SET_PED_PARACHUTE_TINT_INDEX", native_function<LUA_NATIVE_PED_SET_PED_PARACHUTE_TINT_INDEX>},
+		{"SET_PED_PHONE_PALETTE_IDX", native_function<LUA_NATIVE_PED_SET_PED_PHONE_PALETTE_IDX>},
+		{"SET_PED_PINNED_DOWN", native_function<LUA_NATIVE_PED_SET_PED_PINNED_DOWN>},
+		{"SET_PED_PLAYS_HEAD_ON_HORN_ANIM_WHEN_DIES_IN_VEHICLE", native_function<LUA_NATIVE_PED_SET_PED_PLAYS_HEAD_ON_HORN_ANIM_WHEN_DIES_IN_VEHICLE>},
+		{"SET_PED_PREFERRED_COVER_SET", native_function<LUA_NATIVE_PED_SET_PED_PREFERRED_COVER_SET>},
+		{"SET_PED_PRELOAD_PROP_DATA", native_function<LUA_NATIVE_PED_SET_PED_PRELOAD_PROP_DATA>},
+		{"SET_PED_PRELOAD_VARIATION_DATA", native_function<LUA_NATIVE_PED_SET_PED_PRELOAD_VARIATION_DATA>},
+		{"SET_PED_PRIMARY_LOOKAT", native_function<LUA_NATIVE_PED_SET_PED_PRIMARY_LOOKAT>},
+		{"SET_PED_PROP_INDEX", native_function<LUA_NATIVE_PED_SET_PED_PROP_INDEX>},
+		{"SET_PED_RAGDOLL_FORCE_FALL", native_function<LUA_NATIVE_PED_SET_PED_RAGDOLL_FORCE_FALL>},
+		{"SET_PED_RAGDOLL_ON_COLLISION", native_function<LUA_NATIVE_PED_SET_PED_RAGDOLL_ON_COLLISION>},
+		{"SET_PED_RANDOM_COMPONENT_VARIATION", native_function<LUA_NATIVE_PED_SET_PED_RANDOM_COMPONENT_VARIATION>},
+		{"SET_PED_RANDOM_PROPS", native_function<LUA_NATIVE_PED_SET_PED_RANDOM_PROPS>},
+		{"SET_PED_RELATIONSHIP_GROUP_DEFAULT_HASH", native_function<LUA_NATIVE_PED_SET_PED_RELATIONSHIP_GROUP_DEFAULT_HASH>},
+		{"SET_PED_RELATIONSHIP_GROUP_HASH", native_function<LUA_NATIVE_PED_SET_PED_RELATIONSHIP_GROUP_HASH>},
+		{"SET_PED_RESERVE_PARACHUTE_TINT_INDEX", native_function<LUA_NATIVE_PED_SET_PED_RESERVE_PARACHUTE_TINT_INDEX>},
+		{"SET_PED_RESET_FLAG", native_function<LUA_NATIVE_PED_SET_PED_RESET_FLAG>},
+		{"SET_PED_SCUBA_GEAR_VARIATION", native_function<LUA_NATIVE_PED_SET_PED_SCUBA_GEAR_VARIATION>},
+		{"SET_PED_SEEING_RANGE", native_function<LUA_NATIVE_PED_SET_PED_SEEING_RANGE>},
+		{"SET_PED_SHOOTS_AT_COORD", native_function<LUA_NATIVE_PED_SET_PED_SHOOTS_AT_COORD>},
+		{"SET_PED_SHOOT_RATE", native_function<LUA_NATIVE_PED_SET_PED_SHOOT_RATE>},
+		{"SET_PED_SHOULD_IGNORE_SCENARIO_EXIT_COLLISION_CHECKS", native_function<LUA_NATIVE_PED_SET_PED_SHOULD_IGNORE_SCENARIO_EXIT_COLLISION_CHECKS>},
+		{"SET_PED_SHOULD_IGNORE_SCENARIO_NAV_CHECKS", native_function<LUA_NATIVE_PED_SET_PED_SHOULD_IGNORE_SCENARIO_NAV_CHECKS>},
+		{"SET_PED_SHOULD_PLAY_DIRECTED_NORMAL_SCENARIO_EXIT", native_function<LUA_NATIVE_PED_SET_PED_SHOULD_PLAY_DIRECTED_NORMAL_SCENARIO_EXIT>},
+		{"SET_PED_SHOULD_PLAY_FLEE_SCENARIO_EXIT", native_function<LUA_NATIVE_PED_SET_PED_SHOULD_PLAY_FLEE_SCENARIO_EXIT>},
+		{"SET_PED_SHOULD_PLAY_IMMEDIATE_SCENARIO_EXIT", native_function<LUA_NATIVE_PED_SET_PED_SHOULD_PLAY_IMMEDIATE_SCENARIO_EXIT>},
+		{"SET_PED_SHOULD_PLAY_NORMAL_SCENARIO_EXIT", native_function<LUA_NATIVE_PED_SET_PED_SHOULD_PLAY_NORMAL_SCENARIO_EXIT>},
+		{"SET_PED_SHOULD_PROBE_FOR_SCENARIO_EXITS_IN_ONE_FRAME", native_function<LUA_NATIVE_PED_SET_PED_SHOULD_PROBE_FOR_SCENARIO_EXITS_IN_ONE_FRAME>},
+		{"SET_PED_SPHERE_DEFENSIVE_AREA", native_function<LUA_NATIVE_PED_SET_PED_SPHERE_DEFENSIVE_AREA>},
+		{"SET_PED_STAY_IN_VEHICLE_WHEN_JACKED", native_function<LUA_NATIVE_PED_SET_PED_STAY_IN_VEHICLE_WHEN_JACKED>},
+		{"SET_PED_STEALTH_MOVEMENT", native_function<LUA_NATIVE_PED_SET_PED_STEALTH_MOVEMENT>},
+		{"SET_PED_STEERS_AROUND_DEAD_BODIES", native_function<LUA_NATIVE_PED_SET_PED_STEERS_AROUND_DEAD_BODIES>},
+		{"SET_PED_STEERS_AROUND_OBJECTS", native_function<LUA_NATIVE_PED_SET_PED_STEERS_AROUND_OBJECTS>},
+		{"SET_PED_STEERS_AROUND_PEDS", native_function<LUA_NATIVE_PED_SET_PED_STEERS_AROUND_PEDS>},
+		{"SET_PED_STEERS_AROUND_VEHICLES", native_function<LUA_NATIVE_PED_SET_PED_STEERS_AROUND_VEHICLES>},
+		{"SET_PED_STEER_BIAS", native_function<LUA_NATIVE_PED_SET_PED_STEER_BIAS>},
+		{"SET_PED_STRAFE_CLIPSET", native_function<LUA_NATIVE_PED_SET_PED_STRAFE_CLIPSET>},
+		{"SET_PED_SUFFERS_CRITICAL_HITS", native_function<LUA_NATIVE_PED_SET_PED_SUFFERS_CRITICAL_HITS>},
+		{"SET_PED_SWEAT", native_function<LUA_NATIVE_PED_SET_PED_SWEAT>},
+		{"SET_PED_TARGET_LOSS_RESPONSE", native_function<LUA_NATIVE_PED_SET_PED_TARGET_LOSS_RESPONSE>},
+		{"SET_PED_TO_INFORM_RESPECTED_FRIENDS", native_function<LUA_NATIVE_PED_SET_PED_TO_INFORM_RESPECTED_FRIENDS>},
+		{"SET_PED_TO_LOAD_COVER", native_function<LUA_NATIVE_PED_SET_PED_TO_LOAD_COVER>},
+		{"SET_PED_TO_RAGDOLL", native_function<LUA_NATIVE_PED_SET_PED_TO_RAGDOLL>},
+		{"SET_PED_TO_RAGDOLL_WITH_FALL", native_function<LUA_NATIVE_PED_SET_PED_TO_RAGDOLL_WITH_FALL>},
+		{"SET_PED_TREATED_AS_FRIENDLY", native_function<LUA_NATIVE_PED_SET_PED_TREATED_AS_FRIENDLY>},
+		{"SET_PED_UPPER_BODY_DAMAGE_ONLY", native_function<LUA_NATIVE_PED_SET_PED_UPPER_BODY_DAMAGE_ONLY>},
+		{"SET_PED_USING_ACTION_MODE", native_function<LUA_NATIVE_PED_SET_PED_USING_ACTION_MODE>},
+		{"SET_PED_VEHICLE_FORCED_SEAT_USAGE", native_function<LUA_NATIVE_PED_SET_PED_VEHICLE_FORCED_SEAT_USAGE>},
+		{"SET_PED_VISUAL_FIELD_CENTER_ANGLE", native_function<LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_CENTER_ANGLE>},
+		{"SET_PED_VISUAL_FIELD_MAX_ANGLE", native_function<LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_MAX_ANGLE>},
+		{"SET_PED_VISUAL_FIELD_MAX_ELEVATION_ANGLE", native_function<LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_MAX_ELEVATION_ANGLE>},
+		{"SET_PED_VISUAL_FIELD_MIN_ANGLE", native_function<LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_MIN_ANGLE>},
+		{"SET_PED_VISUAL_FIELD_MIN_ELEVATION_ANGLE", native_function<LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_MIN_ELEVATION_ANGLE>},
+		{"SET_PED_VISUAL_FIELD_PERIPHERAL_RANGE", native_function<LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_PERIPHERAL_RANGE>},
+		{"SET_PED_WEAPON_MOVEMENT_CLIPSET", native_function<LUA_NATIVE_PED_SET_PED_WEAPON_MOVEMENT_CLIPSET>},
+		{"SET_PED_WETNESS", native_function<LUA_NATIVE_PED_SET_PED_WETNESS>},
+		{"SET_PED_WETNESS_ENABLED_THIS_FRAME", native_function<LUA_NATIVE_PED_SET_PED_WETNESS_ENABLED_THIS_FRAME>},
+		{"SET_PED_WETNESS_HEIGHT", native_function<LUA_NATIVE_PED_SET_PED_WETNESS_HEIGHT>},
+		{"SET_PED_WILL_ONLY_ATTACK_WANTED_PLAYER", native_function<LUA_NATIVE_PED_SET_PED_WILL_ONLY_ATTACK_WANTED_PLAYER>},
+		{"SET_POP_CONTROL_SPHERE_THIS_FRAME", native_function<LUA_NATIVE_PED_SET_POP_CONTROL_SPHERE_THIS_FRAME>},
+		{"SET_RAGDOLL_BLOCKING_FLAGS", native_function<LUA_NATIVE_PED_SET_RAGDOLL_BLOCKING_FLAGS>},
+		{"SET_RELATIONSHIP_BETWEEN_GROUPS", native_function<LUA_NATIVE_PED_SET_RELATIONSHIP_BETWEEN_GROUPS>},
+		{"SET_RELATIONSHIP_GROUP_AFFECTS_WANTED_LEVEL", native_function<LUA_NATIVE_PED_SET_RELATIONSHIP_GROUP_AFFECTS_WANTED_LEVEL>},
+		{"SET_SCENARIO_PEDS_SPAWN_IN_SPHERE_AREA", native_function<LUA_NATIVE_PED_SET_SCENARIO_PEDS_SPAWN_IN_SPHERE_AREA>},
+		{"SET_SCENARIO_PEDS_TO_BE_RETURNED_BY_NEXT_COMMAND", native_function<LUA_NATIVE_PED_SET_SCENARIO_PEDS_TO_BE_RETURNED_BY_NEXT_COMMAND>},
+		{"SET_SCENARIO_PED_DENSITY_MULTIPLIER_THIS_FRAME", native_function<LUA_NATIVE_PED_SET_SCENARIO_PED_DENSITY_MULTIPLIER_THIS_FRAME>},
+		{"SET_SCRIPTED_ANIM_SEAT_OFFSET", native_function<LUA_NATIVE_PED_SET_SCRIPTED_ANIM_SEAT_OFFSET>},
+		{"SET_SCRIPTED_CONVERSION_COORD_THIS_FRAME", native_function<LUA_NATIVE_PED_SET_SCRIPTED_CONVERSION_COORD_THIS_FRAME>},
+		{"SET_SYNCHRONIZED_SCENE_HOLD_LAST_FRAME", native_function<LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_HOLD_LAST_FRAME>},
+		{"SET_SYNCHRONIZED_SCENE_LOOPED", native_function<LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_LOOPED>},
+		{"SET_SYNCHRONIZED_SCENE_ORIGIN", native_function<LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_ORIGIN>},
+		{"SET_SYNCHRONIZED_SCENE_PHASE", native_function<LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_PHASE>},
+		{"SET_SYNCHRONIZED_SCENE_RATE", native_function<LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_RATE>},
+		{"SET_TREAT_AS_AMBIENT_PED_FOR_DRIVER_LOCKON", native_function<LUA_NATIVE_PED_SET_TREAT_AS_AMBIENT_PED_FOR_DRIVER_LOCKON>},
+		{"SET_USE_CAMERA_HEADING_FOR_DESIRED_DIRECTION_LOCK_ON_TEST", native_function<LUA_NATIVE_PED_SET_USE_CAMERA_HEADING_FOR_DESIRED_DIRECTION_LOCK_ON_TEST>},
+		{"SPAWNPOINTS_CANCEL_SEARCH", native_function<LUA_NATIVE_PED_SPAWNPOINTS_CANCEL_SEARCH>},
+		{"SPAWNPOINTS_GET_NUM_SEARCH_RESULTS", native_function<LUA_NATIVE_PED_SPAWNPOINTS_GET_NUM_SEARCH_RESULTS>},
+		{"SPAWNPOINTS_GET_SEARCH_RESULT", native_function<LUA_NATIVE_PED_SPAWNPOINTS_GET_SEARCH_RESULT>},
+		{"SPAWNPOINTS_GET_SEARCH_RESULT_FLAGS", native_function<LUA_NATIVE_PED_SPAWNPOINTS_GET_SEARCH_RESULT_FLAGS>},
+		{"SPAWNPOINTS_IS_SEARCH_ACTIVE", native_function<LUA_NATIVE_PED_SPAWNPOINTS_IS_SEARCH_ACTIVE>},
+		{"SPAWNPOINTS_IS_SEARCH_COMPLETE", native_function<LUA_NATIVE_PED_SPAWNPOINTS_IS_SEARCH_COMPLETE>},
+		{"SPAWNPOINTS_IS_SEARCH_FAILED", native_function<LUA_NATIVE_PED_SPAWNPOINTS_IS_SEARCH_FAILED>},
+		{"SPAWNPOINTS_START_SEARCH", native_function<LUA_NATIVE_PED_SPAWNPOINTS_START_SEARCH>},
+		{"SPAWNPOINTS_START_SEARCH_IN_ANGLED_AREA", native_function<LUA_NATIVE_PED_SPAWNPOINTS_START_SEARCH_IN_ANGLED_AREA>},
+		{"SPECIAL_FUNCTION_DO_NOT_USE", native_function<LUA_NATIVE_PED_SPECIAL_FUNCTION_DO_NOT_USE>},
+		{"STOP_ANY_PED_MODEL_BEING_SUPPRESSED", native_function<LUA_NATIVE_PED_STOP_ANY_PED_MODEL_BEING_SUPPRESSED>},
+		{"STOP_PED_WEAPON_FIRING_WHEN_DROPPED", native_function<LUA_NATIVE_PED_STOP_PED_WEAPON_FIRING_WHEN_DROPPED>},
+		{"SUPPRESS_AMBIENT_PED_AGGRESSIVE_CLEANUP_THIS_FRAME", native_function<LUA_NATIVE_PED_SUPPRESS_AMBIENT_PED_AGGRESSIVE_CLEANUP_THIS_FRAME>},
+		{"TAKE_OWNERSHIP_OF_SYNCHRONIZED_SCENE", native_function<LUA_NATIVE_PED_TAKE_OWNERSHIP_OF_SYNCHRONIZED_SCENE>},
+		{"TELL_GROUP_PEDS_IN_AREA_TO_ATTACK", native_function<LUA_NATIVE_PED_TELL_GROUP_PEDS_IN_AREA_TO_ATTACK>},
+		{"TOGGLE_SCENARIO_PED_COWER_IN_PLACE", native_function<LUA_NATIVE_PED_TOGGLE_SCENARIO_PED_COWER_IN_PLACE>},
+		{"TRIGGER_IDLE_ANIMATION_ON_PED", native_function<LUA_NATIVE_PED_TRIGGER_IDLE_ANIMATION_ON_PED>},
+		{"TRIGGER_PED_SCENARIO_PANICEXITTOFLEE", native_function<LUA_NATIVE_PED_TRIGGER_PED_SCENARIO_PANICEXITTOFLEE>},
+		{"UNREGISTER_PEDHEADSHOT", native_function<LUA_NATIVE_PED_UNREGISTER_PEDHEADSHOT>},
+		{"UPDATE_PED_HEAD_BLEND_DATA", native_function<LUA_NATIVE_PED_UPDATE_PED_HEAD_BLEND_DATA>},
+		{"WAS_PED_KILLED_BY_STEALTH", native_function<LUA_NATIVE_PED_WAS_PED_KILLED_BY_STEALTH>},
+		{"WAS_PED_KILLED_BY_TAKEDOWN", native_function<LUA_NATIVE_PED_WAS_PED_KILLED_BY_TAKEDOWN>},
+		{"WAS_PED_KNOCKED_OUT", native_function<LUA_NATIVE_PED_WAS_PED_KNOCKED_OUT>},
+		{"WAS_PED_SKELETON_UPDATED", native_function<LUA_NATIVE_PED_WAS_PED_SKELETON_UPDATED>},
+	};
+
 	void init_native_binding_PED(sol::state& L)
 	{
-		auto PED = L["PED"].get_or_create<sol::table>();
-		PED.set_function("CREATE_PED", LUA_NATIVE_PED_CREATE_PED);
-		PED.set_function("DELETE_PED", LUA_NATIVE_PED_DELETE_PED);
-		PED.set_function("CLONE_PED", LUA_NATIVE_PED_CLONE_PED);
-		PED.set_function("CLONE_PED_ALT", LUA_NATIVE_PED_CLONE_PED_ALT);
-		PED.set_function("CLONE_PED_TO_TARGET", LUA_NATIVE_PED_CLONE_PED_TO_TARGET);
-		PED.set_function("CLONE_PED_TO_TARGET_ALT", LUA_NATIVE_PED_CLONE_PED_TO_TARGET_ALT);
-		PED.set_function("IS_PED_IN_VEHICLE", LUA_NATIVE_PED_IS_PED_IN_VEHICLE);
-		PED.set_function("IS_PED_IN_MODEL", LUA_NATIVE_PED_IS_PED_IN_MODEL);
-		PED.set_function("IS_PED_IN_ANY_VEHICLE", LUA_NATIVE_PED_IS_PED_IN_ANY_VEHICLE);
-		PED.set_function("IS_COP_PED_IN_AREA_3D", LUA_NATIVE_PED_IS_COP_PED_IN_AREA_3D);
-		PED.set_function("IS_PED_INJURED", LUA_NATIVE_PED_IS_PED_INJURED);
-		PED.set_function("IS_PED_HURT", LUA_NATIVE_PED_IS_PED_HURT);
-		PED.set_function("IS_PED_FATALLY_INJURED", LUA_NATIVE_PED_IS_PED_FATALLY_INJURED);
-		PED.set_function("IS_PED_DEAD_OR_DYING", LUA_NATIVE_PED_IS_PED_DEAD_OR_DYING);
-		PED.set_function("IS_CONVERSATION_PED_DEAD", LUA_NATIVE_PED_IS_CONVERSATION_PED_DEAD);
-		PED.set_function("IS_PED_AIMING_FROM_COVER", LUA_NATIVE_PED_IS_PED_AIMING_FROM_COVER);
-		PED.set_function("IS_PED_RELOADING", LUA_NATIVE_PED_IS_PED_RELOADING);
-		PED.set_function("IS_PED_A_PLAYER", LUA_NATIVE_PED_IS_PED_A_PLAYER);
-		PED.set_function("CREATE_PED_INSIDE_VEHICLE", LUA_NATIVE_PED_CREATE_PED_INSIDE_VEHICLE);
-		PED.set_function("SET_PED_DESIRED_HEADING", LUA_NATIVE_PED_SET_PED_DESIRED_HEADING);
-		PED.set_function("FORCE_ALL_HEADING_VALUES_TO_ALIGN", LUA_NATIVE_PED_FORCE_ALL_HEADING_VALUES_TO_ALIGN);
-		PED.set_function("IS_PED_FACING_PED", LUA_NATIVE_PED_IS_PED_FACING_PED);
-		PED.set_function("IS_PED_IN_MELEE_COMBAT", LUA_NATIVE_PED_IS_PED_IN_MELEE_COMBAT);
-		PED.set_function("IS_PED_STOPPED", LUA_NATIVE_PED_IS_PED_STOPPED);
-		PED.set_function("IS_PED_SHOOTING_IN_AREA", LUA_NATIVE_PED_IS_PED_SHOOTING_IN_AREA);
-		PED.set_function("IS_ANY_PED_SHOOTING_IN_AREA", LUA_NATIVE_PED_IS_ANY_PED_SHOOTING_IN_AREA);
-		PED.set_function("IS_PED_SHOOTING", LUA_NATIVE_PED_IS_PED_SHOOTING);
-		PED.set_function("SET_PED_ACCURACY", LUA_NATIVE_PED_SET_PED_ACCURACY);
-		PED.set_function("GET_PED_ACCURACY", LUA_NATIVE_PED_GET_PED_ACCURACY);
-		PED.set_function("SET_AMBIENT_LAW_PED_ACCURACY_MODIFIER", LUA_NATIVE_PED_SET_AMBIENT_LAW_PED_ACCURACY_MODIFIER);
-		PED.set_function("IS_PED_MODEL", LUA_NATIVE_PED_IS_PED_MODEL);
-		PED.set_function("EXPLODE_PED_HEAD", LUA_NATIVE_PED_EXPLODE_PED_HEAD);
-		PED.set_function("REMOVE_PED_ELEGANTLY", LUA_NATIVE_PED_REMOVE_PED_ELEGANTLY);
-		PED.set_function("ADD_ARMOUR_TO_PED", LUA_NATIVE_PED_ADD_ARMOUR_TO_PED);
-		PED.set_function("SET_PED_ARMOUR", LUA_NATIVE_PED_SET_PED_ARMOUR);
-		PED.set_function("SET_PED_INTO_VEHICLE", LUA_NATIVE_PED_SET_PED_INTO_VEHICLE);
-		PED.set_function("SET_PED_ALLOW_VEHICLES_OVERRIDE", LUA_NATIVE_PED_SET_PED_ALLOW_VEHICLES_OVERRIDE);
-		PED.set_function("CAN_CREATE_RANDOM_PED", LUA_NATIVE_PED_CAN_CREATE_RANDOM_PED);
-		PED.set_function("CREATE_RANDOM_PED", LUA_NATIVE_PED_CREATE_RANDOM_PED);
-		PED.set_function("CREATE_RANDOM_PED_AS_DRIVER", LUA_NATIVE_PED_CREATE_RANDOM_PED_AS_DRIVER);
-		PED.set_function("CAN_CREATE_RANDOM_DRIVER", LUA_NATIVE_PED_CAN_CREATE_RANDOM_DRIVER);
-		PED.set_function("CAN_CREATE_RANDOM_BIKE_RIDER", LUA_NATIVE_PED_CAN_CREATE_RANDOM_BIKE_RIDER);
-		PED.set_function("SET_PED_MOVE_ANIMS_BLEND_OUT", LUA_NATIVE_PED_SET_PED_MOVE_ANIMS_BLEND_OUT);
-		PED.set_function("SET_PED_CAN_BE_DRAGGED_OUT", LUA_NATIVE_PED_SET_PED_CAN_BE_DRAGGED_OUT);
-		PED.set_function("SET_PED_ALLOW_HURT_COMBAT_FOR_ALL_MISSION_PEDS", LUA_NATIVE_PED_SET_PED_ALLOW_HURT_COMBAT_FOR_ALL_MISSION_PEDS);
-		PED.set_function("IS_PED_MALE", LUA_NATIVE_PED_IS_PED_MALE);
-		PED.set_function("IS_PED_HUMAN", LUA_NATIVE_PED_IS_PED_HUMAN);
-		PED.set_function("GET_VEHICLE_PED_IS_IN", LUA_NATIVE_PED_GET_VEHICLE_PED_IS_IN);
-		PED.set_function("RESET_PED_LAST_VEHICLE", LUA_NATIVE_PED_RESET_PED_LAST_VEHICLE);
-		PED.set_function("SET_PED_DENSITY_MULTIPLIER_THIS_FRAME", LUA_NATIVE_PED_SET_PED_DENSITY_MULTIPLIER_THIS_FRAME);
-		PED.set_function("SET_SCENARIO_PED_DENSITY_MULTIPLIER_THIS_FRAME", LUA_NATIVE_PED_SET_SCENARIO_PED_DENSITY_MULTIPLIER_THIS_FRAME);
-		PED.set_function("SUPPRESS_AMBIENT_PED_AGGRESSIVE_CLEANUP_THIS_FRAME", LUA_NATIVE_PED_SUPPRESS_AMBIENT_PED_AGGRESSIVE_CLEANUP_THIS_FRAME);
-		PED.set_function("SET_SCRIPTED_CONVERSION_COORD_THIS_FRAME", LUA_NATIVE_PED_SET_SCRIPTED_CONVERSION_COORD_THIS_FRAME);
-		PED.set_function("SET_PED_NON_CREATION_AREA", LUA_NATIVE_PED_SET_PED_NON_CREATION_AREA);
-		PED.set_function("CLEAR_PED_NON_CREATION_AREA", LUA_NATIVE_PED_CLEAR_PED_NON_CREATION_AREA);
-		PED.set_function("INSTANTLY_FILL_PED_POPULATION", LUA_NATIVE_PED_INSTANTLY_FILL_PED_POPULATION);
-		PED.set_function("IS_PED_ON_MOUNT", LUA_NATIVE_PED_IS_PED_ON_MOUNT);
-		PED.set_function("GET_MOUNT", LUA_NATIVE_PED_GET_MOUNT);
-		PED.set_function("IS_PED_ON_VEHICLE", LUA_NATIVE_PED_IS_PED_ON_VEHICLE);
-		PED.set_function("IS_PED_ON_SPECIFIC_VEHICLE", LUA_NATIVE_PED_IS_PED_ON_SPECIFIC_VEHICLE);
-		PED.set_function("SET_PED_MONEY", LUA_NATIVE_PED_SET_PED_MONEY);
-		PED.set_function("GET_PED_MONEY", LUA_NATIVE_PED_GET_PED_MONEY);
-		PED.set_function("SET_HEALTH_SNACKS_CARRIED_BY_ALL_NEW_PEDS", LUA_NATIVE_PED_SET_HEALTH_SNACKS_CARRIED_BY_ALL_NEW_PEDS);
-		PED.set_function("SET_AMBIENT_PEDS_DROP_MONEY", LUA_NATIVE_PED_SET_AMBIENT_PEDS_DROP_MONEY);
-		PED.set_function("SET_BLOCKING_OF_NON_TEMPORARY_EVENTS_FOR_AMBIENT_PEDS_THIS_FRAME", LUA_NATIVE_PED_SET_BLOCKING_OF_NON_TEMPORARY_EVENTS_FOR_AMBIENT_PEDS_THIS_FRAME);
-		PED.set_function("SET_PED_SUFFERS_CRITICAL_HITS", LUA_NATIVE_PED_SET_PED_SUFFERS_CRITICAL_HITS);
-		PED.set_function("SET_PED_UPPER_BODY_DAMAGE_ONLY", LUA_NATIVE_PED_SET_PED_UPPER_BODY_DAMAGE_ONLY);
-		PED.set_function("IS_PED_SITTING_IN_VEHICLE", LUA_NATIVE_PED_IS_PED_SITTING_IN_VEHICLE);
-		PED.set_function("IS_PED_SITTING_IN_ANY_VEHICLE", LUA_NATIVE_PED_IS_PED_SITTING_IN_ANY_VEHICLE);
-		PED.set_function("IS_PED_ON_FOOT", LUA_NATIVE_PED_IS_PED_ON_FOOT);
-		PED.set_function("IS_PED_ON_ANY_BIKE", LUA_NATIVE_PED_IS_PED_ON_ANY_BIKE);
-		PED.set_function("IS_PED_PLANTING_BOMB", LUA_NATIVE_PED_IS_PED_PLANTING_BOMB);
-		PED.set_function("GET_DEAD_PED_PICKUP_COORDS", LUA_NATIVE_PED_GET_DEAD_PED_PICKUP_COORDS);
-		PED.set_function("IS_PED_IN_ANY_BOAT", LUA_NATIVE_PED_IS_PED_IN_ANY_BOAT);
-		PED.set_function("IS_PED_IN_ANY_SUB", LUA_NATIVE_PED_IS_PED_IN_ANY_SUB);
-		PED.set_function("IS_PED_IN_ANY_HELI", LUA_NATIVE_PED_IS_PED_IN_ANY_HELI);
-		PED.set_function("IS_PED_IN_ANY_PLANE", LUA_NATIVE_PED_IS_PED_IN_ANY_PLANE);
-		PED.set_function("IS_PED_IN_FLYING_VEHICLE", LUA_NATIVE_PED_IS_PED_IN_FLYING_VEHICLE);
-		PED.set_function("SET_PED_DIES_IN_WATER", LUA_NATIVE_PED_SET_PED_DIES_IN_WATER);
-		PED.set_function("GET_PED_DIES_IN_WATER", LUA_NATIVE_PED_GET_PED_DIES_IN_WATER);
-		PED.set_function("SET_PED_DIES_IN_SINKING_VEHICLE", LUA_NATIVE_PED_SET_PED_DIES_IN_SINKING_VEHICLE);
-		PED.set_function("GET_PED_ARMOUR", LUA_NATIVE_PED_GET_PED_ARMOUR);
-		PED.set_function("SET_PED_STAY_IN_VEHICLE_WHEN_JACKED", LUA_NATIVE_PED_SET_PED_STAY_IN_VEHICLE_WHEN_JACKED);
-		PED.set_function("SET_PED_CAN_BE_SHOT_IN_VEHICLE", LUA_NATIVE_PED_SET_PED_CAN_BE_SHOT_IN_VEHICLE);
-		PED.set_function("GET_PED_LAST_DAMAGE_BONE", LUA_NATIVE_PED_GET_PED_LAST_DAMAGE_BONE);
-		PED.set_function("CLEAR_PED_LAST_DAMAGE_BONE", LUA_NATIVE_PED_CLEAR_PED_LAST_DAMAGE_BONE);
-		PED.set_function("SET_AI_WEAPON_DAMAGE_MODIFIER", LUA_NATIVE_PED_SET_AI_WEAPON_DAMAGE_MODIFIER);
-		PED.set_function("RESET_AI_WEAPON_DAMAGE_MODIFIER", LUA_NATIVE_PED_RESET_AI_WEAPON_DAMAGE_MODIFIER);
-		PED.set_function("SET_AI_MELEE_WEAPON_DAMAGE_MODIFIER", LUA_NATIVE_PED_SET_AI_MELEE_WEAPON_DAMAGE_MODIFIER);
-		PED.set_function("RESET_AI_MELEE_WEAPON_DAMAGE_MODIFIER", LUA_NATIVE_PED_RESET_AI_MELEE_WEAPON_DAMAGE_MODIFIER);
-		PED.set_function("SET_TREAT_AS_AMBIENT_PED_FOR_DRIVER_LOCKON", LUA_NATIVE_PED_SET_TREAT_AS_AMBIENT_PED_FOR_DRIVER_LOCKON);
-		PED.set_function("SET_PED_CAN_BE_TARGETTED", LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETTED);
-		PED.set_function("SET_PED_CAN_BE_TARGETTED_BY_TEAM", LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETTED_BY_TEAM);
-		PED.set_function("SET_PED_CAN_BE_TARGETTED_BY_PLAYER", LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETTED_BY_PLAYER);
-		PED.set_function("SET_ALLOW_LOCKON_TO_PED_IF_FRIENDLY", LUA_NATIVE_PED_SET_ALLOW_LOCKON_TO_PED_IF_FRIENDLY);
-		PED.set_function("SET_USE_CAMERA_HEADING_FOR_DESIRED_DIRECTION_LOCK_ON_TEST", LUA_NATIVE_PED_SET_USE_CAMERA_HEADING_FOR_DESIRED_DIRECTION_LOCK_ON_TEST);
-		PED.set_function("IS_PED_IN_ANY_POLICE_VEHICLE", LUA_NATIVE_PED_IS_PED_IN_ANY_POLICE_VEHICLE);
-		PED.set_function("FORCE_PED_TO_OPEN_PARACHUTE", LUA_NATIVE_PED_FORCE_PED_TO_OPEN_PARACHUTE);
-		PED.set_function("IS_PED_IN_PARACHUTE_FREE_FALL", LUA_NATIVE_PED_IS_PED_IN_PARACHUTE_FREE_FALL);
-		PED.set_function("IS_PED_FALLING", LUA_NATIVE_PED_IS_PED_FALLING);
-		PED.set_function("IS_PED_JUMPING", LUA_NATIVE_PED_IS_PED_JUMPING);
-		PED.set_function("IS_PED_LANDING", LUA_NATIVE_PED_IS_PED_LANDING);
-		PED.set_function("IS_PED_DOING_A_BEAST_JUMP", LUA_NATIVE_PED_IS_PED_DOING_A_BEAST_JUMP);
-		PED.set_function("IS_PED_CLIMBING", LUA_NATIVE_PED_IS_PED_CLIMBING);
-		PED.set_function("IS_PED_VAULTING", LUA_NATIVE_PED_IS_PED_VAULTING);
-		PED.set_function("IS_PED_DIVING", LUA_NATIVE_PED_IS_PED_DIVING);
-		PED.set_function("IS_PED_JUMPING_OUT_OF_VEHICLE", LUA_NATIVE_PED_IS_PED_JUMPING_OUT_OF_VEHICLE);
-		PED.set_function("IS_PED_OPENING_DOOR", LUA_NATIVE_PED_IS_PED_OPENING_DOOR);
-		PED.set_function("GET_PED_PARACHUTE_STATE", LUA_NATIVE_PED_GET_PED_PARACHUTE_STATE);
-		PED.set_function("GET_PED_PARACHUTE_LANDING_TYPE", LUA_NATIVE_PED_GET_PED_PARACHUTE_LANDING_TYPE);
-		PED.set_function("SET_PED_PARACHUTE_TINT_INDEX", LUA_NATIVE_PED_SET_PED_PARACHUTE_TINT_INDEX);
-		PED.set_function("GET_PED_PARACHUTE_TINT_INDEX", LUA_NATIVE_PED_GET_PED_PARACHUTE_TINT_INDEX);
-		PED.set_function("SET_PED_RESERVE_PARACHUTE_TINT_INDEX", LUA_NATIVE_PED_SET_PED_RESERVE_PARACHUTE_TINT_INDEX);
-		PED.set_function("CREATE_PARACHUTE_BAG_OBJECT", LUA_NATIVE_PED_CREATE_PARACHUTE_BAG_OBJECT);
-		PED.set_function("SET_PED_DUCKING", LUA_NATIVE_PED_SET_PED_DUCKING);
-		PED.set_function("IS_PED_DUCKING", LUA_NATIVE_PED_IS_PED_DUCKING);
-		PED.set_function("IS_PED_IN_ANY_TAXI", LUA_NATIVE_PED_IS_PED_IN_ANY_TAXI);
-		PED.set_function("SET_PED_ID_RANGE", LUA_NATIVE_PED_SET_PED_ID_RANGE);
-		PED.set_function("SET_PED_HIGHLY_PERCEPTIVE", LUA_NATIVE_PED_SET_PED_HIGHLY_PERCEPTIVE);
-		PED.set_function("SET_COP_PERCEPTION_OVERRIDES", LUA_NATIVE_PED_SET_COP_PERCEPTION_OVERRIDES);
-		PED.set_function("SET_PED_INJURED_ON_GROUND_BEHAVIOUR", LUA_NATIVE_PED_SET_PED_INJURED_ON_GROUND_BEHAVIOUR);
-		PED.set_function("DISABLE_PED_INJURED_ON_GROUND_BEHAVIOUR", LUA_NATIVE_PED_DISABLE_PED_INJURED_ON_GROUND_BEHAVIOUR);
-		PED.set_function("SET_PED_SEEING_RANGE", LUA_NATIVE_PED_SET_PED_SEEING_RANGE);
-		PED.set_function("SET_PED_HEARING_RANGE", LUA_NATIVE_PED_SET_PED_HEARING_RANGE);
-		PED.set_function("SET_PED_VISUAL_FIELD_MIN_ANGLE", LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_MIN_ANGLE);
-		PED.set_function("SET_PED_VISUAL_FIELD_MAX_ANGLE", LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_MAX_ANGLE);
-		PED.set_function("SET_PED_VISUAL_FIELD_MIN_ELEVATION_ANGLE", LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_MIN_ELEVATION_ANGLE);
-		PED.set_function("SET_PED_VISUAL_FIELD_MAX_ELEVATION_ANGLE", LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_MAX_ELEVATION_ANGLE);
-		PED.set_function("SET_PED_VISUAL_FIELD_PERIPHERAL_RANGE", LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_PERIPHERAL_RANGE);
-		PED.set_function("SET_PED_VISUAL_FIELD_CENTER_ANGLE", LUA_NATIVE_PED_SET_PED_VISUAL_FIELD_CENTER_ANGLE);
-		PED.set_function("GET_PED_VISUAL_FIELD_CENTER_ANGLE", LUA_NATIVE_PED_GET_PED_VISUAL_FIELD_CENTER_ANGLE);
-		PED.set_function("SET_PED_STEALTH_MOVEMENT", LUA_NATIVE_PED_SET_PED_STEALTH_MOVEMENT);
-		PED.set_function("GET_PED_STEALTH_MOVEMENT", LUA_NATIVE_PED_GET_PED_STEALTH_MOVEMENT);
-		PED.set_function("CREATE_GROUP", LUA_NATIVE_PED_CREATE_GROUP);
-		PED.set_function("SET_PED_AS_GROUP_LEADER", LUA_NATIVE_PED_SET_PED_AS_GROUP_LEADER);
-		PED.set_function("SET_PED_AS_GROUP_MEMBER", LUA_NATIVE_PED_SET_PED_AS_GROUP_MEMBER);
-		PED.set_function("SET_PED_CAN_TELEPORT_TO_GROUP_LEADER", LUA_NATIVE_PED_SET_PED_CAN_TELEPORT_TO_GROUP_LEADER);
-		PED.set_function("REMOVE_GROUP", LUA_NATIVE_PED_REMOVE_GROUP);
-		PED.set_function("REMOVE_PED_FROM_GROUP", LUA_NATIVE_PED_REMOVE_PED_FROM_GROUP);
-		PED.set_function("IS_PED_GROUP_MEMBER", LUA_NATIVE_PED_IS_PED_GROUP_MEMBER);
-		PED.set_function("IS_PED_HANGING_ON_TO_VEHICLE", LUA_NATIVE_PED_IS_PED_HANGING_ON_TO_VEHICLE);
-		PED.set_function("SET_GROUP_SEPARATION_RANGE", LUA_NATIVE_PED_SET_GROUP_SEPARATION_RANGE);
-		PED.set_function("SET_PED_MIN_GROUND_TIME_FOR_STUNGUN", LUA_NATIVE_PED_SET_PED_MIN_GROUND_TIME_FOR_STUNGUN);
-		PED.set_function("IS_PED_PRONE", LUA_NATIVE_PED_IS_PED_PRONE);
-		PED.set_function("IS_PED_IN_COMBAT", LUA_NATIVE_PED_IS_PED_IN_COMBAT);
-		PED.set_function("GET_PED_TARGET_FROM_COMBAT_PED", LUA_NATIVE_PED_GET_PED_TARGET_FROM_COMBAT_PED);
-		PED.set_function("CAN_PED_IN_COMBAT_SEE_TARGET", LUA_NATIVE_PED_CAN_PED_IN_COMBAT_SEE_TARGET);
-		PED.set_function("IS_PED_DOING_DRIVEBY", LUA_NATIVE_PED_IS_PED_DOING_DRIVEBY);
-		PED.set_function("IS_PED_JACKING", LUA_NATIVE_PED_IS_PED_JACKING);
-		PED.set_function("IS_PED_BEING_JACKED", LUA_NATIVE_PED_IS_PED_BEING_JACKED);
-		PED.set_function("IS_PED_BEING_STUNNED", LUA_NATIVE_PED_IS_PED_BEING_STUNNED);
-		PED.set_function("GET_PEDS_JACKER", LUA_NATIVE_PED_GET_PEDS_JACKER);
-		PED.set_function("GET_JACK_TARGET", LUA_NATIVE_PED_GET_JACK_TARGET);
-		PED.set_function("IS_PED_FLEEING", LUA_NATIVE_PED_IS_PED_FLEEING);
-		PED.set_function("IS_PED_IN_COVER", LUA_NATIVE_PED_IS_PED_IN_COVER);
-		PED.set_function("IS_PED_IN_COVER_FACING_LEFT", LUA_NATIVE_PED_IS_PED_IN_COVER_FACING_LEFT);
-		PED.set_function("IS_PED_IN_HIGH_COVER", LUA_NATIVE_PED_IS_PED_IN_HIGH_COVER);
-		PED.set_function("IS_PED_GOING_INTO_COVER", LUA_NATIVE_PED_IS_PED_GOING_INTO_COVER);
-		PED.set_function("SET_PED_PINNED_DOWN", LUA_NATIVE_PED_SET_PED_PINNED_DOWN);
-		PED.set_function("HAS_PED_CLEAR_LOS_TO_ENTITY_", LUA_NATIVE_PED_HAS_PED_CLEAR_LOS_TO_ENTITY_);
-		PED.set_function("GET_SEAT_PED_IS_TRYING_TO_ENTER", LUA_NATIVE_PED_GET_SEAT_PED_IS_TRYING_TO_ENTER);
-		PED.set_function("GET_VEHICLE_PED_IS_TRYING_TO_ENTER", LUA_NATIVE_PED_GET_VEHICLE_PED_IS_TRYING_TO_ENTER);
-		PED.set_function("GET_PED_SOURCE_OF_DEATH", LUA_NATIVE_PED_GET_PED_SOURCE_OF_DEATH);
-		PED.set_function("GET_PED_CAUSE_OF_DEATH", LUA_NATIVE_PED_GET_PED_CAUSE_OF_DEATH);
-		PED.set_function("GET_PED_TIME_OF_DEATH", LUA_NATIVE_PED_GET_PED_TIME_OF_DEATH);
-		PED.set_function("COUNT_PEDS_IN_COMBAT_WITH_TARGET", LUA_NATIVE_PED_COUNT_PEDS_IN_COMBAT_WITH_TARGET);
-		PED.set_function("COUNT_PEDS_IN_COMBAT_WITH_TARGET_WITHIN_RADIUS", LUA_NATIVE_PED_COUNT_PEDS_IN_COMBAT_WITH_TARGET_WITHIN_RADIUS);
-		PED.set_function("SET_PED_RELATIONSHIP_GROUP_DEFAULT_HASH", LUA_NATIVE_PED_SET_PED_RELATIONSHIP_GROUP_DEFAULT_HASH);
-		PED.set_function("SET_PED_RELATIONSHIP_GROUP_HASH", LUA_NATIVE_PED_SET_PED_RELATIONSHIP_GROUP_HASH);
-		PED.set_function("SET_RELATIONSHIP_BETWEEN_GROUPS", LUA_NATIVE_PED_SET_RELATIONSHIP_BETWEEN_GROUPS);
-		PED.set_function("CLEAR_RELATIONSHIP_BETWEEN_GROUPS", LUA_NATIVE_PED_CLEAR_RELATIONSHIP_BETWEEN_GROUPS);
-		PED.set_function("ADD_RELATIONSHIP_GROUP", LUA_NATIVE_PED_ADD_RELATIONSHIP_GROUP);
-		PED.set_function("REMOVE_RELATIONSHIP_GROUP", LUA_NATIVE_PED_REMOVE_RELATIONSHIP_GROUP);
-		PED.set_function("DOES_RELATIONSHIP_GROUP_EXIST", LUA_NATIVE_PED_DOES_RELATIONSHIP_GROUP_EXIST);
-		PED.set_function("GET_RELATIONSHIP_BETWEEN_PEDS", LUA_NATIVE_PED_GET_RELATIONSHIP_BETWEEN_PEDS);
-		PED.set_function("GET_PED_RELATIONSHIP_GROUP_DEFAULT_HASH", LUA_NATIVE_PED_GET_PED_RELATIONSHIP_GROUP_DEFAULT_HASH);
-		PED.set_function("GET_PED_RELATIONSHIP_GROUP_HASH", LUA_NATIVE_PED_GET_PED_RELATIONSHIP_GROUP_HASH);
-		PED.set_function("GET_RELATIONSHIP_BETWEEN_GROUPS", LUA_NATIVE_PED_GET_RELATIONSHIP_BETWEEN_GROUPS);
-		PED.set_function("SET_RELATIONSHIP_GROUP_AFFECTS_WANTED_LEVEL", LUA_NATIVE_PED_SET_RELATIONSHIP_GROUP_AFFECTS_WANTED_LEVEL);
-		PED.set_function("TELL_GROUP_PEDS_IN_AREA_TO_ATTACK", LUA_NATIVE_PED_TELL_GROUP_PEDS_IN_AREA_TO_ATTACK);
-		PED.set_function("SET_PED_CAN_BE_TARGETED_WITHOUT_LOS", LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETED_WITHOUT_LOS);
-		PED.set_function("SET_PED_TO_INFORM_RESPECTED_FRIENDS", LUA_NATIVE_PED_SET_PED_TO_INFORM_RESPECTED_FRIENDS);
-		PED.set_function("IS_PED_RESPONDING_TO_EVENT", LUA_NATIVE_PED_IS_PED_RESPONDING_TO_EVENT);
-		PED.set_function("GET_POS_FROM_FIRED_EVENT", LUA_NATIVE_PED_GET_POS_FROM_FIRED_EVENT);
-		PED.set_function("SET_PED_FIRING_PATTERN", LUA_NATIVE_PED_SET_PED_FIRING_PATTERN);
-		PED.set_function("SET_PED_SHOOT_RATE", LUA_NATIVE_PED_SET_PED_SHOOT_RATE);
-		PED.set_function("SET_COMBAT_FLOAT", LUA_NATIVE_PED_SET_COMBAT_FLOAT);
-		PED.set_function("GET_COMBAT_FLOAT", LUA_NATIVE_PED_GET_COMBAT_FLOAT);
-		PED.set_function("GET_GROUP_SIZE", LUA_NATIVE_PED_GET_GROUP_SIZE);
-		PED.set_function("DOES_GROUP_EXIST", LUA_NATIVE_PED_DOES_GROUP_EXIST);
-		PED.set_function("GET_PED_GROUP_INDEX", LUA_NATIVE_PED_GET_PED_GROUP_INDEX);
-		PED.set_function("IS_PED_IN_GROUP", LUA_NATIVE_PED_IS_PED_IN_GROUP);
-		PED.set_function("GET_PLAYER_PED_IS_FOLLOWING", LUA_NATIVE_PED_GET_PLAYER_PED_IS_FOLLOWING);
-		PED.set_function("SET_GROUP_FORMATION", LUA_NATIVE_PED_SET_GROUP_FORMATION);
-		PED.set_function("SET_GROUP_FORMATION_SPACING", LUA_NATIVE_PED_SET_GROUP_FORMATION_SPACING);
-		PED.set_function("RESET_GROUP_FORMATION_DEFAULT_SPACING", LUA_NATIVE_PED_RESET_GROUP_FORMATION_DEFAULT_SPACING);
-		PED.set_function("GET_VEHICLE_PED_IS_USING", LUA_NATIVE_PED_GET_VEHICLE_PED_IS_USING);
-		PED.set_function("GET_VEHICLE_PED_IS_ENTERING", LUA_NATIVE_PED_GET_VEHICLE_PED_IS_ENTERING);
-		PED.set_function("SET_PED_GRAVITY", LUA_NATIVE_PED_SET_PED_GRAVITY);
-		PED.set_function("APPLY_DAMAGE_TO_PED", LUA_NATIVE_PED_APPLY_DAMAGE_TO_PED);
-		PED.set_function("GET_TIME_PED_DAMAGED_BY_WEAPON", LUA_NATIVE_PED_GET_TIME_PED_DAMAGED_BY_WEAPON);
-		PED.set_function("SET_PED_ALLOWED_TO_DUCK", LUA_NATIVE_PED_SET_PED_ALLOWED_TO_DUCK);
-		PED.set_function("SET_PED_NEVER_LEAVES_GROUP", LUA_NATIVE_PED_SET_PED_NEVER_LEAVES_GROUP);
-		PED.set_function("GET_PED_TYPE", LUA_NATIVE_PED_GET_PED_TYPE);
-		PED.set_function("SET_PED_AS_COP", LUA_NATIVE_PED_SET_PED_AS_COP);
-		PED.set_function("SET_PED_HEALTH_PENDING_LAST_DAMAGE_EVENT_OVERRIDE_FLAG", LUA_NATIVE_PED_SET_PED_HEALTH_PENDING_LAST_DAMAGE_EVENT_OVERRIDE_FLAG);
-		PED.set_function("SET_PED_MAX_HEALTH", LUA_NATIVE_PED_SET_PED_MAX_HEALTH);
-		PED.set_function("GET_PED_MAX_HEALTH", LUA_NATIVE_PED_GET_PED_MAX_HEALTH);
-		PED.set_function("SET_PED_MAX_TIME_IN_WATER", LUA_NATIVE_PED_SET_PED_MAX_TIME_IN_WATER);
-		PED.set_function("SET_PED_MAX_TIME_UNDERWATER", LUA_NATIVE_PED_SET_PED_MAX_TIME_UNDERWATER);
-		PED.set_function("SET_CORPSE_RAGDOLL_FRICTION", LUA_NATIVE_PED_SET_CORPSE_RAGDOLL_FRICTION);
-		PED.set_function("SET_PED_VEHICLE_FORCED_SEAT_USAGE", LUA_NATIVE_PED_SET_PED_VEHICLE_FORCED_SEAT_USAGE);
-		PED.set_function("CLEAR_ALL_PED_VEHICLE_FORCED_SEAT_USAGE", LUA_NATIVE_PED_CLEAR_ALL_PED_VEHICLE_FORCED_SEAT_USAGE);
-		PED.set_function("SET_PED_CAN_BE_KNOCKED_OFF_BIKE", LUA_NATIVE_PED_SET_PED_CAN_BE_KNOCKED_OFF_BIKE);
-		PED.set_function("SET_PED_CAN_BE_KNOCKED_OFF_VEHICLE", LUA_NATIVE_PED_SET_PED_CAN_BE_KNOCKED_OFF_VEHICLE);
-		PED.set_function("CAN_KNOCK_PED_OFF_VEHICLE", LUA_NATIVE_PED_CAN_KNOCK_PED_OFF_VEHICLE);
-		PED.set_function("KNOCK_PED_OFF_VEHICLE", LUA_NATIVE_PED_KNOCK_PED_OFF_VEHICLE);
-		PED.set_function("SET_PED_COORDS_NO_GANG", LUA_NATIVE_PED_SET_PED_COORDS_NO_GANG);
-		PED.set_function("GET_PED_AS_GROUP_MEMBER", LUA_NATIVE_PED_GET_PED_AS_GROUP_MEMBER);
-		PED.set_function("GET_PED_AS_GROUP_LEADER", LUA_NATIVE_PED_GET_PED_AS_GROUP_LEADER);
-		PED.set_function("SET_PED_KEEP_TASK", LUA_NATIVE_PED_SET_PED_KEEP_TASK);
-		PED.set_function("SET_PED_ALLOW_MINOR_REACTIONS_AS_MISSION_PED", LUA_NATIVE_PED_SET_PED_ALLOW_MINOR_REACTIONS_AS_MISSION_PED);
-		PED.set_function("IS_PED_SWIMMING", LUA_NATIVE_PED_IS_PED_SWIMMING);
-		PED.set_function("IS_PED_SWIMMING_UNDER_WATER", LUA_NATIVE_PED_IS_PED_SWIMMING_UNDER_WATER);
-		PED.set_function("SET_PED_COORDS_KEEP_VEHICLE", LUA_NATIVE_PED_SET_PED_COORDS_KEEP_VEHICLE);
-		PED.set_function("SET_PED_DIES_IN_VEHICLE", LUA_NATIVE_PED_SET_PED_DIES_IN_VEHICLE);
-		PED.set_function("SET_CREATE_RANDOM_COPS", LUA_NATIVE_PED_SET_CREATE_RANDOM_COPS);
-		PED.set_function("SET_CREATE_RANDOM_COPS_NOT_ON_SCENARIOS", LUA_NATIVE_PED_SET_CREATE_RANDOM_COPS_NOT_ON_SCENARIOS);
-		PED.set_function("SET_CREATE_RANDOM_COPS_ON_SCENARIOS", LUA_NATIVE_PED_SET_CREATE_RANDOM_COPS_ON_SCENARIOS);
-		PED.set_function("CAN_CREATE_RANDOM_COPS", LUA_NATIVE_PED_CAN_CREATE_RANDOM_COPS);
-		PED.set_function("SET_PED_AS_ENEMY", LUA_NATIVE_PED_SET_PED_AS_ENEMY);
-		PED.set_function("SET_PED_CAN_SMASH_GLASS", LUA_NATIVE_PED_SET_PED_CAN_SMASH_GLASS);
-		PED.set_function("IS_PED_IN_ANY_TRAIN", LUA_NATIVE_PED_IS_PED_IN_ANY_TRAIN);
-		PED.set_function("IS_PED_GETTING_INTO_A_VEHICLE", LUA_NATIVE_PED_IS_PED_GETTING_INTO_A_VEHICLE);
-		PED.set_function("IS_PED_TRYING_TO_ENTER_A_LOCKED_VEHICLE", LUA_NATIVE_PED_IS_PED_TRYING_TO_ENTER_A_LOCKED_VEHICLE);
-		PED.set_function("SET_ENABLE_HANDCUFFS", LUA_NATIVE_PED_SET_ENABLE_HANDCUFFS);
-		PED.set_function("SET_ENABLE_BOUND_ANKLES", LUA_NATIVE_PED_SET_ENABLE_BOUND_ANKLES);
-		PED.set_function("SET_ENABLE_SCUBA", LUA_NATIVE_PED_SET_ENABLE_SCUBA);
-		PED.set_function("SET_CAN_ATTACK_FRIENDLY", LUA_NATIVE_PED_SET_CAN_ATTACK_FRIENDLY);
-		PED.set_function("GET_PED_ALERTNESS", LUA_NATIVE_PED_GET_PED_ALERTNESS);
-		PED.set_function("SET_PED_ALERTNESS", LUA_NATIVE_PED_SET_PED_ALERTNESS);
-		PED.set_function("SET_PED_GET_OUT_UPSIDE_DOWN_VEHICLE", LUA_NATIVE_PED_SET_PED_GET_OUT_UPSIDE_DOWN_VEHICLE);
-		PED.set_function("SET_PED_MOVEMENT_CLIPSET", LUA_NATIVE_PED_SET_PED_MOVEMENT_CLIPSET);
-		PED.set_function("RESET_PED_MOVEMENT_CLIPSET", LUA_NATIVE_PED_RESET_PED_MOVEMENT_CLIPSET);
-		PED.set_function("SET_PED_STRAFE_CLIPSET", LUA_NATIVE_PED_SET_PED_STRAFE_CLIPSET);
-		PED.set_function("RESET_PED_STRAFE_CLIPSET", LUA_NATIVE_PED_RESET_PED_STRAFE_CLIPSET);
-		PED.set_function("SET_PED_WEAPON_MOVEMENT_CLIPSET", LUA_NATIVE_PED_SET_PED_WEAPON_MOVEMENT_CLIPSET);
-		PED.set_function("RESET_PED_WEAPON_MOVEMENT_CLIPSET", LUA_NATIVE_PED_RESET_PED_WEAPON_MOVEMENT_CLIPSET);
-		PED.set_function("SET_PED_DRIVE_BY_CLIPSET_OVERRIDE", LUA_NATIVE_PED_SET_PED_DRIVE_BY_CLIPSET_OVERRIDE);
-		PED.set_function("CLEAR_PED_DRIVE_BY_CLIPSET_OVERRIDE", LUA_NATIVE_PED_CLEAR_PED_DRIVE_BY_CLIPSET_OVERRIDE);
-		PED.set_function("SET_PED_MOTION_IN_COVER_CLIPSET_OVERRIDE", LUA_NATIVE_PED_SET_PED_MOTION_IN_COVER_CLIPSET_OVERRIDE);
-		PED.set_function("CLEAR_PED_MOTION_IN_COVER_CLIPSET_OVERRIDE", LUA_NATIVE_PED_CLEAR_PED_MOTION_IN_COVER_CLIPSET_OVERRIDE);
-		PED.set_function("CLEAR_PED_FALL_UPPER_BODY_CLIPSET_OVERRIDE", LUA_NATIVE_PED_CLEAR_PED_FALL_UPPER_BODY_CLIPSET_OVERRIDE);
-		PED.set_function("SET_PED_IN_VEHICLE_CONTEXT", LUA_NATIVE_PED_SET_PED_IN_VEHICLE_CONTEXT);
-		PED.set_function("RESET_PED_IN_VEHICLE_CONTEXT", LUA_NATIVE_PED_RESET_PED_IN_VEHICLE_CONTEXT);
-		PED.set_function("IS_SCRIPTED_SCENARIO_PED_USING_CONDITIONAL_ANIM", LUA_NATIVE_PED_IS_SCRIPTED_SCENARIO_PED_USING_CONDITIONAL_ANIM);
-		PED.set_function("SET_PED_ALTERNATE_WALK_ANIM", LUA_NATIVE_PED_SET_PED_ALTERNATE_WALK_ANIM);
-		PED.set_function("CLEAR_PED_ALTERNATE_WALK_ANIM", LUA_NATIVE_PED_CLEAR_PED_ALTERNATE_WALK_ANIM);
-		PED.set_function("SET_PED_ALTERNATE_MOVEMENT_ANIM", LUA_NATIVE_PED_SET_PED_ALTERNATE_MOVEMENT_ANIM);
-		PED.set_function("CLEAR_PED_ALTERNATE_MOVEMENT_ANIM", LUA_NATIVE_PED_CLEAR_PED_ALTERNATE_MOVEMENT_ANIM);
-		PED.set_function("SET_PED_GESTURE_GROUP", LUA_NATIVE_PED_SET_PED_GESTURE_GROUP);
-		PED.set_function("GET_ANIM_INITIAL_OFFSET_POSITION", LUA_NATIVE_PED_GET_ANIM_INITIAL_OFFSET_POSITION);
-		PED.set_function("GET_ANIM_INITIAL_OFFSET_ROTATION", LUA_NATIVE_PED_GET_ANIM_INITIAL_OFFSET_ROTATION);
-		PED.set_function("GET_PED_DRAWABLE_VARIATION", LUA_NATIVE_PED_GET_PED_DRAWABLE_VARIATION);
-		PED.set_function("GET_NUMBER_OF_PED_DRAWABLE_VARIATIONS", LUA_NATIVE_PED_GET_NUMBER_OF_PED_DRAWABLE_VARIATIONS);
-		PED.set_function("GET_PED_TEXTURE_VARIATION", LUA_NATIVE_PED_GET_PED_TEXTURE_VARIATION);
-		PED.set_function("GET_NUMBER_OF_PED_TEXTURE_VARIATIONS", LUA_NATIVE_PED_GET_NUMBER_OF_PED_TEXTURE_VARIATIONS);
-		PED.set_function("GET_NUMBER_OF_PED_PROP_DRAWABLE_VARIATIONS", LUA_NATIVE_PED_GET_NUMBER_OF_PED_PROP_DRAWABLE_VARIATIONS);
-		PED.set_function("GET_NUMBER_OF_PED_PROP_TEXTURE_VARIATIONS", LUA_NATIVE_PED_GET_NUMBER_OF_PED_PROP_TEXTURE_VARIATIONS);
-		PED.set_function("GET_PED_PALETTE_VARIATION", LUA_NATIVE_PED_GET_PED_PALETTE_VARIATION);
-		PED.set_function("GET_MP_OUTFIT_DATA_FROM_METADATA", LUA_NATIVE_PED_GET_MP_OUTFIT_DATA_FROM_METADATA);
-		PED.set_function("GET_FM_MALE_SHOP_PED_APPAREL_ITEM_INDEX", LUA_NATIVE_PED_GET_FM_MALE_SHOP_PED_APPAREL_ITEM_INDEX);
-		PED.set_function("GET_FM_FEMALE_SHOP_PED_APPAREL_ITEM_INDEX", LUA_NATIVE_PED_GET_FM_FEMALE_SHOP_PED_APPAREL_ITEM_INDEX);
-		PED.set_function("IS_PED_COMPONENT_VARIATION_VALID", LUA_NATIVE_PED_IS_PED_COMPONENT_VARIATION_VALID);
-		PED.set_function("SET_PED_COMPONENT_VARIATION", LUA_NATIVE_PED_SET_PED_COMPONENT_VARIATION);
-		PED.set_function("SET_PED_RANDOM_COMPONENT_VARIATION", LUA_NATIVE_PED_SET_PED_RANDOM_COMPONENT_VARIATION);
-		PED.set_function("SET_PED_RANDOM_PROPS", LUA_NATIVE_PED_SET_PED_RANDOM_PROPS);
-		PED.set_function("SET_PED_DEFAULT_COMPONENT_VARIATION", LUA_NATIVE_PED_SET_PED_DEFAULT_COMPONENT_VARIATION);
-		PED.set_function("SET_PED_BLEND_FROM_PARENTS", LUA_NATIVE_PED_SET_PED_BLEND_FROM_PARENTS);
-		PED.set_function("SET_PED_HEAD_BLEND_DATA", LUA_NATIVE_PED_SET_PED_HEAD_BLEND_DATA);
-		PED.set_function("GET_PED_HEAD_BLEND_DATA", LUA_NATIVE_PED_GET_PED_HEAD_BLEND_DATA);
-		PED.set_function("UPDATE_PED_HEAD_BLEND_DATA", LUA_NATIVE_PED_UPDATE_PED_HEAD_BLEND_DATA);
-		PED.set_function("SET_HEAD_BLEND_EYE_COLOR", LUA_NATIVE_PED_SET_HEAD_BLEND_EYE_COLOR);
-		PED.set_function("GET_HEAD_BLEND_EYE_COLOR", LUA_NATIVE_PED_GET_HEAD_BLEND_EYE_COLOR);
-		PED.set_function("SET_PED_HEAD_OVERLAY", LUA_NATIVE_PED_SET_PED_HEAD_OVERLAY);
-		PED.set_function("GET_PED_HEAD_OVERLAY", LUA_NATIVE_PED_GET_PED_HEAD_OVERLAY);
-		PED.set_function("GET_PED_HEAD_OVERLAY_NUM", LUA_NATIVE_PED_GET_PED_HEAD_OVERLAY_NUM);
-		PED.set_function("SET_PED_HEAD_OVERLAY_TINT", LUA_NATIVE_PED_SET_PED_HEAD_OVERLAY_TINT);
-		PED.set_function("SET_PED_HAIR_TINT", LUA_NATIVE_PED_SET_PED_HAIR_TINT);
-		PED.set_function("GET_NUM_PED_HAIR_TINTS", LUA_NATIVE_PED_GET_NUM_PED_HAIR_TINTS);
-		PED.set_function("GET_NUM_PED_MAKEUP_TINTS", LUA_NATIVE_PED_GET_NUM_PED_MAKEUP_TINTS);
-		PED.set_function("GET_PED_HAIR_TINT_COLOR", LUA_NATIVE_PED_GET_PED_HAIR_TINT_COLOR);
-		PED.set_function("GET_PED_MAKEUP_TINT_COLOR", LUA_NATIVE_PED_GET_PED_MAKEUP_TINT_COLOR);
-		PED.set_function("IS_PED_HAIR_TINT_FOR_CREATOR", LUA_NATIVE_PED_IS_PED_HAIR_TINT_FOR_CREATOR);
-		PED.set_function("GET_DEFAULT_SECONDARY_TINT_FOR_CREATOR", LUA_NATIVE_PED_GET_DEFAULT_SECONDARY_TINT_FOR_CREATOR);
-		PED.set_function("IS_PED_LIPSTICK_TINT_FOR_CREATOR", LUA_NATIVE_PED_IS_PED_LIPSTICK_TINT_FOR_CREATOR);
-		PED.set_function("IS_PED_BLUSH_TINT_FOR_CREATOR", LUA_NATIVE_PED_IS_PED_BLUSH_TINT_FOR_CREATOR);
-		PED.set_function("IS_PED_HAIR_TINT_FOR_BARBER", LUA_NATIVE_PED_IS_PED_HAIR_TINT_FOR_BARBER);
-		PED.set_function("GET_DEFAULT_SECONDARY_TINT_FOR_BARBER", LUA_NATIVE_PED_GET_DEFAULT_SECONDARY_TINT_FOR_BARBER);
-		PED.set_function("IS_PED_LIPSTICK_TINT_FOR_BARBER", LUA_NATIVE_PED_IS_PED_LIPSTICK_TINT_FOR_BARBER);
-		PED.set_function("IS_PED_BLUSH_TINT_FOR_BARBER", LUA_NATIVE_PED_IS_PED_BLUSH_TINT_FOR_BARBER);
-		PED.set_function("IS_PED_BLUSH_FACEPAINT_TINT_FOR_BARBER", LUA_NATIVE_PED_IS_PED_BLUSH_FACEPAINT_TINT_FOR_BARBER);
-		PED.set_function("GET_TINT_INDEX_FOR_LAST_GEN_HAIR_TEXTURE", LUA_NATIVE_PED_GET_TINT_INDEX_FOR_LAST_GEN_HAIR_TEXTURE);
-		PED.set_function("SET_PED_MICRO_MORPH", LUA_NATIVE_PED_SET_PED_MICRO_MORPH);
-		PED.set_function("HAS_PED_HEAD_BLEND_FINISHED", LUA_NATIVE_PED_HAS_PED_HEAD_BLEND_FINISHED);
-		PED.set_function("FINALIZE_HEAD_BLEND", LUA_NATIVE_PED_FINALIZE_HEAD_BLEND);
-		PED.set_function("SET_HEAD_BLEND_PALETTE_COLOR", LUA_NATIVE_PED_SET_HEAD_BLEND_PALETTE_COLOR);
-		PED.set_function("DISABLE_HEAD_BLEND_PALETTE_COLOR", LUA_NATIVE_PED_DISABLE_HEAD_BLEND_PALETTE_COLOR);
-		PED.set_function("GET_PED_HEAD_BLEND_FIRST_INDEX", LUA_NATIVE_PED_GET_PED_HEAD_BLEND_FIRST_INDEX);
-		PED.set_function("GET_PED_HEAD_BLEND_NUM_HEADS", LUA_NATIVE_PED_GET_PED_HEAD_BLEND_NUM_HEADS);
-		PED.set_function("SET_PED_PRELOAD_VARIATION_DATA", LUA_NATIVE_PED_SET_PED_PRELOAD_VARIATION_DATA);
-		PED.set_function("HAS_PED_PRELOAD_VARIATION_DATA_FINISHED", LUA_NATIVE_PED_HAS_PED_PRELOAD_VARIATION_DATA_FINISHED);
-		PED.set_function("RELEASE_PED_PRELOAD_VARIATION_DATA", LUA_NATIVE_PED_RELEASE_PED_PRELOAD_VARIATION_DATA);
-		PED.set_function("SET_PED_PRELOAD_PROP_DATA", LUA_NATIVE_PED_SET_PED_PRELOAD_PROP_DATA);
-		PED.set_function("HAS_PED_PRELOAD_PROP_DATA_FINISHED", LUA_NATIVE_PED_HAS_PED_PRELOAD_PROP_DATA_FINISHED);
-		PED.set_function("RELEASE_PED_PRELOAD_PROP_DATA", LUA_NATIVE_PED_RELEASE_PED_PRELOAD_PROP_DATA);
-		PED.set_function("GET_PED_PROP_INDEX", LUA_NATIVE_PED_GET_PED_PROP_INDEX);
-		PED.set_function("SET_PED_PROP_INDEX", LUA_NATIVE_PED_SET_PED_PROP_INDEX);
-		PED.set_function("KNOCK_OFF_PED_PROP", LUA_NATIVE_PED_KNOCK_OFF_PED_PROP);
-		PED.set_function("CLEAR_PED_PROP", LUA_NATIVE_PED_CLEAR_PED_PROP);
-		PED.set_function("CLEAR_ALL_PED_PROPS", LUA_NATIVE_PED_CLEAR_ALL_PED_PROPS);
-		PED.set_function("DROP_AMBIENT_PROP", LUA_NATIVE_PED_DROP_AMBIENT_PROP);
-		PED.set_function("GET_PED_PROP_TEXTURE_INDEX", LUA_NATIVE_PED_GET_PED_PROP_TEXTURE_INDEX);
-		PED.set_function("CLEAR_PED_PARACHUTE_PACK_VARIATION", LUA_NATIVE_PED_CLEAR_PED_PARACHUTE_PACK_VARIATION);
-		PED.set_function("SET_PED_SCUBA_GEAR_VARIATION", LUA_NATIVE_PED_SET_PED_SCUBA_GEAR_VARIATION);
-		PED.set_function("CLEAR_PED_SCUBA_GEAR_VARIATION", LUA_NATIVE_PED_CLEAR_PED_SCUBA_GEAR_VARIATION);
-		PED.set_function("IS_USING_PED_SCUBA_GEAR_VARIATION", LUA_NATIVE_PED_IS_USING_PED_SCUBA_GEAR_VARIATION);
-		PED.set_function("SET_BLOCKING_OF_NON_TEMPORARY_EVENTS", LUA_NATIVE_PED_SET_BLOCKING_OF_NON_TEMPORARY_EVENTS);
-		PED.set_function("SET_PED_BOUNDS_ORIENTATION", LUA_NATIVE_PED_SET_PED_BOUNDS_ORIENTATION);
-		PED.set_function("REGISTER_TARGET", LUA_NATIVE_PED_REGISTER_TARGET);
-		PED.set_function("REGISTER_HATED_TARGETS_AROUND_PED", LUA_NATIVE_PED_REGISTER_HATED_TARGETS_AROUND_PED);
-		PED.set_function("GET_RANDOM_PED_AT_COORD", LUA_NATIVE_PED_GET_RANDOM_PED_AT_COORD);
-		PED.set_function("GET_CLOSEST_PED", LUA_NATIVE_PED_GET_CLOSEST_PED);
-		PED.set_function("SET_SCENARIO_PEDS_TO_BE_RETURNED_BY_NEXT_COMMAND", LUA_NATIVE_PED_SET_SCENARIO_PEDS_TO_BE_RETURNED_BY_NEXT_COMMAND);
-		PED.set_function("GET_CAN_PED_BE_GRABBED_BY_SCRIPT", LUA_NATIVE_PED_GET_CAN_PED_BE_GRABBED_BY_SCRIPT);
-		PED.set_function("SET_DRIVER_RACING_MODIFIER", LUA_NATIVE_PED_SET_DRIVER_RACING_MODIFIER);
-		PED.set_function("SET_DRIVER_ABILITY", LUA_NATIVE_PED_SET_DRIVER_ABILITY);
-		PED.set_function("SET_DRIVER_AGGRESSIVENESS", LUA_NATIVE_PED_SET_DRIVER_AGGRESSIVENESS);
-		PED.set_function("CAN_PED_RAGDOLL", LUA_NATIVE_PED_CAN_PED_RAGDOLL);
-		PED.set_function("SET_PED_TO_RAGDOLL", LUA_NATIVE_PED_SET_PED_TO_RAGDOLL);
-		PED.set_function("SET_PED_TO_RAGDOLL_WITH_FALL", LUA_NATIVE_PED_SET_PED_TO_RAGDOLL_WITH_FALL);
-		PED.set_function("SET_PED_RAGDOLL_ON_COLLISION", LUA_NATIVE_PED_SET_PED_RAGDOLL_ON_COLLISION);
-		PED.set_function("IS_PED_RAGDOLL", LUA_NATIVE_PED_IS_PED_RAGDOLL);
-		PED.set_function("IS_PED_RUNNING_RAGDOLL_TASK", LUA_NATIVE_PED_IS_PED_RUNNING_RAGDOLL_TASK);
-		PED.set_function("SET_PED_RAGDOLL_FORCE_FALL", LUA_NATIVE_PED_SET_PED_RAGDOLL_FORCE_FALL);
-		PED.set_function("RESET_PED_RAGDOLL_TIMER", LUA_NATIVE_PED_RESET_PED_RAGDOLL_TIMER);
-		PED.set_function("SET_PED_CAN_RAGDOLL", LUA_NATIVE_PED_SET_PED_CAN_RAGDOLL);
-		PED.set_function("IS_PED_RUNNING_MELEE_TASK", LUA_NATIVE_PED_IS_PED_RUNNING_MELEE_TASK);
-		PED.set_function("IS_PED_RUNNING_MOBILE_PHONE_TASK", LUA_NATIVE_PED_IS_PED_RUNNING_MOBILE_PHONE_TASK);
-		PED.set_function("IS_MOBILE_PHONE_TO_PED_EAR", LUA_NATIVE_PED_IS_MOBILE_PHONE_TO_PED_EAR);
-		PED.set_function("SET_RAGDOLL_BLOCKING_FLAGS", LUA_NATIVE_PED_SET_RAGDOLL_BLOCKING_FLAGS);
-		PED.set_function("CLEAR_RAGDOLL_BLOCKING_FLAGS", LUA_NATIVE_PED_CLEAR_RAGDOLL_BLOCKING_FLAGS);
-		PED.set_function("SET_PED_ANGLED_DEFENSIVE_AREA", LUA_NATIVE_PED_SET_PED_ANGLED_DEFENSIVE_AREA);
-		PED.set_function("SET_PED_SPHERE_DEFENSIVE_AREA", LUA_NATIVE_PED_SET_PED_SPHERE_DEFENSIVE_AREA);
-		PED.set_function("SET_PED_DEFENSIVE_SPHERE_ATTACHED_TO_PED", LUA_NATIVE_PED_SET_PED_DEFENSIVE_SPHERE_ATTACHED_TO_PED);
-		PED.set_function("SET_PED_DEFENSIVE_SPHERE_ATTACHED_TO_VEHICLE", LUA_NATIVE_PED_SET_PED_DEFENSIVE_SPHERE_ATTACHED_TO_VEHICLE);
-		PED.set_function("SET_PED_DEFENSIVE_AREA_ATTACHED_TO_PED", LUA_NATIVE_PED_SET_PED_DEFENSIVE_AREA_ATTACHED_TO_PED);
-		PED.set_function("SET_PED_DEFENSIVE_AREA_DIRECTION", LUA_NATIVE_PED_SET_PED_DEFENSIVE_AREA_DIRECTION);
-		PED.set_function("REMOVE_PED_DEFENSIVE_AREA", LUA_NATIVE_PED_REMOVE_PED_DEFENSIVE_AREA);
-		PED.set_function("GET_PED_DEFENSIVE_AREA_POSITION", LUA_NATIVE_PED_GET_PED_DEFENSIVE_AREA_POSITION);
-		PED.set_function("IS_PED_DEFENSIVE_AREA_ACTIVE", LUA_NATIVE_PED_IS_PED_DEFENSIVE_AREA_ACTIVE);
-		PED.set_function("SET_PED_PREFERRED_COVER_SET", LUA_NATIVE_PED_SET_PED_PREFERRED_COVER_SET);
-		PED.set_function("REMOVE_PED_PREFERRED_COVER_SET", LUA_NATIVE_PED_REMOVE_PED_PREFERRED_COVER_SET);
-		PED.set_function("REVIVE_INJURED_PED", LUA_NATIVE_PED_REVIVE_INJURED_PED);
-		PED.set_function("RESURRECT_PED", LUA_NATIVE_PED_RESURRECT_PED);
-		PED.set_function("SET_PED_NAME_DEBUG", LUA_NATIVE_PED_SET_PED_NAME_DEBUG);
-		PED.set_function("GET_PED_EXTRACTED_DISPLACEMENT", LUA_NATIVE_PED_GET_PED_EXTRACTED_DISPLACEMENT);
-		PED.set_function("SET_PED_DIES_WHEN_INJURED", LUA_NATIVE_PED_SET_PED_DIES_WHEN_INJURED);
-		PED.set_function("SET_PED_ENABLE_WEAPON_BLOCKING", LUA_NATIVE_PED_SET_PED_ENABLE_WEAPON_BLOCKING);
-		PED.set_function("SPECIAL_FUNCTION_DO_NOT_USE", LUA_NATIVE_PED_SPECIAL_FUNCTION_DO_NOT_USE);
-		PED.set_function("RESET_PED_VISIBLE_DAMAGE", LUA_NATIVE_PED_RESET_PED_VISIBLE_DAMAGE);
-		PED.set_function("APPLY_PED_BLOOD_DAMAGE_BY_ZONE", LUA_NATIVE_PED_APPLY_PED_BLOOD_DAMAGE_BY_ZONE);
-		PED.set_function("APPLY_PED_BLOOD", LUA_NATIVE_PED_APPLY_PED_BLOOD);
-		PED.set_function("APPLY_PED_BLOOD_BY_ZONE", LUA_NATIVE_PED_APPLY_PED_BLOOD_BY_ZONE);
-		PED.set_function("APPLY_PED_BLOOD_SPECIFIC", LUA_NATIVE_PED_APPLY_PED_BLOOD_SPECIFIC);
-		PED.set_function("APPLY_PED_DAMAGE_DECAL", LUA_NATIVE_PED_APPLY_PED_DAMAGE_DECAL);
-		PED.set_function("APPLY_PED_DAMAGE_PACK", LUA_NATIVE_PED_APPLY_PED_DAMAGE_PACK);
-		PED.set_function("CLEAR_PED_BLOOD_DAMAGE", LUA_NATIVE_PED_CLEAR_PED_BLOOD_DAMAGE);
-		PED.set_function("CLEAR_PED_BLOOD_DAMAGE_BY_ZONE", LUA_NATIVE_PED_CLEAR_PED_BLOOD_DAMAGE_BY_ZONE);
-		PED.set_function("HIDE_PED_BLOOD_DAMAGE_BY_ZONE", LUA_NATIVE_PED_HIDE_PED_BLOOD_DAMAGE_BY_ZONE);
-		PED.set_function("CLEAR_PED_DAMAGE_DECAL_BY_ZONE", LUA_NATIVE_PED_CLEAR_PED_DAMAGE_DECAL_BY_ZONE);
-		PED.set_function("GET_PED_DECORATIONS_STATE", LUA_NATIVE_PED_GET_PED_DECORATIONS_STATE);
-		PED.set_function("MARK_PED_DECORATIONS_AS_CLONED_FROM_LOCAL_PLAYER", LUA_NATIVE_PED_MARK_PED_DECORATIONS_AS_CLONED_FROM_LOCAL_PLAYER);
-		PED.set_function("CLEAR_PED_WETNESS", LUA_NATIVE_PED_CLEAR_PED_WETNESS);
-		PED.set_function("SET_PED_WETNESS_HEIGHT", LUA_NATIVE_PED_SET_PED_WETNESS_HEIGHT);
-		PED.set_function("SET_PED_WETNESS_ENABLED_THIS_FRAME", LUA_NATIVE_PED_SET_PED_WETNESS_ENABLED_THIS_FRAME);
-		PED.set_function("SET_PED_WETNESS", LUA_NATIVE_PED_SET_PED_WETNESS);
-		PED.set_function("CLEAR_PED_ENV_DIRT", LUA_NATIVE_PED_CLEAR_PED_ENV_DIRT);
-		PED.set_function("SET_PED_SWEAT", LUA_NATIVE_PED_SET_PED_SWEAT);
-		PED.set_function("ADD_PED_DECORATION_FROM_HASHES", LUA_NATIVE_PED_ADD_PED_DECORATION_FROM_HASHES);
-		PED.set_function("ADD_PED_DECORATION_FROM_HASHES_IN_CORONA", LUA_NATIVE_PED_ADD_PED_DECORATION_FROM_HASHES_IN_CORONA);
-		PED.set_function("GET_PED_DECORATION_ZONE_FROM_HASHES", LUA_NATIVE_PED_GET_PED_DECORATION_ZONE_FROM_HASHES);
-		PED.set_function("CLEAR_PED_DECORATIONS", LUA_NATIVE_PED_CLEAR_PED_DECORATIONS);
-		PED.set_function("CLEAR_PED_DECORATIONS_LEAVE_SCARS", LUA_NATIVE_PED_CLEAR_PED_DECORATIONS_LEAVE_SCARS);
-		PED.set_function("WAS_PED_SKELETON_UPDATED", LUA_NATIVE_PED_WAS_PED_SKELETON_UPDATED);
-		PED.set_function("GET_PED_BONE_COORDS", LUA_NATIVE_PED_GET_PED_BONE_COORDS);
-		PED.set_function("CREATE_NM_MESSAGE", LUA_NATIVE_PED_CREATE_NM_MESSAGE);
-		PED.set_function("GIVE_PED_NM_MESSAGE", LUA_NATIVE_PED_GIVE_PED_NM_MESSAGE);
-		PED.set_function("ADD_SCENARIO_BLOCKING_AREA", LUA_NATIVE_PED_ADD_SCENARIO_BLOCKING_AREA);
-		PED.set_function("REMOVE_SCENARIO_BLOCKING_AREAS", LUA_NATIVE_PED_REMOVE_SCENARIO_BLOCKING_AREAS);
-		PED.set_function("REMOVE_SCENARIO_BLOCKING_AREA", LUA_NATIVE_PED_REMOVE_SCENARIO_BLOCKING_AREA);
-		PED.set_function("SET_SCENARIO_PEDS_SPAWN_IN_SPHERE_AREA", LUA_NATIVE_PED_SET_SCENARIO_PEDS_SPAWN_IN_SPHERE_AREA);
-		PED.set_function("DOES_SCENARIO_BLOCKING_AREA_EXISTS", LUA_NATIVE_PED_DOES_SCENARIO_BLOCKING_AREA_EXISTS);
-		PED.set_function("IS_PED_USING_SCENARIO", LUA_NATIVE_PED_IS_PED_USING_SCENARIO);
-		PED.set_function("IS_PED_USING_ANY_SCENARIO", LUA_NATIVE_PED_IS_PED_USING_ANY_SCENARIO);
-		PED.set_function("SET_PED_PANIC_EXIT_SCENARIO", LUA_NATIVE_PED_SET_PED_PANIC_EXIT_SCENARIO);
-		PED.set_function("TOGGLE_SCENARIO_PED_COWER_IN_PLACE", LUA_NATIVE_PED_TOGGLE_SCENARIO_PED_COWER_IN_PLACE);
-		PED.set_function("TRIGGER_PED_SCENARIO_PANICEXITTOFLEE", LUA_NATIVE_PED_TRIGGER_PED_SCENARIO_PANICEXITTOFLEE);
-		PED.set_function("SET_PED_SHOULD_PLAY_DIRECTED_NORMAL_SCENARIO_EXIT", LUA_NATIVE_PED_SET_PED_SHOULD_PLAY_DIRECTED_NORMAL_SCENARIO_EXIT);
-		PED.set_function("SET_PED_SHOULD_PLAY_NORMAL_SCENARIO_EXIT", LUA_NATIVE_PED_SET_PED_SHOULD_PLAY_NORMAL_SCENARIO_EXIT);
-		PED.set_function("SET_PED_SHOULD_PLAY_IMMEDIATE_SCENARIO_EXIT", LUA_NATIVE_PED_SET_PED_SHOULD_PLAY_IMMEDIATE_SCENARIO_EXIT);
-		PED.set_function("SET_PED_SHOULD_PLAY_FLEE_SCENARIO_EXIT", LUA_NATIVE_PED_SET_PED_SHOULD_PLAY_FLEE_SCENARIO_EXIT);
-		PED.set_function("SET_PED_SHOULD_IGNORE_SCENARIO_EXIT_COLLISION_CHECKS", LUA_NATIVE_PED_SET_PED_SHOULD_IGNORE_SCENARIO_EXIT_COLLISION_CHECKS);
-		PED.set_function("SET_PED_SHOULD_IGNORE_SCENARIO_NAV_CHECKS", LUA_NATIVE_PED_SET_PED_SHOULD_IGNORE_SCENARIO_NAV_CHECKS);
-		PED.set_function("SET_PED_SHOULD_PROBE_FOR_SCENARIO_EXITS_IN_ONE_FRAME", LUA_NATIVE_PED_SET_PED_SHOULD_PROBE_FOR_SCENARIO_EXITS_IN_ONE_FRAME);
-		PED.set_function("IS_PED_GESTURING", LUA_NATIVE_PED_IS_PED_GESTURING);
-		PED.set_function("RESET_FACIAL_IDLE_ANIM", LUA_NATIVE_PED_RESET_FACIAL_IDLE_ANIM);
-		PED.set_function("PLAY_FACIAL_ANIM", LUA_NATIVE_PED_PLAY_FACIAL_ANIM);
-		PED.set_function("SET_FACIAL_CLIPSET", LUA_NATIVE_PED_SET_FACIAL_CLIPSET);
-		PED.set_function("SET_FACIAL_IDLE_ANIM_OVERRIDE", LUA_NATIVE_PED_SET_FACIAL_IDLE_ANIM_OVERRIDE);
-		PED.set_function("CLEAR_FACIAL_IDLE_ANIM_OVERRIDE", LUA_NATIVE_PED_CLEAR_FACIAL_IDLE_ANIM_OVERRIDE);
-		PED.set_function("SET_PED_CAN_PLAY_GESTURE_ANIMS", LUA_NATIVE_PED_SET_PED_CAN_PLAY_GESTURE_ANIMS);
-		PED.set_function("SET_PED_CAN_PLAY_VISEME_ANIMS", LUA_NATIVE_PED_SET_PED_CAN_PLAY_VISEME_ANIMS);
-		PED.set_function("SET_PED_IS_IGNORED_BY_AUTO_OPEN_DOORS", LUA_NATIVE_PED_SET_PED_IS_IGNORED_BY_AUTO_OPEN_DOORS);
-		PED.set_function("SET_PED_CAN_PLAY_AMBIENT_ANIMS", LUA_NATIVE_PED_SET_PED_CAN_PLAY_AMBIENT_ANIMS);
-		PED.set_function("SET_PED_CAN_PLAY_AMBIENT_BASE_ANIMS", LUA_NATIVE_PED_SET_PED_CAN_PLAY_AMBIENT_BASE_ANIMS);
-		PED.set_function("TRIGGER_IDLE_ANIMATION_ON_PED", LUA_NATIVE_PED_TRIGGER_IDLE_ANIMATION_ON_PED);
-		PED.set_function("SET_PED_CAN_ARM_IK", LUA_NATIVE_PED_SET_PED_CAN_ARM_IK);
-		PED.set_function("SET_PED_CAN_HEAD_IK", LUA_NATIVE_PED_SET_PED_CAN_HEAD_IK);
-		PED.set_function("SET_PED_CAN_LEG_IK", LUA_NATIVE_PED_SET_PED_CAN_LEG_IK);
-		PED.set_function("SET_PED_CAN_TORSO_IK", LUA_NATIVE_PED_SET_PED_CAN_TORSO_IK);
-		PED.set_function("SET_PED_CAN_TORSO_REACT_IK", LUA_NATIVE_PED_SET_PED_CAN_TORSO_REACT_IK);
-		PED.set_function("SET_PED_CAN_TORSO_VEHICLE_IK", LUA_NATIVE_PED_SET_PED_CAN_TORSO_VEHICLE_IK);
-		PED.set_function("SET_PED_CAN_USE_AUTO_CONVERSATION_LOOKAT", LUA_NATIVE_PED_SET_PED_CAN_USE_AUTO_CONVERSATION_LOOKAT);
-		PED.set_function("IS_PED_HEADTRACKING_PED", LUA_NATIVE_PED_IS_PED_HEADTRACKING_PED);
-		PED.set_function("IS_PED_HEADTRACKING_ENTITY", LUA_NATIVE_PED_IS_PED_HEADTRACKING_ENTITY);
-		PED.set_function("SET_PED_PRIMARY_LOOKAT", LUA_NATIVE_PED_SET_PED_PRIMARY_LOOKAT);
-		PED.set_function("SET_PED_CLOTH_PIN_FRAMES", LUA_NATIVE_PED_SET_PED_CLOTH_PIN_FRAMES);
-		PED.set_function("SET_PED_CLOTH_PACKAGE_INDEX", LUA_NATIVE_PED_SET_PED_CLOTH_PACKAGE_INDEX);
-		PED.set_function("SET_PED_CLOTH_PRONE", LUA_NATIVE_PED_SET_PED_CLOTH_PRONE);
-		PED.set_function("SET_PED_CONFIG_FLAG", LUA_NATIVE_PED_SET_PED_CONFIG_FLAG);
-		PED.set_function("SET_PED_RESET_FLAG", LUA_NATIVE_PED_SET_PED_RESET_FLAG);
-		PED.set_function("GET_PED_CONFIG_FLAG", LUA_NATIVE_PED_GET_PED_CONFIG_FLAG);
-		PED.set_function("GET_PED_RESET_FLAG", LUA_NATIVE_PED_GET_PED_RESET_FLAG);
-		PED.set_function("SET_PED_GROUP_MEMBER_PASSENGER_INDEX", LUA_NATIVE_PED_SET_PED_GROUP_MEMBER_PASSENGER_INDEX);
-		PED.set_function("SET_PED_CAN_EVASIVE_DIVE", LUA_NATIVE_PED_SET_PED_CAN_EVASIVE_DIVE);
-		PED.set_function("IS_PED_EVASIVE_DIVING", LUA_NATIVE_PED_IS_PED_EVASIVE_DIVING);
-		PED.set_function("SET_PED_SHOOTS_AT_COORD", LUA_NATIVE_PED_SET_PED_SHOOTS_AT_COORD);
-		PED.set_function("SET_PED_MODEL_IS_SUPPRESSED", LUA_NATIVE_PED_SET_PED_MODEL_IS_SUPPRESSED);
-		PED.set_function("STOP_ANY_PED_MODEL_BEING_SUPPRESSED", LUA_NATIVE_PED_STOP_ANY_PED_MODEL_BEING_SUPPRESSED);
-		PED.set_function("SET_PED_CAN_BE_TARGETED_WHEN_INJURED", LUA_NATIVE_PED_SET_PED_CAN_BE_TARGETED_WHEN_INJURED);
-		PED.set_function("SET_PED_GENERATES_DEAD_BODY_EVENTS", LUA_NATIVE_PED_SET_PED_GENERATES_DEAD_BODY_EVENTS);
-		PED.set_function("BLOCK_PED_FROM_GENERATING_DEAD_BODY_EVENTS_WHEN_DEAD", LUA_NATIVE_PED_BLOCK_PED_FROM_GENERATING_DEAD_BODY_EVENTS_WHEN_DEAD);
-		PED.set_function("SET_PED_WILL_ONLY_ATTACK_WANTED_PLAYER", LUA_NATIVE_PED_SET_PED_WILL_ONLY_ATTACK_WANTED_PLAYER);
-		PED.set_function("SET_PED_CAN_RAGDOLL_FROM_PLAYER_IMPACT", LUA_NATIVE_PED_SET_PED_CAN_RAGDOLL_FROM_PLAYER_IMPACT);
-		PED.set_function("GIVE_PED_HELMET", LUA_NATIVE_PED_GIVE_PED_HELMET);
-		PED.set_function("REMOVE_PED_HELMET", LUA_NATIVE_PED_REMOVE_PED_HELMET);
-		PED.set_function("IS_PED_TAKING_OFF_HELMET", LUA_NATIVE_PED_IS_PED_TAKING_OFF_HELMET);
-		PED.set_function("SET_PED_HELMET", LUA_NATIVE_PED_SET_PED_HELMET);
-		PED.set_function("SET_PED_HELMET_FLAG", LUA_NATIVE_PED_SET_PED_HELMET_FLAG);
-		PED.set_function("SET_PED_HELMET_PROP_INDEX", LUA_NATIVE_PED_SET_PED_HELMET_PROP_INDEX);
-		PED.set_function("SET_PED_HELMET_VISOR_PROP_INDICES", LUA_NATIVE_PED_SET_PED_HELMET_VISOR_PROP_INDICES);
-		PED.set_function("IS_PED_HELMET_VISOR_UP", LUA_NATIVE_PED_IS_PED_HELMET_VISOR_UP);
-		PED.set_function("SET_PED_HELMET_TEXTURE_INDEX", LUA_NATIVE_PED_SET_PED_HELMET_TEXTURE_INDEX);
-		PED.set_function("IS_PED_WEARING_HELMET", LUA_NATIVE_PED_IS_PED_WEARING_HELMET);
-		PED.set_function("CLEAR_PED_STORED_HAT_PROP", LUA_NATIVE_PED_CLEAR_PED_STORED_HAT_PROP);
-		PED.set_function("GET_PED_HELMET_STORED_HAT_PROP_INDEX", LUA_NATIVE_PED_GET_PED_HELMET_STORED_HAT_PROP_INDEX);
-		PED.set_function("GET_PED_HELMET_STORED_HAT_TEX_INDEX", LUA_NATIVE_PED_GET_PED_HELMET_STORED_HAT_TEX_INDEX);
-		PED.set_function("IS_CURRENT_HEAD_PROP_A_HELMET", LUA_NATIVE_PED_IS_CURRENT_HEAD_PROP_A_HELMET);
-		PED.set_function("SET_PED_TO_LOAD_COVER", LUA_NATIVE_PED_SET_PED_TO_LOAD_COVER);
-		PED.set_function("SET_PED_CAN_COWER_IN_COVER", LUA_NATIVE_PED_SET_PED_CAN_COWER_IN_COVER);
-		PED.set_function("SET_PED_CAN_PEEK_IN_COVER", LUA_NATIVE_PED_SET_PED_CAN_PEEK_IN_COVER);
-		PED.set_function("SET_PED_PLAYS_HEAD_ON_HORN_ANIM_WHEN_DIES_IN_VEHICLE", LUA_NATIVE_PED_SET_PED_PLAYS_HEAD_ON_HORN_ANIM_WHEN_DIES_IN_VEHICLE);
-		PED.set_function("SET_PED_LEG_IK_MODE", LUA_NATIVE_PED_SET_PED_LEG_IK_MODE);
-		PED.set_function("SET_PED_MOTION_BLUR", LUA_NATIVE_PED_SET_PED_MOTION_BLUR);
-		PED.set_function("SET_PED_CAN_SWITCH_WEAPON", LUA_NATIVE_PED_SET_PED_CAN_SWITCH_WEAPON);
-		PED.set_function("SET_PED_DIES_INSTANTLY_IN_WATER", LUA_NATIVE_PED_SET_PED_DIES_INSTANTLY_IN_WATER);
-		PED.set_function("SET_LADDER_CLIMB_INPUT_STATE", LUA_NATIVE_PED_SET_LADDER_CLIMB_INPUT_STATE);
-		PED.set_function("STOP_PED_WEAPON_FIRING_WHEN_DROPPED", LUA_NATIVE_PED_STOP_PED_WEAPON_FIRING_WHEN_DROPPED);
-		PED.set_function("SET_SCRIPTED_ANIM_SEAT_OFFSET", LUA_NATIVE_PED_SET_SCRIPTED_ANIM_SEAT_OFFSET);
-		PED.set_function("SET_PED_COMBAT_MOVEMENT", LUA_NATIVE_PED_SET_PED_COMBAT_MOVEMENT);
-		PED.set_function("GET_PED_COMBAT_MOVEMENT", LUA_NATIVE_PED_GET_PED_COMBAT_MOVEMENT);
-		PED.set_function("SET_PED_COMBAT_ABILITY", LUA_NATIVE_PED_SET_PED_COMBAT_ABILITY);
-		PED.set_function("SET_PED_COMBAT_RANGE", LUA_NATIVE_PED_SET_PED_COMBAT_RANGE);
-		PED.set_function("GET_PED_COMBAT_RANGE", LUA_NATIVE_PED_GET_PED_COMBAT_RANGE);
-		PED.set_function("SET_PED_COMBAT_ATTRIBUTES", LUA_NATIVE_PED_SET_PED_COMBAT_ATTRIBUTES);
-		PED.set_function("SET_PED_TARGET_LOSS_RESPONSE", LUA_NATIVE_PED_SET_PED_TARGET_LOSS_RESPONSE);
-		PED.set_function("IS_PED_PERFORMING_MELEE_ACTION", LUA_NATIVE_PED_IS_PED_PERFORMING_MELEE_ACTION);
-		PED.set_function("IS_PED_PERFORMING_STEALTH_KILL", LUA_NATIVE_PED_IS_PED_PERFORMING_STEALTH_KILL);
-		PED.set_function("IS_PED_PERFORMING_A_COUNTER_ATTACK", LUA_NATIVE_PED_IS_PED_PERFORMING_A_COUNTER_ATTACK);
-		PED.set_function("IS_PED_BEING_STEALTH_KILLED", LUA_NATIVE_PED_IS_PED_BEING_STEALTH_KILLED);
-		PED.set_function("GET_MELEE_TARGET_FOR_PED", LUA_NATIVE_PED_GET_MELEE_TARGET_FOR_PED);
-		PED.set_function("WAS_PED_KILLED_BY_STEALTH", LUA_NATIVE_PED_WAS_PED_KILLED_BY_STEALTH);
-		PED.set_function("WAS_PED_KILLED_BY_TAKEDOWN", LUA_NATIVE_PED_WAS_PED_KILLED_BY_TAKEDOWN);
-		PED.set_function("WAS_PED_KNOCKED_OUT", LUA_NATIVE_PED_WAS_PED_KNOCKED_OUT);
-		PED.set_function("SET_PED_FLEE_ATTRIBUTES", LUA_NATIVE_PED_SET_PED_FLEE_ATTRIBUTES);
-		PED.set_function("SET_PED_COWER_HASH", LUA_NATIVE_PED_SET_PED_COWER_HASH);
-		PED.set_function("SET_PED_STEERS_AROUND_DEAD_BODIES", LUA_NATIVE_PED_SET_PED_STEERS_AROUND_DEAD_BODIES);
-		PED.set_function("SET_PED_STEERS_AROUND_PEDS", LUA_NATIVE_PED_SET_PED_STEERS_AROUND_PEDS);
-		PED.set_function("SET_PED_STEERS_AROUND_OBJECTS", LUA_NATIVE_PED_SET_PED_STEERS_AROUND_OBJECTS);
-		PED.set_function("SET_PED_STEERS_AROUND_VEHICLES", LUA_NATIVE_PED_SET_PED_STEERS_AROUND_VEHICLES);
-		PED.set_function("SET_PED_IS_AVOIDED_BY_OTHERS", LUA_NATIVE_PED_SET_PED_IS_AVOIDED_BY_OTHERS);
-		PED.set_function("SET_PED_INCREASED_AVOIDANCE_RADIUS", LUA_NATIVE_PED_SET_PED_INCREASED_AVOIDANCE_RADIUS);
-		PED.set_function("SET_PED_BLOCKS_PATHING_WHEN_DEAD", LUA_NATIVE_PED_SET_PED_BLOCKS_PATHING_WHEN_DEAD);
-		PED.set_function("SET_PED_NO_TIME_DELAY_BEFORE_SHOT", LUA_NATIVE_PED_SET_PED_NO_TIME_DELAY_BEFORE_SHOT);
-		PED.set_function("IS_ANY_PED_NEAR_POINT", LUA_NATIVE_PED_IS_ANY_PED_NEAR_POINT);
-		PED.set_function("FORCE_PED_AI_AND_ANIMATION_UPDATE", LUA_NATIVE_PED_FORCE_PED_AI_AND_ANIMATION_UPDATE);
-		PED.set_function("IS_PED_HEADING_TOWARDS_POSITION", LUA_NATIVE_PED_IS_PED_HEADING_TOWARDS_POSITION);
-		PED.set_function("REQUEST_PED_VISIBILITY_TRACKING", LUA_NATIVE_PED_REQUEST_PED_VISIBILITY_TRACKING);
-		PED.set_function("REQUEST_PED_VEHICLE_VISIBILITY_TRACKING", LUA_NATIVE_PED_REQUEST_PED_VEHICLE_VISIBILITY_TRACKING);
-		PED.set_function("REQUEST_PED_RESTRICTED_VEHICLE_VISIBILITY_TRACKING", LUA_NATIVE_PED_REQUEST_PED_RESTRICTED_VEHICLE_VISIBILITY_TRACKING);
-		PED.set_function("REQUEST_PED_USE_SMALL_BBOX_VISIBILITY_TRACKING", LUA_NATIVE_PED_REQUEST_PED_USE_SMALL_BBOX_VISIBILITY_TRACKING);
-		PED.set_function("IS_TRACKED_PED_VISIBLE", LUA_NATIVE_PED_IS_TRACKED_PED_VISIBLE);
-		PED.set_function("GET_TRACKED_PED_PIXELCOUNT", LUA_NATIVE_PED_GET_TRACKED_PED_PIXELCOUNT);
-		PED.set_function("IS_PED_TRACKED", LUA_NATIVE_PED_IS_PED_TRACKED);
-		PED.set_function("HAS_PED_RECEIVED_EVENT", LUA_NATIVE_PED_HAS_PED_RECEIVED_EVENT);
-		PED.set_function("CAN_PED_SEE_HATED_PED", LUA_NATIVE_PED_CAN_PED_SEE_HATED_PED);
-		PED.set_function("CAN_PED_SHUFFLE_TO_OR_FROM_TURRET_SEAT", LUA_NATIVE_PED_CAN_PED_SHUFFLE_TO_OR_FROM_TURRET_SEAT);
-		PED.set_function("CAN_PED_SHUFFLE_TO_OR_FROM_EXTRA_SEAT", LUA_NATIVE_PED_CAN_PED_SHUFFLE_TO_OR_FROM_EXTRA_SEAT);
-		PED.set_function("GET_PED_BONE_INDEX", LUA_NATIVE_PED_GET_PED_BONE_INDEX);
-		PED.set_function("GET_PED_RAGDOLL_BONE_INDEX", LUA_NATIVE_PED_GET_PED_RAGDOLL_BONE_INDEX);
-		PED.set_function("SET_PED_ENVEFF_SCALE", LUA_NATIVE_PED_SET_PED_ENVEFF_SCALE);
-		PED.set_function("GET_PED_ENVEFF_SCALE", LUA_NATIVE_PED_GET_PED_ENVEFF_SCALE);
-		PED.set_function("SET_ENABLE_PED_ENVEFF_SCALE", LUA_NATIVE_PED_SET_ENABLE_PED_ENVEFF_SCALE);
-		PED.set_function("SET_PED_ENVEFF_CPV_ADD", LUA_NATIVE_PED_SET_PED_ENVEFF_CPV_ADD);
-		PED.set_function("SET_PED_ENVEFF_COLOR_MODULATOR", LUA_NATIVE_PED_SET_PED_ENVEFF_COLOR_MODULATOR);
-		PED.set_function("SET_PED_EMISSIVE_SCALE", LUA_NATIVE_PED_SET_PED_EMISSIVE_SCALE);
-		PED.set_function("GET_PED_EMISSIVE_SCALE", LUA_NATIVE_PED_GET_PED_EMISSIVE_SCALE);
-		PED.set_function("IS_PED_SHADER_READY", LUA_NATIVE_PED_IS_PED_SHADER_READY);
-		PED.set_function("SET_PED_ENABLE_CREW_EMBLEM", LUA_NATIVE_PED_SET_PED_ENABLE_CREW_EMBLEM);
-		PED.set_function("REQUEST_RAGDOLL_BOUNDS_UPDATE", LUA_NATIVE_PED_REQUEST_RAGDOLL_BOUNDS_UPDATE);
-		PED.set_function("SET_PED_AO_BLOB_RENDERING", LUA_NATIVE_PED_SET_PED_AO_BLOB_RENDERING);
-		PED.set_function("IS_PED_SHELTERED", LUA_NATIVE_PED_IS_PED_SHELTERED);
-		PED.set_function("CREATE_SYNCHRONIZED_SCENE", LUA_NATIVE_PED_CREATE_SYNCHRONIZED_SCENE);
-		PED.set_function("CREATE_SYNCHRONIZED_SCENE_AT_MAP_OBJECT", LUA_NATIVE_PED_CREATE_SYNCHRONIZED_SCENE_AT_MAP_OBJECT);
-		PED.set_function("IS_SYNCHRONIZED_SCENE_RUNNING", LUA_NATIVE_PED_IS_SYNCHRONIZED_SCENE_RUNNING);
-		PED.set_function("SET_SYNCHRONIZED_SCENE_ORIGIN", LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_ORIGIN);
-		PED.set_function("SET_SYNCHRONIZED_SCENE_PHASE", LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_PHASE);
-		PED.set_function("GET_SYNCHRONIZED_SCENE_PHASE", LUA_NATIVE_PED_GET_SYNCHRONIZED_SCENE_PHASE);
-		PED.set_function("SET_SYNCHRONIZED_SCENE_RATE", LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_RATE);
-		PED.set_function("GET_SYNCHRONIZED_SCENE_RATE", LUA_NATIVE_PED_GET_SYNCHRONIZED_SCENE_RATE);
-		PED.set_function("SET_SYNCHRONIZED_SCENE_LOOPED", LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_LOOPED);
-		PED.set_function("IS_SYNCHRONIZED_SCENE_LOOPED", LUA_NATIVE_PED_IS_SYNCHRONIZED_SCENE_LOOPED);
-		PED.set_function("SET_SYNCHRONIZED_SCENE_HOLD_LAST_FRAME", LUA_NATIVE_PED_SET_SYNCHRONIZED_SCENE_HOLD_LAST_FRAME);
-		PED.set_function("IS_SYNCHRONIZED_SCENE_HOLD_LAST_FRAME", LUA_NATIVE_PED_IS_SYNCHRONIZED_SCENE_HOLD_LAST_FRAME);
-		PED.set_function("ATTACH_SYNCHRONIZED_SCENE_TO_ENTITY", LUA_NATIVE_PED_ATTACH_SYNCHRONIZED_SCENE_TO_ENTITY);
-		PED.set_function("DETACH_SYNCHRONIZED_SCENE", LUA_NATIVE_PED_DETACH_SYNCHRONIZED_SCENE);
-		PED.set_function("TAKE_OWNERSHIP_OF_SYNCHRONIZED_SCENE", LUA_NATIVE_PED_TAKE_OWNERSHIP_OF_SYNCHRONIZED_SCENE);
-		PED.set_function("FORCE_PED_MOTION_STATE", LUA_NATIVE_PED_FORCE_PED_MOTION_STATE);
-		PED.set_function("GET_PED_CURRENT_MOVE_BLEND_RATIO", LUA_NATIVE_PED_GET_PED_CURRENT_MOVE_BLEND_RATIO);
-		PED.set_function("SET_PED_MAX_MOVE_BLEND_RATIO", LUA_NATIVE_PED_SET_PED_MAX_MOVE_BLEND_RATIO);
-		PED.set_function("SET_PED_MIN_MOVE_BLEND_RATIO", LUA_NATIVE_PED_SET_PED_MIN_MOVE_BLEND_RATIO);
-		PED.set_function("SET_PED_MOVE_RATE_OVERRIDE", LUA_NATIVE_PED_SET_PED_MOVE_RATE_OVERRIDE);
-		PED.set_function("SET_PED_MOVE_RATE_IN_WATER_OVERRIDE", LUA_NATIVE_PED_SET_PED_MOVE_RATE_IN_WATER_OVERRIDE);
-		PED.set_function("PED_HAS_SEXINESS_FLAG_SET", LUA_NATIVE_PED_PED_HAS_SEXINESS_FLAG_SET);
-		PED.set_function("GET_PED_NEARBY_VEHICLES", LUA_NATIVE_PED_GET_PED_NEARBY_VEHICLES);
-		PED.set_function("GET_PED_NEARBY_PEDS", LUA_NATIVE_PED_GET_PED_NEARBY_PEDS);
-		PED.set_function("HAVE_ALL_STREAMING_REQUESTS_COMPLETED", LUA_NATIVE_PED_HAVE_ALL_STREAMING_REQUESTS_COMPLETED);
-		PED.set_function("IS_PED_USING_ACTION_MODE", LUA_NATIVE_PED_IS_PED_USING_ACTION_MODE);
-		PED.set_function("SET_PED_USING_ACTION_MODE", LUA_NATIVE_PED_SET_PED_USING_ACTION_MODE);
-		PED.set_function("SET_MOVEMENT_MODE_OVERRIDE", LUA_NATIVE_PED_SET_MOVEMENT_MODE_OVERRIDE);
-		PED.set_function("SET_PED_CAPSULE", LUA_NATIVE_PED_SET_PED_CAPSULE);
-		PED.set_function("REGISTER_PEDHEADSHOT", LUA_NATIVE_PED_REGISTER_PEDHEADSHOT);
-		PED.set_function("REGISTER_PEDHEADSHOT_HIRES", LUA_NATIVE_PED_REGISTER_PEDHEADSHOT_HIRES);
-		PED.set_function("REGISTER_PEDHEADSHOT_TRANSPARENT", LUA_NATIVE_PED_REGISTER_PEDHEADSHOT_TRANSPARENT);
-		PED.set_function("UNREGISTER_PEDHEADSHOT", LUA_NATIVE_PED_UNREGISTER_PEDHEADSHOT);
-		PED.set_function("IS_PEDHEADSHOT_VALID", LUA_NATIVE_PED_IS_PEDHEADSHOT_VALID);
-		PED.set_function("IS_PEDHEADSHOT_READY", LUA_NATIVE_PED_IS_PEDHEADSHOT_READY);
-		PED.set_function("GET_PEDHEADSHOT_TXD_STRING", LUA_NATIVE_PED_GET_PEDHEADSHOT_TXD_STRING);
-		PED.set_function("REQUEST_PEDHEADSHOT_IMG_UPLOAD", LUA_NATIVE_PED_REQUEST_PEDHEADSHOT_IMG_UPLOAD);
-		PED.set_function("RELEASE_PEDHEADSHOT_IMG_UPLOAD", LUA_NATIVE_PED_RELEASE_PEDHEADSHOT_IMG_UPLOAD);
-		PED.set_function("IS_PEDHEADSHOT_IMG_UPLOAD_AVAILABLE", LUA_NATIVE_PED_IS_PEDHEADSHOT_IMG_UPLOAD_AVAILABLE);
-		PED.set_function("HAS_PEDHEADSHOT_IMG_UPLOAD_FAILED", LUA_NATIVE_PED_HAS_PEDHEADSHOT_IMG_UPLOAD_FAILED);
-		PED.set_function("HAS_PEDHEADSHOT_IMG_UPLOAD_SUCCEEDED", LUA_NATIVE_PED_HAS_PEDHEADSHOT_IMG_UPLOAD_SUCCEEDED);
-		PED.set_function("SET_PED_HEATSCALE_OVERRIDE", LUA_NATIVE_PED_SET_PED_HEATSCALE_OVERRIDE);
-		PED.set_function("DISABLE_PED_HEATSCALE_OVERRIDE", LUA_NATIVE_PED_DISABLE_PED_HEATSCALE_OVERRIDE);
-		PED.set_function("SPAWNPOINTS_START_SEARCH", LUA_NATIVE_PED_SPAWNPOINTS_START_SEARCH);
-		PED.set_function("SPAWNPOINTS_START_SEARCH_IN_ANGLED_AREA", LUA_NATIVE_PED_SPAWNPOINTS_START_SEARCH_IN_ANGLED_AREA);
-		PED.set_function("SPAWNPOINTS_CANCEL_SEARCH", LUA_NATIVE_PED_SPAWNPOINTS_CANCEL_SEARCH);
-		PED.set_function("SPAWNPOINTS_IS_SEARCH_ACTIVE", LUA_NATIVE_PED_SPAWNPOINTS_IS_SEARCH_ACTIVE);
-		PED.set_function("SPAWNPOINTS_IS_SEARCH_COMPLETE", LUA_NATIVE_PED_SPAWNPOINTS_IS_SEARCH_COMPLETE);
-		PED.set_function("SPAWNPOINTS_IS_SEARCH_FAILED", LUA_NATIVE_PED_SPAWNPOINTS_IS_SEARCH_FAILED);
-		PED.set_function("SPAWNPOINTS_GET_NUM_SEARCH_RESULTS", LUA_NATIVE_PED_SPAWNPOINTS_GET_NUM_SEARCH_RESULTS);
-		PED.set_function("SPAWNPOINTS_GET_SEARCH_RESULT", LUA_NATIVE_PED_SPAWNPOINTS_GET_SEARCH_RESULT);
-		PED.set_function("SPAWNPOINTS_GET_SEARCH_RESULT_FLAGS", LUA_NATIVE_PED_SPAWNPOINTS_GET_SEARCH_RESULT_FLAGS);
-		PED.set_function("SET_IK_TARGET", LUA_NATIVE_PED_SET_IK_TARGET);
-		PED.set_function("FORCE_INSTANT_LEG_IK_SETUP", LUA_NATIVE_PED_FORCE_INSTANT_LEG_IK_SETUP);
-		PED.set_function("REQUEST_ACTION_MODE_ASSET", LUA_NATIVE_PED_REQUEST_ACTION_MODE_ASSET);
-		PED.set_function("HAS_ACTION_MODE_ASSET_LOADED", LUA_NATIVE_PED_HAS_ACTION_MODE_ASSET_LOADED);
-		PED.set_function("REMOVE_ACTION_MODE_ASSET", LUA_NATIVE_PED_REMOVE_ACTION_MODE_ASSET);
-		PED.set_function("REQUEST_STEALTH_MODE_ASSET", LUA_NATIVE_PED_REQUEST_STEALTH_MODE_ASSET);
-		PED.set_function("HAS_STEALTH_MODE_ASSET_LOADED", LUA_NATIVE_PED_HAS_STEALTH_MODE_ASSET_LOADED);
-		PED.set_function("REMOVE_STEALTH_MODE_ASSET", LUA_NATIVE_PED_REMOVE_STEALTH_MODE_ASSET);
-		PED.set_function("SET_PED_LOD_MULTIPLIER", LUA_NATIVE_PED_SET_PED_LOD_MULTIPLIER);
-		PED.set_function("SET_PED_CAN_LOSE_PROPS_ON_DAMAGE", LUA_NATIVE_PED_SET_PED_CAN_LOSE_PROPS_ON_DAMAGE);
-		PED.set_function("SET_FORCE_FOOTSTEP_UPDATE", LUA_NATIVE_PED_SET_FORCE_FOOTSTEP_UPDATE);
-		PED.set_function("SET_FORCE_STEP_TYPE", LUA_NATIVE_PED_SET_FORCE_STEP_TYPE);
-		PED.set_function("IS_ANY_HOSTILE_PED_NEAR_POINT", LUA_NATIVE_PED_IS_ANY_HOSTILE_PED_NEAR_POINT);
-		PED.set_function("SET_PED_CAN_PLAY_IN_CAR_IDLES", LUA_NATIVE_PED_SET_PED_CAN_PLAY_IN_CAR_IDLES);
-		PED.set_function("IS_TARGET_PED_IN_PERCEPTION_AREA", LUA_NATIVE_PED_IS_TARGET_PED_IN_PERCEPTION_AREA);
-		PED.set_function("SET_POP_CONTROL_SPHERE_THIS_FRAME", LUA_NATIVE_PED_SET_POP_CONTROL_SPHERE_THIS_FRAME);
-		PED.set_function("FORCE_ZERO_MASS_IN_COLLISIONS", LUA_NATIVE_PED_FORCE_ZERO_MASS_IN_COLLISIONS);
-		PED.set_function("SET_DISABLE_HIGH_FALL_DEATH", LUA_NATIVE_PED_SET_DISABLE_HIGH_FALL_DEATH);
-		PED.set_function("SET_PED_PHONE_PALETTE_IDX", LUA_NATIVE_PED_SET_PED_PHONE_PALETTE_IDX);
-		PED.set_function("SET_PED_STEER_BIAS", LUA_NATIVE_PED_SET_PED_STEER_BIAS);
-		PED.set_function("IS_PED_SWITCHING_WEAPON", LUA_NATIVE_PED_IS_PED_SWITCHING_WEAPON);
-		PED.set_function("SET_PED_TREATED_AS_FRIENDLY", LUA_NATIVE_PED_SET_PED_TREATED_AS_FRIENDLY);
-		PED.set_function("SET_DISABLE_PED_MAP_COLLISION", LUA_NATIVE_PED_SET_DISABLE_PED_MAP_COLLISION);
-		PED.set_function("ENABLE_MP_LIGHT", LUA_NATIVE_PED_ENABLE_MP_LIGHT);
-		PED.set_function("GET_MP_LIGHT_ENABLED", LUA_NATIVE_PED_GET_MP_LIGHT_ENABLED);
-		PED.set_function("CLEAR_COVER_POINT_FOR_PED", LUA_NATIVE_PED_CLEAR_COVER_POINT_FOR_PED);
-		PED.set_function("SET_ALLOW_STUNT_JUMP_CAMERA", LUA_NATIVE_PED_SET_ALLOW_STUNT_JUMP_CAMERA);
+		bind_namespace(L, "PED", PED_natives);
 	}
 }
@@ -263,56 +263,59 @@ namespace lua::native
 		PHYSICS::SET_IN_ARENA_MODE(toggle);
 	}
 
+	static constexpr native_entry PHYSICS_natives[] = {
+		{"ACTIVATE_PHYSICS", native_function<LUA_NATIVE_PHYSICS_ACTIVATE_PHYSICS>},
+		{"ADD_ROPE", native_function<LUA_NATIVE_PHYSICS_ADD_ROPE>},
+		{"APPLY_IMPULSE_TO_CLOTH", native_function<LUA_NATIVE_PHYSICS_APPLY_IMPULSE_TO_CLOTH>},
+		{"ATTACH_ENTITIES_TO_ROPE", native_function<LUA_NATIVE_PHYSICS_ATTACH_ENTITIES_TO_ROPE>},
+		{"ATTACH_ROPE_TO_ENTITY", native_function<LUA_NATIVE_PHYSICS_ATTACH_ROPE_TO_ENTITY>},
+		{"BREAK_ENTITY_GLASS", native_function<LUA_NATIVE_PHYSICS_BREAK_ENTITY_GLASS>},
+		{"DELETE_CHILD_ROPE", native_function<LUA_NATIVE_PHYSICS_DELETE_CHILD_ROPE>},
+		{"DELETE_ROPE", native_function<LUA_NATIVE_PHYSICS_DELETE_ROPE>},
+		{"DETACH_ROPE_FROM_ENTITY", native_function<LUA_NATIVE_PHYSICS_DETACH_ROPE_FROM_ENTITY>},
+		{"DOES_ROPE_EXIST", native_function<LUA_NATIVE_PHYSICS_DOES_ROPE_EXIST>},
+		{"DOES_SCRIPT_OWN_ROPE", native_function<LUA_NATIVE_PHYSICS_DOES_SCRIPT_OWN_ROPE>},
+		{"GET_CGOFFSET", native_function<LUA_NATIVE_PHYSICS_GET_CGOFFSET>},
+		{"GET_IS_ENTITY_A_FRAG", native_function<LUA_NATIVE_PHYSICS_GET_IS_ENTITY_A_FRAG>},
+		{"GET_ROPE_LAST_VERTEX_COORD", native_function<LUA_NATIVE_PHYSICS_GET_ROPE_LAST_VERTEX_COORD>},
+		{"GET_ROPE_VERTEX_COORD", native_function<LUA_NATIVE_PHYSICS_GET_ROPE_VERTEX_COORD>},
+		{"GET_ROPE_VERTEX_COUNT", native_function<LUA_NATIVE_PHYSICS_GET_ROPE_VERTEX_COUNT>},
+		{"IS_ROPE_ATTACHED_AT_BOTH_ENDS", native_function<LUA_NATIVE_PHYSICS_IS_ROPE_ATTACHED_AT_BOTH_ENDS>},
+		{"LOAD_ROPE_DATA", native_function<LUA_NATIVE_PHYSICS_LOAD_ROPE_DATA>},
+		{"PIN_ROPE_VERTEX", native_function<LUA_NATIVE_PHYSICS_PIN_ROPE_VERTEX>},
+		{"RESET_DISABLE_BREAKING", native_function<LUA_NATIVE_PHYSICS_RESET_DISABLE_BREAKING>},
+		{"ROPE_ARE_TEXTURES_LOADED", native_function<LUA_NATIVE_PHYSICS_ROPE_ARE_TEXTURES_LOADED>},
+		{"ROPE_ATTACH_VIRTUAL_BOUND_GEOM", native_function<LUA_NATIVE_PHYSICS_ROPE_ATTACH_VIRTUAL_BOUND_GEOM>},
+		{"ROPE_CHANGE_SCRIPT_OWNER", native_function<LUA_NATIVE_PHYSICS_ROPE_CHANGE_SCRIPT_OWNER>},
+		{"ROPE_CONVERT_TO_SIMPLE", native_function<LUA_NATIVE_PHYSICS_ROPE_CONVERT_TO_SIMPLE>},
+		{"ROPE_DRAW_ENABLED", native_function<LUA_NATIVE_PHYSICS_ROPE_DRAW_ENABLED>},
+		{"ROPE_DRAW_SHADOW_ENABLED", native_function<LUA_NATIVE_PHYSICS_ROPE_DRAW_SHADOW_ENABLED>},
+		{"ROPE_FORCE_LENGTH", native_function<LUA_NATIVE_PHYSICS_ROPE_FORCE_LENGTH>},
+		{"ROPE_GET_DISTANCE_BETWEEN_ENDS", native_function<LUA_NATIVE_PHYSICS_ROPE_GET_DISTANCE_BETWEEN_ENDS>},
+		{"ROPE_LOAD_TEXTURES", native_function<LUA_NATIVE_PHYSICS_ROPE_LOAD_TEXTURES>},
+		{"ROPE_RESET_LENGTH", native_function<LUA_NATIVE_PHYSICS_ROPE_RESET_LENGTH>},
+		{"ROPE_SET_REFFRAMEVELOCITY_COLLIDERORDER", native_function<LUA_NATIVE_PHYSICS_ROPE_SET_REFFRAMEVELOCITY_COLLIDERORDER>},
+		{"ROPE_SET_SMOOTH_REELIN", native_function<LUA_NATIVE_PHYSICS_ROPE_SET_SMOOTH_REELIN>},
+		{"ROPE_SET_UPDATE_ORDER", native_function<LUA_NATIVE_PHYSICS_ROPE_SET_UPDATE_ORDER>},
+		{"ROPE_SET_UPDATE_PINVERTS", native_function<LUA_NATIVE_PHYSICS_ROPE_SET_UPDATE_PINVERTS>},
+		{"ROPE_UNLOAD_TEXTURES", native_function<LUA_NATIVE_PHYSICS_ROPE_UNLOAD_TEXTURES>},
+		{"SET_CGOFFSET", native_function<LUA_NATIVE_PHYSICS_SET_CGOFFSET>},
+		{"SET_CG_AT_BOUNDCENTER", native_function<LUA_NATIVE_PHYSICS_SET_CG_AT_BOUNDCENTER>},
+		{"SET_DAMPING", native_function<LUA_NATIVE_PHYSICS_SET_DAMPING>},
+		{"SET_DISABLE_BREAKING", native_function<LUA_NATIVE_PHYSICS_SET_DISABLE_BREAKING>},
+		{"SET_DISABLE_FRAG_DAMAGE", native_function<LUA_NATIVE_PHYSICS_SET_DISABLE_FRAG_DAMAGE>},
+		{"SET_IN_ARENA_MODE", native_function<LUA_NATIVE_PHYSICS_SET_IN_ARENA_MODE>},
+		{"SET_IN_STUNT_MODE", native_function<LUA_NATIVE_PHYSICS_SET_IN_STUNT_MODE>},
+		{"SET_USE_KINEMATIC_PHYSICS", native_function<LUA_NATIVE_PHYSICS_SET_USE_KINEMATIC_PHYSICS>},
+		{"START_ROPE_UNWINDING_FRONT", native_function<LUA_NATIVE_PHYSICS_START_ROPE_UNWINDING_FRONT>},
+		{"START_ROPE_WINDING", native_function<LUA_NATIVE_PHYSICS_START_ROPE_WINDING>},
+		{"STOP_ROPE_UNWINDING_FRONT", native_function<LUA_NATIVE_PHYSICS_STOP_ROPE_UNWINDING_FRONT>},
+		{"STOP_ROPE_WINDING", native_function<LUA_NATIVE_PHYSICS_STOP_ROPE_WINDING>},
+		{"UNPIN_ROPE_VERTEX", native_function<LUA_NATIVE_PHYSICS_UNPIN_ROPE_VERTEX>},
+	};
+
 	void init_native_binding_PHYSICS(sol::state& L)
 	{
-		auto PHYSICS = L["PHYSICS"].get_or_create<sol::table>();
-		PHYSICS.set_function("ADD_ROPE", LUA_NATIVE_PHYSICS_ADD_ROPE);
-		PHYSICS.set_function("DELETE_ROPE", LUA_NATIVE_PHYSICS_DELETE_ROPE);
-		PHYSICS.set_function("DELETE_CHILD_ROPE", LUA_NATIVE_PHYSICS_DELETE_CHILD_ROPE);
-		PHYSICS.set_function("DOES_ROPE_EXIST", LUA_NATIVE_PHYSICS_DOES_ROPE_EXIST);
-		PHYSICS.set_function("ROPE_DRAW_ENABLED", LUA_NATIVE_PHYSICS_ROPE_DRAW_ENABLED);
-		PHYSICS.set_function("ROPE_DRAW_SHADOW_ENABLED", LUA_NATIVE_PHYSICS_ROPE_DRAW_SHADOW_ENABLED);
-		PHYSICS.set_function("LOAD_ROPE_DATA", LUA_NATIVE_PHYSICS_LOAD_ROPE_DATA);
-		PHYSICS.set_function("PIN_ROPE_VERTEX", LUA_NATIVE_PHYSICS_PIN_ROPE_VERTEX);
-		PHYSICS.set_function("UNPIN_ROPE_VERTEX", LUA_NATIVE_PHYSICS_UNPIN_ROPE_VERTEX);
-		PHYSICS.set_function("GET_ROPE_VERTEX_COUNT", LUA_NATIVE_PHYSICS_GET_ROPE_VERTEX_COUNT);
-		PHYSICS.set_function("ATTACH_ENTITIES_TO_ROPE", LUA_NATIVE_PHYSICS_ATTACH_ENTITIES_TO_ROPE);
-		PHYSICS.set_function("ATTACH_ROPE_TO_ENTITY", LUA_NATIVE_PHYSICS_ATTACH_ROPE_TO_ENTITY);
-		PHYSICS.set_function("DETACH_ROPE_FROM_ENTITY", LUA_NATIVE_PHYSICS_DETACH_ROPE_FROM_ENTITY);
-		PHYSICS.set_function("ROPE_SET_UPDATE_PINVERTS", LUA_NATIVE_PHYSICS_ROPE_SET_UPDATE_PINVERTS);
-		PHYSICS.set_function("ROPE_SET_UPDATE_ORDER", LUA_NATIVE_PHYSICS_ROPE_SET_UPDATE_ORDER);
-		PHYSICS.set_function("ROPE_SET_SMOOTH_REELIN", LUA_NATIVE_PHYSICS_ROPE_SET_SMOOTH_REELIN);
-		PHYSICS.set_function("IS_ROPE_ATTACHED_AT_BOTH_ENDS", LUA_NATIVE_PHYSICS_IS_ROPE_ATTACHED_AT_BOTH_ENDS);
-		PHYSICS.set_function("GET_ROPE_LAST_VERTEX_COORD", LUA_NATIVE_PHYSICS_GET_ROPE_LAST_VERTEX_COORD);
-		PHYSICS.set_function("GET_ROPE_VERTEX_COORD", LUA_NATIVE_PHYSICS_GET_ROPE_VERTEX_COORD);
-		PHYSICS.set_function("START_ROPE_WINDING", LUA_NATIVE_PHYSICS_START_ROPE_WINDING);
-		PHYSICS.set_function("STOP_ROPE_WINDING", LUA_NATIVE_PHYSICS_STOP_ROPE_WINDING);
-		PHYSICS.set_function("START_ROPE_UNWINDING_FRONT", LUA_NATIVE_PHYSICS_START_ROPE_UNWINDING_FRONT);
-		PHYSICS.set_function("STOP_ROPE_UNWINDING_FRONT", LUA_NATIVE_PHYSICS_STOP_ROPE_UNWINDING_FRONT);
-		PHYSICS.set_function("ROPE_CONVERT_TO_SIMPLE", LUA_NATIVE_PHYSICS_ROPE_CONVERT_TO_SIMPLE);
-		PHYSICS.set_function("ROPE_LOAD_TEXTURES", LUA_NATIVE_PHYSICS_ROPE_LOAD_TEXTURES);
-		PHYSICS.set_function("ROPE_ARE_TEXTURES_LOADED", LUA_NATIVE_PHYSICS_ROPE_ARE_TEXTURES_LOADED);
-		PHYSICS.set_function("ROPE_UNLOAD_TEXTURES", LUA_NATIVE_PHYSICS_ROPE_UNLOAD_TEXTURES);
-		PHYSICS.set_function("DOES_SCRIPT_OWN_ROPE", LUA_NATIVE_PHYSICS_DOES_SCRIPT_OWN_ROPE);
-		PHYSICS.set_function("ROPE_ATTACH_VIRTUAL_BOUND_GEOM", LUA_NATIVE_PHYSICS_ROPE_ATTACH_VIRTUAL_BOUND_GEOM);
-		PHYSICS.set_function("ROPE_CHANGE_SCRIPT_OWNER", LUA_NATIVE_PHYSICS_ROPE_CHANGE_SCRIPT_OWNER);
-		PHYSICS.set_function("ROPE_SET_REFFRAMEVELOCITY_COLLIDERORDER", LUA_NATIVE_PHYSICS_ROPE_SET_REFFRAMEVELOCITY_COLLIDERORDER);
-		PHYSICS.set_function("ROPE_GET_DISTANCE_BETWEEN_ENDS", LUA_NATIVE_PHYSICS_ROPE_GET_DISTANCE_BETWEEN_ENDS);
-		PHYSICS.set_function("ROPE_FORCE_LENGTH", LUA_NATIVE_PHYSICS_ROPE_FORCE_LENGTH);
-		PHYSICS.set_function("ROPE_RESET_LENGTH", LUA_NATIVE_PHYSICS_ROPE_RESET_LENGTH);
-		PHYSICS.set_function("APPLY_IMPULSE_TO_CLOTH", LUA_NATIVE_PHYSICS_APPLY_IMPULSE_TO_CLOTH);
-		PHYSICS.set_function("SET_DAMPING", LUA_NATIVE_PHYSICS_SET_DAMPING);
-		PHYSICS.set_function("ACTIVATE_PHYSICS", LUA_NATIVE_PHYSICS_ACTIVATE_PHYSICS);
-		PHYSICS.set_function("SET_CGOFFSET", LUA_NATIVE_PHYSICS_SET_CGOFFSET);
-		PHYSICS.set_function("GET_CGOFFSET", LUA_NATIVE_PHYSICS_GET_CGOFFSET);
-		PHYSICS.set_function("SET_CG_AT_BOUNDCENTER", LUA_NATIVE_PHYSICS_SET_CG_AT_BOUNDCENTER);
-		PHYSICS.set_function("BREAK_ENTITY_GLASS", LUA_NATIVE_PHYSICS_BREAK_ENTITY_GLASS);
-		PHYSICS.set_function("GET_IS_ENTITY_A_FRAG", LUA_NATIVE_PHYSICS_GET_IS_ENTITY_A_FRAG);
-		PHYSICS.set_function("SET_DISABLE_BREAKING", LUA_NATIVE_PHYSICS_SET_DISABLE_BREAKING);
-		PHYSICS.set_function("RESET_DISABLE_BREAKING", LUA_NATIVE_PHYSICS_RESET_DISABLE_BREAKING);
-		PHYSICS.set_function("SET_DISABLE_FRAG_DAMAGE", LUA_NATIVE_PHYSICS_SET_DISABLE_FRAG_DAMAGE);
-		PHYSICS.set_function("SET_USE_KINEMATIC_PHYSICS", LUA_NATIVE_PHYSICS_SET_USE_KINEMATIC_PHYSICS);
-		PHYSICS.set_function("SET_IN_STUNT_MODE", LUA_NATIVE_PHYSICS_SET_IN_STUNT_MODE);
-		PHYSICS.set_function("SET_IN_ARENA_MODE", LUA_NATIVE_PHYSICS_SET_IN_ARENA_MODE);
+		bind_namespace(L, "PHYSICS", PHYSICS_natives);
 	}
 }
@@ -1361,257 +1361,260 @@ namespace lua::native
 		PLAYER::SET_SCRIPT_FIRE_POSITION(coordX, coordY, coordZ);
 	}
 
+	static constexpr native_entry PLAYER_natives[] = {
+		{"ADD_PLAYER_TARGETABLE_ENTITY", native_function<LUA_NATIVE_PLAYER_ADD_PLAYER_TARGETABLE_ENTITY>},
+		{"ALLOW_EVASION_HUD_IF_DISABLING_HIDDEN_EVASION_THIS_FRAME", native_function<LUA_NATIVE_PLAYER_ALLOW_EVASION_HUD_IF_DISABLING_HIDDEN_EVASION_THIS_FRAME>},
+		{"ARE_PLAYER_FLASHING_STARS_ABOUT_TO_DROP", native_function<LUA_NATIVE_PLAYER_ARE_PLAYER_FLASHING_STARS_ABOUT_TO_DROP>},
+		{"ARE_PLAYER_STARS_GREYED_OUT", native_function<LUA_NATIVE_PLAYER_ARE_PLAYER_STARS_GREYED_OUT>},
+		{"ASSISTED_MOVEMENT_CLOSE_ROUTE", native_function<LUA_NATIVE_PLAYER_ASSISTED_MOVEMENT_CLOSE_ROUTE>},
+		{"ASSISTED_MOVEMENT_FLUSH_ROUTE", native_function<LUA_NATIVE_PLAYER_ASSISTED_MOVEMENT_FLUSH_ROUTE>},
+		{"CAN_PED_HEAR_PLAYER", native_function<LUA_NATIVE_PLAYER_CAN_PED_HEAR_PLAYER>},
+		{"CAN_PLAYER_START_MISSION", native_function<LUA_NATIVE_PLAYER_CAN_PLAYER_START_MISSION>},
+		{"CHANGE_PLAYER_PED", native_function<LUA_NATIVE_PLAYER_CHANGE_PLAYER_PED>},
+		{"CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_NON_ANIMAL_PED", native_function<LUA_NATIVE_PLAYER_CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_NON_ANIMAL_PED>},
+		{"CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_PED", native_function<LUA_NATIVE_PLAYER_CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_PED>},
+		{"CLEAR_PLAYER_PARACHUTE_MODEL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_CLEAR_PLAYER_PARACHUTE_MODEL_OVERRIDE>},
+		{"CLEAR_PLAYER_PARACHUTE_PACK_MODEL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_CLEAR_PLAYER_PARACHUTE_PACK_MODEL_OVERRIDE>},
+		{"CLEAR_PLAYER_PARACHUTE_VARIATION_OVERRIDE", native_function<LUA_NATIVE_PLAYER_CLEAR_PLAYER_PARACHUTE_VARIATION_OVERRIDE>},
+		{"CLEAR_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_CLEAR_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE>},
+		{"CLEAR_PLAYER_WANTED_LEVEL", native_function<LUA_NATIVE_PLAYER_CLEAR_PLAYER_WANTED_LEVEL>},
+		{"DISABLE_CAMERA_VIEW_MODE_CYCLE", native_function<LUA_NATIVE_PLAYER_DISABLE_CAMERA_VIEW_MODE_CYCLE>},
+		{"DISABLE_PLAYER_FIRING", native_function<LUA_NATIVE_PLAYER_DISABLE_PLAYER_FIRING>},
+		{"DISABLE_PLAYER_HEALTH_RECHARGE", native_function<LUA_NATIVE_PLAYER_DISABLE_PLAYER_HEALTH_RECHARGE>},
+		{"DISABLE_PLAYER_THROW_GRENADE_WHILE_USING_GUN", native_function<LUA_NATIVE_PLAYER_DISABLE_PLAYER_THROW_GRENADE_WHILE_USING_GUN>},
+		{"DISABLE_PLAYER_VEHICLE_REWARDS", native_function<LUA_NATIVE_PLAYER_DISABLE_PLAYER_VEHICLE_REWARDS>},
+		{"DISPLAY_SYSTEM_SIGNIN_UI", native_function<LUA_NATIVE_PLAYER_DISPLAY_SYSTEM_SIGNIN_UI>},
+		{"ENABLE_SPECIAL_ABILITY", native_function<LUA_NATIVE_PLAYER_ENABLE_SPECIAL_ABILITY>},
+		{"EXTEND_WORLD_BOUNDARY_FOR_PLAYER", native_function<LUA_NATIVE_PLAYER_EXTEND_WORLD_BOUNDARY_FOR_PLAYER>},
+		{"FORCE_CLEANUP", native_function<LUA_NATIVE_PLAYER_FORCE_CLEANUP>},
+		{"FORCE_CLEANUP_FOR_ALL_THREADS_WITH_THIS_NAME", native_function<LUA_NATIVE_PLAYER_FORCE_CLEANUP_FOR_ALL_THREADS_WITH_THIS_NAME>},
+		{"FORCE_CLEANUP_FOR_THREAD_WITH_THIS_ID", native_function<LUA_NATIVE_PLAYER_FORCE_CLEANUP_FOR_THREAD_WITH_THIS_ID>},
+		{"FORCE_START_HIDDEN_EVASION", native_function<LUA_NATIVE_PLAYER_FORCE_START_HIDDEN_EVASION>},
+		{"GET_ACHIEVEMENT_PROGRESS", native_function<LUA_NATIVE_PLAYER_GET_ACHIEVEMENT_PROGRESS>},
+		{"GET_ARE_CAMERA_CONTROLS_DISABLED", native_function<LUA_NATIVE_PLAYER_GET_ARE_CAMERA_CONTROLS_DISABLED>},
+		{"GET_CAUSE_OF_MOST_RECENT_FORCE_CLEANUP", native_function<LUA_NATIVE_PLAYER_GET_CAUSE_OF_MOST_RECENT_FORCE_CLEANUP>},
+		{"GET_ENTITY_PLAYER_IS_FREE_AIMING_AT", native_function<LUA_NATIVE_PLAYER_GET_ENTITY_PLAYER_IS_FREE_AIMING_AT>},
+		{"GET_IS_MOPPING_AREA_FREE_IN_FRONT_OF_PLAYER", native_function<LUA_NATIVE_PLAYER_GET_IS_MOPPING_AREA_FREE_IN_FRONT_OF_PLAYER>},
+		{"GET_IS_PLAYER_DRIVING_ON_HIGHWAY", native_function<LUA_NATIVE_PLAYER_GET_IS_PLAYER_DRIVING_ON_HIGHWAY>},
+		{"GET_IS_PLAYER_DRIVING_WRECKLESS", native_function<LUA_NATIVE_PLAYER_GET_IS_PLAYER_DRIVING_WRECKLESS>},
+		{"GET_IS_USING_FPS_THIRD_PERSON_COVER", native_function<LUA_NATIVE_PLAYER_GET_IS_USING_FPS_THIRD_PERSON_COVER>},
+		{"GET_IS_USING_HOOD_CAMERA", native_function<LUA_NATIVE_PLAYER_GET_IS_USING_HOOD_CAMERA>},
+		{"GET_MAX_WANTED_LEVEL", native_function<LUA_NATIVE_PLAYER_GET_MAX_WANTED_LEVEL>},
+		{"GET_NUMBER_OF_PLAYERS", native_function<LUA_NATIVE_PLAYER_GET_NUMBER_OF_PLAYERS>},
+		{"GET_NUMBER_OF_PLAYERS_IN_TEAM", native_function<LUA_NATIVE_PLAYER_GET_NUMBER_OF_PLAYERS_IN_TEAM>},
+		{"GET_PLAYERS_LAST_VEHICLE", native_function<LUA_NATIVE_PLAYER_GET_PLAYERS_LAST_VEHICLE>},
+		{"GET_PLAYER_CURRENT_STEALTH_NOISE", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_CURRENT_STEALTH_NOISE>},
+		{"GET_PLAYER_DEBUG_INVINCIBLE", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_DEBUG_INVINCIBLE>},
+		{"GET_PLAYER_FAKE_WANTED_LEVEL", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_FAKE_WANTED_LEVEL>},
+		{"GET_PLAYER_GROUP", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_GROUP>},
+		{"GET_PLAYER_HAS_RESERVE_PARACHUTE", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_HAS_RESERVE_PARACHUTE>},
+		{"GET_PLAYER_HEALTH_RECHARGE_MAX_PERCENT", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_HEALTH_RECHARGE_MAX_PERCENT>},
+		{"GET_PLAYER_INDEX", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_INDEX>},
+		{"GET_PLAYER_INVINCIBLE", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_INVINCIBLE>},
+		{"GET_PLAYER_MAX_ARMOUR", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_MAX_ARMOUR>},
+		{"GET_PLAYER_NAME", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_NAME>},
+		{"GET_PLAYER_PARACHUTE_MODEL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_PARACHUTE_MODEL_OVERRIDE>},
+		{"GET_PLAYER_PARACHUTE_PACK_TINT_INDEX", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_PARACHUTE_PACK_TINT_INDEX>},
+		{"GET_PLAYER_PARACHUTE_SMOKE_TRAIL_COLOR", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_PARACHUTE_SMOKE_TRAIL_COLOR>},
+		{"GET_PLAYER_PARACHUTE_TINT_INDEX", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_PARACHUTE_TINT_INDEX>},
+		{"GET_PLAYER_PED", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_PED>},
+		{"GET_PLAYER_PED_SCRIPT_INDEX", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_PED_SCRIPT_INDEX>},
+		{"GET_PLAYER_RECEIVED_BATTLE_EVENT_RECENTLY", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_RECEIVED_BATTLE_EVENT_RECENTLY>},
+		{"GET_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE>},
+		{"GET_PLAYER_RESERVE_PARACHUTE_TINT_INDEX", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_RESERVE_PARACHUTE_TINT_INDEX>},
+		{"GET_PLAYER_RGB_COLOUR", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_RGB_COLOUR>},
+		{"GET_PLAYER_SPRINT_STAMINA_REMAINING", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_SPRINT_STAMINA_REMAINING>},
+		{"GET_PLAYER_SPRINT_TIME_REMAINING", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_SPRINT_TIME_REMAINING>},
+		{"GET_PLAYER_TARGET_ENTITY", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_TARGET_ENTITY>},
+		{"GET_PLAYER_TEAM", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_TEAM>},
+		{"GET_PLAYER_UNDERWATER_TIME_REMAINING", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_UNDERWATER_TIME_REMAINING>},
+		{"GET_PLAYER_WANTED_CENTRE_POSITION", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_WANTED_CENTRE_POSITION>},
+		{"GET_PLAYER_WANTED_LEVEL", native_function<LUA_NATIVE_PLAYER_GET_PLAYER_WANTED_LEVEL>},
+		{"GET_TIME_SINCE_LAST_ARREST", native_function<LUA_NATIVE_PLAYER_GET_TIME_SINCE_LAST_ARREST>},
+		{"GET_TIME_SINCE_LAST_DEATH", native_function<LUA_NATIVE_PLAYER_GET_TIME_SINCE_LAST_DEATH>},
+		{"GET_TIME_SINCE_PLAYER_DROVE_AGAINST_TRAFFIC", native_function<LUA_NATIVE_PLAYER_GET_TIME_SINCE_PLAYER_DROVE_AGAINST_TRAFFIC>},
+		{"GET_TIME_SINCE_PLAYER_DROVE_ON_PAVEMENT", native_function<LUA_NATIVE_PLAYER_GET_TIME_SINCE_PLAYER_DROVE_ON_PAVEMENT>},
+		{"GET_TIME_SINCE_PLAYER_HIT_PED", native_function<LUA_NATIVE_PLAYER_GET_TIME_SINCE_PLAYER_HIT_PED>},
+		{"GET_TIME_SINCE_PLAYER_HIT_VEHICLE", native_function<LUA_NATIVE_PLAYER_GET_TIME_SINCE_PLAYER_HIT_VEHICLE>},
+		{"GET_WANTED_LEVEL_RADIUS", native_function<LUA_NATIVE_PLAYER_GET_WANTED_LEVEL_RADIUS>},
+		{"GET_WANTED_LEVEL_THRESHOLD", native_function<LUA_NATIVE_PLAYER_GET_WANTED_LEVEL_THRESHOLD>},
+		{"GET_WANTED_LEVEL_TIME_TO_ESCAPE", native_function<LUA_NATIVE_PLAYER_GET_WANTED_LEVEL_TIME_TO_ESCAPE>},
+		{"GIVE_ACHIEVEMENT_TO_PLAYER", native_function<LUA_NATIVE_PLAYER_GIVE_ACHIEVEMENT_TO_PLAYER>},
+		{"GIVE_PLAYER_RAGDOLL_CONTROL", native_function<LUA_NATIVE_PLAYER_GIVE_PLAYER_RAGDOLL_CONTROL>},
+		{"HAS_ACHIEVEMENT_BEEN_PASSED", native_function<LUA_NATIVE_PLAYER_HAS_ACHIEVEMENT_BEEN_PASSED>},
+		{"HAS_FORCE_CLEANUP_OCCURRED", native_function<LUA_NATIVE_PLAYER_HAS_FORCE_CLEANUP_OCCURRED>},
+		{"HAS_PLAYER_BEEN_SPOTTED_IN_STOLEN_VEHICLE", native_function<LUA_NATIVE_PLAYER_HAS_PLAYER_BEEN_SPOTTED_IN_STOLEN_VEHICLE>},
+		{"HAS_PLAYER_DAMAGED_AT_LEAST_ONE_NON_ANIMAL_PED", native_function<LUA_NATIVE_PLAYER_HAS_PLAYER_DAMAGED_AT_LEAST_ONE_NON_ANIMAL_PED>},
+		{"HAS_PLAYER_DAMAGED_AT_LEAST_ONE_PED", native_function<LUA_NATIVE_PLAYER_HAS_PLAYER_DAMAGED_AT_LEAST_ONE_PED>},
+		{"HAS_PLAYER_LEFT_THE_WORLD", native_function<LUA_NATIVE_PLAYER_HAS_PLAYER_LEFT_THE_WORLD>},
+		{"INCREASE_PLAYER_JUMP_SUPPRESSION_RANGE", native_function<LUA_NATIVE_PLAYER_INCREASE_PLAYER_JUMP_SUPPRESSION_RANGE>},
+		{"INT_TO_PARTICIPANTINDEX", native_function<LUA_NATIVE_PLAYER_INT_TO_PARTICIPANTINDEX>},
+		{"INT_TO_PLAYERINDEX", native_function<LUA_NATIVE_PLAYER_INT_TO_PLAYERINDEX>},
+		{"IS_PLAYER_BATTLE_AWARE", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_BATTLE_AWARE>},
+		{"IS_PLAYER_BEING_ARRESTED", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_BEING_ARRESTED>},
+		{"IS_PLAYER_BLUETOOTH_ENABLE", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_BLUETOOTH_ENABLE>},
+		{"IS_PLAYER_CLIMBING", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_CLIMBING>},
+		{"IS_PLAYER_CONTROL_ON", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_CONTROL_ON>},
+		{"IS_PLAYER_DEAD", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_DEAD>},
+		{"IS_PLAYER_FREE_AIMING", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_FREE_AIMING>},
+		{"IS_PLAYER_FREE_AIMING_AT_ENTITY", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_FREE_AIMING_AT_ENTITY>},
+		{"IS_PLAYER_FREE_FOR_AMBIENT_TASK", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_FREE_FOR_AMBIENT_TASK>},
+		{"IS_PLAYER_LOGGING_IN_NP", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_LOGGING_IN_NP>},
+		{"IS_PLAYER_ONLINE", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_ONLINE>},
+		{"IS_PLAYER_PLAYING", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_PLAYING>},
+		{"IS_PLAYER_PRESSING_HORN", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_PRESSING_HORN>},
+		{"IS_PLAYER_READY_FOR_CUTSCENE", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_READY_FOR_CUTSCENE>},
+		{"IS_PLAYER_RIDING_TRAIN", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_RIDING_TRAIN>},
+		{"IS_PLAYER_SCRIPT_CONTROL_ON", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_SCRIPT_CONTROL_ON>},
+		{"IS_PLAYER_TARGETTING_ANYTHING", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_TARGETTING_ANYTHING>},
+		{"IS_PLAYER_TARGETTING_ENTITY", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_TARGETTING_ENTITY>},
+		{"IS_PLAYER_TELEPORT_ACTIVE", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_TELEPORT_ACTIVE>},
+		{"IS_PLAYER_VEHICLE_WEAPON_TOGGLED_TO_NON_HOMING", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_VEHICLE_WEAPON_TOGGLED_TO_NON_HOMING>},
+		{"IS_PLAYER_WANTED_LEVEL_GREATER", native_function<LUA_NATIVE_PLAYER_IS_PLAYER_WANTED_LEVEL_GREATER>},
+		{"IS_REMOTE_PLAYER_IN_NON_CLONED_VEHICLE", native_function<LUA_NATIVE_PLAYER_IS_REMOTE_PLAYER_IN_NON_CLONED_VEHICLE>},
+		{"IS_SPECIAL_ABILITY_ACTIVE", native_function<LUA_NATIVE_PLAYER_IS_SPECIAL_ABILITY_ACTIVE>},
+		{"IS_SPECIAL_ABILITY_ENABLED", native_function<LUA_NATIVE_PLAYER_IS_SPECIAL_ABILITY_ENABLED>},
+		{"IS_SPECIAL_ABILITY_METER_FULL", native_function<LUA_NATIVE_PLAYER_IS_SPECIAL_ABILITY_METER_FULL>},
+		{"IS_SPECIAL_ABILITY_UNLOCKED", native_function<LUA_NATIVE_PLAYER_IS_SPECIAL_ABILITY_UNLOCKED>},
+		{"IS_SYSTEM_UI_BEING_DISPLAYED", native_function<LUA_NATIVE_PLAYER_IS_SYSTEM_UI_BEING_DISPLAYED>},
+		{"IS_WANTED_AND_HAS_BEEN_SEEN_BY_COPS", native_function<LUA_NATIVE_PLAYER_IS_WANTED_AND_HAS_BEEN_SEEN_BY_COPS>},
+		{"NETWORK_PLAYER_ID_TO_INT", native_function<LUA_NATIVE_PLAYER_NETWORK_PLAYER_ID_TO_INT>},
+		{"PLAYER_ATTACH_VIRTUAL_BOUND", native_function<LUA_NATIVE_PLAYER_PLAYER_ATTACH_VIRTUAL_BOUND>},
+		{"PLAYER_DETACH_VIRTUAL_BOUND", native_function<LUA_NATIVE_PLAYER_PLAYER_DETACH_VIRTUAL_BOUND>},
+		{"PLAYER_ID", native_function<LUA_NATIVE_PLAYER_PLAYER_ID>},
+		{"PLAYER_PED_ID", native_function<LUA_NATIVE_PLAYER_PLAYER_PED_ID>},
+		{"REMOVE_PLAYER_HELMET", native_function<LUA_NATIVE_PLAYER_REMOVE_PLAYER_HELMET>},
+		{"REMOVE_PLAYER_TARGETABLE_ENTITY", native_function<LUA_NATIVE_PLAYER_REMOVE_PLAYER_TARGETABLE_ENTITY>},
+		{"REMOVE_SCRIPT_FIRE_POSITION", native_function<LUA_NATIVE_PLAYER_REMOVE_SCRIPT_FIRE_POSITION>},
+		{"REPORT_CRIME", native_function<LUA_NATIVE_PLAYER_REPORT_CRIME>},
+		{"REPORT_POLICE_SPOTTED_PLAYER", native_function<LUA_NATIVE_PLAYER_REPORT_POLICE_SPOTTED_PLAYER>},
+		{"RESET_LAW_RESPONSE_DELAY_OVERRIDE", native_function<LUA_NATIVE_PLAYER_RESET_LAW_RESPONSE_DELAY_OVERRIDE>},
+		{"RESET_PLAYER_ARREST_STATE", native_function<LUA_NATIVE_PLAYER_RESET_PLAYER_ARREST_STATE>},
+		{"RESET_PLAYER_INPUT_GAIT", native_function<LUA_NATIVE_PLAYER_RESET_PLAYER_INPUT_GAIT>},
+		{"RESET_PLAYER_STAMINA", native_function<LUA_NATIVE_PLAYER_RESET_PLAYER_STAMINA>},
+		{"RESET_WANTED_LEVEL_DIFFICULTY", native_function<LUA_NATIVE_PLAYER_RESET_WANTED_LEVEL_DIFFICULTY>},
+		{"RESET_WANTED_LEVEL_HIDDEN_ESCAPE_TIME", native_function<LUA_NATIVE_PLAYER_RESET_WANTED_LEVEL_HIDDEN_ESCAPE_TIME>},
+		{"RESET_WORLD_BOUNDARY_FOR_PLAYER", native_function<LUA_NATIVE_PLAYER_RESET_WORLD_BOUNDARY_FOR_PLAYER>},
+		{"RESTORE_PLAYER_STAMINA", native_function<LUA_NATIVE_PLAYER_RESTORE_PLAYER_STAMINA>},
+		{"SET_ACHIEVEMENT_PROGRESS", native_function<LUA_NATIVE_PLAYER_SET_ACHIEVEMENT_PROGRESS>},
+		{"SET_AIR_DRAG_MULTIPLIER_FOR_PLAYERS_VEHICLE", native_function<LUA_NATIVE_PLAYER_SET_AIR_DRAG_MULTIPLIER_FOR_PLAYERS_VEHICLE>},
+		{"SET_ALL_NEUTRAL_RANDOM_PEDS_FLEE", native_function<LUA_NATIVE_PLAYER_SET_ALL_NEUTRAL_RANDOM_PEDS_FLEE>},
+		{"SET_ALL_NEUTRAL_RANDOM_PEDS_FLEE_THIS_FRAME", native_function<LUA_NATIVE_PLAYER_SET_ALL_NEUTRAL_RANDOM_PEDS_FLEE_THIS_FRAME>},
+		{"SET_ALL_RANDOM_PEDS_FLEE", native_function<LUA_NATIVE_PLAYER_SET_ALL_RANDOM_PEDS_FLEE>},
+		{"SET_ALL_RANDOM_PEDS_FLEE_THIS_FRAME", native_function<LUA_NATIVE_PLAYER_SET_ALL_RANDOM_PEDS_FLEE_THIS_FRAME>},
+		{"SET_APPLY_WAYPOINT_OF_PLAYER", native_function<LUA_NATIVE_PLAYER_SET_APPLY_WAYPOINT_OF_PLAYER>},
+		{"SET_AUTO_GIVE_PARACHUTE_WHEN_ENTER_PLANE", native_function<LUA_NATIVE_PLAYER_SET_AUTO_GIVE_PARACHUTE_WHEN_ENTER_PLANE>},
+		{"SET_AUTO_GIVE_SCUBA_GEAR_WHEN_EXIT_VEHICLE", native_function<LUA_NATIVE_PLAYER_SET_AUTO_GIVE_SCUBA_GEAR_WHEN_EXIT_VEHICLE>},
+		{"SET_DISABLE_AMBIENT_MELEE_MOVE", native_function<LUA_NATIVE_PLAYER_SET_DISABLE_AMBIENT_MELEE_MOVE>},
+		{"SET_DISPATCH_COPS_FOR_PLAYER", native_function<LUA_NATIVE_PLAYER_SET_DISPATCH_COPS_FOR_PLAYER>},
+		{"SET_EVERYONE_IGNORE_PLAYER", native_function<LUA_NATIVE_PLAYER_SET_EVERYONE_IGNORE_PLAYER>},
+		{"SET_IGNORE_LOW_PRIORITY_SHOCKING_EVENTS", native_function<LUA_NATIVE_PLAYER_SET_IGNORE_LOW_PRIORITY_SHOCKING_EVENTS>},
+		{"SET_LAW_PEDS_CAN_ATTACK_NON_WANTED_PLAYER_THIS_FRAME", native_function<LUA_NATIVE_PLAYER_SET_LAW_PEDS_CAN_ATTACK_NON_WANTED_PLAYER_THIS_FRAME>},
+		{"SET_LAW_RESPONSE_DELAY_OVERRIDE", native_function<LUA_NATIVE_PLAYER_SET_LAW_RESPONSE_DELAY_OVERRIDE>},
+		{"SET_MAX_WANTED_LEVEL", native_function<LUA_NATIVE_PLAYER_SET_MAX_WANTED_LEVEL>},
+		{"SET_PLAYER_BLUETOOTH_STATE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_BLUETOOTH_STATE>},
+		{"SET_PLAYER_CAN_BE_HASSLED_BY_GANGS", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CAN_BE_HASSLED_BY_GANGS>},
+		{"SET_PLAYER_CAN_COLLECT_DROPPED_MONEY", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CAN_COLLECT_DROPPED_MONEY>},
+		{"SET_PLAYER_CAN_DAMAGE_PLAYER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CAN_DAMAGE_PLAYER>},
+		{"SET_PLAYER_CAN_DO_DRIVE_BY", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CAN_DO_DRIVE_BY>},
+		{"SET_PLAYER_CAN_LEAVE_PARACHUTE_SMOKE_TRAIL", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CAN_LEAVE_PARACHUTE_SMOKE_TRAIL>},
+		{"SET_PLAYER_CAN_USE_COVER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CAN_USE_COVER>},
+		{"SET_PLAYER_CLOTH_LOCK_COUNTER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CLOTH_LOCK_COUNTER>},
+		{"SET_PLAYER_CLOTH_PACKAGE_INDEX", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CLOTH_PACKAGE_INDEX>},
+		{"SET_PLAYER_CLOTH_PIN_FRAMES", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CLOTH_PIN_FRAMES>},
+		{"SET_PLAYER_CONTROL", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_CONTROL>},
+		{"SET_PLAYER_EXPLOSIVE_DAMAGE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_EXPLOSIVE_DAMAGE_MODIFIER>},
+		{"SET_PLAYER_FALL_DISTANCE_TO_TRIGGER_RAGDOLL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_FALL_DISTANCE_TO_TRIGGER_RAGDOLL_OVERRIDE>},
+		{"SET_PLAYER_FORCED_AIM", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_FORCED_AIM>},
+		{"SET_PLAYER_FORCED_ZOOM", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_FORCED_ZOOM>},
+		{"SET_PLAYER_FORCE_SKIP_AIM_INTRO", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_FORCE_SKIP_AIM_INTRO>},
+		{"SET_PLAYER_HAS_RESERVE_PARACHUTE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_HAS_RESERVE_PARACHUTE>},
+		{"SET_PLAYER_HEALTH_RECHARGE_MAX_PERCENT", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_HEALTH_RECHARGE_MAX_PERCENT>},
+		{"SET_PLAYER_HEALTH_RECHARGE_MULTIPLIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_HEALTH_RECHARGE_MULTIPLIER>},
+		{"SET_PLAYER_HOMING_DISABLED_FOR_ALL_VEHICLE_WEAPONS", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_HOMING_DISABLED_FOR_ALL_VEHICLE_WEAPONS>},
+		{"SET_PLAYER_INVINCIBLE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_INVINCIBLE>},
+		{"SET_PLAYER_INVINCIBLE_BUT_HAS_REACTIONS", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_INVINCIBLE_BUT_HAS_REACTIONS>},
+		{"SET_PLAYER_LEAVE_PED_BEHIND", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_LEAVE_PED_BEHIND>},
+		{"SET_PLAYER_LOCKON", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_LOCKON>},
+		{"SET_PLAYER_LOCKON_RANGE_OVERRIDE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_LOCKON_RANGE_OVERRIDE>},
+		{"SET_PLAYER_MAX_ARMOUR", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_MAX_ARMOUR>},
+		{"SET_PLAYER_MAX_EXPLOSIVE_DAMAGE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_MAX_EXPLOSIVE_DAMAGE>},
+		{"SET_PLAYER_MAY_NOT_ENTER_ANY_VEHICLE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_MAY_NOT_ENTER_ANY_VEHICLE>},
+		{"SET_PLAYER_MAY_ONLY_ENTER_THIS_VEHICLE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_MAY_ONLY_ENTER_THIS_VEHICLE>},
+		{"SET_PLAYER_MELEE_WEAPON_DAMAGE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_MELEE_WEAPON_DAMAGE_MODIFIER>},
+		{"SET_PLAYER_MELEE_WEAPON_DEFENSE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_MELEE_WEAPON_DEFENSE_MODIFIER>},
+		{"SET_PLAYER_MODEL", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_MODEL>},
+		{"SET_PLAYER_NOISE_MULTIPLIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_NOISE_MULTIPLIER>},
+		{"SET_PLAYER_PARACHUTE_MODEL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_MODEL_OVERRIDE>},
+		{"SET_PLAYER_PARACHUTE_PACK_MODEL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_PACK_MODEL_OVERRIDE>},
+		{"SET_PLAYER_PARACHUTE_PACK_TINT_INDEX", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_PACK_TINT_INDEX>},
+		{"SET_PLAYER_PARACHUTE_SMOKE_TRAIL_COLOR", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_SMOKE_TRAIL_COLOR>},
+		{"SET_PLAYER_PARACHUTE_TINT_INDEX", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_TINT_INDEX>},
+		{"SET_PLAYER_PARACHUTE_VARIATION_OVERRIDE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_VARIATION_OVERRIDE>},
+		{"SET_PLAYER_PHONE_PALETTE_IDX", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_PHONE_PALETTE_IDX>},
+		{"SET_PLAYER_PREVIOUS_VARIATION_DATA", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_PREVIOUS_VARIATION_DATA>},
+		{"SET_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE>},
+		{"SET_PLAYER_RESERVE_PARACHUTE_TINT_INDEX", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_RESERVE_PARACHUTE_TINT_INDEX>},
+		{"SET_PLAYER_SIMULATE_AIMING", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_SIMULATE_AIMING>},
+		{"SET_PLAYER_SNEAKING_NOISE_MULTIPLIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_SNEAKING_NOISE_MULTIPLIER>},
+		{"SET_PLAYER_SPECTATED_VEHICLE_RADIO_OVERRIDE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_SPECTATED_VEHICLE_RADIO_OVERRIDE>},
+		{"SET_PLAYER_SPRINT", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_SPRINT>},
+		{"SET_PLAYER_STEALTH_PERCEPTION_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_STEALTH_PERCEPTION_MODIFIER>},
+		{"SET_PLAYER_TARGETING_MODE", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_TARGETING_MODE>},
+		{"SET_PLAYER_TARGET_LEVEL", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_TARGET_LEVEL>},
+		{"SET_PLAYER_TEAM", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_TEAM>},
+		{"SET_PLAYER_UNDERWATER_BREATH_PERCENT_REMAINING", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_UNDERWATER_BREATH_PERCENT_REMAINING>},
+		{"SET_PLAYER_VEHICLE_DAMAGE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_VEHICLE_DAMAGE_MODIFIER>},
+		{"SET_PLAYER_VEHICLE_DEFENSE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_VEHICLE_DEFENSE_MODIFIER>},
+		{"SET_PLAYER_VEHICLE_WEAPON_TO_NON_HOMING", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_VEHICLE_WEAPON_TO_NON_HOMING>},
+		{"SET_PLAYER_WANTED_CENTRE_POSITION", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_WANTED_CENTRE_POSITION>},
+		{"SET_PLAYER_WANTED_LEVEL", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_WANTED_LEVEL>},
+		{"SET_PLAYER_WANTED_LEVEL_NOW", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_WANTED_LEVEL_NOW>},
+		{"SET_PLAYER_WANTED_LEVEL_NO_DROP", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_WANTED_LEVEL_NO_DROP>},
+		{"SET_PLAYER_WEAPON_DAMAGE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_WEAPON_DAMAGE_MODIFIER>},
+		{"SET_PLAYER_WEAPON_DEFENSE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_WEAPON_DEFENSE_MODIFIER>},
+		{"SET_PLAYER_WEAPON_MINIGUN_DEFENSE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_WEAPON_MINIGUN_DEFENSE_MODIFIER>},
+		{"SET_PLAYER_WEAPON_TAKEDOWN_DEFENSE_MODIFIER", native_function<LUA_NATIVE_PLAYER_SET_PLAYER_WEAPON_TAKEDOWN_DEFENSE_MODIFIER>},
+		{"SET_POLICE_IGNORE_PLAYER", native_function<LUA_NATIVE_PLAYER_SET_POLICE_IGNORE_PLAYER>},
+		{"SET_POLICE_RADAR_BLIPS", native_function<LUA_NATIVE_PLAYER_SET_POLICE_RADAR_BLIPS>},
+		{"SET_RUN_SPRINT_MULTIPLIER_FOR_PLAYER", native_function<LUA_NATIVE_PLAYER_SET_RUN_SPRINT_MULTIPLIER_FOR_PLAYER>},
+		{"SET_SCRIPT_FIRE_POSITION", native_function<LUA_NATIVE_PLAYER_SET_SCRIPT_FIRE_POSITION>},
+		{"SET_SPECIAL_ABILITY_MP", native_function<LUA_NATIVE_PLAYER_SET_SPECIAL_ABILITY_MP>},
+		{"SET_SPECIAL_ABILITY_MULTIPLIER", native_function<LUA_NATIVE_PLAYER_SET_SPECIAL_ABILITY_MULTIPLIER>},
+		{"SET_SWIM_MULTIPLIER_FOR_PLAYER", native_function<LUA_NATIVE_PLAYER_SET_SWIM_MULTIPLIER_FOR_PLAYER>},
+		{"SET_WANTED_LEVEL_DIFFICULTY", native_function<LUA_NATIVE_PLAYER_SET_WANTED_LEVEL_DIFFICULTY>},
+		{"SET_WANTED_LEVEL_HIDDEN_ESCAPE_TIME", native_function<LUA_NATIVE_PLAYER_SET_WANTED_LEVEL_HIDDEN_ESCAPE_TIME>},
+		{"SET_WANTED_LEVEL_MULTIPLIER", native_function<LUA_NATIVE_PLAYER_SET_WANTED_LEVEL_MULTIPLIER>},
+		{"SIMULATE_PLAYER_INPUT_GAIT", native_function<LUA_NATIVE_PLAYER_SIMULATE_PLAYER_INPUT_GAIT>},
+		{"SPECIAL_ABILITY_ACTIVATE", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_ACTIVATE>},
+		{"SPECIAL_ABILITY_CHARGE_ABSOLUTE", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_ABSOLUTE>},
+		{"SPECIAL_ABILITY_CHARGE_CONTINUOUS", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_CONTINUOUS>},
+		{"SPECIAL_ABILITY_CHARGE_LARGE", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_LARGE>},
+		{"SPECIAL_ABILITY_CHARGE_MEDIUM", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_MEDIUM>},
+		{"SPECIAL_ABILITY_CHARGE_NORMALIZED", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_NORMALIZED>},
+		{"SPECIAL_ABILITY_CHARGE_ON_MISSION_FAILED", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_ON_MISSION_FAILED>},
+		{"SPECIAL_ABILITY_CHARGE_SMALL", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_SMALL>},
+		{"SPECIAL_ABILITY_DEACTIVATE", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_DEACTIVATE>},
+		{"SPECIAL_ABILITY_DEACTIVATE_FAST", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_DEACTIVATE_FAST>},
+		{"SPECIAL_ABILITY_DEACTIVATE_MP", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_DEACTIVATE_MP>},
+		{"SPECIAL_ABILITY_DEPLETE_METER", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_DEPLETE_METER>},
+		{"SPECIAL_ABILITY_FILL_METER", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_FILL_METER>},
+		{"SPECIAL_ABILITY_LOCK", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_LOCK>},
+		{"SPECIAL_ABILITY_RESET", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_RESET>},
+		{"SPECIAL_ABILITY_UNLOCK", native_function<LUA_NATIVE_PLAYER_SPECIAL_ABILITY_UNLOCK>},
+		{"START_FIRING_AMNESTY", native_function<LUA_NATIVE_PLAYER_START_FIRING_AMNESTY>},
+		{"START_PLAYER_TELEPORT", native_function<LUA_NATIVE_PLAYER_START_PLAYER_TELEPORT>},
+		{"STOP_PLAYER_TELEPORT", native_function<LUA_NATIVE_PLAYER_STOP_PLAYER_TELEPORT>},
+		{"SUPPRESS_CRIME_THIS_FRAME", native_function<LUA_NATIVE_PLAYER_SUPPRESS_CRIME_THIS_FRAME>},
+		{"SUPPRESS_LOSING_WANTED_LEVEL_IF_HIDDEN_THIS_FRAME", native_function<LUA_NATIVE_PLAYER_SUPPRESS_LOSING_WANTED_LEVEL_IF_HIDDEN_THIS_FRAME>},
+		{"SUPPRESS_WITNESSES_CALLING_POLICE_THIS_FRAME", native_function<LUA_NATIVE_PLAYER_SUPPRESS_WITNESSES_CALLING_POLICE_THIS_FRAME>},
+		{"UPDATE_PLAYER_TELEPORT", native_function<LUA_NATIVE_PLAYER_UPDATE_PLAYER_TELEPORT>},
+		{"UPDATE_SPECIAL_ABILITY_FROM_STAT", native_function<LUA_NATIVE_PLAYER_UPDATE_SPECIAL_ABILITY_FROM_STAT>},
+		{"UPDATE_WANTED_POSITION_THIS_FRAME", native_function<LUA_NATIVE_PLAYER_UPDATE_WANTED_POSITION_THIS_FRAME>},
+	};
+
 	void init_native_binding_PLAYER(sol::state& L)
 	{
-		auto PLAYER = L["PLAYER"].get_or_create<sol::table>();
-		PLAYER.set_function("GET_PLAYER_PED", LUA_NATIVE_PLAYER_GET_PLAYER_PED);
-		PLAYER.set_function("GET_PLAYER_PED_SCRIPT_INDEX", LUA_NATIVE_PLAYER_GET_PLAYER_PED_SCRIPT_INDEX);
-		PLAYER.set_function("SET_PLAYER_MODEL", LUA_NATIVE_PLAYER_SET_PLAYER_MODEL);
-		PLAYER.set_function("CHANGE_PLAYER_PED", LUA_NATIVE_PLAYER_CHANGE_PLAYER_PED);
-		PLAYER.set_function("GET_PLAYER_RGB_COLOUR", LUA_NATIVE_PLAYER_GET_PLAYER_RGB_COLOUR);
-		PLAYER.set_function("GET_NUMBER_OF_PLAYERS", LUA_NATIVE_PLAYER_GET_NUMBER_OF_PLAYERS);
-		PLAYER.set_function("GET_PLAYER_TEAM", LUA_NATIVE_PLAYER_GET_PLAYER_TEAM);
-		PLAYER.set_function("SET_PLAYER_TEAM", LUA_NATIVE_PLAYER_SET_PLAYER_TEAM);
-		PLAYER.set_function("GET_NUMBER_OF_PLAYERS_IN_TEAM", LUA_NATIVE_PLAYER_GET_NUMBER_OF_PLAYERS_IN_TEAM);
-		PLAYER.set_function("GET_PLAYER_NAME", LUA_NATIVE_PLAYER_GET_PLAYER_NAME);
-		PLAYER.set_function("GET_WANTED_LEVEL_RADIUS", LUA_NATIVE_PLAYER_GET_WANTED_LEVEL_RADIUS);
-		PLAYER.set_function("GET_PLAYER_WANTED_CENTRE_POSITION", LUA_NATIVE_PLAYER_GET_PLAYER_WANTED_CENTRE_POSITION);
-		PLAYER.set_function("SET_PLAYER_WANTED_CENTRE_POSITION", LUA_NATIVE_PLAYER_SET_PLAYER_WANTED_CENTRE_POSITION);
-		PLAYER.set_function("GET_WANTED_LEVEL_THRESHOLD", LUA_NATIVE_PLAYER_GET_WANTED_LEVEL_THRESHOLD);
-		PLAYER.set_function("SET_PLAYER_WANTED_LEVEL", LUA_NATIVE_PLAYER_SET_PLAYER_WANTED_LEVEL);
-		PLAYER.set_function("SET_PLAYER_WANTED_LEVEL_NO_DROP", LUA_NATIVE_PLAYER_SET_PLAYER_WANTED_LEVEL_NO_DROP);
-		PLAYER.set_function("SET_PLAYER_WANTED_LEVEL_NOW", LUA_NATIVE_PLAYER_SET_PLAYER_WANTED_LEVEL_NOW);
-		PLAYER.set_function("ARE_PLAYER_FLASHING_STARS_ABOUT_TO_DROP", LUA_NATIVE_PLAYER_ARE_PLAYER_FLASHING_STARS_ABOUT_TO_DROP);
-		PLAYER.set_function("ARE_PLAYER_STARS_GREYED_OUT", LUA_NATIVE_PLAYER_ARE_PLAYER_STARS_GREYED_OUT);
-		PLAYER.set_function("IS_WANTED_AND_HAS_BEEN_SEEN_BY_COPS", LUA_NATIVE_PLAYER_IS_WANTED_AND_HAS_BEEN_SEEN_BY_COPS);
-		PLAYER.set_function("SET_DISPATCH_COPS_FOR_PLAYER", LUA_NATIVE_PLAYER_SET_DISPATCH_COPS_FOR_PLAYER);
-		PLAYER.set_function("IS_PLAYER_WANTED_LEVEL_GREATER", LUA_NATIVE_PLAYER_IS_PLAYER_WANTED_LEVEL_GREATER);
-		PLAYER.set_function("CLEAR_PLAYER_WANTED_LEVEL", LUA_NATIVE_PLAYER_CLEAR_PLAYER_WANTED_LEVEL);
-		PLAYER.set_function("IS_PLAYER_DEAD", LUA_NATIVE_PLAYER_IS_PLAYER_DEAD);
-		PLAYER.set_function("IS_PLAYER_PRESSING_HORN", LUA_NATIVE_PLAYER_IS_PLAYER_PRESSING_HORN);
-		PLAYER.set_function("SET_PLAYER_CONTROL", LUA_NATIVE_PLAYER_SET_PLAYER_CONTROL);
-		PLAYER.set_function("GET_PLAYER_WANTED_LEVEL", LUA_NATIVE_PLAYER_GET_PLAYER_WANTED_LEVEL);
-		PLAYER.set_function("SET_MAX_WANTED_LEVEL", LUA_NATIVE_PLAYER_SET_MAX_WANTED_LEVEL);
-		PLAYER.set_function("SET_POLICE_RADAR_BLIPS", LUA_NATIVE_PLAYER_SET_POLICE_RADAR_BLIPS);
-		PLAYER.set_function("SET_POLICE_IGNORE_PLAYER", LUA_NATIVE_PLAYER_SET_POLICE_IGNORE_PLAYER);
-		PLAYER.set_function("IS_PLAYER_PLAYING", LUA_NATIVE_PLAYER_IS_PLAYER_PLAYING);
-		PLAYER.set_function("SET_EVERYONE_IGNORE_PLAYER", LUA_NATIVE_PLAYER_SET_EVERYONE_IGNORE_PLAYER);
-		PLAYER.set_function("SET_ALL_RANDOM_PEDS_FLEE", LUA_NATIVE_PLAYER_SET_ALL_RANDOM_PEDS_FLEE);
-		PLAYER.set_function("SET_ALL_RANDOM_PEDS_FLEE_THIS_FRAME", LUA_NATIVE_PLAYER_SET_ALL_RANDOM_PEDS_FLEE_THIS_FRAME);
-		PLAYER.set_function("SET_ALL_NEUTRAL_RANDOM_PEDS_FLEE", LUA_NATIVE_PLAYER_SET_ALL_NEUTRAL_RANDOM_PEDS_FLEE);
-		PLAYER.set_function("SET_ALL_NEUTRAL_RANDOM_PEDS_FLEE_THIS_FRAME", LUA_NATIVE_PLAYER_SET_ALL_NEUTRAL_RANDOM_PEDS_FLEE_THIS_FRAME);
-		PLAYER.set_function("SET_LAW_PEDS_CAN_ATTACK_NON_WANTED_PLAYER_THIS_FRAME", LUA_NATIVE_PLAYER_SET_LAW_PEDS_CAN_ATTACK_NON_WANTED_PLAYER_THIS_FRAME);
-		PLAYER.set_function("SET_IGNORE_LOW_PRIORITY_SHOCKING_EVENTS", LUA_NATIVE_PLAYER_SET_IGNORE_LOW_PRIORITY_SHOCKING_EVENTS);
-		PLAYER.set_function("SET_WANTED_LEVEL_MULTIPLIER", LUA_NATIVE_PLAYER_SET_WANTED_LEVEL_MULTIPLIER);
-		PLAYER.set_function("SET_WANTED_LEVEL_DIFFICULTY", LUA_NATIVE_PLAYER_SET_WANTED_LEVEL_DIFFICULTY);
-		PLAYER.set_function("RESET_WANTED_LEVEL_DIFFICULTY", LUA_NATIVE_PLAYER_RESET_WANTED_LEVEL_DIFFICULTY);
-		PLAYER.set_function("GET_WANTED_LEVEL_TIME_TO_ESCAPE", LUA_NATIVE_PLAYER_GET_WANTED_LEVEL_TIME_TO_ESCAPE);
-		PLAYER.set_function("SET_WANTED_LEVEL_HIDDEN_ESCAPE_TIME", LUA_NATIVE_PLAYER_SET_WANTED_LEVEL_HIDDEN_ESCAPE_TIME);
-		PLAYER.set_function("RESET_WANTED_LEVEL_HIDDEN_ESCAPE_TIME", LUA_NATIVE_PLAYER_RESET_WANTED_LEVEL_HIDDEN_ESCAPE_TIME);
-		PLAYER.set_function("START_FIRING_AMNESTY", LUA_NATIVE_PLAYER_START_FIRING_AMNESTY);
-		PLAYER.set_function("REPORT_CRIME", LUA_NATIVE_PLAYER_REPORT_CRIME);
-		PLAYER.set_function("SUPPRESS_CRIME_THIS_FRAME", LUA_NATIVE_PLAYER_SUPPRESS_CRIME_THIS_FRAME);
-		PLAYER.set_function("UPDATE_WANTED_POSITION_THIS_FRAME", LUA_NATIVE_PLAYER_UPDATE_WANTED_POSITION_THIS_FRAME);
-		PLAYER.set_function("SUPPRESS_LOSING_WANTED_LEVEL_IF_HIDDEN_THIS_FRAME", LUA_NATIVE_PLAYER_SUPPRESS_LOSING_WANTED_LEVEL_IF_HIDDEN_THIS_FRAME);
-		PLAYER.set_function("ALLOW_EVASION_HUD_IF_DISABLING_HIDDEN_EVASION_THIS_FRAME", LUA_NATIVE_PLAYER_ALLOW_EVASION_HUD_IF_DISABLING_HIDDEN_EVASION_THIS_FRAME);
-		PLAYER.set_function("FORCE_START_HIDDEN_EVASION", LUA_NATIVE_PLAYER_FORCE_START_HIDDEN_EVASION);
-		PLAYER.set_function("SUPPRESS_WITNESSES_CALLING_POLICE_THIS_FRAME", LUA_NATIVE_PLAYER_SUPPRESS_WITNESSES_CALLING_POLICE_THIS_FRAME);
-		PLAYER.set_function("REPORT_POLICE_SPOTTED_PLAYER", LUA_NATIVE_PLAYER_REPORT_POLICE_SPOTTED_PLAYER);
-		PLAYER.set_function("SET_LAW_RESPONSE_DELAY_OVERRIDE", LUA_NATIVE_PLAYER_SET_LAW_RESPONSE_DELAY_OVERRIDE);
-		PLAYER.set_function("RESET_LAW_RESPONSE_DELAY_OVERRIDE", LUA_NATIVE_PLAYER_RESET_LAW_RESPONSE_DELAY_OVERRIDE);
-		PLAYER.set_function("CAN_PLAYER_START_MISSION", LUA_NATIVE_PLAYER_CAN_PLAYER_START_MISSION);
-		PLAYER.set_function("IS_PLAYER_READY_FOR_CUTSCENE", LUA_NATIVE_PLAYER_IS_PLAYER_READY_FOR_CUTSCENE);
-		PLAYER.set_function("IS_PLAYER_TARGETTING_ENTITY", LUA_NATIVE_PLAYER_IS_PLAYER_TARGETTING_ENTITY);
-		PLAYER.set_function("GET_PLAYER_TARGET_ENTITY", LUA_NATIVE_PLAYER_GET_PLAYER_TARGET_ENTITY);
-		PLAYER.set_function("IS_PLAYER_FREE_AIMING", LUA_NATIVE_PLAYER_IS_PLAYER_FREE_AIMING);
-		PLAYER.set_function("IS_PLAYER_FREE_AIMING_AT_ENTITY", LUA_NATIVE_PLAYER_IS_PLAYER_FREE_AIMING_AT_ENTITY);
-		PLAYER.set_function("GET_ENTITY_PLAYER_IS_FREE_AIMING_AT", LUA_NATIVE_PLAYER_GET_ENTITY_PLAYER_IS_FREE_AIMING_AT);
-		PLAYER.set_function("SET_PLAYER_LOCKON_RANGE_OVERRIDE", LUA_NATIVE_PLAYER_SET_PLAYER_LOCKON_RANGE_OVERRIDE);
-		PLAYER.set_function("SET_PLAYER_CAN_DO_DRIVE_BY", LUA_NATIVE_PLAYER_SET_PLAYER_CAN_DO_DRIVE_BY);
-		PLAYER.set_function("SET_PLAYER_CAN_BE_HASSLED_BY_GANGS", LUA_NATIVE_PLAYER_SET_PLAYER_CAN_BE_HASSLED_BY_GANGS);
-		PLAYER.set_function("SET_PLAYER_CAN_USE_COVER", LUA_NATIVE_PLAYER_SET_PLAYER_CAN_USE_COVER);
-		PLAYER.set_function("GET_MAX_WANTED_LEVEL", LUA_NATIVE_PLAYER_GET_MAX_WANTED_LEVEL);
-		PLAYER.set_function("IS_PLAYER_TARGETTING_ANYTHING", LUA_NATIVE_PLAYER_IS_PLAYER_TARGETTING_ANYTHING);
-		PLAYER.set_function("SET_PLAYER_SPRINT", LUA_NATIVE_PLAYER_SET_PLAYER_SPRINT);
-		PLAYER.set_function("RESET_PLAYER_STAMINA", LUA_NATIVE_PLAYER_RESET_PLAYER_STAMINA);
-		PLAYER.set_function("RESTORE_PLAYER_STAMINA", LUA_NATIVE_PLAYER_RESTORE_PLAYER_STAMINA);
-		PLAYER.set_function("GET_PLAYER_SPRINT_STAMINA_REMAINING", LUA_NATIVE_PLAYER_GET_PLAYER_SPRINT_STAMINA_REMAINING);
-		PLAYER.set_function("GET_PLAYER_SPRINT_TIME_REMAINING", LUA_NATIVE_PLAYER_GET_PLAYER_SPRINT_TIME_REMAINING);
-		PLAYER.set_function("GET_PLAYER_UNDERWATER_TIME_REMAINING", LUA_NATIVE_PLAYER_GET_PLAYER_UNDERWATER_TIME_REMAINING);
-		PLAYER.set_function("SET_PLAYER_UNDERWATER_BREATH_PERCENT_REMAINING", LUA_NATIVE_PLAYER_SET_PLAYER_UNDERWATER_BREATH_PERCENT_REMAINING);
-		PLAYER.set_function("GET_PLAYER_GROUP", LUA_NATIVE_PLAYER_GET_PLAYER_GROUP);
-		PLAYER.set_function("GET_PLAYER_MAX_ARMOUR", LUA_NATIVE_PLAYER_GET_PLAYER_MAX_ARMOUR);
-		PLAYER.set_function("IS_PLAYER_CONTROL_ON", LUA_NATIVE_PLAYER_IS_PLAYER_CONTROL_ON);
-		PLAYER.set_function("GET_ARE_CAMERA_CONTROLS_DISABLED", LUA_NATIVE_PLAYER_GET_ARE_CAMERA_CONTROLS_DISABLED);
-		PLAYER.set_function("IS_PLAYER_SCRIPT_CONTROL_ON", LUA_NATIVE_PLAYER_IS_PLAYER_SCRIPT_CONTROL_ON);
-		PLAYER.set_function("IS_PLAYER_CLIMBING", LUA_NATIVE_PLAYER_IS_PLAYER_CLIMBING);
-		PLAYER.set_function("IS_PLAYER_BEING_ARRESTED", LUA_NATIVE_PLAYER_IS_PLAYER_BEING_ARRESTED);
-		PLAYER.set_function("RESET_PLAYER_ARREST_STATE", LUA_NATIVE_PLAYER_RESET_PLAYER_ARREST_STATE);
-		PLAYER.set_function("GET_PLAYERS_LAST_VEHICLE", LUA_NATIVE_PLAYER_GET_PLAYERS_LAST_VEHICLE);
-		PLAYER.set_function("GET_PLAYER_INDEX", LUA_NATIVE_PLAYER_GET_PLAYER_INDEX);
-		PLAYER.set_function("INT_TO_PLAYERINDEX", LUA_NATIVE_PLAYER_INT_TO_PLAYERINDEX);
-		PLAYER.set_function("INT_TO_PARTICIPANTINDEX", LUA_NATIVE_PLAYER_INT_TO_PARTICIPANTINDEX);
-		PLAYER.set_function("GET_TIME_SINCE_PLAYER_HIT_VEHICLE", LUA_NATIVE_PLAYER_GET_TIME_SINCE_PLAYER_HIT_VEHICLE);
-		PLAYER.set_function("GET_TIME_SINCE_PLAYER_HIT_PED", LUA_NATIVE_PLAYER_GET_TIME_SINCE_PLAYER_HIT_PED);
-		PLAYER.set_function("GET_TIME_SINCE_PLAYER_DROVE_ON_PAVEMENT", LUA_NATIVE_PLAYER_GET_TIME_SINCE_PLAYER_DROVE_ON_PAVEMENT);
-		PLAYER.set_function("GET_TIME_SINCE_PLAYER_DROVE_AGAINST_TRAFFIC", LUA_NATIVE_PLAYER_GET_TIME_SINCE_PLAYER_DROVE_AGAINST_TRAFFIC);
-		PLAYER.set_function("IS_PLAYER_FREE_FOR_AMBIENT_TASK", LUA_NATIVE_PLAYER_IS_PLAYER_FREE_FOR_AMBIENT_TASK);
-		PLAYER.set_function("PLAYER_ID", LUA_NATIVE_PLAYER_PLAYER_ID);
-		PLAYER.set_function("PLAYER_PED_ID", LUA_NATIVE_PLAYER_PLAYER_PED_ID);
-		PLAYER.set_function("NETWORK_PLAYER_ID_TO_INT", LUA_NATIVE_PLAYER_NETWORK_PLAYER_ID_TO_INT);
-		PLAYER.set_function("HAS_FORCE_CLEANUP_OCCURRED", LUA_NATIVE_PLAYER_HAS_FORCE_CLEANUP_OCCURRED);
-		PLAYER.set_function("FORCE_CLEANUP", LUA_NATIVE_PLAYER_FORCE_CLEANUP);
-		PLAYER.set_function("FORCE_CLEANUP_FOR_ALL_THREADS_WITH_THIS_NAME", LUA_NATIVE_PLAYER_FORCE_CLEANUP_FOR_ALL_THREADS_WITH_THIS_NAME);
-		PLAYER.set_function("FORCE_CLEANUP_FOR_THREAD_WITH_THIS_ID", LUA_NATIVE_PLAYER_FORCE_CLEANUP_FOR_THREAD_WITH_THIS_ID);
-		PLAYER.set_function("GET_CAUSE_OF_MOST_RECENT_FORCE_CLEANUP", LUA_NATIVE_PLAYER_GET_CAUSE_OF_MOST_RECENT_FORCE_CLEANUP);
-		PLAYER.set_function("SET_PLAYER_MAY_ONLY_ENTER_THIS_VEHICLE", LUA_NATIVE_PLAYER_SET_PLAYER_MAY_ONLY_ENTER_THIS_VEHICLE);
-		PLAYER.set_function("SET_PLAYER_MAY_NOT_ENTER_ANY_VEHICLE", LUA_NATIVE_PLAYER_SET_PLAYER_MAY_NOT_ENTER_ANY_VEHICLE);
-		PLAYER.set_function("GIVE_ACHIEVEMENT_TO_PLAYER", LUA_NATIVE_PLAYER_GIVE_ACHIEVEMENT_TO_PLAYER);
-		PLAYER.set_function("SET_ACHIEVEMENT_PROGRESS", LUA_NATIVE_PLAYER_SET_ACHIEVEMENT_PROGRESS);
-		PLAYER.set_function("GET_ACHIEVEMENT_PROGRESS", LUA_NATIVE_PLAYER_GET_ACHIEVEMENT_PROGRESS);
-		PLAYER.set_function("HAS_ACHIEVEMENT_BEEN_PASSED", LUA_NATIVE_PLAYER_HAS_ACHIEVEMENT_BEEN_PASSED);
-		PLAYER.set_function("IS_PLAYER_ONLINE", LUA_NATIVE_PLAYER_IS_PLAYER_ONLINE);
-		PLAYER.set_function("IS_PLAYER_LOGGING_IN_NP", LUA_NATIVE_PLAYER_IS_PLAYER_LOGGING_IN_NP);
-		PLAYER.set_function("DISPLAY_SYSTEM_SIGNIN_UI", LUA_NATIVE_PLAYER_DISPLAY_SYSTEM_SIGNIN_UI);
-		PLAYER.set_function("IS_SYSTEM_UI_BEING_DISPLAYED", LUA_NATIVE_PLAYER_IS_SYSTEM_UI_BEING_DISPLAYED);
-		PLAYER.set_function("SET_PLAYER_INVINCIBLE", LUA_NATIVE_PLAYER_SET_PLAYER_INVINCIBLE);
-		PLAYER.set_function("GET_PLAYER_INVINCIBLE", LUA_NATIVE_PLAYER_GET_PLAYER_INVINCIBLE);
-		PLAYER.set_function("GET_PLAYER_DEBUG_INVINCIBLE", LUA_NATIVE_PLAYER_GET_PLAYER_DEBUG_INVINCIBLE);
-		PLAYER.set_function("SET_PLAYER_INVINCIBLE_BUT_HAS_REACTIONS", LUA_NATIVE_PLAYER_SET_PLAYER_INVINCIBLE_BUT_HAS_REACTIONS);
-		PLAYER.set_function("SET_PLAYER_CAN_COLLECT_DROPPED_MONEY", LUA_NATIVE_PLAYER_SET_PLAYER_CAN_COLLECT_DROPPED_MONEY);
-		PLAYER.set_function("REMOVE_PLAYER_HELMET", LUA_NATIVE_PLAYER_REMOVE_PLAYER_HELMET);
-		PLAYER.set_function("GIVE_PLAYER_RAGDOLL_CONTROL", LUA_NATIVE_PLAYER_GIVE_PLAYER_RAGDOLL_CONTROL);
-		PLAYER.set_function("SET_PLAYER_LOCKON", LUA_NATIVE_PLAYER_SET_PLAYER_LOCKON);
-		PLAYER.set_function("SET_PLAYER_TARGETING_MODE", LUA_NATIVE_PLAYER_SET_PLAYER_TARGETING_MODE);
-		PLAYER.set_function("SET_PLAYER_TARGET_LEVEL", LUA_NATIVE_PLAYER_SET_PLAYER_TARGET_LEVEL);
-		PLAYER.set_function("GET_IS_USING_FPS_THIRD_PERSON_COVER", LUA_NATIVE_PLAYER_GET_IS_USING_FPS_THIRD_PERSON_COVER);
-		PLAYER.set_function("GET_IS_USING_HOOD_CAMERA", LUA_NATIVE_PLAYER_GET_IS_USING_HOOD_CAMERA);
-		PLAYER.set_function("CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_PED", LUA_NATIVE_PLAYER_CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_PED);
-		PLAYER.set_function("HAS_PLAYER_DAMAGED_AT_LEAST_ONE_PED", LUA_NATIVE_PLAYER_HAS_PLAYER_DAMAGED_AT_LEAST_ONE_PED);
-		PLAYER.set_function("CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_NON_ANIMAL_PED", LUA_NATIVE_PLAYER_CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_NON_ANIMAL_PED);
-		PLAYER.set_function("HAS_PLAYER_DAMAGED_AT_LEAST_ONE_NON_ANIMAL_PED", LUA_NATIVE_PLAYER_HAS_PLAYER_DAMAGED_AT_LEAST_ONE_NON_ANIMAL_PED);
-		PLAYER.set_function("SET_AIR_DRAG_MULTIPLIER_FOR_PLAYERS_VEHICLE", LUA_NATIVE_PLAYER_SET_AIR_DRAG_MULTIPLIER_FOR_PLAYERS_VEHICLE);
-		PLAYER.set_function("SET_SWIM_MULTIPLIER_FOR_PLAYER", LUA_NATIVE_PLAYER_SET_SWIM_MULTIPLIER_FOR_PLAYER);
-		PLAYER.set_function("SET_RUN_SPRINT_MULTIPLIER_FOR_PLAYER", LUA_NATIVE_PLAYER_SET_RUN_SPRINT_MULTIPLIER_FOR_PLAYER);
-		PLAYER.set_function("GET_TIME_SINCE_LAST_ARREST", LUA_NATIVE_PLAYER_GET_TIME_SINCE_LAST_ARREST);
-		PLAYER.set_function("GET_TIME_SINCE_LAST_DEATH", LUA_NATIVE_PLAYER_GET_TIME_SINCE_LAST_DEATH);
-		PLAYER.set_function("ASSISTED_MOVEMENT_CLOSE_ROUTE", LUA_NATIVE_PLAYER_ASSISTED_MOVEMENT_CLOSE_ROUTE);
-		PLAYER.set_function("ASSISTED_MOVEMENT_FLUSH_ROUTE", LUA_NATIVE_PLAYER_ASSISTED_MOVEMENT_FLUSH_ROUTE);
-		PLAYER.set_function("SET_PLAYER_FORCED_AIM", LUA_NATIVE_PLAYER_SET_PLAYER_FORCED_AIM);
-		PLAYER.set_function("SET_PLAYER_FORCED_ZOOM", LUA_NATIVE_PLAYER_SET_PLAYER_FORCED_ZOOM);
-		PLAYER.set_function("SET_PLAYER_FORCE_SKIP_AIM_INTRO", LUA_NATIVE_PLAYER_SET_PLAYER_FORCE_SKIP_AIM_INTRO);
-		PLAYER.set_function("DISABLE_PLAYER_FIRING", LUA_NATIVE_PLAYER_DISABLE_PLAYER_FIRING);
-		PLAYER.set_function("DISABLE_PLAYER_THROW_GRENADE_WHILE_USING_GUN", LUA_NATIVE_PLAYER_DISABLE_PLAYER_THROW_GRENADE_WHILE_USING_GUN);
-		PLAYER.set_function("SET_DISABLE_AMBIENT_MELEE_MOVE", LUA_NATIVE_PLAYER_SET_DISABLE_AMBIENT_MELEE_MOVE);
-		PLAYER.set_function("SET_PLAYER_MAX_ARMOUR", LUA_NATIVE_PLAYER_SET_PLAYER_MAX_ARMOUR);
-		PLAYER.set_function("SPECIAL_ABILITY_ACTIVATE", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_ACTIVATE);
-		PLAYER.set_function("SET_SPECIAL_ABILITY_MP", LUA_NATIVE_PLAYER_SET_SPECIAL_ABILITY_MP);
-		PLAYER.set_function("SPECIAL_ABILITY_DEACTIVATE_MP", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_DEACTIVATE_MP);
-		PLAYER.set_function("SPECIAL_ABILITY_DEACTIVATE", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_DEACTIVATE);
-		PLAYER.set_function("SPECIAL_ABILITY_DEACTIVATE_FAST", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_DEACTIVATE_FAST);
-		PLAYER.set_function("SPECIAL_ABILITY_RESET", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_RESET);
-		PLAYER.set_function("SPECIAL_ABILITY_CHARGE_ON_MISSION_FAILED", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_ON_MISSION_FAILED);
-		PLAYER.set_function("SPECIAL_ABILITY_CHARGE_SMALL", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_SMALL);
-		PLAYER.set_function("SPECIAL_ABILITY_CHARGE_MEDIUM", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_MEDIUM);
-		PLAYER.set_function("SPECIAL_ABILITY_CHARGE_LARGE", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_LARGE);
-		PLAYER.set_function("SPECIAL_ABILITY_CHARGE_CONTINUOUS", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_CONTINUOUS);
-		PLAYER.set_function("SPECIAL_ABILITY_CHARGE_ABSOLUTE", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_ABSOLUTE);
-		PLAYER.set_function("SPECIAL_ABILITY_CHARGE_NORMALIZED", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_CHARGE_NORMALIZED);
-		PLAYER.set_function("SPECIAL_ABILITY_FILL_METER", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_FILL_METER);
-		PLAYER.set_function("SPECIAL_ABILITY_DEPLETE_METER", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_DEPLETE_METER);
-		PLAYER.set_function("SPECIAL_ABILITY_LOCK", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_LOCK);
-		PLAYER.set_function("SPECIAL_ABILITY_UNLOCK", LUA_NATIVE_PLAYER_SPECIAL_ABILITY_UNLOCK);
-		PLAYER.set_function("IS_SPECIAL_ABILITY_UNLOCKED", LUA_NATIVE_PLAYER_IS_SPECIAL_ABILITY_UNLOCKED);
-		PLAYER.set_function("IS_SPECIAL_ABILITY_ACTIVE", LUA_NATIVE_PLAYER_IS_SPECIAL_ABILITY_ACTIVE);
-		PLAYER.set_function("IS_SPECIAL_ABILITY_METER_FULL", LUA_NATIVE_PLAYER_IS_SPECIAL_ABILITY_METER_FULL);
-		PLAYER.set_function("ENABLE_SPECIAL_ABILITY", LUA_NATIVE_PLAYER_ENABLE_SPECIAL_ABILITY);
-		PLAYER.set_function("IS_SPECIAL_ABILITY_ENABLED", LUA_NATIVE_PLAYER_IS_SPECIAL_ABILITY_ENABLED);
-		PLAYER.set_function("SET_SPECIAL_ABILITY_MULTIPLIER", LUA_NATIVE_PLAYER_SET_SPECIAL_ABILITY_MULTIPLIER);
-		PLAYER.set_function("UPDATE_SPECIAL_ABILITY_FROM_STAT", LUA_NATIVE_PLAYER_UPDATE_SPECIAL_ABILITY_FROM_STAT);
-		PLAYER.set_function("GET_IS_PLAYER_DRIVING_ON_HIGHWAY", LUA_NATIVE_PLAYER_GET_IS_PLAYER_DRIVING_ON_HIGHWAY);
-		PLAYER.set_function("GET_IS_PLAYER_DRIVING_WRECKLESS", LUA_NATIVE_PLAYER_GET_IS_PLAYER_DRIVING_WRECKLESS);
-		PLAYER.set_function("GET_IS_MOPPING_AREA_FREE_IN_FRONT_OF_PLAYER", LUA_NATIVE_PLAYER_GET_IS_MOPPING_AREA_FREE_IN_FRONT_OF_PLAYER);
-		PLAYER.set_function("START_PLAYER_TELEPORT", LUA_NATIVE_PLAYER_START_PLAYER_TELEPORT);
-		PLAYER.set_function("UPDATE_PLAYER_TELEPORT", LUA_NATIVE_PLAYER_UPDATE_PLAYER_TELEPORT);
-		PLAYER.set_function("STOP_PLAYER_TELEPORT", LUA_NATIVE_PLAYER_STOP_PLAYER_TELEPORT);
-		PLAYER.set_function("IS_PLAYER_TELEPORT_ACTIVE", LUA_NATIVE_PLAYER_IS_PLAYER_TELEPORT_ACTIVE);
-		PLAYER.set_function("GET_PLAYER_CURRENT_STEALTH_NOISE", LUA_NATIVE_PLAYER_GET_PLAYER_CURRENT_STEALTH_NOISE);
-		PLAYER.set_function("SET_PLAYER_HEALTH_RECHARGE_MULTIPLIER", LUA_NATIVE_PLAYER_SET_PLAYER_HEALTH_RECHARGE_MULTIPLIER);
-		PLAYER.set_function("GET_PLAYER_HEALTH_RECHARGE_MAX_PERCENT", LUA_NATIVE_PLAYER_GET_PLAYER_HEALTH_RECHARGE_MAX_PERCENT);
-		PLAYER.set_function("SET_PLAYER_HEALTH_RECHARGE_MAX_PERCENT", LUA_NATIVE_PLAYER_SET_PLAYER_HEALTH_RECHARGE_MAX_PERCENT);
-		PLAYER.set_function("DISABLE_PLAYER_HEALTH_RECHARGE", LUA_NATIVE_PLAYER_DISABLE_PLAYER_HEALTH_RECHARGE);
-		PLAYER.set_function("SET_PLAYER_FALL_DISTANCE_TO_TRIGGER_RAGDOLL_OVERRIDE", LUA_NATIVE_PLAYER_SET_PLAYER_FALL_DISTANCE_TO_TRIGGER_RAGDOLL_OVERRIDE);
-		PLAYER.set_function("SET_PLAYER_WEAPON_DAMAGE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_WEAPON_DAMAGE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_WEAPON_DEFENSE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_WEAPON_DEFENSE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_WEAPON_MINIGUN_DEFENSE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_WEAPON_MINIGUN_DEFENSE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_MELEE_WEAPON_DAMAGE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_MELEE_WEAPON_DAMAGE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_MELEE_WEAPON_DEFENSE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_MELEE_WEAPON_DEFENSE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_VEHICLE_DAMAGE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_VEHICLE_DAMAGE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_VEHICLE_DEFENSE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_VEHICLE_DEFENSE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_MAX_EXPLOSIVE_DAMAGE", LUA_NATIVE_PLAYER_SET_PLAYER_MAX_EXPLOSIVE_DAMAGE);
-		PLAYER.set_function("SET_PLAYER_EXPLOSIVE_DAMAGE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_EXPLOSIVE_DAMAGE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_WEAPON_TAKEDOWN_DEFENSE_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_WEAPON_TAKEDOWN_DEFENSE_MODIFIER);
-		PLAYER.set_function("SET_PLAYER_PARACHUTE_TINT_INDEX", LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_TINT_INDEX);
-		PLAYER.set_function("GET_PLAYER_PARACHUTE_TINT_INDEX", LUA_NATIVE_PLAYER_GET_PLAYER_PARACHUTE_TINT_INDEX);
-		PLAYER.set_function("SET_PLAYER_RESERVE_PARACHUTE_TINT_INDEX", LUA_NATIVE_PLAYER_SET_PLAYER_RESERVE_PARACHUTE_TINT_INDEX);
-		PLAYER.set_function("GET_PLAYER_RESERVE_PARACHUTE_TINT_INDEX", LUA_NATIVE_PLAYER_GET_PLAYER_RESERVE_PARACHUTE_TINT_INDEX);
-		PLAYER.set_function("SET_PLAYER_PARACHUTE_PACK_TINT_INDEX", LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_PACK_TINT_INDEX);
-		PLAYER.set_function("GET_PLAYER_PARACHUTE_PACK_TINT_INDEX", LUA_NATIVE_PLAYER_GET_PLAYER_PARACHUTE_PACK_TINT_INDEX);
-		PLAYER.set_function("SET_PLAYER_HAS_RESERVE_PARACHUTE", LUA_NATIVE_PLAYER_SET_PLAYER_HAS_RESERVE_PARACHUTE);
-		PLAYER.set_function("GET_PLAYER_HAS_RESERVE_PARACHUTE", LUA_NATIVE_PLAYER_GET_PLAYER_HAS_RESERVE_PARACHUTE);
-		PLAYER.set_function("SET_PLAYER_CAN_LEAVE_PARACHUTE_SMOKE_TRAIL", LUA_NATIVE_PLAYER_SET_PLAYER_CAN_LEAVE_PARACHUTE_SMOKE_TRAIL);
-		PLAYER.set_function("SET_PLAYER_PARACHUTE_SMOKE_TRAIL_COLOR", LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_SMOKE_TRAIL_COLOR);
-		PLAYER.set_function("GET_PLAYER_PARACHUTE_SMOKE_TRAIL_COLOR", LUA_NATIVE_PLAYER_GET_PLAYER_PARACHUTE_SMOKE_TRAIL_COLOR);
-		PLAYER.set_function("SET_PLAYER_PHONE_PALETTE_IDX", LUA_NATIVE_PLAYER_SET_PLAYER_PHONE_PALETTE_IDX);
-		PLAYER.set_function("SET_PLAYER_NOISE_MULTIPLIER", LUA_NATIVE_PLAYER_SET_PLAYER_NOISE_MULTIPLIER);
-		PLAYER.set_function("SET_PLAYER_SNEAKING_NOISE_MULTIPLIER", LUA_NATIVE_PLAYER_SET_PLAYER_SNEAKING_NOISE_MULTIPLIER);
-		PLAYER.set_function("CAN_PED_HEAR_PLAYER", LUA_NATIVE_PLAYER_CAN_PED_HEAR_PLAYER);
-		PLAYER.set_function("SIMULATE_PLAYER_INPUT_GAIT", LUA_NATIVE_PLAYER_SIMULATE_PLAYER_INPUT_GAIT);
-		PLAYER.set_function("RESET_PLAYER_INPUT_GAIT", LUA_NATIVE_PLAYER_RESET_PLAYER_INPUT_GAIT);
-		PLAYER.set_function("SET_AUTO_GIVE_PARACHUTE_WHEN_ENTER_PLANE", LUA_NATIVE_PLAYER_SET_AUTO_GIVE_PARACHUTE_WHEN_ENTER_PLANE);
-		PLAYER.set_function("SET_AUTO_GIVE_SCUBA_GEAR_WHEN_EXIT_VEHICLE", LUA_NATIVE_PLAYER_SET_AUTO_GIVE_SCUBA_GEAR_WHEN_EXIT_VEHICLE);
-		PLAYER.set_function("SET_PLAYER_STEALTH_PERCEPTION_MODIFIER", LUA_NATIVE_PLAYER_SET_PLAYER_STEALTH_PERCEPTION_MODIFIER);
-		PLAYER.set_function("IS_REMOTE_PLAYER_IN_NON_CLONED_VEHICLE", LUA_NATIVE_PLAYER_IS_REMOTE_PLAYER_IN_NON_CLONED_VEHICLE);
-		PLAYER.set_function("INCREASE_PLAYER_JUMP_SUPPRESSION_RANGE", LUA_NATIVE_PLAYER_INCREASE_PLAYER_JUMP_SUPPRESSION_RANGE);
-		PLAYER.set_function("SET_PLAYER_SIMULATE_AIMING", LUA_NATIVE_PLAYER_SET_PLAYER_SIMULATE_AIMING);
-		PLAYER.set_function("SET_PLAYER_CLOTH_PIN_FRAMES", LUA_NATIVE_PLAYER_SET_PLAYER_CLOTH_PIN_FRAMES);
-		PLAYER.set_function("SET_PLAYER_CLOTH_PACKAGE_INDEX", LUA_NATIVE_PLAYER_SET_PLAYER_CLOTH_PACKAGE_INDEX);
-		PLAYER.set_function("SET_PLAYER_CLOTH_LOCK_COUNTER", LUA_NATIVE_PLAYER_SET_PLAYER_CLOTH_LOCK_COUNTER);
-		PLAYER.set_function("PLAYER_ATTACH_VIRTUAL_BOUND", LUA_NATIVE_PLAYER_PLAYER_ATTACH_VIRTUAL_BOUND);
-		PLAYER.set_function("PLAYER_DETACH_VIRTUAL_BOUND", LUA_NATIVE_PLAYER_PLAYER_DETACH_VIRTUAL_BOUND);
-		PLAYER.set_function("HAS_PLAYER_BEEN_SPOTTED_IN_STOLEN_VEHICLE", LUA_NATIVE_PLAYER_HAS_PLAYER_BEEN_SPOTTED_IN_STOLEN_VEHICLE);
-		PLAYER.set_function("IS_PLAYER_BATTLE_AWARE", LUA_NATIVE_PLAYER_IS_PLAYER_BATTLE_AWARE);
-		PLAYER.set_function("GET_PLAYER_RECEIVED_BATTLE_EVENT_RECENTLY", LUA_NATIVE_PLAYER_GET_PLAYER_RECEIVED_BATTLE_EVENT_RECENTLY);
-		PLAYER.set_function("EXTEND_WORLD_BOUNDARY_FOR_PLAYER", LUA_NATIVE_PLAYER_EXTEND_WORLD_BOUNDARY_FOR_PLAYER);
-		PLAYER.set_function("RESET_WORLD_BOUNDARY_FOR_PLAYER", LUA_NATIVE_PLAYER_RESET_WORLD_BOUNDARY_FOR_PLAYER);
-		PLAYER.set_function("IS_PLAYER_RIDING_TRAIN", LUA_NATIVE_PLAYER_IS_PLAYER_RIDING_TRAIN);
-		PLAYER.set_function("HAS_PLAYER_LEFT_THE_WORLD", LUA_NATIVE_PLAYER_HAS_PLAYER_LEFT_THE_WORLD);
-		PLAYER.set_function("SET_PLAYER_LEAVE_PED_BEHIND", LUA_NATIVE_PLAYER_SET_PLAYER_LEAVE_PED_BEHIND);
-		PLAYER.set_function("SET_PLAYER_PARACHUTE_VARIATION_OVERRIDE", LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_VARIATION_OVERRIDE);
-		PLAYER.set_function("CLEAR_PLAYER_PARACHUTE_VARIATION_OVERRIDE", LUA_NATIVE_PLAYER_CLEAR_PLAYER_PARACHUTE_VARIATION_OVERRIDE);
-		PLAYER.set_function("SET_PLAYER_PARACHUTE_MODEL_OVERRIDE", LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_MODEL_OVERRIDE);
-		PLAYER.set_function("SET_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE", LUA_NATIVE_PLAYER_SET_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE);
-		PLAYER.set_function("GET_PLAYER_PARACHUTE_MODEL_OVERRIDE", LUA_NATIVE_PLAYER_GET_PLAYER_PARACHUTE_MODEL_OVERRIDE);
-		PLAYER.set_function("GET_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE", LUA_NATIVE_PLAYER_GET_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE);
-		PLAYER.set_function("CLEAR_PLAYER_PARACHUTE_MODEL_OVERRIDE", LUA_NATIVE_PLAYER_CLEAR_PLAYER_PARACHUTE_MODEL_OVERRIDE);
-		PLAYER.set_function("CLEAR_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE", LUA_NATIVE_PLAYER_CLEAR_PLAYER_RESERVE_PARACHUTE_MODEL_OVERRIDE);
-		PLAYER.set_function("SET_PLAYER_PARACHUTE_PACK_MODEL_OVERRIDE", LUA_NATIVE_PLAYER_SET_PLAYER_PARACHUTE_PACK_MODEL_OVERRIDE);
-		PLAYER.set_function("CLEAR_PLAYER_PARACHUTE_PACK_MODEL_OVERRIDE", LUA_NATIVE_PLAYER_CLEAR_PLAYER_PARACHUTE_PACK_MODEL_OVERRIDE);
-		PLAYER.set_function("DISABLE_PLAYER_VEHICLE_REWARDS", LUA_NATIVE_PLAYER_DISABLE_PLAYER_VEHICLE_REWARDS);
-		PLAYER.set_function("SET_PLAYER_SPECTATED_VEHICLE_RADIO_OVERRIDE", LUA_NATIVE_PLAYER_SET_PLAYER_SPECTATED_VEHICLE_RADIO_OVERRIDE);
-		PLAYER.set_function("SET_PLAYER_BLUETOOTH_STATE", LUA_NATIVE_PLAYER_SET_PLAYER_BLUETOOTH_STATE);
-		PLAYER.set_function("IS_PLAYER_BLUETOOTH_ENABLE", LUA_NATIVE_PLAYER_IS_PLAYER_BLUETOOTH_ENABLE);
-		PLAYER.set_function("DISABLE_CAMERA_VIEW_MODE_CYCLE", LUA_NATIVE_PLAYER_DISABLE_CAMERA_VIEW_MODE_CYCLE);
-		PLAYER.set_function("GET_PLAYER_FAKE_WANTED_LEVEL", LUA_NATIVE_PLAYER_GET_PLAYER_FAKE_WANTED_LEVEL);
-		PLAYER.set_function("SET_PLAYER_CAN_DAMAGE_PLAYER", LUA_NATIVE_PLAYER_SET_PLAYER_CAN_DAMAGE_PLAYER);
-		PLAYER.set_function("SET_APPLY_WAYPOINT_OF_PLAYER", LUA_NATIVE_PLAYER_SET_APPLY_WAYPOINT_OF_PLAYER);
-		PLAYER.set_function("IS_PLAYER_VEHICLE_WEAPON_TOGGLED_TO_NON_HOMING", LUA_NATIVE_PLAYER_IS_PLAYER_VEHICLE_WEAPON_TOGGLED_TO_NON_HOMING);
-		PLAYER.set_function("SET_PLAYER_VEHICLE_WEAPON_TO_NON_HOMING", LUA_NATIVE_PLAYER_SET_PLAYER_VEHICLE_WEAPON_TO_NON_HOMING);
-		PLAYER.set_function("SET_PLAYER_HOMING_DISABLED_FOR_ALL_VEHICLE_WEAPONS", LUA_NATIVE_PLAYER_SET_PLAYER_HOMING_DISABLED_FOR_ALL_VEHICLE_WEAPONS);
-		PLAYER.set_function("ADD_PLAYER_TARGETABLE_ENTITY", LUA_NATIVE_PLAYER_ADD_PLAYER_TARGETABLE_ENTITY);
-		PLAYER.set_function("REMOVE_PLAYER_TARGETABLE_ENTITY", LUA_NATIVE_PLAYER_REMOVE_PLAYER_TARGETABLE_ENTITY);
-		PLAYER.set_function("SET_PLAYER_PREVIOUS_VARIATION_DATA", LUA_NATIVE_PLAYER_SET_PLAYER_PREVIOUS_VARIATION_DATA);
-		PLAYER.set_function("REMOVE_SCRIPT_FIRE_POSITION", LUA_NATIVE_PLAYER_REMOVE_SCRIPT_FIRE_POSITION);
-		PLAYER.set_function("SET_SCRIPT_FIRE_POSITION", LUA_NATIVE_PLAYER_SET_SCRIPT_FIRE_POSITION);
+		bind_namespace(L, "PLAYER", PLAYER_natives);
 	}
 }
@@ -93,25 +93,28 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry RECORDING_natives[] = {
+		{"CANCEL_REPLAY_RECORDING", native_function<LUA_NATIVE_RECORDING_CANCEL_REPLAY_RECORDING>},
+		{"IS_REPLAY_AVAILABLE", native_function<LUA_NATIVE_RECORDING_IS_REPLAY_AVAILABLE>},
+		{"IS_REPLAY_INITIALIZED", native_function<LUA_NATIVE_RECORDING_IS_REPLAY_INITIALIZED>},
+		{"IS_REPLAY_RECORDING", native_function<LUA_NATIVE_RECORDING_IS_REPLAY_RECORDING>},
+		{"IS_REPLAY_RECORD_SPACE_AVAILABLE", native_function<LUA_NATIVE_RECORDING_IS_REPLAY_RECORD_SPACE_AVAILABLE>},
+		{"RECORD_GREATEST_MOMENT", native_function<LUA_NATIVE_RECORDING_RECORD_GREATEST_MOMENT>},
+		{"REPLAY_CANCEL_EVENT", native_function<LUA_NATIVE_RECORDING_REPLAY_CANCEL_EVENT>},
+		{"REPLAY_CHECK_FOR_EVENT_THIS_FRAME", native_function<LUA_NATIVE_RECORDING_REPLAY_CHECK_FOR_EVENT_THIS_FRAME>},
+		{"REPLAY_DISABLE_CAMERA_MOVEMENT_THIS_FRAME", native_function<LUA_NATIVE_RECORDING_REPLAY_DISABLE_CAMERA_MOVEMENT_THIS_FRAME>},
+		{"REPLAY_PREVENT_RECORDING_THIS_FRAME", native_function<LUA_NATIVE_RECORDING_REPLAY_PREVENT_RECORDING_THIS_FRAME>},
+		{"REPLAY_RECORD_BACK_FOR_TIME", native_function<LUA_NATIVE_RECORDING_REPLAY_RECORD_BACK_FOR_TIME>},
+		{"REPLAY_RESET_EVENT_INFO", native_function<LUA_NATIVE_RECORDING_REPLAY_RESET_EVENT_INFO>},
+		{"REPLAY_START_EVENT", native_function<LUA_NATIVE_RECORDING_REPLAY_START_EVENT>},
+		{"REPLAY_STOP_EVENT", native_function<LUA_NATIVE_RECORDING_REPLAY_STOP_EVENT>},
+		{"SAVE_REPLAY_RECORDING", native_function<LUA_NATIVE_RECORDING_SAVE_REPLAY_RECORDING>},
+		{"START_REPLAY_RECORDING", native_function<LUA_NATIVE_RECORDING_START_REPLAY_RECORDING>},
+		{"STOP_REPLAY_RECORDING", native_function<LUA_NATIVE_RECORDING_STOP_REPLAY_RECORDING>},
+	};
+
 	void init_native_binding_RECORDING(sol::state& L)
 	{
-		auto RECORDING = L["RECORDING"].get_or_create<sol::table>();
-		RECORDING.set_function("REPLAY_START_EVENT", LUA_NATIVE_RECORDING_REPLAY_START_EVENT);
-		RECORDING.set_function("REPLAY_STOP_EVENT", LUA_NATIVE_RECORDING_REPLAY_STOP_EVENT);
-		RECORDING.set_function("REPLAY_CANCEL_EVENT", LUA_NATIVE_RECORDING_REPLAY_CANCEL_EVENT);
-		RECORDING.set_function("REPLAY_RECORD_BACK_FOR_TIME", LUA_NATIVE_RECORDING_REPLAY_RECORD_BACK_FOR_TIME);
-		RECORDING.set_function("REPLAY_CHECK_FOR_EVENT_THIS_FRAME", LUA_NATIVE_RECORDING_REPLAY_CHECK_FOR_EVENT_THIS_FRAME);
-		RECORDING.set_function("REPLAY_PREVENT_RECORDING_THIS_FRAME", LUA_NATIVE_RECORDING_REPLAY_PREVENT_RECORDING_THIS_FRAME);
-		RECORDING.set_function("REPLAY_RESET_EVENT_INFO", LUA_NATIVE_RECORDING_REPLAY_RESET_EVENT_INFO);
-		RECORDING.set_function("REPLAY_DISABLE_CAMERA_MOVEMENT_THIS_FRAME", LUA_NATIVE_RECORDING_REPLAY_DISABLE_CAMERA_MOVEMENT_THIS_FRAME);
-		RECORDING.set_function("RECORD_GREATEST_MOMENT", LUA_NATIVE_RECORDING_RECORD_GREATEST_MOMENT);
-		RECORDING.set_function("START_REPLAY_RECORDING", LUA_NATIVE_RECORDING_START_REPLAY_RECORDING);
-		RECORDING.set_function("STOP_REPLAY_RECORDING", LUA_NATIVE_RECORDING_STOP_REPLAY_RECORDING);
-		RECORDING.set_function("CANCEL_REPLAY_RECORDING", LUA_NATIVE_RECORDING_CANCEL_REPLAY_RECORDING);
-		RECORDING.set_function("SAVE_REPLAY_RECORDING", LUA_NATIVE_RECORDING_SAVE_REPLAY_RECORDING);
-		RECORDING.set_function("IS_REPLAY_RECORDING", LUA_NATIVE_RECORDING_IS_REPLAY_RECORDING);
-		RECORDING.set_function("IS_REPLAY_INITIALIZED", LUA_NATIVE_RECORDING_IS_REPLAY_INITIALIZED);
-		RECORDING.set_function("IS_REPLAY_AVAILABLE", LUA_NATIVE_RECORDING_IS_REPLAY_AVAILABLE);
-		RECORDING.set_function("IS_REPLAY_RECORD_SPACE_AVAILABLE", LUA_NATIVE_RECORDING_IS_REPLAY_RECORD_SPACE_AVAILABLE);
+		bind_namespace(L, "RECORDING", RECORDING_natives);
 	}
 }
@@ -34,14 +34,17 @@ namespace lua::native
 		REPLAY::ACTIVATE_ROCKSTAR_EDITOR(p0);
 	}
 
+	static constexpr native_entry REPLAY_natives[] = {
+		{"ACTIVATE_ROCKSTAR_EDITOR", native_function<LUA_NATIVE_REPLAY_ACTIVATE_ROCKSTAR_EDITOR>},
+		{"REGISTER_EFFECT_FOR_REPLAY_EDITOR", native_function<LUA_NATIVE_REPLAY_REGISTER_EFFECT_FOR_REPLAY_EDITOR>},
+		{"REPLAY_CONTROL_SHUTDOWN", native_function<LUA_NATIVE_REPLAY_REPLAY_CONTROL_SHUTDOWN>},
+		{"REPLAY_SYSTEM_HAS_REQUESTED_A_SCRIPT_CLEANUP", native_function<LUA_NATIVE_REPLAY_REPLAY_SYSTEM_HAS_REQUESTED_A_SCRIPT_CLEANUP>},
+		{"SET_REPLAY_SYSTEM_PAUSED_FOR_SAVE", native_function<LUA_NATIVE_REPLAY_SET_REPLAY_SYSTEM_PAUSED_FOR_SAVE>},
+		{"SET_SCRIPTS_HAVE_CLEANED_UP_FOR_REPLAY_SYSTEM", native_function<LUA_NATIVE_REPLAY_SET_SCRIPTS_HAVE_CLEANED_UP_FOR_REPLAY_SYSTEM>},
+	};
+
 	void init_native_binding_REPLAY(sol::state& L)
 	{
-		auto REPLAY = L["REPLAY"].get_or_create<sol::table>();
-		REPLAY.set_function("REGISTER_EFFECT_FOR_REPLAY_EDITOR", LUA_NATIVE_REPLAY_REGISTER_EFFECT_FOR_REPLAY_EDITOR);
-		REPLAY.set_function("REPLAY_SYSTEM_HAS_REQUESTED_A_SCRIPT_CLEANUP", LUA_NATIVE_REPLAY_REPLAY_SYSTEM_HAS_REQUESTED_A_SCRIPT_CLEANUP);
-		REPLAY.set_function("SET_SCRIPTS_HAVE_CLEANED_UP_FOR_REPLAY_SYSTEM", LUA_NATIVE_REPLAY_SET_SCRIPTS_HAVE_CLEANED_UP_FOR_REPLAY_SYSTEM);
-		REPLAY.set_function("SET_REPLAY_SYSTEM_PAUSED_FOR_SAVE", LUA_NATIVE_REPLAY_SET_REPLAY_SYSTEM_PAUSED_FOR_SAVE);
-		REPLAY.set_function("REPLAY_CONTROL_SHUTDOWN", LUA_NATIVE_REPLAY_REPLAY_CONTROL_SHUTDOWN);
-		REPLAY.set_function("ACTIVATE_ROCKSTAR_EDITOR", LUA_NATIVE_REPLAY_ACTIVATE_ROCKSTAR_EDITOR);
+		bind_namespace(L, "REPLAY", REPLAY_natives);
 	}
 }
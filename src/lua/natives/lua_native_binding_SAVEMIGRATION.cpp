@@ -45,15 +45,18 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry SAVEMIGRATION_natives[] = {
+		{"SAVEMIGRATION_IS_MP_ENABLED", native_function<LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_IS_MP_ENABLED>},
+		{"SAVEMIGRATION_MP_GET_ACCOUNT", native_function<LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_GET_ACCOUNT>},
+		{"SAVEMIGRATION_MP_GET_ACCOUNTS_STATUS", native_function<LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_GET_ACCOUNTS_STATUS>},
+		{"SAVEMIGRATION_MP_GET_STATUS", native_function<LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_GET_STATUS>},
+		{"SAVEMIGRATION_MP_NUM_ACCOUNTS", native_function<LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_NUM_ACCOUNTS>},
+		{"SAVEMIGRATION_MP_REQUEST_ACCOUNTS", native_function<LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_REQUEST_ACCOUNTS>},
+		{"SAVEMIGRATION_MP_REQUEST_STATUS", native_function<LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_REQUEST_STATUS>},
+	};
+
 	void init_native_binding_SAVEMIGRATION(sol::state& L)
 	{
-		auto SAVEMIGRATION = L["SAVEMIGRATION"].get_or_create<sol::table>();
-		SAVEMIGRATION.set_function("SAVEMIGRATION_IS_MP_ENABLED", LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_IS_MP_ENABLED);
-		SAVEMIGRATION.set_function("SAVEMIGRATION_MP_REQUEST_ACCOUNTS", LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_REQUEST_ACCOUNTS);
-		SAVEMIGRATION.set_function("SAVEMIGRATION_MP_GET_ACCOUNTS_STATUS", LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_GET_ACCOUNTS_STATUS);
-		SAVEMIGRATION.set_function("SAVEMIGRATION_MP_NUM_ACCOUNTS", LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_NUM_ACCOUNTS);
-		SAVEMIGRATION.set_function("SAVEMIGRATION_MP_GET_ACCOUNT", LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_GET_ACCOUNT);
-		SAVEMIGRATION.set_function("SAVEMIGRATION_MP_REQUEST_STATUS", LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_REQUEST_STATUS);
-		SAVEMIGRATION.set_function("SAVEMIGRATION_MP_GET_STATUS", LUA_NATIVE_SAVEMIGRATION_SAVEMIGRATION_MP_GET_STATUS);
+		bind_namespace(L, "SAVEMIGRATION", SAVEMIGRATION_natives);
 	}
 }
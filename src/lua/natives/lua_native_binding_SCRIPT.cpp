@@ -208,45 +208,48 @@ namespace lua::native
 		SCRIPT::_SEND_TU_SCRIPT_EVENT_NEW(eventGroup, (Any*)eventData, eventDataSize, playerBits, eventType);
 	}
 
+	static constexpr native_entry SCRIPT_natives[] = {
+		{"BG_DOES_LAUNCH_PARAM_EXIST", native_function<LUA_NATIVE_SCRIPT_BG_DOES_LAUNCH_PARAM_EXIST>},
+		{"BG_END_CONTEXT", native_function<LUA_NATIVE_SCRIPT_BG_END_CONTEXT>},
+		{"BG_END_CONTEXT_HASH", native_function<LUA_NATIVE_SCRIPT_BG_END_CONTEXT_HASH>},
+		{"BG_GET_LAUNCH_PARAM_VALUE", native_function<LUA_NATIVE_SCRIPT_BG_GET_LAUNCH_PARAM_VALUE>},
+		{"BG_GET_SCRIPT_ID_FROM_NAME_HASH", native_function<LUA_NATIVE_SCRIPT_BG_GET_SCRIPT_ID_FROM_NAME_HASH>},
+		{"BG_IS_EXITFLAG_SET", native_function<LUA_NATIVE_SCRIPT_BG_IS_EXITFLAG_SET>},
+		{"BG_SET_EXITFLAG_RESPONSE", native_function<LUA_NATIVE_SCRIPT_BG_SET_EXITFLAG_RESPONSE>},
+		{"BG_START_CONTEXT", native_function<LUA_NATIVE_SCRIPT_BG_START_CONTEXT>},
+		{"BG_START_CONTEXT_HASH", native_function<LUA_NATIVE_SCRIPT_BG_START_CONTEXT_HASH>},
+		{"COMMIT_TO_LOADINGSCREEN_SELCTION", native_function<LUA_NATIVE_SCRIPT_COMMIT_TO_LOADINGSCREEN_SELCTION>},
+		{"DOES_SCRIPT_EXIST", native_function<LUA_NATIVE_SCRIPT_DOES_SCRIPT_EXIST>},
+		{"DOES_SCRIPT_WITH_NAME_HASH_EXIST", native_function<LUA_NATIVE_SCRIPT_DOES_SCRIPT_WITH_NAME_HASH_EXIST>},
+		{"GET_EVENT_AT_INDEX", native_function<LUA_NATIVE_SCRIPT_GET_EVENT_AT_INDEX>},
+		{"GET_EVENT_DATA", native_function<LUA_NATIVE_SCRIPT_GET_EVENT_DATA>},
+		{"GET_EVENT_EXISTS", native_function<LUA_NATIVE_SCRIPT_GET_EVENT_EXISTS>},
+		{"GET_HASH_OF_THIS_SCRIPT_NAME", native_function<LUA_NATIVE_SCRIPT_GET_HASH_OF_THIS_SCRIPT_NAME>},
+		{"GET_ID_OF_THIS_THREAD", native_function<LUA_NATIVE_SCRIPT_GET_ID_OF_THIS_THREAD>},
+		{"GET_NAME_OF_SCRIPT_WITH_THIS_ID", native_function<LUA_NATIVE_SCRIPT_GET_NAME_OF_SCRIPT_WITH_THIS_ID>},
+		{"GET_NO_LOADING_SCREEN", native_function<LUA_NATIVE_SCRIPT_GET_NO_LOADING_SCREEN>},
+		{"GET_NUMBER_OF_EVENTS", native_function<LUA_NATIVE_SCRIPT_GET_NUMBER_OF_EVENTS>},
+		{"GET_NUMBER_OF_THREADS_RUNNING_THE_SCRIPT_WITH_THIS_HASH", native_function<LUA_NATIVE_SCRIPT_GET_NUMBER_OF_THREADS_RUNNING_THE_SCRIPT_WITH_THIS_HASH>},
+		{"GET_THIS_SCRIPT_NAME", native_function<LUA_NATIVE_SCRIPT_GET_THIS_SCRIPT_NAME>},
+		{"HAS_SCRIPT_LOADED", native_function<LUA_NATIVE_SCRIPT_HAS_SCRIPT_LOADED>},
+		{"HAS_SCRIPT_WITH_NAME_HASH_LOADED", native_function<LUA_NATIVE_SCRIPT_HAS_SCRIPT_WITH_NAME_HASH_LOADED>},
+		{"IS_THREAD_ACTIVE", native_function<LUA_NATIVE_SCRIPT_IS_THREAD_ACTIVE>},
+		{"REQUEST_SCRIPT", native_function<LUA_NATIVE_SCRIPT_REQUEST_SCRIPT>},
+		{"REQUEST_SCRIPT_WITH_NAME_HASH", native_function<LUA_NATIVE_SCRIPT_REQUEST_SCRIPT_WITH_NAME_HASH>},
+		{"SCRIPT_THREAD_ITERATOR_GET_NEXT_THREAD_ID", native_function<LUA_NATIVE_SCRIPT_SCRIPT_THREAD_ITERATOR_GET_NEXT_THREAD_ID>},
+		{"SCRIPT_THREAD_ITERATOR_RESET", native_function<LUA_NATIVE_SCRIPT_SCRIPT_THREAD_ITERATOR_RESET>},
+		{"SEND_TU_SCRIPT_EVENT_NEW_", native_function<LUA_NATIVE_SCRIPT_SEND_TU_SCRIPT_EVENT_NEW_>},
+		{"SET_NO_LOADING_SCREEN", native_function<LUA_NATIVE_SCRIPT_SET_NO_LOADING_SCREEN>},
+		{"SET_SCRIPT_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_SCRIPT_SET_SCRIPT_AS_NO_LONGER_NEEDED>},
+		{"SET_SCRIPT_WITH_NAME_HASH_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_SCRIPT_SET_SCRIPT_WITH_NAME_HASH_AS_NO_LONGER_NEEDED>},
+		{"SHUTDOWN_LOADING_SCREEN", native_function<LUA_NATIVE_SCRIPT_SHUTDOWN_LOADING_SCREEN>},
+		{"TERMINATE_THIS_THREAD", native_function<LUA_NATIVE_SCRIPT_TERMINATE_THIS_THREAD>},
+		{"TERMINATE_THREAD", native_function<LUA_NATIVE_SCRIPT_TERMINATE_THREAD>},
+		{"TRIGGER_SCRIPT_EVENT", native_function<LUA_NATIVE_SCRIPT_TRIGGER_SCRIPT_EVENT>},
+	};
+
 	void init_native_binding_SCRIPT(sol::state& L)
 	{
-		auto SCRIPT = L["SCRIPT"].get_or_create<sol::table>();
-		SCRIPT.set_function("REQUEST_SCRIPT", LUA_NATIVE_SCRIPT_REQUEST_SCRIPT);
-		SCRIPT.set_function("SET_SCRIPT_AS_NO_LONGER_NEEDED", LUA_NATIVE_SCRIPT_SET_SCRIPT_AS_NO_LONGER_NEEDED);
-		SCRIPT.set_function("HAS_SCRIPT_LOADED", LUA_NATIVE_SCRIPT_HAS_SCRIPT_LOADED);
-		SCRIPT.set_function("DOES_SCRIPT_EXIST", LUA_NATIVE_SCRIPT_DOES_SCRIPT_EXIST);
-		SCRIPT.set_function("REQUEST_SCRIPT_WITH_NAME_HASH", LUA_NATIVE_SCRIPT_REQUEST_SCRIPT_WITH_NAME_HASH);
-		SCRIPT.set_function("SET_SCRIPT_WITH_NAME_HASH_AS_NO_LONGER_NEEDED", LUA_NATIVE_SCRIPT_SET_SCRIPT_WITH_NAME_HASH_AS_NO_LONGER_NEEDED);
-		SCRIPT.set_function("HAS_SCRIPT_WITH_NAME_HASH_LOADED", LUA_NATIVE_SCRIPT_HAS_SCRIPT_WITH_NAME_HASH_LOADED);
-		SCRIPT.set_function("DOES_SCRIPT_WITH_NAME_HASH_EXIST", LUA_NATIVE_SCRIPT_DOES_SCRIPT_WITH_NAME_HASH_EXIST);
-		SCRIPT.set_function("TERMINATE_THREAD", LUA_NATIVE_SCRIPT_TERMINATE_THREAD);
-		SCRIPT.set_function("IS_THREAD_ACTIVE", LUA_NATIVE_SCRIPT_IS_THREAD_ACTIVE);
-		SCRIPT.set_function("GET_NAME_OF_SCRIPT_WITH_THIS_ID", LUA_NATIVE_SCRIPT_GET_NAME_OF_SCRIPT_WITH_THIS_ID);
-		SCRIPT.set_function("SCRIPT_THREAD_ITERATOR_RESET", LUA_NATIVE_SCRIPT_SCRIPT_THREAD_ITERATOR_RESET);
-		SCRIPT.set_function("SCRIPT_THREAD_ITERATOR_GET_NEXT_THREAD_ID", LUA_NATIVE_SCRIPT_SCRIPT_THREAD_ITERATOR_GET_NEXT_THREAD_ID);
-		SCRIPT.set_function("GET_ID_OF_THIS_THREAD", LUA_NATIVE_SCRIPT_GET_ID_OF_THIS_THREAD);
-		SCRIPT.set_function("TERMINATE_THIS_THREAD", LUA_NATIVE_SCRIPT_TERMINATE_THIS_THREAD);
-		SCRIPT.set_function("GET_NUMBER_OF_THREADS_RUNNING_THE_SCRIPT_WITH_THIS_HASH", LUA_NATIVE_SCRIPT_GET_NUMBER_OF_THREADS_RUNNING_THE_SCRIPT_WITH_THIS_HASH);
-		SCRIPT.set_function("GET_THIS_SCRIPT_NAME", LUA_NATIVE_SCRIPT_GET_THIS_SCRIPT_NAME);
-		SCRIPT.set_function("GET_HASH_OF_THIS_SCRIPT_NAME", LUA_NATIVE_SCRIPT_GET_HASH_OF_THIS_SCRIPT_NAME);
-		SCRIPT.set_function("GET_NUMBER_OF_EVENTS", LUA_NATIVE_SCRIPT_GET_NUMBER_OF_EVENTS);
-		SCRIPT.set_function("GET_EVENT_EXISTS", LUA_NATIVE_SCRIPT_GET_EVENT_EXISTS);
-		SCRIPT.set_function("GET_EVENT_AT_INDEX", LUA_NATIVE_SCRIPT_GET_EVENT_AT_INDEX);
-		SCRIPT.set_function("GET_EVENT_DATA", LUA_NATIVE_SCRIPT_GET_EVENT_DATA);
-		SCRIPT.set_function("TRIGGER_SCRIPT_EVENT", LUA_NATIVE_SCRIPT_TRIGGER_SCRIPT_EVENT);
-		SCRIPT.set_function("SHUTDOWN_LOADING_SCREEN", LUA_NATIVE_SCRIPT_SHUTDOWN_LOADING_SCREEN);
-		SCRIPT.set_function("SET_NO_LOADING_SCREEN", LUA_NATIVE_SCRIPT_SET_NO_LOADING_SCREEN);
-		SCRIPT.set_function("GET_NO_LOADING_SCREEN", LUA_NATIVE_SCRIPT_GET_NO_LOADING_SCREEN);
-		SCRIPT.set_function("COMMIT_TO_LOADINGSCREEN_SELCTION", LUA_NATIVE_SCRIPT_COMMIT_TO_LOADINGSCREEN_SELCTION);
-		SCRIPT.set_function("BG_IS_EXITFLAG_SET", LUA_NATIVE_SCRIPT_BG_IS_EXITFLAG_SET);
-		SCRIPT.set_function("BG_SET_EXITFLAG_RESPONSE", LUA_NATIVE_SCRIPT_BG_SET_EXITFLAG_RESPONSE);
-		SCRIPT.set_function("BG_START_CONTEXT_HASH", LUA_NATIVE_SCRIPT_BG_START_CONTEXT_HASH);
-		SCRIPT.set_function("BG_END_CONTEXT_HASH", LUA_NATIVE_SCRIPT_BG_END_CONTEXT_HASH);
-		SCRIPT.set_function("BG_START_CONTEXT", LUA_NATIVE_SCRIPT_BG_START_CONTEXT);
-		SCRIPT.set_function("BG_END_CONTEXT", LUA_NATIVE_SCRIPT_BG_END_CONTEXT);
-		SCRIPT.set_function("BG_DOES_LAUNCH_PARAM_EXIST", LUA_NATIVE_SCRIPT_BG_DOES_LAUNCH_PARAM_EXIST);
-		SCRIPT.set_function("BG_GET_LAUNCH_PARAM_VALUE", LUA_NATIVE_SCRIPT_BG_GET_LAUNCH_PARAM_VALUE);
-		SCRIPT.set_function("BG_GET_SCRIPT_ID_FROM_NAME_HASH", LUA_NATIVE_SCRIPT_BG_GET_SCRIPT_ID_FROM_NAME_HASH);
-		SCRIPT.set_function("SEND_TU_SCRIPT_EVENT_NEW_", LUA_NATIVE_SCRIPT_SEND_TU_SCRIPT_EVENT_NEW_);
+		bind_namespace(L, "SCRIPT", SCRIPT_natives);
 	}
 }
@@ -18,11 +18,14 @@ namespace lua::native
 		SECURITY::FORCE_CHECK_SCRIPT_VARIABLES();
 	}
 
+	static constexpr native_entry SECURITY_natives[] = {
+		{"FORCE_CHECK_SCRIPT_VARIABLES", native_function<LUA_NATIVE_SECURITY_FORCE_CHECK_SCRIPT_VARIABLES>},
+		{"REGISTER_SCRIPT_VARIABLE", native_function<LUA_NATIVE_SECURITY_REGISTER_SCRIPT_VARIABLE>},
+		{"UNREGISTER_SCRIPT_VARIABLE", native_function<LUA_NATIVE_SECURITY_UNREGISTER_SCRIPT_VARIABLE>},
+	};
+
 	void init_native_binding_SECURITY(sol::state& L)
 	{
-		auto SECURITY = L["SECURITY"].get_or_create<sol::table>();
-		SECURITY.set_function("REGISTER_SCRIPT_VARIABLE", LUA_NATIVE_SECURITY_REGISTER_SCRIPT_VARIABLE);
-		SECURITY.set_function("UNREGISTER_SCRIPT_VARIABLE", LUA_NATIVE_SECURITY_UNREGISTER_SCRIPT_VARIABLE);
-		SECURITY.set_function("FORCE_CHECK_SCRIPT_VARIABLES", LUA_NATIVE_SECURITY_FORCE_CHECK_SCRIPT_VARIABLES);
+		bind_namespace(L, "SECURITY", SECURITY_natives);
 	}
 }
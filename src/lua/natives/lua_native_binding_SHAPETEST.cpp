@@ -85,19 +85,22 @@ namespace lua::native
 		SHAPETEST::RELEASE_SCRIPT_GUID_FROM_ENTITY(entityHit);
 	}
 
+	static constexpr native_entry SHAPETEST_natives[] = {
+		{"GET_SHAPE_TEST_RESULT", native_function<LUA_NATIVE_SHAPETEST_GET_SHAPE_TEST_RESULT>},
+		{"GET_SHAPE_TEST_RESULT_INCLUDING_MATERIAL", native_function<LUA_NATIVE_SHAPETEST_GET_SHAPE_TEST_RESULT_INCLUDING_MATERIAL>},
+		{"RELEASE_SCRIPT_GUID_FROM_ENTITY", native_function<LUA_NATIVE_SHAPETEST_RELEASE_SCRIPT_GUID_FROM_ENTITY>},
+		{"START_EXPENSIVE_SYNCHRONOUS_SHAPE_TEST_LOS_PROBE", native_function<LUA_NATIVE_SHAPETEST_START_EXPENSIVE_SYNCHRONOUS_SHAPE_TEST_LOS_PROBE>},
+		{"START_SHAPE_TEST_BOUND", native_function<LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_BOUND>},
+		{"START_SHAPE_TEST_BOUNDING_BOX", native_function<LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_BOUNDING_BOX>},
+		{"START_SHAPE_TEST_BOX", native_function<LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_BOX>},
+		{"START_SHAPE_TEST_CAPSULE", native_function<LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_CAPSULE>},
+		{"START_SHAPE_TEST_LOS_PROBE", native_function<LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_LOS_PROBE>},
+		{"START_SHAPE_TEST_MOUSE_CURSOR_LOS_PROBE", native_function<LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_MOUSE_CURSOR_LOS_PROBE>},
+		{"START_SHAPE_TEST_SWEPT_SPHERE", native_function<LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_SWEPT_SPHERE>},
+	};
+
 	void init_native_binding_SHAPETEST(sol::state& L)
 	{
-		auto SHAPETEST = L["SHAPETEST"].get_or_create<sol::table>();
-		SHAPETEST.set_function("START_SHAPE_TEST_LOS_PROBE", LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_LOS_PROBE);
-		SHAPETEST.set_function("START_EXPENSIVE_SYNCHRONOUS_SHAPE_TEST_LOS_PROBE", LUA_NATIVE_SHAPETEST_START_EXPENSIVE_SYNCHRONOUS_SHAPE_TEST_LOS_PROBE);
-		SHAPETEST.set_function("START_SHAPE_TEST_BOUNDING_BOX", LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_BOUNDING_BOX);
-		SHAPETEST.set_function("START_SHAPE_TEST_BOX", LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_BOX);
-		SHAPETEST.set_function("START_SHAPE_TEST_BOUND", LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_BOUND);
-		SHAPETEST.set_function("START_SHAPE_TEST_CAPSULE", LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_CAPSULE);
-		SHAPETEST.set_function("START_SHAPE_TEST_SWEPT_SPHERE", LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_SWEPT_SPHERE);
-		SHAPETEST.set_function("START_SHAPE_TEST_MOUSE_CURSOR_LOS_PROBE", LUA_NATIVE_SHAPETEST_START_SHAPE_TEST_MOUSE_CURSOR_LOS_PROBE);
-		SHAPETEST.set_function("GET_SHAPE_TEST_RESULT", LUA_NATIVE_SHAPETEST_GET_SHAPE_TEST_RESULT);
-		SHAPETEST.set_function("GET_SHAPE_TEST_RESULT_INCLUDING_MATERIAL", LUA_NATIVE_SHAPETEST_GET_SHAPE_TEST_RESULT_INCLUDING_MATERIAL);
-		SHAPETEST.set_function("RELEASE_SCRIPT_GUID_FROM_ENTITY", LUA_NATIVE_SHAPETEST_RELEASE_SCRIPT_GUID_FROM_ENTITY);
+		bind_namespace(L, "SHAPETEST", SHAPETEST_natives);
 	}
 }
@@ -560,90 +560,93 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry SOCIALCLUB_natives[] = {
+		{"SC_ACCOUNT_INFO_GET_NICKNAME", native_function<LUA_NATIVE_SOCIALCLUB_SC_ACCOUNT_INFO_GET_NICKNAME>},
+		{"SC_ACHIEVEMENT_INFO_STATUS", native_function<LUA_NATIVE_SOCIALCLUB_SC_ACHIEVEMENT_INFO_STATUS>},
+		{"SC_CACHE_NEW_ROCKSTAR_MSGS", native_function<LUA_NATIVE_SOCIALCLUB_SC_CACHE_NEW_ROCKSTAR_MSGS>},
+		{"SC_COMMUNITY_EVENT_GET_DISPLAY_NAME", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_DISPLAY_NAME>},
+		{"SC_COMMUNITY_EVENT_GET_DISPLAY_NAME_BY_ID", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_DISPLAY_NAME_BY_ID>},
+		{"SC_COMMUNITY_EVENT_GET_DISPLAY_NAME_FOR_TYPE", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_DISPLAY_NAME_FOR_TYPE>},
+		{"SC_COMMUNITY_EVENT_GET_EVENT_ID", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EVENT_ID>},
+		{"SC_COMMUNITY_EVENT_GET_EVENT_ID_FOR_TYPE", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EVENT_ID_FOR_TYPE>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT_BY_ID", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT_BY_ID>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT_FOR_TYPE", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT_FOR_TYPE>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT_BY_ID", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT_BY_ID>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT_FOR_TYPE", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT_FOR_TYPE>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING_BY_ID", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING_BY_ID>},
+		{"SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING_FOR_TYPE", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING_FOR_TYPE>},
+		{"SC_COMMUNITY_EVENT_IS_ACTIVE", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_IS_ACTIVE>},
+		{"SC_COMMUNITY_EVENT_IS_ACTIVE_BY_ID", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_IS_ACTIVE_BY_ID>},
+		{"SC_COMMUNITY_EVENT_IS_ACTIVE_FOR_TYPE", native_function<LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_IS_ACTIVE_FOR_TYPE>},
+		{"SC_EMAIL_DELETE_EMAILS", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_DELETE_EMAILS>},
+		{"SC_EMAIL_GET_EMAIL_AT_INDEX", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_GET_EMAIL_AT_INDEX>},
+		{"SC_EMAIL_GET_NUM_RETRIEVED_EMAILS", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_GET_NUM_RETRIEVED_EMAILS>},
+		{"SC_EMAIL_GET_RETRIEVAL_STATUS", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_GET_RETRIEVAL_STATUS>},
+		{"SC_EMAIL_MESSAGE_CLEAR_RECIP_LIST", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_MESSAGE_CLEAR_RECIP_LIST>},
+		{"SC_EMAIL_MESSAGE_PUSH_GAMER_TO_RECIP_LIST", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_MESSAGE_PUSH_GAMER_TO_RECIP_LIST>},
+		{"SC_EMAIL_RETRIEVE_EMAILS", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_RETRIEVE_EMAILS>},
+		{"SC_EMAIL_SEND_EMAIL", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_SEND_EMAIL>},
+		{"SC_EMAIL_SET_CURRENT_EMAIL_TAG", native_function<LUA_NATIVE_SOCIALCLUB_SC_EMAIL_SET_CURRENT_EMAIL_TAG>},
+		{"SC_GAMERDATA_GET_ACTIVE_XP_BONUS", native_function<LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_ACTIVE_XP_BONUS>},
+		{"SC_GAMERDATA_GET_BOOL", native_function<LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_BOOL>},
+		{"SC_GAMERDATA_GET_FLOAT", native_function<LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_FLOAT>},
+		{"SC_GAMERDATA_GET_INT", native_function<LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_INT>},
+		{"SC_GAMERDATA_GET_STRING", native_function<LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_STRING>},
+		{"SC_GET_NEW_ROCKSTAR_MSG", native_function<LUA_NATIVE_SOCIALCLUB_SC_GET_NEW_ROCKSTAR_MSG>},
+		{"SC_HAS_ACHIEVEMENT_BEEN_PASSED", native_function<LUA_NATIVE_SOCIALCLUB_SC_HAS_ACHIEVEMENT_BEEN_PASSED>},
+		{"SC_HAS_NEW_ROCKSTAR_MSG", native_function<LUA_NATIVE_SOCIALCLUB_SC_HAS_NEW_ROCKSTAR_MSG>},
+		{"SC_INBOX_GET_BOUNTY_DATA_AT_INDEX", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_GET_BOUNTY_DATA_AT_INDEX>},
+		{"SC_INBOX_GET_MESSAGE_IS_READ_AT_INDEX", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_GET_MESSAGE_IS_READ_AT_INDEX>},
+		{"SC_INBOX_GET_MESSAGE_TYPE_AT_INDEX", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_GET_MESSAGE_TYPE_AT_INDEX>},
+		{"SC_INBOX_GET_TOTAL_NUM_MESSAGES", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_GET_TOTAL_NUM_MESSAGES>},
+		{"SC_INBOX_MESSAGE_DO_APPLY", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_DO_APPLY>},
+		{"SC_INBOX_MESSAGE_GET_DATA_BOOL", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_DATA_BOOL>},
+		{"SC_INBOX_MESSAGE_GET_DATA_INT", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_DATA_INT>},
+		{"SC_INBOX_MESSAGE_GET_DATA_STRING", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_DATA_STRING>},
+		{"SC_INBOX_MESSAGE_GET_RAW_TYPE_AT_INDEX", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_RAW_TYPE_AT_INDEX>},
+		{"SC_INBOX_MESSAGE_GET_UGCDATA", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_UGCDATA>},
+		{"SC_INBOX_MESSAGE_PUSH_GAMER_T0_RECIP_LIST", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_PUSH_GAMER_T0_RECIP_LIST>},
+		{"SC_INBOX_SEND_UGCSTATUPDATE_TO_RECIP_LIST", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_SEND_UGCSTATUPDATE_TO_RECIP_LIST>},
+		{"SC_INBOX_SET_MESSAGE_AS_READ_AT_INDEX", native_function<LUA_NATIVE_SOCIALCLUB_SC_INBOX_SET_MESSAGE_AS_READ_AT_INDEX>},
+		{"SC_LICENSEPLATE_ADD", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_ADD>},
+		{"SC_LICENSEPLATE_CHECK_STRING", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_CHECK_STRING>},
+		{"SC_LICENSEPLATE_GET_ADD_IS_PENDING", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_ADD_IS_PENDING>},
+		{"SC_LICENSEPLATE_GET_ADD_STATUS", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_ADD_STATUS>},
+		{"SC_LICENSEPLATE_GET_CHECK_IS_PENDING", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_CHECK_IS_PENDING>},
+		{"SC_LICENSEPLATE_GET_CHECK_IS_VALID", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_CHECK_IS_VALID>},
+		{"SC_LICENSEPLATE_GET_COUNT", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_COUNT>},
+		{"SC_LICENSEPLATE_GET_ISVALID_IS_PENDING", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_ISVALID_IS_PENDING>},
+		{"SC_LICENSEPLATE_GET_ISVALID_STATUS", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_ISVALID_STATUS>},
+		{"SC_LICENSEPLATE_GET_PLATE", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_PLATE>},
+		{"SC_LICENSEPLATE_GET_PLATE_DATA", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_PLATE_DATA>},
+		{"SC_LICENSEPLATE_ISVALID", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_ISVALID>},
+		{"SC_LICENSEPLATE_SET_PLATE_DATA", native_function<LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_SET_PLATE_DATA>},
+		{"SC_PAUSE_NEWS_GET_PENDING_STORY", native_function<LUA_NATIVE_SOCIALCLUB_SC_PAUSE_NEWS_GET_PENDING_STORY>},
+		{"SC_PAUSE_NEWS_INIT_STARTER_PACK", native_function<LUA_NATIVE_SOCIALCLUB_SC_PAUSE_NEWS_INIT_STARTER_PACK>},
+		{"SC_PAUSE_NEWS_SHUTDOWN", native_function<LUA_NATIVE_SOCIALCLUB_SC_PAUSE_NEWS_SHUTDOWN>},
+		{"SC_PRESENCE_ATTR_SET_FLOAT", native_function<LUA_NATIVE_SOCIALCLUB_SC_PRESENCE_ATTR_SET_FLOAT>},
+		{"SC_PRESENCE_ATTR_SET_INT", native_function<LUA_NATIVE_SOCIALCLUB_SC_PRESENCE_ATTR_SET_INT>},
+		{"SC_PRESENCE_ATTR_SET_STRING", native_function<LUA_NATIVE_SOCIALCLUB_SC_PRESENCE_ATTR_SET_STRING>},
+		{"SC_PRESENCE_SET_ACTIVITY_RATING", native_function<LUA_NATIVE_SOCIALCLUB_SC_PRESENCE_SET_ACTIVITY_RATING>},
+		{"SC_PROFANITY_CHECK_STRING", native_function<LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_CHECK_STRING>},
+		{"SC_PROFANITY_CHECK_STRING_UGC", native_function<LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_CHECK_STRING_UGC>},
+		{"SC_PROFANITY_GET_CHECK_IS_PENDING", native_function<LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_GET_CHECK_IS_PENDING>},
+		{"SC_PROFANITY_GET_CHECK_IS_VALID", native_function<LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_GET_CHECK_IS_VALID>},
+		{"SC_PROFANITY_GET_STRING_PASSED", native_function<LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_GET_STRING_PASSED>},
+		{"SC_PROFANITY_GET_STRING_STATUS", native_function<LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_GET_STRING_STATUS>},
+		{"SC_TRANSITION_NEWS_END", native_function<LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_END>},
+		{"SC_TRANSITION_NEWS_GET_EXTRA_DATA_INT_TU", native_function<LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_GET_EXTRA_DATA_INT_TU>},
+		{"SC_TRANSITION_NEWS_HAS_EXTRA_DATA_TU", native_function<LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_HAS_EXTRA_DATA_TU>},
+		{"SC_TRANSITION_NEWS_SHOW", native_function<LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_SHOW>},
+		{"SC_TRANSITION_NEWS_SHOW_NEXT_ITEM", native_function<LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_SHOW_NEXT_ITEM>},
+		{"SC_TRANSITION_NEWS_SHOW_TIMED", native_function<LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_SHOW_TIMED>},
+	};
+
 	void init_native_binding_SOCIALCLUB(sol::state& L)
 	{
-		auto SOCIALCLUB = L["SOCIALCLUB"].get_or_create<sol::table>();
-		SOCIALCLUB.set_function("SC_INBOX_GET_TOTAL_NUM_MESSAGES", LUA_NATIVE_SOCIALCLUB_SC_INBOX_GET_TOTAL_NUM_MESSAGES);
-		SOCIALCLUB.set_function("SC_INBOX_GET_MESSAGE_TYPE_AT_INDEX", LUA_NATIVE_SOCIALCLUB_SC_INBOX_GET_MESSAGE_TYPE_AT_INDEX);
-		SOCIALCLUB.set_function("SC_INBOX_GET_MESSAGE_IS_READ_AT_INDEX", LUA_NATIVE_SOCIALCLUB_SC_INBOX_GET_MESSAGE_IS_READ_AT_INDEX);
-		SOCIALCLUB.set_function("SC_INBOX_SET_MESSAGE_AS_READ_AT_INDEX", LUA_NATIVE_SOCIALCLUB_SC_INBOX_SET_MESSAGE_AS_READ_AT_INDEX);
-		SOCIALCLUB.set_function("SC_INBOX_MESSAGE_GET_DATA_INT", LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_DATA_INT);
-		SOCIALCLUB.set_function("SC_INBOX_MESSAGE_GET_DATA_BOOL", LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_DATA_BOOL);
-		SOCIALCLUB.set_function("SC_INBOX_MESSAGE_GET_DATA_STRING", LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_DATA_STRING);
-		SOCIALCLUB.set_function("SC_INBOX_MESSAGE_DO_APPLY", LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_DO_APPLY);
-		SOCIALCLUB.set_function("SC_INBOX_MESSAGE_GET_RAW_TYPE_AT_INDEX", LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_RAW_TYPE_AT_INDEX);
-		SOCIALCLUB.set_function("SC_INBOX_MESSAGE_PUSH_GAMER_T0_RECIP_LIST", LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_PUSH_GAMER_T0_RECIP_LIST);
-		SOCIALCLUB.set_function("SC_INBOX_SEND_UGCSTATUPDATE_TO_RECIP_LIST", LUA_NATIVE_SOCIALCLUB_SC_INBOX_SEND_UGCSTATUPDATE_TO_RECIP_LIST);
-		SOCIALCLUB.set_function("SC_INBOX_MESSAGE_GET_UGCDATA", LUA_NATIVE_SOCIALCLUB_SC_INBOX_MESSAGE_GET_UGCDATA);
-		SOCIALCLUB.set_function("SC_INBOX_GET_BOUNTY_DATA_AT_INDEX", LUA_NATIVE_SOCIALCLUB_SC_INBOX_GET_BOUNTY_DATA_AT_INDEX);
-		SOCIALCLUB.set_function("SC_EMAIL_RETRIEVE_EMAILS", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_RETRIEVE_EMAILS);
-		SOCIALCLUB.set_function("SC_EMAIL_GET_RETRIEVAL_STATUS", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_GET_RETRIEVAL_STATUS);
-		SOCIALCLUB.set_function("SC_EMAIL_GET_NUM_RETRIEVED_EMAILS", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_GET_NUM_RETRIEVED_EMAILS);
-		SOCIALCLUB.set_function("SC_EMAIL_GET_EMAIL_AT_INDEX", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_GET_EMAIL_AT_INDEX);
-		SOCIALCLUB.set_function("SC_EMAIL_DELETE_EMAILS", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_DELETE_EMAILS);
-		SOCIALCLUB.set_function("SC_EMAIL_MESSAGE_PUSH_GAMER_TO_RECIP_LIST", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_MESSAGE_PUSH_GAMER_TO_RECIP_LIST);
-		SOCIALCLUB.set_function("SC_EMAIL_MESSAGE_CLEAR_RECIP_LIST", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_MESSAGE_CLEAR_RECIP_LIST);
-		SOCIALCLUB.set_function("SC_EMAIL_SEND_EMAIL", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_SEND_EMAIL);
-		SOCIALCLUB.set_function("SC_EMAIL_SET_CURRENT_EMAIL_TAG", LUA_NATIVE_SOCIALCLUB_SC_EMAIL_SET_CURRENT_EMAIL_TAG);
-		SOCIALCLUB.set_function("SC_CACHE_NEW_ROCKSTAR_MSGS", LUA_NATIVE_SOCIALCLUB_SC_CACHE_NEW_ROCKSTAR_MSGS);
-		SOCIALCLUB.set_function("SC_HAS_NEW_ROCKSTAR_MSG", LUA_NATIVE_SOCIALCLUB_SC_HAS_NEW_ROCKSTAR_MSG);
-		SOCIALCLUB.set_function("SC_GET_NEW_ROCKSTAR_MSG", LUA_NATIVE_SOCIALCLUB_SC_GET_NEW_ROCKSTAR_MSG);
-		SOCIALCLUB.set_function("SC_PRESENCE_ATTR_SET_INT", LUA_NATIVE_SOCIALCLUB_SC_PRESENCE_ATTR_SET_INT);
-		SOCIALCLUB.set_function("SC_PRESENCE_ATTR_SET_FLOAT", LUA_NATIVE_SOCIALCLUB_SC_PRESENCE_ATTR_SET_FLOAT);
-		SOCIALCLUB.set_function("SC_PRESENCE_ATTR_SET_STRING", LUA_NATIVE_SOCIALCLUB_SC_PRESENCE_ATTR_SET_STRING);
-		SOCIALCLUB.set_function("SC_PRESENCE_SET_ACTIVITY_RATING", LUA_NATIVE_SOCIALCLUB_SC_PRESENCE_SET_ACTIVITY_RATING);
-		SOCIALCLUB.set_function("SC_GAMERDATA_GET_INT", LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_INT);
-		SOCIALCLUB.set_function("SC_GAMERDATA_GET_FLOAT", LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_FLOAT);
-		SOCIALCLUB.set_function("SC_GAMERDATA_GET_BOOL", LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_BOOL);
-		SOCIALCLUB.set_function("SC_GAMERDATA_GET_STRING", LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_STRING);
-		SOCIALCLUB.set_function("SC_GAMERDATA_GET_ACTIVE_XP_BONUS", LUA_NATIVE_SOCIALCLUB_SC_GAMERDATA_GET_ACTIVE_XP_BONUS);
-		SOCIALCLUB.set_function("SC_PROFANITY_CHECK_STRING", LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_CHECK_STRING);
-		SOCIALCLUB.set_function("SC_PROFANITY_CHECK_STRING_UGC", LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_CHECK_STRING_UGC);
-		SOCIALCLUB.set_function("SC_PROFANITY_GET_CHECK_IS_VALID", LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_GET_CHECK_IS_VALID);
-		SOCIALCLUB.set_function("SC_PROFANITY_GET_CHECK_IS_PENDING", LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_GET_CHECK_IS_PENDING);
-		SOCIALCLUB.set_function("SC_PROFANITY_GET_STRING_PASSED", LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_GET_STRING_PASSED);
-		SOCIALCLUB.set_function("SC_PROFANITY_GET_STRING_STATUS", LUA_NATIVE_SOCIALCLUB_SC_PROFANITY_GET_STRING_STATUS);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_CHECK_STRING", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_CHECK_STRING);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_CHECK_IS_VALID", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_CHECK_IS_VALID);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_CHECK_IS_PENDING", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_CHECK_IS_PENDING);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_COUNT", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_COUNT);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_PLATE", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_PLATE);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_PLATE_DATA", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_PLATE_DATA);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_SET_PLATE_DATA", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_SET_PLATE_DATA);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_ADD", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_ADD);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_ADD_IS_PENDING", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_ADD_IS_PENDING);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_ADD_STATUS", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_ADD_STATUS);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_ISVALID", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_ISVALID);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_ISVALID_IS_PENDING", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_ISVALID_IS_PENDING);
-		SOCIALCLUB.set_function("SC_LICENSEPLATE_GET_ISVALID_STATUS", LUA_NATIVE_SOCIALCLUB_SC_LICENSEPLATE_GET_ISVALID_STATUS);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_IS_ACTIVE", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_IS_ACTIVE);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EVENT_ID", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EVENT_ID);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_DISPLAY_NAME", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_DISPLAY_NAME);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_IS_ACTIVE_FOR_TYPE", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_IS_ACTIVE_FOR_TYPE);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EVENT_ID_FOR_TYPE", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EVENT_ID_FOR_TYPE);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT_FOR_TYPE", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT_FOR_TYPE);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT_FOR_TYPE", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT_FOR_TYPE);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING_FOR_TYPE", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING_FOR_TYPE);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_DISPLAY_NAME_FOR_TYPE", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_DISPLAY_NAME_FOR_TYPE);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_IS_ACTIVE_BY_ID", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_IS_ACTIVE_BY_ID);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT_BY_ID", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_INT_BY_ID);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT_BY_ID", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_FLOAT_BY_ID);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING_BY_ID", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_EXTRA_DATA_STRING_BY_ID);
-		SOCIALCLUB.set_function("SC_COMMUNITY_EVENT_GET_DISPLAY_NAME_BY_ID", LUA_NATIVE_SOCIALCLUB_SC_COMMUNITY_EVENT_GET_DISPLAY_NAME_BY_ID);
-		SOCIALCLUB.set_function("SC_TRANSITION_NEWS_SHOW", LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_SHOW);
-		SOCIALCLUB.set_function("SC_TRANSITION_NEWS_SHOW_TIMED", LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_SHOW_TIMED);
-		SOCIALCLUB.set_function("SC_TRANSITION_NEWS_SHOW_NEXT_ITEM", LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_SHOW_NEXT_ITEM);
-		SOCIALCLUB.set_function("SC_TRANSITION_NEWS_HAS_EXTRA_DATA_TU", LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_HAS_EXTRA_DATA_TU);
-		SOCIALCLUB.set_function("SC_TRANSITION_NEWS_GET_EXTRA_DATA_INT_TU", LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_GET_EXTRA_DATA_INT_TU);
-		SOCIALCLUB.set_function("SC_TRANSITION_NEWS_END", LUA_NATIVE_SOCIALCLUB_SC_TRANSITION_NEWS_END);
-		SOCIALCLUB.set_function("SC_PAUSE_NEWS_INIT_STARTER_PACK", LUA_NATIVE_SOCIALCLUB_SC_PAUSE_NEWS_INIT_STARTER_PACK);
-		SOCIALCLUB.set_function("SC_PAUSE_NEWS_GET_PENDING_STORY", LUA_NATIVE_SOCIALCLUB_SC_PAUSE_NEWS_GET_PENDING_STORY);
-		SOCIALCLUB.set_function("SC_PAUSE_NEWS_SHUTDOWN", LUA_NATIVE_SOCIALCLUB_SC_PAUSE_NEWS_SHUTDOWN);
-		SOCIALCLUB.set_function("SC_ACCOUNT_INFO_GET_NICKNAME", LUA_NATIVE_SOCIALCLUB_SC_ACCOUNT_INFO_GET_NICKNAME);
-		SOCIALCLUB.set_function("SC_ACHIEVEMENT_INFO_STATUS", LUA_NATIVE_SOCIALCLUB_SC_ACHIEVEMENT_INFO_STATUS);
-		SOCIALCLUB.set_function("SC_HAS_ACHIEVEMENT_BEEN_PASSED", LUA_NATIVE_SOCIALCLUB_SC_HAS_ACHIEVEMENT_BEEN_PASSED);
+		bind_namespace(L, "SOCIALCLUB", SOCIALCLUB_natives);
 	}
 }
@@ -1757,331 +1757,334 @@ namespace lua::native
 		STATS::_PLAYSTATS_SHOWROOM_OVERVIEW((Any*)data);
 	}
 
+	static constexpr native_entry STATS_natives[] = {
+		{"CHANGE_GOON_LOOKING_FOR_WORK", native_function<LUA_NATIVE_STATS_CHANGE_GOON_LOOKING_FOR_WORK>},
+		{"CHANGE_UNIFORM", native_function<LUA_NATIVE_STATS_CHANGE_UNIFORM>},
+		{"END_BEING_BOSS", native_function<LUA_NATIVE_STATS_END_BEING_BOSS>},
+		{"END_BEING_GOON", native_function<LUA_NATIVE_STATS_END_BEING_GOON>},
+		{"FORCE_CLOUD_MP_STATS_DOWNLOAD_AND_OVERWRITE_LOCAL_SAVE", native_function<LUA_NATIVE_STATS_FORCE_CLOUD_MP_STATS_DOWNLOAD_AND_OVERWRITE_LOCAL_SAVE>},
+		{"GET_BOSS_GOON_UUID", native_function<LUA_NATIVE_STATS_GET_BOSS_GOON_UUID>},
+		{"GET_PACKED_INT_STAT_KEY", native_function<LUA_NATIVE_STATS_GET_PACKED_INT_STAT_KEY>},
+		{"GET_PACKED_NG_INT_STAT_KEY", native_function<LUA_NATIVE_STATS_GET_PACKED_NG_INT_STAT_KEY>},
+		{"GET_PACKED_STAT_BOOL_CODE", native_function<LUA_NATIVE_STATS_GET_PACKED_STAT_BOOL_CODE>},
+		{"GET_PACKED_STAT_INT_CODE", native_function<LUA_NATIVE_STATS_GET_PACKED_STAT_INT_CODE>},
+		{"GET_PACKED_TU_INT_STAT_KEY", native_function<LUA_NATIVE_STATS_GET_PACKED_TU_INT_STAT_KEY>},
+		{"GET_PLAYER_HAS_DRIVEN_ALL_VEHICLES", native_function<LUA_NATIVE_STATS_GET_PLAYER_HAS_DRIVEN_ALL_VEHICLES>},
+		{"GET_STAT_HASH_FOR_CHARACTER_STAT_", native_function<LUA_NATIVE_STATS_GET_STAT_HASH_FOR_CHARACTER_STAT_>},
+		{"HIRED_LIMO", native_function<LUA_NATIVE_STATS_HIRED_LIMO>},
+		{"LEADERBOARDS2_READ_BY_HANDLE", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_HANDLE>},
+		{"LEADERBOARDS2_READ_BY_PLAFORM", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_PLAFORM>},
+		{"LEADERBOARDS2_READ_BY_RADIUS", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_RADIUS>},
+		{"LEADERBOARDS2_READ_BY_RANK", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_RANK>},
+		{"LEADERBOARDS2_READ_BY_SCORE_FLOAT", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_SCORE_FLOAT>},
+		{"LEADERBOARDS2_READ_BY_SCORE_INT", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_SCORE_INT>},
+		{"LEADERBOARDS2_READ_FRIENDS_BY_ROW", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_FRIENDS_BY_ROW>},
+		{"LEADERBOARDS2_READ_GET_ROW_DATA_END", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_END>},
+		{"LEADERBOARDS2_READ_GET_ROW_DATA_FLOAT", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_FLOAT>},
+		{"LEADERBOARDS2_READ_GET_ROW_DATA_INFO", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_INFO>},
+		{"LEADERBOARDS2_READ_GET_ROW_DATA_INT", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_INT>},
+		{"LEADERBOARDS2_READ_GET_ROW_DATA_START", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_START>},
+		{"LEADERBOARDS2_READ_RANK_PREDICTION", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_READ_RANK_PREDICTION>},
+		{"LEADERBOARDS2_WRITE_DATA", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_WRITE_DATA>},
+		{"LEADERBOARDS2_WRITE_DATA_FOR_EVENT_TYPE", native_function<LUA_NATIVE_STATS_LEADERBOARDS2_WRITE_DATA_FOR_EVENT_TYPE>},
+		{"LEADERBOARDS_CACHE_DATA_ROW", native_function<LUA_NATIVE_STATS_LEADERBOARDS_CACHE_DATA_ROW>},
+		{"LEADERBOARDS_CLEAR_CACHE_DATA", native_function<LUA_NATIVE_STATS_LEADERBOARDS_CLEAR_CACHE_DATA>},
+		{"LEADERBOARDS_CLEAR_CACHE_DATA_ID", native_function<LUA_NATIVE_STATS_LEADERBOARDS_CLEAR_CACHE_DATA_ID>},
+		{"LEADERBOARDS_GET_CACHE_DATA_ROW", native_function<LUA_NATIVE_STATS_LEADERBOARDS_GET_CACHE_DATA_ROW>},
+		{"LEADERBOARDS_GET_CACHE_EXISTS", native_function<LUA_NATIVE_STATS_LEADERBOARDS_GET_CACHE_EXISTS>},
+		{"LEADERBOARDS_GET_CACHE_NUMBER_OF_ROWS", native_function<LUA_NATIVE_STATS_LEADERBOARDS_GET_CACHE_NUMBER_OF_ROWS>},
+		{"LEADERBOARDS_GET_CACHE_TIME", native_function<LUA_NATIVE_STATS_LEADERBOARDS_GET_CACHE_TIME>},
+		{"LEADERBOARDS_GET_COLUMN_ID", native_function<LUA_NATIVE_STATS_LEADERBOARDS_GET_COLUMN_ID>},
+		{"LEADERBOARDS_GET_COLUMN_TYPE", native_function<LUA_NATIVE_STATS_LEADERBOARDS_GET_COLUMN_TYPE>},
+		{"LEADERBOARDS_GET_NUMBER_OF_COLUMNS", native_function<LUA_NATIVE_STATS_LEADERBOARDS_GET_NUMBER_OF_COLUMNS>},
+		{"LEADERBOARDS_READ_ANY_PENDING", native_function<LUA_NATIVE_STATS_LEADERBOARDS_READ_ANY_PENDING>},
+		{"LEADERBOARDS_READ_CLEAR", native_function<LUA_NATIVE_STATS_LEADERBOARDS_READ_CLEAR>},
+		{"LEADERBOARDS_READ_CLEAR_ALL", native_function<LUA_NATIVE_STATS_LEADERBOARDS_READ_CLEAR_ALL>},
+		{"LEADERBOARDS_READ_PENDING", native_function<LUA_NATIVE_STATS_LEADERBOARDS_READ_PENDING>},
+		{"LEADERBOARDS_READ_SUCCESSFUL", native_function<LUA_NATIVE_STATS_LEADERBOARDS_READ_SUCCESSFUL>},
+		{"LEADERBOARDS_WRITE_ADD_COLUMN", native_function<LUA_NATIVE_STATS_LEADERBOARDS_WRITE_ADD_COLUMN>},
+		{"LEADERBOARDS_WRITE_ADD_COLUMN_LONG", native_function<LUA_NATIVE_STATS_LEADERBOARDS_WRITE_ADD_COLUMN_LONG>},
+		{"ORDER_BOSS_VEHICLE", native_function<LUA_NATIVE_STATS_ORDER_BOSS_VEHICLE>},
+		{"PACKED_STAT_GET_INT_STAT_INDEX", native_function<LUA_NATIVE_STATS_PACKED_STAT_GET_INT_STAT_INDEX>},
+		{"PLAYSTATS_ABANDONED_MC", native_function<LUA_NATIVE_STATS_PLAYSTATS_ABANDONED_MC>},
+		{"PLAYSTATS_ACID_MISSION_END_", native_function<LUA_NATIVE_STATS_PLAYSTATS_ACID_MISSION_END_>},
+		{"PLAYSTATS_ACID_RND_", native_function<LUA_NATIVE_STATS_PLAYSTATS_ACID_RND_>},
+		{"PLAYSTATS_ACQUIRED_HIDDEN_PACKAGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_ACQUIRED_HIDDEN_PACKAGE>},
+		{"PLAYSTATS_ACTIVITY_DONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_ACTIVITY_DONE>},
+		{"PLAYSTATS_ALERT_", native_function<LUA_NATIVE_STATS_PLAYSTATS_ALERT_>},
+		{"PLAYSTATS_APPEND_DIRECTOR_METRIC", native_function<LUA_NATIVE_STATS_PLAYSTATS_APPEND_DIRECTOR_METRIC>},
+		{"PLAYSTATS_ARCADE_CABINET", native_function<LUA_NATIVE_STATS_PLAYSTATS_ARCADE_CABINET>},
+		{"PLAYSTATS_ARCADE_GAME", native_function<LUA_NATIVE_STATS_PLAYSTATS_ARCADE_GAME>},
+		{"PLAYSTATS_ARCADE_LOVE_MATCH", native_function<LUA_NATIVE_STATS_PLAYSTATS_ARCADE_LOVE_MATCH>},
+		{"PLAYSTATS_ARENA_WARS_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_ARENA_WARS_ENDED>},
+		{"PLAYSTATS_ARENA_WARS_SPECTATOR", native_function<LUA_NATIVE_STATS_PLAYSTATS_ARENA_WARS_SPECTATOR>},
+		{"PLAYSTATS_ATTRITION_STAGE_END_", native_function<LUA_NATIVE_STATS_PLAYSTATS_ATTRITION_STAGE_END_>},
+		{"PLAYSTATS_AWARD_BAD_SPORT", native_function<LUA_NATIVE_STATS_PLAYSTATS_AWARD_BAD_SPORT>},
+		{"PLAYSTATS_AWARD_NAV", native_function<LUA_NATIVE_STATS_PLAYSTATS_AWARD_NAV>},
+		{"PLAYSTATS_AWARD_XP", native_function<LUA_NATIVE_STATS_PLAYSTATS_AWARD_XP>},
+		{"PLAYSTATS_BACKGROUND_SCRIPT_ACTION", native_function<LUA_NATIVE_STATS_PLAYSTATS_BACKGROUND_SCRIPT_ACTION>},
+		{"PLAYSTATS_BAN_ALERT", native_function<LUA_NATIVE_STATS_PLAYSTATS_BAN_ALERT>},
+		{"PLAYSTATS_BC_CAR_JACKING", native_function<LUA_NATIVE_STATS_PLAYSTATS_BC_CAR_JACKING>},
+		{"PLAYSTATS_BC_CASHING", native_function<LUA_NATIVE_STATS_PLAYSTATS_BC_CASHING>},
+		{"PLAYSTATS_BC_FINDERS_KEEPERS", native_function<LUA_NATIVE_STATS_PLAYSTATS_BC_FINDERS_KEEPERS>},
+		{"PLAYSTATS_BC_MOST_WANTED", native_function<LUA_NATIVE_STATS_PLAYSTATS_BC_MOST_WANTED>},
+		{"PLAYSTATS_BC_POINT_TO_POINT", native_function<LUA_NATIVE_STATS_PLAYSTATS_BC_POINT_TO_POINT>},
+		{"PLAYSTATS_BC_PROTECTION_RACKET", native_function<LUA_NATIVE_STATS_PLAYSTATS_BC_PROTECTION_RACKET>},
+		{"PLAYSTATS_BC_SALVAGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_BC_SALVAGE>},
+		{"PLAYSTATS_BC_SMASH_AND_GRAB", native_function<LUA_NATIVE_STATS_PLAYSTATS_BC_SMASH_AND_GRAB>},
+		{"PLAYSTATS_BUSINESS_BATTLE_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_BUSINESS_BATTLE_ENDED>},
+		{"PLAYSTATS_BUY_CONTRABAND_MISSION", native_function<LUA_NATIVE_STATS_PLAYSTATS_BUY_CONTRABAND_MISSION>},
+		{"PLAYSTATS_BW_AIR_FREIGHT", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_AIR_FREIGHT>},
+		{"PLAYSTATS_BW_ASSAULT", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_ASSAULT>},
+		{"PLAYSTATS_BW_BELLY_OF_THE_BEAST", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_BELLY_OF_THE_BEAST>},
+		{"PLAYSTATS_BW_BOSSONBOSSDEATHMATCH", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_BOSSONBOSSDEATHMATCH>},
+		{"PLAYSTATS_BW_FRAGILE_GOODS", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_FRAGILE_GOODS>},
+		{"PLAYSTATS_BW_HEAD_HUNTER", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_HEAD_HUNTER>},
+		{"PLAYSTATS_BW_HUNT_THE_BOSS", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_HUNT_THE_BOSS>},
+		{"PLAYSTATS_BW_SIGHTSEER", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_SIGHTSEER>},
+		{"PLAYSTATS_BW_YATCHATTACK", native_function<LUA_NATIVE_STATS_PLAYSTATS_BW_YATCHATTACK>},
+		{"PLAYSTATS_CARCLUB_CHALLENGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_CARCLUB_CHALLENGE>},
+		{"PLAYSTATS_CARCLUB_POINTS", native_function<LUA_NATIVE_STATS_PLAYSTATS_CARCLUB_POINTS>},
+		{"PLAYSTATS_CARCLUB_PRIZE", native_function<LUA_NATIVE_STATS_PLAYSTATS_CARCLUB_PRIZE>},
+		{"PLAYSTATS_CASINO_BLACKJACK", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_BLACKJACK>},
+		{"PLAYSTATS_CASINO_BLACKJACK_LIGHT", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_BLACKJACK_LIGHT>},
+		{"PLAYSTATS_CASINO_CHIP", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_CHIP>},
+		{"PLAYSTATS_CASINO_INSIDE_TRACK", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_INSIDE_TRACK>},
+		{"PLAYSTATS_CASINO_INSIDE_TRACK_LIGHT", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_INSIDE_TRACK_LIGHT>},
+		{"PLAYSTATS_CASINO_LUCKY_SEVEN", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_LUCKY_SEVEN>},
+		{"PLAYSTATS_CASINO_ROULETTE", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_ROULETTE>},
+		{"PLAYSTATS_CASINO_ROULETTE_LIGHT", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_ROULETTE_LIGHT>},
+		{"PLAYSTATS_CASINO_SLOT_MACHINE", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_SLOT_MACHINE>},
+		{"PLAYSTATS_CASINO_SLOT_MACHINE_LIGHT", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_SLOT_MACHINE_LIGHT>},
+		{"PLAYSTATS_CASINO_STORY_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_STORY_MISSION_ENDED>},
+		{"PLAYSTATS_CASINO_THREE_CARD_POKER", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_THREE_CARD_POKER>},
+		{"PLAYSTATS_CASINO_THREE_CARD_POKER_LIGHT", native_function<LUA_NATIVE_STATS_PLAYSTATS_CASINO_THREE_CARD_POKER_LIGHT>},
+		{"PLAYSTATS_CHANGE_MC_OUTFIT", native_function<LUA_NATIVE_STATS_PLAYSTATS_CHANGE_MC_OUTFIT>},
+		{"PLAYSTATS_CHANGE_MC_ROLE", native_function<LUA_NATIVE_STATS_PLAYSTATS_CHANGE_MC_ROLE>},
+		{"PLAYSTATS_CHEAT_APPLIED", native_function<LUA_NATIVE_STATS_PLAYSTATS_CHEAT_APPLIED>},
+		{"PLAYSTATS_CLOTH_CHANGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_CLOTH_CHANGE>},
+		{"PLAYSTATS_COLLECTIBLE_PICKED_UP", native_function<LUA_NATIVE_STATS_PLAYSTATS_COLLECTIBLE_PICKED_UP>},
+		{"PLAYSTATS_COPY_RANK_INTO_NEW_SLOT", native_function<LUA_NATIVE_STATS_PLAYSTATS_COPY_RANK_INTO_NEW_SLOT>},
+		{"PLAYSTATS_CRATE_CREATED", native_function<LUA_NATIVE_STATS_PLAYSTATS_CRATE_CREATED>},
+		{"PLAYSTATS_CRATE_DROP_MISSION_DONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_CRATE_DROP_MISSION_DONE>},
+		{"PLAYSTATS_CREATE_MATCH_HISTORY_ID_2", native_function<LUA_NATIVE_STATS_PLAYSTATS_CREATE_MATCH_HISTORY_ID_2>},
+		{"PLAYSTATS_DAR_CHECKPOINT", native_function<LUA_NATIVE_STATS_PLAYSTATS_DAR_CHECKPOINT>},
+		{"PLAYSTATS_DEFEND_CONTRABAND_MISSION", native_function<LUA_NATIVE_STATS_PLAYSTATS_DEFEND_CONTRABAND_MISSION>},
+		{"PLAYSTATS_DJ_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_DJ_MISSION_ENDED>},
+		{"PLAYSTATS_DJ_USAGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_DJ_USAGE>},
+		{"PLAYSTATS_DRONE_USAGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_DRONE_USAGE>},
+		{"PLAYSTATS_DUPE_DETECTED", native_function<LUA_NATIVE_STATS_PLAYSTATS_DUPE_DETECTED>},
+		{"PLAYSTATS_EARNED_MC_POINTS", native_function<LUA_NATIVE_STATS_PLAYSTATS_EARNED_MC_POINTS>},
+		{"PLAYSTATS_ENTER_SESSION_PACK", native_function<LUA_NATIVE_STATS_PLAYSTATS_ENTER_SESSION_PACK>},
+		{"PLAYSTATS_EXTRA_EVENT", native_function<LUA_NATIVE_STATS_PLAYSTATS_EXTRA_EVENT>},
+		{"PLAYSTATS_FAST_TRVL", native_function<LUA_NATIVE_STATS_PLAYSTATS_FAST_TRVL>},
+		{"PLAYSTATS_FLOW_LOW_", native_function<LUA_NATIVE_STATS_PLAYSTATS_FLOW_LOW_>},
+		{"PLAYSTATS_FLOW_MEDIUM_", native_function<LUA_NATIVE_STATS_PLAYSTATS_FLOW_MEDIUM_>},
+		{"PLAYSTATS_FM_EVENT_ATOB", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_ATOB>},
+		{"PLAYSTATS_FM_EVENT_CHALLENGES", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_CHALLENGES>},
+		{"PLAYSTATS_FM_EVENT_CHECKPOINTCOLLECTION", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_CHECKPOINTCOLLECTION>},
+		{"PLAYSTATS_FM_EVENT_COMPETITIVEURBANWARFARE", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_COMPETITIVEURBANWARFARE>},
+		{"PLAYSTATS_FM_EVENT_CRIMINALDAMAGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_CRIMINALDAMAGE>},
+		{"PLAYSTATS_FM_EVENT_DEADDROP", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_DEADDROP>},
+		{"PLAYSTATS_FM_EVENT_HOTPROPERTY", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_HOTPROPERTY>},
+		{"PLAYSTATS_FM_EVENT_HUNTBEAST", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_HUNTBEAST>},
+		{"PLAYSTATS_FM_EVENT_KINGOFTHECASTLE", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_KINGOFTHECASTLE>},
+		{"PLAYSTATS_FM_EVENT_PASSTHEPARCEL", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_PASSTHEPARCEL>},
+		{"PLAYSTATS_FM_EVENT_PENNEDIN", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_PENNEDIN>},
+		{"PLAYSTATS_FM_EVENT_URBANWARFARE", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_URBANWARFARE>},
+		{"PLAYSTATS_FM_EVENT_VEHICLETARGET", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_VEHICLETARGET>},
+		{"PLAYSTATS_FM_HEIST_PREP_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_HEIST_PREP_ENDED>},
+		{"PLAYSTATS_FM_MISSION_END", native_function<LUA_NATIVE_STATS_PLAYSTATS_FM_MISSION_END>},
+		{"PLAYSTATS_FREEMODE_CASINO_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_FREEMODE_CASINO_MISSION_ENDED>},
+		{"PLAYSTATS_FRIEND_ACTIVITY", native_function<LUA_NATIVE_STATS_PLAYSTATS_FRIEND_ACTIVITY>},
+		{"PLAYSTATS_GUNRUNNING_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_GUNRUNNING_MISSION_ENDED>},
+		{"PLAYSTATS_GUNRUNNING_RND", native_function<LUA_NATIVE_STATS_PLAYSTATS_GUNRUNNING_RND>},
+		{"PLAYSTATS_HEIST3_DRONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_HEIST3_DRONE>},
+		{"PLAYSTATS_HEIST3_FINALE", native_function<LUA_NATIVE_STATS_PLAYSTATS_HEIST3_FINALE>},
+		{"PLAYSTATS_HEIST3_HACK", native_function<LUA_NATIVE_STATS_PLAYSTATS_HEIST3_HACK>},
+		{"PLAYSTATS_HEIST3_PREP", native_function<LUA_NATIVE_STATS_PLAYSTATS_HEIST3_PREP>},
+		{"PLAYSTATS_HEIST4_FINALE", native_function<LUA_NATIVE_STATS_PLAYSTATS_HEIST4_FINALE>},
+		{"PLAYSTATS_HEIST4_HACK", native_function<LUA_NATIVE_STATS_PLAYSTATS_HEIST4_HACK>},
+		{"PLAYSTATS_HEIST4_PREP", native_function<LUA_NATIVE_STATS_PLAYSTATS_HEIST4_PREP>},
+		{"PLAYSTATS_HEIST_SAVE_CHEAT", native_function<LUA_NATIVE_STATS_PLAYSTATS_HEIST_SAVE_CHEAT>},
+		{"PLAYSTATS_HIT_CONTRABAND_DESTROY_LIMIT", native_function<LUA_NATIVE_STATS_PLAYSTATS_HIT_CONTRABAND_DESTROY_LIMIT>},
+		{"PLAYSTATS_HOLD_UP_MISSION_DONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_HOLD_UP_MISSION_DONE>},
+		{"PLAYSTATS_HUB_ENTRY", native_function<LUA_NATIVE_STATS_PLAYSTATS_HUB_ENTRY>},
+		{"PLAYSTATS_HUB_EXIT", native_function<LUA_NATIVE_STATS_PLAYSTATS_HUB_EXIT>},
+		{"PLAYSTATS_IDLE_", native_function<LUA_NATIVE_STATS_PLAYSTATS_IDLE_>},
+		{"PLAYSTATS_IDLE_KICK", native_function<LUA_NATIVE_STATS_PLAYSTATS_IDLE_KICK>},
+		{"PLAYSTATS_IMPEXP_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_IMPEXP_MISSION_ENDED>},
+		{"PLAYSTATS_IMPORT_EXPORT_MISSION_DONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_IMPORT_EXPORT_MISSION_DONE>},
+		{"PLAYSTATS_INSTANCED_HEIST_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_INSTANCED_HEIST_ENDED>},
+		{"PLAYSTATS_INST_MISSION_END", native_function<LUA_NATIVE_STATS_PLAYSTATS_INST_MISSION_END>},
+		{"PLAYSTATS_INVENTORY", native_function<LUA_NATIVE_STATS_PLAYSTATS_INVENTORY>},
+		{"PLAYSTATS_JOB_ACTIVITY_END", native_function<LUA_NATIVE_STATS_PLAYSTATS_JOB_ACTIVITY_END>},
+		{"PLAYSTATS_JOB_BEND", native_function<LUA_NATIVE_STATS_PLAYSTATS_JOB_BEND>},
+		{"PLAYSTATS_JOB_LTS_END", native_function<LUA_NATIVE_STATS_PLAYSTATS_JOB_LTS_END>},
+		{"PLAYSTATS_JOB_LTS_ROUND_END", native_function<LUA_NATIVE_STATS_PLAYSTATS_JOB_LTS_ROUND_END>},
+		{"PLAYSTATS_LEAVE_JOB_CHAIN", native_function<LUA_NATIVE_STATS_PLAYSTATS_LEAVE_JOB_CHAIN>},
+		{"PLAYSTATS_MASTER_CONTROL", native_function<LUA_NATIVE_STATS_PLAYSTATS_MASTER_CONTROL>},
+		{"PLAYSTATS_MATCH_STARTED", native_function<LUA_NATIVE_STATS_PLAYSTATS_MATCH_STARTED>},
+		{"PLAYSTATS_MC_CLUBHOUSE_ACTIVITY", native_function<LUA_NATIVE_STATS_PLAYSTATS_MC_CLUBHOUSE_ACTIVITY>},
+		{"PLAYSTATS_MC_FORMATION_ENDS", native_function<LUA_NATIVE_STATS_PLAYSTATS_MC_FORMATION_ENDS>},
+		{"PLAYSTATS_MC_KILLED_RIVAL_MC_MEMBER", native_function<LUA_NATIVE_STATS_PLAYSTATS_MC_KILLED_RIVAL_MC_MEMBER>},
+		{"PLAYSTATS_MC_REQUEST_BIKE", native_function<LUA_NATIVE_STATS_PLAYSTATS_MC_REQUEST_BIKE>},
+		{"PLAYSTATS_MINIGAME_USAGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_MINIGAME_USAGE>},
+		{"PLAYSTATS_MISSION_CHECKPOINT", native_function<LUA_NATIVE_STATS_PLAYSTATS_MISSION_CHECKPOINT>},
+		{"PLAYSTATS_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_MISSION_ENDED>},
+		{"PLAYSTATS_MISSION_OVER", native_function<LUA_NATIVE_STATS_PLAYSTATS_MISSION_OVER>},
+		{"PLAYSTATS_MISSION_STARTED", native_function<LUA_NATIVE_STATS_PLAYSTATS_MISSION_STARTED>},
+		{"PLAYSTATS_MISSION_VOTE", native_function<LUA_NATIVE_STATS_PLAYSTATS_MISSION_VOTE>},
+		{"PLAYSTATS_NIGHTCLUB_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_NIGHTCLUB_MISSION_ENDED>},
+		{"PLAYSTATS_NJVS_VOTE", native_function<LUA_NATIVE_STATS_PLAYSTATS_NJVS_VOTE>},
+		{"PLAYSTATS_NPC_INVITE", native_function<LUA_NATIVE_STATS_PLAYSTATS_NPC_INVITE>},
+		{"PLAYSTATS_NPC_PHONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_NPC_PHONE>},
+		{"PLAYSTATS_ODDJOB_DONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_ODDJOB_DONE>},
+		{"PLAYSTATS_PEGASUS_AS_PERSONAL_AIRCRAFT", native_function<LUA_NATIVE_STATS_PLAYSTATS_PEGASUS_AS_PERSONAL_AIRCRAFT>},
+		{"PLAYSTATS_PIMENU_HIDE_OPTIONS", native_function<LUA_NATIVE_STATS_PLAYSTATS_PIMENU_HIDE_OPTIONS>},
+		{"PLAYSTATS_PLAYER_STYLE_", native_function<LUA_NATIVE_STATS_PLAYSTATS_PLAYER_STYLE_>},
+		{"PLAYSTATS_PROP_CHANGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_PROP_CHANGE>},
+		{"PLAYSTATS_QUICKFIX_TOOL", native_function<LUA_NATIVE_STATS_PLAYSTATS_QUICKFIX_TOOL>},
+		{"PLAYSTATS_QUIT_MODE", native_function<LUA_NATIVE_STATS_PLAYSTATS_QUIT_MODE>},
+		{"PLAYSTATS_RACE_CHECKPOINT", native_function<LUA_NATIVE_STATS_PLAYSTATS_RACE_CHECKPOINT>},
+		{"PLAYSTATS_RACE_TO_POINT_MISSION_DONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_RACE_TO_POINT_MISSION_DONE>},
+		{"PLAYSTATS_RANDOM_EVENT_", native_function<LUA_NATIVE_STATS_PLAYSTATS_RANDOM_EVENT_>},
+		{"PLAYSTATS_RANDOM_MISSION_DONE", native_function<LUA_NATIVE_STATS_PLAYSTATS_RANDOM_MISSION_DONE>},
+		{"PLAYSTATS_RANK_UP", native_function<LUA_NATIVE_STATS_PLAYSTATS_RANK_UP>},
+		{"PLAYSTATS_RECOVER_CONTRABAND_MISSION", native_function<LUA_NATIVE_STATS_PLAYSTATS_RECOVER_CONTRABAND_MISSION>},
+		{"PLAYSTATS_RIVAL_BEHAVIOR", native_function<LUA_NATIVE_STATS_PLAYSTATS_RIVAL_BEHAVIOR>},
+		{"PLAYSTATS_ROBBERY_FINALE", native_function<LUA_NATIVE_STATS_PLAYSTATS_ROBBERY_FINALE>},
+		{"PLAYSTATS_ROBBERY_PREP", native_function<LUA_NATIVE_STATS_PLAYSTATS_ROBBERY_PREP>},
+		{"PLAYSTATS_ROS_BET", native_function<LUA_NATIVE_STATS_PLAYSTATS_ROS_BET>},
+		{"PLAYSTATS_SELL_CONTRABAND_MISSION", native_function<LUA_NATIVE_STATS_PLAYSTATS_SELL_CONTRABAND_MISSION>},
+		{"PLAYSTATS_SET_JOIN_TYPE", native_function<LUA_NATIVE_STATS_PLAYSTATS_SET_JOIN_TYPE>},
+		{"PLAYSTATS_SHOPMENU_NAV_", native_function<LUA_NATIVE_STATS_PLAYSTATS_SHOPMENU_NAV_>},
+		{"PLAYSTATS_SHOP_ITEM", native_function<LUA_NATIVE_STATS_PLAYSTATS_SHOP_ITEM>},
+		{"PLAYSTATS_SHOWROOM_NAV_", native_function<LUA_NATIVE_STATS_PLAYSTATS_SHOWROOM_NAV_>},
+		{"PLAYSTATS_SHOWROOM_OVERVIEW_", native_function<LUA_NATIVE_STATS_PLAYSTATS_SHOWROOM_OVERVIEW_>},
+		{"PLAYSTATS_SMUGGLER_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_SMUGGLER_MISSION_ENDED>},
+		{"PLAYSTATS_SPENT_PI_CUSTOM_LOADOUT", native_function<LUA_NATIVE_STATS_PLAYSTATS_SPENT_PI_CUSTOM_LOADOUT>},
+		{"PLAYSTATS_SPIN_WHEEL", native_function<LUA_NATIVE_STATS_PLAYSTATS_SPIN_WHEEL>},
+		{"PLAYSTATS_STARTED_SESSION_IN_OFFLINEMODE", native_function<LUA_NATIVE_STATS_PLAYSTATS_STARTED_SESSION_IN_OFFLINEMODE>},
+		{"PLAYSTATS_START_TRACKING_STUNTS", native_function<LUA_NATIVE_STATS_PLAYSTATS_START_TRACKING_STUNTS>},
+		{"PLAYSTATS_STONE_HATCHET_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_STONE_HATCHET_ENDED>},
+		{"PLAYSTATS_STOP_TRACKING_STUNTS", native_function<LUA_NATIVE_STATS_PLAYSTATS_STOP_TRACKING_STUNTS>},
+		{"PLAYSTATS_SUB_WEAP", native_function<LUA_NATIVE_STATS_PLAYSTATS_SUB_WEAP>},
+		{"PLAYSTATS_SWITCH_MC_EMBLEM", native_function<LUA_NATIVE_STATS_PLAYSTATS_SWITCH_MC_EMBLEM>},
+		{"PLAYSTATS_SWITCH_PASSIVE_MODE", native_function<LUA_NATIVE_STATS_PLAYSTATS_SWITCH_PASSIVE_MODE>},
+		{"PLAYSTATS_VEH_DEL", native_function<LUA_NATIVE_STATS_PLAYSTATS_VEH_DEL>},
+		{"PLAYSTATS_WAREHOUSE_MISSION_ENDED", native_function<LUA_NATIVE_STATS_PLAYSTATS_WAREHOUSE_MISSION_ENDED>},
+		{"PLAYSTATS_WEAPON_MODE_CHANGE", native_function<LUA_NATIVE_STATS_PLAYSTATS_WEAPON_MODE_CHANGE>},
+		{"PLAYSTATS_WEBSITE_VISITED", native_function<LUA_NATIVE_STATS_PLAYSTATS_WEBSITE_VISITED>},
+		{"PRESENCE_EVENT_UPDATESTAT_FLOAT", native_function<LUA_NATIVE_STATS_PRESENCE_EVENT_UPDATESTAT_FLOAT>},
+		{"PRESENCE_EVENT_UPDATESTAT_INT", native_function<LUA_NATIVE_STATS_PRESENCE_EVENT_UPDATESTAT_INT>},
+		{"PRESENCE_EVENT_UPDATESTAT_INT_WITH_STRING", native_function<LUA_NATIVE_STATS_PRESENCE_EVENT_UPDATESTAT_INT_WITH_STRING>},
+		{"SEND_METRIC_GHOSTING_TO_PLAYER", native_function<LUA_NATIVE_STATS_SEND_METRIC_GHOSTING_TO_PLAYER>},
+		{"SEND_METRIC_PUNISH_BODYGUARD", native_function<LUA_NATIVE_STATS_SEND_METRIC_PUNISH_BODYGUARD>},
+		{"SEND_METRIC_VIP_POACH", native_function<LUA_NATIVE_STATS_SEND_METRIC_VIP_POACH>},
+		{"SET_FREEMODE_PROLOGUE_DONE", native_function<LUA_NATIVE_STATS_SET_FREEMODE_PROLOGUE_DONE>},
+		{"SET_FREEMODE_STRAND_PROGRESSION_STATUS", native_function<LUA_NATIVE_STATS_SET_FREEMODE_STRAND_PROGRESSION_STATUS>},
+		{"SET_HAS_POSTED_ALL_VEHICLES_DRIVEN", native_function<LUA_NATIVE_STATS_SET_HAS_POSTED_ALL_VEHICLES_DRIVEN>},
+		{"SET_HAS_SPECIALEDITION_CONTENT", native_function<LUA_NATIVE_STATS_SET_HAS_SPECIALEDITION_CONTENT>},
+		{"SET_JOB_ACTIVITY_ID_STARTED", native_function<LUA_NATIVE_STATS_SET_JOB_ACTIVITY_ID_STARTED>},
+		{"SET_PACKED_STAT_BOOL_CODE", native_function<LUA_NATIVE_STATS_SET_PACKED_STAT_BOOL_CODE>},
+		{"SET_PACKED_STAT_INT_CODE", native_function<LUA_NATIVE_STATS_SET_PACKED_STAT_INT_CODE>},
+		{"SET_PROFILE_SETTING_CREATOR_CTF_DONE", native_function<LUA_NATIVE_STATS_SET_PROFILE_SETTING_CREATOR_CTF_DONE>},
+		{"SET_PROFILE_SETTING_CREATOR_DM_DONE", native_function<LUA_NATIVE_STATS_SET_PROFILE_SETTING_CREATOR_DM_DONE>},
+		{"SET_PROFILE_SETTING_CREATOR_RACES_DONE", native_function<LUA_NATIVE_STATS_SET_PROFILE_SETTING_CREATOR_RACES_DONE>},
+		{"SET_PROFILE_SETTING_PROLOGUE_COMPLETE", native_function<LUA_NATIVE_STATS_SET_PROFILE_SETTING_PROLOGUE_COMPLETE>},
+		{"SET_PROFILE_SETTING_SP_CHOP_MISSION_COMPLETE", native_function<LUA_NATIVE_STATS_SET_PROFILE_SETTING_SP_CHOP_MISSION_COMPLETE>},
+		{"SET_SAVE_MIGRATION_TRANSACTION_ID_WARNING", native_function<LUA_NATIVE_STATS_SET_SAVE_MIGRATION_TRANSACTION_ID_WARNING>},
+		{"START_BEING_BOSS", native_function<LUA_NATIVE_STATS_START_BEING_BOSS>},
+		{"START_BEING_GOON", native_function<LUA_NATIVE_STATS_START_BEING_GOON>},
+		{"STATS_COMPLETED_CHARACTER_CREATION", native_function<LUA_NATIVE_STATS_STATS_COMPLETED_CHARACTER_CREATION>},
+		{"STAT_CLEAR_DIRTY_READ_DETECTED", native_function<LUA_NATIVE_STATS_STAT_CLEAR_DIRTY_READ_DETECTED>},
+		{"STAT_CLEAR_PENDING_SAVES", native_function<LUA_NATIVE_STATS_STAT_CLEAR_PENDING_SAVES>},
+		{"STAT_CLEAR_SLOT_FOR_RELOAD", native_function<LUA_NATIVE_STATS_STAT_CLEAR_SLOT_FOR_RELOAD>},
+		{"STAT_CLOUD_SLOT_LOAD_FAILED", native_function<LUA_NATIVE_STATS_STAT_CLOUD_SLOT_LOAD_FAILED>},
+		{"STAT_CLOUD_SLOT_LOAD_FAILED_CODE", native_function<LUA_NATIVE_STATS_STAT_CLOUD_SLOT_LOAD_FAILED_CODE>},
+		{"STAT_CLOUD_SLOT_SAVE_FAILED", native_function<LUA_NATIVE_STATS_STAT_CLOUD_SLOT_SAVE_FAILED>},
+		{"STAT_COMMUNITY_GET_HISTORY", native_function<LUA_NATIVE_STATS_STAT_COMMUNITY_GET_HISTORY>},
+		{"STAT_COMMUNITY_START_SYNCH", native_function<LUA_NATIVE_STATS_STAT_COMMUNITY_START_SYNCH>},
+		{"STAT_COMMUNITY_SYNCH_IS_PENDING", native_function<LUA_NATIVE_STATS_STAT_COMMUNITY_SYNCH_IS_PENDING>},
+		{"STAT_DELETE_SLOT", native_function<LUA_NATIVE_STATS_STAT_DELETE_SLOT>},
+		{"STAT_DISABLE_STATS_TRACKING", native_function<LUA_NATIVE_STATS_STAT_DISABLE_STATS_TRACKING>},
+		{"STAT_ENABLE_STATS_TRACKING", native_function<LUA_NATIVE_STATS_STAT_ENABLE_STATS_TRACKING>},
+		{"STAT_GET_BLOCK_SAVES", native_function<LUA_NATIVE_STATS_STAT_GET_BLOCK_SAVES>},
+		{"STAT_GET_BOOL", native_function<LUA_NATIVE_STATS_STAT_GET_BOOL>},
+		{"STAT_GET_CANCEL_SAVE_MIGRATION_STATUS", native_function<LUA_NATIVE_STATS_STAT_GET_CANCEL_SAVE_MIGRATION_STATUS>},
+		{"STAT_GET_CHALLENGE_FLYING_DIST", native_function<LUA_NATIVE_STATS_STAT_GET_CHALLENGE_FLYING_DIST>},
+		{"STAT_GET_CURRENT_DRIVE_NOCRASH_DISTANCE", native_function<LUA_NATIVE_STATS_STAT_GET_CURRENT_DRIVE_NOCRASH_DISTANCE>},
+		{"STAT_GET_CURRENT_DRIVING_REVERSE_DISTANCE", native_function<LUA_NATIVE_STATS_STAT_GET_CURRENT_DRIVING_REVERSE_DISTANCE>},
+		{"STAT_GET_CURRENT_FRONT_WHEEL_DISTANCE", native_function<LUA_NATIVE_STATS_STAT_GET_CURRENT_FRONT_WHEEL_DISTANCE>},
+		{"STAT_GET_CURRENT_JUMP_DISTANCE", native_function<LUA_NATIVE_STATS_STAT_GET_CURRENT_JUMP_DISTANCE>},
+		{"STAT_GET_CURRENT_NEAR_MISS_NOCRASH_PRECISE", native_function<LUA_NATIVE_STATS_STAT_GET_CURRENT_NEAR_MISS_NOCRASH_PRECISE>},
+		{"STAT_GET_CURRENT_REAR_WHEEL_DISTANCE", native_function<LUA_NATIVE_STATS_STAT_GET_CURRENT_REAR_WHEEL_DISTANCE>},
+		{"STAT_GET_CURRENT_SKYDIVING_DISTANCE", native_function<LUA_NATIVE_STATS_STAT_GET_CURRENT_SKYDIVING_DISTANCE>},
+		{"STAT_GET_CURRENT_SPEED", native_function<LUA_NATIVE_STATS_STAT_GET_CURRENT_SPEED>},
+		{"STAT_GET_DATE", native_function<LUA_NATIVE_STATS_STAT_GET_DATE>},
+		{"STAT_GET_FLOAT", native_function<LUA_NATIVE_STATS_STAT_GET_FLOAT>},
+		{"STAT_GET_FLYING_ALTITUDE", native_function<LUA_NATIVE_STATS_STAT_GET_FLYING_ALTITUDE>},
+		{"STAT_GET_INT", native_function<LUA_NATIVE_STATS_STAT_GET_INT>},
+		{"STAT_GET_LICENSE_PLATE", native_function<LUA_NATIVE_STATS_STAT_GET_LICENSE_PLATE>},
+		{"STAT_GET_LOAD_SAFE_TO_PROGRESS_TO_MP_FROM_SP", native_function<LUA_NATIVE_STATS_STAT_GET_LOAD_SAFE_TO_PROGRESS_TO_MP_FROM_SP>},
+		{"STAT_GET_MASKED_INT", native_function<LUA_NATIVE_STATS_STAT_GET_MASKED_INT>},
+		{"STAT_GET_NUMBER_OF_DAYS", native_function<LUA_NATIVE_STATS_STAT_GET_NUMBER_OF_DAYS>},
+		{"STAT_GET_NUMBER_OF_HOURS", native_function<LUA_NATIVE_STATS_STAT_GET_NUMBER_OF_HOURS>},
+		{"STAT_GET_NUMBER_OF_MINUTES", native_function<LUA_NATIVE_STATS_STAT_GET_NUMBER_OF_MINUTES>},
+		{"STAT_GET_NUMBER_OF_SECONDS", native_function<LUA_NATIVE_STATS_STAT_GET_NUMBER_OF_SECONDS>},
+		{"STAT_GET_POS", native_function<LUA_NATIVE_STATS_STAT_GET_POS>},
+		{"STAT_GET_RECORDED_VALUE", native_function<LUA_NATIVE_STATS_STAT_GET_RECORDED_VALUE>},
+		{"STAT_GET_SAVE_MIGRATION_CONSUME_CONTENT_STATUS", native_function<LUA_NATIVE_STATS_STAT_GET_SAVE_MIGRATION_CONSUME_CONTENT_STATUS>},
+		{"STAT_GET_SAVE_MIGRATION_STATUS", native_function<LUA_NATIVE_STATS_STAT_GET_SAVE_MIGRATION_STATUS>},
+		{"STAT_GET_STRING", native_function<LUA_NATIVE_STATS_STAT_GET_STRING>},
+		{"STAT_GET_USER_ID", native_function<LUA_NATIVE_STATS_STAT_GET_USER_ID>},
+		{"STAT_GET_VEHICLE_BAIL_DISTANCE", native_function<LUA_NATIVE_STATS_STAT_GET_VEHICLE_BAIL_DISTANCE>},
+		{"STAT_INCREMENT", native_function<LUA_NATIVE_STATS_STAT_INCREMENT>},
+		{"STAT_IS_PLAYER_VEHICLE_ABOVE_OCEAN", native_function<LUA_NATIVE_STATS_STAT_IS_PLAYER_VEHICLE_ABOVE_OCEAN>},
+		{"STAT_IS_RECORDING_STAT", native_function<LUA_NATIVE_STATS_STAT_IS_RECORDING_STAT>},
+		{"STAT_IS_STATS_TRACKING_ENABLED", native_function<LUA_NATIVE_STATS_STAT_IS_STATS_TRACKING_ENABLED>},
+		{"STAT_LOAD", native_function<LUA_NATIVE_STATS_STAT_LOAD>},
+		{"STAT_LOAD_DIRTY_READ_DETECTED", native_function<LUA_NATIVE_STATS_STAT_LOAD_DIRTY_READ_DETECTED>},
+		{"STAT_LOAD_PENDING", native_function<LUA_NATIVE_STATS_STAT_LOAD_PENDING>},
+		{"STAT_LOCAL_RESET_ALL_ONLINE_CHARACTER_STATS", native_function<LUA_NATIVE_STATS_STAT_LOCAL_RESET_ALL_ONLINE_CHARACTER_STATS>},
+		{"STAT_MIGRATE_CHECK_ALREADY_DONE", native_function<LUA_NATIVE_STATS_STAT_MIGRATE_CHECK_ALREADY_DONE>},
+		{"STAT_MIGRATE_CHECK_GET_IS_PLATFORM_AVAILABLE", native_function<LUA_NATIVE_STATS_STAT_MIGRATE_CHECK_GET_IS_PLATFORM_AVAILABLE>},
+		{"STAT_MIGRATE_CHECK_GET_PLATFORM_STATUS", native_function<LUA_NATIVE_STATS_STAT_MIGRATE_CHECK_GET_PLATFORM_STATUS>},
+		{"STAT_MIGRATE_CHECK_START", native_function<LUA_NATIVE_STATS_STAT_MIGRATE_CHECK_START>},
+		{"STAT_MIGRATE_CLEAR_FOR_RESTART", native_function<LUA_NATIVE_STATS_STAT_MIGRATE_CLEAR_FOR_RESTART>},
+		{"STAT_MIGRATE_SAVEGAME_GET_STATUS", native_function<LUA_NATIVE_STATS_STAT_MIGRATE_SAVEGAME_GET_STATUS>},
+		{"STAT_MIGRATE_SAVEGAME_START", native_function<LUA_NATIVE_STATS_STAT_MIGRATE_SAVEGAME_START>},
+		{"STAT_NETWORK_INCREMENT_ON_SUICIDE", native_function<LUA_NATIVE_STATS_STAT_NETWORK_INCREMENT_ON_SUICIDE>},
+		{"STAT_RESET_ALL_ONLINE_CHARACTER_STATS", native_function<LUA_NATIVE_STATS_STAT_RESET_ALL_ONLINE_CHARACTER_STATS>},
+		{"STAT_ROLLBACK_SAVE_MIGRATION", native_function<LUA_NATIVE_STATS_STAT_ROLLBACK_SAVE_MIGRATION>},
+		{"STAT_SAVE", native_function<LUA_NATIVE_STATS_STAT_SAVE>},
+		{"STAT_SAVE_MIGRATION_CANCEL_PENDING_OPERATION", native_function<LUA_NATIVE_STATS_STAT_SAVE_MIGRATION_CANCEL_PENDING_OPERATION>},
+		{"STAT_SAVE_MIGRATION_CONSUME_CONTENT", native_function<LUA_NATIVE_STATS_STAT_SAVE_MIGRATION_CONSUME_CONTENT>},
+		{"STAT_SAVE_PENDING", native_function<LUA_NATIVE_STATS_STAT_SAVE_PENDING>},
+		{"STAT_SAVE_PENDING_OR_REQUESTED", native_function<LUA_NATIVE_STATS_STAT_SAVE_PENDING_OR_REQUESTED>},
+		{"STAT_SET_BLOCK_SAVES", native_function<LUA_NATIVE_STATS_STAT_SET_BLOCK_SAVES>},
+		{"STAT_SET_BOOL", native_function<LUA_NATIVE_STATS_STAT_SET_BOOL>},
+		{"STAT_SET_CHEAT_IS_ACTIVE", native_function<LUA_NATIVE_STATS_STAT_SET_CHEAT_IS_ACTIVE>},
+		{"STAT_SET_CURRENT_POSIX_TIME", native_function<LUA_NATIVE_STATS_STAT_SET_CURRENT_POSIX_TIME>},
+		{"STAT_SET_DATE", native_function<LUA_NATIVE_STATS_STAT_SET_DATE>},
+		{"STAT_SET_FLOAT", native_function<LUA_NATIVE_STATS_STAT_SET_FLOAT>},
+		{"STAT_SET_GXT_LABEL", native_function<LUA_NATIVE_STATS_STAT_SET_GXT_LABEL>},
+		{"STAT_SET_INT", native_function<LUA_NATIVE_STATS_STAT_SET_INT>},
+		{"STAT_SET_LICENSE_PLATE", native_function<LUA_NATIVE_STATS_STAT_SET_LICENSE_PLATE>},
+		{"STAT_SET_MASKED_INT", native_function<LUA_NATIVE_STATS_STAT_SET_MASKED_INT>},
+		{"STAT_SET_OPEN_SAVETYPE_IN_JOB", native_function<LUA_NATIVE_STATS_STAT_SET_OPEN_SAVETYPE_IN_JOB>},
+		{"STAT_SET_POS", native_function<LUA_NATIVE_STATS_STAT_SET_POS>},
+		{"STAT_SET_PROFILE_SETTING_VALUE", native_function<LUA_NATIVE_STATS_STAT_SET_PROFILE_SETTING_VALUE>},
+		{"STAT_SET_STRING", native_function<LUA_NATIVE_STATS_STAT_SET_STRING>},
+		{"STAT_SET_USER_ID", native_function<LUA_NATIVE_STATS_STAT_SET_USER_ID>},
+		{"STAT_SLOT_IS_LOADED", native_function<LUA_NATIVE_STATS_STAT_SLOT_IS_LOADED>},
+		{"STAT_START_RECORD_STAT", native_function<LUA_NATIVE_STATS_STAT_START_RECORD_STAT>},
+		{"STAT_STOP_RECORD_STAT", native_function<LUA_NATIVE_STATS_STAT_STOP_RECORD_STAT>},
+	};
+
 	void init_native_binding_STATS(sol::state& L)
 	{
-		auto STATS = L["STATS"].get_or_create<sol::table>();
-		STATS.set_function("STAT_CLEAR_SLOT_FOR_RELOAD", LUA_NATIVE_STATS_STAT_CLEAR_SLOT_FOR_RELOAD);
-		STATS.set_function("STAT_LOAD", LUA_NATIVE_STATS_STAT_LOAD);
-		STATS.set_function("STAT_SAVE", LUA_NATIVE_STATS_STAT_SAVE);
-		STATS.set_function("STAT_SET_OPEN_SAVETYPE_IN_JOB", LUA_NATIVE_STATS_STAT_SET_OPEN_SAVETYPE_IN_JOB);
-		STATS.set_function("STAT_LOAD_PENDING", LUA_NATIVE_STATS_STAT_LOAD_PENDING);
-		STATS.set_function("STAT_SAVE_PENDING", LUA_NATIVE_STATS_STAT_SAVE_PENDING);
-		STATS.set_function("STAT_SAVE_PENDING_OR_REQUESTED", LUA_NATIVE_STATS_STAT_SAVE_PENDING_OR_REQUESTED);
-		STATS.set_function("STAT_DELETE_SLOT", LUA_NATIVE_STATS_STAT_DELETE_SLOT);
-		STATS.set_function("STAT_SLOT_IS_LOADED", LUA_NATIVE_STATS_STAT_SLOT_IS_LOADED);
-		STATS.set_function("STAT_CLOUD_SLOT_LOAD_FAILED", LUA_NATIVE_STATS_STAT_CLOUD_SLOT_LOAD_FAILED);
-		STATS.set_function("STAT_CLOUD_SLOT_LOAD_FAILED_CODE", LUA_NATIVE_STATS_STAT_CLOUD_SLOT_LOAD_FAILED_CODE);
-		STATS.set_function("STAT_SET_BLOCK_SAVES", LUA_NATIVE_STATS_STAT_SET_BLOCK_SAVES);
-		STATS.set_function("STAT_GET_BLOCK_SAVES", LUA_NATIVE_STATS_STAT_GET_BLOCK_SAVES);
-		STATS.set_function("STAT_CLOUD_SLOT_SAVE_FAILED", LUA_NATIVE_STATS_STAT_CLOUD_SLOT_SAVE_FAILED);
-		STATS.set_function("STAT_CLEAR_PENDING_SAVES", LUA_NATIVE_STATS_STAT_CLEAR_PENDING_SAVES);
-		STATS.set_function("STAT_LOAD_DIRTY_READ_DETECTED", LUA_NATIVE_STATS_STAT_LOAD_DIRTY_READ_DETECTED);
-		STATS.set_function("STAT_CLEAR_DIRTY_READ_DETECTED", LUA_NATIVE_STATS_STAT_CLEAR_DIRTY_READ_DETECTED);
-		STATS.set_function("STAT_GET_LOAD_SAFE_TO_PROGRESS_TO_MP_FROM_SP", LUA_NATIVE_STATS_STAT_GET_LOAD_SAFE_TO_PROGRESS_TO_MP_FROM_SP);
-		STATS.set_function("GET_STAT_HASH_FOR_CHARACTER_STAT_", LUA_NATIVE_STATS_GET_STAT_HASH_FOR_CHARACTER_STAT_);
-		STATS.set_function("STAT_SET_INT", LUA_NATIVE_STATS_STAT_SET_INT);
-		STATS.set_function("STAT_SET_FLOAT", LUA_NATIVE_STATS_STAT_SET_FLOAT);
-		STATS.set_function("STAT_SET_BOOL", LUA_NATIVE_STATS_STAT_SET_BOOL);
-		STATS.set_function("STAT_SET_GXT_LABEL", LUA_NATIVE_STATS_STAT_SET_GXT_LABEL);
-		STATS.set_function("STAT_SET_DATE", LUA_NATIVE_STATS_STAT_SET_DATE);
-		STATS.set_function("STAT_SET_STRING", LUA_NATIVE_STATS_STAT_SET_STRING);
-		STATS.set_function("STAT_SET_POS", LUA_NATIVE_STATS_STAT_SET_POS);
-		STATS.set_function("STAT_SET_MASKED_INT", LUA_NATIVE_STATS_STAT_SET_MASKED_INT);
-		STATS.set_function("STAT_SET_USER_ID", LUA_NATIVE_STATS_STAT_SET_USER_ID);
-		STATS.set_function("STAT_SET_CURRENT_POSIX_TIME", LUA_NATIVE_STATS_STAT_SET_CURRENT_POSIX_TIME);
-		STATS.set_function("STAT_GET_INT", LUA_NATIVE_STATS_STAT_GET_INT);
-		STATS.set_function("STAT_GET_FLOAT", LUA_NATIVE_STATS_STAT_GET_FLOAT);
-		STATS.set_function("STAT_GET_BOOL", LUA_NATIVE_STATS_STAT_GET_BOOL);
-		STATS.set_function("STAT_GET_DATE", LUA_NATIVE_STATS_STAT_GET_DATE);
-		STATS.set_function("STAT_GET_STRING", LUA_NATIVE_STATS_STAT_GET_STRING);
-		STATS.set_function("STAT_GET_POS", LUA_NATIVE_STATS_STAT_GET_POS);
-		STATS.set_function("STAT_GET_MASKED_INT", LUA_NATIVE_STATS_STAT_GET_MASKED_INT);
-		STATS.set_function("STAT_GET_USER_ID", LUA_NATIVE_STATS_STAT_GET_USER_ID);
-		STATS.set_function("STAT_GET_LICENSE_PLATE", LUA_NATIVE_STATS_STAT_GET_LICENSE_PLATE);
-		STATS.set_function("STAT_SET_LICENSE_PLATE", LUA_NATIVE_STATS_STAT_SET_LICENSE_PLATE);
-		STATS.set_function("STAT_INCREMENT", LUA_NATIVE_STATS_STAT_INCREMENT);
-		STATS.set_function("STAT_COMMUNITY_START_SYNCH", LUA_NATIVE_STATS_STAT_COMMUNITY_START_SYNCH);
-		STATS.set_function("STAT_COMMUNITY_SYNCH_IS_PENDING", LUA_NATIVE_STATS_STAT_COMMUNITY_SYNCH_IS_PENDING);
-		STATS.set_function("STAT_COMMUNITY_GET_HISTORY", LUA_NATIVE_STATS_STAT_COMMUNITY_GET_HISTORY);
-		STATS.set_function("STAT_RESET_ALL_ONLINE_CHARACTER_STATS", LUA_NATIVE_STATS_STAT_RESET_ALL_ONLINE_CHARACTER_STATS);
-		STATS.set_function("STAT_LOCAL_RESET_ALL_ONLINE_CHARACTER_STATS", LUA_NATIVE_STATS_STAT_LOCAL_RESET_ALL_ONLINE_CHARACTER_STATS);
-		STATS.set_function("STAT_GET_NUMBER_OF_DAYS", LUA_NATIVE_STATS_STAT_GET_NUMBER_OF_DAYS);
-		STATS.set_function("STAT_GET_NUMBER_OF_HOURS", LUA_NATIVE_STATS_STAT_GET_NUMBER_OF_HOURS);
-		STATS.set_function("STAT_GET_NUMBER_OF_MINUTES", LUA_NATIVE_STATS_STAT_GET_NUMBER_OF_MINUTES);
-		STATS.set_function("STAT_GET_NUMBER_OF_SECONDS", LUA_NATIVE_STATS_STAT_GET_NUMBER_OF_SECONDS);
-		STATS.set_function("STAT_SET_PROFILE_SETTING_VALUE", LUA_NATIVE_STATS_STAT_SET_PROFILE_SETTING_VALUE);
-		STATS.set_function("STATS_COMPLETED_CHARACTER_CREATION", LUA_NATIVE_STATS_STATS_COMPLETED_CHARACTER_CREATION);
-		STATS.set_function("PACKED_STAT_GET_INT_STAT_INDEX", LUA_NATIVE_STATS_PACKED_STAT_GET_INT_STAT_INDEX);
-		STATS.set_function("GET_PACKED_INT_STAT_KEY", LUA_NATIVE_STATS_GET_PACKED_INT_STAT_KEY);
-		STATS.set_function("GET_PACKED_TU_INT_STAT_KEY", LUA_NATIVE_STATS_GET_PACKED_TU_INT_STAT_KEY);
-		STATS.set_function("GET_PACKED_NG_INT_STAT_KEY", LUA_NATIVE_STATS_GET_PACKED_NG_INT_STAT_KEY);
-		STATS.set_function("GET_PACKED_STAT_BOOL_CODE", LUA_NATIVE_STATS_GET_PACKED_STAT_BOOL_CODE);
-		STATS.set_function("GET_PACKED_STAT_INT_CODE", LUA_NATIVE_STATS_GET_PACKED_STAT_INT_CODE);
-		STATS.set_function("SET_PACKED_STAT_BOOL_CODE", LUA_NATIVE_STATS_SET_PACKED_STAT_BOOL_CODE);
-		STATS.set_function("SET_PACKED_STAT_INT_CODE", LUA_NATIVE_STATS_SET_PACKED_STAT_INT_CODE);
-		STATS.set_function("PLAYSTATS_BACKGROUND_SCRIPT_ACTION", LUA_NATIVE_STATS_PLAYSTATS_BACKGROUND_SCRIPT_ACTION);
-		STATS.set_function("PLAYSTATS_FLOW_LOW_", LUA_NATIVE_STATS_PLAYSTATS_FLOW_LOW_);
-		STATS.set_function("PLAYSTATS_FLOW_MEDIUM_", LUA_NATIVE_STATS_PLAYSTATS_FLOW_MEDIUM_);
-		STATS.set_function("PLAYSTATS_NPC_INVITE", LUA_NATIVE_STATS_PLAYSTATS_NPC_INVITE);
-		STATS.set_function("PLAYSTATS_AWARD_XP", LUA_NATIVE_STATS_PLAYSTATS_AWARD_XP);
-		STATS.set_function("PLAYSTATS_RANK_UP", LUA_NATIVE_STATS_PLAYSTATS_RANK_UP);
-		STATS.set_function("PLAYSTATS_STARTED_SESSION_IN_OFFLINEMODE", LUA_NATIVE_STATS_PLAYSTATS_STARTED_SESSION_IN_OFFLINEMODE);
-		STATS.set_function("PLAYSTATS_ACTIVITY_DONE", LUA_NATIVE_STATS_PLAYSTATS_ACTIVITY_DONE);
-		STATS.set_function("PLAYSTATS_LEAVE_JOB_CHAIN", LUA_NATIVE_STATS_PLAYSTATS_LEAVE_JOB_CHAIN);
-		STATS.set_function("PLAYSTATS_MISSION_STARTED", LUA_NATIVE_STATS_PLAYSTATS_MISSION_STARTED);
-		STATS.set_function("PLAYSTATS_MISSION_OVER", LUA_NATIVE_STATS_PLAYSTATS_MISSION_OVER);
-		STATS.set_function("PLAYSTATS_MISSION_CHECKPOINT", LUA_NATIVE_STATS_PLAYSTATS_MISSION_CHECKPOINT);
-		STATS.set_function("PLAYSTATS_RANDOM_MISSION_DONE", LUA_NATIVE_STATS_PLAYSTATS_RANDOM_MISSION_DONE);
-		STATS.set_function("PLAYSTATS_ROS_BET", LUA_NATIVE_STATS_PLAYSTATS_ROS_BET);
-		STATS.set_function("PLAYSTATS_RACE_CHECKPOINT", LUA_NATIVE_STATS_PLAYSTATS_RACE_CHECKPOINT);
-		STATS.set_function("PLAYSTATS_CREATE_MATCH_HISTORY_ID_2", LUA_NATIVE_STATS_PLAYSTATS_CREATE_MATCH_HISTORY_ID_2);
-		STATS.set_function("PLAYSTATS_MATCH_STARTED", LUA_NATIVE_STATS_PLAYSTATS_MATCH_STARTED);
-		STATS.set_function("PLAYSTATS_SHOP_ITEM", LUA_NATIVE_STATS_PLAYSTATS_SHOP_ITEM);
-		STATS.set_function("PLAYSTATS_CRATE_DROP_MISSION_DONE", LUA_NATIVE_STATS_PLAYSTATS_CRATE_DROP_MISSION_DONE);
-		STATS.set_function("PLAYSTATS_CRATE_CREATED", LUA_NATIVE_STATS_PLAYSTATS_CRATE_CREATED);
-		STATS.set_function("PLAYSTATS_HOLD_UP_MISSION_DONE", LUA_NATIVE_STATS_PLAYSTATS_HOLD_UP_MISSION_DONE);
-		STATS.set_function("PLAYSTATS_IMPORT_EXPORT_MISSION_DONE", LUA_NATIVE_STATS_PLAYSTATS_IMPORT_EXPORT_MISSION_DONE);
-		STATS.set_function("PLAYSTATS_RACE_TO_POINT_MISSION_DONE", LUA_NATIVE_STATS_PLAYSTATS_RACE_TO_POINT_MISSION_DONE);
-		STATS.set_function("PLAYSTATS_ACQUIRED_HIDDEN_PACKAGE", LUA_NATIVE_STATS_PLAYSTATS_ACQUIRED_HIDDEN_PACKAGE);
-		STATS.set_function("PLAYSTATS_WEBSITE_VISITED", LUA_NATIVE_STATS_PLAYSTATS_WEBSITE_VISITED);
-		STATS.set_function("PLAYSTATS_FRIEND_ACTIVITY", LUA_NATIVE_STATS_PLAYSTATS_FRIEND_ACTIVITY);
-		STATS.set_function("PLAYSTATS_ODDJOB_DONE", LUA_NATIVE_STATS_PLAYSTATS_ODDJOB_DONE);
-		STATS.set_function("PLAYSTATS_PROP_CHANGE", LUA_NATIVE_STATS_PLAYSTATS_PROP_CHANGE);
-		STATS.set_function("PLAYSTATS_CLOTH_CHANGE", LUA_NATIVE_STATS_PLAYSTATS_CLOTH_CHANGE);
-		STATS.set_function("PLAYSTATS_WEAPON_MODE_CHANGE", LUA_NATIVE_STATS_PLAYSTATS_WEAPON_MODE_CHANGE);
-		STATS.set_function("PLAYSTATS_CHEAT_APPLIED", LUA_NATIVE_STATS_PLAYSTATS_CHEAT_APPLIED);
-		STATS.set_function("PLAYSTATS_JOB_ACTIVITY_END", LUA_NATIVE_STATS_PLAYSTATS_JOB_ACTIVITY_END);
-		STATS.set_function("PLAYSTATS_JOB_BEND", LUA_NATIVE_STATS_PLAYSTATS_JOB_BEND);
-		STATS.set_function("PLAYSTATS_JOB_LTS_END", LUA_NATIVE_STATS_PLAYSTATS_JOB_LTS_END);
-		STATS.set_function("PLAYSTATS_JOB_LTS_ROUND_END", LUA_NATIVE_STATS_PLAYSTATS_JOB_LTS_ROUND_END);
-		STATS.set_function("PLAYSTATS_QUICKFIX_TOOL", LUA_NATIVE_STATS_PLAYSTATS_QUICKFIX_TOOL);
-		STATS.set_function("PLAYSTATS_IDLE_KICK", LUA_NATIVE_STATS_PLAYSTATS_IDLE_KICK);
-		STATS.set_function("PLAYSTATS_SET_JOIN_TYPE", LUA_NATIVE_STATS_PLAYSTATS_SET_JOIN_TYPE);
-		STATS.set_function("PLAYSTATS_HEIST_SAVE_CHEAT", LUA_NATIVE_STATS_PLAYSTATS_HEIST_SAVE_CHEAT);
-		STATS.set_function("PLAYSTATS_APPEND_DIRECTOR_METRIC", LUA_NATIVE_STATS_PLAYSTATS_APPEND_DIRECTOR_METRIC);
-		STATS.set_function("PLAYSTATS_AWARD_BAD_SPORT", LUA_NATIVE_STATS_PLAYSTATS_AWARD_BAD_SPORT);
-		STATS.set_function("PLAYSTATS_PEGASUS_AS_PERSONAL_AIRCRAFT", LUA_NATIVE_STATS_PLAYSTATS_PEGASUS_AS_PERSONAL_AIRCRAFT);
-		STATS.set_function("PLAYSTATS_SHOPMENU_NAV_", LUA_NATIVE_STATS_PLAYSTATS_SHOPMENU_NAV_);
-		STATS.set_function("PLAYSTATS_FM_EVENT_CHALLENGES", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_CHALLENGES);
-		STATS.set_function("PLAYSTATS_FM_EVENT_VEHICLETARGET", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_VEHICLETARGET);
-		STATS.set_function("PLAYSTATS_FM_EVENT_URBANWARFARE", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_URBANWARFARE);
-		STATS.set_function("PLAYSTATS_FM_EVENT_CHECKPOINTCOLLECTION", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_CHECKPOINTCOLLECTION);
-		STATS.set_function("PLAYSTATS_FM_EVENT_ATOB", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_ATOB);
-		STATS.set_function("PLAYSTATS_FM_EVENT_PENNEDIN", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_PENNEDIN);
-		STATS.set_function("PLAYSTATS_FM_EVENT_PASSTHEPARCEL", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_PASSTHEPARCEL);
-		STATS.set_function("PLAYSTATS_FM_EVENT_HOTPROPERTY", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_HOTPROPERTY);
-		STATS.set_function("PLAYSTATS_FM_EVENT_DEADDROP", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_DEADDROP);
-		STATS.set_function("PLAYSTATS_FM_EVENT_KINGOFTHECASTLE", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_KINGOFTHECASTLE);
-		STATS.set_function("PLAYSTATS_FM_EVENT_CRIMINALDAMAGE", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_CRIMINALDAMAGE);
-		STATS.set_function("PLAYSTATS_FM_EVENT_COMPETITIVEURBANWARFARE", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_COMPETITIVEURBANWARFARE);
-		STATS.set_function("PLAYSTATS_FM_EVENT_HUNTBEAST", LUA_NATIVE_STATS_PLAYSTATS_FM_EVENT_HUNTBEAST);
-		STATS.set_function("PLAYSTATS_PIMENU_HIDE_OPTIONS", LUA_NATIVE_STATS_PLAYSTATS_PIMENU_HIDE_OPTIONS);
-		STATS.set_function("LEADERBOARDS_GET_NUMBER_OF_COLUMNS", LUA_NATIVE_STATS_LEADERBOARDS_GET_NUMBER_OF_COLUMNS);
-		STATS.set_function("LEADERBOARDS_GET_COLUMN_ID", LUA_NATIVE_STATS_LEADERBOARDS_GET_COLUMN_ID);
-		STATS.set_function("LEADERBOARDS_GET_COLUMN_TYPE", LUA_NATIVE_STATS_LEADERBOARDS_GET_COLUMN_TYPE);
-		STATS.set_function("LEADERBOARDS_READ_CLEAR_ALL", LUA_NATIVE_STATS_LEADERBOARDS_READ_CLEAR_ALL);
-		STATS.set_function("LEADERBOARDS_READ_CLEAR", LUA_NATIVE_STATS_LEADERBOARDS_READ_CLEAR);
-		STATS.set_function("LEADERBOARDS_READ_PENDING", LUA_NATIVE_STATS_LEADERBOARDS_READ_PENDING);
-		STATS.set_function("LEADERBOARDS_READ_ANY_PENDING", LUA_NATIVE_STATS_LEADERBOARDS_READ_ANY_PENDING);
-		STATS.set_function("LEADERBOARDS_READ_SUCCESSFUL", LUA_NATIVE_STATS_LEADERBOARDS_READ_SUCCESSFUL);
-		STATS.set_function("LEADERBOARDS2_READ_FRIENDS_BY_ROW", LUA_NATIVE_STATS_LEADERBOARDS2_READ_FRIENDS_BY_ROW);
-		STATS.set_function("LEADERBOARDS2_READ_BY_HANDLE", LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_HANDLE);
-		STATS.set_function("LEADERBOARDS2_READ_BY_RANK", LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_RANK);
-		STATS.set_function("LEADERBOARDS2_READ_BY_RADIUS", LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_RADIUS);
-		STATS.set_function("LEADERBOARDS2_READ_BY_SCORE_INT", LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_SCORE_INT);
-		STATS.set_function("LEADERBOARDS2_READ_BY_SCORE_FLOAT", LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_SCORE_FLOAT);
-		STATS.set_function("LEADERBOARDS2_READ_RANK_PREDICTION", LUA_NATIVE_STATS_LEADERBOARDS2_READ_RANK_PREDICTION);
-		STATS.set_function("LEADERBOARDS2_READ_BY_PLAFORM", LUA_NATIVE_STATS_LEADERBOARDS2_READ_BY_PLAFORM);
-		STATS.set_function("LEADERBOARDS2_READ_GET_ROW_DATA_START", LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_START);
-		STATS.set_function("LEADERBOARDS2_READ_GET_ROW_DATA_END", LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_END);
-		STATS.set_function("LEADERBOARDS2_READ_GET_ROW_DATA_INFO", LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_INFO);
-		STATS.set_function("LEADERBOARDS2_READ_GET_ROW_DATA_INT", LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_INT);
-		STATS.set_function("LEADERBOARDS2_READ_GET_ROW_DATA_FLOAT", LUA_NATIVE_STATS_LEADERBOARDS2_READ_GET_ROW_DATA_FLOAT);
-		STATS.set_function("LEADERBOARDS2_WRITE_DATA", LUA_NATIVE_STATS_LEADERBOARDS2_WRITE_DATA);
-		STATS.set_function("LEADERBOARDS_WRITE_ADD_COLUMN", LUA_NATIVE_STATS_LEADERBOARDS_WRITE_ADD_COLUMN);
-		STATS.set_function("LEADERBOARDS_WRITE_ADD_COLUMN_LONG", LUA_NATIVE_STATS_LEADERBOARDS_WRITE_ADD_COLUMN_LONG);
-		STATS.set_function("LEADERBOARDS_CACHE_DATA_ROW", LUA_NATIVE_STATS_LEADERBOARDS_CACHE_DATA_ROW);
-		STATS.set_function("LEADERBOARDS_CLEAR_CACHE_DATA", LUA_NATIVE_STATS_LEADERBOARDS_CLEAR_CACHE_DATA);
-		STATS.set_function("LEADERBOARDS_CLEAR_CACHE_DATA_ID", LUA_NATIVE_STATS_LEADERBOARDS_CLEAR_CACHE_DATA_ID);
-		STATS.set_function("LEADERBOARDS_GET_CACHE_EXISTS", LUA_NATIVE_STATS_LEADERBOARDS_GET_CACHE_EXISTS);
-		STATS.set_function("LEADERBOARDS_GET_CACHE_TIME", LUA_NATIVE_STATS_LEADERBOARDS_GET_CACHE_TIME);
-		STATS.set_function("LEADERBOARDS_GET_CACHE_NUMBER_OF_ROWS", LUA_NATIVE_STATS_LEADERBOARDS_GET_CACHE_NUMBER_OF_ROWS);
-		STATS.set_function("LEADERBOARDS_GET_CACHE_DATA_ROW", LUA_NATIVE_STATS_LEADERBOARDS_GET_CACHE_DATA_ROW);
-		STATS.set_function("PRESENCE_EVENT_UPDATESTAT_INT", LUA_NATIVE_STATS_PRESENCE_EVENT_UPDATESTAT_INT);
-		STATS.set_function("PRESENCE_EVENT_UPDATESTAT_FLOAT", LUA_NATIVE_STATS_PRESENCE_EVENT_UPDATESTAT_FLOAT);
-		STATS.set_function("PRESENCE_EVENT_UPDATESTAT_INT_WITH_STRING", LUA_NATIVE_STATS_PRESENCE_EVENT_UPDATESTAT_INT_WITH_STRING);
-		STATS.set_function("GET_PLAYER_HAS_DRIVEN_ALL_VEHICLES", LUA_NATIVE_STATS_GET_PLAYER_HAS_DRIVEN_ALL_VEHICLES);
-		STATS.set_function("SET_HAS_POSTED_ALL_VEHICLES_DRIVEN", LUA_NATIVE_STATS_SET_HAS_POSTED_ALL_VEHICLES_DRIVEN);
-		STATS.set_function("SET_PROFILE_SETTING_PROLOGUE_COMPLETE", LUA_NATIVE_STATS_SET_PROFILE_SETTING_PROLOGUE_COMPLETE);
-		STATS.set_function("SET_PROFILE_SETTING_SP_CHOP_MISSION_COMPLETE", LUA_NATIVE_STATS_SET_PROFILE_SETTING_SP_CHOP_MISSION_COMPLETE);
-		STATS.set_function("SET_PROFILE_SETTING_CREATOR_RACES_DONE", LUA_NATIVE_STATS_SET_PROFILE_SETTING_CREATOR_RACES_DONE);
-		STATS.set_function("SET_PROFILE_SETTING_CREATOR_DM_DONE", LUA_NATIVE_STATS_SET_PROFILE_SETTING_CREATOR_DM_DONE);
-		STATS.set_function("SET_PROFILE_SETTING_CREATOR_CTF_DONE", LUA_NATIVE_STATS_SET_PROFILE_SETTING_CREATOR_CTF_DONE);
-		STATS.set_function("SET_JOB_ACTIVITY_ID_STARTED", LUA_NATIVE_STATS_SET_JOB_ACTIVITY_ID_STARTED);
-		STATS.set_function("SET_FREEMODE_PROLOGUE_DONE", LUA_NATIVE_STATS_SET_FREEMODE_PROLOGUE_DONE);
-		STATS.set_function("SET_FREEMODE_STRAND_PROGRESSION_STATUS", LUA_NATIVE_STATS_SET_FREEMODE_STRAND_PROGRESSION_STATUS);
-		STATS.set_function("STAT_NETWORK_INCREMENT_ON_SUICIDE", LUA_NATIVE_STATS_STAT_NETWORK_INCREMENT_ON_SUICIDE);
-		STATS.set_function("STAT_SET_CHEAT_IS_ACTIVE", LUA_NATIVE_STATS_STAT_SET_CHEAT_IS_ACTIVE);
-		STATS.set_function("LEADERBOARDS2_WRITE_DATA_FOR_EVENT_TYPE", LUA_NATIVE_STATS_LEADERBOARDS2_WRITE_DATA_FOR_EVENT_TYPE);
-		STATS.set_function("FORCE_CLOUD_MP_STATS_DOWNLOAD_AND_OVERWRITE_LOCAL_SAVE", LUA_NATIVE_STATS_FORCE_CLOUD_MP_STATS_DOWNLOAD_AND_OVERWRITE_LOCAL_SAVE);
-		STATS.set_function("STAT_MIGRATE_CLEAR_FOR_RESTART", LUA_NATIVE_STATS_STAT_MIGRATE_CLEAR_FOR_RESTART);
-		STATS.set_function("STAT_MIGRATE_SAVEGAME_START", LUA_NATIVE_STATS_STAT_MIGRATE_SAVEGAME_START);
-		STATS.set_function("STAT_MIGRATE_SAVEGAME_GET_STATUS", LUA_NATIVE_STATS_STAT_MIGRATE_SAVEGAME_GET_STATUS);
-		STATS.set_function("STAT_MIGRATE_CHECK_ALREADY_DONE", LUA_NATIVE_STATS_STAT_MIGRATE_CHECK_ALREADY_DONE);
-		STATS.set_function("STAT_MIGRATE_CHECK_START", LUA_NATIVE_STATS_STAT_MIGRATE_CHECK_START);
-		STATS.set_function("STAT_MIGRATE_CHECK_GET_IS_PLATFORM_AVAILABLE", LUA_NATIVE_STATS_STAT_MIGRATE_CHECK_GET_IS_PLATFORM_AVAILABLE);
-		STATS.set_function("STAT_MIGRATE_CHECK_GET_PLATFORM_STATUS", LUA_NATIVE_STATS_STAT_MIGRATE_CHECK_GET_PLATFORM_STATUS);
-		STATS.set_function("STAT_GET_SAVE_MIGRATION_STATUS", LUA_NATIVE_STATS_STAT_GET_SAVE_MIGRATION_STATUS);
-		STATS.set_function("STAT_SAVE_MIGRATION_CANCEL_PENDING_OPERATION", LUA_NATIVE_STATS_STAT_SAVE_MIGRATION_CANCEL_PENDING_OPERATION);
-		STATS.set_function("STAT_GET_CANCEL_SAVE_MIGRATION_STATUS", LUA_NATIVE_STATS_STAT_GET_CANCEL_SAVE_MIGRATION_STATUS);
-		STATS.set_function("STAT_SAVE_MIGRATION_CONSUME_CONTENT", LUA_NATIVE_STATS_STAT_SAVE_MIGRATION_CONSUME_CONTENT);
-		STATS.set_function("STAT_GET_SAVE_MIGRATION_CONSUME_CONTENT_STATUS", LUA_NATIVE_STATS_STAT_GET_SAVE_MIGRATION_CONSUME_CONTENT_STATUS);
-		STATS.set_function("STAT_ENABLE_STATS_TRACKING", LUA_NATIVE_STATS_STAT_ENABLE_STATS_TRACKING);
-		STATS.set_function("STAT_DISABLE_STATS_TRACKING", LUA_NATIVE_STATS_STAT_DISABLE_STATS_TRACKING);
-		STATS.set_function("STAT_IS_STATS_TRACKING_ENABLED", LUA_NATIVE_STATS_STAT_IS_STATS_TRACKING_ENABLED);
-		STATS.set_function("STAT_START_RECORD_STAT", LUA_NATIVE_STATS_STAT_START_RECORD_STAT);
-		STATS.set_function("STAT_STOP_RECORD_STAT", LUA_NATIVE_STATS_STAT_STOP_RECORD_STAT);
-		STATS.set_function("STAT_GET_RECORDED_VALUE", LUA_NATIVE_STATS_STAT_GET_RECORDED_VALUE);
-		STATS.set_function("STAT_IS_RECORDING_STAT", LUA_NATIVE_STATS_STAT_IS_RECORDING_STAT);
-		STATS.set_function("STAT_GET_CURRENT_NEAR_MISS_NOCRASH_PRECISE", LUA_NATIVE_STATS_STAT_GET_CURRENT_NEAR_MISS_NOCRASH_PRECISE);
-		STATS.set_function("STAT_GET_CURRENT_REAR_WHEEL_DISTANCE", LUA_NATIVE_STATS_STAT_GET_CURRENT_REAR_WHEEL_DISTANCE);
-		STATS.set_function("STAT_GET_CURRENT_FRONT_WHEEL_DISTANCE", LUA_NATIVE_STATS_STAT_GET_CURRENT_FRONT_WHEEL_DISTANCE);
-		STATS.set_function("STAT_GET_CURRENT_JUMP_DISTANCE", LUA_NATIVE_STATS_STAT_GET_CURRENT_JUMP_DISTANCE);
-		STATS.set_function("STAT_GET_CURRENT_DRIVE_NOCRASH_DISTANCE", LUA_NATIVE_STATS_STAT_GET_CURRENT_DRIVE_NOCRASH_DISTANCE);
-		STATS.set_function("STAT_GET_CURRENT_SPEED", LUA_NATIVE_STATS_STAT_GET_CURRENT_SPEED);
-		STATS.set_function("STAT_GET_CURRENT_DRIVING_REVERSE_DISTANCE", LUA_NATIVE_STATS_STAT_GET_CURRENT_DRIVING_REVERSE_DISTANCE);
-		STATS.set_function("STAT_GET_CURRENT_SKYDIVING_DISTANCE", LUA_NATIVE_STATS_STAT_GET_CURRENT_SKYDIVING_DISTANCE);
-		STATS.set_function("STAT_GET_CHALLENGE_FLYING_DIST", LUA_NATIVE_STATS_STAT_GET_CHALLENGE_FLYING_DIST);
-		STATS.set_function("STAT_GET_FLYING_ALTITUDE", LUA_NATIVE_STATS_STAT_GET_FLYING_ALTITUDE);
-		STATS.set_function("STAT_IS_PLAYER_VEHICLE_ABOVE_OCEAN", LUA_NATIVE_STATS_STAT_IS_PLAYER_VEHICLE_ABOVE_OCEAN);
-		STATS.set_function("STAT_GET_VEHICLE_BAIL_DISTANCE", LUA_NATIVE_STATS_STAT_GET_VEHICLE_BAIL_DISTANCE);
-		STATS.set_function("STAT_ROLLBACK_SAVE_MIGRATION", LUA_NATIVE_STATS_STAT_ROLLBACK_SAVE_MIGRATION);
-		STATS.set_function("SET_HAS_SPECIALEDITION_CONTENT", LUA_NATIVE_STATS_SET_HAS_SPECIALEDITION_CONTENT);
-		STATS.set_function("SET_SAVE_MIGRATION_TRANSACTION_ID_WARNING", LUA_NATIVE_STATS_SET_SAVE_MIGRATION_TRANSACTION_ID_WARNING);
-		STATS.set_function("GET_BOSS_GOON_UUID", LUA_NATIVE_STATS_GET_BOSS_GOON_UUID);
-		STATS.set_function("PLAYSTATS_BW_BOSSONBOSSDEATHMATCH", LUA_NATIVE_STATS_PLAYSTATS_BW_BOSSONBOSSDEATHMATCH);
-		STATS.set_function("PLAYSTATS_BW_YATCHATTACK", LUA_NATIVE_STATS_PLAYSTATS_BW_YATCHATTACK);
-		STATS.set_function("PLAYSTATS_BW_HUNT_THE_BOSS", LUA_NATIVE_STATS_PLAYSTATS_BW_HUNT_THE_BOSS);
-		STATS.set_function("PLAYSTATS_BW_SIGHTSEER", LUA_NATIVE_STATS_PLAYSTATS_BW_SIGHTSEER);
-		STATS.set_function("PLAYSTATS_BW_ASSAULT", LUA_NATIVE_STATS_PLAYSTATS_BW_ASSAULT);
-		STATS.set_function("PLAYSTATS_BW_BELLY_OF_THE_BEAST", LUA_NATIVE_STATS_PLAYSTATS_BW_BELLY_OF_THE_BEAST);
-		STATS.set_function("PLAYSTATS_BW_HEAD_HUNTER", LUA_NATIVE_STATS_PLAYSTATS_BW_HEAD_HUNTER);
-		STATS.set_function("PLAYSTATS_BW_FRAGILE_GOODS", LUA_NATIVE_STATS_PLAYSTATS_BW_FRAGILE_GOODS);
-		STATS.set_function("PLAYSTATS_BW_AIR_FREIGHT", LUA_NATIVE_STATS_PLAYSTATS_BW_AIR_FREIGHT);
-		STATS.set_function("PLAYSTATS_BC_CAR_JACKING", LUA_NATIVE_STATS_PLAYSTATS_BC_CAR_JACKING);
-		STATS.set_function("PLAYSTATS_BC_SMASH_AND_GRAB", LUA_NATIVE_STATS_PLAYSTATS_BC_SMASH_AND_GRAB);
-		STATS.set_function("PLAYSTATS_BC_PROTECTION_RACKET", LUA_NATIVE_STATS_PLAYSTATS_BC_PROTECTION_RACKET);
-		STATS.set_function("PLAYSTATS_BC_MOST_WANTED", LUA_NATIVE_STATS_PLAYSTATS_BC_MOST_WANTED);
-		STATS.set_function("PLAYSTATS_BC_FINDERS_KEEPERS", LUA_NATIVE_STATS_PLAYSTATS_BC_FINDERS_KEEPERS);
-		STATS.set_function("PLAYSTATS_BC_POINT_TO_POINT", LUA_NATIVE_STATS_PLAYSTATS_BC_POINT_TO_POINT);
-		STATS.set_function("PLAYSTATS_BC_CASHING", LUA_NATIVE_STATS_PLAYSTATS_BC_CASHING);
-		STATS.set_function("PLAYSTATS_BC_SALVAGE", LUA_NATIVE_STATS_PLAYSTATS_BC_SALVAGE);
-		STATS.set_function("PLAYSTATS_SPENT_PI_CUSTOM_LOADOUT", LUA_NATIVE_STATS_PLAYSTATS_SPENT_PI_CUSTOM_LOADOUT);
-		STATS.set_function("PLAYSTATS_BUY_CONTRABAND_MISSION", LUA_NATIVE_STATS_PLAYSTATS_BUY_CONTRABAND_MISSION);
-		STATS.set_function("PLAYSTATS_SELL_CONTRABAND_MISSION", LUA_NATIVE_STATS_PLAYSTATS_SELL_CONTRABAND_MISSION);
-		STATS.set_function("PLAYSTATS_DEFEND_CONTRABAND_MISSION", LUA_NATIVE_STATS_PLAYSTATS_DEFEND_CONTRABAND_MISSION);
-		STATS.set_function("PLAYSTATS_RECOVER_CONTRABAND_MISSION", LUA_NATIVE_STATS_PLAYSTATS_RECOVER_CONTRABAND_MISSION);
-		STATS.set_function("PLAYSTATS_HIT_CONTRABAND_DESTROY_LIMIT", LUA_NATIVE_STATS_PLAYSTATS_HIT_CONTRABAND_DESTROY_LIMIT);
-		STATS.set_function("START_BEING_BOSS", LUA_NATIVE_STATS_START_BEING_BOSS);
-		STATS.set_function("START_BEING_GOON", LUA_NATIVE_STATS_START_BEING_GOON);
-		STATS.set_function("END_BEING_BOSS", LUA_NATIVE_STATS_END_BEING_BOSS);
-		STATS.set_function("END_BEING_GOON", LUA_NATIVE_STATS_END_BEING_GOON);
-		STATS.set_function("HIRED_LIMO", LUA_NATIVE_STATS_HIRED_LIMO);
-		STATS.set_function("ORDER_BOSS_VEHICLE", LUA_NATIVE_STATS_ORDER_BOSS_VEHICLE);
-		STATS.set_function("CHANGE_UNIFORM", LUA_NATIVE_STATS_CHANGE_UNIFORM);
-		STATS.set_function("CHANGE_GOON_LOOKING_FOR_WORK", LUA_NATIVE_STATS_CHANGE_GOON_LOOKING_FOR_WORK);
-		STATS.set_function("SEND_METRIC_GHOSTING_TO_PLAYER", LUA_NATIVE_STATS_SEND_METRIC_GHOSTING_TO_PLAYER);
-		STATS.set_function("SEND_METRIC_VIP_POACH", LUA_NATIVE_STATS_SEND_METRIC_VIP_POACH);
-		STATS.set_function("SEND_METRIC_PUNISH_BODYGUARD", LUA_NATIVE_STATS_SEND_METRIC_PUNISH_BODYGUARD);
-		STATS.set_function("PLAYSTATS_START_TRACKING_STUNTS", LUA_NATIVE_STATS_PLAYSTATS_START_TRACKING_STUNTS);
-		STATS.set_function("PLAYSTATS_STOP_TRACKING_STUNTS", LUA_NATIVE_STATS_PLAYSTATS_STOP_TRACKING_STUNTS);
-		STATS.set_function("PLAYSTATS_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_IMPEXP_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_IMPEXP_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_CHANGE_MC_ROLE", LUA_NATIVE_STATS_PLAYSTATS_CHANGE_MC_ROLE);
-		STATS.set_function("PLAYSTATS_CHANGE_MC_OUTFIT", LUA_NATIVE_STATS_PLAYSTATS_CHANGE_MC_OUTFIT);
-		STATS.set_function("PLAYSTATS_SWITCH_MC_EMBLEM", LUA_NATIVE_STATS_PLAYSTATS_SWITCH_MC_EMBLEM);
-		STATS.set_function("PLAYSTATS_MC_REQUEST_BIKE", LUA_NATIVE_STATS_PLAYSTATS_MC_REQUEST_BIKE);
-		STATS.set_function("PLAYSTATS_MC_KILLED_RIVAL_MC_MEMBER", LUA_NATIVE_STATS_PLAYSTATS_MC_KILLED_RIVAL_MC_MEMBER);
-		STATS.set_function("PLAYSTATS_ABANDONED_MC", LUA_NATIVE_STATS_PLAYSTATS_ABANDONED_MC);
-		STATS.set_function("PLAYSTATS_EARNED_MC_POINTS", LUA_NATIVE_STATS_PLAYSTATS_EARNED_MC_POINTS);
-		STATS.set_function("PLAYSTATS_MC_FORMATION_ENDS", LUA_NATIVE_STATS_PLAYSTATS_MC_FORMATION_ENDS);
-		STATS.set_function("PLAYSTATS_MC_CLUBHOUSE_ACTIVITY", LUA_NATIVE_STATS_PLAYSTATS_MC_CLUBHOUSE_ACTIVITY);
-		STATS.set_function("PLAYSTATS_RIVAL_BEHAVIOR", LUA_NATIVE_STATS_PLAYSTATS_RIVAL_BEHAVIOR);
-		STATS.set_function("PLAYSTATS_COPY_RANK_INTO_NEW_SLOT", LUA_NATIVE_STATS_PLAYSTATS_COPY_RANK_INTO_NEW_SLOT);
-		STATS.set_function("PLAYSTATS_DUPE_DETECTED", LUA_NATIVE_STATS_PLAYSTATS_DUPE_DETECTED);
-		STATS.set_function("PLAYSTATS_BAN_ALERT", LUA_NATIVE_STATS_PLAYSTATS_BAN_ALERT);
-		STATS.set_function("PLAYSTATS_GUNRUNNING_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_GUNRUNNING_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_GUNRUNNING_RND", LUA_NATIVE_STATS_PLAYSTATS_GUNRUNNING_RND);
-		STATS.set_function("PLAYSTATS_BUSINESS_BATTLE_ENDED", LUA_NATIVE_STATS_PLAYSTATS_BUSINESS_BATTLE_ENDED);
-		STATS.set_function("PLAYSTATS_WAREHOUSE_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_WAREHOUSE_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_NIGHTCLUB_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_NIGHTCLUB_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_DJ_USAGE", LUA_NATIVE_STATS_PLAYSTATS_DJ_USAGE);
-		STATS.set_function("PLAYSTATS_MINIGAME_USAGE", LUA_NATIVE_STATS_PLAYSTATS_MINIGAME_USAGE);
-		STATS.set_function("PLAYSTATS_STONE_HATCHET_ENDED", LUA_NATIVE_STATS_PLAYSTATS_STONE_HATCHET_ENDED);
-		STATS.set_function("PLAYSTATS_SMUGGLER_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_SMUGGLER_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_FM_HEIST_PREP_ENDED", LUA_NATIVE_STATS_PLAYSTATS_FM_HEIST_PREP_ENDED);
-		STATS.set_function("PLAYSTATS_INSTANCED_HEIST_ENDED", LUA_NATIVE_STATS_PLAYSTATS_INSTANCED_HEIST_ENDED);
-		STATS.set_function("PLAYSTATS_DAR_CHECKPOINT", LUA_NATIVE_STATS_PLAYSTATS_DAR_CHECKPOINT);
-		STATS.set_function("PLAYSTATS_ENTER_SESSION_PACK", LUA_NATIVE_STATS_PLAYSTATS_ENTER_SESSION_PACK);
-		STATS.set_function("PLAYSTATS_DRONE_USAGE", LUA_NATIVE_STATS_PLAYSTATS_DRONE_USAGE);
-		STATS.set_function("PLAYSTATS_SPIN_WHEEL", LUA_NATIVE_STATS_PLAYSTATS_SPIN_WHEEL);
-		STATS.set_function("PLAYSTATS_ARENA_WARS_SPECTATOR", LUA_NATIVE_STATS_PLAYSTATS_ARENA_WARS_SPECTATOR);
-		STATS.set_function("PLAYSTATS_ARENA_WARS_ENDED", LUA_NATIVE_STATS_PLAYSTATS_ARENA_WARS_ENDED);
-		STATS.set_function("PLAYSTATS_SWITCH_PASSIVE_MODE", LUA_NATIVE_STATS_PLAYSTATS_SWITCH_PASSIVE_MODE);
-		STATS.set_function("PLAYSTATS_COLLECTIBLE_PICKED_UP", LUA_NATIVE_STATS_PLAYSTATS_COLLECTIBLE_PICKED_UP);
-		STATS.set_function("PLAYSTATS_CASINO_STORY_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_CASINO_STORY_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_CASINO_CHIP", LUA_NATIVE_STATS_PLAYSTATS_CASINO_CHIP);
-		STATS.set_function("PLAYSTATS_CASINO_ROULETTE", LUA_NATIVE_STATS_PLAYSTATS_CASINO_ROULETTE);
-		STATS.set_function("PLAYSTATS_CASINO_BLACKJACK", LUA_NATIVE_STATS_PLAYSTATS_CASINO_BLACKJACK);
-		STATS.set_function("PLAYSTATS_CASINO_THREE_CARD_POKER", LUA_NATIVE_STATS_PLAYSTATS_CASINO_THREE_CARD_POKER);
-		STATS.set_function("PLAYSTATS_CASINO_SLOT_MACHINE", LUA_NATIVE_STATS_PLAYSTATS_CASINO_SLOT_MACHINE);
-		STATS.set_function("PLAYSTATS_CASINO_INSIDE_TRACK", LUA_NATIVE_STATS_PLAYSTATS_CASINO_INSIDE_TRACK);
-		STATS.set_function("PLAYSTATS_CASINO_LUCKY_SEVEN", LUA_NATIVE_STATS_PLAYSTATS_CASINO_LUCKY_SEVEN);
-		STATS.set_function("PLAYSTATS_CASINO_ROULETTE_LIGHT", LUA_NATIVE_STATS_PLAYSTATS_CASINO_ROULETTE_LIGHT);
-		STATS.set_function("PLAYSTATS_CASINO_BLACKJACK_LIGHT", LUA_NATIVE_STATS_PLAYSTATS_CASINO_BLACKJACK_LIGHT);
-		STATS.set_function("PLAYSTATS_CASINO_THREE_CARD_POKER_LIGHT", LUA_NATIVE_STATS_PLAYSTATS_CASINO_THREE_CARD_POKER_LIGHT);
-		STATS.set_function("PLAYSTATS_CASINO_SLOT_MACHINE_LIGHT", LUA_NATIVE_STATS_PLAYSTATS_CASINO_SLOT_MACHINE_LIGHT);
-		STATS.set_function("PLAYSTATS_CASINO_INSIDE_TRACK_LIGHT", LUA_NATIVE_STATS_PLAYSTATS_CASINO_INSIDE_TRACK_LIGHT);
-		STATS.set_function("PLAYSTATS_ARCADE_GAME", LUA_NATIVE_STATS_PLAYSTATS_ARCADE_GAME);
-		STATS.set_function("PLAYSTATS_ARCADE_LOVE_MATCH", LUA_NATIVE_STATS_PLAYSTATS_ARCADE_LOVE_MATCH);
-		STATS.set_function("PLAYSTATS_FREEMODE_CASINO_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_FREEMODE_CASINO_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_HEIST3_DRONE", LUA_NATIVE_STATS_PLAYSTATS_HEIST3_DRONE);
-		STATS.set_function("PLAYSTATS_HEIST3_HACK", LUA_NATIVE_STATS_PLAYSTATS_HEIST3_HACK);
-		STATS.set_function("PLAYSTATS_NPC_PHONE", LUA_NATIVE_STATS_PLAYSTATS_NPC_PHONE);
-		STATS.set_function("PLAYSTATS_ARCADE_CABINET", LUA_NATIVE_STATS_PLAYSTATS_ARCADE_CABINET);
-		STATS.set_function("PLAYSTATS_HEIST3_FINALE", LUA_NATIVE_STATS_PLAYSTATS_HEIST3_FINALE);
-		STATS.set_function("PLAYSTATS_HEIST3_PREP", LUA_NATIVE_STATS_PLAYSTATS_HEIST3_PREP);
-		STATS.set_function("PLAYSTATS_MASTER_CONTROL", LUA_NATIVE_STATS_PLAYSTATS_MASTER_CONTROL);
-		STATS.set_function("PLAYSTATS_QUIT_MODE", LUA_NATIVE_STATS_PLAYSTATS_QUIT_MODE);
-		STATS.set_function("PLAYSTATS_MISSION_VOTE", LUA_NATIVE_STATS_PLAYSTATS_MISSION_VOTE);
-		STATS.set_function("PLAYSTATS_NJVS_VOTE", LUA_NATIVE_STATS_PLAYSTATS_NJVS_VOTE);
-		STATS.set_function("PLAYSTATS_FM_MISSION_END", LUA_NATIVE_STATS_PLAYSTATS_FM_MISSION_END);
-		STATS.set_function("PLAYSTATS_HEIST4_PREP", LUA_NATIVE_STATS_PLAYSTATS_HEIST4_PREP);
-		STATS.set_function("PLAYSTATS_HEIST4_FINALE", LUA_NATIVE_STATS_PLAYSTATS_HEIST4_FINALE);
-		STATS.set_function("PLAYSTATS_HEIST4_HACK", LUA_NATIVE_STATS_PLAYSTATS_HEIST4_HACK);
-		STATS.set_function("PLAYSTATS_SUB_WEAP", LUA_NATIVE_STATS_PLAYSTATS_SUB_WEAP);
-		STATS.set_function("PLAYSTATS_FAST_TRVL", LUA_NATIVE_STATS_PLAYSTATS_FAST_TRVL);
-		STATS.set_function("PLAYSTATS_HUB_ENTRY", LUA_NATIVE_STATS_PLAYSTATS_HUB_ENTRY);
-		STATS.set_function("PLAYSTATS_DJ_MISSION_ENDED", LUA_NATIVE_STATS_PLAYSTATS_DJ_MISSION_ENDED);
-		STATS.set_function("PLAYSTATS_ROBBERY_PREP", LUA_NATIVE_STATS_PLAYSTATS_ROBBERY_PREP);
-		STATS.set_function("PLAYSTATS_ROBBERY_FINALE", LUA_NATIVE_STATS_PLAYSTATS_ROBBERY_FINALE);
-		STATS.set_function("PLAYSTATS_EXTRA_EVENT", LUA_NATIVE_STATS_PLAYSTATS_EXTRA_EVENT);
-		STATS.set_function("PLAYSTATS_CARCLUB_POINTS", LUA_NATIVE_STATS_PLAYSTATS_CARCLUB_POINTS);
-		STATS.set_function("PLAYSTATS_CARCLUB_CHALLENGE", LUA_NATIVE_STATS_PLAYSTATS_CARCLUB_CHALLENGE);
-		STATS.set_function("PLAYSTATS_CARCLUB_PRIZE", LUA_NATIVE_STATS_PLAYSTATS_CARCLUB_PRIZE);
-		STATS.set_function("PLAYSTATS_AWARD_NAV", LUA_NATIVE_STATS_PLAYSTATS_AWARD_NAV);
-		STATS.set_function("PLAYSTATS_INST_MISSION_END", LUA_NATIVE_STATS_PLAYSTATS_INST_MISSION_END);
-		STATS.set_function("PLAYSTATS_HUB_EXIT", LUA_NATIVE_STATS_PLAYSTATS_HUB_EXIT);
-		STATS.set_function("PLAYSTATS_VEH_DEL", LUA_NATIVE_STATS_PLAYSTATS_VEH_DEL);
-		STATS.set_function("PLAYSTATS_INVENTORY", LUA_NATIVE_STATS_PLAYSTATS_INVENTORY);
-		STATS.set_function("PLAYSTATS_ACID_MISSION_END_", LUA_NATIVE_STATS_PLAYSTATS_ACID_MISSION_END_);
-		STATS.set_function("PLAYSTATS_ACID_RND_", LUA_NATIVE_STATS_PLAYSTATS_ACID_RND_);
-		STATS.set_function("PLAYSTATS_IDLE_", LUA_NATIVE_STATS_PLAYSTATS_IDLE_);
-		STATS.set_function("PLAYSTATS_PLAYER_STYLE_", LUA_NATIVE_STATS_PLAYSTATS_PLAYER_STYLE_);
-		STATS.set_function("PLAYSTATS_RANDOM_EVENT_", LUA_NATIVE_STATS_PLAYSTATS_RANDOM_EVENT_);
-		STATS.set_function("PLAYSTATS_ALERT_", LUA_NATIVE_STATS_PLAYSTATS_ALERT_);
-		STATS.set_function("PLAYSTATS_ATTRITION_STAGE_END_", LUA_NATIVE_STATS_PLAYSTATS_ATTRITION_STAGE_END_);
-		STATS.set_function("PLAYSTATS_SHOWROOM_NAV_", LUA_NATIVE_STATS_PLAYSTATS_SHOWROOM_NAV_);
-		STATS.set_function("PLAYSTATS_SHOWROOM_OVERVIEW_", LUA_NATIVE_STATS_PLAYSTATS_SHOWROOM_OVERVIEW_);
+		bind_namespace(L, "STATS", STATS_natives);
 	}
 }
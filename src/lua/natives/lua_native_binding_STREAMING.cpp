@@ -649,128 +649,131 @@ namespace lua::native
 		STREAMING::SET_ISLAND_ENABLED(name.is<const char*>() ? name.as<const char*>() : nullptr, toggle);
 	}
 
+	static constexpr native_entry STREAMING_natives[] = {
+		{"ADD_MODEL_TO_CREATOR_BUDGET", native_function<LUA_NATIVE_STREAMING_ADD_MODEL_TO_CREATOR_BUDGET>},
+		{"ALLOW_PLAYER_SWITCH_ASCENT", native_function<LUA_NATIVE_STREAMING_ALLOW_PLAYER_SWITCH_ASCENT>},
+		{"ALLOW_PLAYER_SWITCH_DESCENT", native_function<LUA_NATIVE_STREAMING_ALLOW_PLAYER_SWITCH_DESCENT>},
+		{"ALLOW_PLAYER_SWITCH_OUTRO", native_function<LUA_NATIVE_STREAMING_ALLOW_PLAYER_SWITCH_OUTRO>},
+		{"ALLOW_PLAYER_SWITCH_PAN", native_function<LUA_NATIVE_STREAMING_ALLOW_PLAYER_SWITCH_PAN>},
+		{"BEGIN_SRL", native_function<LUA_NATIVE_STREAMING_BEGIN_SRL>},
+		{"CLEAR_FOCUS", native_function<LUA_NATIVE_STREAMING_CLEAR_FOCUS>},
+		{"CLEAR_HD_AREA", native_function<LUA_NATIVE_STREAMING_CLEAR_HD_AREA>},
+		{"DISABLE_SWITCH_OUTRO_FX", native_function<LUA_NATIVE_STREAMING_DISABLE_SWITCH_OUTRO_FX>},
+		{"DOES_ANIM_DICT_EXIST", native_function<LUA_NATIVE_STREAMING_DOES_ANIM_DICT_EXIST>},
+		{"ENABLE_SWITCH_PAUSE_BEFORE_DESCENT", native_function<LUA_NATIVE_STREAMING_ENABLE_SWITCH_PAUSE_BEFORE_DESCENT>},
+		{"END_SRL", native_function<LUA_NATIVE_STREAMING_END_SRL>},
+		{"FORCE_ALLOW_TIME_BASED_FADING_THIS_FRAME", native_function<LUA_NATIVE_STREAMING_FORCE_ALLOW_TIME_BASED_FADING_THIS_FRAME>},
+		{"GET_GLOBAL_WATER_FILE", native_function<LUA_NATIVE_STREAMING_GET_GLOBAL_WATER_FILE>},
+		{"GET_IDEAL_PLAYER_SWITCH_TYPE", native_function<LUA_NATIVE_STREAMING_GET_IDEAL_PLAYER_SWITCH_TYPE>},
+		{"GET_LODSCALE", native_function<LUA_NATIVE_STREAMING_GET_LODSCALE>},
+		{"GET_NUMBER_OF_STREAMING_REQUESTS", native_function<LUA_NATIVE_STREAMING_GET_NUMBER_OF_STREAMING_REQUESTS>},
+		{"GET_PLAYER_SHORT_SWITCH_STATE", native_function<LUA_NATIVE_STREAMING_GET_PLAYER_SHORT_SWITCH_STATE>},
+		{"GET_PLAYER_SWITCH_INTERP_OUT_CURRENT_TIME", native_function<LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_INTERP_OUT_CURRENT_TIME>},
+		{"GET_PLAYER_SWITCH_INTERP_OUT_DURATION", native_function<LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_INTERP_OUT_DURATION>},
+		{"GET_PLAYER_SWITCH_JUMP_CUT_INDEX", native_function<LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_JUMP_CUT_INDEX>},
+		{"GET_PLAYER_SWITCH_STATE", native_function<LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_STATE>},
+		{"GET_PLAYER_SWITCH_TYPE", native_function<LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_TYPE>},
+		{"GET_USED_CREATOR_BUDGET", native_function<LUA_NATIVE_STREAMING_GET_USED_CREATOR_BUDGET>},
+		{"HAS_ANIM_DICT_LOADED", native_function<LUA_NATIVE_STREAMING_HAS_ANIM_DICT_LOADED>},
+		{"HAS_ANIM_SET_LOADED", native_function<LUA_NATIVE_STREAMING_HAS_ANIM_SET_LOADED>},
+		{"HAS_CLIP_SET_LOADED", native_function<LUA_NATIVE_STREAMING_HAS_CLIP_SET_LOADED>},
+		{"HAS_COLLISION_FOR_MODEL_LOADED", native_function<LUA_NATIVE_STREAMING_HAS_COLLISION_FOR_MODEL_LOADED>},
+		{"HAS_MODEL_LOADED", native_function<LUA_NATIVE_STREAMING_HAS_MODEL_LOADED>},
+		{"HAS_NAMED_PTFX_ASSET_LOADED", native_function<LUA_NATIVE_STREAMING_HAS_NAMED_PTFX_ASSET_LOADED>},
+		{"HAS_PTFX_ASSET_LOADED", native_function<LUA_NATIVE_STREAMING_HAS_PTFX_ASSET_LOADED>},
+		{"INIT_CREATOR_BUDGET", native_function<LUA_NATIVE_STREAMING_INIT_CREATOR_BUDGET>},
+		{"IPL_GROUP_SWAP_CANCEL", native_function<LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_CANCEL>},
+		{"IPL_GROUP_SWAP_FINISH", native_function<LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_FINISH>},
+		{"IPL_GROUP_SWAP_IS_ACTIVE", native_function<LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_IS_ACTIVE>},
+		{"IPL_GROUP_SWAP_IS_READY", native_function<LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_IS_READY>},
+		{"IPL_GROUP_SWAP_START", native_function<LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_START>},
+		{"IS_ENTITY_FOCUS", native_function<LUA_NATIVE_STREAMING_IS_ENTITY_FOCUS>},
+		{"IS_IPL_ACTIVE", native_function<LUA_NATIVE_STREAMING_IS_IPL_ACTIVE>},
+		{"IS_MODEL_A_PED", native_function<LUA_NATIVE_STREAMING_IS_MODEL_A_PED>},
+		{"IS_MODEL_A_VEHICLE", native_function<LUA_NATIVE_STREAMING_IS_MODEL_A_VEHICLE>},
+		{"IS_MODEL_IN_CDIMAGE", native_function<LUA_NATIVE_STREAMING_IS_MODEL_IN_CDIMAGE>},
+		{"IS_MODEL_VALID", native_function<LUA_NATIVE_STREAMING_IS_MODEL_VALID>},
+		{"IS_NETWORK_LOADING_SCENE", native_function<LUA_NATIVE_STREAMING_IS_NETWORK_LOADING_SCENE>},
+		{"IS_NEW_LOAD_SCENE_ACTIVE", native_function<LUA_NATIVE_STREAMING_IS_NEW_LOAD_SCENE_ACTIVE>},
+		{"IS_NEW_LOAD_SCENE_LOADED", native_function<LUA_NATIVE_STREAMING_IS_NEW_LOAD_SCENE_LOADED>},
+		{"IS_PLAYER_SWITCH_IN_PROGRESS", native_function<LUA_NATIVE_STREAMING_IS_PLAYER_SWITCH_IN_PROGRESS>},
+		{"IS_SAFE_TO_START_PLAYER_SWITCH", native_function<LUA_NATIVE_STREAMING_IS_SAFE_TO_START_PLAYER_SWITCH>},
+		{"IS_SRL_LOADED", native_function<LUA_NATIVE_STREAMING_IS_SRL_LOADED>},
+		{"IS_STREAMVOL_ACTIVE", native_function<LUA_NATIVE_STREAMING_IS_STREAMVOL_ACTIVE>},
+		{"IS_SWITCH_READY_FOR_DESCENT", native_function<LUA_NATIVE_STREAMING_IS_SWITCH_READY_FOR_DESCENT>},
+		{"IS_SWITCH_SKIPPING_DESCENT", native_function<LUA_NATIVE_STREAMING_IS_SWITCH_SKIPPING_DESCENT>},
+		{"IS_SWITCH_TO_MULTI_FIRSTPART_FINISHED", native_function<LUA_NATIVE_STREAMING_IS_SWITCH_TO_MULTI_FIRSTPART_FINISHED>},
+		{"LOAD_ALL_OBJECTS_NOW", native_function<LUA_NATIVE_STREAMING_LOAD_ALL_OBJECTS_NOW>},
+		{"LOAD_GLOBAL_WATER_FILE", native_function<LUA_NATIVE_STREAMING_LOAD_GLOBAL_WATER_FILE>},
+		{"LOAD_SCENE", native_function<LUA_NATIVE_STREAMING_LOAD_SCENE>},
+		{"NETWORK_UPDATE_LOAD_SCENE", native_function<LUA_NATIVE_STREAMING_NETWORK_UPDATE_LOAD_SCENE>},
+		{"NEW_LOAD_SCENE_START", native_function<LUA_NATIVE_STREAMING_NEW_LOAD_SCENE_START>},
+		{"NEW_LOAD_SCENE_START_SPHERE", native_function<LUA_NATIVE_STREAMING_NEW_LOAD_SCENE_START_SPHERE>},
+		{"NEW_LOAD_SCENE_STOP", native_function<LUA_NATIVE_STREAMING_NEW_LOAD_SCENE_STOP>},
+		{"OVERRIDE_LODSCALE_THIS_FRAME", native_function<LUA_NATIVE_STREAMING_OVERRIDE_LODSCALE_THIS_FRAME>},
+		{"PREFETCH_SRL", native_function<LUA_NATIVE_STREAMING_PREFETCH_SRL>},
+		{"REMAP_LODSCALE_RANGE_THIS_FRAME", native_function<LUA_NATIVE_STREAMING_REMAP_LODSCALE_RANGE_THIS_FRAME>},
+		{"REMOVE_ANIM_DICT", native_function<LUA_NATIVE_STREAMING_REMOVE_ANIM_DICT>},
+		{"REMOVE_ANIM_SET", native_function<LUA_NATIVE_STREAMING_REMOVE_ANIM_SET>},
+		{"REMOVE_CLIP_SET", native_function<LUA_NATIVE_STREAMING_REMOVE_CLIP_SET>},
+		{"REMOVE_IPL", native_function<LUA_NATIVE_STREAMING_REMOVE_IPL>},
+		{"REMOVE_MODEL_FROM_CREATOR_BUDGET", native_function<LUA_NATIVE_STREAMING_REMOVE_MODEL_FROM_CREATOR_BUDGET>},
+		{"REMOVE_NAMED_PTFX_ASSET", native_function<LUA_NATIVE_STREAMING_REMOVE_NAMED_PTFX_ASSET>},
+		{"REMOVE_PTFX_ASSET", native_function<LUA_NATIVE_STREAMING_REMOVE_PTFX_ASSET>},
+		{"REQUEST_ADDITIONAL_COLLISION_AT_COORD", native_function<LUA_NATIVE_STREAMING_REQUEST_ADDITIONAL_COLLISION_AT_COORD>},
+		{"REQUEST_ANIM_DICT", native_function<LUA_NATIVE_STREAMING_REQUEST_ANIM_DICT>},
+		{"REQUEST_ANIM_SET", native_function<LUA_NATIVE_STREAMING_REQUEST_ANIM_SET>},
+		{"REQUEST_CLIP_SET", native_function<LUA_NATIVE_STREAMING_REQUEST_CLIP_SET>},
+		{"REQUEST_COLLISION_AT_COORD", native_function<LUA_NATIVE_STREAMING_REQUEST_COLLISION_AT_COORD>},
+		{"REQUEST_COLLISION_FOR_MODEL", native_function<LUA_NATIVE_STREAMING_REQUEST_COLLISION_FOR_MODEL>},
+		{"REQUEST_IPL", native_function<LUA_NATIVE_STREAMING_REQUEST_IPL>},
+		{"REQUEST_MENU_PED_MODEL", native_function<LUA_NATIVE_STREAMING_REQUEST_MENU_PED_MODEL>},
+		{"REQUEST_MODEL", native_function<LUA_NATIVE_STREAMING_REQUEST_MODEL>},
+		{"REQUEST_MODELS_IN_ROOM", native_function<LUA_NATIVE_STREAMING_REQUEST_MODELS_IN_ROOM>},
+		{"REQUEST_NAMED_PTFX_ASSET", native_function<LUA_NATIVE_STREAMING_REQUEST_NAMED_PTFX_ASSET>},
+		{"REQUEST_PTFX_ASSET", native_function<LUA_NATIVE_STREAMING_REQUEST_PTFX_ASSET>},
+		{"SET_ALL_MAPDATA_CULLED", native_function<LUA_NATIVE_STREAMING_SET_ALL_MAPDATA_CULLED>},
+		{"SET_DITCH_POLICE_MODELS", native_function<LUA_NATIVE_STREAMING_SET_DITCH_POLICE_MODELS>},
+		{"SET_FOCUS_ENTITY", native_function<LUA_NATIVE_STREAMING_SET_FOCUS_ENTITY>},
+		{"SET_FOCUS_POS_AND_VEL", native_function<LUA_NATIVE_STREAMING_SET_FOCUS_POS_AND_VEL>},
+		{"SET_GAME_PAUSES_FOR_STREAMING", native_function<LUA_NATIVE_STREAMING_SET_GAME_PAUSES_FOR_STREAMING>},
+		{"SET_HD_AREA", native_function<LUA_NATIVE_STREAMING_SET_HD_AREA>},
+		{"SET_INTERIOR_ACTIVE", native_function<LUA_NATIVE_STREAMING_SET_INTERIOR_ACTIVE>},
+		{"SET_ISLAND_ENABLED", native_function<LUA_NATIVE_STREAMING_SET_ISLAND_ENABLED>},
+		{"SET_MAPDATACULLBOX_ENABLED", native_function<LUA_NATIVE_STREAMING_SET_MAPDATACULLBOX_ENABLED>},
+		{"SET_MODEL_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_STREAMING_SET_MODEL_AS_NO_LONGER_NEEDED>},
+		{"SET_PED_POPULATION_BUDGET", native_function<LUA_NATIVE_STREAMING_SET_PED_POPULATION_BUDGET>},
+		{"SET_PLAYER_SHORT_SWITCH_STYLE", native_function<LUA_NATIVE_STREAMING_SET_PLAYER_SHORT_SWITCH_STYLE>},
+		{"SET_PLAYER_SWITCH_ESTABLISHING_SHOT", native_function<LUA_NATIVE_STREAMING_SET_PLAYER_SWITCH_ESTABLISHING_SHOT>},
+		{"SET_PLAYER_SWITCH_OUTRO", native_function<LUA_NATIVE_STREAMING_SET_PLAYER_SWITCH_OUTRO>},
+		{"SET_REDUCE_PED_MODEL_BUDGET", native_function<LUA_NATIVE_STREAMING_SET_REDUCE_PED_MODEL_BUDGET>},
+		{"SET_REDUCE_VEHICLE_MODEL_BUDGET", native_function<LUA_NATIVE_STREAMING_SET_REDUCE_VEHICLE_MODEL_BUDGET>},
+		{"SET_RENDER_HD_ONLY", native_function<LUA_NATIVE_STREAMING_SET_RENDER_HD_ONLY>},
+		{"SET_RESTORE_FOCUS_ENTITY", native_function<LUA_NATIVE_STREAMING_SET_RESTORE_FOCUS_ENTITY>},
+		{"SET_SCENE_STREAMING_TRACKS_CAM_POS_THIS_FRAME", native_function<LUA_NATIVE_STREAMING_SET_SCENE_STREAMING_TRACKS_CAM_POS_THIS_FRAME>},
+		{"SET_SRL_FORCE_PRESTREAM", native_function<LUA_NATIVE_STREAMING_SET_SRL_FORCE_PRESTREAM>},
+		{"SET_SRL_LONG_JUMP_MODE", native_function<LUA_NATIVE_STREAMING_SET_SRL_LONG_JUMP_MODE>},
+		{"SET_SRL_POST_CUTSCENE_CAMERA", native_function<LUA_NATIVE_STREAMING_SET_SRL_POST_CUTSCENE_CAMERA>},
+		{"SET_SRL_READAHEAD_TIMES", native_function<LUA_NATIVE_STREAMING_SET_SRL_READAHEAD_TIMES>},
+		{"SET_SRL_TIME", native_function<LUA_NATIVE_STREAMING_SET_SRL_TIME>},
+		{"SET_STREAMING", native_function<LUA_NATIVE_STREAMING_SET_STREAMING>},
+		{"SET_VEHICLE_POPULATION_BUDGET", native_function<LUA_NATIVE_STREAMING_SET_VEHICLE_POPULATION_BUDGET>},
+		{"SHUTDOWN_CREATOR_BUDGET", native_function<LUA_NATIVE_STREAMING_SHUTDOWN_CREATOR_BUDGET>},
+		{"START_PLAYER_SWITCH", native_function<LUA_NATIVE_STREAMING_START_PLAYER_SWITCH>},
+		{"STOP_PLAYER_SWITCH", native_function<LUA_NATIVE_STREAMING_STOP_PLAYER_SWITCH>},
+		{"STREAMVOL_CREATE_FRUSTUM", native_function<LUA_NATIVE_STREAMING_STREAMVOL_CREATE_FRUSTUM>},
+		{"STREAMVOL_CREATE_LINE", native_function<LUA_NATIVE_STREAMING_STREAMVOL_CREATE_LINE>},
+		{"STREAMVOL_CREATE_SPHERE", native_function<LUA_NATIVE_STREAMING_STREAMVOL_CREATE_SPHERE>},
+		{"STREAMVOL_DELETE", native_function<LUA_NATIVE_STREAMING_STREAMVOL_DELETE>},
+		{"STREAMVOL_HAS_LOADED", native_function<LUA_NATIVE_STREAMING_STREAMVOL_HAS_LOADED>},
+		{"STREAMVOL_IS_VALID", native_function<LUA_NATIVE_STREAMING_STREAMVOL_IS_VALID>},
+		{"SUPPRESS_HD_MAP_STREAMING_THIS_FRAME", native_function<LUA_NATIVE_STREAMING_SUPPRESS_HD_MAP_STREAMING_THIS_FRAME>},
+		{"SWITCH_TO_MULTI_FIRSTPART", native_function<LUA_NATIVE_STREAMING_SWITCH_TO_MULTI_FIRSTPART>},
+		{"SWITCH_TO_MULTI_SECONDPART", native_function<LUA_NATIVE_STREAMING_SWITCH_TO_MULTI_SECONDPART>},
+	};
+
 	void init_native_binding_STREAMING(sol::state& L)
 	{
-		auto STREAMING = L["STREAMING"].get_or_create<sol::table>();
-		STREAMING.set_function("LOAD_ALL_OBJECTS_NOW", LUA_NATIVE_STREAMING_LOAD_ALL_OBJECTS_NOW);
-		STREAMING.set_function("LOAD_SCENE", LUA_NATIVE_STREAMING_LOAD_SCENE);
-		STREAMING.set_function("NETWORK_UPDATE_LOAD_SCENE", LUA_NATIVE_STREAMING_NETWORK_UPDATE_LOAD_SCENE);
-		STREAMING.set_function("IS_NETWORK_LOADING_SCENE", LUA_NATIVE_STREAMING_IS_NETWORK_LOADING_SCENE);
-		STREAMING.set_function("SET_INTERIOR_ACTIVE", LUA_NATIVE_STREAMING_SET_INTERIOR_ACTIVE);
-		STREAMING.set_function("REQUEST_MODEL", LUA_NATIVE_STREAMING_REQUEST_MODEL);
-		STREAMING.set_function("REQUEST_MENU_PED_MODEL", LUA_NATIVE_STREAMING_REQUEST_MENU_PED_MODEL);
-		STREAMING.set_function("HAS_MODEL_LOADED", LUA_NATIVE_STREAMING_HAS_MODEL_LOADED);
-		STREAMING.set_function("REQUEST_MODELS_IN_ROOM", LUA_NATIVE_STREAMING_REQUEST_MODELS_IN_ROOM);
-		STREAMING.set_function("SET_MODEL_AS_NO_LONGER_NEEDED", LUA_NATIVE_STREAMING_SET_MODEL_AS_NO_LONGER_NEEDED);
-		STREAMING.set_function("IS_MODEL_IN_CDIMAGE", LUA_NATIVE_STREAMING_IS_MODEL_IN_CDIMAGE);
-		STREAMING.set_function("IS_MODEL_VALID", LUA_NATIVE_STREAMING_IS_MODEL_VALID);
-		STREAMING.set_function("IS_MODEL_A_PED", LUA_NATIVE_STREAMING_IS_MODEL_A_PED);
-		STREAMING.set_function("IS_MODEL_A_VEHICLE", LUA_NATIVE_STREAMING_IS_MODEL_A_VEHICLE);
-		STREAMING.set_function("REQUEST_COLLISION_AT_COORD", LUA_NATIVE_STREAMING_REQUEST_COLLISION_AT_COORD);
-		STREAMING.set_function("REQUEST_COLLISION_FOR_MODEL", LUA_NATIVE_STREAMING_REQUEST_COLLISION_FOR_MODEL);
-		STREAMING.set_function("HAS_COLLISION_FOR_MODEL_LOADED", LUA_NATIVE_STREAMING_HAS_COLLISION_FOR_MODEL_LOADED);
-		STREAMING.set_function("REQUEST_ADDITIONAL_COLLISION_AT_COORD", LUA_NATIVE_STREAMING_REQUEST_ADDITIONAL_COLLISION_AT_COORD);
-		STREAMING.set_function("DOES_ANIM_DICT_EXIST", LUA_NATIVE_STREAMING_DOES_ANIM_DICT_EXIST);
-		STREAMING.set_function("REQUEST_ANIM_DICT", LUA_NATIVE_STREAMING_REQUEST_ANIM_DICT);
-		STREAMING.set_function("HAS_ANIM_DICT_LOADED", LUA_NATIVE_STREAMING_HAS_ANIM_DICT_LOADED);
-		STREAMING.set_function("REMOVE_ANIM_DICT", LUA_NATIVE_STREAMING_REMOVE_ANIM_DICT);
-		STREAMING.set_function("REQUEST_ANIM_SET", LUA_NATIVE_STREAMING_REQUEST_ANIM_SET);
-		STREAMING.set_function("HAS_ANIM_SET_LOADED", LUA_NATIVE_STREAMING_HAS_ANIM_SET_LOADED);
-		STREAMING.set_function("REMOVE_ANIM_SET", LUA_NATIVE_STREAMING_REMOVE_ANIM_SET);
-		STREAMING.set_function("REQUEST_CLIP_SET", LUA_NATIVE_STREAMING_REQUEST_CLIP_SET);
-		STREAMING.set_function("HAS_CLIP_SET_LOADED", LUA_NATIVE_STREAMING_HAS_CLIP_SET_LOADED);
-		STREAMING.set_function("REMOVE_CLIP_SET", LUA_NATIVE_STREAMING_REMOVE_CLIP_SET);
-		STREAMING.set_function("REQUEST_IPL", LUA_NATIVE_STREAMING_REQUEST_IPL);
-		STREAMING.set_function("REMOVE_IPL", LUA_NATIVE_STREAMING_REMOVE_IPL);
-		STREAMING.set_function("IS_IPL_ACTIVE", LUA_NATIVE_STREAMING_IS_IPL_ACTIVE);
-		STREAMING.set_function("SET_STREAMING", LUA_NATIVE_STREAMING_SET_STREAMING);
-		STREAMING.set_function("LOAD_GLOBAL_WATER_FILE", LUA_NATIVE_STREAMING_LOAD_GLOBAL_WATER_FILE);
-		STREAMING.set_function("GET_GLOBAL_WATER_FILE", LUA_NATIVE_STREAMING_GET_GLOBAL_WATER_FILE);
-		STREAMING.set_function("SET_GAME_PAUSES_FOR_STREAMING", LUA_NATIVE_STREAMING_SET_GAME_PAUSES_FOR_STREAMING);
-		STREAMING.set_function("SET_REDUCE_PED_MODEL_BUDGET", LUA_NATIVE_STREAMING_SET_REDUCE_PED_MODEL_BUDGET);
-		STREAMING.set_function("SET_REDUCE_VEHICLE_MODEL_BUDGET", LUA_NATIVE_STREAMING_SET_REDUCE_VEHICLE_MODEL_BUDGET);
-		STREAMING.set_function("SET_DITCH_POLICE_MODELS", LUA_NATIVE_STREAMING_SET_DITCH_POLICE_MODELS);
-		STREAMING.set_function("GET_NUMBER_OF_STREAMING_REQUESTS", LUA_NATIVE_STREAMING_GET_NUMBER_OF_STREAMING_REQUESTS);
-		STREAMING.set_function("REQUEST_PTFX_ASSET", LUA_NATIVE_STREAMING_REQUEST_PTFX_ASSET);
-		STREAMING.set_function("HAS_PTFX_ASSET_LOADED", LUA_NATIVE_STREAMING_HAS_PTFX_ASSET_LOADED);
-		STREAMING.set_function("REMOVE_PTFX_ASSET", LUA_NATIVE_STREAMING_REMOVE_PTFX_ASSET);
-		STREAMING.set_function("REQUEST_NAMED_PTFX_ASSET", LUA_NATIVE_STREAMING_REQUEST_NAMED_PTFX_ASSET);
-		STREAMING.set_function("HAS_NAMED_PTFX_ASSET_LOADED", LUA_NATIVE_STREAMING_HAS_NAMED_PTFX_ASSET_LOADED);
-		STREAMING.set_function("REMOVE_NAMED_PTFX_ASSET", LUA_NATIVE_STREAMING_REMOVE_NAMED_PTFX_ASSET);
-		STREAMING.set_function("SET_VEHICLE_POPULATION_BUDGET", LUA_NATIVE_STREAMING_SET_VEHICLE_POPULATION_BUDGET);
-		STREAMING.set_function("SET_PED_POPULATION_BUDGET", LUA_NATIVE_STREAMING_SET_PED_POPULATION_BUDGET);
-		STREAMING.set_function("CLEAR_FOCUS", LUA_NATIVE_STREAMING_CLEAR_FOCUS);
-		STREAMING.set_function("SET_FOCUS_POS_AND_VEL", LUA_NATIVE_STREAMING_SET_FOCUS_POS_AND_VEL);
-		STREAMING.set_function("SET_FOCUS_ENTITY", LUA_NATIVE_STREAMING_SET_FOCUS_ENTITY);
-		STREAMING.set_function("IS_ENTITY_FOCUS", LUA_NATIVE_STREAMING_IS_ENTITY_FOCUS);
-		STREAMING.set_function("SET_RESTORE_FOCUS_ENTITY", LUA_NATIVE_STREAMING_SET_RESTORE_FOCUS_ENTITY);
-		STREAMING.set_function("SET_MAPDATACULLBOX_ENABLED", LUA_NATIVE_STREAMING_SET_MAPDATACULLBOX_ENABLED);
-		STREAMING.set_function("SET_ALL_MAPDATA_CULLED", LUA_NATIVE_STREAMING_SET_ALL_MAPDATA_CULLED);
-		STREAMING.set_function("STREAMVOL_CREATE_SPHERE", LUA_NATIVE_STREAMING_STREAMVOL_CREATE_SPHERE);
-		STREAMING.set_function("STREAMVOL_CREATE_FRUSTUM", LUA_NATIVE_STREAMING_STREAMVOL_CREATE_FRUSTUM);
-		STREAMING.set_function("STREAMVOL_CREATE_LINE", LUA_NATIVE_STREAMING_STREAMVOL_CREATE_LINE);
-		STREAMING.set_function("STREAMVOL_DELETE", LUA_NATIVE_STREAMING_STREAMVOL_DELETE);
-		STREAMING.set_function("STREAMVOL_HAS_LOADED", LUA_NATIVE_STREAMING_STREAMVOL_HAS_LOADED);
-		STREAMING.set_function("STREAMVOL_IS_VALID", LUA_NATIVE_STREAMING_STREAMVOL_IS_VALID);
-		STREAMING.set_function("IS_STREAMVOL_ACTIVE", LUA_NATIVE_STREAMING_IS_STREAMVOL_ACTIVE);
-		STREAMING.set_function("NEW_LOAD_SCENE_START", LUA_NATIVE_STREAMING_NEW_LOAD_SCENE_START);
-		STREAMING.set_function("NEW_LOAD_SCENE_START_SPHERE", LUA_NATIVE_STREAMING_NEW_LOAD_SCENE_START_SPHERE);
-		STREAMING.set_function("NEW_LOAD_SCENE_STOP", LUA_NATIVE_STREAMING_NEW_LOAD_SCENE_STOP);
-		STREAMING.set_function("IS_NEW_LOAD_SCENE_ACTIVE", LUA_NATIVE_STREAMING_IS_NEW_LOAD_SCENE_ACTIVE);
-		STREAMING.set_function("IS_NEW_LOAD_SCENE_LOADED", LUA_NATIVE_STREAMING_IS_NEW_LOAD_SCENE_LOADED);
-		STREAMING.set_function("IS_SAFE_TO_START_PLAYER_SWITCH", LUA_NATIVE_STREAMING_IS_SAFE_TO_START_PLAYER_SWITCH);
-		STREAMING.set_function("START_PLAYER_SWITCH", LUA_NATIVE_STREAMING_START_PLAYER_SWITCH);
-		STREAMING.set_function("STOP_PLAYER_SWITCH", LUA_NATIVE_STREAMING_STOP_PLAYER_SWITCH);
-		STREAMING.set_function("IS_PLAYER_SWITCH_IN_PROGRESS", LUA_NATIVE_STREAMING_IS_PLAYER_SWITCH_IN_PROGRESS);
-		STREAMING.set_function("GET_PLAYER_SWITCH_TYPE", LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_TYPE);
-		STREAMING.set_function("GET_IDEAL_PLAYER_SWITCH_TYPE", LUA_NATIVE_STREAMING_GET_IDEAL_PLAYER_SWITCH_TYPE);
-		STREAMING.set_function("GET_PLAYER_SWITCH_STATE", LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_STATE);
-		STREAMING.set_function("GET_PLAYER_SHORT_SWITCH_STATE", LUA_NATIVE_STREAMING_GET_PLAYER_SHORT_SWITCH_STATE);
-		STREAMING.set_function("SET_PLAYER_SHORT_SWITCH_STYLE", LUA_NATIVE_STREAMING_SET_PLAYER_SHORT_SWITCH_STYLE);
-		STREAMING.set_function("GET_PLAYER_SWITCH_JUMP_CUT_INDEX", LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_JUMP_CUT_INDEX);
-		STREAMING.set_function("SET_PLAYER_SWITCH_OUTRO", LUA_NATIVE_STREAMING_SET_PLAYER_SWITCH_OUTRO);
-		STREAMING.set_function("SET_PLAYER_SWITCH_ESTABLISHING_SHOT", LUA_NATIVE_STREAMING_SET_PLAYER_SWITCH_ESTABLISHING_SHOT);
-		STREAMING.set_function("ALLOW_PLAYER_SWITCH_PAN", LUA_NATIVE_STREAMING_ALLOW_PLAYER_SWITCH_PAN);
-		STREAMING.set_function("ALLOW_PLAYER_SWITCH_OUTRO", LUA_NATIVE_STREAMING_ALLOW_PLAYER_SWITCH_OUTRO);
-		STREAMING.set_function("ALLOW_PLAYER_SWITCH_ASCENT", LUA_NATIVE_STREAMING_ALLOW_PLAYER_SWITCH_ASCENT);
-		STREAMING.set_function("ALLOW_PLAYER_SWITCH_DESCENT", LUA_NATIVE_STREAMING_ALLOW_PLAYER_SWITCH_DESCENT);
-		STREAMING.set_function("IS_SWITCH_READY_FOR_DESCENT", LUA_NATIVE_STREAMING_IS_SWITCH_READY_FOR_DESCENT);
-		STREAMING.set_function("ENABLE_SWITCH_PAUSE_BEFORE_DESCENT", LUA_NATIVE_STREAMING_ENABLE_SWITCH_PAUSE_BEFORE_DESCENT);
-		STREAMING.set_function("DISABLE_SWITCH_OUTRO_FX", LUA_NATIVE_STREAMING_DISABLE_SWITCH_OUTRO_FX);
-		STREAMING.set_function("SWITCH_TO_MULTI_FIRSTPART", LUA_NATIVE_STREAMING_SWITCH_TO_MULTI_FIRSTPART);
-		STREAMING.set_function("SWITCH_TO_MULTI_SECONDPART", LUA_NATIVE_STREAMING_SWITCH_TO_MULTI_SECONDPART);
-		STREAMING.set_function("IS_SWITCH_TO_MULTI_FIRSTPART_FINISHED", LUA_NATIVE_STREAMING_IS_SWITCH_TO_MULTI_FIRSTPART_FINISHED);
-		STREAMING.set_function("GET_PLAYER_SWITCH_INTERP_OUT_DURATION", LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_INTERP_OUT_DURATION);
-		STREAMING.set_function("GET_PLAYER_SWITCH_INTERP_OUT_CURRENT_TIME", LUA_NATIVE_STREAMING_GET_PLAYER_SWITCH_INTERP_OUT_CURRENT_TIME);
-		STREAMING.set_function("IS_SWITCH_SKIPPING_DESCENT", LUA_NATIVE_STREAMING_IS_SWITCH_SKIPPING_DESCENT);
-		STREAMING.set_function("SET_SCENE_STREAMING_TRACKS_CAM_POS_THIS_FRAME", LUA_NATIVE_STREAMING_SET_SCENE_STREAMING_TRACKS_CAM_POS_THIS_FRAME);
-		STREAMING.set_function("GET_LODSCALE", LUA_NATIVE_STREAMING_GET_LODSCALE);
-		STREAMING.set_function("OVERRIDE_LODSCALE_THIS_FRAME", LUA_NATIVE_STREAMING_OVERRIDE_LODSCALE_THIS_FRAME);
-		STREAMING.set_function("REMAP_LODSCALE_RANGE_THIS_FRAME", LUA_NATIVE_STREAMING_REMAP_LODSCALE_RANGE_THIS_FRAME);
-		STREAMING.set_function("SUPPRESS_HD_MAP_STREAMING_THIS_FRAME", LUA_NATIVE_STREAMING_SUPPRESS_HD_MAP_STREAMING_THIS_FRAME);
-		STREAMING.set_function("SET_RENDER_HD_ONLY", LUA_NATIVE_STREAMING_SET_RENDER_HD_ONLY);
-		STREAMING.set_function("FORCE_ALLOW_TIME_BASED_FADING_THIS_FRAME", LUA_NATIVE_STREAMING_FORCE_ALLOW_TIME_BASED_FADING_THIS_FRAME);
-		STREAMING.set_function("IPL_GROUP_SWAP_START", LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_START);
-		STREAMING.set_function("IPL_GROUP_SWAP_CANCEL", LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_CANCEL);
-		STREAMING.set_function("IPL_GROUP_SWAP_IS_READY", LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_IS_READY);
-		STREAMING.set_function("IPL_GROUP_SWAP_FINISH", LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_FINISH);
-		STREAMING.set_function("IPL_GROUP_SWAP_IS_ACTIVE", LUA_NATIVE_STREAMING_IPL_GROUP_SWAP_IS_ACTIVE);
-		STREAMING.set_function("PREFETCH_SRL", LUA_NATIVE_STREAMING_PREFETCH_SRL);
-		STREAMING.set_function("IS_SRL_LOADED", LUA_NATIVE_STREAMING_IS_SRL_LOADED);
-		STREAMING.set_function("BEGIN_SRL", LUA_NATIVE_STREAMING_BEGIN_SRL);
-		STREAMING.set_function("END_SRL", LUA_NATIVE_STREAMING_END_SRL);
-		STREAMING.set_function("SET_SRL_TIME", LUA_NATIVE_STREAMING_SET_SRL_TIME);
-		STREAMING.set_function("SET_SRL_POST_CUTSCENE_CAMERA", LUA_NATIVE_STREAMING_SET_SRL_POST_CUTSCENE_CAMERA);
-		STREAMING.set_function("SET_SRL_READAHEAD_TIMES", LUA_NATIVE_STREAMING_SET_SRL_READAHEAD_TIMES);
-		STREAMING.set_function("SET_SRL_LONG_JUMP_MODE", LUA_NATIVE_STREAMING_SET_SRL_LONG_JUMP_MODE);
-		STREAMING.set_function("SET_SRL_FORCE_PRESTREAM", LUA_NATIVE_STREAMING_SET_SRL_FORCE_PRESTREAM);
-		STREAMING.set_function("SET_HD_AREA", LUA_NATIVE_STREAMING_SET_HD_AREA);
-		STREAMING.set_function("CLEAR_HD_AREA", LUA_NATIVE_STREAMING_CLEAR_HD_AREA);
-		STREAMING.set_function("INIT_CREATOR_BUDGET", LUA_NATIVE_STREAMING_INIT_CREATOR_BUDGET);
-		STREAMING.set_function("SHUTDOWN_CREATOR_BUDGET", LUA_NATIVE_STREAMING_SHUTDOWN_CREATOR_BUDGET);
-		STREAMING.set_function("ADD_MODEL_TO_CREATOR_BUDGET", LUA_NATIVE_STREAMING_ADD_MODEL_TO_CREATOR_BUDGET);
-		STREAMING.set_function("REMOVE_MODEL_FROM_CREATOR_BUDGET", LUA_NATIVE_STREAMING_REMOVE_MODEL_FROM_CREATOR_BUDGET);
-		STREAMING.set_function("GET_USED_CREATOR_BUDGET", LUA_NATIVE_STREAMING_GET_USED_CREATOR_BUDGET);
-		STREAMING.set_function("SET_ISLAND_ENABLED", LUA_NATIVE_STREAMING_SET_ISLAND_ENABLED);
+		bind_namespace(L, "STREAMING", STREAMING_natives);
 	}
 }
@@ -155,34 +155,37 @@ namespace lua::native
 		SYSTEM::SET_THIS_THREAD_PRIORITY(priority);
 	}
 
+	static constexpr native_entry SYSTEM_natives[] = {
+		{"CEIL", native_function<LUA_NATIVE_SYSTEM_CEIL>},
+		{"COS", native_function<LUA_NATIVE_SYSTEM_COS>},
+		{"FLOOR", native_function<LUA_NATIVE_SYSTEM_FLOOR>},
+		{"LOG10", native_function<LUA_NATIVE_SYSTEM_LOG10>},
+		{"POW", native_function<LUA_NATIVE_SYSTEM_POW>},
+		{"ROUND", native_function<LUA_NATIVE_SYSTEM_ROUND>},
+		{"SETTIMERA", native_function<LUA_NATIVE_SYSTEM_SETTIMERA>},
+		{"SETTIMERB", native_function<LUA_NATIVE_SYSTEM_SETTIMERB>},
+		{"SET_THIS_THREAD_PRIORITY", native_function<LUA_NATIVE_SYSTEM_SET_THIS_THREAD_PRIORITY>},
+		{"SHIFT_LEFT", native_function<LUA_NATIVE_SYSTEM_SHIFT_LEFT>},
+		{"SHIFT_RIGHT", native_function<LUA_NATIVE_SYSTEM_SHIFT_RIGHT>},
+		{"SIN", native_function<LUA_NATIVE_SYSTEM_SIN>},
+		{"SQRT", native_function<LUA_NATIVE_SYSTEM_SQRT>},
+		{"START_NEW_SCRIPT", native_function<LUA_NATIVE_SYSTEM_START_NEW_SCRIPT>},
+		{"START_NEW_SCRIPT_WITH_ARGS", native_function<LUA_NATIVE_SYSTEM_START_NEW_SCRIPT_WITH_ARGS>},
+		{"START_NEW_SCRIPT_WITH_NAME_HASH", native_function<LUA_NATIVE_SYSTEM_START_NEW_SCRIPT_WITH_NAME_HASH>},
+		{"START_NEW_SCRIPT_WITH_NAME_HASH_AND_ARGS", native_function<LUA_NATIVE_SYSTEM_START_NEW_SCRIPT_WITH_NAME_HASH_AND_ARGS>},
+		{"TIMERA", native_function<LUA_NATIVE_SYSTEM_TIMERA>},
+		{"TIMERB", native_function<LUA_NATIVE_SYSTEM_TIMERB>},
+		{"TIMESTEP", native_function<LUA_NATIVE_SYSTEM_TIMESTEP>},
+		{"TO_FLOAT", native_function<LUA_NATIVE_SYSTEM_TO_FLOAT>},
+		{"VDIST", native_function<LUA_NATIVE_SYSTEM_VDIST>},
+		{"VDIST2", native_function<LUA_NATIVE_SYSTEM_VDIST2>},
+		{"VMAG", native_function<LUA_NATIVE_SYSTEM_VMAG>},
+		{"VMAG2", native_function<LUA_NATIVE_SYSTEM_VMAG2>},
+		{"WAIT", native_function<LUA_NATIVE_SYSTEM_WAIT>},
+	};
+
 	void init_native_binding_SYSTEM(sol::state& L)
 	{
-		auto SYSTEM = L["SYSTEM"].get_or_create<sol::table>();
-		SYSTEM.set_function("WAIT", LUA_NATIVE_SYSTEM_WAIT);
-		SYSTEM.set_function("START_NEW_SCRIPT", LUA_NATIVE_SYSTEM_START_NEW_SCRIPT);
-		SYSTEM.set_function("START_NEW_SCRIPT_WITH_ARGS", LUA_NATIVE_SYSTEM_START_NEW_SCRIPT_WITH_ARGS);
-		SYSTEM.set_function("START_NEW_SCRIPT_WITH_NAME_HASH", LUA_NATIVE_SYSTEM_START_NEW_SCRIPT_WITH_NAME_HASH);
-		SYSTEM.set_function("START_NEW_SCRIPT_WITH_NAME_HASH_AND_ARGS", LUA_NATIVE_SYSTEM_START_NEW_SCRIPT_WITH_NAME_HASH_AND_ARGS);
-		SYSTEM.set_function("TIMERA", LUA_NATIVE_SYSTEM_TIMERA);
-		SYSTEM.set_function("TIMERB", LUA_NATIVE_SYSTEM_TIMERB);
-		SYSTEM.set_function("SETTIMERA", LUA_NATIVE_SYSTEM_SETTIMERA);
-		SYSTEM.set_function("SETTIMERB", LUA_NATIVE_SYSTEM_SETTIMERB);
-		SYSTEM.set_function("TIMESTEP", LUA_NATIVE_SYSTEM_TIMESTEP);
-		SYSTEM.set_function("SIN", LUA_NATIVE_SYSTEM_SIN);
-		SYSTEM.set_function("COS", LUA_NATIVE_SYSTEM_COS);
-		SYSTEM.set_function("SQRT", LUA_NATIVE_SYSTEM_SQRT);
-		SYSTEM.set_function("POW", LUA_NATIVE_SYSTEM_POW);
-		SYSTEM.set_function("LOG10", LUA_NATIVE_SYSTEM_LOG10);
-		SYSTEM.set_function("VMAG", LUA_NATIVE_SYSTEM_VMAG);
-		SYSTEM.set_function("VMAG2", LUA_NATIVE_SYSTEM_VMAG2);
-		SYSTEM.set_function("VDIST", LUA_NATIVE_SYSTEM_VDIST);
-		SYSTEM.set_function("VDIST2", LUA_NATIVE_SYSTEM_VDIST2);
-		SYSTEM.set_function("SHIFT_LEFT", LUA_NATIVE_SYSTEM_SHIFT_LEFT);
-		SYSTEM.set_function("SHIFT_RIGHT", LUA_NATIVE_SYSTEM_SHIFT_RIGHT);
-		SYSTEM.set_function("FLOOR", LUA_NATIVE_SYSTEM_FLOOR);
-		SYSTEM.set_function("CEIL", LUA_NATIVE_SYSTEM_CEIL);
-		SYSTEM.set_function("ROUND", LUA_NATIVE_SYSTEM_ROUND);
-		SYSTEM.set_function("TO_FLOAT", LUA_NATIVE_SYSTEM_TO_FLOAT);
-		SYSTEM.set_function("SET_THIS_THREAD_PRIORITY", LUA_NATIVE_SYSTEM_SET_THIS_THREAD_PRIORITY);
+		bind_namespace(L, "SYSTEM", SYSTEM_natives);
 	}
 }
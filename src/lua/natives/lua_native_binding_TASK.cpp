@@ -1638,315 +1638,318 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry TASK_natives[] = {
+		{"ADD_COVER_BLOCKING_AREA", native_function<LUA_NATIVE_TASK_ADD_COVER_BLOCKING_AREA>},
+		{"ADD_COVER_POINT", native_function<LUA_NATIVE_TASK_ADD_COVER_POINT>},
+		{"ADD_PATROL_ROUTE_LINK", native_function<LUA_NATIVE_TASK_ADD_PATROL_ROUTE_LINK>},
+		{"ADD_PATROL_ROUTE_NODE", native_function<LUA_NATIVE_TASK_ADD_PATROL_ROUTE_NODE>},
+		{"ADD_SCRIPTED_COVER_AREA", native_function<LUA_NATIVE_TASK_ADD_SCRIPTED_COVER_AREA>},
+		{"ADD_VEHICLE_SUBTASK_ATTACK_COORD", native_function<LUA_NATIVE_TASK_ADD_VEHICLE_SUBTASK_ATTACK_COORD>},
+		{"ADD_VEHICLE_SUBTASK_ATTACK_PED", native_function<LUA_NATIVE_TASK_ADD_VEHICLE_SUBTASK_ATTACK_PED>},
+		{"ASSISTED_MOVEMENT_IS_ROUTE_LOADED", native_function<LUA_NATIVE_TASK_ASSISTED_MOVEMENT_IS_ROUTE_LOADED>},
+		{"ASSISTED_MOVEMENT_OVERRIDE_LOAD_DISTANCE_THIS_FRAME", native_function<LUA_NATIVE_TASK_ASSISTED_MOVEMENT_OVERRIDE_LOAD_DISTANCE_THIS_FRAME>},
+		{"ASSISTED_MOVEMENT_REMOVE_ROUTE", native_function<LUA_NATIVE_TASK_ASSISTED_MOVEMENT_REMOVE_ROUTE>},
+		{"ASSISTED_MOVEMENT_REQUEST_ROUTE", native_function<LUA_NATIVE_TASK_ASSISTED_MOVEMENT_REQUEST_ROUTE>},
+		{"ASSISTED_MOVEMENT_SET_ROUTE_PROPERTIES", native_function<LUA_NATIVE_TASK_ASSISTED_MOVEMENT_SET_ROUTE_PROPERTIES>},
+		{"CLEAR_DEFAULT_PRIMARY_TASK", native_function<LUA_NATIVE_TASK_CLEAR_DEFAULT_PRIMARY_TASK>},
+		{"CLEAR_DRIVEBY_TASK_UNDERNEATH_DRIVING_TASK", native_function<LUA_NATIVE_TASK_CLEAR_DRIVEBY_TASK_UNDERNEATH_DRIVING_TASK>},
+		{"CLEAR_PED_SECONDARY_TASK", native_function<LUA_NATIVE_TASK_CLEAR_PED_SECONDARY_TASK>},
+		{"CLEAR_PED_TASKS", native_function<LUA_NATIVE_TASK_CLEAR_PED_TASKS>},
+		{"CLEAR_PED_TASKS_IMMEDIATELY", native_function<LUA_NATIVE_TASK_CLEAR_PED_TASKS_IMMEDIATELY>},
+		{"CLEAR_PRIMARY_VEHICLE_TASK", native_function<LUA_NATIVE_TASK_CLEAR_PRIMARY_VEHICLE_TASK>},
+		{"CLEAR_SEQUENCE_TASK", native_function<LUA_NATIVE_TASK_CLEAR_SEQUENCE_TASK>},
+		{"CLEAR_VEHICLE_CRASH_TASK", native_function<LUA_NATIVE_TASK_CLEAR_VEHICLE_CRASH_TASK>},
+		{"CLOSE_PATROL_ROUTE", native_function<LUA_NATIVE_TASK_CLOSE_PATROL_ROUTE>},
+		{"CLOSE_SEQUENCE_TASK", native_function<LUA_NATIVE_TASK_CLOSE_SEQUENCE_TASK>},
+		{"CONTROL_MOUNTED_WEAPON", native_function<LUA_NATIVE_TASK_CONTROL_MOUNTED_WEAPON>},
+		{"CREATE_PATROL_ROUTE", native_function<LUA_NATIVE_TASK_CREATE_PATROL_ROUTE>},
+		{"DELETE_PATROL_ROUTE", native_function<LUA_NATIVE_TASK_DELETE_PATROL_ROUTE>},
+		{"DOES_SCENARIO_EXIST_IN_AREA", native_function<LUA_NATIVE_TASK_DOES_SCENARIO_EXIST_IN_AREA>},
+		{"DOES_SCENARIO_GROUP_EXIST", native_function<LUA_NATIVE_TASK_DOES_SCENARIO_GROUP_EXIST>},
+		{"DOES_SCENARIO_OF_TYPE_EXIST_IN_AREA", native_function<LUA_NATIVE_TASK_DOES_SCENARIO_OF_TYPE_EXIST_IN_AREA>},
+		{"DOES_SCRIPTED_COVER_POINT_EXIST_AT_COORDS", native_function<LUA_NATIVE_TASK_DOES_SCRIPTED_COVER_POINT_EXIST_AT_COORDS>},
+		{"GET_ACTIVE_VEHICLE_MISSION_TYPE", native_function<LUA_NATIVE_TASK_GET_ACTIVE_VEHICLE_MISSION_TYPE>},
+		{"GET_CLIP_SET_FOR_SCRIPTED_GUN_TASK", native_function<LUA_NATIVE_TASK_GET_CLIP_SET_FOR_SCRIPTED_GUN_TASK>},
+		{"GET_IS_TASK_ACTIVE", native_function<LUA_NATIVE_TASK_GET_IS_TASK_ACTIVE>},
+		{"GET_IS_WAYPOINT_RECORDING_LOADED", native_function<LUA_NATIVE_TASK_GET_IS_WAYPOINT_RECORDING_LOADED>},
+		{"GET_NAVMESH_ROUTE_DISTANCE_REMAINING", native_function<LUA_NATIVE_TASK_GET_NAVMESH_ROUTE_DISTANCE_REMAINING>},
+		{"GET_NAVMESH_ROUTE_RESULT", native_function<LUA_NATIVE_TASK_GET_NAVMESH_ROUTE_RESULT>},
+		{"GET_PATROL_TASK_INFO", native_function<LUA_NATIVE_TASK_GET_PATROL_TASK_INFO>},
+		{"GET_PED_DESIRED_MOVE_BLEND_RATIO", native_function<LUA_NATIVE_TASK_GET_PED_DESIRED_MOVE_BLEND_RATIO>},
+		{"GET_PED_WAYPOINT_DISTANCE", native_function<LUA_NATIVE_TASK_GET_PED_WAYPOINT_DISTANCE>},
+		{"GET_PED_WAYPOINT_PROGRESS", native_function<LUA_NATIVE_TASK_GET_PED_WAYPOINT_PROGRESS>},
+		{"GET_PHONE_GESTURE_ANIM_CURRENT_TIME", native_function<LUA_NATIVE_TASK_GET_PHONE_GESTURE_ANIM_CURRENT_TIME>},
+		{"GET_PHONE_GESTURE_ANIM_TOTAL_TIME", native_function<LUA_NATIVE_TASK_GET_PHONE_GESTURE_ANIM_TOTAL_TIME>},
+		{"GET_SCRIPTED_COVER_POINT_COORDS", native_function<LUA_NATIVE_TASK_GET_SCRIPTED_COVER_POINT_COORDS>},
+		{"GET_SCRIPT_TASK_STATUS", native_function<LUA_NATIVE_TASK_GET_SCRIPT_TASK_STATUS>},
+		{"GET_SEQUENCE_PROGRESS", native_function<LUA_NATIVE_TASK_GET_SEQUENCE_PROGRESS>},
+		{"GET_TASK_MOVE_NETWORK_EVENT", native_function<LUA_NATIVE_TASK_GET_TASK_MOVE_NETWORK_EVENT>},
+		{"GET_TASK_MOVE_NETWORK_SIGNAL_BOOL", native_function<LUA_NATIVE_TASK_GET_TASK_MOVE_NETWORK_SIGNAL_BOOL>},
+		{"GET_TASK_MOVE_NETWORK_SIGNAL_FLOAT", native_function<LUA_NATIVE_TASK_GET_TASK_MOVE_NETWORK_SIGNAL_FLOAT>},
+		{"GET_TASK_MOVE_NETWORK_STATE", native_function<LUA_NATIVE_TASK_GET_TASK_MOVE_NETWORK_STATE>},
+		{"GET_TASK_RAPPEL_DOWN_WALL_STATE", native_function<LUA_NATIVE_TASK_GET_TASK_RAPPEL_DOWN_WALL_STATE>},
+		{"GET_VEHICLE_WAYPOINT_PROGRESS", native_function<LUA_NATIVE_TASK_GET_VEHICLE_WAYPOINT_PROGRESS>},
+		{"GET_VEHICLE_WAYPOINT_TARGET_POINT", native_function<LUA_NATIVE_TASK_GET_VEHICLE_WAYPOINT_TARGET_POINT>},
+		{"GET_WAYPOINT_DISTANCE_ALONG_ROUTE", native_function<LUA_NATIVE_TASK_GET_WAYPOINT_DISTANCE_ALONG_ROUTE>},
+		{"IS_CONTROLLED_VEHICLE_UNABLE_TO_GET_TO_ROAD", native_function<LUA_NATIVE_TASK_IS_CONTROLLED_VEHICLE_UNABLE_TO_GET_TO_ROAD>},
+		{"IS_DRIVEBY_TASK_UNDERNEATH_DRIVING_TASK", native_function<LUA_NATIVE_TASK_IS_DRIVEBY_TASK_UNDERNEATH_DRIVING_TASK>},
+		{"IS_MOUNTED_WEAPON_TASK_UNDERNEATH_DRIVING_TASK", native_function<LUA_NATIVE_TASK_IS_MOUNTED_WEAPON_TASK_UNDERNEATH_DRIVING_TASK>},
+		{"IS_MOVE_BLEND_RATIO_RUNNING", native_function<LUA_NATIVE_TASK_IS_MOVE_BLEND_RATIO_RUNNING>},
+		{"IS_MOVE_BLEND_RATIO_SPRINTING", native_function<LUA_NATIVE_TASK_IS_MOVE_BLEND_RATIO_SPRINTING>},
+		{"IS_MOVE_BLEND_RATIO_STILL", native_function<LUA_NATIVE_TASK_IS_MOVE_BLEND_RATIO_STILL>},
+		{"IS_MOVE_BLEND_RATIO_WALKING", native_function<LUA_NATIVE_TASK_IS_MOVE_BLEND_RATIO_WALKING>},
+		{"IS_PED_ACTIVE_IN_SCENARIO", native_function<LUA_NATIVE_TASK_IS_PED_ACTIVE_IN_SCENARIO>},
+		{"IS_PED_BEING_ARRESTED", native_function<LUA_NATIVE_TASK_IS_PED_BEING_ARRESTED>},
+		{"IS_PED_CUFFED", native_function<LUA_NATIVE_TASK_IS_PED_CUFFED>},
+		{"IS_PED_GETTING_UP", native_function<LUA_NATIVE_TASK_IS_PED_GETTING_UP>},
+		{"IS_PED_IN_WRITHE", native_function<LUA_NATIVE_TASK_IS_PED_IN_WRITHE>},
+		{"IS_PED_PLAYING_BASE_CLIP_IN_SCENARIO", native_function<LUA_NATIVE_TASK_IS_PED_PLAYING_BASE_CLIP_IN_SCENARIO>},
+		{"IS_PED_RUNNING", native_function<LUA_NATIVE_TASK_IS_PED_RUNNING>},
+		{"IS_PED_RUNNING_ARREST_TASK", native_function<LUA_NATIVE_TASK_IS_PED_RUNNING_ARREST_TASK>},
+		{"IS_PED_SPRINTING", native_function<LUA_NATIVE_TASK_IS_PED_SPRINTING>},
+		{"IS_PED_STILL", native_function<LUA_NATIVE_TASK_IS_PED_STILL>},
+		{"IS_PED_STRAFING", native_function<LUA_NATIVE_TASK_IS_PED_STRAFING>},
+		{"IS_PED_WALKING", native_function<LUA_NATIVE_TASK_IS_PED_WALKING>},
+		{"IS_PLAYING_PHONE_GESTURE_ANIM", native_function<LUA_NATIVE_TASK_IS_PLAYING_PHONE_GESTURE_ANIM>},
+		{"IS_SCENARIO_GROUP_ENABLED", native_function<LUA_NATIVE_TASK_IS_SCENARIO_GROUP_ENABLED>},
+		{"IS_SCENARIO_OCCUPIED", native_function<LUA_NATIVE_TASK_IS_SCENARIO_OCCUPIED>},
+		{"IS_SCENARIO_TYPE_ENABLED", native_function<LUA_NATIVE_TASK_IS_SCENARIO_TYPE_ENABLED>},
+		{"IS_TASK_MOVE_NETWORK_ACTIVE", native_function<LUA_NATIVE_TASK_IS_TASK_MOVE_NETWORK_ACTIVE>},
+		{"IS_TASK_MOVE_NETWORK_READY_FOR_TRANSITION", native_function<LUA_NATIVE_TASK_IS_TASK_MOVE_NETWORK_READY_FOR_TRANSITION>},
+		{"IS_WAYPOINT_PLAYBACK_GOING_ON_FOR_PED", native_function<LUA_NATIVE_TASK_IS_WAYPOINT_PLAYBACK_GOING_ON_FOR_PED>},
+		{"IS_WAYPOINT_PLAYBACK_GOING_ON_FOR_VEHICLE", native_function<LUA_NATIVE_TASK_IS_WAYPOINT_PLAYBACK_GOING_ON_FOR_VEHICLE>},
+		{"OPEN_PATROL_ROUTE", native_function<LUA_NATIVE_TASK_OPEN_PATROL_ROUTE>},
+		{"OPEN_SEQUENCE_TASK", native_function<LUA_NATIVE_TASK_OPEN_SEQUENCE_TASK>},
+		{"PED_HAS_USE_SCENARIO_TASK", native_function<LUA_NATIVE_TASK_PED_HAS_USE_SCENARIO_TASK>},
+		{"PLAY_ANIM_ON_RUNNING_SCENARIO", native_function<LUA_NATIVE_TASK_PLAY_ANIM_ON_RUNNING_SCENARIO>},
+		{"PLAY_ENTITY_SCRIPTED_ANIM", native_function<LUA_NATIVE_TASK_PLAY_ENTITY_SCRIPTED_ANIM>},
+		{"REMOVE_ALL_COVER_BLOCKING_AREAS", native_function<LUA_NATIVE_TASK_REMOVE_ALL_COVER_BLOCKING_AREAS>},
+		{"REMOVE_COVER_BLOCKING_AREAS_AT_POSITION", native_function<LUA_NATIVE_TASK_REMOVE_COVER_BLOCKING_AREAS_AT_POSITION>},
+		{"REMOVE_COVER_POINT", native_function<LUA_NATIVE_TASK_REMOVE_COVER_POINT>},
+		{"REMOVE_SPECIFIC_COVER_BLOCKING_AREAS", native_function<LUA_NATIVE_TASK_REMOVE_SPECIFIC_COVER_BLOCKING_AREAS>},
+		{"REMOVE_WAYPOINT_RECORDING", native_function<LUA_NATIVE_TASK_REMOVE_WAYPOINT_RECORDING>},
+		{"REQUEST_TASK_MOVE_NETWORK_STATE_TRANSITION", native_function<LUA_NATIVE_TASK_REQUEST_TASK_MOVE_NETWORK_STATE_TRANSITION>},
+		{"REQUEST_WAYPOINT_RECORDING", native_function<LUA_NATIVE_TASK_REQUEST_WAYPOINT_RECORDING>},
+		{"RESET_EXCLUSIVE_SCENARIO_GROUP", native_function<LUA_NATIVE_TASK_RESET_EXCLUSIVE_SCENARIO_GROUP>},
+		{"RESET_SCENARIO_GROUPS_ENABLED", native_function<LUA_NATIVE_TASK_RESET_SCENARIO_GROUPS_ENABLED>},
+		{"RESET_SCENARIO_TYPES_ENABLED", native_function<LUA_NATIVE_TASK_RESET_SCENARIO_TYPES_ENABLED>},
+		{"SET_ANIM_LOOPED", native_function<LUA_NATIVE_TASK_SET_ANIM_LOOPED>},
+		{"SET_ANIM_PHASE", native_function<LUA_NATIVE_TASK_SET_ANIM_PHASE>},
+		{"SET_ANIM_RATE", native_function<LUA_NATIVE_TASK_SET_ANIM_RATE>},
+		{"SET_ANIM_WEIGHT", native_function<LUA_NATIVE_TASK_SET_ANIM_WEIGHT>},
+		{"SET_DRIVEBY_TASK_TARGET", native_function<LUA_NATIVE_TASK_SET_DRIVEBY_TASK_TARGET>},
+		{"SET_DRIVE_TASK_CRUISE_SPEED", native_function<LUA_NATIVE_TASK_SET_DRIVE_TASK_CRUISE_SPEED>},
+		{"SET_DRIVE_TASK_DRIVING_STYLE", native_function<LUA_NATIVE_TASK_SET_DRIVE_TASK_DRIVING_STYLE>},
+		{"SET_DRIVE_TASK_MAX_CRUISE_SPEED", native_function<LUA_NATIVE_TASK_SET_DRIVE_TASK_MAX_CRUISE_SPEED>},
+		{"SET_EXCLUSIVE_SCENARIO_GROUP", native_function<LUA_NATIVE_TASK_SET_EXCLUSIVE_SCENARIO_GROUP>},
+		{"SET_EXPECTED_CLONE_NEXT_TASK_MOVE_NETWORK_STATE", native_function<LUA_NATIVE_TASK_SET_EXPECTED_CLONE_NEXT_TASK_MOVE_NETWORK_STATE>},
+		{"SET_GLOBAL_MIN_BIRD_FLIGHT_HEIGHT", native_function<LUA_NATIVE_TASK_SET_GLOBAL_MIN_BIRD_FLIGHT_HEIGHT>},
+		{"SET_HIGH_FALL_TASK", native_function<LUA_NATIVE_TASK_SET_HIGH_FALL_TASK>},
+		{"SET_MOUNTED_WEAPON_TARGET", native_function<LUA_NATIVE_TASK_SET_MOUNTED_WEAPON_TARGET>},
+		{"SET_NEXT_DESIRED_MOVE_STATE", native_function<LUA_NATIVE_TASK_SET_NEXT_DESIRED_MOVE_STATE>},
+		{"SET_PARACHUTE_TASK_TARGET", native_function<LUA_NATIVE_TASK_SET_PARACHUTE_TASK_TARGET>},
+		{"SET_PARACHUTE_TASK_THRUST", native_function<LUA_NATIVE_TASK_SET_PARACHUTE_TASK_THRUST>},
+		{"SET_PED_CAN_PLAY_AMBIENT_IDLES", native_function<LUA_NATIVE_TASK_SET_PED_CAN_PLAY_AMBIENT_IDLES>},
+		{"SET_PED_DESIRED_MOVE_BLEND_RATIO", native_function<LUA_NATIVE_TASK_SET_PED_DESIRED_MOVE_BLEND_RATIO>},
+		{"SET_PED_PATH_AVOID_FIRE", native_function<LUA_NATIVE_TASK_SET_PED_PATH_AVOID_FIRE>},
+		{"SET_PED_PATH_CAN_DROP_FROM_HEIGHT", native_function<LUA_NATIVE_TASK_SET_PED_PATH_CAN_DROP_FROM_HEIGHT>},
+		{"SET_PED_PATH_CAN_USE_CLIMBOVERS", native_function<LUA_NATIVE_TASK_SET_PED_PATH_CAN_USE_CLIMBOVERS>},
+		{"SET_PED_PATH_CAN_USE_LADDERS", native_function<LUA_NATIVE_TASK_SET_PED_PATH_CAN_USE_LADDERS>},
+		{"SET_PED_PATH_CLIMB_COST_MODIFIER", native_function<LUA_NATIVE_TASK_SET_PED_PATH_CLIMB_COST_MODIFIER>},
+		{"SET_PED_PATH_MAY_ENTER_WATER", native_function<LUA_NATIVE_TASK_SET_PED_PATH_MAY_ENTER_WATER>},
+		{"SET_PED_PATH_PREFER_TO_AVOID_WATER", native_function<LUA_NATIVE_TASK_SET_PED_PATH_PREFER_TO_AVOID_WATER>},
+		{"SET_PED_WAYPOINT_ROUTE_OFFSET", native_function<LUA_NATIVE_TASK_SET_PED_WAYPOINT_ROUTE_OFFSET>},
+		{"SET_SCENARIO_GROUP_ENABLED", native_function<LUA_NATIVE_TASK_SET_SCENARIO_GROUP_ENABLED>},
+		{"SET_SCENARIO_TYPE_ENABLED", native_function<LUA_NATIVE_TASK_SET_SCENARIO_TYPE_ENABLED>},
+		{"SET_SCRIPT_TASK_ENABLE_COLLISION_ON_NETWORK_CLONE_WHEN_FIXED_", native_function<LUA_NATIVE_TASK_SET_SCRIPT_TASK_ENABLE_COLLISION_ON_NETWORK_CLONE_WHEN_FIXED_>},
+		{"SET_SEQUENCE_TO_REPEAT", native_function<LUA_NATIVE_TASK_SET_SEQUENCE_TO_REPEAT>},
+		{"SET_TASK_MOVE_NETWORK_ANIM_SET", native_function<LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_ANIM_SET>},
+		{"SET_TASK_MOVE_NETWORK_ENABLE_COLLISION_ON_NETWORK_CLONE_WHEN_FIXED", native_function<LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_ENABLE_COLLISION_ON_NETWORK_CLONE_WHEN_FIXED>},
+		{"SET_TASK_MOVE_NETWORK_SIGNAL_BOOL", native_function<LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_SIGNAL_BOOL>},
+		{"SET_TASK_MOVE_NETWORK_SIGNAL_FLOAT", native_function<LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_SIGNAL_FLOAT>},
+		{"SET_TASK_MOVE_NETWORK_SIGNAL_FLOAT_LERP_RATE", native_function<LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_SIGNAL_FLOAT_LERP_RATE>},
+		{"SET_TASK_MOVE_NETWORK_SIGNAL_LOCAL_FLOAT", native_function<LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_SIGNAL_LOCAL_FLOAT>},
+		{"SET_TASK_VEHICLE_CHASE_BEHAVIOR_FLAG", native_function<LUA_NATIVE_TASK_SET_TASK_VEHICLE_CHASE_BEHAVIOR_FLAG>},
+		{"SET_TASK_VEHICLE_CHASE_IDEAL_PURSUIT_DISTANCE", native_function<LUA_NATIVE_TASK_SET_TASK_VEHICLE_CHASE_IDEAL_PURSUIT_DISTANCE>},
+		{"STOP_ANIM_PLAYBACK", native_function<LUA_NATIVE_TASK_STOP_ANIM_PLAYBACK>},
+		{"STOP_ANIM_TASK", native_function<LUA_NATIVE_TASK_STOP_ANIM_TASK>},
+		{"TASK_ACHIEVE_HEADING", native_function<LUA_NATIVE_TASK_TASK_ACHIEVE_HEADING>},
+		{"TASK_AGITATED_ACTION_CONFRONT_RESPONSE", native_function<LUA_NATIVE_TASK_TASK_AGITATED_ACTION_CONFRONT_RESPONSE>},
+		{"TASK_AIM_GUN_AT_COORD", native_function<LUA_NATIVE_TASK_TASK_AIM_GUN_AT_COORD>},
+		{"TASK_AIM_GUN_AT_ENTITY", native_function<LUA_NATIVE_TASK_TASK_AIM_GUN_AT_ENTITY>},
+		{"TASK_AIM_GUN_SCRIPTED", native_function<LUA_NATIVE_TASK_TASK_AIM_GUN_SCRIPTED>},
+		{"TASK_AIM_GUN_SCRIPTED_WITH_TARGET", native_function<LUA_NATIVE_TASK_TASK_AIM_GUN_SCRIPTED_WITH_TARGET>},
+		{"TASK_ARREST_PED", native_function<LUA_NATIVE_TASK_TASK_ARREST_PED>},
+		{"TASK_BOAT_MISSION", native_function<LUA_NATIVE_TASK_TASK_BOAT_MISSION>},
+		{"TASK_CHAT_TO_PED", native_function<LUA_NATIVE_TASK_TASK_CHAT_TO_PED>},
+		{"TASK_CLEAR_DEFENSIVE_AREA", native_function<LUA_NATIVE_TASK_TASK_CLEAR_DEFENSIVE_AREA>},
+		{"TASK_CLEAR_LOOK_AT", native_function<LUA_NATIVE_TASK_TASK_CLEAR_LOOK_AT>},
+		{"TASK_CLIMB", native_function<LUA_NATIVE_TASK_TASK_CLIMB>},
+		{"TASK_CLIMB_LADDER", native_function<LUA_NATIVE_TASK_TASK_CLIMB_LADDER>},
+		{"TASK_COMBAT_HATED_TARGETS_AROUND_PED", native_function<LUA_NATIVE_TASK_TASK_COMBAT_HATED_TARGETS_AROUND_PED>},
+		{"TASK_COMBAT_HATED_TARGETS_AROUND_PED_TIMED", native_function<LUA_NATIVE_TASK_TASK_COMBAT_HATED_TARGETS_AROUND_PED_TIMED>},
+		{"TASK_COMBAT_HATED_TARGETS_IN_AREA", native_function<LUA_NATIVE_TASK_TASK_COMBAT_HATED_TARGETS_IN_AREA>},
+		{"TASK_COMBAT_PED", native_function<LUA_NATIVE_TASK_TASK_COMBAT_PED>},
+		{"TASK_COMBAT_PED_TIMED", native_function<LUA_NATIVE_TASK_TASK_COMBAT_PED_TIMED>},
+		{"TASK_COWER", native_function<LUA_NATIVE_TASK_TASK_COWER>},
+		{"TASK_DRIVE_BY", native_function<LUA_NATIVE_TASK_TASK_DRIVE_BY>},
+		{"TASK_ENTER_VEHICLE", native_function<LUA_NATIVE_TASK_TASK_ENTER_VEHICLE>},
+		{"TASK_EVERYONE_LEAVE_VEHICLE", native_function<LUA_NATIVE_TASK_TASK_EVERYONE_LEAVE_VEHICLE>},
+		{"TASK_EXIT_COVER", native_function<LUA_NATIVE_TASK_TASK_EXIT_COVER>},
+		{"TASK_EXTEND_ROUTE", native_function<LUA_NATIVE_TASK_TASK_EXTEND_ROUTE>},
+		{"TASK_FLUSH_ROUTE", native_function<LUA_NATIVE_TASK_TASK_FLUSH_ROUTE>},
+		{"TASK_FOLLOW_NAV_MESH_TO_COORD", native_function<LUA_NATIVE_TASK_TASK_FOLLOW_NAV_MESH_TO_COORD>},
+		{"TASK_FOLLOW_NAV_MESH_TO_COORD_ADVANCED", native_function<LUA_NATIVE_TASK_TASK_FOLLOW_NAV_MESH_TO_COORD_ADVANCED>},
+		{"TASK_FOLLOW_POINT_ROUTE", native_function<LUA_NATIVE_TASK_TASK_FOLLOW_POINT_ROUTE>},
+		{"TASK_FOLLOW_TO_OFFSET_OF_ENTITY", native_function<LUA_NATIVE_TASK_TASK_FOLLOW_TO_OFFSET_OF_ENTITY>},
+		{"TASK_FOLLOW_WAYPOINT_RECORDING", native_function<LUA_NATIVE_TASK_TASK_FOLLOW_WAYPOINT_RECORDING>},
+		{"TASK_FORCE_MOTION_STATE", native_function<LUA_NATIVE_TASK_TASK_FORCE_MOTION_STATE>},
+		{"TASK_GET_OFF_BOAT", native_function<LUA_NATIVE_TASK_TASK_GET_OFF_BOAT>},
+		{"TASK_GOTO_ENTITY_AIMING", native_function<LUA_NATIVE_TASK_TASK_GOTO_ENTITY_AIMING>},
+		{"TASK_GOTO_ENTITY_OFFSET", native_function<LUA_NATIVE_TASK_TASK_GOTO_ENTITY_OFFSET>},
+		{"TASK_GOTO_ENTITY_OFFSET_XY", native_function<LUA_NATIVE_TASK_TASK_GOTO_ENTITY_OFFSET_XY>},
+		{"TASK_GO_STRAIGHT_TO_COORD", native_function<LUA_NATIVE_TASK_TASK_GO_STRAIGHT_TO_COORD>},
+		{"TASK_GO_STRAIGHT_TO_COORD_RELATIVE_TO_ENTITY", native_function<LUA_NATIVE_TASK_TASK_GO_STRAIGHT_TO_COORD_RELATIVE_TO_ENTITY>},
+		{"TASK_GO_TO_COORD_AND_AIM_AT_HATED_ENTITIES_NEAR_COORD", native_function<LUA_NATIVE_TASK_TASK_GO_TO_COORD_AND_AIM_AT_HATED_ENTITIES_NEAR_COORD>},
+		{"TASK_GO_TO_COORD_ANY_MEANS", native_function<LUA_NATIVE_TASK_TASK_GO_TO_COORD_ANY_MEANS>},
+		{"TASK_GO_TO_COORD_ANY_MEANS_EXTRA_PARAMS", native_function<LUA_NATIVE_TASK_TASK_GO_TO_COORD_ANY_MEANS_EXTRA_PARAMS>},
+		{"TASK_GO_TO_COORD_ANY_MEANS_EXTRA_PARAMS_WITH_CRUISE_SPEED", native_function<LUA_NATIVE_TASK_TASK_GO_TO_COORD_ANY_MEANS_EXTRA_PARAMS_WITH_CRUISE_SPEED>},
+		{"TASK_GO_TO_COORD_WHILE_AIMING_AT_COORD", native_function<LUA_NATIVE_TASK_TASK_GO_TO_COORD_WHILE_AIMING_AT_COORD>},
+		{"TASK_GO_TO_COORD_WHILE_AIMING_AT_ENTITY", native_function<LUA_NATIVE_TASK_TASK_GO_TO_COORD_WHILE_AIMING_AT_ENTITY>},
+		{"TASK_GO_TO_ENTITY", native_function<LUA_NATIVE_TASK_TASK_GO_TO_ENTITY>},
+		{"TASK_GO_TO_ENTITY_WHILE_AIMING_AT_COORD", native_function<LUA_NATIVE_TASK_TASK_GO_TO_ENTITY_WHILE_AIMING_AT_COORD>},
+		{"TASK_GO_TO_ENTITY_WHILE_AIMING_AT_ENTITY", native_function<LUA_NATIVE_TASK_TASK_GO_TO_ENTITY_WHILE_AIMING_AT_ENTITY>},
+		{"TASK_GUARD_ASSIGNED_DEFENSIVE_AREA", native_function<LUA_NATIVE_TASK_TASK_GUARD_ASSIGNED_DEFENSIVE_AREA>},
+		{"TASK_GUARD_CURRENT_POSITION", native_function<LUA_NATIVE_TASK_TASK_GUARD_CURRENT_POSITION>},
+		{"TASK_GUARD_SPHERE_DEFENSIVE_AREA", native_function<LUA_NATIVE_TASK_TASK_GUARD_SPHERE_DEFENSIVE_AREA>},
+		{"TASK_HANDS_UP", native_function<LUA_NATIVE_TASK_TASK_HANDS_UP>},
+		{"TASK_HELI_CHASE", native_function<LUA_NATIVE_TASK_TASK_HELI_CHASE>},
+		{"TASK_HELI_ESCORT_HELI", native_function<LUA_NATIVE_TASK_TASK_HELI_ESCORT_HELI>},
+		{"TASK_HELI_MISSION", native_function<LUA_NATIVE_TASK_TASK_HELI_MISSION>},
+		{"TASK_JUMP", native_function<LUA_NATIVE_TASK_TASK_JUMP>},
+		{"TASK_LEAVE_ANY_VEHICLE", native_function<LUA_NATIVE_TASK_TASK_LEAVE_ANY_VEHICLE>},
+		{"TASK_LEAVE_VEHICLE", native_function<LUA_NATIVE_TASK_TASK_LEAVE_VEHICLE>},
+		{"TASK_LOOK_AT_COORD", native_function<LUA_NATIVE_TASK_TASK_LOOK_AT_COORD>},
+		{"TASK_LOOK_AT_ENTITY", native_function<LUA_NATIVE_TASK_TASK_LOOK_AT_ENTITY>},
+		{"TASK_MOVE_NETWORK_ADVANCED_BY_NAME", native_function<LUA_NATIVE_TASK_TASK_MOVE_NETWORK_ADVANCED_BY_NAME>},
+		{"TASK_MOVE_NETWORK_ADVANCED_BY_NAME_WITH_INIT_PARAMS", native_function<LUA_NATIVE_TASK_TASK_MOVE_NETWORK_ADVANCED_BY_NAME_WITH_INIT_PARAMS>},
+		{"TASK_MOVE_NETWORK_BY_NAME", native_function<LUA_NATIVE_TASK_TASK_MOVE_NETWORK_BY_NAME>},
+		{"TASK_MOVE_NETWORK_BY_NAME_WITH_INIT_PARAMS", native_function<LUA_NATIVE_TASK_TASK_MOVE_NETWORK_BY_NAME_WITH_INIT_PARAMS>},
+		{"TASK_OPEN_VEHICLE_DOOR", native_function<LUA_NATIVE_TASK_TASK_OPEN_VEHICLE_DOOR>},
+		{"TASK_PARACHUTE", native_function<LUA_NATIVE_TASK_TASK_PARACHUTE>},
+		{"TASK_PARACHUTE_TO_TARGET", native_function<LUA_NATIVE_TASK_TASK_PARACHUTE_TO_TARGET>},
+		{"TASK_PATROL", native_function<LUA_NATIVE_TASK_TASK_PATROL>},
+		{"TASK_PAUSE", native_function<LUA_NATIVE_TASK_TASK_PAUSE>},
+		{"TASK_PED_SLIDE_TO_COORD", native_function<LUA_NATIVE_TASK_TASK_PED_SLIDE_TO_COORD>},
+		{"TASK_PED_SLIDE_TO_COORD_HDG_RATE", native_function<LUA_NATIVE_TASK_TASK_PED_SLIDE_TO_COORD_HDG_RATE>},
+		{"TASK_PERFORM_SEQUENCE", native_function<LUA_NATIVE_TASK_TASK_PERFORM_SEQUENCE>},
+		{"TASK_PERFORM_SEQUENCE_FROM_PROGRESS", native_function<LUA_NATIVE_TASK_TASK_PERFORM_SEQUENCE_FROM_PROGRESS>},
+		{"TASK_PERFORM_SEQUENCE_LOCALLY", native_function<LUA_NATIVE_TASK_TASK_PERFORM_SEQUENCE_LOCALLY>},
+		{"TASK_PLANE_CHASE", native_function<LUA_NATIVE_TASK_TASK_PLANE_CHASE>},
+		{"TASK_PLANE_GOTO_PRECISE_VTOL", native_function<LUA_NATIVE_TASK_TASK_PLANE_GOTO_PRECISE_VTOL>},
+		{"TASK_PLANE_LAND", native_function<LUA_NATIVE_TASK_TASK_PLANE_LAND>},
+		{"TASK_PLANE_MISSION", native_function<LUA_NATIVE_TASK_TASK_PLANE_MISSION>},
+		{"TASK_PLANE_TAXI", native_function<LUA_NATIVE_TASK_TASK_PLANE_TAXI>},
+		{"TASK_PLANT_BOMB", native_function<LUA_NATIVE_TASK_TASK_PLANT_BOMB>},
+		{"TASK_PLAY_ANIM", native_function<LUA_NATIVE_TASK_TASK_PLAY_ANIM>},
+		{"TASK_PLAY_ANIM_ADVANCED", native_function<LUA_NATIVE_TASK_TASK_PLAY_ANIM_ADVANCED>},
+		{"TASK_PLAY_PHONE_GESTURE_ANIMATION", native_function<LUA_NATIVE_TASK_TASK_PLAY_PHONE_GESTURE_ANIMATION>},
+		{"TASK_PUT_PED_DIRECTLY_INTO_COVER", native_function<LUA_NATIVE_TASK_TASK_PUT_PED_DIRECTLY_INTO_COVER>},
+		{"TASK_PUT_PED_DIRECTLY_INTO_MELEE", native_function<LUA_NATIVE_TASK_TASK_PUT_PED_DIRECTLY_INTO_MELEE>},
+		{"TASK_RAPPEL_DOWN_WALL_USING_CLIPSET_OVERRIDE", native_function<LUA_NATIVE_TASK_TASK_RAPPEL_DOWN_WALL_USING_CLIPSET_OVERRIDE>},
+		{"TASK_RAPPEL_FROM_HELI", native_function<LUA_NATIVE_TASK_TASK_RAPPEL_FROM_HELI>},
+		{"TASK_REACT_AND_FLEE_PED", native_function<LUA_NATIVE_TASK_TASK_REACT_AND_FLEE_PED>},
+		{"TASK_RELOAD_WEAPON", native_function<LUA_NATIVE_TASK_TASK_RELOAD_WEAPON>},
+		{"TASK_SCRIPTED_ANIMATION", native_function<LUA_NATIVE_TASK_TASK_SCRIPTED_ANIMATION>},
+		{"TASK_SEEK_COVER_FROM_PED", native_function<LUA_NATIVE_TASK_TASK_SEEK_COVER_FROM_PED>},
+		{"TASK_SEEK_COVER_FROM_POS", native_function<LUA_NATIVE_TASK_TASK_SEEK_COVER_FROM_POS>},
+		{"TASK_SEEK_COVER_TO_COORDS", native_function<LUA_NATIVE_TASK_TASK_SEEK_COVER_TO_COORDS>},
+		{"TASK_SEEK_COVER_TO_COVER_POINT", native_function<LUA_NATIVE_TASK_TASK_SEEK_COVER_TO_COVER_POINT>},
+		{"TASK_SET_BLOCKING_OF_NON_TEMPORARY_EVENTS", native_function<LUA_NATIVE_TASK_TASK_SET_BLOCKING_OF_NON_TEMPORARY_EVENTS>},
+		{"TASK_SET_DECISION_MAKER", native_function<LUA_NATIVE_TASK_TASK_SET_DECISION_MAKER>},
+		{"TASK_SET_SPHERE_DEFENSIVE_AREA", native_function<LUA_NATIVE_TASK_TASK_SET_SPHERE_DEFENSIVE_AREA>},
+		{"TASK_SHOCKING_EVENT_REACT", native_function<LUA_NATIVE_TASK_TASK_SHOCKING_EVENT_REACT>},
+		{"TASK_SHOOT_AT_COORD", native_function<LUA_NATIVE_TASK_TASK_SHOOT_AT_COORD>},
+		{"TASK_SHOOT_AT_ENTITY", native_function<LUA_NATIVE_TASK_TASK_SHOOT_AT_ENTITY>},
+		{"TASK_SHUFFLE_TO_NEXT_VEHICLE_SEAT", native_function<LUA_NATIVE_TASK_TASK_SHUFFLE_TO_NEXT_VEHICLE_SEAT>},
+		{"TASK_SKY_DIVE", native_function<LUA_NATIVE_TASK_TASK_SKY_DIVE>},
+		{"TASK_SMART_FLEE_COORD", native_function<LUA_NATIVE_TASK_TASK_SMART_FLEE_COORD>},
+		{"TASK_SMART_FLEE_PED", native_function<LUA_NATIVE_TASK_TASK_SMART_FLEE_PED>},
+		{"TASK_STAND_GUARD", native_function<LUA_NATIVE_TASK_TASK_STAND_GUARD>},
+		{"TASK_STAND_STILL", native_function<LUA_NATIVE_TASK_TASK_STAND_STILL>},
+		{"TASK_START_SCENARIO_AT_POSITION", native_function<LUA_NATIVE_TASK_TASK_START_SCENARIO_AT_POSITION>},
+		{"TASK_START_SCENARIO_IN_PLACE", native_function<LUA_NATIVE_TASK_TASK_START_SCENARIO_IN_PLACE>},
+		{"TASK_STAY_IN_COVER", native_function<LUA_NATIVE_TASK_TASK_STAY_IN_COVER>},
+		{"TASK_STEALTH_KILL", native_function<LUA_NATIVE_TASK_TASK_STEALTH_KILL>},
+		{"TASK_STOP_PHONE_GESTURE_ANIMATION", native_function<LUA_NATIVE_TASK_TASK_STOP_PHONE_GESTURE_ANIMATION>},
+		{"TASK_SUBMARINE_GOTO_AND_STOP", native_function<LUA_NATIVE_TASK_TASK_SUBMARINE_GOTO_AND_STOP>},
+		{"TASK_SWAP_WEAPON", native_function<LUA_NATIVE_TASK_TASK_SWAP_WEAPON>},
+		{"TASK_SWEEP_AIM_ENTITY", native_function<LUA_NATIVE_TASK_TASK_SWEEP_AIM_ENTITY>},
+		{"TASK_SWEEP_AIM_POSITION", native_function<LUA_NATIVE_TASK_TASK_SWEEP_AIM_POSITION>},
+		{"TASK_SYNCHRONIZED_SCENE", native_function<LUA_NATIVE_TASK_TASK_SYNCHRONIZED_SCENE>},
+		{"TASK_THROW_PROJECTILE", native_function<LUA_NATIVE_TASK_TASK_THROW_PROJECTILE>},
+		{"TASK_TOGGLE_DUCK", native_function<LUA_NATIVE_TASK_TASK_TOGGLE_DUCK>},
+		{"TASK_TURN_PED_TO_FACE_COORD", native_function<LUA_NATIVE_TASK_TASK_TURN_PED_TO_FACE_COORD>},
+		{"TASK_TURN_PED_TO_FACE_ENTITY", native_function<LUA_NATIVE_TASK_TASK_TURN_PED_TO_FACE_ENTITY>},
+		{"TASK_USE_MOBILE_PHONE", native_function<LUA_NATIVE_TASK_TASK_USE_MOBILE_PHONE>},
+		{"TASK_USE_MOBILE_PHONE_TIMED", native_function<LUA_NATIVE_TASK_TASK_USE_MOBILE_PHONE_TIMED>},
+		{"TASK_USE_NEAREST_SCENARIO_CHAIN_TO_COORD", native_function<LUA_NATIVE_TASK_TASK_USE_NEAREST_SCENARIO_CHAIN_TO_COORD>},
+		{"TASK_USE_NEAREST_SCENARIO_CHAIN_TO_COORD_WARP", native_function<LUA_NATIVE_TASK_TASK_USE_NEAREST_SCENARIO_CHAIN_TO_COORD_WARP>},
+		{"TASK_USE_NEAREST_SCENARIO_TO_COORD", native_function<LUA_NATIVE_TASK_TASK_USE_NEAREST_SCENARIO_TO_COORD>},
+		{"TASK_USE_NEAREST_SCENARIO_TO_COORD_WARP", native_function<LUA_NATIVE_TASK_TASK_USE_NEAREST_SCENARIO_TO_COORD_WARP>},
+		{"TASK_VEHICLE_AIM_AT_COORD", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_AIM_AT_COORD>},
+		{"TASK_VEHICLE_AIM_AT_PED", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_AIM_AT_PED>},
+		{"TASK_VEHICLE_CHASE", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_CHASE>},
+		{"TASK_VEHICLE_DRIVE_TO_COORD", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_DRIVE_TO_COORD>},
+		{"TASK_VEHICLE_DRIVE_TO_COORD_LONGRANGE", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_DRIVE_TO_COORD_LONGRANGE>},
+		{"TASK_VEHICLE_DRIVE_WANDER", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_DRIVE_WANDER>},
+		{"TASK_VEHICLE_ESCORT", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_ESCORT>},
+		{"TASK_VEHICLE_FOLLOW", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_FOLLOW>},
+		{"TASK_VEHICLE_FOLLOW_WAYPOINT_RECORDING", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_FOLLOW_WAYPOINT_RECORDING>},
+		{"TASK_VEHICLE_GOTO_NAVMESH", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_GOTO_NAVMESH>},
+		{"TASK_VEHICLE_HELI_PROTECT", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_HELI_PROTECT>},
+		{"TASK_VEHICLE_MISSION", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_MISSION>},
+		{"TASK_VEHICLE_MISSION_COORS_TARGET", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_MISSION_COORS_TARGET>},
+		{"TASK_VEHICLE_MISSION_PED_TARGET", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_MISSION_PED_TARGET>},
+		{"TASK_VEHICLE_PARK", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_PARK>},
+		{"TASK_VEHICLE_PLAY_ANIM", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_PLAY_ANIM>},
+		{"TASK_VEHICLE_SHOOT_AT_COORD", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_SHOOT_AT_COORD>},
+		{"TASK_VEHICLE_SHOOT_AT_PED", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_SHOOT_AT_PED>},
+		{"TASK_VEHICLE_TEMP_ACTION", native_function<LUA_NATIVE_TASK_TASK_VEHICLE_TEMP_ACTION>},
+		{"TASK_WANDER_IN_AREA", native_function<LUA_NATIVE_TASK_TASK_WANDER_IN_AREA>},
+		{"TASK_WANDER_SPECIFIC", native_function<LUA_NATIVE_TASK_TASK_WANDER_SPECIFIC>},
+		{"TASK_WANDER_STANDARD", native_function<LUA_NATIVE_TASK_TASK_WANDER_STANDARD>},
+		{"TASK_WARP_PED_DIRECTLY_INTO_COVER", native_function<LUA_NATIVE_TASK_TASK_WARP_PED_DIRECTLY_INTO_COVER>},
+		{"TASK_WARP_PED_INTO_VEHICLE", native_function<LUA_NATIVE_TASK_TASK_WARP_PED_INTO_VEHICLE>},
+		{"TASK_WRITHE", native_function<LUA_NATIVE_TASK_TASK_WRITHE>},
+		{"UNCUFF_PED", native_function<LUA_NATIVE_TASK_UNCUFF_PED>},
+		{"UPDATE_TASK_AIM_GUN_SCRIPTED_TARGET", native_function<LUA_NATIVE_TASK_UPDATE_TASK_AIM_GUN_SCRIPTED_TARGET>},
+		{"UPDATE_TASK_HANDS_UP_DURATION", native_function<LUA_NATIVE_TASK_UPDATE_TASK_HANDS_UP_DURATION>},
+		{"UPDATE_TASK_SWEEP_AIM_ENTITY", native_function<LUA_NATIVE_TASK_UPDATE_TASK_SWEEP_AIM_ENTITY>},
+		{"UPDATE_TASK_SWEEP_AIM_POSITION", native_function<LUA_NATIVE_TASK_UPDATE_TASK_SWEEP_AIM_POSITION>},
+		{"USE_WAYPOINT_RECORDING_AS_ASSISTED_MOVEMENT_ROUTE", native_function<LUA_NATIVE_TASK_USE_WAYPOINT_RECORDING_AS_ASSISTED_MOVEMENT_ROUTE>},
+		{"VEHICLE_WAYPOINT_PLAYBACK_OVERRIDE_SPEED", native_function<LUA_NATIVE_TASK_VEHICLE_WAYPOINT_PLAYBACK_OVERRIDE_SPEED>},
+		{"VEHICLE_WAYPOINT_PLAYBACK_PAUSE", native_function<LUA_NATIVE_TASK_VEHICLE_WAYPOINT_PLAYBACK_PAUSE>},
+		{"VEHICLE_WAYPOINT_PLAYBACK_RESUME", native_function<LUA_NATIVE_TASK_VEHICLE_WAYPOINT_PLAYBACK_RESUME>},
+		{"VEHICLE_WAYPOINT_PLAYBACK_USE_DEFAULT_SPEED", native_function<LUA_NATIVE_TASK_VEHICLE_WAYPOINT_PLAYBACK_USE_DEFAULT_SPEED>},
+		{"WAYPOINT_PLAYBACK_GET_IS_PAUSED", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_GET_IS_PAUSED>},
+		{"WAYPOINT_PLAYBACK_OVERRIDE_SPEED", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_OVERRIDE_SPEED>},
+		{"WAYPOINT_PLAYBACK_PAUSE", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_PAUSE>},
+		{"WAYPOINT_PLAYBACK_RESUME", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_RESUME>},
+		{"WAYPOINT_PLAYBACK_START_AIMING_AT_COORD", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_START_AIMING_AT_COORD>},
+		{"WAYPOINT_PLAYBACK_START_AIMING_AT_PED", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_START_AIMING_AT_PED>},
+		{"WAYPOINT_PLAYBACK_START_SHOOTING_AT_COORD", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_START_SHOOTING_AT_COORD>},
+		{"WAYPOINT_PLAYBACK_START_SHOOTING_AT_PED", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_START_SHOOTING_AT_PED>},
+		{"WAYPOINT_PLAYBACK_STOP_AIMING_OR_SHOOTING", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_STOP_AIMING_OR_SHOOTING>},
+		{"WAYPOINT_PLAYBACK_USE_DEFAULT_SPEED", native_function<LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_USE_DEFAULT_SPEED>},
+		{"WAYPOINT_RECORDING_GET_CLOSEST_WAYPOINT", native_function<LUA_NATIVE_TASK_WAYPOINT_RECORDING_GET_CLOSEST_WAYPOINT>},
+		{"WAYPOINT_RECORDING_GET_COORD", native_function<LUA_NATIVE_TASK_WAYPOINT_RECORDING_GET_COORD>},
+		{"WAYPOINT_RECORDING_GET_NUM_POINTS", native_function<LUA_NATIVE_TASK_WAYPOINT_RECORDING_GET_NUM_POINTS>},
+		{"WAYPOINT_RECORDING_GET_SPEED_AT_POINT", native_function<LUA_NATIVE_TASK_WAYPOINT_RECORDING_GET_SPEED_AT_POINT>},
+	};
+
 	void init_native_binding_TASK(sol::state& L)
 	{
-		auto TASK = L["TASK"].get_or_create<sol::table>();
-		TASK.set_function("TASK_PAUSE", LUA_NATIVE_TASK_TASK_PAUSE);
-		TASK.set_function("TASK_STAND_STILL", LUA_NATIVE_TASK_TASK_STAND_STILL);
-		TASK.set_function("TASK_JUMP", LUA_NATIVE_TASK_TASK_JUMP);
-		TASK.set_function("TASK_COWER", LUA_NATIVE_TASK_TASK_COWER);
-		TASK.set_function("TASK_HANDS_UP", LUA_NATIVE_TASK_TASK_HANDS_UP);
-		TASK.set_function("UPDATE_TASK_HANDS_UP_DURATION", LUA_NATIVE_TASK_UPDATE_TASK_HANDS_UP_DURATION);
-		TASK.set_function("TASK_OPEN_VEHICLE_DOOR", LUA_NATIVE_TASK_TASK_OPEN_VEHICLE_DOOR);
-		TASK.set_function("TASK_ENTER_VEHICLE", LUA_NATIVE_TASK_TASK_ENTER_VEHICLE);
-		TASK.set_function("TASK_LEAVE_VEHICLE", LUA_NATIVE_TASK_TASK_LEAVE_VEHICLE);
-		TASK.set_function("TASK_GET_OFF_BOAT", LUA_NATIVE_TASK_TASK_GET_OFF_BOAT);
-		TASK.set_function("TASK_SKY_DIVE", LUA_NATIVE_TASK_TASK_SKY_DIVE);
-		TASK.set_function("TASK_PARACHUTE", LUA_NATIVE_TASK_TASK_PARACHUTE);
-		TASK.set_function("TASK_PARACHUTE_TO_TARGET", LUA_NATIVE_TASK_TASK_PARACHUTE_TO_TARGET);
-		TASK.set_function("SET_PARACHUTE_TASK_TARGET", LUA_NATIVE_TASK_SET_PARACHUTE_TASK_TARGET);
-		TASK.set_function("SET_PARACHUTE_TASK_THRUST", LUA_NATIVE_TASK_SET_PARACHUTE_TASK_THRUST);
-		TASK.set_function("TASK_RAPPEL_FROM_HELI", LUA_NATIVE_TASK_TASK_RAPPEL_FROM_HELI);
-		TASK.set_function("TASK_VEHICLE_DRIVE_TO_COORD", LUA_NATIVE_TASK_TASK_VEHICLE_DRIVE_TO_COORD);
-		TASK.set_function("TASK_VEHICLE_DRIVE_TO_COORD_LONGRANGE", LUA_NATIVE_TASK_TASK_VEHICLE_DRIVE_TO_COORD_LONGRANGE);
-		TASK.set_function("TASK_VEHICLE_DRIVE_WANDER", LUA_NATIVE_TASK_TASK_VEHICLE_DRIVE_WANDER);
-		TASK.set_function("TASK_FOLLOW_TO_OFFSET_OF_ENTITY", LUA_NATIVE_TASK_TASK_FOLLOW_TO_OFFSET_OF_ENTITY);
-		TASK.set_function("TASK_GO_STRAIGHT_TO_COORD", LUA_NATIVE_TASK_TASK_GO_STRAIGHT_TO_COORD);
-		TASK.set_function("TASK_GO_STRAIGHT_TO_COORD_RELATIVE_TO_ENTITY", LUA_NATIVE_TASK_TASK_GO_STRAIGHT_TO_COORD_RELATIVE_TO_ENTITY);
-		TASK.set_function("TASK_ACHIEVE_HEADING", LUA_NATIVE_TASK_TASK_ACHIEVE_HEADING);
-		TASK.set_function("TASK_FLUSH_ROUTE", LUA_NATIVE_TASK_TASK_FLUSH_ROUTE);
-		TASK.set_function("TASK_EXTEND_ROUTE", LUA_NATIVE_TASK_TASK_EXTEND_ROUTE);
-		TASK.set_function("TASK_FOLLOW_POINT_ROUTE", LUA_NATIVE_TASK_TASK_FOLLOW_POINT_ROUTE);
-		TASK.set_function("TASK_GO_TO_ENTITY", LUA_NATIVE_TASK_TASK_GO_TO_ENTITY);
-		TASK.set_function("TASK_SMART_FLEE_COORD", LUA_NATIVE_TASK_TASK_SMART_FLEE_COORD);
-		TASK.set_function("TASK_SMART_FLEE_PED", LUA_NATIVE_TASK_TASK_SMART_FLEE_PED);
-		TASK.set_function("TASK_REACT_AND_FLEE_PED", LUA_NATIVE_TASK_TASK_REACT_AND_FLEE_PED);
-		TASK.set_function("TASK_SHOCKING_EVENT_REACT", LUA_NATIVE_TASK_TASK_SHOCKING_EVENT_REACT);
-		TASK.set_function("TASK_WANDER_IN_AREA", LUA_NATIVE_TASK_TASK_WANDER_IN_AREA);
-		TASK.set_function("TASK_WANDER_STANDARD", LUA_NATIVE_TASK_TASK_WANDER_STANDARD);
-		TASK.set_function("TASK_WANDER_SPECIFIC", LUA_NATIVE_TASK_TASK_WANDER_SPECIFIC);
-		TASK.set_function("TASK_VEHICLE_PARK", LUA_NATIVE_TASK_TASK_VEHICLE_PARK);
-		TASK.set_function("TASK_STEALTH_KILL", LUA_NATIVE_TASK_TASK_STEALTH_KILL);
-		TASK.set_function("TASK_PLANT_BOMB", LUA_NATIVE_TASK_TASK_PLANT_BOMB);
-		TASK.set_function("TASK_FOLLOW_NAV_MESH_TO_COORD", LUA_NATIVE_TASK_TASK_FOLLOW_NAV_MESH_TO_COORD);
-		TASK.set_function("TASK_FOLLOW_NAV_MESH_TO_COORD_ADVANCED", LUA_NATIVE_TASK_TASK_FOLLOW_NAV_MESH_TO_COORD_ADVANCED);
-		TASK.set_function("SET_PED_PATH_CAN_USE_CLIMBOVERS", LUA_NATIVE_TASK_SET_PED_PATH_CAN_USE_CLIMBOVERS);
-		TASK.set_function("SET_PED_PATH_CAN_USE_LADDERS", LUA_NATIVE_TASK_SET_PED_PATH_CAN_USE_LADDERS);
-		TASK.set_function("SET_PED_PATH_CAN_DROP_FROM_HEIGHT", LUA_NATIVE_TASK_SET_PED_PATH_CAN_DROP_FROM_HEIGHT);
-		TASK.set_function("SET_PED_PATH_CLIMB_COST_MODIFIER", LUA_NATIVE_TASK_SET_PED_PATH_CLIMB_COST_MODIFIER);
-		TASK.set_function("SET_PED_PATH_MAY_ENTER_WATER", LUA_NATIVE_TASK_SET_PED_PATH_MAY_ENTER_WATER);
-		TASK.set_function("SET_PED_PATH_PREFER_TO_AVOID_WATER", LUA_NATIVE_TASK_SET_PED_PATH_PREFER_TO_AVOID_WATER);
-		TASK.set_function("SET_PED_PATH_AVOID_FIRE", LUA_NATIVE_TASK_SET_PED_PATH_AVOID_FIRE);
-		TASK.set_function("SET_GLOBAL_MIN_BIRD_FLIGHT_HEIGHT", LUA_NATIVE_TASK_SET_GLOBAL_MIN_BIRD_FLIGHT_HEIGHT);
-		TASK.set_function("GET_NAVMESH_ROUTE_DISTANCE_REMAINING", LUA_NATIVE_TASK_GET_NAVMESH_ROUTE_DISTANCE_REMAINING);
-		TASK.set_function("GET_NAVMESH_ROUTE_RESULT", LUA_NATIVE_TASK_GET_NAVMESH_ROUTE_RESULT);
-		TASK.set_function("IS_CONTROLLED_VEHICLE_UNABLE_TO_GET_TO_ROAD", LUA_NATIVE_TASK_IS_CONTROLLED_VEHICLE_UNABLE_TO_GET_TO_ROAD);
-		TASK.set_function("TASK_GO_TO_COORD_ANY_MEANS", LUA_NATIVE_TASK_TASK_GO_TO_COORD_ANY_MEANS);
-		TASK.set_function("TASK_GO_TO_COORD_ANY_MEANS_EXTRA_PARAMS", LUA_NATIVE_TASK_TASK_GO_TO_COORD_ANY_MEANS_EXTRA_PARAMS);
-		TASK.set_function("TASK_GO_TO_COORD_ANY_MEANS_EXTRA_PARAMS_WITH_CRUISE_SPEED", LUA_NATIVE_TASK_TASK_GO_TO_COORD_ANY_MEANS_EXTRA_PARAMS_WITH_CRUISE_SPEED);
-		TASK.set_function("TASK_PLAY_ANIM", LUA_NATIVE_TASK_TASK_PLAY_ANIM);
-		TASK.set_function("TASK_PLAY_ANIM_ADVANCED", LUA_NATIVE_TASK_TASK_PLAY_ANIM_ADVANCED);
-		TASK.set_function("STOP_ANIM_TASK", LUA_NATIVE_TASK_STOP_ANIM_TASK);
-		TASK.set_function("TASK_SCRIPTED_ANIMATION", LUA_NATIVE_TASK_TASK_SCRIPTED_ANIMATION);
-		TASK.set_function("PLAY_ENTITY_SCRIPTED_ANIM", LUA_NATIVE_TASK_PLAY_ENTITY_SCRIPTED_ANIM);
-		TASK.set_function("STOP_ANIM_PLAYBACK", LUA_NATIVE_TASK_STOP_ANIM_PLAYBACK);
-		TASK.set_function("SET_ANIM_WEIGHT", LUA_NATIVE_TASK_SET_ANIM_WEIGHT);
-		TASK.set_function("SET_ANIM_PHASE", LUA_NATIVE_TASK_SET_ANIM_PHASE);
-		TASK.set_function("SET_ANIM_RATE", LUA_NATIVE_TASK_SET_ANIM_RATE);
-		TASK.set_function("SET_ANIM_LOOPED", LUA_NATIVE_TASK_SET_ANIM_LOOPED);
-		TASK.set_function("TASK_PLAY_PHONE_GESTURE_ANIMATION", LUA_NATIVE_TASK_TASK_PLAY_PHONE_GESTURE_ANIMATION);
-		TASK.set_function("TASK_STOP_PHONE_GESTURE_ANIMATION", LUA_NATIVE_TASK_TASK_STOP_PHONE_GESTURE_ANIMATION);
-		TASK.set_function("IS_PLAYING_PHONE_GESTURE_ANIM", LUA_NATIVE_TASK_IS_PLAYING_PHONE_GESTURE_ANIM);
-		TASK.set_function("GET_PHONE_GESTURE_ANIM_CURRENT_TIME", LUA_NATIVE_TASK_GET_PHONE_GESTURE_ANIM_CURRENT_TIME);
-		TASK.set_function("GET_PHONE_GESTURE_ANIM_TOTAL_TIME", LUA_NATIVE_TASK_GET_PHONE_GESTURE_ANIM_TOTAL_TIME);
-		TASK.set_function("TASK_VEHICLE_PLAY_ANIM", LUA_NATIVE_TASK_TASK_VEHICLE_PLAY_ANIM);
-		TASK.set_function("TASK_LOOK_AT_COORD", LUA_NATIVE_TASK_TASK_LOOK_AT_COORD);
-		TASK.set_function("TASK_LOOK_AT_ENTITY", LUA_NATIVE_TASK_TASK_LOOK_AT_ENTITY);
-		TASK.set_function("TASK_CLEAR_LOOK_AT", LUA_NATIVE_TASK_TASK_CLEAR_LOOK_AT);
-		TASK.set_function("OPEN_SEQUENCE_TASK", LUA_NATIVE_TASK_OPEN_SEQUENCE_TASK);
-		TASK.set_function("CLOSE_SEQUENCE_TASK", LUA_NATIVE_TASK_CLOSE_SEQUENCE_TASK);
-		TASK.set_function("TASK_PERFORM_SEQUENCE", LUA_NATIVE_TASK_TASK_PERFORM_SEQUENCE);
-		TASK.set_function("TASK_PERFORM_SEQUENCE_LOCALLY", LUA_NATIVE_TASK_TASK_PERFORM_SEQUENCE_LOCALLY);
-		TASK.set_function("CLEAR_SEQUENCE_TASK", LUA_NATIVE_TASK_CLEAR_SEQUENCE_TASK);
-		TASK.set_function("SET_SEQUENCE_TO_REPEAT", LUA_NATIVE_TASK_SET_SEQUENCE_TO_REPEAT);
-		TASK.set_function("GET_SEQUENCE_PROGRESS", LUA_NATIVE_TASK_GET_SEQUENCE_PROGRESS);
-		TASK.set_function("GET_IS_TASK_ACTIVE", LUA_NATIVE_TASK_GET_IS_TASK_ACTIVE);
-		TASK.set_function("GET_SCRIPT_TASK_STATUS", LUA_NATIVE_TASK_GET_SCRIPT_TASK_STATUS);
-		TASK.set_function("GET_ACTIVE_VEHICLE_MISSION_TYPE", LUA_NATIVE_TASK_GET_ACTIVE_VEHICLE_MISSION_TYPE);
-		TASK.set_function("TASK_LEAVE_ANY_VEHICLE", LUA_NATIVE_TASK_TASK_LEAVE_ANY_VEHICLE);
-		TASK.set_function("TASK_AIM_GUN_SCRIPTED", LUA_NATIVE_TASK_TASK_AIM_GUN_SCRIPTED);
-		TASK.set_function("TASK_AIM_GUN_SCRIPTED_WITH_TARGET", LUA_NATIVE_TASK_TASK_AIM_GUN_SCRIPTED_WITH_TARGET);
-		TASK.set_function("UPDATE_TASK_AIM_GUN_SCRIPTED_TARGET", LUA_NATIVE_TASK_UPDATE_TASK_AIM_GUN_SCRIPTED_TARGET);
-		TASK.set_function("GET_CLIP_SET_FOR_SCRIPTED_GUN_TASK", LUA_NATIVE_TASK_GET_CLIP_SET_FOR_SCRIPTED_GUN_TASK);
-		TASK.set_function("TASK_AIM_GUN_AT_ENTITY", LUA_NATIVE_TASK_TASK_AIM_GUN_AT_ENTITY);
-		TASK.set_function("TASK_TURN_PED_TO_FACE_ENTITY", LUA_NATIVE_TASK_TASK_TURN_PED_TO_FACE_ENTITY);
-		TASK.set_function("TASK_AIM_GUN_AT_COORD", LUA_NATIVE_TASK_TASK_AIM_GUN_AT_COORD);
-		TASK.set_function("TASK_SHOOT_AT_COORD", LUA_NATIVE_TASK_TASK_SHOOT_AT_COORD);
-		TASK.set_function("TASK_SHUFFLE_TO_NEXT_VEHICLE_SEAT", LUA_NATIVE_TASK_TASK_SHUFFLE_TO_NEXT_VEHICLE_SEAT);
-		TASK.set_function("CLEAR_PED_TASKS", LUA_NATIVE_TASK_CLEAR_PED_TASKS);
-		TASK.set_function("CLEAR_PED_SECONDARY_TASK", LUA_NATIVE_TASK_CLEAR_PED_SECONDARY_TASK);
-		TASK.set_function("TASK_EVERYONE_LEAVE_VEHICLE", LUA_NATIVE_TASK_TASK_EVERYONE_LEAVE_VEHICLE);
-		TASK.set_function("TASK_GOTO_ENTITY_OFFSET", LUA_NATIVE_TASK_TASK_GOTO_ENTITY_OFFSET);
-		TASK.set_function("TASK_GOTO_ENTITY_OFFSET_XY", LUA_NATIVE_TASK_TASK_GOTO_ENTITY_OFFSET_XY);
-		TASK.set_function("TASK_TURN_PED_TO_FACE_COORD", LUA_NATIVE_TASK_TASK_TURN_PED_TO_FACE_COORD);
-		TASK.set_function("TASK_VEHICLE_TEMP_ACTION", LUA_NATIVE_TASK_TASK_VEHICLE_TEMP_ACTION);
-		TASK.set_function("TASK_VEHICLE_MISSION", LUA_NATIVE_TASK_TASK_VEHICLE_MISSION);
-		TASK.set_function("TASK_VEHICLE_MISSION_PED_TARGET", LUA_NATIVE_TASK_TASK_VEHICLE_MISSION_PED_TARGET);
-		TASK.set_function("TASK_VEHICLE_MISSION_COORS_TARGET", LUA_NATIVE_TASK_TASK_VEHICLE_MISSION_COORS_TARGET);
-		TASK.set_function("TASK_VEHICLE_ESCORT", LUA_NATIVE_TASK_TASK_VEHICLE_ESCORT);
-		TASK.set_function("TASK_VEHICLE_FOLLOW", LUA_NATIVE_TASK_TASK_VEHICLE_FOLLOW);
-		TASK.set_function("TASK_VEHICLE_CHASE", LUA_NATIVE_TASK_TASK_VEHICLE_CHASE);
-		TASK.set_function("TASK_VEHICLE_HELI_PROTECT", LUA_NATIVE_TASK_TASK_VEHICLE_HELI_PROTECT);
-		TASK.set_function("SET_TASK_VEHICLE_CHASE_BEHAVIOR_FLAG", LUA_NATIVE_TASK_SET_TASK_VEHICLE_CHASE_BEHAVIOR_FLAG);
-		TASK.set_function("SET_TASK_VEHICLE_CHASE_IDEAL_PURSUIT_DISTANCE", LUA_NATIVE_TASK_SET_TASK_VEHICLE_CHASE_IDEAL_PURSUIT_DISTANCE);
-		TASK.set_function("TASK_HELI_CHASE", LUA_NATIVE_TASK_TASK_HELI_CHASE);
-		TASK.set_function("TASK_PLANE_CHASE", LUA_NATIVE_TASK_TASK_PLANE_CHASE);
-		TASK.set_function("TASK_PLANE_LAND", LUA_NATIVE_TASK_TASK_PLANE_LAND);
-		TASK.set_function("CLEAR_DEFAULT_PRIMARY_TASK", LUA_NATIVE_TASK_CLEAR_DEFAULT_PRIMARY_TASK);
-		TASK.set_function("CLEAR_PRIMARY_VEHICLE_TASK", LUA_NATIVE_TASK_CLEAR_PRIMARY_VEHICLE_TASK);
-		TASK.set_function("CLEAR_VEHICLE_CRASH_TASK", LUA_NATIVE_TASK_CLEAR_VEHICLE_CRASH_TASK);
-		TASK.set_function("TASK_PLANE_GOTO_PRECISE_VTOL", LUA_NATIVE_TASK_TASK_PLANE_GOTO_PRECISE_VTOL);
-		TASK.set_function("TASK_SUBMARINE_GOTO_AND_STOP", LUA_NATIVE_TASK_TASK_SUBMARINE_GOTO_AND_STOP);
-		TASK.set_function("TASK_HELI_MISSION", LUA_NATIVE_TASK_TASK_HELI_MISSION);
-		TASK.set_function("TASK_HELI_ESCORT_HELI", LUA_NATIVE_TASK_TASK_HELI_ESCORT_HELI);
-		TASK.set_function("TASK_PLANE_MISSION", LUA_NATIVE_TASK_TASK_PLANE_MISSION);
-		TASK.set_function("TASK_PLANE_TAXI", LUA_NATIVE_TASK_TASK_PLANE_TAXI);
-		TASK.set_function("TASK_BOAT_MISSION", LUA_NATIVE_TASK_TASK_BOAT_MISSION);
-		TASK.set_function("TASK_DRIVE_BY", LUA_NATIVE_TASK_TASK_DRIVE_BY);
-		TASK.set_function("SET_DRIVEBY_TASK_TARGET", LUA_NATIVE_TASK_SET_DRIVEBY_TASK_TARGET);
-		TASK.set_function("CLEAR_DRIVEBY_TASK_UNDERNEATH_DRIVING_TASK", LUA_NATIVE_TASK_CLEAR_DRIVEBY_TASK_UNDERNEATH_DRIVING_TASK);
-		TASK.set_function("IS_DRIVEBY_TASK_UNDERNEATH_DRIVING_TASK", LUA_NATIVE_TASK_IS_DRIVEBY_TASK_UNDERNEATH_DRIVING_TASK);
-		TASK.set_function("CONTROL_MOUNTED_WEAPON", LUA_NATIVE_TASK_CONTROL_MOUNTED_WEAPON);
-		TASK.set_function("SET_MOUNTED_WEAPON_TARGET", LUA_NATIVE_TASK_SET_MOUNTED_WEAPON_TARGET);
-		TASK.set_function("IS_MOUNTED_WEAPON_TASK_UNDERNEATH_DRIVING_TASK", LUA_NATIVE_TASK_IS_MOUNTED_WEAPON_TASK_UNDERNEATH_DRIVING_TASK);
-		TASK.set_function("TASK_USE_MOBILE_PHONE", LUA_NATIVE_TASK_TASK_USE_MOBILE_PHONE);
-		TASK.set_function("TASK_USE_MOBILE_PHONE_TIMED", LUA_NATIVE_TASK_TASK_USE_MOBILE_PHONE_TIMED);
-		TASK.set_function("TASK_CHAT_TO_PED", LUA_NATIVE_TASK_TASK_CHAT_TO_PED);
-		TASK.set_function("TASK_WARP_PED_INTO_VEHICLE", LUA_NATIVE_TASK_TASK_WARP_PED_INTO_VEHICLE);
-		TASK.set_function("TASK_SHOOT_AT_ENTITY", LUA_NATIVE_TASK_TASK_SHOOT_AT_ENTITY);
-		TASK.set_function("TASK_CLIMB", LUA_NATIVE_TASK_TASK_CLIMB);
-		TASK.set_function("TASK_CLIMB_LADDER", LUA_NATIVE_TASK_TASK_CLIMB_LADDER);
-		TASK.set_function("TASK_RAPPEL_DOWN_WALL_USING_CLIPSET_OVERRIDE", LUA_NATIVE_TASK_TASK_RAPPEL_DOWN_WALL_USING_CLIPSET_OVERRIDE);
-		TASK.set_function("GET_TASK_RAPPEL_DOWN_WALL_STATE", LUA_NATIVE_TASK_GET_TASK_RAPPEL_DOWN_WALL_STATE);
-		TASK.set_function("CLEAR_PED_TASKS_IMMEDIATELY", LUA_NATIVE_TASK_CLEAR_PED_TASKS_IMMEDIATELY);
-		TASK.set_function("TASK_PERFORM_SEQUENCE_FROM_PROGRESS", LUA_NATIVE_TASK_TASK_PERFORM_SEQUENCE_FROM_PROGRESS);
-		TASK.set_function("SET_NEXT_DESIRED_MOVE_STATE", LUA_NATIVE_TASK_SET_NEXT_DESIRED_MOVE_STATE);
-		TASK.set_function("SET_PED_DESIRED_MOVE_BLEND_RATIO", LUA_NATIVE_TASK_SET_PED_DESIRED_MOVE_BLEND_RATIO);
-		TASK.set_function("GET_PED_DESIRED_MOVE_BLEND_RATIO", LUA_NATIVE_TASK_GET_PED_DESIRED_MOVE_BLEND_RATIO);
-		TASK.set_function("TASK_GOTO_ENTITY_AIMING", LUA_NATIVE_TASK_TASK_GOTO_ENTITY_AIMING);
-		TASK.set_function("TASK_SET_DECISION_MAKER", LUA_NATIVE_TASK_TASK_SET_DECISION_MAKER);
-		TASK.set_function("TASK_SET_SPHERE_DEFENSIVE_AREA", LUA_NATIVE_TASK_TASK_SET_SPHERE_DEFENSIVE_AREA);
-		TASK.set_function("TASK_CLEAR_DEFENSIVE_AREA", LUA_NATIVE_TASK_TASK_CLEAR_DEFENSIVE_AREA);
-		TASK.set_function("TASK_PED_SLIDE_TO_COORD", LUA_NATIVE_TASK_TASK_PED_SLIDE_TO_COORD);
-		TASK.set_function("TASK_PED_SLIDE_TO_COORD_HDG_RATE", LUA_NATIVE_TASK_TASK_PED_SLIDE_TO_COORD_HDG_RATE);
-		TASK.set_function("ADD_COVER_POINT", LUA_NATIVE_TASK_ADD_COVER_POINT);
-		TASK.set_function("REMOVE_COVER_POINT", LUA_NATIVE_TASK_REMOVE_COVER_POINT);
-		TASK.set_function("DOES_SCRIPTED_COVER_POINT_EXIST_AT_COORDS", LUA_NATIVE_TASK_DOES_SCRIPTED_COVER_POINT_EXIST_AT_COORDS);
-		TASK.set_function("GET_SCRIPTED_COVER_POINT_COORDS", LUA_NATIVE_TASK_GET_SCRIPTED_COVER_POINT_COORDS);
-		TASK.set_function("ADD_SCRIPTED_COVER_AREA", LUA_NATIVE_TASK_ADD_SCRIPTED_COVER_AREA);
-		TASK.set_function("TASK_COMBAT_PED", LUA_NATIVE_TASK_TASK_COMBAT_PED);
-		TASK.set_function("TASK_COMBAT_PED_TIMED", LUA_NATIVE_TASK_TASK_COMBAT_PED_TIMED);
-		TASK.set_function("TASK_SEEK_COVER_FROM_POS", LUA_NATIVE_TASK_TASK_SEEK_COVER_FROM_POS);
-		TASK.set_function("TASK_SEEK_COVER_FROM_PED", LUA_NATIVE_TASK_TASK_SEEK_COVER_FROM_PED);
-		TASK.set_function("TASK_SEEK_COVER_TO_COVER_POINT", LUA_NATIVE_TASK_TASK_SEEK_COVER_TO_COVER_POINT);
-		TASK.set_function("TASK_SEEK_COVER_TO_COORDS", LUA_NATIVE_TASK_TASK_SEEK_COVER_TO_COORDS);
-		TASK.set_function("TASK_PUT_PED_DIRECTLY_INTO_COVER", LUA_NATIVE_TASK_TASK_PUT_PED_DIRECTLY_INTO_COVER);
-		TASK.set_function("TASK_WARP_PED_DIRECTLY_INTO_COVER", LUA_NATIVE_TASK_TASK_WARP_PED_DIRECTLY_INTO_COVER);
-		TASK.set_function("TASK_EXIT_COVER", LUA_NATIVE_TASK_TASK_EXIT_COVER);
-		TASK.set_function("TASK_PUT_PED_DIRECTLY_INTO_MELEE", LUA_NATIVE_TASK_TASK_PUT_PED_DIRECTLY_INTO_MELEE);
-		TASK.set_function("TASK_TOGGLE_DUCK", LUA_NATIVE_TASK_TASK_TOGGLE_DUCK);
-		TASK.set_function("TASK_GUARD_CURRENT_POSITION", LUA_NATIVE_TASK_TASK_GUARD_CURRENT_POSITION);
-		TASK.set_function("TASK_GUARD_ASSIGNED_DEFENSIVE_AREA", LUA_NATIVE_TASK_TASK_GUARD_ASSIGNED_DEFENSIVE_AREA);
-		TASK.set_function("TASK_GUARD_SPHERE_DEFENSIVE_AREA", LUA_NATIVE_TASK_TASK_GUARD_SPHERE_DEFENSIVE_AREA);
-		TASK.set_function("TASK_STAND_GUARD", LUA_NATIVE_TASK_TASK_STAND_GUARD);
-		TASK.set_function("SET_DRIVE_TASK_CRUISE_SPEED", LUA_NATIVE_TASK_SET_DRIVE_TASK_CRUISE_SPEED);
-		TASK.set_function("SET_DRIVE_TASK_MAX_CRUISE_SPEED", LUA_NATIVE_TASK_SET_DRIVE_TASK_MAX_CRUISE_SPEED);
-		TASK.set_function("SET_DRIVE_TASK_DRIVING_STYLE", LUA_NATIVE_TASK_SET_DRIVE_TASK_DRIVING_STYLE);
-		TASK.set_function("ADD_COVER_BLOCKING_AREA", LUA_NATIVE_TASK_ADD_COVER_BLOCKING_AREA);
-		TASK.set_function("REMOVE_ALL_COVER_BLOCKING_AREAS", LUA_NATIVE_TASK_REMOVE_ALL_COVER_BLOCKING_AREAS);
-		TASK.set_function("REMOVE_COVER_BLOCKING_AREAS_AT_POSITION", LUA_NATIVE_TASK_REMOVE_COVER_BLOCKING_AREAS_AT_POSITION);
-		TASK.set_function("REMOVE_SPECIFIC_COVER_BLOCKING_AREAS", LUA_NATIVE_TASK_REMOVE_SPECIFIC_COVER_BLOCKING_AREAS);
-		TASK.set_function("TASK_START_SCENARIO_IN_PLACE", LUA_NATIVE_TASK_TASK_START_SCENARIO_IN_PLACE);
-		TASK.set_function("TASK_START_SCENARIO_AT_POSITION", LUA_NATIVE_TASK_TASK_START_SCENARIO_AT_POSITION);
-		TASK.set_function("TASK_USE_NEAREST_SCENARIO_TO_COORD", LUA_NATIVE_TASK_TASK_USE_NEAREST_SCENARIO_TO_COORD);
-		TASK.set_function("TASK_USE_NEAREST_SCENARIO_TO_COORD_WARP", LUA_NATIVE_TASK_TASK_USE_NEAREST_SCENARIO_TO_COORD_WARP);
-		TASK.set_function("TASK_USE_NEAREST_SCENARIO_CHAIN_TO_COORD", LUA_NATIVE_TASK_TASK_USE_NEAREST_SCENARIO_CHAIN_TO_COORD);
-		TASK.set_function("TASK_USE_NEAREST_SCENARIO_CHAIN_TO_COORD_WARP", LUA_NATIVE_TASK_TASK_USE_NEAREST_SCENARIO_CHAIN_TO_COORD_WARP);
-		TASK.set_function("DOES_SCENARIO_EXIST_IN_AREA", LUA_NATIVE_TASK_DOES_SCENARIO_EXIST_IN_AREA);
-		TASK.set_function("DOES_SCENARIO_OF_TYPE_EXIST_IN_AREA", LUA_NATIVE_TASK_DOES_SCENARIO_OF_TYPE_EXIST_IN_AREA);
-		TASK.set_function("IS_SCENARIO_OCCUPIED", LUA_NATIVE_TASK_IS_SCENARIO_OCCUPIED);
-		TASK.set_function("PED_HAS_USE_SCENARIO_TASK", LUA_NATIVE_TASK_PED_HAS_USE_SCENARIO_TASK);
-		TASK.set_function("PLAY_ANIM_ON_RUNNING_SCENARIO", LUA_NATIVE_TASK_PLAY_ANIM_ON_RUNNING_SCENARIO);
-		TASK.set_function("DOES_SCENARIO_GROUP_EXIST", LUA_NATIVE_TASK_DOES_SCENARIO_GROUP_EXIST);
-		TASK.set_function("IS_SCENARIO_GROUP_ENABLED", LUA_NATIVE_TASK_IS_SCENARIO_GROUP_ENABLED);
-		TASK.set_function("SET_SCENARIO_GROUP_ENABLED", LUA_NATIVE_TASK_SET_SCENARIO_GROUP_ENABLED);
-		TASK.set_function("RESET_SCENARIO_GROUPS_ENABLED", LUA_NATIVE_TASK_RESET_SCENARIO_GROUPS_ENABLED);
-		TASK.set_function("SET_EXCLUSIVE_SCENARIO_GROUP", LUA_NATIVE_TASK_SET_EXCLUSIVE_SCENARIO_GROUP);
-		TASK.set_function("RESET_EXCLUSIVE_SCENARIO_GROUP", LUA_NATIVE_TASK_RESET_EXCLUSIVE_SCENARIO_GROUP);
-		TASK.set_function("IS_SCENARIO_TYPE_ENABLED", LUA_NATIVE_TASK_IS_SCENARIO_TYPE_ENABLED);
-		TASK.set_function("SET_SCENARIO_TYPE_ENABLED", LUA_NATIVE_TASK_SET_SCENARIO_TYPE_ENABLED);
-		TASK.set_function("RESET_SCENARIO_TYPES_ENABLED", LUA_NATIVE_TASK_RESET_SCENARIO_TYPES_ENABLED);
-		TASK.set_function("IS_PED_ACTIVE_IN_SCENARIO", LUA_NATIVE_TASK_IS_PED_ACTIVE_IN_SCENARIO);
-		TASK.set_function("IS_PED_PLAYING_BASE_CLIP_IN_SCENARIO", LUA_NATIVE_TASK_IS_PED_PLAYING_BASE_CLIP_IN_SCENARIO);
-		TASK.set_function("SET_PED_CAN_PLAY_AMBIENT_IDLES", LUA_NATIVE_TASK_SET_PED_CAN_PLAY_AMBIENT_IDLES);
-		TASK.set_function("TASK_COMBAT_HATED_TARGETS_IN_AREA", LUA_NATIVE_TASK_TASK_COMBAT_HATED_TARGETS_IN_AREA);
-		TASK.set_function("TASK_COMBAT_HATED_TARGETS_AROUND_PED", LUA_NATIVE_TASK_TASK_COMBAT_HATED_TARGETS_AROUND_PED);
-		TASK.set_function("TASK_COMBAT_HATED_TARGETS_AROUND_PED_TIMED", LUA_NATIVE_TASK_TASK_COMBAT_HATED_TARGETS_AROUND_PED_TIMED);
-		TASK.set_function("TASK_THROW_PROJECTILE", LUA_NATIVE_TASK_TASK_THROW_PROJECTILE);
-		TASK.set_function("TASK_SWAP_WEAPON", LUA_NATIVE_TASK_TASK_SWAP_WEAPON);
-		TASK.set_function("TASK_RELOAD_WEAPON", LUA_NATIVE_TASK_TASK_RELOAD_WEAPON);
-		TASK.set_function("IS_PED_GETTING_UP", LUA_NATIVE_TASK_IS_PED_GETTING_UP);
-		TASK.set_function("TASK_WRITHE", LUA_NATIVE_TASK_TASK_WRITHE);
-		TASK.set_function("IS_PED_IN_WRITHE", LUA_NATIVE_TASK_IS_PED_IN_WRITHE);
-		TASK.set_function("OPEN_PATROL_ROUTE", LUA_NATIVE_TASK_OPEN_PATROL_ROUTE);
-		TASK.set_function("CLOSE_PATROL_ROUTE", LUA_NATIVE_TASK_CLOSE_PATROL_ROUTE);
-		TASK.set_function("ADD_PATROL_ROUTE_NODE", LUA_NATIVE_TASK_ADD_PATROL_ROUTE_NODE);
-		TASK.set_function("ADD_PATROL_ROUTE_LINK", LUA_NATIVE_TASK_ADD_PATROL_ROUTE_LINK);
-		TASK.set_function("CREATE_PATROL_ROUTE", LUA_NATIVE_TASK_CREATE_PATROL_ROUTE);
-		TASK.set_function("DELETE_PATROL_ROUTE", LUA_NATIVE_TASK_DELETE_PATROL_ROUTE);
-		TASK.set_function("GET_PATROL_TASK_INFO", LUA_NATIVE_TASK_GET_PATROL_TASK_INFO);
-		TASK.set_function("TASK_PATROL", LUA_NATIVE_TASK_TASK_PATROL);
-		TASK.set_function("TASK_STAY_IN_COVER", LUA_NATIVE_TASK_TASK_STAY_IN_COVER);
-		TASK.set_function("ADD_VEHICLE_SUBTASK_ATTACK_COORD", LUA_NATIVE_TASK_ADD_VEHICLE_SUBTASK_ATTACK_COORD);
-		TASK.set_function("ADD_VEHICLE_SUBTASK_ATTACK_PED", LUA_NATIVE_TASK_ADD_VEHICLE_SUBTASK_ATTACK_PED);
-		TASK.set_function("TASK_VEHICLE_SHOOT_AT_PED", LUA_NATIVE_TASK_TASK_VEHICLE_SHOOT_AT_PED);
-		TASK.set_function("TASK_VEHICLE_AIM_AT_PED", LUA_NATIVE_TASK_TASK_VEHICLE_AIM_AT_PED);
-		TASK.set_function("TASK_VEHICLE_SHOOT_AT_COORD", LUA_NATIVE_TASK_TASK_VEHICLE_SHOOT_AT_COORD);
-		TASK.set_function("TASK_VEHICLE_AIM_AT_COORD", LUA_NATIVE_TASK_TASK_VEHICLE_AIM_AT_COORD);
-		TASK.set_function("TASK_VEHICLE_GOTO_NAVMESH", LUA_NATIVE_TASK_TASK_VEHICLE_GOTO_NAVMESH);
-		TASK.set_function("TASK_GO_TO_COORD_WHILE_AIMING_AT_COORD", LUA_NATIVE_TASK_TASK_GO_TO_COORD_WHILE_AIMING_AT_COORD);
-		TASK.set_function("TASK_GO_TO_COORD_WHILE_AIMING_AT_ENTITY", LUA_NATIVE_TASK_TASK_GO_TO_COORD_WHILE_AIMING_AT_ENTITY);
-		TASK.set_function("TASK_GO_TO_COORD_AND_AIM_AT_HATED_ENTITIES_NEAR_COORD", LUA_NATIVE_TASK_TASK_GO_TO_COORD_AND_AIM_AT_HATED_ENTITIES_NEAR_COORD);
-		TASK.set_function("TASK_GO_TO_ENTITY_WHILE_AIMING_AT_COORD", LUA_NATIVE_TASK_TASK_GO_TO_ENTITY_WHILE_AIMING_AT_COORD);
-		TASK.set_function("TASK_GO_TO_ENTITY_WHILE_AIMING_AT_ENTITY", LUA_NATIVE_TASK_TASK_GO_TO_ENTITY_WHILE_AIMING_AT_ENTITY);
-		TASK.set_function("SET_HIGH_FALL_TASK", LUA_NATIVE_TASK_SET_HIGH_FALL_TASK);
-		TASK.set_function("REQUEST_WAYPOINT_RECORDING", LUA_NATIVE_TASK_REQUEST_WAYPOINT_RECORDING);
-		TASK.set_function("GET_IS_WAYPOINT_RECORDING_LOADED", LUA_NATIVE_TASK_GET_IS_WAYPOINT_RECORDING_LOADED);
-		TASK.set_function("REMOVE_WAYPOINT_RECORDING", LUA_NATIVE_TASK_REMOVE_WAYPOINT_RECORDING);
-		TASK.set_function("WAYPOINT_RECORDING_GET_NUM_POINTS", LUA_NATIVE_TASK_WAYPOINT_RECORDING_GET_NUM_POINTS);
-		TASK.set_function("WAYPOINT_RECORDING_GET_COORD", LUA_NATIVE_TASK_WAYPOINT_RECORDING_GET_COORD);
-		TASK.set_function("WAYPOINT_RECORDING_GET_SPEED_AT_POINT", LUA_NATIVE_TASK_WAYPOINT_RECORDING_GET_SPEED_AT_POINT);
-		TASK.set_function("WAYPOINT_RECORDING_GET_CLOSEST_WAYPOINT", LUA_NATIVE_TASK_WAYPOINT_RECORDING_GET_CLOSEST_WAYPOINT);
-		TASK.set_function("TASK_FOLLOW_WAYPOINT_RECORDING", LUA_NATIVE_TASK_TASK_FOLLOW_WAYPOINT_RECORDING);
-		TASK.set_function("IS_WAYPOINT_PLAYBACK_GOING_ON_FOR_PED", LUA_NATIVE_TASK_IS_WAYPOINT_PLAYBACK_GOING_ON_FOR_PED);
-		TASK.set_function("GET_PED_WAYPOINT_PROGRESS", LUA_NATIVE_TASK_GET_PED_WAYPOINT_PROGRESS);
-		TASK.set_function("GET_PED_WAYPOINT_DISTANCE", LUA_NATIVE_TASK_GET_PED_WAYPOINT_DISTANCE);
-		TASK.set_function("SET_PED_WAYPOINT_ROUTE_OFFSET", LUA_NATIVE_TASK_SET_PED_WAYPOINT_ROUTE_OFFSET);
-		TASK.set_function("GET_WAYPOINT_DISTANCE_ALONG_ROUTE", LUA_NATIVE_TASK_GET_WAYPOINT_DISTANCE_ALONG_ROUTE);
-		TASK.set_function("WAYPOINT_PLAYBACK_GET_IS_PAUSED", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_GET_IS_PAUSED);
-		TASK.set_function("WAYPOINT_PLAYBACK_PAUSE", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_PAUSE);
-		TASK.set_function("WAYPOINT_PLAYBACK_RESUME", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_RESUME);
-		TASK.set_function("WAYPOINT_PLAYBACK_OVERRIDE_SPEED", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_OVERRIDE_SPEED);
-		TASK.set_function("WAYPOINT_PLAYBACK_USE_DEFAULT_SPEED", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_USE_DEFAULT_SPEED);
-		TASK.set_function("USE_WAYPOINT_RECORDING_AS_ASSISTED_MOVEMENT_ROUTE", LUA_NATIVE_TASK_USE_WAYPOINT_RECORDING_AS_ASSISTED_MOVEMENT_ROUTE);
-		TASK.set_function("WAYPOINT_PLAYBACK_START_AIMING_AT_PED", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_START_AIMING_AT_PED);
-		TASK.set_function("WAYPOINT_PLAYBACK_START_AIMING_AT_COORD", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_START_AIMING_AT_COORD);
-		TASK.set_function("WAYPOINT_PLAYBACK_START_SHOOTING_AT_PED", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_START_SHOOTING_AT_PED);
-		TASK.set_function("WAYPOINT_PLAYBACK_START_SHOOTING_AT_COORD", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_START_SHOOTING_AT_COORD);
-		TASK.set_function("WAYPOINT_PLAYBACK_STOP_AIMING_OR_SHOOTING", LUA_NATIVE_TASK_WAYPOINT_PLAYBACK_STOP_AIMING_OR_SHOOTING);
-		TASK.set_function("ASSISTED_MOVEMENT_REQUEST_ROUTE", LUA_NATIVE_TASK_ASSISTED_MOVEMENT_REQUEST_ROUTE);
-		TASK.set_function("ASSISTED_MOVEMENT_REMOVE_ROUTE", LUA_NATIVE_TASK_ASSISTED_MOVEMENT_REMOVE_ROUTE);
-		TASK.set_function("ASSISTED_MOVEMENT_IS_ROUTE_LOADED", LUA_NATIVE_TASK_ASSISTED_MOVEMENT_IS_ROUTE_LOADED);
-		TASK.set_function("ASSISTED_MOVEMENT_SET_ROUTE_PROPERTIES", LUA_NATIVE_TASK_ASSISTED_MOVEMENT_SET_ROUTE_PROPERTIES);
-		TASK.set_function("ASSISTED_MOVEMENT_OVERRIDE_LOAD_DISTANCE_THIS_FRAME", LUA_NATIVE_TASK_ASSISTED_MOVEMENT_OVERRIDE_LOAD_DISTANCE_THIS_FRAME);
-		TASK.set_function("TASK_VEHICLE_FOLLOW_WAYPOINT_RECORDING", LUA_NATIVE_TASK_TASK_VEHICLE_FOLLOW_WAYPOINT_RECORDING);
-		TASK.set_function("IS_WAYPOINT_PLAYBACK_GOING_ON_FOR_VEHICLE", LUA_NATIVE_TASK_IS_WAYPOINT_PLAYBACK_GOING_ON_FOR_VEHICLE);
-		TASK.set_function("GET_VEHICLE_WAYPOINT_PROGRESS", LUA_NATIVE_TASK_GET_VEHICLE_WAYPOINT_PROGRESS);
-		TASK.set_function("GET_VEHICLE_WAYPOINT_TARGET_POINT", LUA_NATIVE_TASK_GET_VEHICLE_WAYPOINT_TARGET_POINT);
-		TASK.set_function("VEHICLE_WAYPOINT_PLAYBACK_PAUSE", LUA_NATIVE_TASK_VEHICLE_WAYPOINT_PLAYBACK_PAUSE);
-		TASK.set_function("VEHICLE_WAYPOINT_PLAYBACK_RESUME", LUA_NATIVE_TASK_VEHICLE_WAYPOINT_PLAYBACK_RESUME);
-		TASK.set_function("VEHICLE_WAYPOINT_PLAYBACK_USE_DEFAULT_SPEED", LUA_NATIVE_TASK_VEHICLE_WAYPOINT_PLAYBACK_USE_DEFAULT_SPEED);
-		TASK.set_function("VEHICLE_WAYPOINT_PLAYBACK_OVERRIDE_SPEED", LUA_NATIVE_TASK_VEHICLE_WAYPOINT_PLAYBACK_OVERRIDE_SPEED);
-		TASK.set_function("TASK_SET_BLOCKING_OF_NON_TEMPORARY_EVENTS", LUA_NATIVE_TASK_TASK_SET_BLOCKING_OF_NON_TEMPORARY_EVENTS);
-		TASK.set_function("TASK_FORCE_MOTION_STATE", LUA_NATIVE_TASK_TASK_FORCE_MOTION_STATE);
-		TASK.set_function("TASK_MOVE_NETWORK_BY_NAME", LUA_NATIVE_TASK_TASK_MOVE_NETWORK_BY_NAME);
-		TASK.set_function("TASK_MOVE_NETWORK_ADVANCED_BY_NAME", LUA_NATIVE_TASK_TASK_MOVE_NETWORK_ADVANCED_BY_NAME);
-		TASK.set_function("TASK_MOVE_NETWORK_BY_NAME_WITH_INIT_PARAMS", LUA_NATIVE_TASK_TASK_MOVE_NETWORK_BY_NAME_WITH_INIT_PARAMS);
-		TASK.set_function("TASK_MOVE_NETWORK_ADVANCED_BY_NAME_WITH_INIT_PARAMS", LUA_NATIVE_TASK_TASK_MOVE_NETWORK_ADVANCED_BY_NAME_WITH_INIT_PARAMS);
-		TASK.set_function("IS_TASK_MOVE_NETWORK_ACTIVE", LUA_NATIVE_TASK_IS_TASK_MOVE_NETWORK_ACTIVE);
-		TASK.set_function("IS_TASK_MOVE_NETWORK_READY_FOR_TRANSITION", LUA_NATIVE_TASK_IS_TASK_MOVE_NETWORK_READY_FOR_TRANSITION);
-		TASK.set_function("REQUEST_TASK_MOVE_NETWORK_STATE_TRANSITION", LUA_NATIVE_TASK_REQUEST_TASK_MOVE_NETWORK_STATE_TRANSITION);
-		TASK.set_function("SET_EXPECTED_CLONE_NEXT_TASK_MOVE_NETWORK_STATE", LUA_NATIVE_TASK_SET_EXPECTED_CLONE_NEXT_TASK_MOVE_NETWORK_STATE);
-		TASK.set_function("GET_TASK_MOVE_NETWORK_STATE", LUA_NATIVE_TASK_GET_TASK_MOVE_NETWORK_STATE);
-		TASK.set_function("SET_TASK_MOVE_NETWORK_ANIM_SET", LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_ANIM_SET);
-		TASK.set_function("SET_TASK_MOVE_NETWORK_SIGNAL_FLOAT", LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_SIGNAL_FLOAT);
-		TASK.set_function("SET_TASK_MOVE_NETWORK_SIGNAL_LOCAL_FLOAT", LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_SIGNAL_LOCAL_FLOAT);
-		TASK.set_function("SET_TASK_MOVE_NETWORK_SIGNAL_FLOAT_LERP_RATE", LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_SIGNAL_FLOAT_LERP_RATE);
-		TASK.set_function("SET_TASK_MOVE_NETWORK_SIGNAL_BOOL", LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_SIGNAL_BOOL);
-		TASK.set_function("GET_TASK_MOVE_NETWORK_SIGNAL_FLOAT", LUA_NATIVE_TASK_GET_TASK_MOVE_NETWORK_SIGNAL_FLOAT);
-		TASK.set_function("GET_TASK_MOVE_NETWORK_SIGNAL_BOOL", LUA_NATIVE_TASK_GET_TASK_MOVE_NETWORK_SIGNAL_BOOL);
-		TASK.set_function("GET_TASK_MOVE_NETWORK_EVENT", LUA_NATIVE_TASK_GET_TASK_MOVE_NETWORK_EVENT);
-		TASK.set_function("SET_TASK_MOVE_NETWORK_ENABLE_COLLISION_ON_NETWORK_CLONE_WHEN_FIXED", LUA_NATIVE_TASK_SET_TASK_MOVE_NETWORK_ENABLE_COLLISION_ON_NETWORK_CLONE_WHEN_FIXED);
-		TASK.set_function("SET_SCRIPT_TASK_ENABLE_COLLISION_ON_NETWORK_CLONE_WHEN_FIXED_", LUA_NATIVE_TASK_SET_SCRIPT_TASK_ENABLE_COLLISION_ON_NETWORK_CLONE_WHEN_FIXED_);
-		TASK.set_function("IS_MOVE_BLEND_RATIO_STILL", LUA_NATIVE_TASK_IS_MOVE_BLEND_RATIO_STILL);
-		TASK.set_function("IS_MOVE_BLEND_RATIO_WALKING", LUA_NATIVE_TASK_IS_MOVE_BLEND_RATIO_WALKING);
-		TASK.set_function("IS_MOVE_BLEND_RATIO_RUNNING", LUA_NATIVE_TASK_IS_MOVE_BLEND_RATIO_RUNNING);
-		TASK.set_function("IS_MOVE_BLEND_RATIO_SPRINTING", LUA_NATIVE_TASK_IS_MOVE_BLEND_RATIO_SPRINTING);
-		TASK.set_function("IS_PED_STILL", LUA_NATIVE_TASK_IS_PED_STILL);
-		TASK.set_function("IS_PED_WALKING", LUA_NATIVE_TASK_IS_PED_WALKING);
-		TASK.set_function("IS_PED_RUNNING", LUA_NATIVE_TASK_IS_PED_RUNNING);
-		TASK.set_function("IS_PED_SPRINTING", LUA_NATIVE_TASK_IS_PED_SPRINTING);
-		TASK.set_function("IS_PED_STRAFING", LUA_NATIVE_TASK_IS_PED_STRAFING);
-		TASK.set_function("TASK_SYNCHRONIZED_SCENE", LUA_NATIVE_TASK_TASK_SYNCHRONIZED_SCENE);
-		TASK.set_function("TASK_AGITATED_ACTION_CONFRONT_RESPONSE", LUA_NATIVE_TASK_TASK_AGITATED_ACTION_CONFRONT_RESPONSE);
-		TASK.set_function("TASK_SWEEP_AIM_ENTITY", LUA_NATIVE_TASK_TASK_SWEEP_AIM_ENTITY);
-		TASK.set_function("UPDATE_TASK_SWEEP_AIM_ENTITY", LUA_NATIVE_TASK_UPDATE_TASK_SWEEP_AIM_ENTITY);
-		TASK.set_function("TASK_SWEEP_AIM_POSITION", LUA_NATIVE_TASK_TASK_SWEEP_AIM_POSITION);
-		TASK.set_function("UPDATE_TASK_SWEEP_AIM_POSITION", LUA_NATIVE_TASK_UPDATE_TASK_SWEEP_AIM_POSITION);
-		TASK.set_function("TASK_ARREST_PED", LUA_NATIVE_TASK_TASK_ARREST_PED);
-		TASK.set_function("IS_PED_RUNNING_ARREST_TASK", LUA_NATIVE_TASK_IS_PED_RUNNING_ARREST_TASK);
-		TASK.set_function("IS_PED_BEING_ARRESTED", LUA_NATIVE_TASK_IS_PED_BEING_ARRESTED);
-		TASK.set_function("UNCUFF_PED", LUA_NATIVE_TASK_UNCUFF_PED);
-		TASK.set_function("IS_PED_CUFFED", LUA_NATIVE_TASK_IS_PED_CUFFED);
+		bind_namespace(L, "TASK", TASK_natives);
 	}
 }
@@ -4196,773 +4196,776 @@ namespace lua::native
 		return return_values;
 	}
 
+	static constexpr native_entry VEHICLE_natives[] = {
+		{"ADD_ROAD_NODE_SPEED_ZONE", native_function<LUA_NATIVE_VEHICLE_ADD_ROAD_NODE_SPEED_ZONE>},
+		{"ADD_VEHICLE_COMBAT_ANGLED_AVOIDANCE_AREA", native_function<LUA_NATIVE_VEHICLE_ADD_VEHICLE_COMBAT_ANGLED_AVOIDANCE_AREA>},
+		{"ADD_VEHICLE_PHONE_EXPLOSIVE_DEVICE", native_function<LUA_NATIVE_VEHICLE_ADD_VEHICLE_PHONE_EXPLOSIVE_DEVICE>},
+		{"ADD_VEHICLE_STUCK_CHECK_WITH_WARP", native_function<LUA_NATIVE_VEHICLE_ADD_VEHICLE_STUCK_CHECK_WITH_WARP>},
+		{"ADD_VEHICLE_UPSIDEDOWN_CHECK", native_function<LUA_NATIVE_VEHICLE_ADD_VEHICLE_UPSIDEDOWN_CHECK>},
+		{"ALLOW_AMBIENT_VEHICLES_TO_AVOID_ADVERSE_CONDITIONS", native_function<LUA_NATIVE_VEHICLE_ALLOW_AMBIENT_VEHICLES_TO_AVOID_ADVERSE_CONDITIONS>},
+		{"ALLOW_BOAT_BOOM_TO_ANIMATE", native_function<LUA_NATIVE_VEHICLE_ALLOW_BOAT_BOOM_TO_ANIMATE>},
+		{"ALLOW_TRAIN_TO_BE_REMOVED_BY_POPULATION", native_function<LUA_NATIVE_VEHICLE_ALLOW_TRAIN_TO_BE_REMOVED_BY_POPULATION>},
+		{"APPLY_EMP_EFFECT", native_function<LUA_NATIVE_VEHICLE_APPLY_EMP_EFFECT>},
+		{"ARE_ALL_VEHICLE_WINDOWS_INTACT", native_function<LUA_NATIVE_VEHICLE_ARE_ALL_VEHICLE_WINDOWS_INTACT>},
+		{"ARE_ANY_VEHICLE_SEATS_FREE", native_function<LUA_NATIVE_VEHICLE_ARE_ANY_VEHICLE_SEATS_FREE>},
+		{"ARE_FOLDING_WINGS_DEPLOYED", native_function<LUA_NATIVE_VEHICLE_ARE_FOLDING_WINGS_DEPLOYED>},
+		{"ARE_MISSILE_BAYS_DEPLOYED_", native_function<LUA_NATIVE_VEHICLE_ARE_MISSILE_BAYS_DEPLOYED_>},
+		{"ARE_PLANE_CONTROL_PANELS_INTACT", native_function<LUA_NATIVE_VEHICLE_ARE_PLANE_CONTROL_PANELS_INTACT>},
+		{"ARE_PLANE_PROPELLERS_INTACT", native_function<LUA_NATIVE_VEHICLE_ARE_PLANE_PROPELLERS_INTACT>},
+		{"ARE_WINGS_OF_PLANE_INTACT", native_function<LUA_NATIVE_VEHICLE_ARE_WINGS_OF_PLANE_INTACT>},
+		{"ATTACH_CONTAINER_TO_HANDLER_FRAME_WHEN_LINED_UP", native_function<LUA_NATIVE_VEHICLE_ATTACH_CONTAINER_TO_HANDLER_FRAME_WHEN_LINED_UP>},
+		{"ATTACH_ENTITY_TO_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_ATTACH_ENTITY_TO_CARGOBOB>},
+		{"ATTACH_VEHICLE_ON_TO_TRAILER", native_function<LUA_NATIVE_VEHICLE_ATTACH_VEHICLE_ON_TO_TRAILER>},
+		{"ATTACH_VEHICLE_TO_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_ATTACH_VEHICLE_TO_CARGOBOB>},
+		{"ATTACH_VEHICLE_TO_TOW_TRUCK", native_function<LUA_NATIVE_VEHICLE_ATTACH_VEHICLE_TO_TOW_TRUCK>},
+		{"ATTACH_VEHICLE_TO_TRAILER", native_function<LUA_NATIVE_VEHICLE_ATTACH_VEHICLE_TO_TRAILER>},
+		{"BRING_VEHICLE_TO_HALT", native_function<LUA_NATIVE_VEHICLE_BRING_VEHICLE_TO_HALT>},
+		{"CAN_ANCHOR_BOAT_HERE", native_function<LUA_NATIVE_VEHICLE_CAN_ANCHOR_BOAT_HERE>},
+		{"CAN_ANCHOR_BOAT_HERE_IGNORE_PLAYERS", native_function<LUA_NATIVE_VEHICLE_CAN_ANCHOR_BOAT_HERE_IGNORE_PLAYERS>},
+		{"CAN_CARGOBOB_PICK_UP_ENTITY", native_function<LUA_NATIVE_VEHICLE_CAN_CARGOBOB_PICK_UP_ENTITY>},
+		{"CAN_SHUFFLE_SEAT", native_function<LUA_NATIVE_VEHICLE_CAN_SHUFFLE_SEAT>},
+		{"CLEAR_LAST_DRIVEN_VEHICLE", native_function<LUA_NATIVE_VEHICLE_CLEAR_LAST_DRIVEN_VEHICLE>},
+		{"CLEAR_NITROUS", native_function<LUA_NATIVE_VEHICLE_CLEAR_NITROUS>},
+		{"CLEAR_VEHICLE_CUSTOM_PRIMARY_COLOUR", native_function<LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_CUSTOM_PRIMARY_COLOUR>},
+		{"CLEAR_VEHICLE_CUSTOM_SECONDARY_COLOUR", native_function<LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_CUSTOM_SECONDARY_COLOUR>},
+		{"CLEAR_VEHICLE_GENERATOR_AREA_OF_INTEREST", native_function<LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_GENERATOR_AREA_OF_INTEREST>},
+		{"CLEAR_VEHICLE_PETROLTANK_FIRE_CULPRIT", native_function<LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_PETROLTANK_FIRE_CULPRIT>},
+		{"CLEAR_VEHICLE_PHONE_EXPLOSIVE_DEVICE", native_function<LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_PHONE_EXPLOSIVE_DEVICE>},
+		{"CLEAR_VEHICLE_ROUTE_HISTORY", native_function<LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_ROUTE_HISTORY>},
+		{"CLOSE_BOMB_BAY_DOORS", native_function<LUA_NATIVE_VEHICLE_CLOSE_BOMB_BAY_DOORS>},
+		{"CONTROL_LANDING_GEAR", native_function<LUA_NATIVE_VEHICLE_CONTROL_LANDING_GEAR>},
+		{"COPY_VEHICLE_DAMAGES", native_function<LUA_NATIVE_VEHICLE_COPY_VEHICLE_DAMAGES>},
+		{"CREATE_MISSION_TRAIN", native_function<LUA_NATIVE_VEHICLE_CREATE_MISSION_TRAIN>},
+		{"CREATE_PICK_UP_ROPE_FOR_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_CREATE_PICK_UP_ROPE_FOR_CARGOBOB>},
+		{"CREATE_SCRIPT_VEHICLE_GENERATOR", native_function<LUA_NATIVE_VEHICLE_CREATE_SCRIPT_VEHICLE_GENERATOR>},
+		{"CREATE_VEHICLE", native_function<LUA_NATIVE_VEHICLE_CREATE_VEHICLE>},
+		{"DELETE_ALL_TRAINS", native_function<LUA_NATIVE_VEHICLE_DELETE_ALL_TRAINS>},
+		{"DELETE_MISSION_TRAIN", native_function<LUA_NATIVE_VEHICLE_DELETE_MISSION_TRAIN>},
+		{"DELETE_SCRIPT_VEHICLE_GENERATOR", native_function<LUA_NATIVE_VEHICLE_DELETE_SCRIPT_VEHICLE_GENERATOR>},
+		{"DELETE_VEHICLE", native_function<LUA_NATIVE_VEHICLE_DELETE_VEHICLE>},
+		{"DETACH_CONTAINER_FROM_HANDLER_FRAME", native_function<LUA_NATIVE_VEHICLE_DETACH_CONTAINER_FROM_HANDLER_FRAME>},
+		{"DETACH_ENTITY_FROM_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_DETACH_ENTITY_FROM_CARGOBOB>},
+		{"DETACH_VEHICLE_FROM_ANY_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_ANY_CARGOBOB>},
+		{"DETACH_VEHICLE_FROM_ANY_TOW_TRUCK", native_function<LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_ANY_TOW_TRUCK>},
+		{"DETACH_VEHICLE_FROM_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_CARGOBOB>},
+		{"DETACH_VEHICLE_FROM_TOW_TRUCK", native_function<LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_TOW_TRUCK>},
+		{"DETACH_VEHICLE_FROM_TRAILER", native_function<LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_TRAILER>},
+		{"DETONATE_VEHICLE_PHONE_EXPLOSIVE_DEVICE", native_function<LUA_NATIVE_VEHICLE_DETONATE_VEHICLE_PHONE_EXPLOSIVE_DEVICE>},
+		{"DISABLE_INDIVIDUAL_PLANE_PROPELLER", native_function<LUA_NATIVE_VEHICLE_DISABLE_INDIVIDUAL_PLANE_PROPELLER>},
+		{"DISABLE_PLANE_AILERON", native_function<LUA_NATIVE_VEHICLE_DISABLE_PLANE_AILERON>},
+		{"DISABLE_VEHCILE_DYNAMIC_AMBIENT_SCALES", native_function<LUA_NATIVE_VEHICLE_DISABLE_VEHCILE_DYNAMIC_AMBIENT_SCALES>},
+		{"DISABLE_VEHICLE_EXPLOSION_BREAK_OFF_PARTS", native_function<LUA_NATIVE_VEHICLE_DISABLE_VEHICLE_EXPLOSION_BREAK_OFF_PARTS>},
+		{"DISABLE_VEHICLE_TURRET_MOVEMENT_THIS_FRAME", native_function<LUA_NATIVE_VEHICLE_DISABLE_VEHICLE_TURRET_MOVEMENT_THIS_FRAME>},
+		{"DISABLE_VEHICLE_WEAPON", native_function<LUA_NATIVE_VEHICLE_DISABLE_VEHICLE_WEAPON>},
+		{"DOES_CARGOBOB_HAVE_PICKUP_MAGNET", native_function<LUA_NATIVE_VEHICLE_DOES_CARGOBOB_HAVE_PICKUP_MAGNET>},
+		{"DOES_CARGOBOB_HAVE_PICK_UP_ROPE", native_function<LUA_NATIVE_VEHICLE_DOES_CARGOBOB_HAVE_PICK_UP_ROPE>},
+		{"DOES_EXTRA_EXIST", native_function<LUA_NATIVE_VEHICLE_DOES_EXTRA_EXIST>},
+		{"DOES_SCRIPT_VEHICLE_GENERATOR_EXIST", native_function<LUA_NATIVE_VEHICLE_DOES_SCRIPT_VEHICLE_GENERATOR_EXIST>},
+		{"DOES_VEHICLE_ALLOW_RAPPEL", native_function<LUA_NATIVE_VEHICLE_DOES_VEHICLE_ALLOW_RAPPEL>},
+		{"DOES_VEHICLE_EXIST_WITH_DECORATOR", native_function<LUA_NATIVE_VEHICLE_DOES_VEHICLE_EXIST_WITH_DECORATOR>},
+		{"DOES_VEHICLE_HAVE_ROOF", native_function<LUA_NATIVE_VEHICLE_DOES_VEHICLE_HAVE_ROOF>},
+		{"DOES_VEHICLE_HAVE_SEARCHLIGHT", native_function<LUA_NATIVE_VEHICLE_DOES_VEHICLE_HAVE_SEARCHLIGHT>},
+		{"DOES_VEHICLE_HAVE_STUCK_VEHICLE_CHECK", native_function<LUA_NATIVE_VEHICLE_DOES_VEHICLE_HAVE_STUCK_VEHICLE_CHECK>},
+		{"DOES_VEHICLE_HAVE_WEAPONS", native_function<LUA_NATIVE_VEHICLE_DOES_VEHICLE_HAVE_WEAPONS>},
+		{"ENABLE_VEHICLE_DYNAMIC_AMBIENT_SCALES", native_function<LUA_NATIVE_VEHICLE_ENABLE_VEHICLE_DYNAMIC_AMBIENT_SCALES>},
+		{"EXPLODE_VEHICLE", native_function<LUA_NATIVE_VEHICLE_EXPLODE_VEHICLE>},
+		{"EXPLODE_VEHICLE_IN_CUTSCENE", native_function<LUA_NATIVE_VEHICLE_EXPLODE_VEHICLE_IN_CUTSCENE>},
+		{"FIND_HANDLER_VEHICLE_CONTAINER_IS_ATTACHED_TO", native_function<LUA_NATIVE_VEHICLE_FIND_HANDLER_VEHICLE_CONTAINER_IS_ATTACHED_TO>},
+		{"FIND_SPAWN_COORDINATES_FOR_HELI", native_function<LUA_NATIVE_VEHICLE_FIND_SPAWN_COORDINATES_FOR_HELI>},
+		{"FIX_VEHICLE_WINDOW", native_function<LUA_NATIVE_VEHICLE_FIX_VEHICLE_WINDOW>},
+		{"FORCE_PLAYBACK_RECORDED_VEHICLE_UPDATE", native_function<LUA_NATIVE_VEHICLE_FORCE_PLAYBACK_RECORDED_VEHICLE_UPDATE>},
+		{"FORCE_SUBMARINE_NEURTAL_BUOYANCY", native_function<LUA_NATIVE_VEHICLE_FORCE_SUBMARINE_NEURTAL_BUOYANCY>},
+		{"FORCE_SUBMARINE_SURFACE_MODE", native_function<LUA_NATIVE_VEHICLE_FORCE_SUBMARINE_SURFACE_MODE>},
+		{"FORCE_SUB_THROTTLE_FOR_TIME", native_function<LUA_NATIVE_VEHICLE_FORCE_SUB_THROTTLE_FOR_TIME>},
+		{"FULLY_CHARGE_NITROUS", native_function<LUA_NATIVE_VEHICLE_FULLY_CHARGE_NITROUS>},
+		{"GENERATE_VEHICLE_CREATION_POS_FROM_PATHS", native_function<LUA_NATIVE_VEHICLE_GENERATE_VEHICLE_CREATION_POS_FROM_PATHS>},
+		{"GET_ALL_VEHICLES", native_function<LUA_NATIVE_VEHICLE_GET_ALL_VEHICLES>},
+		{"GET_ARE_BOMB_BAY_DOORS_OPEN", native_function<LUA_NATIVE_VEHICLE_GET_ARE_BOMB_BAY_DOORS_OPEN>},
+		{"GET_ATTACHED_PICK_UP_HOOK_POSITION", native_function<LUA_NATIVE_VEHICLE_GET_ATTACHED_PICK_UP_HOOK_POSITION>},
+		{"GET_BOAT_BOOM_POSITION_RATIO", native_function<LUA_NATIVE_VEHICLE_GET_BOAT_BOOM_POSITION_RATIO>},
+		{"GET_BOAT_VEHICLE_MODEL_AGILITY", native_function<LUA_NATIVE_VEHICLE_GET_BOAT_VEHICLE_MODEL_AGILITY>},
+		{"GET_BOTH_VEHICLE_HEADLIGHTS_DAMAGED", native_function<LUA_NATIVE_VEHICLE_GET_BOTH_VEHICLE_HEADLIGHTS_DAMAGED>},
+		{"GET_CAN_VEHICLE_BE_PLACED_HERE", native_function<LUA_NATIVE_VEHICLE_GET_CAN_VEHICLE_BE_PLACED_HERE>},
+		{"GET_CAR_HAS_JUMP", native_function<LUA_NATIVE_VEHICLE_GET_CAR_HAS_JUMP>},
+		{"GET_CLOSEST_VEHICLE", native_function<LUA_NATIVE_VEHICLE_GET_CLOSEST_VEHICLE>},
+		{"GET_CONVERTIBLE_ROOF_STATE", native_function<LUA_NATIVE_VEHICLE_GET_CONVERTIBLE_ROOF_STATE>},
+		{"GET_CURRENT_PLAYBACK_FOR_VEHICLE", native_function<LUA_NATIVE_VEHICLE_GET_CURRENT_PLAYBACK_FOR_VEHICLE>},
+		{"GET_DISPLAY_NAME_FROM_VEHICLE_MODEL", native_function<LUA_NATIVE_VEHICLE_GET_DISPLAY_NAME_FROM_VEHICLE_MODEL>},
+		{"GET_DOES_VEHICLE_HAVE_DAMAGE_DECALS", native_function<LUA_NATIVE_VEHICLE_GET_DOES_VEHICLE_HAVE_DAMAGE_DECALS>},
+		{"GET_DOES_VEHICLE_HAVE_TOMBSTONE", native_function<LUA_NATIVE_VEHICLE_GET_DOES_VEHICLE_HAVE_TOMBSTONE>},
+		{"GET_DRIFT_TYRES_SET", native_function<LUA_NATIVE_VEHICLE_GET_DRIFT_TYRES_SET>},
+		{"GET_ENTITY_ATTACHED_TO_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_GET_ENTITY_ATTACHED_TO_CARGOBOB>},
+		{"GET_ENTITY_ATTACHED_TO_TOW_TRUCK", native_function<LUA_NATIVE_VEHICLE_GET_ENTITY_ATTACHED_TO_TOW_TRUCK>},
+		{"GET_ENTRY_POINT_POSITION", native_function<LUA_NATIVE_VEHICLE_GET_ENTRY_POINT_POSITION>},
+		{"GET_FAKE_SUSPENSION_LOWERING_AMOUNT", native_function<LUA_NATIVE_VEHICLE_GET_FAKE_SUSPENSION_LOWERING_AMOUNT>},
+		{"GET_FLYING_VEHICLE_MODEL_AGILITY", native_function<LUA_NATIVE_VEHICLE_GET_FLYING_VEHICLE_MODEL_AGILITY>},
+		{"GET_HAS_RETRACTABLE_WHEELS", native_function<LUA_NATIVE_VEHICLE_GET_HAS_RETRACTABLE_WHEELS>},
+		{"GET_HAS_ROCKET_BOOST", native_function<LUA_NATIVE_VEHICLE_GET_HAS_ROCKET_BOOST>},
+		{"GET_HAS_VEHICLE_BEEN_HIT_BY_SHUNT", native_function<LUA_NATIVE_VEHICLE_GET_HAS_VEHICLE_BEEN_HIT_BY_SHUNT>},
+		{"GET_HELI_MAIN_ROTOR_HEALTH", native_function<LUA_NATIVE_VEHICLE_GET_HELI_MAIN_ROTOR_HEALTH>},
+		{"GET_HELI_TAIL_BOOM_HEALTH", native_function<LUA_NATIVE_VEHICLE_GET_HELI_TAIL_BOOM_HEALTH>},
+		{"GET_HELI_TAIL_ROTOR_HEALTH", native_function<LUA_NATIVE_VEHICLE_GET_HELI_TAIL_ROTOR_HEALTH>},
+		{"GET_HYDRAULIC_SUSPENSION_RAISE_FACTOR", native_function<LUA_NATIVE_VEHICLE_GET_HYDRAULIC_SUSPENSION_RAISE_FACTOR>},
+		{"GET_IN_VEHICLE_CLIPSET_HASH_FOR_SEAT", native_function<LUA_NATIVE_VEHICLE_GET_IN_VEHICLE_CLIPSET_HASH_FOR_SEAT>},
+		{"GET_IS_BOAT_CAPSIZED", native_function<LUA_NATIVE_VEHICLE_GET_IS_BOAT_CAPSIZED>},
+		{"GET_IS_DOOR_VALID", native_function<LUA_NATIVE_VEHICLE_GET_IS_DOOR_VALID>},
+		{"GET_IS_LEFT_VEHICLE_HEADLIGHT_DAMAGED", native_function<LUA_NATIVE_VEHICLE_GET_IS_LEFT_VEHICLE_HEADLIGHT_DAMAGED>},
+		{"GET_IS_RIGHT_VEHICLE_HEADLIGHT_DAMAGED", native_function<LUA_NATIVE_VEHICLE_GET_IS_RIGHT_VEHICLE_HEADLIGHT_DAMAGED>},
+		{"GET_IS_VEHICLE_DISABLED_BY_EMP", native_function<LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_DISABLED_BY_EMP>},
+		{"GET_IS_VEHICLE_ENGINE_RUNNING", native_function<LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_ENGINE_RUNNING>},
+		{"GET_IS_VEHICLE_PRIMARY_COLOUR_CUSTOM", native_function<LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_PRIMARY_COLOUR_CUSTOM>},
+		{"GET_IS_VEHICLE_SECONDARY_COLOUR_CUSTOM", native_function<LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_SECONDARY_COLOUR_CUSTOM>},
+		{"GET_IS_VEHICLE_SHUNTING", native_function<LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_SHUNTING>},
+		{"GET_IS_WHEELS_RETRACTED", native_function<LUA_NATIVE_VEHICLE_GET_IS_WHEELS_RETRACTED>},
+		{"GET_LANDING_GEAR_STATE", native_function<LUA_NATIVE_VEHICLE_GET_LANDING_GEAR_STATE>},
+		{"GET_LAST_DRIVEN_VEHICLE", native_function<LUA_NATIVE_VEHICLE_GET_LAST_DRIVEN_VEHICLE>},
+		{"GET_LAST_PED_IN_VEHICLE_SEAT", native_function<LUA_NATIVE_VEHICLE_GET_LAST_PED_IN_VEHICLE_SEAT>},
+		{"GET_LAST_SHUNT_VEHICLE", native_function<LUA_NATIVE_VEHICLE_GET_LAST_SHUNT_VEHICLE>},
+		{"GET_LIVERY_NAME", native_function<LUA_NATIVE_VEHICLE_GET_LIVERY_NAME>},
+		{"GET_MAKE_NAME_FROM_VEHICLE_MODEL", native_function<LUA_NATIVE_VEHICLE_GET_MAKE_NAME_FROM_VEHICLE_MODEL>},
+		{"GET_MOD_SLOT_NAME", native_function<LUA_NATIVE_VEHICLE_GET_MOD_SLOT_NAME>},
+		{"GET_MOD_TEXT_LABEL", native_function<LUA_NATIVE_VEHICLE_GET_MOD_TEXT_LABEL>},
+		{"GET_NUMBER_OF_VEHICLE_COLOURS", native_function<LUA_NATIVE_VEHICLE_GET_NUMBER_OF_VEHICLE_COLOURS>},
+		{"GET_NUMBER_OF_VEHICLE_DOORS", native_function<LUA_NATIVE_VEHICLE_GET_NUMBER_OF_VEHICLE_DOORS>},
+		{"GET_NUMBER_OF_VEHICLE_NUMBER_PLATES", native_function<LUA_NATIVE_VEHICLE_GET_NUMBER_OF_VEHICLE_NUMBER_PLATES>},
+		{"GET_NUM_MOD_COLORS", native_function<LUA_NATIVE_VEHICLE_GET_NUM_MOD_COLORS>},
+		{"GET_NUM_MOD_KITS", native_function<LUA_NATIVE_VEHICLE_GET_NUM_MOD_KITS>},
+		{"GET_NUM_VEHICLE_MODS", native_function<LUA_NATIVE_VEHICLE_GET_NUM_VEHICLE_MODS>},
+		{"GET_NUM_VEHICLE_WINDOW_TINTS", native_function<LUA_NATIVE_VEHICLE_GET_NUM_VEHICLE_WINDOW_TINTS>},
+		{"GET_OUTRIGGERS_DEPLOYED", native_function<LUA_NATIVE_VEHICLE_GET_OUTRIGGERS_DEPLOYED>},
+		{"GET_PED_IN_VEHICLE_SEAT", native_function<LUA_NATIVE_VEHICLE_GET_PED_IN_VEHICLE_SEAT>},
+		{"GET_PED_USING_VEHICLE_DOOR", native_function<LUA_NATIVE_VEHICLE_GET_PED_USING_VEHICLE_DOOR>},
+		{"GET_POSITION_IN_RECORDING", native_function<LUA_NATIVE_VEHICLE_GET_POSITION_IN_RECORDING>},
+		{"GET_POSITION_OF_VEHICLE_RECORDING_AT_TIME", native_function<LUA_NATIVE_VEHICLE_GET_POSITION_OF_VEHICLE_RECORDING_AT_TIME>},
+		{"GET_POSITION_OF_VEHICLE_RECORDING_ID_AT_TIME", native_function<LUA_NATIVE_VEHICLE_GET_POSITION_OF_VEHICLE_RECORDING_ID_AT_TIME>},
+		{"GET_RANDOM_VEHICLE_BACK_BUMPER_IN_SPHERE", native_function<LUA_NATIVE_VEHICLE_GET_RANDOM_VEHICLE_BACK_BUMPER_IN_SPHERE>},
+		{"GET_RANDOM_VEHICLE_FRONT_BUMPER_IN_SPHERE", native_function<LUA_NATIVE_VEHICLE_GET_RANDOM_VEHICLE_FRONT_BUMPER_IN_SPHERE>},
+		{"GET_RANDOM_VEHICLE_IN_SPHERE", native_function<LUA_NATIVE_VEHICLE_GET_RANDOM_VEHICLE_IN_SPHERE>},
+		{"GET_RANDOM_VEHICLE_MODEL_IN_MEMORY", native_function<LUA_NATIVE_VEHICLE_GET_RANDOM_VEHICLE_MODEL_IN_MEMORY>},
+		{"GET_REMAINING_NITROUS_DURATION_", native_function<LUA_NATIVE_VEHICLE_GET_REMAINING_NITROUS_DURATION_>},
+		{"GET_ROTATION_OF_VEHICLE_RECORDING_AT_TIME", native_function<LUA_NATIVE_VEHICLE_GET_ROTATION_OF_VEHICLE_RECORDING_AT_TIME>},
+		{"GET_ROTATION_OF_VEHICLE_RECORDING_ID_AT_TIME", native_function<LUA_NATIVE_VEHICLE_GET_ROTATION_OF_VEHICLE_RECORDING_ID_AT_TIME>},
+		{"GET_SUBMARINE_IS_UNDER_DESIGN_DEPTH", native_function<LUA_NATIVE_VEHICLE_GET_SUBMARINE_IS_UNDER_DESIGN_DEPTH>},
+		{"GET_SUBMARINE_NUMBER_OF_AIR_LEAKS", native_function<LUA_NATIVE_VEHICLE_GET_SUBMARINE_NUMBER_OF_AIR_LEAKS>},
+		{"GET_TIME_POSITION_IN_RECORDING", native_function<LUA_NATIVE_VEHICLE_GET_TIME_POSITION_IN_RECORDING>},
+		{"GET_TOTAL_DURATION_OF_VEHICLE_RECORDING", native_function<LUA_NATIVE_VEHICLE_GET_TOTAL_DURATION_OF_VEHICLE_RECORDING>},
+		{"GET_TOTAL_DURATION_OF_VEHICLE_RECORDING_ID", native_function<LUA_NATIVE_VEHICLE_GET_TOTAL_DURATION_OF_VEHICLE_RECORDING_ID>},
+		{"GET_TRAIN_CARRIAGE", native_function<LUA_NATIVE_VEHICLE_GET_TRAIN_CARRIAGE>},
+		{"GET_TYRE_HEALTH", native_function<LUA_NATIVE_VEHICLE_GET_TYRE_HEALTH>},
+		{"GET_TYRE_WEAR_RATE", native_function<LUA_NATIVE_VEHICLE_GET_TYRE_WEAR_RATE>},
+		{"GET_VEHICLE_ACCELERATION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_ACCELERATION>},
+		{"GET_VEHICLE_ATTACHED_TO_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_ATTACHED_TO_CARGOBOB>},
+		{"GET_VEHICLE_BODY_HEALTH", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_BODY_HEALTH>},
+		{"GET_VEHICLE_BOMB_AMMO", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_BOMB_AMMO>},
+		{"GET_VEHICLE_CAN_DEPLOY_PARACHUTE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CAN_DEPLOY_PARACHUTE>},
+		{"GET_VEHICLE_CAUSE_OF_DESTRUCTION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CAUSE_OF_DESTRUCTION>},
+		{"GET_VEHICLE_CLASS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS>},
+		{"GET_VEHICLE_CLASS_ESTIMATED_MAX_SPEED", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_ESTIMATED_MAX_SPEED>},
+		{"GET_VEHICLE_CLASS_FROM_NAME", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_FROM_NAME>},
+		{"GET_VEHICLE_CLASS_MAX_ACCELERATION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_MAX_ACCELERATION>},
+		{"GET_VEHICLE_CLASS_MAX_AGILITY", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_MAX_AGILITY>},
+		{"GET_VEHICLE_CLASS_MAX_BRAKING", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_MAX_BRAKING>},
+		{"GET_VEHICLE_CLASS_MAX_TRACTION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_MAX_TRACTION>},
+		{"GET_VEHICLE_COLOR", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_COLOR>},
+		{"GET_VEHICLE_COLOURS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_COLOURS>},
+		{"GET_VEHICLE_COLOURS_WHICH_CAN_BE_SET", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_COLOURS_WHICH_CAN_BE_SET>},
+		{"GET_VEHICLE_COLOUR_COMBINATION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_COLOUR_COMBINATION>},
+		{"GET_VEHICLE_COUNTERMEASURE_AMMO", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_COUNTERMEASURE_AMMO>},
+		{"GET_VEHICLE_CURRENT_DRIVE_GEAR_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CURRENT_DRIVE_GEAR_>},
+		{"GET_VEHICLE_CURRENT_REV_RATIO_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CURRENT_REV_RATIO_>},
+		{"GET_VEHICLE_CURRENT_TIME_IN_SLIP_STREAM", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CURRENT_TIME_IN_SLIP_STREAM>},
+		{"GET_VEHICLE_CUSTOM_PRIMARY_COLOUR", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CUSTOM_PRIMARY_COLOUR>},
+		{"GET_VEHICLE_CUSTOM_SECONDARY_COLOUR", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_CUSTOM_SECONDARY_COLOUR>},
+		{"GET_VEHICLE_DEFORMATION_AT_POS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_DEFORMATION_AT_POS>},
+		{"GET_VEHICLE_DESIRED_DRIVE_GEAR_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_DESIRED_DRIVE_GEAR_>},
+		{"GET_VEHICLE_DIRT_LEVEL", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_DIRT_LEVEL>},
+		{"GET_VEHICLE_DOORS_LOCKED_FOR_PLAYER", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_DOORS_LOCKED_FOR_PLAYER>},
+		{"GET_VEHICLE_DOOR_ANGLE_RATIO", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_DOOR_ANGLE_RATIO>},
+		{"GET_VEHICLE_DOOR_LOCK_STATUS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_DOOR_LOCK_STATUS>},
+		{"GET_VEHICLE_ENGINE_HEALTH", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_ENGINE_HEALTH>},
+		{"GET_VEHICLE_ENVEFF_SCALE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_ENVEFF_SCALE>},
+		{"GET_VEHICLE_ESTIMATED_MAX_SPEED", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_ESTIMATED_MAX_SPEED>},
+		{"GET_VEHICLE_EXHAUST_BONE_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_EXHAUST_BONE_>},
+		{"GET_VEHICLE_EXTRA_COLOURS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_EXTRA_COLOURS>},
+		{"GET_VEHICLE_EXTRA_COLOUR_5", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_EXTRA_COLOUR_5>},
+		{"GET_VEHICLE_EXTRA_COLOUR_6", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_EXTRA_COLOUR_6>},
+		{"GET_VEHICLE_FLIGHT_NOZZLE_POSITION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_FLIGHT_NOZZLE_POSITION>},
+		{"GET_VEHICLE_HAS_KERS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_HAS_KERS>},
+		{"GET_VEHICLE_HAS_LANDING_GEAR", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_HAS_LANDING_GEAR>},
+		{"GET_VEHICLE_HAS_PARACHUTE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_HAS_PARACHUTE>},
+		{"GET_VEHICLE_HEALTH_PERCENTAGE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_HEALTH_PERCENTAGE>},
+		{"GET_VEHICLE_HOMING_LOCKEDONTO_STATE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_HOMING_LOCKEDONTO_STATE>},
+		{"GET_VEHICLE_HOMING_LOCKON_STATE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_HOMING_LOCKON_STATE>},
+		{"GET_VEHICLE_INDIVIDUAL_DOOR_LOCK_STATUS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_INDIVIDUAL_DOOR_LOCK_STATUS>},
+		{"GET_VEHICLE_IS_DUMMY", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_IS_DUMMY>},
+		{"GET_VEHICLE_IS_MERCENARY", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_IS_MERCENARY>},
+		{"GET_VEHICLE_LAYOUT_HASH", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_LAYOUT_HASH>},
+		{"GET_VEHICLE_LIGHTS_STATE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_LIGHTS_STATE>},
+		{"GET_VEHICLE_LIVERY", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_LIVERY>},
+		{"GET_VEHICLE_LIVERY2", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_LIVERY2>},
+		{"GET_VEHICLE_LIVERY2_COUNT", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_LIVERY2_COUNT>},
+		{"GET_VEHICLE_LIVERY_COUNT", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_LIVERY_COUNT>},
+		{"GET_VEHICLE_LOCK_ON_TARGET", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_LOCK_ON_TARGET>},
+		{"GET_VEHICLE_MAX_BRAKING", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_BRAKING>},
+		{"GET_VEHICLE_MAX_DRIVE_GEAR_COUNT_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_DRIVE_GEAR_COUNT_>},
+		{"GET_VEHICLE_MAX_EXHAUST_BONE_COUNT_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_EXHAUST_BONE_COUNT_>},
+		{"GET_VEHICLE_MAX_NUMBER_OF_PASSENGERS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_NUMBER_OF_PASSENGERS>},
+		{"GET_VEHICLE_MAX_TRACTION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_TRACTION>},
+		{"GET_VEHICLE_MOD", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD>},
+		{"GET_VEHICLE_MODEL_ACCELERATION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_ACCELERATION>},
+		{"GET_VEHICLE_MODEL_ACCELERATION_MAX_MODS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_ACCELERATION_MAX_MODS>},
+		{"GET_VEHICLE_MODEL_ESTIMATED_MAX_SPEED", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_ESTIMATED_MAX_SPEED>},
+		{"GET_VEHICLE_MODEL_MAX_BRAKING", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_MAX_BRAKING>},
+		{"GET_VEHICLE_MODEL_MAX_BRAKING_MAX_MODS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_MAX_BRAKING_MAX_MODS>},
+		{"GET_VEHICLE_MODEL_MAX_TRACTION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_MAX_TRACTION>},
+		{"GET_VEHICLE_MODEL_NUMBER_OF_SEATS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_NUMBER_OF_SEATS>},
+		{"GET_VEHICLE_MODEL_NUM_DRIVE_GEARS_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_NUM_DRIVE_GEARS_>},
+		{"GET_VEHICLE_MODEL_VALUE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_VALUE>},
+		{"GET_VEHICLE_MOD_COLOR_1", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_COLOR_1>},
+		{"GET_VEHICLE_MOD_COLOR_1_NAME", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_COLOR_1_NAME>},
+		{"GET_VEHICLE_MOD_COLOR_2", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_COLOR_2>},
+		{"GET_VEHICLE_MOD_COLOR_2_NAME", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_COLOR_2_NAME>},
+		{"GET_VEHICLE_MOD_IDENTIFIER_HASH", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_IDENTIFIER_HASH>},
+		{"GET_VEHICLE_MOD_KIT", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_KIT>},
+		{"GET_VEHICLE_MOD_KIT_TYPE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_KIT_TYPE>},
+		{"GET_VEHICLE_MOD_MODIFIER_VALUE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_MODIFIER_VALUE>},
+		{"GET_VEHICLE_MOD_VARIATION", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_VARIATION>},
+		{"GET_VEHICLE_NEON_COLOUR", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_NEON_COLOUR>},
+		{"GET_VEHICLE_NEON_ENABLED", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_NEON_ENABLED>},
+		{"GET_VEHICLE_NUMBER_OF_PASSENGERS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_NUMBER_OF_PASSENGERS>},
+		{"GET_VEHICLE_NUMBER_PLATE_TEXT", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_NUMBER_PLATE_TEXT>},
+		{"GET_VEHICLE_NUMBER_PLATE_TEXT_INDEX", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_NUMBER_PLATE_TEXT_INDEX>},
+		{"GET_VEHICLE_NUM_OF_BROKEN_LOOSEN_PARTS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_NUM_OF_BROKEN_LOOSEN_PARTS>},
+		{"GET_VEHICLE_NUM_OF_BROKEN_OFF_PARTS", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_NUM_OF_BROKEN_OFF_PARTS>},
+		{"GET_VEHICLE_PETROL_TANK_HEALTH", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_PETROL_TANK_HEALTH>},
+		{"GET_VEHICLE_PLATE_TYPE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_PLATE_TYPE>},
+		{"GET_VEHICLE_RECORDING_ID", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_RECORDING_ID>},
+		{"GET_VEHICLE_SIZE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_SIZE>},
+		{"GET_VEHICLE_THROTTLE_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_THROTTLE_>},
+		{"GET_VEHICLE_TRAILER_PARENT_VEHICLE_", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_TRAILER_PARENT_VEHICLE_>},
+		{"GET_VEHICLE_TRAILER_VEHICLE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_TRAILER_VEHICLE>},
+		{"GET_VEHICLE_TYRES_CAN_BURST", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_TYRES_CAN_BURST>},
+		{"GET_VEHICLE_TYRE_SMOKE_COLOR", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_TYRE_SMOKE_COLOR>},
+		{"GET_VEHICLE_WEAPON_RESTRICTED_AMMO", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_WEAPON_RESTRICTED_AMMO>},
+		{"GET_VEHICLE_WHEEL_TYPE", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_WHEEL_TYPE>},
+		{"GET_VEHICLE_WINDOW_TINT", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_WINDOW_TINT>},
+		{"GET_VEHICLE_XENON_LIGHT_COLOR_INDEX", native_function<LUA_NATIVE_VEHICLE_GET_VEHICLE_XENON_LIGHT_COLOR_INDEX>},
+		{"HAS_INSTANT_FILL_VEHICLE_POPULATION_FINISHED", native_function<LUA_NATIVE_VEHICLE_HAS_INSTANT_FILL_VEHICLE_POPULATION_FINISHED>},
+		{"HAS_PRELOAD_MODS_FINISHED", native_function<LUA_NATIVE_VEHICLE_HAS_PRELOAD_MODS_FINISHED>},
+		{"HAS_VEHICLE_ASSET_LOADED", native_function<LUA_NATIVE_VEHICLE_HAS_VEHICLE_ASSET_LOADED>},
+		{"HAS_VEHICLE_PETROLTANK_SET_ON_FIRE_BY_ENTITY", native_function<LUA_NATIVE_VEHICLE_HAS_VEHICLE_PETROLTANK_SET_ON_FIRE_BY_ENTITY>},
+		{"HAS_VEHICLE_PHONE_EXPLOSIVE_DEVICE", native_function<LUA_NATIVE_VEHICLE_HAS_VEHICLE_PHONE_EXPLOSIVE_DEVICE>},
+		{"HAS_VEHICLE_RECORDING_BEEN_LOADED", native_function<LUA_NATIVE_VEHICLE_HAS_VEHICLE_RECORDING_BEEN_LOADED>},
+		{"HAVE_VEHICLE_MODS_STREAMED_IN", native_function<LUA_NATIVE_VEHICLE_HAVE_VEHICLE_MODS_STREAMED_IN>},
+		{"HAVE_VEHICLE_REAR_DOORS_BEEN_BLOWN_OPEN_BY_STICKYBOMB", native_function<LUA_NATIVE_VEHICLE_HAVE_VEHICLE_REAR_DOORS_BEEN_BLOWN_OPEN_BY_STICKYBOMB>},
+		{"HIDE_TOMBSTONE", native_function<LUA_NATIVE_VEHICLE_HIDE_TOMBSTONE>},
+		{"INSTANTLY_FILL_VEHICLE_POPULATION", native_function<LUA_NATIVE_VEHICLE_INSTANTLY_FILL_VEHICLE_POPULATION>},
+		{"IS_ANY_ENTITY_ATTACHED_TO_HANDLER_FRAME", native_function<LUA_NATIVE_VEHICLE_IS_ANY_ENTITY_ATTACHED_TO_HANDLER_FRAME>},
+		{"IS_ANY_PED_RAPPELLING_FROM_HELI", native_function<LUA_NATIVE_VEHICLE_IS_ANY_PED_RAPPELLING_FROM_HELI>},
+		{"IS_ANY_VEHICLE_NEAR_POINT", native_function<LUA_NATIVE_VEHICLE_IS_ANY_VEHICLE_NEAR_POINT>},
+		{"IS_BIG_VEHICLE", native_function<LUA_NATIVE_VEHICLE_IS_BIG_VEHICLE>},
+		{"IS_BOAT_ANCHORED", native_function<LUA_NATIVE_VEHICLE_IS_BOAT_ANCHORED>},
+		{"IS_COP_VEHICLE_IN_AREA_3D", native_function<LUA_NATIVE_VEHICLE_IS_COP_VEHICLE_IN_AREA_3D>},
+		{"IS_ENTITY_ATTACHED_TO_HANDLER_FRAME", native_function<LUA_NATIVE_VEHICLE_IS_ENTITY_ATTACHED_TO_HANDLER_FRAME>},
+		{"IS_ENTRY_POINT_FOR_SEAT_CLEAR", native_function<LUA_NATIVE_VEHICLE_IS_ENTRY_POINT_FOR_SEAT_CLEAR>},
+		{"IS_EXTRA_BROKEN_OFF", native_function<LUA_NATIVE_VEHICLE_IS_EXTRA_BROKEN_OFF>},
+		{"IS_HANDLER_FRAME_LINED_UP_WITH_CONTAINER", native_function<LUA_NATIVE_VEHICLE_IS_HANDLER_FRAME_LINED_UP_WITH_CONTAINER>},
+		{"IS_HELI_LANDING_AREA_BLOCKED", native_function<LUA_NATIVE_VEHICLE_IS_HELI_LANDING_AREA_BLOCKED>},
+		{"IS_HELI_PART_BROKEN", native_function<LUA_NATIVE_VEHICLE_IS_HELI_PART_BROKEN>},
+		{"IS_MISSION_TRAIN", native_function<LUA_NATIVE_VEHICLE_IS_MISSION_TRAIN>},
+		{"IS_NITROUS_ACTIVE", native_function<LUA_NATIVE_VEHICLE_IS_NITROUS_ACTIVE>},
+		{"IS_PED_EXCLUSIVE_DRIVER_OF_VEHICLE", native_function<LUA_NATIVE_VEHICLE_IS_PED_EXCLUSIVE_DRIVER_OF_VEHICLE>},
+		{"IS_PLANE_LANDING_GEAR_INTACT", native_function<LUA_NATIVE_VEHICLE_IS_PLANE_LANDING_GEAR_INTACT>},
+		{"IS_PLAYBACK_GOING_ON_FOR_VEHICLE", native_function<LUA_NATIVE_VEHICLE_IS_PLAYBACK_GOING_ON_FOR_VEHICLE>},
+		{"IS_PLAYBACK_USING_AI_GOING_ON_FOR_VEHICLE", native_function<LUA_NATIVE_VEHICLE_IS_PLAYBACK_USING_AI_GOING_ON_FOR_VEHICLE>},
+		{"IS_ROCKET_BOOST_ACTIVE", native_function<LUA_NATIVE_VEHICLE_IS_ROCKET_BOOST_ACTIVE>},
+		{"IS_SEAT_WARP_ONLY", native_function<LUA_NATIVE_VEHICLE_IS_SEAT_WARP_ONLY>},
+		{"IS_TAXI_LIGHT_ON", native_function<LUA_NATIVE_VEHICLE_IS_TAXI_LIGHT_ON>},
+		{"IS_THIS_MODEL_AN_AMPHIBIOUS_CAR", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_AN_AMPHIBIOUS_CAR>},
+		{"IS_THIS_MODEL_AN_AMPHIBIOUS_QUADBIKE", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_AN_AMPHIBIOUS_QUADBIKE>},
+		{"IS_THIS_MODEL_A_BICYCLE", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_BICYCLE>},
+		{"IS_THIS_MODEL_A_BIKE", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_BIKE>},
+		{"IS_THIS_MODEL_A_BOAT", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_BOAT>},
+		{"IS_THIS_MODEL_A_CAR", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_CAR>},
+		{"IS_THIS_MODEL_A_HELI", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_HELI>},
+		{"IS_THIS_MODEL_A_JETSKI", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_JETSKI>},
+		{"IS_THIS_MODEL_A_PLANE", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_PLANE>},
+		{"IS_THIS_MODEL_A_QUADBIKE", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_QUADBIKE>},
+		{"IS_THIS_MODEL_A_TRAIN", native_function<LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_TRAIN>},
+		{"IS_TOGGLE_MOD_ON", native_function<LUA_NATIVE_VEHICLE_IS_TOGGLE_MOD_ON>},
+		{"IS_TURRET_SEAT", native_function<LUA_NATIVE_VEHICLE_IS_TURRET_SEAT>},
+		{"IS_VEHICLE_ALARM_ACTIVATED", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_ALARM_ACTIVATED>},
+		{"IS_VEHICLE_ATTACHED_TO_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_ATTACHED_TO_CARGOBOB>},
+		{"IS_VEHICLE_ATTACHED_TO_TOW_TRUCK", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_ATTACHED_TO_TOW_TRUCK>},
+		{"IS_VEHICLE_ATTACHED_TO_TRAILER", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_ATTACHED_TO_TRAILER>},
+		{"IS_VEHICLE_A_CONVERTIBLE", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_A_CONVERTIBLE>},
+		{"IS_VEHICLE_BEING_BROUGHT_TO_HALT", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_BEING_BROUGHT_TO_HALT>},
+		{"IS_VEHICLE_BUMPER_BOUNCING", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_BUMPER_BOUNCING>},
+		{"IS_VEHICLE_BUMPER_BROKEN_OFF", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_BUMPER_BROKEN_OFF>},
+		{"IS_VEHICLE_DOOR_DAMAGED", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_DOOR_DAMAGED>},
+		{"IS_VEHICLE_DOOR_FULLY_OPEN", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_DOOR_FULLY_OPEN>},
+		{"IS_VEHICLE_DRIVEABLE", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_DRIVEABLE>},
+		{"IS_VEHICLE_EXTRA_TURNED_ON", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_EXTRA_TURNED_ON>},
+		{"IS_VEHICLE_GEN9_EXCLUSIVE_MODEL_", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_GEN9_EXCLUSIVE_MODEL_>},
+		{"IS_VEHICLE_HIGH_DETAIL", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_HIGH_DETAIL>},
+		{"IS_VEHICLE_IN_BURNOUT", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_IN_BURNOUT>},
+		{"IS_VEHICLE_IN_GARAGE_AREA", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_IN_GARAGE_AREA>},
+		{"IS_VEHICLE_IN_SUBMARINE_MODE", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_IN_SUBMARINE_MODE>},
+		{"IS_VEHICLE_MODEL", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_MODEL>},
+		{"IS_VEHICLE_MOD_GEN9_EXCLUSIVE", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_MOD_GEN9_EXCLUSIVE>},
+		{"IS_VEHICLE_ON_ALL_WHEELS", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_ON_ALL_WHEELS>},
+		{"IS_VEHICLE_PARACHUTE_DEPLOYED", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_PARACHUTE_DEPLOYED>},
+		{"IS_VEHICLE_PRODUCING_SLIP_STREAM", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_PRODUCING_SLIP_STREAM>},
+		{"IS_VEHICLE_SEARCHLIGHT_ON", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_SEARCHLIGHT_ON>},
+		{"IS_VEHICLE_SEAT_FREE", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_SEAT_FREE>},
+		{"IS_VEHICLE_SIREN_AUDIO_ON", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_SIREN_AUDIO_ON>},
+		{"IS_VEHICLE_SIREN_ON", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_SIREN_ON>},
+		{"IS_VEHICLE_SPRAYABLE", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_SPRAYABLE>},
+		{"IS_VEHICLE_STOLEN", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_STOLEN>},
+		{"IS_VEHICLE_STOPPED", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_STOPPED>},
+		{"IS_VEHICLE_STOPPED_AT_TRAFFIC_LIGHTS", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_STOPPED_AT_TRAFFIC_LIGHTS>},
+		{"IS_VEHICLE_STUCK_ON_ROOF", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_STUCK_ON_ROOF>},
+		{"IS_VEHICLE_STUCK_TIMER_UP", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_STUCK_TIMER_UP>},
+		{"IS_VEHICLE_TYRE_BURST", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_TYRE_BURST>},
+		{"IS_VEHICLE_VISIBLE", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_VISIBLE>},
+		{"IS_VEHICLE_WEAPON_DISABLED", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_WEAPON_DISABLED>},
+		{"IS_VEHICLE_WINDOW_INTACT", native_function<LUA_NATIVE_VEHICLE_IS_VEHICLE_WINDOW_INTACT>},
+		{"LOCK_DOORS_WHEN_NO_LONGER_NEEDED", native_function<LUA_NATIVE_VEHICLE_LOCK_DOORS_WHEN_NO_LONGER_NEEDED>},
+		{"LOWER_CONVERTIBLE_ROOF", native_function<LUA_NATIVE_VEHICLE_LOWER_CONVERTIBLE_ROOF>},
+		{"LOWER_FORKLIFT_FORKS", native_function<LUA_NATIVE_VEHICLE_LOWER_FORKLIFT_FORKS>},
+		{"MODIFY_VEHICLE_TOP_SPEED", native_function<LUA_NATIVE_VEHICLE_MODIFY_VEHICLE_TOP_SPEED>},
+		{"NETWORK_CAP_EMPTY_CROWDING_VEHICLES_REMOVAL", native_function<LUA_NATIVE_VEHICLE_NETWORK_CAP_EMPTY_CROWDING_VEHICLES_REMOVAL>},
+		{"NETWORK_ENABLE_EMPTY_CROWDING_VEHICLES_REMOVAL", native_function<LUA_NATIVE_VEHICLE_NETWORK_ENABLE_EMPTY_CROWDING_VEHICLES_REMOVAL>},
+		{"NETWORK_USE_HIGH_PRECISION_TRAIN_BLENDING", native_function<LUA_NATIVE_VEHICLE_NETWORK_USE_HIGH_PRECISION_TRAIN_BLENDING>},
+		{"OPEN_BOMB_BAY_DOORS", native_function<LUA_NATIVE_VEHICLE_OPEN_BOMB_BAY_DOORS>},
+		{"OVERRIDE_PLANE_DAMAGE_THREHSOLD", native_function<LUA_NATIVE_VEHICLE_OVERRIDE_PLANE_DAMAGE_THREHSOLD>},
+		{"PAUSE_PLAYBACK_RECORDED_VEHICLE", native_function<LUA_NATIVE_VEHICLE_PAUSE_PLAYBACK_RECORDED_VEHICLE>},
+		{"POP_OFF_VEHICLE_ROOF_WITH_IMPULSE", native_function<LUA_NATIVE_VEHICLE_POP_OFF_VEHICLE_ROOF_WITH_IMPULSE>},
+		{"POP_OUT_VEHICLE_WINDSCREEN", native_function<LUA_NATIVE_VEHICLE_POP_OUT_VEHICLE_WINDSCREEN>},
+		{"PRELOAD_VEHICLE_MOD", native_function<LUA_NATIVE_VEHICLE_PRELOAD_VEHICLE_MOD>},
+		{"RAISE_CONVERTIBLE_ROOF", native_function<LUA_NATIVE_VEHICLE_RAISE_CONVERTIBLE_ROOF>},
+		{"RELEASE_PRELOAD_MODS", native_function<LUA_NATIVE_VEHICLE_RELEASE_PRELOAD_MODS>},
+		{"REMOVE_PICK_UP_ROPE_FOR_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_REMOVE_PICK_UP_ROPE_FOR_CARGOBOB>},
+		{"REMOVE_ROAD_NODE_SPEED_ZONE", native_function<LUA_NATIVE_VEHICLE_REMOVE_ROAD_NODE_SPEED_ZONE>},
+		{"REMOVE_VEHICLES_FROM_GENERATORS_IN_AREA", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLES_FROM_GENERATORS_IN_AREA>},
+		{"REMOVE_VEHICLE_ASSET", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_ASSET>},
+		{"REMOVE_VEHICLE_COMBAT_AVOIDANCE_AREA", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_COMBAT_AVOIDANCE_AREA>},
+		{"REMOVE_VEHICLE_HIGH_DETAIL_MODEL", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_HIGH_DETAIL_MODEL>},
+		{"REMOVE_VEHICLE_MOD", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_MOD>},
+		{"REMOVE_VEHICLE_RECORDING", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_RECORDING>},
+		{"REMOVE_VEHICLE_STUCK_CHECK", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_STUCK_CHECK>},
+		{"REMOVE_VEHICLE_UPSIDEDOWN_CHECK", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_UPSIDEDOWN_CHECK>},
+		{"REMOVE_VEHICLE_WINDOW", native_function<LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_WINDOW>},
+		{"REQUEST_VEHICLE_ASSET", native_function<LUA_NATIVE_VEHICLE_REQUEST_VEHICLE_ASSET>},
+		{"REQUEST_VEHICLE_DIAL", native_function<LUA_NATIVE_VEHICLE_REQUEST_VEHICLE_DIAL>},
+		{"REQUEST_VEHICLE_HIGH_DETAIL_MODEL", native_function<LUA_NATIVE_VEHICLE_REQUEST_VEHICLE_HIGH_DETAIL_MODEL>},
+		{"REQUEST_VEHICLE_RECORDING", native_function<LUA_NATIVE_VEHICLE_REQUEST_VEHICLE_RECORDING>},
+		{"RESET_FORMATION_LEADER", native_function<LUA_NATIVE_VEHICLE_RESET_FORMATION_LEADER>},
+		{"RESET_VEHICLE_STUCK_TIMER", native_function<LUA_NATIVE_VEHICLE_RESET_VEHICLE_STUCK_TIMER>},
+		{"RESET_VEHICLE_WHEELS", native_function<LUA_NATIVE_VEHICLE_RESET_VEHICLE_WHEELS>},
+		{"ROLL_DOWN_WINDOW", native_function<LUA_NATIVE_VEHICLE_ROLL_DOWN_WINDOW>},
+		{"ROLL_DOWN_WINDOWS", native_function<LUA_NATIVE_VEHICLE_ROLL_DOWN_WINDOWS>},
+		{"ROLL_UP_WINDOW", native_function<LUA_NATIVE_VEHICLE_ROLL_UP_WINDOW>},
+		{"SET_ADDITIONAL_ROTATION_FOR_RECORDED_VEHICLE_PLAYBACK", native_function<LUA_NATIVE_VEHICLE_SET_ADDITIONAL_ROTATION_FOR_RECORDED_VEHICLE_PLAYBACK>},
+		{"SET_AIRCRAFT_IGNORE_HIGHTMAP_OPTIMISATION", native_function<LUA_NATIVE_VEHICLE_SET_AIRCRAFT_IGNORE_HIGHTMAP_OPTIMISATION>},
+		{"SET_AIRCRAFT_PILOT_SKILL_NOISE_SCALAR", native_function<LUA_NATIVE_VEHICLE_SET_AIRCRAFT_PILOT_SKILL_NOISE_SCALAR>},
+		{"SET_ALLOW_COLLISION_WHEN_IN_VEHICLE_", native_function<LUA_NATIVE_VEHICLE_SET_ALLOW_COLLISION_WHEN_IN_VEHICLE_>},
+		{"SET_ALLOW_RAMMING_SOOP_OR_RAMP", native_function<LUA_NATIVE_VEHICLE_SET_ALLOW_RAMMING_SOOP_OR_RAMP>},
+		{"SET_ALLOW_VEHICLE_EXPLODES_ON_CONTACT", native_function<LUA_NATIVE_VEHICLE_SET_ALLOW_VEHICLE_EXPLODES_ON_CONTACT>},
+		{"SET_ALL_LOW_PRIORITY_VEHICLE_GENERATORS_ACTIVE", native_function<LUA_NATIVE_VEHICLE_SET_ALL_LOW_PRIORITY_VEHICLE_GENERATORS_ACTIVE>},
+		{"SET_ALL_VEHICLE_GENERATORS_ACTIVE", native_function<LUA_NATIVE_VEHICLE_SET_ALL_VEHICLE_GENERATORS_ACTIVE>},
+		{"SET_ALL_VEHICLE_GENERATORS_ACTIVE_IN_AREA", native_function<LUA_NATIVE_VEHICLE_SET_ALL_VEHICLE_GENERATORS_ACTIVE_IN_AREA>},
+		{"SET_AMBIENT_VEHICLE_NEON_ENABLED", native_function<LUA_NATIVE_VEHICLE_SET_AMBIENT_VEHICLE_NEON_ENABLED>},
+		{"SET_AMBIENT_VEHICLE_RANGE_MULTIPLIER_THIS_FRAME", native_function<LUA_NATIVE_VEHICLE_SET_AMBIENT_VEHICLE_RANGE_MULTIPLIER_THIS_FRAME>},
+		{"SET_ARRIVE_DISTANCE_OVERRIDE_FOR_VEHICLE_PERSUIT_ATTACK", native_function<LUA_NATIVE_VEHICLE_SET_ARRIVE_DISTANCE_OVERRIDE_FOR_VEHICLE_PERSUIT_ATTACK>},
+		{"SET_ATTACHED_VEHICLE_TO_TOW_TRUCK_ARM_", native_function<LUA_NATIVE_VEHICLE_SET_ATTACHED_VEHICLE_TO_TOW_TRUCK_ARM_>},
+		{"SET_BIKE_EASY_TO_LAND", native_function<LUA_NATIVE_VEHICLE_SET_BIKE_EASY_TO_LAND>},
+		{"SET_BIKE_ON_STAND", native_function<LUA_NATIVE_VEHICLE_SET_BIKE_ON_STAND>},
+		{"SET_BOAT_ANCHOR", native_function<LUA_NATIVE_VEHICLE_SET_BOAT_ANCHOR>},
+		{"SET_BOAT_DISABLE_AVOIDANCE", native_function<LUA_NATIVE_VEHICLE_SET_BOAT_DISABLE_AVOIDANCE>},
+		{"SET_BOAT_IGNORE_LAND_PROBES", native_function<LUA_NATIVE_VEHICLE_SET_BOAT_IGNORE_LAND_PROBES>},
+		{"SET_BOAT_LOW_LOD_ANCHOR_DISTANCE", native_function<LUA_NATIVE_VEHICLE_SET_BOAT_LOW_LOD_ANCHOR_DISTANCE>},
+		{"SET_BOAT_REMAINS_ANCHORED_WHILE_PLAYER_IS_DRIVER", native_function<LUA_NATIVE_VEHICLE_SET_BOAT_REMAINS_ANCHORED_WHILE_PLAYER_IS_DRIVER>},
+		{"SET_BOAT_SINKS_WHEN_WRECKED", native_function<LUA_NATIVE_VEHICLE_SET_BOAT_SINKS_WHEN_WRECKED>},
+		{"SET_BOAT_WRECKED", native_function<LUA_NATIVE_VEHICLE_SET_BOAT_WRECKED>},
+		{"SET_BOUNDS_AFFECT_WATER_PROBES_", native_function<LUA_NATIVE_VEHICLE_SET_BOUNDS_AFFECT_WATER_PROBES_>},
+		{"SET_CAN_ADJUST_GROUND_CLEARANCE", native_function<LUA_NATIVE_VEHICLE_SET_CAN_ADJUST_GROUND_CLEARANCE>},
+		{"SET_CAN_RESPRAY_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SET_CAN_RESPRAY_VEHICLE>},
+		{"SET_CAN_USE_HYDRAULICS", native_function<LUA_NATIVE_VEHICLE_SET_CAN_USE_HYDRAULICS>},
+		{"SET_CARGOBOB_EXCLUDE_FROM_PICKUP_ENTITY", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_EXCLUDE_FROM_PICKUP_ENTITY>},
+		{"SET_CARGOBOB_EXTA_PICKUP_RANGE", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_EXTA_PICKUP_RANGE>},
+		{"SET_CARGOBOB_FORCE_DONT_DETACH_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_FORCE_DONT_DETACH_VEHICLE>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_ACTIVE", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_ACTIVE>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_ENSURE_PICKUP_ENTITY_UPRIGHT", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_ENSURE_PICKUP_ENTITY_UPRIGHT>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_FALLOFF", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_FALLOFF>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_PULL_ROPE_LENGTH", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_PULL_ROPE_LENGTH>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_PULL_STRENGTH", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_PULL_STRENGTH>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_REDUCED_FALLOFF", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_REDUCED_FALLOFF>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_REDUCED_STRENGTH", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_REDUCED_STRENGTH>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_SET_AMBIENT_MODE", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_SET_AMBIENT_MODE>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_SET_TARGETED_MODE", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_SET_TARGETED_MODE>},
+		{"SET_CARGOBOB_PICKUP_MAGNET_STRENGTH", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_STRENGTH>},
+		{"SET_CARGOBOB_PICKUP_ROPE_DAMPING_MULTIPLIER", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_ROPE_DAMPING_MULTIPLIER>},
+		{"SET_CARGOBOB_PICKUP_ROPE_TYPE", native_function<LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_ROPE_TYPE>},
+		{"SET_CARJACK_MISSION_REMOVAL_PARAMETERS", native_function<LUA_NATIVE_VEHICLE_SET_CARJACK_MISSION_REMOVAL_PARAMETERS>},
+		{"SET_CAR_BOOT_OPEN", native_function<LUA_NATIVE_VEHICLE_SET_CAR_BOOT_OPEN>},
+		{"SET_CAR_HIGH_SPEED_BUMP_SEVERITY_MULTIPLIER", native_function<LUA_NATIVE_VEHICLE_SET_CAR_HIGH_SPEED_BUMP_SEVERITY_MULTIPLIER>},
+		{"SET_CHECK_FOR_ENOUGH_ROOM_FOR_PED", native_function<LUA_NATIVE_VEHICLE_SET_CHECK_FOR_ENOUGH_ROOM_FOR_PED>},
+		{"SET_CLEAR_FREEZE_WAITING_ON_COLLISION_ONCE_PLAYER_ENTERS", native_function<LUA_NATIVE_VEHICLE_SET_CLEAR_FREEZE_WAITING_ON_COLLISION_ONCE_PLAYER_ENTERS>},
+		{"SET_CONVERTIBLE_ROOF", native_function<LUA_NATIVE_VEHICLE_SET_CONVERTIBLE_ROOF>},
+		{"SET_CONVERTIBLE_ROOF_LATCH_STATE", native_function<LUA_NATIVE_VEHICLE_SET_CONVERTIBLE_ROOF_LATCH_STATE>},
+		{"SET_DEPLOY_FOLDING_WINGS", native_function<LUA_NATIVE_VEHICLE_SET_DEPLOY_FOLDING_WINGS>},
+		{"SET_DEPLOY_MISSILE_BAYS_", native_function<LUA_NATIVE_VEHICLE_SET_DEPLOY_MISSILE_BAYS_>},
+		{"SET_DIP_STRAIGHT_DOWN_WHEN_CRASHING_PLANE", native_function<LUA_NATIVE_VEHICLE_SET_DIP_STRAIGHT_DOWN_WHEN_CRASHING_PLANE>},
+		{"SET_DISABLE_AUTOMATIC_CRASH_TASK", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_AUTOMATIC_CRASH_TASK>},
+		{"SET_DISABLE_BMX_EXTRA_TRICK_FORCES", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_BMX_EXTRA_TRICK_FORCES>},
+		{"SET_DISABLE_DAMAGE_WITH_PICKED_UP_ENTITY", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_DAMAGE_WITH_PICKED_UP_ENTITY>},
+		{"SET_DISABLE_EXPLODE_FROM_BODY_DAMAGE_ON_COLLISION", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_EXPLODE_FROM_BODY_DAMAGE_ON_COLLISION>},
+		{"SET_DISABLE_HELI_EXPLODE_FROM_BODY_DAMAGE", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_HELI_EXPLODE_FROM_BODY_DAMAGE>},
+		{"SET_DISABLE_HOVER_MODE_FLIGHT", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_HOVER_MODE_FLIGHT>},
+		{"SET_DISABLE_MAP_COLLISION", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_MAP_COLLISION>},
+		{"SET_DISABLE_PED_STAND_ON_TOP", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_PED_STAND_ON_TOP>},
+		{"SET_DISABLE_PRETEND_OCCUPANTS", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_PRETEND_OCCUPANTS>},
+		{"SET_DISABLE_RANDOM_TRAINS_THIS_FRAME", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_RANDOM_TRAINS_THIS_FRAME>},
+		{"SET_DISABLE_RETRACTING_WEAPON_BLADES", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_RETRACTING_WEAPON_BLADES>},
+		{"SET_DISABLE_SUPERDUMMY", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_SUPERDUMMY>},
+		{"SET_DISABLE_TURRET_MOVEMENT", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_TURRET_MOVEMENT>},
+		{"SET_DISABLE_VEHICLE_ENGINE_FIRES", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_VEHICLE_ENGINE_FIRES>},
+		{"SET_DISABLE_VEHICLE_EXPLOSIONS_DAMAGE", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_VEHICLE_EXPLOSIONS_DAMAGE>},
+		{"SET_DISABLE_VEHICLE_PETROL_TANK_DAMAGE", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_VEHICLE_PETROL_TANK_DAMAGE>},
+		{"SET_DISABLE_VEHICLE_PETROL_TANK_FIRES", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_VEHICLE_PETROL_TANK_FIRES>},
+		{"SET_DISABLE_VERTICAL_FLIGHT_MODE_TRANSITION", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_VERTICAL_FLIGHT_MODE_TRANSITION>},
+		{"SET_DISABLE_WANTED_CONES_RESPONSE", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_WANTED_CONES_RESPONSE>},
+		{"SET_DISABLE_WEAPON_BLADE_FORCES", native_function<LUA_NATIVE_VEHICLE_SET_DISABLE_WEAPON_BLADE_FORCES>},
+		{"SET_DISTANT_CARS_ENABLED", native_function<LUA_NATIVE_VEHICLE_SET_DISTANT_CARS_ENABLED>},
+		{"SET_DONT_ALLOW_PLAYER_TO_ENTER_VEHICLE_IF_LOCKED_FOR_PLAYER", native_function<LUA_NATIVE_VEHICLE_SET_DONT_ALLOW_PLAYER_TO_ENTER_VEHICLE_IF_LOCKED_FOR_PLAYER>},
+		{"SET_DONT_PROCESS_VEHICLE_GLASS", native_function<LUA_NATIVE_VEHICLE_SET_DONT_PROCESS_VEHICLE_GLASS>},
+		{"SET_DOOR_ALLOWED_TO_BE_BROKEN_OFF", native_function<LUA_NATIVE_VEHICLE_SET_DOOR_ALLOWED_TO_BE_BROKEN_OFF>},
+		{"SET_DRIFT_SLIP_ANGLE_LIMITS_", native_function<LUA_NATIVE_VEHICLE_SET_DRIFT_SLIP_ANGLE_LIMITS_>},
+		{"SET_DRIFT_TYRES", native_function<LUA_NATIVE_VEHICLE_SET_DRIFT_TYRES>},
+		{"SET_ENABLE_VEHICLE_SLIPSTREAMING", native_function<LUA_NATIVE_VEHICLE_SET_ENABLE_VEHICLE_SLIPSTREAMING>},
+		{"SET_FAR_DRAW_VEHICLES", native_function<LUA_NATIVE_VEHICLE_SET_FAR_DRAW_VEHICLES>},
+		{"SET_FLEEING_VEHICLES_USE_SWITCHED_OFF_NODES", native_function<LUA_NATIVE_VEHICLE_SET_FLEEING_VEHICLES_USE_SWITCHED_OFF_NODES>},
+		{"SET_FORCE_FIX_LINK_MATRICES", native_function<LUA_NATIVE_VEHICLE_SET_FORCE_FIX_LINK_MATRICES>},
+		{"SET_FORCE_HD_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SET_FORCE_HD_VEHICLE>},
+		{"SET_FORCE_LOW_LOD_ANCHOR_MODE", native_function<LUA_NATIVE_VEHICLE_SET_FORCE_LOW_LOD_ANCHOR_MODE>},
+		{"SET_FORCE_VEHICLE_ENGINE_DAMAGE_BY_BULLET", native_function<LUA_NATIVE_VEHICLE_SET_FORCE_VEHICLE_ENGINE_DAMAGE_BY_BULLET>},
+		{"SET_FORKLIFT_FORK_HEIGHT", native_function<LUA_NATIVE_VEHICLE_SET_FORKLIFT_FORK_HEIGHT>},
+		{"SET_FORMATION_LEADER", native_function<LUA_NATIVE_VEHICLE_SET_FORMATION_LEADER>},
+		{"SET_GARBAGE_TRUCKS", native_function<LUA_NATIVE_VEHICLE_SET_GARBAGE_TRUCKS>},
+		{"SET_GLIDER_ACTIVE", native_function<LUA_NATIVE_VEHICLE_SET_GLIDER_ACTIVE>},
+		{"SET_GLOBAL_POSITION_OFFSET_FOR_RECORDED_VEHICLE_PLAYBACK", native_function<LUA_NATIVE_VEHICLE_SET_GLOBAL_POSITION_OFFSET_FOR_RECORDED_VEHICLE_PLAYBACK>},
+		{"SET_GOON_BOSS_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SET_GOON_BOSS_VEHICLE>},
+		{"SET_GROUND_EFFECT_REDUCES_DRAG", native_function<LUA_NATIVE_VEHICLE_SET_GROUND_EFFECT_REDUCES_DRAG>},
+		{"SET_HELI_BLADES_FULL_SPEED", native_function<LUA_NATIVE_VEHICLE_SET_HELI_BLADES_FULL_SPEED>},
+		{"SET_HELI_BLADES_SPEED", native_function<LUA_NATIVE_VEHICLE_SET_HELI_BLADES_SPEED>},
+		{"SET_HELI_CAN_PICKUP_ENTITY_THAT_HAS_PICK_UP_DISABLED", native_function<LUA_NATIVE_VEHICLE_SET_HELI_CAN_PICKUP_ENTITY_THAT_HAS_PICK_UP_DISABLED>},
+		{"SET_HELI_COMBAT_OFFSET", native_function<LUA_NATIVE_VEHICLE_SET_HELI_COMBAT_OFFSET>},
+		{"SET_HELI_CONTROL_LAGGING_RATE_SCALAR", native_function<LUA_NATIVE_VEHICLE_SET_HELI_CONTROL_LAGGING_RATE_SCALAR>},
+		{"SET_HELI_MAIN_ROTOR_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_HELI_MAIN_ROTOR_HEALTH>},
+		{"SET_HELI_RESIST_TO_EXPLOSION", native_function<LUA_NATIVE_VEHICLE_SET_HELI_RESIST_TO_EXPLOSION>},
+		{"SET_HELI_TAIL_BOOM_CAN_BREAK_OFF", native_function<LUA_NATIVE_VEHICLE_SET_HELI_TAIL_BOOM_CAN_BREAK_OFF>},
+		{"SET_HELI_TAIL_ROTOR_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_HELI_TAIL_ROTOR_HEALTH>},
+		{"SET_HELI_TURBULENCE_SCALAR", native_function<LUA_NATIVE_VEHICLE_SET_HELI_TURBULENCE_SCALAR>},
+		{"SET_HOVER_MODE_WING_RATIO", native_function<LUA_NATIVE_VEHICLE_SET_HOVER_MODE_WING_RATIO>},
+		{"SET_HYDRAULICS_CONTROL", native_function<LUA_NATIVE_VEHICLE_SET_HYDRAULICS_CONTROL>},
+		{"SET_HYDRAULIC_SUSPENSION_RAISE_FACTOR", native_function<LUA_NATIVE_VEHICLE_SET_HYDRAULIC_SUSPENSION_RAISE_FACTOR>},
+		{"SET_HYDRAULIC_VEHICLE_STATE", native_function<LUA_NATIVE_VEHICLE_SET_HYDRAULIC_VEHICLE_STATE>},
+		{"SET_HYDRAULIC_WHEEL_STATE", native_function<LUA_NATIVE_VEHICLE_SET_HYDRAULIC_WHEEL_STATE>},
+		{"SET_IGNORE_PLANES_SMALL_PITCH_CHANGE", native_function<LUA_NATIVE_VEHICLE_SET_IGNORE_PLANES_SMALL_PITCH_CHANGE>},
+		{"SET_INCREASE_WHEEL_CRUSH_DAMAGE", native_function<LUA_NATIVE_VEHICLE_SET_INCREASE_WHEEL_CRUSH_DAMAGE>},
+		{"SET_INVERT_VEHICLE_CONTROLS", native_function<LUA_NATIVE_VEHICLE_SET_INVERT_VEHICLE_CONTROLS>},
+		{"SET_LAST_DRIVEN_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SET_LAST_DRIVEN_VEHICLE>},
+		{"SET_LIGHTS_CUTOFF_DISTANCE_TWEAK", native_function<LUA_NATIVE_VEHICLE_SET_LIGHTS_CUTOFF_DISTANCE_TWEAK>},
+		{"SET_MINIMUM_TIME_BETWEEN_GEAR_SHIFTS_", native_function<LUA_NATIVE_VEHICLE_SET_MINIMUM_TIME_BETWEEN_GEAR_SHIFTS_>},
+		{"SET_MISSION_TRAIN_AS_NO_LONGER_NEEDED", native_function<LUA_NATIVE_VEHICLE_SET_MISSION_TRAIN_AS_NO_LONGER_NEEDED>},
+		{"SET_MISSION_TRAIN_COORDS", native_function<LUA_NATIVE_VEHICLE_SET_MISSION_TRAIN_COORDS>},
+		{"SET_NITROUS_IS_ACTIVE", native_function<LUA_NATIVE_VEHICLE_SET_NITROUS_IS_ACTIVE>},
+		{"SET_NUMBER_OF_PARKED_VEHICLES", native_function<LUA_NATIVE_VEHICLE_SET_NUMBER_OF_PARKED_VEHICLES>},
+		{"SET_OPEN_REAR_DOORS_ON_EXPLOSION", native_function<LUA_NATIVE_VEHICLE_SET_OPEN_REAR_DOORS_ON_EXPLOSION>},
+		{"SET_OVERRIDE_NITROUS_LEVEL", native_function<LUA_NATIVE_VEHICLE_SET_OVERRIDE_NITROUS_LEVEL>},
+		{"SET_OVERRIDE_TRACTION_LOSS_MULTIPLIER_", native_function<LUA_NATIVE_VEHICLE_SET_OVERRIDE_TRACTION_LOSS_MULTIPLIER_>},
+		{"SET_OVERRIDE_VEHICLE_DOOR_TORQUE", native_function<LUA_NATIVE_VEHICLE_SET_OVERRIDE_VEHICLE_DOOR_TORQUE>},
+		{"SET_PARKED_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME", native_function<LUA_NATIVE_VEHICLE_SET_PARKED_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME>},
+		{"SET_PEDS_CAN_FALL_OFF_THIS_VEHICLE_FROM_LARGE_FALL_DAMAGE", native_function<LUA_NATIVE_VEHICLE_SET_PEDS_CAN_FALL_OFF_THIS_VEHICLE_FROM_LARGE_FALL_DAMAGE>},
+		{"SET_PICKUP_ROPE_LENGTH_FOR_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_SET_PICKUP_ROPE_LENGTH_FOR_CARGOBOB>},
+		{"SET_PICKUP_ROPE_LENGTH_WITHOUT_CREATING_ROPE_FOR_CARGOBOB", native_function<LUA_NATIVE_VEHICLE_SET_PICKUP_ROPE_LENGTH_WITHOUT_CREATING_ROPE_FOR_CARGOBOB>},
+		{"SET_PLANE_ENGINE_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_PLANE_ENGINE_HEALTH>},
+		{"SET_PLANE_PROPELLER_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_PLANE_PROPELLER_HEALTH>},
+		{"SET_PLANE_RESIST_TO_EXPLOSION", native_function<LUA_NATIVE_VEHICLE_SET_PLANE_RESIST_TO_EXPLOSION>},
+		{"SET_PLANE_SECTION_DAMAGE_SCALE", native_function<LUA_NATIVE_VEHICLE_SET_PLANE_SECTION_DAMAGE_SCALE>},
+		{"SET_PLANE_TURBULENCE_MULTIPLIER", native_function<LUA_NATIVE_VEHICLE_SET_PLANE_TURBULENCE_MULTIPLIER>},
+		{"SET_PLAYBACK_SPEED", native_function<LUA_NATIVE_VEHICLE_SET_PLAYBACK_SPEED>},
+		{"SET_PLAYBACK_TO_USE_AI", native_function<LUA_NATIVE_VEHICLE_SET_PLAYBACK_TO_USE_AI>},
+		{"SET_PLAYBACK_TO_USE_AI_TRY_TO_REVERT_BACK_LATER", native_function<LUA_NATIVE_VEHICLE_SET_PLAYBACK_TO_USE_AI_TRY_TO_REVERT_BACK_LATER>},
+		{"SET_PLAYERS_LAST_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SET_PLAYERS_LAST_VEHICLE>},
+		{"SET_POLICE_FOCUS_WILL_TRACK_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SET_POLICE_FOCUS_WILL_TRACK_VEHICLE>},
+		{"SET_POSITION_OFFSET_FOR_RECORDED_VEHICLE_PLAYBACK", native_function<LUA_NATIVE_VEHICLE_SET_POSITION_OFFSET_FOR_RECORDED_VEHICLE_PLAYBACK>},
+		{"SET_RANDOM_BOATS", native_function<LUA_NATIVE_VEHICLE_SET_RANDOM_BOATS>},
+		{"SET_RANDOM_BOATS_MP", native_function<LUA_NATIVE_VEHICLE_SET_RANDOM_BOATS_MP>},
+		{"SET_RANDOM_TRAINS", native_function<LUA_NATIVE_VEHICLE_SET_RANDOM_TRAINS>},
+		{"SET_RANDOM_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME", native_function<LUA_NATIVE_VEHICLE_SET_RANDOM_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME>},
+		{"SET_REDUCED_SUSPENSION_FORCE", native_function<LUA_NATIVE_VEHICLE_SET_REDUCED_SUSPENSION_FORCE>},
+		{"SET_RENDER_TRAIN_AS_DERAILED", native_function<LUA_NATIVE_VEHICLE_SET_RENDER_TRAIN_AS_DERAILED>},
+		{"SET_ROCKET_BOOST_ACTIVE", native_function<LUA_NATIVE_VEHICLE_SET_ROCKET_BOOST_ACTIVE>},
+		{"SET_ROCKET_BOOST_FILL", native_function<LUA_NATIVE_VEHICLE_SET_ROCKET_BOOST_FILL>},
+		{"SET_SCRIPT_RAMP_IMPULSE_SCALE", native_function<LUA_NATIVE_VEHICLE_SET_SCRIPT_RAMP_IMPULSE_SCALE>},
+		{"SET_SCRIPT_ROCKET_BOOST_RECHARGE_TIME", native_function<LUA_NATIVE_VEHICLE_SET_SCRIPT_ROCKET_BOOST_RECHARGE_TIME>},
+		{"SET_SCRIPT_VEHICLE_GENERATOR", native_function<LUA_NATIVE_VEHICLE_SET_SCRIPT_VEHICLE_GENERATOR>},
+		{"SET_SHORT_SLOWDOWN_FOR_LANDING", native_function<LUA_NATIVE_VEHICLE_SET_SHORT_SLOWDOWN_FOR_LANDING>},
+		{"SET_SHOULD_LERP_FROM_AI_TO_FULL_RECORDING", native_function<LUA_NATIVE_VEHICLE_SET_SHOULD_LERP_FROM_AI_TO_FULL_RECORDING>},
+		{"SET_SHOULD_RESET_TURRET_IN_SCRIPTED_CAMERAS", native_function<LUA_NATIVE_VEHICLE_SET_SHOULD_RESET_TURRET_IN_SCRIPTED_CAMERAS>},
+		{"SET_SLOW_DOWN_EFFECT_DISABLED", native_function<LUA_NATIVE_VEHICLE_SET_SLOW_DOWN_EFFECT_DISABLED>},
+		{"SET_SPECIAL_FLIGHT_MODE_ALLOWED", native_function<LUA_NATIVE_VEHICLE_SET_SPECIAL_FLIGHT_MODE_ALLOWED>},
+		{"SET_SPECIAL_FLIGHT_MODE_RATIO", native_function<LUA_NATIVE_VEHICLE_SET_SPECIAL_FLIGHT_MODE_RATIO>},
+		{"SET_SPECIAL_FLIGHT_MODE_TARGET_RATIO", native_function<LUA_NATIVE_VEHICLE_SET_SPECIAL_FLIGHT_MODE_TARGET_RATIO>},
+		{"SET_SPEED_BOOST_EFFECT_DISABLED", native_function<LUA_NATIVE_VEHICLE_SET_SPEED_BOOST_EFFECT_DISABLED>},
+		{"SET_SUBMARINE_CRUSH_DEPTHS", native_function<LUA_NATIVE_VEHICLE_SET_SUBMARINE_CRUSH_DEPTHS>},
+		{"SET_TASK_VEHICLE_GOTO_PLANE_MIN_HEIGHT_ABOVE_TERRAIN", native_function<LUA_NATIVE_VEHICLE_SET_TASK_VEHICLE_GOTO_PLANE_MIN_HEIGHT_ABOVE_TERRAIN>},
+		{"SET_TAXI_LIGHTS", native_function<LUA_NATIVE_VEHICLE_SET_TAXI_LIGHTS>},
+		{"SET_TRAILER_ATTACHMENT_ENABLED", native_function<LUA_NATIVE_VEHICLE_SET_TRAILER_ATTACHMENT_ENABLED>},
+		{"SET_TRAILER_INVERSE_MASS_SCALE", native_function<LUA_NATIVE_VEHICLE_SET_TRAILER_INVERSE_MASS_SCALE>},
+		{"SET_TRAILER_LEGS_LOWERED", native_function<LUA_NATIVE_VEHICLE_SET_TRAILER_LEGS_LOWERED>},
+		{"SET_TRAILER_LEGS_RAISED", native_function<LUA_NATIVE_VEHICLE_SET_TRAILER_LEGS_RAISED>},
+		{"SET_TRAIN_CRUISE_SPEED", native_function<LUA_NATIVE_VEHICLE_SET_TRAIN_CRUISE_SPEED>},
+		{"SET_TRAIN_SPEED", native_function<LUA_NATIVE_VEHICLE_SET_TRAIN_SPEED>},
+		{"SET_TRAIN_TRACK_SPAWN_FREQUENCY", native_function<LUA_NATIVE_VEHICLE_SET_TRAIN_TRACK_SPAWN_FREQUENCY>},
+		{"SET_TRANSFORM_RATE_FOR_ANIMATION", native_function<LUA_NATIVE_VEHICLE_SET_TRANSFORM_RATE_FOR_ANIMATION>},
+		{"SET_TRANSFORM_TO_SUBMARINE_USES_ALTERNATE_INPUT", native_function<LUA_NATIVE_VEHICLE_SET_TRANSFORM_TO_SUBMARINE_USES_ALTERNATE_INPUT>},
+		{"SET_TRANSMISSION_REDUCED_GEAR_RATIO_", native_function<LUA_NATIVE_VEHICLE_SET_TRANSMISSION_REDUCED_GEAR_RATIO_>},
+		{"SET_TURRET_HIDDEN", native_function<LUA_NATIVE_VEHICLE_SET_TURRET_HIDDEN>},
+		{"SET_TYRE_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_TYRE_HEALTH>},
+		{"SET_TYRE_MAXIMUM_GRIP_DIFFERENCE_DUE_TO_WEAR_RATE", native_function<LUA_NATIVE_VEHICLE_SET_TYRE_MAXIMUM_GRIP_DIFFERENCE_DUE_TO_WEAR_RATE>},
+		{"SET_TYRE_WEAR_RATE", native_function<LUA_NATIVE_VEHICLE_SET_TYRE_WEAR_RATE>},
+		{"SET_TYRE_WEAR_RATE_SCALE", native_function<LUA_NATIVE_VEHICLE_SET_TYRE_WEAR_RATE_SCALE>},
+		{"SET_USE_DESIRED_Z_CRUISE_SPEED_FOR_LANDING", native_function<LUA_NATIVE_VEHICLE_SET_USE_DESIRED_Z_CRUISE_SPEED_FOR_LANDING>},
+		{"SET_USE_DOUBLE_CLICK_FOR_CAR_JUMP", native_function<LUA_NATIVE_VEHICLE_SET_USE_DOUBLE_CLICK_FOR_CAR_JUMP>},
+		{"SET_USE_HIGHER_CAR_JUMP", native_function<LUA_NATIVE_VEHICLE_SET_USE_HIGHER_CAR_JUMP>},
+		{"SET_VEHICLE_ACTIVE_DURING_PLAYBACK", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ACTIVE_DURING_PLAYBACK>},
+		{"SET_VEHICLE_ACTIVE_FOR_PED_NAVIGATION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ACTIVE_FOR_PED_NAVIGATION>},
+		{"SET_VEHICLE_ACT_AS_IF_HAS_SIREN_ON", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ACT_AS_IF_HAS_SIREN_ON>},
+		{"SET_VEHICLE_ACT_AS_IF_HIGH_SPEED_FOR_FRAG_SMASHING", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ACT_AS_IF_HIGH_SPEED_FOR_FRAG_SMASHING>},
+		{"SET_VEHICLE_AI_CAN_USE_EXCLUSIVE_SEATS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_AI_CAN_USE_EXCLUSIVE_SEATS>},
+		{"SET_VEHICLE_ALARM", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ALARM>},
+		{"SET_VEHICLE_ALLOW_HOMING_MISSLE_LOCKON", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ALLOW_HOMING_MISSLE_LOCKON>},
+		{"SET_VEHICLE_ALLOW_HOMING_MISSLE_LOCKON_SYNCED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ALLOW_HOMING_MISSLE_LOCKON_SYNCED>},
+		{"SET_VEHICLE_ALLOW_NO_PASSENGERS_LOCKON", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ALLOW_NO_PASSENGERS_LOCKON>},
+		{"SET_VEHICLE_AUTOMATICALLY_ATTACHES", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_AUTOMATICALLY_ATTACHES>},
+		{"SET_VEHICLE_AVOID_PLAYER_VEHICLE_RIOT_VAN_MISSION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_AVOID_PLAYER_VEHICLE_RIOT_VAN_MISSION>},
+		{"SET_VEHICLE_BLIP_THROTTLE_RANDOMLY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BLIP_THROTTLE_RANDOMLY>},
+		{"SET_VEHICLE_BOBBLEHEAD_VELOCITY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BOBBLEHEAD_VELOCITY>},
+		{"SET_VEHICLE_BODY_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BODY_HEALTH>},
+		{"SET_VEHICLE_BOMB_AMMO", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BOMB_AMMO>},
+		{"SET_VEHICLE_BRAKE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BRAKE>},
+		{"SET_VEHICLE_BRAKE_LIGHTS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BRAKE_LIGHTS>},
+		{"SET_VEHICLE_BROKEN_PARTS_DONT_AFFECT_AI_HANDLING", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BROKEN_PARTS_DONT_AFFECT_AI_HANDLING>},
+		{"SET_VEHICLE_BULLDOZER_ARM_POSITION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BULLDOZER_ARM_POSITION>},
+		{"SET_VEHICLE_BURNOUT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_BURNOUT>},
+		{"SET_VEHICLE_CAN_BE_TARGETTED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_BE_TARGETTED>},
+		{"SET_VEHICLE_CAN_BE_USED_BY_FLEEING_PEDS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_BE_USED_BY_FLEEING_PEDS>},
+		{"SET_VEHICLE_CAN_BE_VISIBLY_DAMAGED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_BE_VISIBLY_DAMAGED>},
+		{"SET_VEHICLE_CAN_BREAK", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_BREAK>},
+		{"SET_VEHICLE_CAN_DEFORM_WHEELS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_DEFORM_WHEELS>},
+		{"SET_VEHICLE_CAN_EJECT_PASSENGERS_IF_LOCKED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_EJECT_PASSENGERS_IF_LOCKED>},
+		{"SET_VEHICLE_CAN_ENGINE_MISSFIRE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_ENGINE_MISSFIRE>},
+		{"SET_VEHICLE_CAN_LEAK_OIL", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_LEAK_OIL>},
+		{"SET_VEHICLE_CAN_LEAK_PETROL", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_LEAK_PETROL>},
+		{"SET_VEHICLE_CAN_SAVE_IN_GARAGE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_SAVE_IN_GARAGE>},
+		{"SET_VEHICLE_CAUSES_SWERVING", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CAUSES_SWERVING>},
+		{"SET_VEHICLE_CEILING_HEIGHT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CEILING_HEIGHT>},
+		{"SET_VEHICLE_CHEAT_POWER_INCREASE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CHEAT_POWER_INCREASE>},
+		{"SET_VEHICLE_COLOURS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_COLOURS>},
+		{"SET_VEHICLE_COLOUR_COMBINATION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_COLOUR_COMBINATION>},
+		{"SET_VEHICLE_COMBAT_MODE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_COMBAT_MODE>},
+		{"SET_VEHICLE_COUNTERMEASURE_AMMO", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_COUNTERMEASURE_AMMO>},
+		{"SET_VEHICLE_CUSTOM_PATH_NODE_STREAMING_RADIUS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CUSTOM_PATH_NODE_STREAMING_RADIUS>},
+		{"SET_VEHICLE_CUSTOM_PRIMARY_COLOUR", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CUSTOM_PRIMARY_COLOUR>},
+		{"SET_VEHICLE_CUSTOM_SECONDARY_COLOUR", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_CUSTOM_SECONDARY_COLOUR>},
+		{"SET_VEHICLE_DAMAGE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DAMAGE>},
+		{"SET_VEHICLE_DAMAGE_SCALE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DAMAGE_SCALE>},
+		{"SET_VEHICLE_DAMAGE_SCALES", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DAMAGE_SCALES>},
+		{"SET_VEHICLE_DEFORMATION_FIXED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DEFORMATION_FIXED>},
+		{"SET_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME>},
+		{"SET_VEHICLE_DETONATION_MODE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DETONATION_MODE>},
+		{"SET_VEHICLE_DIRT_LEVEL", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DIRT_LEVEL>},
+		{"SET_VEHICLE_DISABLE_COLLISION_UPON_CREATION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DISABLE_COLLISION_UPON_CREATION>},
+		{"SET_VEHICLE_DISABLE_HEIGHT_MAP_AVOIDANCE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DISABLE_HEIGHT_MAP_AVOIDANCE>},
+		{"SET_VEHICLE_DISABLE_TOWING", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DISABLE_TOWING>},
+		{"SET_VEHICLE_DONT_TERMINATE_TASK_WHEN_ACHIEVED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DONT_TERMINATE_TASK_WHEN_ACHIEVED>},
+		{"SET_VEHICLE_DOORS_LOCKED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED>},
+		{"SET_VEHICLE_DOORS_LOCKED_FOR_ALL_PLAYERS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_ALL_PLAYERS>},
+		{"SET_VEHICLE_DOORS_LOCKED_FOR_ALL_TEAMS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_ALL_TEAMS>},
+		{"SET_VEHICLE_DOORS_LOCKED_FOR_NON_SCRIPT_PLAYERS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_NON_SCRIPT_PLAYERS>},
+		{"SET_VEHICLE_DOORS_LOCKED_FOR_PLAYER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_PLAYER>},
+		{"SET_VEHICLE_DOORS_LOCKED_FOR_TEAM", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_TEAM>},
+		{"SET_VEHICLE_DOORS_SHUT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_SHUT>},
+		{"SET_VEHICLE_DOOR_AUTO_LOCK", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_AUTO_LOCK>},
+		{"SET_VEHICLE_DOOR_BROKEN", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_BROKEN>},
+		{"SET_VEHICLE_DOOR_CONTROL", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_CONTROL>},
+		{"SET_VEHICLE_DOOR_LATCHED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_LATCHED>},
+		{"SET_VEHICLE_DOOR_OPEN", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_OPEN>},
+		{"SET_VEHICLE_DOOR_SHUT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_SHUT>},
+		{"SET_VEHICLE_DROPS_MONEY_WHEN_BLOWN_UP", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_DROPS_MONEY_WHEN_BLOWN_UP>},
+		{"SET_VEHICLE_ENGINE_CAN_DEGRADE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ENGINE_CAN_DEGRADE>},
+		{"SET_VEHICLE_ENGINE_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ENGINE_HEALTH>},
+		{"SET_VEHICLE_ENGINE_ON", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ENGINE_ON>},
+		{"SET_VEHICLE_ENVEFF_SCALE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ENVEFF_SCALE>},
+		{"SET_VEHICLE_EXCLUSIVE_DRIVER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_EXCLUSIVE_DRIVER>},
+		{"SET_VEHICLE_EXPLODES_ON_EXPLOSION_DAMAGE_AT_ZERO_BODY_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_EXPLODES_ON_EXPLOSION_DAMAGE_AT_ZERO_BODY_HEALTH>},
+		{"SET_VEHICLE_EXPLODES_ON_HIGH_EXPLOSION_DAMAGE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_EXPLODES_ON_HIGH_EXPLOSION_DAMAGE>},
+		{"SET_VEHICLE_EXTENDED_REMOVAL_RANGE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTENDED_REMOVAL_RANGE>},
+		{"SET_VEHICLE_EXTRA", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTRA>},
+		{"SET_VEHICLE_EXTRA_COLOURS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTRA_COLOURS>},
+		{"SET_VEHICLE_EXTRA_COLOUR_5", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTRA_COLOUR_5>},
+		{"SET_VEHICLE_EXTRA_COLOUR_6", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTRA_COLOUR_6>},
+		{"SET_VEHICLE_FIXED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FIXED>},
+		{"SET_VEHICLE_FLIGHT_NOZZLE_POSITION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FLIGHT_NOZZLE_POSITION>},
+		{"SET_VEHICLE_FLIGHT_NOZZLE_POSITION_IMMEDIATE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FLIGHT_NOZZLE_POSITION_IMMEDIATE>},
+		{"SET_VEHICLE_FORCE_AFTERBURNER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FORCE_AFTERBURNER>},
+		{"SET_VEHICLE_FORCE_INTERIORLIGHT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FORCE_INTERIORLIGHT>},
+		{"SET_VEHICLE_FORWARD_SPEED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FORWARD_SPEED>},
+		{"SET_VEHICLE_FORWARD_SPEED_XY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FORWARD_SPEED_XY>},
+		{"SET_VEHICLE_FRICTION_OVERRIDE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FRICTION_OVERRIDE>},
+		{"SET_VEHICLE_FULLBEAM", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_FULLBEAM>},
+		{"SET_VEHICLE_GENERATES_ENGINE_SHOCKING_EVENTS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_GENERATES_ENGINE_SHOCKING_EVENTS>},
+		{"SET_VEHICLE_GENERATOR_AREA_OF_INTEREST", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_GENERATOR_AREA_OF_INTEREST>},
+		{"SET_VEHICLE_GRAVITY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_GRAVITY>},
+		{"SET_VEHICLE_HANDBRAKE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HANDBRAKE>},
+		{"SET_VEHICLE_HANDLING_OVERRIDE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HANDLING_OVERRIDE>},
+		{"SET_VEHICLE_HAS_BEEN_DRIVEN_FLAG", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_BEEN_DRIVEN_FLAG>},
+		{"SET_VEHICLE_HAS_BEEN_OWNED_BY_PLAYER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_BEEN_OWNED_BY_PLAYER>},
+		{"SET_VEHICLE_HAS_MUTED_SIRENS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_MUTED_SIRENS>},
+		{"SET_VEHICLE_HAS_STRONG_AXLES", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_STRONG_AXLES>},
+		{"SET_VEHICLE_HAS_UNBREAKABLE_LIGHTS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_UNBREAKABLE_LIGHTS>},
+		{"SET_VEHICLE_HEADLIGHT_SHADOWS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HEADLIGHT_SHADOWS>},
+		{"SET_VEHICLE_HOMING_LOCKEDONTO_STATE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_HOMING_LOCKEDONTO_STATE>},
+		{"SET_VEHICLE_IMPATIENCE_TIMER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_IMPATIENCE_TIMER>},
+		{"SET_VEHICLE_INACTIVE_DURING_PLAYBACK", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_INACTIVE_DURING_PLAYBACK>},
+		{"SET_VEHICLE_INDICATOR_LIGHTS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_INDICATOR_LIGHTS>},
+		{"SET_VEHICLE_INDIVIDUAL_DOORS_LOCKED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_INDIVIDUAL_DOORS_LOCKED>},
+		{"SET_VEHICLE_INFLUENCES_WANTED_LEVEL", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_INFLUENCES_WANTED_LEVEL>},
+		{"SET_VEHICLE_INTERIORLIGHT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_INTERIORLIGHT>},
+		{"SET_VEHICLE_IN_CAR_MOD_SHOP", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_IN_CAR_MOD_SHOP>},
+		{"SET_VEHICLE_IS_CONSIDERED_BY_PLAYER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_IS_CONSIDERED_BY_PLAYER>},
+		{"SET_VEHICLE_IS_RACING", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_IS_RACING>},
+		{"SET_VEHICLE_IS_STOLEN", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_IS_STOLEN>},
+		{"SET_VEHICLE_IS_WANTED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_IS_WANTED>},
+		{"SET_VEHICLE_KEEP_ENGINE_ON_WHEN_ABANDONED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_KEEP_ENGINE_ON_WHEN_ABANDONED>},
+		{"SET_VEHICLE_KERS_ALLOWED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_KERS_ALLOWED>},
+		{"SET_VEHICLE_LIGHTS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_LIGHTS>},
+		{"SET_VEHICLE_LIGHT_MULTIPLIER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_LIGHT_MULTIPLIER>},
+		{"SET_VEHICLE_LIMIT_SPEED_WHEN_PLAYER_INACTIVE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_LIMIT_SPEED_WHEN_PLAYER_INACTIVE>},
+		{"SET_VEHICLE_LIVERY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_LIVERY>},
+		{"SET_VEHICLE_LIVERY2", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_LIVERY2>},
+		{"SET_VEHICLE_LOD_MULTIPLIER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_LOD_MULTIPLIER>},
+		{"SET_VEHICLE_MAX_LAUNCH_ENGINE_REVS_", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_MAX_LAUNCH_ENGINE_REVS_>},
+		{"SET_VEHICLE_MAX_SPEED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_MAX_SPEED>},
+		{"SET_VEHICLE_MAY_BE_USED_BY_GOTO_POINT_ANY_MEANS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_MAY_BE_USED_BY_GOTO_POINT_ANY_MEANS>},
+		{"SET_VEHICLE_MOD", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_MOD>},
+		{"SET_VEHICLE_MODEL_IS_SUPPRESSED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_MODEL_IS_SUPPRESSED>},
+		{"SET_VEHICLE_MOD_COLOR_1", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_MOD_COLOR_1>},
+		{"SET_VEHICLE_MOD_COLOR_2", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_MOD_COLOR_2>},
+		{"SET_VEHICLE_MOD_KIT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_MOD_KIT>},
+		{"SET_VEHICLE_NAME_DEBUG", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NAME_DEBUG>},
+		{"SET_VEHICLE_NEEDS_TO_BE_HOTWIRED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NEEDS_TO_BE_HOTWIRED>},
+		{"SET_VEHICLE_NEON_COLOUR", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NEON_COLOUR>},
+		{"SET_VEHICLE_NEON_ENABLED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NEON_ENABLED>},
+		{"SET_VEHICLE_NEON_INDEX_COLOUR", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NEON_INDEX_COLOUR>},
+		{"SET_VEHICLE_NOT_STEALABLE_AMBIENTLY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NOT_STEALABLE_AMBIENTLY>},
+		{"SET_VEHICLE_NO_EXPLOSION_DAMAGE_FROM_DRIVER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NO_EXPLOSION_DAMAGE_FROM_DRIVER>},
+		{"SET_VEHICLE_NUMBER_PLATE_TEXT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NUMBER_PLATE_TEXT>},
+		{"SET_VEHICLE_NUMBER_PLATE_TEXT_INDEX", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_NUMBER_PLATE_TEXT_INDEX>},
+		{"SET_VEHICLE_OCCUPANTS_TAKE_EXPLOSIVE_DAMAGE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_OCCUPANTS_TAKE_EXPLOSIVE_DAMAGE>},
+		{"SET_VEHICLE_ON_GROUND_PROPERLY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_ON_GROUND_PROPERLY>},
+		{"SET_VEHICLE_OUT_OF_CONTROL", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_OUT_OF_CONTROL>},
+		{"SET_VEHICLE_PETROL_TANK_HEALTH", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_PETROL_TANK_HEALTH>},
+		{"SET_VEHICLE_PROVIDES_COVER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_PROVIDES_COVER>},
+		{"SET_VEHICLE_READY_FOR_CLEANUP", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_READY_FOR_CLEANUP>},
+		{"SET_VEHICLE_REDUCE_GRIP", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_REDUCE_GRIP>},
+		{"SET_VEHICLE_REDUCE_GRIP_LEVEL", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_REDUCE_GRIP_LEVEL>},
+		{"SET_VEHICLE_REMOVE_AGGRESSIVE_CARJACK_MISSION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_REMOVE_AGGRESSIVE_CARJACK_MISSION>},
+		{"SET_VEHICLE_RESPECTS_LOCKS_WHEN_HAS_DRIVER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_RESPECTS_LOCKS_WHEN_HAS_DRIVER>},
+		{"SET_VEHICLE_RUDDER_BROKEN", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_RUDDER_BROKEN>},
+		{"SET_VEHICLE_SEARCHLIGHT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_SEARCHLIGHT>},
+		{"SET_VEHICLE_SHOOT_AT_TARGET", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_SHOOT_AT_TARGET>},
+		{"SET_VEHICLE_SHUNT_ON_STICK", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_SHUNT_ON_STICK>},
+		{"SET_VEHICLE_SIREN", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_SIREN>},
+		{"SET_VEHICLE_SLIPSTREAMING_SHOULD_TIME_OUT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_SLIPSTREAMING_SHOULD_TIME_OUT>},
+		{"SET_VEHICLE_STAYS_FROZEN_WHEN_CLEANED_UP", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_STAYS_FROZEN_WHEN_CLEANED_UP>},
+		{"SET_VEHICLE_STEERING_BIAS_SCALAR", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_STEERING_BIAS_SCALAR>},
+		{"SET_VEHICLE_STEER_BIAS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_STEER_BIAS>},
+		{"SET_VEHICLE_STEER_FOR_BUILDINGS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_STEER_FOR_BUILDINGS>},
+		{"SET_VEHICLE_STOP_INSTANTLY_WHEN_PLAYER_INACTIVE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_STOP_INSTANTLY_WHEN_PLAYER_INACTIVE>},
+		{"SET_VEHICLE_STRONG", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_STRONG>},
+		{"SET_VEHICLE_TAIL_LIGHTS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TAIL_LIGHTS>},
+		{"SET_VEHICLE_TANK_STATIONARY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TANK_STATIONARY>},
+		{"SET_VEHICLE_TANK_TURRET_POSITION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TANK_TURRET_POSITION>},
+		{"SET_VEHICLE_TIMED_EXPLOSION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TIMED_EXPLOSION>},
+		{"SET_VEHICLE_TOW_TRUCK_ARM_POSITION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TOW_TRUCK_ARM_POSITION>},
+		{"SET_VEHICLE_TURRET_SPEED_THIS_FRAME", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TURRET_SPEED_THIS_FRAME>},
+		{"SET_VEHICLE_TURRET_TARGET", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TURRET_TARGET>},
+		{"SET_VEHICLE_TYRES_CAN_BURST", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TYRES_CAN_BURST>},
+		{"SET_VEHICLE_TYRE_BURST", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TYRE_BURST>},
+		{"SET_VEHICLE_TYRE_FIXED", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TYRE_FIXED>},
+		{"SET_VEHICLE_TYRE_SMOKE_COLOR", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_TYRE_SMOKE_COLOR>},
+		{"SET_VEHICLE_UNDRIVEABLE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_UNDRIVEABLE>},
+		{"SET_VEHICLE_USED_FOR_PILOT_SCHOOL", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USED_FOR_PILOT_SCHOOL>},
+		{"SET_VEHICLE_USES_LARGE_REAR_RAMP", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USES_LARGE_REAR_RAMP>},
+		{"SET_VEHICLE_USES_MP_PLAYER_DAMAGE_MULTIPLIER", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USES_MP_PLAYER_DAMAGE_MULTIPLIER>},
+		{"SET_VEHICLE_USE_ALTERNATE_HANDLING", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_ALTERNATE_HANDLING>},
+		{"SET_VEHICLE_USE_BOOST_BUTTON_FOR_WHEEL_RETRACT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_BOOST_BUTTON_FOR_WHEEL_RETRACT>},
+		{"SET_VEHICLE_USE_CUTSCENE_WHEEL_COMPRESSION", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_CUTSCENE_WHEEL_COMPRESSION>},
+		{"SET_VEHICLE_USE_HORN_BUTTON_FOR_NITROUS_", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_HORN_BUTTON_FOR_NITROUS_>},
+		{"SET_VEHICLE_USE_MORE_RESTRICTIVE_SPAWN_CHECKS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_MORE_RESTRICTIVE_SPAWN_CHECKS>},
+		{"SET_VEHICLE_USE_PLAYER_LIGHT_SETTINGS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_PLAYER_LIGHT_SETTINGS>},
+		{"SET_VEHICLE_WEAPON_CAN_TARGET_OBJECTS", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WEAPON_CAN_TARGET_OBJECTS>},
+		{"SET_VEHICLE_WEAPON_DAMAGE_SCALE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WEAPON_DAMAGE_SCALE>},
+		{"SET_VEHICLE_WEAPON_RESTRICTED_AMMO", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WEAPON_RESTRICTED_AMMO>},
+		{"SET_VEHICLE_WHEELS_CAN_BREAK", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WHEELS_CAN_BREAK>},
+		{"SET_VEHICLE_WHEELS_CAN_BREAK_OFF_WHEN_BLOW_UP", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WHEELS_CAN_BREAK_OFF_WHEN_BLOW_UP>},
+		{"SET_VEHICLE_WHEEL_TYPE", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WHEEL_TYPE>},
+		{"SET_VEHICLE_WILL_FORCE_OTHER_VEHICLES_TO_STOP", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WILL_FORCE_OTHER_VEHICLES_TO_STOP>},
+		{"SET_VEHICLE_WILL_TELL_OTHERS_TO_HURRY", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WILL_TELL_OTHERS_TO_HURRY>},
+		{"SET_VEHICLE_WINDOW_TINT", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_WINDOW_TINT>},
+		{"SET_VEHICLE_XENON_LIGHT_COLOR_INDEX", native_function<LUA_NATIVE_VEHICLE_SET_VEHICLE_XENON_LIGHT_COLOR_INDEX>},
+		{"SET_WHEELIE_ENABLED", native_function<LUA_NATIVE_VEHICLE_SET_WHEELIE_ENABLED>},
+		{"SET_WHEELS_EXTENDED_INSTANTLY", native_function<LUA_NATIVE_VEHICLE_SET_WHEELS_EXTENDED_INSTANTLY>},
+		{"SET_WHEELS_RETRACTED_INSTANTLY", native_function<LUA_NATIVE_VEHICLE_SET_WHEELS_RETRACTED_INSTANTLY>},
+		{"SKIP_TIME_IN_PLAYBACK_RECORDED_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SKIP_TIME_IN_PLAYBACK_RECORDED_VEHICLE>},
+		{"SKIP_TO_END_AND_STOP_PLAYBACK_RECORDED_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SKIP_TO_END_AND_STOP_PLAYBACK_RECORDED_VEHICLE>},
+		{"SMASH_VEHICLE_WINDOW", native_function<LUA_NATIVE_VEHICLE_SMASH_VEHICLE_WINDOW>},
+		{"STABILISE_ENTITY_ATTACHED_TO_HELI", native_function<LUA_NATIVE_VEHICLE_STABILISE_ENTITY_ATTACHED_TO_HELI>},
+		{"START_PLAYBACK_RECORDED_VEHICLE", native_function<LUA_NATIVE_VEHICLE_START_PLAYBACK_RECORDED_VEHICLE>},
+		{"START_PLAYBACK_RECORDED_VEHICLE_USING_AI", native_function<LUA_NATIVE_VEHICLE_START_PLAYBACK_RECORDED_VEHICLE_USING_AI>},
+		{"START_PLAYBACK_RECORDED_VEHICLE_WITH_FLAGS", native_function<LUA_NATIVE_VEHICLE_START_PLAYBACK_RECORDED_VEHICLE_WITH_FLAGS>},
+		{"START_VEHICLE_ALARM", native_function<LUA_NATIVE_VEHICLE_START_VEHICLE_ALARM>},
+		{"START_VEHICLE_HORN", native_function<LUA_NATIVE_VEHICLE_START_VEHICLE_HORN>},
+		{"STOP_ALL_GARAGE_ACTIVITY", native_function<LUA_NATIVE_VEHICLE_STOP_ALL_GARAGE_ACTIVITY>},
+		{"STOP_BRINGING_VEHICLE_TO_HALT", native_function<LUA_NATIVE_VEHICLE_STOP_BRINGING_VEHICLE_TO_HALT>},
+		{"STOP_PLAYBACK_RECORDED_VEHICLE", native_function<LUA_NATIVE_VEHICLE_STOP_PLAYBACK_RECORDED_VEHICLE>},
+		{"SUPPRESS_NEONS_ON_VEHICLE", native_function<LUA_NATIVE_VEHICLE_SUPPRESS_NEONS_ON_VEHICLE>},
+		{"SWING_BOAT_BOOM_FREELY", native_function<LUA_NATIVE_VEHICLE_SWING_BOAT_BOOM_FREELY>},
+		{"SWING_BOAT_BOOM_TO_RATIO", native_function<LUA_NATIVE_VEHICLE_SWING_BOAT_BOOM_TO_RATIO>},
+		{"SWITCH_TRAIN_TRACK", native_function<LUA_NATIVE_VEHICLE_SWITCH_TRAIN_TRACK>},
+		{"TOGGLE_VEHICLE_MOD", native_function<LUA_NATIVE_VEHICLE_TOGGLE_VEHICLE_MOD>},
+		{"TRACK_VEHICLE_VISIBILITY", native_function<LUA_NATIVE_VEHICLE_TRACK_VEHICLE_VISIBILITY>},
+		{"TRANSFORM_TO_CAR", native_function<LUA_NATIVE_VEHICLE_TRANSFORM_TO_CAR>},
+		{"TRANSFORM_TO_SUBMARINE", native_function<LUA_NATIVE_VEHICLE_TRANSFORM_TO_SUBMARINE>},
+		{"UNPAUSE_PLAYBACK_RECORDED_VEHICLE", native_function<LUA_NATIVE_VEHICLE_UNPAUSE_PLAYBACK_RECORDED_VEHICLE>},
+		{"VEHICLE_SET_ENABLE_NORMALISE_RAMP_CAR_VERTICAL_VELOCTIY", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_ENABLE_NORMALISE_RAMP_CAR_VERTICAL_VELOCTIY>},
+		{"VEHICLE_SET_ENABLE_RAMP_CAR_SIDE_IMPULSE", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_ENABLE_RAMP_CAR_SIDE_IMPULSE>},
+		{"VEHICLE_SET_EXTENABLE_SIDE_TARGET_RATIO", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_EXTENABLE_SIDE_TARGET_RATIO>},
+		{"VEHICLE_SET_JET_WASH_FORCE_ENABLED", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_JET_WASH_FORCE_ENABLED>},
+		{"VEHICLE_SET_OVERRIDE_EXTENABLE_SIDE_RATIO", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_OVERRIDE_EXTENABLE_SIDE_RATIO>},
+		{"VEHICLE_SET_OVERRIDE_SIDE_RATIO", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_OVERRIDE_SIDE_RATIO>},
+		{"VEHICLE_SET_PARACHUTE_MODEL_OVERRIDE", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_PARACHUTE_MODEL_OVERRIDE>},
+		{"VEHICLE_SET_PARACHUTE_MODEL_TINT_INDEX", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_PARACHUTE_MODEL_TINT_INDEX>},
+		{"VEHICLE_SET_RAMP_AND_RAMMING_CARS_TAKE_DAMAGE", native_function<LUA_NATIVE_VEHICLE_VEHICLE_SET_RAMP_AND_RAMMING_CARS_TAKE_DAMAGE>},
+		{"VEHICLE_START_PARACHUTING", native_function<LUA_NATIVE_VEHICLE_VEHICLE_START_PARACHUTING>},
+	};
+
 	void init_native_binding_VEHICLE(sol::state& L)
 	{
-		auto VEHICLE = L["VEHICLE"].get_or_create<sol::table>();
-		VEHICLE.set_function("CREATE_VEHICLE", LUA_NATIVE_VEHICLE_CREATE_VEHICLE);
-		VEHICLE.set_function("DELETE_VEHICLE", LUA_NATIVE_VEHICLE_DELETE_VEHICLE);
-		VEHICLE.set_function("SET_VEHICLE_ALLOW_HOMING_MISSLE_LOCKON", LUA_NATIVE_VEHICLE_SET_VEHICLE_ALLOW_HOMING_MISSLE_LOCKON);
-		VEHICLE.set_function("SET_VEHICLE_ALLOW_HOMING_MISSLE_LOCKON_SYNCED", LUA_NATIVE_VEHICLE_SET_VEHICLE_ALLOW_HOMING_MISSLE_LOCKON_SYNCED);
-		VEHICLE.set_function("SET_VEHICLE_ALLOW_NO_PASSENGERS_LOCKON", LUA_NATIVE_VEHICLE_SET_VEHICLE_ALLOW_NO_PASSENGERS_LOCKON);
-		VEHICLE.set_function("GET_VEHICLE_HOMING_LOCKON_STATE", LUA_NATIVE_VEHICLE_GET_VEHICLE_HOMING_LOCKON_STATE);
-		VEHICLE.set_function("GET_VEHICLE_HOMING_LOCKEDONTO_STATE", LUA_NATIVE_VEHICLE_GET_VEHICLE_HOMING_LOCKEDONTO_STATE);
-		VEHICLE.set_function("SET_VEHICLE_HOMING_LOCKEDONTO_STATE", LUA_NATIVE_VEHICLE_SET_VEHICLE_HOMING_LOCKEDONTO_STATE);
-		VEHICLE.set_function("IS_VEHICLE_MODEL", LUA_NATIVE_VEHICLE_IS_VEHICLE_MODEL);
-		VEHICLE.set_function("DOES_SCRIPT_VEHICLE_GENERATOR_EXIST", LUA_NATIVE_VEHICLE_DOES_SCRIPT_VEHICLE_GENERATOR_EXIST);
-		VEHICLE.set_function("CREATE_SCRIPT_VEHICLE_GENERATOR", LUA_NATIVE_VEHICLE_CREATE_SCRIPT_VEHICLE_GENERATOR);
-		VEHICLE.set_function("DELETE_SCRIPT_VEHICLE_GENERATOR", LUA_NATIVE_VEHICLE_DELETE_SCRIPT_VEHICLE_GENERATOR);
-		VEHICLE.set_function("SET_SCRIPT_VEHICLE_GENERATOR", LUA_NATIVE_VEHICLE_SET_SCRIPT_VEHICLE_GENERATOR);
-		VEHICLE.set_function("SET_ALL_VEHICLE_GENERATORS_ACTIVE_IN_AREA", LUA_NATIVE_VEHICLE_SET_ALL_VEHICLE_GENERATORS_ACTIVE_IN_AREA);
-		VEHICLE.set_function("SET_ALL_VEHICLE_GENERATORS_ACTIVE", LUA_NATIVE_VEHICLE_SET_ALL_VEHICLE_GENERATORS_ACTIVE);
-		VEHICLE.set_function("SET_ALL_LOW_PRIORITY_VEHICLE_GENERATORS_ACTIVE", LUA_NATIVE_VEHICLE_SET_ALL_LOW_PRIORITY_VEHICLE_GENERATORS_ACTIVE);
-		VEHICLE.set_function("SET_VEHICLE_GENERATOR_AREA_OF_INTEREST", LUA_NATIVE_VEHICLE_SET_VEHICLE_GENERATOR_AREA_OF_INTEREST);
-		VEHICLE.set_function("CLEAR_VEHICLE_GENERATOR_AREA_OF_INTEREST", LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_GENERATOR_AREA_OF_INTEREST);
-		VEHICLE.set_function("SET_VEHICLE_ON_GROUND_PROPERLY", LUA_NATIVE_VEHICLE_SET_VEHICLE_ON_GROUND_PROPERLY);
-		VEHICLE.set_function("SET_VEHICLE_USE_CUTSCENE_WHEEL_COMPRESSION", LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_CUTSCENE_WHEEL_COMPRESSION);
-		VEHICLE.set_function("IS_VEHICLE_STUCK_ON_ROOF", LUA_NATIVE_VEHICLE_IS_VEHICLE_STUCK_ON_ROOF);
-		VEHICLE.set_function("ADD_VEHICLE_UPSIDEDOWN_CHECK", LUA_NATIVE_VEHICLE_ADD_VEHICLE_UPSIDEDOWN_CHECK);
-		VEHICLE.set_function("REMOVE_VEHICLE_UPSIDEDOWN_CHECK", LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_UPSIDEDOWN_CHECK);
-		VEHICLE.set_function("IS_VEHICLE_STOPPED", LUA_NATIVE_VEHICLE_IS_VEHICLE_STOPPED);
-		VEHICLE.set_function("GET_VEHICLE_NUMBER_OF_PASSENGERS", LUA_NATIVE_VEHICLE_GET_VEHICLE_NUMBER_OF_PASSENGERS);
-		VEHICLE.set_function("GET_VEHICLE_MAX_NUMBER_OF_PASSENGERS", LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_NUMBER_OF_PASSENGERS);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_NUMBER_OF_SEATS", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_NUMBER_OF_SEATS);
-		VEHICLE.set_function("IS_SEAT_WARP_ONLY", LUA_NATIVE_VEHICLE_IS_SEAT_WARP_ONLY);
-		VEHICLE.set_function("IS_TURRET_SEAT", LUA_NATIVE_VEHICLE_IS_TURRET_SEAT);
-		VEHICLE.set_function("DOES_VEHICLE_ALLOW_RAPPEL", LUA_NATIVE_VEHICLE_DOES_VEHICLE_ALLOW_RAPPEL);
-		VEHICLE.set_function("SET_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME", LUA_NATIVE_VEHICLE_SET_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME);
-		VEHICLE.set_function("SET_RANDOM_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME", LUA_NATIVE_VEHICLE_SET_RANDOM_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME);
-		VEHICLE.set_function("SET_PARKED_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME", LUA_NATIVE_VEHICLE_SET_PARKED_VEHICLE_DENSITY_MULTIPLIER_THIS_FRAME);
-		VEHICLE.set_function("SET_DISABLE_RANDOM_TRAINS_THIS_FRAME", LUA_NATIVE_VEHICLE_SET_DISABLE_RANDOM_TRAINS_THIS_FRAME);
-		VEHICLE.set_function("SET_AMBIENT_VEHICLE_RANGE_MULTIPLIER_THIS_FRAME", LUA_NATIVE_VEHICLE_SET_AMBIENT_VEHICLE_RANGE_MULTIPLIER_THIS_FRAME);
-		VEHICLE.set_function("SET_FAR_DRAW_VEHICLES", LUA_NATIVE_VEHICLE_SET_FAR_DRAW_VEHICLES);
-		VEHICLE.set_function("SET_NUMBER_OF_PARKED_VEHICLES", LUA_NATIVE_VEHICLE_SET_NUMBER_OF_PARKED_VEHICLES);
-		VEHICLE.set_function("SET_VEHICLE_DOORS_LOCKED", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED);
-		VEHICLE.set_function("SET_VEHICLE_INDIVIDUAL_DOORS_LOCKED", LUA_NATIVE_VEHICLE_SET_VEHICLE_INDIVIDUAL_DOORS_LOCKED);
-		VEHICLE.set_function("SET_VEHICLE_HAS_MUTED_SIRENS", LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_MUTED_SIRENS);
-		VEHICLE.set_function("SET_VEHICLE_DOORS_LOCKED_FOR_PLAYER", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_PLAYER);
-		VEHICLE.set_function("GET_VEHICLE_DOORS_LOCKED_FOR_PLAYER", LUA_NATIVE_VEHICLE_GET_VEHICLE_DOORS_LOCKED_FOR_PLAYER);
-		VEHICLE.set_function("SET_VEHICLE_DOORS_LOCKED_FOR_ALL_PLAYERS", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_ALL_PLAYERS);
-		VEHICLE.set_function("SET_VEHICLE_DOORS_LOCKED_FOR_NON_SCRIPT_PLAYERS", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_NON_SCRIPT_PLAYERS);
-		VEHICLE.set_function("SET_VEHICLE_DOORS_LOCKED_FOR_TEAM", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_TEAM);
-		VEHICLE.set_function("SET_VEHICLE_DOORS_LOCKED_FOR_ALL_TEAMS", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_LOCKED_FOR_ALL_TEAMS);
-		VEHICLE.set_function("SET_VEHICLE_DONT_TERMINATE_TASK_WHEN_ACHIEVED", LUA_NATIVE_VEHICLE_SET_VEHICLE_DONT_TERMINATE_TASK_WHEN_ACHIEVED);
-		VEHICLE.set_function("SET_VEHICLE_MAX_LAUNCH_ENGINE_REVS_", LUA_NATIVE_VEHICLE_SET_VEHICLE_MAX_LAUNCH_ENGINE_REVS_);
-		VEHICLE.set_function("GET_VEHICLE_THROTTLE_", LUA_NATIVE_VEHICLE_GET_VEHICLE_THROTTLE_);
-		VEHICLE.set_function("EXPLODE_VEHICLE", LUA_NATIVE_VEHICLE_EXPLODE_VEHICLE);
-		VEHICLE.set_function("SET_VEHICLE_OUT_OF_CONTROL", LUA_NATIVE_VEHICLE_SET_VEHICLE_OUT_OF_CONTROL);
-		VEHICLE.set_function("SET_VEHICLE_TIMED_EXPLOSION", LUA_NATIVE_VEHICLE_SET_VEHICLE_TIMED_EXPLOSION);
-		VEHICLE.set_function("ADD_VEHICLE_PHONE_EXPLOSIVE_DEVICE", LUA_NATIVE_VEHICLE_ADD_VEHICLE_PHONE_EXPLOSIVE_DEVICE);
-		VEHICLE.set_function("CLEAR_VEHICLE_PHONE_EXPLOSIVE_DEVICE", LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_PHONE_EXPLOSIVE_DEVICE);
-		VEHICLE.set_function("HAS_VEHICLE_PHONE_EXPLOSIVE_DEVICE", LUA_NATIVE_VEHICLE_HAS_VEHICLE_PHONE_EXPLOSIVE_DEVICE);
-		VEHICLE.set_function("DETONATE_VEHICLE_PHONE_EXPLOSIVE_DEVICE", LUA_NATIVE_VEHICLE_DETONATE_VEHICLE_PHONE_EXPLOSIVE_DEVICE);
-		VEHICLE.set_function("HAVE_VEHICLE_REAR_DOORS_BEEN_BLOWN_OPEN_BY_STICKYBOMB", LUA_NATIVE_VEHICLE_HAVE_VEHICLE_REAR_DOORS_BEEN_BLOWN_OPEN_BY_STICKYBOMB);
-		VEHICLE.set_function("SET_TAXI_LIGHTS", LUA_NATIVE_VEHICLE_SET_TAXI_LIGHTS);
-		VEHICLE.set_function("IS_TAXI_LIGHT_ON", LUA_NATIVE_VEHICLE_IS_TAXI_LIGHT_ON);
-		VEHICLE.set_function("IS_VEHICLE_IN_GARAGE_AREA", LUA_NATIVE_VEHICLE_IS_VEHICLE_IN_GARAGE_AREA);
-		VEHICLE.set_function("SET_VEHICLE_COLOURS", LUA_NATIVE_VEHICLE_SET_VEHICLE_COLOURS);
-		VEHICLE.set_function("SET_VEHICLE_FULLBEAM", LUA_NATIVE_VEHICLE_SET_VEHICLE_FULLBEAM);
-		VEHICLE.set_function("SET_VEHICLE_IS_RACING", LUA_NATIVE_VEHICLE_SET_VEHICLE_IS_RACING);
-		VEHICLE.set_function("SET_VEHICLE_CUSTOM_PRIMARY_COLOUR", LUA_NATIVE_VEHICLE_SET_VEHICLE_CUSTOM_PRIMARY_COLOUR);
-		VEHICLE.set_function("GET_VEHICLE_CUSTOM_PRIMARY_COLOUR", LUA_NATIVE_VEHICLE_GET_VEHICLE_CUSTOM_PRIMARY_COLOUR);
-		VEHICLE.set_function("CLEAR_VEHICLE_CUSTOM_PRIMARY_COLOUR", LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_CUSTOM_PRIMARY_COLOUR);
-		VEHICLE.set_function("GET_IS_VEHICLE_PRIMARY_COLOUR_CUSTOM", LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_PRIMARY_COLOUR_CUSTOM);
-		VEHICLE.set_function("SET_VEHICLE_CUSTOM_SECONDARY_COLOUR", LUA_NATIVE_VEHICLE_SET_VEHICLE_CUSTOM_SECONDARY_COLOUR);
-		VEHICLE.set_function("GET_VEHICLE_CUSTOM_SECONDARY_COLOUR", LUA_NATIVE_VEHICLE_GET_VEHICLE_CUSTOM_SECONDARY_COLOUR);
-		VEHICLE.set_function("CLEAR_VEHICLE_CUSTOM_SECONDARY_COLOUR", LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_CUSTOM_SECONDARY_COLOUR);
-		VEHICLE.set_function("GET_IS_VEHICLE_SECONDARY_COLOUR_CUSTOM", LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_SECONDARY_COLOUR_CUSTOM);
-		VEHICLE.set_function("SET_VEHICLE_ENVEFF_SCALE", LUA_NATIVE_VEHICLE_SET_VEHICLE_ENVEFF_SCALE);
-		VEHICLE.set_function("GET_VEHICLE_ENVEFF_SCALE", LUA_NATIVE_VEHICLE_GET_VEHICLE_ENVEFF_SCALE);
-		VEHICLE.set_function("SET_CAN_RESPRAY_VEHICLE", LUA_NATIVE_VEHICLE_SET_CAN_RESPRAY_VEHICLE);
-		VEHICLE.set_function("SET_GOON_BOSS_VEHICLE", LUA_NATIVE_VEHICLE_SET_GOON_BOSS_VEHICLE);
-		VEHICLE.set_function("SET_OPEN_REAR_DOORS_ON_EXPLOSION", LUA_NATIVE_VEHICLE_SET_OPEN_REAR_DOORS_ON_EXPLOSION);
-		VEHICLE.set_function("FORCE_SUBMARINE_SURFACE_MODE", LUA_NATIVE_VEHICLE_FORCE_SUBMARINE_SURFACE_MODE);
-		VEHICLE.set_function("FORCE_SUBMARINE_NEURTAL_BUOYANCY", LUA_NATIVE_VEHICLE_FORCE_SUBMARINE_NEURTAL_BUOYANCY);
-		VEHICLE.set_function("SET_SUBMARINE_CRUSH_DEPTHS", LUA_NATIVE_VEHICLE_SET_SUBMARINE_CRUSH_DEPTHS);
-		VEHICLE.set_function("GET_SUBMARINE_IS_UNDER_DESIGN_DEPTH", LUA_NATIVE_VEHICLE_GET_SUBMARINE_IS_UNDER_DESIGN_DEPTH);
-		VEHICLE.set_function("GET_SUBMARINE_NUMBER_OF_AIR_LEAKS", LUA_NATIVE_VEHICLE_GET_SUBMARINE_NUMBER_OF_AIR_LEAKS);
-		VEHICLE.set_function("SET_BOAT_IGNORE_LAND_PROBES", LUA_NATIVE_VEHICLE_SET_BOAT_IGNORE_LAND_PROBES);
-		VEHICLE.set_function("SET_BOUNDS_AFFECT_WATER_PROBES_", LUA_NATIVE_VEHICLE_SET_BOUNDS_AFFECT_WATER_PROBES_);
-		VEHICLE.set_function("SET_BOAT_ANCHOR", LUA_NATIVE_VEHICLE_SET_BOAT_ANCHOR);
-		VEHICLE.set_function("CAN_ANCHOR_BOAT_HERE", LUA_NATIVE_VEHICLE_CAN_ANCHOR_BOAT_HERE);
-		VEHICLE.set_function("CAN_ANCHOR_BOAT_HERE_IGNORE_PLAYERS", LUA_NATIVE_VEHICLE_CAN_ANCHOR_BOAT_HERE_IGNORE_PLAYERS);
-		VEHICLE.set_function("SET_BOAT_REMAINS_ANCHORED_WHILE_PLAYER_IS_DRIVER", LUA_NATIVE_VEHICLE_SET_BOAT_REMAINS_ANCHORED_WHILE_PLAYER_IS_DRIVER);
-		VEHICLE.set_function("SET_FORCE_LOW_LOD_ANCHOR_MODE", LUA_NATIVE_VEHICLE_SET_FORCE_LOW_LOD_ANCHOR_MODE);
-		VEHICLE.set_function("SET_BOAT_LOW_LOD_ANCHOR_DISTANCE", LUA_NATIVE_VEHICLE_SET_BOAT_LOW_LOD_ANCHOR_DISTANCE);
-		VEHICLE.set_function("IS_BOAT_ANCHORED", LUA_NATIVE_VEHICLE_IS_BOAT_ANCHORED);
-		VEHICLE.set_function("SET_BOAT_SINKS_WHEN_WRECKED", LUA_NATIVE_VEHICLE_SET_BOAT_SINKS_WHEN_WRECKED);
-		VEHICLE.set_function("SET_BOAT_WRECKED", LUA_NATIVE_VEHICLE_SET_BOAT_WRECKED);
-		VEHICLE.set_function("SET_VEHICLE_SIREN", LUA_NATIVE_VEHICLE_SET_VEHICLE_SIREN);
-		VEHICLE.set_function("IS_VEHICLE_SIREN_ON", LUA_NATIVE_VEHICLE_IS_VEHICLE_SIREN_ON);
-		VEHICLE.set_function("IS_VEHICLE_SIREN_AUDIO_ON", LUA_NATIVE_VEHICLE_IS_VEHICLE_SIREN_AUDIO_ON);
-		VEHICLE.set_function("SET_VEHICLE_STRONG", LUA_NATIVE_VEHICLE_SET_VEHICLE_STRONG);
-		VEHICLE.set_function("REMOVE_VEHICLE_STUCK_CHECK", LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_STUCK_CHECK);
-		VEHICLE.set_function("GET_VEHICLE_COLOURS", LUA_NATIVE_VEHICLE_GET_VEHICLE_COLOURS);
-		VEHICLE.set_function("IS_VEHICLE_SEAT_FREE", LUA_NATIVE_VEHICLE_IS_VEHICLE_SEAT_FREE);
-		VEHICLE.set_function("GET_PED_IN_VEHICLE_SEAT", LUA_NATIVE_VEHICLE_GET_PED_IN_VEHICLE_SEAT);
-		VEHICLE.set_function("GET_LAST_PED_IN_VEHICLE_SEAT", LUA_NATIVE_VEHICLE_GET_LAST_PED_IN_VEHICLE_SEAT);
-		VEHICLE.set_function("GET_VEHICLE_LIGHTS_STATE", LUA_NATIVE_VEHICLE_GET_VEHICLE_LIGHTS_STATE);
-		VEHICLE.set_function("IS_VEHICLE_TYRE_BURST", LUA_NATIVE_VEHICLE_IS_VEHICLE_TYRE_BURST);
-		VEHICLE.set_function("SET_VEHICLE_FORWARD_SPEED", LUA_NATIVE_VEHICLE_SET_VEHICLE_FORWARD_SPEED);
-		VEHICLE.set_function("SET_VEHICLE_FORWARD_SPEED_XY", LUA_NATIVE_VEHICLE_SET_VEHICLE_FORWARD_SPEED_XY);
-		VEHICLE.set_function("BRING_VEHICLE_TO_HALT", LUA_NATIVE_VEHICLE_BRING_VEHICLE_TO_HALT);
-		VEHICLE.set_function("SET_VEHICLE_STEER_FOR_BUILDINGS", LUA_NATIVE_VEHICLE_SET_VEHICLE_STEER_FOR_BUILDINGS);
-		VEHICLE.set_function("SET_VEHICLE_CAUSES_SWERVING", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAUSES_SWERVING);
-		VEHICLE.set_function("SET_IGNORE_PLANES_SMALL_PITCH_CHANGE", LUA_NATIVE_VEHICLE_SET_IGNORE_PLANES_SMALL_PITCH_CHANGE);
-		VEHICLE.set_function("STOP_BRINGING_VEHICLE_TO_HALT", LUA_NATIVE_VEHICLE_STOP_BRINGING_VEHICLE_TO_HALT);
-		VEHICLE.set_function("IS_VEHICLE_BEING_BROUGHT_TO_HALT", LUA_NATIVE_VEHICLE_IS_VEHICLE_BEING_BROUGHT_TO_HALT);
-		VEHICLE.set_function("LOWER_FORKLIFT_FORKS", LUA_NATIVE_VEHICLE_LOWER_FORKLIFT_FORKS);
-		VEHICLE.set_function("SET_FORKLIFT_FORK_HEIGHT", LUA_NATIVE_VEHICLE_SET_FORKLIFT_FORK_HEIGHT);
-		VEHICLE.set_function("IS_ENTITY_ATTACHED_TO_HANDLER_FRAME", LUA_NATIVE_VEHICLE_IS_ENTITY_ATTACHED_TO_HANDLER_FRAME);
-		VEHICLE.set_function("IS_ANY_ENTITY_ATTACHED_TO_HANDLER_FRAME", LUA_NATIVE_VEHICLE_IS_ANY_ENTITY_ATTACHED_TO_HANDLER_FRAME);
-		VEHICLE.set_function("FIND_HANDLER_VEHICLE_CONTAINER_IS_ATTACHED_TO", LUA_NATIVE_VEHICLE_FIND_HANDLER_VEHICLE_CONTAINER_IS_ATTACHED_TO);
-		VEHICLE.set_function("IS_HANDLER_FRAME_LINED_UP_WITH_CONTAINER", LUA_NATIVE_VEHICLE_IS_HANDLER_FRAME_LINED_UP_WITH_CONTAINER);
-		VEHICLE.set_function("ATTACH_CONTAINER_TO_HANDLER_FRAME_WHEN_LINED_UP", LUA_NATIVE_VEHICLE_ATTACH_CONTAINER_TO_HANDLER_FRAME_WHEN_LINED_UP);
-		VEHICLE.set_function("DETACH_CONTAINER_FROM_HANDLER_FRAME", LUA_NATIVE_VEHICLE_DETACH_CONTAINER_FROM_HANDLER_FRAME);
-		VEHICLE.set_function("SET_VEHICLE_DISABLE_HEIGHT_MAP_AVOIDANCE", LUA_NATIVE_VEHICLE_SET_VEHICLE_DISABLE_HEIGHT_MAP_AVOIDANCE);
-		VEHICLE.set_function("SET_BOAT_DISABLE_AVOIDANCE", LUA_NATIVE_VEHICLE_SET_BOAT_DISABLE_AVOIDANCE);
-		VEHICLE.set_function("IS_HELI_LANDING_AREA_BLOCKED", LUA_NATIVE_VEHICLE_IS_HELI_LANDING_AREA_BLOCKED);
-		VEHICLE.set_function("SET_SHORT_SLOWDOWN_FOR_LANDING", LUA_NATIVE_VEHICLE_SET_SHORT_SLOWDOWN_FOR_LANDING);
-		VEHICLE.set_function("SET_HELI_TURBULENCE_SCALAR", LUA_NATIVE_VEHICLE_SET_HELI_TURBULENCE_SCALAR);
-		VEHICLE.set_function("SET_CAR_BOOT_OPEN", LUA_NATIVE_VEHICLE_SET_CAR_BOOT_OPEN);
-		VEHICLE.set_function("SET_VEHICLE_TYRE_BURST", LUA_NATIVE_VEHICLE_SET_VEHICLE_TYRE_BURST);
-		VEHICLE.set_function("SET_VEHICLE_DOORS_SHUT", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOORS_SHUT);
-		VEHICLE.set_function("SET_VEHICLE_TYRES_CAN_BURST", LUA_NATIVE_VEHICLE_SET_VEHICLE_TYRES_CAN_BURST);
-		VEHICLE.set_function("GET_VEHICLE_TYRES_CAN_BURST", LUA_NATIVE_VEHICLE_GET_VEHICLE_TYRES_CAN_BURST);
-		VEHICLE.set_function("SET_VEHICLE_WHEELS_CAN_BREAK", LUA_NATIVE_VEHICLE_SET_VEHICLE_WHEELS_CAN_BREAK);
-		VEHICLE.set_function("SET_VEHICLE_DOOR_OPEN", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_OPEN);
-		VEHICLE.set_function("SET_VEHICLE_DOOR_AUTO_LOCK", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_AUTO_LOCK);
-		VEHICLE.set_function("SET_FLEEING_VEHICLES_USE_SWITCHED_OFF_NODES", LUA_NATIVE_VEHICLE_SET_FLEEING_VEHICLES_USE_SWITCHED_OFF_NODES);
-		VEHICLE.set_function("REMOVE_VEHICLE_WINDOW", LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_WINDOW);
-		VEHICLE.set_function("ROLL_DOWN_WINDOWS", LUA_NATIVE_VEHICLE_ROLL_DOWN_WINDOWS);
-		VEHICLE.set_function("ROLL_DOWN_WINDOW", LUA_NATIVE_VEHICLE_ROLL_DOWN_WINDOW);
-		VEHICLE.set_function("ROLL_UP_WINDOW", LUA_NATIVE_VEHICLE_ROLL_UP_WINDOW);
-		VEHICLE.set_function("SMASH_VEHICLE_WINDOW", LUA_NATIVE_VEHICLE_SMASH_VEHICLE_WINDOW);
-		VEHICLE.set_function("FIX_VEHICLE_WINDOW", LUA_NATIVE_VEHICLE_FIX_VEHICLE_WINDOW);
-		VEHICLE.set_function("POP_OUT_VEHICLE_WINDSCREEN", LUA_NATIVE_VEHICLE_POP_OUT_VEHICLE_WINDSCREEN);
-		VEHICLE.set_function("POP_OFF_VEHICLE_ROOF_WITH_IMPULSE", LUA_NATIVE_VEHICLE_POP_OFF_VEHICLE_ROOF_WITH_IMPULSE);
-		VEHICLE.set_function("SET_VEHICLE_LIGHTS", LUA_NATIVE_VEHICLE_SET_VEHICLE_LIGHTS);
-		VEHICLE.set_function("SET_VEHICLE_USE_PLAYER_LIGHT_SETTINGS", LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_PLAYER_LIGHT_SETTINGS);
-		VEHICLE.set_function("SET_VEHICLE_HEADLIGHT_SHADOWS", LUA_NATIVE_VEHICLE_SET_VEHICLE_HEADLIGHT_SHADOWS);
-		VEHICLE.set_function("SET_VEHICLE_ALARM", LUA_NATIVE_VEHICLE_SET_VEHICLE_ALARM);
-		VEHICLE.set_function("START_VEHICLE_ALARM", LUA_NATIVE_VEHICLE_START_VEHICLE_ALARM);
-		VEHICLE.set_function("IS_VEHICLE_ALARM_ACTIVATED", LUA_NATIVE_VEHICLE_IS_VEHICLE_ALARM_ACTIVATED);
-		VEHICLE.set_function("SET_VEHICLE_INTERIORLIGHT", LUA_NATIVE_VEHICLE_SET_VEHICLE_INTERIORLIGHT);
-		VEHICLE.set_function("SET_VEHICLE_FORCE_INTERIORLIGHT", LUA_NATIVE_VEHICLE_SET_VEHICLE_FORCE_INTERIORLIGHT);
-		VEHICLE.set_function("SET_VEHICLE_LIGHT_MULTIPLIER", LUA_NATIVE_VEHICLE_SET_VEHICLE_LIGHT_MULTIPLIER);
-		VEHICLE.set_function("ATTACH_VEHICLE_TO_TRAILER", LUA_NATIVE_VEHICLE_ATTACH_VEHICLE_TO_TRAILER);
-		VEHICLE.set_function("ATTACH_VEHICLE_ON_TO_TRAILER", LUA_NATIVE_VEHICLE_ATTACH_VEHICLE_ON_TO_TRAILER);
-		VEHICLE.set_function("STABILISE_ENTITY_ATTACHED_TO_HELI", LUA_NATIVE_VEHICLE_STABILISE_ENTITY_ATTACHED_TO_HELI);
-		VEHICLE.set_function("DETACH_VEHICLE_FROM_TRAILER", LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_TRAILER);
-		VEHICLE.set_function("IS_VEHICLE_ATTACHED_TO_TRAILER", LUA_NATIVE_VEHICLE_IS_VEHICLE_ATTACHED_TO_TRAILER);
-		VEHICLE.set_function("SET_TRAILER_INVERSE_MASS_SCALE", LUA_NATIVE_VEHICLE_SET_TRAILER_INVERSE_MASS_SCALE);
-		VEHICLE.set_function("SET_TRAILER_LEGS_RAISED", LUA_NATIVE_VEHICLE_SET_TRAILER_LEGS_RAISED);
-		VEHICLE.set_function("SET_TRAILER_LEGS_LOWERED", LUA_NATIVE_VEHICLE_SET_TRAILER_LEGS_LOWERED);
-		VEHICLE.set_function("SET_VEHICLE_TYRE_FIXED", LUA_NATIVE_VEHICLE_SET_VEHICLE_TYRE_FIXED);
-		VEHICLE.set_function("SET_VEHICLE_NUMBER_PLATE_TEXT", LUA_NATIVE_VEHICLE_SET_VEHICLE_NUMBER_PLATE_TEXT);
-		VEHICLE.set_function("GET_VEHICLE_NUMBER_PLATE_TEXT", LUA_NATIVE_VEHICLE_GET_VEHICLE_NUMBER_PLATE_TEXT);
-		VEHICLE.set_function("GET_NUMBER_OF_VEHICLE_NUMBER_PLATES", LUA_NATIVE_VEHICLE_GET_NUMBER_OF_VEHICLE_NUMBER_PLATES);
-		VEHICLE.set_function("SET_VEHICLE_NUMBER_PLATE_TEXT_INDEX", LUA_NATIVE_VEHICLE_SET_VEHICLE_NUMBER_PLATE_TEXT_INDEX);
-		VEHICLE.set_function("GET_VEHICLE_NUMBER_PLATE_TEXT_INDEX", LUA_NATIVE_VEHICLE_GET_VEHICLE_NUMBER_PLATE_TEXT_INDEX);
-		VEHICLE.set_function("SET_RANDOM_TRAINS", LUA_NATIVE_VEHICLE_SET_RANDOM_TRAINS);
-		VEHICLE.set_function("CREATE_MISSION_TRAIN", LUA_NATIVE_VEHICLE_CREATE_MISSION_TRAIN);
-		VEHICLE.set_function("SWITCH_TRAIN_TRACK", LUA_NATIVE_VEHICLE_SWITCH_TRAIN_TRACK);
-		VEHICLE.set_function("SET_TRAIN_TRACK_SPAWN_FREQUENCY", LUA_NATIVE_VEHICLE_SET_TRAIN_TRACK_SPAWN_FREQUENCY);
-		VEHICLE.set_function("ALLOW_TRAIN_TO_BE_REMOVED_BY_POPULATION", LUA_NATIVE_VEHICLE_ALLOW_TRAIN_TO_BE_REMOVED_BY_POPULATION);
-		VEHICLE.set_function("DELETE_ALL_TRAINS", LUA_NATIVE_VEHICLE_DELETE_ALL_TRAINS);
-		VEHICLE.set_function("SET_TRAIN_SPEED", LUA_NATIVE_VEHICLE_SET_TRAIN_SPEED);
-		VEHICLE.set_function("SET_TRAIN_CRUISE_SPEED", LUA_NATIVE_VEHICLE_SET_TRAIN_CRUISE_SPEED);
-		VEHICLE.set_function("SET_RANDOM_BOATS", LUA_NATIVE_VEHICLE_SET_RANDOM_BOATS);
-		VEHICLE.set_function("SET_RANDOM_BOATS_MP", LUA_NATIVE_VEHICLE_SET_RANDOM_BOATS_MP);
-		VEHICLE.set_function("SET_GARBAGE_TRUCKS", LUA_NATIVE_VEHICLE_SET_GARBAGE_TRUCKS);
-		VEHICLE.set_function("DOES_VEHICLE_HAVE_STUCK_VEHICLE_CHECK", LUA_NATIVE_VEHICLE_DOES_VEHICLE_HAVE_STUCK_VEHICLE_CHECK);
-		VEHICLE.set_function("GET_VEHICLE_RECORDING_ID", LUA_NATIVE_VEHICLE_GET_VEHICLE_RECORDING_ID);
-		VEHICLE.set_function("REQUEST_VEHICLE_RECORDING", LUA_NATIVE_VEHICLE_REQUEST_VEHICLE_RECORDING);
-		VEHICLE.set_function("HAS_VEHICLE_RECORDING_BEEN_LOADED", LUA_NATIVE_VEHICLE_HAS_VEHICLE_RECORDING_BEEN_LOADED);
-		VEHICLE.set_function("REMOVE_VEHICLE_RECORDING", LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_RECORDING);
-		VEHICLE.set_function("GET_POSITION_OF_VEHICLE_RECORDING_ID_AT_TIME", LUA_NATIVE_VEHICLE_GET_POSITION_OF_VEHICLE_RECORDING_ID_AT_TIME);
-		VEHICLE.set_function("GET_POSITION_OF_VEHICLE_RECORDING_AT_TIME", LUA_NATIVE_VEHICLE_GET_POSITION_OF_VEHICLE_RECORDING_AT_TIME);
-		VEHICLE.set_function("GET_ROTATION_OF_VEHICLE_RECORDING_ID_AT_TIME", LUA_NATIVE_VEHICLE_GET_ROTATION_OF_VEHICLE_RECORDING_ID_AT_TIME);
-		VEHICLE.set_function("GET_ROTATION_OF_VEHICLE_RECORDING_AT_TIME", LUA_NATIVE_VEHICLE_GET_ROTATION_OF_VEHICLE_RECORDING_AT_TIME);
-		VEHICLE.set_function("GET_TOTAL_DURATION_OF_VEHICLE_RECORDING_ID", LUA_NATIVE_VEHICLE_GET_TOTAL_DURATION_OF_VEHICLE_RECORDING_ID);
-		VEHICLE.set_function("GET_TOTAL_DURATION_OF_VEHICLE_RECORDING", LUA_NATIVE_VEHICLE_GET_TOTAL_DURATION_OF_VEHICLE_RECORDING);
-		VEHICLE.set_function("GET_POSITION_IN_RECORDING", LUA_NATIVE_VEHICLE_GET_POSITION_IN_RECORDING);
-		VEHICLE.set_function("GET_TIME_POSITION_IN_RECORDING", LUA_NATIVE_VEHICLE_GET_TIME_POSITION_IN_RECORDING);
-		VEHICLE.set_function("START_PLAYBACK_RECORDED_VEHICLE", LUA_NATIVE_VEHICLE_START_PLAYBACK_RECORDED_VEHICLE);
-		VEHICLE.set_function("START_PLAYBACK_RECORDED_VEHICLE_WITH_FLAGS", LUA_NATIVE_VEHICLE_START_PLAYBACK_RECORDED_VEHICLE_WITH_FLAGS);
-		VEHICLE.set_function("FORCE_PLAYBACK_RECORDED_VEHICLE_UPDATE", LUA_NATIVE_VEHICLE_FORCE_PLAYBACK_RECORDED_VEHICLE_UPDATE);
-		VEHICLE.set_function("STOP_PLAYBACK_RECORDED_VEHICLE", LUA_NATIVE_VEHICLE_STOP_PLAYBACK_RECORDED_VEHICLE);
-		VEHICLE.set_function("PAUSE_PLAYBACK_RECORDED_VEHICLE", LUA_NATIVE_VEHICLE_PAUSE_PLAYBACK_RECORDED_VEHICLE);
-		VEHICLE.set_function("UNPAUSE_PLAYBACK_RECORDED_VEHICLE", LUA_NATIVE_VEHICLE_UNPAUSE_PLAYBACK_RECORDED_VEHICLE);
-		VEHICLE.set_function("IS_PLAYBACK_GOING_ON_FOR_VEHICLE", LUA_NATIVE_VEHICLE_IS_PLAYBACK_GOING_ON_FOR_VEHICLE);
-		VEHICLE.set_function("IS_PLAYBACK_USING_AI_GOING_ON_FOR_VEHICLE", LUA_NATIVE_VEHICLE_IS_PLAYBACK_USING_AI_GOING_ON_FOR_VEHICLE);
-		VEHICLE.set_function("GET_CURRENT_PLAYBACK_FOR_VEHICLE", LUA_NATIVE_VEHICLE_GET_CURRENT_PLAYBACK_FOR_VEHICLE);
-		VEHICLE.set_function("SKIP_TO_END_AND_STOP_PLAYBACK_RECORDED_VEHICLE", LUA_NATIVE_VEHICLE_SKIP_TO_END_AND_STOP_PLAYBACK_RECORDED_VEHICLE);
-		VEHICLE.set_function("SET_PLAYBACK_SPEED", LUA_NATIVE_VEHICLE_SET_PLAYBACK_SPEED);
-		VEHICLE.set_function("START_PLAYBACK_RECORDED_VEHICLE_USING_AI", LUA_NATIVE_VEHICLE_START_PLAYBACK_RECORDED_VEHICLE_USING_AI);
-		VEHICLE.set_function("SKIP_TIME_IN_PLAYBACK_RECORDED_VEHICLE", LUA_NATIVE_VEHICLE_SKIP_TIME_IN_PLAYBACK_RECORDED_VEHICLE);
-		VEHICLE.set_function("SET_PLAYBACK_TO_USE_AI", LUA_NATIVE_VEHICLE_SET_PLAYBACK_TO_USE_AI);
-		VEHICLE.set_function("SET_PLAYBACK_TO_USE_AI_TRY_TO_REVERT_BACK_LATER", LUA_NATIVE_VEHICLE_SET_PLAYBACK_TO_USE_AI_TRY_TO_REVERT_BACK_LATER);
-		VEHICLE.set_function("SET_ADDITIONAL_ROTATION_FOR_RECORDED_VEHICLE_PLAYBACK", LUA_NATIVE_VEHICLE_SET_ADDITIONAL_ROTATION_FOR_RECORDED_VEHICLE_PLAYBACK);
-		VEHICLE.set_function("SET_POSITION_OFFSET_FOR_RECORDED_VEHICLE_PLAYBACK", LUA_NATIVE_VEHICLE_SET_POSITION_OFFSET_FOR_RECORDED_VEHICLE_PLAYBACK);
-		VEHICLE.set_function("SET_GLOBAL_POSITION_OFFSET_FOR_RECORDED_VEHICLE_PLAYBACK", LUA_NATIVE_VEHICLE_SET_GLOBAL_POSITION_OFFSET_FOR_RECORDED_VEHICLE_PLAYBACK);
-		VEHICLE.set_function("SET_SHOULD_LERP_FROM_AI_TO_FULL_RECORDING", LUA_NATIVE_VEHICLE_SET_SHOULD_LERP_FROM_AI_TO_FULL_RECORDING);
-		VEHICLE.set_function("EXPLODE_VEHICLE_IN_CUTSCENE", LUA_NATIVE_VEHICLE_EXPLODE_VEHICLE_IN_CUTSCENE);
-		VEHICLE.set_function("ADD_VEHICLE_STUCK_CHECK_WITH_WARP", LUA_NATIVE_VEHICLE_ADD_VEHICLE_STUCK_CHECK_WITH_WARP);
-		VEHICLE.set_function("SET_VEHICLE_MODEL_IS_SUPPRESSED", LUA_NATIVE_VEHICLE_SET_VEHICLE_MODEL_IS_SUPPRESSED);
-		VEHICLE.set_function("GET_RANDOM_VEHICLE_IN_SPHERE", LUA_NATIVE_VEHICLE_GET_RANDOM_VEHICLE_IN_SPHERE);
-		VEHICLE.set_function("GET_RANDOM_VEHICLE_FRONT_BUMPER_IN_SPHERE", LUA_NATIVE_VEHICLE_GET_RANDOM_VEHICLE_FRONT_BUMPER_IN_SPHERE);
-		VEHICLE.set_function("GET_RANDOM_VEHICLE_BACK_BUMPER_IN_SPHERE", LUA_NATIVE_VEHICLE_GET_RANDOM_VEHICLE_BACK_BUMPER_IN_SPHERE);
-		VEHICLE.set_function("GET_CLOSEST_VEHICLE", LUA_NATIVE_VEHICLE_GET_CLOSEST_VEHICLE);
-		VEHICLE.set_function("GET_TRAIN_CARRIAGE", LUA_NATIVE_VEHICLE_GET_TRAIN_CARRIAGE);
-		VEHICLE.set_function("IS_MISSION_TRAIN", LUA_NATIVE_VEHICLE_IS_MISSION_TRAIN);
-		VEHICLE.set_function("DELETE_MISSION_TRAIN", LUA_NATIVE_VEHICLE_DELETE_MISSION_TRAIN);
-		VEHICLE.set_function("SET_MISSION_TRAIN_AS_NO_LONGER_NEEDED", LUA_NATIVE_VEHICLE_SET_MISSION_TRAIN_AS_NO_LONGER_NEEDED);
-		VEHICLE.set_function("SET_MISSION_TRAIN_COORDS", LUA_NATIVE_VEHICLE_SET_MISSION_TRAIN_COORDS);
-		VEHICLE.set_function("IS_THIS_MODEL_A_BOAT", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_BOAT);
-		VEHICLE.set_function("IS_THIS_MODEL_A_JETSKI", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_JETSKI);
-		VEHICLE.set_function("IS_THIS_MODEL_A_PLANE", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_PLANE);
-		VEHICLE.set_function("IS_THIS_MODEL_A_HELI", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_HELI);
-		VEHICLE.set_function("IS_THIS_MODEL_A_CAR", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_CAR);
-		VEHICLE.set_function("IS_THIS_MODEL_A_TRAIN", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_TRAIN);
-		VEHICLE.set_function("IS_THIS_MODEL_A_BIKE", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_BIKE);
-		VEHICLE.set_function("IS_THIS_MODEL_A_BICYCLE", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_BICYCLE);
-		VEHICLE.set_function("IS_THIS_MODEL_A_QUADBIKE", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_A_QUADBIKE);
-		VEHICLE.set_function("IS_THIS_MODEL_AN_AMPHIBIOUS_CAR", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_AN_AMPHIBIOUS_CAR);
-		VEHICLE.set_function("IS_THIS_MODEL_AN_AMPHIBIOUS_QUADBIKE", LUA_NATIVE_VEHICLE_IS_THIS_MODEL_AN_AMPHIBIOUS_QUADBIKE);
-		VEHICLE.set_function("SET_HELI_BLADES_FULL_SPEED", LUA_NATIVE_VEHICLE_SET_HELI_BLADES_FULL_SPEED);
-		VEHICLE.set_function("SET_HELI_BLADES_SPEED", LUA_NATIVE_VEHICLE_SET_HELI_BLADES_SPEED);
-		VEHICLE.set_function("FORCE_SUB_THROTTLE_FOR_TIME", LUA_NATIVE_VEHICLE_FORCE_SUB_THROTTLE_FOR_TIME);
-		VEHICLE.set_function("SET_VEHICLE_CAN_BE_TARGETTED", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_BE_TARGETTED);
-		VEHICLE.set_function("SET_DONT_ALLOW_PLAYER_TO_ENTER_VEHICLE_IF_LOCKED_FOR_PLAYER", LUA_NATIVE_VEHICLE_SET_DONT_ALLOW_PLAYER_TO_ENTER_VEHICLE_IF_LOCKED_FOR_PLAYER);
-		VEHICLE.set_function("SET_VEHICLE_CAN_BE_VISIBLY_DAMAGED", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_BE_VISIBLY_DAMAGED);
-		VEHICLE.set_function("SET_VEHICLE_HAS_UNBREAKABLE_LIGHTS", LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_UNBREAKABLE_LIGHTS);
-		VEHICLE.set_function("SET_VEHICLE_RESPECTS_LOCKS_WHEN_HAS_DRIVER", LUA_NATIVE_VEHICLE_SET_VEHICLE_RESPECTS_LOCKS_WHEN_HAS_DRIVER);
-		VEHICLE.set_function("SET_VEHICLE_CAN_EJECT_PASSENGERS_IF_LOCKED", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_EJECT_PASSENGERS_IF_LOCKED);
-		VEHICLE.set_function("GET_VEHICLE_DIRT_LEVEL", LUA_NATIVE_VEHICLE_GET_VEHICLE_DIRT_LEVEL);
-		VEHICLE.set_function("SET_VEHICLE_DIRT_LEVEL", LUA_NATIVE_VEHICLE_SET_VEHICLE_DIRT_LEVEL);
-		VEHICLE.set_function("GET_DOES_VEHICLE_HAVE_DAMAGE_DECALS", LUA_NATIVE_VEHICLE_GET_DOES_VEHICLE_HAVE_DAMAGE_DECALS);
-		VEHICLE.set_function("IS_VEHICLE_DOOR_FULLY_OPEN", LUA_NATIVE_VEHICLE_IS_VEHICLE_DOOR_FULLY_OPEN);
-		VEHICLE.set_function("SET_VEHICLE_ENGINE_ON", LUA_NATIVE_VEHICLE_SET_VEHICLE_ENGINE_ON);
-		VEHICLE.set_function("SET_VEHICLE_UNDRIVEABLE", LUA_NATIVE_VEHICLE_SET_VEHICLE_UNDRIVEABLE);
-		VEHICLE.set_function("SET_VEHICLE_PROVIDES_COVER", LUA_NATIVE_VEHICLE_SET_VEHICLE_PROVIDES_COVER);
-		VEHICLE.set_function("SET_VEHICLE_DOOR_CONTROL", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_CONTROL);
-		VEHICLE.set_function("SET_VEHICLE_DOOR_LATCHED", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_LATCHED);
-		VEHICLE.set_function("GET_VEHICLE_DOOR_ANGLE_RATIO", LUA_NATIVE_VEHICLE_GET_VEHICLE_DOOR_ANGLE_RATIO);
-		VEHICLE.set_function("GET_PED_USING_VEHICLE_DOOR", LUA_NATIVE_VEHICLE_GET_PED_USING_VEHICLE_DOOR);
-		VEHICLE.set_function("SET_VEHICLE_DOOR_SHUT", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_SHUT);
-		VEHICLE.set_function("SET_VEHICLE_DOOR_BROKEN", LUA_NATIVE_VEHICLE_SET_VEHICLE_DOOR_BROKEN);
-		VEHICLE.set_function("SET_VEHICLE_CAN_BREAK", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_BREAK);
-		VEHICLE.set_function("DOES_VEHICLE_HAVE_ROOF", LUA_NATIVE_VEHICLE_DOES_VEHICLE_HAVE_ROOF);
-		VEHICLE.set_function("SET_VEHICLE_REMOVE_AGGRESSIVE_CARJACK_MISSION", LUA_NATIVE_VEHICLE_SET_VEHICLE_REMOVE_AGGRESSIVE_CARJACK_MISSION);
-		VEHICLE.set_function("SET_VEHICLE_AVOID_PLAYER_VEHICLE_RIOT_VAN_MISSION", LUA_NATIVE_VEHICLE_SET_VEHICLE_AVOID_PLAYER_VEHICLE_RIOT_VAN_MISSION);
-		VEHICLE.set_function("SET_CARJACK_MISSION_REMOVAL_PARAMETERS", LUA_NATIVE_VEHICLE_SET_CARJACK_MISSION_REMOVAL_PARAMETERS);
-		VEHICLE.set_function("IS_BIG_VEHICLE", LUA_NATIVE_VEHICLE_IS_BIG_VEHICLE);
-		VEHICLE.set_function("GET_NUMBER_OF_VEHICLE_COLOURS", LUA_NATIVE_VEHICLE_GET_NUMBER_OF_VEHICLE_COLOURS);
-		VEHICLE.set_function("SET_VEHICLE_COLOUR_COMBINATION", LUA_NATIVE_VEHICLE_SET_VEHICLE_COLOUR_COMBINATION);
-		VEHICLE.set_function("GET_VEHICLE_COLOUR_COMBINATION", LUA_NATIVE_VEHICLE_GET_VEHICLE_COLOUR_COMBINATION);
-		VEHICLE.set_function("SET_VEHICLE_XENON_LIGHT_COLOR_INDEX", LUA_NATIVE_VEHICLE_SET_VEHICLE_XENON_LIGHT_COLOR_INDEX);
-		VEHICLE.set_function("GET_VEHICLE_XENON_LIGHT_COLOR_INDEX", LUA_NATIVE_VEHICLE_GET_VEHICLE_XENON_LIGHT_COLOR_INDEX);
-		VEHICLE.set_function("SET_VEHICLE_IS_CONSIDERED_BY_PLAYER", LUA_NATIVE_VEHICLE_SET_VEHICLE_IS_CONSIDERED_BY_PLAYER);
-		VEHICLE.set_function("SET_VEHICLE_WILL_FORCE_OTHER_VEHICLES_TO_STOP", LUA_NATIVE_VEHICLE_SET_VEHICLE_WILL_FORCE_OTHER_VEHICLES_TO_STOP);
-		VEHICLE.set_function("SET_VEHICLE_ACT_AS_IF_HAS_SIREN_ON", LUA_NATIVE_VEHICLE_SET_VEHICLE_ACT_AS_IF_HAS_SIREN_ON);
-		VEHICLE.set_function("SET_VEHICLE_USE_MORE_RESTRICTIVE_SPAWN_CHECKS", LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_MORE_RESTRICTIVE_SPAWN_CHECKS);
-		VEHICLE.set_function("SET_VEHICLE_MAY_BE_USED_BY_GOTO_POINT_ANY_MEANS", LUA_NATIVE_VEHICLE_SET_VEHICLE_MAY_BE_USED_BY_GOTO_POINT_ANY_MEANS);
-		VEHICLE.set_function("GET_RANDOM_VEHICLE_MODEL_IN_MEMORY", LUA_NATIVE_VEHICLE_GET_RANDOM_VEHICLE_MODEL_IN_MEMORY);
-		VEHICLE.set_function("GET_VEHICLE_DOOR_LOCK_STATUS", LUA_NATIVE_VEHICLE_GET_VEHICLE_DOOR_LOCK_STATUS);
-		VEHICLE.set_function("GET_VEHICLE_INDIVIDUAL_DOOR_LOCK_STATUS", LUA_NATIVE_VEHICLE_GET_VEHICLE_INDIVIDUAL_DOOR_LOCK_STATUS);
-		VEHICLE.set_function("IS_VEHICLE_DOOR_DAMAGED", LUA_NATIVE_VEHICLE_IS_VEHICLE_DOOR_DAMAGED);
-		VEHICLE.set_function("SET_DOOR_ALLOWED_TO_BE_BROKEN_OFF", LUA_NATIVE_VEHICLE_SET_DOOR_ALLOWED_TO_BE_BROKEN_OFF);
-		VEHICLE.set_function("IS_VEHICLE_BUMPER_BOUNCING", LUA_NATIVE_VEHICLE_IS_VEHICLE_BUMPER_BOUNCING);
-		VEHICLE.set_function("IS_VEHICLE_BUMPER_BROKEN_OFF", LUA_NATIVE_VEHICLE_IS_VEHICLE_BUMPER_BROKEN_OFF);
-		VEHICLE.set_function("IS_COP_VEHICLE_IN_AREA_3D", LUA_NATIVE_VEHICLE_IS_COP_VEHICLE_IN_AREA_3D);
-		VEHICLE.set_function("IS_VEHICLE_ON_ALL_WHEELS", LUA_NATIVE_VEHICLE_IS_VEHICLE_ON_ALL_WHEELS);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_VALUE", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_VALUE);
-		VEHICLE.set_function("GET_VEHICLE_LAYOUT_HASH", LUA_NATIVE_VEHICLE_GET_VEHICLE_LAYOUT_HASH);
-		VEHICLE.set_function("GET_IN_VEHICLE_CLIPSET_HASH_FOR_SEAT", LUA_NATIVE_VEHICLE_GET_IN_VEHICLE_CLIPSET_HASH_FOR_SEAT);
-		VEHICLE.set_function("SET_RENDER_TRAIN_AS_DERAILED", LUA_NATIVE_VEHICLE_SET_RENDER_TRAIN_AS_DERAILED);
-		VEHICLE.set_function("SET_VEHICLE_EXTRA_COLOURS", LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTRA_COLOURS);
-		VEHICLE.set_function("GET_VEHICLE_EXTRA_COLOURS", LUA_NATIVE_VEHICLE_GET_VEHICLE_EXTRA_COLOURS);
-		VEHICLE.set_function("SET_VEHICLE_EXTRA_COLOUR_5", LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTRA_COLOUR_5);
-		VEHICLE.set_function("GET_VEHICLE_EXTRA_COLOUR_5", LUA_NATIVE_VEHICLE_GET_VEHICLE_EXTRA_COLOUR_5);
-		VEHICLE.set_function("SET_VEHICLE_EXTRA_COLOUR_6", LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTRA_COLOUR_6);
-		VEHICLE.set_function("GET_VEHICLE_EXTRA_COLOUR_6", LUA_NATIVE_VEHICLE_GET_VEHICLE_EXTRA_COLOUR_6);
-		VEHICLE.set_function("STOP_ALL_GARAGE_ACTIVITY", LUA_NATIVE_VEHICLE_STOP_ALL_GARAGE_ACTIVITY);
-		VEHICLE.set_function("SET_VEHICLE_FIXED", LUA_NATIVE_VEHICLE_SET_VEHICLE_FIXED);
-		VEHICLE.set_function("SET_VEHICLE_DEFORMATION_FIXED", LUA_NATIVE_VEHICLE_SET_VEHICLE_DEFORMATION_FIXED);
-		VEHICLE.set_function("SET_VEHICLE_CAN_ENGINE_MISSFIRE", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_ENGINE_MISSFIRE);
-		VEHICLE.set_function("SET_VEHICLE_CAN_LEAK_OIL", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_LEAK_OIL);
-		VEHICLE.set_function("SET_VEHICLE_CAN_LEAK_PETROL", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_LEAK_PETROL);
-		VEHICLE.set_function("SET_DISABLE_VEHICLE_PETROL_TANK_FIRES", LUA_NATIVE_VEHICLE_SET_DISABLE_VEHICLE_PETROL_TANK_FIRES);
-		VEHICLE.set_function("SET_DISABLE_VEHICLE_PETROL_TANK_DAMAGE", LUA_NATIVE_VEHICLE_SET_DISABLE_VEHICLE_PETROL_TANK_DAMAGE);
-		VEHICLE.set_function("SET_DISABLE_VEHICLE_ENGINE_FIRES", LUA_NATIVE_VEHICLE_SET_DISABLE_VEHICLE_ENGINE_FIRES);
-		VEHICLE.set_function("SET_VEHICLE_LIMIT_SPEED_WHEN_PLAYER_INACTIVE", LUA_NATIVE_VEHICLE_SET_VEHICLE_LIMIT_SPEED_WHEN_PLAYER_INACTIVE);
-		VEHICLE.set_function("SET_VEHICLE_STOP_INSTANTLY_WHEN_PLAYER_INACTIVE", LUA_NATIVE_VEHICLE_SET_VEHICLE_STOP_INSTANTLY_WHEN_PLAYER_INACTIVE);
-		VEHICLE.set_function("SET_DISABLE_PRETEND_OCCUPANTS", LUA_NATIVE_VEHICLE_SET_DISABLE_PRETEND_OCCUPANTS);
-		VEHICLE.set_function("REMOVE_VEHICLES_FROM_GENERATORS_IN_AREA", LUA_NATIVE_VEHICLE_REMOVE_VEHICLES_FROM_GENERATORS_IN_AREA);
-		VEHICLE.set_function("SET_VEHICLE_STEER_BIAS", LUA_NATIVE_VEHICLE_SET_VEHICLE_STEER_BIAS);
-		VEHICLE.set_function("IS_VEHICLE_EXTRA_TURNED_ON", LUA_NATIVE_VEHICLE_IS_VEHICLE_EXTRA_TURNED_ON);
-		VEHICLE.set_function("SET_VEHICLE_EXTRA", LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTRA);
-		VEHICLE.set_function("DOES_EXTRA_EXIST", LUA_NATIVE_VEHICLE_DOES_EXTRA_EXIST);
-		VEHICLE.set_function("IS_EXTRA_BROKEN_OFF", LUA_NATIVE_VEHICLE_IS_EXTRA_BROKEN_OFF);
-		VEHICLE.set_function("SET_CONVERTIBLE_ROOF", LUA_NATIVE_VEHICLE_SET_CONVERTIBLE_ROOF);
-		VEHICLE.set_function("LOWER_CONVERTIBLE_ROOF", LUA_NATIVE_VEHICLE_LOWER_CONVERTIBLE_ROOF);
-		VEHICLE.set_function("RAISE_CONVERTIBLE_ROOF", LUA_NATIVE_VEHICLE_RAISE_CONVERTIBLE_ROOF);
-		VEHICLE.set_function("GET_CONVERTIBLE_ROOF_STATE", LUA_NATIVE_VEHICLE_GET_CONVERTIBLE_ROOF_STATE);
-		VEHICLE.set_function("IS_VEHICLE_A_CONVERTIBLE", LUA_NATIVE_VEHICLE_IS_VEHICLE_A_CONVERTIBLE);
-		VEHICLE.set_function("TRANSFORM_TO_SUBMARINE", LUA_NATIVE_VEHICLE_TRANSFORM_TO_SUBMARINE);
-		VEHICLE.set_function("TRANSFORM_TO_CAR", LUA_NATIVE_VEHICLE_TRANSFORM_TO_CAR);
-		VEHICLE.set_function("IS_VEHICLE_IN_SUBMARINE_MODE", LUA_NATIVE_VEHICLE_IS_VEHICLE_IN_SUBMARINE_MODE);
-		VEHICLE.set_function("IS_VEHICLE_STOPPED_AT_TRAFFIC_LIGHTS", LUA_NATIVE_VEHICLE_IS_VEHICLE_STOPPED_AT_TRAFFIC_LIGHTS);
-		VEHICLE.set_function("SET_VEHICLE_DAMAGE", LUA_NATIVE_VEHICLE_SET_VEHICLE_DAMAGE);
-		VEHICLE.set_function("SET_VEHICLE_OCCUPANTS_TAKE_EXPLOSIVE_DAMAGE", LUA_NATIVE_VEHICLE_SET_VEHICLE_OCCUPANTS_TAKE_EXPLOSIVE_DAMAGE);
-		VEHICLE.set_function("GET_VEHICLE_ENGINE_HEALTH", LUA_NATIVE_VEHICLE_GET_VEHICLE_ENGINE_HEALTH);
-		VEHICLE.set_function("SET_VEHICLE_ENGINE_HEALTH", LUA_NATIVE_VEHICLE_SET_VEHICLE_ENGINE_HEALTH);
-		VEHICLE.set_function("SET_PLANE_ENGINE_HEALTH", LUA_NATIVE_VEHICLE_SET_PLANE_ENGINE_HEALTH);
-		VEHICLE.set_function("GET_VEHICLE_PETROL_TANK_HEALTH", LUA_NATIVE_VEHICLE_GET_VEHICLE_PETROL_TANK_HEALTH);
-		VEHICLE.set_function("SET_VEHICLE_PETROL_TANK_HEALTH", LUA_NATIVE_VEHICLE_SET_VEHICLE_PETROL_TANK_HEALTH);
-		VEHICLE.set_function("IS_VEHICLE_STUCK_TIMER_UP", LUA_NATIVE_VEHICLE_IS_VEHICLE_STUCK_TIMER_UP);
-		VEHICLE.set_function("RESET_VEHICLE_STUCK_TIMER", LUA_NATIVE_VEHICLE_RESET_VEHICLE_STUCK_TIMER);
-		VEHICLE.set_function("IS_VEHICLE_DRIVEABLE", LUA_NATIVE_VEHICLE_IS_VEHICLE_DRIVEABLE);
-		VEHICLE.set_function("SET_VEHICLE_HAS_BEEN_OWNED_BY_PLAYER", LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_BEEN_OWNED_BY_PLAYER);
-		VEHICLE.set_function("SET_VEHICLE_NEEDS_TO_BE_HOTWIRED", LUA_NATIVE_VEHICLE_SET_VEHICLE_NEEDS_TO_BE_HOTWIRED);
-		VEHICLE.set_function("SET_VEHICLE_BLIP_THROTTLE_RANDOMLY", LUA_NATIVE_VEHICLE_SET_VEHICLE_BLIP_THROTTLE_RANDOMLY);
-		VEHICLE.set_function("SET_POLICE_FOCUS_WILL_TRACK_VEHICLE", LUA_NATIVE_VEHICLE_SET_POLICE_FOCUS_WILL_TRACK_VEHICLE);
-		VEHICLE.set_function("START_VEHICLE_HORN", LUA_NATIVE_VEHICLE_START_VEHICLE_HORN);
-		VEHICLE.set_function("SET_VEHICLE_IN_CAR_MOD_SHOP", LUA_NATIVE_VEHICLE_SET_VEHICLE_IN_CAR_MOD_SHOP);
-		VEHICLE.set_function("SET_VEHICLE_HAS_STRONG_AXLES", LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_STRONG_AXLES);
-		VEHICLE.set_function("GET_DISPLAY_NAME_FROM_VEHICLE_MODEL", LUA_NATIVE_VEHICLE_GET_DISPLAY_NAME_FROM_VEHICLE_MODEL);
-		VEHICLE.set_function("GET_MAKE_NAME_FROM_VEHICLE_MODEL", LUA_NATIVE_VEHICLE_GET_MAKE_NAME_FROM_VEHICLE_MODEL);
-		VEHICLE.set_function("GET_VEHICLE_DEFORMATION_AT_POS", LUA_NATIVE_VEHICLE_GET_VEHICLE_DEFORMATION_AT_POS);
-		VEHICLE.set_function("SET_VEHICLE_LIVERY", LUA_NATIVE_VEHICLE_SET_VEHICLE_LIVERY);
-		VEHICLE.set_function("GET_VEHICLE_LIVERY", LUA_NATIVE_VEHICLE_GET_VEHICLE_LIVERY);
-		VEHICLE.set_function("GET_VEHICLE_LIVERY_COUNT", LUA_NATIVE_VEHICLE_GET_VEHICLE_LIVERY_COUNT);
-		VEHICLE.set_function("SET_VEHICLE_LIVERY2", LUA_NATIVE_VEHICLE_SET_VEHICLE_LIVERY2);
-		VEHICLE.set_function("GET_VEHICLE_LIVERY2", LUA_NATIVE_VEHICLE_GET_VEHICLE_LIVERY2);
-		VEHICLE.set_function("GET_VEHICLE_LIVERY2_COUNT", LUA_NATIVE_VEHICLE_GET_VEHICLE_LIVERY2_COUNT);
-		VEHICLE.set_function("IS_VEHICLE_WINDOW_INTACT", LUA_NATIVE_VEHICLE_IS_VEHICLE_WINDOW_INTACT);
-		VEHICLE.set_function("ARE_ALL_VEHICLE_WINDOWS_INTACT", LUA_NATIVE_VEHICLE_ARE_ALL_VEHICLE_WINDOWS_INTACT);
-		VEHICLE.set_function("ARE_ANY_VEHICLE_SEATS_FREE", LUA_NATIVE_VEHICLE_ARE_ANY_VEHICLE_SEATS_FREE);
-		VEHICLE.set_function("RESET_VEHICLE_WHEELS", LUA_NATIVE_VEHICLE_RESET_VEHICLE_WHEELS);
-		VEHICLE.set_function("IS_HELI_PART_BROKEN", LUA_NATIVE_VEHICLE_IS_HELI_PART_BROKEN);
-		VEHICLE.set_function("GET_HELI_MAIN_ROTOR_HEALTH", LUA_NATIVE_VEHICLE_GET_HELI_MAIN_ROTOR_HEALTH);
-		VEHICLE.set_function("GET_HELI_TAIL_ROTOR_HEALTH", LUA_NATIVE_VEHICLE_GET_HELI_TAIL_ROTOR_HEALTH);
-		VEHICLE.set_function("GET_HELI_TAIL_BOOM_HEALTH", LUA_NATIVE_VEHICLE_GET_HELI_TAIL_BOOM_HEALTH);
-		VEHICLE.set_function("SET_HELI_MAIN_ROTOR_HEALTH", LUA_NATIVE_VEHICLE_SET_HELI_MAIN_ROTOR_HEALTH);
-		VEHICLE.set_function("SET_HELI_TAIL_ROTOR_HEALTH", LUA_NATIVE_VEHICLE_SET_HELI_TAIL_ROTOR_HEALTH);
-		VEHICLE.set_function("SET_HELI_TAIL_BOOM_CAN_BREAK_OFF", LUA_NATIVE_VEHICLE_SET_HELI_TAIL_BOOM_CAN_BREAK_OFF);
-		VEHICLE.set_function("SET_VEHICLE_NAME_DEBUG", LUA_NATIVE_VEHICLE_SET_VEHICLE_NAME_DEBUG);
-		VEHICLE.set_function("SET_VEHICLE_EXPLODES_ON_HIGH_EXPLOSION_DAMAGE", LUA_NATIVE_VEHICLE_SET_VEHICLE_EXPLODES_ON_HIGH_EXPLOSION_DAMAGE);
-		VEHICLE.set_function("SET_VEHICLE_EXPLODES_ON_EXPLOSION_DAMAGE_AT_ZERO_BODY_HEALTH", LUA_NATIVE_VEHICLE_SET_VEHICLE_EXPLODES_ON_EXPLOSION_DAMAGE_AT_ZERO_BODY_HEALTH);
-		VEHICLE.set_function("SET_ALLOW_VEHICLE_EXPLODES_ON_CONTACT", LUA_NATIVE_VEHICLE_SET_ALLOW_VEHICLE_EXPLODES_ON_CONTACT);
-		VEHICLE.set_function("SET_VEHICLE_DISABLE_TOWING", LUA_NATIVE_VEHICLE_SET_VEHICLE_DISABLE_TOWING);
-		VEHICLE.set_function("GET_VEHICLE_HAS_LANDING_GEAR", LUA_NATIVE_VEHICLE_GET_VEHICLE_HAS_LANDING_GEAR);
-		VEHICLE.set_function("CONTROL_LANDING_GEAR", LUA_NATIVE_VEHICLE_CONTROL_LANDING_GEAR);
-		VEHICLE.set_function("GET_LANDING_GEAR_STATE", LUA_NATIVE_VEHICLE_GET_LANDING_GEAR_STATE);
-		VEHICLE.set_function("IS_ANY_VEHICLE_NEAR_POINT", LUA_NATIVE_VEHICLE_IS_ANY_VEHICLE_NEAR_POINT);
-		VEHICLE.set_function("REQUEST_VEHICLE_HIGH_DETAIL_MODEL", LUA_NATIVE_VEHICLE_REQUEST_VEHICLE_HIGH_DETAIL_MODEL);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_NUM_DRIVE_GEARS_", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_NUM_DRIVE_GEARS_);
-		VEHICLE.set_function("GET_VEHICLE_MAX_DRIVE_GEAR_COUNT_", LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_DRIVE_GEAR_COUNT_);
-		VEHICLE.set_function("GET_VEHICLE_CURRENT_DRIVE_GEAR_", LUA_NATIVE_VEHICLE_GET_VEHICLE_CURRENT_DRIVE_GEAR_);
-		VEHICLE.set_function("GET_VEHICLE_CURRENT_REV_RATIO_", LUA_NATIVE_VEHICLE_GET_VEHICLE_CURRENT_REV_RATIO_);
-		VEHICLE.set_function("REMOVE_VEHICLE_HIGH_DETAIL_MODEL", LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_HIGH_DETAIL_MODEL);
-		VEHICLE.set_function("IS_VEHICLE_HIGH_DETAIL", LUA_NATIVE_VEHICLE_IS_VEHICLE_HIGH_DETAIL);
-		VEHICLE.set_function("REQUEST_VEHICLE_ASSET", LUA_NATIVE_VEHICLE_REQUEST_VEHICLE_ASSET);
-		VEHICLE.set_function("HAS_VEHICLE_ASSET_LOADED", LUA_NATIVE_VEHICLE_HAS_VEHICLE_ASSET_LOADED);
-		VEHICLE.set_function("REMOVE_VEHICLE_ASSET", LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_ASSET);
-		VEHICLE.set_function("SET_VEHICLE_TOW_TRUCK_ARM_POSITION", LUA_NATIVE_VEHICLE_SET_VEHICLE_TOW_TRUCK_ARM_POSITION);
-		VEHICLE.set_function("SET_ATTACHED_VEHICLE_TO_TOW_TRUCK_ARM_", LUA_NATIVE_VEHICLE_SET_ATTACHED_VEHICLE_TO_TOW_TRUCK_ARM_);
-		VEHICLE.set_function("ATTACH_VEHICLE_TO_TOW_TRUCK", LUA_NATIVE_VEHICLE_ATTACH_VEHICLE_TO_TOW_TRUCK);
-		VEHICLE.set_function("DETACH_VEHICLE_FROM_TOW_TRUCK", LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_TOW_TRUCK);
-		VEHICLE.set_function("DETACH_VEHICLE_FROM_ANY_TOW_TRUCK", LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_ANY_TOW_TRUCK);
-		VEHICLE.set_function("IS_VEHICLE_ATTACHED_TO_TOW_TRUCK", LUA_NATIVE_VEHICLE_IS_VEHICLE_ATTACHED_TO_TOW_TRUCK);
-		VEHICLE.set_function("GET_ENTITY_ATTACHED_TO_TOW_TRUCK", LUA_NATIVE_VEHICLE_GET_ENTITY_ATTACHED_TO_TOW_TRUCK);
-		VEHICLE.set_function("SET_VEHICLE_AUTOMATICALLY_ATTACHES", LUA_NATIVE_VEHICLE_SET_VEHICLE_AUTOMATICALLY_ATTACHES);
-		VEHICLE.set_function("SET_VEHICLE_BULLDOZER_ARM_POSITION", LUA_NATIVE_VEHICLE_SET_VEHICLE_BULLDOZER_ARM_POSITION);
-		VEHICLE.set_function("SET_VEHICLE_TANK_TURRET_POSITION", LUA_NATIVE_VEHICLE_SET_VEHICLE_TANK_TURRET_POSITION);
-		VEHICLE.set_function("SET_VEHICLE_TURRET_TARGET", LUA_NATIVE_VEHICLE_SET_VEHICLE_TURRET_TARGET);
-		VEHICLE.set_function("SET_VEHICLE_TANK_STATIONARY", LUA_NATIVE_VEHICLE_SET_VEHICLE_TANK_STATIONARY);
-		VEHICLE.set_function("SET_VEHICLE_TURRET_SPEED_THIS_FRAME", LUA_NATIVE_VEHICLE_SET_VEHICLE_TURRET_SPEED_THIS_FRAME);
-		VEHICLE.set_function("DISABLE_VEHICLE_TURRET_MOVEMENT_THIS_FRAME", LUA_NATIVE_VEHICLE_DISABLE_VEHICLE_TURRET_MOVEMENT_THIS_FRAME);
-		VEHICLE.set_function("SET_VEHICLE_FLIGHT_NOZZLE_POSITION", LUA_NATIVE_VEHICLE_SET_VEHICLE_FLIGHT_NOZZLE_POSITION);
-		VEHICLE.set_function("SET_VEHICLE_FLIGHT_NOZZLE_POSITION_IMMEDIATE", LUA_NATIVE_VEHICLE_SET_VEHICLE_FLIGHT_NOZZLE_POSITION_IMMEDIATE);
-		VEHICLE.set_function("GET_VEHICLE_FLIGHT_NOZZLE_POSITION", LUA_NATIVE_VEHICLE_GET_VEHICLE_FLIGHT_NOZZLE_POSITION);
-		VEHICLE.set_function("SET_DISABLE_VERTICAL_FLIGHT_MODE_TRANSITION", LUA_NATIVE_VEHICLE_SET_DISABLE_VERTICAL_FLIGHT_MODE_TRANSITION);
-		VEHICLE.set_function("GENERATE_VEHICLE_CREATION_POS_FROM_PATHS", LUA_NATIVE_VEHICLE_GENERATE_VEHICLE_CREATION_POS_FROM_PATHS);
-		VEHICLE.set_function("SET_VEHICLE_BURNOUT", LUA_NATIVE_VEHICLE_SET_VEHICLE_BURNOUT);
-		VEHICLE.set_function("IS_VEHICLE_IN_BURNOUT", LUA_NATIVE_VEHICLE_IS_VEHICLE_IN_BURNOUT);
-		VEHICLE.set_function("SET_VEHICLE_REDUCE_GRIP", LUA_NATIVE_VEHICLE_SET_VEHICLE_REDUCE_GRIP);
-		VEHICLE.set_function("SET_VEHICLE_REDUCE_GRIP_LEVEL", LUA_NATIVE_VEHICLE_SET_VEHICLE_REDUCE_GRIP_LEVEL);
-		VEHICLE.set_function("SET_VEHICLE_INDICATOR_LIGHTS", LUA_NATIVE_VEHICLE_SET_VEHICLE_INDICATOR_LIGHTS);
-		VEHICLE.set_function("SET_VEHICLE_BRAKE_LIGHTS", LUA_NATIVE_VEHICLE_SET_VEHICLE_BRAKE_LIGHTS);
-		VEHICLE.set_function("SET_VEHICLE_TAIL_LIGHTS", LUA_NATIVE_VEHICLE_SET_VEHICLE_TAIL_LIGHTS);
-		VEHICLE.set_function("SET_VEHICLE_HANDBRAKE", LUA_NATIVE_VEHICLE_SET_VEHICLE_HANDBRAKE);
-		VEHICLE.set_function("SET_VEHICLE_BRAKE", LUA_NATIVE_VEHICLE_SET_VEHICLE_BRAKE);
-		VEHICLE.set_function("INSTANTLY_FILL_VEHICLE_POPULATION", LUA_NATIVE_VEHICLE_INSTANTLY_FILL_VEHICLE_POPULATION);
-		VEHICLE.set_function("HAS_INSTANT_FILL_VEHICLE_POPULATION_FINISHED", LUA_NATIVE_VEHICLE_HAS_INSTANT_FILL_VEHICLE_POPULATION_FINISHED);
-		VEHICLE.set_function("NETWORK_ENABLE_EMPTY_CROWDING_VEHICLES_REMOVAL", LUA_NATIVE_VEHICLE_NETWORK_ENABLE_EMPTY_CROWDING_VEHICLES_REMOVAL);
-		VEHICLE.set_function("NETWORK_CAP_EMPTY_CROWDING_VEHICLES_REMOVAL", LUA_NATIVE_VEHICLE_NETWORK_CAP_EMPTY_CROWDING_VEHICLES_REMOVAL);
-		VEHICLE.set_function("GET_VEHICLE_TRAILER_VEHICLE", LUA_NATIVE_VEHICLE_GET_VEHICLE_TRAILER_VEHICLE);
-		VEHICLE.set_function("GET_VEHICLE_TRAILER_PARENT_VEHICLE_", LUA_NATIVE_VEHICLE_GET_VEHICLE_TRAILER_PARENT_VEHICLE_);
-		VEHICLE.set_function("SET_VEHICLE_USES_LARGE_REAR_RAMP", LUA_NATIVE_VEHICLE_SET_VEHICLE_USES_LARGE_REAR_RAMP);
-		VEHICLE.set_function("SET_VEHICLE_RUDDER_BROKEN", LUA_NATIVE_VEHICLE_SET_VEHICLE_RUDDER_BROKEN);
-		VEHICLE.set_function("SET_CONVERTIBLE_ROOF_LATCH_STATE", LUA_NATIVE_VEHICLE_SET_CONVERTIBLE_ROOF_LATCH_STATE);
-		VEHICLE.set_function("GET_VEHICLE_ESTIMATED_MAX_SPEED", LUA_NATIVE_VEHICLE_GET_VEHICLE_ESTIMATED_MAX_SPEED);
-		VEHICLE.set_function("GET_VEHICLE_MAX_BRAKING", LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_BRAKING);
-		VEHICLE.set_function("GET_VEHICLE_MAX_TRACTION", LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_TRACTION);
-		VEHICLE.set_function("GET_VEHICLE_ACCELERATION", LUA_NATIVE_VEHICLE_GET_VEHICLE_ACCELERATION);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_ESTIMATED_MAX_SPEED", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_ESTIMATED_MAX_SPEED);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_MAX_BRAKING", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_MAX_BRAKING);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_MAX_BRAKING_MAX_MODS", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_MAX_BRAKING_MAX_MODS);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_MAX_TRACTION", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_MAX_TRACTION);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_ACCELERATION", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_ACCELERATION);
-		VEHICLE.set_function("GET_VEHICLE_MODEL_ACCELERATION_MAX_MODS", LUA_NATIVE_VEHICLE_GET_VEHICLE_MODEL_ACCELERATION_MAX_MODS);
-		VEHICLE.set_function("GET_FLYING_VEHICLE_MODEL_AGILITY", LUA_NATIVE_VEHICLE_GET_FLYING_VEHICLE_MODEL_AGILITY);
-		VEHICLE.set_function("GET_BOAT_VEHICLE_MODEL_AGILITY", LUA_NATIVE_VEHICLE_GET_BOAT_VEHICLE_MODEL_AGILITY);
-		VEHICLE.set_function("GET_VEHICLE_CLASS_ESTIMATED_MAX_SPEED", LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_ESTIMATED_MAX_SPEED);
-		VEHICLE.set_function("GET_VEHICLE_CLASS_MAX_TRACTION", LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_MAX_TRACTION);
-		VEHICLE.set_function("GET_VEHICLE_CLASS_MAX_AGILITY", LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_MAX_AGILITY);
-		VEHICLE.set_function("GET_VEHICLE_CLASS_MAX_ACCELERATION", LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_MAX_ACCELERATION);
-		VEHICLE.set_function("GET_VEHICLE_CLASS_MAX_BRAKING", LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_MAX_BRAKING);
-		VEHICLE.set_function("ADD_ROAD_NODE_SPEED_ZONE", LUA_NATIVE_VEHICLE_ADD_ROAD_NODE_SPEED_ZONE);
-		VEHICLE.set_function("REMOVE_ROAD_NODE_SPEED_ZONE", LUA_NATIVE_VEHICLE_REMOVE_ROAD_NODE_SPEED_ZONE);
-		VEHICLE.set_function("OPEN_BOMB_BAY_DOORS", LUA_NATIVE_VEHICLE_OPEN_BOMB_BAY_DOORS);
-		VEHICLE.set_function("CLOSE_BOMB_BAY_DOORS", LUA_NATIVE_VEHICLE_CLOSE_BOMB_BAY_DOORS);
-		VEHICLE.set_function("GET_ARE_BOMB_BAY_DOORS_OPEN", LUA_NATIVE_VEHICLE_GET_ARE_BOMB_BAY_DOORS_OPEN);
-		VEHICLE.set_function("IS_VEHICLE_SEARCHLIGHT_ON", LUA_NATIVE_VEHICLE_IS_VEHICLE_SEARCHLIGHT_ON);
-		VEHICLE.set_function("SET_VEHICLE_SEARCHLIGHT", LUA_NATIVE_VEHICLE_SET_VEHICLE_SEARCHLIGHT);
-		VEHICLE.set_function("DOES_VEHICLE_HAVE_SEARCHLIGHT", LUA_NATIVE_VEHICLE_DOES_VEHICLE_HAVE_SEARCHLIGHT);
-		VEHICLE.set_function("IS_ENTRY_POINT_FOR_SEAT_CLEAR", LUA_NATIVE_VEHICLE_IS_ENTRY_POINT_FOR_SEAT_CLEAR);
-		VEHICLE.set_function("GET_ENTRY_POINT_POSITION", LUA_NATIVE_VEHICLE_GET_ENTRY_POINT_POSITION);
-		VEHICLE.set_function("CAN_SHUFFLE_SEAT", LUA_NATIVE_VEHICLE_CAN_SHUFFLE_SEAT);
-		VEHICLE.set_function("GET_NUM_MOD_KITS", LUA_NATIVE_VEHICLE_GET_NUM_MOD_KITS);
-		VEHICLE.set_function("SET_VEHICLE_MOD_KIT", LUA_NATIVE_VEHICLE_SET_VEHICLE_MOD_KIT);
-		VEHICLE.set_function("GET_VEHICLE_MOD_KIT", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_KIT);
-		VEHICLE.set_function("GET_VEHICLE_MOD_KIT_TYPE", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_KIT_TYPE);
-		VEHICLE.set_function("GET_VEHICLE_WHEEL_TYPE", LUA_NATIVE_VEHICLE_GET_VEHICLE_WHEEL_TYPE);
-		VEHICLE.set_function("SET_VEHICLE_WHEEL_TYPE", LUA_NATIVE_VEHICLE_SET_VEHICLE_WHEEL_TYPE);
-		VEHICLE.set_function("GET_NUM_MOD_COLORS", LUA_NATIVE_VEHICLE_GET_NUM_MOD_COLORS);
-		VEHICLE.set_function("SET_VEHICLE_MOD_COLOR_1", LUA_NATIVE_VEHICLE_SET_VEHICLE_MOD_COLOR_1);
-		VEHICLE.set_function("SET_VEHICLE_MOD_COLOR_2", LUA_NATIVE_VEHICLE_SET_VEHICLE_MOD_COLOR_2);
-		VEHICLE.set_function("GET_VEHICLE_MOD_COLOR_1", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_COLOR_1);
-		VEHICLE.set_function("GET_VEHICLE_MOD_COLOR_2", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_COLOR_2);
-		VEHICLE.set_function("GET_VEHICLE_MOD_COLOR_1_NAME", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_COLOR_1_NAME);
-		VEHICLE.set_function("GET_VEHICLE_MOD_COLOR_2_NAME", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_COLOR_2_NAME);
-		VEHICLE.set_function("HAVE_VEHICLE_MODS_STREAMED_IN", LUA_NATIVE_VEHICLE_HAVE_VEHICLE_MODS_STREAMED_IN);
-		VEHICLE.set_function("IS_VEHICLE_MOD_GEN9_EXCLUSIVE", LUA_NATIVE_VEHICLE_IS_VEHICLE_MOD_GEN9_EXCLUSIVE);
-		VEHICLE.set_function("SET_VEHICLE_MOD", LUA_NATIVE_VEHICLE_SET_VEHICLE_MOD);
-		VEHICLE.set_function("GET_VEHICLE_MOD", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD);
-		VEHICLE.set_function("GET_VEHICLE_MOD_VARIATION", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_VARIATION);
-		VEHICLE.set_function("GET_NUM_VEHICLE_MODS", LUA_NATIVE_VEHICLE_GET_NUM_VEHICLE_MODS);
-		VEHICLE.set_function("REMOVE_VEHICLE_MOD", LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_MOD);
-		VEHICLE.set_function("TOGGLE_VEHICLE_MOD", LUA_NATIVE_VEHICLE_TOGGLE_VEHICLE_MOD);
-		VEHICLE.set_function("IS_TOGGLE_MOD_ON", LUA_NATIVE_VEHICLE_IS_TOGGLE_MOD_ON);
-		VEHICLE.set_function("GET_MOD_TEXT_LABEL", LUA_NATIVE_VEHICLE_GET_MOD_TEXT_LABEL);
-		VEHICLE.set_function("GET_MOD_SLOT_NAME", LUA_NATIVE_VEHICLE_GET_MOD_SLOT_NAME);
-		VEHICLE.set_function("GET_LIVERY_NAME", LUA_NATIVE_VEHICLE_GET_LIVERY_NAME);
-		VEHICLE.set_function("GET_VEHICLE_MOD_MODIFIER_VALUE", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_MODIFIER_VALUE);
-		VEHICLE.set_function("GET_VEHICLE_MOD_IDENTIFIER_HASH", LUA_NATIVE_VEHICLE_GET_VEHICLE_MOD_IDENTIFIER_HASH);
-		VEHICLE.set_function("PRELOAD_VEHICLE_MOD", LUA_NATIVE_VEHICLE_PRELOAD_VEHICLE_MOD);
-		VEHICLE.set_function("HAS_PRELOAD_MODS_FINISHED", LUA_NATIVE_VEHICLE_HAS_PRELOAD_MODS_FINISHED);
-		VEHICLE.set_function("RELEASE_PRELOAD_MODS", LUA_NATIVE_VEHICLE_RELEASE_PRELOAD_MODS);
-		VEHICLE.set_function("SET_VEHICLE_TYRE_SMOKE_COLOR", LUA_NATIVE_VEHICLE_SET_VEHICLE_TYRE_SMOKE_COLOR);
-		VEHICLE.set_function("GET_VEHICLE_TYRE_SMOKE_COLOR", LUA_NATIVE_VEHICLE_GET_VEHICLE_TYRE_SMOKE_COLOR);
-		VEHICLE.set_function("SET_VEHICLE_WINDOW_TINT", LUA_NATIVE_VEHICLE_SET_VEHICLE_WINDOW_TINT);
-		VEHICLE.set_function("GET_VEHICLE_WINDOW_TINT", LUA_NATIVE_VEHICLE_GET_VEHICLE_WINDOW_TINT);
-		VEHICLE.set_function("GET_NUM_VEHICLE_WINDOW_TINTS", LUA_NATIVE_VEHICLE_GET_NUM_VEHICLE_WINDOW_TINTS);
-		VEHICLE.set_function("GET_VEHICLE_COLOR", LUA_NATIVE_VEHICLE_GET_VEHICLE_COLOR);
-		VEHICLE.set_function("GET_VEHICLE_COLOURS_WHICH_CAN_BE_SET", LUA_NATIVE_VEHICLE_GET_VEHICLE_COLOURS_WHICH_CAN_BE_SET);
-		VEHICLE.set_function("GET_VEHICLE_CAUSE_OF_DESTRUCTION", LUA_NATIVE_VEHICLE_GET_VEHICLE_CAUSE_OF_DESTRUCTION);
-		VEHICLE.set_function("OVERRIDE_PLANE_DAMAGE_THREHSOLD", LUA_NATIVE_VEHICLE_OVERRIDE_PLANE_DAMAGE_THREHSOLD);
-		VEHICLE.set_function("SET_TRANSMISSION_REDUCED_GEAR_RATIO_", LUA_NATIVE_VEHICLE_SET_TRANSMISSION_REDUCED_GEAR_RATIO_);
-		VEHICLE.set_function("GET_VEHICLE_DESIRED_DRIVE_GEAR_", LUA_NATIVE_VEHICLE_GET_VEHICLE_DESIRED_DRIVE_GEAR_);
-		VEHICLE.set_function("GET_IS_LEFT_VEHICLE_HEADLIGHT_DAMAGED", LUA_NATIVE_VEHICLE_GET_IS_LEFT_VEHICLE_HEADLIGHT_DAMAGED);
-		VEHICLE.set_function("GET_IS_RIGHT_VEHICLE_HEADLIGHT_DAMAGED", LUA_NATIVE_VEHICLE_GET_IS_RIGHT_VEHICLE_HEADLIGHT_DAMAGED);
-		VEHICLE.set_function("GET_BOTH_VEHICLE_HEADLIGHTS_DAMAGED", LUA_NATIVE_VEHICLE_GET_BOTH_VEHICLE_HEADLIGHTS_DAMAGED);
-		VEHICLE.set_function("MODIFY_VEHICLE_TOP_SPEED", LUA_NATIVE_VEHICLE_MODIFY_VEHICLE_TOP_SPEED);
-		VEHICLE.set_function("SET_VEHICLE_MAX_SPEED", LUA_NATIVE_VEHICLE_SET_VEHICLE_MAX_SPEED);
-		VEHICLE.set_function("SET_VEHICLE_STAYS_FROZEN_WHEN_CLEANED_UP", LUA_NATIVE_VEHICLE_SET_VEHICLE_STAYS_FROZEN_WHEN_CLEANED_UP);
-		VEHICLE.set_function("SET_VEHICLE_ACT_AS_IF_HIGH_SPEED_FOR_FRAG_SMASHING", LUA_NATIVE_VEHICLE_SET_VEHICLE_ACT_AS_IF_HIGH_SPEED_FOR_FRAG_SMASHING);
-		VEHICLE.set_function("SET_PEDS_CAN_FALL_OFF_THIS_VEHICLE_FROM_LARGE_FALL_DAMAGE", LUA_NATIVE_VEHICLE_SET_PEDS_CAN_FALL_OFF_THIS_VEHICLE_FROM_LARGE_FALL_DAMAGE);
-		VEHICLE.set_function("ADD_VEHICLE_COMBAT_ANGLED_AVOIDANCE_AREA", LUA_NATIVE_VEHICLE_ADD_VEHICLE_COMBAT_ANGLED_AVOIDANCE_AREA);
-		VEHICLE.set_function("REMOVE_VEHICLE_COMBAT_AVOIDANCE_AREA", LUA_NATIVE_VEHICLE_REMOVE_VEHICLE_COMBAT_AVOIDANCE_AREA);
-		VEHICLE.set_function("IS_ANY_PED_RAPPELLING_FROM_HELI", LUA_NATIVE_VEHICLE_IS_ANY_PED_RAPPELLING_FROM_HELI);
-		VEHICLE.set_function("SET_VEHICLE_CHEAT_POWER_INCREASE", LUA_NATIVE_VEHICLE_SET_VEHICLE_CHEAT_POWER_INCREASE);
-		VEHICLE.set_function("SET_VEHICLE_INFLUENCES_WANTED_LEVEL", LUA_NATIVE_VEHICLE_SET_VEHICLE_INFLUENCES_WANTED_LEVEL);
-		VEHICLE.set_function("SET_VEHICLE_IS_WANTED", LUA_NATIVE_VEHICLE_SET_VEHICLE_IS_WANTED);
-		VEHICLE.set_function("SWING_BOAT_BOOM_TO_RATIO", LUA_NATIVE_VEHICLE_SWING_BOAT_BOOM_TO_RATIO);
-		VEHICLE.set_function("SWING_BOAT_BOOM_FREELY", LUA_NATIVE_VEHICLE_SWING_BOAT_BOOM_FREELY);
-		VEHICLE.set_function("ALLOW_BOAT_BOOM_TO_ANIMATE", LUA_NATIVE_VEHICLE_ALLOW_BOAT_BOOM_TO_ANIMATE);
-		VEHICLE.set_function("GET_BOAT_BOOM_POSITION_RATIO", LUA_NATIVE_VEHICLE_GET_BOAT_BOOM_POSITION_RATIO);
-		VEHICLE.set_function("DISABLE_PLANE_AILERON", LUA_NATIVE_VEHICLE_DISABLE_PLANE_AILERON);
-		VEHICLE.set_function("GET_IS_VEHICLE_ENGINE_RUNNING", LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_ENGINE_RUNNING);
-		VEHICLE.set_function("SET_VEHICLE_USE_ALTERNATE_HANDLING", LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_ALTERNATE_HANDLING);
-		VEHICLE.set_function("SET_BIKE_ON_STAND", LUA_NATIVE_VEHICLE_SET_BIKE_ON_STAND);
-		VEHICLE.set_function("SET_VEHICLE_NOT_STEALABLE_AMBIENTLY", LUA_NATIVE_VEHICLE_SET_VEHICLE_NOT_STEALABLE_AMBIENTLY);
-		VEHICLE.set_function("LOCK_DOORS_WHEN_NO_LONGER_NEEDED", LUA_NATIVE_VEHICLE_LOCK_DOORS_WHEN_NO_LONGER_NEEDED);
-		VEHICLE.set_function("SET_LAST_DRIVEN_VEHICLE", LUA_NATIVE_VEHICLE_SET_LAST_DRIVEN_VEHICLE);
-		VEHICLE.set_function("GET_LAST_DRIVEN_VEHICLE", LUA_NATIVE_VEHICLE_GET_LAST_DRIVEN_VEHICLE);
-		VEHICLE.set_function("CLEAR_LAST_DRIVEN_VEHICLE", LUA_NATIVE_VEHICLE_CLEAR_LAST_DRIVEN_VEHICLE);
-		VEHICLE.set_function("SET_VEHICLE_HAS_BEEN_DRIVEN_FLAG", LUA_NATIVE_VEHICLE_SET_VEHICLE_HAS_BEEN_DRIVEN_FLAG);
-		VEHICLE.set_function("SET_TASK_VEHICLE_GOTO_PLANE_MIN_HEIGHT_ABOVE_TERRAIN", LUA_NATIVE_VEHICLE_SET_TASK_VEHICLE_GOTO_PLANE_MIN_HEIGHT_ABOVE_TERRAIN);
-		VEHICLE.set_function("SET_VEHICLE_LOD_MULTIPLIER", LUA_NATIVE_VEHICLE_SET_VEHICLE_LOD_MULTIPLIER);
-		VEHICLE.set_function("SET_VEHICLE_CAN_SAVE_IN_GARAGE", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_SAVE_IN_GARAGE);
-		VEHICLE.set_function("GET_VEHICLE_NUM_OF_BROKEN_OFF_PARTS", LUA_NATIVE_VEHICLE_GET_VEHICLE_NUM_OF_BROKEN_OFF_PARTS);
-		VEHICLE.set_function("GET_VEHICLE_NUM_OF_BROKEN_LOOSEN_PARTS", LUA_NATIVE_VEHICLE_GET_VEHICLE_NUM_OF_BROKEN_LOOSEN_PARTS);
-		VEHICLE.set_function("SET_FORCE_VEHICLE_ENGINE_DAMAGE_BY_BULLET", LUA_NATIVE_VEHICLE_SET_FORCE_VEHICLE_ENGINE_DAMAGE_BY_BULLET);
-		VEHICLE.set_function("SET_VEHICLE_GENERATES_ENGINE_SHOCKING_EVENTS", LUA_NATIVE_VEHICLE_SET_VEHICLE_GENERATES_ENGINE_SHOCKING_EVENTS);
-		VEHICLE.set_function("COPY_VEHICLE_DAMAGES", LUA_NATIVE_VEHICLE_COPY_VEHICLE_DAMAGES);
-		VEHICLE.set_function("DISABLE_VEHICLE_EXPLOSION_BREAK_OFF_PARTS", LUA_NATIVE_VEHICLE_DISABLE_VEHICLE_EXPLOSION_BREAK_OFF_PARTS);
-		VEHICLE.set_function("SET_LIGHTS_CUTOFF_DISTANCE_TWEAK", LUA_NATIVE_VEHICLE_SET_LIGHTS_CUTOFF_DISTANCE_TWEAK);
-		VEHICLE.set_function("SET_VEHICLE_SHOOT_AT_TARGET", LUA_NATIVE_VEHICLE_SET_VEHICLE_SHOOT_AT_TARGET);
-		VEHICLE.set_function("GET_VEHICLE_LOCK_ON_TARGET", LUA_NATIVE_VEHICLE_GET_VEHICLE_LOCK_ON_TARGET);
-		VEHICLE.set_function("SET_FORCE_HD_VEHICLE", LUA_NATIVE_VEHICLE_SET_FORCE_HD_VEHICLE);
-		VEHICLE.set_function("SET_VEHICLE_CUSTOM_PATH_NODE_STREAMING_RADIUS", LUA_NATIVE_VEHICLE_SET_VEHICLE_CUSTOM_PATH_NODE_STREAMING_RADIUS);
-		VEHICLE.set_function("GET_VEHICLE_PLATE_TYPE", LUA_NATIVE_VEHICLE_GET_VEHICLE_PLATE_TYPE);
-		VEHICLE.set_function("TRACK_VEHICLE_VISIBILITY", LUA_NATIVE_VEHICLE_TRACK_VEHICLE_VISIBILITY);
-		VEHICLE.set_function("IS_VEHICLE_VISIBLE", LUA_NATIVE_VEHICLE_IS_VEHICLE_VISIBLE);
-		VEHICLE.set_function("SET_VEHICLE_GRAVITY", LUA_NATIVE_VEHICLE_SET_VEHICLE_GRAVITY);
-		VEHICLE.set_function("SET_ENABLE_VEHICLE_SLIPSTREAMING", LUA_NATIVE_VEHICLE_SET_ENABLE_VEHICLE_SLIPSTREAMING);
-		VEHICLE.set_function("SET_VEHICLE_SLIPSTREAMING_SHOULD_TIME_OUT", LUA_NATIVE_VEHICLE_SET_VEHICLE_SLIPSTREAMING_SHOULD_TIME_OUT);
-		VEHICLE.set_function("GET_VEHICLE_CURRENT_TIME_IN_SLIP_STREAM", LUA_NATIVE_VEHICLE_GET_VEHICLE_CURRENT_TIME_IN_SLIP_STREAM);
-		VEHICLE.set_function("IS_VEHICLE_PRODUCING_SLIP_STREAM", LUA_NATIVE_VEHICLE_IS_VEHICLE_PRODUCING_SLIP_STREAM);
-		VEHICLE.set_function("SET_VEHICLE_INACTIVE_DURING_PLAYBACK", LUA_NATIVE_VEHICLE_SET_VEHICLE_INACTIVE_DURING_PLAYBACK);
-		VEHICLE.set_function("SET_VEHICLE_ACTIVE_DURING_PLAYBACK", LUA_NATIVE_VEHICLE_SET_VEHICLE_ACTIVE_DURING_PLAYBACK);
-		VEHICLE.set_function("IS_VEHICLE_SPRAYABLE", LUA_NATIVE_VEHICLE_IS_VEHICLE_SPRAYABLE);
-		VEHICLE.set_function("SET_VEHICLE_ENGINE_CAN_DEGRADE", LUA_NATIVE_VEHICLE_SET_VEHICLE_ENGINE_CAN_DEGRADE);
-		VEHICLE.set_function("DISABLE_VEHCILE_DYNAMIC_AMBIENT_SCALES", LUA_NATIVE_VEHICLE_DISABLE_VEHCILE_DYNAMIC_AMBIENT_SCALES);
-		VEHICLE.set_function("ENABLE_VEHICLE_DYNAMIC_AMBIENT_SCALES", LUA_NATIVE_VEHICLE_ENABLE_VEHICLE_DYNAMIC_AMBIENT_SCALES);
-		VEHICLE.set_function("IS_PLANE_LANDING_GEAR_INTACT", LUA_NATIVE_VEHICLE_IS_PLANE_LANDING_GEAR_INTACT);
-		VEHICLE.set_function("ARE_PLANE_PROPELLERS_INTACT", LUA_NATIVE_VEHICLE_ARE_PLANE_PROPELLERS_INTACT);
-		VEHICLE.set_function("SET_PLANE_PROPELLER_HEALTH", LUA_NATIVE_VEHICLE_SET_PLANE_PROPELLER_HEALTH);
-		VEHICLE.set_function("SET_VEHICLE_CAN_DEFORM_WHEELS", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_DEFORM_WHEELS);
-		VEHICLE.set_function("IS_VEHICLE_STOLEN", LUA_NATIVE_VEHICLE_IS_VEHICLE_STOLEN);
-		VEHICLE.set_function("SET_VEHICLE_IS_STOLEN", LUA_NATIVE_VEHICLE_SET_VEHICLE_IS_STOLEN);
-		VEHICLE.set_function("SET_PLANE_TURBULENCE_MULTIPLIER", LUA_NATIVE_VEHICLE_SET_PLANE_TURBULENCE_MULTIPLIER);
-		VEHICLE.set_function("ARE_WINGS_OF_PLANE_INTACT", LUA_NATIVE_VEHICLE_ARE_WINGS_OF_PLANE_INTACT);
-		VEHICLE.set_function("ALLOW_AMBIENT_VEHICLES_TO_AVOID_ADVERSE_CONDITIONS", LUA_NATIVE_VEHICLE_ALLOW_AMBIENT_VEHICLES_TO_AVOID_ADVERSE_CONDITIONS);
-		VEHICLE.set_function("DETACH_VEHICLE_FROM_CARGOBOB", LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_CARGOBOB);
-		VEHICLE.set_function("DETACH_VEHICLE_FROM_ANY_CARGOBOB", LUA_NATIVE_VEHICLE_DETACH_VEHICLE_FROM_ANY_CARGOBOB);
-		VEHICLE.set_function("DETACH_ENTITY_FROM_CARGOBOB", LUA_NATIVE_VEHICLE_DETACH_ENTITY_FROM_CARGOBOB);
-		VEHICLE.set_function("IS_VEHICLE_ATTACHED_TO_CARGOBOB", LUA_NATIVE_VEHICLE_IS_VEHICLE_ATTACHED_TO_CARGOBOB);
-		VEHICLE.set_function("GET_VEHICLE_ATTACHED_TO_CARGOBOB", LUA_NATIVE_VEHICLE_GET_VEHICLE_ATTACHED_TO_CARGOBOB);
-		VEHICLE.set_function("GET_ENTITY_ATTACHED_TO_CARGOBOB", LUA_NATIVE_VEHICLE_GET_ENTITY_ATTACHED_TO_CARGOBOB);
-		VEHICLE.set_function("ATTACH_VEHICLE_TO_CARGOBOB", LUA_NATIVE_VEHICLE_ATTACH_VEHICLE_TO_CARGOBOB);
-		VEHICLE.set_function("ATTACH_ENTITY_TO_CARGOBOB", LUA_NATIVE_VEHICLE_ATTACH_ENTITY_TO_CARGOBOB);
-		VEHICLE.set_function("SET_CARGOBOB_FORCE_DONT_DETACH_VEHICLE", LUA_NATIVE_VEHICLE_SET_CARGOBOB_FORCE_DONT_DETACH_VEHICLE);
-		VEHICLE.set_function("SET_CARGOBOB_EXCLUDE_FROM_PICKUP_ENTITY", LUA_NATIVE_VEHICLE_SET_CARGOBOB_EXCLUDE_FROM_PICKUP_ENTITY);
-		VEHICLE.set_function("CAN_CARGOBOB_PICK_UP_ENTITY", LUA_NATIVE_VEHICLE_CAN_CARGOBOB_PICK_UP_ENTITY);
-		VEHICLE.set_function("GET_ATTACHED_PICK_UP_HOOK_POSITION", LUA_NATIVE_VEHICLE_GET_ATTACHED_PICK_UP_HOOK_POSITION);
-		VEHICLE.set_function("DOES_CARGOBOB_HAVE_PICK_UP_ROPE", LUA_NATIVE_VEHICLE_DOES_CARGOBOB_HAVE_PICK_UP_ROPE);
-		VEHICLE.set_function("CREATE_PICK_UP_ROPE_FOR_CARGOBOB", LUA_NATIVE_VEHICLE_CREATE_PICK_UP_ROPE_FOR_CARGOBOB);
-		VEHICLE.set_function("REMOVE_PICK_UP_ROPE_FOR_CARGOBOB", LUA_NATIVE_VEHICLE_REMOVE_PICK_UP_ROPE_FOR_CARGOBOB);
-		VEHICLE.set_function("SET_PICKUP_ROPE_LENGTH_FOR_CARGOBOB", LUA_NATIVE_VEHICLE_SET_PICKUP_ROPE_LENGTH_FOR_CARGOBOB);
-		VEHICLE.set_function("SET_PICKUP_ROPE_LENGTH_WITHOUT_CREATING_ROPE_FOR_CARGOBOB", LUA_NATIVE_VEHICLE_SET_PICKUP_ROPE_LENGTH_WITHOUT_CREATING_ROPE_FOR_CARGOBOB);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_ROPE_DAMPING_MULTIPLIER", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_ROPE_DAMPING_MULTIPLIER);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_ROPE_TYPE", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_ROPE_TYPE);
-		VEHICLE.set_function("DOES_CARGOBOB_HAVE_PICKUP_MAGNET", LUA_NATIVE_VEHICLE_DOES_CARGOBOB_HAVE_PICKUP_MAGNET);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_ACTIVE", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_ACTIVE);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_STRENGTH", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_STRENGTH);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_FALLOFF", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_FALLOFF);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_REDUCED_STRENGTH", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_REDUCED_STRENGTH);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_REDUCED_FALLOFF", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_REDUCED_FALLOFF);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_PULL_STRENGTH", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_PULL_STRENGTH);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_PULL_ROPE_LENGTH", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_PULL_ROPE_LENGTH);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_SET_TARGETED_MODE", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_SET_TARGETED_MODE);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_SET_AMBIENT_MODE", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_SET_AMBIENT_MODE);
-		VEHICLE.set_function("SET_CARGOBOB_PICKUP_MAGNET_ENSURE_PICKUP_ENTITY_UPRIGHT", LUA_NATIVE_VEHICLE_SET_CARGOBOB_PICKUP_MAGNET_ENSURE_PICKUP_ENTITY_UPRIGHT);
-		VEHICLE.set_function("DOES_VEHICLE_HAVE_WEAPONS", LUA_NATIVE_VEHICLE_DOES_VEHICLE_HAVE_WEAPONS);
-		VEHICLE.set_function("SET_VEHICLE_WILL_TELL_OTHERS_TO_HURRY", LUA_NATIVE_VEHICLE_SET_VEHICLE_WILL_TELL_OTHERS_TO_HURRY);
-		VEHICLE.set_function("DISABLE_VEHICLE_WEAPON", LUA_NATIVE_VEHICLE_DISABLE_VEHICLE_WEAPON);
-		VEHICLE.set_function("IS_VEHICLE_WEAPON_DISABLED", LUA_NATIVE_VEHICLE_IS_VEHICLE_WEAPON_DISABLED);
-		VEHICLE.set_function("SET_VEHICLE_USED_FOR_PILOT_SCHOOL", LUA_NATIVE_VEHICLE_SET_VEHICLE_USED_FOR_PILOT_SCHOOL);
-		VEHICLE.set_function("SET_VEHICLE_ACTIVE_FOR_PED_NAVIGATION", LUA_NATIVE_VEHICLE_SET_VEHICLE_ACTIVE_FOR_PED_NAVIGATION);
-		VEHICLE.set_function("GET_VEHICLE_CLASS", LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS);
-		VEHICLE.set_function("GET_VEHICLE_CLASS_FROM_NAME", LUA_NATIVE_VEHICLE_GET_VEHICLE_CLASS_FROM_NAME);
-		VEHICLE.set_function("SET_PLAYERS_LAST_VEHICLE", LUA_NATIVE_VEHICLE_SET_PLAYERS_LAST_VEHICLE);
-		VEHICLE.set_function("SET_VEHICLE_CAN_BE_USED_BY_FLEEING_PEDS", LUA_NATIVE_VEHICLE_SET_VEHICLE_CAN_BE_USED_BY_FLEEING_PEDS);
-		VEHICLE.set_function("SET_AIRCRAFT_PILOT_SKILL_NOISE_SCALAR", LUA_NATIVE_VEHICLE_SET_AIRCRAFT_PILOT_SKILL_NOISE_SCALAR);
-		VEHICLE.set_function("SET_VEHICLE_DROPS_MONEY_WHEN_BLOWN_UP", LUA_NATIVE_VEHICLE_SET_VEHICLE_DROPS_MONEY_WHEN_BLOWN_UP);
-		VEHICLE.set_function("SET_VEHICLE_KEEP_ENGINE_ON_WHEN_ABANDONED", LUA_NATIVE_VEHICLE_SET_VEHICLE_KEEP_ENGINE_ON_WHEN_ABANDONED);
-		VEHICLE.set_function("SET_VEHICLE_IMPATIENCE_TIMER", LUA_NATIVE_VEHICLE_SET_VEHICLE_IMPATIENCE_TIMER);
-		VEHICLE.set_function("SET_VEHICLE_HANDLING_OVERRIDE", LUA_NATIVE_VEHICLE_SET_VEHICLE_HANDLING_OVERRIDE);
-		VEHICLE.set_function("SET_VEHICLE_EXTENDED_REMOVAL_RANGE", LUA_NATIVE_VEHICLE_SET_VEHICLE_EXTENDED_REMOVAL_RANGE);
-		VEHICLE.set_function("SET_VEHICLE_STEERING_BIAS_SCALAR", LUA_NATIVE_VEHICLE_SET_VEHICLE_STEERING_BIAS_SCALAR);
-		VEHICLE.set_function("SET_HELI_CONTROL_LAGGING_RATE_SCALAR", LUA_NATIVE_VEHICLE_SET_HELI_CONTROL_LAGGING_RATE_SCALAR);
-		VEHICLE.set_function("SET_VEHICLE_FRICTION_OVERRIDE", LUA_NATIVE_VEHICLE_SET_VEHICLE_FRICTION_OVERRIDE);
-		VEHICLE.set_function("SET_VEHICLE_WHEELS_CAN_BREAK_OFF_WHEN_BLOW_UP", LUA_NATIVE_VEHICLE_SET_VEHICLE_WHEELS_CAN_BREAK_OFF_WHEN_BLOW_UP);
-		VEHICLE.set_function("ARE_PLANE_CONTROL_PANELS_INTACT", LUA_NATIVE_VEHICLE_ARE_PLANE_CONTROL_PANELS_INTACT);
-		VEHICLE.set_function("SET_VEHICLE_CEILING_HEIGHT", LUA_NATIVE_VEHICLE_SET_VEHICLE_CEILING_HEIGHT);
-		VEHICLE.set_function("SET_VEHICLE_NO_EXPLOSION_DAMAGE_FROM_DRIVER", LUA_NATIVE_VEHICLE_SET_VEHICLE_NO_EXPLOSION_DAMAGE_FROM_DRIVER);
-		VEHICLE.set_function("CLEAR_VEHICLE_ROUTE_HISTORY", LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_ROUTE_HISTORY);
-		VEHICLE.set_function("DOES_VEHICLE_EXIST_WITH_DECORATOR", LUA_NATIVE_VEHICLE_DOES_VEHICLE_EXIST_WITH_DECORATOR);
-		VEHICLE.set_function("SET_VEHICLE_AI_CAN_USE_EXCLUSIVE_SEATS", LUA_NATIVE_VEHICLE_SET_VEHICLE_AI_CAN_USE_EXCLUSIVE_SEATS);
-		VEHICLE.set_function("SET_VEHICLE_EXCLUSIVE_DRIVER", LUA_NATIVE_VEHICLE_SET_VEHICLE_EXCLUSIVE_DRIVER);
-		VEHICLE.set_function("IS_PED_EXCLUSIVE_DRIVER_OF_VEHICLE", LUA_NATIVE_VEHICLE_IS_PED_EXCLUSIVE_DRIVER_OF_VEHICLE);
-		VEHICLE.set_function("DISABLE_INDIVIDUAL_PLANE_PROPELLER", LUA_NATIVE_VEHICLE_DISABLE_INDIVIDUAL_PLANE_PROPELLER);
-		VEHICLE.set_function("SET_VEHICLE_FORCE_AFTERBURNER", LUA_NATIVE_VEHICLE_SET_VEHICLE_FORCE_AFTERBURNER);
-		VEHICLE.set_function("SET_DONT_PROCESS_VEHICLE_GLASS", LUA_NATIVE_VEHICLE_SET_DONT_PROCESS_VEHICLE_GLASS);
-		VEHICLE.set_function("SET_DISABLE_WANTED_CONES_RESPONSE", LUA_NATIVE_VEHICLE_SET_DISABLE_WANTED_CONES_RESPONSE);
-		VEHICLE.set_function("SET_USE_DESIRED_Z_CRUISE_SPEED_FOR_LANDING", LUA_NATIVE_VEHICLE_SET_USE_DESIRED_Z_CRUISE_SPEED_FOR_LANDING);
-		VEHICLE.set_function("SET_ARRIVE_DISTANCE_OVERRIDE_FOR_VEHICLE_PERSUIT_ATTACK", LUA_NATIVE_VEHICLE_SET_ARRIVE_DISTANCE_OVERRIDE_FOR_VEHICLE_PERSUIT_ATTACK);
-		VEHICLE.set_function("SET_VEHICLE_READY_FOR_CLEANUP", LUA_NATIVE_VEHICLE_SET_VEHICLE_READY_FOR_CLEANUP);
-		VEHICLE.set_function("SET_DISTANT_CARS_ENABLED", LUA_NATIVE_VEHICLE_SET_DISTANT_CARS_ENABLED);
-		VEHICLE.set_function("SET_VEHICLE_NEON_COLOUR", LUA_NATIVE_VEHICLE_SET_VEHICLE_NEON_COLOUR);
-		VEHICLE.set_function("SET_VEHICLE_NEON_INDEX_COLOUR", LUA_NATIVE_VEHICLE_SET_VEHICLE_NEON_INDEX_COLOUR);
-		VEHICLE.set_function("GET_VEHICLE_NEON_COLOUR", LUA_NATIVE_VEHICLE_GET_VEHICLE_NEON_COLOUR);
-		VEHICLE.set_function("SET_VEHICLE_NEON_ENABLED", LUA_NATIVE_VEHICLE_SET_VEHICLE_NEON_ENABLED);
-		VEHICLE.set_function("GET_VEHICLE_NEON_ENABLED", LUA_NATIVE_VEHICLE_GET_VEHICLE_NEON_ENABLED);
-		VEHICLE.set_function("SET_AMBIENT_VEHICLE_NEON_ENABLED", LUA_NATIVE_VEHICLE_SET_AMBIENT_VEHICLE_NEON_ENABLED);
-		VEHICLE.set_function("SUPPRESS_NEONS_ON_VEHICLE", LUA_NATIVE_VEHICLE_SUPPRESS_NEONS_ON_VEHICLE);
-		VEHICLE.set_function("SET_DISABLE_SUPERDUMMY", LUA_NATIVE_VEHICLE_SET_DISABLE_SUPERDUMMY);
-		VEHICLE.set_function("REQUEST_VEHICLE_DIAL", LUA_NATIVE_VEHICLE_REQUEST_VEHICLE_DIAL);
-		VEHICLE.set_function("GET_VEHICLE_BODY_HEALTH", LUA_NATIVE_VEHICLE_GET_VEHICLE_BODY_HEALTH);
-		VEHICLE.set_function("SET_VEHICLE_BODY_HEALTH", LUA_NATIVE_VEHICLE_SET_VEHICLE_BODY_HEALTH);
-		VEHICLE.set_function("GET_VEHICLE_SIZE", LUA_NATIVE_VEHICLE_GET_VEHICLE_SIZE);
-		VEHICLE.set_function("GET_FAKE_SUSPENSION_LOWERING_AMOUNT", LUA_NATIVE_VEHICLE_GET_FAKE_SUSPENSION_LOWERING_AMOUNT);
-		VEHICLE.set_function("SET_CAR_HIGH_SPEED_BUMP_SEVERITY_MULTIPLIER", LUA_NATIVE_VEHICLE_SET_CAR_HIGH_SPEED_BUMP_SEVERITY_MULTIPLIER);
-		VEHICLE.set_function("GET_NUMBER_OF_VEHICLE_DOORS", LUA_NATIVE_VEHICLE_GET_NUMBER_OF_VEHICLE_DOORS);
-		VEHICLE.set_function("SET_HYDRAULICS_CONTROL", LUA_NATIVE_VEHICLE_SET_HYDRAULICS_CONTROL);
-		VEHICLE.set_function("SET_CAN_ADJUST_GROUND_CLEARANCE", LUA_NATIVE_VEHICLE_SET_CAN_ADJUST_GROUND_CLEARANCE);
-		VEHICLE.set_function("GET_VEHICLE_HEALTH_PERCENTAGE", LUA_NATIVE_VEHICLE_GET_VEHICLE_HEALTH_PERCENTAGE);
-		VEHICLE.set_function("GET_VEHICLE_IS_MERCENARY", LUA_NATIVE_VEHICLE_GET_VEHICLE_IS_MERCENARY);
-		VEHICLE.set_function("SET_VEHICLE_BROKEN_PARTS_DONT_AFFECT_AI_HANDLING", LUA_NATIVE_VEHICLE_SET_VEHICLE_BROKEN_PARTS_DONT_AFFECT_AI_HANDLING);
-		VEHICLE.set_function("SET_VEHICLE_KERS_ALLOWED", LUA_NATIVE_VEHICLE_SET_VEHICLE_KERS_ALLOWED);
-		VEHICLE.set_function("GET_VEHICLE_HAS_KERS", LUA_NATIVE_VEHICLE_GET_VEHICLE_HAS_KERS);
-		VEHICLE.set_function("SET_PLANE_RESIST_TO_EXPLOSION", LUA_NATIVE_VEHICLE_SET_PLANE_RESIST_TO_EXPLOSION);
-		VEHICLE.set_function("SET_HELI_RESIST_TO_EXPLOSION", LUA_NATIVE_VEHICLE_SET_HELI_RESIST_TO_EXPLOSION);
-		VEHICLE.set_function("SET_DISABLE_BMX_EXTRA_TRICK_FORCES", LUA_NATIVE_VEHICLE_SET_DISABLE_BMX_EXTRA_TRICK_FORCES);
-		VEHICLE.set_function("SET_HYDRAULIC_SUSPENSION_RAISE_FACTOR", LUA_NATIVE_VEHICLE_SET_HYDRAULIC_SUSPENSION_RAISE_FACTOR);
-		VEHICLE.set_function("GET_HYDRAULIC_SUSPENSION_RAISE_FACTOR", LUA_NATIVE_VEHICLE_GET_HYDRAULIC_SUSPENSION_RAISE_FACTOR);
-		VEHICLE.set_function("SET_CAN_USE_HYDRAULICS", LUA_NATIVE_VEHICLE_SET_CAN_USE_HYDRAULICS);
-		VEHICLE.set_function("SET_HYDRAULIC_VEHICLE_STATE", LUA_NATIVE_VEHICLE_SET_HYDRAULIC_VEHICLE_STATE);
-		VEHICLE.set_function("SET_HYDRAULIC_WHEEL_STATE", LUA_NATIVE_VEHICLE_SET_HYDRAULIC_WHEEL_STATE);
-		VEHICLE.set_function("HAS_VEHICLE_PETROLTANK_SET_ON_FIRE_BY_ENTITY", LUA_NATIVE_VEHICLE_HAS_VEHICLE_PETROLTANK_SET_ON_FIRE_BY_ENTITY);
-		VEHICLE.set_function("CLEAR_VEHICLE_PETROLTANK_FIRE_CULPRIT", LUA_NATIVE_VEHICLE_CLEAR_VEHICLE_PETROLTANK_FIRE_CULPRIT);
-		VEHICLE.set_function("SET_VEHICLE_BOBBLEHEAD_VELOCITY", LUA_NATIVE_VEHICLE_SET_VEHICLE_BOBBLEHEAD_VELOCITY);
-		VEHICLE.set_function("GET_VEHICLE_IS_DUMMY", LUA_NATIVE_VEHICLE_GET_VEHICLE_IS_DUMMY);
-		VEHICLE.set_function("SET_VEHICLE_DAMAGE_SCALE", LUA_NATIVE_VEHICLE_SET_VEHICLE_DAMAGE_SCALE);
-		VEHICLE.set_function("SET_VEHICLE_WEAPON_DAMAGE_SCALE", LUA_NATIVE_VEHICLE_SET_VEHICLE_WEAPON_DAMAGE_SCALE);
-		VEHICLE.set_function("SET_DISABLE_DAMAGE_WITH_PICKED_UP_ENTITY", LUA_NATIVE_VEHICLE_SET_DISABLE_DAMAGE_WITH_PICKED_UP_ENTITY);
-		VEHICLE.set_function("SET_VEHICLE_USES_MP_PLAYER_DAMAGE_MULTIPLIER", LUA_NATIVE_VEHICLE_SET_VEHICLE_USES_MP_PLAYER_DAMAGE_MULTIPLIER);
-		VEHICLE.set_function("SET_BIKE_EASY_TO_LAND", LUA_NATIVE_VEHICLE_SET_BIKE_EASY_TO_LAND);
-		VEHICLE.set_function("SET_INVERT_VEHICLE_CONTROLS", LUA_NATIVE_VEHICLE_SET_INVERT_VEHICLE_CONTROLS);
-		VEHICLE.set_function("SET_SPEED_BOOST_EFFECT_DISABLED", LUA_NATIVE_VEHICLE_SET_SPEED_BOOST_EFFECT_DISABLED);
-		VEHICLE.set_function("SET_SLOW_DOWN_EFFECT_DISABLED", LUA_NATIVE_VEHICLE_SET_SLOW_DOWN_EFFECT_DISABLED);
-		VEHICLE.set_function("SET_FORMATION_LEADER", LUA_NATIVE_VEHICLE_SET_FORMATION_LEADER);
-		VEHICLE.set_function("RESET_FORMATION_LEADER", LUA_NATIVE_VEHICLE_RESET_FORMATION_LEADER);
-		VEHICLE.set_function("GET_IS_BOAT_CAPSIZED", LUA_NATIVE_VEHICLE_GET_IS_BOAT_CAPSIZED);
-		VEHICLE.set_function("SET_ALLOW_RAMMING_SOOP_OR_RAMP", LUA_NATIVE_VEHICLE_SET_ALLOW_RAMMING_SOOP_OR_RAMP);
-		VEHICLE.set_function("SET_SCRIPT_RAMP_IMPULSE_SCALE", LUA_NATIVE_VEHICLE_SET_SCRIPT_RAMP_IMPULSE_SCALE);
-		VEHICLE.set_function("GET_IS_DOOR_VALID", LUA_NATIVE_VEHICLE_GET_IS_DOOR_VALID);
-		VEHICLE.set_function("SET_SCRIPT_ROCKET_BOOST_RECHARGE_TIME", LUA_NATIVE_VEHICLE_SET_SCRIPT_ROCKET_BOOST_RECHARGE_TIME);
-		VEHICLE.set_function("GET_HAS_ROCKET_BOOST", LUA_NATIVE_VEHICLE_GET_HAS_ROCKET_BOOST);
-		VEHICLE.set_function("IS_ROCKET_BOOST_ACTIVE", LUA_NATIVE_VEHICLE_IS_ROCKET_BOOST_ACTIVE);
-		VEHICLE.set_function("SET_ROCKET_BOOST_ACTIVE", LUA_NATIVE_VEHICLE_SET_ROCKET_BOOST_ACTIVE);
-		VEHICLE.set_function("GET_HAS_RETRACTABLE_WHEELS", LUA_NATIVE_VEHICLE_GET_HAS_RETRACTABLE_WHEELS);
-		VEHICLE.set_function("GET_IS_WHEELS_RETRACTED", LUA_NATIVE_VEHICLE_GET_IS_WHEELS_RETRACTED);
-		VEHICLE.set_function("SET_WHEELS_EXTENDED_INSTANTLY", LUA_NATIVE_VEHICLE_SET_WHEELS_EXTENDED_INSTANTLY);
-		VEHICLE.set_function("SET_WHEELS_RETRACTED_INSTANTLY", LUA_NATIVE_VEHICLE_SET_WHEELS_RETRACTED_INSTANTLY);
-		VEHICLE.set_function("GET_CAR_HAS_JUMP", LUA_NATIVE_VEHICLE_GET_CAR_HAS_JUMP);
-		VEHICLE.set_function("SET_USE_HIGHER_CAR_JUMP", LUA_NATIVE_VEHICLE_SET_USE_HIGHER_CAR_JUMP);
-		VEHICLE.set_function("SET_CLEAR_FREEZE_WAITING_ON_COLLISION_ONCE_PLAYER_ENTERS", LUA_NATIVE_VEHICLE_SET_CLEAR_FREEZE_WAITING_ON_COLLISION_ONCE_PLAYER_ENTERS);
-		VEHICLE.set_function("SET_VEHICLE_WEAPON_RESTRICTED_AMMO", LUA_NATIVE_VEHICLE_SET_VEHICLE_WEAPON_RESTRICTED_AMMO);
-		VEHICLE.set_function("GET_VEHICLE_WEAPON_RESTRICTED_AMMO", LUA_NATIVE_VEHICLE_GET_VEHICLE_WEAPON_RESTRICTED_AMMO);
-		VEHICLE.set_function("GET_VEHICLE_HAS_PARACHUTE", LUA_NATIVE_VEHICLE_GET_VEHICLE_HAS_PARACHUTE);
-		VEHICLE.set_function("GET_VEHICLE_CAN_DEPLOY_PARACHUTE", LUA_NATIVE_VEHICLE_GET_VEHICLE_CAN_DEPLOY_PARACHUTE);
-		VEHICLE.set_function("VEHICLE_START_PARACHUTING", LUA_NATIVE_VEHICLE_VEHICLE_START_PARACHUTING);
-		VEHICLE.set_function("IS_VEHICLE_PARACHUTE_DEPLOYED", LUA_NATIVE_VEHICLE_IS_VEHICLE_PARACHUTE_DEPLOYED);
-		VEHICLE.set_function("VEHICLE_SET_RAMP_AND_RAMMING_CARS_TAKE_DAMAGE", LUA_NATIVE_VEHICLE_VEHICLE_SET_RAMP_AND_RAMMING_CARS_TAKE_DAMAGE);
-		VEHICLE.set_function("VEHICLE_SET_ENABLE_RAMP_CAR_SIDE_IMPULSE", LUA_NATIVE_VEHICLE_VEHICLE_SET_ENABLE_RAMP_CAR_SIDE_IMPULSE);
-		VEHICLE.set_function("VEHICLE_SET_ENABLE_NORMALISE_RAMP_CAR_VERTICAL_VELOCTIY", LUA_NATIVE_VEHICLE_VEHICLE_SET_ENABLE_NORMALISE_RAMP_CAR_VERTICAL_VELOCTIY);
-		VEHICLE.set_function("VEHICLE_SET_JET_WASH_FORCE_ENABLED", LUA_NATIVE_VEHICLE_VEHICLE_SET_JET_WASH_FORCE_ENABLED);
-		VEHICLE.set_function("SET_VEHICLE_WEAPON_CAN_TARGET_OBJECTS", LUA_NATIVE_VEHICLE_SET_VEHICLE_WEAPON_CAN_TARGET_OBJECTS);
-		VEHICLE.set_function("SET_VEHICLE_USE_BOOST_BUTTON_FOR_WHEEL_RETRACT", LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_BOOST_BUTTON_FOR_WHEEL_RETRACT);
-		VEHICLE.set_function("SET_VEHICLE_USE_HORN_BUTTON_FOR_NITROUS_", LUA_NATIVE_VEHICLE_SET_VEHICLE_USE_HORN_BUTTON_FOR_NITROUS_);
-		VEHICLE.set_function("VEHICLE_SET_PARACHUTE_MODEL_OVERRIDE", LUA_NATIVE_VEHICLE_VEHICLE_SET_PARACHUTE_MODEL_OVERRIDE);
-		VEHICLE.set_function("VEHICLE_SET_PARACHUTE_MODEL_TINT_INDEX", LUA_NATIVE_VEHICLE_VEHICLE_SET_PARACHUTE_MODEL_TINT_INDEX);
-		VEHICLE.set_function("VEHICLE_SET_OVERRIDE_EXTENABLE_SIDE_RATIO", LUA_NATIVE_VEHICLE_VEHICLE_SET_OVERRIDE_EXTENABLE_SIDE_RATIO);
-		VEHICLE.set_function("VEHICLE_SET_EXTENABLE_SIDE_TARGET_RATIO", LUA_NATIVE_VEHICLE_VEHICLE_SET_EXTENABLE_SIDE_TARGET_RATIO);
-		VEHICLE.set_function("VEHICLE_SET_OVERRIDE_SIDE_RATIO", LUA_NATIVE_VEHICLE_VEHICLE_SET_OVERRIDE_SIDE_RATIO);
-		VEHICLE.set_function("GET_ALL_VEHICLES", LUA_NATIVE_VEHICLE_GET_ALL_VEHICLES);
-		VEHICLE.set_function("SET_CARGOBOB_EXTA_PICKUP_RANGE", LUA_NATIVE_VEHICLE_SET_CARGOBOB_EXTA_PICKUP_RANGE);
-		VEHICLE.set_function("SET_OVERRIDE_VEHICLE_DOOR_TORQUE", LUA_NATIVE_VEHICLE_SET_OVERRIDE_VEHICLE_DOOR_TORQUE);
-		VEHICLE.set_function("SET_WHEELIE_ENABLED", LUA_NATIVE_VEHICLE_SET_WHEELIE_ENABLED);
-		VEHICLE.set_function("SET_DISABLE_HELI_EXPLODE_FROM_BODY_DAMAGE", LUA_NATIVE_VEHICLE_SET_DISABLE_HELI_EXPLODE_FROM_BODY_DAMAGE);
-		VEHICLE.set_function("SET_DISABLE_EXPLODE_FROM_BODY_DAMAGE_ON_COLLISION", LUA_NATIVE_VEHICLE_SET_DISABLE_EXPLODE_FROM_BODY_DAMAGE_ON_COLLISION);
-		VEHICLE.set_function("SET_TRAILER_ATTACHMENT_ENABLED", LUA_NATIVE_VEHICLE_SET_TRAILER_ATTACHMENT_ENABLED);
-		VEHICLE.set_function("SET_ROCKET_BOOST_FILL", LUA_NATIVE_VEHICLE_SET_ROCKET_BOOST_FILL);
-		VEHICLE.set_function("SET_GLIDER_ACTIVE", LUA_NATIVE_VEHICLE_SET_GLIDER_ACTIVE);
-		VEHICLE.set_function("SET_SHOULD_RESET_TURRET_IN_SCRIPTED_CAMERAS", LUA_NATIVE_VEHICLE_SET_SHOULD_RESET_TURRET_IN_SCRIPTED_CAMERAS);
-		VEHICLE.set_function("SET_VEHICLE_DISABLE_COLLISION_UPON_CREATION", LUA_NATIVE_VEHICLE_SET_VEHICLE_DISABLE_COLLISION_UPON_CREATION);
-		VEHICLE.set_function("SET_GROUND_EFFECT_REDUCES_DRAG", LUA_NATIVE_VEHICLE_SET_GROUND_EFFECT_REDUCES_DRAG);
-		VEHICLE.set_function("SET_DISABLE_MAP_COLLISION", LUA_NATIVE_VEHICLE_SET_DISABLE_MAP_COLLISION);
-		VEHICLE.set_function("SET_DISABLE_PED_STAND_ON_TOP", LUA_NATIVE_VEHICLE_SET_DISABLE_PED_STAND_ON_TOP);
-		VEHICLE.set_function("SET_VEHICLE_DAMAGE_SCALES", LUA_NATIVE_VEHICLE_SET_VEHICLE_DAMAGE_SCALES);
-		VEHICLE.set_function("SET_PLANE_SECTION_DAMAGE_SCALE", LUA_NATIVE_VEHICLE_SET_PLANE_SECTION_DAMAGE_SCALE);
-		VEHICLE.set_function("SET_HELI_CAN_PICKUP_ENTITY_THAT_HAS_PICK_UP_DISABLED", LUA_NATIVE_VEHICLE_SET_HELI_CAN_PICKUP_ENTITY_THAT_HAS_PICK_UP_DISABLED);
-		VEHICLE.set_function("SET_VEHICLE_BOMB_AMMO", LUA_NATIVE_VEHICLE_SET_VEHICLE_BOMB_AMMO);
-		VEHICLE.set_function("GET_VEHICLE_BOMB_AMMO", LUA_NATIVE_VEHICLE_GET_VEHICLE_BOMB_AMMO);
-		VEHICLE.set_function("SET_VEHICLE_COUNTERMEASURE_AMMO", LUA_NATIVE_VEHICLE_SET_VEHICLE_COUNTERMEASURE_AMMO);
-		VEHICLE.set_function("GET_VEHICLE_COUNTERMEASURE_AMMO", LUA_NATIVE_VEHICLE_GET_VEHICLE_COUNTERMEASURE_AMMO);
-		VEHICLE.set_function("SET_HELI_COMBAT_OFFSET", LUA_NATIVE_VEHICLE_SET_HELI_COMBAT_OFFSET);
-		VEHICLE.set_function("GET_CAN_VEHICLE_BE_PLACED_HERE", LUA_NATIVE_VEHICLE_GET_CAN_VEHICLE_BE_PLACED_HERE);
-		VEHICLE.set_function("SET_DISABLE_AUTOMATIC_CRASH_TASK", LUA_NATIVE_VEHICLE_SET_DISABLE_AUTOMATIC_CRASH_TASK);
-		VEHICLE.set_function("SET_SPECIAL_FLIGHT_MODE_RATIO", LUA_NATIVE_VEHICLE_SET_SPECIAL_FLIGHT_MODE_RATIO);
-		VEHICLE.set_function("SET_SPECIAL_FLIGHT_MODE_TARGET_RATIO", LUA_NATIVE_VEHICLE_SET_SPECIAL_FLIGHT_MODE_TARGET_RATIO);
-		VEHICLE.set_function("SET_SPECIAL_FLIGHT_MODE_ALLOWED", LUA_NATIVE_VEHICLE_SET_SPECIAL_FLIGHT_MODE_ALLOWED);
-		VEHICLE.set_function("SET_DISABLE_HOVER_MODE_FLIGHT", LUA_NATIVE_VEHICLE_SET_DISABLE_HOVER_MODE_FLIGHT);
-		VEHICLE.set_function("GET_OUTRIGGERS_DEPLOYED", LUA_NATIVE_VEHICLE_GET_OUTRIGGERS_DEPLOYED);
-		VEHICLE.set_function("FIND_SPAWN_COORDINATES_FOR_HELI", LUA_NATIVE_VEHICLE_FIND_SPAWN_COORDINATES_FOR_HELI);
-		VEHICLE.set_function("SET_DEPLOY_FOLDING_WINGS", LUA_NATIVE_VEHICLE_SET_DEPLOY_FOLDING_WINGS);
-		VEHICLE.set_function("ARE_FOLDING_WINGS_DEPLOYED", LUA_NATIVE_VEHICLE_ARE_FOLDING_WINGS_DEPLOYED);
-		VEHICLE.set_function("SET_DEPLOY_MISSILE_BAYS_", LUA_NATIVE_VEHICLE_SET_DEPLOY_MISSILE_BAYS_);
-		VEHICLE.set_function("ARE_MISSILE_BAYS_DEPLOYED_", LUA_NATIVE_VEHICLE_ARE_MISSILE_BAYS_DEPLOYED_);
-		VEHICLE.set_function("SET_DIP_STRAIGHT_DOWN_WHEN_CRASHING_PLANE", LUA_NATIVE_VEHICLE_SET_DIP_STRAIGHT_DOWN_WHEN_CRASHING_PLANE);
-		VEHICLE.set_function("SET_TURRET_HIDDEN", LUA_NATIVE_VEHICLE_SET_TURRET_HIDDEN);
-		VEHICLE.set_function("SET_HOVER_MODE_WING_RATIO", LUA_NATIVE_VEHICLE_SET_HOVER_MODE_WING_RATIO);
-		VEHICLE.set_function("SET_DISABLE_TURRET_MOVEMENT", LUA_NATIVE_VEHICLE_SET_DISABLE_TURRET_MOVEMENT);
-		VEHICLE.set_function("SET_FORCE_FIX_LINK_MATRICES", LUA_NATIVE_VEHICLE_SET_FORCE_FIX_LINK_MATRICES);
-		VEHICLE.set_function("SET_TRANSFORM_RATE_FOR_ANIMATION", LUA_NATIVE_VEHICLE_SET_TRANSFORM_RATE_FOR_ANIMATION);
-		VEHICLE.set_function("SET_TRANSFORM_TO_SUBMARINE_USES_ALTERNATE_INPUT", LUA_NATIVE_VEHICLE_SET_TRANSFORM_TO_SUBMARINE_USES_ALTERNATE_INPUT);
-		VEHICLE.set_function("SET_VEHICLE_COMBAT_MODE", LUA_NATIVE_VEHICLE_SET_VEHICLE_COMBAT_MODE);
-		VEHICLE.set_function("SET_VEHICLE_DETONATION_MODE", LUA_NATIVE_VEHICLE_SET_VEHICLE_DETONATION_MODE);
-		VEHICLE.set_function("SET_VEHICLE_SHUNT_ON_STICK", LUA_NATIVE_VEHICLE_SET_VEHICLE_SHUNT_ON_STICK);
-		VEHICLE.set_function("GET_IS_VEHICLE_SHUNTING", LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_SHUNTING);
-		VEHICLE.set_function("GET_HAS_VEHICLE_BEEN_HIT_BY_SHUNT", LUA_NATIVE_VEHICLE_GET_HAS_VEHICLE_BEEN_HIT_BY_SHUNT);
-		VEHICLE.set_function("GET_LAST_SHUNT_VEHICLE", LUA_NATIVE_VEHICLE_GET_LAST_SHUNT_VEHICLE);
-		VEHICLE.set_function("SET_DISABLE_VEHICLE_EXPLOSIONS_DAMAGE", LUA_NATIVE_VEHICLE_SET_DISABLE_VEHICLE_EXPLOSIONS_DAMAGE);
-		VEHICLE.set_function("SET_OVERRIDE_NITROUS_LEVEL", LUA_NATIVE_VEHICLE_SET_OVERRIDE_NITROUS_LEVEL);
-		VEHICLE.set_function("SET_NITROUS_IS_ACTIVE", LUA_NATIVE_VEHICLE_SET_NITROUS_IS_ACTIVE);
-		VEHICLE.set_function("SET_OVERRIDE_TRACTION_LOSS_MULTIPLIER_", LUA_NATIVE_VEHICLE_SET_OVERRIDE_TRACTION_LOSS_MULTIPLIER_);
-		VEHICLE.set_function("SET_DRIFT_SLIP_ANGLE_LIMITS_", LUA_NATIVE_VEHICLE_SET_DRIFT_SLIP_ANGLE_LIMITS_);
-		VEHICLE.set_function("SET_MINIMUM_TIME_BETWEEN_GEAR_SHIFTS_", LUA_NATIVE_VEHICLE_SET_MINIMUM_TIME_BETWEEN_GEAR_SHIFTS_);
-		VEHICLE.set_function("FULLY_CHARGE_NITROUS", LUA_NATIVE_VEHICLE_FULLY_CHARGE_NITROUS);
-		VEHICLE.set_function("GET_REMAINING_NITROUS_DURATION_", LUA_NATIVE_VEHICLE_GET_REMAINING_NITROUS_DURATION_);
-		VEHICLE.set_function("IS_NITROUS_ACTIVE", LUA_NATIVE_VEHICLE_IS_NITROUS_ACTIVE);
-		VEHICLE.set_function("CLEAR_NITROUS", LUA_NATIVE_VEHICLE_CLEAR_NITROUS);
-		VEHICLE.set_function("SET_INCREASE_WHEEL_CRUSH_DAMAGE", LUA_NATIVE_VEHICLE_SET_INCREASE_WHEEL_CRUSH_DAMAGE);
-		VEHICLE.set_function("SET_DISABLE_WEAPON_BLADE_FORCES", LUA_NATIVE_VEHICLE_SET_DISABLE_WEAPON_BLADE_FORCES);
-		VEHICLE.set_function("SET_USE_DOUBLE_CLICK_FOR_CAR_JUMP", LUA_NATIVE_VEHICLE_SET_USE_DOUBLE_CLICK_FOR_CAR_JUMP);
-		VEHICLE.set_function("GET_DOES_VEHICLE_HAVE_TOMBSTONE", LUA_NATIVE_VEHICLE_GET_DOES_VEHICLE_HAVE_TOMBSTONE);
-		VEHICLE.set_function("HIDE_TOMBSTONE", LUA_NATIVE_VEHICLE_HIDE_TOMBSTONE);
-		VEHICLE.set_function("APPLY_EMP_EFFECT", LUA_NATIVE_VEHICLE_APPLY_EMP_EFFECT);
-		VEHICLE.set_function("GET_IS_VEHICLE_DISABLED_BY_EMP", LUA_NATIVE_VEHICLE_GET_IS_VEHICLE_DISABLED_BY_EMP);
-		VEHICLE.set_function("SET_DISABLE_RETRACTING_WEAPON_BLADES", LUA_NATIVE_VEHICLE_SET_DISABLE_RETRACTING_WEAPON_BLADES);
-		VEHICLE.set_function("GET_TYRE_HEALTH", LUA_NATIVE_VEHICLE_GET_TYRE_HEALTH);
-		VEHICLE.set_function("SET_TYRE_HEALTH", LUA_NATIVE_VEHICLE_SET_TYRE_HEALTH);
-		VEHICLE.set_function("GET_TYRE_WEAR_RATE", LUA_NATIVE_VEHICLE_GET_TYRE_WEAR_RATE);
-		VEHICLE.set_function("SET_TYRE_WEAR_RATE", LUA_NATIVE_VEHICLE_SET_TYRE_WEAR_RATE);
-		VEHICLE.set_function("SET_TYRE_WEAR_RATE_SCALE", LUA_NATIVE_VEHICLE_SET_TYRE_WEAR_RATE_SCALE);
-		VEHICLE.set_function("SET_TYRE_MAXIMUM_GRIP_DIFFERENCE_DUE_TO_WEAR_RATE", LUA_NATIVE_VEHICLE_SET_TYRE_MAXIMUM_GRIP_DIFFERENCE_DUE_TO_WEAR_RATE);
-		VEHICLE.set_function("SET_AIRCRAFT_IGNORE_HIGHTMAP_OPTIMISATION", LUA_NATIVE_VEHICLE_SET_AIRCRAFT_IGNORE_HIGHTMAP_OPTIMISATION);
-		VEHICLE.set_function("SET_REDUCED_SUSPENSION_FORCE", LUA_NATIVE_VEHICLE_SET_REDUCED_SUSPENSION_FORCE);
-		VEHICLE.set_function("SET_DRIFT_TYRES", LUA_NATIVE_VEHICLE_SET_DRIFT_TYRES);
-		VEHICLE.set_function("GET_DRIFT_TYRES_SET", LUA_NATIVE_VEHICLE_GET_DRIFT_TYRES_SET);
-		VEHICLE.set_function("NETWORK_USE_HIGH_PRECISION_TRAIN_BLENDING", LUA_NATIVE_VEHICLE_NETWORK_USE_HIGH_PRECISION_TRAIN_BLENDING);
-		VEHICLE.set_function("SET_CHECK_FOR_ENOUGH_ROOM_FOR_PED", LUA_NATIVE_VEHICLE_SET_CHECK_FOR_ENOUGH_ROOM_FOR_PED);
-		VEHICLE.set_function("SET_ALLOW_COLLISION_WHEN_IN_VEHICLE_", LUA_NATIVE_VEHICLE_SET_ALLOW_COLLISION_WHEN_IN_VEHICLE_);
-		VEHICLE.set_function("IS_VEHICLE_GEN9_EXCLUSIVE_MODEL_", LUA_NATIVE_VEHICLE_IS_VEHICLE_GEN9_EXCLUSIVE_MODEL_);
-		VEHICLE.set_function("GET_VEHICLE_MAX_EXHAUST_BONE_COUNT_", LUA_NATIVE_VEHICLE_GET_VEHICLE_MAX_EXHAUST_BONE_COUNT_);
-		VEHICLE.set_function("GET_VEHICLE_EXHAUST_BONE_", LUA_NATIVE_VEHICLE_GET_VEHICLE_EXHAUST_BONE_);
+		bind_namespace(L, "VEHICLE", VEHICLE_natives);
 	}
 }
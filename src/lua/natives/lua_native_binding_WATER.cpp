@@ -85,20 +85,23 @@ namespace lua::native
 		WATER::RESET_DEEP_OCEAN_SCALER();
 	}
 
+	static constexpr native_entry WATER_natives[] = {
+		{"ADD_EXTRA_CALMING_QUAD", native_function<LUA_NATIVE_WATER_ADD_EXTRA_CALMING_QUAD>},
+		{"GET_DEEP_OCEAN_SCALER", native_function<LUA_NATIVE_WATER_GET_DEEP_OCEAN_SCALER>},
+		{"GET_WATER_HEIGHT", native_function<LUA_NATIVE_WATER_GET_WATER_HEIGHT>},
+		{"GET_WATER_HEIGHT_NO_WAVES", native_function<LUA_NATIVE_WATER_GET_WATER_HEIGHT_NO_WAVES>},
+		{"MODIFY_WATER", native_function<LUA_NATIVE_WATER_MODIFY_WATER>},
+		{"REMOVE_EXTRA_CALMING_QUAD", native_function<LUA_NATIVE_WATER_REMOVE_EXTRA_CALMING_QUAD>},
+		{"RESET_DEEP_OCEAN_SCALER", native_function<LUA_NATIVE_WATER_RESET_DEEP_OCEAN_SCALER>},
+		{"SET_CALMED_WAVE_HEIGHT_SCALER", native_function<LUA_NATIVE_WATER_SET_CALMED_WAVE_HEIGHT_SCALER>},
+		{"SET_DEEP_OCEAN_SCALER", native_function<LUA_NATIVE_WATER_SET_DEEP_OCEAN_SCALER>},
+		{"TEST_PROBE_AGAINST_ALL_WATER", native_function<LUA_NATIVE_WATER_TEST_PROBE_AGAINST_ALL_WATER>},
+		{"TEST_PROBE_AGAINST_WATER", native_function<LUA_NATIVE_WATER_TEST_PROBE_AGAINST_WATER>},
+		{"TEST_VERTICAL_PROBE_AGAINST_ALL_WATER", native_function<LUA_NATIVE_WATER_TEST_VERTICAL_PROBE_AGAINST_ALL_WATER>},
+	};
+
 	void init_native_binding_WATER(sol::state& L)
 	{
-		auto WATER = L["WATER"].get_or_create<sol::table>();
-		WATER.set_function("GET_WATER_HEIGHT", LUA_NATIVE_WATER_GET_WATER_HEIGHT);
-		WATER.set_function("GET_WATER_HEIGHT_NO_WAVES", LUA_NATIVE_WATER_GET_WATER_HEIGHT_NO_WAVES);
-		WATER.set_function("TEST_PROBE_AGAINST_WATER", LUA_NATIVE_WATER_TEST_PROBE_AGAINST_WATER);
-		WATER.set_function("TEST_PROBE_AGAINST_ALL_WATER", LUA_NATIVE_WATER_TEST_PROBE_AGAINST_ALL_WATER);
-		WATER.set_function("TEST_VERTICAL_PROBE_AGAINST_ALL_WATER", LUA_NATIVE_WATER_TEST_VERTICAL_PROBE_AGAINST_ALL_WATER);
-		WATER.set_function("MODIFY_WATER", LUA_NATIVE_WATER_MODIFY_WATER);
-		WATER.set_function("ADD_EXTRA_CALMING_QUAD", LUA_NATIVE_WATER_ADD_EXTRA_CALMING_QUAD);
-		WATER.set_function("REMOVE_EXTRA_CALMING_QUAD", LUA_NATIVE_WATER_REMOVE_EXTRA_CALMING_QUAD);
-		WATER.set_function("SET_DEEP_OCEAN_SCALER", LUA_NATIVE_WATER_SET_DEEP_OCEAN_SCALER);
-		WATER.set_function("GET_DEEP_OCEAN_SCALER", LUA_NATIVE_WATER_GET_DEEP_OCEAN_SCALER);
-		WATER.set_function("SET_CALMED_WAVE_HEIGHT_SCALER", LUA_NATIVE_WATER_SET_CALMED_WAVE_HEIGHT_SCALER);
-		WATER.set_function("RESET_DEEP_OCEAN_SCALER", LUA_NATIVE_WATER_RESET_DEEP_OCEAN_SCALER);
+		bind_namespace(L, "WATER", WATER_natives);
 	}
 }
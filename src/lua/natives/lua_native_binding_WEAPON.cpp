@@ -673,125 +673,128 @@ namespace lua::native
 		WEAPON::SET_CAN_PED_SELECT_ALL_WEAPONS(ped, toggle);
 	}
 
+	static constexpr native_entry WEAPON_natives[] = {
+		{"ADD_AMMO_TO_PED", native_function<LUA_NATIVE_WEAPON_ADD_AMMO_TO_PED>},
+		{"ADD_PED_AMMO_BY_TYPE", native_function<LUA_NATIVE_WEAPON_ADD_PED_AMMO_BY_TYPE>},
+		{"CAN_USE_WEAPON_ON_PARACHUTE", native_function<LUA_NATIVE_WEAPON_CAN_USE_WEAPON_ON_PARACHUTE>},
+		{"CLEAR_ENTITY_LAST_WEAPON_DAMAGE", native_function<LUA_NATIVE_WEAPON_CLEAR_ENTITY_LAST_WEAPON_DAMAGE>},
+		{"CLEAR_PED_LAST_WEAPON_DAMAGE", native_function<LUA_NATIVE_WEAPON_CLEAR_PED_LAST_WEAPON_DAMAGE>},
+		{"CREATE_AIR_DEFENCE_ANGLED_AREA", native_function<LUA_NATIVE_WEAPON_CREATE_AIR_DEFENCE_ANGLED_AREA>},
+		{"CREATE_AIR_DEFENCE_SPHERE", native_function<LUA_NATIVE_WEAPON_CREATE_AIR_DEFENCE_SPHERE>},
+		{"CREATE_WEAPON_OBJECT", native_function<LUA_NATIVE_WEAPON_CREATE_WEAPON_OBJECT>},
+		{"DOES_AIR_DEFENCE_SPHERE_EXIST", native_function<LUA_NATIVE_WEAPON_DOES_AIR_DEFENCE_SPHERE_EXIST>},
+		{"DOES_WEAPON_TAKE_WEAPON_COMPONENT", native_function<LUA_NATIVE_WEAPON_DOES_WEAPON_TAKE_WEAPON_COMPONENT>},
+		{"ENABLE_LASER_SIGHT_RENDERING", native_function<LUA_NATIVE_WEAPON_ENABLE_LASER_SIGHT_RENDERING>},
+		{"EXPLODE_PROJECTILES", native_function<LUA_NATIVE_WEAPON_EXPLODE_PROJECTILES>},
+		{"FIRE_AIR_DEFENCE_SPHERE_WEAPON_AT_POSITION", native_function<LUA_NATIVE_WEAPON_FIRE_AIR_DEFENCE_SPHERE_WEAPON_AT_POSITION>},
+		{"GET_AMMO_IN_CLIP", native_function<LUA_NATIVE_WEAPON_GET_AMMO_IN_CLIP>},
+		{"GET_AMMO_IN_PED_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_AMMO_IN_PED_WEAPON>},
+		{"GET_BEST_PED_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_BEST_PED_WEAPON>},
+		{"GET_CURRENT_PED_VEHICLE_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_CURRENT_PED_VEHICLE_WEAPON>},
+		{"GET_CURRENT_PED_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_CURRENT_PED_WEAPON>},
+		{"GET_CURRENT_PED_WEAPON_ENTITY_INDEX", native_function<LUA_NATIVE_WEAPON_GET_CURRENT_PED_WEAPON_ENTITY_INDEX>},
+		{"GET_IS_PED_GADGET_EQUIPPED", native_function<LUA_NATIVE_WEAPON_GET_IS_PED_GADGET_EQUIPPED>},
+		{"GET_LOCKON_DISTANCE_OF_CURRENT_PED_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_LOCKON_DISTANCE_OF_CURRENT_PED_WEAPON>},
+		{"GET_MAX_AMMO", native_function<LUA_NATIVE_WEAPON_GET_MAX_AMMO>},
+		{"GET_MAX_AMMO_BY_TYPE", native_function<LUA_NATIVE_WEAPON_GET_MAX_AMMO_BY_TYPE>},
+		{"GET_MAX_AMMO_IN_CLIP", native_function<LUA_NATIVE_WEAPON_GET_MAX_AMMO_IN_CLIP>},
+		{"GET_MAX_RANGE_OF_CURRENT_PED_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_MAX_RANGE_OF_CURRENT_PED_WEAPON>},
+		{"GET_PED_AMMO_BY_TYPE", native_function<LUA_NATIVE_WEAPON_GET_PED_AMMO_BY_TYPE>},
+		{"GET_PED_AMMO_TYPE_FROM_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_PED_AMMO_TYPE_FROM_WEAPON>},
+		{"GET_PED_LAST_WEAPON_IMPACT_COORD", native_function<LUA_NATIVE_WEAPON_GET_PED_LAST_WEAPON_IMPACT_COORD>},
+		{"GET_PED_ORIGINAL_AMMO_TYPE_FROM_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_PED_ORIGINAL_AMMO_TYPE_FROM_WEAPON>},
+		{"GET_PED_WEAPONTYPE_IN_SLOT", native_function<LUA_NATIVE_WEAPON_GET_PED_WEAPONTYPE_IN_SLOT>},
+		{"GET_PED_WEAPON_CAMO_INDEX", native_function<LUA_NATIVE_WEAPON_GET_PED_WEAPON_CAMO_INDEX>},
+		{"GET_PED_WEAPON_COMPONENT_TINT_INDEX", native_function<LUA_NATIVE_WEAPON_GET_PED_WEAPON_COMPONENT_TINT_INDEX>},
+		{"GET_PED_WEAPON_TINT_INDEX", native_function<LUA_NATIVE_WEAPON_GET_PED_WEAPON_TINT_INDEX>},
+		{"GET_SELECTED_PED_WEAPON", native_function<LUA_NATIVE_WEAPON_GET_SELECTED_PED_WEAPON>},
+		{"GET_WEAPONTYPE_GROUP", native_function<LUA_NATIVE_WEAPON_GET_WEAPONTYPE_GROUP>},
+		{"GET_WEAPONTYPE_MODEL", native_function<LUA_NATIVE_WEAPON_GET_WEAPONTYPE_MODEL>},
+		{"GET_WEAPONTYPE_SLOT", native_function<LUA_NATIVE_WEAPON_GET_WEAPONTYPE_SLOT>},
+		{"GET_WEAPON_CLIP_SIZE", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_CLIP_SIZE>},
+		{"GET_WEAPON_COMPONENT_HUD_STATS", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_COMPONENT_HUD_STATS>},
+		{"GET_WEAPON_COMPONENT_TYPE_MODEL", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_COMPONENT_TYPE_MODEL>},
+		{"GET_WEAPON_COMPONENT_VARIANT_EXTRA_COUNT", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_COMPONENT_VARIANT_EXTRA_COUNT>},
+		{"GET_WEAPON_COMPONENT_VARIANT_EXTRA_MODEL", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_COMPONENT_VARIANT_EXTRA_MODEL>},
+		{"GET_WEAPON_DAMAGE", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_DAMAGE>},
+		{"GET_WEAPON_DAMAGE_TYPE", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_DAMAGE_TYPE>},
+		{"GET_WEAPON_HUD_STATS", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_HUD_STATS>},
+		{"GET_WEAPON_OBJECT_COMPONENT_TINT_INDEX", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_OBJECT_COMPONENT_TINT_INDEX>},
+		{"GET_WEAPON_OBJECT_FROM_PED", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_OBJECT_FROM_PED>},
+		{"GET_WEAPON_OBJECT_TINT_INDEX", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_OBJECT_TINT_INDEX>},
+		{"GET_WEAPON_TIME_BETWEEN_SHOTS", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_TIME_BETWEEN_SHOTS>},
+		{"GET_WEAPON_TINT_COUNT", native_function<LUA_NATIVE_WEAPON_GET_WEAPON_TINT_COUNT>},
+		{"GIVE_DELAYED_WEAPON_TO_PED", native_function<LUA_NATIVE_WEAPON_GIVE_DELAYED_WEAPON_TO_PED>},
+		{"GIVE_LOADOUT_TO_PED", native_function<LUA_NATIVE_WEAPON_GIVE_LOADOUT_TO_PED>},
+		{"GIVE_WEAPON_COMPONENT_TO_PED", native_function<LUA_NATIVE_WEAPON_GIVE_WEAPON_COMPONENT_TO_PED>},
+		{"GIVE_WEAPON_COMPONENT_TO_WEAPON_OBJECT", native_function<LUA_NATIVE_WEAPON_GIVE_WEAPON_COMPONENT_TO_WEAPON_OBJECT>},
+		{"GIVE_WEAPON_OBJECT_TO_PED", native_function<LUA_NATIVE_WEAPON_GIVE_WEAPON_OBJECT_TO_PED>},
+		{"GIVE_WEAPON_TO_PED", native_function<LUA_NATIVE_WEAPON_GIVE_WEAPON_TO_PED>},
+		{"HAS_ENTITY_BEEN_DAMAGED_BY_WEAPON", native_function<LUA_NATIVE_WEAPON_HAS_ENTITY_BEEN_DAMAGED_BY_WEAPON>},
+		{"HAS_PED_BEEN_DAMAGED_BY_WEAPON", native_function<LUA_NATIVE_WEAPON_HAS_PED_BEEN_DAMAGED_BY_WEAPON>},
+		{"HAS_PED_GOT_WEAPON", native_function<LUA_NATIVE_WEAPON_HAS_PED_GOT_WEAPON>},
+		{"HAS_PED_GOT_WEAPON_COMPONENT", native_function<LUA_NATIVE_WEAPON_HAS_PED_GOT_WEAPON_COMPONENT>},
+		{"HAS_VEHICLE_GOT_PROJECTILE_ATTACHED", native_function<LUA_NATIVE_WEAPON_HAS_VEHICLE_GOT_PROJECTILE_ATTACHED>},
+		{"HAS_WEAPON_ASSET_LOADED", native_function<LUA_NATIVE_WEAPON_HAS_WEAPON_ASSET_LOADED>},
+		{"HAS_WEAPON_GOT_WEAPON_COMPONENT", native_function<LUA_NATIVE_WEAPON_HAS_WEAPON_GOT_WEAPON_COMPONENT>},
+		{"HIDE_PED_WEAPON_FOR_SCRIPTED_CUTSCENE", native_function<LUA_NATIVE_WEAPON_HIDE_PED_WEAPON_FOR_SCRIPTED_CUTSCENE>},
+		{"IS_AIR_DEFENCE_SPHERE_IN_AREA", native_function<LUA_NATIVE_WEAPON_IS_AIR_DEFENCE_SPHERE_IN_AREA>},
+		{"IS_FLASH_LIGHT_ON", native_function<LUA_NATIVE_WEAPON_IS_FLASH_LIGHT_ON>},
+		{"IS_PED_ARMED", native_function<LUA_NATIVE_WEAPON_IS_PED_ARMED>},
+		{"IS_PED_CURRENT_WEAPON_SILENCED", native_function<LUA_NATIVE_WEAPON_IS_PED_CURRENT_WEAPON_SILENCED>},
+		{"IS_PED_WEAPON_COMPONENT_ACTIVE", native_function<LUA_NATIVE_WEAPON_IS_PED_WEAPON_COMPONENT_ACTIVE>},
+		{"IS_PED_WEAPON_READY_TO_SHOOT", native_function<LUA_NATIVE_WEAPON_IS_PED_WEAPON_READY_TO_SHOOT>},
+		{"IS_WEAPON_VALID", native_function<LUA_NATIVE_WEAPON_IS_WEAPON_VALID>},
+		{"MAKE_PED_RELOAD", native_function<LUA_NATIVE_WEAPON_MAKE_PED_RELOAD>},
+		{"REFILL_AMMO_INSTANTLY", native_function<LUA_NATIVE_WEAPON_REFILL_AMMO_INSTANTLY>},
+		{"REMOVE_AIR_DEFENCE_SPHERE", native_function<LUA_NATIVE_WEAPON_REMOVE_AIR_DEFENCE_SPHERE>},
+		{"REMOVE_ALL_AIR_DEFENCE_SPHERES", native_function<LUA_NATIVE_WEAPON_REMOVE_ALL_AIR_DEFENCE_SPHERES>},
+		{"REMOVE_ALL_PED_WEAPONS", native_function<LUA_NATIVE_WEAPON_REMOVE_ALL_PED_WEAPONS>},
+		{"REMOVE_ALL_PROJECTILES_OF_TYPE", native_function<LUA_NATIVE_WEAPON_REMOVE_ALL_PROJECTILES_OF_TYPE>},
+		{"REMOVE_WEAPON_ASSET", native_function<LUA_NATIVE_WEAPON_REMOVE_WEAPON_ASSET>},
+		{"REMOVE_WEAPON_COMPONENT_FROM_PED", native_function<LUA_NATIVE_WEAPON_REMOVE_WEAPON_COMPONENT_FROM_PED>},
+		{"REMOVE_WEAPON_COMPONENT_FROM_WEAPON_OBJECT", native_function<LUA_NATIVE_WEAPON_REMOVE_WEAPON_COMPONENT_FROM_WEAPON_OBJECT>},
+		{"REMOVE_WEAPON_FROM_PED", native_function<LUA_NATIVE_WEAPON_REMOVE_WEAPON_FROM_PED>},
+		{"REQUEST_WEAPON_ASSET", native_function<LUA_NATIVE_WEAPON_REQUEST_WEAPON_ASSET>},
+		{"REQUEST_WEAPON_HIGH_DETAIL_MODEL", native_function<LUA_NATIVE_WEAPON_REQUEST_WEAPON_HIGH_DETAIL_MODEL>},
+		{"SET_AMMO_IN_CLIP", native_function<LUA_NATIVE_WEAPON_SET_AMMO_IN_CLIP>},
+		{"SET_CAN_PED_SELECT_ALL_WEAPONS", native_function<LUA_NATIVE_WEAPON_SET_CAN_PED_SELECT_ALL_WEAPONS>},
+		{"SET_CAN_PED_SELECT_INVENTORY_WEAPON", native_function<LUA_NATIVE_WEAPON_SET_CAN_PED_SELECT_INVENTORY_WEAPON>},
+		{"SET_CURRENT_PED_VEHICLE_WEAPON", native_function<LUA_NATIVE_WEAPON_SET_CURRENT_PED_VEHICLE_WEAPON>},
+		{"SET_CURRENT_PED_WEAPON", native_function<LUA_NATIVE_WEAPON_SET_CURRENT_PED_WEAPON>},
+		{"SET_EQIPPED_WEAPON_START_SPINNING_AT_FULL_SPEED", native_function<LUA_NATIVE_WEAPON_SET_EQIPPED_WEAPON_START_SPINNING_AT_FULL_SPEED>},
+		{"SET_FLASH_LIGHT_ACTIVE_HISTORY", native_function<LUA_NATIVE_WEAPON_SET_FLASH_LIGHT_ACTIVE_HISTORY>},
+		{"SET_FLASH_LIGHT_FADE_DISTANCE", native_function<LUA_NATIVE_WEAPON_SET_FLASH_LIGHT_FADE_DISTANCE>},
+		{"SET_PED_AMMO", native_function<LUA_NATIVE_WEAPON_SET_PED_AMMO>},
+		{"SET_PED_AMMO_BY_TYPE", native_function<LUA_NATIVE_WEAPON_SET_PED_AMMO_BY_TYPE>},
+		{"SET_PED_AMMO_TO_DROP", native_function<LUA_NATIVE_WEAPON_SET_PED_AMMO_TO_DROP>},
+		{"SET_PED_CHANCE_OF_FIRING_BLANKS", native_function<LUA_NATIVE_WEAPON_SET_PED_CHANCE_OF_FIRING_BLANKS>},
+		{"SET_PED_CURRENT_WEAPON_VISIBLE", native_function<LUA_NATIVE_WEAPON_SET_PED_CURRENT_WEAPON_VISIBLE>},
+		{"SET_PED_CYCLE_VEHICLE_WEAPONS_ONLY", native_function<LUA_NATIVE_WEAPON_SET_PED_CYCLE_VEHICLE_WEAPONS_ONLY>},
+		{"SET_PED_DROPS_INVENTORY_WEAPON", native_function<LUA_NATIVE_WEAPON_SET_PED_DROPS_INVENTORY_WEAPON>},
+		{"SET_PED_DROPS_WEAPON", native_function<LUA_NATIVE_WEAPON_SET_PED_DROPS_WEAPON>},
+		{"SET_PED_DROPS_WEAPONS_WHEN_DEAD", native_function<LUA_NATIVE_WEAPON_SET_PED_DROPS_WEAPONS_WHEN_DEAD>},
+		{"SET_PED_GADGET", native_function<LUA_NATIVE_WEAPON_SET_PED_GADGET>},
+		{"SET_PED_INFINITE_AMMO", native_function<LUA_NATIVE_WEAPON_SET_PED_INFINITE_AMMO>},
+		{"SET_PED_INFINITE_AMMO_CLIP", native_function<LUA_NATIVE_WEAPON_SET_PED_INFINITE_AMMO_CLIP>},
+		{"SET_PED_SHOOT_ORDNANCE_WEAPON", native_function<LUA_NATIVE_WEAPON_SET_PED_SHOOT_ORDNANCE_WEAPON>},
+		{"SET_PED_STUN_GUN_FINITE_AMMO", native_function<LUA_NATIVE_WEAPON_SET_PED_STUN_GUN_FINITE_AMMO>},
+		{"SET_PED_WEAPON_COMPONENT_TINT_INDEX", native_function<LUA_NATIVE_WEAPON_SET_PED_WEAPON_COMPONENT_TINT_INDEX>},
+		{"SET_PED_WEAPON_TINT_INDEX", native_function<LUA_NATIVE_WEAPON_SET_PED_WEAPON_TINT_INDEX>},
+		{"SET_PICKUP_AMMO_AMOUNT_SCALER", native_function<LUA_NATIVE_WEAPON_SET_PICKUP_AMMO_AMOUNT_SCALER>},
+		{"SET_PLAYER_TARGETTABLE_FOR_AIR_DEFENCE_SPHERE", native_function<LUA_NATIVE_WEAPON_SET_PLAYER_TARGETTABLE_FOR_AIR_DEFENCE_SPHERE>},
+		{"SET_WEAPON_ANIMATION_OVERRIDE", native_function<LUA_NATIVE_WEAPON_SET_WEAPON_ANIMATION_OVERRIDE>},
+		{"SET_WEAPON_AOE_MODIFIER", native_function<LUA_NATIVE_WEAPON_SET_WEAPON_AOE_MODIFIER>},
+		{"SET_WEAPON_DAMAGE_MODIFIER", native_function<LUA_NATIVE_WEAPON_SET_WEAPON_DAMAGE_MODIFIER>},
+		{"SET_WEAPON_EFFECT_DURATION_MODIFIER", native_function<LUA_NATIVE_WEAPON_SET_WEAPON_EFFECT_DURATION_MODIFIER>},
+		{"SET_WEAPON_OBJECT_CAMO_INDEX", native_function<LUA_NATIVE_WEAPON_SET_WEAPON_OBJECT_CAMO_INDEX>},
+		{"SET_WEAPON_OBJECT_COMPONENT_TINT_INDEX", native_function<LUA_NATIVE_WEAPON_SET_WEAPON_OBJECT_COMPONENT_TINT_INDEX>},
+		{"SET_WEAPON_OBJECT_TINT_INDEX", native_function<LUA_NATIVE_WEAPON_SET_WEAPON_OBJECT_TINT_INDEX>},
+		{"SET_WEAPON_PED_DAMAGE_MODIFIER_", native_function<LUA_NATIVE_WEAPON_SET_WEAPON_PED_DAMAGE_MODIFIER_>},
+	};
+
 	void init_native_binding_WEAPON(sol::state& L)
 	{
-		auto WEAPON = L["WEAPON"].get_or_create<sol::table>();
-		WEAPON.set_function("ENABLE_LASER_SIGHT_RENDERING", LUA_NATIVE_WEAPON_ENABLE_LASER_SIGHT_RENDERING);
-		WEAPON.set_function("GET_WEAPON_COMPONENT_TYPE_MODEL", LUA_NATIVE_WEAPON_GET_WEAPON_COMPONENT_TYPE_MODEL);
-		WEAPON.set_function("GET_WEAPONTYPE_MODEL", LUA_NATIVE_WEAPON_GET_WEAPONTYPE_MODEL);
-		WEAPON.set_function("GET_WEAPONTYPE_SLOT", LUA_NATIVE_WEAPON_GET_WEAPONTYPE_SLOT);
-		WEAPON.set_function("GET_WEAPONTYPE_GROUP", LUA_NATIVE_WEAPON_GET_WEAPONTYPE_GROUP);
-		WEAPON.set_function("GET_WEAPON_COMPONENT_VARIANT_EXTRA_COUNT", LUA_NATIVE_WEAPON_GET_WEAPON_COMPONENT_VARIANT_EXTRA_COUNT);
-		WEAPON.set_function("GET_WEAPON_COMPONENT_VARIANT_EXTRA_MODEL", LUA_NATIVE_WEAPON_GET_WEAPON_COMPONENT_VARIANT_EXTRA_MODEL);
-		WEAPON.set_function("SET_CURRENT_PED_WEAPON", LUA_NATIVE_WEAPON_SET_CURRENT_PED_WEAPON);
-		WEAPON.set_function("GET_CURRENT_PED_WEAPON", LUA_NATIVE_WEAPON_GET_CURRENT_PED_WEAPON);
-		WEAPON.set_function("GET_CURRENT_PED_WEAPON_ENTITY_INDEX", LUA_NATIVE_WEAPON_GET_CURRENT_PED_WEAPON_ENTITY_INDEX);
-		WEAPON.set_function("GET_BEST_PED_WEAPON", LUA_NATIVE_WEAPON_GET_BEST_PED_WEAPON);
-		WEAPON.set_function("SET_CURRENT_PED_VEHICLE_WEAPON", LUA_NATIVE_WEAPON_SET_CURRENT_PED_VEHICLE_WEAPON);
-		WEAPON.set_function("GET_CURRENT_PED_VEHICLE_WEAPON", LUA_NATIVE_WEAPON_GET_CURRENT_PED_VEHICLE_WEAPON);
-		WEAPON.set_function("SET_PED_CYCLE_VEHICLE_WEAPONS_ONLY", LUA_NATIVE_WEAPON_SET_PED_CYCLE_VEHICLE_WEAPONS_ONLY);
-		WEAPON.set_function("IS_PED_ARMED", LUA_NATIVE_WEAPON_IS_PED_ARMED);
-		WEAPON.set_function("IS_WEAPON_VALID", LUA_NATIVE_WEAPON_IS_WEAPON_VALID);
-		WEAPON.set_function("HAS_PED_GOT_WEAPON", LUA_NATIVE_WEAPON_HAS_PED_GOT_WEAPON);
-		WEAPON.set_function("IS_PED_WEAPON_READY_TO_SHOOT", LUA_NATIVE_WEAPON_IS_PED_WEAPON_READY_TO_SHOOT);
-		WEAPON.set_function("GET_PED_WEAPONTYPE_IN_SLOT", LUA_NATIVE_WEAPON_GET_PED_WEAPONTYPE_IN_SLOT);
-		WEAPON.set_function("GET_AMMO_IN_PED_WEAPON", LUA_NATIVE_WEAPON_GET_AMMO_IN_PED_WEAPON);
-		WEAPON.set_function("ADD_AMMO_TO_PED", LUA_NATIVE_WEAPON_ADD_AMMO_TO_PED);
-		WEAPON.set_function("SET_PED_AMMO", LUA_NATIVE_WEAPON_SET_PED_AMMO);
-		WEAPON.set_function("SET_PED_INFINITE_AMMO", LUA_NATIVE_WEAPON_SET_PED_INFINITE_AMMO);
-		WEAPON.set_function("SET_PED_INFINITE_AMMO_CLIP", LUA_NATIVE_WEAPON_SET_PED_INFINITE_AMMO_CLIP);
-		WEAPON.set_function("SET_PED_STUN_GUN_FINITE_AMMO", LUA_NATIVE_WEAPON_SET_PED_STUN_GUN_FINITE_AMMO);
-		WEAPON.set_function("GIVE_WEAPON_TO_PED", LUA_NATIVE_WEAPON_GIVE_WEAPON_TO_PED);
-		WEAPON.set_function("GIVE_DELAYED_WEAPON_TO_PED", LUA_NATIVE_WEAPON_GIVE_DELAYED_WEAPON_TO_PED);
-		WEAPON.set_function("REMOVE_ALL_PED_WEAPONS", LUA_NATIVE_WEAPON_REMOVE_ALL_PED_WEAPONS);
-		WEAPON.set_function("REMOVE_WEAPON_FROM_PED", LUA_NATIVE_WEAPON_REMOVE_WEAPON_FROM_PED);
-		WEAPON.set_function("HIDE_PED_WEAPON_FOR_SCRIPTED_CUTSCENE", LUA_NATIVE_WEAPON_HIDE_PED_WEAPON_FOR_SCRIPTED_CUTSCENE);
-		WEAPON.set_function("SET_PED_CURRENT_WEAPON_VISIBLE", LUA_NATIVE_WEAPON_SET_PED_CURRENT_WEAPON_VISIBLE);
-		WEAPON.set_function("SET_PED_DROPS_WEAPONS_WHEN_DEAD", LUA_NATIVE_WEAPON_SET_PED_DROPS_WEAPONS_WHEN_DEAD);
-		WEAPON.set_function("HAS_PED_BEEN_DAMAGED_BY_WEAPON", LUA_NATIVE_WEAPON_HAS_PED_BEEN_DAMAGED_BY_WEAPON);
-		WEAPON.set_function("CLEAR_PED_LAST_WEAPON_DAMAGE", LUA_NATIVE_WEAPON_CLEAR_PED_LAST_WEAPON_DAMAGE);
-		WEAPON.set_function("HAS_ENTITY_BEEN_DAMAGED_BY_WEAPON", LUA_NATIVE_WEAPON_HAS_ENTITY_BEEN_DAMAGED_BY_WEAPON);
-		WEAPON.set_function("CLEAR_ENTITY_LAST_WEAPON_DAMAGE", LUA_NATIVE_WEAPON_CLEAR_ENTITY_LAST_WEAPON_DAMAGE);
-		WEAPON.set_function("SET_PED_DROPS_WEAPON", LUA_NATIVE_WEAPON_SET_PED_DROPS_WEAPON);
-		WEAPON.set_function("SET_PED_DROPS_INVENTORY_WEAPON", LUA_NATIVE_WEAPON_SET_PED_DROPS_INVENTORY_WEAPON);
-		WEAPON.set_function("GET_MAX_AMMO_IN_CLIP", LUA_NATIVE_WEAPON_GET_MAX_AMMO_IN_CLIP);
-		WEAPON.set_function("GET_AMMO_IN_CLIP", LUA_NATIVE_WEAPON_GET_AMMO_IN_CLIP);
-		WEAPON.set_function("SET_AMMO_IN_CLIP", LUA_NATIVE_WEAPON_SET_AMMO_IN_CLIP);
-		WEAPON.set_function("GET_MAX_AMMO", LUA_NATIVE_WEAPON_GET_MAX_AMMO);
-		WEAPON.set_function("GET_MAX_AMMO_BY_TYPE", LUA_NATIVE_WEAPON_GET_MAX_AMMO_BY_TYPE);
-		WEAPON.set_function("ADD_PED_AMMO_BY_TYPE", LUA_NATIVE_WEAPON_ADD_PED_AMMO_BY_TYPE);
-		WEAPON.set_function("SET_PED_AMMO_BY_TYPE", LUA_NATIVE_WEAPON_SET_PED_AMMO_BY_TYPE);
-		WEAPON.set_function("GET_PED_AMMO_BY_TYPE", LUA_NATIVE_WEAPON_GET_PED_AMMO_BY_TYPE);
-		WEAPON.set_function("SET_PED_AMMO_TO_DROP", LUA_NATIVE_WEAPON_SET_PED_AMMO_TO_DROP);
-		WEAPON.set_function("SET_PICKUP_AMMO_AMOUNT_SCALER", LUA_NATIVE_WEAPON_SET_PICKUP_AMMO_AMOUNT_SCALER);
-		WEAPON.set_function("GET_PED_AMMO_TYPE_FROM_WEAPON", LUA_NATIVE_WEAPON_GET_PED_AMMO_TYPE_FROM_WEAPON);
-		WEAPON.set_function("GET_PED_ORIGINAL_AMMO_TYPE_FROM_WEAPON", LUA_NATIVE_WEAPON_GET_PED_ORIGINAL_AMMO_TYPE_FROM_WEAPON);
-		WEAPON.set_function("GET_PED_LAST_WEAPON_IMPACT_COORD", LUA_NATIVE_WEAPON_GET_PED_LAST_WEAPON_IMPACT_COORD);
-		WEAPON.set_function("SET_PED_GADGET", LUA_NATIVE_WEAPON_SET_PED_GADGET);
-		WEAPON.set_function("GET_IS_PED_GADGET_EQUIPPED", LUA_NATIVE_WEAPON_GET_IS_PED_GADGET_EQUIPPED);
-		WEAPON.set_function("GET_SELECTED_PED_WEAPON", LUA_NATIVE_WEAPON_GET_SELECTED_PED_WEAPON);
-		WEAPON.set_function("EXPLODE_PROJECTILES", LUA_NATIVE_WEAPON_EXPLODE_PROJECTILES);
-		WEAPON.set_function("REMOVE_ALL_PROJECTILES_OF_TYPE", LUA_NATIVE_WEAPON_REMOVE_ALL_PROJECTILES_OF_TYPE);
-		WEAPON.set_function("GET_LOCKON_DISTANCE_OF_CURRENT_PED_WEAPON", LUA_NATIVE_WEAPON_GET_LOCKON_DISTANCE_OF_CURRENT_PED_WEAPON);
-		WEAPON.set_function("GET_MAX_RANGE_OF_CURRENT_PED_WEAPON", LUA_NATIVE_WEAPON_GET_MAX_RANGE_OF_CURRENT_PED_WEAPON);
-		WEAPON.set_function("HAS_VEHICLE_GOT_PROJECTILE_ATTACHED", LUA_NATIVE_WEAPON_HAS_VEHICLE_GOT_PROJECTILE_ATTACHED);
-		WEAPON.set_function("GIVE_WEAPON_COMPONENT_TO_PED", LUA_NATIVE_WEAPON_GIVE_WEAPON_COMPONENT_TO_PED);
-		WEAPON.set_function("REMOVE_WEAPON_COMPONENT_FROM_PED", LUA_NATIVE_WEAPON_REMOVE_WEAPON_COMPONENT_FROM_PED);
-		WEAPON.set_function("HAS_PED_GOT_WEAPON_COMPONENT", LUA_NATIVE_WEAPON_HAS_PED_GOT_WEAPON_COMPONENT);
-		WEAPON.set_function("IS_PED_WEAPON_COMPONENT_ACTIVE", LUA_NATIVE_WEAPON_IS_PED_WEAPON_COMPONENT_ACTIVE);
-		WEAPON.set_function("REFILL_AMMO_INSTANTLY", LUA_NATIVE_WEAPON_REFILL_AMMO_INSTANTLY);
-		WEAPON.set_function("MAKE_PED_RELOAD", LUA_NATIVE_WEAPON_MAKE_PED_RELOAD);
-		WEAPON.set_function("REQUEST_WEAPON_ASSET", LUA_NATIVE_WEAPON_REQUEST_WEAPON_ASSET);
-		WEAPON.set_function("HAS_WEAPON_ASSET_LOADED", LUA_NATIVE_WEAPON_HAS_WEAPON_ASSET_LOADED);
-		WEAPON.set_function("REMOVE_WEAPON_ASSET", LUA_NATIVE_WEAPON_REMOVE_WEAPON_ASSET);
-		WEAPON.set_function("CREATE_WEAPON_OBJECT", LUA_NATIVE_WEAPON_CREATE_WEAPON_OBJECT);
-		WEAPON.set_function("GIVE_WEAPON_COMPONENT_TO_WEAPON_OBJECT", LUA_NATIVE_WEAPON_GIVE_WEAPON_COMPONENT_TO_WEAPON_OBJECT);
-		WEAPON.set_function("REMOVE_WEAPON_COMPONENT_FROM_WEAPON_OBJECT", LUA_NATIVE_WEAPON_REMOVE_WEAPON_COMPONENT_FROM_WEAPON_OBJECT);
-		WEAPON.set_function("HAS_WEAPON_GOT_WEAPON_COMPONENT", LUA_NATIVE_WEAPON_HAS_WEAPON_GOT_WEAPON_COMPONENT);
-		WEAPON.set_function("GIVE_WEAPON_OBJECT_TO_PED", LUA_NATIVE_WEAPON_GIVE_WEAPON_OBJECT_TO_PED);
-		WEAPON.set_function("DOES_WEAPON_TAKE_WEAPON_COMPONENT", LUA_NATIVE_WEAPON_DOES_WEAPON_TAKE_WEAPON_COMPONENT);
-		WEAPON.set_function("GET_WEAPON_OBJECT_FROM_PED", LUA_NATIVE_WEAPON_GET_WEAPON_OBJECT_FROM_PED);
-		WEAPON.set_function("GIVE_LOADOUT_TO_PED", LUA_NATIVE_WEAPON_GIVE_LOADOUT_TO_PED);
-		WEAPON.set_function("SET_PED_WEAPON_TINT_INDEX", LUA_NATIVE_WEAPON_SET_PED_WEAPON_TINT_INDEX);
-		WEAPON.set_function("GET_PED_WEAPON_TINT_INDEX", LUA_NATIVE_WEAPON_GET_PED_WEAPON_TINT_INDEX);
-		WEAPON.set_function("SET_WEAPON_OBJECT_TINT_INDEX", LUA_NATIVE_WEAPON_SET_WEAPON_OBJECT_TINT_INDEX);
-		WEAPON.set_function("GET_WEAPON_OBJECT_TINT_INDEX", LUA_NATIVE_WEAPON_GET_WEAPON_OBJECT_TINT_INDEX);
-		WEAPON.set_function("GET_WEAPON_TINT_COUNT", LUA_NATIVE_WEAPON_GET_WEAPON_TINT_COUNT);
-		WEAPON.set_function("SET_PED_WEAPON_COMPONENT_TINT_INDEX", LUA_NATIVE_WEAPON_SET_PED_WEAPON_COMPONENT_TINT_INDEX);
-		WEAPON.set_function("GET_PED_WEAPON_COMPONENT_TINT_INDEX", LUA_NATIVE_WEAPON_GET_PED_WEAPON_COMPONENT_TINT_INDEX);
-		WEAPON.set_function("SET_WEAPON_OBJECT_COMPONENT_TINT_INDEX", LUA_NATIVE_WEAPON_SET_WEAPON_OBJECT_COMPONENT_TINT_INDEX);
-		WEAPON.set_function("GET_WEAPON_OBJECT_COMPONENT_TINT_INDEX", LUA_NATIVE_WEAPON_GET_WEAPON_OBJECT_COMPONENT_TINT_INDEX);
-		WEAPON.set_function("GET_PED_WEAPON_CAMO_INDEX", LUA_NATIVE_WEAPON_GET_PED_WEAPON_CAMO_INDEX);
-		WEAPON.set_function("SET_WEAPON_OBJECT_CAMO_INDEX", LUA_NATIVE_WEAPON_SET_WEAPON_OBJECT_CAMO_INDEX);
-		WEAPON.set_function("GET_WEAPON_HUD_STATS", LUA_NATIVE_WEAPON_GET_WEAPON_HUD_STATS);
-		WEAPON.set_function("GET_WEAPON_COMPONENT_HUD_STATS", LUA_NATIVE_WEAPON_GET_WEAPON_COMPONENT_HUD_STATS);
-		WEAPON.set_function("GET_WEAPON_DAMAGE", LUA_NATIVE_WEAPON_GET_WEAPON_DAMAGE);
-		WEAPON.set_function("GET_WEAPON_CLIP_SIZE", LUA_NATIVE_WEAPON_GET_WEAPON_CLIP_SIZE);
-		WEAPON.set_function("GET_WEAPON_TIME_BETWEEN_SHOTS", LUA_NATIVE_WEAPON_GET_WEAPON_TIME_BETWEEN_SHOTS);
-		WEAPON.set_function("SET_PED_CHANCE_OF_FIRING_BLANKS", LUA_NATIVE_WEAPON_SET_PED_CHANCE_OF_FIRING_BLANKS);
-		WEAPON.set_function("SET_PED_SHOOT_ORDNANCE_WEAPON", LUA_NATIVE_WEAPON_SET_PED_SHOOT_ORDNANCE_WEAPON);
-		WEAPON.set_function("REQUEST_WEAPON_HIGH_DETAIL_MODEL", LUA_NATIVE_WEAPON_REQUEST_WEAPON_HIGH_DETAIL_MODEL);
-		WEAPON.set_function("SET_WEAPON_PED_DAMAGE_MODIFIER_", LUA_NATIVE_WEAPON_SET_WEAPON_PED_DAMAGE_MODIFIER_);
-		WEAPON.set_function("SET_WEAPON_DAMAGE_MODIFIER", LUA_NATIVE_WEAPON_SET_WEAPON_DAMAGE_MODIFIER);
-		WEAPON.set_function("SET_WEAPON_AOE_MODIFIER", LUA_NATIVE_WEAPON_SET_WEAPON_AOE_MODIFIER);
-		WEAPON.set_function("SET_WEAPON_EFFECT_DURATION_MODIFIER", LUA_NATIVE_WEAPON_SET_WEAPON_EFFECT_DURATION_MODIFIER);
-		WEAPON.set_function("IS_PED_CURRENT_WEAPON_SILENCED", LUA_NATIVE_WEAPON_IS_PED_CURRENT_WEAPON_SILENCED);
-		WEAPON.set_function("IS_FLASH_LIGHT_ON", LUA_NATIVE_WEAPON_IS_FLASH_LIGHT_ON);
-		WEAPON.set_function("SET_FLASH_LIGHT_FADE_DISTANCE", LUA_NATIVE_WEAPON_SET_FLASH_LIGHT_FADE_DISTANCE);
-		WEAPON.set_function("SET_FLASH_LIGHT_ACTIVE_HISTORY", LUA_NATIVE_WEAPON_SET_FLASH_LIGHT_ACTIVE_HISTORY);
-		WEAPON.set_function("SET_WEAPON_ANIMATION_OVERRIDE", LUA_NATIVE_WEAPON_SET_WEAPON_ANIMATION_OVERRIDE);
-		WEAPON.set_function("GET_WEAPON_DAMAGE_TYPE", LUA_NATIVE_WEAPON_GET_WEAPON_DAMAGE_TYPE);
-		WEAPON.set_function("SET_EQIPPED_WEAPON_START_SPINNING_AT_FULL_SPEED", LUA_NATIVE_WEAPON_SET_EQIPPED_WEAPON_START_SPINNING_AT_FULL_SPEED);
-		WEAPON.set_function("CAN_USE_WEAPON_ON_PARACHUTE", LUA_NATIVE_WEAPON_CAN_USE_WEAPON_ON_PARACHUTE);
-		WEAPON.set_function("CREATE_AIR_DEFENCE_SPHERE", LUA_NATIVE_WEAPON_CREATE_AIR_DEFENCE_SPHERE);
-		WEAPON.set_function("CREATE_AIR_DEFENCE_ANGLED_AREA", LUA_NATIVE_WEAPON_CREATE_AIR_DEFENCE_ANGLED_AREA);
-		WEAPON.set_function("REMOVE_AIR_DEFENCE_SPHERE", LUA_NATIVE_WEAPON_REMOVE_AIR_DEFENCE_SPHERE);
-		WEAPON.set_function("REMOVE_ALL_AIR_DEFENCE_SPHERES", LUA_NATIVE_WEAPON_REMOVE_ALL_AIR_DEFENCE_SPHERES);
-		WEAPON.set_function("SET_PLAYER_TARGETTABLE_FOR_AIR_DEFENCE_SPHERE", LUA_NATIVE_WEAPON_SET_PLAYER_TARGETTABLE_FOR_AIR_DEFENCE_SPHERE);
-		WEAPON.set_function("IS_AIR_DEFENCE_SPHERE_IN_AREA", LUA_NATIVE_WEAPON_IS_AIR_DEFENCE_SPHERE_IN_AREA);
-		WEAPON.set_function("FIRE_AIR_DEFENCE_SPHERE_WEAPON_AT_POSITION", LUA_NATIVE_WEAPON_FIRE_AIR_DEFENCE_SPHERE_WEAPON_AT_POSITION);
-		WEAPON.set_function("DOES_AIR_DEFENCE_SPHERE_EXIST", LUA_NATIVE_WEAPON_DOES_AIR_DEFENCE_SPHERE_EXIST);
-		WEAPON.set_function("SET_CAN_PED_SELECT_INVENTORY_WEAPON", LUA_NATIVE_WEAPON_SET_CAN_PED_SELECT_INVENTORY_WEAPON);
-		WEAPON.set_function("SET_CAN_PED_SELECT_ALL_WEAPONS", LUA_NATIVE_WEAPON_SET_CAN_PED_SELECT_ALL_WEAPONS);
+		bind_namespace(L, "WEAPON", WEAPON_natives);
 	}
 }
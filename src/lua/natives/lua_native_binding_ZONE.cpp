@@ -54,17 +54,20 @@ namespace lua::native
 		return retval;
 	}
 
+	static constexpr native_entry ZONE_natives[] = {
+		{"CLEAR_POPSCHEDULE_OVERRIDE_VEHICLE_MODEL", native_function<LUA_NATIVE_ZONE_CLEAR_POPSCHEDULE_OVERRIDE_VEHICLE_MODEL>},
+		{"GET_HASH_OF_MAP_AREA_AT_COORDS", native_function<LUA_NATIVE_ZONE_GET_HASH_OF_MAP_AREA_AT_COORDS>},
+		{"GET_NAME_OF_ZONE", native_function<LUA_NATIVE_ZONE_GET_NAME_OF_ZONE>},
+		{"GET_ZONE_AT_COORDS", native_function<LUA_NATIVE_ZONE_GET_ZONE_AT_COORDS>},
+		{"GET_ZONE_FROM_NAME_ID", native_function<LUA_NATIVE_ZONE_GET_ZONE_FROM_NAME_ID>},
+		{"GET_ZONE_POPSCHEDULE", native_function<LUA_NATIVE_ZONE_GET_ZONE_POPSCHEDULE>},
+		{"GET_ZONE_SCUMMINESS", native_function<LUA_NATIVE_ZONE_GET_ZONE_SCUMMINESS>},
+		{"OVERRIDE_POPSCHEDULE_VEHICLE_MODEL", native_function<LUA_NATIVE_ZONE_OVERRIDE_POPSCHEDULE_VEHICLE_MODEL>},
+		{"SET_ZONE_ENABLED", native_function<LUA_NATIVE_ZONE_SET_ZONE_ENABLED>},
+	};
+
 	void init_native_binding_ZONE(sol::state& L)
 	{
-		auto ZONE = L["ZONE"].get_or_create<sol::table>();
-		ZONE.set_function("GET_ZONE_AT_COORDS", LUA_NATIVE_ZONE_GET_ZONE_AT_COORDS);
-		ZONE.set_function("GET_ZONE_FROM_NAME_ID", LUA_NATIVE_ZONE_GET_ZONE_FROM_NAME_ID);
-		ZONE.set_function("GET_ZONE_POPSCHEDULE", LUA_NATIVE_ZONE_GET_ZONE_POPSCHEDULE);
-		ZONE.set_function("GET_NAME_OF_ZONE", LUA_NATIVE_ZONE_GET_NAME_OF_ZONE);
-		ZONE.set_function("SET_ZONE_ENABLED", LUA_NATIVE_ZONE_SET_ZONE_ENABLED);
-		ZONE.set_function("GET_ZONE_SCUMMINESS", LUA_NATIVE_ZONE_GET_ZONE_SCUMMINESS);
-		ZONE.set_function("OVERRIDE_POPSCHEDULE_VEHICLE_MODEL", LUA_NATIVE_ZONE_OVERRIDE_POPSCHEDULE_VEHICLE_MODEL);
-		ZONE.set_function("CLEAR_POPSCHEDULE_OVERRIDE_VEHICLE_MODEL", LUA_NATIVE_ZONE_CLEAR_POPSCHEDULE_OVERRIDE_VEHICLE_MODEL);
-		ZONE.set_function("GET_HASH_OF_MAP_AREA_AT_COORDS", LUA_NATIVE_ZONE_GET_HASH_OF_MAP_AREA_AT_COORDS);
+		bind_namespace(L, "ZONE", ZONE_natives);
 	}
 }
@@ -0,0 +1,84 @@
+#include "native_namespace.hpp"
+
+namespace lua::native
+{
+	static std::span<const native_entry> get_natives(lua_State* L)
+	{
+		const auto natives = static_cast<const native_entry*>(lua_touserdata(L, lua_upvalueindex(1)));
+		return {natives, static_cast<std::size_t>(lua_tointeger(L, lua_upvalueindex(2)))};
+	}
+
+	// __index(namespace, name)
+	static int index_namespace(lua_State* L)
+	{
+		if (lua_type(L, 2) != LUA_TSTRING)
+			return 0;
+
+		std::size_t length;
+		const auto data = lua_tolstring(L, 2, &length);
+		const std::string_view name(data, length);
+
+		const auto natives = get_natives(L);
+		const auto it      = std::lower_bound(natives.begin(), natives.end(), name, [](const native_entry& entry, std::string_view key) {
+			return entry.m_name < key;
+		});
+		if (it == natives.end() || it->m_name != name)
+			return 0;
+
+		// stored in the table itself, later lookups of the native don't get here anymore
+		lua_pushcfunction(L, it->m_function);
+		lua_pushvalue(L, 2);
+		lua_pushvalue(L, -2);
+		lua_rawset(L, 1);
+		return 1;
+	}
+
+	static int next_native(lua_State* L)
+	{
+		lua_settop(L, 2);
+		if (lua_next(L, 1))
+			return 2;
+
+		lua_pushnil(L);
+		return 1;
+	}
+
+	// __pairs(namespace)
+	static int iterate_namespace(lua_State* L)
+	{
+		for (const auto& native : get_natives(L))
+		{
+			lua_pushlstring(L, native.m_name.data(), native.m_name.size());
+			if (lua_rawget(L, 1) == LUA_TNIL)
+			{
+				lua_pushlstring(L, native.m_name.data(), native.m_name.size());
+				lua_pushcfunction(L, native.m_function);
+				lua_rawset(L, 1);
+			}
+			lua_pop(L, 1);
+		}
+
+		lua_pushcfunction(L, next_native);
+		lua_pushvalue(L, 1);
+		lua_pushnil(L);
+		return 3;
+	}
+
+	void bind_namespace(sol::state& L, const char* name, std::span<const native_entry> natives)
+	{
+		auto ns = L[name].get_or_create<sol::table>();
+
+		const auto state = L.lua_state();
+		ns.push();
+		lua_createtable(state, 0, 2);
+		for (const auto& [field, function] : {std::pair{"__index", index_namespace}, std::pair{"__pairs", iterate_namespace}})
+		{
+			lua_pushlightuserdata(state, const_cast<native_entry*>(natives.data()));
+			lua_pushinteger(state, static_cast<lua_Integer>(natives.size()));
+			lua_pushcclosure(state, function, 2);
+			lua_setfield(state, -2, field);
+		}
+		lua_setmetatable(state, -2);
+		lua_pop(state, 1);
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <span>
+
+namespace lua::native
+{
+	struct native_entry
+	{
+		std::string_view m_name;
+		lua_CFunction m_function;
+	};
+
+	template<auto F>
+	constexpr lua_CFunction native_function = sol::c_call<decltype(F), F>;
+
+	/**
+	 * @brief Installs an empty namespace table that binds each native the first time a script looks it up.
+	 *
+	 * Scripts usually only touch a handful of namespaces, this keeps every lua state from paying for thousands of
+	 * functions it never calls. Iterating the table with pairs binds the whole namespace.
+	 *
+	 * @param natives Has to be sorted by name and outlive the lua state.
+	 */
+	void bind_namespace(sol::state& L, const char* name, std::span<const native_entry> natives);
+}
@@ -15,6 +15,7 @@
 #include "services/api/api_service.hpp"
 #include "services/context_menu/context_menu_service.hpp"
 #include "services/custom_text/custom_text_service.hpp"
+#include "services/entity_snapshot/entity_snapshot_service.hpp"
 #include "services/gta_data/gta_data_service.hpp"
 #include "services/gui/gui_service.hpp"
 #include "services/hotkey/hotkey_service.hpp"
@@ -31,6 +32,7 @@
 #include "services/vehicle/handling_service.hpp"
 #include "services/vehicle/xml_vehicles_service.hpp"
 #include "services/xml_maps/xml_map_service.hpp"
+#include "startup_sequencer.hpp"
 #include "thread_pool.hpp"
 #include "util/is_proton.hpp"
 #include "version.hpp"
@@ -175,58 +177,113 @@ BOOL APIENTRY DllMain(HMODULE hmod, DWORD reason, PVOID)
 			    auto thread_pool_instance = std::make_unique<thread_pool>();
 			    LOG(INFO) << "Thread pool initialized.";
 
-			    auto pointers_instance = std::make_unique<pointers>();
-			    LOG(INFO) << "Pointers initialized.";
-
-			    while (!disable_anticheat_skeleton())
-			    {
-				    LOG(WARNING) << "Failed patching anticheat gameskeleton (injected too early?). Waiting 100ms and trying again";
-				    std::this_thread::sleep_for(100ms);
-			    }
-			    LOG(INFO) << "Disabled anticheat gameskeleton.";
-
-			    auto byte_patch_manager_instance = std::make_unique<byte_patch_manager>();
-			    LOG(INFO) << "Byte Patch Manager initialized.";
-
-			    g_renderer.init();
-			    LOG(INFO) << "Renderer initialized.";
-			    auto gui_instance = std::make_unique<gui>();
-
-			    auto fiber_pool_instance = std::make_unique<fiber_pool>(11);
-			    LOG(INFO) << "Fiber pool initialized.";
-
-			    g_http_client.init(g_file_manager.get_project_file("./proxy_settings.json"));
-			    LOG(INFO) << "HTTP Client initialized.";
-
-			    g_translation_service.init();
-			    LOG(INFO) << "Translation Service initialized.";
-
-			    auto hooking_instance = std::make_unique<hooking>();
-			    LOG(INFO) << "Hooking initialized.";
-
-			    g_gta_data_service.init();
-
-			    auto context_menu_service_instance      = std::make_unique<context_menu_service>();
-			    auto custom_text_service_instance       = std::make_unique<custom_text_service>();
-			    auto mobile_service_instance            = std::make_unique<mobile_service>();
-			    auto pickup_service_instance            = std::make_unique<pickup_service>();
-			    auto player_service_instance            = std::make_unique<player_service>();
-			    auto model_preview_service_instance     = std::make_unique<model_preview_service>();
-			    auto handling_service_instance          = std::make_unique<handling_service>();
-			    auto gui_service_instance               = std::make_unique<gui_service>();
-			    auto script_patcher_service_instance    = std::make_unique<script_patcher_service>();
-			    auto player_database_service_instance   = std::make_unique<player_database_service>();
-			    auto hotkey_service_instance            = std::make_unique<hotkey_service>();
-			    auto matchmaking_service_instance       = std::make_unique<matchmaking_service>();
-			    auto api_service_instance               = std::make_unique<api_service>();
-			    auto tunables_service_instance          = std::make_unique<tunables_service>();
-			    auto script_connection_service_instance = std::make_unique<script_connection_service>();
-			    auto xml_vehicles_service_instance      = std::make_unique<xml_vehicles_service>();
-			    auto xml_maps_service_instance          = std::make_unique<xml_map_service>();
-			    LOG(INFO) << "Registered service instances...";
-
-			    g_notification_service.initialise();
-			    LOG(INFO) << "Finished initialising services.";
+			    std::unique_ptr<pointers> pointers_instance;
+			    std::unique_ptr<byte_patch_manager> byte_patch_manager_instance;
+			    std::unique_ptr<gui> gui_instance;
+			    std::unique_ptr<fiber_pool> fiber_pool_instance;
+			    std::unique_ptr<hooking> hooking_instance;
+
+			    std::unique_ptr<context_menu_service> context_menu_service_instance;
+			    std::unique_ptr<custom_text_service> custom_text_service_instance;
+			    std::unique_ptr<mobile_service> mobile_service_instance;
+			    std::unique_ptr<pickup_service> pickup_service_instance;
+			    std::unique_ptr<player_service> player_service_instance;
+			    std::unique_ptr<model_preview_service> model_preview_service_instance;
+			    std::unique_ptr<handling_service> handling_service_instance;
+			    std::unique_ptr<gui_service> gui_service_instance;
+			    std::unique_ptr<script_patcher_service> script_patcher_service_instance;
+			    std::unique_ptr<player_database_service> player_database_service_instance;
+			    std::unique_ptr<hotkey_service> hotkey_service_instance;
+			    std::unique_ptr<matchmaking_service> matchmaking_service_instance;
+			    std::unique_ptr<api_service> api_service_instance;
+			    std::unique_ptr<tunables_service> tunables_service_instance;
+			    std::unique_ptr<script_connection_service> script_connection_service_instance;
+			    std::unique_ptr<xml_vehicles_service> xml_vehicles_service_instance;
+			    std::unique_ptr<xml_map_service> xml_maps_service_instance;
+			    std::unique_ptr<entity_snapshot_service> entity_snapshot_service_instance;
+
+			    // the signature scan is the slow step, network bound work is left for after startup
+			    startup_sequencer startup;
+
+			    startup.add("pointers", {}, [&] {
+				    pointers_instance = std::make_unique<pointers>();
+				    LOG(INFO) << "Pointers initialized.";
+			    });
+
+			    startup.add("anticheat", {"pointers"}, [] {
+				    while (!disable_anticheat_skeleton())
+				    {
+					    LOG(WARNING) << "Failed patching anticheat gameskeleton (injected too early?). Waiting 100ms and trying again";
+					    std::this_thread::sleep_for(100ms);
+				    }
+				    LOG(INFO) << "Disabled anticheat gameskeleton.";
+			    });
+
+			    startup.add("byte_patch_manager", {"anticheat"}, [&] {
+				    byte_patch_manager_instance = std::make_unique<byte_patch_manager>();
+				    LOG(INFO) << "Byte Patch Manager initialized.";
+			    });
+
+			    startup.add("renderer", {"pointers"}, [&] {
+				    g_renderer.init();
+				    LOG(INFO) << "Renderer initialized.";
+				    gui_instance = std::make_unique<gui>();
+			    });
+
+			    startup.add("fiber_pool", {}, [&] {
+				    fiber_pool_instance = std::make_unique<fiber_pool>(11);
+				    LOG(INFO) << "Fiber pool initialized.";
+			    });
+
+			    startup.add("http_client", {}, [] {
+				    g_http_client.init(g_file_manager.get_project_file("./proxy_settings.json"));
+				    LOG(INFO) << "HTTP Client initialized.";
+			    });
+
+			    startup.add("translation_service", {"renderer"}, [] {
+				    g_translation_service.init();
+				    LOG(INFO) << "Translation Service initialized.";
+			    });
+
+			    startup.add("hooking", {"byte_patch_manager", "renderer"}, [&] {
+				    hooking_instance = std::make_unique<hooking>();
+				    LOG(INFO) << "Hooking initialized.";
+			    });
+
+			    startup.add("gta_data_service", {"pointers"}, [] {
+				    g_gta_data_service.init();
+			    });
+
+			    startup.add("services", {"hooking", "gta_data_service", "fiber_pool", "translation_service"}, [&] {
+				    context_menu_service_instance      = std::make_unique<context_menu_service>();
+				    custom_text_service_instance       = std::make_unique<custom_text_service>();
+				    mobile_service_instance            = std::make_unique<mobile_service>();
+				    pickup_service_instance            = std::make_unique<pickup_service>();
+				    player_service_instance            = std::make_unique<player_service>();
+				    model_preview_service_instance     = std::make_unique<model_preview_service>();
+				    handling_service_instance          = std::make_unique<handling_service>();
+				    gui_service_instance               = std::make_unique<gui_service>();
+				    script_patcher_service_instance    = std::make_unique<script_patcher_service>();
+				    player_database_service_instance   = std::make_unique<player_database_service>();
+				    hotkey_service_instance            = std::make_unique<hotkey_service>();
+				    matchmaking_service_instance       = std::make_unique<matchmaking_service>();
+				    api_service_instance               = std::make_unique<api_service>();
+				    tunables_service_instance          = std::make_unique<tunables_service>();
+				    script_connection_service_instance = std::make_unique<script_connection_service>();
+				    xml_vehicles_service_instance      = std::make_unique<xml_vehicles_service>();
+				    xml_maps_service_instance          = std::make_unique<xml_map_service>();
+				    entity_snapshot_service_instance   = std::make_unique<entity_snapshot_service>();
+				    LOG(INFO) << "Registered service instances...";
+
+				    g_notification_service.initialise();
+				    LOG(INFO) << "Finished initialising services.";
+			    });
+
+			    // the gui and the scripts only start running once hooking is enabled, by then every step is done
+			    startup.run();
+
+			    // the packs on disk are in use until the remote ones have been checked
+			    g_translation_service.update_in_background();
 
 			    g_script_mgr.add_script(std::make_unique<script>(&gui::script_func, "GUI", false));
 
@@ -267,6 +324,8 @@ BOOL APIENTRY DllMain(HMODULE hmod, DWORD reason, PVOID)
 				    std::this_thread::sleep_for(500ms);
 			    }
 
+			    g.flush();
+
 			    g_script_mgr.remove_all_scripts();
 			    LOG(INFO) << "Scripts unregistered.";
 
@@ -316,6 +375,8 @@ BOOL APIENTRY DllMain(HMODULE hmod, DWORD reason, PVOID)
 			    LOG(INFO) << "Context Service reset.";
 			    xml_vehicles_service_instance.reset();
 			    LOG(INFO) << "Xml Vehicles Service reset.";
+			    entity_snapshot_service_instance.reset();
+			    LOG(INFO) << "Entity Snapshot Service reset.";
 			    LOG(INFO) << "Services uninitialized.";
 
 			    hooking_instance.reset();
@@ -1,27 +1,49 @@
 #pragma once
+#include "packed_pattern.hpp"
 #include "pattern.hpp"
+#include "pattern_batch.hpp"
 #include "range.hpp"
 #include "signature.hpp"
 
-#include <future>
+#include <thread>
+#include <unordered_map>
 
 namespace memory
 {
-	template<size_t N>
+	template<size_t N, size_t L>
 	struct batch
 	{
 		std::array<signature, N> m_entries;
+		// the ida strings of m_entries, parsed at compile time
+		std::array<packed_pattern<L>, N> m_patterns;
+		// hash of the name and ida string of each entry, identifies the entry in the pointers cache
+		std::array<uint32_t, N> m_hashes;
 
-		constexpr batch(std::array<signature, N> entries)
+		constexpr batch(std::array<signature, N> entries, std::array<packed_pattern<L>, N> patterns, std::array<uint32_t, N> hashes)
 		{
-			m_entries = entries;
+			m_entries  = entries;
+			m_patterns = patterns;
+			m_hashes   = hashes;
 		}
 	};
 
-	template<size_t N>
+	// what the pointers cache remembers about a match of a batch entry
+	struct batch_cache_entry
+	{
+		static constexpr size_t window_size = 32;
+
+		uint32_t m_hash;
+		uint32_t m_window_size;
+		// offset of the match from the beginning of the scanned region
+		uint64_t m_offset;
+		// bytes found at the match, wildcards included, the ones past the signature single out the match when it moved
+		std::array<uint8_t, window_size> m_window;
+	};
+
+	template<size_t N, size_t L>
 	struct batch_and_hash
 	{
-		batch<N> m_batch;
+		batch<N, L> m_batch;
 		uint32_t m_hash;
 	};
 
@@ -61,42 +83,123 @@ namespace memory
 	static inline constexpr auto make_batch(uint32_t hash = signature_hasher::FNV_OFFSET_32)
 	{
 		constexpr std::array<signature, sizeof...(args)> a1 = {args...};
+		constexpr size_t longest_pattern = std::max({ida_length(args.m_ida)...});
+		constexpr std::array<packed_pattern<longest_pattern>, sizeof...(args)> a2 = {parse_ida<longest_pattern>(args.m_ida)...};
+		constexpr std::array<uint32_t, sizeof...(args)> a3 = {signature_hasher::fnv1a_32(args.m_ida, signature_hasher::fnv1a_32(args.m_name))...};
 
-		constexpr memory::batch<a1.size()> h(a1);
+		constexpr memory::batch<a1.size(), longest_pattern> h(a1, a2, a3);
 
-		return batch_and_hash<a1.size()>{h, signature_hasher::add<args...>()};
+		return batch_and_hash<a1.size(), longest_pattern>{h, signature_hasher::add<args...>()};
 	}
 
 	struct batch_runner
 	{
+		// the whole batch is resolved in a single pass over the region, split across this many threads
+		static inline const std::size_t s_worker_count = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+		// how far from its cached offset a signature is searched for before falling back to the full pass
+		static inline constexpr std::size_t s_local_scan_radius = 0x400000;
+		// when more than one in this many signatures moved, the windows would cover about as much as the full pass
+		static inline constexpr std::size_t s_local_scan_max_share = 8;
+
 		inline static std::mutex s_entry_mutex;
-		inline static std::vector<std::future<bool>> g_futures;
 
-		template<size_t N>
-		inline static bool run(const memory::batch<N> batch, range region)
+		/**
+		 * @brief Resolves every entry of the batch and executes their callbacks.
+		 *
+		 * Entries found in the cache are first checked at their cached offset, then searched for around it
+		 * in a single batch pass over the merged windows, unless too many of them moved.
+		 * Only the entries that couldn't be found that way are part of the full pass over the region.
+		 *
+		 * @param cache Matches of a previous run, replaced with the matches of this run.
+		 * @return true if every entry was found.
+		 */
+		template<size_t N, size_t L>
+		inline static bool run(const memory::batch<N, L>& batch, range region, std::vector<batch_cache_entry>& cache)
 		{
-			for (auto& entry : batch.m_entries)
+			std::unordered_map<uint32_t, const batch_cache_entry*> cached_entries;
+			for (const auto& entry : cache)
 			{
-				g_futures.emplace_back(std::async(&scan_pattern_and_execute_callback, region, entry));
+				cached_entries.emplace(entry.m_hash, &entry);
 			}
 
-			bool found_all_patterns = true;
-			for (auto& future : g_futures)
+			std::vector<std::optional<handle>> results(N);
+			std::vector<pattern_view> patterns;
+			std::vector<size_t> pattern_indices;
+			std::vector<moved_entry> moved;
+			size_t verified = 0, relocated = 0;
+			for (size_t i = 0; i < N; i++)
 			{
-				future.wait();
+				const auto sig = batch.m_patterns[i].view();
 
-				if (!future.get())
-					found_all_patterns = false;
+				if (const auto it = cached_entries.find(batch.m_hashes[i]); it != cached_entries.end())
+				{
+					const auto& entry = *it->second;
+					if (verify_cached(region, sig, entry))
+					{
+						results[i] = region.begin().add(entry.m_offset);
+						verified++;
+						continue;
+					}
+
+					if (entry.m_offset < region.size())
+					{
+						const auto begin = entry.m_offset > s_local_scan_radius ? entry.m_offset - s_local_scan_radius : 0;
+						const auto end   = std::min(entry.m_offset + s_local_scan_radius, region.size());
+						moved.push_back({i, sig, begin, end, &entry});
+						continue;
+					}
+				}
+
+				patterns.push_back(sig);
+				pattern_indices.push_back(i);
+			}
+
+			if (!moved.empty() && moved.size() * s_local_scan_max_share <= N)
+			{
+				relocated = scan_near(region, moved, results);
 			}
 
-			g_futures.clear();
+			for (const auto& entry : moved)
+			{
+				if (!results[entry.m_index])
+				{
+					patterns.push_back(entry.m_sig);
+					pattern_indices.push_back(entry.m_index);
+				}
+			}
+
+			if (!patterns.empty())
+			{
+				const auto pattern_count = patterns.size();
+				const auto scanned       = pattern_batch(std::move(patterns)).scan(region, s_worker_count);
+				for (size_t i = 0; i < pattern_count; i++)
+				{
+					results[pattern_indices[i]] = scanned[i];
+				}
+			}
+
+			LOG(INFO) << verified << " signatures found at their cached offset, " << relocated << " near it and "
+			          << pattern_indices.size() << " had to be scanned for.";
+
+			bool found_all_patterns = true;
+			cache.clear();
+			for (size_t i = 0; i < N; i++)
+			{
+				if (!execute_callback(region, batch.m_entries[i], results[i]))
+				{
+					found_all_patterns = false;
+					continue;
+				}
+
+				cache.push_back(make_cache_entry(region, batch.m_hashes[i], *results[i]));
+			}
 
 			return found_all_patterns;
 		}
 
-		inline static bool scan_pattern_and_execute_callback(range region, signature entry)
+		inline static bool execute_callback(range region, signature entry, std::optional<handle> result)
 		{
-			if (auto result = region.scan(entry.m_ida); result.has_value())
+			if (result.has_value())
 			{
 				if (entry.m_on_signature_found)
 				{
@@ -114,5 +217,144 @@ namespace memory
 
 			return false;
 		}
+
+	private:
+		// a cached entry that doesn't match at its cached offset anymore, and the window it is searched for in
+		struct moved_entry
+		{
+			size_t m_index;
+			pattern_view m_sig;
+			size_t m_begin;
+			size_t m_end;
+			const batch_cache_entry* m_cached;
+		};
+
+		// the signature followed by the bytes that came after it in the cached window
+		struct extended_pattern
+		{
+			std::array<uint8_t, batch_cache_entry::window_size> m_value;
+			std::array<uint8_t, batch_cache_entry::window_size> m_mask;
+			size_t m_length;
+
+			pattern_view view() const
+			{
+				return {m_value.data(), m_mask.data(), m_length, find_anchors(m_value.data(), m_mask.data(), m_length)};
+			}
+		};
+
+		inline static std::optional<extended_pattern> extend(pattern_view sig, const batch_cache_entry& cached)
+		{
+			if (cached.m_window_size <= sig.m_length)
+				return std::nullopt;
+
+			extended_pattern pattern{};
+			pattern.m_length = cached.m_window_size;
+			for (size_t i = 0; i < pattern.m_length; i++)
+			{
+				pattern.m_mask[i]  = i < sig.m_length ? sig.m_mask[i] : 0xFF;
+				pattern.m_value[i] = i < sig.m_length ? sig.m_value[i] : cached.m_window[i];
+			}
+
+			return pattern;
+		}
+
+		inline static bool verify_cached(range region, pattern_view sig, const batch_cache_entry& entry)
+		{
+			return entry.m_offset + sig.m_length <= region.size() && sig.matches(region.begin().add(entry.m_offset).as<const uint8_t*>());
+		}
+
+		/**
+		 * @brief Searches the signatures that moved around their cached offset, with one batch pass per group of overlapping windows.
+		 *
+		 * A signature is also searched for followed by the bytes that came after it in its cached window, that match is
+		 * preferred as it is the same code that just moved. Otherwise the first match within the window of the signature
+		 * is taken, for signatures that aren't unique it can differ from the first match a scan without cache would find.
+		 *
+		 * @return The amount of signatures found.
+		 */
+		inline static size_t scan_near(range region, std::vector<moved_entry>& moved, std::vector<std::optional<handle>>& results)
+		{
+			std::sort(moved.begin(), moved.end(), [](const moved_entry& a, const moved_entry& b) {
+				return a.m_begin < b.m_begin;
+			});
+
+			size_t found = 0;
+			for (size_t group_begin = 0; group_begin < moved.size();)
+			{
+				auto group_end  = group_begin + 1;
+				auto window_end   = moved[group_begin].m_end;
+				while (group_end < moved.size() && moved[group_end].m_begin <= window_end)
+				{
+					window_end = std::max(window_end, moved[group_end].m_end);
+					group_end++;
+				}
+
+				const auto window_begin = moved[group_begin].m_begin;
+				const auto group_size   = group_end - group_begin;
+
+				// the signatures come first, followed by the extended patterns of those that have one
+				std::vector<extended_pattern> extended;
+				std::vector<std::optional<size_t>> extended_slots(group_size);
+				for (auto i = group_begin; i < group_end; i++)
+				{
+					if (auto pattern = extend(moved[i].m_sig, *moved[i].m_cached))
+					{
+						extended_slots[i - group_begin] = group_size + extended.size();
+						extended.push_back(*pattern);
+					}
+				}
+
+				std::vector<pattern_view> patterns;
+				for (auto i = group_begin; i < group_end; i++)
+				{
+					patterns.push_back(moved[i].m_sig);
+				}
+				for (const auto& pattern : extended)
+				{
+					patterns.push_back(pattern.view());
+				}
+
+				const auto window  = range(region.begin().add(window_begin), window_end - window_begin);
+				const auto matches = pattern_batch(std::move(patterns)).scan(window, s_worker_count);
+				for (auto i = group_begin; i < group_end; i++)
+				{
+					// the merged window can be larger than the one of the signature
+					const auto in_window = [&region, &entry = moved[i]](const std::optional<handle>& match) {
+						if (!match)
+							return false;
+
+						const auto offset = match->as<uintptr_t>() - region.begin().as<uintptr_t>();
+						return offset >= entry.m_begin && offset < entry.m_end;
+					};
+
+					const auto extended_slot = extended_slots[i - group_begin];
+					if (extended_slot && in_window(matches[*extended_slot]))
+					{
+						results[moved[i].m_index] = matches[*extended_slot];
+						found++;
+					}
+					else if (in_window(matches[i - group_begin]))
+					{
+						results[moved[i].m_index] = matches[i - group_begin];
+						found++;
+					}
+				}
+
+				group_begin = group_end;
+			}
+
+			return found;
+		}
+
+		inline static batch_cache_entry make_cache_entry(range region, uint32_t hash, handle match)
+		{
+			batch_cache_entry entry{};
+			entry.m_hash        = hash;
+			entry.m_offset      = match.as<uintptr_t>() - region.begin().as<uintptr_t>();
+			entry.m_window_size = static_cast<uint32_t>(std::min(batch_cache_entry::window_size, region.size() - entry.m_offset));
+			memcpy(entry.m_window.data(), match.as<const uint8_t*>(), entry.m_window_size);
+
+			return entry;
+		}
 	};
 }
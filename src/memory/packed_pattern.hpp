@@ -0,0 +1,204 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace memory
+{
+	constexpr std::size_t no_anchor = static_cast<std::size_t>(-1);
+
+	// rough estimate of how often a byte shows up in x64 code, the lower the better as a scan anchor
+	constexpr int byte_weight(std::uint8_t byte)
+	{
+		switch (byte)
+		{
+		case 0x00:
+		case 0xCC:
+		case 0xFF: return 4;
+		case 0x48:
+		case 0x8B:
+		case 0x89:
+		case 0x0F: return 3;
+		case 0x4C:
+		case 0x24:
+		case 0x83:
+		case 0x8D:
+		case 0xE8:
+		case 0x90:
+		case 0xC0:
+		case 0x44:
+		case 0x01: return 2;
+		default: return 0;
+		}
+	}
+
+	struct pattern_anchors
+	{
+		// offsets of the two least common concrete bytes, used by the single pattern scanners
+		std::size_t m_first  = no_anchor;
+		std::size_t m_second = no_anchor;
+		// offset of the least common pair of consecutive concrete bytes, used by pattern_batch
+		std::size_t m_pair = no_anchor;
+	};
+
+	constexpr pattern_anchors find_anchors(const std::uint8_t* value, const std::uint8_t* mask, std::size_t length)
+	{
+		pattern_anchors anchors{};
+
+		for (std::size_t i = 0; i < length; i++)
+		{
+			if (!mask[i])
+				continue;
+
+			const auto weight = byte_weight(value[i]);
+			if (anchors.m_first == no_anchor || weight < byte_weight(value[anchors.m_first]))
+			{
+				anchors.m_second = anchors.m_first;
+				anchors.m_first  = i;
+			}
+			else if (anchors.m_second == no_anchor || weight < byte_weight(value[anchors.m_second]))
+			{
+				anchors.m_second = i;
+			}
+		}
+
+		if (anchors.m_second == no_anchor)
+			anchors.m_second = anchors.m_first;
+
+		int best_pair_weight = 0;
+		for (std::size_t i = 0; i + 1 < length; i++)
+		{
+			if (!mask[i] || !mask[i + 1])
+				continue;
+
+			const auto weight = byte_weight(value[i]) + byte_weight(value[i + 1]);
+			if (anchors.m_pair == no_anchor || weight < best_pair_weight)
+			{
+				best_pair_weight = weight;
+				anchors.m_pair   = i;
+			}
+		}
+
+		return anchors;
+	}
+
+	/**
+	 * @brief Non-owning mask/value form of a pattern, a byte matches when (byte & mask) == value.
+	 */
+	struct pattern_view
+	{
+		const std::uint8_t* m_value;
+		const std::uint8_t* m_mask;
+		std::size_t m_length;
+		pattern_anchors m_anchors;
+
+		bool has_anchor() const
+		{
+			return m_anchors.m_first != no_anchor;
+		}
+
+		bool matches(const std::uint8_t* target) const
+		{
+			for (std::size_t i = 0; i < m_length; i++)
+			{
+				if ((target[i] & m_mask[i]) != m_value[i])
+					return false;
+			}
+
+			return true;
+		}
+	};
+
+	/**
+	 * @brief A pattern parsed at compile time into fixed size arrays, see parse_ida.
+	 *
+	 * @tparam L Capacity in bytes, the batch uses the length of its longest signature.
+	 */
+	template<std::size_t L>
+	struct packed_pattern
+	{
+		std::array<std::uint8_t, L> m_value{};
+		std::array<std::uint8_t, L> m_mask{};
+		std::size_t m_length{};
+		pattern_anchors m_anchors{};
+
+		constexpr pattern_view view() const
+		{
+			return {m_value.data(), m_mask.data(), m_length, m_anchors};
+		}
+	};
+
+	namespace detail
+	{
+		consteval std::uint8_t hex_digit(char c)
+		{
+			if (c >= '0' && c <= '9')
+				return static_cast<std::uint8_t>(c - '0');
+			if (c >= 'a' && c <= 'f')
+				return static_cast<std::uint8_t>(c - 'a' + 0xA);
+			if (c >= 'A' && c <= 'F')
+				return static_cast<std::uint8_t>(c - 'A' + 0xA);
+
+			throw std::invalid_argument("Invalid character in IDA signature.");
+		}
+
+		// calls func(index, byte, is_wildcard) for each byte of the signature, trailing wildcards are dropped
+		template<typename F>
+		consteval std::size_t for_each_ida_byte(const char* ida, F&& func)
+		{
+			std::size_t length = 0, length_without_trailing_wildcards = 0;
+			for (std::size_t i = 0; ida[i] != '\0';)
+			{
+				if (ida[i] == ' ')
+				{
+					i++;
+					continue;
+				}
+
+				if (ida[i] == '?')
+				{
+					func(length++, 0, true);
+					i += ida[i + 1] == '?' ? 2 : 1;
+					continue;
+				}
+
+				if (ida[i + 1] == '\0' || ida[i + 1] == ' ')
+					throw std::invalid_argument("IDA signature bytes must be two hex digits.");
+
+				func(length++, static_cast<std::uint8_t>(hex_digit(ida[i]) * 0x10 + hex_digit(ida[i + 1])), false);
+				length_without_trailing_wildcards = length;
+				i += 2;
+			}
+
+			return length_without_trailing_wildcards;
+		}
+	}
+
+	consteval std::size_t ida_length(const char* ida)
+	{
+		return detail::for_each_ida_byte(ida, [](std::size_t, std::uint8_t, bool) {
+		});
+	}
+
+	template<std::size_t L>
+	consteval packed_pattern<L> parse_ida(const char* ida)
+	{
+		packed_pattern<L> result{};
+
+		result.m_length = detail::for_each_ida_byte(ida, [&result](std::size_t i, std::uint8_t byte, bool wildcard) {
+			if (i >= L)
+				return;
+
+			result.m_value[i] = wildcard ? 0 : byte;
+			result.m_mask[i]  = wildcard ? 0 : 0xFF;
+		});
+
+		if (result.m_length > L)
+			throw std::invalid_argument("IDA signature doesn't fit in the packed pattern.");
+
+		result.m_anchors = find_anchors(result.m_value.data(), result.m_mask.data(), result.m_length);
+
+		return result;
+	}
+}
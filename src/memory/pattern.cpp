@@ -57,5 +57,19 @@ namespace memory
 				m_bytes.push_back({});
 			}
 		}
+
+		m_value.resize(m_bytes.size());
+		m_mask.resize(m_bytes.size());
+		for (size_t i = 0; i != m_bytes.size(); ++i)
+		{
+			m_value[i] = m_bytes[i].value_or(0);
+			m_mask[i]  = m_bytes[i] ? 0xFF : 0;
+		}
+		m_anchors = find_anchors(m_value.data(), m_mask.data(), m_bytes.size());
+	}
+
+	pattern_view pattern::view() const
+	{
+		return {m_value.data(), m_mask.data(), m_bytes.size(), m_anchors};
 	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "fwddec.hpp"
 #include "handle.hpp"
+#include "packed_pattern.hpp"
 
 #include <cstdint>
 #include <optional>
@@ -22,6 +23,13 @@ namespace memory
 		{
 		}
 
+		pattern_view view() const;
+
 		std::vector<std::optional<uint8_t>> m_bytes;
+
+	private:
+		std::vector<uint8_t> m_value;
+		std::vector<uint8_t> m_mask;
+		pattern_anchors m_anchors;
 	};
 }
@@ -0,0 +1,144 @@
+#include "pattern_batch.hpp"
+
+#include "../common.hpp"
+#include "range.hpp"
+
+#include <future>
+
+namespace memory
+{
+	// amount of bytes handed to a worker at once, small enough to balance the load between workers
+	// and big enough that the overlap between two chunks doesn't matter
+	constexpr std::size_t chunk_size = 0x100000;
+
+	constexpr std::size_t not_found = static_cast<std::size_t>(-1);
+
+	static std::uint16_t read_key(const std::uint8_t* data)
+	{
+		return static_cast<std::uint16_t>(data[0] | (data[1] << 8));
+	}
+
+	pattern_batch::pattern_batch(std::vector<pattern_view> patterns) :
+	    m_patterns(std::move(patterns)),
+	    m_bucket_begin(0x10000 + 1)
+	{
+		std::vector<std::pair<std::uint16_t, anchor>> keyed_anchors;
+		keyed_anchors.reserve(m_patterns.size());
+
+		for (std::size_t i = 0; i < m_patterns.size(); i++)
+		{
+			const auto& sig   = m_patterns[i];
+			const auto offset = sig.m_anchors.m_pair;
+
+			if (offset == no_anchor)
+			{
+				m_unanchored.push_back(i);
+				continue;
+			}
+
+			const auto key = static_cast<std::uint16_t>(sig.m_value[offset] | (sig.m_value[offset + 1] << 8));
+			keyed_anchors.emplace_back(key, anchor{static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(offset)});
+
+			m_max_anchor_offset = std::max(m_max_anchor_offset, offset);
+		}
+
+		std::stable_sort(keyed_anchors.begin(), keyed_anchors.end(), [](const auto& a, const auto& b) {
+			return a.first < b.first;
+		});
+
+		m_anchors.reserve(keyed_anchors.size());
+		for (const auto& [key, entry] : keyed_anchors)
+		{
+			m_anchors.push_back(entry);
+			m_bucket_begin[key + 1]++;
+			m_bucket_filter[key / 64] |= 1ull << (key % 64);
+		}
+
+		for (std::size_t key = 0; key < 0x10000; key++)
+			m_bucket_begin[key + 1] += m_bucket_begin[key];
+	}
+
+	std::size_t pattern_batch::size() const
+	{
+		return m_patterns.size();
+	}
+
+	void pattern_batch::scan_chunk(const std::uint8_t* data, std::size_t data_size, std::size_t chunk_begin, std::size_t chunk_end, std::vector<std::size_t>& results) const
+	{
+		// the anchor of a match starting inside the chunk can lie past its end
+		const auto anchor_end = std::min(chunk_end + m_max_anchor_offset, data_size - 1);
+
+		for (std::size_t i = chunk_begin; i < anchor_end; i++)
+		{
+			const auto key = read_key(data + i);
+			if (!(m_bucket_filter[key / 64] & (1ull << (key % 64)))) [[likely]]
+				continue;
+
+			for (auto j = m_bucket_begin[key]; j != m_bucket_begin[key + 1]; j++)
+			{
+				const auto& candidate = m_anchors[j];
+				if (results[candidate.m_pattern_index] != not_found || candidate.m_offset > i)
+					continue;
+
+				const auto start = i - candidate.m_offset;
+				const auto& sig  = m_patterns[candidate.m_pattern_index];
+				if (start < chunk_begin || start >= chunk_end || start + sig.m_length > data_size)
+					continue;
+
+				if (sig.matches(data + start))
+					results[candidate.m_pattern_index] = start;
+			}
+		}
+	}
+
+	std::vector<std::optional<handle>> pattern_batch::scan(const range& region, std::size_t worker_count) const
+	{
+		const auto data      = region.begin().as<const std::uint8_t*>();
+		const auto data_size = region.size();
+
+		std::vector<std::size_t> lowest(m_patterns.size(), not_found);
+
+		if (!m_anchors.empty() && data_size >= 2)
+		{
+			const auto chunk_count = (data_size + chunk_size - 1) / chunk_size;
+			worker_count           = std::clamp<std::size_t>(worker_count, 1, chunk_count);
+
+			std::atomic<std::size_t> next_chunk = 0;
+			auto worker = [&] {
+				std::vector<std::size_t> results(m_patterns.size(), not_found);
+				for (auto chunk = next_chunk++; chunk < chunk_count; chunk = next_chunk++)
+				{
+					const auto chunk_begin = chunk * chunk_size;
+					scan_chunk(data, data_size, chunk_begin, std::min(chunk_begin + chunk_size, data_size), results);
+				}
+				return results;
+			};
+
+			std::vector<std::future<std::vector<std::size_t>>> workers;
+			workers.reserve(worker_count - 1);
+			for (std::size_t i = 1; i < worker_count; i++)
+				workers.emplace_back(std::async(std::launch::async, worker));
+
+			auto merge = [&lowest](const std::vector<std::size_t>& results) {
+				for (std::size_t i = 0; i < results.size(); i++)
+					lowest[i] = std::min(lowest[i], results[i]);
+			};
+
+			merge(worker());
+			for (auto& future : workers)
+				merge(future.get());
+		}
+
+		std::vector<std::optional<handle>> matches(m_patterns.size());
+		for (std::size_t i = 0; i < m_patterns.size(); i++)
+		{
+			if (lowest[i] != not_found)
+				matches[i] = region.begin().add(lowest[i]);
+		}
+
+		for (const auto i : m_unanchored)
+			matches[i] = region.scan(m_patterns[i]);
+
+		return matches;
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "fwddec.hpp"
+#include "handle.hpp"
+#include "packed_pattern.hpp"
+
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace memory
+{
+	/**
+	 * @brief Compiles a set of patterns into a single prefix index so that all of them
+	 * can be located in one pass over a memory range instead of one pass per pattern.
+	 *
+	 * Every pattern is indexed by its least common pair of consecutive concrete bytes (pattern_anchors::m_pair).
+	 * While walking the range, the two bytes at each position select a bucket of candidate
+	 * patterns which are then verified in place.
+	 */
+	class pattern_batch
+	{
+	public:
+		// the memory the views point to has to outlive the pattern_batch
+		explicit pattern_batch(std::vector<pattern_view> patterns);
+
+		/**
+		 * @brief Scans the region once for every pattern of the batch.
+		 *
+		 * @param region Memory range to scan.
+		 * @param worker_count Amount of threads the range is split across.
+		 * @return The first match of each pattern, in the order the patterns were given.
+		 */
+		std::vector<std::optional<handle>> scan(const range& region, std::size_t worker_count) const;
+
+		std::size_t size() const;
+
+	private:
+		struct anchor
+		{
+			std::uint32_t m_pattern_index;
+			std::uint32_t m_offset;
+		};
+
+		void scan_chunk(const std::uint8_t* data, std::size_t data_size, std::size_t chunk_begin, std::size_t chunk_end, std::vector<std::size_t>& results) const;
+
+		std::vector<pattern_view> m_patterns;
+
+		// anchors grouped by their 16 bit key, m_bucket_begin[key] .. m_bucket_begin[key + 1] indexes into m_anchors
+		std::vector<anchor> m_anchors;
+		std::vector<std::uint32_t> m_bucket_begin;
+		// one bit per key, lets the hot loop reject empty buckets without touching m_bucket_begin
+		std::array<std::uint64_t, 0x10000 / 64> m_bucket_filter{};
+
+		// patterns without two consecutive concrete bytes, these are scanned on their own
+		std::vector<std::size_t> m_unanchored;
+
+		std::size_t m_max_anchor_offset{};
+	};
+}
@@ -3,6 +3,10 @@
 #include "../common.hpp"
 #include "pattern.hpp"
 
+#include <bit>
+#include <immintrin.h>
+#include <intrin.h>
+
 namespace memory
 {
 	range::range(handle base, std::size_t size) :
@@ -33,8 +37,9 @@ namespace memory
 
 	// https://en.wikipedia.org/wiki/Boyer%E2%80%93Moore%E2%80%93Horspool_algorithm
 	// https://www.youtube.com/watch?v=AuZUeshhy-s
-	std::optional<handle> scan_pattern(const std::optional<uint8_t>* sig, std::size_t length, handle begin, std::size_t module_size)
+	std::optional<handle> scan_pattern(const pattern_view& sig, handle begin, std::size_t module_size)
 	{
+		const auto length    = sig.m_length;
 		std::size_t maxShift = length;
 		std::size_t max_idx  = length - 1;
 
@@ -42,7 +47,7 @@ namespace memory
 		std::size_t wild_card_idx{static_cast<size_t>(-1)};
 		for (int i{static_cast<int>(max_idx - 1)}; i >= 0; --i)
 		{
-			if (!sig[i])
+			if (!sig.m_mask[i])
 			{
 				maxShift      = max_idx - i;
 				wild_card_idx = i;
@@ -60,7 +65,7 @@ namespace memory
 		//Fill shift table with sig bytes
 		for (std::size_t i{wild_card_idx + 1}; i != max_idx; ++i)
 		{
-			shift_table[*sig[i]] = max_idx - i;
+			shift_table[sig.m_value[i]] = max_idx - i;
 		}
 
 		//Loop data
@@ -69,7 +74,7 @@ namespace memory
 		{
 			for (std::ptrdiff_t sig_idx{(std::ptrdiff_t)max_idx}; sig_idx >= 0; --sig_idx)
 			{
-				if (sig[sig_idx] && *begin.add(current_idx + sig_idx).as<uint8_t*>() != *sig[sig_idx])
+				if ((*begin.add(current_idx + sig_idx).as<uint8_t*>() & sig.m_mask[sig_idx]) != sig.m_value[sig_idx])
 				{
 					current_idx += shift_table[*begin.add(current_idx + max_idx).as<uint8_t*>()];
 					break;
@@ -83,42 +88,169 @@ namespace memory
 		return std::nullopt;
 	}
 
-	std::optional<handle> range::scan(pattern const& sig) const
+	constexpr std::size_t simd_not_found = static_cast<std::size_t>(-1);
+
+	// returns the offset of the first match at or after from
+	static std::size_t find_sse2(const uint8_t* data, std::size_t size, const pattern_view& sig, std::size_t from)
 	{
-		auto data   = sig.m_bytes.data();
-		auto length = sig.m_bytes.size();
+		const auto last_start = size - sig.m_length;
+		const auto first      = _mm_set1_epi8(static_cast<char>(sig.m_value[sig.m_anchors.m_first]));
+		const auto second     = _mm_set1_epi8(static_cast<char>(sig.m_value[sig.m_anchors.m_second]));
 
-		if (auto result = scan_pattern(data, length, m_base, m_size); result)
+		std::size_t i = from;
+		for (; i + 16 <= last_start + 1; i += 16)
 		{
-			return result;
+			const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + sig.m_anchors.m_first));
+			const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + sig.m_anchors.m_second));
+
+			auto candidates = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, second))));
+			while (candidates)
+			{
+				const auto candidate = i + std::countr_zero(candidates);
+				if (sig.matches(data + candidate))
+					return candidate;
+
+				candidates &= candidates - 1;
+			}
 		}
 
-		return std::nullopt;
+		for (; i <= last_start; i++)
+		{
+			if (sig.matches(data + i))
+				return i;
+		}
+
+		return simd_not_found;
 	}
 
-	bool pattern_matches(uint8_t* target, const std::optional<uint8_t>* sig, std::size_t length)
+	static std::size_t find_avx2(const uint8_t* data, std::size_t size, const pattern_view& sig, std::size_t from)
 	{
-		for (std::size_t i{}; i != length; ++i)
+		const auto last_start = size - sig.m_length;
+		const auto first      = _mm256_set1_epi8(static_cast<char>(sig.m_value[sig.m_anchors.m_first]));
+		const auto second     = _mm256_set1_epi8(static_cast<char>(sig.m_value[sig.m_anchors.m_second]));
+
+		std::size_t i = from;
+		for (; i + 32 <= last_start + 1; i += 32)
 		{
-			if (sig[i] && *sig[i] != target[i])
+			const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + sig.m_anchors.m_first));
+			const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + sig.m_anchors.m_second));
+
+			auto candidates = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, second))));
+			while (candidates)
+			{
+				const auto candidate = i + std::countr_zero(candidates);
+				if (sig.matches(data + candidate))
+					return candidate;
+
+				candidates &= candidates - 1;
+			}
+		}
+
+		return find_sse2(data, size, sig, i);
+	}
+
+	static bool cpu_supports_avx2()
+	{
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return false;
+
+		// AVX has to be supported by the cpu and its registers saved by the OS
+		__cpuid(info, 1);
+		if (!(info[2] & (1 << 27)) || !(info[2] & (1 << 28)))
+			return false;
+		if ((_xgetbv(0) & 6) != 6)
+			return false;
+
+		__cpuidex(info, 7, 0);
+		return info[1] & (1 << 5);
+	}
+
+	static bool cpu_supports_sse2()
+	{
+		int info[4];
+		__cpuid(info, 1);
+		return info[3] & (1 << 26);
+	}
+
+	using simd_find_t = std::size_t (*)(const uint8_t* data, std::size_t size, const pattern_view& sig, std::size_t from);
+
+	// nullptr when the cpu has no usable vector extension, the scalar scanners are used in that case
+	static simd_find_t get_simd_kernel()
+	{
+		static const simd_find_t kernel = []() -> simd_find_t {
+			if (cpu_supports_avx2())
 			{
-				return false;
+				LOG(VERBOSE) << "Using AVX2 pattern scanner.";
+				return &find_avx2;
 			}
+			if (cpu_supports_sse2())
+			{
+				LOG(VERBOSE) << "Using SSE2 pattern scanner.";
+				return &find_sse2;
+			}
+
+			LOG(VERBOSE) << "Using scalar pattern scanner.";
+			return nullptr;
+		}();
+
+		return kernel;
+	}
+
+	std::optional<handle> range::scan(pattern const& sig) const
+	{
+		return scan(sig.view());
+	}
+
+	std::optional<handle> range::scan(pattern_view sig) const
+	{
+		if (sig.m_length == 0 || sig.m_length > m_size)
+			return std::nullopt;
+
+		if (const auto kernel = get_simd_kernel(); kernel && sig.has_anchor())
+		{
+			if (const auto offset = kernel(m_base.as<const uint8_t*>(), m_size, sig, 0); offset != simd_not_found)
+				return m_base.add(offset);
+
+			return std::nullopt;
 		}
 
-		return true;
+		if (auto result = scan_pattern(sig, m_base, m_size); result)
+		{
+			return result;
+		}
+
+		return std::nullopt;
 	}
 
 	std::vector<handle> range::scan_all(pattern const& sig) const
+	{
+		return scan_all(sig.view());
+	}
+
+	std::vector<handle> range::scan_all(pattern_view sig) const
 	{
 		std::vector<handle> result{};
-		auto data   = sig.m_bytes.data();
-		auto length = sig.m_bytes.size();
 
-		const auto scan_end = m_size - length;
+		if (sig.m_length == 0 || sig.m_length > m_size)
+			return result;
+
+		if (const auto kernel = get_simd_kernel(); kernel && sig.has_anchor())
+		{
+			for (auto offset = kernel(m_base.as<const uint8_t*>(), m_size, sig, 0); offset != simd_not_found;
+			     offset      = kernel(m_base.as<const uint8_t*>(), m_size, sig, offset + 1))
+			{
+				result.push_back(m_base.add(offset));
+			}
+
+			return result;
+		}
+
+		const auto scan_end = m_size - sig.m_length;
 		for (std::uintptr_t i{}; i != scan_end; ++i)
 		{
-			if (pattern_matches(m_base.add(i).as<uint8_t*>(), data, length))
+			if (sig.matches(m_base.add(i).as<uint8_t*>()))
 			{
 				result.push_back(m_base.add(i));
 			}
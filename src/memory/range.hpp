@@ -1,6 +1,7 @@
 #pragma once
 #include "fwddec.hpp"
 #include "handle.hpp"
+#include "packed_pattern.hpp"
 
 #include <vector>
 
@@ -18,7 +19,9 @@ namespace memory
 		bool contains(handle h) const;
 
 		std::optional<handle> scan(pattern const& sig) const;
+		std::optional<handle> scan(pattern_view sig) const;
 		std::vector<handle> scan_all(pattern const& sig) const;
+		std::vector<handle> scan_all(pattern_view sig) const;
 
 	protected:
 		handle m_base;
@@ -1,8 +1,5 @@
 #include "pointers.hpp"
 
-#include "gta_pointers_layout_info.hpp"
-#include "sc_pointers_layout_info.hpp"
-
 #define GTA_VERSION_TARGET "1.69-3337"
 
 namespace big
@@ -2063,40 +2060,6 @@ namespace big
 		return batch_and_hash;
 	}
 
-	void pointers::load_pointers_from_cache(const cache_file& cache_file, const uintptr_t pointer_to_cacheable_data_start, const memory::module& mem_region)
-	{
-		// fill pointers instance fields by reading the file data into it
-
-		LOG(INFO) << "Loading pointers instance from cache";
-
-		// multiple things here:
-		// - iterate each cacheable field of the pointers instance
-		// - add the base module address to the current offset retrieved from the cache
-		// - assign that ptr to the pointers field
-		uintptr_t* cache_data = reinterpret_cast<uintptr_t*>(cache_file.data());
-
-		const size_t field_count_from_cache = cache_file.data_size() / sizeof(uintptr_t);
-		LOG(INFO) << "Pointers cache: Loading " << field_count_from_cache << " fields from the cache";
-
-		uintptr_t* field_ptr = reinterpret_cast<uintptr_t*>(pointer_to_cacheable_data_start);
-		for (size_t i = 0; i < field_count_from_cache; i++)
-		{
-			uintptr_t offset = cache_data[i];
-			uintptr_t ptr    = offset + mem_region.begin().as<uintptr_t>();
-
-			if (mem_region.contains(memory::handle(ptr)))
-			{
-				*field_ptr = ptr;
-			}
-			else
-			{
-				LOG(FATAL) << "Just tried to load from cache a pointer supposedly within the gta 5 module range but isn't! Offset from start of pointers instance: " << (reinterpret_cast<uintptr_t>(field_ptr) - reinterpret_cast<uintptr_t>(this));
-			}
-
-			field_ptr++;
-		}
-	}
-
 	pointers::pointers() :
 	    m_gta_pointers_cache(g_file_manager.get_project_file("./cache/gta_pointers.bin")),
 	    m_sc_pointers_cache(g_file_manager.get_project_file("./cache/sc_pointers.bin")),
@@ -2108,22 +2071,14 @@ namespace big
 
 		constexpr auto gta_batch_and_hash = pointers::get_gta_batch();
 		constexpr cstxpr_str gta_batch_name{"GTA5"};
-		write_to_cache_or_read_from_cache<gta_batch_name,
-		    gta_batch_and_hash.m_hash,
-		    gta_pointers_layout_info::offset_of_cache_begin_field,
-		    gta_pointers_layout_info::offset_of_cache_end_field,
-		    gta_batch_and_hash.m_batch>(m_gta_pointers_cache, mem_region);
+		run_batch_with_cache<gta_batch_name, gta_batch_and_hash.m_batch>(m_gta_pointers_cache, mem_region);
 
 		auto sc_module = memory::module("socialclub.dll");
 		if (sc_module.wait_for_module())
 		{
 			constexpr auto sc_batch_and_hash = pointers::get_sc_batch();
 			constexpr cstxpr_str sc_batch_name{"Social Club"};
-			write_to_cache_or_read_from_cache<sc_batch_name,
-			    sc_batch_and_hash.m_hash,
-			    sc_pointers_layout_info::offset_of_cache_begin_field,
-			    sc_pointers_layout_info::offset_of_cache_end_field,
-			    sc_batch_and_hash.m_batch>(m_sc_pointers_cache, sc_module);
+			run_batch_with_cache<sc_batch_name, sc_batch_and_hash.m_batch>(m_sc_pointers_cache, sc_module);
 		}
 		else
 			LOG(WARNING) << "socialclub.dll module was not loaded within the time limit.";
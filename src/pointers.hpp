@@ -16,96 +16,69 @@ namespace big
 	class pointers
 	{
 	private:
-		template<cstxpr_str batch_name, auto batch_hash, size_t offset_of_cache_begin_field, size_t offset_of_cache_end_field, memory::batch batch>
-		void write_to_cache_or_read_from_cache(cache_file& cache_file, const memory::module& mem_region)
-		{
-			static_assert(batch_hash > 0);
+		// bump this when changing the layout of memory::batch_cache_entry
+		static constexpr uint32_t pointers_cache_version = 2;
 
-			constexpr size_t field_count = (offset_of_cache_end_field - offset_of_cache_begin_field) / sizeof(void*);
-			constexpr auto cache_version = batch_hash + field_count;
+		template<cstxpr_str batch_name, memory::batch batch>
+		void run_batch_with_cache(cache_file& cache_file, const memory::module& mem_region)
+		{
+			cache_file.set_cache_version(pointers_cache_version);
 
-			cache_file.set_cache_version(cache_version);
+			auto cache                = load_pointers_cache<batch_name>(cache_file);
+			const auto previous_cache = cache;
 
-			const uintptr_t pointer_to_cacheable_data_start = reinterpret_cast<uintptr_t>(this) + offset_of_cache_begin_field;
+			run_batch<batch_name>(batch, mem_region, cache);
 
-			if (!is_pointers_cache_up_to_date<batch_name>(cache_file, mem_region))
+			const auto cache_changed = cache.size() != previous_cache.size()
+			    || memcmp(cache.data(), previous_cache.data(), cache.size() * sizeof(memory::batch_cache_entry));
+			if (cache_changed || !cache_file.up_to_date(mem_region.timestamp()))
 			{
-				run_batch<batch_name>(batch, mem_region);
-
-				const uintptr_t pointer_to_cacheable_data_end = reinterpret_cast<uintptr_t>(this) + offset_of_cache_end_field;
-				write_pointers_to_cache<batch_name, offset_of_cache_begin_field, offset_of_cache_end_field>(cache_file, pointer_to_cacheable_data_start, pointer_to_cacheable_data_end, mem_region);
-			}
-			else
-			{
-				load_pointers_from_cache(cache_file, pointer_to_cacheable_data_start, mem_region);
+				write_pointers_cache<batch_name>(cache_file, cache, mem_region);
 			}
 
 			cache_file.free();
 		}
 
-		void load_pointers_from_cache(const cache_file& cache_file, const uintptr_t pointer_to_cacheable_data_start, const memory::module& mem_region);
-
-		template<cstxpr_str batch_name, size_t offset_of_cache_begin_field, size_t offset_of_cache_end_field>
-		void write_pointers_to_cache(cache_file& cache_file, const uintptr_t pointer_to_cacheable_data_start, const uintptr_t pointer_to_cacheable_data_end, const memory::module& mem_region)
+		template<cstxpr_str batch_name>
+		std::vector<memory::batch_cache_entry> load_pointers_cache(cache_file& cache_file)
 		{
-			constexpr size_t data_size = offset_of_cache_end_field - offset_of_cache_begin_field;
-
-			cache_data cache_data_ptr = std::make_unique<uint8_t[]>(data_size);
-
-			// multiple things here:
-			// - iterate each cacheable field of the pointers instance
-			// - substract the base module address so that we only keep the offsets
-			// - save that to the cache
-			uintptr_t* cache_data = reinterpret_cast<uintptr_t*>(cache_data_ptr.get());
-
-			size_t i = 0;
-			for (uintptr_t field_ptr = pointer_to_cacheable_data_start; field_ptr != pointer_to_cacheable_data_end; field_ptr += sizeof(uintptr_t))
+			// the cached offsets are verified against the module before use, a different game build doesn't invalidate them
+			if (!cache_file.load() || !cache_file.up_to_date_ignoring_file_version())
 			{
-				const uintptr_t field_value = *reinterpret_cast<uintptr_t*>(field_ptr);
+				LOG(INFO) << batch_name.str << " pointers cache is missing or outdated, scanning all signatures.";
 
-				if (mem_region.contains(memory::handle(field_value)))
-				{
-					const uintptr_t offset = field_value - mem_region.begin().as<uintptr_t>();
-					cache_data[i]          = offset;
-				}
-				else
-				{
-					LOG(FATAL) << "Just tried to save to cache a pointer supposedly within the " << batch_name.str << " module range but isn't! Offset from start of pointers instance: " << (field_ptr - reinterpret_cast<uintptr_t>(this));
-				}
-
-				i++;
+				return {};
 			}
 
-			LOG(INFO) << "Pointers cache: saved " << (data_size / sizeof(uintptr_t)) << " fields to the cache";
-
-			cache_file.set_data(std::move(cache_data_ptr), data_size);
+			const auto entries = cache_file.view<memory::batch_cache_entry>();
+			LOG(INFO) << "Pointers cache: Loading " << entries.size() << " " << batch_name.str << " entries from the cache";
 
-			cache_file.set_header_version(mem_region.timestamp());
-			cache_file.write();
+			return {entries.begin(), entries.end()};
 		}
 
 		template<cstxpr_str batch_name>
-		bool is_pointers_cache_up_to_date(cache_file& cache_file, const memory::module& mem_region)
+		void write_pointers_cache(cache_file& cache_file, const std::vector<memory::batch_cache_entry>& cache, const memory::module& mem_region)
 		{
-			cache_file.load();
+			const auto data_size = cache.size() * sizeof(memory::batch_cache_entry);
 
-			if (cache_file.up_to_date(mem_region.timestamp()))
-			{
-				LOG(INFO) << batch_name.str << " pointers cache is up to date, using it.";
+			cache_data cache_data_ptr = std::make_unique<uint8_t[]>(data_size);
+			memcpy(cache_data_ptr.get(), cache.data(), data_size);
 
-				return true;
-			}
+			LOG(INFO) << "Pointers cache: saved " << cache.size() << " " << batch_name.str << " entries to the cache";
+
+			cache_file.set_data(std::move(cache_data_ptr), data_size);
 
-			return false;
+			cache_file.set_header_version(mem_region.timestamp());
+			cache_file.write();
 		}
 
 		static constexpr auto get_gta_batch();
 		static constexpr auto get_sc_batch();
 
-		template<cstxpr_str batch_name, size_t N>
-		void run_batch(const memory::batch<N>& batch, const memory::module& mem_region)
+		template<cstxpr_str batch_name, size_t N, size_t L>
+		void run_batch(const memory::batch<N, L>& batch, const memory::module& mem_region, std::vector<memory::batch_cache_entry>& cache)
 		{
-			if (!memory::batch_runner::run(batch, mem_region))
+			if (!memory::batch_runner::run(batch, mem_region, cache))
 			{
 				auto message = std::format("Failed to find some patterns for {}", batch_name.str);
 
@@ -64,20 +64,25 @@ namespace big
 		return m_done;
 	}
 
-	void script::tick()
+	void script::tick(time_point now)
 	{
 		m_main_fiber = GetCurrentFiber();
-		if (!m_wake_time.has_value() || m_wake_time.value() <= std::chrono::high_resolution_clock::now())
+		if (!m_wake_time.has_value() || m_wake_time.value() <= now)
 		{
+			const auto start = clock::now();
 			SwitchToFiber(m_script_fiber);
+			m_last_run_time = clock::now() - start;
+
+			// exponential moving average over roughly the last 16 resumes
+			m_average_run_time += (m_last_run_time - m_average_run_time) / 16;
 		}
 	}
 
-	void script::yield(std::optional<std::chrono::high_resolution_clock::duration> time)
+	void script::yield(std::optional<clock::duration> time)
 	{
 		if (time.has_value())
 		{
-			m_wake_time = std::chrono::high_resolution_clock::now() + time.value();
+			m_wake_time = clock::now() + time.value();
 		}
 		else
 		{
@@ -92,6 +97,21 @@ namespace big
 		return static_cast<script*>(GetFiberData());
 	}
 
+	const std::optional<script::time_point>& script::wake_time() const
+	{
+		return m_wake_time;
+	}
+
+	script::clock::duration script::last_run_time() const
+	{
+		return m_last_run_time;
+	}
+
+	script::clock::duration script::average_run_time() const
+	{
+		return m_average_run_time;
+	}
+
 	void script::fiber_func()
 	{
 		m_func();
@@ -10,7 +10,9 @@ namespace big
 		bool m_done;
 
 	public:
-		using func_t = std::function<void(void)>;
+		using func_t     = std::function<void(void)>;
+		using clock      = std::chrono::high_resolution_clock;
+		using time_point = clock::time_point;
 
 	public:
 		explicit script(const func_t func, const std::string& name, const bool toggleable = true, const std::optional<std::size_t> stack_size = std::nullopt);
@@ -26,10 +28,16 @@ namespace big
 
 		[[nodiscard]] bool is_done() const;
 
-		void tick();
-		void yield(std::optional<std::chrono::high_resolution_clock::duration> time = std::nullopt);
+		// now is read once per frame by the caller, the script only resumes if it's due
+		void tick(time_point now);
+		void yield(std::optional<clock::duration> time = std::nullopt);
 		static script* get_current();
 
+		[[nodiscard]] const std::optional<time_point>& wake_time() const;
+		// time spent inside the script the last time it resumed, and a moving average of it
+		[[nodiscard]] clock::duration last_run_time() const;
+		[[nodiscard]] clock::duration average_run_time() const;
+
 	private:
 		void fiber_func();
 
@@ -37,6 +45,9 @@ namespace big
 		void* m_script_fiber;
 		void* m_main_fiber;
 		func_t m_func;
-		std::optional<std::chrono::high_resolution_clock::time_point> m_wake_time;
+		std::optional<time_point> m_wake_time;
+
+		clock::duration m_last_run_time{};
+		clock::duration m_average_run_time{};
 	};
 }
\ No newline at end of file
@@ -12,6 +12,7 @@ namespace big
 	{
 		std::lock_guard lock(m_mutex);
 
+		m_ready_scripts.push_back(m_scripts.size());
 		m_scripts.push_back(std::move(script));
 	}
 
@@ -19,6 +20,8 @@ namespace big
 	{
 		std::lock_guard lock(m_mutex);
 
+		m_ready_scripts.clear();
+		m_sleeping_scripts = {};
 		m_scripts.clear();
 	}
 
@@ -34,12 +37,12 @@ namespace big
 		m_can_tick = true;
 	}
 
-	static void lua_manager_tick()
+	static void lua_manager_tick(script::time_point now)
 	{
 		g_lua_manager->reload_changed_scripts();
 
-		g_lua_manager->for_each_module([](const std::shared_ptr<lua_module>& module) {
-			module->tick_scripts();
+		g_lua_manager->for_each_module([now](const std::shared_ptr<lua_module>& module) {
+			module->tick_scripts(now);
 			module->cleanup_done_scripts();
 		});
 	}
@@ -50,12 +53,42 @@ namespace big
 
 		std::lock_guard lock(m_mutex);
 
-		lua_manager_tick();
+		const auto now = script::clock::now();
 
-		for (const auto& script : m_scripts)
+		lua_manager_tick(now);
+
+		auto ready_scripts = std::move(m_ready_scripts);
+		m_ready_scripts.clear();
+
+		while (!m_sleeping_scripts.empty() && m_sleeping_scripts.top().m_wake_time <= now)
+		{
+			ready_scripts.push_back(m_sleeping_scripts.top().m_index);
+			m_sleeping_scripts.pop();
+		}
+
+		std::sort(ready_scripts.begin(), ready_scripts.end());
+
+		// scripts can be added while ticking, so neither the vector nor references into m_scripts are held on to
+		for (const auto index : ready_scripts)
 		{
+			const auto script = m_scripts[index].get();
 			if (script->is_enabled())
-				script->tick();
+			{
+				script->tick(now);
+
+				if (const auto& wake_time = script->wake_time(); wake_time.has_value() && wake_time.value() > now)
+				{
+					m_sleeping_scripts.push({wake_time.value(), index});
+					continue;
+				}
+
+				if (script->is_done())
+					continue;
+			}
+
+			m_ready_scripts.push_back(index);
 		}
+
+		std::sort(m_ready_scripts.begin(), m_ready_scripts.end());
 	}
 }
@@ -2,6 +2,8 @@
 #include "lua/lua_manager.hpp"
 #include "script.hpp"
 
+#include <queue>
+
 namespace big
 {
 	using script_list = std::vector<std::unique_ptr<script>>;
@@ -43,9 +45,26 @@ namespace big
 		void tick_internal();
 
 	private:
+		// index into m_scripts of a script that yielded with a duration
+		struct sleeping_script
+		{
+			script::time_point m_wake_time;
+			std::size_t m_index;
+
+			bool operator>(const sleeping_script& other) const
+			{
+				return m_wake_time > other.m_wake_time;
+			}
+		};
+
 		std::recursive_mutex m_mutex;
 		script_list m_scripts;
 
+		// scripts that get resumed every tick, kept in the order they were added
+		std::vector<std::size_t> m_ready_scripts;
+		// min-heap on the wake time, only the top has to be looked at each tick
+		std::priority_queue<sleeping_script, std::vector<sleeping_script>, std::greater<>> m_sleeping_scripts;
+
 		bool m_can_tick = false;
 	};
 
@@ -0,0 +1,102 @@
+#include "entity_snapshot_service.hpp"
+
+#include "natives.hpp"
+#include "pointers.hpp"
+#include "util/pools.hpp"
+
+namespace big
+{
+	entity_snapshot_service::entity_snapshot_service()
+	{
+		g_entity_snapshot_service = this;
+	}
+
+	entity_snapshot_service::~entity_snapshot_service()
+	{
+		g_entity_snapshot_service = nullptr;
+	}
+
+	std::span<const Entity> entity_snapshot_service::get_handles(snapshot_entity_type type)
+	{
+		return update(type).m_handles;
+	}
+
+	std::span<rage::CEntity* const> entity_snapshot_service::get_pointers(snapshot_entity_type type)
+	{
+		return update(type).m_pointers;
+	}
+
+	std::span<const Hash> entity_snapshot_service::get_models(snapshot_entity_type type)
+	{
+		return update(type).m_models;
+	}
+
+	std::span<const rage::fvector3> entity_snapshot_service::get_positions(snapshot_entity_type type)
+	{
+		return update(type).m_positions;
+	}
+
+	std::vector<Entity> entity_snapshot_service::get_entities_in_radius(snapshot_entity_type type, const rage::fvector3& center, float radius)
+	{
+		std::vector<Entity> entities;
+		const auto handles = get_handles(type);
+		for_each_in_radius(type, center, radius, [&](std::size_t index) {
+			entities.push_back(handles[index]);
+		});
+
+		return entities;
+	}
+
+	template<typename P>
+	void entity_snapshot_service::capture(P& pool, type_snapshot& snapshot)
+	{
+		// clear() keeps the capacity, after the first few frames this doesn't allocate anymore
+		snapshot.m_handles.clear();
+		snapshot.m_pointers.clear();
+		snapshot.m_models.clear();
+		snapshot.m_positions.clear();
+
+		for (auto entity : pool)
+		{
+			if (!entity)
+				continue;
+
+			snapshot.m_handles.push_back(g_pointers->m_gta.m_ptr_to_handle(entity));
+			snapshot.m_pointers.push_back(entity);
+			snapshot.m_models.push_back(entity->m_model_info ? entity->m_model_info->m_hash : 0);
+			snapshot.m_positions.push_back(*entity->get_position());
+		}
+
+		auto& grid = snapshot.m_grid;
+		grid.clear();
+		for (std::uint32_t i = 0; i < snapshot.m_positions.size(); i++)
+		{
+			const auto& pos = snapshot.m_positions[i];
+			grid.push_back({cell_key(cell_coord(pos.x), cell_coord(pos.y)), i});
+		}
+
+		std::sort(grid.begin(), grid.end(), [](const grid_entry& a, const grid_entry& b) {
+			return a.m_cell < b.m_cell;
+		});
+	}
+
+	const entity_snapshot_service::type_snapshot& entity_snapshot_service::update(snapshot_entity_type type)
+	{
+		auto& snapshot = m_snapshots[(int)type];
+
+		const auto frame = MISC::GET_FRAME_COUNT();
+		if (frame == snapshot.m_frame)
+			return snapshot;
+		snapshot.m_frame = frame;
+
+		switch (type)
+		{
+		case snapshot_entity_type::VEHICLE: capture(pools::get_all_vehicles(), snapshot); break;
+		case snapshot_entity_type::PED: capture(pools::get_all_peds(), snapshot); break;
+		case snapshot_entity_type::PROP: capture(pools::get_all_props(), snapshot); break;
+		default: break;
+		}
+
+		return snapshot;
+	}
+}
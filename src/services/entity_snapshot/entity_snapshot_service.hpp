@@ -0,0 +1,126 @@
+#pragma once
+#include <rage/vector.hpp>
+#include <script/types.hpp>
+
+#include <span>
+
+namespace rage
+{
+	class CEntity;
+}
+
+namespace big
+{
+	enum class snapshot_entity_type : std::uint8_t
+	{
+		VEHICLE,
+		PED,
+		PROP,
+		COUNT
+	};
+
+	/**
+	 * @brief The vehicles, peds and props of the game pools, each type captured at most once per frame.
+	 *
+	 * A pool is only walked when something asks for its type, and only once a frame no matter how many features
+	 * look at nearby entities. Entities of a type are stored in parallel arrays that are reused between frames.
+	 *
+	 * Only use it from script fibers, a type is refreshed by its first caller of a new frame.
+	 * The spans returned are invalidated by that refresh, so don't keep them across a yield.
+	 */
+	class entity_snapshot_service final
+	{
+	public:
+		entity_snapshot_service();
+		~entity_snapshot_service();
+
+		entity_snapshot_service(const entity_snapshot_service&)                = delete;
+		entity_snapshot_service(entity_snapshot_service&&) noexcept            = delete;
+		entity_snapshot_service& operator=(const entity_snapshot_service&)     = delete;
+		entity_snapshot_service& operator=(entity_snapshot_service&&) noexcept = delete;
+
+		std::span<const Entity> get_handles(snapshot_entity_type type);
+		std::span<rage::CEntity* const> get_pointers(snapshot_entity_type type);
+		std::span<const Hash> get_models(snapshot_entity_type type);
+		std::span<const rage::fvector3> get_positions(snapshot_entity_type type);
+
+		/**
+		 * @brief Calls func(index) for every entity of the given type within radius of center,
+		 * index can be used with the spans returned by the getters above.
+		 */
+		template<typename F>
+		void for_each_in_radius(snapshot_entity_type type, const rage::fvector3& center, float radius, F&& func)
+		{
+			const auto& snapshot = update(type);
+
+			const auto& grid = snapshot.m_grid;
+			const auto min_x = cell_coord(center.x - radius), max_x = cell_coord(center.x + radius);
+			const auto min_y = cell_coord(center.y - radius), max_y = cell_coord(center.y + radius);
+			const auto radius_sq = radius * radius;
+
+			for (auto x = min_x; x <= max_x; x++)
+			{
+				for (auto y = min_y; y <= max_y; y++)
+				{
+					const auto key = cell_key(x, y);
+					auto it = std::lower_bound(grid.begin(), grid.end(), key, [](const grid_entry& entry, std::uint64_t key) {
+						return entry.m_cell < key;
+					});
+
+					for (; it != grid.end() && it->m_cell == key; ++it)
+					{
+						const auto& pos = snapshot.m_positions[it->m_index];
+						const auto dx = pos.x - center.x, dy = pos.y - center.y, dz = pos.z - center.z;
+						if (dx * dx + dy * dy + dz * dz <= radius_sq)
+							func(it->m_index);
+					}
+				}
+			}
+		}
+
+		std::vector<Entity> get_entities_in_radius(snapshot_entity_type type, const rage::fvector3& center, float radius);
+
+	private:
+		// cells are only laid out on the horizontal plane, most of the map is flat enough for that
+		static constexpr float cell_size = 32.f;
+
+		struct grid_entry
+		{
+			std::uint64_t m_cell;
+			std::uint32_t m_index;
+		};
+
+		static std::int32_t cell_coord(float value)
+		{
+			return (std::int32_t)std::floor(value / cell_size);
+		}
+
+		static std::uint64_t cell_key(std::int32_t x, std::int32_t y)
+		{
+			return ((std::uint64_t)(std::uint32_t)x << 32) | (std::uint32_t)y;
+		}
+
+		struct type_snapshot
+		{
+			// frame the type was last captured at
+			int m_frame = -1;
+
+			// parallel arrays
+			std::vector<Entity> m_handles;
+			std::vector<rage::CEntity*> m_pointers;
+			std::vector<Hash> m_models;
+			std::vector<rage::fvector3> m_positions;
+
+			// entries sorted by cell, indexing into the arrays above
+			std::vector<grid_entry> m_grid;
+		};
+
+		const type_snapshot& update(snapshot_entity_type type);
+		template<typename P>
+		static void capture(P& pool, type_snapshot& snapshot);
+
+		std::array<type_snapshot, (int)snapshot_entity_type::COUNT> m_snapshots;
+	};
+
+	inline entity_snapshot_service* g_entity_snapshot_service{};
+}
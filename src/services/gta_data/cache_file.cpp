@@ -2,6 +2,23 @@
 
 namespace big
 {
+	static uint64_t compute_checksum(const uint8_t* data, uint64_t size)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (uint64_t i = 0; i < size; i++)
+		{
+			hash ^= data[i];
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	void mapped_view_deleter::operator()(const uint8_t* view) const
+	{
+		UnmapViewOfFile(view);
+	}
+
 	cache_file::cache_file(file cache_file) :
 	    m_cache_file(cache_file),
 	    m_data(nullptr),
@@ -21,23 +38,58 @@ namespace big
 	void cache_file::free()
 	{
 		m_data.reset();
+		m_mapped_view.reset();
 	}
 
 	bool cache_file::load()
 	{
 		if (!m_cache_file.exists())
 			return false;
-		if (m_data)
+		if (m_data || m_mapped_view)
 			return true;
 
-		auto file = std::ifstream(m_cache_file.get_path(), std::ios::binary);
+		const auto file = CreateFileW(m_cache_file.get_path().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER file_size{};
+		if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < static_cast<LONGLONG>(sizeof(cache_header)))
+		{
+			CloseHandle(file);
+			LOG(WARNING) << "Cache file " << m_cache_file.get_path().filename() << " is truncated, ignoring it.";
 
-		file.read(reinterpret_cast<char*>(&m_cache_header), sizeof(m_cache_header));
+			return false;
+		}
+
+		// the view keeps the mapping and the file open
+		const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping)
+			return false;
+
+		mapped_view view(static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)));
+		CloseHandle(mapping);
+		if (!view)
+			return false;
 
-		m_data = std::make_unique<uint8_t[]>(m_cache_header.m_data_size);
-		file.read(reinterpret_cast<char*>(m_data.get()), m_cache_header.m_data_size);
+		const auto header      = *reinterpret_cast<const cache_header*>(view.get());
+		const auto stored_size = static_cast<uint64_t>(file_size.QuadPart) - sizeof(cache_header);
+		if (header.m_magic != cache_header::magic || header.m_format_version != cache_header::format_version)
+		{
+			LOG(INFO) << "Cache file " << m_cache_file.get_path().filename() << " uses an older format, ignoring it.";
+
+			return false;
+		}
+		if (header.m_data_size != stored_size || header.m_checksum != compute_checksum(view.get() + sizeof(cache_header), stored_size))
+		{
+			LOG(WARNING) << "Cache file " << m_cache_file.get_path().filename() << " is corrupted, ignoring it.";
+
+			return false;
+		}
+
+		m_cache_header = header;
+		m_mapped_view  = std::move(view);
 
-		file.close();
 		return true;
 	}
 
@@ -46,18 +98,51 @@ namespace big
 		if (!m_data)
 			return false;
 
-		auto file = std::ofstream(m_cache_file.get_path(), std::ios::binary);
+		auto header             = m_cache_header;
+		header.m_magic          = cache_header::magic;
+		header.m_format_version = cache_header::format_version;
+		header.m_checksum       = compute_checksum(m_data.get(), header.m_data_size);
+
+		const auto path = m_cache_file.get_path();
+		auto temp_path  = path;
+		temp_path += ".tmp";
+
+		{
+			auto file = std::ofstream(temp_path, std::ios::binary | std::ios::trunc);
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(m_data.get()), header.m_data_size);
+			file.close();
+
+			if (!file)
+			{
+				LOG(WARNING) << "Failed to write cache file " << temp_path.filename();
 
-		file.write(reinterpret_cast<const char*>(&m_cache_header), sizeof(m_cache_header));
-		file.write(reinterpret_cast<const char*>(m_data.get()), m_cache_header.m_data_size);
-		file.close();
+				return false;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temp_path, path, ec);
+		if (ec)
+		{
+			LOG(WARNING) << "Failed to replace cache file " << path.filename() << ": " << ec.message();
+			std::filesystem::remove(temp_path, ec);
+
+			return false;
+		}
 
 		return true;
 	}
 
-	uint8_t* cache_file::data() const
+	const uint8_t* cache_file::data() const
 	{
-		return m_data.get();
+		if (m_data)
+			return m_data.get();
+		if (m_mapped_view)
+			return m_mapped_view.get() + sizeof(cache_header);
+
+		return nullptr;
 	}
 
 	uint64_t cache_file::data_size() const
@@ -67,14 +152,25 @@ namespace big
 
 	bool cache_file::up_to_date(uint32_t file_version) const
 	{
-		if (!m_data)
+		if (!data())
 			return false;
 
 		return m_cache_version == m_cache_header.m_cache_version && file_version == m_cache_header.m_file_version;
 	}
 
+	bool cache_file::up_to_date_ignoring_file_version() const
+	{
+		if (!data())
+			return false;
+
+		return m_cache_version == m_cache_header.m_cache_version;
+	}
+
 	void cache_file::set_data(cache_data&& data, uint64_t data_size)
 	{
+		// the file can't be replaced while it's still mapped
+		m_mapped_view.reset();
+
 		m_data.swap(data);
 		m_cache_header.m_data_size = data_size;
 	}
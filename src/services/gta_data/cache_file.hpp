@@ -1,17 +1,32 @@
 #pragma once
 #include "file_manager/file.hpp"
 
+#include <span>
+
 namespace big
 {
 	class cache_header final
 	{
 	public:
+		static constexpr uint32_t magic          = 0x434D4959; // YIMC
+		static constexpr uint32_t format_version = 2;
+
+		uint32_t m_magic;
+		uint32_t m_format_version;
 		uint32_t m_cache_version;
 		uint32_t m_file_version;
 		uint64_t m_data_size;
+		// FNV-1a of the data following the header
+		uint64_t m_checksum;
+	};
+
+	struct mapped_view_deleter
+	{
+		void operator()(const uint8_t* view) const;
 	};
 
-	using cache_data = std::unique_ptr<uint8_t[]>;
+	using cache_data  = std::unique_ptr<uint8_t[]>;
+	using mapped_view = std::unique_ptr<const uint8_t, mapped_view_deleter>;
 	class cache_file final
 	{
 	public:
@@ -35,20 +50,29 @@ namespace big
 		void free();
 
 		/// <summary>
-		/// Attempts to load the cache from disk
+		/// Attempts to load the cache from disk, the file is mapped read-only until free() or set_data() is called.
 		/// </summary>
-		/// <returns>True after successfully loading the data, false if the file didn't exist.</returns>
+		/// <returns>True after successfully loading the data, false if the file didn't exist or failed validation.</returns>
 		bool load();
 
 		/// <summary>
-		/// Writes the cache to disk
+		/// Writes the cache to a temporary file and atomically replaces the cache file with it
 		/// </summary>
-		/// <returns></returns>
+		/// <returns>True if the cache file was replaced.</returns>
 		bool write() const;
 
-		uint8_t* data() const;
+		const uint8_t* data() const;
 		uint64_t data_size() const;
 
+		/// <summary>
+		/// Views the cached data as an array of T without copying it
+		/// </summary>
+		template<typename T>
+		std::span<const T> view() const
+		{
+			return {reinterpret_cast<const T*>(data()), static_cast<size_t>(data_size() / sizeof(T))};
+		}
+
 		/// <summary>
 		/// Check if the cache file is up to date with the expected versions
 		/// </summary>
@@ -57,6 +81,12 @@ namespace big
 		/// <returns>True if cache is up to date, false otherwise.</returns>
 		bool up_to_date(uint32_t file_version) const;
 
+		/// <summary>
+		/// Check if the cache file was written with the expected cache version, whatever the game version it was written for
+		/// </summary>
+		/// <returns>True if the data layout is the expected one, false otherwise.</returns>
+		bool up_to_date_ignoring_file_version() const;
+
 
 		void set_data(cache_data&& data, uint64_t data_size);
 		/// <summary>
@@ -75,5 +105,7 @@ namespace big
 
 		cache_header m_cache_header;
 		cache_data m_data;
+		// the whole file, header included, while loaded from disk
+		mapped_view m_mapped_view;
 	};
 }
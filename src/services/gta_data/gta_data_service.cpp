@@ -15,6 +15,7 @@
 #include "yim_fipackfile.hpp"
 
 #include <algorithm>
+#include <queue>
 
 namespace big
 {
@@ -69,44 +70,43 @@ namespace big
 		});
 	}
 
-	// innefficient getters, don't care to fix right now
 	const ped_item& gta_data_service::ped_by_hash(uint32_t hash)
 	{
-		for (const auto& [name, ped] : m_peds)
-			if (ped.m_hash == hash)
-				return ped;
+		std::shared_lock lock(m_index_mutex);
+		if (const auto ped = m_ped_index.find(hash))
+			return *ped;
 		return gta_data_service::empty_ped;
 	}
 
 	const vehicle_item& gta_data_service::vehicle_by_hash(uint32_t hash)
 	{
-		for (const auto& [name, veh] : m_vehicles)
-			if (veh.m_hash == hash)
-				return veh;
+		std::shared_lock lock(m_index_mutex);
+		if (const auto veh = m_vehicle_index.find(hash))
+			return *veh;
 		return gta_data_service::empty_vehicle;
 	}
 
 	const weapon_item& gta_data_service::weapon_by_hash(uint32_t hash)
 	{
-		for (const auto& [name, weapon] : m_weapons_cache.weapon_map)
-			if (weapon.m_hash == hash)
-				return weapon;
+		std::shared_lock lock(m_index_mutex);
+		if (const auto weapon = m_weapon_index.find(hash))
+			return *weapon;
 		return gta_data_service::empty_weapon;
 	}
 
 	const weapon_component& gta_data_service::weapon_component_by_hash(uint32_t hash)
 	{
-		for (const auto& [name, component] : m_weapons_cache.weapon_components)
-			if (component.m_hash == hash)
-				return component;
+		std::shared_lock lock(m_index_mutex);
+		if (const auto component = m_weapon_component_index.find(hash))
+			return *component;
 		return gta_data_service::empty_component;
 	}
 
 	const weapon_component& gta_data_service::weapon_component_by_name(std::string name)
 	{
-		for (const auto& [name_key, component] : m_weapons_cache.weapon_components)
-			if (name_key == name)
-				return component;
+		std::shared_lock lock(m_index_mutex);
+		if (const auto it = m_weapons_cache.weapon_components.find(name); it != m_weapons_cache.weapon_components.end())
+			return it->second;
 		return gta_data_service::empty_component;
 	}
 
@@ -140,8 +140,14 @@ namespace big
 			{
 				nlohmann::json weapons_file_json;
 				file >> weapons_file_json;
-				m_weapons_cache = weapons_file_json["weapons_cache"];
+				weapon_file weapons_cache = weapons_file_json["weapons_cache"];
 				file.close();
+
+				// keep the previous weapons usable until the cache is rebuilt
+				std::unique_lock lock(m_index_mutex);
+				m_weapons_cache = std::move(weapons_cache);
+				m_weapon_index.build(m_weapons_cache.weapon_map);
+				m_weapon_component_index.build(m_weapons_cache.weapon_components);
 			}
 			catch (const std::exception& exception)
 			{
@@ -162,52 +168,66 @@ namespace big
 		load_peds();
 		load_vehicles();
 		load_weapons();
+		m_generation++;
 
 		LOG(VERBOSE) << "Loaded all data from cache.";
 	}
 
 	void gta_data_service::load_peds()
 	{
-		const auto ped_count = m_peds_cache.data_size() / sizeof(ped_item);
-		LOG(INFO) << "Loading " << ped_count << " peds from cache.";
+		const auto cached_peds = m_peds_cache.view<ped_item>();
+		LOG(INFO) << "Loading " << cached_peds.size() << " peds from cache.";
 
-		m_ped_types.clear();
-		m_ped_types.reserve(ped_count);
-		m_peds.clear();
+		string_vec ped_types;
+		ped_types.reserve(cached_peds.size());
+		ped_map peds;
 
-		auto cached_peds = reinterpret_cast<const ped_item*>(m_peds_cache.data());
-		for (size_t i = 0; i < ped_count; i++)
+		for (const auto& ped : cached_peds)
 		{
-			const auto ped = cached_peds[i];
-
-			add_if_not_exists(m_ped_types, ped.m_ped_type);
-			m_peds.insert({ped.m_name, ped});
+			add_if_not_exists(ped_types, ped.m_ped_type);
+			peds.insert({ped.m_name, ped});
 		}
 
-		std::sort(m_ped_types.begin(), m_ped_types.end());
+		std::sort(ped_types.begin(), ped_types.end());
 		m_peds_cache.free();
+
+		// the nodes move along with the map, the index stays valid after the swap
+		hash_index<ped_item> index;
+		index.build(peds);
+		{
+			std::unique_lock lock(m_index_mutex);
+			m_ped_types.swap(ped_types);
+			m_peds.swap(peds);
+			m_ped_index = std::move(index);
+		}
 	}
 
 	void gta_data_service::load_vehicles()
 	{
-		const auto vehicle_count = m_vehicles_cache.data_size() / sizeof(vehicle_item);
-		LOG(INFO) << "Loading " << vehicle_count << " vehicles from cache.";
+		const auto cached_vehicles = m_vehicles_cache.view<vehicle_item>();
+		LOG(INFO) << "Loading " << cached_vehicles.size() << " vehicles from cache.";
 
-		m_vehicle_classes.clear();
-		m_vehicle_classes.reserve(vehicle_count);
-		m_vehicles.clear();
+		string_vec vehicle_classes;
+		vehicle_classes.reserve(cached_vehicles.size());
+		vehicle_map vehicles;
 
-		auto cached_vehicles = reinterpret_cast<const vehicle_item*>(m_vehicles_cache.data());
-		for (size_t i = 0; i < vehicle_count; i++)
+		for (const auto& vehicle : cached_vehicles)
 		{
-			const auto vehicle = cached_vehicles[i];
-
-			add_if_not_exists(m_vehicle_classes, vehicle.m_vehicle_class);
-			m_vehicles.insert({vehicle.m_name, vehicle});
+			add_if_not_exists(vehicle_classes, vehicle.m_vehicle_class);
+			vehicles.insert({vehicle.m_name, vehicle});
 		}
 
-		std::sort(m_vehicle_classes.begin(), m_vehicle_classes.end());
+		std::sort(vehicle_classes.begin(), vehicle_classes.end());
 		m_vehicles_cache.free();
+
+		hash_index<vehicle_item> index;
+		index.build(vehicles);
+		{
+			std::unique_lock lock(m_index_mutex);
+			m_vehicle_classes.swap(vehicle_classes);
+			m_vehicles.swap(vehicles);
+			m_vehicle_index = std::move(index);
+		}
 	}
 
 	void gta_data_service::load_weapons()
@@ -215,7 +235,10 @@ namespace big
 		LOG(INFO) << "Loading " << m_weapons_cache.weapon_map.size() << " weapons from cache.";
 		LOG(INFO) << "Loading " << m_weapons_cache.weapon_components.size() << " weapon components from cache.";
 
+		std::unique_lock lock(m_index_mutex);
 		std::sort(m_weapon_types.begin(), m_weapon_types.end());
+		m_weapon_index.build(m_weapons_cache.weapon_map);
+		m_weapon_component_index.build(m_weapons_cache.weapon_components);
 	}
 
 	static RPFDatafileSource determine_file_type(std::string file_path, std::string_view rpf_filename)
@@ -239,36 +262,366 @@ namespace big
 		return RPFDatafileSource::UNKNOWN;
 	}
 
-	inline void parse_ped(std::vector<ped_item>& peds, std::vector<uint32_t>& mapped_peds, pugi::xml_document& doc)
+	enum class meta_file_type
+	{
+		VEHICLES,
+		PEDS,
+		PED_MODEL,
+		WEAPONS,
+		WEAPON_COMPONENTS
+	};
+
+	// a file collected from the RPFs, waiting to be parsed
+	struct meta_file
+	{
+		size_t m_index;
+		meta_file_type m_type;
+		RPFDatafileSource m_source = RPFDatafileSource::UNKNOWN;
+		// the model name for PED_MODEL, the file contents otherwise
+		std::string m_ped_name;
+		std::unique_ptr<uint8_t[]> m_content;
+		int m_content_size = 0;
+	};
+
+	// everything extracted from a single meta_file, nothing is de-duplicated yet
+	struct meta_file_items
 	{
-		const auto& items = doc.select_nodes("/CPedModelInfo__InitDataList/InitDatas/Item");
-		for (const auto& item_node : items)
+		std::vector<ped_item> m_peds;
+		std::vector<vehicle_item> m_vehicles;
+		std::vector<weapon_item_parsed> m_weapons;
+		std::vector<weapon_component> m_weapon_components;
+	};
+
+	static void parse_peds(meta_file_items& items, pugi::xml_document& doc)
+	{
+		const auto& nodes = doc.select_nodes("/CPedModelInfo__InitDataList/InitDatas/Item");
+		for (const auto& item_node : nodes)
 		{
 			const auto& item = item_node.node();
 			const auto name  = item.child("Name").text().as_string();
-			const auto hash  = rage::joaat(name);
 
-			if (protection::is_crash_ped(hash))
+			auto ped = ped_item{};
+
+			std::strncpy(ped.m_name, name, sizeof(ped.m_name));
+
+			const auto ped_type = item.child("Pedtype").text().as_string();
+			std::strncpy(ped.m_ped_type, ped_type, sizeof(ped.m_ped_type));
+
+			ped.m_hash = rage::joaat(name);
+
+			items.m_peds.emplace_back(std::move(ped));
+		}
+	}
+
+	static void parse_vehicles(meta_file_items& items, pugi::xml_document& doc)
+	{
+		const auto& nodes = doc.select_nodes("/CVehicleModelInfo__InitDataList/InitDatas/Item");
+		for (const auto& item_node : nodes)
+		{
+			const auto item = item_node.node();
+
+			std::string name = item.child("modelName").text().as_string();
+			std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+
+			auto veh = vehicle_item{};
+			std::strncpy(veh.m_name, name.c_str(), sizeof(veh.m_name));
+
+			const auto manufacturer_display = item.child("vehicleMakeName").text().as_string();
+			std::strncpy(veh.m_display_manufacturer, manufacturer_display, sizeof(veh.m_display_manufacturer));
+
+			const auto game_name = item.child("gameName").text().as_string();
+			std::strncpy(veh.m_display_name, game_name, sizeof(veh.m_display_name));
+
+			const auto vehicle_class       = item.child("vehicleClass").text().as_string();
+			constexpr auto enum_prefix_len = 3;
+			if (std::strlen(vehicle_class) > enum_prefix_len)
+				std::strncpy(veh.m_vehicle_class, vehicle_class + enum_prefix_len, sizeof(veh.m_vehicle_class));
+
+			veh.m_hash = rage::joaat(name);
+
+			items.m_vehicles.emplace_back(std::move(veh));
+		}
+	}
+
+	static void parse_weapon_components(meta_file_items& items, pugi::xml_document& doc)
+	{
+		const auto& nodes = doc.select_nodes("/CWeaponComponentInfoBlob/Infos/*[self::Item[@type='CWeaponComponentInfo'] or self::Item[@type='CWeaponComponentFlashLightInfo'] or self::Item[@type='CWeaponComponentScopeInfo'] or self::Item[@type='CWeaponComponentSuppressorInfo'] or self::Item[@type='CWeaponComponentVariantModelInfo'] or self::Item[@type='CWeaponComponentClipInfo']]");
+		for (const auto& item_node : nodes)
+		{
+			const auto item        = item_node.node();
+			const std::string name = item.child("Name").text().as_string();
+
+			if (!name.starts_with("COMPONENT") || name.ends_with("MK2_UPGRADE"))
+			{
 				continue;
+			}
+
+			weapon_component component;
 
-			if (std::find(mapped_peds.begin(), mapped_peds.end(), hash) != mapped_peds.end())
+			component.m_name = name;
+			component.m_hash = rage::joaat(name);
+			// the loc names are resolved on the game thread, see resolve_component_labels
+			component.m_display_name = item.child("LocName").text().as_string();
+			component.m_display_desc = item.child("LocDesc").text().as_string();
+
+			items.m_weapon_components.push_back(component);
+		}
+	}
+
+	static void parse_weapons(meta_file_items& items, pugi::xml_document& doc, RPFDatafileSource source)
+	{
+		const auto& nodes = doc.select_nodes("/CWeaponInfoBlob/Infos/Item/Infos/Item[@type='CWeaponInfo']");
+		for (const auto& item_node : nodes)
+		{
+			const auto item = item_node.node();
+			const auto name = item.child("Name").text().as_string();
+			const auto hash = rage::joaat(name);
+
+			if (hash == "WEAPON_BIRD_CRAP"_J)
 				continue;
 
-			mapped_peds.emplace_back(hash);
+			const auto human_name_hash = item.child("HumanNameHash").text().as_string();
+			if (std::strcmp(human_name_hash, "WT_INVALID") == 0 || std::strcmp(human_name_hash, "WT_VEHMINE") == 0)
+				continue;
+
+			auto weapon = weapon_item_parsed{};
+
+			weapon.m_name         = name;
+			weapon.m_display_name = human_name_hash;
+			weapon.rpf_file_type  = source;
+
+			auto weapon_flags = std::string(item.child("WeaponFlags").text().as_string());
+
+			bool is_gun         = false;
+			bool is_rechargable = false;
+
+			const char* category = "";
 
+			std::size_t pos;
+			while ((pos = weapon_flags.find(' ')) != std::string::npos)
+			{
+				const auto flag = weapon_flags.substr(0, pos);
+				if (flag == "Thrown")
+				{
+					weapon.m_throwable = true;
+				}
+				else if (flag == "Gun")
+				{
+					is_gun = true;
+				}
+				else if (flag == "DisplayRechargeTimeHUD")
+				{
+					is_rechargable = true;
+				}
+				else if (flag == "Vehicle" || flag == "HiddenFromWeaponWheel" || flag == "NotAWeapon")
+				{
+					goto skip;
+				}
+
+				weapon_flags.erase(0, pos + 1);
+			}
+
+			category = item.child("Group").text().as_string();
+
+			if (std::strlen(category) == 0 || std::strcmp(category, "GROUP_DIGISCANNER") == 0)
+				continue;
+
+			if (std::strlen(category) > 6)
+			{
+				weapon.m_weapon_type = category + 6;
+			}
+
+			if (is_gun || weapon.m_weapon_type == "MELEE" || weapon.m_weapon_type == "UNARMED")
+			{
+				const std::string reward_prefix = "REWARD_";
+				weapon.m_reward_hash            = rage::joaat(reward_prefix + name);
+
+				if (is_gun && !is_rechargable)
+				{
+					std::string weapon_id     = name + 7;
+					weapon.m_reward_ammo_hash = rage::joaat(reward_prefix + "AMMO_" + weapon_id);
+				}
+			}
+
+			for (pugi::xml_node attach_point : item.child("AttachPoints").children("Item"))
+			{
+				for (pugi::xml_node component : attach_point.child("Components").children("Item"))
+				{
+					weapon.m_attachments.push_back(component.child_value("Name"));
+				}
+			}
+
+			weapon.m_hash = hash;
+
+			items.m_weapons.push_back(std::move(weapon));
+		skip:
+			continue;
+		}
+	}
+
+	static meta_file_items parse_meta_file(const meta_file& file)
+	{
+		meta_file_items items{};
+
+		if (file.m_type == meta_file_type::PED_MODEL)
+		{
 			auto ped = ped_item{};
+			std::strncpy(ped.m_name, file.m_ped_name.c_str(), sizeof(ped.m_name));
+			ped.m_hash = rage::joaat(file.m_ped_name);
 
-			std::strncpy(ped.m_name, name, sizeof(ped.m_name));
+			items.m_peds.emplace_back(std::move(ped));
 
-			const auto ped_type = item.child("Pedtype").text().as_string();
-			std::strncpy(ped.m_ped_type, ped_type, sizeof(ped.m_ped_type));
+			return items;
+		}
 
-			ped.m_hash = hash;
+		pugi::xml_document doc;
+		if (doc.load_buffer(file.m_content.get(), file.m_content_size).status != pugi::xml_parse_status::status_ok)
+			return items;
 
-			peds.emplace_back(std::move(ped));
+		switch (file.m_type)
+		{
+		case meta_file_type::VEHICLES: parse_vehicles(items, doc); break;
+		case meta_file_type::PEDS: parse_peds(items, doc); break;
+		case meta_file_type::WEAPONS: parse_weapons(items, doc, file.m_source); break;
+		case meta_file_type::WEAPON_COMPONENTS: parse_weapon_components(items, doc); break;
+		default: break;
 		}
+
+		return items;
 	}
 
+	// needs the MP_Weapons script to be running, returns false if the component should be dropped
+	static bool resolve_component_labels(weapon_component& component)
+	{
+		if (component.m_display_name.ends_with("RAIL"))
+			return false;
+
+		if (component.m_display_name.ends_with("INVALID"))
+		{
+			Hash weapon_hash = 0;
+			if (component.m_name.starts_with("COMPONENT_KNIFE"))
+				weapon_hash = "WEAPON_KNIFE"_J;
+			else if (component.m_name.starts_with("COMPONENT_KNUCKLE"))
+				weapon_hash = "WEAPON_KNUCKLE"_J;
+			else if (component.m_name.starts_with("COMPONENT_BAT"))
+				weapon_hash = "WEAPON_BAT"_J;
+			const auto display_string = scr_functions::get_component_name_string.call<const char*>(component.m_hash, weapon_hash);
+			if (display_string == nullptr)
+				return false;
+			component.m_display_name = display_string;
+		}
+
+		if (component.m_display_name.ends_with("INVALID"))
+			return false;
+
+		if (component.m_display_desc.ends_with("INVALID"))
+		{
+			const auto display_string = scr_functions::get_component_desc_string.call<const char*>(component.m_hash, 0);
+			if (display_string != nullptr)
+				component.m_display_desc = display_string;
+		}
+
+		if (component.m_display_desc.ends_with("INVALID"))
+			component.m_display_desc.clear();
+
+		return true;
+	}
+
+	// parses the files collected from the RPFs on the thread pool while the game thread keeps collecting them
+	class meta_file_parser final
+	{
+	public:
+		explicit meta_file_parser(size_t worker_count) :
+		    m_running_workers(worker_count)
+		{
+			for (size_t i = 0; i < worker_count; i++)
+				g_thread_pool->push([this] {
+					work();
+				});
+		}
+
+		void push(meta_file&& file)
+		{
+			{
+				std::lock_guard lock(m_queue_lock);
+				m_queue.push(std::move(file));
+			}
+			m_queue_condition.notify_one();
+		}
+
+		// stops accepting files, the workers exit once the queue is empty
+		void finish()
+		{
+			{
+				std::lock_guard lock(m_queue_lock);
+				m_finished = true;
+			}
+			m_queue_condition.notify_all();
+		}
+
+		bool done() const
+		{
+			return m_running_workers == 0;
+		}
+
+		// only valid once done(), sorted in the order the files were pushed
+		std::vector<std::pair<size_t, meta_file_items>>& results()
+		{
+			std::sort(m_results.begin(), m_results.end(), [](const auto& a, const auto& b) {
+				return a.first < b.first;
+			});
+
+			return m_results;
+		}
+
+	private:
+		void work()
+		{
+			std::vector<std::pair<size_t, meta_file_items>> results;
+
+			for (;;)
+			{
+				std::unique_lock lock(m_queue_lock);
+				m_queue_condition.wait(lock, [this] {
+					return !m_queue.empty() || m_finished;
+				});
+
+				if (m_queue.empty())
+					break;
+
+				auto file = std::move(m_queue.front());
+				m_queue.pop();
+				lock.unlock();
+
+				try
+				{
+					results.emplace_back(file.m_index, parse_meta_file(file));
+				}
+				catch (const std::exception& e)
+				{
+					LOG(WARNING) << "Failed to parse meta file: " << e.what();
+				}
+			}
+
+			{
+				std::lock_guard lock(m_results_lock);
+				std::move(results.begin(), results.end(), std::back_inserter(m_results));
+			}
+
+			--m_running_workers;
+		}
+
+		std::mutex m_queue_lock;
+		std::condition_variable m_queue_condition;
+		std::queue<meta_file> m_queue;
+		bool m_finished = false;
+
+		std::mutex m_results_lock;
+		std::vector<std::pair<size_t, meta_file_items>> m_results;
+
+		std::atomic<size_t> m_running_workers;
+	};
+
 	void gta_data_service::rebuild_cache()
 	{
 		static bool completed = false;
@@ -278,22 +631,18 @@ namespace big
 			return;
 		}
 
-		using hash_array = std::vector<uint32_t>;
-		hash_array mapped_peds{};
-		hash_array mapped_vehicles{};
-		hash_array mapped_weapons{};
-		hash_array mapped_components{};
-
 		int mp_weapons_thread_id = 0;
 
 		std::vector<ped_item> peds{};
 		std::vector<vehicle_item> vehicles{};
-		//std::vector<weapon_item> weapons;
 		std::unordered_map<Hash, weapon_item_parsed> weapons{};
 		std::vector<weapon_component> weapon_components{};
 
-		constexpr auto exists = [](const hash_array& arr, uint32_t val) -> bool {
-			return std::find(arr.begin(), arr.end(), val) != arr.end();
+		const auto wait = [this] {
+			if (state() == eGtaDataUpdateState::UPDATING)
+				script::get_current()->yield();
+			else
+				std::this_thread::sleep_for(100ms);
 		};
 
 		constexpr Hash script_hash = "MP_Weapons"_J;
@@ -314,245 +663,54 @@ namespace big
 		}
 
 		LOG(INFO) << "Rebuilding cache started...";
+
+		// only collect the files here, the fiPackfiles can't be used from another thread
+		meta_file_parser parser(std::clamp(std::thread::hardware_concurrency() / 2, 2u, 4u));
+		size_t file_count = 0;
 		yim_fipackfile::add_wrapper_call_back([&](yim_fipackfile& rpf_wrapper, std::filesystem::path path) -> void {
+			auto file = meta_file{file_count};
+
 			if (path.filename() == "vehicles.meta")
 			{
-				rpf_wrapper.read_xml_file(path, [&exists, &vehicles, &mapped_vehicles](pugi::xml_document& doc) {
-					const auto& items = doc.select_nodes("/CVehicleModelInfo__InitDataList/InitDatas/Item");
-					for (const auto& item_node : items)
-					{
-						const auto item = item_node.node();
-
-						std::string name = item.child("modelName").text().as_string();
-						std::transform(name.begin(), name.end(), name.begin(), ::toupper);
-						const auto hash = rage::joaat(name);
-						if (protection::is_crash_vehicle(hash))
-							continue;
-
-						if (exists(mapped_vehicles, hash))
-							continue;
-						mapped_vehicles.emplace_back(hash);
-
-						auto veh = vehicle_item{};
-						std::strncpy(veh.m_name, name.c_str(), sizeof(veh.m_name));
-
-						const auto manufacturer_display = item.child("vehicleMakeName").text().as_string();
-						std::strncpy(veh.m_display_manufacturer, manufacturer_display, sizeof(veh.m_display_manufacturer));
-
-						const auto game_name = item.child("gameName").text().as_string();
-						std::strncpy(veh.m_display_name, game_name, sizeof(veh.m_display_name));
-
-						const auto vehicle_class       = item.child("vehicleClass").text().as_string();
-						constexpr auto enum_prefix_len = 3;
-						if (std::strlen(vehicle_class) > enum_prefix_len)
-							std::strncpy(veh.m_vehicle_class, vehicle_class + enum_prefix_len, sizeof(veh.m_vehicle_class));
-
-						veh.m_hash = hash;
-
-						vehicles.emplace_back(std::move(veh));
-					}
-				});
+				file.m_type = meta_file_type::VEHICLES;
 			}
 			else if (const auto file_str = path.string(); file_str.find("weaponcomponents") != std::string::npos && path.extension() == ".meta")
 			{
-				rpf_wrapper.read_xml_file(path, [&exists, &weapon_components, &mapped_components, &mp_weapons_thread_id](pugi::xml_document& doc) {
-					const auto& items = doc.select_nodes("/CWeaponComponentInfoBlob/Infos/*[self::Item[@type='CWeaponComponentInfo'] or self::Item[@type='CWeaponComponentFlashLightInfo'] or self::Item[@type='CWeaponComponentScopeInfo'] or self::Item[@type='CWeaponComponentSuppressorInfo'] or self::Item[@type='CWeaponComponentVariantModelInfo'] or self::Item[@type='CWeaponComponentClipInfo']]");
-					for (const auto& item_node : items)
-					{
-						const auto item        = item_node.node();
-						const std::string name = item.child("Name").text().as_string();
-						const auto hash        = rage::joaat(name);
-
-						if (!name.starts_with("COMPONENT") || name.ends_with("MK2_UPGRADE"))
-						{
-							continue;
-						}
-
-						if (exists(mapped_components, hash))
-						{
-							continue;
-						}
-						mapped_components.emplace_back(hash);
-
-						std::string LocName = item.child("LocName").text().as_string();
-						std::string LocDesc = item.child("LocDesc").text().as_string();
-
-						if (LocName.ends_with("RAIL"))
-							continue;
-
-						if (LocName.ends_with("INVALID"))
-						{
-							Hash weapon_hash = 0;
-							if (name.starts_with("COMPONENT_KNIFE"))
-								weapon_hash = "WEAPON_KNIFE"_J;
-							else if (name.starts_with("COMPONENT_KNUCKLE"))
-								weapon_hash = "WEAPON_KNUCKLE"_J;
-							else if (name.starts_with("COMPONENT_BAT"))
-								weapon_hash = "WEAPON_BAT"_J;
-							const auto display_string = scr_functions::get_component_name_string.call<const char*>(hash, weapon_hash);
-							if (display_string == nullptr)
-								continue;
-							LocName = display_string;
-						}
-
-						if (LocName.ends_with("INVALID"))
-							continue;
-
-						if (LocDesc.ends_with("INVALID"))
-						{
-							const auto display_string = scr_functions::get_component_desc_string.call<const char*>(hash, 0);
-							if (display_string != nullptr)
-								LocDesc = display_string;
-						}
-
-						if (LocDesc.ends_with("INVALID"))
-							LocDesc.clear();
-
-						weapon_component component;
-
-						component.m_name         = name;
-						component.m_hash         = hash;
-						component.m_display_name = LocName;
-						component.m_display_desc = LocDesc;
-
-						weapon_components.push_back(component);
-					}
-				});
+				file.m_type = meta_file_type::WEAPON_COMPONENTS;
 			}
 			else if (const auto file_str = path.string(); file_str.contains("weapon") && !file_str.contains("vehicle") && path.extension() == ".meta")
 			{
-				rpf_wrapper.read_xml_file(path, [&exists, &weapons, &mapped_weapons, file_str, &rpf_wrapper](pugi::xml_document& doc) {
-					const auto& items = doc.select_nodes("/CWeaponInfoBlob/Infos/Item/Infos/Item[@type='CWeaponInfo']");
-					for (const auto& item_node : items)
-					{
-						const auto item = item_node.node();
-						const auto name = item.child("Name").text().as_string();
-						const auto hash = rage::joaat(name);
-
-						if (hash == "WEAPON_BIRD_CRAP"_J)
-							continue;
-
-						if (!exists(mapped_weapons, hash))
-							mapped_weapons.emplace_back(hash);
-
-						const auto human_name_hash = item.child("HumanNameHash").text().as_string();
-						if (std::strcmp(human_name_hash, "WT_INVALID") == 0 || std::strcmp(human_name_hash, "WT_VEHMINE") == 0)
-							continue;
-
-						std::string desc = scr_functions::get_weapon_desc_string.call<const char*>(hash, false);
-						if (desc.ends_with("INVALID"))
-							desc.clear();
-
-						auto weapon = weapon_item_parsed{};
-
-						weapon.m_name         = name;
-						weapon.m_display_name = human_name_hash;
-						weapon.m_display_desc = desc;
-						weapon.rpf_file_type  = determine_file_type(file_str, rpf_wrapper.get_name());
-
-						auto weapon_flags = std::string(item.child("WeaponFlags").text().as_string());
-
-						bool is_gun         = false;
-						bool is_rechargable = false;
-
-						const char* category = "";
-
-						std::size_t pos;
-						while ((pos = weapon_flags.find(' ')) != std::string::npos)
-						{
-							const auto flag = weapon_flags.substr(0, pos);
-							if (flag == "Thrown")
-							{
-								weapon.m_throwable = true;
-							}
-							else if (flag == "Gun")
-							{
-								is_gun = true;
-							}
-							else if (flag == "DisplayRechargeTimeHUD")
-							{
-								is_rechargable = true;
-							}
-							else if (flag == "Vehicle" || flag == "HiddenFromWeaponWheel" || flag == "NotAWeapon")
-							{
-								goto skip;
-							}
-
-							weapon_flags.erase(0, pos + 1);
-						}
-
-						category = item.child("Group").text().as_string();
-
-						if (std::strlen(category) == 0 || std::strcmp(category, "GROUP_DIGISCANNER") == 0)
-							continue;
-
-						if (std::strlen(category) > 6)
-						{
-							weapon.m_weapon_type = category + 6;
-						}
-
-						if (is_gun || weapon.m_weapon_type == "MELEE" || weapon.m_weapon_type == "UNARMED")
-						{
-							const std::string reward_prefix = "REWARD_";
-							weapon.m_reward_hash            = rage::joaat(reward_prefix + name);
-
-							if (is_gun && !is_rechargable)
-							{
-								std::string weapon_id     = name + 7;
-								weapon.m_reward_ammo_hash = rage::joaat(reward_prefix + "AMMO_" + weapon_id);
-							}
-						}
-
-						for (pugi::xml_node attach_point : item.child("AttachPoints").children("Item"))
-						{
-							for (pugi::xml_node component : attach_point.child("Components").children("Item"))
-							{
-								weapon.m_attachments.push_back(component.child_value("Name"));
-							}
-						}
-
-						weapon.m_hash = hash;
-
-						if (weapons.contains(hash))
-						{
-							if (weapons[hash].rpf_file_type > weapon.rpf_file_type)
-							{
-								continue;
-							}
-						}
-
-						weapons[hash] = weapon;
-					skip:
-						continue;
-					}
-				});
+				file.m_type   = meta_file_type::WEAPONS;
+				file.m_source = determine_file_type(file_str, rpf_wrapper.get_name());
 			}
 			else if (path.filename() == "peds.meta")
 			{
-				rpf_wrapper.read_xml_file(path, [&exists, &peds, &mapped_peds](pugi::xml_document& doc) {
-					parse_ped(peds, mapped_peds, doc);
-				});
+				file.m_type = meta_file_type::PEDS;
 			}
 			else if (std::string str = rpf_wrapper.get_name(); (str.find("componentpeds") != std::string::npos || str.find("streamedpeds") != std::string::npos || str.find("mppatches") != std::string::npos || str.find("cutspeds") != std::string::npos) && path.extension() == ".yft")
 			{
-				const auto name = path.stem().string();
-				const auto hash = rage::joaat(name);
-
-				if (protection::is_crash_ped(hash))
-					return;
-
-				if (std::find(mapped_peds.begin(), mapped_peds.end(), hash) != mapped_peds.end())
-					return;
-
-				mapped_peds.emplace_back(hash);
-
-				auto ped = ped_item{};
+				file.m_type     = meta_file_type::PED_MODEL;
+				file.m_ped_name = path.stem().string();
 
-				std::strncpy(ped.m_name, name.c_str(), sizeof(ped.m_name));
+				parser.push(std::move(file));
+				file_count++;
+				return;
+			}
+			else
+			{
+				return;
+			}
 
-				ped.m_hash = hash;
+			rpf_wrapper.read_file(path, [&file](const std::unique_ptr<uint8_t[]>& file_content, const int data_size) {
+				file.m_content = std::make_unique<uint8_t[]>(data_size);
+				std::memcpy(file.m_content.get(), file_content.get(), data_size);
+				file.m_content_size = data_size;
+			});
 
-				peds.emplace_back(std::move(ped));
+			if (file.m_content)
+			{
+				parser.push(std::move(file));
+				file_count++;
 			}
 		});
 
@@ -561,9 +719,47 @@ namespace big
 			yim_fipackfile::for_each_fipackfile();
 		}
 
-		if (mp_weapons_thread_id != 0)
+		parser.finish();
+		while (!parser.done())
+			wait();
+
+		// merge in the order the files were found, the first occurrence of a model wins
+		std::unordered_set<uint32_t> mapped_peds{};
+		std::unordered_set<uint32_t> mapped_vehicles{};
+		std::unordered_set<uint32_t> mapped_components{};
+		for (auto& [index, items] : parser.results())
 		{
-			SCRIPT::TERMINATE_THREAD(mp_weapons_thread_id);
+			for (auto& ped : items.m_peds)
+			{
+				if (protection::is_crash_ped(ped.m_hash) || !mapped_peds.insert(ped.m_hash).second)
+					continue;
+
+				peds.emplace_back(std::move(ped));
+			}
+
+			for (auto& veh : items.m_vehicles)
+			{
+				if (protection::is_crash_vehicle(veh.m_hash) || !mapped_vehicles.insert(veh.m_hash).second)
+					continue;
+
+				vehicles.emplace_back(std::move(veh));
+			}
+
+			for (auto& component : items.m_weapon_components)
+			{
+				if (!mapped_components.insert(component.m_hash).second)
+					continue;
+
+				weapon_components.emplace_back(std::move(component));
+			}
+
+			for (auto& weapon : items.m_weapons)
+			{
+				if (const auto it = weapons.find(weapon.m_hash); it != weapons.end() && it->second.rpf_file_type > weapon.rpf_file_type)
+					continue;
+
+				weapons[weapon.m_hash] = std::move(weapon);
+			}
 		}
 
 		static bool translate_label = false;
@@ -579,20 +775,31 @@ namespace big
 			}
 			for (auto& item : weapons)
 			{
+				std::string desc = scr_functions::get_weapon_desc_string.call<const char*>(item.first, false);
+				if (desc.ends_with("INVALID"))
+					desc.clear();
+
 				item.second.m_display_name = HUD::GET_FILENAME_FOR_AUDIO_CONVERSATION(item.second.m_display_name.c_str());
-				item.second.m_display_desc = HUD::GET_FILENAME_FOR_AUDIO_CONVERSATION(item.second.m_display_desc.c_str());
+				item.second.m_display_desc = HUD::GET_FILENAME_FOR_AUDIO_CONVERSATION(desc.c_str());
 				if (item.second.m_display_desc == "NULL")
 					item.second.m_display_desc.clear();
 			}
-			for (auto& item : weapon_components)
+			for (auto it = weapon_components.begin(); it != weapon_components.end();)
 			{
-				item.m_display_name = HUD::GET_FILENAME_FOR_AUDIO_CONVERSATION(item.m_display_name.c_str());
-				if (!item.m_display_desc.empty())
+				if (!resolve_component_labels(*it))
 				{
-					item.m_display_desc = HUD::GET_FILENAME_FOR_AUDIO_CONVERSATION(item.m_display_desc.c_str());
-					if (item.m_display_desc == "NULL")
-						item.m_display_desc.clear();
+					it = weapon_components.erase(it);
+					continue;
 				}
+
+				it->m_display_name = HUD::GET_FILENAME_FOR_AUDIO_CONVERSATION(it->m_display_name.c_str());
+				if (!it->m_display_desc.empty())
+				{
+					it->m_display_desc = HUD::GET_FILENAME_FOR_AUDIO_CONVERSATION(it->m_display_desc.c_str());
+					if (it->m_display_desc == "NULL")
+						it->m_display_desc.clear();
+				}
+				++it;
 			}
 			for (auto it = peds.begin(); it != peds.end();)
 			{
@@ -604,18 +811,18 @@ namespace big
 				}
 				else
 				{
-					peds.erase(it);
+					it = peds.erase(it);
 				}
 			}
 			translate_label = true;
-		});
+		}, fiber_pool_priority::LOW);
 
 		while (!translate_label)
+			wait();
+
+		if (mp_weapons_thread_id != 0)
 		{
-			if (state() == eGtaDataUpdateState::UPDATING)
-				script::get_current()->yield();
-			else
-				std::this_thread::sleep_for(100ms);
+			SCRIPT::TERMINATE_THREAD(mp_weapons_thread_id);
 		}
 
 		m_update_state = eGtaDataUpdateState::IDLE;
@@ -628,8 +835,9 @@ namespace big
 
 			{
 				const auto data_size = sizeof(ped_item) * peds.size();
-				m_peds_cache.set_data(std::make_unique<uint8_t[]>(data_size), data_size);
-				std::memcpy(m_peds_cache.data(), peds.data(), data_size);
+				auto data            = std::make_unique<uint8_t[]>(data_size);
+				std::memcpy(data.get(), peds.data(), data_size);
+				m_peds_cache.set_data(std::move(data), data_size);
 
 				m_peds_cache.set_header_version(file_version);
 				m_peds_cache.write();
@@ -637,8 +845,9 @@ namespace big
 
 			{
 				const auto data_size = sizeof(vehicle_item) * vehicles.size();
-				m_vehicles_cache.set_data(std::make_unique<uint8_t[]>(data_size), data_size);
-				std::memcpy(m_vehicles_cache.data(), vehicles.data(), data_size);
+				auto data            = std::make_unique<uint8_t[]>(data_size);
+				std::memcpy(data.get(), vehicles.data(), data_size);
+				m_vehicles_cache.set_data(std::move(data), data_size);
 
 				m_vehicles_cache.set_header_version(file_version);
 				m_vehicles_cache.write();
@@ -649,19 +858,32 @@ namespace big
 				m_weapons_cache.version_info.m_online_version = g_pointers->m_gta.m_online_version;
 				m_weapons_cache.version_info.m_file_version   = file_version;
 
-				m_weapon_types.clear();
-				m_weapon_types.reserve(weapons.size());
-				m_weapons_cache.weapon_map.clear();
+				string_vec weapon_types;
+				weapon_types.reserve(weapons.size());
+				std::map<std::string, weapon_item> weapon_map;
 				for (auto weapon : weapons)
 				{
-					add_if_not_exists(m_weapon_types, weapon.second.m_weapon_type);
-					m_weapons_cache.weapon_map.insert({weapon.second.m_name, weapon.second});
+					add_if_not_exists(weapon_types, weapon.second.m_weapon_type);
+					weapon_map.insert({weapon.second.m_name, weapon.second});
 				}
 
-				m_weapons_cache.weapon_components.clear();
+				std::map<std::string, weapon_component> component_map;
 				for (auto weapon_component : weapon_components)
 				{
-					m_weapons_cache.weapon_components.insert({weapon_component.m_name, weapon_component});
+					component_map.insert({weapon_component.m_name, weapon_component});
+				}
+
+				hash_index<weapon_item> weapon_index;
+				weapon_index.build(weapon_map);
+				hash_index<weapon_component> component_index;
+				component_index.build(component_map);
+				{
+					std::unique_lock lock(m_index_mutex);
+					m_weapon_types.swap(weapon_types);
+					m_weapons_cache.weapon_map.swap(weapon_map);
+					m_weapons_cache.weapon_components.swap(component_map);
+					m_weapon_index           = std::move(weapon_index);
+					m_weapon_component_index = std::move(component_index);
 				}
 
 				auto weapons_file = g_file_manager.get_project_file("./cache/weapons.json");
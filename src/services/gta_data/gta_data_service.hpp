@@ -1,9 +1,12 @@
 #pragma once
 #include "cache_file.hpp"
+#include "hash_index.hpp"
 #include "ped_item.hpp"
 #include "vehicle_item.hpp"
 #include "weapon_file.hpp"
 
+#include <shared_mutex>
+
 namespace big
 {
 	enum class eGtaDataUpdateState
@@ -41,6 +44,12 @@ namespace big
 		string_vec& vehicle_classes();
 		string_vec& weapon_types();
 
+		// changes whenever the data below gets reloaded, lets views cache what they derive from it
+		std::uint32_t generation() const
+		{
+			return m_generation;
+		}
+
 		ped_map& peds()
 		{
 			return m_peds;
@@ -77,11 +86,20 @@ namespace big
 		ped_map m_peds;
 		vehicle_map m_vehicles;
 
+		// new maps are built on the side and swapped in together with their index under m_index_mutex,
+		// so that the *_by_hash lookups never see an index pointing into a map being refilled
+		std::shared_mutex m_index_mutex;
+		hash_index<ped_item> m_ped_index;
+		hash_index<vehicle_item> m_vehicle_index;
+		hash_index<weapon_item> m_weapon_index;
+		hash_index<weapon_component> m_weapon_component_index;
+
 		string_vec m_ped_types;
 		string_vec m_vehicle_classes;
 		string_vec m_weapon_types;
 
 		eGtaDataUpdateState m_update_state;
+		std::uint32_t m_generation = 0;
 
 	private:
 		static constexpr ped_item empty_ped{};
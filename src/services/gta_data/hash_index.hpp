@@ -0,0 +1,42 @@
+#pragma once
+
+namespace big
+{
+	/// <summary>
+	/// Sorted (hash, item) pairs over a map of items, the map keeps ownership of the items.
+	/// Must be rebuilt whenever items are removed from the map.
+	/// </summary>
+	template<typename T>
+	class hash_index final
+	{
+	public:
+		template<typename Map>
+		void build(const Map& map)
+		{
+			m_entries.clear();
+			m_entries.reserve(map.size());
+			for (const auto& [key, item] : map)
+				m_entries.emplace_back(item.m_hash, &item);
+
+			// stable so that duplicate hashes resolve to the first item in map order, like the linear search did
+			std::stable_sort(m_entries.begin(), m_entries.end(), [](const auto& a, const auto& b) {
+				return a.first < b.first;
+			});
+		}
+
+		const T* find(uint32_t hash) const
+		{
+			const auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash, [](const auto& entry, uint32_t value) {
+				return entry.first < value;
+			});
+
+			if (it == m_entries.end() || it->first != hash)
+				return nullptr;
+
+			return it->second;
+		}
+
+	private:
+		std::vector<std::pair<uint32_t, const T*>> m_entries;
+	};
+}
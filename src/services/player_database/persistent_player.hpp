@@ -66,6 +66,7 @@ namespace big
 		std::string game_mode_name         = "VIEW_NET_PLAYER_DB_GAME_MODE_UNKNOWN"_T.data();
 		std::string game_mode_id           = "";
 		rage::rlSessionInfo redirect_info{};
+		std::chrono::steady_clock::time_point last_presence_update{};
 
 		NLOHMANN_DEFINE_TYPE_INTRUSIVE_WITH_DEFAULT(persistent_player, name, rockstar_id, block_join, block_join_reason, is_modder, is_trusted, notify_online, infractions, custom_infraction_reason, notes, command_access_level, join_redirect, join_redirect_preference)
 
@@ -12,6 +12,65 @@ namespace big
 	bool_command g_player_db_auto_update_online_states("player_db_auto_update_states", "AUTO_UPDATE_STATES", "AUTO_UPDATE_STATES_DESC",
 	    g.player_db.update_player_online_states);
 
+	// fixed size query state for one call to m_start_get_presence_attributes, kept around so every poll reuses the same buffers
+	struct player_database_service::presence_query
+	{
+		static constexpr std::size_t max_players    = 100;
+		static constexpr std::size_t attribute_count = 9;
+
+		std::vector<std::shared_ptr<persistent_player>> m_players;
+		std::vector<rage::rlScHandle> m_handles;
+		rage::rlQueryPresenceAttributesContext m_contexts[max_players][attribute_count]{};
+		rage::rlQueryPresenceAttributesContext* m_contexts_per_player[max_players]{};
+		rage::rlScTaskStatus m_status{};
+
+		presence_query()
+		{
+			m_players.reserve(max_players);
+			m_handles.reserve(max_players);
+		}
+
+		void reset()
+		{
+			m_players.clear();
+			m_handles.clear();
+			m_status = {};
+
+			for (std::size_t i = 0; i < max_players; i++)
+			{
+				auto contexts = m_contexts[i];
+				for (std::size_t j = 0; j < attribute_count; j++)
+					contexts[j] = {};
+
+				contexts[0].m_presence_attibute_type = 1;
+				strcpy(contexts[0].m_presence_attribute_key, "gstype");
+				contexts[0].m_presence_attribute_int_value = -1;
+				contexts[1].m_presence_attibute_type       = 3;
+				strcpy(contexts[1].m_presence_attribute_key, "gsinfo");
+				contexts[2].m_presence_attibute_type = 1;
+				strcpy(contexts[2].m_presence_attribute_key, "sctv");
+				contexts[3].m_presence_attibute_type = 1;
+				strcpy(contexts[3].m_presence_attribute_key, "gshost");
+				contexts[4].m_presence_attibute_type = 3;
+				strcpy(contexts[4].m_presence_attribute_key, "trinfo");
+				contexts[5].m_presence_attibute_type = 1;
+				strcpy(contexts[5].m_presence_attribute_key, "trhost");
+				contexts[6].m_presence_attibute_type = 3;
+				strcpy(contexts[6].m_presence_attribute_key, "mp_mis_str");
+				contexts[7].m_presence_attibute_type = 3;
+				strcpy(contexts[7].m_presence_attribute_key, "mp_mis_id");
+				contexts[8].m_presence_attibute_type = 1;
+				strcpy(contexts[8].m_presence_attribute_key, "mp_curr_gamemode");
+				m_contexts_per_player[i] = contexts;
+			}
+		}
+
+		bool start()
+		{
+			return g_pointers->m_sc.m_start_get_presence_attributes(0, m_handles.data(), m_handles.size(), m_contexts_per_player, attribute_count, &m_status);
+		}
+	};
+
 	const char* player_database_service::get_name_by_content_id(const std::string& content_id)
 	{
 		if (NETWORK::UGC_QUERY_BY_CONTENT_ID(content_id.c_str(), false, "gta5mission"))
@@ -133,11 +192,92 @@ namespace big
 		}
 	}
 
+	// amount of journal records after which they get merged into the snapshot
+	constexpr std::size_t journal_compaction_threshold = 1000;
+
+	static std::filesystem::path get_rotated_journal_path(std::filesystem::path journal_path)
+	{
+		return journal_path += ".old";
+	}
+
+	static nlohmann::json read_snapshot(const std::filesystem::path& path)
+	{
+		if (!std::filesystem::exists(path))
+			return nlohmann::json::object();
+
+		std::ifstream file_stream(path);
+
+		nlohmann::json json;
+		file_stream >> json;
+
+		return json;
+	}
+
+	// applies the records of a journal to a snapshot, a record cut off by a crash ends the replay
+	static std::size_t replay_journal(const std::filesystem::path& path, nlohmann::json& snapshot)
+	{
+		std::ifstream file_stream(path);
+
+		std::size_t records = 0;
+		for (std::string line; std::getline(file_stream, line);)
+		{
+			if (line.empty())
+				continue;
+
+			try
+			{
+				const auto record = nlohmann::json::parse(line);
+				const auto key    = std::to_string(record["rid"].get<uint64_t>());
+
+				if (record["op"] == "put")
+					snapshot[key] = record["player"];
+				else
+					snapshot.erase(key);
+
+				records++;
+			}
+			catch (const std::exception& e)
+			{
+				LOG(WARNING) << "Ignoring the rest of the player database journal, found an incomplete record. " << e.what();
+				break;
+			}
+		}
+
+		return records;
+	}
+
+	static bool write_snapshot(const std::filesystem::path& path, const nlohmann::json& snapshot)
+	{
+		auto temp_path = path;
+		temp_path += ".tmp";
+
+		std::ofstream file_stream(temp_path, std::ios::out | std::ios::trunc);
+		file_stream << snapshot;
+		file_stream.close();
+
+		if (!file_stream)
+			return false;
+
+		std::error_code ec;
+		std::filesystem::rename(temp_path, path, ec);
+		if (ec)
+		{
+			LOG(WARNING) << "Failed to replace the player database: " << ec.message();
+			return false;
+		}
+
+		return true;
+	}
+
 	player_database_service::player_database_service() :
+	    m_journal_path(g_file_manager.get_project_file("./players.journal").get_path()),
 	    m_file_path(g_file_manager.get_project_file("./players.json").get_path())
 	{
 		load();
 
+		if (m_journal_records)
+			compact_journal();
+
 		start_update_loop();
 
 		g_player_database_service = this;
@@ -145,6 +285,12 @@ namespace big
 
 	player_database_service::~player_database_service()
 	{
+		// waits for a running compaction, a queued one is dropped and its rotated journal gets replayed on the next load
+		{
+			std::lock_guard lock(m_compaction_state->m_mutex);
+			m_compaction_state->m_cancelled = true;
+		}
+
 		g_player_database_service = nullptr;
 	}
 
@@ -157,38 +303,137 @@ namespace big
 			json[std::to_string(rid)] = player;
 		}
 
-		std::ofstream file_stream(m_file_path);
-		file_stream << json;
+		std::lock_guard snapshot_lock(m_snapshot_mutex);
+		std::lock_guard journal_lock(m_journal_mutex);
+
+		if (!write_snapshot(m_file_path, json))
+			return;
+
+		// everything journaled so far is part of the snapshot now
+		m_journal.close();
+		m_journal.open(m_journal_path, std::ios::out | std::ios::trunc);
+		m_journal_records = 0;
+
+		std::error_code ec;
+		std::filesystem::remove(get_rotated_journal_path(m_journal_path), ec);
 	}
 
-	void player_database_service::load()
+	void player_database_service::save(const std::shared_ptr<persistent_player>& player)
 	{
-		m_selected = nullptr;
-		if (std::filesystem::exists(m_file_path))
+		if (!player)
+			return;
+
+		append_to_journal({{"op", "put"}, {"rid", player->rockstar_id}, {"player", player}});
+		m_generation++;
+	}
+
+	void player_database_service::append_to_journal(const nlohmann::json& record)
+	{
+		bool compact;
 		{
-			try
-			{
-				std::ifstream file_stream(m_file_path);
+			std::lock_guard lock(m_journal_mutex);
+
+			// one record per line, flushed right away so a crash loses at most the record being written
+			m_journal << record.dump() << '\n' << std::flush;
+			compact = ++m_journal_records >= journal_compaction_threshold;
+		}
 
-				nlohmann::json json;
-				file_stream >> json;
-				file_stream.close();
+		if (compact)
+			compact_journal();
+	}
 
-				for (auto& [key, value] : json.items())
-				{
-					auto player                = value.get<std::shared_ptr<persistent_player>>();
-					m_players[std::stoll(key)] = player;
+	void player_database_service::compact_journal()
+	{
+		if (m_compacting.exchange(true))
+			return;
 
-					std::string lower = player->name;
-					std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-					m_sorted_players[lower] = player;
-				}
+		// new records go to a fresh journal while the rotated one is merged into the snapshot
+		{
+			std::lock_guard lock(m_journal_mutex);
+
+			m_journal.close();
+
+			std::error_code ec;
+			const auto rotated_path = get_rotated_journal_path(m_journal_path);
+			if (std::filesystem::exists(rotated_path))
+			{
+				// left behind by an interrupted compaction, it has to be merged before the current journal
+				std::ofstream rotated(rotated_path, std::ios::out | std::ios::app);
+				rotated << std::ifstream(m_journal_path).rdbuf();
+				rotated.close();
+				std::filesystem::remove(m_journal_path, ec);
+			}
+			else
+			{
+				std::filesystem::rename(m_journal_path, rotated_path, ec);
 			}
-			catch (std::exception& e)
+
+			m_journal.open(m_journal_path, std::ios::out | std::ios::app);
+			m_journal_records = 0;
+		}
+
+		g_thread_pool->push(
+		    [this, state = m_compaction_state] {
+			    std::lock_guard state_lock(state->m_mutex);
+			    if (state->m_cancelled)
+				    return;
+
+			    std::lock_guard lock(m_snapshot_mutex);
+
+			    const auto rotated_path = get_rotated_journal_path(m_journal_path);
+			    try
+			    {
+				    auto snapshot = read_snapshot(m_file_path);
+				    replay_journal(rotated_path, snapshot);
+
+				    if (write_snapshot(m_file_path, snapshot))
+					    std::filesystem::remove(rotated_path);
+			    }
+			    catch (const std::exception& e)
+			    {
+				    LOG(WARNING) << "Failed to compact the player database journal. " << e.what();
+			    }
+
+			    m_compacting = false;
+		    },
+		    thread_pool_priority::LOW);
+	}
+
+	void player_database_service::load()
+	{
+		m_selected = nullptr;
+
+		std::lock_guard snapshot_lock(m_snapshot_mutex);
+		std::lock_guard journal_lock(m_journal_mutex);
+
+		std::size_t journal_records = 0;
+		try
+		{
+			auto json = read_snapshot(m_file_path);
+
+			// whatever didn't make it into the snapshot before the last unload or crash
+			journal_records += replay_journal(get_rotated_journal_path(m_journal_path), json);
+			journal_records += replay_journal(m_journal_path, json);
+
+			for (auto& [key, value] : json.items())
 			{
-				LOG(WARNING) << "Failed to load player database file. " << e.what();
+				auto player                = value.get<std::shared_ptr<persistent_player>>();
+				m_players[std::stoll(key)] = player;
+
+				std::string lower = player->name;
+				std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+				m_sorted_players[lower] = player;
 			}
 		}
+		catch (std::exception& e)
+		{
+			LOG(WARNING) << "Failed to load player database file. " << e.what();
+		}
+		m_generation++;
+
+		m_journal.close();
+		m_journal.open(m_journal_path, std::ios::out | std::ios::app);
+		m_journal_records = journal_records;
 	}
 
 	std::unordered_map<uint64_t, std::shared_ptr<persistent_player>>& player_database_service::get_players()
@@ -201,6 +446,11 @@ namespace big
 		return m_sorted_players;
 	}
 
+	uint32_t player_database_service::generation() const
+	{
+		return m_generation;
+	}
+
 	std::shared_ptr<persistent_player> player_database_service::add_player(std::int64_t rid, const std::string_view name)
 	{
 		std::string lower = name.data();
@@ -214,6 +464,7 @@ namespace big
 		m_players[rid] = player;
 
 		m_sorted_players[lower] = player;
+		m_generation++;
 
 		return player;
 	}
@@ -226,6 +477,7 @@ namespace big
 			if ((filter_modder && player->is_modder) || (filter_trust && player->is_trusted)
 			    || (filter_block_join && player->block_join) || (filter_track_player && player->notify_online))
 			{
+				append_to_journal({{"op", "del"}, {"rid", it->first}});
 				it = m_players.erase(it);
 			}
 			else
@@ -247,6 +499,8 @@ namespace big
 				++it;
 			}
 		}
+
+		m_generation++;
 	}
 
 	std::shared_ptr<persistent_player> player_database_service::get_player_by_rockstar_id(uint64_t rockstar_id)
@@ -263,7 +517,7 @@ namespace big
 		else
 		{
 			auto player_ptr = add_player(player->get_rockstar_id(), player->get_name());
-			save();
+			save(player_ptr);
 			return player_ptr;
 		}
 	}
@@ -273,6 +527,9 @@ namespace big
 		auto player  = m_players.extract(old);
 		player.key() = _new;
 
+		// the caller saves the player under its new id
+		append_to_journal({{"op", "del"}, {"rid", old}});
+
 		m_players.insert(std::move(player));
 	}
 
@@ -288,6 +545,9 @@ namespace big
 
 			m_sorted_players.erase(lower);
 			m_players.erase(it);
+			m_generation++;
+
+			append_to_journal({{"op", "del"}, {"rid", rockstar_id}});
 		}
 	}
 
@@ -301,6 +561,11 @@ namespace big
 		return m_selected;
 	}
 
+	static bool is_tracked(const persistent_player& player)
+	{
+		return player.notify_online || player.join_redirect;
+	}
+
 	void player_database_service::start_update_loop()
 	{
 		// So that it doesnt immediately exit the first time.
@@ -323,18 +588,15 @@ namespace big
 				first_time = false;
 			}
 
-			static auto last_update = std::chrono::high_resolution_clock::now() - 45s;
-
 			while (g_running && g.player_db.update_player_online_states)
 			{
-				const auto cur = std::chrono::high_resolution_clock::now();
-				if (cur - last_update > 45s && !updating)
+				if (!updating && std::chrono::steady_clock::now() >= m_next_presence_poll.load())
 				{
 					updating = true;
 					g_fiber_pool->queue_job([this] {
-						update_player_states(true);
+						poll_stale_players();
+						update_presence_stats();
 						updating = false;
-						last_update = std::chrono::high_resolution_clock::now();
 					});
 				}
 
@@ -343,188 +605,293 @@ namespace big
 		});
 	}
 
+	void player_database_service::poll_stale_players()
+	{
+		const auto now = std::chrono::steady_clock::now();
+
+		std::vector<std::shared_ptr<persistent_player>> players;
+		for (auto& [rid, player] : m_players)
+		{
+			if (is_tracked(*player) && player->rockstar_id != 0 && ((int64_t)player->rockstar_id) > 0)
+				players.push_back(player);
+		}
+
+		m_next_presence_poll = now + presence_poll_step + m_presence_backoff.load();
+
+		if (players.empty())
+			return;
+
+		// every tracked player gets polled once per presence_poll_interval, spread over the steps in between
+		// instead of querying all of them in a single burst
+		constexpr std::size_t steps_per_interval = presence_poll_interval / presence_poll_step;
+		auto count = (players.size() + steps_per_interval - 1) / steps_per_interval;
+
+		const auto overdue = std::count_if(players.begin(), players.end(), [now](const auto& player) {
+			return now - player->last_presence_update >= presence_poll_interval;
+		});
+		count = std::min<std::size_t>(std::max<std::size_t>(count, overdue), presence_query::max_players * max_presence_queries);
+
+		std::partial_sort(players.begin(), players.begin() + std::min(count, players.size()), players.end(), [](const auto& a, const auto& b) {
+			return a->last_presence_update < b->last_presence_update;
+		});
+		players.resize(std::min(count, players.size()));
+
+		query_player_states(players);
+	}
+
 	void player_database_service::update_player_states(bool tracked_only)
 	{
-		constexpr auto bucket_size = 100;
+		std::vector<std::shared_ptr<persistent_player>> players;
+		for (auto& [rid, player] : m_players)
+		{
+			if ((!tracked_only || is_tracked(*player)) && player->rockstar_id != 0 && ((int64_t)player->rockstar_id) > 0)
+				players.push_back(player);
+		}
 
-		std::vector<std::vector<rage::rlScHandle>> gamer_handle_buckets{};
+		// players we notify about go first, the rest from the longest ago polled to the most recent
+		std::sort(players.begin(), players.end(), [](const auto& a, const auto& b) {
+			if (is_tracked(*a) != is_tracked(*b))
+				return is_tracked(*a);
+			return a->last_presence_update < b->last_presence_update;
+		});
 
-		size_t i = 0;
-		for (auto& player : m_players)
+		// the query buffers are shared with the update loop
+		while (updating.exchange(true))
+			script::get_current()->yield();
+
+		query_player_states(players);
+		updating = false;
+	}
+
+	void player_database_service::query_player_states(const std::vector<std::shared_ptr<persistent_player>>& players)
+	{
+		if (players.empty())
+			return;
+
+		std::size_t next_player = 0;
+		while (next_player < players.size())
 		{
-			if (!tracked_only || (player.second->notify_online || player.second->join_redirect))
+			// a few queries are kept in flight at once so the round trips overlap
+			std::size_t query_count = 0;
+			for (; query_count < max_presence_queries && next_player < players.size(); query_count++)
 			{
-				if (gamer_handle_buckets.size() <= i / bucket_size)
-					gamer_handle_buckets.push_back({});
+				if (m_presence_queries.size() <= query_count)
+					m_presence_queries.push_back(std::make_unique<presence_query>());
 
-				if (player.second->rockstar_id == 0 || ((int64_t)player.second->rockstar_id) < 0)
-					continue;
+				auto& query = *m_presence_queries[query_count];
+				query.reset();
 
-				gamer_handle_buckets[i / bucket_size].push_back(player.second->rockstar_id);
-				i++;
+				for (; query.m_players.size() < presence_query::max_players && next_player < players.size(); next_player++)
+				{
+					query.m_players.push_back(players[next_player]);
+					query.m_handles.push_back(players[next_player]->rockstar_id);
+				}
+
+				if (!query.start())
+					query.m_status.status = 2;
 			}
-		}
 
-		if (i == 0)
-			return;
+			bool pending = true;
+			while (pending)
+			{
+				pending = false;
+				for (std::size_t i = 0; i < query_count; i++)
+					pending |= m_presence_queries[i]->m_status.status == 1;
 
-		for (auto& bucket : gamer_handle_buckets)
-		{
-			rage::rlScTaskStatus status{};
+				if (pending)
+					script::get_current()->yield();
+			}
 
-			// TODO: big sized object on the stack, might be a problem in the future
-			rage::rlQueryPresenceAttributesContext contexts[bucket_size][9]{};
-			rage::rlQueryPresenceAttributesContext* contexts_per_player[bucket_size]{};
+			const auto now = std::chrono::steady_clock::now();
+			bool failed    = false;
+			for (std::size_t i = 0; i < query_count; i++)
+			{
+				auto& query = *m_presence_queries[i];
+				if (query.m_status.status != 3)
+				{
+					failed = true;
+					continue;
+				}
+
+				for (std::size_t j = 0; j < query.m_players.size(); j++)
+				{
+					apply_presence_attributes(*query.m_players[j], query.m_contexts[j]);
+					query.m_players[j]->last_presence_update = now;
+				}
 
-			for (int i = 0; i < bucket.size(); i++)
+				m_presence_history.emplace_back(now, query.m_players.size());
+			}
+
+			if (failed)
 			{
-				contexts[i][0].m_presence_attibute_type = 1;
-				strcpy(contexts[i][0].m_presence_attribute_key, "gstype");
-				contexts[i][0].m_presence_attribute_int_value = -1;
-				contexts[i][1].m_presence_attibute_type       = 3;
-				strcpy(contexts[i][1].m_presence_attribute_key, "gsinfo");
-				contexts[i][2].m_presence_attibute_type = 1;
-				strcpy(contexts[i][2].m_presence_attribute_key, "sctv");
-				contexts[i][3].m_presence_attibute_type = 1;
-				strcpy(contexts[i][3].m_presence_attribute_key, "gshost");
-				contexts[i][4].m_presence_attibute_type = 3;
-				strcpy(contexts[i][4].m_presence_attribute_key, "trinfo");
-				contexts[i][5].m_presence_attibute_type = 1;
-				strcpy(contexts[i][5].m_presence_attribute_key, "trhost");
-				contexts[i][6].m_presence_attibute_type = 3;
-				strcpy(contexts[i][6].m_presence_attribute_key, "mp_mis_str");
-				contexts[i][7].m_presence_attibute_type = 3;
-				strcpy(contexts[i][7].m_presence_attribute_key, "mp_mis_id");
-				contexts[i][8].m_presence_attibute_type = 1;
-				strcpy(contexts[i][8].m_presence_attribute_key, "mp_curr_gamemode");
-				contexts_per_player[i] = contexts[i];
+				// back off exponentially so a failing endpoint doesn't get hammered every step
+				const auto backoff = std::clamp<std::chrono::steady_clock::duration>(m_presence_backoff.load() * 2, presence_poll_step, max_presence_backoff);
+				m_presence_backoff   = backoff;
+				m_next_presence_poll = now + backoff;
+
+				LOG(WARNING) << "Presence attribute endpoint failed, backing off for "
+				             << std::chrono::duration_cast<std::chrono::seconds>(backoff).count() << "s";
+				break;
 			}
 
-			if (g_pointers->m_sc.m_start_get_presence_attributes(0, bucket.data(), bucket.size(), contexts_per_player, 9, &status))
+			m_presence_backoff = std::chrono::steady_clock::duration{};
+		}
+
+		while (!m_presence_history.empty() && std::chrono::steady_clock::now() - m_presence_history.front().first > presence_stats_window)
+			m_presence_history.pop_front();
+
+		handle_join_redirect();
+	}
+
+	void player_database_service::apply_presence_attributes(persistent_player& player, rage::rlQueryPresenceAttributesContext* contexts)
+	{
+		rage::rlSessionInfo info{};
+		rage::rlSessionInfo transition_info{};
+		info.m_session_token            = -1;
+		transition_info.m_session_token = -1;
+		GSType gstype           = (GSType)(int)contexts[0].m_presence_attribute_int_value;
+		bool is_spectating      = (bool)contexts[2].m_presence_attribute_int_value;
+		bool is_host_of_session = (bool)contexts[3].m_presence_attribute_int_value;
+		bool is_host_of_transition_session = (bool)contexts[5].m_presence_attribute_int_value;
+		GameMode game_mode       = (GameMode)contexts[8].m_presence_attribute_int_value;
+		std::string mission_id   = contexts[7].m_presence_attribute_string_value;
+		std::string mission_name = contexts[6].m_presence_attribute_string_value;
+
+		if (contexts[1].m_presence_attribute_string_value[0] == 0
+		    || !g_pointers->m_gta.m_decode_session_info(&info, contexts[1].m_presence_attribute_string_value, nullptr))
+			gstype = GSType::Invalid;
+
+		if (can_fetch_name(game_mode) && mission_name.empty() && mission_id.empty())
+			game_mode = GameMode::None;
+
+		if (contexts[4].m_presence_attribute_string_value[0] == 0
+		    || !g_pointers->m_gta.m_decode_session_info(&transition_info, contexts[4].m_presence_attribute_string_value, nullptr))
+			transition_info.m_session_token = -1;
+
+		if (player.session_type != gstype)
+		{
+			handle_session_type_change(player, gstype);
+		}
+		else if (player.notify_online && player.session_id != info.m_session_token
+		    && g.player_db.notify_on_session_change)
+		{
+			g_notification_service.push("Player DB",
+			    std::format("{} has joined a new session", player.name));
+		}
+
+		if (gstype != GSType::Invalid)
+		{
+			if (player.notify_online && is_spectating != player.is_spectating
+			    && g.player_db.notify_on_spectator_change)
 			{
-				while (status.status == 1)
+				if (is_spectating)
 				{
-					script::get_current()->yield();
+					g_notification_service.push("Player DB",
+					    std::format("{} is now spectating", player.name));
 				}
+				else
+				{
+					g_notification_service.push("Player DB",
+					    std::format("{} is no longer spectating", player.name));
+				}
+			}
 
-				if (status.status == 3)
+			if (player.notify_online && is_host_of_session != player.is_host_of_session
+			    && g.player_db.notify_on_become_host && is_host_of_session && player.session_id == info.m_session_token)
+			{
+				g_notification_service.push("Player DB",
+				    std::format("{} is now the host of their session", player.name));
+			}
+
+			if (player.notify_online && g.player_db.notify_on_transition_change
+			    && transition_info.m_session_token != -1 && player.transition_session_id == -1)
+			{
+				if (is_host_of_transition_session)
 				{
-					for (size_t i = 0; i < bucket.size(); ++i)
-					{
-						if (const auto& it = m_players.find(bucket[i].m_rockstar_id); it != m_players.end())
-						{
-							rage::rlSessionInfo info{};
-							rage::rlSessionInfo transition_info{};
-							info.m_session_token            = -1;
-							transition_info.m_session_token = -1;
-							GSType gstype           = (GSType)(int)contexts[i][0].m_presence_attribute_int_value;
-							bool is_spectating      = (bool)contexts[i][2].m_presence_attribute_int_value;
-							bool is_host_of_session = (bool)contexts[i][3].m_presence_attribute_int_value;
-							bool is_host_of_transition_session = (bool)contexts[i][5].m_presence_attribute_int_value;
-							GameMode game_mode       = (GameMode)contexts[i][8].m_presence_attribute_int_value;
-							std::string mission_id   = contexts[i][7].m_presence_attribute_string_value;
-							std::string mission_name = contexts[i][6].m_presence_attribute_string_value;
-
-							if (contexts[i][1].m_presence_attribute_string_value[0] == 0
-							    || !g_pointers->m_gta.m_decode_session_info(&info, contexts[i][1].m_presence_attribute_string_value, nullptr))
-								gstype = GSType::Invalid;
-
-							if (can_fetch_name(game_mode) && mission_name.empty() && mission_id.empty())
-								game_mode = GameMode::None;
-
-							if (contexts[i][4].m_presence_attribute_string_value[0] == 0
-							    || !g_pointers->m_gta.m_decode_session_info(&transition_info, contexts[i][4].m_presence_attribute_string_value, nullptr))
-								transition_info.m_session_token = -1;
-
-							if (it->second->session_type != gstype)
-							{
-								handle_session_type_change(*it->second, gstype);
-							}
-							else if (it->second->notify_online && it->second->session_id != info.m_session_token
-							    && g.player_db.notify_on_session_change)
-							{
-								g_notification_service.push("Player DB",
-								    std::format("{} has joined a new session", it->second->name));
-							}
-
-							if (gstype != GSType::Invalid)
-							{
-								if (it->second->notify_online && is_spectating != it->second->is_spectating
-								    && g.player_db.notify_on_spectator_change)
-								{
-									if (is_spectating)
-									{
-										g_notification_service.push("Player DB",
-										    std::format("{} is now spectating", it->second->name));
-									}
-									else
-									{
-										g_notification_service.push("Player DB",
-										    std::format("{} is no longer spectating", it->second->name));
-									}
-								}
-
-								if (it->second->notify_online && is_host_of_session != it->second->is_host_of_session
-								    && g.player_db.notify_on_become_host && is_host_of_session && it->second->session_id == info.m_session_token)
-								{
-									g_notification_service.push("Player DB",
-									    std::format("{} is now the host of their session", it->second->name));
-								}
-
-								if (it->second->notify_online && g.player_db.notify_on_transition_change
-								    && transition_info.m_session_token != -1 && it->second->transition_session_id == -1)
-								{
-									if (is_host_of_transition_session)
-									{
-										g_notification_service.push("Player DB",
-										    std::format("{} has hosted a job lobby", it->second->name));
-									}
-									else
-									{
-										g_notification_service.push("Player DB",
-										    std::format("{} has joined a job lobby", it->second->name));
-									}
-								}
-								else if (it->second->notify_online && g.player_db.notify_on_transition_change
-								    && transition_info.m_session_token == -1 && it->second->transition_session_id != -1)
-								{
-									g_notification_service.push("Player DB",
-									    std::format("{} is no longer in a job lobby", it->second->name));
-								}
-
-								if (it->second->notify_online && g.player_db.notify_on_mission_change
-								    && game_mode != it->second->game_mode)
-								{
-									auto rid           = it->second->rockstar_id;
-									auto old_game_mode = it->second->game_mode;
-									g_fiber_pool->queue_job([rid, old_game_mode, game_mode, mission_id, mission_name] {
-										handle_game_mode_change(rid, old_game_mode, game_mode, mission_id, mission_name);
-									});
-								}
-							}
-
-							if (it->second->join_redirect)
-								it->second->redirect_info = info;
-
-							it->second->session_type                  = gstype;
-							it->second->session_id                    = info.m_session_token;
-							it->second->is_spectating                 = is_spectating;
-							it->second->is_host_of_session            = is_host_of_session;
-							it->second->transition_session_id         = transition_info.m_session_token;
-							it->second->is_host_of_transition_session = is_host_of_transition_session;
-							it->second->game_mode                     = game_mode;
-							it->second->game_mode_id                  = mission_id;
-							it->second->game_mode_name                = mission_name;
-						}
-					}
-					handle_join_redirect();
+					g_notification_service.push("Player DB",
+					    std::format("{} has hosted a job lobby", player.name));
 				}
 				else
 				{
-					LOG(WARNING) << "Presence attribute endpoint failed";
+					g_notification_service.push("Player DB",
+					    std::format("{} has joined a job lobby", player.name));
 				}
 			}
+			else if (player.notify_online && g.player_db.notify_on_transition_change
+			    && transition_info.m_session_token == -1 && player.transition_session_id != -1)
+			{
+				g_notification_service.push("Player DB",
+				    std::format("{} is no longer in a job lobby", player.name));
+			}
+
+			if (player.notify_online && g.player_db.notify_on_mission_change
+			    && game_mode != player.game_mode)
+			{
+				auto rid           = player.rockstar_id;
+				auto old_game_mode = player.game_mode;
+				g_fiber_pool->queue_job([rid, old_game_mode, game_mode, mission_id, mission_name] {
+					handle_game_mode_change(rid, old_game_mode, game_mode, mission_id, mission_name);
+				});
+			}
+		}
+
+		if (player.join_redirect)
+			player.redirect_info = info;
+
+		if (player.session_type != gstype || player.game_mode != game_mode)
+			m_generation++;
+
+		player.session_type                  = gstype;
+		player.session_id                    = info.m_session_token;
+		player.is_spectating                 = is_spectating;
+		player.is_host_of_session            = is_host_of_session;
+		player.transition_session_id         = transition_info.m_session_token;
+		player.is_host_of_transition_session = is_host_of_transition_session;
+		player.game_mode                     = game_mode;
+		player.game_mode_id                  = mission_id;
+		player.game_mode_name                = mission_name;
+	}
+
+	void player_database_service::update_presence_stats()
+	{
+		presence_stats stats{};
+
+		const auto now = std::chrono::steady_clock::now();
+		std::size_t polled = 0;
+		for (const auto& [time, count] : m_presence_history)
+		{
+			if (now - time <= presence_stats_window)
+				polled += count;
+		}
+		stats.m_players_per_second = polled / std::chrono::duration<float>(presence_stats_window).count();
+
+		std::vector<std::chrono::steady_clock::duration> staleness;
+		for (const auto& [rid, player] : m_players)
+		{
+			// players that were never polled count as stale since the service started
+			if (is_tracked(*player))
+				staleness.push_back(now - std::max(player->last_presence_update, m_created_time));
+		}
+
+		if (!staleness.empty())
+		{
+			std::sort(staleness.begin(), staleness.end());
+			auto percentile = [&staleness](std::size_t p) {
+				return std::chrono::duration_cast<std::chrono::milliseconds>(staleness[(staleness.size() - 1) * p / 100]);
+			};
+			stats.m_staleness_p50 = percentile(50);
+			stats.m_staleness_p95 = percentile(95);
+			stats.m_staleness_p99 = percentile(99);
 		}
+
+		std::lock_guard lock(m_presence_stats_mutex);
+		m_presence_stats = stats;
+	}
+
+	player_database_service::presence_stats player_database_service::get_presence_stats()
+	{
+		std::lock_guard lock(m_presence_stats_mutex);
+		return m_presence_stats;
 	}
 
 	bool player_database_service::is_joinable_session(GSType type, GameMode mode)
@@ -20,13 +20,30 @@ namespace nlohmann
 	};
 }
 
+namespace rage
+{
+	class rlQueryPresenceAttributesContext;
+}
+
 namespace big
 {
 	class player_database_service
 	{
+	public:
+		struct presence_stats
+		{
+			float m_players_per_second = 0.f;
+			std::chrono::milliseconds m_staleness_p50{};
+			std::chrono::milliseconds m_staleness_p95{};
+			std::chrono::milliseconds m_staleness_p99{};
+		};
+
+	private:
 		std::unordered_map<uint64_t, std::shared_ptr<persistent_player>> m_players;
 		std::map<std::string, std::shared_ptr<persistent_player>> m_sorted_players;
 		std::shared_ptr<persistent_player> m_selected = nullptr;
+		// bumped whenever players are added, removed, saved or move to another kind of session
+		std::atomic<uint32_t> m_generation = 0;
 
 		void handle_session_type_change(persistent_player& player, GSType new_session_type);
 		static void handle_game_mode_change(uint64_t rid, GameMode old_game_mode, GameMode new_game_mode, std::string mission_id, std::string mission_name); // run in fiber pool
@@ -34,17 +51,64 @@ namespace big
 		void handle_join_redirect();
 		std::atomic_bool updating = false;
 
+		// changes are appended to the journal as single json records and merged into m_file_path in the background
+		std::filesystem::path m_journal_path;
+		std::ofstream m_journal;
+		std::size_t m_journal_records = 0;
+		std::mutex m_journal_mutex;
+		// held while the snapshot at m_file_path is being replaced
+		std::mutex m_snapshot_mutex;
+		std::atomic_bool m_compacting = false;
+		// shared with the queued compaction job, which must not touch the service once it's destroyed
+		struct compaction_state
+		{
+			std::mutex m_mutex;
+			bool m_cancelled = false;
+		};
+		std::shared_ptr<compaction_state> m_compaction_state = std::make_shared<compaction_state>();
+
+		void append_to_journal(const nlohmann::json& record);
+		void compact_journal();
+
+		// tracked players are polled in small batches every presence_poll_step so that each of them
+		// is refreshed once per presence_poll_interval without bursts of queries
+		static constexpr auto presence_poll_interval = 45s;
+		static constexpr auto presence_poll_step     = 5s;
+		static constexpr auto max_presence_backoff   = 5min;
+		static constexpr auto presence_stats_window  = 60s;
+		static constexpr std::size_t max_presence_queries = 3;
+
+		struct presence_query;
+		std::vector<std::unique_ptr<presence_query>> m_presence_queries;
+		// written by the presence fiber job, read by the update loop on the thread pool
+		std::atomic<std::chrono::steady_clock::time_point> m_next_presence_poll{};
+		std::atomic<std::chrono::steady_clock::duration> m_presence_backoff{};
+		// amount of players refreshed per successful query, for update_presence_stats
+		std::deque<std::pair<std::chrono::steady_clock::time_point, std::size_t>> m_presence_history;
+		std::chrono::steady_clock::time_point m_created_time = std::chrono::steady_clock::now();
+		std::mutex m_presence_stats_mutex;
+		presence_stats m_presence_stats;
+
+		void poll_stale_players();
+		void update_presence_stats();
+		void query_player_states(const std::vector<std::shared_ptr<persistent_player>>& players);
+		void apply_presence_attributes(persistent_player& player, rage::rlQueryPresenceAttributesContext* contexts);
+
 	public:
 		std::filesystem::path m_file_path;
 		player_database_service();
 		~player_database_service();
 
+		// rewrites the whole database, only needed after bulk changes
 		void save();
+		// records the current state of a single player
+		void save(const std::shared_ptr<persistent_player>& player);
 		void load();
 
 		std::shared_ptr<persistent_player> add_player(std::int64_t rid, const std::string_view name);
 		std::unordered_map<uint64_t, std::shared_ptr<persistent_player>>& get_players();
 		std::map<std::string, std::shared_ptr<persistent_player>>& get_sorted_players();
+		uint32_t generation() const;
 		std::shared_ptr<persistent_player> get_player_by_rockstar_id(uint64_t rockstar_id);
 		std::shared_ptr<persistent_player> get_or_create_player(player_ptr player);
 		void remove_filtered_players(bool filter_modder, bool filter_trust, bool filter_block_join, bool filter_track_player);
@@ -55,7 +119,10 @@ namespace big
 		std::shared_ptr<persistent_player> get_selected();
 
 		void start_update_loop();
+		// polls every (tracked) player right away, the update loop only refreshes the stalest ones
 		void update_player_states(bool tracked_only = false);
+		// as of the last poll, safe to call from the gui
+		presence_stats get_presence_stats();
 
 		static bool is_joinable_session(GSType type, GameMode mode);
 		static const char* get_session_type_str(GSType type);
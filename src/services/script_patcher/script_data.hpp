@@ -1,34 +1,38 @@
 #pragma once
 
+#include <script/scrProgram.hpp>
+
 namespace big
 {
 	class script_data
 	{
-		uint32_t m_num_pages;
+		// the pages are copied next to each other so patterns can be scanned for over the whole program at once
+		std::vector<uint8_t> m_code;
+		std::vector<uint8_t*> m_pages;
 
 	public:
 		uint32_t m_code_size;
 		uint8_t** m_bytecode;
 
-		script_data(uint32_t code_size, uint8_t** bytecode, uint32_t num_pages) :
-		    m_code_size(code_size),
-		    m_bytecode(bytecode),
-		    m_num_pages(num_pages)
+		explicit script_data(rage::scrProgram* program) :
+		    m_code(program->m_code_size),
+		    m_pages(program->get_num_code_pages()),
+		    m_code_size(program->m_code_size),
+		    m_bytecode(m_pages.data())
 		{
+			for (auto i = 0u; i < program->get_num_code_pages(); i++)
+			{
+				m_pages[i] = m_code.data() + (i << 14);
+				std::memcpy(m_pages[i], program->get_code_page(i), program->get_code_page_size(i));
+			}
 		}
 
 		script_data(const script_data& that)            = delete;
 		script_data& operator=(const script_data& that) = delete;
 
-		~script_data()
+		uint8_t* code()
 		{
-			for (auto i = 0u; i < m_num_pages; i++)
-			{
-				delete[] m_bytecode[i];
-			}
-
-			delete[] m_bytecode;
-			m_bytecode = nullptr;
+			return m_code.data();
 		}
 	};
 }
\ No newline at end of file
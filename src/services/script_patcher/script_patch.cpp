@@ -20,22 +20,25 @@ namespace big
 		return &data->m_bytecode[index >> 14][index & 0x3FFF];
 	}
 
-	const std::optional<uint32_t> script_patch::get_code_location_by_pattern(script_data* data, const memory::pattern& pattern)
+	uint64_t script_patch::get_pattern_hash() const
 	{
-		uint32_t code_size = data->m_code_size;
-		for (uint32_t i = 0; i < (code_size - pattern.m_bytes.size()); i++)
+		// FNV-1a over the pattern bytes, wildcards hash differently from every concrete byte
+		uint64_t hash = 0xCBF29CE484222325;
+		for (const auto& byte : m_pattern.m_bytes)
 		{
-			for (uint32_t j = 0; j < pattern.m_bytes.size(); j++)
-				if (pattern.m_bytes[j].has_value())
-					if (pattern.m_bytes[j].value() != *get_code_address(data, i + j))
-						goto incorrect;
-
-			return i;
-		incorrect:
-			continue;
+			hash = (hash ^ (byte.has_value() ? *byte : 0x100)) * 0x100000001B3;
 		}
 
-		return std::nullopt;
+		return hash;
+	}
+
+	void script_patch::resolve(script_data* data, uint32_t location)
+	{
+		m_ip = location + m_offset;
+
+		m_original.clear();
+		for (int i = 0; i < m_patch.size(); i++)
+			m_original.push_back(*get_code_address(data, m_ip + i));
 	}
 
 	void script_patch::enable(script_data* data)
@@ -50,20 +53,9 @@ namespace big
 
 	void script_patch::update(script_data* data)
 	{
-		if (m_ip == 0)
-		{
-			auto result = get_code_location_by_pattern(data, m_pattern);
-			if (!result.has_value())
-			{
-				LOG(FATAL) << "Failed to find pattern: " << m_name;
-				return;
-			}
-
-			m_ip = result.value() + m_offset;
-
-			for (int i = 0; i < m_patch.size(); i++)
-				m_original.push_back(*get_code_address(data, m_ip + i));
-		}
+		// script_patcher_service resolves the location before the first update
+		if (!is_resolved())
+			return;
 
 		if (!m_bool || *m_bool)
 			enable(data);
@@ -17,7 +17,6 @@ namespace big
 		int32_t m_ip;
 
 		static uint8_t* get_code_address(script_data* data, uint32_t index);
-		static const std::optional<uint32_t> get_code_location_by_pattern(script_data* data, const memory::pattern& pattern);
 
 	public:
 		void enable(script_data* data);
@@ -33,6 +32,21 @@ namespace big
 			return m_name;
 		}
 
+		inline const memory::pattern& get_pattern() const
+		{
+			return m_pattern;
+		}
+
+		inline bool is_resolved() const
+		{
+			return m_ip != 0;
+		}
+
+		// identifies the pattern in the location cache of script_patcher_service
+		uint64_t get_pattern_hash() const;
+		// location is where the pattern was found in the script, the patch is applied m_offset bytes after it
+		void resolve(script_data* data, uint32_t location);
+
 		script_patch(rage::joaat_t script, std::string name, const memory::pattern pattern, int32_t offset, std::vector<uint8_t> patch, bool* enable_bool);
 		void update(script_data* data);
 	};
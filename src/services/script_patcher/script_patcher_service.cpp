@@ -1,5 +1,8 @@
 #include "script_patcher_service.hpp"
 
+#include "file_manager.hpp"
+#include "memory/pattern_batch.hpp"
+#include "memory/range.hpp"
 #include "script_data.hpp"
 #include "script_patch.hpp"
 
@@ -7,8 +10,16 @@
 
 namespace big
 {
-	script_patcher_service::script_patcher_service()
+	static uint64_t location_key(rage::joaat_t script, uint32_t code_size, uint64_t pattern_hash)
 	{
+		return pattern_hash ^ ((uint64_t)script << 32 | code_size) * 0x9E3779B97F4A7C15;
+	}
+
+	script_patcher_service::script_patcher_service() :
+	    m_cache_file(g_file_manager.get_project_file("./cache/script_patches.bin"), 1)
+	{
+		load_locations();
+
 		g_script_patcher_service = this;
 	}
 
@@ -19,68 +30,136 @@ namespace big
 		g_script_patcher_service = nullptr;
 	}
 
+	void script_patcher_service::load_locations()
+	{
+		// entries are checked against the bytecode before being used, so the game version doesn't matter
+		if (!m_cache_file.load() || !m_cache_file.up_to_date_ignoring_file_version())
+			return;
+
+		for (const auto& entry : m_cache_file.view<cached_location>())
+			m_locations.emplace(entry.m_key, entry.m_location);
+
+		m_cache_file.free();
+	}
+
+	void script_patcher_service::save_locations()
+	{
+		const auto data_size = sizeof(cached_location) * m_locations.size();
+		auto data            = std::make_unique<uint8_t[]>(data_size);
+		auto entries         = reinterpret_cast<cached_location*>(data.get());
+
+		for (const auto& [key, location] : m_locations)
+			*entries++ = {key, location, 0};
+
+		m_cache_file.set_header_version(0);
+		m_cache_file.set_data(std::move(data), data_size);
+		m_cache_file.write();
+		m_cache_file.free();
+	}
+
 	script_data* script_patcher_service::get_data_for_script(rage::joaat_t script)
 	{
-		for (auto& p : m_script_data)
-		{
-			if (p.first == script)
-			{
-				return p.second.get();
-			}
-		}
+		if (auto it = m_script_data.find(script); it != m_script_data.end())
+			return it->second.get();
 
 		return nullptr;
 	}
 
 	bool script_patcher_service::does_script_have_patches(rage::joaat_t script)
 	{
-		for (auto& p : m_script_patches)
-		{
-			if (p.get_script() == script)
-				return true;
-		}
+		if (auto it = m_script_patches.find(script); it != m_script_patches.end())
+			return !it->second.empty();
 
 		return false;
 	}
 
 	void script_patcher_service::create_data_for_script(rage::scrProgram* program)
 	{
-		auto pages = new uint8_t*[program->get_num_code_pages()];
+		m_script_data.emplace(program->m_name_hash, std::make_unique<script_data>(program));
+	}
 
-		for (auto i = 0u; i < program->get_num_code_pages(); i++)
+	void script_patcher_service::resolve_patches_for_script(rage::joaat_t script, script_data* data)
+	{
+		std::vector<script_patch*> unresolved;
+		std::vector<memory::pattern_view> patterns;
+
+		for (auto& p : m_script_patches[script])
 		{
-			pages[i] = new uint8_t[program->get_code_page_size(i)];
-			std::memcpy(pages[i], program->get_code_page(i), program->get_code_page_size(i));
+			if (p.is_resolved())
+				continue;
+
+			const auto pattern = p.get_pattern().view();
+			const auto key     = location_key(script, data->m_code_size, p.get_pattern_hash());
+
+			if (auto it = m_locations.find(key); it != m_locations.end() && it->second + pattern.m_length <= data->m_code_size
+			    && pattern.matches(data->code() + it->second))
+			{
+				p.resolve(data, it->second);
+				continue;
+			}
+
+			unresolved.push_back(&p);
+			patterns.push_back(pattern);
 		}
 
-		m_script_data.emplace(program->m_name_hash, std::make_unique<script_data>(program->m_code_size, pages, program->get_num_code_pages()));
+		if (unresolved.empty())
+			return;
+
+		// all the patterns the cache couldn't provide are looked for in a single pass over the program
+		static const auto worker_count = std::clamp(std::thread::hardware_concurrency(), 1u, 4u);
+		const auto results = memory::pattern_batch(std::move(patterns)).scan(memory::range(data->code(), data->m_code_size), worker_count);
+
+		bool found_any = false;
+		for (std::size_t i = 0; i < unresolved.size(); i++)
+		{
+			if (!results[i])
+			{
+				LOG(FATAL) << "Failed to find pattern: " << unresolved[i]->get_name();
+				continue;
+			}
+
+			const auto location = (uint32_t)(results[i]->as<uint8_t*>() - data->code());
+			unresolved[i]->resolve(data, location);
+			m_locations[location_key(script, data->m_code_size, unresolved[i]->get_pattern_hash())] = location;
+			found_any = true;
+		}
+
+		if (found_any)
+			save_locations();
 	}
 
 	void script_patcher_service::update_all_patches_for_script(rage::joaat_t script)
 	{
 		auto data = get_data_for_script(script);
+		if (!data)
+			return;
+
+		resolve_patches_for_script(script, data);
 
-		for (auto& p : m_script_patches)
-			if (p.get_script() == script)
-				p.update(data);
+		for (auto& p : m_script_patches[script])
+			p.update(data);
 	}
 
 	void script_patcher_service::add_patch(script_patch&& patch)
 	{
-		m_script_patches.push_back(std::move(patch));
+		const auto script = patch.get_script();
+		m_script_patches[script].push_back(std::move(patch));
 	}
 
 	void script_patcher_service::remove_patch(std::string_view patch_name)
 	{
-		for (auto it = m_script_patches.begin(); it != m_script_patches.end();)
+		for (auto& [script, patches] : m_script_patches)
 		{
-			if (it->get_name() == patch_name)
+			for (auto it = patches.begin(); it != patches.end();)
 			{
-				it = m_script_patches.erase(it);
-			}
-			else
-			{
-				++it;
+				if (it->get_name() == patch_name)
+				{
+					it = patches.erase(it);
+				}
+				else
+				{
+					++it;
+				}
 			}
 		}
 	}
@@ -106,12 +185,15 @@ namespace big
 
 	void script_patcher_service::update()
 	{
-		for (auto& p : m_script_patches)
+		for (auto& [script, patches] : m_script_patches)
 		{
-			auto data = get_data_for_script(p.get_script());
+			auto data = get_data_for_script(script);
 			if (data)
 			{
-				p.update(data);
+				resolve_patches_for_script(script, data);
+
+				for (auto& p : patches)
+					p.update(data);
 			}
 		}
 	}
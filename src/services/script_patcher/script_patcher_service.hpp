@@ -2,6 +2,7 @@
 #include "memory/pattern.hpp"
 #include "script_data.hpp"
 #include "script_patch.hpp"
+#include "services/gta_data/cache_file.hpp"
 
 #include <script/scrProgram.hpp>
 
@@ -9,11 +10,28 @@ namespace big
 {
 	class script_patcher_service
 	{
-		std::list<script_patch> m_script_patches;
+		struct cached_location
+		{
+			uint64_t m_key;
+			uint32_t m_location;
+			uint32_t m_pad;
+		};
+
+		std::unordered_map<rage::joaat_t, std::list<script_patch>> m_script_patches;
 		std::unordered_map<rage::joaat_t, std::unique_ptr<script_data>> m_script_data;
+
+		// where each pattern was found, keyed by script hash, code size and pattern
+		// so that loading a script we've seen before doesn't need a scan at all
+		cache_file m_cache_file;
+		std::unordered_map<uint64_t, uint32_t> m_locations;
+
 		script_data* get_data_for_script(rage::joaat_t script);
 		bool does_script_have_patches(rage::joaat_t script);
 		void create_data_for_script(rage::scrProgram* program);
+		void resolve_patches_for_script(rage::joaat_t script, script_data* data);
+
+		void load_locations();
+		void save_locations();
 
 	public:
 		script_patcher_service();
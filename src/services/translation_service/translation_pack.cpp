@@ -0,0 +1,110 @@
+#include "translation_pack.hpp"
+
+namespace big
+{
+	// changes whenever the json is replaced, e.g. after downloading an updated pack
+	static uint32_t get_json_version(const file& json_file)
+	{
+		std::error_code ec;
+		const auto time = std::filesystem::last_write_time(json_file.get_path(), ec).time_since_epoch().count();
+		const auto size = std::filesystem::file_size(json_file.get_path(), ec);
+
+		return static_cast<uint32_t>(time ^ (time >> 32) ^ size);
+	}
+
+	bool translation_pack::load(const folder& directory, std::string_view pack_id)
+	{
+		const auto json_file = directory.get_file(std::format("./{}.json", pack_id));
+		m_pack               = cache_file(directory.get_file(std::format("./{}.bin", pack_id)), pack_version);
+		m_entries            = {};
+		m_pool               = nullptr;
+
+		const auto json_exists  = json_file.exists();
+		const auto json_version = json_exists ? get_json_version(json_file) : 0;
+
+		// a pack without its json is still usable, it just can't be checked for being outdated
+		if (!m_pack.load() || (json_exists ? !m_pack.up_to_date(json_version) : !m_pack.up_to_date_ignoring_file_version()))
+		{
+			if (!json_exists || !compile(json_file, m_pack, json_version) || !m_pack.load())
+				return false;
+		}
+
+		if (m_pack.data_size() < sizeof(header))
+			return false;
+
+		const auto pack_header = reinterpret_cast<const header*>(m_pack.data());
+		const auto entries     = reinterpret_cast<const entry*>(m_pack.data() + sizeof(header));
+		if (m_pack.data_size() != sizeof(header) + pack_header->m_entry_count * sizeof(entry) + pack_header->m_pool_size)
+			return false;
+
+		m_entries = {entries, pack_header->m_entry_count};
+		m_pool    = reinterpret_cast<const char*>(entries + pack_header->m_entry_count);
+
+		return true;
+	}
+
+	std::string_view translation_pack::find(rage::joaat_t hash) const
+	{
+		const auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash, [](const entry& e, rage::joaat_t hash) {
+			return e.m_hash < hash;
+		});
+		if (it == m_entries.end() || it->m_hash != hash)
+			return {};
+
+		return {m_pool + it->m_offset, it->m_length};
+	}
+
+	bool translation_pack::compile(const file& json_file, cache_file& pack, uint32_t json_version)
+	{
+		nlohmann::json j;
+		try
+		{
+			j = nlohmann::json::parse(std::ifstream(json_file.get_path(), std::ios::binary));
+		}
+		catch (const std::exception& e)
+		{
+			LOG(WARNING) << "Failed to parse language pack. " << e.what();
+
+			return false;
+		}
+
+		std::vector<entry> entries;
+		std::string pool;
+		entries.reserve(j.size());
+		for (auto& [key, value] : j.items())
+		{
+			if (!value.is_string())
+				continue;
+
+			const auto& translation = value.get_ref<const std::string&>();
+			entries.push_back({rage::joaat(key), static_cast<uint32_t>(pool.size()), static_cast<uint32_t>(translation.size())});
+
+			// null terminated so the views can be handed to imgui as is
+			pool.append(translation);
+			pool.push_back('\0');
+		}
+
+		std::stable_sort(entries.begin(), entries.end(), [](const entry& a, const entry& b) {
+			return a.m_hash < b.m_hash;
+		});
+		entries.erase(std::unique(entries.begin(), entries.end(), [](const entry& a, const entry& b) {
+			return a.m_hash == b.m_hash;
+		}), entries.end());
+
+		const header pack_header{static_cast<uint32_t>(entries.size()), static_cast<uint32_t>(pool.size())};
+		const auto data_size = sizeof(header) + entries.size() * sizeof(entry) + pool.size();
+
+		auto data = std::make_unique<uint8_t[]>(data_size);
+		std::memcpy(data.get(), &pack_header, sizeof(header));
+		std::memcpy(data.get() + sizeof(header), entries.data(), entries.size() * sizeof(entry));
+		std::memcpy(data.get() + sizeof(header) + entries.size() * sizeof(entry), pool.data(), pool.size());
+
+		pack.set_data(std::move(data), data_size);
+		pack.set_header_version(json_version);
+
+		// the old pack may still be mapped by a previous load, the compiled data is used from memory in that case
+		pack.write();
+
+		return true;
+	}
+}
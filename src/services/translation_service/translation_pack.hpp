@@ -0,0 +1,49 @@
+#pragma once
+#include "file_manager/folder.hpp"
+#include "gta/joaat.hpp"
+#include "services/gta_data/cache_file.hpp"
+
+namespace big
+{
+	/**
+	 * @brief A language pack compiled from its json into a table of hashes sorted for binary search and a single string pool.
+	 *
+	 * The compiled pack is stored next to the json as <pack_id>.bin and mapped read-only, lookups don't allocate.
+	 */
+	class translation_pack final
+	{
+	public:
+		// bump when changing the layout of the compiled pack
+		static constexpr uint32_t pack_version = 1;
+
+		/**
+		 * @brief Maps the compiled pack, (re)compiling it from the json first if it's missing or out of date.
+		 *
+		 * @return False if neither the compiled pack nor the json could be loaded.
+		 */
+		bool load(const folder& directory, std::string_view pack_id);
+
+		// the returned view is null terminated and lives as long as the pack, empty if the key isn't translated
+		std::string_view find(rage::joaat_t hash) const;
+
+	private:
+		struct entry
+		{
+			rage::joaat_t m_hash;
+			uint32_t m_offset;
+			uint32_t m_length;
+		};
+
+		struct header
+		{
+			uint32_t m_entry_count;
+			uint32_t m_pool_size;
+		};
+
+		static bool compile(const file& json_file, cache_file& pack, uint32_t json_version);
+
+		cache_file m_pack;
+		std::span<const entry> m_entries;
+		const char* m_pool = nullptr;
+	};
+}
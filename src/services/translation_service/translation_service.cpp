@@ -12,7 +12,8 @@ namespace big
 {
 	translation_service::translation_service() :
 	    m_url("https://raw.githubusercontent.com/YimMenu/Translations/master"),
-	    m_fallback_url("https://cdn.jsdelivr.net/gh/YimMenu/Translations@master")
+	    m_fallback_url("https://cdn.jsdelivr.net/gh/YimMenu/Translations@master"),
+	    m_packs(nullptr)
 	{
 	}
 
@@ -20,40 +21,56 @@ namespace big
 	{
 		m_translation_directory = std::make_unique<folder>(g_file_manager.get_project_folder("./translations").get_path());
 
+		// only the packs on disk are loaded here, they get checked against the remote index by update_in_background
+		m_has_local_index = load_local_index();
+		if (!m_has_local_index)
+			return;
+
+		use_fallback_remote();
+		load_translations();
+	}
+
+	void translation_service::update_in_background()
+	{
+		g_thread_pool->push([this] {
+			update_from_remote();
+		});
+	}
+
+	void translation_service::update_from_remote()
+	{
+		// with translations on disk they're already in use, no need to keep retrying
+		const auto download_attempts = m_has_local_index ? 1 : 5;
+
 		bool loaded_remote_index = false;
-		for (size_t i = 0; i < 5 && !loaded_remote_index; i++)
+		for (size_t i = 0; i < download_attempts && !loaded_remote_index; i++)
 		{
 			if (i)
 				LOG(WARNING) << "Failed to download remote index, trying again... (" << i << ")";
 			loaded_remote_index = download_index();
 		}
 
-		if (load_local_index())
+		if (!loaded_remote_index)
 		{
-			if (!loaded_remote_index)
-			{
-				LOG(WARNING) << "Failed to load remote index, attempting to use fallback.";
-				use_fallback_remote();
-			}
-			else if (m_local_index.version < m_remote_index.version)
+			if (m_has_local_index)
+				LOG(WARNING) << "Failed to load remote index, keeping the translations on disk.";
+			else
+				LOG(WARNING) << "Failed to load remote index, unable to load translations.";
+			return;
+		}
+
+		if (m_has_local_index)
+		{
+			if (m_local_index.version < m_remote_index.version)
 			{
 				LOG(INFO) << "Languages outdated, downloading new translations.";
 
 				update_language_packs();
 				m_local_index.version = m_remote_index.version;
+				load_translations();
 			}
 
-			load_translations();
-
-			if (loaded_remote_index)
-				try_set_default_language();
-
-			return;
-		}
-
-		if (!loaded_remote_index)
-		{
-			LOG(WARNING) << "Failed to load remote index, unable to load translations.";
+			try_set_default_language();
 			return;
 		}
 
@@ -75,12 +92,22 @@ namespace big
 
 	std::string_view translation_service::get_translation(const rage::joaat_t translation_key, const std::string_view fallback) const
 	{
-		if (auto it = m_translations.find(translation_key); it != m_translations.end())
-			return it->second.c_str();
+		if (const auto packs = m_packs.load())
+		{
+			if (const auto translation = packs->m_selected.find(translation_key); !translation.empty())
+				return translation;
+			if (const auto translation = packs->m_default.find(translation_key); !translation.empty())
+				return translation;
+		}
 
 		return fallback;
 	}
 
+	uint32_t translation_service::generation() const
+	{
+		return m_generation;
+	}
+
 	std::map<std::string, translation_entry>& translation_service::available_translations()
 	{
 		return m_remote_index.translations;
@@ -123,24 +150,30 @@ namespace big
 
 	void translation_service::load_translations()
 	{
-		m_translations.clear();
+		auto packs = std::make_unique<translation_packs>();
 
 		// load default lang first to make sure there are fallback keys if another language pack doesn't have a certain key
-		auto j = load_translation(m_remote_index.default_lang);
-		for (auto& [key, value] : j.items())
-		{
-			m_translations.insert({rage::joaat(key), value.get<std::string>()});
-		}
+		load_translation(packs->m_default, m_remote_index.default_lang);
 
 		// Don't load selected language if it's the same as default
 		if (m_local_index.selected_language != m_remote_index.default_lang)
+			load_translation(packs->m_selected, m_local_index.selected_language);
+
 		{
-			auto j = load_translation(m_local_index.selected_language);
-			for (auto& [key, value] : j.items())
-			{
-				m_translations[rage::joaat(key)] = value;
-			}
+			std::lock_guard lock(m_loaded_packs_mutex);
+			const auto now = std::chrono::steady_clock::now();
+
+			// readers of packs retired a while ago are done with them by now
+			std::erase_if(m_retired_packs, [now](const auto& retired) {
+				return now - retired.first > retired_packs_grace_period;
+			});
+
+			m_packs = packs.get();
+			if (m_current_packs)
+				m_retired_packs.emplace_back(now, std::move(m_current_packs));
+			m_current_packs = std::move(packs);
 		}
+		m_generation++;
 
 		// local index is saved below so this is prime location to update a value and be sure to have it persisted!
 		m_local_index.alphabet_type = m_remote_index.translations[m_local_index.selected_language].alphabet_type;
@@ -161,7 +194,7 @@ namespace big
 		return false;
 	}
 
-	nlohmann::json translation_service::load_translation(const std::string_view pack_id)
+	bool translation_service::load_translation(translation_pack& pack, const std::string_view pack_id)
 	{
 		auto file = m_translation_directory->get_file(std::format("./{}.json", pack_id));
 		if (!file.exists())
@@ -170,25 +203,21 @@ namespace big
 			if (!download_language_pack(pack_id))
 			{
 				LOG(WARNING) << "Failed to download language pack, can't recover...";
-				return {};
+				return false;
 			}
 			// make a copy available
 			m_local_index.fallback_languages[pack_id.data()] = m_remote_index.translations[pack_id.data()];
 		}
 
-		try
-		{
-			return nlohmann::json::parse(std::ifstream(file.get_path(), std::ios::binary));
-		}
-		catch (std::exception& e)
+		if (!pack.load(*m_translation_directory, pack_id))
 		{
-			LOG(WARNING) << "Failed to parse language pack. " << e.what();
-
 			if (auto it = m_remote_index.translations.find(pack_id.data()); it != m_remote_index.translations.end()) // ensure that local language files are not removed
 				std::filesystem::remove(file.get_path());
 
-			return {};
+			return false;
 		}
+
+		return true;
 	}
 
 	bool translation_service::download_language_pack(const std::string_view pack_id)
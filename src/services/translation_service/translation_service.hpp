@@ -3,12 +3,18 @@
 #include "gta/joaat.hpp"
 #include "local_index.hpp"
 #include "remote_index.hpp"
+#include "translation_pack.hpp"
 
 #include <cpr/response.h>
 
 namespace big
 {
-	using translation_map = std::unordered_map<rage::joaat_t, std::string>;
+	struct translation_packs
+	{
+		translation_pack m_selected;
+		// has every key, used for whatever the selected language doesn't translate
+		translation_pack m_default;
+	};
 
 	class translation_service
 	{
@@ -20,7 +26,10 @@ namespace big
 		translation_service& operator=(const translation_service&)     = delete;
 		translation_service& operator=(translation_service&&) noexcept = delete;
 
+		// loads the language packs on disk, doesn't touch the network
 		void init();
+		// checks the remote index on the thread pool and downloads the packs that are missing or outdated
+		void update_in_background();
 
 		std::string_view get_translation(const std::string_view translation_key) const;
 		std::string_view get_translation(const rage::joaat_t translation_key, const std::string_view fallback = {0, 0}) const;
@@ -28,6 +37,8 @@ namespace big
 		std::map<std::string, translation_entry>& available_translations();
 		const std::string& current_language_pack();
 		void select_language_pack(const std::string& pack_id);
+		// changes every time another set of packs gets loaded, lets callers know their cached translations are stale
+		uint32_t generation() const;
 
 		/**
 		 * @brief Updates the language packs and reloads the language cache
@@ -36,9 +47,10 @@ namespace big
 		void update_n_reload_language_packs();
 
 	private:
+		void update_from_remote();
 		void load_translations();
 		bool does_language_exist(const std::string_view language);
-		nlohmann::json load_translation(const std::string_view pack_id);
+		bool load_translation(translation_pack& pack, const std::string_view pack_id);
 
 		bool download_language_pack(const std::string_view pack_id);
 		void update_language_packs();
@@ -66,9 +78,19 @@ namespace big
 
 		std::unique_ptr<folder> m_translation_directory;
 		local_index m_local_index;
+		bool m_has_local_index = false;
 		remote_index m_remote_index;
 
-		translation_map m_translations;
+		// views handed out by get_translation are used for the rest of the frame they were looked up in,
+		// replaced packs are kept for this long before they get freed
+		static constexpr auto retired_packs_grace_period = std::chrono::seconds(10);
+
+		// swapped as a whole when switching languages, m_current_packs owns what m_packs points to
+		std::atomic<const translation_packs*> m_packs;
+		std::atomic<uint32_t> m_generation = 0;
+		std::mutex m_loaded_packs_mutex;
+		std::unique_ptr<translation_packs> m_current_packs;
+		std::vector<std::pair<std::chrono::steady_clock::time_point, std::unique_ptr<translation_packs>>> m_retired_packs;
 	};
 
 	inline auto g_translation_service = translation_service();
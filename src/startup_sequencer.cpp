@@ -0,0 +1,94 @@
+#include "startup_sequencer.hpp"
+
+#include <future>
+
+namespace big
+{
+	void startup_sequencer::add(std::string name, std::vector<std::string> dependencies, std::function<void()> func)
+	{
+		step new_step{std::move(name), {}, std::move(func)};
+
+		for (const auto& dependency : dependencies)
+		{
+			const auto it = std::find_if(m_steps.begin(), m_steps.end(), [&dependency](const step& s) {
+				return s.m_name == dependency;
+			});
+			if (it == m_steps.end())
+				throw std::invalid_argument(std::format("Startup step {} depends on unknown step {}.", new_step.m_name, dependency));
+
+			new_step.m_dependencies.push_back(std::distance(m_steps.begin(), it));
+		}
+
+		m_steps.push_back(std::move(new_step));
+	}
+
+	void startup_sequencer::run()
+	{
+		const auto started = std::chrono::steady_clock::now();
+
+		// every step waits on its own thread, a failed dependency rethrows in its dependents so they never run
+		for (auto& current : m_steps)
+		{
+			auto run_step = [this, &current] {
+				for (const auto dependency : current.m_dependencies)
+					m_steps[dependency].m_done.get();
+
+				current.m_started = std::chrono::steady_clock::now();
+				try
+				{
+					current.m_func();
+				}
+				catch (const std::exception& e)
+				{
+					LOG(FATAL) << "Startup step " << current.m_name << " failed: " << e.what();
+					throw;
+				}
+				current.m_finished = std::chrono::steady_clock::now();
+			};
+
+			current.m_done = std::async(std::launch::async, std::move(run_step)).share();
+		}
+
+		std::exception_ptr exception;
+		for (auto& current : m_steps)
+		{
+			try
+			{
+				current.m_done.get();
+			}
+			catch (...)
+			{
+				if (!exception)
+					exception = std::current_exception();
+			}
+		}
+
+		if (exception)
+			std::rethrow_exception(exception);
+
+		log_report(started);
+	}
+
+	void startup_sequencer::log_report(std::chrono::steady_clock::time_point started) const
+	{
+		using ms = std::chrono::duration<float, std::milli>;
+
+		std::vector<const step*> steps;
+		for (const auto& current : m_steps)
+			steps.push_back(&current);
+
+		std::sort(steps.begin(), steps.end(), [](const step* a, const step* b) {
+			return a->m_started < b->m_started;
+		});
+
+		std::stringstream report;
+		std::chrono::steady_clock::time_point finished{};
+		for (const auto current : steps)
+		{
+			report << std::format("\n\t{:<24}{:>10.1f}ms{:>10.1f}ms", current->m_name, ms(current->m_started - started).count(), ms(current->m_finished - current->m_started).count());
+			finished = std::max(finished, current->m_finished);
+		}
+
+		LOG(INFO) << "Startup took " << ms(finished - started).count() << "ms (step, started at, took):" << report.str();
+	}
+}
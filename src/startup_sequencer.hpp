@@ -0,0 +1,35 @@
+#pragma once
+
+namespace big
+{
+	/**
+	 * @brief Runs the initialization steps of the menu as a dependency graph.
+	 *
+	 * Every step starts as soon as all of its dependencies are done, steps that don't depend on each other run concurrently.
+	 */
+	class startup_sequencer
+	{
+	public:
+		// dependencies have to be added before the steps that depend on them
+		void add(std::string name, std::vector<std::string> dependencies, std::function<void()> func);
+
+		// blocks until every step ran, rethrows the first exception thrown by a step
+		void run();
+
+	private:
+		struct step
+		{
+			std::string m_name;
+			std::vector<std::size_t> m_dependencies;
+			std::function<void()> m_func;
+
+			std::shared_future<void> m_done;
+			std::chrono::steady_clock::time_point m_started;
+			std::chrono::steady_clock::time_point m_finished;
+		};
+
+		void log_report(std::chrono::steady_clock::time_point started) const;
+
+		std::vector<step> m_steps;
+	};
+}
@@ -4,8 +4,13 @@ namespace big
 {
 	thread_pool::thread_pool(const std::size_t preallocated_thread_count) :
 	    m_accept_jobs(true),
+	    m_queued_jobs(0),
 	    m_allocated_thread_count(preallocated_thread_count),
-	    m_busy_threads(0)
+	    m_busy_threads(0),
+	    m_completed_jobs(0),
+	    m_total_wait_us(0),
+	    m_max_wait_us(0),
+	    m_total_run_us(0)
 	{
 		rescale_thread_pool();
 
@@ -43,58 +48,90 @@ namespace big
 		m_thread_pool.clear();
 	}
 
-	void thread_pool::push(std::function<void()> func, std::source_location location)
+	void thread_pool::push(std::move_only_function<void()> func, thread_pool_priority priority, std::source_location location)
 	{
 		if (func)
 		{
 			{
 				std::unique_lock lock(m_lock);
-				m_job_stack.push({func, location});
+				m_job_queues[static_cast<size_t>(priority)].push_back({std::move(func), location, std::chrono::steady_clock::now()});
+				++m_queued_jobs;
 
-				if (m_allocated_thread_count - m_busy_threads < m_job_stack.size()) [[unlikely]]
+				// only grow when every thread is stuck on a job, long running jobs would otherwise starve the queue
+				if (m_allocated_thread_count - m_busy_threads < m_queued_jobs) [[unlikely]]
 				{
-					LOG(WARNING) << "Thread pool potentially starved, resizing to accommodate for load.";
-
 					if (m_allocated_thread_count >= MAX_POOL_SIZE)
 					{
 						LOG(FATAL) << "The thread pool limit has been reached, whatever you did this should not occur in production.";
 					}
-					if (m_accept_jobs && m_allocated_thread_count + 1 <= MAX_POOL_SIZE)
+					else if (m_accept_jobs)
 					{
 						++m_allocated_thread_count;
 						rescale_thread_pool();
 					}
 				}
 			}
-			m_data_condition.notify_all();
+			m_data_condition.notify_one();
 		}
 	}
 
+	thread_pool_usage thread_pool::usage() const
+	{
+		size_t queued_jobs;
+		{
+			std::lock_guard lock(m_lock);
+			queued_jobs = m_queued_jobs;
+		}
+
+		const auto completed_jobs = m_completed_jobs.load();
+		const auto average        = [completed_jobs](uint64_t total) {
+			return std::chrono::microseconds(completed_jobs ? total / completed_jobs : 0);
+		};
+
+		return {m_busy_threads, m_allocated_thread_count, queued_jobs, completed_jobs, average(m_total_wait_us), std::chrono::microseconds(m_max_wait_us), average(m_total_run_us)};
+	}
+
+	thread_pool_job thread_pool::pop_job()
+	{
+		for (auto& queue : m_job_queues)
+		{
+			if (!queue.empty())
+			{
+				auto job = std::move(queue.front());
+				queue.pop_front();
+				--m_queued_jobs;
+
+				return job;
+			}
+		}
+
+		return {};
+	}
+
 	void thread_pool::run()
 	{
 		for (;;)
 		{
 			std::unique_lock lock(m_lock);
 			m_data_condition.wait(lock, [this]() {
-				return !m_job_stack.empty() || !m_accept_jobs;
+				return m_queued_jobs || !m_accept_jobs;
 			});
 
 			if (!m_accept_jobs) [[unlikely]]
 				break;
-			if (m_job_stack.empty()) [[likely]]
-				continue;
 
-			thread_pool_job job = m_job_stack.top();
-			m_job_stack.pop();
+			thread_pool_job job = pop_job();
+			++m_busy_threads;
 			lock.unlock();
 
-			++m_busy_threads;
+			const auto started_at = std::chrono::steady_clock::now();
+			const auto wait_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(started_at - job.m_queued_at).count());
 
 			try
 			{
 				const auto source_file = std::filesystem::path(job.m_source_location.file_name()).filename().string();
 				LOG(VERBOSE) << "Thread " << std::this_thread::get_id() << " executing " << source_file << ":"
-				             << job.m_source_location.line();
+				             << job.m_source_location.line() << " after waiting " << wait_us << "us";
 
 				std::invoke(job.m_func);
 			}
@@ -103,6 +140,14 @@ namespace big
 				LOG(WARNING) << "Exception thrown while executing job in thread:" << std::endl << e.what();
 			}
 
+			const auto run_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started_at).count();
+
+			m_total_wait_us += wait_us;
+			m_total_run_us += static_cast<uint64_t>(run_us);
+			for (auto max_wait = m_max_wait_us.load(); wait_us > max_wait && !m_max_wait_us.compare_exchange_weak(max_wait, wait_us);)
+				;
+			++m_completed_jobs;
+
 			--m_busy_threads;
 		}
 
@@ -5,10 +5,36 @@ namespace big
 	// if this limit is hit you did something wrong coding wise.
 	constexpr auto MAX_POOL_SIZE = 32u;
 
+	// jobs are picked highest priority first and in the order they were pushed within a priority
+	enum class thread_pool_priority
+	{
+		HIGH,
+		NORMAL,
+		LOW
+	};
+
+	constexpr auto THREAD_POOL_PRIORITY_COUNT = 3u;
+
 	struct thread_pool_job
 	{
-		std::function<void()> m_func;
+		std::move_only_function<void()> m_func;
 		std::source_location m_source_location;
+		std::chrono::steady_clock::time_point m_queued_at;
+	};
+
+	struct thread_pool_usage
+	{
+		// the amount of threads currently on a job
+		size_t m_busy_threads;
+		// the amount of threads active in the pool
+		size_t m_allocated_threads;
+		size_t m_queued_jobs;
+		size_t m_completed_jobs;
+
+		// time spent between being pushed and being picked up by a thread
+		std::chrono::microseconds m_average_wait;
+		std::chrono::microseconds m_max_wait;
+		std::chrono::microseconds m_average_run;
 	};
 
 	class thread_pool
@@ -16,8 +42,9 @@ namespace big
 		std::atomic<bool> m_accept_jobs;
 		std::condition_variable m_data_condition;
 
-		std::stack<thread_pool_job> m_job_stack;
-		std::mutex m_lock;
+		std::array<std::deque<thread_pool_job>, THREAD_POOL_PRIORITY_COUNT> m_job_queues;
+		size_t m_queued_jobs;
+		mutable std::mutex m_lock;
 		std::vector<std::thread> m_thread_pool;
 
 		// the amount of threads active in the pool
@@ -25,20 +52,25 @@ namespace big
 		// the amount of threads currently on a job
 		std::atomic<size_t> m_busy_threads;
 
+		std::atomic<size_t> m_completed_jobs;
+		std::atomic<uint64_t> m_total_wait_us;
+		std::atomic<uint64_t> m_max_wait_us;
+		std::atomic<uint64_t> m_total_run_us;
+
 	public:
 		// YimMenu only has 2 blocking threads, 4 should be sufficient but the pool should automatically allocate more if needed
 		thread_pool(const std::size_t preallocated_thread_count = 4);
 		~thread_pool();
 
 		void destroy();
-		void push(std::function<void()> func, std::source_location location = std::source_location::current());
+		void push(std::move_only_function<void()> func, thread_pool_priority priority = thread_pool_priority::NORMAL, std::source_location location = std::source_location::current());
 
-		std::pair<size_t, size_t> usage() const
-		{ return { m_busy_threads, m_allocated_thread_count }; }
+		thread_pool_usage usage() const;
 
 	private:
 		void run();
 		void rescale_thread_pool();
+		thread_pool_job pop_job();
 	};
 
 	inline thread_pool* g_thread_pool{};
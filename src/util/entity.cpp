@@ -5,6 +5,7 @@
 #include "natives.hpp"
 #include "pools.hpp"
 #include "script.hpp"
+#include "services/entity_snapshot/entity_snapshot_service.hpp"
 #include "services/players/player_service.hpp"
 #include "packet.hpp"
 #include "gta/net_object_mgr.hpp"
@@ -195,35 +196,37 @@ namespace big::entity
 
 		if (vehicles)
 		{
-			for (auto vehicle : pools::get_all_vehicles())
+			const auto handles  = g_entity_snapshot_service->get_handles(snapshot_entity_type::VEHICLE);
+			const auto pointers = g_entity_snapshot_service->get_pointers(snapshot_entity_type::VEHICLE);
+			const auto self_veh = gta_util::get_local_vehicle();
+
+			for (std::size_t i = 0; i < handles.size(); i++)
 			{
-				if (!vehicle || (!include_self_veh && vehicle == gta_util::get_local_vehicle()))
+				if (!include_self_veh && pointers[i] == self_veh)
 					continue;
 
-				target_entities.push_back(g_pointers->m_gta.m_ptr_to_handle(vehicle));
+				target_entities.push_back(handles[i]);
 			}
 		}
 
 		if (peds)
 		{
-			for (auto ped : pools::get_all_peds())
+			const auto handles  = g_entity_snapshot_service->get_handles(snapshot_entity_type::PED);
+			const auto pointers = g_entity_snapshot_service->get_pointers(snapshot_entity_type::PED);
+
+			for (std::size_t i = 0; i < handles.size(); i++)
 			{
-				if (!ped || ped == g_local_player)
+				if (pointers[i] == g_local_player)
 					continue;
 
-				target_entities.push_back(g_pointers->m_gta.m_ptr_to_handle(ped));
+				target_entities.push_back(handles[i]);
 			}
 		}
 
 		if (props)
 		{
-			for (auto prop : pools::get_all_props())
-			{
-				if (!prop)
-					continue;
-
-				target_entities.push_back(g_pointers->m_gta.m_ptr_to_handle(prop));
-			}
+			const auto handles = g_entity_snapshot_service->get_handles(snapshot_entity_type::PROP);
+			target_entities.insert(target_entities.end(), handles.begin(), handles.end());
 		}
 		return target_entities;
 	}
@@ -187,7 +187,7 @@ namespace big::session
 				plyr->custom_infraction_reason += plyr->custom_infraction_reason.size() ? (std::string(", ") + custom_reason) : custom_reason;
 			}
 
-			g_player_database_service->save();
+			g_player_database_service->save(plyr);
 
 			g.reactions.modder_detection.process(player);
 		}
@@ -29,7 +29,59 @@ namespace big
 	};
 
 	// Sync Node Virtual Function Table address to all sync node identifiers that also have that vft address.
-	using sync_node_vft_to_ids = std::unordered_map<uint64_t, sync_node_id>;
+	// Filled once by sync_node_finder::init and then frozen into a sorted array, lookups never write to it.
+	class sync_node_vft_to_ids
+	{
+		std::vector<std::pair<uint64_t, sync_node_id>> m_nodes;
+
+	public:
+		void add(uint64_t addr, sync_node_id node_id)
+		{
+			m_nodes.emplace_back(addr, node_id);
+		}
+
+		// the first identifier added for an address wins, same as emplace into a map
+		void freeze()
+		{
+			std::stable_sort(m_nodes.begin(), m_nodes.end(), [](const auto& a, const auto& b) {
+				return a.first < b.first;
+			});
+			m_nodes.erase(std::unique(m_nodes.begin(), m_nodes.end(),
+			                  [](const auto& a, const auto& b) {
+				                  return a.first == b.first;
+			                  }),
+			    m_nodes.end());
+			m_nodes.shrink_to_fit();
+		}
+
+		const sync_node_id* find(uint64_t addr) const
+		{
+			if (m_nodes.empty())
+				return nullptr;
+
+			// branchless binary search for the last node <= addr, the ternary compiles down to a cmov
+			auto base = m_nodes.data();
+			auto len  = m_nodes.size();
+			while (len > 1)
+			{
+				const auto half = len / 2;
+				base += base[half].first <= addr ? half : 0;
+				len -= half;
+			}
+
+			return base->first == addr ? &base->second : nullptr;
+		}
+
+		auto begin() const
+		{
+			return m_nodes.begin();
+		}
+
+		auto end() const
+		{
+			return m_nodes.end();
+		}
+	};
 
 	// Sync Tree node array index to node identifier.
 	using sync_tree_node_array_index_to_node_id_t = std::vector<sync_node_id>;
@@ -514,15 +566,22 @@ namespace big
 	{
 	private:
 		static inline sync_node_finder_t finder;
-		static inline bool inited = false;
+		static inline std::atomic_bool inited = false;
+		static inline std::once_flag init_flag;
+		static inline const sync_node_id invalid_node{};
 
 	public:
+		// returns an invalid node id (id 0) for addresses that don't belong to any known node
 		static const sync_node_id& find(eNetObjType obj_type, uintptr_t addr)
 		{
 			if (!is_initialized()) [[unlikely]]
 				init();
 
-			return finder.sync_trees_sync_node_addr_to_ids[(int)obj_type][addr];
+			if ((size_t)obj_type >= sync_node_finder_t::sync_tree_count) [[unlikely]]
+				return invalid_node;
+
+			const auto node_id = finder.sync_trees_sync_node_addr_to_ids[(int)obj_type].find(addr);
+			return node_id ? *node_id : invalid_node;
 		}
 
 		static const sync_node_id& find(uintptr_t addr)
@@ -530,45 +589,52 @@ namespace big
 			if (!is_initialized()) [[unlikely]]
 				init();
 
-			return finder.global_node_identifier[addr];
+			const auto node_id = finder.global_node_identifier.find(addr);
+			return node_id ? *node_id : invalid_node;
 		}
 
-		static sync_node_vft_to_ids& get_object_nodes(eNetObjType obj_type)
+		static const sync_node_vft_to_ids& get_object_nodes(eNetObjType obj_type)
 		{
 			return finder.sync_trees_sync_node_addr_to_ids[(int)obj_type];
 		}
 
 		static bool is_initialized()
 		{
-			return inited;
+			return inited.load(std::memory_order_acquire);
 		}
 
 		static void init()
 		{
-			for (int i = (int)eNetObjType::NET_OBJ_TYPE_AUTOMOBILE; i <= (int)eNetObjType::NET_OBJ_TYPE_TRAIN; i++)
-			{
-				rage::netSyncTree* tree = g_pointers->m_gta.m_get_sync_tree_for_type(*g_pointers->m_gta.m_network_object_mgr, i);
-
-				if (tree->m_child_node_count != finder.sync_trees_node_array_index_to_node_id[i].size())
+			std::call_once(init_flag, [] {
+				for (int i = (int)eNetObjType::NET_OBJ_TYPE_AUTOMOBILE; i <= (int)eNetObjType::NET_OBJ_TYPE_TRAIN; i++)
 				{
-					LOG(FATAL) << "Cache nodes failed " << i << " " << tree->m_child_node_count << " "
-					           << finder.sync_trees_node_array_index_to_node_id[i].size();
+					rage::netSyncTree* tree = g_pointers->m_gta.m_get_sync_tree_for_type(*g_pointers->m_gta.m_network_object_mgr, i);
 
-					throw std::runtime_error("Failed to cache nodes");
-				}
+					if (tree->m_child_node_count != finder.sync_trees_node_array_index_to_node_id[i].size())
+					{
+						LOG(FATAL) << "Cache nodes failed " << i << " " << tree->m_child_node_count << " "
+						           << finder.sync_trees_node_array_index_to_node_id[i].size();
 
-				for (int j = 0; j < tree->m_child_node_count; j++)
-				{
-					const uintptr_t addr = (uintptr_t)tree->m_child_nodes[j];
+						throw std::runtime_error("Failed to cache nodes");
+					}
+
+					for (int j = 0; j < tree->m_child_node_count; j++)
+					{
+						const uintptr_t addr = (uintptr_t)tree->m_child_nodes[j];
 
-					const sync_node_id node_id = finder.sync_trees_node_array_index_to_node_id[i][j];
+						const sync_node_id node_id = finder.sync_trees_node_array_index_to_node_id[i][j];
 
-					finder.sync_trees_sync_node_addr_to_ids[i][addr] = node_id;
-					finder.global_node_identifier.emplace(addr, node_id);
+						finder.sync_trees_sync_node_addr_to_ids[i].add(addr, node_id);
+						finder.global_node_identifier.add(addr, node_id);
+					}
+
+					finder.sync_trees_sync_node_addr_to_ids[i].freeze();
 				}
-			}
 
-			inited = true;
+				finder.global_node_identifier.freeze();
+
+				inited.store(true, std::memory_order_release);
+			});
 		}
 	};
 }
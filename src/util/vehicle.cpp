@@ -1,5 +1,6 @@
 #include "vehicle.hpp"
 #include "pools.hpp"
+#include "services/entity_snapshot/entity_snapshot_service.hpp"
 #include "script_function.hpp"
 
 namespace big::vehicle
@@ -95,33 +96,25 @@ namespace big::vehicle
 
 	Vehicle get_closest_to_location(Vector3 location, float range)
 	{
-		float min_dist   = FLT_MAX;
-		int32_t m_handle = 0;
+		const auto handles   = g_entity_snapshot_service->get_handles(snapshot_entity_type::VEHICLE);
+		const auto positions = g_entity_snapshot_service->get_positions(snapshot_entity_type::VEHICLE);
 
-		for (const auto veh_entity : pools::get_all_vehicles())
-		{
-			const auto veh_ptr = veh_entity;
-			if (!veh_ptr || !veh_ptr->m_navigation)
-				continue;
-
-			auto veh_pos_arr = *veh_ptr->m_navigation->get_position();
-			Vector3 veh_pos(veh_pos_arr.x, veh_pos_arr.y, veh_pos_arr.z);
+		std::vector<std::pair<float, Vehicle>> candidates;
+		g_entity_snapshot_service->for_each_in_radius(snapshot_entity_type::VEHICLE, {location.x, location.y, location.z}, range, [&](std::size_t i) {
+			Vector3 veh_pos(positions[i].x, positions[i].y, positions[i].z);
+			candidates.emplace_back(math::distance_between_vectors(veh_pos, location), handles[i]);
+		});
 
-			float dist = math::distance_between_vectors(veh_pos, location);
-
-			if (dist < min_dist)
-			{
-				int32_t tmp_handle = g_pointers->m_gta.m_ptr_to_handle(veh_ptr);
+		std::sort(candidates.begin(), candidates.end());
 
-				if (entity::take_control_of(tmp_handle))
-				{
-					min_dist = dist;
-					m_handle = tmp_handle;
-				}
-			}
+		// the spans above are invalidated once take_control_of yields into the next frame, hence the copy
+		for (const auto& [dist, veh] : candidates)
+		{
+			if (entity::take_control_of(veh))
+				return veh;
 		}
 
-		return m_handle;
+		return 0;
 	}
 
 	bool set_plate(Vehicle veh, const char* plate)
@@ -685,22 +685,15 @@ namespace big
 				}
 				else
 				{
-					auto all_commands = g_commands;
-					std::vector<std::string> command_names{};
-					for (auto& [hash, cmd] : all_commands)
+					// the list is kept while navigating it, the buffer then holds one of its entries
+					if (std::find(current_suggestion_list.begin(), current_suggestion_list.end(), argument->name) == current_suggestion_list.end())
 					{
-						if (cmd && cmd->get_name().length() > 0)
-							command_names.push_back(cmd->get_name());
-					}
+						std::array<command*, 10> matches;
+						const auto count = command::get_suggestions(argument->name, matches);
 
-					auto filtered_commands = suggestion_list_filtered(command_names, argument->name);
-					if (filtered_commands.size() > 10)
-					{
-						current_suggestion_list = std::vector<std::string>(filtered_commands.begin(), filtered_commands.begin() + 10);
-					}
-					else
-					{
-						current_suggestion_list = filtered_commands;
+						current_suggestion_list.clear();
+						for (std::size_t i = 0; i < count; i++)
+							current_suggestion_list.push_back(matches[i]->get_name());
 					}
 				}
 			}
@@ -18,6 +18,9 @@ namespace big
 					{
 						g_notification_service.push(std::string(script->name()).append("VIEW_DEBUG_SCRIPTS_SCRIPT"_T.data()), script->is_enabled() ? "VIEW_DEBUG_SCRIPTS_RESUMED"_T.data() : "VIEW_DEBUG_SCRIPTS_HALTED"_T.data());
 					}
+
+					ImGui::SameLine();
+					ImGui::TextDisabled("%.3f ms", std::chrono::duration<float, std::milli>(script->average_run_time()).count());
 				}
 			});
 
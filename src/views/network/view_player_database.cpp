@@ -1,6 +1,7 @@
 #include "core/data/block_join_reasons.hpp"
 #include "core/data/command_access_levels.hpp"
 #include "gta/enums.hpp"
+#include "gui/components/filtered_list.hpp"
 #include "pointers.hpp"
 #include "services/api/api_service.hpp"
 #include "services/player_database/player_database_service.hpp"
@@ -44,45 +45,39 @@ namespace big
 		return true;
 	}
 
-	void draw_player_db_entry(const std::shared_ptr<persistent_player>& player, const std::string& lower_search)
+	void draw_player_db_entry(const std::shared_ptr<persistent_player>& player)
 	{
-		std::string name = player->name;
-		std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+		ImGui::PushID(player->rockstar_id);
 
-		if ((lower_search.empty() || name.find(lower_search) != std::string::npos) && apply_filters(player))
-		{
-			ImGui::PushID(player->rockstar_id);
-
-			float circle_size = 7.5f;
-			auto cursor_pos   = ImGui::GetCursorScreenPos();
+		float circle_size = 7.5f;
+		auto cursor_pos   = ImGui::GetCursorScreenPos();
 
-			//render status circle
-			ImGui::GetWindowDrawList()->AddCircleFilled(ImVec2(cursor_pos.x + 4.f + circle_size, cursor_pos.y + 4.f + circle_size), circle_size, ImColor(get_player_color(*player)));
+		//render status circle
+		ImGui::GetWindowDrawList()->AddCircleFilled(ImVec2(cursor_pos.x + 4.f + circle_size, cursor_pos.y + 4.f + circle_size), circle_size, ImColor(get_player_color(*player)));
 
-			//we need some padding
-			ImVec2 cursor = ImGui::GetCursorPos();
-			ImGui::SetCursorPos(ImVec2(cursor.x + 25.f, cursor.y));
+		//we need some padding
+		ImVec2 cursor = ImGui::GetCursorPos();
+		ImGui::SetCursorPos(ImVec2(cursor.x + 25.f, cursor.y));
 
-			if (components::selectable(player->name, player == g_player_database_service->get_selected()))
+		if (components::selectable(player->name, player == g_player_database_service->get_selected()))
+		{
+			if (notes_dirty)
 			{
-				if (notes_dirty)
-				{
-					// Ensure notes are saved
-					g_player_database_service->save();
-					notes_dirty = false;
-				}
-
-				g_player_database_service->set_selected(player);
-				current_player = player;
-				strncpy(name_buf, current_player->name.data(), sizeof(name_buf));
-				strncpy(note_buffer, current_player->notes.data(), sizeof(note_buffer));
+				// Ensure notes are saved
+				g_player_database_service->save(current_player);
+				notes_dirty = false;
 			}
 
-			if (ImGui::IsItemHovered())
-				ImGui::SetTooltip(player_database_service::get_session_type_str(player->session_type));
-
-			ImGui::PopID();
+			g_player_database_service->set_selected(player);
+			current_player = player;
+			strncpy(name_buf, current_player->name.data(), sizeof(name_buf));
+			strncpy(note_buffer, current_player->notes.data(), sizeof(note_buffer));
 		}
+
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip(player_database_service::get_session_type_str(player->session_type));
+
+		ImGui::PopID();
 	}
 
 	void view::player_database()
@@ -90,32 +85,37 @@ namespace big
 		ImGui::SetNextItemWidth(300.f);
 		components::input_text_with_hint("PLAYER"_T, "SEARCH"_T, search, sizeof(search), ImGuiInputTextFlags_None);
 
-		if (ImGui::BeginListBox("###players", {180, static_cast<float>(*g_pointers->m_gta.m_resolution_y - 400 - 38 * 4)}))
-		{
+		static filtered_list<std::shared_ptr<persistent_player>> player_list;
+		player_list.set_source(g_player_database_service->generation(), [](auto& list) {
 			auto& item_arr = g_player_database_service->get_sorted_players();
-			if (item_arr.size() > 0)
+
+			// joinable players first, then the other ones online and the offline ones last
+			for (auto& player : item_arr | std::ranges::views::values)
 			{
-				std::string lower_search = search;
-				std::transform(lower_search.begin(), lower_search.end(), lower_search.begin(), tolower);
+				if (player_database_service::is_joinable_session(player->session_type, player->game_mode))
+					list.add(player, {player->name});
+			}
 
-				for (auto& player : item_arr | std::ranges::views::values)
-				{
-					if (player_database_service::is_joinable_session(player->session_type, player->game_mode))
-						draw_player_db_entry(player, lower_search);
-				}
+			for (auto& player : item_arr | std::ranges::views::values)
+			{
+				if (!player_database_service::is_joinable_session(player->session_type, player->game_mode) && player->session_type != GSType::Invalid
+				    && player->session_type != GSType::Unknown)
+					list.add(player, {player->name});
+			}
 
-				for (auto& player : item_arr | std::ranges::views::values)
-				{
-					if (!player_database_service::is_joinable_session(player->session_type, player->game_mode) && player->session_type != GSType::Invalid
-					    && player->session_type != GSType::Unknown)
-						draw_player_db_entry(player, lower_search);
-				}
+			for (auto& player : item_arr | std::ranges::views::values)
+			{
+				if (player->session_type == GSType::Invalid || player->session_type == GSType::Unknown)
+					list.add(player, {player->name});
+			}
+		});
+		player_list.filter(search, filter_modder | filter_trust << 1 | filter_block_join << 2 | filter_track_player << 3, apply_filters);
 
-				for (auto& player : item_arr | std::ranges::views::values)
-				{
-					if (player->session_type == GSType::Invalid || player->session_type == GSType::Unknown)
-						draw_player_db_entry(player, lower_search);
-				}
+		if (ImGui::BeginListBox("###players", {180, static_cast<float>(*g_pointers->m_gta.m_resolution_y - 400 - 38 * 4)}))
+		{
+			if (g_player_database_service->get_sorted_players().size() > 0)
+			{
+				player_list.draw(draw_player_db_entry);
 			}
 			else
 			{
@@ -145,7 +145,7 @@ namespace big
 				{
 					if (current_player->rockstar_id != selected->rockstar_id)
 						g_player_database_service->update_rockstar_id(selected->rockstar_id, current_player->rockstar_id);
-					g_player_database_service->save();
+					g_player_database_service->save(current_player);
 				}
 
 				ImGui::SetNextItemWidth(250);
@@ -161,7 +161,7 @@ namespace big
 							if (ImGui::Selectable(reason_str, is_selected))
 							{
 								current_player->block_join_reason = i;
-								g_player_database_service->save();
+								g_player_database_service->save(current_player);
 							}
 
 							if (is_selected)
@@ -189,7 +189,7 @@ namespace big
 						if (ImGui::Selectable(name, type == current_player->command_access_level.value_or(g.session.chat_command_default_access_level)))
 						{
 							current_player->command_access_level = type;
-							g_player_database_service->save();
+							g_player_database_service->save(current_player);
 						}
 
 						if (type == current_player->command_access_level.value_or(g.session.chat_command_default_access_level))
@@ -297,7 +297,7 @@ namespace big
 						g_player_database_service->update_rockstar_id(selected->rockstar_id, current_player->rockstar_id);
 
 					selected = current_player;
-					g_player_database_service->save();
+					g_player_database_service->save(current_player);
 				}
 
 				ImGui::SameLine();
@@ -323,7 +323,6 @@ namespace big
 			{
 				g_player_database_service->set_selected(nullptr);
 				g_player_database_service->remove_filtered_players(filter_modder, filter_trust, filter_block_join, filter_track_player);
-				g_player_database_service->save();
 				ImGui::CloseCurrentPopup();
 			}
 			ImGui::SameLine();
@@ -382,6 +381,16 @@ namespace big
 			ImGui::Checkbox("VIEW_NET_PLAYER_DB_NOTIFY_ON_BECOME_HOST"_T.data(), &g.player_db.notify_on_become_host);
 			ImGui::Checkbox("VIEW_NET_PLAYER_DB_NOTIFY_JOB_LOBBY_CHANGE"_T.data(), &g.player_db.notify_on_transition_change);
 			ImGui::Checkbox("VIEW_NET_PLAYER_DB_NOTIFY_MISSION_CHANGE"_T.data(), &g.player_db.notify_on_mission_change);
+
+			if (g.player_db.update_player_online_states)
+			{
+				const auto stats = g_player_database_service->get_presence_stats();
+				const auto p50 = std::chrono::duration_cast<std::chrono::seconds>(stats.m_staleness_p50).count();
+				const auto p95 = std::chrono::duration_cast<std::chrono::seconds>(stats.m_staleness_p95).count();
+				const auto p99 = std::chrono::duration_cast<std::chrono::seconds>(stats.m_staleness_p99).count();
+				ImGui::Text(std::vformat("VIEW_NET_PLAYER_DB_REFRESHED_PLAYERS_PER_SECOND"_T, std::make_format_args(stats.m_players_per_second)).data());
+				ImGui::Text(std::vformat("VIEW_NET_PLAYER_DB_PRESENCE_STALENESS"_T, std::make_format_args(p50, p95, p99)).data());
+			}
 			ImGui::TreePop();
 		}
 		if (ImGui::TreeNode("VIEW_NET_PLAYER_DB_FILTERS"_T.data()))
@@ -406,7 +415,7 @@ namespace big
 		if (ImGui::Button("ADD"_T.data()))
 		{
 			current_player = g_player_database_service->add_player(new_rockstar_id, new_name);
-			g_player_database_service->save();
+			g_player_database_service->save(current_player);
 		}
 		ImGui::SameLine();
 		if (ImGui::Button("SEARCH"_T.data()))
@@ -153,7 +153,7 @@ namespace big
 			    {
 				    auto entry = g_player_database_service->get_or_create_player(g_player_service->get_selected());
 				    entry->is_trusted = g_player_service->get_selected()->is_trusted;
-				    g_player_database_service->save();
+				    g_player_database_service->save(entry);
 			    }
 			    ImGui::Checkbox("VIEW_PLAYER_INFO_BLOCK_EXPLOSIONS"_T.data(), &g_player_service->get_selected()->block_explosions);
 			    ImGui::Checkbox("VIEW_PLAYER_INFO_BLOCK_CLONE_CREATE"_T.data(), &g_player_service->get_selected()->block_clone_create);
@@ -172,8 +172,9 @@ namespace big
 					            type == g_player_service->get_selected()->command_access_level.value_or(g.session.chat_command_default_access_level)))
 					    {
 						    g.session.chat_command_default_access_level = type;
-						    g_player_database_service->get_or_create_player(g_player_service->get_selected())->command_access_level = type;
-						    g_player_database_service->save();
+						    auto entry                  = g_player_database_service->get_or_create_player(g_player_service->get_selected());
+						    entry->command_access_level = type;
+						    g_player_database_service->save(entry);
 					    }
 
 					    if (type == g_player_service->get_selected()->command_access_level.value_or(g.session.chat_command_default_access_level))
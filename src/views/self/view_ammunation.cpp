@@ -1,4 +1,5 @@
 #include "gta/weapons.hpp"
+#include "gui/components/filtered_list.hpp"
 #include "services/gta_data/gta_data_service.hpp"
 #include "services/persist_weapons/persist_weapons.hpp"
 #include "views/view.hpp"
@@ -69,54 +70,46 @@ namespace big
 		}
 		if (ImGui::BeginPopup("##weapons_popup", ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove))
 		{
-			std::map<std::string, weapon_item> sorted_map;
-			for (const auto& [_, weapon] : g_gta_data_service.weapons())
-			{
-				sorted_map.emplace(weapon.m_display_name, weapon);
-			}
+			static filtered_list<const weapon_item*> weapon_list;
+			weapon_list.set_source(g_gta_data_service.generation(), [](auto& list) {
+				// sorted by display name, weapons sharing one are only listed once
+				std::map<std::string_view, const weapon_item*> sorted_map;
+				for (const auto& [_, weapon] : g_gta_data_service.weapons())
+				{
+					if (weapon.m_display_name != "NULL" && weapon.m_hash != NULL)
+						sorted_map.emplace(weapon.m_display_name, &weapon);
+				}
+
+				for (const auto& [display_name, weapon] : sorted_map)
+					list.add(weapon, {display_name});
+			});
 
 			ImGui::Text("SEARCH"_T.data());
 			ImGui::SameLine();
 			ImGui::SetNextItemWidth(250.f);
 			components::input_text("##search_weapon", search_weapon, sizeof(search_weapon));
 
-			std::string search_lower = search_weapon;
-			std::transform(search_lower.begin(), search_lower.end(), search_lower.begin(), ::tolower);
-
-			bool found_match = false;
-			for (const auto& weapon : sorted_map)
-			{
-				auto weapon_name = weapon.second.m_display_name;
-				auto weapon_hash = weapon.second.m_hash;
-
-				if (weapon_name == "NULL" || weapon_hash == NULL)
-					continue;
+			weapon_list.filter(search_weapon);
 
-				std::string weapon_lower = weapon_name;
-				std::transform(weapon_lower.begin(), weapon_lower.end(), weapon_lower.begin(), ::tolower);
-
-				if (weapon_lower.find(search_lower) != std::string::npos)
+			weapon_list.draw([](const weapon_item* weapon) {
+				if (ImGui::Selectable(weapon->m_display_name.c_str()))
 				{
-					found_match = true;
-					if (ImGui::Selectable(weapon_name.c_str()))
-					{
-						selected_weapon          = weapon_name;
-						selected_weapon_hash     = weapon_hash;
-						selected_attachment      = "SELECT"_T.data();
-						selected_attachment_hash = 0;
-						selected_tint            = 0;
-					}
-					if (ImGui::IsItemHovered() && !weapon.second.m_display_desc.empty())
-					{
-						ImGui::BeginTooltip();
-						ImGui::PushTextWrapPos(ImGui::GetFontSize() * 35);
-						ImGui::TextUnformatted(weapon.second.m_display_desc.c_str());
-						ImGui::PopTextWrapPos();
-						ImGui::EndTooltip();
-					}
+					selected_weapon          = weapon->m_display_name;
+					selected_weapon_hash     = weapon->m_hash;
+					selected_attachment      = "SELECT"_T.data();
+					selected_attachment_hash = 0;
+					selected_tint            = 0;
 				}
-			}
-			if (!found_match)
+				if (ImGui::IsItemHovered() && !weapon->m_display_desc.empty())
+				{
+					ImGui::BeginTooltip();
+					ImGui::PushTextWrapPos(ImGui::GetFontSize() * 35);
+					ImGui::TextUnformatted(weapon->m_display_desc.c_str());
+					ImGui::PopTextWrapPos();
+					ImGui::EndTooltip();
+				}
+			});
+			if (weapon_list.empty())
 				ImGui::Text("NO_WEAPON_IN_REGISTRY"_T.data());
 			ImGui::EndPopup();
 		}
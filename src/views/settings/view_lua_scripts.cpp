@@ -69,8 +69,13 @@ namespace big
 
 			ImGui::Text(std::format("{}: {}",
 			    "VIEW_LUA_SCRIPTS_SCRIPTS_REGISTERED"_T,
-			    selected_module.lock()->m_registered_scripts.size())
+			    selected_module.lock()->is_disabled() ? 0 : selected_module.lock()->executor().size())
 			                .c_str());
+			if (!selected_module.lock()->is_disabled())
+			{
+				for (const auto& name : selected_module.lock()->executor().names())
+					ImGui::BulletText("%s", name.c_str());
+			}
 			ImGui::Text(std::format("{}: {}",
 			    "VIEW_LUA_SCRIPTS_MEMORY_PATCHES_REGISTERED"_T,
 			    selected_module.lock()->m_registered_patches.size())
@@ -1,4 +1,5 @@
 #include "fiber_pool.hpp"
+#include "gui/components/filtered_list.hpp"
 #include "natives.hpp"
 #include "services/gta_data/gta_data_service.hpp"
 #include "services/model_preview/model_preview_service.hpp"
@@ -64,35 +65,18 @@ namespace big
 		ImGui::SetNextItemWidth(300.f);
 		components::input_text_with_hint("MODEL_NAME"_T, "SEARCH"_T, search, sizeof(search), ImGuiInputTextFlags_None);
 
-		vehicle_map calculated_map{};
-
-		if (g_gta_data_service.vehicles().size() > 0)
-		{
-			for (auto& item : g_gta_data_service.vehicles())
-			{
-				const auto& vehicle = item.second;
-
-				std::string display_name         = vehicle.m_display_name;
-				std::string display_manufacturer = vehicle.m_display_manufacturer;
-				std::string clazz                = vehicle.m_vehicle_class;
-
-				std::transform(display_name.begin(), display_name.end(), display_name.begin(), ::tolower);
-				std::transform(display_manufacturer.begin(), display_manufacturer.end(), display_manufacturer.begin(), ::tolower);
-
-				std::string lower_search = search;
-				std::transform(lower_search.begin(), lower_search.end(), lower_search.begin(), tolower);
-
-				if ((selected_class == -1 || class_arr[selected_class] == clazz)
-				    && (display_name.find(lower_search) != std::string::npos || display_manufacturer.find(lower_search) != std::string::npos))
-				{
-					calculated_map.emplace(item);
-				}
-			}
-		}
+		static filtered_list<const vehicle_item*> vehicle_list;
+		vehicle_list.set_source(g_gta_data_service.generation(), [](auto& list) {
+			for (const auto& [_, vehicle] : g_gta_data_service.vehicles())
+				list.add(&vehicle, {vehicle.m_display_name, vehicle.m_display_manufacturer});
+		});
+		vehicle_list.filter(search, selected_class, [&class_arr](const vehicle_item* vehicle) {
+			return selected_class == -1 || class_arr[selected_class] == vehicle->m_vehicle_class;
+		});
 
 		static const auto over_30 = (30 * ImGui::GetTextLineHeightWithSpacing() + 2);
-		auto calculated_size      = calculated_map.size();
-		if (calculated_map.size() == 0)
+		auto calculated_size      = vehicle_list.size();
+		if (vehicle_list.empty())
 		{
 			calculated_size++;
 		}
@@ -160,11 +144,10 @@ namespace big
 				}
 			}
 
-			if (calculated_map.size() > 0)
+			if (!vehicle_list.empty())
 			{
-				for (auto& item : calculated_map)
-				{
-					const auto& vehicle = item.second;
+				vehicle_list.draw([](const vehicle_item* item) {
+					const auto& vehicle = *item;
 					ImGui::PushID(vehicle.m_hash);
 					components::selectable(vehicle.m_display_name, false, [&vehicle] {
 						const auto spawn_location = vehicle::get_spawn_location(g.spawn_vehicle.spawn_inside, vehicle.m_hash);
@@ -204,7 +187,7 @@ namespace big
 					{
 						g_model_preview_service->show_vehicle(vehicle.m_hash, g.spawn_vehicle.spawn_maxed);
 					}
-				}
+				});
 			}
 			else
 			{
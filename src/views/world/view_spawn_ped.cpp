@@ -1,4 +1,5 @@
 #include "backend/looped/looped.hpp"
+#include "gui/components/filtered_list.hpp"
 #include "natives.hpp"
 #include "pointers.hpp"
 #include "services/gta_data/gta_data_service.hpp"
@@ -368,8 +369,14 @@ namespace big
 						bool is_open      = true;
 						bool item_hovered = false;
 
-						std::string lower_search = ped_model_buf;
-						std::transform(lower_search.begin(), lower_search.end(), lower_search.begin(), tolower);
+						static filtered_list<const ped_item*> ped_list;
+						ped_list.set_source(g_gta_data_service.generation(), [&ped_arr](auto& list) {
+							for (const auto& [_, item] : ped_arr)
+								list.add(&item, {item.m_name});
+						});
+						ped_list.filter(ped_model_buf, selected_ped_type, [&ped_type_arr](const ped_item* item) {
+							return selected_ped_type == -1 || ped_type_arr[selected_ped_type] == item->m_ped_type;
+						});
 
 						ImGui::SetNextWindowPos({ImGui::GetItemRectMin().x, ImGui::GetItemRectMax().y});
 						ImGui::SetNextWindowSize({300, 300});
@@ -378,38 +385,29 @@ namespace big
 							ImGui::BringWindowToDisplayFront(ImGui::GetCurrentWindow());
 							ped_model_dropdown_focused |= ImGui::IsWindowFocused();
 
-							for (const auto& [_, item] : ped_arr)
-							{
-								std::string ped_type = item.m_ped_type;
-								std::string name     = item.m_name;
+							ped_list.draw([&](const ped_item* item) {
+								bool selectable_highlighted = stricmp(ped_model_buf, item->m_name) == 0;
+								bool selectable_clicked = ImGui::Selectable(item->m_name, selectable_highlighted);
+								ped_model_dropdown_focused |= ImGui::IsItemFocused();
 
-								std::transform(name.begin(), name.end(), name.begin(), tolower);
-
-								if ((selected_ped_type == -1 || ped_type_arr[selected_ped_type] == ped_type) && (name.find(lower_search) != std::string::npos))
+								if (selectable_clicked)
 								{
-									bool selectable_highlighted = lower_search == name;
-									bool selectable_clicked = ImGui::Selectable(item.m_name, selectable_highlighted);
-									ped_model_dropdown_focused |= ImGui::IsItemFocused();
-
-									if (selectable_clicked)
-									{
-										strncpy(ped_model_buf, item.m_name, 64);
-										ped_model_dropdown_open    = false;
-										ped_model_dropdown_focused = false;
-									}
+									strncpy(ped_model_buf, item->m_name, 64);
+									ped_model_dropdown_open    = false;
+									ped_model_dropdown_focused = false;
+								}
 
-									if (selectable_highlighted)
-									{
-										ImGui::SetItemDefaultFocus();
-									}
+								if (selectable_highlighted)
+								{
+									ImGui::SetItemDefaultFocus();
+								}
 
-									if (ImGui::IsItemHovered())
-									{
-										item_hovered = true;
-										g_model_preview_service->show_ped(item.m_hash);
-									}
+								if (ImGui::IsItemHovered())
+								{
+									item_hovered = true;
+									g_model_preview_service->show_ped(item->m_hash);
 								}
-							}
+							});
 							ImGui::End();
 						}
 